@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+/**
+ * @brief Minimal microbenchmark runner for env:native
+ *
+ * Runs fn() for a warm-up pass, then `iterations` timed calls, and prints
+ * the mean time per call. Results are host numbers: compare them between
+ * two commits on the same machine, not with Teensy timings.
+ */
+namespace Bench {
+
+/* Keeps a value alive for the optimizer without a memory barrier per call */
+template <typename T>
+inline void keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename Fn>
+void run(const char* name, uint32_t iterations, Fn&& fn) {
+    using Clock = std::chrono::steady_clock;
+
+    for (uint32_t i = 0; i < iterations / 10 + 1; ++i) {
+        fn(i);
+    }
+
+    const Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        fn(i);
+    }
+    const double ns =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+
+    printf("  %-48s %10.1f ns/op  (%u runs)\n", name, ns, iterations);
+}
+
+}  // namespace Bench
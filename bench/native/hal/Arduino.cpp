@@ -0,0 +1,43 @@
+#include "Arduino.h"
+
+#include <chrono>
+#include <thread>
+
+uint32_t nativeDemcr = 0;
+uint32_t nativeDwtCtrl = 0;
+
+NativeSerial Serial;
+
+namespace NativeHal {
+
+uint64_t nanos() {
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point start = Clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+uint32_t cycles() {
+    return static_cast<uint32_t>(nanos() * (F_CPU_ACTUAL / 1000000u) / 1000u);
+}
+
+}  // namespace NativeHal
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+size_t Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length <= 0) return 0;
+    const size_t size = static_cast<size_t>(length) < sizeof(buffer) ? length : sizeof(buffer) - 1;
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+}
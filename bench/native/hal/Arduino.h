@@ -0,0 +1,180 @@
+#pragma once
+
+/*
+ * Arduino.h - Host HAL mock for env:native
+ *
+ * Just what the core, InputBinding, MidiMapper and TextUtils sources use:
+ * clocks, interrupt masking, the DWT cycle counter, Print / Serial on
+ * stdout and a String over std::string. Time runs on the host steady
+ * clock; DWT cycles are scaled to F_CPU_ACTUAL so cycle -> us conversions
+ * in the core read the same as on the Teensy.
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <utility>
+
+#define DMAMEM
+#define EXTMEM
+#define FASTRUN
+#define FLASHMEM
+#define PROGMEM
+
+#define F_CPU_ACTUAL 600000000u
+
+namespace NativeHal {
+uint64_t nanos();
+uint32_t cycles();
+}  // namespace NativeHal
+
+extern uint32_t nativeDemcr;
+extern uint32_t nativeDwtCtrl;
+#define ARM_DEMCR nativeDemcr
+#define ARM_DEMCR_TRCENA (1u << 24)
+#define ARM_DWT_CTRL nativeDwtCtrl
+#define ARM_DWT_CTRL_CYCCNTENA (1u << 0)
+#define ARM_DWT_CYCCNT (NativeHal::cycles())
+
+inline uint32_t millis() {
+    return static_cast<uint32_t>(NativeHal::nanos() / 1000000u);
+}
+
+inline uint32_t micros() {
+    return static_cast<uint32_t>(NativeHal::nanos() / 1000u);
+}
+
+/* No PSRAM on the host: the Teensy fallback, the heap */
+inline void* extmem_malloc(size_t size) {
+    return malloc(size);
+}
+
+inline void extmem_free(void* pointer) {
+    free(pointer);
+}
+
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+/* Single-threaded host: nothing to mask */
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+template <typename T, typename L, typename H>
+inline T constrain(T value, L low, H high) {
+    return value < low ? static_cast<T>(low) : (value > high ? static_cast<T>(high) : value);
+}
+
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+
+    size_t print(const char* text) {
+        return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+    }
+    size_t print(char c) {
+        return write(reinterpret_cast<const uint8_t*>(&c), 1);
+    }
+    size_t print(int value) {
+        return printf("%d", value);
+    }
+    size_t print(unsigned value) {
+        return printf("%u", value);
+    }
+    size_t print(long value) {
+        return printf("%ld", value);
+    }
+    size_t print(unsigned long value) {
+        return printf("%lu", value);
+    }
+    size_t print(double value) {
+        return printf("%.2f", value);
+    }
+
+    size_t println() {
+        return print('\n');
+    }
+    template <typename T>
+    size_t println(T value) {
+        return print(value) + println();
+    }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class NativeSerial : public Print {
+public:
+    void begin(uint32_t) {}
+    size_t write(const uint8_t* data, size_t length) override {
+        return fwrite(data, 1, length, stdout);
+    }
+    int available() {
+        return 0;
+    }
+    int read() {
+        return -1;
+    }
+    explicit operator bool() const {
+        return true;
+    }
+};
+
+extern NativeSerial Serial;
+
+/* Arduino String, the subset TextUtils uses */
+class String {
+public:
+    String() = default;
+    String(const char* text) : text_(text ? text : "") {}
+    String(const std::string& text) : text_(text) {}
+    explicit String(char c) : text_(1, c) {}
+
+    unsigned int length() const {
+        return static_cast<unsigned int>(text_.size());
+    }
+    const char* c_str() const {
+        return text_.c_str();
+    }
+    char operator[](unsigned int index) const {
+        return index < text_.size() ? text_[index] : '\0';
+    }
+    String substring(unsigned int from) const {
+        return from < text_.size() ? String(text_.substr(from)) : String();
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        return from < text_.size() ? String(text_.substr(from, to - from)) : String();
+    }
+
+    String& operator+=(const String& other) {
+        text_ += other.text_;
+        return *this;
+    }
+    String& operator+=(const char* other) {
+        text_ += other;
+        return *this;
+    }
+    String& operator+=(char c) {
+        text_ += c;
+        return *this;
+    }
+
+    friend String operator+(const String& a, const String& b) {
+        return String(a.text_ + b.text_);
+    }
+    friend String operator+(const String& a, const char* b) {
+        return String(a.text_ + b);
+    }
+    friend bool operator==(const String& a, const String& b) {
+        return a.text_ == b.text_;
+    }
+
+private:
+    std::string text_;
+};
@@ -0,0 +1,151 @@
+/*
+ * Host microbenchmarks (env:native)
+ *
+ *   pio run -e native && .pio/build/native/program
+ *
+ * Hot paths of the core on the PC: EventBus emit / on / off, InputBinding
+ * dispatch with full binding tables, MidiMapper encoder lookups and
+ * TextUtils two-line layout. Watch for regressions between commits; the
+ * absolute numbers are host numbers.
+ */
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "Bench.hpp"
+#include "config/InputID.hpp"
+#include "config/System.hpp"
+#include "core/event/EventBus.hpp"
+#include "core/event/Events.hpp"
+#include "core/factory/MidiFactory.hpp"
+#include "core/input/InputBinding.hpp"
+#include "core/interface/midi/MidiOutput.hpp"
+#include "core/midi/MidiMapper.hpp"
+#include "util/TextUtils.hpp"
+
+namespace {
+
+constexpr uint32_t RUNS = 200000;
+
+/* Counts what MidiMapper sends instead of writing USB */
+class NullMidiOut : public MidiOutput {
+public:
+    void sendControlChange(MidiChannelValue, MidiCCValue, uint8_t) override {
+        ++messages;
+    }
+    void sendNoteOn(MidiChannelValue, MidiNoteValue, uint8_t) override {}
+    void sendNoteOff(MidiChannelValue, MidiNoteValue, uint8_t) override {}
+    void sendProgramChange(MidiChannelValue, uint8_t) override {}
+    void sendPitchBend(MidiChannelValue, uint16_t) override {}
+    void sendChannelPressure(MidiChannelValue, uint8_t) override {}
+    void sendSysEx(const uint8_t*, uint16_t) override {}
+
+    uint32_t messages = 0;
+};
+
+void benchEventBus() {
+    printf("EventBus\n");
+    EventBus bus;
+    uint32_t calls = 0;
+
+    Bench::run("emit, no subscriber", RUNS, [&](uint32_t i) {
+        bus.emit(EncoderChangedEvent(EncoderID::MACRO_1, (i & 0xFF) / 255.0f));
+    });
+
+    for (int s = 0; s < 8; ++s) {
+        bus.on(EventCategory::Input, InputEvent::EncoderChanged,
+               [&calls](const Event&) { ++calls; });
+    }
+    Bench::run("emit, 8 subscribers", RUNS, [&](uint32_t i) {
+        bus.emit(EncoderChangedEvent(EncoderID::MACRO_1, (i & 0xFF) / 255.0f));
+    });
+
+    Bench::run("on + off", RUNS, [&](uint32_t) {
+        const SubscriptionId id = bus.on(EventCategory::MIDI, MidiEvent::CC,
+                                         [&calls](const Event&) { ++calls; });
+        bus.off(id);
+    });
+    Bench::keep(calls);
+}
+
+void benchInputBinding() {
+    printf("InputBinding (tables full: %u button, %u encoder bindings)\n",
+           static_cast<unsigned>(System::Memory::MAX_BUTTON_BINDINGS),
+           static_cast<unsigned>(System::Memory::MAX_ENCODER_BINDINGS));
+    EventBus bus;
+    InputBinding bindings(bus);
+    uint32_t actions = 0;
+
+    // Spread over every control so lookups see a full table
+    for (size_t i = 0; i < System::Memory::MAX_BUTTON_BINDINGS; ++i) {
+        const ButtonID id = BUTTON_IDS[i % BUTTON_ID_COUNT];
+        if (i / BUTTON_ID_COUNT % 2 == 0) {
+            bindings.onPressed(id, [&actions]() { ++actions; });
+        } else {
+            bindings.onReleased(id, [&actions]() { ++actions; });
+        }
+    }
+    for (size_t i = 0; i < System::Memory::MAX_ENCODER_BINDINGS; ++i) {
+        bindings.onTurned(ENCODER_IDS[i % ENCODER_ID_COUNT], [&actions](float) { ++actions; });
+    }
+
+    Bench::run("button press + release", RUNS, [&](uint32_t i) {
+        const ButtonID id = BUTTON_IDS[i % BUTTON_ID_COUNT];
+        bus.emit(ButtonPressEvent(id, true, micros()));
+        bus.emit(ButtonReleaseEvent(id, micros()));
+    });
+    Bench::run("encoder turn", RUNS, [&](uint32_t i) {
+        bus.emit(EncoderChangedEvent(ENCODER_IDS[i % ENCODER_ID_COUNT], (i & 0xFF) / 255.0f));
+    });
+    Bench::run("processTick, nothing due", RUNS, [&](uint32_t) { bindings.processTick(millis()); });
+    Bench::keep(actions);
+}
+
+void benchMidiMapper() {
+    printf("MidiMapper (default mappings)\n");
+    EventBus bus;
+    NullMidiOut out;
+    MidiMapper mapper(out, bus, MidiFactory::createDefault());
+
+    // Inside the rate limit window: lookup + pending value, the common case while turning
+    Bench::run("encoder change -> mapping", RUNS, [&](uint32_t i) {
+        bus.emit(EncoderChangedEvent(ENCODER_IDS[i % ENCODER_ID_COUNT], (i & 0x7F) / 127.0f,
+                                     micros()));
+    });
+    Bench::run("update(), pending sends", RUNS, [&](uint32_t) { mapper.update(); });
+    Bench::keep(out.messages);
+}
+
+void benchTextUtils() {
+    printf("TextUtils\n");
+    const lv_font_t* font = &lv_font_montserrat_12;
+    const char* const names[] = {
+        "Cutoff", "Filter Envelope Amount", "Oscillator 2 Fine Tune Semitones",
+        "Reverb Pre-Delay Time", "LFO 1 Rate Sync To Host Tempo",
+    };
+    constexpr size_t NAME_COUNT = sizeof(names) / sizeof(names[0]);
+    char out[64];
+
+    Bench::run("formatTextForTwoLines (buffer, memoized)", RUNS, [&](uint32_t i) {
+        Bench::keep(TextUtils::formatTextForTwoLines(names[i % NAME_COUNT], 70, font, out,
+                                                     sizeof(out)));
+    });
+    Bench::run("formatTextForTwoLines (String)", RUNS / 10, [&](uint32_t i) {
+        const String text = TextUtils::formatTextForTwoLines(String(names[i % NAME_COUNT]), 70,
+                                                             font);
+        Bench::keep(text.length());
+    });
+}
+
+}  // namespace
+
+int main() {
+    lv_init();
+    lv_tick_set_cb([]() -> uint32_t { return millis(); });
+
+    benchEventBus();
+    benchInputBinding();
+    benchMidiMapper();
+    benchTextUtils();
+    return 0;
+}
@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+"""
+Convert LVGL binary fonts (lv_font_conv --format bin) to native lv_font_t C sources.
+
+A binfont has to be parsed by lv_binfont_create_from_buffer() at boot, which
+allocates its glyph descriptors, cmaps and bitmaps in the LVGL heap. The C
+source produced here holds the same tables as const data, linked into flash:
+nothing to parse, nothing allocated.
+
+Input is either a raw .bin file or the xxd array (.c.inc) emitted by the old
+generate_font.sh. The layout read here is the one of LVGL's
+lv_binfont_loader.c (tables head, cmap, loca, glyf, optional kern).
+
+Usage:
+    python3 script/binfont_to_c.py <font.bin|font.c.inc> <font_name> <out.c>
+"""
+
+import re
+import struct
+import sys
+
+HEADER_FORMAT = "<IHHHhHhHhhHHBBBBBBBBBBhH"
+
+CMAP_FORMAT0_FULL = 0
+CMAP_SPARSE_FULL = 1
+CMAP_FORMAT0_TINY = 2
+CMAP_SPARSE_TINY = 3
+
+CMAP_TYPE_NAMES = {
+    CMAP_FORMAT0_FULL: "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL",
+    CMAP_SPARSE_FULL: "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL",
+    CMAP_FORMAT0_TINY: "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY",
+    CMAP_SPARSE_TINY: "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY",
+}
+
+BITMAP_FORMAT_NAMES = {
+    0: "LV_FONT_FMT_TXT_PLAIN",
+    1: "LV_FONT_FMT_TXT_COMPRESSED",
+    2: "LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER",
+}
+
+SUBPX_NAMES = {0: "LV_FONT_SUBPX_NONE", 1: "LV_FONT_SUBPX_HOR", 2: "LV_FONT_SUBPX_VER"}
+
+
+def load_bytes(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not path.endswith(".c.inc"):
+        return data
+    text = data.decode("ascii")
+    body = text[text.index("{") + 1 : text.rindex("}")]
+    return bytes(int(token, 16) for token in re.findall(r"0x[0-9a-fA-F]{2}", body))
+
+
+class BitReader:
+    """MSB-first bit reader, as in lv_binfont_loader.c"""
+
+    def __init__(self, data, offset):
+        self.data = data
+        self.offset = offset
+        self.bit_pos = -1
+        self.byte_value = 0
+
+    def read(self, n):
+        value = 0
+        for _ in range(n):
+            self.bit_pos -= 1
+            if self.bit_pos < 0:
+                self.bit_pos = 7
+                self.byte_value = self.data[self.offset]
+                self.offset += 1
+            value = (value << 1) | ((self.byte_value >> self.bit_pos) & 1)
+        return value
+
+    def read_signed(self, n):
+        value = self.read(n)
+        if n and value & (1 << (n - 1)):
+            value -= 1 << n
+        return value
+
+
+def read_table(data, start, label):
+    length, name = struct.unpack_from("<I4s", data, start)
+    if name != label.encode("ascii"):
+        raise ValueError("expected table '%s' at %d, found %r" % (label, start, name))
+    return length
+
+
+def parse(data):
+    head_start = 0
+    head_length = read_table(data, head_start, "head")
+    header = struct.unpack_from(HEADER_FORMAT, data, head_start + 8)
+    (_version, _tables, _size, ascent, descent, _typo_ascent, _typo_descent, _gap, _min_y,
+     _max_y, default_adv, kern_scale, loc_format, _glyph_id_format, adv_format, bpp, xy_bits,
+     wh_bits, adv_bits, compression, subpx, _pad, underline_pos, underline_thick) = header
+
+    cmap_start = head_start + head_length
+    cmap_length = read_table(data, cmap_start, "cmap")
+    (cmap_count,) = struct.unpack_from("<I", data, cmap_start + 8)
+    cmaps = []
+    for i in range(cmap_count):
+        (offset, range_start, range_length, glyph_id_start, entries, fmt, _pad) = (
+            struct.unpack_from("<IIHHHBB", data, cmap_start + 12 + 16 * i))
+        cmap = {
+            "range_start": range_start,
+            "range_length": range_length,
+            "glyph_id_start": glyph_id_start,
+            "type": fmt,
+            "unicode_list": None,
+            "glyph_id_ofs_list": None,
+            "list_length": 0,
+        }
+        at = cmap_start + offset
+        if fmt == CMAP_FORMAT0_FULL:
+            cmap["glyph_id_ofs_list"] = list(data[at : at + entries])
+            cmap["list_length"] = range_length
+        elif fmt in (CMAP_SPARSE_FULL, CMAP_SPARSE_TINY):
+            cmap["unicode_list"] = list(struct.unpack_from("<%dH" % entries, data, at))
+            cmap["list_length"] = entries
+            if fmt == CMAP_SPARSE_FULL:
+                cmap["glyph_id_ofs_list"] = list(
+                    struct.unpack_from("<%dH" % entries, data, at + 2 * entries))
+        cmaps.append(cmap)
+
+    loca_start = cmap_start + cmap_length
+    loca_length = read_table(data, loca_start, "loca")
+    (loca_count,) = struct.unpack_from("<I", data, loca_start + 8)
+    loca_type = "H" if loc_format == 0 else "I"
+    glyph_offsets = list(struct.unpack_from("<%d%s" % (loca_count, loca_type), data,
+                                            loca_start + 12))
+
+    glyf_start = loca_start + loca_length
+    glyf_length = read_table(data, glyf_start, "glyf")
+
+    if glyf_start + glyf_length < len(data):
+        kern_length, kern_name = struct.unpack_from("<I4s", data, glyf_start + glyf_length)
+        if kern_name == b"kern" and kern_length > 8:
+            raise ValueError("kerning tables are not supported, regenerate with --no-kerning")
+
+    nbits = adv_bits + 2 * xy_bits + 2 * wh_bits
+    glyphs = []
+    bitmap = bytearray()
+    for i, glyph_offset in enumerate(glyph_offsets):
+        reader = BitReader(data, glyf_start + glyph_offset)
+        adv_w = default_adv if adv_bits == 0 else reader.read(adv_bits)
+        if adv_format == 0:
+            adv_w *= 16
+        ofs_x = reader.read_signed(xy_bits)
+        ofs_y = reader.read_signed(xy_bits)
+        box_w = reader.read(wh_bits)
+        box_h = reader.read(wh_bits)
+
+        next_offset = glyph_offsets[i + 1] if i < loca_count - 1 else glyf_length
+        bmp_size = next_offset - glyph_offset - nbits // 8
+
+        if i == 0:
+            adv_w = box_w = box_h = ofs_x = ofs_y = 0
+
+        glyphs.append((len(bitmap), adv_w, box_w, box_h, ofs_x, ofs_y))
+
+        if bmp_size <= 0:
+            continue
+        if nbits % 8 == 0:
+            at = glyf_start + glyph_offset + nbits // 8
+            bitmap += data[at : at + bmp_size]
+        else:
+            for _ in range(bmp_size - 1):
+                bitmap.append(reader.read(8))
+            last = reader.read(8 - nbits % 8)
+            bitmap.append((last << (nbits % 8)) & 0xFF)
+
+    return {
+        "line_height": ascent - descent,
+        "base_line": -descent,
+        "subpx": subpx,
+        "underline_position": underline_pos,
+        "underline_thickness": underline_thick,
+        "bpp": bpp,
+        "kern_scale": kern_scale,
+        "bitmap_format": compression,
+        "cmaps": cmaps,
+        "glyphs": glyphs,
+        "bitmap": bytes(bitmap),
+    }
+
+
+def format_list(values, per_line, width=0):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i : i + per_line]
+        lines.append("    " + ", ".join(v if isinstance(v, str) else str(v).rjust(width)
+                                        for v in chunk) + ",")
+    return "\n".join(lines)
+
+
+def emit(font, name, source):
+    out = []
+    out.append("/*")
+    out.append(" * %s - generated by script/binfont_to_c.py from %s" % (name, source))
+    out.append(" * Native LVGL font, const data in flash. Do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append("#include <lvgl.h>")
+    out.append("")
+
+    out.append("static const uint8_t glyph_bitmap[] = {")
+    out.append(format_list(["0x%02x" % b for b in font["bitmap"]], 16))
+    out.append("};")
+    out.append("")
+
+    out.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    for glyph in font["glyphs"]:
+        out.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, "
+                   ".ofs_x = %d, .ofs_y = %d}," % glyph)
+    out.append("};")
+    out.append("")
+
+    for i, cmap in enumerate(font["cmaps"]):
+        if cmap["unicode_list"] is not None:
+            out.append("static const uint16_t unicode_list_%d[] = {" % i)
+            out.append(format_list(["0x%x" % u for u in cmap["unicode_list"]], 12))
+            out.append("};")
+            out.append("")
+        if cmap["glyph_id_ofs_list"] is not None:
+            ctype = "uint8_t" if cmap["type"] == CMAP_FORMAT0_FULL else "uint16_t"
+            out.append("static const %s glyph_id_ofs_list_%d[] = {" % (ctype, i))
+            out.append(format_list(cmap["glyph_id_ofs_list"], 16))
+            out.append("};")
+            out.append("")
+
+    out.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+    for i, cmap in enumerate(font["cmaps"]):
+        unicode_list = "unicode_list_%d" % i if cmap["unicode_list"] is not None else "NULL"
+        ofs_list = ("glyph_id_ofs_list_%d" % i
+                    if cmap["glyph_id_ofs_list"] is not None else "NULL")
+        out.append("    {.range_start = %d, .range_length = %d, .glyph_id_start = %d,"
+                   % (cmap["range_start"], cmap["range_length"], cmap["glyph_id_start"]))
+        out.append("     .unicode_list = %s, .glyph_id_ofs_list = %s, .list_length = %d,"
+                   % (unicode_list, ofs_list, cmap["list_length"]))
+        out.append("     .type = %s}," % CMAP_TYPE_NAMES[cmap["type"]])
+    out.append("};")
+    out.append("")
+
+    out.append("static const lv_font_fmt_txt_dsc_t font_dsc = {")
+    out.append("    .glyph_bitmap = glyph_bitmap,")
+    out.append("    .glyph_dsc = glyph_dsc,")
+    out.append("    .cmaps = cmaps,")
+    out.append("    .kern_dsc = NULL,")
+    out.append("    .kern_scale = %d," % font["kern_scale"])
+    out.append("    .cmap_num = %d," % len(font["cmaps"]))
+    out.append("    .bpp = %d," % font["bpp"])
+    out.append("    .kern_classes = 0,")
+    out.append("    .bitmap_format = %s," % BITMAP_FORMAT_NAMES[font["bitmap_format"]])
+    out.append("};")
+    out.append("")
+
+    out.append("const lv_font_t %s = {" % name)
+    out.append("    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,")
+    out.append("    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,")
+    out.append("    .line_height = %d," % font["line_height"])
+    out.append("    .base_line = %d," % font["base_line"])
+    out.append("    .subpx = %s," % SUBPX_NAMES[font["subpx"]])
+    out.append("    .underline_position = %d," % font["underline_position"])
+    out.append("    .underline_thickness = %d," % font["underline_thickness"])
+    out.append("    .dsc = &font_dsc,")
+    out.append("    .fallback = NULL,")
+    out.append("    .user_data = NULL,")
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.stderr.write(__doc__)
+        return 1
+    path, name, out_path = sys.argv[1:]
+    font = parse(load_bytes(path))
+    with open(out_path, "w", newline="\n") as f:
+        f.write(emit(font, name, path.replace("\\", "/").split("/")[-1]))
+    print("%s: %d glyphs, %d cmaps, %d bitmap bytes" %
+          (name, len(font["glyphs"]), len(font["cmaps"]), len(font["bitmap"])))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,79 @@
+"""
+PlatformIO post-link script: size of the input -> MIDI hot set in RAM1
+
+Lists the symbols of the hot-path classes (see src/core/util/MemoryPlacement.hpp)
+with the address ranges they were linked to: code should be in ITCM, state in
+DTCM. Anything of the hot set linked to flash is printed by name, since it runs
+through the flash cache that LVGL also uses.
+
+Reads the ELF with the toolchain's nm; prints a warning and carries on if nm is
+missing.
+"""
+import re
+import subprocess
+
+Import("env")
+
+HOT_CLASSES = re.compile(
+    r"^(EventBus|Encoder|EncoderController|ButtonController|InputBinding|GestureEngine|"
+    r"MidiMapper|MidiDispatchIndex|TeensyUsbMidiIn|TeensyUsbMidiOut)::"
+)
+
+ITCM = (0x00000000, 0x00080000)
+DTCM = (0x20000000, 0x20080000)
+FLASH = (0x60000000, 0x61000000)
+
+
+def in_range(address, bounds):
+    return bounds[0] <= address < bounds[1]
+
+
+def read_symbols(nm, elf):
+    output = subprocess.run([nm, "-C", "-S", "--size-sort", elf],
+                            capture_output=True, text=True, check=True).stdout
+    for line in output.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) != 4:
+            continue
+        address, size, kind, name = fields
+        yield int(address, 16), int(size, 16), kind.lower(), name
+
+
+def report(target, source, env):
+    elf = str(target[0])
+    nm = env.subst("$CC")
+    nm = nm[:-3] + "nm" if nm.endswith("gcc") else "arm-none-eabi-nm"
+    try:
+        symbols = list(read_symbols(nm, elf))
+    except (OSError, subprocess.CalledProcessError) as error:
+        print(f"[WARNING] Hot set report skipped: {error}")
+        return
+
+    itcm_total = sum(size for address, size, kind, _ in symbols
+                     if kind in "tw" and in_range(address, ITCM))
+    dtcm_total = sum(size for address, size, kind, _ in symbols
+                     if kind in "bdr" and in_range(address, DTCM))
+
+    hot_code = [(size, address, name) for address, size, kind, name in symbols
+                if kind in "tw" and HOT_CLASSES.match(name)]
+    hot_itcm = sum(size for size, address, _ in hot_code if in_range(address, ITCM))
+    hot_flash = [(size, name) for size, address, name in hot_code
+                 if in_range(address, FLASH)]
+
+    largest_dtcm = sorted(((size, name) for address, size, kind, name in symbols
+                           if kind in "bd" and in_range(address, DTCM)), reverse=True)[:5]
+
+    print("Hot set (input -> MIDI path):")
+    print(f"  ITCM code: {hot_itcm} bytes in {len(hot_code) - len(hot_flash)} functions "
+          f"(of {itcm_total} bytes of code in ITCM)")
+    if hot_flash:
+        print(f"  In flash: {sum(size for size, _ in hot_flash)} bytes, "
+              "mark them HOT_CODE:")
+        for size, name in sorted(hot_flash, reverse=True):
+            print(f"    {size:6d}  {name}")
+    print(f"  DTCM data: {dtcm_total} bytes, largest:")
+    for size, name in largest_dtcm:
+        print(f"    {size:6d}  {name}")
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", report)
@@ -2,6 +2,7 @@
 
 #include "config/System.hpp"
 #include "log/Macros.hpp"
+#include "log/Profiler.hpp"
 
 DMAMEM static uint16_t main_framebuffer[System::Display::FRAMEBUFFER_SIZE];
 
@@ -26,8 +27,96 @@ Ili9341Driver::Ili9341Driver()
     tft_.setDiffGap(System::Display::DIFF_GAP);
     tft_.setIRQPriority(System::Display::IRQ_PRIORITY);
     tft_.setLateStartRatio(System::Display::LATE_START_RATIO);
+
+    stats_.diffGap = static_cast<uint8_t>(diffGap_);
+    stats_.vsyncSpacing = static_cast<uint8_t>(vsyncSpacing_);
 }
 
 void Ili9341Driver::refresh(bool redraw_now, uint16_t* pixels) {
+    PROFILE_SECTION("ili9341-refresh");
+    const uint32_t startUs = micros();
     tft_.update(pixels, redraw_now);
+    frameDone(startUs);
+}
+
+void Ili9341Driver::refreshRegion(bool redraw_now, const uint16_t* pixels, int xmin, int xmax,
+                                  int ymin, int ymax, int stride) {
+    const uint32_t startUs = micros();
+    tft_.updateRegion(redraw_now, pixels, xmin, xmax, ymin, ymax, stride);
+    frameDone(startUs);
+}
+
+bool Ili9341Driver::isBusy() {
+    return tft_.asyncUpdateActive();
+}
+
+void Ili9341Driver::setRefreshRate(int hz) {
+    tft_.setRefreshRate(hz);
+}
+
+void Ili9341Driver::setAutoTune(bool enabled) {
+    autoTune_ = enabled;
+    if (enabled) return;
+
+    diffGap_ = System::Display::DIFF_GAP;
+    vsyncSpacing_ = System::Display::VSYNC_SPACING;
+    tft_.setDiffGap(diffGap_);
+    tft_.setVSyncSpacing(vsyncSpacing_);
+    stats_.diffGap = static_cast<uint8_t>(diffGap_);
+    stats_.vsyncSpacing = static_cast<uint8_t>(vsyncSpacing_);
+}
+
+void Ili9341Driver::frameDone(uint32_t startUs) {
+    // update() blocks while the previous upload runs, then until its vsync slot
+    windowWaitUs_ += micros() - startUs;
+    ++stats_.frames;
+    if (++windowFrames_ >= System::Display::DRIVER_STATS_FRAMES) {
+        closeWindow();
+    }
+}
+
+void Ili9341Driver::closeWindow() {
+    const uint32_t overflows = diff1_.statsNbOverflow() + diff2_.statsNbOverflow();
+    const uint32_t teared = tft_.statsNbTeared();
+    const uint32_t uploadUs = static_cast<uint32_t>(tft_.statsUploadtime().avg());
+
+    stats_.diffOverflows += overflows;
+    stats_.tearedFrames += teared;
+    stats_.uploadedPixels = static_cast<uint32_t>(tft_.statsUploadedPixels().avg());
+    stats_.uploadUs = uploadUs;
+    stats_.waitUs = windowWaitUs_ / windowFrames_;
+
+    if (autoTune_) {
+        // A wider gap merges nearby changes into fewer, longer runs: smaller diffs
+        if (overflows * 100 > windowFrames_ * System::Display::AUTOTUNE_OVERFLOW_PERCENT) {
+            if (diffGap_ * 2 <= System::Display::AUTOTUNE_DIFF_GAP_MAX) diffGap_ *= 2;
+        } else if (overflows == 0 && diffGap_ / 2 >= System::Display::DIFF_GAP) {
+            diffGap_ /= 2;
+        }
+
+        // An upload spreads over vsyncSpacing_ refresh periods without tearing
+        const int refreshHz = tft_.getRefreshRate();
+        const uint32_t periodUs = 1000000 / static_cast<uint32_t>(refreshHz > 0 ? refreshHz : 1);
+        if (teared > 0) {
+            if (vsyncSpacing_ < System::Display::AUTOTUNE_VSYNC_SPACING_MAX) ++vsyncSpacing_;
+        } else if (vsyncSpacing_ > System::Display::AUTOTUNE_VSYNC_SPACING_MIN &&
+                   uploadUs < periodUs * static_cast<uint32_t>(vsyncSpacing_ - 1) * 3 / 4) {
+            --vsyncSpacing_;
+        }
+
+        if (diffGap_ != stats_.diffGap || vsyncSpacing_ != stats_.vsyncSpacing) {
+            tft_.setDiffGap(diffGap_);
+            tft_.setVSyncSpacing(vsyncSpacing_);
+            stats_.diffGap = static_cast<uint8_t>(diffGap_);
+            stats_.vsyncSpacing = static_cast<uint8_t>(vsyncSpacing_);
+            LOGF("[Ili9341Driver] Auto-tune: diff gap %d, vsync spacing %d\n", diffGap_,
+                 vsyncSpacing_);
+        }
+    }
+
+    tft_.statsReset();
+    diff1_.statsReset();
+    diff2_.statsReset();
+    windowFrames_ = 0;
+    windowWaitUs_ = 0;
 }
@@ -6,14 +6,70 @@
 
 class Ili9341Driver {
 public:
+    /**
+     * @brief Upload figures (System::Display::DRIVER_STATS_FRAMES window)
+     *
+     * Counters run since boot; averages cover the last complete window.
+     */
+    struct Stats {
+        uint32_t frames;
+        uint32_t diffOverflows;   // Diffs that did not fit their buffer
+        uint32_t tearedFrames;
+        uint32_t uploadedPixels;  // Per frame, average
+        uint32_t uploadUs;        // Per frame (DMA), average
+        uint32_t waitUs;          // Per frame, average time blocked in update() for vsync
+        uint8_t diffGap;
+        uint8_t vsyncSpacing;
+    };
+
     Ili9341Driver();
     ~Ili9341Driver() = default;
 
     void refresh(bool redraw_now, uint16_t* pixels);
 
+    /**
+     * @brief Update the rectangle [xmin, xmax] x [ymin, ymax] (inclusive) only
+     * @param pixels First pixel of the region
+     * @param stride Row length of pixels, in pixels
+     */
+    void refreshRegion(bool redraw_now, const uint16_t* pixels, int xmin, int xmax, int ymin,
+                       int ymax, int stride);
+
+    /** @brief Change the panel refresh rate (Hz), e.g. for idle */
+    void setRefreshRate(int hz);
+
+    /** @brief A DMA upload is in progress (refresh now would block until it ends) */
+    bool isBusy();
+
+    const Stats& getStats() const {
+        return stats_;
+    }
+
+    /**
+     * @brief Adjust diff gap and vsync spacing from the measured load
+     *
+     * Off: both go back to System::Display::DIFF_GAP / VSYNC_SPACING.
+     */
+    void setAutoTune(bool enabled);
+
+    bool isAutoTuneEnabled() const {
+        return autoTune_;
+    }
+
 private:
+    /** @brief Count the frame, close the stats window when it is full */
+    void frameDone(uint32_t startUs);
+    void closeWindow();
+
     ILI9341_T4::ILI9341Driver tft_;
     uint16_t* framebuffer_;
     ILI9341_T4::DiffBuff diff1_;
     ILI9341_T4::DiffBuff diff2_;
-};
\ No newline at end of file
+
+    Stats stats_ = {};
+    bool autoTune_ = System::Display::DRIVER_AUTOTUNE;
+    int diffGap_ = System::Display::DIFF_GAP;
+    int vsyncSpacing_ = System::Display::VSYNC_SPACING;
+    uint32_t windowFrames_ = 0;
+    uint32_t windowWaitUs_ = 0;
+};
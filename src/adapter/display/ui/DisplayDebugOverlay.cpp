@@ -0,0 +1,159 @@
+#include "DisplayDebugOverlay.hpp"
+
+#include <Arduino.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "LVGLBridge.hpp"
+
+namespace {
+constexpr lv_coord_t TEXT_HEIGHT = 16;
+constexpr uint32_t HEAT_COLOR = 0xFF2020;
+constexpr uint32_t TEXT_BG_COLOR = 0x000000;
+constexpr uint32_t TEXT_COLOR = 0xFFFF00;
+
+void join(lv_area_t& into, const lv_area_t& area) {
+    if (area.x1 < into.x1) into.x1 = area.x1;
+    if (area.y1 < into.y1) into.y1 = area.y1;
+    if (area.x2 > into.x2) into.x2 = area.x2;
+    if (area.y2 > into.y2) into.y2 = area.y2;
+}
+}  // namespace
+
+DisplayDebugOverlay::DisplayDebugOverlay(lv_display_t* display, const LVGLBridge& bridge)
+    : display_(display), bridge_(bridge) {
+    canvas_ = lv_obj_create(lv_layer_sys());
+    lv_obj_remove_style_all(canvas_);
+    lv_obj_set_size(canvas_, System::Display::SCREEN_WIDTH, System::Display::SCREEN_HEIGHT);
+    lv_obj_clear_flag(canvas_, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(canvas_, drawCallback, LV_EVENT_DRAW_MAIN, this);
+
+    textArea_.x1 = 0;
+    textArea_.y1 = System::Display::SCREEN_HEIGHT - TEXT_HEIGHT;
+    textArea_.x2 = System::Display::SCREEN_WIDTH - 1;
+    textArea_.y2 = System::Display::SCREEN_HEIGHT - 1;
+
+    lv_display_add_event_cb(display_, invalidateCallback, LV_EVENT_INVALIDATE_AREA, this);
+    lv_display_add_event_cb(display_, frameStartCallback, LV_EVENT_REFR_START, this);
+}
+
+DisplayDebugOverlay::~DisplayDebugOverlay() {
+    lv_display_remove_event_cb_with_user_data(display_, invalidateCallback, this);
+    lv_display_remove_event_cb_with_user_data(display_, frameStartCallback, this);
+    if (canvas_) {
+        lv_obj_delete(canvas_);  // Invalidates what the overlay covered
+    }
+}
+
+void DisplayDebugOverlay::invalidateCallback(lv_event_t* e) {
+    auto* overlay = static_cast<DisplayDebugOverlay*>(lv_event_get_user_data(e));
+    const auto* area = static_cast<const lv_area_t*>(lv_event_get_param(e));
+    if (overlay && area) {
+        overlay->record(*area);
+    }
+}
+
+void DisplayDebugOverlay::frameStartCallback(lv_event_t* e) {
+    auto* overlay = static_cast<DisplayDebugOverlay*>(lv_event_get_user_data(e));
+    if (overlay) {
+        overlay->nextFrame();
+    }
+}
+
+void DisplayDebugOverlay::drawCallback(lv_event_t* e) {
+    auto* overlay = static_cast<DisplayDebugOverlay*>(lv_event_get_user_data(e));
+    if (overlay) {
+        overlay->draw(lv_event_get_layer(e));
+    }
+}
+
+void DisplayDebugOverlay::record(const lv_area_t& area) {
+    if (selfInvalidating_) return;
+
+    Frame& frame = frames_[head_];
+    if (frame.count == 0) {
+        frame.bounds = area;
+    } else {
+        join(frame.bounds, area);
+    }
+
+    if (frame.count < AREAS) {
+        frame.areas[frame.count++] = area;
+    } else {
+        join(frame.areas[AREAS - 1], area);
+    }
+}
+
+/*
+ * Every recorded frame fades one step (or drops out) each frame, so all of
+ * them are redrawn; those invalidations are the overlay's own, not recorded.
+ */
+void DisplayDebugOverlay::nextFrame() {
+    selfInvalidating_ = true;
+
+    for (const auto& frame : frames_) {
+        if (frame.count != 0) {
+            invalidateOwn(frame.bounds);
+        }
+    }
+    head_ = static_cast<uint8_t>((head_ + 1) % FRAMES);
+    frames_[head_].count = 0;
+
+    const uint32_t nowMs = millis();
+    if (nowMs - lastTextMs_ >= System::Display::OVERLAY_TEXT_PERIOD_MS) {
+        lastTextMs_ = nowMs;
+
+        const DisplayStats stats = bridge_.getStats();
+        char text[sizeof(text_)];
+        const int length =
+            snprintf(text, sizeof(text), "render %lu us  flush %lu us  %u fps  drop %lu",
+                     static_cast<unsigned long>(stats.renderUs),
+                     static_cast<unsigned long>(stats.flushUs), static_cast<unsigned>(stats.fps),
+                     static_cast<unsigned long>(stats.droppedFrames));
+        // A cut line would be shown as is: keep the last whole one instead
+        const bool whole = length >= 0 && static_cast<size_t>(length) < sizeof(text);
+        if (whole && strcmp(text, text_) != 0) {
+            memcpy(text_, text, sizeof(text_));
+            invalidateOwn(textArea_);
+        }
+    }
+
+    selfInvalidating_ = false;
+}
+
+void DisplayDebugOverlay::invalidateOwn(const lv_area_t& area) {
+    lv_obj_invalidate_area(canvas_, &area);
+}
+
+void DisplayDebugOverlay::draw(lv_layer_t* layer) const {
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = lv_color_hex(HEAT_COLOR);
+
+    // Oldest first, so overlapping newer frames stack on top
+    for (size_t age = FRAMES; age-- > 0;) {
+        const Frame& frame = frames_[(head_ + FRAMES - age) % FRAMES];
+        rect.bg_opa = static_cast<lv_opa_t>(LV_OPA_60 * (FRAMES - age) / FRAMES);
+        for (uint8_t i = 0; i < frame.count; ++i) {
+            lv_draw_rect(layer, &rect, &frame.areas[i]);
+        }
+    }
+
+    if (text_[0] == '\0') return;
+
+    lv_draw_rect_dsc_t background;
+    lv_draw_rect_dsc_init(&background);
+    background.bg_color = lv_color_hex(TEXT_BG_COLOR);
+    background.bg_opa = LV_OPA_70;
+    lv_draw_rect(layer, &background, &textArea_);
+
+    lv_draw_label_dsc_t label;
+    lv_draw_label_dsc_init(&label);
+    label.color = lv_color_hex(TEXT_COLOR);
+    label.text = text_;
+    lv_area_t textArea = textArea_;
+    textArea.x1 += 2;
+    textArea.y1 += 2;
+    lv_draw_label(layer, &label, &textArea);
+}
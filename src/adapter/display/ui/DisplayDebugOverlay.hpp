@@ -0,0 +1,60 @@
+#pragma once
+
+#include <lvgl.h>
+#include <etl/array.h>
+
+#include "config/System.hpp"
+
+class LVGLBridge;
+
+/**
+ * @brief Runtime dirty-region heatmap and frame-time readout
+ *
+ * Runtime counterpart of LV_USE_REFR_DEBUG. Every area invalidated on the
+ * display (LV_EVENT_INVALIDATE_AREA) is recorded per frame; a full-screen
+ * object on the system layer paints the last OVERLAY_FRAMES frames as
+ * translucent red rectangles, newest most opaque, with the bridge's render
+ * and flush times in a corner.
+ *
+ * The overlay's own invalidations are not recorded, so it does not feed
+ * back into the heatmap. Created and destroyed by LVGLBridge::setDebugOverlay.
+ */
+class DisplayDebugOverlay {
+public:
+    DisplayDebugOverlay(lv_display_t* display, const LVGLBridge& bridge);
+    ~DisplayDebugOverlay();
+
+    DisplayDebugOverlay(const DisplayDebugOverlay&) = delete;
+    DisplayDebugOverlay& operator=(const DisplayDebugOverlay&) = delete;
+
+private:
+    static constexpr size_t FRAMES = System::Display::OVERLAY_FRAMES;
+    static constexpr size_t AREAS = System::Display::OVERLAY_AREAS_PER_FRAME;
+
+    struct Frame {
+        etl::array<lv_area_t, AREAS> areas;
+        lv_area_t bounds;
+        uint8_t count;
+    };
+
+    static void invalidateCallback(lv_event_t* e);
+    static void frameStartCallback(lv_event_t* e);
+    static void drawCallback(lv_event_t* e);
+
+    void record(const lv_area_t& area);
+    void nextFrame();
+    void draw(lv_layer_t* layer) const;
+    void invalidateOwn(const lv_area_t& area);
+
+    lv_display_t* display_;
+    const LVGLBridge& bridge_;
+    lv_obj_t* canvas_ = nullptr;
+
+    etl::array<Frame, FRAMES> frames_ = {};
+    uint8_t head_ = 0;  // Frame being recorded
+    bool selfInvalidating_ = false;
+
+    char text_[72] = {};  // Fits the worst case: three 10-digit counters, 5-digit fps
+    lv_area_t textArea_ = {};
+    uint32_t lastTextMs_ = 0;
+};
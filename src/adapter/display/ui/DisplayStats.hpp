@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief LVGL memory and rendering figures (LVGLBridge::getStats)
+ *
+ * Collected in every build, without LV_USE_SYSMON / perf monitor overlays.
+ */
+struct DisplayStats {
+    /* LVGL heap (lv_mem_monitor, both tiers with LVGL_TIERED_MEMORY) */
+    uint32_t memTotal;
+    uint32_t memUsed;
+    uint32_t memPeak;      // High-water mark since boot
+    uint8_t memUsedPct;
+    uint8_t memFragPct;
+    uint32_t memFastUsed;  // RAM2 small-object tier
+    uint32_t memLargeUsed; // PSRAM tier
+
+    /* Rendering */
+    uint16_t fps;            // Frames pushed to the driver during the last second
+    uint32_t renderUs;       // Last lv_timer_handler() run that drew, flush included
+    uint32_t flushUs;        // Last hand-off to the driver (copy + diff)
+    uint32_t droppedFrames;  // Skipped for pending input since boot
+    bool idle;
+    uint32_t frames;         // Pushed to the driver since boot
+
+    /* Panel driver (Ili9341Driver::Stats) */
+    uint32_t diffOverflows;   // Since boot
+    uint32_t tearedFrames;    // Since boot
+    uint32_t uploadedPixels;  // Per frame, averages of the last stats window
+    uint32_t uploadUs;
+    uint32_t vsyncWaitUs;
+    uint8_t diffGap;
+    uint8_t vsyncSpacing;
+};
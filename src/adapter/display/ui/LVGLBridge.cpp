@@ -1,10 +1,16 @@
 #include "LVGLBridge.hpp"
 
 #include "../driver/Ili9341Driver.hpp"
+#include "LVGLDrawKernels.hpp"
+#include "LVGLMemory.hpp"
 #include "config/System.hpp"
 #include "log/Macros.hpp"
+#include "log/Profiler.hpp"
 
-DMAMEM static lv_color_t lvgl_buffer[System::Display::LVGL_BUFFER_SIZE];
+// RGB565 pixels (the display's color format), not lv_color_t: that one is 3 bytes
+DMAMEM static uint16_t lvgl_buffer[System::Display::LVGL_BUFFER_SIZE];
+DMAMEM static uint16_t
+    lvgl_buffer2[System::Display::LVGL_DOUBLE_BUFFER ? System::Display::LVGL_BUFFER_SIZE : 1];
 
 LVGLBridge::LVGLBridge(Ili9341Driver& driver) : driver_(driver), display_(nullptr) {
     lv_init();
@@ -18,35 +24,245 @@ LVGLBridge::LVGLBridge(Ili9341Driver& driver) : driver_(driver), display_(nullpt
 
     lv_display_set_buffers(display_,
                            lvgl_buffer,
-                           nullptr,
-                           System::Display::LVGL_BUFFER_SIZE * sizeof(lv_color_t),
-                           LV_DISPLAY_RENDER_MODE_FULL);
+                           System::Display::LVGL_DOUBLE_BUFFER ? lvgl_buffer2 : nullptr,
+                           sizeof(lvgl_buffer),
+                           System::Display::LVGL_DIRECT_RENDER ? LV_DISPLAY_RENDER_MODE_DIRECT
+                                                               : LV_DISPLAY_RENDER_MODE_FULL);
 
     lv_display_set_color_format(display_, LV_COLOR_FORMAT_RGB565);
-    lv_display_set_flush_cb(display_, flush);
-    lv_display_set_user_data(display_, &driver_);
+    lv_display_set_flush_cb(display_, System::Display::LVGL_DIRECT_RENDER ? flushDirect : flush);
+    lv_display_set_user_data(display_, this);
+    if (System::Display::LVGL_DOUBLE_BUFFER) {
+        lv_display_set_flush_wait_cb(display_, flushWait);
+    }
+    if (!System::Display::LVGL_DIRECT_RENDER) {
+        // Full mode: LVGL itself widens every invalidation to the screen
+        lv_display_add_event_cb(display_, onInvalidateArea, LV_EVENT_INVALIDATE_AREA, this);
+    }
+
+#ifdef DRAW_KERNEL_BENCHMARK
+    LVGLDrawKernels::runBenchmark();
+#endif
 }
 
 LVGLBridge::~LVGLBridge() {
+    overlay_.reset();  // Unhooks from display_ first
     if (display_) {
         lv_display_delete(display_);
     }
 }
 
-void LVGLBridge::refresh() {
-    lv_timer_handler();
+void LVGLBridge::refresh(bool inputPending) {
+    pushPending();
+
+    const uint32_t startUs = micros();
+    if (startUs - lastFrameUs_ < frameGapUs_) return;
+
+    if (inputPending && droppedInRow_ < System::Display::MAX_DROPPED_FRAMES) {
+        ++droppedInRow_;
+        ++droppedTotal_;
+        return;
+    }
+    droppedInRow_ = 0;
+    lastFrameUs_ = startUs;
+
+    const uint32_t pushedBefore = framesPushed_;
+    {
+        PROFILE_SECTION("lv_timer_handler");
+        lv_timer_handler();
+    }
+
+    lastRenderUs_ = micros() - startUs;
+    if (framesPushed_ != pushedBefore) {
+        lastDrawUs_ = lastRenderUs_;
+    }
+
+    const uint32_t nowMs = millis();
+    if (nowMs - fpsWindowMs_ >= 1000) {
+        fps_ = static_cast<uint16_t>(framesPushed_ - fpsWindowFrames_);
+        fpsWindowFrames_ = framesPushed_;
+        fpsWindowMs_ = nowMs;
+    }
+
+    if (!idle_ && System::Display::IDLE_AFTER_MS != 0 &&
+        millis() - lastActivityMs_ >= System::Display::IDLE_AFTER_MS) {
+        idle_ = true;
+        driver_.setRefreshRate(System::Display::IDLE_REFRESH_RATE_HZ);
+    }
+
+    const uint32_t periodUs =
+        idle_ ? System::Display::IDLE_FRAME_PERIOD_US : System::Display::FRAME_PERIOD_US;
+    const uint32_t loadGapUs = lastRenderUs_ * 100 / System::Display::RENDER_MAX_LOAD_PERCENT;
+    frameGapUs_ = loadGapUs > periodUs ? loadGapUs : periodUs;
+}
+
+void LVGLBridge::wake() {
+    lastActivityMs_ = millis();
+    if (!idle_) return;
+
+    idle_ = false;
+    driver_.setRefreshRate(System::Display::REFRESH_RATE_HZ);
+    frameGapUs_ = 0;  // Render the input's effect on the next refresh()
+}
+
+void LVGLBridge::setDriverAutoTune(bool enabled) {
+    driver_.setAutoTune(enabled);
+}
+
+void LVGLBridge::setDebugOverlay(bool enabled) {
+    if (enabled == overlay_.has_value() || !display_) return;
+
+    if (enabled) {
+        overlay_.emplace(display_, *this);
+    } else {
+        overlay_.reset();
+    }
+    wake();
+}
+
+DisplayStats LVGLBridge::getStats() const {
+    lv_mem_monitor_t mem;
+    lv_mem_monitor(&mem);
+    LvglMemoryStats tiers;
+    getLvglMemoryStats(&tiers);
+
+    DisplayStats stats;
+    stats.memTotal = mem.total_size;
+    stats.memUsed = mem.total_size - mem.free_size;
+    stats.memPeak = mem.max_used;
+    stats.memUsedPct = mem.used_pct;
+    stats.memFragPct = mem.frag_pct;
+    stats.memFastUsed = tiers.fast_used;
+    stats.memLargeUsed = tiers.large_used;
+    stats.fps = fps_;
+    stats.renderUs = lastDrawUs_;
+    stats.flushUs = lastFlushUs_;
+    stats.droppedFrames = droppedTotal_;
+    stats.idle = idle_;
+    stats.frames = framesPushed_;
+
+    const Ili9341Driver::Stats& driver = driver_.getStats();
+    stats.diffOverflows = driver.diffOverflows;
+    stats.tearedFrames = driver.tearedFrames;
+    stats.uploadedPixels = driver.uploadedPixels;
+    stats.uploadUs = driver.uploadUs;
+    stats.vsyncWaitUs = driver.waitUs;
+    stats.diffGap = driver.diffGap;
+    stats.vsyncSpacing = driver.vsyncSpacing;
+    return stats;
+}
+
+/*
+ * Single buffer: push right away (the driver waits for its previous upload
+ * if needed). Double buffer: push only when the driver is idle, otherwise
+ * leave the frame pending and let LVGL render into the other buffer.
+ */
+void LVGLBridge::submit(const uint16_t* pixels, const lv_area_t* area, bool region) {
+    wake();  // A redraw is activity
+
+    pending_.pixels = pixels;
+    pending_.area = *area;
+    pending_.region = region;
+    hasPending_ = true;
+
+    if (!System::Display::LVGL_DOUBLE_BUFFER || !driver_.isBusy()) {
+        pushPending();
+    }
+}
+
+bool LVGLBridge::pushPending() {
+    if (!hasPending_) return false;
+    if (System::Display::LVGL_DOUBLE_BUFFER && driver_.isBusy()) return false;
+
+    const uint32_t startUs = micros();
+    const lv_area_t& area = pending_.area;
+    if (pending_.region) {
+        constexpr int stride = System::Display::SCREEN_WIDTH;
+        driver_.refreshRegion(false, pending_.pixels + area.y1 * stride + area.x1, area.x1,
+                              area.x2, area.y1, area.y2, stride);
+    } else {
+        driver_.refresh(false, const_cast<uint16_t*>(pending_.pixels));
+    }
+    lastFlushUs_ = micros() - startUs;
+    ++framesPushed_;
+
+    hasPending_ = false;
+    lv_display_flush_ready(display_);
+    return true;
 }
 
 void LVGLBridge::flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
-    auto* driver = static_cast<Ili9341Driver*>(lv_display_get_user_data(disp));
+    auto* bridge = static_cast<LVGLBridge*>(lv_display_get_user_data(disp));
+
+    if (!bridge) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    // LVGL redraws the whole buffer, but the driver only needs to diff and
+    // copy what was invalidated since the last frame
+    if (bridge->hasDirty_) {
+        bridge->hasDirty_ = false;
+        bridge->submit(reinterpret_cast<const uint16_t*>(px_map), &bridge->dirty_, true);
+        return;
+    }
+    bridge->submit(reinterpret_cast<const uint16_t*>(px_map), area, false);
+}
+
+/*
+ * Full mode: the area as invalidated, sent before LVGL replaces its list with
+ * the whole screen. Invalidation is refused while a frame renders, so the
+ * union covers exactly the next frame's changes.
+ */
+void LVGLBridge::onInvalidateArea(lv_event_t* event) {
+    auto* bridge = static_cast<LVGLBridge*>(lv_event_get_user_data(event));
+    const auto* area = static_cast<const lv_area_t*>(lv_event_get_param(event));
+    if (bridge && area) {
+        bridge->addDirty(*area);
+    }
+}
+
+void LVGLBridge::addDirty(const lv_area_t& area) {
+    if (!hasDirty_) {
+        dirty_ = area;
+        hasDirty_ = true;
+        return;
+    }
+    if (area.x1 < dirty_.x1) dirty_.x1 = area.x1;
+    if (area.y1 < dirty_.y1) dirty_.y1 = area.y1;
+    if (area.x2 > dirty_.x2) dirty_.x2 = area.x2;
+    if (area.y2 > dirty_.y2) dirty_.y2 = area.y2;
+}
+
+/*
+ * Direct mode: px_map is the full-screen buffer, already up to date outside
+ * the redrawn areas. One region update per frame keeps the driver to a
+ * single diff and upload.
+ */
+void LVGLBridge::flushDirect(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
+    auto* bridge = static_cast<LVGLBridge*>(lv_display_get_user_data(disp));
+
+    if (!bridge) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    bridge->addDirty(*area);
 
-    if (!driver) {
+    if (!lv_display_flush_is_last(disp)) {
         lv_display_flush_ready(disp);
         return;
     }
 
-    auto* pixels = reinterpret_cast<uint16_t*>(px_map);
-    driver->refresh(false, pixels);
+    bridge->hasDirty_ = false;
+    bridge->submit(reinterpret_cast<const uint16_t*>(px_map), &bridge->dirty_, true);
+}
+
+/* LVGL has the next frame ready and needs the pending buffer back */
+void LVGLBridge::flushWait(lv_display_t* disp) {
+    auto* bridge = static_cast<LVGLBridge*>(lv_display_get_user_data(disp));
+    if (!bridge) return;
 
-    lv_display_flush_ready(disp);
-}
\ No newline at end of file
+    while (bridge->hasPending_ && !bridge->pushPending()) {
+    }
+}
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <Arduino.h>
 #include <lvgl.h>
+#include <etl/optional.h>
+
+#include "DisplayDebugOverlay.hpp"
+#include "DisplayStats.hpp"
 
 class Ili9341Driver;
 
@@ -9,17 +14,111 @@ class Ili9341Driver;
  *
  * Manages LVGL initialization and provides the flush callback to render
  * graphics to the physical display through the hardware driver.
+ *
+ * In direct render mode (System::Display::LVGL_DIRECT_RENDER) the flush
+ * callback only collects the areas LVGL redrew; on the frame's last area the
+ * bounding box is sent to the driver in one region update. In full mode LVGL
+ * re-renders the whole buffer and reports the whole screen as invalidated,
+ * so the bridge collects the areas as they are invalidated
+ * (LV_EVENT_INVALIDATE_AREA) and hands over only their bounding box: the
+ * driver's diff against its framebuffer (which also copies the new pixels
+ * over the old) covers that box, not 150 KB.
+ *
+ * With LVGL_DOUBLE_BUFFER the hand-off to the driver is deferred while its
+ * DMA upload is busy, instead of blocking inside the flush: LVGL keeps
+ * rendering into the other buffer, and the pending frame is pushed (and
+ * flush-ready signalled) from refresh() or LVGL's flush-wait hook once the
+ * driver is idle.
+ *
+ * When nothing has been redrawn for IDLE_AFTER_MS the bridge goes idle:
+ * lower panel refresh and LVGL frame rate, until the next redraw or wake().
  */
 class LVGLBridge {
 public:
     explicit LVGLBridge(Ili9341Driver& driver);
     ~LVGLBridge();
 
-    void refresh();
+    /**
+     * @brief Run LVGL if a frame is due (see System::Display frame scheduling)
+     * @param inputPending Input or MIDI is still waiting: the frame may be dropped
+     */
+    void refresh(bool inputPending = false);
+
+    /** @brief Leave idle mode now (call on input), next frame at full rate */
+    void wake();
+
+    bool isIdle() const {
+        return idle_;
+    }
+
+    /** @brief refresh() would push a frame or run LVGL now */
+    bool hasFrameDue() const {
+        return hasPending_ || micros() - lastFrameUs_ >= frameGapUs_;
+    }
+
+    /** @brief Duration of the last rendered frame (lv_timer_handler) */
+    uint32_t getLastRenderUs() const {
+        return lastRenderUs_;
+    }
+
+    /** @brief Frames skipped for pending input since boot */
+    uint32_t getDroppedFrames() const {
+        return droppedTotal_;
+    }
+
+    /** @brief LVGL heap and render figures, see DisplayStats */
+    DisplayStats getStats() const;
+
+    /** @brief Let the panel driver tune diff gap and vsync spacing (Ili9341Driver::setAutoTune) */
+    void setDriverAutoTune(bool enabled);
+
+    /** @brief Show / hide the dirty-region heatmap and frame times (DisplayDebugOverlay) */
+    void setDebugOverlay(bool enabled);
+
+    bool isDebugOverlayEnabled() const {
+        return overlay_.has_value();
+    }
 
 private:
     Ili9341Driver& driver_;
     lv_display_t* display_;
+    lv_area_t dirty_ = {};  // Union of the frame's flushed (direct) or invalidated (full) areas
+    bool hasDirty_ = false;
+
+    /** @brief Frame handed over by LVGL, not yet pushed to the driver */
+    struct PendingFrame {
+        const uint16_t* pixels = nullptr;
+        lv_area_t area = {};
+        bool region = false;  // refreshRegion (direct mode), else full refresh
+    };
+    PendingFrame pending_;
+    bool hasPending_ = false;
+
+    uint32_t lastFrameUs_ = 0;
+    uint32_t frameGapUs_ = 0;  // Earliest start of the next frame after lastFrameUs_
+    uint32_t lastRenderUs_ = 0;
+    uint32_t lastDrawUs_ = 0;   // lastRenderUs_ of the last frame that flushed
+    uint32_t lastFlushUs_ = 0;
+    uint32_t framesPushed_ = 0;  // Total, for the fps window
+    uint32_t fpsWindowMs_ = 0;
+    uint32_t fpsWindowFrames_ = 0;
+    uint16_t fps_ = 0;
+    uint8_t droppedInRow_ = 0;
+    uint32_t droppedTotal_ = 0;
+
+    uint32_t lastActivityMs_ = 0;  // Last redraw or wake()
+    bool idle_ = false;
+
+    etl::optional<DisplayDebugOverlay> overlay_;
+
+    void submit(const uint16_t* pixels, const lv_area_t* area, bool region);
+    bool pushPending();
+
+    void addDirty(const lv_area_t& area);
+
+    static void onInvalidateArea(lv_event_t* event);
 
     static void flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+    static void flushDirect(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+    static void flushWait(lv_display_t* disp);
 };
\ No newline at end of file
@@ -0,0 +1,351 @@
+#include <Arduino.h>
+#include <lvgl.h>
+#include <draw/sw/blend/lv_draw_sw_blend_private.h>
+#include <draw/sw/blend/lv_draw_sw_blend_to_rgb565.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "LVGLDrawKernels.hpp"
+#include "log/Macros.hpp"
+
+/*
+ * All kernels produce the same pixels as LVGL's C path: partial coverage
+ * uses its lv_color_16_16_mix() arithmetic (5-bit weight, both colours
+ * spread as 0000 0GGG GGG0 0000 RRRR R000 00BB BBB so one multiply blends
+ * the three channels). The gain comes from the loop structure:
+ *   - rows are written a word (two pixels) at a time, eight words per
+ *     iteration, which the M7 issues as 64-bit STRD pairs
+ *   - the spread foreground and its weight are computed once per call
+ *   - masks are tested four bytes at a time, so runs of fully transparent
+ *     or fully covered pixels (most of a glyph box) skip the per-pixel path
+ *   - with uniform opacity, a destination word equal to the previous one
+ *     reuses its result (flat backgrounds blend once per run)
+ */
+
+namespace {
+
+constexpr uint32_t SPREAD_MASK = 0x07E0F81F;
+constexpr uint32_t MASK_ALL_COVER = 0xFFFFFFFF;
+
+bool enabled = true;
+
+inline uint32_t spread(uint16_t color) {
+    return (color | (static_cast<uint32_t>(color) << 16)) & SPREAD_MASK;
+}
+
+/* lv_color_16_16_mix() weight: 0-255 opacity to 0-32 */
+inline uint32_t mixWeight(uint32_t opa) {
+    return (opa + 4) >> 3;
+}
+
+inline uint16_t blendSpread(uint32_t fgSpread, uint16_t bg, uint32_t weight) {
+    const uint32_t bgSpread = spread(bg);
+    const uint32_t result = ((((fgSpread - bgSpread) * weight) >> 5) + bgSpread) & SPREAD_MASK;
+    return static_cast<uint16_t>((result >> 16) | result);
+}
+
+/* Two pixels packed in a word */
+inline uint32_t blendPair(uint32_t fgSpread, uint32_t bgPair, uint32_t weight) {
+    return blendSpread(fgSpread, static_cast<uint16_t>(bgPair), weight) |
+           (static_cast<uint32_t>(blendSpread(fgSpread, bgPair >> 16, weight)) << 16);
+}
+
+/* Same as lv_color_16_16_mix(): the ends are exact */
+inline uint16_t blendOpa(uint16_t fg, uint32_t fgSpread, uint16_t bg, uint32_t opa) {
+    if (opa >= LV_OPA_COVER) return fg;
+    if (opa == LV_OPA_TRANSP) return bg;
+    return blendSpread(fgSpread, bg, mixWeight(opa));
+}
+
+inline uint32_t load32(const void* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));  // LDR, unaligned access is fine on the M7
+    return value;
+}
+
+inline uint16_t* nextRow(uint16_t* row, int32_t stride) {
+    return reinterpret_cast<uint16_t*>(reinterpret_cast<uint8_t*>(row) + stride);
+}
+
+void fillRow(uint16_t* dest, int32_t w, uint16_t color) {
+    if ((reinterpret_cast<uintptr_t>(dest) & 0x2) && w > 0) {
+        *dest++ = color;
+        --w;
+    }
+
+    const uint32_t pair = color | (static_cast<uint32_t>(color) << 16);
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    int32_t pairs = w >> 1;
+    while (pairs >= 8) {
+        words[0] = pair;
+        words[1] = pair;
+        words[2] = pair;
+        words[3] = pair;
+        words[4] = pair;
+        words[5] = pair;
+        words[6] = pair;
+        words[7] = pair;
+        words += 8;
+        pairs -= 8;
+    }
+    while (pairs-- > 0) {
+        *words++ = pair;
+    }
+    if (w & 1) {
+        *reinterpret_cast<uint16_t*>(words) = color;
+    }
+}
+
+void blendRowOpa(uint16_t* dest, int32_t w, uint32_t fgSpread, uint32_t weight) {
+    if ((reinterpret_cast<uintptr_t>(dest) & 0x2) && w > 0) {
+        *dest = blendSpread(fgSpread, *dest, weight);
+        ++dest;
+        --w;
+    }
+
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    uint32_t lastIn = 0;
+    uint32_t lastOut = blendPair(fgSpread, 0, weight);
+    for (int32_t pairs = w >> 1; pairs > 0; --pairs, ++words) {
+        const uint32_t in = *words;
+        if (in != lastIn) {
+            lastIn = in;
+            lastOut = blendPair(fgSpread, in, weight);
+        }
+        *words = lastOut;
+    }
+    if (w & 1) {
+        uint16_t* last = reinterpret_cast<uint16_t*>(words);
+        *last = blendSpread(fgSpread, *last, weight);
+    }
+}
+
+void blendRowMask(uint16_t* dest, const lv_opa_t* mask, int32_t w, uint16_t color,
+                  uint32_t fgSpread) {
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+        const uint32_t coverage = load32(mask + x);
+        if (coverage == 0) continue;
+        if (coverage == MASK_ALL_COVER) {
+            dest[x] = color;
+            dest[x + 1] = color;
+            dest[x + 2] = color;
+            dest[x + 3] = color;
+            continue;
+        }
+        dest[x] = blendOpa(color, fgSpread, dest[x], mask[x]);
+        dest[x + 1] = blendOpa(color, fgSpread, dest[x + 1], mask[x + 1]);
+        dest[x + 2] = blendOpa(color, fgSpread, dest[x + 2], mask[x + 2]);
+        dest[x + 3] = blendOpa(color, fgSpread, dest[x + 3], mask[x + 3]);
+    }
+    for (; x < w; ++x) {
+        dest[x] = blendOpa(color, fgSpread, dest[x], mask[x]);
+    }
+}
+
+void blendRowMaskOpa(uint16_t* dest, const lv_opa_t* mask, int32_t w, uint16_t color,
+                     uint32_t fgSpread, uint32_t opa) {
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+        if (load32(mask + x) == 0) continue;
+        for (int32_t i = x; i < x + 4; ++i) {
+            dest[i] = blendOpa(color, fgSpread, dest[i], LV_OPA_MIX2(mask[i], opa));
+        }
+    }
+    for (; x < w; ++x) {
+        dest[x] = blendOpa(color, fgSpread, dest[x], LV_OPA_MIX2(mask[x], opa));
+    }
+}
+
+}  // namespace
+
+// =============================================================================
+// LVGL hooks
+// =============================================================================
+
+extern "C" {
+
+lv_result_t lvgl_m7_fill_rgb565(lv_draw_sw_blend_fill_dsc_t* dsc) {
+    if (!enabled) return LV_RESULT_INVALID;
+
+    const uint16_t color = lv_color_to_u16(dsc->color);
+    uint16_t* row = static_cast<uint16_t*>(dsc->dest_buf);
+    for (int32_t y = 0; y < dsc->dest_h; ++y) {
+        fillRow(row, dsc->dest_w, color);
+        row = nextRow(row, dsc->dest_stride);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lvgl_m7_fill_rgb565_opa(lv_draw_sw_blend_fill_dsc_t* dsc) {
+    if (!enabled) return LV_RESULT_INVALID;
+
+    const uint32_t fgSpread = spread(lv_color_to_u16(dsc->color));
+    const uint32_t weight = mixWeight(dsc->opa);
+    uint16_t* row = static_cast<uint16_t*>(dsc->dest_buf);
+    for (int32_t y = 0; y < dsc->dest_h; ++y) {
+        if (weight != 0) {
+            blendRowOpa(row, dsc->dest_w, fgSpread, weight);
+        }
+        row = nextRow(row, dsc->dest_stride);
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lvgl_m7_fill_rgb565_mask(lv_draw_sw_blend_fill_dsc_t* dsc) {
+    if (!enabled) return LV_RESULT_INVALID;
+
+    const uint16_t color = lv_color_to_u16(dsc->color);
+    const uint32_t fgSpread = spread(color);
+    uint16_t* row = static_cast<uint16_t*>(dsc->dest_buf);
+    const lv_opa_t* mask = dsc->mask_buf;
+    for (int32_t y = 0; y < dsc->dest_h; ++y) {
+        blendRowMask(row, mask, dsc->dest_w, color, fgSpread);
+        row = nextRow(row, dsc->dest_stride);
+        mask += dsc->mask_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lvgl_m7_fill_rgb565_mask_opa(lv_draw_sw_blend_fill_dsc_t* dsc) {
+    if (!enabled) return LV_RESULT_INVALID;
+
+    const uint16_t color = lv_color_to_u16(dsc->color);
+    const uint32_t fgSpread = spread(color);
+    uint16_t* row = static_cast<uint16_t*>(dsc->dest_buf);
+    const lv_opa_t* mask = dsc->mask_buf;
+    for (int32_t y = 0; y < dsc->dest_h; ++y) {
+        blendRowMaskOpa(row, mask, dsc->dest_w, color, fgSpread, dsc->opa);
+        row = nextRow(row, dsc->dest_stride);
+        mask += dsc->mask_stride;
+    }
+    return LV_RESULT_OK;
+}
+
+}  // extern "C"
+
+// =============================================================================
+// Control and benchmark
+// =============================================================================
+
+namespace LVGLDrawKernels {
+
+void setEnabled(bool value) {
+    enabled = value;
+}
+
+bool isEnabled() {
+    return enabled;
+}
+
+namespace {
+
+/* A knob-page sized area: wide enough for the word loops, odd to hit the tails */
+constexpr int32_t BENCH_W = 161;
+constexpr int32_t BENCH_H = 60;
+constexpr int32_t BENCH_STRIDE = (BENCH_W + 1) * 2;
+constexpr size_t BENCH_PIXELS = BENCH_STRIDE / 2 * BENCH_H;
+constexpr uint8_t BENCH_RUNS = 8;
+
+struct BenchCase {
+    const char* name;
+    lv_opa_t opa;
+    bool masked;
+};
+
+constexpr BenchCase BENCH_CASES[] = {
+    {"fill", LV_OPA_COVER, false},
+    {"fill opa", LV_OPA_50, false},
+    {"mask (text)", LV_OPA_COVER, true},
+    {"mask + opa", LV_OPA_70, true},
+};
+
+/* Background gradient, so the opacity loop's run cache gets no free hits */
+void fillBackground(uint16_t* pixels) {
+    for (size_t i = 0; i < BENCH_PIXELS; ++i) {
+        pixels[i] = static_cast<uint16_t>(i * 2654435761u >> 16);
+    }
+}
+
+/* Glyph-like coverage: empty runs, solid strokes and anti-aliased edges */
+void fillMask(lv_opa_t* mask) {
+    for (int32_t y = 0; y < BENCH_H; ++y) {
+        for (int32_t x = 0; x < BENCH_W; ++x) {
+            const int32_t phase = (x + y / 3) % 12;
+            lv_opa_t value = 0;
+            if (phase >= 4 && phase < 8) value = LV_OPA_COVER;
+            else if (phase == 3 || phase == 8) value = static_cast<lv_opa_t>(40 + (x + y) % 180);
+            mask[y * BENCH_W + x] = value;
+        }
+    }
+}
+
+uint32_t timeBlend(const BenchCase& bench, uint16_t* dest, const lv_opa_t* mask) {
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.dest_buf = dest + 1;  // odd start: exercises the alignment head
+    dsc.dest_w = BENCH_W;
+    dsc.dest_h = BENCH_H;
+    dsc.dest_stride = BENCH_STRIDE;
+    dsc.mask_buf = bench.masked ? mask : nullptr;
+    dsc.mask_stride = BENCH_W;
+    dsc.color = lv_color_hex(0x3FA9F5);
+    dsc.opa = bench.opa;
+    lv_area_set(&dsc.relative_area, 0, 0, BENCH_W - 1, BENCH_H - 1);
+
+    uint32_t best = UINT32_MAX;
+    for (uint8_t run = 0; run < BENCH_RUNS; ++run) {
+        fillBackground(dest);
+        const uint32_t start = ARM_DWT_CYCCNT;
+        lv_draw_sw_blend_color_to_rgb565(&dsc);
+        const uint32_t cycles = ARM_DWT_CYCCNT - start;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+}  // namespace
+
+void runBenchmark() {
+    const size_t pixelBytes = BENCH_PIXELS * sizeof(uint16_t);
+    auto* kernelOut = static_cast<uint16_t*>(malloc(pixelBytes));
+    auto* referenceOut = static_cast<uint16_t*>(malloc(pixelBytes));
+    auto* mask = static_cast<lv_opa_t*>(malloc(BENCH_W * BENCH_H));
+    if (!kernelOut || !referenceOut || !mask) {
+        LOGLN("[DrawKernels] ERROR: Benchmark buffers allocation failed");
+        free(kernelOut);
+        free(referenceOut);
+        free(mask);
+        return;
+    }
+
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    fillMask(mask);
+
+    const bool wasEnabled = enabled;
+    LOGF("[DrawKernels] Benchmark %dx%d px, best of %d\n", static_cast<int>(BENCH_W),
+         static_cast<int>(BENCH_H), BENCH_RUNS);
+    for (const BenchCase& bench : BENCH_CASES) {
+        enabled = false;
+        const uint32_t reference = timeBlend(bench, referenceOut, mask);
+        enabled = true;
+        uint32_t kernel = timeBlend(bench, kernelOut, mask);
+        if (kernel == 0) kernel = 1;
+
+        const bool same = memcmp(kernelOut, referenceOut, pixelBytes) == 0;
+        LOGF("[DrawKernels]   %-12s C %7lu cyc, kernel %7lu cyc, x%lu.%02lu %s\n", bench.name,
+             static_cast<unsigned long>(reference), static_cast<unsigned long>(kernel),
+             static_cast<unsigned long>(reference / kernel),
+             static_cast<unsigned long>(reference * 100 / kernel % 100),
+             same ? "identical" : "MISMATCH");
+    }
+    enabled = wasEnabled;
+
+    free(kernelOut);
+    free(referenceOut);
+    free(mask);
+}
+
+}  // namespace LVGLDrawKernels
@@ -0,0 +1,60 @@
+#pragma once
+
+/*
+ * RGB565 blend kernels for LVGL's software renderer (LV_DRAW_SW_ASM_CUSTOM)
+ *
+ * lv_conf.h names this header as LV_DRAW_SW_ASM_CUSTOM_INCLUDE: LVGL's blend
+ * sources include it after their own headers (so lv_result_t is declared)
+ * and call the hooks below before their generic C loops. A hook returning
+ * LV_RESULT_INVALID falls back to the C path.
+ *
+ * Text goes through the masked hooks: glyphs are A4 in flash, decoded to an
+ * A8 mask by the font engine, then blended as a colour fill with that mask.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct _lv_draw_sw_blend_fill_dsc_t;
+
+/* Opaque fill, no mask */
+lv_result_t lvgl_m7_fill_rgb565(struct _lv_draw_sw_blend_fill_dsc_t* dsc);
+
+/* Uniform opacity, no mask (opa < LV_OPA_MAX) */
+lv_result_t lvgl_m7_fill_rgb565_opa(struct _lv_draw_sw_blend_fill_dsc_t* dsc);
+
+/* A8 mask, opaque colour (anti-aliased edges, text) */
+lv_result_t lvgl_m7_fill_rgb565_mask(struct _lv_draw_sw_blend_fill_dsc_t* dsc);
+
+/* A8 mask and opacity */
+lv_result_t lvgl_m7_fill_rgb565_mask_opa(struct _lv_draw_sw_blend_fill_dsc_t* dsc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) lvgl_m7_fill_rgb565(dsc)
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) lvgl_m7_fill_rgb565_opa(dsc)
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) lvgl_m7_fill_rgb565_mask(dsc)
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) lvgl_m7_fill_rgb565_mask_opa(dsc)
+
+#ifdef __cplusplus
+namespace LVGLDrawKernels {
+
+/** @brief Route blends to the kernels (default) or to LVGL's C loops */
+void setEnabled(bool enabled);
+bool isEnabled();
+
+/**
+ * @brief Time each kernel against LVGL's C path on the same input, and log it
+ *
+ * Both sides run through lv_draw_sw_blend_color_to_rgb565(), with the kernels
+ * enabled then disabled, on a scratch buffer from the heap. Outputs are
+ * compared byte for byte. Blocks for a few tens of milliseconds; run at boot
+ * (DRAW_KERNEL_BENCHMARK builds) or from a debug command, not per frame.
+ */
+void runBenchmark();
+
+}  // namespace LVGLDrawKernels
+#endif
@@ -3,6 +3,12 @@
 #include <Arduino.h>
 #include <lvgl.h>
 
+#include <string.h>
+
+#include "config/System.hpp"
+
+#if !LVGL_TIERED_MEMORY
+
 EXTMEM static uint8_t lvgl_memory_pool[LVGL_MEMORY_POOL_SIZE];
 
 extern "C" {
@@ -10,4 +16,250 @@ uint8_t* getLvglMemoryPool(size_t size) {
     (void)size;
     return lvgl_memory_pool;
 }
-}
\ No newline at end of file
+
+void getLvglMemoryStats(LvglMemoryStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+}
+
+#else
+
+/*
+ * Tiered allocator (LV_STDLIB_CUSTOM)
+ *
+ * Fast tier: RAM2 arena split into 1 KB pages (LVGL_FAST_POOL_SIZE, capped to
+ * the RAM2 the display and SysEx buffers leave, see System::Memory); a page is given to one size
+ * class (16-256 bytes) the first time that class needs room, and its blocks
+ * go to the class free list. No per-block header: the page gives the class
+ * back on free. Pages stay with their class once assigned.
+ *
+ * Large tier: PSRAM through extmem_malloc, with an 8-byte size header for
+ * realloc and accounting. A large block that stays large is resized with
+ * extmem_realloc, in place when the chunk after it is free.
+ */
+namespace {
+
+constexpr size_t PAGE_SIZE = 1024;
+
+constexpr size_t RAM2_RESERVED = System::Memory::RAM2_DISPLAY_BYTES +
+                                 System::Memory::RAM2_MIDI_BYTES + System::Memory::RAM2_HEAP_MIN;
+static_assert(RAM2_RESERVED <= System::Memory::RAM2_SIZE,
+              "Display and SysEx buffers leave less than RAM2_HEAP_MIN of RAM2");
+constexpr size_t RAM2_ARENA_ROOM =
+    (System::Memory::RAM2_SIZE - RAM2_RESERVED) / PAGE_SIZE * PAGE_SIZE;
+constexpr size_t FAST_ARENA_SIZE =
+    LVGL_FAST_POOL_SIZE < RAM2_ARENA_ROOM ? LVGL_FAST_POOL_SIZE : RAM2_ARENA_ROOM;
+static_assert(FAST_ARENA_SIZE >= PAGE_SIZE, "No RAM2 left for the LVGL fast arena");
+
+constexpr size_t PAGE_COUNT = FAST_ARENA_SIZE / PAGE_SIZE;
+constexpr uint8_t CLASS_COUNT = 5;
+constexpr size_t CLASS_SIZES[CLASS_COUNT] = {16, 32, 64, 128, 256};
+constexpr uint8_t NO_CLASS = 0xFF;
+constexpr size_t LARGE_HEADER = 8;  // Keeps 8-byte alignment
+
+static_assert(LVGL_FAST_MAX_ALLOC <= 256, "LVGL_FAST_MAX_ALLOC above the largest size class");
+static_assert(LVGL_FAST_POOL_SIZE % PAGE_SIZE == 0, "LVGL_FAST_POOL_SIZE must be whole pages");
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+DMAMEM alignas(8) uint8_t fastArena[FAST_ARENA_SIZE];
+uint8_t pageClass[PAGE_COUNT];
+size_t pagesUsed = 0;
+FreeBlock* freeLists[CLASS_COUNT];
+
+size_t fastUsed = 0;
+size_t fastCount = 0;
+size_t largeUsed = 0;
+size_t largeCount = 0;
+size_t maxUsed = 0;
+uint32_t fastFallbacks = 0;
+
+inline uint8_t classFor(size_t size) {
+    if (size > LVGL_FAST_MAX_ALLOC) return NO_CLASS;
+    for (uint8_t c = 0; c < CLASS_COUNT; ++c) {
+        if (size <= CLASS_SIZES[c]) return c;
+    }
+    return NO_CLASS;
+}
+
+inline bool isFast(const void* p) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(p);
+    return bytes >= fastArena && bytes < fastArena + sizeof(fastArena);
+}
+
+inline void trackPeak() {
+    if (fastUsed + largeUsed > maxUsed) maxUsed = fastUsed + largeUsed;
+}
+
+void* fastAlloc(uint8_t cls) {
+    if (!freeLists[cls]) {
+        if (pagesUsed == PAGE_COUNT) return nullptr;
+
+        const size_t page = pagesUsed++;
+        pageClass[page] = cls;
+        uint8_t* base = fastArena + page * PAGE_SIZE;
+        const size_t blockSize = CLASS_SIZES[cls];
+        for (size_t offset = PAGE_SIZE; offset >= blockSize; offset -= blockSize) {
+            auto* block = reinterpret_cast<FreeBlock*>(base + offset - blockSize);
+            block->next = freeLists[cls];
+            freeLists[cls] = block;
+        }
+    }
+
+    FreeBlock* block = freeLists[cls];
+    freeLists[cls] = block->next;
+    fastUsed += CLASS_SIZES[cls];
+    ++fastCount;
+    trackPeak();
+    return block;
+}
+
+inline uint8_t fastClassOf(const void* p) {
+    return pageClass[(static_cast<const uint8_t*>(p) - fastArena) / PAGE_SIZE];
+}
+
+void fastFree(void* p) {
+    const uint8_t cls = fastClassOf(p);
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = freeLists[cls];
+    freeLists[cls] = block;
+    fastUsed -= CLASS_SIZES[cls];
+    --fastCount;
+}
+
+void* largeAlloc(size_t size) {
+    if (largeUsed + size > LVGL_MEMORY_POOL_SIZE) return nullptr;
+
+    auto* raw = static_cast<uint8_t*>(extmem_malloc(size + LARGE_HEADER));
+    if (!raw) return nullptr;
+
+    memcpy(raw, &size, sizeof(size));
+    largeUsed += size;
+    ++largeCount;
+    trackPeak();
+    return raw + LARGE_HEADER;
+}
+
+inline size_t largeSizeOf(const void* p) {
+    size_t size;
+    memcpy(&size, static_cast<const uint8_t*>(p) - LARGE_HEADER, sizeof(size));
+    return size;
+}
+
+/* extmem_realloc keeps the block when it can: no copy, no second block during the move */
+void* largeRealloc(void* p, size_t newSize) {
+    const size_t oldSize = largeSizeOf(p);
+    if (largeUsed - oldSize + newSize > LVGL_MEMORY_POOL_SIZE) return nullptr;
+
+    auto* raw = static_cast<uint8_t*>(
+        extmem_realloc(static_cast<uint8_t*>(p) - LARGE_HEADER, newSize + LARGE_HEADER));
+    if (!raw) return nullptr;
+
+    memcpy(raw, &newSize, sizeof(newSize));
+    largeUsed = largeUsed - oldSize + newSize;
+    trackPeak();
+    return raw + LARGE_HEADER;
+}
+
+void largeFree(void* p) {
+    largeUsed -= largeSizeOf(p);
+    --largeCount;
+    extmem_free(static_cast<uint8_t*>(p) - LARGE_HEADER);
+}
+
+}  // namespace
+
+extern "C" {
+
+uint8_t* getLvglMemoryPool(size_t size) {
+    (void)size;
+    return nullptr;
+}
+
+void getLvglMemoryStats(LvglMemoryStats* stats) {
+    stats->fast_used = fastUsed;
+    stats->fast_pages = pagesUsed;
+    stats->large_used = largeUsed;
+    stats->fast_fallbacks = fastFallbacks;
+}
+
+void lv_mem_init(void) {
+    memset(pageClass, NO_CLASS, sizeof(pageClass));
+}
+
+void lv_mem_deinit(void) {}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    (void)mem;
+    (void)bytes;
+    return nullptr;  // Tiers are fixed
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    (void)pool;
+}
+
+void* lv_malloc_core(size_t size) {
+    const uint8_t cls = classFor(size);
+    if (cls != NO_CLASS) {
+        void* p = fastAlloc(cls);
+        if (p) return p;
+        ++fastFallbacks;
+    }
+    return largeAlloc(size);
+}
+
+void lv_free_core(void* p) {
+    if (!p) return;
+    if (isFast(p)) {
+        fastFree(p);
+    } else {
+        largeFree(p);
+    }
+}
+
+void* lv_realloc_core(void* p, size_t new_size) {
+    if (!p) return lv_malloc_core(new_size);
+
+    const bool fast = isFast(p);
+    const size_t oldSize = fast ? CLASS_SIZES[fastClassOf(p)] : largeSizeOf(p);
+    if (fast && new_size <= oldSize) return p;
+    if (!fast && (new_size <= oldSize || classFor(new_size) == NO_CLASS)) {
+        return largeRealloc(p, new_size);
+    }
+
+    void* moved = lv_malloc_core(new_size);
+    if (!moved) return nullptr;  // p stays valid, as with realloc()
+
+    memcpy(moved, p, oldSize < new_size ? oldSize : new_size);
+    lv_free_core(p);
+    return moved;
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) {
+    const size_t total = sizeof(fastArena) + LVGL_MEMORY_POOL_SIZE;
+    const size_t used = fastUsed + largeUsed;
+
+    memset(mon_p, 0, sizeof(*mon_p));
+    mon_p->total_size = total;
+    mon_p->free_size = total - used;
+    mon_p->free_biggest_size = LVGL_MEMORY_POOL_SIZE - largeUsed;
+    mon_p->used_cnt = fastCount + largeCount;
+    mon_p->max_used = maxUsed;
+    mon_p->used_pct = static_cast<uint8_t>(used * 100 / total);
+
+    // Fragmentation: arena pages held by size classes but not in use
+    const size_t assigned = pagesUsed * PAGE_SIZE;
+    if (assigned > 0) {
+        mon_p->frag_pct = static_cast<uint8_t>((assigned - fastUsed) * 100 / assigned);
+    }
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return LV_RESULT_OK;
+}
+}
+
+#endif
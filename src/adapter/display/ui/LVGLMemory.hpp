@@ -7,8 +7,19 @@
 extern "C" {
 #endif
 
+/* LVGL_TIERED_MEMORY == 0: single LVGL TLSF pool (LV_MEM_POOL_ALLOC) */
 uint8_t* getLvglMemoryPool(size_t size);
 
+/* LVGL_TIERED_MEMORY: usage per tier */
+typedef struct {
+    size_t fast_used;          /* bytes handed out from the RAM2 arena (size-class rounded) */
+    size_t fast_pages;         /* arena pages assigned to a size class */
+    size_t large_used;         /* bytes handed out from PSRAM */
+    uint32_t fast_fallbacks;   /* small allocations served from PSRAM, arena full */
+} LvglMemoryStats;
+
+void getLvglMemoryStats(LvglMemoryStats* stats);
+
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,53 @@
+#include "ShiftRegisterInput.hpp"
+
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
+
+ShiftRegisterInput::ShiftRegisterInput() {
+    for (volatile uint8_t& state : states_) {
+        state = 0xFF;
+    }
+    responder_.setContext(this);
+    responder_.attachInterrupt(transferDone);
+}
+
+void ShiftRegisterInput::enableInput(uint8_t input) {
+    if (enabled_ || input >= System::Hardware::SHIFT_REG_MAX_INPUTS) {
+        return;
+    }
+
+    pinMode(System::Hardware::SHIFT_REG_LOAD_PIN, OUTPUT);
+    digitalWriteFast(System::Hardware::SHIFT_REG_LOAD_PIN, HIGH);
+    SPI.begin();
+    enabled_ = true;
+    LOGF("[ShiftRegisterInput] %u inputs on SPI\n",
+         static_cast<unsigned>(System::Hardware::SHIFT_REG_MAX_INPUTS));
+}
+
+HOT_CODE void ShiftRegisterInput::scan() {
+    if (!enabled_ || busy_) {
+        return;
+    }
+
+    // SH/LD low latches all the chips' inputs; high again hands them to the shift chain
+    digitalWriteFast(System::Hardware::SHIFT_REG_LOAD_PIN, LOW);
+    delayNanoseconds(System::Hardware::SHIFT_REG_LOAD_PULSE_NS);
+    digitalWriteFast(System::Hardware::SHIFT_REG_LOAD_PIN, HIGH);
+
+    busy_ = true;
+    SPI.beginTransaction(SPISettings(System::Hardware::SHIFT_REG_SPI_HZ, MSBFIRST, SPI_MODE0));
+    if (!SPI.transfer(nullptr, rxBuffer_, BYTES, responder_)) {
+        SPI.endTransaction();
+        busy_ = false;  // DMA busy elsewhere: try again on the next scan
+    }
+}
+
+HOT_CODE void ShiftRegisterInput::transferDone(EventResponderRef event) {
+    auto* self = static_cast<ShiftRegisterInput*>(event.getContext());
+    SPI.endTransaction();
+    for (size_t i = 0; i < BYTES; ++i) {
+        self->states_[i] = self->rxBuffer_[i];
+    }
+    ++self->scanCount_;
+    self->busy_ = false;
+}
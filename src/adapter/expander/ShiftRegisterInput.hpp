@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include <EventResponder.h>
+#include <SPI.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+
+/**
+ * @brief Chained 74HC165 inputs, read by SPI DMA into a bit array
+ *
+ * scan() never waits: when no transfer is in flight it pulses SH/LD, which
+ * latches every input of the chain at once, and starts one DMA transfer of
+ * System::Hardware::SHIFT_REG_CHIPS bytes. The completion interrupt copies
+ * the bytes to the cached states and counts the scan. The CPU cost of a
+ * scan is the same whatever the chain length, and there is no per-input
+ * settle delay as on the mux.
+ *
+ * Input n is pin D(n % 8) of chip n / 8, chip 0 being the one whose QH
+ * goes to MISO. readInput() returns the cached level of the last scan.
+ */
+class ShiftRegisterInput {
+public:
+    static_assert(System::Hardware::SHIFT_REG_CHIPS <= 31, "SHIFT_REG_MAX_INPUTS is a uint8_t");
+
+    static constexpr size_t BYTES =
+        System::Hardware::SHIFT_REG_CHIPS > 0 ? System::Hardware::SHIFT_REG_CHIPS : 1;
+
+    ShiftRegisterInput();
+    ~ShiftRegisterInput() = default;
+
+    ShiftRegisterInput(const ShiftRegisterInput&) = delete;
+    ShiftRegisterInput& operator=(const ShiftRegisterInput&) = delete;
+
+    /** @brief An input is used: set up the load pin and SPI on first call */
+    void enableInput(uint8_t input);
+
+    /** @brief Start the next transfer if the previous one is done, never blocks */
+    void scan();
+
+    bool readInput(uint8_t input) const {
+        if (input >= System::Hardware::SHIFT_REG_MAX_INPUTS) return true;
+        return (states_[input >> 3] >> (input & 7)) & 1u;
+    }
+
+    /** @brief Cached levels, bit (n % 8) of byte n / 8 = input n (1 = HIGH) */
+    const volatile uint8_t* getStates() const {
+        return states_;
+    }
+
+    /** @brief Incremented each time the whole chain has been read */
+    uint32_t getScanCount() const {
+        return scanCount_;
+    }
+
+private:
+    static void transferDone(EventResponderRef event);
+
+    EventResponder responder_;
+    uint8_t rxBuffer_[BYTES] = {};
+    volatile uint8_t states_[BYTES];  // Pull-ups: idle HIGH until read
+    volatile uint32_t scanCount_ = 0;
+    volatile bool busy_ = false;
+    bool enabled_ = false;
+};
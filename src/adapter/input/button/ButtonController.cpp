@@ -2,68 +2,258 @@
 
 #include <Arduino.h>
 
+#include <string.h>
+
+#include "../../expander/ShiftRegisterInput.hpp"
 #include "../../multiplexer/MultiplexerController.hpp"
-#include "ButtonFactory.hpp"
+#include "config/InputDefinition.hpp"
 #include "config/System.hpp"
 #include "core/event/Events.hpp"
 #include "core/event/IEventBus.hpp"
+#include "core/util/MemoryPlacement.hpp"
 #include "log/Macros.hpp"
+#include "log/Profiler.hpp"
+
+namespace {
+
+constexpr bool buttonTableValid() {
+    for (const auto& button : Config::BUTTONS) {
+        if (!ButtonReader::isValid(button.pin)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(buttonTableValid(),
+              "Config::BUTTONS contains an invalid MCU pin, mux channel or shift register input");
+static_assert(Config::BUTTON_COUNT <= System::Hardware::BUTTONS_COUNT,
+              "Config::BUTTONS exceeds System::Hardware::BUTTONS_COUNT");
+
+}  // namespace
+
+ButtonController* ButtonController::instance_ = nullptr;
 
 ButtonController::ButtonController(
     const etl::vector<Hardware::Button, System::Hardware::BUTTONS_COUNT>& buttonSetups,
-    Multiplexer& mux, IEventBus& eventBus)
-    : eventBus_(eventBus) {
+    Multiplexer& mux, ShiftRegisterInput& shiftRegs, IEventBus& eventBus)
+    : mux_(mux), shiftRegs_(shiftRegs), eventBus_(eventBus) {
+    static_assert(System::Hardware::BUTTONS_COUNT <= 32, "Button masks hold 32 buttons");
+
+    memset(slots_, INVALID_INPUT_INDEX, sizeof(slots_));
     for (const auto& setup : buttonSetups) {
-        auto button = ButtonFactory::createButton(setup, mux);
-
-        if (button) {
-            size_t index = ownedButtons_.size();
-            ownedButtons_.push_back(std::move(button));
-            lastStates_.push_back(false);
-            lastChangeTime_.push_back(0);  // Initialize debounce timer
-            idToIndex_[setup.id] = index;  // Map InputId -> array index
-        } else {
+        const uint8_t idIndex = buttonIndex(setup.id);
+        if (idIndex == INVALID_INPUT_INDEX) {
+            LOGLN("[ButtonController] ERROR: ButtonID missing from BUTTON_IDS");
+            continue;
+        }
+        ButtonReader reader(setup.pin);
+
+        if (reader.getKind() == ButtonReader::Kind::Invalid) {
             LOGLN("[ButtonController] ERROR: Failed to create button");
+            continue;
+        }
+
+        size_t index = readers_.size();
+        reader.initialize(mux, shiftRegs);
+        if (!reader.isExpanded()) {
+            reader.bindPort(portSlot(reader.portRegister()));
+        }
+        readers_.push_back(reader);
+        ids_.push_back(setup.id);
+        debouncers_.push_back(ButtonDebouncer(setup.debounce));
+        if (setup.debounce == Hardware::DebounceMode::SampleHistory) {
+            sampleHistoryMask_ |= 1u << index;
         }
+        hasMuxButtons_ = hasMuxButtons_ || reader.isMultiplexed();
+        hasShiftRegButtons_ =
+            hasShiftRegButtons_ || reader.getKind() == ButtonReader::Kind::ShiftReg;
+        slots_[idIndex] = static_cast<uint8_t>(index);
     }
+
+    startSampler();
 }
 
-ButtonController::~ButtonController() = default;
+ButtonController::~ButtonController() {
+    if (samplerRunning_) {
+        sampleTimer_.end();
+    }
+    if (instance_ == this) {
+        instance_ = nullptr;
+    }
+}
 
-void ButtonController::updateAll() {
-    uint32_t now = millis();
+void ButtonController::startSampler() {
+    if (System::Input::BUTTON_SAMPLE_RATE_HZ == 0 || instance_ != nullptr) {
+        return;
+    }
 
-    for (size_t i = 0; i < ownedButtons_.size(); ++i) {
-        auto& btn = ownedButtons_[i];
-        btn->update();
+    // One mux channel is sampled per tick, so tick fast enough to visit every
+    // channel BUTTON_SAMPLE_RATE_HZ times per second
+    uint32_t ticksPerScan = 0;
+    for (const auto& reader : readers_) {
+        if (reader.isMultiplexed()) {
+            ++ticksPerScan;
+        }
+    }
+    if (ticksPerScan == 0) {
+        ticksPerScan = 1;
+    }
 
-        bool currentState = btn->isPressed();
-        if (currentState == lastStates_[i]) {
-            continue;
+    float periodUs = 1000000.0f / (static_cast<float>(System::Input::BUTTON_SAMPLE_RATE_HZ) *
+                                   static_cast<float>(ticksPerScan));
+    if (periodUs < System::Hardware::MUX_DEBOUNCE_US) {
+        periodUs = System::Hardware::MUX_DEBOUNCE_US;
+    }
+
+    instance_ = this;
+    samplerRunning_ = sampleTimer_.begin(sampleIsr, periodUs);
+    if (samplerRunning_) {
+        sampleTimer_.priority(System::Input::BUTTON_SAMPLER_IRQ_PRIORITY);
+    } else {
+        instance_ = nullptr;
+        LOGLN("[ButtonController] No IntervalTimer available - polling buttons");
+    }
+}
+
+HOT_CODE void ButtonController::sampleIsr() {
+    if (instance_) {
+        instance_->sample();
+    }
+}
+
+HOT_CODE void ButtonController::sample() {
+    mux_.scan();
+    shiftRegs_.scan();
+
+    // Debouncers advance once per complete scan: every mux channel and
+    // shift register input has a fresh sample
+    const uint32_t scanCount = mux_.getScanCount();
+    const uint32_t shiftScanCount = shiftRegs_.getScanCount();
+    if ((hasMuxButtons_ && scanCount == lastScanCount_) ||
+        (hasShiftRegButtons_ && shiftScanCount == lastShiftScanCount_)) {
+        return;
+    }
+    lastScanCount_ = scanCount;
+    lastShiftScanCount_ = shiftScanCount;
+
+    uint32_t nowUs = micros();
+    uint32_t previous = sampledMask_;
+    uint32_t mask = debounce(readRawMask(), millis());
+
+    // One XOR finds every edge of this scan
+    uint32_t changed = mask ^ previous;
+    while (changed) {
+        uint8_t i = static_cast<uint8_t>(__builtin_ctz(changed));
+        changed &= changed - 1;
+        transitions_.push({i, ((mask >> i) & 1u) != 0, nowUs});
+    }
+
+    sampledMask_ = mask;
+}
+
+uint8_t ButtonController::portSlot(volatile uint32_t* psr) {
+    for (size_t i = 0; i < ports_.size(); ++i) {
+        if (ports_[i] == psr) {
+            return static_cast<uint8_t>(i);
         }
+    }
+    ports_.push_back(psr);
+    return static_cast<uint8_t>(ports_.size() - 1);
+}
+
+HOT_CODE uint32_t ButtonController::readRawMask() const {
+    // One load per GPIO bank: pins sharing a port are sampled together
+    uint32_t portLevels[System::Hardware::BUTTONS_COUNT];
+    for (size_t i = 0; i < ports_.size(); ++i) {
+        portLevels[i] = *ports_[i];
+    }
+
+    uint16_t muxStates = mux_.getChannelStates();
+    const volatile uint8_t* shiftStates = shiftRegs_.getStates();
+    uint32_t raw = 0;
 
-        uint32_t elapsed = now - lastChangeTime_[i];
-        if (elapsed < System::Input::BUTTON_DEBOUNCE_MS) {
-            continue;  // Too soon - ignore this change
+    for (size_t i = 0; i < readers_.size(); ++i) {
+        // Active low: pressed pulls the line to ground
+        if (!readers_[i].readLevel(muxStates, portLevels, shiftStates)) {
+            raw |= 1u << i;
         }
+    }
+    return raw;
+}
 
-        lastStates_[i] = currentState;
-        lastChangeTime_[i] = now;
+HOT_CODE uint32_t ButtonController::debounce(uint32_t raw, uint32_t nowMs) {
+    uint32_t state = sampledMask_;
 
-        if (currentState) {
-            eventBus_.emit(ButtonPressEvent(btn->getId(), true));
-        } else {
-            eventBus_.emit(ButtonReleaseEvent(btn->getId()));
+    // SampleHistory: a bit flips once it agreed over the last HISTORY_DEPTH scans
+    history_[historyIndex_] = raw;
+    historyIndex_ = static_cast<uint8_t>((historyIndex_ + 1) % HISTORY_DEPTH);
+
+    uint32_t stablePressed = ~0u;
+    uint32_t stableReleased = ~0u;
+    for (uint32_t sample : history_) {
+        stablePressed &= sample;
+        stableReleased &= ~sample;
+    }
+    uint32_t next = ((state | stablePressed) & ~stableReleased) & sampleHistoryMask_;
+
+    // Integrator / Lockout: per-button state machines
+    uint32_t others = 0;
+    for (size_t i = 0; i < debouncers_.size(); ++i) {
+        uint32_t bit = 1u << i;
+        if (sampleHistoryMask_ & bit) {
+            continue;
         }
+        debouncers_[i].update((raw & bit) != 0, nowMs);
+        if (debouncers_[i].isPressed()) {
+            others |= bit;
+        }
+    }
+
+    return next | others;
+}
+
+HOT_CODE void ButtonController::updateAll() {
+    PROFILE_SECTION("buttons");
+    if (!samplerRunning_) {
+        sample();
+    }
+
+    // Edges in the order they were sampled (catches presses shorter than a loop)
+    Transition transition;
+    while (transitions_.pop(transition)) {
+        applyState(transition.index, transition.pressed, transition.timeUs);
+    }
+
+    // Resync with the debounced mask in case the ring overflowed (edge time lost)
+    uint32_t mask = sampledMask_;
+    uint32_t drift = mask ^ emittedMask_;
+    while (drift) {
+        size_t i = static_cast<size_t>(__builtin_ctz(drift));
+        drift &= drift - 1;
+        applyState(i, (mask >> i) & 1u, 0);
     }
 }
 
-UnifiedButton* ButtonController::getButton(ButtonID id) {
-    auto it = idToIndex_.find(id);
-    return (it != idToIndex_.end()) ? ownedButtons_[it->second].get() : nullptr;
+HOT_CODE void ButtonController::applyState(size_t index, bool pressed, uint32_t timeUs) {
+    uint32_t bit = 1u << index;
+    if (pressed == ((emittedMask_ & bit) != 0)) {
+        return;
+    }
+
+    emittedMask_ ^= bit;
+
+    ButtonID id = ids_[index];
+    if (pressed) {
+        eventBus_.emit(ButtonPressEvent(id, true, timeUs));
+    } else {
+        eventBus_.emit(ButtonReleaseEvent(id, timeUs));
+    }
 }
 
-const UnifiedButton* ButtonController::getButton(ButtonID id) const {
-    auto it = idToIndex_.find(id);
-    return (it != idToIndex_.end()) ? ownedButtons_[it->second].get() : nullptr;
-}
\ No newline at end of file
+bool ButtonController::isPressed(ButtonID id) const {
+    const uint8_t idIndex = buttonIndex(id);
+    if (idIndex == INVALID_INPUT_INDEX) return false;
+    const uint8_t slot = slots_[idIndex];
+    return slot < ids_.size() && ((emittedMask_ >> slot) & 1u);
+}
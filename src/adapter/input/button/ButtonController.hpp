@@ -1,40 +1,105 @@
 #pragma once
 
-#include <etl/flat_map.h>
+#include <Arduino.h>
 #include <etl/vector.h>
 
-#include "UnifiedButton.hpp"
+#include "ButtonDebouncer.hpp"
+#include "ButtonReader.hpp"
+#include "config/InputID.hpp"
 #include "config/System.hpp"
 #include "core/Type.hpp"
 #include "core/struct/Button.hpp"
+#include "core/util/SpscRing.hpp"
 
 class IEventBus;
 class Multiplexer;
+class ShiftRegisterInput;
 
+/**
+ * @brief Owns all buttons, samples them and emits press/release events
+ *
+ * With System::Input::BUTTON_SAMPLE_RATE_HZ > 0, sampling runs from an
+ * IntervalTimer: the ISR advances the mux scan and the shift register
+ * transfer (ShiftRegisterInput), reads every button and
+ * pushes debounced transitions into a lock-free ring. updateAll() (main loop)
+ * drains the ring and emits the events, so detection no longer depends on
+ * how long the previous frame took. With a rate of 0, updateAll() samples
+ * directly (polling).
+ *
+ * Readers are plain ButtonReader values in a fixed array and button state is
+ * packed into uint32_t masks (bit i = button i), so a scan builds one raw mask
+ * and change detection is a single XOR. MCU pins are grouped by GPIO port and
+ * each port register is loaded once per scan. SampleHistory buttons are debounced
+ * on the whole mask at once; Integrator and Lockout buttons keep a per-button
+ * ButtonDebouncer. Debouncing advances once per complete scan so every button
+ * sees the same sample period.
+ */
 class ButtonController {
 public:
     explicit ButtonController(
         const etl::vector<Hardware::Button, System::Hardware::BUTTONS_COUNT>& buttonSetups,
-        Multiplexer& mux, IEventBus& eventBus);
+        Multiplexer& mux, ShiftRegisterInput& shiftRegs, IEventBus& eventBus);
     ~ButtonController();
 
     ButtonController(const ButtonController&) = delete;
     ButtonController& operator=(const ButtonController&) = delete;
-    ButtonController(ButtonController&&) = default;
-    ButtonController& operator=(ButtonController&&) = default;
+    ButtonController(ButtonController&&) = delete;
+    ButtonController& operator=(ButtonController&&) = delete;
 
     void updateAll();
 
-    UnifiedButton* getButton(ButtonID id);
-    const UnifiedButton* getButton(ButtonID id) const;
+    /** @brief Sampled edges updateAll() has not emitted yet */
+    bool hasPending() const {
+        return !transitions_.empty() || sampledMask_ != emittedMask_;
+    }
+
+    /** @brief Debounced state as last emitted (false for unknown ids) */
+    bool isPressed(ButtonID id) const;
 
 private:
-    etl::vector<std::unique_ptr<UnifiedButton>, System::Hardware::BUTTONS_COUNT> ownedButtons_;
+    struct Transition {
+        uint8_t index;
+        bool pressed;
+        uint32_t timeUs;  // micros() of the scan that confirmed the edge
+    };
+
+    static void sampleIsr();
+
+    void startSampler();
+    void sample();
+    uint8_t portSlot(volatile uint32_t* psr);
+    uint32_t readRawMask() const;
+    uint32_t debounce(uint32_t raw, uint32_t nowMs);
+    void applyState(size_t index, bool pressed, uint32_t timeUs);
+
+    static constexpr uint8_t HISTORY_DEPTH = System::Input::DEBOUNCE_STABLE_SAMPLES;
+    static_assert(HISTORY_DEPTH >= 1 && HISTORY_DEPTH <= 8, "DEBOUNCE_STABLE_SAMPLES must be 1-8");
 
-    etl::vector<bool, System::Hardware::BUTTONS_COUNT> lastStates_;
-    etl::vector<uint32_t, System::Hardware::BUTTONS_COUNT> lastChangeTime_;  // Software debounce
+    etl::vector<ButtonReader, System::Hardware::BUTTONS_COUNT> readers_;
+    etl::vector<volatile uint32_t*, System::Hardware::BUTTONS_COUNT> ports_;  // Distinct PSRs
+    etl::vector<ButtonID, System::Hardware::BUTTONS_COUNT> ids_;
+    etl::vector<ButtonDebouncer, System::Hardware::BUTTONS_COUNT> debouncers_;
 
-    etl::flat_map<ButtonID, size_t, System::Hardware::BUTTONS_COUNT> idToIndex_;
+    uint32_t emittedMask_ = 0;        // Last state emitted
+    uint32_t sampleHistoryMask_ = 0;  // Buttons debounced on the packed history
+    uint32_t history_[HISTORY_DEPTH] = {};
+    uint8_t historyIndex_ = 0;
 
+    uint8_t slots_[BUTTON_ID_COUNT];  // buttonIndex(id) -> readers_ index
+
+    Multiplexer& mux_;
+    ShiftRegisterInput& shiftRegs_;
     IEventBus& eventBus_;
-};
\ No newline at end of file
+
+    /* Sampler state (written by sample(), ISR context when the timer runs) */
+    SpscRing<Transition, System::Memory::MAX_BUTTON_TRANSITIONS> transitions_;
+    volatile uint32_t sampledMask_ = 0;  // bit i = button i pressed (debounced)
+    uint32_t lastScanCount_ = 0;
+    uint32_t lastShiftScanCount_ = 0;
+    bool hasMuxButtons_ = false;
+    bool hasShiftRegButtons_ = false;
+    IntervalTimer sampleTimer_;
+    bool samplerRunning_ = false;
+
+    static ButtonController* instance_;
+};
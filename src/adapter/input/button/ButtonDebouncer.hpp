@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/struct/Button.hpp"
+
+/**
+ * @brief Debounces one button from periodic raw samples
+ *
+ * Fed once per full button scan (BUTTON_SAMPLE_RATE_HZ). Integrator reports an
+ * edge after a few agreeing samples; Lockout keeps the legacy "first edge
+ * wins, then BUTTON_DEBOUNCE_MS dead time" behavior. SampleHistory buttons
+ * are debounced by ButtonController on the packed mask, not here.
+ */
+class ButtonDebouncer {
+public:
+    explicit ButtonDebouncer(Hardware::DebounceMode mode = Hardware::DebounceMode::Lockout)
+        : mode_(mode), state_(false), integrator_(0), lastChangeMs_(0) {}
+
+    /**
+     * @brief Feed one raw sample
+     * @param pressed Raw (bouncy) pressed level
+     * @param nowMs Sample time, used by Lockout only
+     * @return true if the debounced state changed
+     */
+    bool update(bool pressed, uint32_t nowMs) {
+        switch (mode_) {
+            case Hardware::DebounceMode::Lockout:
+            default:
+                if (pressed == state_ ||
+                    nowMs - lastChangeMs_ < System::Input::BUTTON_DEBOUNCE_MS) {
+                    return false;
+                }
+                lastChangeMs_ = nowMs;
+                break;
+
+            case Hardware::DebounceMode::Integrator:
+                if (pressed) {
+                    if (integrator_ < System::Input::DEBOUNCE_INTEGRATOR_SAMPLES) {
+                        ++integrator_;
+                    }
+                } else if (integrator_ > 0) {
+                    --integrator_;
+                }
+
+                if (!state_ && integrator_ == System::Input::DEBOUNCE_INTEGRATOR_SAMPLES) {
+                    pressed = true;
+                } else if (state_ && integrator_ == 0) {
+                    pressed = false;
+                } else {
+                    return false;
+                }
+                break;
+        }
+
+        state_ = pressed;
+        return true;
+    }
+
+    bool isPressed() const {
+        return state_;
+    }
+
+private:
+    Hardware::DebounceMode mode_;
+    bool state_;
+    uint8_t integrator_;
+    uint32_t lastChangeMs_;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "adapter/expander/ShiftRegisterInput.hpp"
+#include "adapter/multiplexer/MultiplexerController.hpp"
+#include "config/System.hpp"
+#include "core/Type.hpp"
+
+/**
+ * @brief Devirtualized button input: a direct MCU pin, a mux channel or a
+ *        shift register input
+ *
+ * Plain value type stored in a fixed array by ButtonController. Reading is a
+ * switch on the source instead of a virtual call through a heap object.
+ *
+ * MCU pins are read from a GPIO port snapshot: ButtonController loads each
+ * port's PSR register once per scan, so buttons on the same bank are sampled
+ * in the same instant.
+ */
+class ButtonReader {
+public:
+    enum class Kind : uint8_t { Invalid, Mcu, Mux, ShiftReg };
+
+    static constexpr uint8_t MAX_MCU_PIN = 41;  // Teensy 4.1 digital pins 0-41
+
+    static constexpr bool isValid(const GpioPin& gpio) {
+        switch (gpio.source) {
+            case GpioPin::Source::MUX:
+                return gpio.pin < System::Hardware::MUX_MAX_CHANNELS;
+            case GpioPin::Source::SHIFT_REG:
+                return gpio.pin < System::Hardware::SHIFT_REG_MAX_INPUTS;
+            default:
+                return gpio.pin <= MAX_MCU_PIN;
+        }
+    }
+
+    constexpr ButtonReader()
+        : kind_(Kind::Invalid), pin_(0), mode_(PinMode::PULLUP), port_(0), bitMask_(0) {}
+
+    explicit constexpr ButtonReader(const GpioPin& gpio)
+        : kind_(!isValid(gpio) ? Kind::Invalid
+                : gpio.source == GpioPin::Source::MUX       ? Kind::Mux
+                : gpio.source == GpioPin::Source::SHIFT_REG ? Kind::ShiftReg
+                                                            : Kind::Mcu),
+          pin_(gpio.pin),
+          mode_(gpio.mode),
+          port_(0),
+          bitMask_(0) {}
+
+    void initialize(Multiplexer& mux, ShiftRegisterInput& shiftRegs) const {
+        switch (kind_) {
+            case Kind::Mcu:
+                pinMode(pin_, mode_ == PinMode::PULLUP     ? INPUT_PULLUP
+                              : mode_ == PinMode::PULLDOWN ? INPUT_PULLDOWN
+                                                           : INPUT);
+                break;
+            case Kind::Mux:
+                mux.enableChannel(pin_);
+                break;
+            case Kind::ShiftReg:
+                shiftRegs.enableInput(pin_);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /** @brief PSR register holding this pin (MCU pins only) */
+    volatile uint32_t* portRegister() const {
+        return portInputRegister(pin_);
+    }
+
+    /** @brief Bind to the controller's port snapshot slot (MCU pins only) */
+    void bindPort(uint8_t port) {
+        port_ = port;
+        bitMask_ = digitalPinToBitMask(pin_);
+    }
+
+    /**
+     * @brief Raw pin level (true = HIGH)
+     * @param muxStates Cached mux levels from Multiplexer::getChannelStates()
+     * @param portLevels PSR snapshots, indexed by the slot given to bindPort()
+     * @param shiftStates Cached levels from ShiftRegisterInput::getStates()
+     */
+    bool readLevel(uint16_t muxStates, const uint32_t* portLevels,
+                   const volatile uint8_t* shiftStates) const {
+        switch (kind_) {
+            case Kind::Mux:
+                return (muxStates >> pin_) & 1u;
+            case Kind::ShiftReg:
+                return (shiftStates[pin_ >> 3] >> (pin_ & 7)) & 1u;
+            default:
+                return (portLevels[port_] & bitMask_) != 0;
+        }
+    }
+
+    Kind getKind() const {
+        return kind_;
+    }
+
+    bool isMultiplexed() const {
+        return kind_ == Kind::Mux;
+    }
+
+    /** @brief Not an MCU pin: no GPIO port to bind */
+    bool isExpanded() const {
+        return kind_ == Kind::Mux || kind_ == Kind::ShiftReg;
+    }
+
+private:
+    Kind kind_;
+    uint8_t pin_;
+    PinMode mode_;
+    uint8_t port_;
+    uint32_t bitMask_;
+};
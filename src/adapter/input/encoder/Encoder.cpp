@@ -3,64 +3,149 @@
 #include <Arduino.h>
 
 #include "core/event/Events.hpp"
+#include "config/System.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
 
 namespace {
 constexpr uint8_t TICK_COUNT_METHOD = 4; // Full Quadrature Mode
 constexpr uint16_t FULL_RANGE_ANGLE = 270;
 constexpr float DISCRETE_VALUES_SENSITIVITY = 0.5;
+
+/* Polled decoding, index (previous << 2) | current with state (A << 1) | B:
+ * A leading B counts up, as EncoderTool. Both pins changed is invalid (0 here,
+ * counted by poll(), as is the same pin changing twice in a row).
+ */
+constexpr int8_t QUADRATURE_STEPS[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+
+/* Virtual position of value in a range of `range` positions */
+int32_t positionOf(UNorm16 value, int32_t range) {
+    return static_cast<int32_t>((static_cast<uint32_t>(value.raw) * (range - 1) +
+                                 UNorm16::MAX_RAW / 2) /
+                                UNorm16::MAX_RAW);
+}
 }
 
 Encoder::Encoder(const Hardware::Encoder& setup, IEventBus& eventBus)
     : id_(setup.id),
       encoder_(),
+      pinA_(setup.pinA.pin),
+      pinB_(setup.pinB.pin),
       mode_(setup.mode),
       ppr_(setup.ppr),
       stepsPerDetent_(setup.stepsPerDetent),
       virtualRange_(0),
       virtualPosition_(0),
-      lastNormalizedValue_(0.5f),
+      lastValue_(UNorm16::fromFloat(0.5f)),
       accumulatedDelta_(0),
       relativePosition_(0.0f),
       eventBus_(eventBus),
-      hasPendingEvent_(false),
-      pendingValue_(0.0f),
       discreteSteps_(0),
-      lastQuantizedValue_(-1.0f) {
+      lastStep_(-1),
+      takeover_(setup.takeover),
+      targetValue_(),
+      tracking_(true),
+      pendingTicks_(0),
+      pendingEdgeUs_(0),
+      acceleration_(setup.acceleration),
+      lastTickUs_(0),
+      smoothedIntervalUs_(setup.acceleration.slowIntervalUs),
+      lastDirection_(0),
+      stormWindowUs_(0),
+      stormEdges_(0),
+      pollState_(0),
+      pollLastPins_(0),
+      polled_(false),
+      invalidTransitions_(0),
+      storms_(0),
+      pollingSinceMs_(0) {
     virtualRange_ = calculateDefaultVirtualRange();
     virtualPosition_ = virtualRange_ / 2;
 
     encoder_.begin(setup.pinA.pin, setup.pinB.pin, EncoderTool::CountMode::full);
-    encoder_.attachCallback([this](int, int delta) { this->processEncoderChange(delta); });
+    encoder_.attachCallback([this](int, int delta) { this->onPinEdge(delta); });
 }
 
 Encoder::~Encoder() = default;
 
-void Encoder::flushEvents() {
-    if (!hasPendingEvent_) return;
+HOT_CODE void Encoder::flushEvents(EncoderFrameEvent* frame) {
+    // Ticks first: a tick landing between the two swaps is left without an edge and
+    // stamped when it is flushed. Edge first would leave that tick's edge behind,
+    // set with no ticks, and stamp the next turn with it. The edge is taken even
+    // when the ticks cancel out, for the same reason.
+    const int32_t ticks = pendingTicks_.exchange(0, std::memory_order_acquire);
+    const uint32_t edgeUs = pendingEdgeUs_.exchange(0, std::memory_order_acquire);
+    if (ticks == 0) return;
+
+    const uint32_t timestampUs = edgeUs != 0 ? edgeUs : micros();
+    if (mode_ == Hardware::EncoderMode::Relative) {
+        float position;
+        const int32_t detents = handleRelativeMode(ticks, position);
+        if (detents != 0) {
+            const EncoderChangedEvent event(id_, position, timestampUs,
+                                            static_cast<int16_t>(detents));
+            eventBus_.emit(event);
+            if (frame) frame->add(event);
+        }
+        return;
+    }
+
+    UNorm16 value;
+    if (handleAbsoluteMode(ticks, value)) {
+        const EncoderChangedEvent event(id_, value, timestampUs);
+        eventBus_.emit(event);
+        if (frame) frame->add(event);
+    }
+}
 
-    hasPendingEvent_ = false;
-    eventBus_.emit(EncoderChangedEvent(id_, pendingValue_));
+void Encoder::discardPending() {
+    pendingEdgeUs_.store(0, std::memory_order_relaxed);
+    pendingTicks_.store(0, std::memory_order_release);
 }
 
 void Encoder::resetPosition(float normalizedValue) {
+    discardPending();
+
     if (mode_ == Hardware::EncoderMode::Relative) {
         relativePosition_ = normalizedValue;
         accumulatedDelta_ = 0;
-        hasPendingEvent_ = false;
         return;
     }
 
-    normalizedValue = constrain(normalizedValue, 0.0f, 1.0f);
-    virtualPosition_ = static_cast<int32_t>(normalizedValue * (virtualRange_ - 1));
-    lastNormalizedValue_ = normalizedValue;
-    hasPendingEvent_ = false;
+    lastValue_ = UNorm16::fromFloat(normalizedValue);
+    virtualPosition_ = positionOf(lastValue_, virtualRange_);
+    tracking_ = true;
+}
+
+void Encoder::syncTo(float normalizedValue) {
+    if (mode_ == Hardware::EncoderMode::Relative || takeover_ == Hardware::EncoderTakeover::Jump) {
+        resetPosition(normalizedValue);
+        return;
+    }
+
+    targetValue_ = UNorm16::fromFloat(normalizedValue);
+
+    // Host values come back 7-bit quantized: an echo of what the encoder just
+    // sent lands within one MIDI LSB (or one virtual step) of it and must not
+    // drop tracking
+    const int32_t midiStep = UNorm16::MAX_RAW / 127;
+    const int32_t virtualStep = UNorm16::MAX_RAW / (virtualRange_ - 1);
+    const int32_t tolerance = midiStep > virtualStep ? midiStep : virtualStep;
+    tracking_ = abs(static_cast<int32_t>(targetValue_.raw) - lastValue_.raw) <= tolerance;
+}
+
+void Encoder::setTakeover(Hardware::EncoderTakeover takeover) {
+    takeover_ = takeover;
+    if (takeover == Hardware::EncoderTakeover::Jump && !tracking_) {
+        resetPosition(targetValue_.toFloat());
+    }
 }
 
 void Encoder::setDiscreteSteps(uint8_t steps) {
     if (mode_ != Hardware::EncoderMode::Absolute) return;
 
     discreteSteps_ = steps;
-    lastQuantizedValue_ = -1.0f;
+    lastStep_ = -1;
 
     int32_t defaultRange = calculateDefaultVirtualRange();
     int32_t minRangeForSteps = steps * (1.0 / DISCRETE_VALUES_SENSITIVITY);
@@ -69,73 +154,225 @@ void Encoder::setDiscreteSteps(uint8_t steps) {
         ? minRangeForSteps
         : defaultRange;
 
-    virtualPosition_ = static_cast<int32_t>(lastNormalizedValue_ * (virtualRange_ - 1));
+    virtualPosition_ = positionOf(lastValue_, virtualRange_);
 }
 
 void Encoder::setContinuous() {
     setDiscreteSteps(0);
 }
 
-void Encoder::processEncoderChange(int32_t delta) {
+void Encoder::setAcceleration(const Hardware::EncoderAcceleration& acceleration) {
+    // Interrupt-side state: a configuration change, not worth a lock-free path
+    noInterrupts();
+    acceleration_ = acceleration;
+    smoothedIntervalUs_ = acceleration.slowIntervalUs;
+    lastDirection_ = 0;
+    interrupts();
+}
+
+HOT_CODE void Encoder::onPinEdge(int32_t delta) {
+    if (System::Input::ENCODER_STORM_EDGES != 0) {
+        const uint32_t nowUs = micros();
+        if (nowUs - stormWindowUs_ >= System::Input::ENCODER_STORM_WINDOW_US) {
+            stormWindowUs_ = nowUs;
+            stormEdges_ = 0;
+        }
+        if (++stormEdges_ > System::Input::ENCODER_STORM_EDGES) {
+            enterPolling();
+            return;
+        }
+    }
+    processEncoderChange(delta);
+}
+
+/* Pin interrupt context: the loop logs the switch and EncoderController starts polling */
+void Encoder::enterPolling() {
+    detachInterrupt(pinA_);
+    detachInterrupt(pinB_);
+    pollState_ = readPins();
+    pollLastPins_ = 0;
+    invalidTransitions_ = 0;
+    ++storms_;
+    polled_ = true;
+}
+
+HOT_CODE void Encoder::poll() {
+    if (!polled_) return;
+
+    const uint8_t state = readPins();
+    const uint8_t previous = pollState_;
+    if (state == previous) return;
+    pollState_ = state;
+
+    const uint8_t changed = state ^ previous;
+    if (changed == 0b11) {
+        ++invalidTransitions_;
+        return;
+    }
+    // Quadrature edges alternate pins: the same pin again is a single-pin bounce (or a
+    // reversal), still decoded since its steps cancel out, but the pins are not quiet
+    if (changed == pollLastPins_) ++invalidTransitions_;
+    pollLastPins_ = changed;
+    processEncoderChange(QUADRATURE_STEPS[(previous << 2) | state]);
+}
+
+bool Encoder::updateFallback(uint32_t nowMs) {
+    if (!polled_) return false;
+
+    if (pollingSinceMs_ == 0) {
+        pollingSinceMs_ = nowMs | 1u;
+        LOGF("[Encoder] WARNING: Edge storm on encoder %u, polling its pins at %lu Hz\n",
+             static_cast<unsigned>(id_),
+             static_cast<unsigned long>(System::Input::ENCODER_POLL_RATE_HZ));
+        return true;
+    }
+    if (nowMs - pollingSinceMs_ < System::Input::ENCODER_STORM_HOLD_MS) return true;
+
+    // Still bouncing: hold again
+    if (invalidTransitions_ != 0) {
+        invalidTransitions_ = 0;
+        pollingSinceMs_ = nowMs | 1u;
+        return true;
+    }
+
+    polled_ = false;
+    pollingSinceMs_ = 0;
+    stormEdges_ = 0;
+    stormWindowUs_ = micros();
+    encoder_.begin(pinA_, pinB_, EncoderTool::CountMode::full);  // Re-attaches the interrupts
+    LOGF("[Encoder] Encoder %u back on pin interrupts\n", static_cast<unsigned>(id_));
+    return false;
+}
+
+HOT_CODE void Encoder::processEncoderChange(int32_t delta) {
     if (delta == 0) return;
 
-    if (mode_ == Hardware::EncoderMode::Relative) {
-        handleRelativeMode(delta);
-    } else {
-        handleAbsoluteMode(delta);
+    const uint32_t nowUs = micros();  // Interrupt context: this is the hardware edge
+
+    int32_t ticks = delta;
+    if (mode_ == Hardware::EncoderMode::Absolute) {
+        const int8_t direction = (delta > 0) ? -1 : 1;
+        ticks = direction * accelerationMultiplier(direction, nowUs);
     }
+
+    // Keep the oldest edge of a coalesced burst: latency is measured from the first tick
+    uint32_t none = 0;
+    pendingEdgeUs_.compare_exchange_strong(none, nowUs | 1u, std::memory_order_relaxed);
+    pendingTicks_.fetch_add(ticks, std::memory_order_release);
 }
 
-void Encoder::handleRelativeMode(int32_t delta) {
-    accumulatedDelta_ += delta;
+HOT_CODE int32_t Encoder::accelerationMultiplier(int8_t direction, uint32_t nowUs) {
+    uint32_t interval = nowUs - lastTickUs_;
+    lastTickUs_ = nowUs;
+
+    const uint32_t slow = acceleration_.slowIntervalUs;
+    const uint32_t fast = acceleration_.fastIntervalUs;
+
+    // Reversing always starts slow, so fine adjustments after a sweep stay precise
+    if (direction != lastDirection_) {
+        lastDirection_ = direction;
+        smoothedIntervalUs_ = slow;
+        return 1;
+    }
+
+    if (!acceleration_.isEnabled()) return 1;
 
-    bool shouldEmit = abs(accumulatedDelta_) >= stepsPerDetent_;
-    if (!shouldEmit) return;
+    // Light smoothing: one short interval from contact bounce doesn't spike the rate
+    if (interval > slow) interval = slow;
+    smoothedIntervalUs_ = (smoothedIntervalUs_ * 3 + interval) / 4;
 
-    float step = (accumulatedDelta_ > 0) ? 1.0f : -1.0f;
-    relativePosition_ += step;
-    accumulatedDelta_ = 0;
+    if (smoothedIntervalUs_ >= slow) return 1;
+    if (smoothedIntervalUs_ <= fast) return acceleration_.maxMultiplier;
 
-    emitPendingEvent(relativePosition_);
+    uint32_t span = slow - fast;
+    uint32_t extra = (acceleration_.maxMultiplier - 1) * (slow - smoothedIntervalUs_) / span;
+    return 1 + static_cast<int32_t>(extra);
 }
 
-void Encoder::handleAbsoluteMode(int32_t delta) {
-    int32_t movement = (delta > 0) ? -1 : 1;
-    virtualPosition_ = constrain(virtualPosition_ + movement, 0, virtualRange_ - 1);
+HOT_CODE int32_t Encoder::handleRelativeMode(int32_t ticks, float& value) {
+    accumulatedDelta_ += ticks;
 
-    float normalizedValue = virtualPosition_ / static_cast<float>(virtualRange_ - 1);
+    const int32_t detents = accumulatedDelta_ / stepsPerDetent_;
+    if (detents == 0) return 0;
 
-    if (normalizedValue == lastNormalizedValue_) return;
-    lastNormalizedValue_ = normalizedValue;
+    relativePosition_ += static_cast<float>(detents);
+    accumulatedDelta_ -= detents * stepsPerDetent_;
 
-    float valueToEmit = normalizedValue;
-    if (applyQuantization(normalizedValue, valueToEmit)) {
-        emitPendingEvent(valueToEmit);
+    value = relativePosition_;
+    return detents;
+}
+
+HOT_CODE bool Encoder::handleAbsoluteMode(int32_t ticks, UNorm16& value) {
+    virtualPosition_ = constrain(virtualPosition_ + ticks, 0, virtualRange_ - 1);
+
+    const UNorm16 position = UNorm16::fromRatio(virtualPosition_, virtualRange_ - 1);
+    if (position == lastValue_) return false;
+    const UNorm16 previous = lastValue_;
+    lastValue_ = position;
+
+    UNorm16 output = position;
+    if (!tracking_ && !takeOver(previous, position, output)) return false;
+
+    return applyQuantization(output, value);
+}
+
+/**
+ * @brief Pickup / Scale step while the encoder and the target disagree
+ * @param value Value to emit
+ * @return false to stay silent
+ */
+HOT_CODE bool Encoder::takeOver(UNorm16 previous, UNorm16 position, UNorm16& value) {
+    const int32_t from = previous.raw;
+    const int32_t to = position.raw;
+    const int32_t target = targetValue_.raw;
+
+    if (takeover_ == Hardware::EncoderTakeover::Pickup) {
+        const bool crossed = (from <= target && to >= target) || (from >= target && to <= target);
+        if (!crossed) return false;
+        tracking_ = true;
+        value = position;
+        return true;
     }
+
+    // Scale: move the target by the same fraction of its way to the end stop
+    const int32_t end = (to > from) ? UNorm16::MAX_RAW : 0;
+    const int32_t encoderLeft = end - from;
+    const int32_t targetLeft = end - target;
+    int32_t scaled = to;
+    if (encoderLeft != 0) {
+        scaled = target + static_cast<int32_t>(static_cast<int64_t>(to - from) * targetLeft /
+                                               encoderLeft);
+    }
+    targetValue_.raw = static_cast<uint16_t>(constrain(scaled, 0, UNorm16::MAX_RAW));
+
+    // Converged within one virtual step: hand over to the encoder
+    const int32_t step = UNorm16::MAX_RAW / (virtualRange_ - 1);
+    if (abs(targetValue_.raw - to) <= step) {
+        tracking_ = true;
+        lastValue_ = targetValue_;
+        virtualPosition_ = positionOf(targetValue_, virtualRange_);
+    }
+    value = targetValue_;
+    return true;
 }
 
-bool Encoder::applyQuantization(float normalizedValue, float& outValue) {
+HOT_CODE bool Encoder::applyQuantization(UNorm16 value, UNorm16& outValue) {
     if (discreteSteps_ == 0) {
-        outValue = normalizedValue;
+        outValue = value;
         return true;
     }
 
-    float quantized = round(normalizedValue * (discreteSteps_ - 1)) / (discreteSteps_ - 1);
-
-    if (quantized == lastQuantizedValue_) {
+    // Integer step index: each step is emitted once, whatever the rounding
+    const int16_t step = static_cast<int16_t>(value.stepIndex(discreteSteps_));
+    if (step == lastStep_) {
         return false;
     }
 
-    lastQuantizedValue_ = quantized;
-    outValue = quantized;
+    lastStep_ = step;
+    outValue = UNorm16::fromStep(static_cast<uint16_t>(step), discreteSteps_);
     return true;
 }
 
-void Encoder::emitPendingEvent(float value) {
-    pendingValue_ = value;
-    hasPendingEvent_ = true;
-}
-
 int32_t Encoder::calculateDefaultVirtualRange() const {
     return (ppr_ * TICK_COUNT_METHOD) * (FULL_RANGE_ANGLE / 360.0f);
 }
@@ -3,11 +3,35 @@
 #include <Arduino.h>
 #include <EncoderTool.h>
 
+#include <atomic>
 #include <memory>
 
 #include "core/event/IEventBus.hpp"
 #include "core/struct/Encoder.hpp"
-
+#include "core/util/UNorm16.hpp"
+
+class EncoderFrameEvent;
+
+/**
+ * @brief One quadrature encoder: pin interrupt -> normalized EncoderChangedEvent
+ *
+ * The pin interrupt only does integer work: it scales each tick by the
+ * acceleration multiplier and adds it to an atomic tick accumulator
+ * (LDREX / STREX, no interrupt masking), keeping the time of the first edge.
+ * flushEvents() swaps the accumulator out from the main loop and converts
+ * it there (exact UNorm16 fraction of the virtual range, integer
+ * quantization), so a burst between two loops is one event.
+ *
+ * Edge storms: past System::Input::ENCODER_STORM_EDGES edges in
+ * ENCODER_STORM_WINDOW_US, the pin interrupt detaches itself and the
+ * encoder switches to polled decoding: EncoderController's timer calls
+ * poll() at ENCODER_POLL_RATE_HZ, which decodes the pins with a state
+ * table and drops invalid transitions (both pins changed). The CPU time
+ * spent on a bad encoder is then bounded by the poll rate. updateFallback()
+ * re-arms the interrupts once ENCODER_STORM_HOLD_MS pass without invalid
+ * transitions or bounces (the same pin changing twice in a row: still
+ * decoded, as the two steps cancel out).
+ */
 class Encoder {
 public:
     explicit Encoder(const Hardware::Encoder& setup, IEventBus& eventBus);
@@ -18,47 +42,136 @@ public:
     Encoder(Encoder&&) = delete;
     Encoder& operator=(Encoder&&) = delete;
 
-    void flushEvents();
+    /** @brief Emit the pending ticks, adding the event to frame as well if given */
+    void flushEvents(EncoderFrameEvent* frame = nullptr);
+
+    /** @brief Move to normalizedValue now, dropping pending ticks (any policy) */
     void resetPosition(float normalizedValue);
 
+    /**
+     * @brief Follow an external value under the takeover policy (see EncoderTakeover)
+     *
+     * A value within one MIDI step of the encoder's own (a host echo) leaves it tracking.
+     */
+    void syncTo(float normalizedValue);
+    void setTakeover(Hardware::EncoderTakeover takeover);
+
+    /**
+     * @brief Feed ticks as if the pins had moved (benchmarks, tests)
+     *
+     * Same path as the pin interrupt; safe from any context.
+     */
+    void injectTicks(int32_t delta) {
+        processEncoderChange(delta);
+    }
+
     void setDiscreteSteps(uint8_t steps);
     void setContinuous();
+    void setAcceleration(const Hardware::EncoderAcceleration& acceleration);
 
     EncoderID getId() const {
         return id_;
     }
 
+    /** @brief Polled decoding step, from EncoderController's timer (no-op unless polled) */
+    void poll();
+
+    /**
+     * @brief Main loop side of the storm fallback: log the switch, re-arm when quiet
+     * @return The encoder is still polled
+     */
+    bool updateFallback(uint32_t nowMs);
+
+    bool isPolled() const {
+        return polled_;
+    }
+
+    /** @brief Edge storms since boot (switches to polled decoding) */
+    uint32_t getStormCount() const {
+        return storms_;
+    }
+
+    /** @brief Ticks from the interrupt not flushed yet */
+    bool hasPendingTicks() const {
+        return pendingTicks_.load(std::memory_order_relaxed) != 0;
+    }
+
     Hardware::EncoderMode getMode() const {
         return mode_;
     }
 
+    /** @brief Absolute mode: last value emitted (the knob's own position under Pickup / Scale) */
+    UNorm16 getValue() const {
+        return lastValue_;
+    }
+
+    /** @brief 0 = continuous */
+    uint8_t getDiscreteSteps() const {
+        return discreteSteps_;
+    }
+
 private:
     EncoderID id_;
     EncoderTool::Encoder encoder_;
+    uint8_t pinA_;
+    uint8_t pinB_;
     Hardware::EncoderMode mode_;
     uint16_t ppr_;
     uint8_t stepsPerDetent_;
 
+    /* Main loop state */
     int32_t virtualRange_;
     int32_t virtualPosition_;
-    float lastNormalizedValue_;
+    UNorm16 lastValue_;
 
     int32_t accumulatedDelta_;
     float relativePosition_;
 
     IEventBus& eventBus_;
 
-    volatile bool hasPendingEvent_;
-    float pendingValue_;
-
     uint8_t discreteSteps_;
-    float lastQuantizedValue_;
+    int16_t lastStep_;  // Last emitted step with discreteSteps_, -1 = none
+
+    Hardware::EncoderTakeover takeover_;
+    UNorm16 targetValue_;  // Value the encoder takes over from (Pickup / Scale)
+    bool tracking_;        // Encoder and value agree: ticks move the value directly
+
+    /* Interrupt -> loop handoff */
+    static_assert(std::atomic<int32_t>::is_always_lock_free, "Tick handoff must be lock-free");
+    std::atomic<int32_t> pendingTicks_;   // Accelerated ticks since the last flush
+    std::atomic<uint32_t> pendingEdgeUs_; // First edge of those ticks, 0 = none
+
+    /* Interrupt state (acceleration) */
+    Hardware::EncoderAcceleration acceleration_;
+    uint32_t lastTickUs_;
+    uint32_t smoothedIntervalUs_;
+    int8_t lastDirection_;
+
+    /* Storm fallback: pin interrupt / timer state, then main loop state */
+    uint32_t stormWindowUs_;
+    uint16_t stormEdges_;
+    uint8_t pollState_;  // (A << 1) | B at the last poll
+    uint8_t pollLastPins_;  // Pin bit that changed last (0 = none since polling began)
+    volatile bool polled_;
+    volatile uint16_t invalidTransitions_;
+    volatile uint32_t storms_;
+    uint32_t pollingSinceMs_;  // 0 = switch not seen by the main loop yet
+
+    void onPinEdge(int32_t delta);
+    void enterPolling();
+    uint8_t readPins() const {
+        return static_cast<uint8_t>((digitalReadFast(pinA_) << 1) | digitalReadFast(pinB_));
+    }
 
     void processEncoderChange(int32_t delta);
-    void handleRelativeMode(int32_t delta);
-    void handleAbsoluteMode(int32_t delta);
+    int32_t accelerationMultiplier(int8_t direction, uint32_t nowUs);
+    void discardPending();
+
+    /** @return Whole detents turned (0: nothing to emit) */
+    int32_t handleRelativeMode(int32_t ticks, float& value);
+    bool handleAbsoluteMode(int32_t ticks, UNorm16& value);
+    bool takeOver(UNorm16 previous, UNorm16 position, UNorm16& value);
 
     int32_t calculateDefaultVirtualRange() const;
-    bool applyQuantization(float normalizedValue, float& outValue);
-    void emitPendingEvent(float value);
+    bool applyQuantization(UNorm16 value, UNorm16& outValue);
 };
@@ -1,18 +1,109 @@
 #include "EncoderController.hpp"
 
+#include <string.h>
+
+#include "core/event/IEventBus.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
+
+EncoderController* EncoderController::instance_ = nullptr;
+
 EncoderController::EncoderController(
     const etl::vector<Hardware::Encoder, System::Hardware::ENCODERS_COUNT>& encoderSetups,
-    IEventBus& eventBus) {
+    IEventBus& eventBus)
+    : eventBus_(eventBus) {
+    memset(slots_, INVALID_INPUT_INDEX, sizeof(slots_));
     for (auto& setup : encoderSetups) {
-        size_t index = encoders_.size();
+        const uint8_t index = encoderIndex(setup.id);
+        if (index == INVALID_INPUT_INDEX) {
+            LOGLN("[EncoderController] ERROR: EncoderID missing from ENCODER_IDS");
+            continue;
+        }
+        slots_[index] = static_cast<uint8_t>(encoders_.size());
         encoders_.emplace_back(setup, eventBus);  // Construct in-place on stack
-        idToIndex_[setup.id] = index;             // Map InputId -> array index
+    }
+}
+
+EncoderController::~EncoderController() {
+    if (polling_) {
+        pollTimer_.end();
+    }
+    if (instance_ == this) {
+        instance_ = nullptr;
     }
 }
 
 void EncoderController::flushAllEvents() {
+    if (System::Input::ENCODER_STORM_EDGES != 0) {
+        updateFallback();
+    }
+
+    if (!frameEvents_) {
+        for (auto& encoder : encoders_) {
+            encoder.flushEvents();
+        }
+        return;
+    }
+
+    frame_.clear();
+    for (auto& encoder : encoders_) {
+        encoder.flushEvents(&frame_);
+    }
+    if (frame_.changedMask != 0) {
+        eventBus_.emit(frame_);
+    }
+}
+
+void EncoderController::updateFallback() {
+    const uint32_t nowMs = millis();
+    bool anyPolled = false;
     for (auto& encoder : encoders_) {
-        encoder.flushEvents();
+        anyPolled = encoder.updateFallback(nowMs) || anyPolled;
+    }
+
+    if (!anyPolled) {
+        if (polling_) {
+            pollTimer_.end();
+            polling_ = false;
+            instance_ = nullptr;
+        }
+        pollFromLoop_ = false;
+        return;
+    }
+
+    if (!polling_ && !pollFromLoop_) {
+        if (instance_ == nullptr) {
+            instance_ = this;
+            polling_ =
+                pollTimer_.begin(pollIsr, 1000000.0f / System::Input::ENCODER_POLL_RATE_HZ);
+        }
+        if (polling_) {
+            pollTimer_.priority(System::Input::ENCODER_POLL_IRQ_PRIORITY);
+        } else {
+            if (instance_ == this) instance_ = nullptr;
+            pollFromLoop_ = true;
+            LOGLN("[EncoderController] No IntervalTimer available - polling encoders from loop");
+        }
+    }
+
+    if (pollFromLoop_) {
+        for (auto& encoder : encoders_) {
+            encoder.poll();
+        }
+    }
+}
+
+HOT_CODE void EncoderController::pollIsr() {
+    if (!instance_) return;
+    for (auto& encoder : instance_->encoders_) {
+        encoder.poll();
+    }
+}
+
+void EncoderController::injectTicks(EncoderID encoderId, int32_t delta) {
+    Encoder* encoder = getEncoder(encoderId);
+    if (encoder) {
+        encoder->injectTicks(delta);
     }
 }
 
@@ -23,6 +114,40 @@ void EncoderController::resetEncoderPosition(EncoderID encoderId, float normaliz
     }
 }
 
+void EncoderController::syncEncoder(EncoderID encoderId, float normalizedValue) {
+    Encoder* encoder = getEncoder(encoderId);
+    if (encoder) {
+        encoder->syncTo(normalizedValue);
+    }
+}
+
+void EncoderController::setTakeover(EncoderID encoderId, Hardware::EncoderTakeover takeover) {
+    Encoder* encoder = getEncoder(encoderId);
+    if (encoder) {
+        encoder->setTakeover(takeover);
+    }
+}
+
+void EncoderController::restore(const Preset::EncoderState* states, uint8_t count) {
+    for (uint8_t i = 0; i < count; ++i) {
+        Encoder* encoder = getEncoder(static_cast<EncoderID>(states[i].encoderId));
+        if (!encoder || encoder->getMode() != Hardware::EncoderMode::Absolute) continue;
+        encoder->setDiscreteSteps(states[i].discreteSteps);
+        encoder->resetPosition(UNorm16{states[i].value}.toFloat());
+    }
+}
+
+uint8_t EncoderController::capture(Preset::EncoderState* out, uint8_t capacity) const {
+    uint8_t count = 0;
+    for (const Encoder& encoder : encoders_) {
+        if (count >= capacity) break;
+        if (encoder.getMode() != Hardware::EncoderMode::Absolute) continue;
+        out[count++] = {static_cast<uint16_t>(encoder.getId()), encoder.getValue().raw,
+                        encoder.getDiscreteSteps()};
+    }
+    return count;
+}
+
 void EncoderController::setDiscreteSteps(EncoderID encoderId, uint16_t steps) {
     Encoder* encoder = getEncoder(encoderId);
     if (encoder) {
@@ -37,12 +162,10 @@ void EncoderController::setContinuous(EncoderID encoderId) {
     }
 }
 
-Encoder* EncoderController::getEncoder(EncoderID id) {
-    auto it = idToIndex_.find(id);
-    return (it != idToIndex_.end()) ? &encoders_[it->second] : nullptr;
-}
-
-const Encoder* EncoderController::getEncoder(EncoderID id) const {
-    auto it = idToIndex_.find(id);
-    return (it != idToIndex_.end()) ? &encoders_[it->second] : nullptr;
+void EncoderController::setAcceleration(EncoderID encoderId,
+                                        const Hardware::EncoderAcceleration& acceleration) {
+    Encoder* encoder = getEncoder(encoderId);
+    if (encoder) {
+        encoder->setAcceleration(acceleration);
+    }
 }
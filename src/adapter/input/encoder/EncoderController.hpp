@@ -1,13 +1,15 @@
 #pragma once
-#include <etl/flat_map.h>
 #include <etl/vector.h>
 
 #include <memory>
 
 #include "Encoder.hpp"
+#include "config/InputID.hpp"
 #include "config/System.hpp"
 #include "core/Type.hpp"
+#include "core/event/Events.hpp"
 #include "core/struct/Encoder.hpp"
+#include "core/struct/Preset.hpp"
 
 class IEventBus;
 
@@ -16,19 +18,92 @@ public:
     explicit EncoderController(
         const etl::vector<Hardware::Encoder, System::Hardware::ENCODERS_COUNT>& encoderSetups,
         IEventBus& eventBus);
+    ~EncoderController();
 
+    EncoderController(const EncoderController&) = delete;
+    EncoderController& operator=(const EncoderController&) = delete;
+
+    /**
+     * @brief Per-encoder events, then one EncoderFrameEvent if frame events are on
+     *
+     * Also runs the edge storm fallback (see Encoder): the poll timer runs
+     * while at least one encoder is polled, or the pins are polled from here
+     * when no IntervalTimer is free.
+     */
     void flushAllEvents();
 
+    /**
+     * @brief Also emit every flush's changes as one EncoderFrameEvent
+     *
+     * Off by default (System::Input::ENCODER_FRAME_EVENTS): the per-encoder
+     * EncoderChangedEvents are emitted either way.
+     */
+    void setFrameEvents(bool enabled) {
+        frameEvents_ = enabled;
+    }
+    bool frameEvents() const {
+        return frameEvents_;
+    }
+
+    /** @brief An encoder has ticks for the next flushAllEvents() (or pins to poll from it) */
+    bool hasPendingTicks() const {
+        if (pollFromLoop_) return true;
+        for (const Encoder& encoder : encoders_) {
+            if (encoder.hasPendingTicks()) return true;
+        }
+        return false;
+    }
+
     void resetEncoderPosition(EncoderID encoderId, float normalizedValue);
 
+    /** @brief Discrete steps and positions of a preset, all at once, no events */
+    void restore(const Preset::EncoderState* states, uint8_t count);
+
+    /** @return States written to out (absolute encoders only) */
+    uint8_t capture(Preset::EncoderState* out, uint8_t capacity) const;
+
+    /** @brief Encoder::syncTo() by id: follow an external value under the takeover policy */
+    void syncEncoder(EncoderID encoderId, float normalizedValue);
+    void setTakeover(EncoderID encoderId, Hardware::EncoderTakeover takeover);
+
+    /** @brief Encoder::injectTicks() by id, ignored for unknown ids */
+    void injectTicks(EncoderID encoderId, int32_t delta);
+
     void setDiscreteSteps(EncoderID encoderId, uint16_t steps);
     void setContinuous(EncoderID encoderId);
+    void setAcceleration(EncoderID encoderId, const Hardware::EncoderAcceleration& acceleration);
 
-    Encoder* getEncoder(EncoderID id);
-    const Encoder* getEncoder(EncoderID id) const;
+    /** @return nullptr for ids without an encoder (two array loads, no search) */
+    Encoder* getEncoder(EncoderID id) {
+        const uint8_t slot = slotOf(id);
+        return slot < encoders_.size() ? &encoders_[slot] : nullptr;
+    }
+    const Encoder* getEncoder(EncoderID id) const {
+        const uint8_t slot = slotOf(id);
+        return slot < encoders_.size() ? &encoders_[slot] : nullptr;
+    }
 
 private:
+    static void pollIsr();
+    void updateFallback();
+
+    /** encoderIndex() is compile-time; slots_ maps it to this controller's order */
+    uint8_t slotOf(EncoderID id) const {
+        const uint8_t index = encoderIndex(id);
+        return index < ENCODER_ID_COUNT ? slots_[index] : INVALID_INPUT_INDEX;
+    }
+
     etl::vector<Encoder, System::Hardware::ENCODERS_COUNT> encoders_;
 
-    etl::flat_map<EncoderID, size_t, System::Hardware::ENCODERS_COUNT> idToIndex_;
-};
\ No newline at end of file
+    uint8_t slots_[ENCODER_ID_COUNT];  // encoderIndex(id) -> encoders_ index
+
+    IEventBus& eventBus_;
+    bool frameEvents_ = System::Input::ENCODER_FRAME_EVENTS;
+    EncoderFrameEvent frame_;  // Entries outside changedMask keep stale values
+
+    IntervalTimer pollTimer_;
+    bool polling_ = false;      // pollTimer_ running
+    bool pollFromLoop_ = false;  // No timer: flushAllEvents() polls
+
+    static EncoderController* instance_;
+};
@@ -0,0 +1,118 @@
+#include "SerialMidiOut.hpp"
+
+#include "log/Macros.hpp"
+
+#include <new>
+
+namespace {
+constexpr uint8_t NOTE_OFF = 0x80;
+constexpr uint8_t NOTE_ON = 0x90;
+constexpr uint8_t POLY_PRESSURE = 0xA0;
+constexpr uint8_t CONTROL_CHANGE = 0xB0;
+constexpr uint8_t PROGRAM_CHANGE = 0xC0;
+constexpr uint8_t CHANNEL_PRESSURE = 0xD0;
+constexpr uint8_t PITCH_BEND = 0xE0;
+constexpr uint8_t SYSEX_START = 0xF0;
+constexpr uint8_t SYSEX_END = 0xF7;
+}  // namespace
+
+SerialMidiOut::SerialMidiOut(HardwareSerial& serial) : serial_(serial) {}
+
+SerialMidiOut::~SerialMidiOut() {
+    // The UART driver keeps a pointer to txBuffer_
+    if (txBuffer_) {
+        serial_.end();
+    }
+}
+
+bool SerialMidiOut::begin() {
+    if (txBuffer_) return true;
+
+    txBuffer_.reset(new (std::nothrow) uint8_t[System::Midi::DIN_TX_BUFFER_SIZE]);
+    serial_.begin(System::Midi::DIN_BAUD_RATE);
+    if (!txBuffer_) {
+        LOGLN("[SerialMidiOut] ERROR: No memory for the transmit buffer, using the driver's");
+        return false;
+    }
+    serial_.addMemoryForWrite(txBuffer_.get(), System::Midi::DIN_TX_BUFFER_SIZE);
+    return true;
+}
+
+void SerialMidiOut::sendControlChange(MidiChannelValue ch, MidiCCValue cc, uint8_t value) {
+    sendChannelMessage(CONTROL_CHANGE | (ch & 0x0F), cc, value, 2);
+}
+
+void SerialMidiOut::sendNoteOn(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) {
+    sendChannelMessage(NOTE_ON | (ch & 0x0F), note, velocity, 2);
+}
+
+void SerialMidiOut::sendNoteOff(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) {
+    sendChannelMessage(NOTE_OFF | (ch & 0x0F), note, velocity, 2);
+}
+
+void SerialMidiOut::sendProgramChange(MidiChannelValue ch, uint8_t program) {
+    sendChannelMessage(PROGRAM_CHANGE | (ch & 0x0F), program, 0, 1);
+}
+
+void SerialMidiOut::sendPitchBend(MidiChannelValue ch, uint16_t value) {
+    sendChannelMessage(PITCH_BEND | (ch & 0x0F), value & 0x7F, (value >> 7) & 0x7F, 2);
+}
+
+void SerialMidiOut::sendChannelPressure(MidiChannelValue ch, uint8_t pressure) {
+    sendChannelMessage(CHANNEL_PRESSURE | (ch & 0x0F), pressure, 0, 1);
+}
+
+void SerialMidiOut::sendPolyPressure(MidiChannelValue ch, MidiNoteValue note, uint8_t pressure) {
+    sendChannelMessage(POLY_PRESSURE | (ch & 0x0F), note, pressure, 2);
+}
+
+void SerialMidiOut::sendSysEx(const uint8_t* data, uint16_t length) {
+    if (!data || length < 2 || data[0] != SYSEX_START || data[length - 1] != SYSEX_END) {
+        LOGLN("[SerialMidiOut] ERROR: SysEx must start with F0 and end with F7");
+        return;
+    }
+    if (serial_.availableForWrite() < length) {
+        dropped_++;
+        return;
+    }
+
+    serial_.write(data, length);
+    runningStatus_ = NO_STATUS;  // SysEx cancels running status
+}
+
+void SerialMidiOut::sendRealtime(uint8_t status) {
+    if (serial_.availableForWrite() < 1) {
+        dropped_++;
+        return;
+    }
+    serial_.write(status);
+}
+
+void SerialMidiOut::sendChannelMessage(uint8_t status, uint8_t data1, uint8_t data2,
+                                       uint8_t dataCount) {
+    const uint32_t nowMs = millis();
+    const bool refresh = System::Midi::DIN_RUNNING_STATUS_REFRESH_MS == 0 ||
+                         nowMs - runningStatusMs_ >= System::Midi::DIN_RUNNING_STATUS_REFRESH_MS;
+    const bool writeStatus = status != runningStatus_ || refresh;
+
+    uint8_t bytes[3];
+    uint8_t count = 0;
+    if (writeStatus) {
+        bytes[count++] = status;
+    }
+    bytes[count++] = data1 & 0x7F;
+    if (dataCount == 2) {
+        bytes[count++] = data2 & 0x7F;
+    }
+
+    if (serial_.availableForWrite() < count) {
+        dropped_++;
+        return;
+    }
+
+    serial_.write(bytes, count);
+    if (writeStatus) {
+        runningStatus_ = status;
+        runningStatusMs_ = nowMs;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+
+#include <memory>
+
+#include "config/System.hpp"
+#include "core/interface/midi/MidiOutput.hpp"
+
+/**
+ * @brief DIN MIDI output on a Teensy hardware serial port
+ *
+ * Messages are written to the UART driver's transmit ring (enlarged with a
+ * RAM2 buffer of each instance, allocated in begin()) and shifted out by
+ * its interrupt, so sending never waits for the 31250 baud line. When the
+ * ring cannot take a whole message, the message is dropped and counted
+ * instead of blocking the main loop.
+ *
+ * Consecutive messages with the same status byte use running status.
+ */
+class SerialMidiOut : public MidiOutput {
+public:
+    explicit SerialMidiOut(HardwareSerial& serial);
+    ~SerialMidiOut();
+
+    SerialMidiOut(const SerialMidiOut&) = delete;
+    SerialMidiOut& operator=(const SerialMidiOut&) = delete;
+
+    /** @brief Open the port at DIN_BAUD_RATE with the transmit buffer @return false on no memory */
+    bool begin();
+
+    void sendControlChange(MidiChannelValue ch, MidiCCValue cc, uint8_t value) override;
+    void sendNoteOn(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) override;
+    void sendNoteOff(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) override;
+
+    void sendProgramChange(MidiChannelValue ch, uint8_t program) override;
+    void sendPitchBend(MidiChannelValue ch, uint16_t value) override;
+    void sendChannelPressure(MidiChannelValue ch, uint8_t pressure) override;
+    void sendPolyPressure(MidiChannelValue ch, MidiNoteValue note, uint8_t pressure) override;
+
+    /** @brief Complete message (F0 ... F7); dropped if the ring can't hold all of it */
+    void sendSysEx(const uint8_t* data, uint16_t length) override;
+
+    /** @brief Realtime byte (clock, start, stop...); doesn't affect running status */
+    void sendRealtime(uint8_t status) override;
+
+    /** @brief Messages dropped because the transmit ring was full */
+    uint32_t getDroppedCount() const {
+        return dropped_;
+    }
+
+private:
+    static constexpr uint8_t NO_STATUS = 0;
+
+    void sendChannelMessage(uint8_t status, uint8_t data1, uint8_t data2, uint8_t dataCount);
+
+    HardwareSerial& serial_;
+    std::unique_ptr<uint8_t[]> txBuffer_;  // Heap, in RAM2 like DMAMEM
+    uint8_t runningStatus_ = NO_STATUS;
+    uint32_t runningStatusMs_ = 0;  // When the status byte was last written
+    uint32_t dropped_ = 0;
+};
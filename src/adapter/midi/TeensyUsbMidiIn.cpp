@@ -2,8 +2,19 @@
 
 #include <Arduino.h>
 
+#include <string.h>
+
+#include "config/System.hpp"
 #include "core/event/Events.hpp"
 #include "core/event/IEventBus.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+DMAMEM uint8_t sysExArena[System::Midi::SYSEX_REASSEMBLY_SIZE];
+
+constexpr MidiRouter::PortId PORT = MidiPort::USB;
+}
 
 TeensyUsbMidiIn* TeensyUsbMidiIn::instance_ = nullptr;
 
@@ -14,6 +25,12 @@ TeensyUsbMidiIn::TeensyUsbMidiIn(IEventBus& eventBus) : eventBus_(eventBus) {
     usbMIDI.setHandleControlChange(handleControlChangeStatic);
     usbMIDI.setHandleNoteOn(handleNoteOnStatic);
     usbMIDI.setHandleNoteOff(handleNoteOffStatic);
+    usbMIDI.setHandleProgramChange(handleProgramChangeStatic);
+    usbMIDI.setHandlePitchChange(handlePitchBendStatic);
+    usbMIDI.setHandleAfterTouchChannel(handleChannelPressureStatic);
+    usbMIDI.setHandleAfterTouchPoly(handlePolyPressureStatic);
+    usbMIDI.setHandleSongPosition(handleSongPositionStatic);
+    usbMIDI.setHandleRealTimeSystem(handleRealtimeStatic);
 }
 
 TeensyUsbMidiIn::~TeensyUsbMidiIn() {
@@ -22,8 +39,49 @@ TeensyUsbMidiIn::~TeensyUsbMidiIn() {
     }
 }
 
-void TeensyUsbMidiIn::processPendingMessages() {
-    while (usbMIDI.read()) {
+HOT_CODE void TeensyUsbMidiIn::processPendingMessages() {
+    const uint32_t startUs = micros();
+    draining_ = COALESCE_SLOTS > 0;
+    backlog_ = true;  // Cleared when the USB queue runs dry inside the budget
+
+    for (uint16_t read = 0; read < maxMessages_; ++read) {
+        if (!usbMIDI.read()) {
+            backlog_ = false;
+            break;
+        }
+        if (micros() - startUs >= budgetUs_) break;
+    }
+
+    flushCoalescedCCs();
+    draining_ = false;
+}
+
+HOT_CODE void TeensyUsbMidiIn::flushCoalescedCCs() {
+    const uint8_t count = pendingCount_;
+    pendingCount_ = 0;  // Handlers may run nested emits; take the batch first
+    for (uint8_t i = 0; i < count; ++i) {
+        const PendingCC& pending = pendingCCs_[i];
+        eventBus_.emit(MidiCCEvent(pending.channel, pending.controller, pending.value, 0,
+                                   MidiOrigin::Host));
+    }
+}
+
+MidiRealtimeListenerId TeensyUsbMidiIn::addRealtimeListener(MidiRealtimeCallback callback) {
+    for (size_t i = 0; i < realtimeListeners_.size(); ++i) {
+        if (!realtimeListeners_[i]) {
+            realtimeListeners_[i] = std::move(callback);
+            return static_cast<MidiRealtimeListenerId>(i);
+        }
+    }
+
+    LOGF("[TeensyUsbMidiIn] ERROR: Cannot add realtime listener (max %d)\n",
+         static_cast<int>(System::Memory::MAX_REALTIME_LISTENERS));
+    return INVALID_REALTIME_LISTENER;
+}
+
+void TeensyUsbMidiIn::removeRealtimeListener(MidiRealtimeListenerId id) {
+    if (id < realtimeListeners_.size()) {
+        realtimeListeners_[id] = nullptr;
     }
 }
 
@@ -33,47 +91,192 @@ void TeensyUsbMidiIn::handleSysExStatic(const uint8_t* data, uint16_t length, bo
     }
 }
 
-void TeensyUsbMidiIn::handleControlChangeStatic(uint8_t channel, uint8_t control, uint8_t value) {
+HOT_CODE void TeensyUsbMidiIn::handleControlChangeStatic(uint8_t channel, uint8_t control,
+                                                         uint8_t value) {
     if (instance_) {
         instance_->handleControlChange(channel, control, value);
     }
 }
 
-void TeensyUsbMidiIn::handleNoteOnStatic(uint8_t channel, uint8_t note, uint8_t velocity) {
+HOT_CODE void TeensyUsbMidiIn::handleNoteOnStatic(uint8_t channel, uint8_t note, uint8_t velocity) {
     if (instance_) {
         instance_->handleNoteOn(channel, note, velocity);
     }
 }
 
-void TeensyUsbMidiIn::handleNoteOffStatic(uint8_t channel, uint8_t note, uint8_t velocity) {
+HOT_CODE void TeensyUsbMidiIn::handleNoteOffStatic(uint8_t channel, uint8_t note,
+                                                   uint8_t velocity) {
     if (instance_) {
         instance_->handleNoteOff(channel, note, velocity);
     }
 }
 
+/*
+ * Messages without extra state are emitted straight from the static handlers
+ */
+void TeensyUsbMidiIn::handleProgramChangeStatic(uint8_t channel, uint8_t program) {
+    if (instance_) {
+        instance_->flushCoalescedCCs();
+        if (instance_->router_) {
+            instance_->router_->routeChannel(PORT, MidiRouter::PROGRAM_CHANGE, channel - 1,
+                                             program, 0);
+        }
+        instance_->eventBus_.emit(MidiProgramChangeEvent(channel - 1, program));
+    }
+}
+
+void TeensyUsbMidiIn::handlePitchBendStatic(uint8_t channel, int value) {
+    if (instance_) {
+        instance_->flushCoalescedCCs();
+        if (instance_->router_) {
+            instance_->router_->routeChannel(PORT, MidiRouter::PITCH_BEND, channel - 1, 0,
+                                             static_cast<uint16_t>(value + 8192));
+        }
+        instance_->eventBus_.emit(MidiPitchBendEvent(channel - 1, static_cast<int16_t>(value)));
+    }
+}
+
+void TeensyUsbMidiIn::handleChannelPressureStatic(uint8_t channel, uint8_t pressure) {
+    if (instance_) {
+        instance_->flushCoalescedCCs();
+        if (instance_->router_) {
+            instance_->router_->routeChannel(PORT, MidiRouter::CHANNEL_PRESSURE, channel - 1,
+                                             pressure, 0);
+        }
+        instance_->eventBus_.emit(MidiChannelPressureEvent(channel - 1, pressure));
+    }
+}
+
+void TeensyUsbMidiIn::handlePolyPressureStatic(uint8_t channel, uint8_t note, uint8_t pressure) {
+    if (instance_) {
+        instance_->flushCoalescedCCs();
+        if (instance_->router_) {
+            instance_->router_->routeChannel(PORT, MidiRouter::POLY_PRESSURE, channel - 1, note,
+                                             pressure);
+        }
+        instance_->eventBus_.emit(MidiPolyPressureEvent(channel - 1, note, pressure));
+    }
+}
+
+void TeensyUsbMidiIn::handleSongPositionStatic(uint16_t beats) {
+    if (instance_) {
+        instance_->flushCoalescedCCs();
+        instance_->eventBus_.emit(MidiSongPositionEvent(beats));
+    }
+}
+
+HOT_CODE void TeensyUsbMidiIn::handleRealtimeStatic(uint8_t status) {
+    if (instance_) {
+        instance_->handleRealtime(status);
+    }
+}
+
+HOT_CODE void TeensyUsbMidiIn::handleRealtime(uint8_t status) {
+    const uint32_t nowUs = micros();
+
+    if (router_) {
+        router_->routeRealtime(PORT, status);
+    }
+
+    for (auto& listener : realtimeListeners_) {
+        if (listener) {
+            listener(status, nowUs);
+        }
+    }
+
+    if (status == MidiRealtime::START || status == MidiRealtime::CONTINUE ||
+        status == MidiRealtime::STOP || status == MidiRealtime::SYSTEM_RESET) {
+        flushCoalescedCCs();
+        eventBus_.emit(MidiTransportEvent(status, nowUs));
+    }
+}
+
 void TeensyUsbMidiIn::handleSysEx(const uint8_t* data, uint16_t length, bool complete) {
+    const uint32_t offset = sysExOffset_;
+    flushCoalescedCCs();
+    eventBus_.emit(SysExChunkEvent(data, length, offset, complete));
+
+    if (complete && offset == 0) {
+        if (router_) {
+            router_->routeSysEx(PORT, data, length);
+        }
+        eventBus_.emit(SysExEvent(data, length));  // Single fragment: no copy
+        return;
+    }
+
+    if (!sysExOverflow_) {
+        if (offset + length <= System::Midi::SYSEX_REASSEMBLY_SIZE) {
+            memcpy(sysExArena + offset, data, length);
+        } else {
+            sysExOverflow_ = true;
+            LOGF("[TeensyUsbMidiIn] SysEx larger than %d bytes, chunks only\n",
+                 static_cast<int>(System::Midi::SYSEX_REASSEMBLY_SIZE));
+        }
+    }
+    sysExOffset_ = offset + length;
+
     if (complete) {
-        eventBus_.emit(SysExEvent(data, length));
+        if (!sysExOverflow_) {
+            if (router_) {
+                router_->routeSysEx(PORT, sysExArena, static_cast<uint16_t>(sysExOffset_));
+            }
+            eventBus_.emit(SysExEvent(sysExArena, static_cast<uint16_t>(sysExOffset_)));
+        }
+        sysExOffset_ = 0;
+        sysExOverflow_ = false;
     }
 }
 
-void TeensyUsbMidiIn::handleControlChange(uint8_t channel, uint8_t control, uint8_t value) {
+HOT_CODE void TeensyUsbMidiIn::handleControlChange(uint8_t channel, uint8_t control,
+                                                   uint8_t value) {
     MidiChannelValue ch = static_cast<MidiChannelValue>(channel - 1);
     MidiCCValue cc = static_cast<MidiCCValue>(control);
 
-    eventBus_.emit(MidiCCEvent(ch, cc, value));
+    if (router_) {
+        router_->routeChannel(PORT, MidiRouter::CONTROL_CHANGE, ch, cc, value);
+    }
+    if (echoFilter_ && echoFilter_->isEcho(ch, cc, millis())) {
+        ++echoCount_;
+        return;
+    }
+
+    if (draining_ && !isSequenceCC(cc)) {
+        for (uint8_t i = pendingCount_; i-- > 0;) {  // Newest first: bursts repeat one CC
+            PendingCC& pending = pendingCCs_[i];
+            if (pending.channel == ch && pending.controller == cc) {
+                pending.value = value;
+                ++coalescedCount_;
+                return;
+            }
+        }
+        if (pendingCount_ == COALESCE_SLOTS) {
+            flushCoalescedCCs();
+        }
+        pendingCCs_[pendingCount_++] = {ch, cc, value};
+        return;
+    }
+    flushCoalescedCCs();
+    eventBus_.emit(MidiCCEvent(ch, cc, value, 0, MidiOrigin::Host));
 }
 
-void TeensyUsbMidiIn::handleNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
+HOT_CODE void TeensyUsbMidiIn::handleNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
     MidiChannelValue ch = static_cast<MidiChannelValue>(channel - 1);
     MidiNoteValue n = static_cast<MidiNoteValue>(note);
 
+    if (router_) {
+        router_->routeChannel(PORT, MidiRouter::NOTE_ON, ch, n, velocity);
+    }
+    flushCoalescedCCs();
     eventBus_.emit(MidiNoteOnEvent(ch, n, velocity));
 }
 
-void TeensyUsbMidiIn::handleNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
+HOT_CODE void TeensyUsbMidiIn::handleNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
     MidiChannelValue ch = static_cast<MidiChannelValue>(channel - 1);
     MidiNoteValue n = static_cast<MidiNoteValue>(note);
 
+    if (router_) {
+        router_->routeChannel(PORT, MidiRouter::NOTE_OFF, ch, n, velocity);
+    }
+    flushCoalescedCCs();
     eventBus_.emit(MidiNoteOffEvent(ch, n, velocity));
 }
\ No newline at end of file
@@ -1,9 +1,46 @@
 #pragma once
 
+#include <Arduino.h>
+#include <etl/array.h>
+
+#include "config/System.hpp"
 #include "core/interface/midi/MidiInput.hpp"
+#include "core/midi/EchoFilter.hpp"
+#include "core/midi/MidiRouter.hpp"
 
 class IEventBus;
 
+/**
+ * @brief USB MIDI input
+ *
+ * Every channel message is emitted as its typed event (Events.hpp). Realtime
+ * bytes take a fast lane: they are timestamped and handed straight to the
+ * registered MidiRealtimeCallback listeners, without an EventBus lookup;
+ * only transport changes (Start / Continue / Stop / Reset) are also emitted.
+ *
+ * SysEx fragments from the framework are emitted as SysExChunkEvent as they
+ * arrive, and reassembled into a static arena for SysExEvent. A message that
+ * fits in one framework buffer is emitted straight from it, without a copy.
+ *
+ * With a MidiRouter attached, every message is offered to it (as input port
+ * MidiPort::USB) before it is emitted, so thru traffic skips the bus.
+ *
+ * Received CCs carry MidiOrigin::Host. With an EchoFilter attached, CCs that
+ * echo what the output just sent are routed but not emitted.
+ *
+ * Each drain is bounded by a message count and a time budget. Inside one
+ * drain, CCs 64-127 are held per channel/controller and only the latest
+ * value is emitted. Held CCs are flushed before any other message (notes,
+ * SysEx, transport...) and at the end of the drain, so ordering is kept.
+ * CCs 0-63 (14-bit MSB / LSB pairs, data entry) and the RPN / NRPN
+ * selectors 96-101 are sequences, never coalesced: each one is emitted, in
+ * order. Routing is not coalesced: thru traffic sees every message.
+ *
+ * With a multi-cable USB type every cable is read and handled the same;
+ * cable() tells them apart from inside an event callback. The framework has
+ * one SysEx receive buffer, so the host must not interleave SysEx messages
+ * across cables.
+ */
 class TeensyUsbMidiIn : public MidiInput {
 public:
     explicit TeensyUsbMidiIn(IEventBus& eventBus);
@@ -11,17 +48,97 @@ public:
 
     void processPendingMessages() override;
 
+    /**
+     * @brief Register a realtime fast-lane listener
+     * @return Listener id, INVALID_REALTIME_LISTENER if MAX_REALTIME_LISTENERS reached
+     */
+    MidiRealtimeListenerId addRealtimeListener(MidiRealtimeCallback callback);
+    void removeRealtimeListener(MidiRealtimeListenerId id);
+
+    /** @brief Forward incoming messages through router (nullptr = no thru) */
+    void setRouter(MidiRouter* router) {
+        router_ = router;
+    }
+
+    MidiRouter* router() const {
+        return router_;
+    }
+
+    /** @brief USB cable of the message being handled (System::Midi::USB_CABLE_*) */
+    uint8_t cable() const {
+        return usbMIDI.getCable();
+    }
+
+    /** @brief Per-loop drain limits (defaults: INPUT_MESSAGES_PER_LOOP, INPUT_BUDGET_US) */
+    void setInputBudget(uint16_t maxMessages, uint32_t maxUs) {
+        maxMessages_ = maxMessages;
+        budgetUs_ = maxUs;
+    }
+
+    /** @brief Last drain stopped on its budget, more messages are likely waiting */
+    bool hasBacklog() const {
+        return backlog_;
+    }
+
+    /** @brief CCs merged into a later value for the same controller since boot */
+    uint32_t getCoalescedCount() const {
+        return coalescedCount_;
+    }
+
+    void setEchoFilter(const EchoFilter* filter) {
+        echoFilter_ = filter;
+    }
+
+    /** @brief CCs dropped as host echo since boot */
+    uint32_t getEchoCount() const {
+        return echoCount_;
+    }
+
 private:
     static void handleSysExStatic(const uint8_t* data, uint16_t length, bool complete);
     static void handleControlChangeStatic(uint8_t channel, uint8_t control, uint8_t value);
     static void handleNoteOnStatic(uint8_t channel, uint8_t note, uint8_t velocity);
     static void handleNoteOffStatic(uint8_t channel, uint8_t note, uint8_t velocity);
+    static void handleProgramChangeStatic(uint8_t channel, uint8_t program);
+    static void handlePitchBendStatic(uint8_t channel, int value);
+    static void handleChannelPressureStatic(uint8_t channel, uint8_t pressure);
+    static void handlePolyPressureStatic(uint8_t channel, uint8_t note, uint8_t pressure);
+    static void handleSongPositionStatic(uint16_t beats);
+    static void handleRealtimeStatic(uint8_t status);
 
     void handleSysEx(const uint8_t* data, uint16_t length, bool complete);
     void handleControlChange(uint8_t channel, uint8_t control, uint8_t value);
     void handleNoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
     void handleNoteOff(uint8_t channel, uint8_t note, uint8_t velocity);
+    void handleRealtime(uint8_t status);
+    void flushCoalescedCCs();
+
+    /** @brief CCs whose every value matters (14-bit pairs, RPN / NRPN) */
+    static bool isSequenceCC(uint8_t controller) {
+        return controller < 64 || (controller >= 96 && controller <= 101);
+    }
+
+    struct PendingCC {
+        uint8_t channel;
+        uint8_t controller;
+        uint8_t value;
+    };
+
+    static constexpr size_t COALESCE_SLOTS = System::Midi::INPUT_CC_COALESCE_SLOTS;
 
     IEventBus& eventBus_;
+    MidiRouter* router_ = nullptr;
+    const EchoFilter* echoFilter_ = nullptr;
+    uint32_t echoCount_ = 0;
+    uint16_t maxMessages_ = System::Midi::INPUT_MESSAGES_PER_LOOP;
+    uint32_t budgetUs_ = System::Midi::INPUT_BUDGET_US;
+    etl::array<PendingCC, (COALESCE_SLOTS > 0 ? COALESCE_SLOTS : 1)> pendingCCs_ = {};
+    uint8_t pendingCount_ = 0;
+    bool draining_ = false;  // Inside processPendingMessages: CCs are held
+    bool backlog_ = false;
+    uint32_t coalescedCount_ = 0;
+    etl::array<MidiRealtimeCallback, System::Memory::MAX_REALTIME_LISTENERS> realtimeListeners_;
+    uint32_t sysExOffset_ = 0;    // Bytes received so far for the current message
+    bool sysExOverflow_ = false;  // Current message exceeds SYSEX_REASSEMBLY_SIZE
     static TeensyUsbMidiIn* instance_;
 };
\ No newline at end of file
@@ -2,68 +2,544 @@
 
 #include <Arduino.h>
 
+#include <string.h>
+
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+DMAMEM uint8_t sysExTxArena[System::Midi::SYSEX_TX_ARENA_SIZE];
+
+constexpr uint8_t SYSEX_START = 0xF0;
+constexpr uint8_t SYSEX_END = 0xF7;
+
+/* Cables the USB type provides (usb_desc.h), 1 without multi-cable MIDI */
+#ifdef MIDI_NUM_CABLES
+constexpr uint8_t USB_CABLES = MIDI_NUM_CABLES;
+#else
+constexpr uint8_t USB_CABLES = 1;
+#endif
+
+constexpr uint8_t usbCable(uint8_t cable) {
+    return cable < USB_CABLES ? cable : 0;
+}
+
+constexpr uint8_t CONTROL_CABLE = usbCable(System::Midi::USB_CABLE_CONTROL);
+constexpr uint8_t PERFORMANCE_CABLE = usbCable(System::Midi::USB_CABLE_PERFORMANCE);
+constexpr uint8_t BULK_CABLE = usbCable(System::Midi::USB_CABLE_BULK);
+
+/* USB-MIDI code index numbers (low nibble; the cable is the high one) */
+constexpr uint8_t CIN_SYSEX_CONTINUE = 0x04;  // 3 bytes, message continues
+constexpr uint8_t CIN_SYSEX_END_1 = 0x05;     // 1..3 bytes, message ends: CIN_SYSEX_END_1 + n - 1
+
+constexpr uint8_t NOTE_OFF = 0x80;
+constexpr uint8_t NOTE_ON = 0x90;
+constexpr uint8_t CONTROL_CHANGE = 0xB0;
+constexpr uint8_t PROGRAM_CHANGE = 0xC0;
+constexpr uint8_t CHANNEL_PRESSURE = 0xD0;
+
+/* Auto traffic class of a channel message, by status */
+uint8_t cableForStatus(uint8_t status) {
+    const uint8_t type = status & 0xF0;
+    return type == CONTROL_CHANGE || type == PROGRAM_CHANGE ? CONTROL_CABLE : PERFORMANCE_CABLE;
+}
+
+uint32_t packet(uint8_t cable, uint8_t status, uint8_t data1, uint8_t data2) {
+    return (status >> 4) | (static_cast<uint32_t>(cable) << 4) |
+           (static_cast<uint32_t>(status) << 8) | (static_cast<uint32_t>(data1 & 0x7F) << 16) |
+           (static_cast<uint32_t>(data2 & 0x7F) << 24);
+}
+}  // namespace
+
+TeensyUsbMidiOut* TeensyUsbMidiOut::scheduleInstance_ = nullptr;
+
 TeensyUsbMidiOut::TeensyUsbMidiOut(IEventBus& eventBus) : eventBus_(eventBus) {
-    for (size_t i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        activeNotes_[i].active = false;
+    memset(lastCC_, CC_UNKNOWN, sizeof(lastCC_));
+
+    // The timer is started by schedule(), only one output can own it
+    if (scheduleInstance_ == nullptr) {
+        scheduleInstance_ = this;
+    }
+}
+
+TeensyUsbMidiOut::~TeensyUsbMidiOut() {
+    if (schedulerRunning_) {
+        scheduleTimer_.end();
+    }
+    if (scheduleInstance_ == this) {
+        scheduleInstance_ = nullptr;
     }
 }
 
-void TeensyUsbMidiOut::sendControlChange(MidiChannelValue ch, MidiCCValue cc, uint8_t value) {
-    usbMIDI.sendControlChange(cc, value, ch + 1);
+HOT_CODE void TeensyUsbMidiOut::sendControlChange(MidiChannelValue ch, MidiCCValue cc,
+                                                  uint8_t value) {
+    sendControlChange(ch, cc, value, MidiTraffic::Auto);
 }
 
-void TeensyUsbMidiOut::sendNoteOn(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) {
-    markNoteActive(ch, note);
-    usbMIDI.sendNoteOn(note, velocity, ch + 1);
+HOT_CODE void TeensyUsbMidiOut::sendControlChange(MidiChannelValue ch, MidiCCValue cc,
+                                                  uint8_t value, MidiTraffic traffic) {
+    if (echoFilter_) {
+        echoFilter_->sent(ch, cc, millis());
+    }
+    lastCC_[ch & 0x0F][cc & 0x7F] = value;
+    enqueue(MessageKind::ControlChange, ch, cc, value,
+            cableFor(traffic, MidiTraffic::Control));
 }
 
-void TeensyUsbMidiOut::sendNoteOff(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) {
-    markNoteInactive(ch, note);
-    usbMIDI.sendNoteOff(note, velocity, ch + 1);
+HOT_CODE size_t TeensyUsbMidiOut::sendControlChanges(const MidiCCMessage* messages, size_t count,
+                                                     bool skipUnchanged) {
+    if (!messages || count == 0) return 0;
+
+    WriteGuard guard(*this);
+    writeBacklog(CONTROL_CABLE);
+
+    const uint32_t nowMs = millis();
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t channel = messages[i].channel & 0x0F;
+        const uint8_t cc = messages[i].cc & 0x7F;
+        const uint8_t value = messages[i].value & 0x7F;
+        if (skipUnchanged && lastCC_[channel][cc] == value) continue;
+
+        lastCC_[channel][cc] = value;
+        if (echoFilter_) {
+            echoFilter_->sent(channel, cc, nowMs);
+        }
+        usb_midi_write_packed(packet(CONTROL_CABLE, CONTROL_CHANGE | channel, cc, value));
+        ++written;
+    }
+
+    if (written > 0) {
+        usbMIDI.send_now();
+    }
+    return written;
+}
+
+HOT_CODE size_t TeensyUsbMidiOut::sendPackets(const uint32_t* packets, size_t count) {
+    if (!packets || count == 0) return 0;
+
+    // A half-sent SysEx only has to end first if one of the packets shares its cable
+    const uint8_t open = openSysExCable();
+    uint8_t cable = (packets[0] >> 4) & 0x0F;
+    for (size_t i = 1; i < count && cable != open; ++i) {
+        if (((packets[i] >> 4) & 0x0F) == open) cable = open;
+    }
+
+    WriteGuard guard(*this);
+    writeBacklog(cable);
+
+    const uint32_t nowMs = millis();
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t usbPacket = packets[i];
+        const uint8_t cin = usbPacket & 0x0F;
+        if (cin >= 0x4 && cin <= 0x7) continue;  // SysEx start / continue / end
+
+        const uint8_t status = static_cast<uint8_t>(usbPacket >> 8);
+        const uint8_t data1 = static_cast<uint8_t>(usbPacket >> 16) & 0x7F;
+        const uint8_t data2 = static_cast<uint8_t>(usbPacket >> 24) & 0x7F;
+        const uint8_t channel = status & 0x0F;
+
+        switch (status & 0xF0) {
+            case NOTE_ON:
+                if (data2 == 0) {
+                    activeNotes_.clear(channel, data1);
+                } else {
+                    activeNotes_.mark(channel, data1);
+                }
+                break;
+            case NOTE_OFF:
+                activeNotes_.clear(channel, data1);
+                break;
+            case CONTROL_CHANGE:
+                lastCC_[channel][data1] = data2;
+                if (echoFilter_) {
+                    echoFilter_->sent(channel, data1, nowMs);
+                }
+                break;
+            default:
+                break;
+        }
+        usb_midi_write_packed(usbPacket);
+        ++written;
+    }
+    usbMIDI.send_now();
+    if (written != count) {
+        LOGF("[TeensyUsbMidiOut] ERROR: %u SysEx packets dropped, use sendSysEx()\n",
+             static_cast<unsigned>(count - written));
+    }
+    return written;
+}
+
+HOT_CODE void TeensyUsbMidiOut::sendNoteOn(MidiChannelValue ch, MidiNoteValue note,
+                                           uint8_t velocity) {
+    sendNoteOn(ch, note, velocity, MidiTraffic::Auto);
+}
+
+HOT_CODE void TeensyUsbMidiOut::sendNoteOn(MidiChannelValue ch, MidiNoteValue note,
+                                           uint8_t velocity, MidiTraffic traffic) {
+    if (velocity == 0) {
+        activeNotes_.clear(ch, note);  // Note On with velocity 0 is a Note Off
+    } else {
+        activeNotes_.mark(ch, note);
+    }
+    enqueue(MessageKind::NoteOn, ch, note, velocity, cableFor(traffic, MidiTraffic::Performance));
+}
+
+HOT_CODE void TeensyUsbMidiOut::sendNoteOff(MidiChannelValue ch, MidiNoteValue note,
+                                            uint8_t velocity) {
+    sendNoteOff(ch, note, velocity, MidiTraffic::Auto);
+}
+
+HOT_CODE void TeensyUsbMidiOut::sendNoteOff(MidiChannelValue ch, MidiNoteValue note,
+                                            uint8_t velocity, MidiTraffic traffic) {
+    activeNotes_.clear(ch, note);
+    enqueue(MessageKind::NoteOff, ch, note, velocity,
+            cableFor(traffic, MidiTraffic::Performance));
 }
 
 void TeensyUsbMidiOut::sendProgramChange(MidiChannelValue ch, uint8_t program) {
-    usbMIDI.sendProgramChange(program, ch + 1);
+    enqueue(MessageKind::ProgramChange, ch, program, 0, CONTROL_CABLE);
 }
 
 void TeensyUsbMidiOut::sendPitchBend(MidiChannelValue ch, uint16_t value) {
-    usbMIDI.sendPitchBend(value, ch + 1);
+    enqueue(MessageKind::PitchBend, ch, 0, value, PERFORMANCE_CABLE);
 }
 
 void TeensyUsbMidiOut::sendChannelPressure(MidiChannelValue ch, uint8_t pressure) {
-    usbMIDI.sendAfterTouch(pressure, ch + 1);
+    enqueue(MessageKind::ChannelPressure, ch, pressure, 0, PERFORMANCE_CABLE);
+}
+
+void TeensyUsbMidiOut::sendPolyPressure(MidiChannelValue ch, MidiNoteValue note,
+                                        uint8_t pressure) {
+    enqueue(MessageKind::PolyPressure, ch, note, pressure, PERFORMANCE_CABLE);
+}
+
+void TeensyUsbMidiOut::sendRealtime(uint8_t status) {
+    // Realtime packets may sit between any two packets, even inside a SysEx
+    WriteGuard guard(*this);
+    usbMIDI.sendRealTime(status, PERFORMANCE_CABLE);
+    usbMIDI.send_now();
 }
 
 void TeensyUsbMidiOut::sendSysEx(const uint8_t* data, uint16_t length) {
-    usbMIDI.sendSysEx(length, data, true);
+    sendSysEx(data, length, MidiTraffic::Auto);
 }
 
-void TeensyUsbMidiOut::flush() {
-    while (usbMIDI.read()) {
+void TeensyUsbMidiOut::sendSysEx(const uint8_t* data, uint16_t length, MidiTraffic traffic) {
+    const uint8_t cable = cableFor(traffic, MidiTraffic::Control);
+
+    WriteGuard guard(*this);
+    // Keep ordering with async messages on the same cable and channel messages of this loop
+    for (const SysExJob& job : sysExJobs_) {
+        if (job.cable == cable) {
+            finishSysEx();
+            break;
+        }
+    }
+    writeQueued();
+    usbMIDI.sendSysEx(length, data, true, cable);
+    usbMIDI.send_now();
+}
+
+void TeensyUsbMidiOut::panic() {
+    WriteGuard guard(*this);
+    finishSysEx();
+    writeQueued();
+
+    // Scheduled messages never sent are dropped; the notes the timer did send are sounding
+    noInterrupts();
+    schedule_.clear();
+    const NoteTracker timedNotes = scheduledNotes_;
+    scheduledNotes_.reset();
+    interrupts();
+
+    activeNotes_.forEachActive([](uint8_t channel, uint8_t note) {
+        usbMIDI.sendNoteOff(note, 0, channel + 1, PERFORMANCE_CABLE);
+    });
+    timedNotes.forEachActive([this](uint8_t channel, uint8_t note) {
+        if (activeNotes_.isActive(channel, note)) return;  // Already sent above
+        usbMIDI.sendNoteOff(note, 0, channel + 1, PERFORMANCE_CABLE);
+    });
+    activeNotes_.reset();
+    usbMIDI.send_now();
+}
+
+HOT_CODE void TeensyUsbMidiOut::sendQueued() {
+    if (!schedulerRunning_) {
+        sendDue();
+    }
+    if (queue_.empty() && sysExJobs_.empty()) return;
+
+    WriteGuard guard(*this);
+    writeQueued();
+
+    size_t budget = System::Midi::SYSEX_TX_PACKETS_PER_LOOP;
+    while (!sysExJobs_.empty() && budget > 0) {
+        if (!streamSysEx(budget)) break;
+        completeSysExJob();
+        writeQueued();  // Message boundary: channel messages may go out
+    }
+
+    usbMIDI.send_now();
+}
+
+bool TeensyUsbMidiOut::sendSysExAsync(const uint8_t* data, uint16_t length,
+                                      SysExSentCallback onSent, MidiTraffic traffic) {
+    if (!data || length < 2 || data[0] != SYSEX_START || data[length - 1] != SYSEX_END) {
+        LOGLN("[TeensyUsbMidiOut] ERROR: SysEx must start with F0 and end with F7");
+        return false;
+    }
+    if (length > System::Midi::SYSEX_TX_ARENA_SIZE) {
+        // Would never fit, even with the arena empty: retrying can't help
+        LOGF("[TeensyUsbMidiOut] ERROR: Async SysEx of %u bytes (max %u), use sendSysEx()\n",
+             static_cast<unsigned>(length),
+             static_cast<unsigned>(System::Midi::SYSEX_TX_ARENA_SIZE));
+        return false;
     }
+    if (sysExJobs_.full() ||
+        sysExArenaUsed_ + length > System::Midi::SYSEX_TX_ARENA_SIZE) {
+        return false;  // Back-pressure: caller retries once pending messages drain
+    }
+
+    memcpy(sysExTxArena + sysExArenaUsed_, data, length);
+    sysExJobs_.push_back({sysExArenaUsed_, length, 0, cableFor(traffic, MidiTraffic::Bulk),
+                          std::move(onSent)});
+    sysExArenaUsed_ += length;
+    return true;
 }
 
-void TeensyUsbMidiOut::markNoteActive(MidiChannelValue ch, MidiNoteValue note) {
-    for (size_t i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (!activeNotes_[i].active) {
-            activeNotes_[i].channel = ch;
-            activeNotes_[i].note = note;
-            activeNotes_[i].active = true;
-            return;
+bool TeensyUsbMidiOut::streamSysEx(size_t& packetBudget) {
+    SysExJob& job = sysExJobs_.front();
+    const uint8_t* data = sysExTxArena + job.offset;
+
+    while (packetBudget > 0 && job.sent < job.length) {
+        const uint16_t remaining = job.length - job.sent;
+        const uint8_t count = remaining > 3 ? 3 : static_cast<uint8_t>(remaining);
+        const uint8_t cin = remaining > 3 ? CIN_SYSEX_CONTINUE : CIN_SYSEX_END_1 + count - 1;
+
+        uint32_t packet = cin | (static_cast<uint32_t>(job.cable) << 4);
+        for (uint8_t i = 0; i < count; ++i) {
+            packet |= static_cast<uint32_t>(data[job.sent + i]) << (8 * (i + 1));
         }
+        usb_midi_write_packed(packet);
+
+        job.sent += count;
+        --packetBudget;
+    }
+    sysExOpenCable_ = job.sent < job.length ? job.cable : NO_CABLE;
+    return job.sent == job.length;
+}
+
+void TeensyUsbMidiOut::completeSysExJob() {
+    SysExSentCallback onSent = std::move(sysExJobs_.front().onSent);
+    sysExJobs_.erase(sysExJobs_.begin());
+    if (sysExJobs_.empty()) {
+        sysExArenaUsed_ = 0;
+    }
+    if (onSent) {
+        onSent();  // May queue the next message
+    }
+}
+
+void TeensyUsbMidiOut::finishSysEx() {
+    while (!sysExJobs_.empty()) {
+        size_t unlimited = System::Midi::SYSEX_TX_ARENA_SIZE;
+        streamSysEx(unlimited);
+        completeSysExJob();
+    }
+}
+
+bool TeensyUsbMidiOut::schedule(uint32_t deadlineUs, uint8_t status, uint8_t data1,
+                                uint8_t data2) {
+    if (status < NOTE_OFF || status >= SYSEX_START) {
+        LOGLN("[TeensyUsbMidiOut] ERROR: Only channel messages can be scheduled");
+        return false;
+    }
+
+    const uint8_t type = status & 0xF0;
+    if (type == PROGRAM_CHANGE || type == CHANNEL_PRESSURE) {
+        data2 = 0;
+    }
+
+    noInterrupts();
+    const bool queued = schedule_.push({deadlineUs, status, data1, data2});
+    const bool idle = !schedulerRunning_;
+    interrupts();
+    if (!queued) {
+        return false;
     }
 
-    activeNotes_[0].channel = ch;
-    activeNotes_[0].note = note;
-    activeNotes_[0].active = true;
+    if (idle) {
+        startScheduler();
+    }
+    return true;
 }
 
-void TeensyUsbMidiOut::markNoteInactive(MidiChannelValue ch, MidiNoteValue note) {
-    for (size_t i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (activeNotes_[i].active && activeNotes_[i].channel == ch &&
-            activeNotes_[i].note == note) {
-            activeNotes_[i].active = false;
-            return;
+void TeensyUsbMidiOut::startScheduler() {
+    if (scheduleInstance_ != this || schedulerUnavailable_) return;  // Sent per loop
+
+    // The ISR only stops the timer once the schedule is empty: nothing to race with here
+    if (!scheduleTimer_.begin(scheduleIsr, System::Midi::SCHEDULER_TICK_US)) {
+        schedulerUnavailable_ = true;
+        LOGLN("[TeensyUsbMidiOut] No IntervalTimer available - scheduled MIDI sent per loop");
+        return;
+    }
+    scheduleTimer_.priority(System::Midi::SCHEDULER_IRQ_PRIORITY);
+    schedulerRunning_ = true;
+}
+
+HOT_CODE void TeensyUsbMidiOut::scheduleIsr() {
+    if (scheduleInstance_) {
+        scheduleInstance_->sendDue();
+    }
+}
+
+/* Timer ISR, or sendQueued() without a timer */
+HOT_CODE void TeensyUsbMidiOut::sendDue() {
+    if (writing_) return;  // Retried next tick
+
+    const uint32_t nowUs = micros();
+    bool sent = false;
+    while (schedule_.isDue(nowUs)) {
+        const MidiSchedule::Message message = schedule_.top();
+        const uint8_t cable = cableForStatus(message.status);
+        if (cable == sysExOpenCable_) break;  // Not inside a SysEx: retried next tick
+        schedule_.pop();
+
+        usb_midi_write_packed(packet(cable, message.status, message.data1, message.data2));
+        sent = true;
+
+        // Sounding from now on, not from schedule(): panic() owes Note Offs for these only
+        const uint8_t type = message.status & 0xF0;
+        const uint8_t channel = message.status & 0x0F;
+        if (type == NOTE_ON && message.data2 != 0) {
+            scheduledNotes_.mark(channel, message.data1);
+        } else if (type == NOTE_OFF || type == NOTE_ON) {
+            scheduledNotes_.clear(channel, message.data1);
         }
     }
+    if (sent) {
+        usbMIDI.send_now();
+    }
+
+    // No 10 kHz interrupt while nothing is scheduled: schedule() starts it again
+    if (schedulerRunning_ && schedule_.empty()) {
+        scheduleTimer_.end();
+        schedulerRunning_ = false;
+    }
+}
+
+uint8_t TeensyUsbMidiOut::cableFor(MidiTraffic traffic, MidiTraffic autoTraffic) {
+    switch (traffic == MidiTraffic::Auto ? autoTraffic : traffic) {
+        case MidiTraffic::Performance: return PERFORMANCE_CABLE;
+        case MidiTraffic::Bulk: return BULK_CABLE;
+        default: return CONTROL_CABLE;
+    }
+}
+
+HOT_CODE void TeensyUsbMidiOut::enqueue(MessageKind kind, MidiChannelValue ch, uint8_t data1,
+                                        uint16_t data2, uint8_t cable) {
+    if (queue_.full()) {
+        // Burst larger than one loop's worth: hand it to usbMIDI now, after any
+        // SysEx already started on a cable it uses (channel messages can't go inside one)
+        WriteGuard guard(*this);
+        writeBacklog(cable);
+    }
+
+    QueuedMessage message{kind, ch, data1, data2, cable};
+#ifdef MIDI_LATENCY_TRACING
+    message.edgeTimestampUs = edgeTimestampUs_;
+    edgeTimestampUs_ = 0;
+#endif
+    queue_.push_back(message);
+}
+
+HOT_CODE void TeensyUsbMidiOut::writeBacklog(uint8_t cable) {
+    // Channel messages can't go inside a SysEx that is already on the wire on their cable
+    const uint8_t open = openSysExCable();
+    bool blocking = open != NO_CABLE && cable == open;
+    for (size_t i = 0; i < queue_.size() && open != NO_CABLE && !blocking; ++i) {
+        blocking = queue_[i].cable == open;
+    }
+    if (blocking) {
+        size_t unlimited = System::Midi::SYSEX_TX_ARENA_SIZE;
+        streamSysEx(unlimited);
+        completeSysExJob();
+    }
+    writeQueued();
+}
+
+HOT_CODE void TeensyUsbMidiOut::writeQueued() {
+    const uint8_t blocked = openSysExCable();
+
+    // Performance cable first; on one shared cable this is the whole queue, in order
+    if (PERFORMANCE_CABLE != blocked) {
+        for (const auto& message : queue_) {
+            if (message.cable == PERFORMANCE_CABLE) writeMessage(message);
+        }
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < queue_.size(); ++i) {
+        const QueuedMessage& message = queue_[i];
+        if (message.cable == blocked) {
+            queue_[kept++] = message;  // After the SysEx on its cable ends
+        } else if (message.cable != PERFORMANCE_CABLE) {
+            writeMessage(message);
+        }
+    }
+    while (queue_.size() > kept) {
+        queue_.pop_back();
+    }
+}
+
+HOT_CODE void TeensyUsbMidiOut::writeMessage(const QueuedMessage& message) {
+    const uint8_t channel = message.channel + 1;
+    const uint8_t cable = message.cable;
+    switch (message.kind) {
+        case MessageKind::ControlChange:
+            usbMIDI.sendControlChange(message.data1, message.data2, channel, cable);
+            break;
+        case MessageKind::NoteOn:
+            usbMIDI.sendNoteOn(message.data1, message.data2, channel, cable);
+            break;
+        case MessageKind::NoteOff:
+            usbMIDI.sendNoteOff(message.data1, message.data2, channel, cable);
+            break;
+        case MessageKind::ProgramChange:
+            usbMIDI.sendProgramChange(message.data1, channel, cable);
+            break;
+        case MessageKind::PitchBend:
+            usbMIDI.sendPitchBend(static_cast<int>(message.data2) - 8192, channel, cable);
+            break;
+        case MessageKind::ChannelPressure:
+            usbMIDI.sendAfterTouch(message.data1, channel, cable);
+            break;
+        case MessageKind::PolyPressure:
+            usbMIDI.sendPolyPressure(message.data1, message.data2, channel, cable);
+            break;
+    }
+#ifdef MIDI_LATENCY_TRACING
+    recordLatency(message.edgeTimestampUs);
+#endif
+}
+
+HOT_CODE void TeensyUsbMidiOut::flush() {
+    while (usbMIDI.read()) {
+    }
+}
+
+#ifdef MIDI_LATENCY_TRACING
+void TeensyUsbMidiOut::recordLatency(uint32_t edgeTimestampUs) {
+    // One sample per tagged input: 14-bit / NRPN bursts count once
+    if (edgeTimestampUs == 0) {
+        return;
+    }
+    const uint32_t latencyUs = micros() - edgeTimestampUs;
+    latency_.record(latencyUs);
+    if (latencySink_) {
+        latencySink_(latencyUs);
+    }
 }
+#endif
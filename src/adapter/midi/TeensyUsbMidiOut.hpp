@@ -1,14 +1,54 @@
 #pragma once
 #include <Arduino.h>
+#include <etl/vector.h>
+
+#include <utility>
 
 #include "config/System.hpp"
 #include "core/interface/midi/MidiOutput.hpp"
+#include "core/midi/EchoFilter.hpp"
+#include "core/midi/MidiSchedule.hpp"
+#include "core/midi/NoteTracker.hpp"
+#include "core/util/InplaceFunction.hpp"
+
+#ifdef MIDI_LATENCY_TRACING
+#include "core/util/LatencyHistogram.hpp"
+#endif
 
 class IEventBus;
 
+/**
+ * @brief USB MIDI output, batched per main loop
+ *
+ * Channel messages are queued and written by sendQueued() at the end of the
+ * loop, followed by a single usbMIDI.send_now(), so messages produced in the
+ * same loop share USB packets instead of trickling out on the flush timer.
+ * SysEx is sent immediately, after anything already queued.
+ *
+ * sendSysExAsync() streams large messages instead: a bounded number of
+ * USB-MIDI packets per loop, so a dump never blocks input and rendering.
+ * Channel messages are only written between two SysEx messages, never
+ * inside one.
+ *
+ * schedule() queues a channel message for a micros() deadline. An
+ * IntervalTimer (SCHEDULER_TICK_US) sends due messages straight to USB, so
+ * their timing doesn't depend on the main loop; it holds off while the main
+ * loop is itself writing to usbMIDI or a SysEx is half sent on its cable.
+ * The timer runs only while messages are scheduled: schedule() starts it,
+ * the ISR stops it once the schedule is empty.
+ *
+ * Every message goes out on the cable of its MidiTraffic class. The "inside
+ * one SysEx" rule above is per cable: with a multi-cable USB type, CCs and
+ * notes are written while a dump streams on the bulk cable. Queued
+ * performance messages (notes, pitch bend, pressure) are written before the
+ * other channel messages of the loop; each cable keeps its own order.
+ */
 class TeensyUsbMidiOut : public MidiOutput {
 public:
+    using SysExSentCallback = InplaceFunction<void(), System::Memory::EVENT_CALLBACK_SIZE>;
+
     explicit TeensyUsbMidiOut(IEventBus& eventBus);
+    ~TeensyUsbMidiOut();
 
     void sendControlChange(MidiChannelValue ch, MidiCCValue cc, uint8_t value) override;
     void sendNoteOn(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity) override;
@@ -18,22 +58,222 @@ public:
     void sendPitchBend(MidiChannelValue ch, uint16_t value) override;
     void sendChannelPressure(MidiChannelValue ch, uint8_t pressure) override;
     void sendSysEx(const uint8_t* data, uint16_t length) override;
+    void sendPolyPressure(MidiChannelValue ch, MidiNoteValue note, uint8_t pressure) override;
+    void sendRealtime(uint8_t status) override;
+
+    /** @brief Same as the MidiOutput sends, on an explicit port */
+    void sendControlChange(MidiChannelValue ch, MidiCCValue cc, uint8_t value,
+                           MidiTraffic traffic);
+    void sendNoteOn(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity,
+                    MidiTraffic traffic);
+    void sendNoteOff(MidiChannelValue ch, MidiNoteValue note, uint8_t velocity,
+                     MidiTraffic traffic);
+    void sendSysEx(const uint8_t* data, uint16_t length, MidiTraffic traffic);
+
+    /**
+     * @brief Write a block of CCs now, in one USB submission
+     * @param skipUnchanged Drop CCs whose value equals the last one sent on
+     *        that channel/controller (any send path counts)
+     * @return Number of CCs written
+     *
+     * Queued messages of this loop go first, so ordering is kept. For page
+     * syncs and snapshot recall, where eight or a hundred CCs are known at once.
+     */
+    size_t sendControlChanges(const MidiCCMessage* messages, size_t count,
+                              bool skipUnchanged = false);
+
+    /**
+     * @brief Write prebuilt USB-MIDI event packets now, in one USB submission
+     * @param packets CIN | cable << 4 | status << 8 | data1 << 16 | data2 << 24,
+     *        cable from System::Midi::USB_CABLE_* (0 on single-cable builds)
+     *
+     * @return Number of packets written
+     *
+     * Channel messages only: SysEx packets (CIN 0x4-0x7) are dropped, they
+     * would interleave with sendSysEx() streams. Note On / Off update the
+     * sounding-note state used by panic(), CCs the last-value table of
+     * sendControlChanges().
+     */
+    size_t sendPackets(const uint32_t* packets, size_t count);
+
+    /**
+     * @brief Note Off for each sounding note, sent immediately in one USB burst
+     *
+     * Goes out after anything already queued (and after async SysEx), on the
+     * performance port, then the note state is cleared. Scheduled messages
+     * not sent yet are dropped: a scheduled Note On counts once the timer has
+     * sent it.
+     */
+    void panic() override;
+
+    /**
+     * @brief Send a channel message at deadlineUs (micros())
+     * @param status Status byte with channel (0x80-0xEF)
+     * @param data2 Ignored for program change and channel pressure
+     * @return false if the schedule is full or status is not a channel message
+     *
+     * A deadline already passed is sent on the next timer tick. Scheduled
+     * notes count as sounding (or released) for panic() once they are sent.
+     */
+    bool schedule(uint32_t deadlineUs, uint8_t status, uint8_t data1, uint8_t data2 = 0);
+
+    size_t scheduledCount() const {
+        return schedule_.size();
+    }
+
+    /** @brief sendQueued() has messages to write (scheduled ones too without the timer) */
+    bool hasQueued() const {
+        return !queue_.empty() || !sysExJobs_.empty() || (!schedulerRunning_ && !schedule_.empty());
+    }
+
+    /** @brief Stamp every CC sent, for host echo detection (nullptr = off) */
+    void setEchoFilter(EchoFilter* filter) {
+        echoFilter_ = filter;
+    }
+
+    bool hasActiveNotes() const {
+        return activeNotes_.any() || scheduledNotes_.any();
+    }
 
     void flush();
 
+    /** @brief Write queued messages and push them to the host (end of loop) */
+    void sendQueued();
+
+    /**
+     * @brief Queue a SysEx message (F0 ... F7) for streaming over the next loops
+     * @param data Message, copied: the buffer can be reused on return
+     * @param onSent Called once the last packet has been written
+     * @param traffic Port, Bulk for Auto
+     * @return false if the arena or job queue is full (retry later), or data is
+     *         malformed or longer than SYSEX_TX_ARENA_SIZE (logged, never fits)
+     */
+    bool sendSysExAsync(const uint8_t* data, uint16_t length, SysExSentCallback onSent = nullptr,
+                        MidiTraffic traffic = MidiTraffic::Auto);
+
+    bool isSysExPending() const {
+        return !sysExJobs_.empty();
+    }
+
+#ifdef MIDI_LATENCY_TRACING
+    void setEdgeTimestamp(uint32_t timestampUs) override {
+        edgeTimestampUs_ = timestampUs;
+    }
+
+    /** @brief Print the input edge -> usbMIDI send histogram */
+    void dumpLatency(Print& out) const {
+        latency_.dump(out, "edge->usbMIDI");
+    }
+
+    void resetLatency() {
+        latency_.reset();
+    }
+
+    /** @brief Called with every latency sample as it is recorded (benchmarks) */
+    using LatencySink = InplaceFunction<void(uint32_t latencyUs), sizeof(void*)>;
+    void setLatencySink(LatencySink sink) {
+        latencySink_ = std::move(sink);
+    }
+#endif
+
 private:
-    static constexpr size_t MAX_ACTIVE_NOTES = System::Midi::MAX_ACTIVE_NOTES;
+    enum class MessageKind : uint8_t {
+        ControlChange,
+        NoteOn,
+        NoteOff,
+        ProgramChange,
+        PitchBend,
+        ChannelPressure,
+        PolyPressure
+    };
 
-    struct ActiveNote {
+    struct QueuedMessage {
+        MessageKind kind;
         MidiChannelValue channel;
-        MidiNoteValue note;
-        bool active;
+        uint8_t data1;
+        uint16_t data2;  // 14-bit for pitch bend
+        uint8_t cable;
+#ifdef MIDI_LATENCY_TRACING
+        uint32_t edgeTimestampUs;
+#endif
+    };
+
+    struct SysExJob {
+        uint16_t offset;  // Start in the arena
+        uint16_t length;
+        uint16_t sent;    // Bytes already written
+        uint8_t cable;
+        SysExSentCallback onSent;
     };
 
-    ActiveNote activeNotes_[MAX_ACTIVE_NOTES];
+    NoteTracker activeNotes_;
+    EchoFilter* echoFilter_ = nullptr;
+
+    NoteTracker scheduledNotes_;  // Notes sendDue() sent, written by it only (ISR)
+
+    MidiSchedule schedule_;  // Shared with the timer ISR, pushed with interrupts off
+    IntervalTimer scheduleTimer_;
+    volatile bool schedulerRunning_ = false;  // Timer armed, cleared by the ISR when idle
+    bool schedulerUnavailable_ = false;       // begin() failed: scheduled MIDI sent per loop
+    volatile bool writing_ = false;  // Main loop is writing to usbMIDI
+    static constexpr uint8_t NO_CABLE = 0xFF;
+    volatile uint8_t sysExOpenCable_ = NO_CABLE;  // Cable of a partly written SysEx
+    static TeensyUsbMidiOut* scheduleInstance_;
+
+    /** @brief Marks a main-loop usbMIDI write, so the timer ISR stays out */
+    struct WriteGuard {
+        explicit WriteGuard(TeensyUsbMidiOut& out) : out_(out), outer_(out.writing_) {
+            out_.writing_ = true;
+        }
+        ~WriteGuard() {
+            out_.writing_ = outer_;
+        }
+        TeensyUsbMidiOut& out_;
+        bool outer_;
+    };
+
+    static void scheduleIsr();
+    void startScheduler();
+    void sendDue();
     IEventBus& eventBus_;
+    etl::vector<QueuedMessage, System::Memory::MAX_MIDI_MESSAGES_QUEUE> queue_;
+    etl::vector<SysExJob, System::Memory::MAX_SYSEX_TX_JOBS> sysExJobs_;  // FIFO, front = streaming
+    uint16_t sysExArenaUsed_ = 0;  // Reset once every job has been sent
+
+    /** @brief Cable of traffic, with Auto resolved to autoTraffic */
+    static uint8_t cableFor(MidiTraffic traffic, MidiTraffic autoTraffic);
+
+    void enqueue(MessageKind kind, MidiChannelValue ch, uint8_t data1, uint16_t data2,
+                 uint8_t cable);
+    void writeMessage(const QueuedMessage& message);
+
+    /** @brief Write the queue, except messages on the cable of a half-sent SysEx */
+    void writeQueued();
+
+    /**
+     * @brief Start of a direct write on cable: end a half-sent SysEx on it (or on a
+     *        cable with queued messages), then the queue
+     */
+    void writeBacklog(uint8_t cable);
+
+    uint8_t openSysExCable() const {
+        return !sysExJobs_.empty() && sysExJobs_.front().sent > 0 ? sysExJobs_.front().cable
+                                                                   : NO_CABLE;
+    }
+
+    static constexpr uint8_t CC_UNKNOWN = 0xFF;
+    uint8_t lastCC_[16][128];  // Last value sent per channel/controller, CC_UNKNOWN if none
+
+    /** @return true when the front job is finished */
+    bool streamSysEx(size_t& packetBudget);
+    void completeSysExJob();
+    void finishSysEx();
 
-    void markNoteActive(MidiChannelValue ch, MidiNoteValue note);
+#ifdef MIDI_LATENCY_TRACING
+    void recordLatency(uint32_t edgeTimestampUs);
 
-    void markNoteInactive(MidiChannelValue ch, MidiNoteValue note);
+    uint32_t edgeTimestampUs_ = 0;
+    LatencyHistogram latency_;
+    LatencySink latencySink_;
+#endif
 };
@@ -2,11 +2,44 @@
 
 #include "log/Macros.hpp"
 
+namespace {
+/* Channel n of the reflected Gray sequence: consecutive entries differ by one select bit */
+constexpr uint8_t grayCode(uint8_t n) {
+    return static_cast<uint8_t>(n ^ (n >> 1));
+}
+}  // namespace
+
 Multiplexer::Multiplexer()
     : mux_(System::Hardware::MUX_S0_PIN, System::Hardware::MUX_S1_PIN, System::Hardware::MUX_S2_PIN,
            System::Hardware::MUX_S3_PIN) {
     pinMode(System::Hardware::MUX_SIGNAL_PIN, INPUT_PULLUP);
-    selectChannel(0);
+    mux_.channel(0);
+    lastSwitchTimestamp_ = micros();
+    channelReady_ = false;
+}
+
+void Multiplexer::enableChannel(uint8_t channel) {
+    if (channel >= System::Hardware::MUX_MAX_CHANNELS) {
+        return;
+    }
+
+    enabledChannels_ |= static_cast<uint16_t>(1u << channel);
+    rebuildScanOrder();
+}
+
+void Multiplexer::rebuildScanOrder() {
+    scanLength_ = 0;
+    for (uint8_t i = 0; i < System::Hardware::MUX_MAX_CHANNELS; ++i) {
+        uint8_t channel = grayCode(i);
+        if (enabledChannels_ & (1u << channel)) {
+            scanOrder_[scanLength_++] = channel;
+        }
+    }
+
+    scanIndex_ = 0;
+    if (scanLength_ > 0) {
+        selectChannel(scanOrder_[0]);
+    }
 }
 
 void Multiplexer::selectChannel(uint8_t channel) {
@@ -23,19 +56,35 @@ void Multiplexer::selectChannel(uint8_t channel) {
     }
 }
 
-bool Multiplexer::readDigital() {
+void Multiplexer::scan() {
+    if (scanLength_ == 0) {
+        return;
+    }
+
     if (!channelReady_) {
-        uint32_t elapsed = micros() - lastSwitchTimestamp_;
-        if (elapsed < System::Hardware::MUX_DEBOUNCE_US) {
-            delayMicroseconds(System::Hardware::MUX_DEBOUNCE_US - elapsed);
+        if (micros() - lastSwitchTimestamp_ < System::Hardware::MUX_DEBOUNCE_US) {
+            return;  // Still settling - sample on a later pass
         }
         channelReady_ = true;
     }
 
-    return digitalRead(System::Hardware::MUX_SIGNAL_PIN);
+    uint16_t bit = static_cast<uint16_t>(1u << currentChannel_);
+    if (digitalRead(System::Hardware::MUX_SIGNAL_PIN)) {
+        channelStates_ |= bit;
+    } else {
+        channelStates_ &= static_cast<uint16_t>(~bit);
+    }
+
+    if (++scanIndex_ >= scanLength_) {
+        scanIndex_ = 0;
+        ++scanCount_;
+    }
+    selectChannel(scanOrder_[scanIndex_]);
 }
 
-bool Multiplexer::readDigitalFromChannel(uint8_t channel) {
-    selectChannel(channel);
-    return readDigital();
-}
\ No newline at end of file
+bool Multiplexer::readDigitalFromChannel(uint8_t channel) const {
+    if (channel >= System::Hardware::MUX_MAX_CHANNELS) {
+        return true;
+    }
+    return (channelStates_ >> channel) & 1u;
+}
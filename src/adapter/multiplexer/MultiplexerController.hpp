@@ -4,6 +4,15 @@
 
 #include "config/System.hpp"
 
+/**
+ * @brief Non-blocking CD74HC4067 scanner
+ *
+ * Channels used by buttons are registered with enableChannel() and visited in
+ * Gray-code order, so each step flips a single select line. scan() never
+ * waits: when the selected channel has settled (MUX_DEBOUNCE_US) it is sampled
+ * into a cached bitmask and the next channel is selected; otherwise it returns.
+ * readDigitalFromChannel() returns the cached level.
+ */
 class Multiplexer {
 public:
     Multiplexer();
@@ -12,14 +21,36 @@ public:
     Multiplexer(const Multiplexer&) = delete;
     Multiplexer& operator=(const Multiplexer&) = delete;
 
-    bool readDigitalFromChannel(uint8_t channel);
+    void enableChannel(uint8_t channel);
+
+    /** @brief Advance the scan by at most one channel, never blocks */
+    void scan();
+
+    bool readDigitalFromChannel(uint8_t channel) const;
+
+    /** @brief Cached level of all channels, bit n = channel n (1 = HIGH) */
+    uint16_t getChannelStates() const {
+        return channelStates_;
+    }
+
+    /** @brief Incremented each time every enabled channel has been sampled once */
+    uint32_t getScanCount() const {
+        return scanCount_;
+    }
 
 private:
     void selectChannel(uint8_t channel);
-    bool readDigital();
+    void rebuildScanOrder();
 
     CD74HC4067 mux_;
     uint8_t currentChannel_ = 0;
     uint32_t lastSwitchTimestamp_ = 0;
     bool channelReady_ = true;
-};
\ No newline at end of file
+
+    uint16_t enabledChannels_ = 0;
+    uint16_t channelStates_ = 0xFFFF;  // Pull-ups: idle HIGH until sampled
+    uint8_t scanOrder_[System::Hardware::MUX_MAX_CHANNELS] = {};
+    uint8_t scanLength_ = 0;
+    uint8_t scanIndex_ = 0;
+    uint32_t scanCount_ = 0;
+};
@@ -0,0 +1,71 @@
+#include "EepromMappingStore.hpp"
+
+#include <EEPROM.h>
+
+#include "log/Macros.hpp"
+
+namespace {
+constexpr uint16_t ADDRESS = System::Storage::MIDI_MAPPINGS_EEPROM_ADDRESS;
+
+/* The whole image is read at boot; keep it clear of the next EEPROM user */
+constexpr size_t EEPROM_SIZE = 4284;
+}  // namespace
+
+bool EepromMappingStore::load(Mappings& out) const {
+    static_assert(ADDRESS + sizeof(Image) <= EEPROM_SIZE, "Mapping image exceeds EEPROM");
+
+    Image image;
+    EEPROM.get(ADDRESS, image);
+    if (image.magic != MAGIC || image.version != VERSION ||
+        image.count > System::Memory::MAX_MIDI_MAPPINGS || image.checksum != checksum(image)) {
+        return false;
+    }
+
+    out.clear();
+    for (uint8_t i = 0; i < image.count; ++i) {
+        const Record& record = image.records[i];
+        if (record.kind == static_cast<uint8_t>(MidiInputKind::Encoder)) {
+            out.push_back(MidiCCMapping(static_cast<EncoderID>(record.inputId), record.channel,
+                                        record.cc, static_cast<MidiResolution>(record.resolution)));
+        } else {
+            out.push_back(
+                MidiCCMapping(static_cast<ButtonID>(record.inputId), record.channel, record.cc));
+        }
+    }
+    return true;
+}
+
+void EepromMappingStore::save(const Mappings& mappings) {
+    Image image = {};
+    image.magic = MAGIC;
+    image.version = VERSION;
+    image.count = static_cast<uint8_t>(mappings.size());
+    for (size_t i = 0; i < mappings.size(); ++i) {
+        const MidiCCMapping& mapping = mappings[i];
+        image.records[i] = {mapping.inputId, static_cast<uint8_t>(mapping.kind), mapping.channel,
+                            mapping.cc, static_cast<uint8_t>(mapping.resolution)};
+    }
+    image.checksum = checksum(image);
+
+    EEPROM.put(ADDRESS, image);
+    LOGF("[EepromMappingStore] Saved %d mappings\n", image.count);
+}
+
+void EepromMappingStore::clear() {
+    const uint32_t none = 0;
+    EEPROM.put(ADDRESS, none);
+}
+
+/* Fletcher-16 over the records in use */
+uint16_t EepromMappingStore::checksum(const Image& image) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(image.records);
+    const size_t length = image.count * sizeof(Record);
+
+    uint16_t sum1 = image.count;
+    uint16_t sum2 = image.version;
+    for (size_t i = 0; i < length; ++i) {
+        sum1 = static_cast<uint16_t>((sum1 + bytes[i]) % 255);
+        sum2 = static_cast<uint16_t>((sum2 + sum1) % 255);
+    }
+    return static_cast<uint16_t>((sum2 << 8) | sum1);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <etl/vector.h>
+
+#include <cstdint>
+
+#include "config/System.hpp"
+#include "core/struct/MidiCCMapping.hpp"
+
+/**
+ * @brief MIDI mappings persisted in the Teensy emulated EEPROM
+ *
+ * The image is a fixed-size block of packed records behind a small header
+ * (magic, version, count, checksum), read back with a single EEPROM.get():
+ * loading at boot is a copy and a checksum, no parsing.
+ */
+class EepromMappingStore {
+public:
+    using Mappings = etl::vector<MidiCCMapping, System::Memory::MAX_MIDI_MAPPINGS>;
+
+    /**
+     * @brief Load the stored mappings
+     * @return false (out untouched) if nothing valid is stored
+     */
+    bool load(Mappings& out) const;
+
+    /** @brief Persist mappings; only modified EEPROM bytes are rewritten */
+    void save(const Mappings& mappings);
+
+    /** @brief Invalidate the stored image (defaults are used at next boot) */
+    void clear();
+
+private:
+    static constexpr uint32_t MAGIC = 0x4D4D4150;  // "MMAP"
+    static constexpr uint8_t VERSION = 1;
+
+    struct Record {
+        uint16_t inputId;
+        uint8_t kind;
+        uint8_t channel;
+        uint8_t cc;
+        uint8_t resolution;
+    };
+
+    struct Image {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t count;
+        uint16_t checksum;
+        Record records[System::Memory::MAX_MIDI_MAPPINGS];
+    };
+
+    static uint16_t checksum(const Image& image);
+};
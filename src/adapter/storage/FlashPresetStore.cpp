@@ -0,0 +1,88 @@
+#include "FlashPresetStore.hpp"
+
+#include <LittleFS.h>
+
+#include <stdio.h>
+
+#include "log/Macros.hpp"
+
+namespace {
+LittleFS_Program presetFs;
+
+constexpr size_t PATH_LENGTH = 16;
+}  // namespace
+
+bool FlashPresetStore::load(uint8_t slot, Preset& out) {
+    char path[PATH_LENGTH];
+    if (!slotPath(slot, path, sizeof(path)) || !mount()) return false;
+
+    File file = presetFs.open(path, FILE_READ);
+    if (!file) return false;
+
+    Preset preset;
+    const bool ok = file.read(&preset, sizeof(preset)) == static_cast<int>(sizeof(preset)) &&
+                    preset.valid();
+    file.close();
+
+    if (!ok) {
+        LOGF("[FlashPresetStore] WARNING: Preset %d is invalid\n", slot);
+        return false;
+    }
+    out = preset;
+    return true;
+}
+
+bool FlashPresetStore::save(uint8_t slot, const Preset& preset) {
+    char path[PATH_LENGTH];
+    if (!slotPath(slot, path, sizeof(path)) || !mount()) return false;
+
+    File file = presetFs.open(path, FILE_WRITE_BEGIN);
+    if (!file) {
+        LOGF("[FlashPresetStore] ERROR: Cannot write preset %d\n", slot);
+        return false;
+    }
+    const bool ok = file.write(reinterpret_cast<const uint8_t*>(&preset), sizeof(preset)) ==
+                    sizeof(preset);
+    file.truncate(sizeof(preset));
+    file.close();
+
+    if (!ok) {
+        LOGF("[FlashPresetStore] ERROR: Preset %d not saved (flash full?)\n", slot);
+        return false;
+    }
+    LOGF("[FlashPresetStore] Saved preset %d\n", slot);
+    return true;
+}
+
+bool FlashPresetStore::remove(uint8_t slot) {
+    char path[PATH_LENGTH];
+    if (!slotPath(slot, path, sizeof(path)) || !mount()) return false;
+    return presetFs.remove(path);
+}
+
+bool FlashPresetStore::exists(uint8_t slot) {
+    char path[PATH_LENGTH];
+    if (!slotPath(slot, path, sizeof(path)) || !mount()) return false;
+    return presetFs.exists(path);
+}
+
+bool FlashPresetStore::mount() {
+    if (mounted_) return true;
+    if (mountFailed_) return false;  // Do not retry (and reformat) on every call
+
+    mounted_ = presetFs.begin(System::Storage::PRESET_FLASH_SIZE);
+    if (!mounted_) {
+        mountFailed_ = true;
+        LOGLN("[FlashPresetStore] ERROR: Cannot mount the preset flash partition");
+    }
+    return mounted_;
+}
+
+bool FlashPresetStore::slotPath(uint8_t slot, char* path, size_t size) {
+    if (slot >= System::Storage::PRESET_SLOTS) {
+        LOGF("[FlashPresetStore] ERROR: No preset slot %d\n", slot);
+        return false;
+    }
+    snprintf(path, size, "/preset%02u.bin", static_cast<unsigned>(slot));
+    return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/struct/Preset.hpp"
+
+/**
+ * @brief Preset slots kept in a LittleFS partition of the Teensy program flash
+ *
+ * One file per slot (System::Storage::PRESET_SLOTS), holding the Preset
+ * struct as is: reading a slot back is one file read and a header check.
+ * LittleFS survives a power loss in the middle of a save (the previous
+ * version of the slot stays). The partition is mounted on first use.
+ */
+class FlashPresetStore {
+public:
+    /** @return false (out untouched) for an empty slot or an invalid image */
+    bool load(uint8_t slot, Preset& out);
+
+    bool save(uint8_t slot, const Preset& preset);
+    bool remove(uint8_t slot);
+    bool exists(uint8_t slot);
+
+private:
+    bool mount();
+    static bool slotPath(uint8_t slot, char* path, size_t size);
+
+    bool mounted_ = false;
+    bool mountFailed_ = false;
+};
@@ -1,21 +1,40 @@
 #include "api/ControllerAPI.hpp"
 #include "adapter/input/encoder/EncoderController.hpp"
+#include "adapter/midi/TeensyUsbMidiIn.hpp"
 #include "adapter/midi/TeensyUsbMidiOut.hpp"
 #include "core/event/IEventBus.hpp"
 #include "core/input/InputBinding.hpp"
+#include "core/midi/MidiMapper.hpp"
+#include "core/midi/SysExCodec.hpp"
+#include "core/util/PluginAccounting.hpp"
+#include "core/util/Task.hpp"
 #include "log/Macros.hpp"
 #include "manager/ViewManager.hpp"
 
 /*
  * Constructor
  */
-ControllerAPI::ControllerAPI(InputBinding& bindings, IEventBus& events, TeensyUsbMidiOut& midiOut,
-                             EncoderController& encoders, ViewManager& viewManager)
+ControllerAPI::ControllerAPI(InputBinding& bindings, IEventBus& events, TeensyUsbMidiIn& midiIn,
+                             MidiClock& clock, TeensyUsbMidiOut& midiOut,
+                             EncoderController& encoders, ViewManager& viewManager,
+                             TaskRunner& tasks, MidiMapper& midiMapper)
     : bindingService_(bindings),
       eventBus_(events),
+      midiIn_(midiIn),
+      clock_(clock),
       midiOut_(midiOut),
       encoders_(encoders),
-      viewManager_(viewManager) {}
+      viewManager_(viewManager),
+      tasks_(tasks),
+      midiMapper_(midiMapper),
+      parameterSync_(parameters_, encoders, midiOut) {
+    const uint8_t pageSync[] = {System::Midi::SYSEX_MANUFACTURER_ID,
+                                System::Midi::SYSEX_CMD_PAGE_SYNC};
+    pageSyncSub_ = addSysExHandler(pageSync, sizeof(pageSync),
+                                   [this](const uint8_t* data, uint16_t length) {
+        applyPageSync(data, length);
+    });
+}
 
 /*
  * INPUT BINDING API - Delegate to InputBinding service
@@ -28,6 +47,10 @@ void ControllerAPI::onReleased(ButtonID buttonId, ActionCallback callback) {
     bindingService_.onReleased(buttonId, callback);
 }
 
+uint32_t ControllerAPI::getPressedButtonMask() const {
+    return bindingService_.pressedMask();
+}
+
 void ControllerAPI::onLongPress(ButtonID buttonId, ActionCallback callback, uint32_t ms) {
     bindingService_.onLongPress(buttonId, callback, ms);
 }
@@ -81,15 +104,69 @@ void ControllerAPI::onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
     bindingService_.onTurnedWhilePressed(encoderId, buttonId, std::move(callback), scope);
 }
 
+void ControllerAPI::onChord(std::initializer_list<ButtonID> buttons, ActionCallback callback) {
+    bindingService_.onChord(buttons, std::move(callback));
+}
+
+void ControllerAPI::onSequence(std::initializer_list<ButtonID> buttons, ActionCallback callback) {
+    bindingService_.onSequence(buttons, std::move(callback));
+}
+
+void ControllerAPI::onHoldTap(ButtonID hold, ButtonID tap, ActionCallback callback) {
+    bindingService_.onHoldTap(hold, tap, std::move(callback));
+}
+
+void ControllerAPI::onChord(std::initializer_list<ButtonID> buttons, ActionCallback callback,
+                            lv_obj_t* scope) {
+    bindingService_.onChord(buttons, std::move(callback), scope);
+}
+
+void ControllerAPI::onSequence(std::initializer_list<ButtonID> buttons, ActionCallback callback,
+                               lv_obj_t* scope) {
+    bindingService_.onSequence(buttons, std::move(callback), scope);
+}
+
+void ControllerAPI::onHoldTap(ButtonID hold, ButtonID tap, ActionCallback callback,
+                              lv_obj_t* scope) {
+    bindingService_.onHoldTap(hold, tap, std::move(callback), scope);
+}
+
 void ControllerAPI::clearScope(lv_obj_t* scope) {
     bindingService_.clearScope(scope);
 }
 
+/*
+ * BINDING LAYERS - Delegate to InputBinding service
+ */
+BindingLayerId ControllerAPI::createBindingLayer(const char* name) {
+    return bindingService_.createLayer(name);
+}
+
+void ControllerAPI::beginBindingLayer(BindingLayerId layer) {
+    bindingService_.beginLayer(layer);
+}
+
+void ControllerAPI::endBindingLayer() {
+    bindingService_.endLayer();
+}
+
+bool ControllerAPI::pushBindingLayer(BindingLayerId layer) {
+    return bindingService_.pushLayer(layer);
+}
+
+void ControllerAPI::popBindingLayer() {
+    bindingService_.popLayer();
+}
+
 /*
  * ENCODER CONTROL API - Control the hardware
  */
 void ControllerAPI::setEncoderPosition(EncoderID encoderId, float normalizedValue) {
-    encoders_.resetEncoderPosition(encoderId, normalizedValue);
+    encoders_.syncEncoder(encoderId, normalizedValue);
+}
+
+void ControllerAPI::setEncoderTakeover(EncoderID encoderId, Hardware::EncoderTakeover takeover) {
+    encoders_.setTakeover(encoderId, takeover);
 }
 
 void ControllerAPI::setEncoderDiscreteSteps(EncoderID encoderId, uint8_t steps) {
@@ -100,23 +177,140 @@ void ControllerAPI::setEncoderContinuous(EncoderID encoderId) {
     encoders_.setContinuous(encoderId);
 }
 
+void ControllerAPI::setEncoderAcceleration(EncoderID encoderId, uint8_t maxMultiplier) {
+    Hardware::EncoderAcceleration acceleration;
+    acceleration.maxMultiplier = maxMultiplier;
+    encoders_.setAcceleration(encoderId, acceleration);
+}
+
+void ControllerAPI::retainEncoderFrames() {
+    if (encoderFrameSubscribers_++ == 0) encoders_.setFrameEvents(true);
+}
+
+void ControllerAPI::releaseEncoderFrames(SubscriptionId id) {
+    eventBus_.off(id);
+    if (encoderFrameSubscribers_ != 0 && --encoderFrameSubscribers_ == 0) {
+        encoders_.setFrameEvents(System::Input::ENCODER_FRAME_EVENTS);
+    }
+}
+
+/*
+ * MIDI INPUT API - Realtime fast lane
+ */
+MidiRealtimeListenerId ControllerAPI::onRealtime(MidiRealtimeCallback callback) {
+    return midiIn_.addRealtimeListener(std::move(callback));
+}
+
+void ControllerAPI::removeRealtimeListener(MidiRealtimeListenerId id) {
+    midiIn_.removeRealtimeListener(id);
+}
+
+/*
+ * MIDI CLOCK API - Delegate to MidiClock
+ */
+MidiClock::ListenerId ControllerAPI::onClockTick(MidiClock::TickCallback callback) {
+    return clock_.addTickListener(std::move(callback));
+}
+
+void ControllerAPI::removeClockTickListener(MidiClock::ListenerId id) {
+    clock_.removeTickListener(id);
+}
+
+float ControllerAPI::getClockBpm() const {
+    return clock_.bpm();
+}
+
+float ControllerAPI::getBeatPhase() const {
+    return clock_.beatPhase();
+}
+
+uint32_t ControllerAPI::getClockTick() const {
+    return clock_.tick();
+}
+
+bool ControllerAPI::isClockRunning() const {
+    return clock_.isRunning();
+}
+
+uint32_t ControllerAPI::nextClockTickUs(uint32_t ticks) const {
+    return clock_.tickTimeUs(clock_.nextTick(ticks));
+}
+
 /*
  * SEND API - MIDI output
  */
-void ControllerAPI::sendSysEx(const uint8_t* data, size_t length) {
-    midiOut_.sendSysEx(data, length);
+void ControllerAPI::sendSysEx(const uint8_t* data, size_t length, MidiTraffic traffic) {
+    midiOut_.sendSysEx(data, length, traffic);
 }
 
-void ControllerAPI::sendCC(uint8_t channel, uint8_t cc, uint8_t value) {
-    midiOut_.sendControlChange(channel, cc, value);
+bool ControllerAPI::sendSysExAsync(const uint8_t* data, size_t length, SysExSentCallback onSent,
+                                   MidiTraffic traffic) {
+    if (length > System::Midi::SYSEX_TX_ARENA_SIZE) {
+        LOGF("[ControllerAPI] ERROR: Async SysEx of %u bytes (max %u), use sendSysEx()\n",
+             static_cast<unsigned>(length),
+             static_cast<unsigned>(System::Midi::SYSEX_TX_ARENA_SIZE));
+        return false;
+    }
+    return midiOut_.sendSysExAsync(data, static_cast<uint16_t>(length), std::move(onSent),
+                                   traffic);
 }
 
-void ControllerAPI::sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
-    midiOut_.sendNoteOn(channel, note, velocity);
+void ControllerAPI::sendCC(uint8_t channel, uint8_t cc, uint8_t value, MidiTraffic traffic) {
+    midiOut_.sendControlChange(channel, cc, value, traffic);
+    eventBus_.post(MidiCCEvent(channel, cc, value, PluginAccounting::currentOwner(),
+                               MidiOrigin::Plugin));
 }
 
-void ControllerAPI::sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
-    midiOut_.sendNoteOff(channel, note, velocity);
+size_t ControllerAPI::sendCCs(const MidiCCMessage* messages, size_t count, bool skipUnchanged) {
+    return midiOut_.sendControlChanges(messages, count, skipUnchanged);
+}
+
+size_t ControllerAPI::sendMidiPackets(const uint32_t* packets, size_t count) {
+    return midiOut_.sendPackets(packets, count);
+}
+
+void ControllerAPI::sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity,
+                               MidiTraffic traffic) {
+    midiOut_.sendNoteOn(channel, note, velocity, traffic);
+}
+
+void ControllerAPI::sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity,
+                                MidiTraffic traffic) {
+    midiOut_.sendNoteOff(channel, note, velocity, traffic);
+}
+
+void ControllerAPI::panic() {
+    midiOut_.panic();
+}
+
+bool ControllerAPI::scheduleCC(uint32_t atUs, uint8_t channel, uint8_t cc, uint8_t value) {
+    return midiOut_.schedule(atUs, 0xB0 | (channel & 0x0F), cc, value);
+}
+
+bool ControllerAPI::scheduleNoteOn(uint32_t atUs, uint8_t channel, uint8_t note,
+                                   uint8_t velocity) {
+    return midiOut_.schedule(atUs, 0x90 | (channel & 0x0F), note, velocity);
+}
+
+bool ControllerAPI::scheduleNoteOff(uint32_t atUs, uint8_t channel, uint8_t note,
+                                    uint8_t velocity) {
+    return midiOut_.schedule(atUs, 0x80 | (channel & 0x0F), note, velocity);
+}
+
+MidiRouter::RouteId ControllerAPI::addMidiRoute(uint8_t source, uint8_t destination,
+                                                uint16_t channelMask, uint16_t typeMask) {
+    MidiRouter* router = midiIn_.router();
+    if (!router) {
+        LOGLN("[ControllerAPI] ERROR: No MIDI router");
+        return MidiRouter::INVALID_ROUTE;
+    }
+    return router->addRoute(source, destination, channelMask, typeMask);
+}
+
+void ControllerAPI::removeMidiRoute(MidiRouter::RouteId id) {
+    if (MidiRouter* router = midiIn_.router()) {
+        router->removeRoute(id);
+    }
 }
 
 /*
@@ -126,12 +320,366 @@ lv_obj_t* ControllerAPI::getParentContainer() {
     return viewManager_.getPluginContainer();
 }
 
+DisplayStats ControllerAPI::getUiStats() const {
+    return viewManager_.getDisplayStats();
+}
+
+void ControllerAPI::sendUiStats() {
+    const DisplayStats stats = getUiStats();
+
+    uint8_t message[96];
+    message[0] = 0xF0;
+    message[1] = System::Midi::SYSEX_MANUFACTURER_ID;
+    message[2] = System::Midi::SYSEX_CMD_UI_STATS;
+    SysExWriter writer(message + 3, sizeof(message) - 4);
+    writer.writeU32(stats.memTotal);
+    writer.writeU32(stats.memUsed);
+    writer.writeU32(stats.memPeak);
+    writer.writeU7(stats.memUsedPct);
+    writer.writeU7(stats.memFragPct);
+    writer.writeU32(stats.memFastUsed);
+    writer.writeU32(stats.memLargeUsed);
+    writer.writeU16(stats.fps);
+    writer.writeU32(stats.renderUs);
+    writer.writeU32(stats.flushUs);
+    writer.writeU32(stats.droppedFrames);
+    writer.writeBool(stats.idle);
+    writer.writeU32(stats.frames);
+    writer.writeU32(stats.diffOverflows);
+    writer.writeU32(stats.tearedFrames);
+    writer.writeU32(stats.uploadedPixels);
+    writer.writeU32(stats.uploadUs);
+    writer.writeU32(stats.vsyncWaitUs);
+    writer.writeU7(stats.diffGap);
+    writer.writeU7(stats.vsyncSpacing);
+    if (!writer.ok()) return;
+
+    const size_t length = 3 + writer.size();
+    message[length] = 0xF7;
+    midiOut_.sendSysEx(message, static_cast<uint16_t>(length + 1));
+}
+
+uint32_t ControllerAPI::getLoopOverrunCount() const {
+    return LoopMonitor::overruns();
+}
+
+const LoopMonitor::Trace* ControllerAPI::getLoopOverrun(uint8_t age) const {
+    return LoopMonitor::trace(age);
+}
+
+const PluginAccounting::Report& ControllerAPI::getPluginStats(uint8_t integrationId) const {
+    return PluginAccounting::report(integrationId);
+}
+
+void* ControllerAPI::allocate(size_t size, size_t alignment) {
+    return PluginArena::allocate(PluginAccounting::currentOwner(), size, alignment);
+}
+
+void ControllerAPI::deallocate(void* pointer, size_t size) {
+    PluginArena::deallocate(pointer, size);
+}
+
+const PluginArena::Stats& ControllerAPI::getPluginArenaStats(uint8_t integrationId) const {
+    return PluginArena::stats(integrationId);
+}
+
+void ControllerAPI::sendPluginStats() {
+    for (uint8_t id = 0; id < System::Memory::MAX_PLUGINS; ++id) {
+        const PluginAccounting::Report& stats = getPluginStats(id);
+        if (stats.update.calls == 0 && stats.callbacks.calls == 0 && stats.heapBytes == 0 &&
+            stats.lvglBytes == 0) {
+            continue;
+        }
+
+        uint8_t message[64];
+        message[0] = 0xF0;
+        message[1] = System::Midi::SYSEX_MANUFACTURER_ID;
+        message[2] = System::Midi::SYSEX_CMD_PLUGIN_STATS;
+        SysExWriter writer(message + 3, sizeof(message) - 4);
+        writer.writeU7(id);
+        for (const PluginAccounting::Cost* cost : {&stats.update, &stats.callbacks}) {
+            writer.writeU32(cost->calls);
+            writer.writeU32(PluginAccounting::cyclesToUs(cost->totalCycles));
+            writer.writeU32(PluginAccounting::cyclesToUs(cost->worstCycles));
+        }
+        writer.writeU32(static_cast<uint32_t>(stats.heapBytes));
+        writer.writeU32(static_cast<uint32_t>(stats.lvglBytes));
+        if (!writer.ok()) return;
+
+        const size_t length = 3 + writer.size();
+        message[length] = 0xF7;
+        midiOut_.sendSysEx(message, static_cast<uint16_t>(length + 1));
+    }
+}
+
+void ControllerAPI::setDisplayAutoTune(bool enabled) {
+    viewManager_.setDisplayAutoTune(enabled);
+}
+
+void ControllerAPI::setDebugOverlay(bool enabled) {
+    viewManager_.setDebugOverlay(enabled);
+}
+
+bool ControllerAPI::isDebugOverlayEnabled() const {
+    return viewManager_.isDebugOverlayEnabled();
+}
+
+bool ControllerAPI::registerPluginView(UI::IView& view, bool hibernate) {
+    return viewManager_.registerPluginView(view, hibernate);
+}
+
+void ControllerAPI::unregisterPluginView(UI::IView& view) {
+    viewManager_.unregisterPluginView(view);
+    bindingService_.invalidateScopes();
+}
+
 void ControllerAPI::showPluginView(UI::IView& view) {
     viewManager_.showPluginView(view);
+    bindingService_.invalidateScopes();
 }
 
 void ControllerAPI::hidePluginView() {
     viewManager_.hidePluginView();
+    bindingService_.invalidateScopes();
+}
+
+/*
+ * FILTERED MIDI INPUT - One bus listener per kind feeds midiIndex_
+ */
+Subscription ControllerAPI::addMidiFilter(MidiDispatchIndex::Kind kind, uint8_t channel,
+                                          uint8_t first, uint8_t last,
+                                          MidiDispatchIndex::Callback callback,
+                                          uint8_t origins) {
+    const MidiDispatchIndex::FilterId id =
+        midiIndex_.add(kind, channel, first, last, std::move(callback), origins);
+    if (id == MidiDispatchIndex::INVALID_FILTER) {
+        return Subscription();
+    }
+    Subscription subscription(&midiIndex_, id, [](void* index, uint16_t filterId) {
+        static_cast<MidiDispatchIndex*>(index)->remove(
+            static_cast<MidiDispatchIndex::FilterId>(filterId));
+    });
+    if (midiIndexListening_[kind]) {
+        return subscription;
+    }
+
+    // The listener serves every filter of this kind: core owns it, not the first caller
+    PluginAccounting::OwnerScope core(PluginAccounting::NO_OWNER);
+    midiIndexListening_[kind] = true;
+    switch (kind) {
+        case MidiDispatchIndex::CC:
+            eventBus_.on<MidiCCEvent>([this](const MidiCCEvent& cc) {
+                midiIndex_.dispatch(MidiDispatchIndex::CC, cc.channel, cc.controller, cc.value,
+                                    midiOriginBit(cc.origin),
+                                    cc.origin == MidiOrigin::Plugin
+                                        ? cc.source
+                                        : PluginAccounting::NO_OWNER);
+            });
+            break;
+        case MidiDispatchIndex::NOTE_ON:
+            eventBus_.on<MidiNoteOnEvent>([this](const MidiNoteOnEvent& note) {
+                midiIndex_.dispatch(MidiDispatchIndex::NOTE_ON, note.channel, note.note,
+                                    note.velocity);
+            });
+            break;
+        case MidiDispatchIndex::NOTE_OFF:
+            eventBus_.on<MidiNoteOffEvent>([this](const MidiNoteOffEvent& note) {
+                midiIndex_.dispatch(MidiDispatchIndex::NOTE_OFF, note.channel, note.note,
+                                    note.velocity);
+            });
+            break;
+        default:
+            break;
+    }
+    return subscription;
+}
+
+/*
+ * SYSEX ROUTING - One bus listener feeds sysExRouter_
+ */
+Subscription ControllerAPI::addSysExHandler(const uint8_t* prefix, uint8_t prefixLength,
+                                            SysExRouter::Handler handler) {
+    const SysExRouter::HandlerId id = sysExRouter_.add(prefix, prefixLength, std::move(handler));
+    if (id == SysExRouter::INVALID_HANDLER) {
+        return Subscription();
+    }
+    Subscription subscription(&sysExRouter_, id, [](void* router, uint16_t handlerId) {
+        static_cast<SysExRouter*>(router)->remove(static_cast<SysExRouter::HandlerId>(handlerId));
+    });
+    if (sysExRouterListening_) {
+        return subscription;
+    }
+
+    // Shared by every handler: core owns it, not the first caller
+    PluginAccounting::OwnerScope core(PluginAccounting::NO_OWNER);
+    sysExRouterListening_ = true;
+    eventBus_.on<SysExEvent>([this](const SysExEvent& sysex) {
+        sysExRouter_.route(sysex.data, sysex.length);
+    });
+    return subscription;
+}
+
+/*
+ * PARAMETER API - Delegate to ParameterSync
+ */
+void ControllerAPI::bindParameterWidget(ParameterStore::Index index, IParameterWidget* widget) {
+    parameterSync_.bindWidget(index, widget);
+}
+
+void ControllerAPI::bindParameterEncoder(ParameterStore::Index index, EncoderID encoder) {
+    parameterSync_.bindEncoder(index, encoder);
+}
+
+void ControllerAPI::bindParameterCC(ParameterStore::Index index, uint8_t channel, uint8_t cc) {
+    parameterSync_.bindCC(index, channel, cc);
+}
+
+void ControllerAPI::clearParameterBindings() {
+    parameterSync_.clear();
+}
+
+void ControllerAPI::syncParameters() {
+    // Host page syncs change the screen without any input: leave idle for them too
+    if (parameterSync_.sync()) viewManager_.wakeDisplay();
+}
+
+namespace {
+enum PageSyncField : uint8_t {
+    PAGE_SYNC_VALUE = 1 << 0,
+    PAGE_SYNC_DISPLAY = 1 << 1,
+    PAGE_SYNC_NAME = 1 << 2,
+    PAGE_SYNC_DISCRETE = 1 << 3,
+};
+
+struct PageSyncEntry {
+    uint16_t id;
+    uint16_t discreteCount;
+    float value;
+    char name[System::Memory::PARAMETER_NAME_LENGTH + 1];
+    char display[System::Memory::PARAMETER_DISPLAY_LENGTH + 1];
+};
+}  // namespace
+
+void ControllerAPI::applyPageSync(const uint8_t* data, uint16_t length) {
+    // F0 7D 12 ... F7: the reader walks the message itself, no unpacked copy
+    if (length < 4) return;
+    SysExReader reader(data + 3, length - 4);
+
+    uint8_t fields = 0;
+    uint8_t count = 0;
+    reader.readU7(fields);
+    reader.readU7(count);
+    if (count > System::Midi::PAGE_SYNC_PARAMETERS) {
+        ++pageSyncErrors_;
+        LOGF("[ControllerAPI] ERROR: Page sync of %u parameters (max %u)\n", count,
+             System::Midi::PAGE_SYNC_PARAMETERS);
+        return;
+    }
+
+    // Parse the whole page before touching the store: a truncated message changes nothing
+    PageSyncEntry entries[System::Midi::PAGE_SYNC_PARAMETERS];
+    for (uint8_t i = 0; i < count; ++i) {
+        PageSyncEntry& entry = entries[i];
+        entry.name[0] = '\0';
+        entry.display[0] = '\0';
+        reader.readU16(entry.id);
+        if (fields & PAGE_SYNC_VALUE) reader.readNormalized(entry.value);
+        if (fields & PAGE_SYNC_DISCRETE) reader.readU14(entry.discreteCount);
+        if (fields & PAGE_SYNC_NAME) reader.readString(entry.name, sizeof(entry.name));
+        if (fields & PAGE_SYNC_DISPLAY) reader.readString(entry.display, sizeof(entry.display));
+    }
+    if (!reader.ok()) {
+        ++pageSyncErrors_;
+        LOGLN("[ControllerAPI] ERROR: Malformed page sync message");
+        return;
+    }
+
+    // Dirty bits only: the whole page reaches widgets and encoders in one syncParameters()
+    for (uint8_t i = 0; i < count; ++i) {
+        const PageSyncEntry& entry = entries[i];
+        const ParameterStore::Index index = parameters_.add(entry.id);
+        if (index == ParameterStore::INVALID_INDEX) continue;
+        if (fields & PAGE_SYNC_NAME) parameters_.setName(index, entry.name);
+        if (fields & PAGE_SYNC_DISCRETE) parameters_.setDiscreteCount(index, entry.discreteCount);
+        if (fields & PAGE_SYNC_VALUE) parameters_.setValue(index, entry.value, MidiOrigin::Host);
+        if (fields & PAGE_SYNC_DISPLAY) parameters_.setDisplay(index, entry.display);
+    }
+}
+
+/*
+ * PRESET API - Snapshots through FlashPresetStore
+ */
+bool ControllerAPI::savePreset(uint8_t slot) {
+    Preset preset;
+    preset.encoderCount = encoders_.capture(preset.encoders, System::Hardware::ENCODERS_COUNT);
+
+    for (ParameterStore::Index i = 0; i < parameters_.size(); ++i) {
+        const ParameterStore::Parameter& param = *parameters_.get(i);
+        preset.parameters[preset.parameterCount++] = {param.id,
+                                                      UNorm16::fromFloat(param.value).raw};
+    }
+
+    MidiMapper::Mappings mappings;
+    midiMapper_.exportMappings(mappings);
+    for (const MidiCCMapping& mapping : mappings) {
+        preset.mappings[preset.mappingCount++] = {mapping.inputId,
+                                                  static_cast<uint8_t>(mapping.kind),
+                                                  mapping.channel, mapping.cc,
+                                                  static_cast<uint8_t>(mapping.resolution)};
+    }
+
+    return presets_.save(slot, preset);
+}
+
+bool ControllerAPI::recallPreset(uint8_t slot) {
+    Preset preset;
+    if (!presets_.load(slot, preset)) return false;
+
+    encoders_.restore(preset.encoders, preset.encoderCount);
+
+    MidiMapper::Mappings mappings;
+    for (uint8_t i = 0; i < preset.mappingCount; ++i) {
+        const Preset::Mapping& mapping = preset.mappings[i];
+        if (mapping.kind == static_cast<uint8_t>(MidiInputKind::Encoder)) {
+            mappings.push_back(MidiCCMapping(static_cast<EncoderID>(mapping.inputId),
+                                             mapping.channel, mapping.cc,
+                                             static_cast<MidiResolution>(mapping.resolution)));
+        } else {
+            mappings.push_back(MidiCCMapping(static_cast<ButtonID>(mapping.inputId),
+                                             mapping.channel, mapping.cc));
+        }
+    }
+    midiMapper_.setMappings(mappings);
+
+    // Dirty bits only: widgets, bound encoders and CCs follow in one syncParameters()
+    for (uint8_t i = 0; i < preset.parameterCount; ++i) {
+        const ParameterStore::Index index = parameters_.find(preset.parameters[i].id);
+        if (index != ParameterStore::INVALID_INDEX) {
+            parameters_.setValue(index, UNorm16{preset.parameters[i].value}.toFloat());
+        }
+    }
+
+    LOGF("[ControllerAPI] Recalled preset %d\n", slot);
+    return true;
+}
+
+/*
+ * TASK API - Delegate to PluginManager's TaskRunner
+ */
+bool ControllerAPI::startTask(Task& task) {
+    if (!tasks_.start(task)) {
+        LOGLN("[ControllerAPI] Task not started (already running or table full)");
+        return false;
+    }
+    return true;
+}
+
+void ControllerAPI::cancelTask(Task& task) {
+    tasks_.cancel(task);
+}
+
+bool ControllerAPI::isTaskRunning(const Task& task) const {
+    return tasks_.isRunning(task);
 }
 
 /*
@@ -1,12 +1,30 @@
 #pragma once
 
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "adapter/display/ui/DisplayStats.hpp"
+#include "adapter/storage/FlashPresetStore.hpp"
 #include "config/InputID.hpp"
+#include "config/System.hpp"
+#include "core/interface/midi/MidiInput.hpp"
+#include "core/interface/midi/MidiOutput.hpp"
+#include "core/midi/MidiClock.hpp"
+#include "core/midi/MidiDispatchIndex.hpp"
+#include "core/midi/SysExRouter.hpp"
+#include "core/event/Subscription.hpp"
+#include "core/param/ParameterStore.hpp"
+#include "core/util/LoopMonitor.hpp"
+#include "core/util/PluginAccounting.hpp"
+#include "core/util/PluginArena.hpp"
+#include "api/ParameterSync.hpp"
+#include "core/midi/MidiRouter.hpp"
+#include "core/struct/Binding.hpp"
+#include "core/struct/Encoder.hpp"
 #include "log/Macros.hpp"
 
 typedef struct _lv_obj_t lv_obj_t;
@@ -21,7 +39,12 @@ namespace Color {}
 class EncoderController;
 class IEventBus;
 class InputBinding;
+class MidiMapper;
+class TeensyUsbMidiIn;
 class TeensyUsbMidiOut;
+class IParameterWidget;
+class Task;
+class TaskRunner;
 class ViewManager;
 
 namespace UI {
@@ -45,11 +68,13 @@ class IView;
  */
 class ControllerAPI {
 public:
-    using ActionCallback = std::function<void()>;
-    using EncoderActionCallback = std::function<void(float normalizedValue)>;
+    using ActionCallback = BindingAction;
+    using EncoderActionCallback = EncoderBindingAction;
+    using SysExSentCallback = InplaceFunction<void(), System::Memory::EVENT_CALLBACK_SIZE>;
 
-    ControllerAPI(InputBinding& bindings, IEventBus& events, TeensyUsbMidiOut& midiOut,
-                  EncoderController& encoders, ViewManager& viewManager);
+    ControllerAPI(InputBinding& bindings, IEventBus& events, TeensyUsbMidiIn& midiIn,
+                  MidiClock& clock, TeensyUsbMidiOut& midiOut, EncoderController& encoders,
+                  ViewManager& viewManager, TaskRunner& tasks, MidiMapper& midiMapper);
 
     // ===== INPUT BINDING API - React to controller input =====
 
@@ -106,6 +131,27 @@ public:
     void onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
                               EncoderActionCallback callback);
 
+    /**
+     * @brief Register callback for all the encoders that moved in one loop
+     * @param callback void(const EncoderFrameEvent& frame)
+     *
+     * One call per loop instead of one per encoder: test frame.changedMask
+     * (bit encoderIndex(id)) or frame.changed(id), then read the entries.
+     * Comes after that loop's onTurned callbacks. The controller emits frame
+     * events while at least one of these subscriptions is held: releasing the
+     * last (or unloading the plugin holding it) turns them back off.
+     */
+    template <typename Callback>
+    Subscription onEncoderFrame(Callback callback);
+
+    /**
+     * @brief Held buttons as a mask, bit buttonIndex(id)
+     *
+     * Feed it to ButtonIndicatorBatch::setStates() to show every button in
+     * one update per frame.
+     */
+    uint32_t getPressedButtonMask() const;
+
     // ===== SCOPED INPUT BINDING API - Active only when LVGL object visible =====
 
     /**
@@ -168,13 +214,77 @@ public:
     void onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
                               EncoderActionCallback callback, lv_obj_t* scope);
 
+    // ===== GESTURES - Multi-button shortcuts =====
+
+    /**
+     * @brief Register callback for a chord (2-8 buttons held together)
+     * @param buttons Exact set of buttons, fires on the press completing it
+     * @param callback Action to execute
+     */
+    void onChord(std::initializer_list<ButtonID> buttons, ActionCallback callback);
+
+    /**
+     * @brief Register callback for a press sequence
+     * @param buttons Buttons in order, each within System::Input::GESTURE_SEQUENCE_STEP_MS
+     * @param callback Action to execute on the last press
+     */
+    void onSequence(std::initializer_list<ButtonID> buttons, ActionCallback callback);
+
+    /**
+     * @brief Register callback for tapping a button while another is held
+     * @param hold Button held down
+     * @param tap Button pressed and released while hold is down
+     * @param callback Action to execute on the tap release
+     */
+    void onHoldTap(ButtonID hold, ButtonID tap, ActionCallback callback);
+
+    /** @brief Scoped variants (active only if scope visible) */
+    void onChord(std::initializer_list<ButtonID> buttons, ActionCallback callback,
+                 lv_obj_t* scope);
+    void onSequence(std::initializer_list<ButtonID> buttons, ActionCallback callback,
+                    lv_obj_t* scope);
+    void onHoldTap(ButtonID hold, ButtonID tap, ActionCallback callback, lv_obj_t* scope);
+
     /**
      * @brief Clear all bindings scoped to LVGL object
      * @param scope LVGL object
      */
     void clearScope(lv_obj_t* scope);
 
+    // ===== BINDING LAYERS - Build modes once, switch them in constant time =====
+
+    /**
+     * @brief Create a named binding layer
+     * @param name Static string used in logs
+     * @return Layer id, INVALID_BINDING_LAYER if System::Memory::MAX_BINDING_LAYERS reached
+     */
+    BindingLayerId createBindingLayer(const char* name);
+
+    /**
+     * @brief Register the following bindings into layer until endBindingLayer()
+     * @param layer Layer id from createBindingLayer()
+     */
+    void beginBindingLayer(BindingLayerId layer);
+    void endBindingLayer();
+
+    /**
+     * @brief Activate a layer above the current ones
+     * @return false if the layer is unknown or already active
+     *
+     * Its bindings take priority over lower layers and base bindings for the same input.
+     */
+    bool pushBindingLayer(BindingLayerId layer);
+
+    /**
+     * @brief Deactivate the topmost layer
+     */
+    void popBindingLayer();
+
     // ===== MIDI INPUT API - React to incoming MIDI messages =====
+    // Callbacks are stored inline (no heap): captures must fit in
+    // System::Memory::EVENT_CALLBACK_SIZE, checked at compile time.
+    // Each registration returns a Subscription: keep it for as long as the
+    // callback should run, the callback is removed when it is destroyed.
 
     /**
      * @brief Register callback for incoming SysEx messages
@@ -184,16 +294,64 @@ public:
      * Plugin should filter by manufacturer ID/protocol inside callback
      */
     template <typename Callback>
-    void onSysEx(Callback callback);
+    Subscription onSysEx(Callback callback);
 
     /**
-     * @brief Register callback for incoming Control Change messages
+     * @brief Register a SysEx handler for one manufacturer ID / command prefix
+     * @param prefix Bytes after 0xF0, e.g. {manufacturer, command}
+     *        (1 to System::Memory::MAX_SYSEX_PREFIX_LENGTH bytes)
+     * @param callback Same signature as onSysEx(callback), whole message
+     * @return Empty Subscription on a bad or duplicate prefix or a full table
+     *
+     * Each message goes to the handler of the longest prefix it starts with
+     * (SysExRouter trie); messages no handler matches are dropped before any
+     * plugin code runs.
+     */
+    template <typename Callback>
+    Subscription onSysEx(const uint8_t* prefix, uint8_t prefixLength, Callback callback);
+
+    /**
+     * @brief Register callback for incoming SysEx fragments
+     * @param callback Function to execute for each fragment as it arrives
+     *
+     * Callback signature:
+     * void(const uint8_t* data, uint16_t length, uint32_t offset, bool complete)
+     * Use for messages longer than System::Midi::SYSEX_REASSEMBLY_SIZE, or to
+     * start processing before the last byte arrives. data is only valid
+     * during the callback.
+     */
+    template <typename Callback>
+    Subscription onSysExChunk(Callback callback);
+
+    /**
+     * @brief Register callback for Control Change messages
      * @param callback Function to execute when CC received
+     * @param origins midiOriginBit() of each origin wanted: CCs from the host,
+     *        from this unit's controls (MidiMapper) and from plugins by default
      *
      * Callback signature: void(uint8_t channel, uint8_t controller, uint8_t value)
+     * Host echoes of CCs just sent are not delivered (System::Midi::ECHO_SUPPRESS_MS).
+     */
+    template <typename Callback>
+    Subscription onCC(Callback callback, uint8_t origins = MIDI_ORIGIN_ALL);
+
+    /** @brief Any channel, for the filtered onCC / onNoteOn / onNoteOff overloads */
+    static constexpr uint8_t MIDI_ANY_CHANNEL = MidiDispatchIndex::ANY_CHANNEL;
+
+    /**
+     * @brief Control Change callback for one controller (or range) on one channel
+     * @param channel 0-15, or MIDI_ANY_CHANNEL
+     * @param firstController,lastController Inclusive range (one controller: same value)
+     * @return Empty Subscription if System::Memory::MAX_FILTERED_MIDI_CALLBACKS
+     *         filters exist
+     *
+     * Same signature and origin filter as onCC(callback), but the callback is
+     * only called for the CCs it asked for (one 16x128 table lookup per CC,
+     * MidiDispatchIndex) instead of filtering every CC in plugin code.
      */
     template <typename Callback>
-    void onCC(Callback callback);
+    Subscription onCC(uint8_t channel, uint8_t firstController, uint8_t lastController,
+                      Callback callback, uint8_t origins = MIDI_ORIGIN_ALL);
 
     /**
      * @brief Register callback for incoming Note On messages
@@ -202,7 +360,12 @@ public:
      * Callback signature: void(uint8_t channel, uint8_t note, uint8_t velocity)
      */
     template <typename Callback>
-    void onNoteOn(Callback callback);
+    Subscription onNoteOn(Callback callback);
+
+    /** @brief Note On callback for a note range on one channel, see filtered onCC */
+    template <typename Callback>
+    Subscription onNoteOn(uint8_t channel, uint8_t firstNote, uint8_t lastNote,
+                          Callback callback);
 
     /**
      * @brief Register callback for incoming Note Off messages
@@ -211,19 +374,115 @@ public:
      * Callback signature: void(uint8_t channel, uint8_t note, uint8_t velocity)
      */
     template <typename Callback>
-    void onNoteOff(Callback callback);
+    Subscription onNoteOff(Callback callback);
+
+    /** @brief Note Off callback for a note range on one channel, see filtered onCC */
+    template <typename Callback>
+    Subscription onNoteOff(uint8_t channel, uint8_t firstNote, uint8_t lastNote,
+                           Callback callback);
+
+    /**
+     * @brief Register callback for incoming Program Change messages
+     *
+     * Callback signature: void(uint8_t channel, uint8_t program)
+     */
+    template <typename Callback>
+    Subscription onProgramChange(Callback callback);
+
+    /**
+     * @brief Register callback for incoming Pitch Bend messages
+     *
+     * Callback signature: void(uint8_t channel, int16_t value)  // -8192..8191
+     */
+    template <typename Callback>
+    Subscription onPitchBend(Callback callback);
+
+    /**
+     * @brief Register callback for incoming Channel Pressure (aftertouch)
+     *
+     * Callback signature: void(uint8_t channel, uint8_t pressure)
+     */
+    template <typename Callback>
+    Subscription onChannelPressure(Callback callback);
+
+    /**
+     * @brief Register callback for incoming Polyphonic Key Pressure
+     *
+     * Callback signature: void(uint8_t channel, uint8_t note, uint8_t pressure)
+     */
+    template <typename Callback>
+    Subscription onPolyPressure(Callback callback);
+
+    /**
+     * @brief Register callback for Start / Continue / Stop / System Reset
+     *
+     * Callback signature: void(uint8_t status)  // MidiRealtime::START, ...
+     */
+    template <typename Callback>
+    Subscription onTransport(Callback callback);
+
+    /**
+     * @brief Register a realtime fast-lane listener (Clock, transport, Active Sensing)
+     * @param callback Called straight from the USB read loop with the status byte
+     *        and the micros() it was decoded at, no EventBus dispatch
+     * @return Listener id for removeRealtimeListener(), INVALID_REALTIME_LISTENER if full
+     */
+    MidiRealtimeListenerId onRealtime(MidiRealtimeCallback callback);
+    void removeRealtimeListener(MidiRealtimeListenerId id);
+
+    // ===== MIDI CLOCK API - Follow incoming MIDI clock =====
+
+    /**
+     * @brief Register callback for every clock tick while the transport runs
+     * @param callback void(uint32_t tick), tick since Start (24 per quarter note)
+     * @return Listener id for removeClockTickListener(), MidiClock::INVALID_LISTENER if full
+     */
+    MidiClock::ListenerId onClockTick(MidiClock::TickCallback callback);
+    void removeClockTickListener(MidiClock::ListenerId id);
+
+    /** @brief Jitter-filtered tempo of incoming clock, 0 without clock */
+    float getClockBpm() const;
+
+    /** @brief Position inside the current quarter note (0.0-1.0), smooth between ticks */
+    float getBeatPhase() const;
+
+    /** @brief Ticks since Start or the last song position (24 per quarter note) */
+    uint32_t getClockTick() const;
+
+    bool isClockRunning() const;
+
+    /**
+     * @brief micros() at which the next clock tick multiple of ticks is due
+     * @param ticks Quantization grid, 24 = quarter note, 6 = sixteenth
+     * @return 0 without a running clock
+     *
+     * For quantized launches: scheduleNoteOn(nextClockTickUs(24), ...).
+     */
+    uint32_t nextClockTickUs(uint32_t ticks) const;
 
     // ===== ENCODER CONTROL API - Control hardware encoders =====
 
     /**
-     * @brief Reset encoder position to match external value
+     * @brief Sync encoder with an external value (DAW parameter)
      * @param encoderId Encoder input ID
      * @param normalizedValue Value between 0.0 and 1.0
      *
-     * Use case: Sync encoder with DAW parameter value
+     * Follows the encoder's takeover policy: with Jump (default) the encoder
+     * moves to the value; with Pickup / Scale it takes over on the next ticks
+     * (see setEncoderTakeover). Relative encoders always move.
      */
     void setEncoderPosition(EncoderID encoderId, float normalizedValue);
 
+    /**
+     * @brief How the encoder follows values from setEncoderPosition (Absolute mode)
+     * @param takeover Jump, Pickup or Scale (Hardware::EncoderTakeover)
+     *
+     * Pickup and Scale avoid the value jump, and the burst of corrective CCs,
+     * when the encoder and the DAW disagree. Switching to Jump applies the
+     * pending value at once.
+     */
+    void setEncoderTakeover(EncoderID encoderId, Hardware::EncoderTakeover takeover);
+
     /**
      * @brief Configure encoder for discrete value steps
      * @param encoderId Encoder input ID
@@ -242,38 +501,117 @@ public:
      */
     void setEncoderContinuous(EncoderID encoderId);
 
+    /**
+     * @brief Configure velocity-based acceleration (Absolute mode)
+     * @param encoderId Encoder input ID
+     * @param maxMultiplier Ticks of movement per detent at full speed (1 = off)
+     *
+     * Fast spins sweep the whole range in one gesture and emit fewer events.
+     * Uses the default curve from System::Input::ENCODER_ACCEL_*.
+     */
+    void setEncoderAcceleration(
+        EncoderID encoderId, uint8_t maxMultiplier = System::Input::ENCODER_ACCEL_MAX_MULTIPLIER);
+
     // ===== SEND API - MIDI output =====
+    //
+    // traffic picks the USB virtual port (System::Midi::USB_CABLE_*); Auto
+    // keeps feedback, notes and dumps on separate ports on multi-cable builds.
 
     /**
      * @brief Send SysEx message via MIDI out
      * @param data SysEx data buffer
      * @param length Data length in bytes
+     * @param traffic Port, Control for Auto
      */
-    void sendSysEx(const uint8_t* data, size_t length);
+    void sendSysEx(const uint8_t* data, size_t length, MidiTraffic traffic = MidiTraffic::Auto);
+
+    /**
+     * @brief Queue a SysEx message, streamed over the next loops without blocking
+     * @param data SysEx data buffer (F0 ... F7), copied before returning
+     * @param length Data length in bytes
+     * @param onSent Optional callback once the message has been written
+     * @param traffic Port, Bulk for Auto
+     * @return false if the send queue is full (retry later), or data is malformed
+     *         or longer than System::Midi::SYSEX_TX_ARENA_SIZE (logged: use sendSysEx())
+     */
+    bool sendSysExAsync(const uint8_t* data, size_t length, SysExSentCallback onSent = nullptr,
+                        MidiTraffic traffic = MidiTraffic::Auto);
 
     /**
      * @brief Send control change message
      * @param channel MIDI channel (0-15)
      * @param cc Control change number
      * @param value CC value (0-127)
+     * @param traffic Port, Control for Auto
+     *
+     * Other plugins see it through onCC() as a MidiOrigin::Plugin CC; the
+     * sender does not get its own CC back.
+     */
+    void sendCC(uint8_t channel, uint8_t cc, uint8_t value,
+                MidiTraffic traffic = MidiTraffic::Auto);
+
+    /**
+     * @brief Send a block of CCs in one USB submission (page sync, snapshot recall)
+     * @param skipUnchanged Drop CCs already at that value (last value sent)
+     * @return Number of CCs sent
+     */
+    size_t sendCCs(const MidiCCMessage* messages, size_t count, bool skipUnchanged = false);
+
+    /**
+     * @brief Send prebuilt USB-MIDI packets in one USB submission
+     * @return Number of packets sent (SysEx packets are dropped)
+     * @see TeensyUsbMidiOut::sendPackets for the packet layout
      */
-    void sendCC(uint8_t channel, uint8_t cc, uint8_t value);
+    size_t sendMidiPackets(const uint32_t* packets, size_t count);
 
     /**
      * @brief Send Note On message
      * @param channel MIDI channel (0-15)
      * @param note MIDI note number (0-127)
      * @param velocity Note velocity (0-127)
+     * @param traffic Port, Performance for Auto
      */
-    void sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
+    void sendNoteOn(uint8_t channel, uint8_t note, uint8_t velocity,
+                    MidiTraffic traffic = MidiTraffic::Auto);
 
     /**
      * @brief Send Note Off message
      * @param channel MIDI channel (0-15)
      * @param note MIDI note number (0-127)
      * @param velocity Note velocity (0-127)
+     * @param traffic Port, Performance for Auto
      */
-    void sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity);
+    void sendNoteOff(uint8_t channel, uint8_t note, uint8_t velocity,
+                     MidiTraffic traffic = MidiTraffic::Auto);
+
+    /**
+     * @brief Send Note Off for every note still sounding, on all channels
+     */
+    void panic();
+
+    /**
+     * @brief Send a message at a micros() deadline, independent of the main loop
+     * @return false if the schedule is full (System::Memory::MAX_SCHEDULED_MIDI)
+     *
+     * Deadlines already passed are sent right away. Example, 100 ms gate:
+     * sendNoteOn(0, 60, 100); scheduleNoteOff(micros() + 100000, 0, 60);
+     */
+    bool scheduleCC(uint32_t atUs, uint8_t channel, uint8_t cc, uint8_t value);
+    bool scheduleNoteOn(uint32_t atUs, uint8_t channel, uint8_t note, uint8_t velocity);
+    bool scheduleNoteOff(uint32_t atUs, uint8_t channel, uint8_t note, uint8_t velocity = 0);
+
+    /**
+     * @brief Forward incoming MIDI to an output without going through plugins
+     * @param source Input port (MidiPort::USB)
+     * @param destination Output port (MidiPort::USB)
+     * @param channelMask Bit n = channel n
+     * @param typeMask MidiRouter::typeBit() of each message type forwarded
+     * @return Route id, MidiRouter::INVALID_ROUTE on failure
+     */
+    MidiRouter::RouteId addMidiRoute(uint8_t source, uint8_t destination,
+                                     uint16_t channelMask = MidiRouter::ALL_CHANNELS,
+                                     uint16_t typeMask = MidiRouter::ALL_TYPES);
+    void removeMidiRoute(MidiRouter::RouteId id);
 
     // ===== VIEW MANAGEMENT API - Display plugin views =====
 
@@ -286,6 +624,17 @@ public:
      */
     lv_obj_t* getParentContainer();
 
+    /**
+     * @brief Let Core build the view on its first show (IView::create)
+     * @param hibernate Free the view's LVGL tree (IView::destroy) while hidden
+     * @return false if System::UI::MAX_PLUGIN_VIEWS views are registered
+     *
+     * Register views from initialize() and build nothing there: a view that is
+     * never shown never allocates its LVGL objects.
+     */
+    bool registerPluginView(UI::IView& view, bool hibernate = false);
+    void unregisterPluginView(UI::IView& view);
+
     /**
      * @brief Show a plugin view (switches to pluginScreen_)
      * @param view Reference to IView implementation (plugin keeps ownership)
@@ -297,6 +646,171 @@ public:
      */
     void hidePluginView();
 
+    /**
+     * @brief LVGL heap usage, fps, render and flush times
+     *
+     * Read it periodically from a plugin, or stream it to host tooling
+     * with sendUiStats().
+     */
+    DisplayStats getUiStats() const;
+
+    /**
+     * @brief Send getUiStats() as SysEx (System::Midi::SYSEX_CMD_UI_STATS)
+     */
+    void sendUiStats();
+
+    /**
+     * @brief Cycles spent in a plugin's update() and its callbacks, and the
+     *        heap / LVGL pool growth across its initialize()
+     * @param integrationId From IntegrationRegisteredEvent (registration order)
+     */
+    const PluginAccounting::Report& getPluginStats(uint8_t integrationId) const;
+
+    /**
+     * @brief Memory from the calling plugin's arena, given back with the plugin
+     * @param size Bytes
+     * @param alignment Power of two
+     *
+     * Call it from the plugin (constructor, initialize(), update() or its
+     * callbacks): the arena is that of the current owner. Outside a plugin,
+     * or once the arena is full, the memory comes from the heap instead.
+     * Nothing is destroyed on release: the plugin destroys what it built.
+     */
+    void* allocate(size_t size, size_t alignment = alignof(max_align_t));
+    void deallocate(void* pointer, size_t size);
+
+    /**
+     * @brief allocate() as a standard allocator, bound to the calling plugin
+     *
+     * @code
+     * std::vector<Step, PluginArena::Allocator<Step>> steps_{api.allocator<Step>()};
+     * @endcode
+     */
+    template <typename T>
+    PluginArena::Allocator<T> allocator() const {
+        return PluginArena::Allocator<T>(PluginAccounting::currentOwner());
+    }
+
+    /** @brief Capacity, use and overflows of a plugin's arena */
+    const PluginArena::Stats& getPluginArenaStats(uint8_t integrationId) const;
+
+    /**
+     * @brief Send getPluginStats() of every plugin slot that ran as SysEx
+     *        (System::Midi::SYSEX_CMD_PLUGIN_STATS)
+     */
+    void sendPluginStats();
+
+    /**
+     * @brief Main loop passes over System::Loop::PASS_BUDGET_US since boot
+     */
+    uint32_t getLoopOverrunCount() const;
+
+    /**
+     * @brief A recent over-budget pass and the stage that took longest in it
+     * @param age 0 = most recent, up to System::Memory::LOOP_OVERRUN_TRACES - 1
+     * @return nullptr past the traces kept
+     */
+    const LoopMonitor::Trace* getLoopOverrun(uint8_t age = 0) const;
+
+    /**
+     * @brief Let the panel driver adjust its diff gap and vsync spacing from
+     *        measured diff overflows and tearing (see System::Display)
+     *
+     * The chosen values and the driver figures are in getUiStats().
+     */
+    void setDisplayAutoTune(bool enabled);
+
+    /**
+     * @brief Toggle the display debug overlay at runtime
+     *
+     * Paints the invalidated areas of the last frames as a fading heatmap
+     * and shows render / flush times and fps, to find widgets that redraw too
+     * much of the screen. Bind it to a button combo during development.
+     */
+    void setDebugOverlay(bool enabled);
+    bool isDebugOverlayEnabled() const;
+
+    // ===== PARAMETER API - One shared copy of parameter state =====
+
+    /**
+     * @brief Core parameter table: values, names, display text, discrete counts
+     *
+     * Write host and user changes here instead of pushing them into widgets.
+     * Bound widgets, encoders and CCs follow once per loop, for the fields
+     * that changed only (ParameterSync). The host can also write a whole page
+     * in one SysEx (System::Midi::SYSEX_CMD_PAGE_SYNC), handled here in core;
+     * ids the plugin has not added are added.
+     */
+    ParameterStore& parameters() {
+        return parameters_;
+    }
+
+    /** @brief Widget showing a parameter (nullptr unbinds) */
+    void bindParameterWidget(ParameterStore::Index index, IParameterWidget* widget);
+
+    /** @brief Encoder whose position and step count follow a parameter */
+    void bindParameterEncoder(ParameterStore::Index index, EncoderID encoder);
+
+    /** @brief CC sent when the parameter changes locally (not for host changes) */
+    void bindParameterCC(ParameterStore::Index index, uint8_t channel, uint8_t cc);
+
+    /** @brief Forget every parameter binding */
+    void clearParameterBindings();
+
+    /** @brief Push pending parameter changes (called by PluginManager each loop) */
+    void syncParameters();
+
+    /** @brief Page sync messages the host sent that failed to parse (dropped whole) */
+    uint32_t getPageSyncErrors() const {
+        return pageSyncErrors_;
+    }
+
+    // ===== PRESET API - Snapshots in program flash =====
+
+    /**
+     * @brief Store absolute encoder positions and steps, parameter values and
+     *        MIDI mappings in a slot (0 to System::Storage::PRESET_SLOTS - 1)
+     *
+     * Flash erase and write stall the loop for milliseconds: save on a user
+     * action, not while playing. Recall only reads.
+     */
+    bool savePreset(uint8_t slot);
+
+    /**
+     * @brief Apply a stored snapshot at once
+     *
+     * Encoders are reset in one pass without events, mappings replaced, and
+     * parameter values written to the ParameterStore: bound widgets, encoders
+     * and CCs follow in the next syncParameters(), and the CCs leave in the
+     * loop's single USB flush. Parameters the snapshot names but the plugin
+     * has not added are skipped.
+     *
+     * @return false for an empty or invalid slot (nothing changed)
+     */
+    bool recallPreset(uint8_t slot);
+
+    bool hasPreset(uint8_t slot) {
+        return presets_.exists(slot);
+    }
+
+    bool deletePreset(uint8_t slot) {
+        return presets_.remove(slot);
+    }
+
+    // ===== TASK API - Multi-step work without blocking the loop =====
+
+    /**
+     * @brief Run a Task (core/util/Task.hpp) one step per loop until it is done
+     * @param task Plugin-owned task, restarted from TASK_BEGIN
+     * @return false if already running or System::Memory::MAX_SCHEDULED_TASKS run
+     *
+     * Steps run after the plugins' update(), every loop. Cancel the plugin's
+     * tasks in cleanup().
+     */
+    bool startTask(Task& task);
+    void cancelTask(Task& task);
+    bool isTaskRunning(const Task& task) const;
+
     // ===== LOGGING API - Debug output =====
 
     /**
@@ -318,9 +832,44 @@ public:
 private:
     InputBinding& bindingService_;
     IEventBus& eventBus_;
+    TeensyUsbMidiIn& midiIn_;
+    MidiClock& clock_;
     TeensyUsbMidiOut& midiOut_;
     EncoderController& encoders_;
     ViewManager& viewManager_;
+    TaskRunner& tasks_;
+    MidiMapper& midiMapper_;
+
+    FlashPresetStore presets_;
+    MidiDispatchIndex midiIndex_;
+    bool midiIndexListening_[MidiDispatchIndex::KIND_COUNT] = {};
+    SysExRouter sysExRouter_;
+    bool sysExRouterListening_ = false;
+    ParameterStore parameters_;
+    ParameterSync parameterSync_;
+    Subscription pageSyncSub_;  // After sysExRouter_: removed from it first
+    uint32_t pageSyncErrors_ = 0;
+
+    /** @brief Write a page sync message (System::Midi::SYSEX_CMD_PAGE_SYNC) to parameters_ */
+    void applyPageSync(const uint8_t* data, uint16_t length);
+
+    /** @brief EventBus subscription to one event class, as an owning handle */
+    template <typename EventT, typename Callback>
+    Subscription subscribe(Callback callback);
+
+    /** @brief EncoderController frame events on while onEncoderFrame subscriptions exist */
+    void retainEncoderFrames();
+    void releaseEncoderFrames(SubscriptionId id);
+    uint8_t encoderFrameSubscribers_ = 0;
+
+    /** @brief Add to sysExRouter_, subscribing its bus listener on first use */
+    Subscription addSysExHandler(const uint8_t* prefix, uint8_t prefixLength,
+                                 SysExRouter::Handler handler);
+
+    /** @brief Add to midiIndex_, subscribing its bus listener for that kind on first use */
+    Subscription addMidiFilter(MidiDispatchIndex::Kind kind, uint8_t channel, uint8_t first,
+                               uint8_t last, MidiDispatchIndex::Callback callback,
+                               uint8_t origins);
 };
 
 // ===== TEMPLATE IMPLEMENTATIONS =====
@@ -329,34 +878,121 @@ private:
 #include "core/event/IEventBus.hpp"
 #include "core/event/UnifiedEventTypes.hpp"
 
+template <typename EventT, typename Callback>
+Subscription ControllerAPI::subscribe(Callback callback) {
+    return Subscription::fromBus(eventBus_, eventBus_.on<EventT>(std::move(callback)));
+}
+
 template <typename Callback>
-void ControllerAPI::onSysEx(Callback callback) {
-    eventBus_.on(EventCategory::MIDI, MidiEvent::SysEx, [callback](const Event& e) {
-        auto& sysex = static_cast<const SysExEvent&>(e);
+Subscription ControllerAPI::onEncoderFrame(Callback callback) {
+    const SubscriptionId id = eventBus_.on<EncoderFrameEvent>(std::move(callback));
+    if (id == 0) return Subscription();
+    retainEncoderFrames();
+    return Subscription(this, id, [](void* owner, uint16_t busId) {
+        auto* api = static_cast<ControllerAPI*>(owner);
+        api->releaseEncoderFrames(static_cast<SubscriptionId>(busId));
+    });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onSysEx(Callback callback) {
+    return subscribe<SysExEvent>([callback](const SysExEvent& sysex) {
         callback(sysex.data, sysex.length);
     });
 }
 
 template <typename Callback>
-void ControllerAPI::onCC(Callback callback) {
-    eventBus_.on(EventCategory::MIDI, MidiEvent::CC, [callback](const Event& e) {
-        auto& cc = static_cast<const MidiCCEvent&>(e);
-        callback(cc.channel, cc.controller, cc.value);
+Subscription ControllerAPI::onSysEx(const uint8_t* prefix, uint8_t prefixLength,
+                                    Callback callback) {
+    return addSysExHandler(prefix, prefixLength, callback);
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onSysExChunk(Callback callback) {
+    return subscribe<SysExChunkEvent>([callback](const SysExChunkEvent& chunk) {
+        callback(chunk.data, chunk.length, chunk.offset, chunk.complete);
     });
 }
 
 template <typename Callback>
-void ControllerAPI::onNoteOn(Callback callback) {
-    eventBus_.on(EventCategory::MIDI, MidiEvent::NoteOn, [callback](const Event& e) {
-        auto& note = static_cast<const MidiNoteOnEvent&>(e);
+Subscription ControllerAPI::onCC(Callback callback, uint8_t origins) {
+    return subscribe<MidiCCEvent>([callback, origins](const MidiCCEvent& cc) {
+        // Runs with its owner current: a plugin's own sendCC() is not echoed back to it
+        if (cc.origin == MidiOrigin::Plugin && cc.source == PluginAccounting::currentOwner()) {
+            return;
+        }
+        if (origins & midiOriginBit(cc.origin)) {
+            callback(cc.channel, cc.controller, cc.value);
+        }
+    });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onCC(uint8_t channel, uint8_t firstController,
+                                 uint8_t lastController, Callback callback, uint8_t origins) {
+    return addMidiFilter(MidiDispatchIndex::CC, channel, firstController, lastController,
+                         callback, origins);
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onProgramChange(Callback callback) {
+    return subscribe<MidiProgramChangeEvent>([callback](const MidiProgramChangeEvent& pc) {
+        callback(pc.channel, pc.program);
+    });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onPitchBend(Callback callback) {
+    return subscribe<MidiPitchBendEvent>([callback](const MidiPitchBendEvent& bend) {
+        callback(bend.channel, bend.value);
+    });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onChannelPressure(Callback callback) {
+    return subscribe<MidiChannelPressureEvent>(
+        [callback](const MidiChannelPressureEvent& pressure) {
+            callback(pressure.channel, pressure.pressure);
+        });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onPolyPressure(Callback callback) {
+    return subscribe<MidiPolyPressureEvent>([callback](const MidiPolyPressureEvent& pressure) {
+        callback(pressure.channel, pressure.note, pressure.pressure);
+    });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onTransport(Callback callback) {
+    return subscribe<MidiTransportEvent>(
+        [callback](const MidiTransportEvent& transport) { callback(transport.status); });
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onNoteOn(Callback callback) {
+    return subscribe<MidiNoteOnEvent>([callback](const MidiNoteOnEvent& note) {
         callback(note.channel, note.note, note.velocity);
     });
 }
 
 template <typename Callback>
-void ControllerAPI::onNoteOff(Callback callback) {
-    eventBus_.on(EventCategory::MIDI, MidiEvent::NoteOff, [callback](const Event& e) {
-        auto& note = static_cast<const MidiNoteOffEvent&>(e);
+Subscription ControllerAPI::onNoteOn(uint8_t channel, uint8_t firstNote, uint8_t lastNote,
+                                     Callback callback) {
+    return addMidiFilter(MidiDispatchIndex::NOTE_ON, channel, firstNote, lastNote, callback,
+                         MIDI_ORIGIN_ALL);
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onNoteOff(uint8_t channel, uint8_t firstNote, uint8_t lastNote,
+                                      Callback callback) {
+    return addMidiFilter(MidiDispatchIndex::NOTE_OFF, channel, firstNote, lastNote, callback,
+                         MIDI_ORIGIN_ALL);
+}
+
+template <typename Callback>
+Subscription ControllerAPI::onNoteOff(Callback callback) {
+    return subscribe<MidiNoteOffEvent>([callback](const MidiNoteOffEvent& note) {
         callback(note.channel, note.note, note.velocity);
     });
 }
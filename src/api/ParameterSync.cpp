@@ -0,0 +1,108 @@
+#include "ParameterSync.hpp"
+
+#include <Arduino.h>
+
+#include "adapter/input/encoder/EncoderController.hpp"
+#include "core/interface/midi/MidiOutput.hpp"
+#include "widget/IParameterWidget.hpp"
+
+ParameterSync::ParameterSync(ParameterStore& store, EncoderController& encoders,
+                             MidiOutput& midiOut)
+    : store_(store), encoders_(encoders), midiOut_(midiOut) {}
+
+void ParameterSync::bindWidget(Index index, IParameterWidget* widget) {
+    if (index >= bindings_.size()) return;
+    Binding& binding = bindings_[index];
+    widgetUpdates_.unbind(binding.slot);
+    binding.widget = widget;
+    binding.slot = widgetUpdates_.bind(widget);
+    if (widget) {
+        store_.markAllDirty();  // Cheap: only bound fields are pushed, once
+    }
+}
+
+void ParameterSync::bindEncoder(Index index, EncoderID encoder) {
+    if (index >= bindings_.size()) return;
+    bindings_[index].encoder = encoder;
+    bindings_[index].hasEncoder = true;
+    store_.markAllDirty();
+}
+
+void ParameterSync::unbindEncoder(Index index) {
+    if (index < bindings_.size()) bindings_[index].hasEncoder = false;
+}
+
+void ParameterSync::bindCC(Index index, uint8_t channel, uint8_t cc) {
+    if (index >= bindings_.size()) return;
+    bindings_[index].channel = channel;
+    bindings_[index].cc = cc;
+}
+
+void ParameterSync::unbindCC(Index index) {
+    if (index < bindings_.size()) bindings_[index].cc = NO_CC;
+}
+
+void ParameterSync::clear() {
+    for (const Binding& binding : bindings_) {
+        widgetUpdates_.unbind(binding.slot);
+    }
+    bindings_.fill(Binding());
+}
+
+bool ParameterSync::sync() {
+    if (!store_.hasDirty()) return false;
+    bool widgetsUpdated = false;
+    store_.consumeDirty([this, &widgetsUpdated](Index index,
+                                                const ParameterStore::Parameter& param,
+                                                uint8_t dirty) {
+        widgetsUpdated |= apply(index, param, dirty);
+    });
+    return widgetsUpdated;
+}
+
+bool ParameterSync::apply(Index index, const ParameterStore::Parameter& param, uint8_t dirty) {
+    const Binding& binding = bindings_[index];
+    bool widgetUpdated = false;
+
+    if (binding.widget) {
+        if (dirty & ParameterStore::DIRTY_NAME) {
+            binding.widget->setName(String(param.name.c_str()));
+        }
+        if (dirty & (ParameterStore::DIRTY_VALUE | ParameterStore::DIRTY_DISPLAY)) {
+            if (binding.slot != ParameterUpdateBatch::INVALID_SLOT) {
+                // Applied at the next frame start, with the latest value only
+                if (param.display.empty()) {
+                    widgetUpdates_.setValue(binding.slot, param.value);
+                } else {
+                    widgetUpdates_.setValueWithDisplay(binding.slot, param.value,
+                                                       param.display.c_str());
+                }
+            } else if (param.display.empty()) {
+                binding.widget->setValue(param.value);
+            } else {
+                binding.widget->setValueWithDisplay(param.value, param.display.c_str());
+            }
+        }
+        widgetUpdated = (dirty & (ParameterStore::DIRTY_NAME | ParameterStore::DIRTY_VALUE |
+                                  ParameterStore::DIRTY_DISPLAY)) != 0;
+    }
+
+    if (binding.hasEncoder) {
+        if (dirty & ParameterStore::DIRTY_DISCRETE) {
+            if (param.discreteCount > 1) {
+                encoders_.setDiscreteSteps(binding.encoder, param.discreteCount);
+            } else {
+                encoders_.setContinuous(binding.encoder);
+            }
+        }
+        if (dirty & (ParameterStore::DIRTY_ENCODER | ParameterStore::DIRTY_DISCRETE)) {
+            encoders_.syncEncoder(binding.encoder, param.value);  // Takeover policy applies
+        }
+    }
+
+    if (binding.cc != NO_CC && (dirty & ParameterStore::DIRTY_MIDI)) {
+        const uint8_t value = static_cast<uint8_t>(param.value * 127.0f + 0.5f);
+        midiOut_.sendControlChange(binding.channel, binding.cc, value);
+    }
+    return widgetUpdated;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <etl/array.h>
+
+#include <stdint.h>
+
+#include "config/InputID.hpp"
+#include "config/System.hpp"
+#include "core/param/ParameterStore.hpp"
+#include "widget/ParameterUpdateBatch.hpp"
+
+class EncoderController;
+class IParameterWidget;
+class MidiOutput;
+
+/**
+ * @brief Pushes ParameterStore changes to widgets, encoders and MIDI out
+ *
+ * Each parameter can be bound to a widget, an encoder and a CC. sync() runs
+ * once per loop (PluginManager) and touches only the parameters and fields
+ * that changed since the previous call: a page resent unchanged by the host
+ * costs nothing here, and a value change is one widget call, one encoder
+ * reset and one CC at most, however many times it was set in between.
+ *
+ * Widget values go through a ParameterUpdateBatch: a host streaming a
+ * parameter faster than the frame rate reaches its widget once per frame.
+ * Past System::UI::MAX_PARAMETER_BINDINGS bound widgets, the others are
+ * updated from sync() directly.
+ */
+class ParameterSync {
+public:
+    using Index = ParameterStore::Index;
+    static constexpr uint8_t NO_CC = 0xFF;
+
+    ParameterSync(ParameterStore& store, EncoderController& encoders, MidiOutput& midiOut);
+
+    /** @param widget nullptr unbinds; the widget gets every field on the next sync() */
+    void bindWidget(Index index, IParameterWidget* widget);
+    void bindEncoder(Index index, EncoderID encoder);
+    void unbindEncoder(Index index);
+    void bindCC(Index index, uint8_t channel, uint8_t cc);
+    void unbindCC(Index index);
+
+    /** @brief Drop every binding (e.g. the plugin's page is torn down) */
+    void clear();
+
+    /** @return true if a bound widget was updated (the display should leave idle mode) */
+    bool sync();
+
+private:
+    struct Binding {
+        IParameterWidget* widget = nullptr;
+        ParameterUpdateBatch::Slot slot = ParameterUpdateBatch::INVALID_SLOT;
+        EncoderID encoder = EncoderID::MACRO_1;
+        bool hasEncoder = false;
+        uint8_t channel = 0;
+        uint8_t cc = NO_CC;
+    };
+
+    /** @return true if the widget was touched */
+    bool apply(Index index, const ParameterStore::Parameter& param, uint8_t dirty);
+
+    ParameterStore& store_;
+    EncoderController& encoders_;
+    MidiOutput& midiOut_;
+    etl::array<Binding, System::Memory::MAX_PARAMETERS> bindings_;
+    ParameterUpdateBatch widgetUpdates_;
+};
@@ -0,0 +1,252 @@
+#include "EventRecorder.hpp"
+
+#ifdef EVENT_RECORDER
+
+#include <SD.h>
+
+#include <string.h>
+
+#include "core/event/Events.hpp"
+
+namespace {
+static_assert(sizeof(EventRecorder::Record) == 12, "Records are 12 bytes on SD");
+
+EXTMEM EventRecorder::Record records[System::Benchmark::RECORD_CAPACITY];
+
+struct FileHeader {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t count;
+};
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+}  // namespace
+
+EventRecorder::EventRecorder(IEventBus& eventBus) : eventBus_(eventBus) {}
+
+EventRecorder::~EventRecorder() {
+    unsubscribe();
+}
+
+void EventRecorder::startRecording() {
+    stop();
+    count_ = 0;
+    dropped_ = 0;
+    lastOffsetUs_ = 0;
+    startUs_ = micros();
+
+    subs_[0] = eventBus_.on<EncoderChangedEvent>([this](const EncoderChangedEvent& event) {
+        const uint8_t id = static_cast<uint8_t>(event.encoderId);
+        if (event.delta != 0) {
+            const int16_t delta = constrain(event.delta, int16_t(-128), int16_t(127));
+            record({0, Kind::RELATIVE_ENCODER, id, static_cast<uint8_t>(delta), 0,
+                    floatBits(event.normalizedValue)},
+                   event.timestampUs);
+        } else {
+            record({0, Kind::ENCODER, id, 0, 0, event.value.raw}, event.timestampUs);
+        }
+    });
+    subs_[1] = eventBus_.on<ButtonPressEvent>([this](const ButtonPressEvent& event) {
+        record({0, Kind::BUTTON, static_cast<uint8_t>(event.buttonId), 0, 1, 0},
+               event.timestampUs);
+    });
+    subs_[2] = eventBus_.on<ButtonReleaseEvent>([this](const ButtonReleaseEvent& event) {
+        record({0, Kind::BUTTON, static_cast<uint8_t>(event.buttonId), 0, 0, 0},
+               event.timestampUs);
+    });
+    subs_[3] = eventBus_.on<MidiCCEvent>([this](const MidiCCEvent& event) {
+        // Local CCs come from the recorded input: the replay produces them again
+        if (event.origin != MidiOrigin::Host) return;
+        record({0, Kind::CC, event.channel, event.controller, event.value, 0}, 0);
+    });
+    subs_[4] = eventBus_.on<MidiNoteOnEvent>([this](const MidiNoteOnEvent& event) {
+        record({0, Kind::NOTE_ON, event.channel, event.note, event.velocity, 0}, 0);
+    });
+    subs_[5] = eventBus_.on<MidiNoteOffEvent>([this](const MidiNoteOffEvent& event) {
+        record({0, Kind::NOTE_OFF, event.channel, event.note, event.velocity, 0}, 0);
+    });
+
+    state_ = State::RECORDING;
+    Serial.println("[Recorder] Recording");
+}
+
+bool EventRecorder::startReplay(uint8_t speed) {
+    stop();
+    if (count_ == 0) {
+        Serial.println("[Recorder] Nothing recorded");
+        return false;
+    }
+
+    next_ = 0;
+    speed_ = speed;
+    startUs_ = micros();
+    state_ = State::REPLAYING;
+    Serial.printf("[Recorder] Replaying %u events, speed x%u\n", static_cast<unsigned>(count_),
+                  static_cast<unsigned>(speed));
+    return true;
+}
+
+void EventRecorder::stop() {
+    if (state_ == State::RECORDING) {
+        unsubscribe();
+        Serial.printf("[Recorder] Recorded %u events in %lu ms (%lu dropped)\n",
+                      static_cast<unsigned>(count_),
+                      static_cast<unsigned long>(lastOffsetUs_ / 1000),
+                      static_cast<unsigned long>(dropped_));
+    }
+    state_ = State::IDLE;
+}
+
+bool EventRecorder::update() {
+    if (state_ != State::REPLAYING) return false;
+
+    // 64-bit: accelerated time overtakes the 32-bit micros() range much sooner
+    const uint64_t elapsedUs = static_cast<uint64_t>(micros() - startUs_) * speed_;
+    for (uint8_t i = 0; i < System::Benchmark::REPLAY_EVENTS_PER_PASS && next_ < count_; ++i) {
+        const Record& next = records[next_];
+        if (speed_ != 0 && next.offsetUs > elapsedUs) break;
+        ++next_;
+        replay(next);  // Subscribers may call stop(): next_ is already past the record
+        if (state_ != State::REPLAYING) return false;
+    }
+
+    if (next_ < count_) return false;
+
+    state_ = State::IDLE;
+    Serial.printf("[Recorder] Replay done in %lu ms\n",
+                  static_cast<unsigned long>((micros() - startUs_) / 1000));
+    return true;
+}
+
+bool EventRecorder::save(const char* path) const {
+    if (!SD.begin(BUILTIN_SDCARD)) {
+        Serial.println("[Recorder] ERROR: No SD card");
+        return false;
+    }
+
+    SD.remove(path);
+    File file = SD.open(path, FILE_WRITE);
+    if (!file) {
+        Serial.printf("[Recorder] ERROR: Cannot create %s\n", path);
+        return false;
+    }
+
+    const FileHeader header = {FILE_MAGIC, FILE_VERSION, {0, 0, 0},
+                               static_cast<uint32_t>(count_)};
+    const size_t bytes = count_ * sizeof(Record);
+    const bool ok = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) ==
+                        sizeof(header) &&
+                    file.write(reinterpret_cast<const uint8_t*>(records), bytes) == bytes;
+    file.close();
+
+    Serial.printf("[Recorder] %s %u events to %s\n", ok ? "Saved" : "ERROR: Failed to save",
+                  static_cast<unsigned>(count_), path);
+    return ok;
+}
+
+bool EventRecorder::load(const char* path) {
+    stop();
+    count_ = 0;
+
+    if (!SD.begin(BUILTIN_SDCARD)) {
+        Serial.println("[Recorder] ERROR: No SD card");
+        return false;
+    }
+
+    File file = SD.open(path, FILE_READ);
+    if (!file) {
+        Serial.printf("[Recorder] ERROR: Cannot open %s\n", path);
+        return false;
+    }
+
+    FileHeader header;
+    bool ok = file.read(&header, sizeof(header)) == sizeof(header) &&
+              header.magic == FILE_MAGIC && header.version == FILE_VERSION &&
+              header.count <= System::Benchmark::RECORD_CAPACITY;
+    if (ok) {
+        const size_t bytes = header.count * sizeof(Record);
+        ok = file.read(records, bytes) == static_cast<int>(bytes);
+    }
+    file.close();
+
+    if (!ok) {
+        Serial.printf("[Recorder] ERROR: %s is not a valid recording\n", path);
+        return false;
+    }
+    count_ = header.count;
+    Serial.printf("[Recorder] Loaded %u events from %s\n", static_cast<unsigned>(count_), path);
+    return true;
+}
+
+void EventRecorder::record(const Record& record, uint32_t timestampUs) {
+    if (count_ >= System::Benchmark::RECORD_CAPACITY) {
+        ++dropped_;
+        return;
+    }
+
+    // Edge timestamps can predate the last event dispatched: keep offsets in order
+    uint32_t offsetUs = (timestampUs != 0 ? timestampUs : micros()) - startUs_;
+    if (static_cast<int32_t>(offsetUs - lastOffsetUs_) < 0) {
+        offsetUs = lastOffsetUs_;
+    }
+    lastOffsetUs_ = offsetUs;
+
+    records[count_] = record;
+    records[count_].offsetUs = offsetUs;
+    ++count_;
+}
+
+void EventRecorder::replay(const Record& record) {
+    const uint32_t nowUs = micros();
+    switch (record.kind) {
+        case Kind::ENCODER:
+            eventBus_.emit(EncoderChangedEvent(static_cast<EncoderID>(record.id),
+                                               UNorm16{static_cast<uint16_t>(record.value)},
+                                               nowUs));
+            break;
+        case Kind::RELATIVE_ENCODER:
+            eventBus_.emit(EncoderChangedEvent(static_cast<EncoderID>(record.id),
+                                               bitsFloat(record.value), nowUs,
+                                               static_cast<int8_t>(record.data1)));
+            break;
+        case Kind::BUTTON:
+            if (record.data2) {
+                eventBus_.emit(ButtonPressEvent(static_cast<ButtonID>(record.id), true, nowUs));
+            } else {
+                eventBus_.emit(ButtonReleaseEvent(static_cast<ButtonID>(record.id), nowUs));
+            }
+            break;
+        case Kind::CC:
+            eventBus_.emit(
+                MidiCCEvent(record.id, record.data1, record.data2, 0, MidiOrigin::Host));
+            break;
+        case Kind::NOTE_ON:
+            eventBus_.emit(MidiNoteOnEvent(record.id, record.data1, record.data2));
+            break;
+        case Kind::NOTE_OFF:
+            eventBus_.emit(MidiNoteOffEvent(record.id, record.data1, record.data2));
+            break;
+    }
+}
+
+void EventRecorder::unsubscribe() {
+    for (SubscriptionId& sub : subs_) {
+        if (sub != 0) {
+            eventBus_.off(sub);
+            sub = 0;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#pragma once
+
+#ifdef EVENT_RECORDER
+
+#include <Arduino.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/event/IEventBus.hpp"
+
+/**
+ * @brief Records a live session from the EventBus and replays it (env:record)
+ *
+ * Recording keeps the input events (encoders, buttons) and the MIDI the host
+ * sent (CC, notes) as 12-byte records timed from the start, in a PSRAM
+ * buffer of System::Benchmark::RECORD_CAPACITY records. The MIDI the
+ * controller sends is not recorded: MidiMapper and the plugins produce it
+ * again from the replayed input.
+ *
+ * Replay emits the records back at their original time, or speed times
+ * faster, while MidiStudioApp leaves the encoder and button polling out.
+ * save() / load() keep a session on the SD card, so one recording can be
+ * replayed against each firmware build and the loop times compared under
+ * the same workload.
+ */
+class EventRecorder {
+public:
+    enum class State : uint8_t { IDLE, RECORDING, REPLAYING };
+
+    explicit EventRecorder(IEventBus& eventBus);
+    ~EventRecorder();
+
+    /** @brief Forget the current recording and start a new one */
+    void startRecording();
+
+    /**
+     * @param speed 1 = original timing, N = N times faster, 0 = as fast as the
+     *        loop runs (System::Benchmark::REPLAY_EVENTS_PER_PASS a pass)
+     * @return false if nothing is recorded
+     */
+    bool startReplay(uint8_t speed = 1);
+
+    /** @brief End the recording or the replay */
+    void stop();
+
+    /** @brief Emit the records that are due (once per loop) @return true when the replay ends */
+    bool update();
+
+    State state() const {
+        return state_;
+    }
+
+    bool replaying() const {
+        return state_ == State::REPLAYING;
+    }
+
+    size_t size() const {
+        return count_;
+    }
+
+    /** @brief Events left out of the recording because the buffer was full */
+    uint32_t dropped() const {
+        return dropped_;
+    }
+
+    /** @brief Write the recording to the SD card @return false on a card or file error */
+    bool save(const char* path = System::Benchmark::RECORD_FILE) const;
+
+    /** @brief Read a recording back @return false (recording cleared) if invalid */
+    bool load(const char* path = System::Benchmark::RECORD_FILE);
+
+    enum class Kind : uint8_t {
+        ENCODER,           // value: UNorm16 raw
+        RELATIVE_ENCODER,  // value: position (float bits), data1: detents (int8)
+        BUTTON,            // data2: pressed
+        CC,
+        NOTE_ON,
+        NOTE_OFF
+    };
+
+    struct Record {
+        uint32_t offsetUs;  // Since the recording started
+        Kind kind;
+        uint8_t id;     // Encoder or button id, MIDI channel
+        uint8_t data1;  // MIDI controller or note
+        uint8_t data2;  // MIDI value or velocity
+        uint32_t value;
+    };
+
+private:
+    static constexpr uint32_t FILE_MAGIC = 0x4D535243;  // "MSRC"
+    static constexpr uint8_t FILE_VERSION = 1;
+
+    void record(const Record& record, uint32_t timestampUs);
+    void replay(const Record& record);
+    void unsubscribe();
+
+    IEventBus& eventBus_;
+    SubscriptionId subs_[6] = {};
+
+    State state_ = State::IDLE;
+    size_t count_ = 0;
+    size_t next_ = 0;  // Next record to replay
+    uint32_t dropped_ = 0;
+    uint32_t startUs_ = 0;
+    uint32_t lastOffsetUs_ = 0;
+    uint8_t speed_ = 1;
+};
+
+#endif
@@ -0,0 +1,150 @@
+#include "LatencyBenchmark.hpp"
+
+#ifdef LATENCY_BENCHMARK
+
+#include <algorithm>
+
+#include "adapter/input/encoder/EncoderController.hpp"
+#include "adapter/midi/TeensyUsbMidiOut.hpp"
+#include "config/InputID.hpp"
+#include "core/event/UnifiedEventTypes.hpp"
+
+LatencyBenchmark* LatencyBenchmark::instance_ = nullptr;
+
+LatencyBenchmark::LatencyBenchmark(EncoderController& encoders, TeensyUsbMidiOut& midiOut,
+                                   IEventBus& eventBus)
+    : encoders_(encoders), midiOut_(midiOut), eventBus_(eventBus) {
+    for (int8_t& direction : directions_) {
+        direction = 1;
+    }
+
+    encoderSub_ = eventBus_.on(EventCategory::Input, InputEvent::EncoderChanged,
+                               [this](const Event&) { ++encoderEvents_; });
+
+    midiOut_.setLatencySink([this](uint32_t latencyUs) {
+        ++midiMessages_;
+        if (phase_ == Phase::LATENCY && !samples_.full()) {
+            samples_.push_back(latencyUs);
+        }
+    });
+
+    instance_ = this;
+    phaseStartMs_ = millis();
+}
+
+LatencyBenchmark::~LatencyBenchmark() {
+    stopTicks();
+    midiOut_.setLatencySink(nullptr);
+    eventBus_.off(encoderSub_);
+    if (instance_ == this) {
+        instance_ = nullptr;
+    }
+}
+
+void LatencyBenchmark::update() {
+    const uint32_t nowMs = millis();
+
+    if (!timerRunning_ && phase_ != Phase::WAITING) {
+        const uint32_t nowUs = micros();
+        if (nowUs - lastLoopTickUs_ >= tickUs_) {
+            lastLoopTickUs_ = nowUs;
+            noInterrupts();
+            tick();
+            interrupts();
+        }
+    }
+
+    switch (phase_) {
+        case Phase::WAITING:
+            if (nowMs - phaseStartMs_ >= waitMs_) {
+                samples_.clear();
+                startPhase(Phase::LATENCY, System::Benchmark::LATENCY_TICK_US);
+            }
+            break;
+
+        case Phase::LATENCY:
+            if (ticks_ >= System::Benchmark::LATENCY_SAMPLES) {
+                stopTicks();
+                reportLatency();
+                startPhase(Phase::THROUGHPUT, System::Benchmark::THROUGHPUT_TICK_US);
+            }
+            break;
+
+        case Phase::THROUGHPUT:
+            if (nowMs - phaseStartMs_ >= System::Benchmark::THROUGHPUT_DURATION_MS) {
+                stopTicks();
+                reportThroughput(nowMs - phaseStartMs_);
+                phase_ = Phase::WAITING;
+                phaseStartMs_ = nowMs;
+                waitMs_ = System::Benchmark::REPEAT_INTERVAL_MS;
+            }
+            break;
+    }
+}
+
+void LatencyBenchmark::tickIsr() {
+    if (instance_) {
+        instance_->tick();
+    }
+}
+
+void LatencyBenchmark::tick() {
+    // Latency runs stay on one encoder so the rate limiter never holds a tick
+    const uint8_t index = phase_ == Phase::LATENCY ? 0 : nextEncoder_;
+    nextEncoder_ = static_cast<uint8_t>((nextEncoder_ + 1) % ENCODER_ID_COUNT);
+
+    // Back and forth: the value never sticks at an end of the range
+    int8_t& direction = directions_[index];
+    encoders_.injectTicks(ENCODER_IDS[index], direction);
+    direction = static_cast<int8_t>(-direction);
+    ticks_ = ticks_ + 1;
+}
+
+void LatencyBenchmark::startPhase(Phase phase, uint32_t tickUs) {
+    phase_ = phase;
+    phaseStartMs_ = millis();
+    tickUs_ = tickUs;
+    ticks_ = 0;
+    encoderEvents_ = 0;
+    midiMessages_ = 0;
+
+    timerRunning_ = timer_.begin(tickIsr, tickUs);
+    if (!timerRunning_) {
+        Serial.println("[Benchmark] No IntervalTimer free - ticking from the main loop");
+    }
+}
+
+void LatencyBenchmark::stopTicks() {
+    if (timerRunning_) {
+        timer_.end();
+        timerRunning_ = false;
+    }
+}
+
+void LatencyBenchmark::reportLatency() {
+    if (samples_.empty()) {
+        Serial.println("[Benchmark] latency: no MIDI out (check the encoder mappings)");
+        return;
+    }
+
+    std::sort(samples_.begin(), samples_.end());
+    auto percentile = [this](uint32_t perMille) -> unsigned long {
+        const size_t index = (samples_.size() - 1) * perMille / 1000;
+        return samples_[index];
+    };
+    Serial.printf("[Benchmark] latency n=%u/%lu us: p50=%lu p90=%lu p99=%lu p99.9=%lu max=%lu\n",
+                  static_cast<unsigned>(samples_.size()), static_cast<unsigned long>(ticks_),
+                  percentile(500), percentile(900), percentile(990), percentile(999),
+                  static_cast<unsigned long>(samples_.back()));
+}
+
+void LatencyBenchmark::reportThroughput(uint32_t elapsedMs) {
+    if (elapsedMs == 0) return;
+    auto perSecond = [elapsedMs](uint32_t count) -> unsigned long {
+        return static_cast<unsigned long>(static_cast<uint64_t>(count) * 1000 / elapsedMs);
+    };
+    Serial.printf("[Benchmark] throughput: %lu ticks/s, %lu encoder events/s, %lu MIDI/s\n",
+                  perSecond(ticks_), perSecond(encoderEvents_), perSecond(midiMessages_));
+}
+
+#endif
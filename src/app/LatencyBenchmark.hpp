@@ -0,0 +1,75 @@
+#pragma once
+
+#ifdef LATENCY_BENCHMARK
+
+#include <Arduino.h>
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+#include "config/InputID.hpp"
+#include "config/System.hpp"
+#include "core/event/IEventBus.hpp"
+
+class EncoderController;
+class TeensyUsbMidiOut;
+
+/**
+ * @brief End-to-end encoder -> USB MIDI benchmark (env:benchmark)
+ *
+ * Ticks are injected from an IntervalTimer, like a pin interrupt, into the
+ * real EncoderController; the MidiMapper default mappings turn them into
+ * CCs. Runs repeat forever, each printing on Serial:
+ *
+ * - Latency: one tick every LATENCY_TICK_US, ticked edge -> usbMIDI write,
+ *   p50 / p90 / p99 / p99.9 / max over LATENCY_SAMPLES ticks
+ * - Throughput: ticks as fast as THROUGHPUT_TICK_US over all encoders,
+ *   encoder events and MIDI messages per second that made it through
+ *
+ * Plugins are not loaded: the numbers are the core path alone.
+ */
+class LatencyBenchmark {
+public:
+    LatencyBenchmark(EncoderController& encoders, TeensyUsbMidiOut& midiOut,
+                     IEventBus& eventBus);
+    ~LatencyBenchmark();
+
+    /** @brief Main loop: phase changes and reports (ticks come from the timer) */
+    void update();
+
+private:
+    enum class Phase : uint8_t { WAITING, LATENCY, THROUGHPUT };
+
+    static void tickIsr();
+    void tick();
+    void startPhase(Phase phase, uint32_t tickUs);
+    void stopTicks();
+    void reportLatency();
+    void reportThroughput(uint32_t elapsedMs);
+
+    static LatencyBenchmark* instance_;
+
+    EncoderController& encoders_;
+    TeensyUsbMidiOut& midiOut_;
+    IEventBus& eventBus_;
+    SubscriptionId encoderSub_ = 0;
+
+    IntervalTimer timer_;
+    bool timerRunning_ = false;
+    uint32_t tickUs_ = 0;
+    uint32_t lastLoopTickUs_ = 0;  // Fallback when no IntervalTimer is free
+
+    Phase phase_ = Phase::WAITING;
+    uint32_t phaseStartMs_ = 0;
+    uint32_t waitMs_ = System::Benchmark::START_DELAY_MS;
+
+    volatile uint32_t ticks_ = 0;
+    uint8_t nextEncoder_ = 0;
+    int8_t directions_[ENCODER_ID_COUNT];
+
+    uint32_t encoderEvents_ = 0;
+    uint32_t midiMessages_ = 0;
+    etl::vector<uint32_t, System::Benchmark::LATENCY_SAMPLES> samples_;
+};
+
+#endif
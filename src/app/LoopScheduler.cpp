@@ -0,0 +1,162 @@
+#include "LoopScheduler.hpp"
+
+#include <utility>
+
+#include "core/util/LoopMonitor.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+/* Wrap-safe "deadline reached" on the 32-bit micros() counter */
+inline bool isDue(uint32_t now, uint32_t dueUs) {
+    return static_cast<int32_t>(now - dueUs) >= 0;
+}
+}  // namespace
+
+bool LoopScheduler::add(const char* name, uint32_t periodUs, uint8_t priority, StageFn fn,
+                        uint32_t budgetUs) {
+    if (stages_.full()) {
+        LOGF("[LoopScheduler] ERROR: Cannot add stage %s (max %d)\n", name,
+             static_cast<int>(System::Memory::MAX_LOOP_STAGES));
+        return false;
+    }
+
+    Stage stage{std::move(fn), priority, micros(), {name, periodUs, budgetUs, 0, 0, 0, 0, 0}};
+
+    // Stable: a new stage goes after those of the same priority
+    auto it = stages_.begin();
+    while (it != stages_.end() && it->priority >= priority) {
+        ++it;
+    }
+    stages_.insert(it, std::move(stage));
+    return true;
+}
+
+void LoopScheduler::run() {
+    const uint32_t passStartUs = micros();
+    const Stage* longest = nullptr;
+    uint32_t longestUs = 0;
+    uint8_t stagesRun = 0;
+
+    for (Stage& stage : stages_) {
+        const uint32_t now = micros();
+        if (stage.stats.periodUs == 0 || isDue(now, stage.nextDueUs)) {
+            const uint32_t elapsed = runStage(stage, now);
+            ++stagesRun;
+            if (!longest || elapsed > longestUs) {
+                longest = &stage;
+                longestUs = elapsed;
+            }
+        }
+    }
+
+    const uint32_t passUs = micros() - passStartUs;
+    if (passUs > System::Loop::PASS_BUDGET_US && longest) {
+        LoopMonitor::recordOverrun({millis(), passUs, longest->stats.name, longestUs, stagesRun});
+        LOGF("[LoopScheduler] WARNING: %lu us pass, %s took %lu us\n",
+             static_cast<unsigned long>(passUs), longest->stats.name,
+             static_cast<unsigned long>(longestUs));
+    }
+
+    if (hasWork_) {
+        sleepIfIdle();
+    }
+}
+
+void LoopScheduler::sleepIfIdle() {
+    const uint32_t now = micros();
+    for (const Stage& stage : stages_) {
+        if (stage.stats.periodUs != 0 && isDue(now, stage.nextDueUs)) return;
+    }
+
+#ifndef NATIVE_HAL
+    // A pending interrupt ends WFI even while masked: an ISR that fires after the
+    // check wakes the core at once, and runs when interrupts are enabled again
+    noInterrupts();
+    if (hasWork_()) {
+        interrupts();
+        return;
+    }
+    const uint32_t startUs = micros();
+    asm volatile("wfi");
+    interrupts();
+
+    const uint32_t sleptUs = micros() - startUs;
+    ++idle_.sleeps;
+    idle_.sleptUs += sleptUs;
+    if (sleptUs > idle_.worstUs) {
+        idle_.worstUs = sleptUs;
+    }
+#endif
+}
+
+uint32_t LoopScheduler::runStage(Stage& stage, uint32_t now) {
+    StageStats& stats = stage.stats;
+    if (stats.periodUs != 0) {
+        if (now - stage.nextDueUs > stats.periodUs) {
+            // A whole period behind: skip the missed runs instead of bursting
+            ++stats.late;
+            stage.nextDueUs = now;
+        }
+        stage.nextDueUs += stats.periodUs;
+    }
+
+    stage.fn();
+
+    const uint32_t elapsed = micros() - now;
+    ++stats.runs;
+    stats.lastUs = elapsed;
+    if (elapsed > stats.worstUs) {
+        stats.worstUs = elapsed;
+    }
+    if (elapsed > stats.budgetUs) {
+        ++stats.overruns;
+    }
+    return elapsed;
+}
+
+void LoopScheduler::resetStats() {
+    for (Stage& stage : stages_) {
+        StageStats& stats = stage.stats;
+        stats.runs = 0;
+        stats.overruns = 0;
+        stats.late = 0;
+        stats.lastUs = 0;
+        stats.worstUs = 0;
+    }
+    idle_ = {0, 0, 0, micros()};
+    LoopMonitor::reset();
+}
+
+void LoopScheduler::dumpStats(Print& out) const {
+    out.println("[LoopScheduler] stage      period  budget    runs  overrun  late  worst us");
+    for (const Stage& stage : stages_) {
+        const StageStats& stats = stage.stats;
+        out.printf("  %-10s %6lu  %6lu  %6lu  %7lu  %4lu  %8lu\n", stats.name,
+                   static_cast<unsigned long>(stats.periodUs),
+                   static_cast<unsigned long>(stats.budgetUs),
+                   static_cast<unsigned long>(stats.runs),
+                   static_cast<unsigned long>(stats.overruns),
+                   static_cast<unsigned long>(stats.late),
+                   static_cast<unsigned long>(stats.worstUs));
+    }
+
+    out.printf("  passes over %lu us: %lu\n",
+               static_cast<unsigned long>(System::Loop::PASS_BUDGET_US),
+               static_cast<unsigned long>(LoopMonitor::overruns()));
+    for (uint8_t age = 0; const LoopMonitor::Trace* trace = LoopMonitor::trace(age); ++age) {
+        out.printf("    at %lu ms: %lu us, %s %lu us (%u stages)\n",
+                   static_cast<unsigned long>(trace->timeMs),
+                   static_cast<unsigned long>(trace->passUs), trace->stage,
+                   static_cast<unsigned long>(trace->stageUs),
+                   static_cast<unsigned>(trace->stagesRun));
+    }
+
+    if (hasWork_) {
+        const uint32_t windowUs = micros() - idle_.sinceUs;
+        out.printf("  idle: %lu sleeps, %lu%% of the time, longest %lu us\n",
+                   static_cast<unsigned long>(idle_.sleeps),
+                   static_cast<unsigned long>(
+                       windowUs ? static_cast<uint64_t>(idle_.sleptUs) * 100 / windowUs : 0),
+                   static_cast<unsigned long>(idle_.worstUs));
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Arduino.h>
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
+
+/**
+ * @brief Main loop stages, each run at its own rate, in priority order
+ *
+ * A stage with period 0 runs on every pass; otherwise it runs once its
+ * period has elapsed since it was last due (catching up by skipping, never
+ * by running twice in a pass). Each run is timed: a run longer than the
+ * stage's budget is an overrun, a run that starts more than a period late
+ * is counted as late. dumpStats() prints both per stage, to tune rates and
+ * budgets without editing MidiStudioApp::update(). A whole pass longer than
+ * System::Loop::PASS_BUDGET_US is traced in LoopMonitor with its longest
+ * stage.
+ *
+ * With an idle check set (setIdleCheck) a pass that leaves no periodic stage
+ * due and no work pending ends in WFI: the core sleeps until the next
+ * interrupt (USB, encoder pin, sampler or MIDI timer, SysTick at the
+ * latest 1 ms later). The check runs with interrupts masked, so work an ISR
+ * makes after it still wakes the core at once.
+ *
+ * @code
+ * scheduler.add("buttons", 1000, LoopScheduler::PRIORITY_INPUT, [this]() { poll(); });
+ * @endcode
+ */
+class LoopScheduler {
+public:
+    using StageFn = InplaceFunction<void(), 2 * sizeof(void*)>;
+    using WorkFn = InplaceFunction<bool(), 2 * sizeof(void*)>;
+
+    static constexpr uint8_t PRIORITY_IDLE = 0;       // Deferred work (log printing)
+    static constexpr uint8_t PRIORITY_UI = 64;
+    static constexpr uint8_t PRIORITY_OUTPUT = 96;    // USB flush, before the render
+    static constexpr uint8_t PRIORITY_PLUGINS = 128;
+    static constexpr uint8_t PRIORITY_INPUT = 192;
+    static constexpr uint8_t PRIORITY_MIDI_IN = 255;
+
+    struct StageStats {
+        const char* name;
+        uint32_t periodUs;
+        uint32_t budgetUs;
+        uint32_t runs;
+        uint32_t overruns;  // Runs longer than budgetUs
+        uint32_t late;      // Runs started more than a period after they were due
+        uint32_t lastUs;
+        uint32_t worstUs;
+    };
+
+    struct IdleStats {
+        uint32_t sleeps;
+        uint32_t sleptUs;  // Total time in WFI, waking interrupt included
+        uint32_t worstUs;
+        uint32_t sinceUs;  // micros() at the last resetStats()
+    };
+
+    /**
+     * @param name Static string (kept by pointer)
+     * @param periodUs 0 = every pass
+     * @param priority Run order within a pass, higher first (same: add order)
+     * @return false when System::Memory::MAX_LOOP_STAGES stages exist
+     */
+    bool add(const char* name, uint32_t periodUs, uint8_t priority, StageFn fn,
+             uint32_t budgetUs = System::Loop::STAGE_BUDGET_US);
+
+    /** @brief One pass: run every due stage, then sleep if idle */
+    void run();
+
+    /**
+     * @brief Enable idle sleep (System::Loop::IDLE_SLEEP)
+     * @param hasWork True while a stage has something to do on the next pass;
+     *        called with interrupts masked: it must only read state
+     */
+    void setIdleCheck(WorkFn hasWork) {
+        hasWork_ = std::move(hasWork);
+    }
+
+    const IdleStats& idleStats() const {
+        return idle_;
+    }
+
+    size_t size() const {
+        return stages_.size();
+    }
+
+    /** @return nullptr past the last stage */
+    const StageStats* stats(size_t index) const {
+        return index < stages_.size() ? &stages_[index].stats : nullptr;
+    }
+
+    void resetStats();
+    void dumpStats(Print& out) const;
+
+private:
+    struct Stage {
+        StageFn fn;
+        uint8_t priority;
+        uint32_t nextDueUs;
+        StageStats stats;
+    };
+
+    /** @return Run time */
+    uint32_t runStage(Stage& stage, uint32_t now);
+    void sleepIfIdle();
+
+    etl::vector<Stage, System::Memory::MAX_LOOP_STAGES> stages_;
+    WorkFn hasWork_;
+    IdleStats idle_ = {0, 0, 0, 0};
+};
@@ -4,7 +4,37 @@
 #include "core/factory/MidiFactory.hpp"
 #include "core/event/Events.hpp"
 #include "core/event/UnifiedEventTypes.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "log/HeapTracker.hpp"
 #include "log/Macros.hpp"
+#include "log/Profiler.hpp"
+
+namespace {
+/* Learned mappings when stored, Config::MIDI_MAPPINGS otherwise */
+MidiMapper::Mappings loadMappings(const EepromMappingStore& store) {
+    MidiMapper::Mappings mappings;
+    if (store.load(mappings)) {
+        LOGF("[MidiStudioApp] Loaded %d learned MIDI mappings\n",
+             static_cast<int>(mappings.size()));
+        return mappings;
+    }
+    return MidiFactory::createDefault();
+}
+
+/* Port of System::Midi::DIN_OUTPUT_SERIAL (Serial1 when 0: constructed, never opened) */
+HardwareSerial& dinSerial() {
+    switch (System::Midi::DIN_OUTPUT_SERIAL) {
+        case 2: return Serial2;
+        case 3: return Serial3;
+        case 4: return Serial4;
+        case 5: return Serial5;
+        case 6: return Serial6;
+        case 7: return Serial7;
+        case 8: return Serial8;
+        default: return Serial1;
+    }
+}
+}  // namespace
 
 /*
  * Constructor - Full stack allocation following dependency levels
@@ -15,6 +45,7 @@ MidiStudioApp::MidiStudioApp(PluginSetupFn setupPlugins)
       eventBus_(),
       displayDriver_(),
       multiplexer_(),
+      shiftRegisters_(),
 
       encoders_config_(InputFactory::createEncoders()),
       buttons_config_(InputFactory::createButtons()),
@@ -22,15 +53,26 @@ MidiStudioApp::MidiStudioApp(PluginSetupFn setupPlugins)
       displayBridge_(displayDriver_),
       midiOut_(eventBus_),
       midiIn_(eventBus_),
+      dinOut_(dinSerial()),
+      midiRouter_(),
+      echoFilter_(),
       encoders_(encoders_config_, eventBus_),
-      buttons_(buttons_config_, multiplexer_, eventBus_),
+      buttons_(buttons_config_, multiplexer_, shiftRegisters_, eventBus_),
 
-      midiMapper_(midiOut_, eventBus_, MidiFactory::createDefault()),
+      mappingStore_(),
+      midiMapper_(midiOut_, eventBus_, loadMappings(mappingStore_)),
       ui_(displayBridge_, eventBus_),
       inputManager_(encoders_, buttons_),
 
-      uiController_(ui_, eventBus_),
-      plugins_(eventBus_, midiIn_, midiOut_, encoders_, ui_) {
+      uiController_(ui_, eventBus_, buttons_),
+      plugins_(eventBus_, midiIn_, midiOut_, encoders_, ui_, midiMapper_)
+#ifdef LATENCY_BENCHMARK
+      , benchmark_(encoders_, midiOut_, eventBus_)
+#endif
+#ifdef EVENT_RECORDER
+      , recorder_(eventBus_)
+#endif
+{
 
     // S'abonner à l'événement BootComplete pour initialiser les plugins après le splash
     bootCompleteSub_ = eventBus_.on(EventCategory::System, SystemEvent::BootComplete,
@@ -38,6 +80,25 @@ MidiStudioApp::MidiStudioApp(PluginSetupFn setupPlugins)
             onBootComplete(e);
         });
 
+    midiMapper_.setLearnCallback([this]() { saveMappings(); });
+
+    // No routes by default: plugins add thru routes through ControllerAPI
+    midiRouter_.addOutput(midiOut_);  // MidiPort::USB
+    if (System::Midi::DIN_OUTPUT_SERIAL != 0) {
+        dinOut_.begin();
+        midiRouter_.addOutput(dinOut_);  // MidiPort::DIN
+    }
+    midiIn_.setRouter(&midiRouter_);
+
+    midiOut_.setEchoFilter(&echoFilter_);
+    midiIn_.setEchoFilter(&echoFilter_);
+
+    // Input and MIDI state are members: they are in DTCM only if the app is
+    if (!MemoryPlacement::isDtcm(this)) {
+        LOGLN("[MidiStudioApp] WARNING: App not in DTCM, hot state runs from slower RAM");
+    }
+
+    addLoopStages();
     ready_ = true;
 }
 
@@ -50,22 +111,184 @@ bool MidiStudioApp::setup() {
     return true;
 }
 
+/*
+ * Main loop stages, highest priority first (rates in System::Loop)
+ */
+void MidiStudioApp::addLoopStages() {
+    using System::Loop::BINDING_TICK_PERIOD_US;
+    using System::Loop::BUTTONS_PERIOD_US;
+
+#ifdef LATENCY_BENCHMARK
+    loop_.add("benchmark", 0, LoopScheduler::PRIORITY_MIDI_IN, [this]() { benchmark_.update(); });
+#endif
+
+    loop_.add("midi-in", 0, LoopScheduler::PRIORITY_MIDI_IN, [this]() {
+        midiIn_.processPendingMessages();
+        eventBus_.dispatchLane(EventLane::Realtime, System::Dispatch::REALTIME_EVENTS_PER_LOOP);
+    });
+
+    // Input stages share a priority: they run in this order
+#ifdef EVENT_RECORDER
+    // Replayed input stands in for the hardware, at the same point of the pass
+    loop_.add("replay", 0, LoopScheduler::PRIORITY_INPUT, [this]() {
+        if (recorder_.update()) reportReplay();
+    });
+#endif
+    loop_.add("encoders", 0, LoopScheduler::PRIORITY_INPUT, [this]() {
+        if (hardwareInputEnabled()) inputManager_.updateEncoders();
+    });
+    loop_.add("buttons", BUTTONS_PERIOD_US, LoopScheduler::PRIORITY_INPUT, [this]() {
+        if (hardwareInputEnabled()) inputManager_.updateButtons();
+    });
+    loop_.add("dispatch", 0, LoopScheduler::PRIORITY_INPUT, [this]() {
+        eventBus_.dispatchPending();
+        midiMapper_.update();
+    });
+
+    loop_.add("bindings", BINDING_TICK_PERIOD_US, LoopScheduler::PRIORITY_PLUGINS, [this]() {
+        if (pluginsInitialized_) plugins_.tickBindings();
+    });
+    loop_.add("plugins", 0, LoopScheduler::PRIORITY_PLUGINS, [this]() {
+        if (pluginsInitialized_) plugins_.update();
+    });
+
+    // One USB flush for everything input and plugins produced, before the
+    // render: a frame never sits between an input and its MIDI
+    loop_.add("midi-out", 0, LoopScheduler::PRIORITY_OUTPUT, [this]() { midiOut_.sendQueued(); });
+
+    // Rendering last: input and MIDI never wait for a frame (MIDI queued by
+    // the UI goes out with the next pass)
+    loop_.add("ui", System::Loop::UI_PERIOD_US, LoopScheduler::PRIORITY_UI,
+              [this]() { ui_.update(midiIn_.hasBacklog() || eventBus_.hasPending()); },
+              System::Loop::UI_BUDGET_US);
+
+#if defined(DEBUG_LOGS) && !defined(SYNC_LOGS)
+    // Deferred logs, once the pass's real work is done
+    loop_.add("log", 0, LoopScheduler::PRIORITY_IDLE, []() { AsyncLog::flush(Serial); });
+#endif
+
+    if (System::Loop::IDLE_SLEEP) {
+        loop_.setIdleCheck([this]() { return hasPendingWork(); });
+    }
+}
+
+/*
+ * Idle check, interrupts masked: every-pass stages with work for the next pass.
+ * Plugins are not asked: their update() runs again after the next interrupt.
+ */
+bool MidiStudioApp::hasPendingWork() const {
+#ifdef EVENT_RECORDER
+    if (recorder_.replaying()) return true;
+#endif
+#if defined(DEBUG_LOGS) && !defined(SYNC_LOGS)
+    if (AsyncLog::pending()) return true;
+#endif
+    return midiIn_.hasBacklog() || eventBus_.hasPending() || encoders_.hasPendingTicks() ||
+           buttons_.hasPending() || midiMapper_.hasPending() || midiOut_.hasQueued() ||
+           ui_.hasWorkDue();
+}
+
 /*
  * Main Loop
  */
 void MidiStudioApp::update() {
     if (!ready_) return;
 
-    midiIn_.processPendingMessages();
-    inputManager_.update();
+    {
+        PROFILE_SECTION("loop");
+        loop_.run();
+    }
+    HEAP_PASS();
 
-    if (pluginsInitialized_) {
-        plugins_.update();
+#if defined(SECTION_PROFILING) || defined(EVENT_RECORDER) || defined(HEAP_TRACKING)
+    if (Serial.available()) {
+        handleSerialCommand(Serial.read());
     }
+#endif
 
-    ui_.update();
+#ifdef EVENTBUS_PROFILING
+    if (System::Dispatch::PROFILE_DUMP_INTERVAL_MS != 0 &&
+        millis() - lastProfileDumpMs_ >= System::Dispatch::PROFILE_DUMP_INTERVAL_MS) {
+        lastProfileDumpMs_ = millis();
+        eventBus_.dumpProfile(Serial);
+        loop_.dumpStats(Serial);
+#ifdef MIDI_LATENCY_TRACING
+        midiOut_.dumpLatency(Serial);
+#endif
+    }
+#endif
 }
 
+/*
+ * Commands from the serial monitor
+ *
+ * SECTION_PROFILING: 'p' prints the sections, 'r' resets them.
+ * EVENT_RECORDER: 'R' records, 'S' stops, 'P' replays, 'F' replays
+ * REPLAY_FAST_SPEED times faster, 'W' / 'L' save / load on the SD card.
+ * HEAP_TRACKING: 'h' prints the heap figures, 'z' resets them (e.g. once
+ * playback has settled, to check it allocates nothing).
+ */
+void MidiStudioApp::handleSerialCommand(int command) {
+    switch (command) {
+#ifdef SECTION_PROFILING
+        case 'p':
+            PROFILE_DUMP(Serial);
+            loop_.dumpStats(Serial);
+            break;
+        case 'r':
+            PROFILE_RESET();
+            loop_.resetStats();
+            break;
+#endif
+#ifdef HEAP_TRACKING
+        case 'h':
+            HEAP_DUMP(Serial);
+            break;
+        case 'z':
+            HEAP_RESET();
+            break;
+#endif
+#ifdef EVENT_RECORDER
+        case 'R':
+            recorder_.startRecording();
+            break;
+        case 'S':
+            recorder_.stop();
+            break;
+        case 'P':
+            startReplay(1);
+            break;
+        case 'F':
+            startReplay(System::Benchmark::REPLAY_FAST_SPEED);
+            break;
+        case 'W':
+            recorder_.save();
+            break;
+        case 'L':
+            recorder_.load();
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+#ifdef EVENT_RECORDER
+void MidiStudioApp::startReplay(uint8_t speed) {
+    if (!recorder_.startReplay(speed)) return;
+    // Stats cover the replay alone
+    loop_.resetStats();
+    replayStartFrames_ = ui_.getDisplayStats().frames;
+}
+
+void MidiStudioApp::reportReplay() {
+    const DisplayStats stats = ui_.getDisplayStats();
+    Serial.printf("[Recorder] %lu frames during the replay\n",
+                  static_cast<unsigned long>(stats.frames - replayStartFrames_));
+    loop_.dumpStats(Serial);
+}
+#endif
+
 void MidiStudioApp::initializePlugins() {
     if (pluginsInitialized_) return;
 
@@ -78,6 +301,17 @@ void MidiStudioApp::initializePlugins() {
     }
 }
 
-void MidiStudioApp::onBootComplete(const Event& event) {
+void MidiStudioApp::onBootComplete(const Event&) {
+    // ViewController subscribed first: it has already picked its view
+    if (uiController_.renderBenchmarkActive()) {
+        LOGLN("[MidiStudioApp] Render benchmark: plugins not initialized");
+        return;
+    }
     initializePlugins();
 }
+
+void MidiStudioApp::saveMappings() {
+    MidiMapper::Mappings mappings;
+    midiMapper_.exportMappings(mappings);
+    mappingStore_.save(mappings);
+}
@@ -11,15 +11,22 @@
 
 #include "adapter/display/driver/Ili9341Driver.hpp"
 #include "adapter/display/ui/LVGLBridge.hpp"
+#include "adapter/expander/ShiftRegisterInput.hpp"
 #include "adapter/input/button/ButtonController.hpp"
 #include "adapter/input/encoder/EncoderController.hpp"
+#include "adapter/midi/SerialMidiOut.hpp"
 #include "adapter/midi/TeensyUsbMidiIn.hpp"
 #include "adapter/midi/TeensyUsbMidiOut.hpp"
 #include "adapter/multiplexer/MultiplexerController.hpp"
+#include "adapter/storage/EepromMappingStore.hpp"
+#include "app/EventRecorder.hpp"
+#include "app/LatencyBenchmark.hpp"
+#include "app/LoopScheduler.hpp"
 #include "config/System.hpp"
 #include "core/event/EventBus.hpp"
 #include "core/event/IEventBus.hpp"
 #include "core/midi/MidiMapper.hpp"
+#include "core/midi/MidiRouter.hpp"
 #include "core/struct/Button.hpp"
 #include "core/struct/Encoder.hpp"
 #include "manager/PluginManager.hpp"
@@ -37,6 +44,11 @@ public:
     bool setup();
     void update();
 
+    /** @brief Per-stage runs, overruns and worst times of the main loop */
+    const LoopScheduler& loopScheduler() const {
+        return loop_;
+    }
+
 private:
     PluginSetupFn setupPlugins_;
 
@@ -44,6 +56,7 @@ private:
 
     Ili9341Driver displayDriver_;
     Multiplexer multiplexer_;
+    ShiftRegisterInput shiftRegisters_;
 
     etl::vector<Hardware::Encoder, System::Hardware::ENCODERS_COUNT> encoders_config_;
     etl::vector<Hardware::Button, System::Hardware::BUTTONS_COUNT> buttons_config_;
@@ -52,21 +65,57 @@ private:
 
     TeensyUsbMidiOut midiOut_;
     TeensyUsbMidiIn midiIn_;
+    SerialMidiOut dinOut_;
+    MidiRouter midiRouter_;
+    EchoFilter echoFilter_;
 
     EncoderController encoders_;
     ButtonController buttons_;
 
+    EepromMappingStore mappingStore_;
     MidiMapper midiMapper_;
     ViewManager ui_;
     InputManager inputManager_;
 
     ViewController uiController_;
     PluginManager plugins_;
+    LoopScheduler loop_;
+
+#ifdef LATENCY_BENCHMARK
+    LatencyBenchmark benchmark_;
+#endif
+
+#ifdef EVENT_RECORDER
+    EventRecorder recorder_;
+    uint32_t replayStartFrames_ = 0;
+#endif
 
     bool ready_ = false;
     bool pluginsInitialized_ = false;
     SubscriptionId bootCompleteSub_ = 0;
 
+#ifdef EVENTBUS_PROFILING
+    uint32_t lastProfileDumpMs_ = 0;
+#endif
+
+    void addLoopStages();
+    void handleSerialCommand(int command);
+    bool hasPendingWork() const;
+#ifdef EVENT_RECORDER
+    void startReplay(uint8_t speed);
+    void reportReplay();
+#endif
+
+    /** @brief Encoders and buttons are polled (not while a recording is replayed) */
+    bool hardwareInputEnabled() const {
+#ifdef EVENT_RECORDER
+        return !recorder_.replaying();
+#else
+        return true;
+#endif
+    }
+
     void initializePlugins();
+    void saveMappings();
     void onBootComplete(const Event& event);
 };
@@ -6,11 +6,12 @@
  * This file contains the complete list of physical input devices
  * connected to the microcontroller. Each entry specifies:
  * - Which logical control (InputID) it represents
- * - Which pins it's connected to (MCU direct or multiplexer)
+ * - Which pins it's connected to (MCU direct, multiplexer or shift register)
  * - Hardware-specific parameters (PPR, steps per detent, etc.)
  *
  * Button format:
- *   {InputID, GpioPin}
+ *   {InputID, GpioPin, DebounceMode}
+ *   Default debounce: SampleHistory (can be omitted)
  *
  * Encoder format:
  *   {InputID, pinA, pinB, pulsesPerRevolution, stepsPerDetent}
@@ -19,6 +20,7 @@
  * Pin helper functions:
  *   mcuPin(n)  - Direct microcontroller pin
  *   muxPin(n)  - Multiplexer channel (0-15)
+ *   shiftRegPin(n) - 74HC165 chain input (0 to SHIFT_REG_MAX_INPUTS - 1, buttons only)
  *
  * To add a new control:
  * 1. Define its ID in InputID.hpp
@@ -25,14 +25,16 @@
  *
  * To add a new control:
  * 1. Add an enum value below (choose an appropriate ID number based on type)
- * 2. Add the hardware definition in InputDefinition.hpp
- * 3. Optionally add a MIDI mapping in MidiMapping.hpp
+ * 2. List it in BUTTON_IDS or ENCODER_IDS (dense index used by state tables)
+ * 3. Add the hardware definition in InputDefinition.hpp
+ * 4. Optionally add a MIDI mapping in MidiMapping.hpp
  *
  * Dependencies: None
  * This file has zero dependencies and can be included anywhere.
  */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 /*
@@ -66,6 +68,94 @@ enum class ButtonID : uint16_t {
     NAV = 40,
 };
 
+/*
+ * Dense ButtonID index
+ *
+ * Every ButtonID, in index order. buttonIndex() maps a ButtonID to its
+ * position (0..BUTTON_ID_COUNT-1) at compile time, so per-button state can
+ * live in plain arrays instead of hash maps.
+ */
+constexpr ButtonID BUTTON_IDS[] = {
+    ButtonID::LEFT_TOP,    ButtonID::LEFT_CENTER,   ButtonID::LEFT_BOTTOM,
+    ButtonID::BOTTOM_LEFT, ButtonID::BOTTOM_CENTER, ButtonID::BOTTOM_RIGHT,
+    ButtonID::MACRO_1,     ButtonID::MACRO_2,       ButtonID::MACRO_3,
+    ButtonID::MACRO_4,     ButtonID::MACRO_5,       ButtonID::MACRO_6,
+    ButtonID::MACRO_7,     ButtonID::MACRO_8,       ButtonID::NAV,
+};
+
+constexpr uint8_t BUTTON_ID_COUNT = sizeof(BUTTON_IDS) / sizeof(BUTTON_IDS[0]);
+constexpr uint8_t INVALID_INPUT_INDEX = 0xFF;
+
+/*
+ * ID -> index lookup tables
+ *
+ * IDs are sparse, so each list gets a table spanning its lowest to highest
+ * ID, filled at compile time: a lookup is one bounds check and one load.
+ */
+namespace InputIdTable {
+
+template <typename Id, size_t N>
+constexpr uint16_t minId(const Id (&ids)[N]) {
+    uint16_t result = static_cast<uint16_t>(ids[0]);
+    for (size_t i = 1; i < N; ++i) {
+        if (static_cast<uint16_t>(ids[i]) < result) result = static_cast<uint16_t>(ids[i]);
+    }
+    return result;
+}
+
+template <typename Id, size_t N>
+constexpr uint16_t maxId(const Id (&ids)[N]) {
+    uint16_t result = static_cast<uint16_t>(ids[0]);
+    for (size_t i = 1; i < N; ++i) {
+        if (static_cast<uint16_t>(ids[i]) > result) result = static_cast<uint16_t>(ids[i]);
+    }
+    return result;
+}
+
+template <size_t Span>
+struct Table {
+    uint8_t index[Span];
+};
+
+template <size_t Span, typename Id, size_t N>
+constexpr Table<Span> build(const Id (&ids)[N], uint16_t base) {
+    Table<Span> table{};
+    for (size_t i = 0; i < Span; ++i) {
+        table.index[i] = INVALID_INPUT_INDEX;
+    }
+    for (size_t i = 0; i < N; ++i) {
+        table.index[static_cast<uint16_t>(ids[i]) - base] = static_cast<uint8_t>(i);
+    }
+    return table;
+}
+
+}  // namespace InputIdTable
+
+constexpr uint16_t BUTTON_ID_MIN = InputIdTable::minId(BUTTON_IDS);
+constexpr uint16_t BUTTON_ID_MAX = InputIdTable::maxId(BUTTON_IDS);
+constexpr size_t BUTTON_ID_SPAN = BUTTON_ID_MAX - BUTTON_ID_MIN + 1;
+constexpr InputIdTable::Table<BUTTON_ID_SPAN> BUTTON_INDEX_TABLE =
+    InputIdTable::build<BUTTON_ID_SPAN>(BUTTON_IDS, BUTTON_ID_MIN);
+
+/**
+ * @return Index of id in BUTTON_IDS, INVALID_INPUT_INDEX if not listed
+ */
+constexpr uint8_t buttonIndex(ButtonID id) {
+    const uint16_t offset = static_cast<uint16_t>(static_cast<uint16_t>(id) - BUTTON_ID_MIN);
+    return offset < BUTTON_ID_SPAN ? BUTTON_INDEX_TABLE.index[offset] : INVALID_INPUT_INDEX;
+}
+
+constexpr bool buttonIdsUnique() {
+    for (uint8_t i = 0; i < BUTTON_ID_COUNT; ++i) {
+        if (buttonIndex(BUTTON_IDS[i]) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(buttonIdsUnique(), "Duplicate ButtonID in BUTTON_IDS");
+
 /*
  * EncoderID
  *
@@ -87,3 +177,39 @@ enum class EncoderID : uint16_t {
     NAV = 400,
     OPT = 410,
 };
+
+/*
+ * Dense EncoderID index (see BUTTON_IDS)
+ */
+constexpr EncoderID ENCODER_IDS[] = {
+    EncoderID::MACRO_1, EncoderID::MACRO_2, EncoderID::MACRO_3, EncoderID::MACRO_4,
+    EncoderID::MACRO_5, EncoderID::MACRO_6, EncoderID::MACRO_7, EncoderID::MACRO_8,
+    EncoderID::NAV,     EncoderID::OPT,
+};
+
+constexpr uint8_t ENCODER_ID_COUNT = sizeof(ENCODER_IDS) / sizeof(ENCODER_IDS[0]);
+
+constexpr uint16_t ENCODER_ID_MIN = InputIdTable::minId(ENCODER_IDS);
+constexpr uint16_t ENCODER_ID_MAX = InputIdTable::maxId(ENCODER_IDS);
+constexpr size_t ENCODER_ID_SPAN = ENCODER_ID_MAX - ENCODER_ID_MIN + 1;
+constexpr InputIdTable::Table<ENCODER_ID_SPAN> ENCODER_INDEX_TABLE =
+    InputIdTable::build<ENCODER_ID_SPAN>(ENCODER_IDS, ENCODER_ID_MIN);
+
+/**
+ * @return Index of id in ENCODER_IDS, INVALID_INPUT_INDEX if not listed
+ */
+constexpr uint8_t encoderIndex(EncoderID id) {
+    const uint16_t offset = static_cast<uint16_t>(static_cast<uint16_t>(id) - ENCODER_ID_MIN);
+    return offset < ENCODER_ID_SPAN ? ENCODER_INDEX_TABLE.index[offset] : INVALID_INPUT_INDEX;
+}
+
+constexpr bool encoderIdsUnique() {
+    for (uint8_t i = 0; i < ENCODER_ID_COUNT; ++i) {
+        if (encoderIndex(ENCODER_IDS[i]) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(encoderIdsUnique(), "Duplicate EncoderID in ENCODER_IDS");
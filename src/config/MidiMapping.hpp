@@ -11,6 +11,10 @@
  *
  * Format:
  *   {InputID, midiChannel, ccNumber}
+ *   {EncoderID, midiChannel, ccNumber, MidiResolution::CC14}  (14-bit, ccNumber 0-31)
+ *   {EncoderID, midiChannel, paramNumber, MidiResolution::NRPN}
+ *   {EncoderID, midiChannel, ccNumber, MidiResolution::UMP}   (32-bit MIDI 2.0 CC)
+ *   {EncoderID, midiChannel, ccNumber, MidiResolution::RelativeTwos}  (detent deltas)
  *
  * MIDI CC ranges used:
  * - CC 1-10    Main encoders
@@ -52,7 +56,7 @@ constexpr MidiCCMapping MIDI_MAPPINGS[] = {
     {EncoderID::MACRO_6, 0, 6},
     {EncoderID::MACRO_7, 0, 7},
     {EncoderID::MACRO_8, 0, 8},
-    {EncoderID::NAV, 0, 9},
+    {EncoderID::NAV, 0, 9, MidiResolution::RelativeTwos},  // Relative-mode encoder
     {EncoderID::OPT, 0, 10},
 
     /* Encoder buttons (CC 11-18) */
@@ -80,4 +84,24 @@ constexpr MidiCCMapping MIDI_MAPPINGS[] = {
  */
 constexpr size_t MIDI_MAPPING_COUNT = sizeof(MIDI_MAPPINGS) / sizeof(MIDI_MAPPINGS[0]);
 
+/*
+ * Every mapping targets a listed control (BUTTON_IDS / ENCODER_IDS), at most once
+ */
+constexpr bool midiMappingsValid() {
+    for (size_t i = 0; i < MIDI_MAPPING_COUNT; ++i) {
+        if (MIDI_MAPPINGS[i].inputIndex() == INVALID_INPUT_INDEX) {
+            return false;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (MIDI_MAPPINGS[j].kind == MIDI_MAPPINGS[i].kind &&
+                MIDI_MAPPINGS[j].inputId == MIDI_MAPPINGS[i].inputId) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(midiMappingsValid(), "MIDI_MAPPINGS: unknown or duplicate control");
+
 }  // namespace Config
@@ -9,6 +9,7 @@
  * - Display settings (resolution, refresh rate, memory)
  * - MIDI parameters (channels, CC ranges, rate limiting)
  * - UI behavior (debug mode, colors)
+ * - Event dispatch (deferred lane budgets)
  * - Memory limits (event system, MIDI queues, UI components)
  *
  * All values are constexpr - they cannot be changed at runtime.
@@ -70,6 +71,17 @@ constexpr uint8_t MUX_S3_PIN = 6;
 constexpr uint8_t MUX_SIGNAL_PIN = 4;
 constexpr uint8_t MUX_MAX_CHANNELS = 16;
 
+/* Input expander (chained 74HC165 on SPI, ShiftRegisterInput)
+ * SH/LD on SHIFT_REG_LOAD_PIN, QH of the first chip on MISO (12), CLK on
+ * SCK (13), CLK INH tied low. Each scan latches every input and reads the
+ * chain in one DMA transfer. 0 chips = not fitted.
+ */
+constexpr uint8_t SHIFT_REG_CHIPS = 0;
+constexpr uint8_t SHIFT_REG_MAX_INPUTS = SHIFT_REG_CHIPS * 8;
+constexpr uint8_t SHIFT_REG_LOAD_PIN = 10;
+constexpr uint32_t SHIFT_REG_SPI_HZ = 4000000;   /* 4 MHz - 128 inputs in 32 us */
+constexpr uint32_t SHIFT_REG_LOAD_PULSE_NS = 100; /* SH/LD low time, 74HC165 at 3.3 V */
+
 /* Input timing (debouncing) */
 constexpr uint16_t BUTTON_DEBOUNCE_US = 20; /* microseconds */
 constexpr uint16_t MUX_DEBOUNCE_US = BUTTON_DEBOUNCE_US;
@@ -93,6 +105,53 @@ constexpr size_t DIFFBUFFER_SIZE = 16384; /* 16KB for better diff precision (was
 constexpr size_t LVGL_BUFFER_LINES = SCREEN_HEIGHT;
 constexpr size_t LVGL_BUFFER_SIZE = SCREEN_WIDTH * LVGL_BUFFER_LINES;
 
+/* LVGL render mode
+ * Direct: LVGL redraws only invalidated areas in place in its full-screen
+ * buffer, and the bounding box of a frame's areas is handed to the driver
+ * (updateRegion), which diffs that region only.
+ * Full: the whole screen is re-rendered and diffed every frame.
+ */
+constexpr bool LVGL_DIRECT_RENDER = true;
+
+/* Double-buffered LVGL rendering
+ * A second RAM2 draw buffer lets LVGL render frame N+1 while the driver is
+ * still uploading frame N; the flush completes once the driver's DMA goes
+ * idle. Costs another LVGL_BUFFER_SIZE * 2 bytes of RAM2 (~150 KB at
+ * full-screen buffer size): the LVGL fast arena shrinks to a few pages to
+ * make room (Memory::RAM2_*), hence off by default.
+ */
+constexpr bool LVGL_DOUBLE_BUFFER = false;
+
+/* Frame scheduling (LVGLBridge::refresh)
+ * LVGL runs at most FRAME_RATE_HZ (independent of REFRESH_RATE_HZ, and capped
+ * by LVGL_REFRESH_PERIOD_MS in lv_conf.h), after input and MIDI in the loop.
+ * A frame that took R us delays the next by at least R * 100 / RENDER_MAX_LOAD,
+ * so rendering never takes more than that share of the loop. While input is
+ * still pending, up to MAX_DROPPED_FRAMES frames in a row are skipped.
+ */
+constexpr uint32_t FRAME_RATE_HZ = 60;
+constexpr uint32_t FRAME_PERIOD_US = 1000000 / FRAME_RATE_HZ;
+constexpr uint32_t RENDER_MAX_LOAD_PERCENT = 50; /* percent of loop time, 1-100 */
+constexpr uint8_t MAX_DROPPED_FRAMES = 4;
+
+/* Idle mode (LVGLBridge)
+ * After IDLE_AFTER_MS without a redraw, the panel refresh and LVGL frame
+ * rate drop to the values below. The first redraw, input event or host
+ * parameter update restores REFRESH_RATE_HZ / FRAME_RATE_HZ.
+ */
+constexpr uint32_t IDLE_AFTER_MS = 2000;      /* milliseconds, 0 = never idle */
+constexpr int IDLE_REFRESH_RATE_HZ = 60;      /* panel refresh while idle */
+constexpr uint32_t IDLE_FRAME_RATE_HZ = 10;   /* LVGL frames while idle */
+constexpr uint32_t IDLE_FRAME_PERIOD_US = 1000000 / IDLE_FRAME_RATE_HZ;
+
+/* Debug overlay (LVGLBridge::setDebugOverlay)
+ * Invalidated areas of the last OVERLAY_FRAMES frames as a fading heatmap,
+ * plus render / flush times and fps. Runtime toggle, no rebuild needed.
+ */
+constexpr size_t OVERLAY_FRAMES = 8;           /* frames of history */
+constexpr size_t OVERLAY_AREAS_PER_FRAME = 8;  /* more are merged into the last */
+constexpr uint32_t OVERLAY_TEXT_PERIOD_MS = 250;
+
 /* Refresh timing */
 constexpr int REFRESH_RATE_HZ = 200;
 constexpr uint32_t REFRESH_PERIOD_MS = (1000 / REFRESH_RATE_HZ);
@@ -106,6 +165,21 @@ constexpr unsigned long VSYNC_PERIOD_MS = REFRESH_PERIOD_MS * VSYNC_SPACING;
 constexpr int DIFF_GAP = 4;
 constexpr int IRQ_PRIORITY = 128;
 constexpr float LATE_START_RATIO = 0.1f;
+
+/* Driver statistics and auto-tune (Ili9341Driver::getStats / setAutoTune)
+ * Upload figures are averaged over windows of DRIVER_STATS_FRAMES frames.
+ * With auto-tune, at the end of each window the diff gap doubles while more
+ * than AUTOTUNE_OVERFLOW_PERCENT of the diffs overflowed their buffer (the
+ * rest of that frame is uploaded whole), and halves back towards DIFF_GAP
+ * when none did. VSync spacing grows while frames tear, and shrinks when
+ * uploads would fit in one refresh period less.
+ */
+constexpr uint32_t DRIVER_STATS_FRAMES = 120;
+constexpr bool DRIVER_AUTOTUNE = false;        /* initial setAutoTune() state */
+constexpr uint32_t AUTOTUNE_OVERFLOW_PERCENT = 5;
+constexpr int AUTOTUNE_DIFF_GAP_MAX = 32;
+constexpr int AUTOTUNE_VSYNC_SPACING_MIN = 1;
+constexpr int AUTOTUNE_VSYNC_SPACING_MAX = 4;
 }  // namespace Display
 
 /*
@@ -118,19 +192,101 @@ namespace Midi {
 constexpr uint8_t DEFAULT_CHANNEL = 0;
 constexpr uint8_t CC_VALUE_MIN = 0;
 constexpr uint8_t CC_VALUE_MAX = 127;
-constexpr size_t MAX_ACTIVE_NOTES = 16;
 
-/* Rate limiting (prevent MIDI flooding) */
-constexpr unsigned long DUPLICATE_CHECK_MS = 1.5; /* milliseconds */
-constexpr unsigned long ENCODER_RATE_LIMIT_MS = 5;
+/* Rate limiting (prevent MIDI flooding), applied by MidiMapper */
+constexpr float DUPLICATE_CHECK_MS = 1.5f;  /* milliseconds - same value on a CC dropped inside this window */
+constexpr float ENCODER_RATE_LIMIT_MS = 5;  /* milliseconds - min gap between sends per encoder */
+
+/* Host feedback suppression (EchoFilter): CCs received this soon after sending
+ * the same channel/CC are not emitted to the UI and plugins (still routed thru)
+ */
+constexpr uint16_t ECHO_SUPPRESS_MS = 100; /* milliseconds, 0 = off */
+
+/* Input drain budget (TeensyUsbMidiIn::processPendingMessages)
+ * A host flood (DAW resync on project load) is spread over several loops
+ * instead of starving input scanning and rendering; USB flow control holds
+ * the rest on the host. Repeated CCs for the same channel/controller inside
+ * one drain are coalesced to the latest value before being emitted.
+ */
+constexpr uint16_t INPUT_MESSAGES_PER_LOOP = 256;  /* messages read per loop */
+constexpr uint32_t INPUT_BUDGET_US = 1000;         /* microseconds per loop */
+constexpr size_t INPUT_CC_COALESCE_SLOTS = 32;     /* distinct CCs held per drain, 0 = off */
+
+/* Device SysEx, under the non-commercial manufacturer ID
+ * UI stats (ControllerAPI::sendUiStats):
+ *   F0 7D 10 <fields of DisplayStats, SysExWriter encoding, in struct order> F7
+ * Plugin stats (ControllerAPI::sendPluginStats), one message per plugin:
+ *   F0 7D 11 <id U7> <update calls, total us, worst us: U32 each>
+ *   <callback calls, total us, worst us: U32 each> <heap, LVGL bytes: U32> F7
+ * Page sync (host to device, applied to ControllerAPI::parameters()):
+ *   F0 7D 12 <fields U7> <count U7>, then count times
+ *   <id U16> [<value: normalized>] [<discrete count U14>] [<name>] [<display>] F7
+ *   fields: 1 value, 2 display, 4 name, 8 discrete count (bracketed parts
+ *   are present when their bit is set); strings are length-prefixed
+ */
+constexpr uint8_t SYSEX_MANUFACTURER_ID = 0x7D;
+constexpr uint8_t SYSEX_CMD_UI_STATS = 0x10;
+constexpr uint8_t SYSEX_CMD_PLUGIN_STATS = 0x11;
+constexpr uint8_t SYSEX_CMD_PAGE_SYNC = 0x12;
+constexpr uint8_t PAGE_SYNC_PARAMETERS = 8;  /* parameters per page sync message, max */
+
+/* MIDI clock follower (MidiClock) */
+constexpr uint32_t CLOCK_PPQN = 24;          /* clock ticks per quarter note (MIDI spec) */
+constexpr size_t CLOCK_FIT_TICKS = 24;       /* ticks in the tempo regression window (<= 255) */
+constexpr uint32_t CLOCK_TIMEOUT_MS = 500;   /* no tick for this long = clock lost */
 
 /* USB MIDI SysEx buffer size
- * Maximum size of SysEx messages that can be received/sent via USB MIDI.
+ * Size of the Teensy framework SysEx receive buffer. Longer messages arrive
+ * as several fragments (SysExChunkEvent) and are reassembled by
+ * TeensyUsbMidiIn, so this no longer bounds the message size.
  * Default Teensy value is 290 bytes.
- * Increase this if you need to handle larger SysEx messages.
  * NOTE: This value is automatically injected into the Teensy framework at build time.
  */
-constexpr size_t USB_SYSEX_MAX_SIZE = 16000;
+constexpr size_t USB_SYSEX_MAX_SIZE = 512;
+
+/* SysEx reassembly arena (RAM2)
+ * Largest message delivered whole as SysExEvent. Longer messages are still
+ * available fragment by fragment through SysExChunkEvent.
+ */
+constexpr size_t SYSEX_REASSEMBLY_SIZE = 4096;
+
+/* Asynchronous SysEx transmission (TeensyUsbMidiOut::sendSysExAsync)
+ * Queued messages are copied into a RAM2 arena and streamed a few USB
+ * packets (3 SysEx bytes each) per loop.
+ */
+constexpr size_t SYSEX_TX_ARENA_SIZE = 4096;      /* bytes - all pending async messages */
+constexpr size_t SYSEX_TX_PACKETS_PER_LOOP = 64;  /* USB-MIDI packets streamed per loop */
+
+/* USB MIDI virtual ports (TeensyUsbMidiOut, MidiTraffic)
+ * Cable of each traffic class when built with a multi-cable USB type
+ * (-D USB_MIDI4_SERIAL: the host sees four ports). A cable the USB type
+ * doesn't provide falls back to 0, so the single-cable default build sends
+ * everything on cable 0 in one stream as before. On separate cables, CC
+ * feedback is no longer held behind a dump: channel messages go out next to
+ * a half-sent SysEx on another cable, and the performance port is written
+ * first each loop.
+ */
+constexpr uint8_t USB_CABLE_CONTROL = 0;      /* CC, program change, sendSysEx() */
+constexpr uint8_t USB_CABLE_PERFORMANCE = 1;  /* notes, pitch bend, pressure, realtime */
+constexpr uint8_t USB_CABLE_BULK = 2;         /* sendSysExAsync() */
+
+/* Scheduled output (TeensyUsbMidiOut::schedule)
+ * An IntervalTimer sends due messages; a message waits at most one tick past
+ * its deadline, or a little more while the main loop is writing to USB.
+ */
+constexpr uint32_t SCHEDULER_TICK_US = 100;      /* microseconds */
+constexpr uint8_t SCHEDULER_IRQ_PRIORITY = 136;  /* below USB (112) and display DMA (128) */
+
+/* DIN MIDI output (SerialMidiOut)
+ * The UART transmit interrupt drains a RAM2 ring of DIN_TX_BUFFER_SIZE bytes
+ * (~320 ms of traffic at 31250 baud); messages that don't fit are dropped.
+ * Running status is re-sent at least every DIN_RUNNING_STATUS_REFRESH_MS so a
+ * receiver plugged in mid-stream resynchronizes.
+ */
+constexpr uint8_t DIN_OUTPUT_SERIAL = 2;     /* Serial2 (TX2 = pin 8), 0 = no DIN output */
+constexpr uint32_t DIN_BAUD_RATE = 31250;
+constexpr size_t DIN_TX_BUFFER_SIZE = 1024;               /* bytes */
+constexpr uint32_t DIN_RUNNING_STATUS_REFRESH_MS = 1000;  /* milliseconds, 0 = no running status */
 }  // namespace Midi
 
 /*
@@ -142,7 +298,36 @@ constexpr size_t USB_SYSEX_MAX_SIZE = 16000;
 namespace Input {
 constexpr uint32_t LONG_PRESS_DEFAULT_MS = 500;  /* milliseconds */
 constexpr uint32_t DOUBLE_TAP_WINDOW_MS = 300;   /* milliseconds */
-constexpr uint32_t BUTTON_DEBOUNCE_MS = 50;      /* milliseconds - software debounce for state changes */
+constexpr uint32_t GESTURE_SEQUENCE_STEP_MS = 400; /* milliseconds - max gap between sequence presses */
+constexpr uint32_t BUTTON_DEBOUNCE_MS = 50;      /* milliseconds - DebounceMode::Lockout dead time */
+constexpr uint8_t DEBOUNCE_STABLE_SAMPLES = 4;      /* DebounceMode::SampleHistory, 1-8 samples */
+constexpr uint8_t DEBOUNCE_INTEGRATOR_SAMPLES = 4;  /* DebounceMode::Integrator saturation */
+
+/* Button sampling (IntervalTimer) */
+constexpr uint32_t BUTTON_SAMPLE_RATE_HZ = 1000;      /* full scans per second, 0 = poll from main loop */
+constexpr uint8_t BUTTON_SAMPLER_IRQ_PRIORITY = 144;  /* below display DMA (128) */
+
+/* Encoder acceleration (default curve, see Hardware::EncoderAcceleration) */
+constexpr uint32_t ENCODER_ACCEL_SLOW_US = 20000; /* tick interval at or above: x1 */
+constexpr uint32_t ENCODER_ACCEL_FAST_US = 1500;  /* tick interval at or below: max */
+constexpr uint8_t ENCODER_ACCEL_MAX_MULTIPLIER = 8;
+
+/* Encoder edge storms (bouncing or worn encoder): over STORM_EDGES pin
+ * interrupts in STORM_WINDOW_US, the encoder's pin interrupts are turned off
+ * and its pins are polled by a timer, until STORM_HOLD_MS pass without an
+ * invalid quadrature transition or a single-pin bounce. 0 edges = never
+ * fall back.
+ */
+constexpr uint16_t ENCODER_STORM_EDGES = 200;       /* ~20000 edges/s, 20x a fast spin */
+constexpr uint32_t ENCODER_STORM_WINDOW_US = 10000; /* microseconds */
+constexpr uint32_t ENCODER_STORM_HOLD_MS = 2000;    /* milliseconds - polled before re-arming */
+constexpr uint32_t ENCODER_POLL_RATE_HZ = 4000;     /* pin samples per second while polled */
+constexpr uint8_t ENCODER_POLL_IRQ_PRIORITY = 144;  /* below display DMA (128) */
+
+/* EncoderFrameEvent: one dispatch per loop with every encoder that moved,
+ * after the per-encoder events (on while ControllerAPI::onEncoderFrame is held)
+ */
+constexpr bool ENCODER_FRAME_EVENTS = false;
 }  // namespace Input
 
 /*
@@ -154,11 +339,165 @@ namespace UI {
 constexpr bool SHOW_DEBUG_INFO = false;
 constexpr bool ENABLE_FULL_UI = true;
 
+/* Plugin view registry (ViewManager::registerPluginView)
+ * Registered views build their LVGL tree on first show; hibernating ones
+ * free it whenever another view (or core) takes the screen.
+ */
+constexpr size_t MAX_PLUGIN_VIEWS = 8;
+
+/* Off-screen view switching (ViewManager::showPluginView)
+ * Leaving the core screen, the new view is built and laid out on the hidden
+ * plugin screen: layout on the next frame, the swap on the one after, so the
+ * first frame on screen is only a render. Plugin to plugin switches share
+ * the plugin screen on display and are not deferred.
+ */
+constexpr bool PREPARE_VIEWS_OFFSCREEN = true;
+
+/* Boot
+ * FAST_BOOT: BootComplete fires on the first loop, once hardware and fonts
+ * are up, so plugins set up (and MIDI flows) while the splash animates; a
+ * plugin view shown meanwhile is loaded when the splash ends. Otherwise
+ * BootComplete waits for the splash. Build with -DSKIP_SPLASH for no splash.
+ */
+constexpr bool FAST_BOOT = true;
+constexpr unsigned long SPLASH_DURATION_MS = 1000;
+
 /* Basic colors */
 constexpr uint32_t COLOR_BLACK = 0x000000;
 constexpr uint32_t COLOR_WHITE = 0xFFFFFF;
+
+/* Glyph bitmap cache (GlyphCache, DTCM)
+ * Decoded A8 bitmaps of the most used glyphs of the parameter fonts, so
+ * labels redrawn while an encoder turns skip the flash read and RLE decode.
+ * 2-way set associative, LRU within a set. Memory: SLOTS * SLOT_BYTES.
+ */
+constexpr size_t GLYPH_CACHE_SLOTS = 64;        /* glyphs, even */
+constexpr size_t GLYPH_CACHE_SLOT_BYTES = 256;  /* largest cached glyph, box_w * box_h */
+constexpr size_t GLYPH_CACHE_FONTS = 2;         /* fonts wrapped with GlyphCache::wrap() */
+
+/* Virtualized ListOverlay (setItemSource)
+ * Only this many rows exist whatever the item count; they are rebound as
+ * the selection moves. MARGIN rows stay around the selection when possible.
+ */
+constexpr size_t LIST_VIRTUAL_ROWS = 8;   /* rows, ~4 visible in the overlay */
+constexpr size_t LIST_VIRTUAL_MARGIN = 2; /* rows kept above / below the selection */
+
+/* Widget flashes and fades (AnimationScheduler), advanced once per frame */
+constexpr size_t MAX_ANIMATIONS = 32; /* concurrently animated widgets */
+
+/* Frame-coalesced widget updates (ParameterUpdateBatch)
+ * Latest value per bound widget, applied once at the start of the next frame.
+ */
+constexpr size_t MAX_PARAMETER_BINDINGS = 32; /* widgets per batch, max 32 (dirty mask) */
+constexpr size_t PARAMETER_DISPLAY_BYTES = 32; /* display text kept per widget, NUL included */
+
+/* Cached static layers (StaticLayer)
+ * A frozen container is rendered once into an LVGL draw buffer (large heap
+ * tier, PSRAM) and blitted on later frames. Containers with an opaque
+ * background cache as RGB565, others as RGB565A8 (3 bytes per pixel).
+ */
+constexpr size_t STATIC_LAYER_BUDGET_BYTES = 128 * 1024; /* all frozen layers together */
+constexpr size_t STATIC_LAYER_MAX_CHILDREN = 32;         /* children hidden per frozen container */
+
+/* Two-line label layout (TextUtils, buffer variant)
+ * Glyph advance tables for the ASCII range, one per font, and an LRU of
+ * laid out labels keyed on (text hash, width, font), the source bytes
+ * compared on a hit. Text or a result longer than TEXT_LAYOUT_MAX_BYTES is
+ * laid out, not cached.
+ */
+constexpr size_t TEXT_LAYOUT_FONTS = 4;          /* fonts with an advance table */
+constexpr size_t TEXT_LAYOUT_CACHE_ENTRIES = 16; /* memoized labels */
+constexpr size_t TEXT_LAYOUT_MAX_BYTES = 48;     /* formatted label, NUL included */
 }  // namespace UI
 
+/*
+ * Plugin
+ *
+ * PluginManager scheduling. Plugins run by priority; each update() is timed.
+ * A plugin that overruns its budget is pushed back, and once the plugins of
+ * a loop have used LOOP_BUDGET_US the rest wait for the next loop.
+ */
+namespace Plugin {
+constexpr uint32_t UPDATE_BUDGET_US = 500;     /* microseconds - default per update() */
+constexpr uint32_t LOOP_BUDGET_US = 2000;      /* microseconds - all plugins, per loop */
+constexpr uint32_t OVERRUN_BACKOFF_US = 20000; /* microseconds - delay after an overrun */
+}  // namespace Plugin
+
+/*
+ * Storage
+ *
+ * Layout of the Teensy emulated EEPROM (4284 bytes on Teensy 4.1), and the
+ * presets' LittleFS partition in program flash (FlashPresetStore).
+ */
+namespace Storage {
+constexpr uint16_t MIDI_MAPPINGS_EEPROM_ADDRESS = 0; /* learned MIDI mappings (EepromMappingStore) */
+constexpr uint32_t PRESET_FLASH_SIZE = 256 * 1024;  /* program flash LittleFS partition */
+constexpr uint8_t PRESET_SLOTS = 32;                /* FlashPresetStore files */
+}  // namespace Storage
+
+/*
+ * Dispatch
+ *
+ * Main loop event dispatch.
+ * Events queued with IEventBus::post() are drained once per loop iteration,
+ * lane by lane (Realtime, Input, then UI). Values are max events per loop.
+ */
+namespace Dispatch {
+constexpr size_t REALTIME_EVENTS_PER_LOOP = 64;
+constexpr size_t INPUT_EVENTS_PER_LOOP = 32;
+constexpr size_t UI_EVENTS_PER_LOOP = 8;
+
+/* EVENTBUS_PROFILING builds: period of the dispatch cost dump on Serial */
+constexpr uint32_t PROFILE_DUMP_INTERVAL_MS = 5000; /* milliseconds, 0 = never */
+}  // namespace Dispatch
+
+/*
+ * Loop
+ *
+ * MidiStudioApp main loop stages (LoopScheduler). A period of 0 runs the
+ * stage on every pass; MIDI in, encoders, event dispatch and the USB flush
+ * always do. Runs longer than their budget are counted as overruns.
+ */
+namespace Loop {
+constexpr uint32_t BUTTONS_PERIOD_US = 1000;        /* 1 kHz, the sampler rate */
+constexpr uint32_t BINDING_TICK_PERIOD_US = 10000;  /* 100 Hz long-press / gesture timeouts */
+constexpr uint32_t UI_PERIOD_US = 0;  /* LVGLBridge paces frames itself (Display::FRAME_RATE_HZ) */
+constexpr uint32_t STAGE_BUDGET_US = 1000;          /* microseconds - default per stage run */
+constexpr uint32_t UI_BUDGET_US = 8000;             /* microseconds - a full frame render */
+constexpr uint32_t PASS_BUDGET_US = UI_BUDGET_US + 2000; /* whole pass (LoopMonitor trace) */
+constexpr size_t LOG_RECORDS_PER_PASS = 8;          /* deferred log lines printed per pass */
+constexpr bool IDLE_SLEEP = true;  /* WFI when a pass leaves nothing due (LoopScheduler) */
+}  // namespace Loop
+
+/*
+ * Benchmark
+ *
+ * env:benchmark firmware (LATENCY_BENCHMARK): synthetic encoder ticks from
+ * an IntervalTimer go through EncoderController -> EventBus -> MidiMapper ->
+ * TeensyUsbMidiOut, and the edge -> usbMIDI latency of each is recorded.
+ * RenderBenchmarkView animates fixed UI scenarios and reports frame figures.
+ * env:record (EVENT_RECORDER): EventRecorder records a live session and
+ * replays it, to compare builds under the same workload.
+ */
+namespace Benchmark {
+constexpr uint32_t START_DELAY_MS = 3000;         /* after boot, for the monitor to attach */
+constexpr uint32_t LATENCY_TICK_US = 10000;       /* above Midi::ENCODER_RATE_LIMIT_MS */
+constexpr size_t LATENCY_SAMPLES = 1000;          /* ticks per latency run */
+constexpr uint32_t THROUGHPUT_TICK_US = 50;       /* 20 kHz ticks, spread over all encoders */
+constexpr uint32_t THROUGHPUT_DURATION_MS = 2000;
+constexpr uint32_t REPEAT_INTERVAL_MS = 5000;     /* pause between two runs */
+
+/* Render benchmark view (RENDER_BENCHMARK builds, or the boot combo held) */
+constexpr uint32_t RENDER_SCENARIO_MS = 5000;     /* per scenario: knobs, lite, list, text */
+constexpr uint8_t RENDER_LIST_ITEMS = 64;
+
+/* Event recorder (EVENT_RECORDER builds) */
+constexpr size_t RECORD_CAPACITY = 65536;         /* 12-byte records in PSRAM (768 KB) */
+constexpr uint8_t REPLAY_EVENTS_PER_PASS = 16;    /* per loop pass, also the pace at speed 0 */
+constexpr uint8_t REPLAY_FAST_SPEED = 4;          /* accelerated replay ('F') */
+constexpr const char* RECORD_FILE = "session.rec"; /* on the SD card */
+}  // namespace Benchmark
+
 /*
  * Memory
  *
@@ -172,23 +511,94 @@ namespace Memory {
 /* Input system */
 constexpr size_t MAX_CONTROL_DEFINITIONS = Hardware::ENCODERS_COUNT + Hardware::BUTTONS_COUNT;
 constexpr size_t MAX_MIDI_MAPPINGS = MAX_CONTROL_DEFINITIONS;
+constexpr size_t MAX_BUTTON_BINDINGS = 64;  /* button bindings, combos count twice */
+constexpr size_t MAX_ENCODER_BINDINGS = 32;
+constexpr size_t BINDING_CALLBACK_SIZE = 4 * sizeof(void*); /* bytes - inline capture storage per binding */
+constexpr size_t MAX_BINDING_SCOPES = 64; /* distinct lv_obj_t scopes with cached visibility (<= 64) */
+constexpr size_t MAX_BINDING_LAYERS = 8;  /* named binding layers, including the base layer */
+constexpr size_t MAX_GESTURES = 16;       /* chords, sequences and hold+tap gestures */
+constexpr size_t MAX_GESTURE_LENGTH = 8;  /* buttons per chord or sequence */
+constexpr size_t MAX_GESTURE_NODES = 32;  /* sequence trie nodes, shared by all sequences */
+
+/* Button sampler transition ring (power of two) */
+constexpr size_t MAX_BUTTON_TRANSITIONS = 32;
 
 /* Event system */
-constexpr size_t MAX_EVENT_SUBSCRIBERS = 32;
-constexpr size_t MAX_EVENT_TYPES = 96;
-constexpr size_t MAX_CALLBACKS_PER_EVENT = 16;
+constexpr size_t MAX_EVENT_SUBSCRIBERS = 64;  /* shared subscriber pool, all event types */
+constexpr size_t MAX_DYNAMIC_EVENT_TYPES = 8;  /* event types not listed in EventRegistry */
+constexpr size_t EVENT_CALLBACK_SIZE = 4 * sizeof(void*); /* bytes - inline capture storage per subscriber */
+constexpr size_t MAX_REALTIME_LANE_EVENTS = 64; /* post() queue depth per lane (power of two) */
+constexpr size_t MAX_INPUT_LANE_EVENTS = 32;
+constexpr size_t MAX_UI_LANE_EVENTS = 16;
+constexpr size_t MAX_COALESCED_EVENTS = 16; /* pending "latest value wins" events (all types) */
+constexpr size_t MAX_EVENT_MESSAGE_LENGTH = 31; /* chars - inline text in system/plugin events */
+constexpr size_t MAX_PLUGIN_NAME_LENGTH = 15;   /* chars - plugin name carried by plugin events */
+constexpr size_t MAX_DEFERRED_EVENT_SIZE = 24;  /* bytes - largest event accepted by post() */
 
 /* MIDI system */
 constexpr size_t MAX_MIDI_CALLBACKS = MAX_CONTROL_DEFINITIONS;
+constexpr size_t MAX_FILTERED_MIDI_CALLBACKS = 16; /* onCC/onNoteOn(channel, ...) filters (<= 16) */
 constexpr size_t MAX_MIDI_PENDING_PARAMS = MAX_CONTROL_DEFINITIONS;
-constexpr size_t MAX_MIDI_MESSAGES_QUEUE = 32;
+constexpr size_t MAX_MIDI_MESSAGES_QUEUE = 32; /* USB MIDI messages batched per loop */
+constexpr size_t MAX_SYSEX_HANDLERS = 8;       /* SysExRouter prefix handlers */
+constexpr size_t MAX_SYSEX_PREFIX_LENGTH = 6;  /* bytes after 0xF0: manufacturer ID + command */
+constexpr size_t MAX_SYSEX_TX_JOBS = 8;         /* pending sendSysExAsync() messages */
+constexpr size_t MAX_SCHEDULED_MIDI = 64;       /* pending TeensyUsbMidiOut::schedule() messages */
+constexpr size_t MAX_REALTIME_LISTENERS = 4;    /* MIDI clock / transport fast-lane listeners */
+constexpr size_t MAX_CLOCK_LISTENERS = 4;       /* MidiClock tick callbacks */
+constexpr size_t MAX_MIDI_INPUT_PORTS = 2;      /* MidiRouter sources */
+constexpr size_t MAX_MIDI_OUTPUT_PORTS = 4;     /* MidiRouter destinations (<= 8) */
+constexpr size_t MAX_MIDI_ROUTES = 16;          /* MidiRouter thru routes */
+
+/* Parameter store (ControllerAPI::parameters()) */
+constexpr size_t MAX_PARAMETERS = 64;          /* < 255 */
+/* Sized to what the labels show: a longer stored text would only be cut again there */
+constexpr size_t PARAMETER_NAME_LENGTH = UI::TEXT_LAYOUT_MAX_BYTES - 1;     /* chars */
+constexpr size_t PARAMETER_DISPLAY_LENGTH = UI::PARAMETER_DISPLAY_BYTES - 1; /* value text */
 
 /* UI system */
 constexpr size_t MAX_NAVIGATION_ACTIONS = 32;
 constexpr size_t MAX_UI_COMPONENTS = 16;
 
+/* Plugin system */
+constexpr size_t MAX_PLUGINS = 8;
+
+/* Plugin arenas (PluginArena): one block per plugin holds the plugin object
+ * and what it allocates through ControllerAPI::allocate() / allocator<T>(),
+ * released with the plugin. 0 = plugins allocate from the heap.
+ */
+constexpr size_t PLUGIN_ARENA_SIZE = 32 * 1024;  /* bytes per plugin */
+constexpr bool PLUGIN_ARENA_PSRAM = true;        /* false = block from the RAM2 heap */
+
+/* RAM2 (OCRAM) budget
+ * The DMAMEM buffers are placed first and the malloc heap gets the rest.
+ * The LVGL fast arena (LVGLMemory.cpp) is capped to what the display and
+ * SysEx buffers leave above RAM2_HEAP_MIN, so double buffering shrinks it.
+ */
+constexpr size_t RAM2_SIZE = 512 * 1024;
+constexpr size_t RAM2_HEAP_MIN = 16 * 1024; /* kept for malloc (USB, DIN TX, plugin blocks) */
+constexpr size_t RAM2_DISPLAY_BYTES =       /* RGB565 framebuffer, LVGL buffer(s), diffs */
+    Display::FRAMEBUFFER_SIZE * 2 +
+    Display::LVGL_BUFFER_SIZE * 2 * (Display::LVGL_DOUBLE_BUFFER ? 2 : 1) +
+    Display::DIFFBUFFER_SIZE * 2;
+constexpr size_t RAM2_MIDI_BYTES = Midi::SYSEX_REASSEMBLY_SIZE + Midi::SYSEX_TX_ARENA_SIZE;
+
 /* Task scheduler */
 constexpr size_t MAX_SCHEDULED_TASKS = 8;
+constexpr size_t MAX_LOOP_STAGES = 12;  /* MidiStudioApp LoopScheduler stages */
+constexpr uint8_t LOOP_OVERRUN_TRACES = 8;  /* recent over-budget passes kept (power of two) */
+
+/* Deferred logging (DEBUG_LOGS builds, log/AsyncLog.hpp) */
+constexpr size_t LOG_RING_SIZE = 8192;   /* bytes, power of two - boot logs fit */
+constexpr size_t LOG_RECORD_SIZE = 128;  /* bytes - format pointer and arguments */
+constexpr size_t LOG_STRING_LENGTH = 48; /* chars kept per %s argument */
+constexpr size_t LOG_LINE_LENGTH = 192;  /* chars per formatted line */
+
+/* Section profiler (SECTION_PROFILING builds, log/Profiler.hpp) */
+constexpr size_t MAX_PROFILE_SECTIONS = 16;
+
+/* Heap tracker (HEAP_TRACKING builds, log/HeapTracker.hpp) */
+constexpr size_t MAX_HEAP_CALL_SITES = 32; /* distinct malloc / new callers kept */
 }  // namespace Memory
 
 }  // namespace System
@@ -29,10 +29,28 @@
 
 #define LVGL_REFRESH_PERIOD_MS 10
 
+/* Native host builds (env:native) have no DMAMEM / PSRAM: plain builtin heap */
+#ifdef NATIVE_HAL
+#define LVGL_USE_DMA_MEMORY 0
+#else
 #define LVGL_USE_DMA_MEMORY 1
+#endif
 #define LVGL_MEMORY_POOL_SIZE_KB 2048
 #define LVGL_MEMORY_POOL_SIZE (LVGL_MEMORY_POOL_SIZE_KB * 1024)
 
+/* Tiered allocator (LVGLMemory.cpp): allocations up to LVGL_FAST_MAX_ALLOC
+ * bytes (objects, styles, timers) come from an internal RAM2 arena, larger
+ * ones (layers, images, caches) from PSRAM, capped at LVGL_MEMORY_POOL_SIZE.
+ * 0 = LVGL builtin TLSF over a single PSRAM pool. */
+#ifdef NATIVE_HAL
+#define LVGL_TIERED_MEMORY 0
+#else
+#define LVGL_TIERED_MEMORY 1
+#endif
+#define LVGL_FAST_POOL_SIZE_KB 64
+#define LVGL_FAST_POOL_SIZE (LVGL_FAST_POOL_SIZE_KB * 1024)
+#define LVGL_FAST_MAX_ALLOC 256
+
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE 8
 #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 128
 #define LV_CACHE_DEF_SIZE (64 * 1024)
@@ -51,7 +69,11 @@
    STDLIB WRAPPER SETTINGS
  *=========================*/
 
+#if LVGL_TIERED_MEMORY
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+#else
 #define LV_USE_STDLIB_MALLOC LV_STDLIB_BUILTIN
+#endif
 #define LV_USE_STDLIB_STRING LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF LV_STDLIB_BUILTIN
 
@@ -123,7 +145,14 @@
 
 #endif
 
-#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_NONE  /* Pas d'ASM (Cortex-M7 n'a ni NEON ni Helium) */
+/* No NEON/Helium on the Cortex-M7: RGB565 fills and blends go through our own
+ * kernels (LVGLDrawKernels.cpp), bit-exact with LVGL's C loops */
+#ifdef NATIVE_HAL
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_NONE
+#else
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE "adapter/display/ui/LVGLDrawKernels.hpp"
+#endif
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS 0
 #endif
 
@@ -341,7 +370,7 @@
  * OTHERS
  *==================*/
 
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1  /* StaticLayer */
 
 #ifdef DEBUG_LOGS
 #define LV_USE_SYSMON 1
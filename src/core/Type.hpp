@@ -24,7 +24,7 @@ enum class EncoderBindingType : uint8_t {
 enum class PinMode { PULLUP, PULLDOWN, RAW };
 
 struct GpioPin {
-    enum class Source { MCU, MUX };
+    enum class Source { MCU, MUX, SHIFT_REG };
 
     Source source = Source::MCU;
     uint8_t pin = 0;
@@ -50,6 +50,9 @@ struct GpioPin {
         if (source == Source::MUX) {
             return pin <= 15;
         }
+        if (source == Source::SHIFT_REG) {
+            return true;  // Chain length: ButtonReader::isValid()
+        }
         return pin <= 99;
     }
 };
@@ -61,3 +64,8 @@ inline constexpr GpioPin mcuPin(uint8_t pinNum, PinMode mode = PinMode::PULLUP)
 inline constexpr GpioPin muxPin(uint8_t channel, PinMode mode = PinMode::PULLUP) {
     return GpioPin(GpioPin::Source::MUX, channel, mode);
 }
+
+/** @brief Input of the 74HC165 chain (ShiftRegisterInput), pulled up on the board */
+inline constexpr GpioPin shiftRegPin(uint8_t input) {
+    return GpioPin(GpioPin::Source::SHIFT_REG, input, PinMode::PULLUP);
+}
@@ -1,10 +1,16 @@
 ﻿#pragma once
 
+#include "EventRegistry.hpp"
 #include "UnifiedEventTypes.hpp"
 
 class Event {
 public:
-    Event(EventCategoryType category, EventType type) : category_(category), type_(type) {}
+    template <EventCategoryType Category, EventType Type>
+    explicit Event(EventKey<Category, Type>)
+        : category_(Category), slot_(EventKey<Category, Type>::SLOT), type_(Type) {}
+
+    Event(EventCategoryType category, EventType type)
+        : category_(category), slot_(EventRegistry::findSlot(category, type)), type_(type) {}
 
     ~Event() = default;
 
@@ -16,7 +22,12 @@ public:
         return type_;
     }
 
+    EventRegistry::EventSlot getSlot() const {
+        return slot_;
+    }
+
 protected:
     EventCategoryType category_;
+    EventRegistry::EventSlot slot_;
     EventType type_;
 };
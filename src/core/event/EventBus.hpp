@@ -1,90 +1,510 @@
 #pragma once
 
-#include <etl/map.h>
+#include <etl/array.h>
+#include <etl/flat_map.h>
 #include <etl/vector.h>
 
-#include <memory>
+#include <string.h>
+
+#include <utility>
 
 #include "Event.hpp"
+#include "EventProfiler.hpp"
+#include "EventQueue.hpp"
+#include "EventRegistry.hpp"
 #include "IEventBus.hpp"
 #include "UnifiedEventTypes.hpp"
 #include "config/System.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "core/util/PluginAccounting.hpp"
 
+/**
+ * @brief Synchronous publish/subscribe bus with deferred ISR-safe priority lanes
+ *
+ * Subscribers live in a fixed pool of MAX_EVENT_SUBSCRIBERS entries, linked
+ * per event slot in subscription order. A SubscriptionId encodes
+ * (pool index, generation), so off() is constant time and stale ids are ignored.
+ * off() may be called from inside a callback: the entry is disabled at once
+ * and unlinked when the outermost emit() returns.
+ *
+ * post() routes each event to the queue of its EventLane (see EventRegistry).
+ * Types registered with coalesce() keep only their latest pending value per key.
+ */
 class EventBus : public IEventBus {
 public:
-    EventBus() : nextId_(1) {}
+    EventBus() : freeHead_(NONE), dispatchDepth_(0), pendingRemoval_(false), coalescedCount_(0) {
+        heads_.fill(NONE);
+        tails_.fill(NONE);
+        coalesceKeys_.fill(nullptr);
+        for (auto& sub : pool_) {
+            sub.generation = 0;
+        }
+        resetPool();
+    }
+
+    using IEventBus::emit;
+    using IEventBus::on;
 
     SubscriptionId on(EventCategoryType category, EventType type, EventCallback callback) override {
-        if (!callback) {
+        if (!callback || freeHead_ == NONE) {
             return 0;
         }
 
-        uint32_t key = makeKey(category, type);
-        SubscriptionId id = nextId_++;
+        EventRegistry::EventSlot slot = resolveSlot(category, type, true);
+        if (slot == EventRegistry::INVALID_SLOT) {
+            return 0;
+        }
+        return onSlot(slot, std::move(callback));
+    }
 
-        auto it = callbackSubscriptions_.find(key);
-        if (it == callbackSubscriptions_.end()) {
-            CallbackList list;
-            list.push_back({id, callback});
-            callbackSubscriptions_[key] = list;
-        } else {
-            if (it->second.size() >= System::Memory::MAX_CALLBACKS_PER_EVENT) {
-                return 0;
+    HOT_CODE void emit(const Event& event) override {
+        EventRegistry::EventSlot slot = event.getSlot();
+        if (slot == EventRegistry::INVALID_SLOT) {
+            slot = resolveSlot(event.getCategory(), event.getType(), false);
+            if (slot == EventRegistry::INVALID_SLOT) {
+                return;
             }
-            it->second.push_back({id, callback});
+        }
+        emitSlot(slot, event);
+    }
+
+    /**
+     * @brief Dispatch events queued with post(), highest priority lane first
+     *
+     * Realtime is drained first, then Input. The UI lane only runs once both
+     * are empty, so UI traffic waits for the next loop when the bus falls behind.
+     *
+     * @return Number of events dispatched
+     */
+    HOT_CODE size_t dispatchPending() {
+        size_t dispatched = dispatchLane(EventLane::Realtime,
+                                         System::Dispatch::REALTIME_EVENTS_PER_LOOP);
+        dispatched += dispatchLane(EventLane::Input, System::Dispatch::INPUT_EVENTS_PER_LOOP);
+
+        if (realtimeQueue_.empty() && inputQueue_.empty()) {
+            dispatched += dispatchLane(EventLane::UI, System::Dispatch::UI_EVENTS_PER_LOOP);
         }
 
-        return id;
+        return dispatched;
     }
 
-    void emit(const Event& event) override {
-        uint32_t key = makeKey(event.getCategory(), event.getType());
-        auto it = callbackSubscriptions_.find(key);
-        if (it != callbackSubscriptions_.end()) {
-            for (const auto& sub : it->second) {
-                sub.callback(event);
-            }
+    /**
+     * @brief Dispatch queued events of a single lane
+     * @param budget Maximum number of events dispatched in this call
+     * @return Number of events dispatched
+     */
+    HOT_CODE size_t dispatchLane(EventLane lane, size_t budget) {
+        size_t dispatched = 0;
+        switch (lane) {
+            case EventLane::Realtime:
+                dispatched = drain(realtimeQueue_, budget);
+                break;
+            case EventLane::Input:
+                dispatched = drain(inputQueue_, budget);
+                break;
+            case EventLane::UI:
+                dispatched = drain(uiQueue_, budget);
+                break;
+            default:
+                return 0;
         }
+
+        if (dispatched < budget) {
+            dispatched += drainCoalesced(lane, budget - dispatched);
+        }
+        return dispatched;
+    }
+
+    bool hasPending() const {
+        return !realtimeQueue_.empty() || !inputQueue_.empty() || !uiQueue_.empty() ||
+               !coalesced_.empty();
+    }
+
+    void coalesce(EventCategoryType category, EventType type, CoalesceKeyFn keyFn) override {
+        EventRegistry::EventSlot slot = resolveSlot(category, type, true);
+        if (slot != EventRegistry::INVALID_SLOT) {
+            coalesceKeys_[slot] = keyFn;
+        }
+    }
+
+    /** @brief Number of posted events replaced by a newer one since boot */
+    uint32_t getCoalescedCount() const {
+        return coalescedCount_;
+    }
+
+    uint32_t getDroppedCount() const {
+        return realtimeQueue_.getDroppedCount() + inputQueue_.getDroppedCount() +
+               uiQueue_.getDroppedCount();
     }
 
     void off(SubscriptionId id) override {
-        for (auto& pair : callbackSubscriptions_) {
-            auto& list = pair.second;
-            for (auto it = list.begin(); it != list.end(); ++it) {
-                if (it->id == id) {
-                    list.erase(it);
-                    return;
-                }
-            }
+        uint8_t index = static_cast<uint8_t>(id & 0xFF);
+        uint8_t generation = static_cast<uint8_t>(id >> 8);
+        if (index >= POOL_SIZE) {
+            return;
+        }
+
+        Subscriber& sub = pool_[index];
+        if (!sub.active || sub.generation != generation) {
+            return;
+        }
+
+        sub.active = false;
+        if (dispatchDepth_ > 0) {
+            pendingRemoval_ = true;
+        } else {
+            release(index);
         }
     }
 
     void clear() {
-        callbackSubscriptions_.clear();
-        nextId_ = 1;
+        for (auto& sub : pool_) {
+            sub.callback.reset();
+        }
+        heads_.fill(NONE);
+        tails_.fill(NONE);
+        coalesceKeys_.fill(nullptr);
+        coalesced_.clear();
+        dynamicSlots_.clear();
+        resetPool();
     }
 
     size_t getSubscriberCount() const {
         size_t count = 0;
-        for (const auto& pair : callbackSubscriptions_) {
-            count += pair.second.size();
+        for (const auto& sub : pool_) {
+            if (sub.active) {
+                ++count;
+            }
         }
         return count;
     }
 
+#ifdef EVENTBUS_PROFILING
+    /**
+     * @brief Print dispatch cost per event slot and per live subscriber
+     */
+    void dumpProfile(Print& out) const {
+        profiler_.dumpEvents(out);
+        out.println("[EventProfiler] subscriber slot count total_cyc avg_us worst_us");
+        for (size_t i = 0; i < POOL_SIZE; ++i) {
+            const Subscriber& sub = pool_[i];
+            if (sub.active) {
+                profiler_.dumpSubscriber(out, makeId(static_cast<uint8_t>(i), sub.generation),
+                                         static_cast<uint8_t>(i), sub.slot);
+            }
+        }
+        out.printf("[EventProfiler] deferred events dropped: %lu\n", getDroppedCount());
+    }
+
+    void resetProfile() {
+        profiler_.reset();
+    }
+#endif
+
+protected:
+    SubscriptionId onSlot(EventRegistry::EventSlot slot, EventCallback callback) override {
+        if (!callback || freeHead_ == NONE) {
+            return 0;
+        }
+
+        uint8_t index = freeHead_;
+        Subscriber& sub = pool_[index];
+        freeHead_ = sub.next;
+
+        sub.callback = std::move(callback);
+        sub.slot = slot;
+        sub.owner = PluginAccounting::currentOwner();
+        sub.active = true;
+        sub.linked = true;
+        sub.next = NONE;
+        sub.prev = tails_[slot];
+
+        if (tails_[slot] != NONE) {
+            pool_[tails_[slot]].next = index;
+        } else {
+            heads_[slot] = index;
+        }
+        tails_[slot] = index;
+
+        return makeId(index, sub.generation);
+    }
+
+    HOT_CODE void emitSlot(EventRegistry::EventSlot slot, const Event& event) override {
+#ifdef EVENTBUS_PROFILING
+        uint32_t eventStart = EventProfiler::now();
+#endif
+
+        ++dispatchDepth_;
+        for (uint8_t index = heads_[slot]; index != NONE;) {
+            Subscriber& sub = pool_[index];
+#ifdef EVENTBUS_PROFILING
+            uint8_t current = index;
+#endif
+            index = sub.next;
+            if (sub.active) {
+#ifdef EVENTBUS_PROFILING
+                uint32_t start = EventProfiler::now();
+                {
+                    PluginAccounting::CallbackTimer timer(sub.owner);
+                    sub.callback(event);
+                }
+                profiler_.recordSubscriber(current, EventProfiler::now() - start);
+#else
+                PluginAccounting::CallbackTimer timer(sub.owner);
+                sub.callback(event);
+#endif
+            }
+        }
+        --dispatchDepth_;
+
+#ifdef EVENTBUS_PROFILING
+        profiler_.recordEvent(slot, EventProfiler::now() - eventStart);
+#endif
+
+        if (dispatchDepth_ == 0 && pendingRemoval_) {
+            collectRemoved();
+        }
+    }
+
+    bool enqueue(const Event& event, size_t size) override {
+        EventRegistry::EventSlot slot = event.getSlot();
+        if (slot == EventRegistry::INVALID_SLOT) {
+            slot = resolveSlot(event.getCategory(), event.getType(), false);
+        }
+
+        if (slot != EventRegistry::INVALID_SLOT && coalesceKeys_[slot] && !inInterrupt() &&
+            size <= System::Memory::MAX_DEFERRED_EVENT_SIZE && storeCoalesced(event, size, slot)) {
+            return true;
+        }
+
+        switch (EventRegistry::laneOf(event.getSlot())) {
+            case EventLane::Realtime:
+                return realtimeQueue_.push(&event, size);
+            case EventLane::Input:
+                return inputQueue_.push(&event, size);
+            default:
+                return uiQueue_.push(&event, size);
+        }
+    }
+
 private:
-    struct CallbackSubscription {
-        SubscriptionId id;
+    static constexpr size_t POOL_SIZE = System::Memory::MAX_EVENT_SUBSCRIBERS;
+    static constexpr uint8_t NONE = 0xFF;
+
+    static_assert(POOL_SIZE < NONE, "MAX_EVENT_SUBSCRIBERS must fit an 8-bit pool index");
+
+    struct Subscriber {
         EventCallback callback;
+        uint8_t generation;
+        uint8_t next;
+        uint8_t prev;
+        EventRegistry::EventSlot slot;
+        uint8_t owner;  // PluginAccounting owner at on()
+        bool active;
+        bool linked;
+    };
+
+    using DynamicSlotMap =
+        etl::flat_map<uint32_t, EventRegistry::EventSlot, EventRegistry::DYNAMIC_SLOT_COUNT>;
+    struct CoalescedEvent {
+        EventRegistry::EventSlot slot;
+        uint8_t size;
+        uint16_t key;
+        alignas(alignof(std::max_align_t)) uint8_t storage[System::Memory::MAX_DEFERRED_EVENT_SIZE];
     };
 
-    using CallbackList = etl::vector<CallbackSubscription, System::Memory::MAX_CALLBACKS_PER_EVENT>;
-    using SubscriptionMap = etl::map<uint32_t, CallbackList, System::Memory::MAX_EVENT_TYPES>;
+    using CoalescedList = etl::vector<CoalescedEvent, System::Memory::MAX_COALESCED_EVENTS>;
+
+    template <size_t Capacity>
+    using LaneQueue = EventQueue<Capacity, System::Memory::MAX_DEFERRED_EVENT_SIZE>;
+
+    static SubscriptionId makeId(uint8_t index, uint8_t generation) {
+        return static_cast<SubscriptionId>((static_cast<uint16_t>(generation) << 8) | index);
+    }
 
     uint32_t makeKey(EventCategoryType category, EventType type) const {
         return (static_cast<uint32_t>(category) << 16) | type;
     }
 
-    SubscriptionMap callbackSubscriptions_;
-    SubscriptionId nextId_;
+    static void bumpGeneration(Subscriber& sub) {
+        sub.generation = static_cast<uint8_t>(sub.generation + 1);
+        if (sub.generation == 0) {
+            sub.generation = 1;  // Keeps ids non-zero
+        }
+    }
+
+    void resetPool() {
+        for (size_t i = 0; i < POOL_SIZE; ++i) {
+            Subscriber& sub = pool_[i];
+            bumpGeneration(sub);  // Invalidates ids handed out before clear()
+            sub.next = (i + 1 < POOL_SIZE) ? static_cast<uint8_t>(i + 1) : NONE;
+            sub.prev = NONE;
+            sub.slot = EventRegistry::INVALID_SLOT;
+            sub.owner = PluginAccounting::NO_OWNER;
+            sub.active = false;
+            sub.linked = false;
+        }
+        freeHead_ = 0;
+        pendingRemoval_ = false;
+    }
+
+    /**
+     * @brief Unlink an entry from its slot list and return it to the free list
+     */
+    void release(uint8_t index) {
+        Subscriber& sub = pool_[index];
+        EventRegistry::EventSlot slot = sub.slot;
+
+        if (sub.prev != NONE) {
+            pool_[sub.prev].next = sub.next;
+        } else {
+            heads_[slot] = sub.next;
+        }
+        if (sub.next != NONE) {
+            pool_[sub.next].prev = sub.prev;
+        } else {
+            tails_[slot] = sub.prev;
+        }
+
+        sub.callback.reset();
+        sub.linked = false;
+        sub.slot = EventRegistry::INVALID_SLOT;
+        sub.prev = NONE;
+        bumpGeneration(sub);
+
+        sub.next = freeHead_;
+        freeHead_ = index;
+
+#ifdef EVENTBUS_PROFILING
+        profiler_.resetSubscriber(index);
+#endif
+    }
+
+    template <typename Queue>
+    size_t drain(Queue& queue, size_t budget) {
+        alignas(alignof(std::max_align_t)) uint8_t buffer[Queue::CELL_SIZE];
+        size_t dispatched = 0;
+
+        while (dispatched < budget && queue.pop(buffer) != 0) {
+            emit(*reinterpret_cast<const Event*>(buffer));
+            ++dispatched;
+        }
+
+        return dispatched;
+    }
+
+    static bool inInterrupt() {
+#if defined(__arm__)
+        uint32_t ipsr;
+        __asm__ volatile("mrs %0, ipsr" : "=r"(ipsr));
+        return ipsr != 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Overwrite the pending event with the same slot and key, or add one
+     * @return false if the coalescing table is full (caller queues normally)
+     */
+    bool storeCoalesced(const Event& event, size_t size, EventRegistry::EventSlot slot) {
+        uint16_t key = coalesceKeys_[slot](event);
+
+        for (auto& pending : coalesced_) {
+            if (pending.slot == slot && pending.key == key) {
+                memcpy(pending.storage, &event, size);
+                pending.size = static_cast<uint8_t>(size);
+                ++coalescedCount_;
+                return true;
+            }
+        }
+
+        if (coalesced_.full()) {
+            return false;
+        }
+
+        coalesced_.emplace_back();
+        CoalescedEvent& pending = coalesced_.back();
+        pending.slot = slot;
+        pending.key = key;
+        pending.size = static_cast<uint8_t>(size);
+        memcpy(pending.storage, &event, size);
+        return true;
+    }
+
+    /**
+     * @brief Dispatch pending coalesced events of one lane, oldest first
+     *
+     * Entries are moved out before dispatch so callbacks can post new ones.
+     */
+    size_t drainCoalesced(EventLane lane, size_t budget) {
+        CoalescedList batch;
+
+        for (size_t i = 0; i < coalesced_.size() && batch.size() < budget;) {
+            if (EventRegistry::laneOf(coalesced_[i].slot) == lane) {
+                batch.push_back(coalesced_[i]);
+                coalesced_.erase(coalesced_.begin() + i);
+            } else {
+                ++i;
+            }
+        }
+
+        for (const auto& pending : batch) {
+            emit(*reinterpret_cast<const Event*>(pending.storage));
+        }
+        return batch.size();
+    }
+
+    void collectRemoved() {
+        pendingRemoval_ = false;
+        for (size_t i = 0; i < POOL_SIZE; ++i) {
+            if (pool_[i].linked && !pool_[i].active) {
+                release(static_cast<uint8_t>(i));
+            }
+        }
+    }
+
+    /**
+     * @brief Slot for a pair, falling back to the dynamic table for unregistered events
+     * @param create Allocate a dynamic slot if the pair has none yet
+     */
+    EventRegistry::EventSlot resolveSlot(EventCategoryType category, EventType type, bool create) {
+        EventRegistry::EventSlot slot = EventRegistry::findSlot(category, type);
+        if (slot != EventRegistry::INVALID_SLOT) {
+            return slot;
+        }
+
+        uint32_t key = makeKey(category, type);
+        auto it = dynamicSlots_.find(key);
+        if (it != dynamicSlots_.end()) {
+            return it->second;
+        }
+
+        if (!create || dynamicSlots_.full()) {
+            return EventRegistry::INVALID_SLOT;
+        }
+
+        slot = static_cast<EventRegistry::EventSlot>(EventRegistry::STATIC_SLOT_COUNT +
+                                                     dynamicSlots_.size());
+        dynamicSlots_[key] = slot;
+        return slot;
+    }
+
+    Subscriber pool_[POOL_SIZE];
+    etl::array<uint8_t, EventRegistry::SLOT_COUNT> heads_;
+    etl::array<uint8_t, EventRegistry::SLOT_COUNT> tails_;
+    DynamicSlotMap dynamicSlots_;
+    etl::array<CoalesceKeyFn, EventRegistry::SLOT_COUNT> coalesceKeys_;
+    CoalescedList coalesced_;
+    LaneQueue<System::Memory::MAX_REALTIME_LANE_EVENTS> realtimeQueue_;
+    LaneQueue<System::Memory::MAX_INPUT_LANE_EVENTS> inputQueue_;
+    LaneQueue<System::Memory::MAX_UI_LANE_EVENTS> uiQueue_;
+    uint8_t freeHead_;
+    uint8_t dispatchDepth_;
+    bool pendingRemoval_;
+    uint32_t coalescedCount_;
+
+#ifdef EVENTBUS_PROFILING
+    EventProfiler profiler_;
+#endif
 };
@@ -0,0 +1,124 @@
+#pragma once
+
+#ifdef EVENTBUS_PROFILING
+
+#include <Arduino.h>
+
+#include "EventRegistry.hpp"
+#include "config/System.hpp"
+
+/**
+ * @brief Dispatch cost counters for EventBus (EVENTBUS_PROFILING builds only)
+ *
+ * Records count, total and worst-case DWT cycles per event slot and per
+ * subscriber pool entry. Cycle counts wrap after ~7 s of accumulated
+ * callback time at 600 MHz, so call reset() between measurement runs.
+ */
+class EventProfiler {
+public:
+    struct Stats {
+        uint32_t count;
+        uint32_t totalCycles;
+        uint32_t worstCycles;
+    };
+
+    EventProfiler() {
+        ARM_DEMCR |= ARM_DEMCR_TRCENA;
+        ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+        reset();
+    }
+
+    static uint32_t now() {
+        return ARM_DWT_CYCCNT;
+    }
+
+    void recordEvent(EventRegistry::EventSlot slot, uint32_t cycles) {
+        if (slot < EventRegistry::SLOT_COUNT) {
+            record(events_[slot], cycles);
+        }
+    }
+
+    void recordSubscriber(uint8_t index, uint32_t cycles) {
+        if (index < System::Memory::MAX_EVENT_SUBSCRIBERS) {
+            record(subscribers_[index], cycles);
+        }
+    }
+
+    /** @brief Forget a subscriber's history when its pool entry is reused */
+    void resetSubscriber(uint8_t index) {
+        if (index < System::Memory::MAX_EVENT_SUBSCRIBERS) {
+            subscribers_[index] = {0, 0, 0};
+        }
+    }
+
+    const Stats& getEventStats(EventRegistry::EventSlot slot) const {
+        return events_[slot];
+    }
+
+    const Stats& getSubscriberStats(uint8_t index) const {
+        return subscribers_[index];
+    }
+
+    void reset() {
+        for (auto& stats : events_) {
+            stats = {0, 0, 0};
+        }
+        for (auto& stats : subscribers_) {
+            stats = {0, 0, 0};
+        }
+    }
+
+    /**
+     * @brief Print the per-event table (cycles, average and worst in microseconds)
+     */
+    void dumpEvents(Print& out) const {
+        out.println("[EventProfiler] slot cat type count total_cyc avg_us worst_us");
+        for (size_t slot = 0; slot < EventRegistry::SLOT_COUNT; ++slot) {
+            const Stats& stats = events_[slot];
+            if (stats.count == 0) {
+                continue;
+            }
+            int category = -1;
+            int type = -1;
+            if (slot < EventRegistry::STATIC_SLOT_COUNT) {
+                category = EventRegistry::EVENTS[slot].category;
+                type = EventRegistry::EVENTS[slot].type;
+            }
+            out.printf("  %2u %2d %5d %8lu %10lu %7.2f %8.2f\n", static_cast<unsigned>(slot),
+                       category, type, stats.count, stats.totalCycles,
+                       toMicros(stats.totalCycles) / stats.count, toMicros(stats.worstCycles));
+        }
+    }
+
+    /**
+     * @brief Print one subscriber row (called by EventBus, which knows the ids)
+     */
+    void dumpSubscriber(Print& out, uint16_t id, uint8_t index,
+                        EventRegistry::EventSlot slot) const {
+        const Stats& stats = subscribers_[index];
+        if (stats.count == 0) {
+            return;
+        }
+        out.printf("  0x%04x %2u %8lu %10lu %7.2f %8.2f\n", id, static_cast<unsigned>(slot),
+                   stats.count, stats.totalCycles, toMicros(stats.totalCycles) / stats.count,
+                   toMicros(stats.worstCycles));
+    }
+
+private:
+    static void record(Stats& stats, uint32_t cycles) {
+        ++stats.count;
+        stats.totalCycles += cycles;
+        if (cycles > stats.worstCycles) {
+            stats.worstCycles = cycles;
+        }
+    }
+
+    static float toMicros(uint32_t cycles) {
+        return static_cast<float>(cycles) / static_cast<float>(F_CPU_ACTUAL / 1000000);
+    }
+
+    Stats events_[EventRegistry::SLOT_COUNT];
+    Stats subscribers_[System::Memory::MAX_EVENT_SUBSCRIBERS];
+};
+
+#endif  // EVENTBUS_PROFILING
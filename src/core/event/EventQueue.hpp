@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Fixed-capacity lock-free ring of raw event storage
+ *
+ * Bounded multi-producer / single-consumer queue (per-cell sequence numbers).
+ * push() never blocks and never allocates, so it may be called from ISRs
+ * (EncoderTool callbacks, IntervalTimer) as well as from the main loop.
+ * pop() must only be called from a single context (the main loop).
+ *
+ * Each cell holds a byte copy of one event, so only trivially copyable
+ * events fit (see IEventBus::post()).
+ *
+ * @tparam Capacity Number of cells (power of two)
+ * @tparam CellSize Maximum size in bytes of one stored event
+ */
+template <size_t Capacity, size_t CellSize>
+class EventQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "EventQueue capacity must be a power of two");
+
+public:
+    static constexpr size_t CELL_SIZE = CellSize;
+
+    EventQueue() : enqueuePos_(0), dequeuePos_(0), dropped_(0) {
+        for (size_t i = 0; i < Capacity; ++i) {
+            cells_[i].sequence.store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /**
+     * @brief Copy size bytes into the next free cell
+     * @return false if the queue is full or the payload is too large (counted as dropped)
+     */
+    bool push(const void* data, size_t size) {
+        if (size > CellSize) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint32_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & MASK];
+            uint32_t seq = cell.sequence.load(std::memory_order_acquire);
+            int32_t diff = static_cast<int32_t>(seq - pos);
+
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    memcpy(cell.storage, data, size);
+                    cell.size = static_cast<uint8_t>(size);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Copy the oldest event out and release its cell
+     * @param out Destination buffer of at least CellSize bytes
+     * @return Size of the event copied, 0 if the queue is empty
+     */
+    size_t pop(void* out) {
+        uint32_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & MASK];
+        uint32_t seq = cell.sequence.load(std::memory_order_acquire);
+
+        if (static_cast<int32_t>(seq - (pos + 1)) < 0) {
+            return 0;
+        }
+
+        size_t size = cell.size;
+        memcpy(out, cell.storage, size);
+        cell.sequence.store(pos + Capacity, std::memory_order_release);
+        dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+        return size;
+    }
+
+    bool empty() const {
+        uint32_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        uint32_t seq = cells_[pos & MASK].sequence.load(std::memory_order_acquire);
+        return static_cast<int32_t>(seq - (pos + 1)) < 0;
+    }
+
+    size_t capacity() const {
+        return Capacity;
+    }
+
+    /** @brief Number of events rejected since boot (queue full or oversized) */
+    uint32_t getDroppedCount() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t MASK = static_cast<uint32_t>(Capacity - 1);
+
+    struct Cell {
+        std::atomic<uint32_t> sequence;
+        uint8_t size;
+        alignas(alignof(std::max_align_t)) uint8_t storage[CellSize];
+    };
+
+    Cell cells_[Capacity];
+    std::atomic<uint32_t> enqueuePos_;
+    std::atomic<uint32_t> dequeuePos_;
+    std::atomic<uint32_t> dropped_;
+};
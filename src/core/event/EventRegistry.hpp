@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "UnifiedEventTypes.hpp"
+#include "config/System.hpp"
+
+/**
+ * @brief Compile-time map of every known (category, type) pair to a dense slot
+ *
+ * Event IDs in UnifiedEventTypes.hpp are sparse, so EventBus indexes its
+ * subscriber table by slot instead of by (category, type). Core events
+ * resolve their slot at compile time through EventKey; any pair not listed
+ * here (plugin-defined events) gets a dynamic slot from EventBus at runtime.
+ *
+ * Each entry also selects the EventLane used by IEventBus::post().
+ * Add an entry here when adding an event type to UnifiedEventTypes.hpp.
+ */
+namespace EventRegistry {
+
+using EventSlot = uint8_t;
+constexpr EventSlot INVALID_SLOT = 0xFF;
+
+struct Entry {
+    EventCategoryType category;
+    EventType type;
+    EventLane lane;
+};
+
+constexpr Entry EVENTS[] = {
+    /* System */
+    {EventCategory::System, SystemEvent::ViewChange, EventLane::UI},
+    {EventCategory::System, SystemEvent::ModeChange, EventLane::UI},
+    {EventCategory::System, SystemEvent::Error, EventLane::UI},
+    {EventCategory::System, SystemEvent::BootComplete, EventLane::UI},
+    {EventCategory::System, SystemEvent::PluginRegistered, EventLane::UI},
+    {EventCategory::System, SystemEvent::PluginActivated, EventLane::UI},
+    {EventCategory::System, SystemEvent::PluginDeactivated, EventLane::UI},
+    {EventCategory::System, SystemEvent::PluginError, EventLane::UI},
+
+    /* Input */
+    {EventCategory::Input, InputEvent::EncoderChanged, EventLane::Input},
+    {EventCategory::Input, InputEvent::EncoderFrame, EventLane::Input},
+    {EventCategory::Input, InputEvent::ButtonPress, EventLane::Input},
+    {EventCategory::Input, InputEvent::ButtonRelease, EventLane::Input},
+    {EventCategory::Input, InputEvent::ButtonLongPress, EventLane::Input},
+    {EventCategory::Input, InputEvent::ButtonCombo, EventLane::Input},
+    {EventCategory::Input, InputEvent::ButtonDoublePress, EventLane::Input},
+
+    /* MIDI */
+    {EventCategory::MIDI, MidiEvent::NoteOn, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::NoteOff, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::CC, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::ProgramChange, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::PitchBend, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::ChannelPressure, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::PolyPressure, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::SongPosition, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::Transport, EventLane::Realtime},
+    {EventCategory::MIDI, MidiEvent::Mapping, EventLane::UI},
+    {EventCategory::MIDI, MidiEvent::SysEx, EventLane::UI},
+    {EventCategory::MIDI, MidiEvent::SysExChunk, EventLane::UI},
+};
+
+constexpr size_t STATIC_SLOT_COUNT = sizeof(EVENTS) / sizeof(EVENTS[0]);
+constexpr size_t DYNAMIC_SLOT_COUNT = System::Memory::MAX_DYNAMIC_EVENT_TYPES;
+constexpr size_t SLOT_COUNT = STATIC_SLOT_COUNT + DYNAMIC_SLOT_COUNT;
+
+static_assert(SLOT_COUNT < INVALID_SLOT, "Too many event slots for EventSlot");
+
+/**
+ * @brief Slot of a registered (category, type) pair
+ * @return Dense index into EVENTS, INVALID_SLOT if the pair is not registered
+ */
+constexpr EventSlot findSlot(EventCategoryType category, EventType type) {
+    for (size_t i = 0; i < STATIC_SLOT_COUNT; ++i) {
+        if (EVENTS[i].category == category && EVENTS[i].type == type) {
+            return static_cast<EventSlot>(i);
+        }
+    }
+    return INVALID_SLOT;
+}
+
+constexpr bool hasDuplicates() {
+    for (size_t i = 0; i < STATIC_SLOT_COUNT; ++i) {
+        if (findSlot(EVENTS[i].category, EVENTS[i].type) != i) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static_assert(!hasDuplicates(), "Duplicate (category, type) pair in EventRegistry::EVENTS");
+
+/**
+ * @brief Dispatch lane of a slot (dynamic slots always go to the UI lane)
+ */
+constexpr EventLane laneOf(EventSlot slot) {
+    return (slot < STATIC_SLOT_COUNT) ? EVENTS[slot].lane : EventLane::UI;
+}
+
+}  // namespace EventRegistry
+
+/**
+ * @brief Compile-time event identity, resolves its registry slot at compile time
+ *
+ * Each event class names its own as Key, which IEventBus::on<EventT>() and
+ * emit() use to reach the slot's subscriber list directly:
+ *
+ * @code
+ * class MyEvent : public Event {
+ * public:
+ *     using Key = EventKey<EventCategory::MIDI, MidiEvent::CC>;
+ *     MyEvent() : Event(Key()) {}
+ * };
+ * @endcode
+ */
+template <EventCategoryType Category, EventType Type>
+struct EventKey {
+    static constexpr EventCategoryType CATEGORY = Category;
+    static constexpr EventType TYPE = Type;
+    static constexpr EventRegistry::EventSlot SLOT = EventRegistry::findSlot(Category, Type);
+    static_assert(SLOT != EventRegistry::INVALID_SLOT,
+                  "Event (category, type) is not registered in EventRegistry::EVENTS");
+};
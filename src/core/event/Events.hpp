@@ -5,56 +5,147 @@
 #include "Event.hpp"
 #include "UnifiedEventTypes.hpp"
 #include "config/InputID.hpp"
-
+#include "config/System.hpp"
+#include "core/interface/midi/MidiInput.hpp"
+#include "core/util/InlineString.hpp"
+#include "core/util/UNorm16.hpp"
+
+using EventMessage = InlineString<System::Memory::MAX_EVENT_MESSAGE_LENGTH>;
+using PluginName = InlineString<System::Memory::MAX_PLUGIN_NAME_LENGTH>;
+
+/*
+ * Input events
+ *
+ * timestampUs is micros() at the hardware edge (encoder interrupt or button
+ * scan sample), 0 if unknown. Wraps every ~71 minutes: compare by difference.
+ */
 class EncoderChangedEvent : public Event {
 public:
-    EncoderChangedEvent(EncoderID encoderId, float normalizedValue)
-        : Event(EventCategory::Input, InputEvent::EncoderChanged),
+    using Key = EventKey<EventCategory::Input, InputEvent::EncoderChanged>;
+
+    EncoderChangedEvent(EncoderID encoderId, float normalizedValue, uint32_t timestampUs = 0,
+                        int16_t delta = 0)
+        : Event(Key()),
           encoderId(encoderId),
-          normalizedValue(normalizedValue) {}
+          normalizedValue(normalizedValue),
+          value(UNorm16::fromFloat(normalizedValue)),
+          timestampUs(timestampUs),
+          delta(delta) {}
+
+    EncoderChangedEvent(EncoderID encoderId, UNorm16 value, uint32_t timestampUs = 0)
+        : Event(Key()),
+          encoderId(encoderId),
+          normalizedValue(value.toFloat()),
+          value(value),
+          timestampUs(timestampUs) {}
 
     EncoderID encoderId;
-    float normalizedValue;
+    float normalizedValue;  // Relative encoders: detent count, not clamped
+    UNorm16 value;          // Same value, exact (clamped to 0.0-1.0)
+    uint32_t timestampUs;
+    int16_t delta = 0;  // Relative encoders: detents turned since the last event
+};
+
+/**
+ * @brief Every encoder that moved in one flush, in one dispatch
+ *
+ * Emitted by EncoderController::flushAllEvents() after the loop's
+ * EncoderChangedEvents, when frame events are on (setFrameEvents,
+ * ControllerAPI::onEncoderFrame). Bit encoderIndex(id) of changedMask marks
+ * the encoders in the frame; their entries hold the fields of their own
+ * EncoderChangedEvent, the others are left as they were.
+ */
+class EncoderFrameEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::Input, InputEvent::EncoderFrame>;
+
+    static_assert(ENCODER_ID_COUNT <= 16, "changedMask holds one bit per encoder");
+
+    EncoderFrameEvent() : Event(Key()) {}
+
+    void add(const EncoderChangedEvent& event) {
+        const uint8_t index = encoderIndex(event.encoderId);
+        if (index >= ENCODER_ID_COUNT) return;
+        if (changedMask == 0 || static_cast<int32_t>(event.timestampUs - timestampUs) < 0) {
+            timestampUs = event.timestampUs;
+        }
+        changedMask |= static_cast<uint16_t>(1u << index);
+        normalizedValues[index] = event.normalizedValue;
+        values[index] = event.value;
+        deltas[index] = event.delta;
+    }
+
+    bool changed(EncoderID encoderId) const {
+        const uint8_t index = encoderIndex(encoderId);
+        return index < ENCODER_ID_COUNT && (changedMask & (1u << index)) != 0;
+    }
+
+    void clear() {
+        changedMask = 0;
+        timestampUs = 0;
+    }
+
+    uint16_t changedMask = 0;  // Bit encoderIndex(id)
+    uint32_t timestampUs = 0;  // Earliest edge in the frame
+    float normalizedValues[ENCODER_ID_COUNT];
+    UNorm16 values[ENCODER_ID_COUNT];
+    int16_t deltas[ENCODER_ID_COUNT];
 };
 
 class ButtonPressEvent : public Event {
 public:
-    ButtonPressEvent(ButtonID buttonId, bool pressed)
-        : Event(EventCategory::Input, InputEvent::ButtonPress),
+    using Key = EventKey<EventCategory::Input, InputEvent::ButtonPress>;
+
+    ButtonPressEvent(ButtonID buttonId, bool pressed, uint32_t timestampUs = 0)
+        : Event(Key()),
           buttonId(buttonId),
-          pressed(pressed) {}
+          pressed(pressed),
+          timestampUs(timestampUs) {}
 
     ButtonID buttonId;
     bool pressed;
+    uint32_t timestampUs;
 };
 
 class ButtonReleaseEvent : public Event {
 public:
-    explicit ButtonReleaseEvent(ButtonID buttonId)
-        : Event(EventCategory::Input, InputEvent::ButtonRelease), buttonId(buttonId) {}
+    using Key = EventKey<EventCategory::Input, InputEvent::ButtonRelease>;
+
+    explicit ButtonReleaseEvent(ButtonID buttonId, uint32_t timestampUs = 0)
+        : Event(Key()),
+          buttonId(buttonId),
+          timestampUs(timestampUs) {}
 
     ButtonID buttonId;
+    uint32_t timestampUs;
 };
 
 class MidiCCEvent : public Event {
 public:
-    MidiCCEvent(uint8_t channel, uint8_t controller, uint8_t value, uint8_t source = 0)
-        : Event(EventCategory::MIDI, MidiEvent::CC),
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::CC>;
+
+    MidiCCEvent(uint8_t channel, uint8_t controller, uint8_t value, uint8_t source = 0,
+                MidiOrigin origin = MidiOrigin::Host)
+        : Event(Key()),
           channel(channel),
           controller(controller),
           value(value),
-          source(source) {}
+          source(source),
+          origin(origin) {}
 
     uint8_t channel;
     uint8_t controller;
     uint8_t value;
     uint8_t source;
+    MidiOrigin origin;
 };
 
 class MidiNoteOnEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::NoteOn>;
+
     MidiNoteOnEvent(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t source = 0)
-        : Event(EventCategory::MIDI, MidiEvent::NoteOn),
+        : Event(Key()),
           channel(channel),
           note(note),
           velocity(velocity),
@@ -68,8 +159,10 @@ public:
 
 class MidiNoteOffEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::NoteOff>;
+
     MidiNoteOffEvent(uint8_t channel, uint8_t note, uint8_t velocity, uint8_t source = 0)
-        : Event(EventCategory::MIDI, MidiEvent::NoteOff),
+        : Event(Key()),
           channel(channel),
           note(note),
           velocity(velocity),
@@ -81,11 +174,97 @@ public:
     uint8_t source;
 };
 
+class MidiProgramChangeEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::ProgramChange>;
+
+    MidiProgramChangeEvent(uint8_t channel, uint8_t program)
+        : Event(Key()),
+          channel(channel),
+          program(program) {}
+
+    uint8_t channel;
+    uint8_t program;
+};
+
+class MidiPitchBendEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::PitchBend>;
+
+    MidiPitchBendEvent(uint8_t channel, int16_t value)
+        : Event(Key()),
+          channel(channel),
+          value(value) {}
+
+    uint8_t channel;
+    int16_t value;  // -8192 to 8191, 0 = center
+};
+
+class MidiChannelPressureEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::ChannelPressure>;
+
+    MidiChannelPressureEvent(uint8_t channel, uint8_t pressure)
+        : Event(Key()),
+          channel(channel),
+          pressure(pressure) {}
+
+    uint8_t channel;
+    uint8_t pressure;
+};
+
+class MidiPolyPressureEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::PolyPressure>;
+
+    MidiPolyPressureEvent(uint8_t channel, uint8_t note, uint8_t pressure)
+        : Event(Key()),
+          channel(channel),
+          note(note),
+          pressure(pressure) {}
+
+    uint8_t channel;
+    uint8_t note;
+    uint8_t pressure;
+};
+
+class MidiSongPositionEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::SongPosition>;
+
+    explicit MidiSongPositionEvent(uint16_t beats)
+        : Event(Key()),
+          beats(beats) {}
+
+    uint16_t beats;  // MIDI beats (sixteenth notes) since song start
+};
+
+/**
+ * @brief Start / Continue / Stop / System Reset received
+ *
+ * Clock (0xF8) and Active Sensing (0xFE) are not emitted as events: they
+ * only reach TeensyUsbMidiIn realtime listeners (see MidiRealtimeCallback).
+ */
+class MidiTransportEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::Transport>;
+
+    MidiTransportEvent(uint8_t status, uint32_t timestampUs)
+        : Event(Key()),
+          status(status),
+          timestampUs(timestampUs) {}
+
+    uint8_t status;        // MidiRealtime::START, CONTINUE, STOP or SYSTEM_RESET
+    uint32_t timestampUs;  // micros() when the byte was decoded
+};
+
 class MidiMappingEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::Mapping>;
+
     MidiMappingEvent(uint8_t inputId, uint8_t midiType, uint8_t midiChannel, uint8_t midiNumber,
                      uint8_t midiValue)
-        : Event(EventCategory::MIDI, MidiEvent::Mapping),
+        : Event(Key()),
           inputId(inputId),
           midiType(midiType),
           midiChannel(midiChannel),
@@ -101,8 +280,10 @@ public:
 
 class SysExEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::SysEx>;
+
     SysExEvent(const uint8_t* data, uint16_t length)
-        : Event(EventCategory::MIDI, MidiEvent::SysEx),
+        : Event(Key()),
           data(data),
           length(length) {}
 
@@ -110,17 +291,44 @@ public:
     uint16_t length;      // Length of data
 };
 
+/**
+ * @brief One fragment of an incoming SysEx message, as delivered by USB
+ *
+ * Emitted for every fragment, before the message is complete, so large
+ * transfers can be consumed incrementally. The first fragment starts with
+ * 0xF0 (offset 0); the last one (complete = true) ends with 0xF7. data is
+ * only valid during dispatch (emit only, never post).
+ */
+class SysExChunkEvent : public Event {
+public:
+    using Key = EventKey<EventCategory::MIDI, MidiEvent::SysExChunk>;
+
+    SysExChunkEvent(const uint8_t* data, uint16_t length, uint32_t offset, bool complete)
+        : Event(Key()),
+          data(data),
+          length(length),
+          offset(offset),
+          complete(complete) {}
+
+    const uint8_t* data;  // Pointer to fragment data (no copy)
+    uint16_t length;      // Length of this fragment
+    uint32_t offset;      // Position of the fragment in the whole message
+    bool complete;        // Last fragment of the message
+};
+
 enum class ViewType : uint8_t;
 
 class SystemViewChangeEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::System, SystemEvent::ViewChange>;
+
     explicit SystemViewChangeEvent(ViewType targetView)
-        : Event(EventCategory::System, SystemEvent::ViewChange),
+        : Event(Key()),
           targetView(targetView),
           hasTarget(true) {}
 
     SystemViewChangeEvent()
-        : Event(EventCategory::System, SystemEvent::ViewChange),
+        : Event(Key()),
           targetView(static_cast<ViewType>(0)),
           hasTarget(false) {}
 
@@ -132,66 +340,91 @@ enum class SystemMode : uint8_t { Performance, Configuration, MidiLearn, Bootloa
 
 class SystemModeChangedEvent : public Event {
 public:
+    using Key = EventKey<EventCategory::System, SystemEvent::ModeChange>;
+
     explicit SystemModeChangedEvent(SystemMode mode)
-        : Event(EventCategory::System, SystemEvent::ModeChange), mode(mode) {}
+        : Event(Key()), mode(mode) {}
 
     SystemMode mode;
 };
 
 class SystemErrorEvent : public Event {
 public:
-    SystemErrorEvent(uint16_t errorCode, const String& message = "")
-        : Event(EventCategory::System, SystemEvent::Error),
+    using Key = EventKey<EventCategory::System, SystemEvent::Error>;
+
+    SystemErrorEvent(uint16_t errorCode, const char* message = "")
+        : Event(Key()),
           errorCode(errorCode),
           message(message) {}
 
     uint16_t errorCode;
-    String message;
+    EventMessage message;
 };
 
 class SystemBootCompleteEvent : public Event {
 public:
-    SystemBootCompleteEvent() : Event(EventCategory::System, SystemEvent::BootComplete) {}
+    using Key = EventKey<EventCategory::System, SystemEvent::BootComplete>;
+
+    SystemBootCompleteEvent()
+        : Event(Key()) {}
 };
 
+/*
+ * Plugin lifecycle events
+ *
+ * integrationId is the plugin index in PluginManager (registration order);
+ * name is a truncated copy for logs and display.
+ */
 class IntegrationRegisteredEvent : public Event {
 public:
-    IntegrationRegisteredEvent(const String& name, uint8_t integrationId)
-        : Event(EventCategory::System, SystemEvent::PluginRegistered),
+    using Key = EventKey<EventCategory::System, SystemEvent::PluginRegistered>;
+
+    IntegrationRegisteredEvent(const char* name, uint8_t integrationId)
+        : Event(Key()),
           name(name),
           integrationId(integrationId) {}
 
-    const String name;
-    const uint8_t integrationId;
+    PluginName name;
+    uint8_t integrationId;
 };
 
 class IntegrationActivatedEvent : public Event {
 public:
-    IntegrationActivatedEvent(const String& name, uint8_t integrationId)
-        : Event(EventCategory::System, SystemEvent::PluginActivated),
+    using Key = EventKey<EventCategory::System, SystemEvent::PluginActivated>;
+
+    IntegrationActivatedEvent(const char* name, uint8_t integrationId)
+        : Event(Key()),
           name(name),
           integrationId(integrationId) {}
 
-    const String name;
-    const uint8_t integrationId;
+    PluginName name;
+    uint8_t integrationId;
 };
 
 class IntegrationDeactivatedEvent : public Event {
 public:
-    IntegrationDeactivatedEvent(const String& name, uint8_t integrationId)
-        : Event(EventCategory::System, SystemEvent::PluginDeactivated),
+    using Key = EventKey<EventCategory::System, SystemEvent::PluginDeactivated>;
+
+    IntegrationDeactivatedEvent(const char* name, uint8_t integrationId)
+        : Event(Key()),
           name(name),
           integrationId(integrationId) {}
 
-    const String name;
-    const uint8_t integrationId;
+    PluginName name;
+    uint8_t integrationId;
 };
 
 class IntegrationErrorEvent : public Event {
 public:
-    IntegrationErrorEvent(const String& name, const String& error)
-        : Event(EventCategory::System, SystemEvent::PluginError), name(name), error(error) {}
+    using Key = EventKey<EventCategory::System, SystemEvent::PluginError>;
+
+    IntegrationErrorEvent(const char* name, uint8_t integrationId, const char* error)
+        : Event(Key()),
+          name(name),
+          integrationId(integrationId),
+          error(error) {}
 
-    const String name;
-    const String error;
+    PluginName name;
+    uint8_t integrationId;
+    EventMessage error;
 };
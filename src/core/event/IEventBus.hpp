@@ -1,19 +1,103 @@
 #pragma once
 
-#include <functional>
+#include <cstddef>
+#include <type_traits>
 
 #include "Event.hpp"
+#include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
 
-using SubscriptionId = uint8_t;
-using EventCallback = std::function<void(const Event&)>;
+using SubscriptionId = uint16_t;  // (generation << 8) | pool index, 0 = invalid
+using EventCallback = InplaceFunction<void(const Event&), System::Memory::EVENT_CALLBACK_SIZE>;
+
+/**
+ * @brief Identity of a coalescable event (e.g. encoder id, channel/CC pair)
+ *
+ * Two posted events of the same type with the same key are redundant:
+ * only the most recent one is dispatched.
+ */
+using CoalesceKeyFn = uint16_t (*)(const Event& event);
 
 class IEventBus {
 protected:
     ~IEventBus() = default;
 
+    /**
+     * @brief Copy a raw event into the deferred queue
+     * @param event Event to copy (the first size bytes of the concrete event object)
+     * @param size sizeof() the concrete event type
+     */
+    virtual bool enqueue(const Event& event, size_t size) = 0;
+
+    /** @brief on() / emit() with the registry slot already resolved (EventKey::SLOT) */
+    virtual SubscriptionId onSlot(EventRegistry::EventSlot slot, EventCallback callback) = 0;
+    virtual void emitSlot(EventRegistry::EventSlot slot, const Event& event) = 0;
+
 public:
     virtual SubscriptionId on(EventCategoryType category, EventType type,
                               EventCallback callback) = 0;
     virtual void emit(const Event& event) = 0;
     virtual void off(SubscriptionId id) = 0;
+
+    /**
+     * @brief Subscribe to one event class, callback(const EventT&)
+     *
+     * The slot comes from EventT::Key at compile time: no key lookup, and the
+     * downcast is done here once instead of by hand in every callback. The
+     * downcast is not checked. Untyped on() and emit() share the slot, so
+     * every event emitted or posted with EventT's key must be an EventT:
+     * another class with the same (category, type) is undefined behavior.
+     *
+     * @code
+     * bus.on<MidiCCEvent>([](const MidiCCEvent& cc) { ... });
+     * @endcode
+     */
+    template <typename EventT, typename Callback>
+    SubscriptionId on(Callback callback) {
+        static_assert(std::is_base_of<Event, EventT>::value, "on<EventT>() requires an Event");
+        return onSlot(EventT::Key::SLOT, [callback](const Event& event) {
+            callback(static_cast<const EventT&>(event));
+        });
+    }
+
+    /** @brief emit() to the compile-time slot of EventT (no slot check) */
+    template <typename EventT>
+    void emit(const EventT& event) {
+        static_assert(std::is_base_of<Event, EventT>::value, "emit() requires an Event");
+        emitSlot(EventT::Key::SLOT, event);
+    }
+
+    /**
+     * @brief Enable "latest value wins" for posted events of one type
+     *
+     * While an event of this type with the same key is still pending, post()
+     * overwrites it in place instead of queueing another one. Applies to
+     * main-loop post() calls only; events posted from an ISR are queued as usual.
+     *
+     * @param keyFn Key extractor, nullptr disables coalescing for the type
+     */
+    virtual void coalesce(EventCategoryType category, EventType type, CoalesceKeyFn keyFn) = 0;
+
+    /**
+     * @brief Queue an event for deferred dispatch from the main loop
+     *
+     * Unlike emit(), subscribers are not called here: the event is copied
+     * into the lock-free ring of its EventLane and dispatched on the next
+     * dispatchPending(), realtime lane first.
+     * Safe to call from interrupt context.
+     *
+     * The event is copied byte-wise, so pointers it carries (e.g. SysExEvent::data)
+     * must still be valid when the main loop dispatches it.
+     *
+     * @return false if the queue is full (event dropped)
+     */
+    template <typename T>
+    bool post(const T& event) {
+        static_assert(std::is_base_of<Event, T>::value, "post() requires an Event subclass");
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "post() requires a trivially copyable event (no String members)");
+        static_assert(sizeof(T) <= System::Memory::MAX_DEFERRED_EVENT_SIZE,
+                      "Event too large for the deferred queue - raise MAX_DEFERRED_EVENT_SIZE");
+        return enqueue(event, sizeof(T));
+    }
 };
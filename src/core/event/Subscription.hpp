@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "IEventBus.hpp"
+
+/**
+ * @brief Owning handle of a callback registration, removed on destruction
+ *
+ * Returned by the ControllerAPI on*() MIDI subscriptions. Keep it as a
+ * member of the plugin or view that owns the callback: when the owner goes
+ * away (or the handle is reassigned, e.g. on reconnect) the callback is
+ * unregistered, so stale callbacks never pile up in the shared pools.
+ *
+ * @code
+ * ccSub_ = api_.onCC([this](uint8_t ch, uint8_t cc, uint8_t v) { apply(cc, v); });
+ * @endcode
+ *
+ * Move-only. release() keeps the registration for good and forgets it.
+ */
+class [[nodiscard]] Subscription {
+public:
+    /** @brief Unregisters `id` from `owner` (an IEventBus, a router...) */
+    using ReleaseFn = void (*)(void* owner, uint16_t id);
+
+    Subscription() = default;
+
+    Subscription(void* owner, uint16_t id, ReleaseFn releaseFn)
+        : owner_(owner), id_(id), releaseFn_(releaseFn) {}
+
+    /** @brief Handle for an IEventBus::on() registration (id 0 = failed) */
+    static Subscription fromBus(IEventBus& bus, SubscriptionId id) {
+        if (id == 0) return Subscription();
+        return Subscription(&bus, id, [](void* owner, uint16_t busId) {
+            static_cast<IEventBus*>(owner)->off(static_cast<SubscriptionId>(busId));
+        });
+    }
+
+    ~Subscription() {
+        reset();
+    }
+
+    Subscription(const Subscription&) = delete;
+    Subscription& operator=(const Subscription&) = delete;
+
+    Subscription(Subscription&& other) noexcept
+        : owner_(other.owner_), id_(other.id_), releaseFn_(other.releaseFn_) {
+        other.releaseFn_ = nullptr;
+    }
+
+    Subscription& operator=(Subscription&& other) noexcept {
+        if (this != &other) {
+            reset();
+            owner_ = other.owner_;
+            id_ = other.id_;
+            releaseFn_ = other.releaseFn_;
+            other.releaseFn_ = nullptr;
+        }
+        return *this;
+    }
+
+    /** @brief Unregister now (no-op when empty) */
+    void reset() {
+        if (releaseFn_) {
+            ReleaseFn releaseFn = releaseFn_;
+            releaseFn_ = nullptr;
+            releaseFn(owner_, id_);
+        }
+    }
+
+    /** @brief Keep the registration for the life of the program */
+    void release() {
+        releaseFn_ = nullptr;
+    }
+
+    bool active() const {
+        return releaseFn_ != nullptr;
+    }
+
+    explicit operator bool() const {
+        return active();
+    }
+
+private:
+    void* owner_ = nullptr;
+    uint16_t id_ = 0;
+    ReleaseFn releaseFn_ = nullptr;
+};
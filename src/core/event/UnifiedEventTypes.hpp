@@ -13,6 +13,15 @@ constexpr EventCategoryType UI = 3;
 constexpr EventCategoryType Integration = 4;
 }  // namespace EventCategory
 
+/**
+ * @brief Deferred dispatch priority, drained in declaration order
+ *
+ * Realtime: MIDI channel/clock traffic, always drained first
+ * Input: buttons and encoders
+ * UI: view changes, system and plugin notifications, SysEx (deferrable)
+ */
+enum class EventLane : uint8_t { Realtime = 0, Input, UI, COUNT };
+
 namespace SystemEvent {
 constexpr EventType ViewChange = 4000;
 constexpr EventType ModeChange = 4001;
@@ -29,6 +38,7 @@ namespace InputEvent {
 constexpr EventType EncoderChanged = 100;
 constexpr EventType ButtonPress = 101;
 constexpr EventType ButtonRelease = 102;
+constexpr EventType EncoderFrame = 103;
 constexpr EventType ButtonLongPress = 5;
 constexpr EventType ButtonCombo = 6;
 constexpr EventType ButtonDoublePress = 7;
@@ -42,4 +52,9 @@ constexpr EventType ProgramChange = 2003;
 constexpr EventType PitchBend = 2004;
 constexpr EventType Mapping = 2005;
 constexpr EventType SysEx = 2006;
+constexpr EventType SysExChunk = 2007;
+constexpr EventType ChannelPressure = 2008;
+constexpr EventType PolyPressure = 2009;
+constexpr EventType SongPosition = 2010;
+constexpr EventType Transport = 2011;
 }  // namespace MidiEvent
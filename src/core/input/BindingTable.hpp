@@ -0,0 +1,130 @@
+#pragma once
+
+#include <etl/vector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief Fixed-capacity binding storage with a sorted key index
+ *
+ * Bindings live in a pool that only grows at the back; a parallel index of
+ * (key, slot) pairs is kept sorted so all bindings of one key are found with
+ * a binary search. Nothing is allocated after construction: registering or
+ * clearing bindings never touches the heap.
+ *
+ * Removal compacts the pool and rebuilds the index, and bumps generation()
+ * so a dispatch loop can detect that slots it collected are stale. Removal
+ * moves bindings, so it must not run while one of them is executing:
+ * InputBinding marks bindings removed during a dispatch and compacts after.
+ *
+ * @tparam Binding Binding struct (ButtonBinding, EncoderBinding)
+ * @tparam Capacity Maximum number of bindings (<= 255)
+ */
+template <typename Binding, size_t Capacity>
+class BindingTable {
+    static_assert(Capacity < 0xFF, "BindingTable slots are 8-bit");
+
+public:
+    using Slot = uint8_t;
+    using Slots = etl::vector<Slot, Capacity>;
+
+    /** @return false if the table is full */
+    bool add(uint32_t key, Binding&& binding) {
+        if (pool_.full()) {
+            return false;
+        }
+
+        const Slot slot = static_cast<Slot>(pool_.size());
+        pool_.push_back({key, std::move(binding)});
+
+        // After existing entries of the same key: registration order is kept
+        Entry entry{key, slot};
+        index_.insert(std::upper_bound(index_.begin(), index_.end(), entry, byKey), entry);
+        return true;
+    }
+
+    /** @brief Slots registered under key, in registration order */
+    void collect(uint32_t key, Slots& out) const {
+        out.clear();
+        Entry probe{key, 0};
+        auto range = std::equal_range(index_.begin(), index_.end(), probe, byKey);
+        for (auto it = range.first; it != range.second; ++it) {
+            out.push_back(it->slot);
+        }
+    }
+
+    bool contains(uint32_t key) const {
+        Entry probe{key, 0};
+        return std::binary_search(index_.begin(), index_.end(), probe, byKey);
+    }
+
+    Binding& operator[](Slot slot) {
+        return pool_[slot].binding;
+    }
+
+    size_t size() const {
+        return pool_.size();
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (Stored& stored : pool_) {
+            fn(stored.binding);
+        }
+    }
+
+    template <typename Predicate>
+    void removeIf(Predicate predicate) {
+        auto end = std::remove_if(pool_.begin(), pool_.end(),
+                                  [&](const Stored& stored) { return predicate(stored.binding); });
+        if (end == pool_.end()) {
+            return;
+        }
+
+        pool_.erase(end, pool_.end());
+        rebuildIndex();
+    }
+
+    void clear() {
+        pool_.clear();
+        index_.clear();
+        ++generation_;
+    }
+
+    /** @brief Changes whenever existing slots are invalidated */
+    uint32_t generation() const {
+        return generation_;
+    }
+
+private:
+    struct Stored {
+        uint32_t key;
+        Binding binding;
+    };
+
+    struct Entry {
+        uint32_t key;
+        Slot slot;
+    };
+
+    static bool byKey(const Entry& a, const Entry& b) {
+        return a.key < b.key;
+    }
+
+    // Same insertion as add(), replayed in pool order (std::stable_sort may allocate)
+    void rebuildIndex() {
+        index_.clear();
+        for (size_t i = 0; i < pool_.size(); ++i) {
+            Entry entry{pool_[i].key, static_cast<Slot>(i)};
+            index_.insert(std::upper_bound(index_.begin(), index_.end(), entry, byKey), entry);
+        }
+        ++generation_;
+    }
+
+    etl::vector<Stored, Capacity> pool_;
+    etl::vector<Entry, Capacity> index_;
+    uint32_t generation_ = 0;
+};
@@ -0,0 +1,136 @@
+#include "GestureEngine.hpp"
+
+#include "log/Macros.hpp"
+
+GestureEngine::GestureEngine() {
+    clear();
+}
+
+void GestureEngine::clear() {
+    nodes_.clear();
+    Node root;
+    root.next.fill(NO_NODE);
+    root.gesture = NONE;
+    nodes_.push_back(root);
+    sequenceState_ = ROOT;
+    lastStepMs_ = 0;
+
+    chords_.clear();
+
+    for (auto& row : holdTap_) {
+        row.fill(NONE);
+    }
+    holdTapMask_.fill(0);
+    heldAtTapPress_.fill(0);
+}
+
+bool GestureEngine::addChord(uint32_t mask, GestureId id) {
+    if (chords_.full() || chords_.find(mask) != chords_.end()) {
+        LOGLN("[GestureEngine] ERROR: Chord table full or duplicate chord");
+        return false;
+    }
+    chords_[mask] = id;
+    return true;
+}
+
+bool GestureEngine::addSequence(const uint8_t* indices, uint8_t length, GestureId id) {
+    // A sequence that is a prefix of another would fire halfway through it: the longer
+    // one could never complete, the matcher restarts on the shorter one's last press
+    uint8_t node = ROOT;
+    for (uint8_t i = 0; i < length && node != NO_NODE; ++i) {
+        node = nodes_[node].next[indices[i]];
+        if (node == NO_NODE) break;
+        if (nodes_[node].gesture != NONE && i + 1 < length) {
+            LOGLN("[GestureEngine] ERROR: Sequence extends an existing sequence");
+            return false;
+        }
+    }
+    if (node != NO_NODE && nodes_[node].gesture == NONE) {
+        for (uint8_t next : nodes_[node].next) {
+            if (next != NO_NODE) {
+                LOGLN("[GestureEngine] ERROR: Sequence is the start of an existing sequence");
+                return false;
+            }
+        }
+    }
+
+    node = ROOT;
+    for (uint8_t i = 0; i < length; ++i) {
+        uint8_t next = nodes_[node].next[indices[i]];
+        if (next == NO_NODE) {
+            if (nodes_.full()) {
+                LOGLN("[GestureEngine] ERROR: Sequence trie full");
+                return false;
+            }
+            Node child;
+            child.next.fill(NO_NODE);
+            child.gesture = NONE;
+            nodes_.push_back(child);
+            next = static_cast<uint8_t>(nodes_.size() - 1);
+            nodes_[node].next[indices[i]] = next;
+        }
+        node = next;
+    }
+
+    if (nodes_[node].gesture != NONE) {
+        LOGLN("[GestureEngine] ERROR: Duplicate sequence");
+        return false;
+    }
+    nodes_[node].gesture = id;
+    return true;
+}
+
+bool GestureEngine::addHoldTap(uint8_t holdIndex, uint8_t tapIndex, GestureId id) {
+    if (holdTap_[tapIndex][holdIndex] != NONE) {
+        LOGLN("[GestureEngine] ERROR: Duplicate hold+tap");
+        return false;
+    }
+    holdTap_[tapIndex][holdIndex] = id;
+    holdTapMask_[tapIndex] |= 1u << holdIndex;
+    return true;
+}
+
+uint8_t GestureEngine::step(uint8_t node, uint8_t index) const {
+    uint8_t next = nodes_[node].next[index];
+    if (next == NO_NODE && node != ROOT) {
+        next = nodes_[ROOT].next[index];  // Mismatch: this press may start a new sequence
+    }
+    return (next == NO_NODE) ? ROOT : next;
+}
+
+GestureEngine::Matches GestureEngine::onPress(uint8_t index, uint32_t pressedMask,
+                                              uint32_t nowMs) {
+    Matches matches;
+
+    auto chord = chords_.find(pressedMask);
+    if (chord != chords_.end()) {
+        matches.ids[matches.count++] = chord->second;
+    }
+
+    if (nodes_.size() > 1) {
+        if (nowMs - lastStepMs_ > System::Input::GESTURE_SEQUENCE_STEP_MS) {
+            sequenceState_ = ROOT;
+        }
+        lastStepMs_ = nowMs;
+
+        sequenceState_ = step(sequenceState_, index);
+        GestureId completed = nodes_[sequenceState_].gesture;
+        if (completed != NONE) {
+            matches.ids[matches.count++] = completed;
+            sequenceState_ = ROOT;
+        }
+    }
+
+    heldAtTapPress_[index] = pressedMask & holdTapMask_[index] & ~(1u << index);
+    return matches;
+}
+
+GestureEngine::GestureId GestureEngine::onRelease(uint8_t index, uint32_t pressedMask) {
+    // Hold button must have been down before the tap and still be down now
+    uint32_t holds = heldAtTapPress_[index] & pressedMask;
+    heldAtTapPress_[index] = 0;
+    if (holds == 0) {
+        return NONE;
+    }
+    return holdTap_[index][__builtin_ctz(holds)];
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <etl/array.h>
+#include <etl/flat_map.h>
+#include <etl/vector.h>
+
+#include <cstdint>
+
+#include "config/InputID.hpp"
+#include "config/System.hpp"
+
+/**
+ * @brief Compiled matcher for multi-button gestures
+ *
+ * Pure state machine over dense button indices (buttonIndex()), no callbacks:
+ * InputBinding compiles its gesture bindings into the tables below and feeds
+ * every button edge; the engine returns the ids of the gestures that matched.
+ *
+ * - Chord: an exact set of buttons held together, fires on the completing press
+ * - Sequence: presses in order, each within GESTURE_SEQUENCE_STEP_MS of the
+ *   previous one. All sequences share one trie whose nodes hold a transition
+ *   per button, so a press is one table lookup. No sequence may be the start
+ *   of another: addSequence() rejects it.
+ * - Hold+tap: tap a button (press and release) while another one is held
+ *
+ * An edge costs a fixed number of table lookups, independent of how many
+ * bindings exist (the chord table is a small sorted map, at most MAX_GESTURES).
+ * Each trigger holds one id: gestures bound to the same trigger in several
+ * layers are compiled once and resolved by InputBinding.
+ */
+class GestureEngine {
+public:
+    using GestureId = uint8_t;
+    static constexpr GestureId NONE = 0xFF;
+
+    /** Gestures completed by one press: at most one chord and one sequence */
+    struct Matches {
+        uint8_t count = 0;
+        GestureId ids[2] = {NONE, NONE};
+    };
+
+    GestureEngine();
+
+    /** @brief Drop every compiled gesture and reset matcher state */
+    void clear();
+
+    bool addChord(uint32_t mask, GestureId id);
+    bool addSequence(const uint8_t* indices, uint8_t length, GestureId id);
+    bool addHoldTap(uint8_t holdIndex, uint8_t tapIndex, GestureId id);
+
+    /**
+     * @param index Button pressed
+     * @param pressedMask Held buttons including index (bit = buttonIndex())
+     */
+    Matches onPress(uint8_t index, uint32_t pressedMask, uint32_t nowMs);
+
+    /**
+     * @param pressedMask Held buttons after the release
+     * @return Hold+tap gesture completed by this release, NONE otherwise
+     */
+    GestureId onRelease(uint8_t index, uint32_t pressedMask);
+
+private:
+    static_assert(BUTTON_ID_COUNT <= 32, "Gesture masks hold 32 buttons");
+
+    static constexpr uint8_t ROOT = 0;
+    static constexpr uint8_t NO_NODE = 0xFF;
+
+    struct Node {
+        etl::array<uint8_t, BUTTON_ID_COUNT> next;
+        GestureId gesture;
+    };
+
+    uint8_t step(uint8_t node, uint8_t index) const;
+
+    /* Sequences */
+    etl::vector<Node, System::Memory::MAX_GESTURE_NODES> nodes_;
+    uint8_t sequenceState_;
+    uint32_t lastStepMs_;
+
+    /* Chords: exact held mask -> gesture */
+    etl::flat_map<uint32_t, GestureId, System::Memory::MAX_GESTURES> chords_;
+
+    /* Hold+tap: [tap][hold] -> gesture, masks of holds that matter per tap */
+    etl::array<etl::array<GestureId, BUTTON_ID_COUNT>, BUTTON_ID_COUNT> holdTap_;
+    etl::array<uint32_t, BUTTON_ID_COUNT> holdTapMask_;
+    etl::array<uint32_t, BUTTON_ID_COUNT> heldAtTapPress_;
+};
@@ -3,22 +3,44 @@
 #include <Arduino.h>
 #include <lvgl.h>
 
+#include <algorithm>
+
 #include "core/event/Events.hpp"
+#include "core/util/MemoryPlacement.hpp"
 #include "log/Macros.hpp"
 #include "config/System.hpp"
 
+namespace {
+uint32_t gestureMask(const GestureBinding& gesture) {
+    uint32_t mask = 0;
+    for (ButtonID id : gesture.buttons) {
+        mask |= 1u << buttonIndex(id);
+    }
+    return mask;
+}
+
+/* Same buttons the engine matches: a chord is a set, the others are ordered */
+bool sameTrigger(const GestureBinding& a, const GestureBinding& b) {
+    if (a.type != b.type) return false;
+    if (a.type == GestureType::CHORD) return gestureMask(a) == gestureMask(b);
+    return a.buttons.size() == b.buttons.size() &&
+           std::equal(a.buttons.begin(), a.buttons.end(), b.buttons.begin());
+}
+}  // namespace
+
 InputBinding::InputBinding(IEventBus& eventBus) : eventBus_(eventBus) {
-    encoderSub_ = eventBus_.on(EventCategory::Input,
-                               InputEvent::EncoderChanged,
-                               [this](const Event& e) { onEncoderChanged(e); });
+    layerRanks_.fill(LAYER_INACTIVE);
+    layerRanks_[BASE_BINDING_LAYER] = 0;
+    layerNames_[BASE_BINDING_LAYER] = "base";
 
-    buttonPressSub_ = eventBus_.on(EventCategory::Input,
-                                   InputEvent::ButtonPress,
-                                   [this](const Event& e) { onButtonPress(e); });
+    encoderSub_ = eventBus_.on<EncoderChangedEvent>(
+        [this](const EncoderChangedEvent& e) { onEncoderChanged(e); });
 
-    buttonReleaseSub_ = eventBus_.on(EventCategory::Input,
-                                     InputEvent::ButtonRelease,
-                                     [this](const Event& e) { onButtonRelease(e); });
+    buttonPressSub_ =
+        eventBus_.on<ButtonPressEvent>([this](const ButtonPressEvent& e) { onButtonPress(e); });
+
+    buttonReleaseSub_ = eventBus_.on<ButtonReleaseEvent>(
+        [this](const ButtonReleaseEvent& e) { onButtonRelease(e); });
 
     LOGLN("[InputBinding] Initialized with direct type-safe API");
 }
@@ -31,19 +53,19 @@ InputBinding::~InputBinding() {
 }
 
 void InputBinding::onPressed(ButtonID id, ActionCallback cb) {
-    buttonBindings_.push_back(
+    addButtonBinding(
         {.type = ButtonBindingType::PRESS, .buttonId = id, .action = std::move(cb)});
     LOGF("[InputBinding] Added PRESS binding for ButtonID %d\n", static_cast<int>(id));
 }
 
 void InputBinding::onReleased(ButtonID id, ActionCallback cb) {
-    buttonBindings_.push_back(
+    addButtonBinding(
         {.type = ButtonBindingType::RELEASE, .buttonId = id, .action = std::move(cb)});
     LOGF("[InputBinding] Added RELEASE binding for ButtonID %d\n", static_cast<int>(id));
 }
 
 void InputBinding::onLongPress(ButtonID id, ActionCallback cb, uint32_t ms) {
-    buttonBindings_.push_back({.type = ButtonBindingType::LONG_PRESS,
+    addButtonBinding({.type = ButtonBindingType::LONG_PRESS,
                                .buttonId = id,
                                .longPressMs = ms,
                                .action = std::move(cb)});
@@ -53,13 +75,13 @@ void InputBinding::onLongPress(ButtonID id, ActionCallback cb, uint32_t ms) {
 }
 
 void InputBinding::onDoubleTap(ButtonID id, ActionCallback cb) {
-    buttonBindings_.push_back(
+    addButtonBinding(
         {.type = ButtonBindingType::DOUBLE_TAP, .buttonId = id, .action = std::move(cb)});
     LOGF("[InputBinding] Added DOUBLE_TAP binding for ButtonID %d\n", static_cast<int>(id));
 }
 
 void InputBinding::onCombo(ButtonID btn1, ButtonID btn2, ActionCallback cb) {
-    buttonBindings_.push_back({.type = ButtonBindingType::COMBO,
+    addButtonBinding({.type = ButtonBindingType::COMBO,
                                .buttonId = btn1,
                                .secondaryButton = btn2,
                                .action = std::move(cb)});
@@ -69,7 +91,7 @@ void InputBinding::onCombo(ButtonID btn1, ButtonID btn2, ActionCallback cb) {
 }
 
 void InputBinding::onTurned(EncoderID id, EncoderActionCallback cb) {
-    encoderBindings_.push_back({
+    addEncoderBinding({
         .type = EncoderBindingType::TURN,
         .encoderId = id,
         .action = std::move(cb)
@@ -79,7 +101,7 @@ void InputBinding::onTurned(EncoderID id, EncoderActionCallback cb) {
 
 void InputBinding::onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
                                         EncoderActionCallback cb) {
-    encoderBindings_.push_back({
+    addEncoderBinding({
         .type = EncoderBindingType::TURN_WHILE_PRESSED,
         .encoderId = encoderId,
         .requiredButton = buttonId,
@@ -90,7 +112,7 @@ void InputBinding::onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
 }
 
 void InputBinding::onPressed(ButtonID id, ActionCallback cb, lv_obj_t* scope) {
-    buttonBindings_.push_back({.type = ButtonBindingType::PRESS,
+    addButtonBinding({.type = ButtonBindingType::PRESS,
                                .buttonId = id,
                                .action = std::move(cb),
                                .scope = scope});
@@ -100,7 +122,7 @@ void InputBinding::onPressed(ButtonID id, ActionCallback cb, lv_obj_t* scope) {
 }
 
 void InputBinding::onReleased(ButtonID id, ActionCallback cb, lv_obj_t* scope) {
-    buttonBindings_.push_back({.type = ButtonBindingType::RELEASE,
+    addButtonBinding({.type = ButtonBindingType::RELEASE,
                                .buttonId = id,
                                .action = std::move(cb),
                                .scope = scope});
@@ -110,7 +132,7 @@ void InputBinding::onReleased(ButtonID id, ActionCallback cb, lv_obj_t* scope) {
 }
 
 void InputBinding::onLongPress(ButtonID id, ActionCallback cb, uint32_t ms, lv_obj_t* scope) {
-    buttonBindings_.push_back({.type = ButtonBindingType::LONG_PRESS,
+    addButtonBinding({.type = ButtonBindingType::LONG_PRESS,
                                .buttonId = id,
                                .longPressMs = ms,
                                .action = std::move(cb),
@@ -122,7 +144,7 @@ void InputBinding::onLongPress(ButtonID id, ActionCallback cb, uint32_t ms, lv_o
 }
 
 void InputBinding::onDoubleTap(ButtonID id, ActionCallback cb, lv_obj_t* scope) {
-    buttonBindings_.push_back({.type = ButtonBindingType::DOUBLE_TAP,
+    addButtonBinding({.type = ButtonBindingType::DOUBLE_TAP,
                                .buttonId = id,
                                .action = std::move(cb),
                                .scope = scope});
@@ -132,7 +154,7 @@ void InputBinding::onDoubleTap(ButtonID id, ActionCallback cb, lv_obj_t* scope)
 }
 
 void InputBinding::onCombo(ButtonID btn1, ButtonID btn2, ActionCallback cb, lv_obj_t* scope) {
-    buttonBindings_.push_back({.type = ButtonBindingType::COMBO,
+    addButtonBinding({.type = ButtonBindingType::COMBO,
                                .buttonId = btn1,
                                .secondaryButton = btn2,
                                .action = std::move(cb),
@@ -144,7 +166,7 @@ void InputBinding::onCombo(ButtonID btn1, ButtonID btn2, ActionCallback cb, lv_o
 }
 
 void InputBinding::onTurned(EncoderID id, EncoderActionCallback cb, lv_obj_t* scope) {
-    encoderBindings_.push_back({
+    addEncoderBinding({
         .type = EncoderBindingType::TURN,
         .encoderId = id,
         .action = std::move(cb),
@@ -156,7 +178,7 @@ void InputBinding::onTurned(EncoderID id, EncoderActionCallback cb, lv_obj_t* sc
 
 void InputBinding::onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
                                         EncoderActionCallback cb, lv_obj_t* scope) {
-    encoderBindings_.push_back({
+    addEncoderBinding({
         .type = EncoderBindingType::TURN_WHILE_PRESSED,
         .encoderId = encoderId,
         .requiredButton = buttonId,
@@ -167,315 +189,513 @@ void InputBinding::onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId,
          static_cast<int>(encoderId), static_cast<int>(buttonId), scope);
 }
 
-void InputBinding::clearScope(lv_obj_t* scope) {
-    auto buttonIt = buttonBindings_.begin();
-    while (buttonIt != buttonBindings_.end()) {
-        if (buttonIt->scope == scope) {
-            buttonIt = buttonBindings_.erase(buttonIt);
-        } else {
-            ++buttonIt;
-        }
+void InputBinding::addButtonBinding(ButtonBinding binding) {
+    binding.layer = buildLayer_;
+    if (binding.scope) {
+        binding.scopeSlot = acquireScopeSlot(binding.scope);
     }
 
-    auto encoderIt = encoderBindings_.begin();
-    while (encoderIt != encoderBindings_.end()) {
-        if (encoderIt->scope == scope) {
-            encoderIt = encoderBindings_.erase(encoderIt);
-        } else {
-            ++encoderIt;
-        }
+    const ButtonID buttonId = binding.buttonId;
+    const bool isLongPress = binding.type == ButtonBindingType::LONG_PRESS;
+    const bool scoped = binding.scope != nullptr;
+
+    // Combos fire on the release of either button: index them under both
+    const bool mirrored = binding.type == ButtonBindingType::COMBO &&
+                          binding.secondaryButton.has_value() &&
+                          *binding.secondaryButton != buttonId;
+    if (buttonBindings_.size() + (mirrored ? 2 : 1) > System::Memory::MAX_BUTTON_BINDINGS) {
+        LOGF("[InputBinding] ERROR: Cannot add button binding (max %d)\n",
+             static_cast<int>(System::Memory::MAX_BUTTON_BINDINGS));
+        return;
     }
 
-    LOGF("[InputBinding] Cleared all bindings for scope %p\n", scope);
-}
+    if (mirrored) {
+        ButtonBinding mirror = binding;
+        buttonBindings_.add(tableKey(buttonKey(*binding.secondaryButton, binding.type), scoped),
+                            std::move(mirror));
+    }
 
-void InputBinding::onEncoderChanged(const Event& event) {
-    auto& evt = static_cast<const EncoderChangedEvent&>(event);
-    triggerMatchingEncoderBindings(evt.encoderId, evt.normalizedValue);
-}
+    buttonBindings_.add(tableKey(buttonKey(buttonId, binding.type), scoped), std::move(binding));
 
-void InputBinding::onButtonPress(const Event& event) {
-    auto& evt = static_cast<const ButtonPressEvent&>(event);
-    ButtonID buttonId = evt.buttonId;
-    const uint32_t now = millis();
+    // Added while the button is held: the new duration may be the next deadline
+    const uint8_t index = buttonIndex(buttonId);
+    if (isLongPress && index != INVALID_INPUT_INDEX && pressed_.test(index) &&
+        !longPressTriggered_.test(index)) {
+        armLongPress(index, millis() - buttonStates_[index].pressTime);
+    }
+}
 
-    buttonStates_[buttonId] = true;
-    buttonPressTime_[buttonId] = now;
+void InputBinding::addEncoderBinding(EncoderBinding binding) {
+    binding.layer = buildLayer_;
+    if (binding.scope) {
+        binding.scopeSlot = acquireScopeSlot(binding.scope);
+    }
 
-    if (now - buttonReleaseTime_[buttonId] < System::Input::DOUBLE_TAP_WINDOW_MS) {
-        buttonTapCount_[buttonId]++;
-    } else {
-        buttonTapCount_[buttonId] = 1;
+    const uint32_t key = tableKey(encoderKey(binding.encoderId), binding.scope != nullptr);
+    if (!encoderBindings_.add(key, std::move(binding))) {
+        LOGF("[InputBinding] ERROR: Cannot add encoder binding (max %d)\n",
+             static_cast<int>(System::Memory::MAX_ENCODER_BINDINGS));
     }
+}
 
-    triggerMatchingButtonBindings(buttonId, ButtonBindingType::PRESS);
+void InputBinding::onChord(std::initializer_list<ButtonID> buttons, ActionCallback cb) {
+    addGesture(GestureType::CHORD, buttons, std::move(cb), nullptr);
 }
 
-void InputBinding::onButtonRelease(const Event& event) {
-    auto& evt = static_cast<const ButtonReleaseEvent&>(event);
-    ButtonID buttonId = evt.buttonId;
-    const uint32_t now = millis();
+void InputBinding::onSequence(std::initializer_list<ButtonID> buttons, ActionCallback cb) {
+    addGesture(GestureType::SEQUENCE, buttons, std::move(cb), nullptr);
+}
 
-    checkAndTriggerCombosOnRelease(buttonId);
+void InputBinding::onHoldTap(ButtonID hold, ButtonID tap, ActionCallback cb) {
+    addGesture(GestureType::HOLD_TAP, {hold, tap}, std::move(cb), nullptr);
+}
 
-    buttonStates_[buttonId] = false;
-    buttonReleaseTime_[buttonId] = now;
-    longPressTriggered_[buttonId] = false;
+void InputBinding::onChord(std::initializer_list<ButtonID> buttons, ActionCallback cb,
+                           lv_obj_t* scope) {
+    addGesture(GestureType::CHORD, buttons, std::move(cb), scope);
+}
 
-    triggerMatchingButtonBindings(buttonId, ButtonBindingType::RELEASE);
+void InputBinding::onSequence(std::initializer_list<ButtonID> buttons, ActionCallback cb,
+                              lv_obj_t* scope) {
+    addGesture(GestureType::SEQUENCE, buttons, std::move(cb), scope);
+}
 
-    checkAndTriggerDoubleTap(buttonId, now);
+void InputBinding::onHoldTap(ButtonID hold, ButtonID tap, ActionCallback cb, lv_obj_t* scope) {
+    addGesture(GestureType::HOLD_TAP, {hold, tap}, std::move(cb), scope);
 }
 
-bool InputBinding::triggerScopedButtonBindings(ButtonID buttonId, ButtonBindingType type) {
-    bool anyTriggered = false;
+void InputBinding::addGesture(GestureType type, std::initializer_list<ButtonID> buttons,
+                              ActionCallback cb, lv_obj_t* scope) {
+    if (gestures_.full() || buttons.size() < 2 ||
+        buttons.size() > System::Memory::MAX_GESTURE_LENGTH) {
+        LOGLN("[InputBinding] ERROR: Invalid gesture (2-8 buttons) or gesture table full");
+        return;
+    }
 
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.buttonId != buttonId) continue;
-        if (binding.type != type) continue;
-        if (binding.scope == nullptr) continue;  // ONLY scoped bindings
-        if (!isBindingActive(binding)) continue;  // Check scope visibility
+    GestureBinding gesture{.type = type, .action = std::move(cb), .scope = scope};
+    for (ButtonID id : buttons) {
+        gesture.buttons.push_back(id);
+    }
+    gesture.layer = buildLayer_;
+    if (scope) {
+        gesture.scopeSlot = acquireScopeSlot(scope);
+    }
 
-        if (binding.action) {
-            binding.action();
-            anyTriggered = true;
+    // A trigger already bound in another layer or scope is compiled once, fireGesture() picks
+    bool compiled = false;
+    for (const auto& other : gestures_) {
+        if (other.removed || !sameTrigger(other, gesture)) continue;
+        if (other.layer == gesture.layer && other.scope == gesture.scope) {
+            LOGLN("[InputBinding] ERROR: Duplicate gesture in this layer and scope");
+            return;
         }
+        compiled = true;
     }
 
-    return anyTriggered;
-}
+    auto id = static_cast<GestureEngine::GestureId>(gestures_.size());
+    if (!compiled && !compileGesture(gesture, id)) {
+        return;
+    }
+    gestures_.push_back(std::move(gesture));
+    LOGF("[InputBinding] Added gesture %d (type %d, %d buttons)\n", id, static_cast<int>(type),
+         static_cast<int>(buttons.size()));
+}
+
+bool InputBinding::compileGesture(const GestureBinding& gesture, GestureEngine::GestureId id) {
+    uint8_t indices[System::Memory::MAX_GESTURE_LENGTH];
+    uint32_t mask = 0;
+    for (size_t i = 0; i < gesture.buttons.size(); ++i) {
+        indices[i] = buttonIndex(gesture.buttons[i]);
+        if (indices[i] == INVALID_INPUT_INDEX) {
+            LOGLN("[InputBinding] ERROR: Gesture uses a ButtonID missing from BUTTON_IDS");
+            return false;
+        }
+        mask |= 1u << indices[i];
+    }
 
-bool InputBinding::triggerGlobalButtonBindings(ButtonID buttonId, ButtonBindingType type) {
-    bool anyTriggered = false;
+    switch (gesture.type) {
+        case GestureType::CHORD:
+            return gestureEngine_.addChord(mask, id);
+        case GestureType::SEQUENCE:
+            return gestureEngine_.addSequence(indices, static_cast<uint8_t>(gesture.buttons.size()),
+                                              id);
+        case GestureType::HOLD_TAP:
+            return indices[0] != indices[1] &&
+                   gestureEngine_.addHoldTap(indices[0], indices[1], id);
+    }
+    return false;
+}
 
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.buttonId != buttonId) continue;
-        if (binding.type != type) continue;
-        if (binding.scope != nullptr) continue;  // ONLY global bindings
+void InputBinding::recompileGestures() {
+    gestureEngine_.clear();
+    for (size_t i = 0; i < gestures_.size(); ++i) {
+        bool compiled = false;
+        for (size_t j = 0; j < i && !compiled; ++j) {
+            compiled = !gestures_[j].removed && sameTrigger(gestures_[j], gestures_[i]);
+        }
+        if (!compiled) {
+            compileGesture(gestures_[i], static_cast<GestureEngine::GestureId>(i));
+        }
+    }
+}
 
-        if (binding.action) {
-            binding.action();
-            anyTriggered = true;
+void InputBinding::fireGesture(GestureEngine::GestureId id) {
+    if (!bindingsEnabled_ || id >= gestures_.size()) return;
+
+    // id is the trigger: fire its binding in the top active layer, scoped first within a layer
+    GestureBinding* top = nullptr;
+    uint8_t topRank = LAYER_INACTIVE;
+    for (auto& gesture : gestures_) {
+        if (!gesture.enabled || gesture.removed || !gesture.action) continue;
+        if (!sameTrigger(gesture, gestures_[id])) continue;
+        const uint8_t rank = layerRanks_[gesture.layer];
+        if (rank == LAYER_INACTIVE || !isBindingActive(gesture)) continue;
+        if (!top || rank > topRank || (rank == topRank && gesture.scope && !top->scope)) {
+            top = &gesture;
+            topRank = rank;
         }
     }
+    if (!top) return;
 
-    return anyTriggered;
+    PluginAccounting::CallbackTimer timer(top->owner);
+    top->action();
+    scopesDirty_ = true;
 }
 
-void InputBinding::triggerMatchingButtonBindings(ButtonID buttonId, ButtonBindingType type) {
-    if (!bindingsEnabled_) return;
+void InputBinding::clearScope(lv_obj_t* scope) {
+    if (!scope) return;
+
+    removeBindings([scope](const auto& binding) { return binding.scope == scope; });
 
-    // PRIORITY 1: Try scoped bindings first
-    if (triggerScopedButtonBindings(buttonId, type)) {
-        // Scoped binding(s) handled it - stop propagation to globals
+    for (auto& slot : scopes_) {
+        if (slot == scope) {
+            slot = nullptr;
+        }
+    }
+
+    LOGF("[InputBinding] Cleared all bindings for scope %p\n", scope);
+}
+
+template <typename Predicate>
+void InputBinding::removeBindings(Predicate predicate) {
+    if (dispatchDepth_ > 0) {
+        auto mark = [&](auto& binding) {
+            if (predicate(binding)) {
+                binding.removed = true;
+                removalsPending_ = true;
+            }
+        };
+        buttonBindings_.forEach(mark);
+        encoderBindings_.forEach(mark);
+        for (auto& gesture : gestures_) {
+            mark(gesture);
+        }
         return;
     }
 
-    // PRIORITY 2: Fall back to global bindings
-    triggerGlobalButtonBindings(buttonId, type);
+    buttonBindings_.removeIf(predicate);
+    encoderBindings_.removeIf(predicate);
+    gestures_.erase(std::remove_if(gestures_.begin(), gestures_.end(), predicate),
+                    gestures_.end());
+    recompileGestures();
 }
 
-bool InputBinding::triggerScopedEncoderBindings(EncoderID encoderId, float encoderValue) {
-    bool anyTriggered = false;
+void InputBinding::compactRemoved() {
+    removalsPending_ = false;
+    removeBindings([](const auto& binding) { return binding.removed; });
+}
 
-    for (auto& binding : encoderBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.encoderId != encoderId) continue;
-        if (binding.scope == nullptr) continue;  // ONLY scoped bindings
-        if (!isBindingActive(binding)) continue;  // Check scope visibility
+HOT_CODE void InputBinding::onEncoderChanged(const EncoderChangedEvent& evt) {
+    DispatchScope dispatch(*this);
+    triggerMatchingEncoderBindings(evt.encoderId, evt.normalizedValue);
+}
 
-        // Handle TURN_WHILE_PRESSED condition
-        if (binding.type == EncoderBindingType::TURN_WHILE_PRESSED) {
-            if (binding.requiredButton.has_value()) {
-                auto it = buttonStates_.find(*binding.requiredButton);
-                if (it == buttonStates_.end() || !it->second) {
-                    continue;  // Required button not pressed, skip this binding
-                }
-            }
-        }
+HOT_CODE void InputBinding::onButtonPress(const ButtonPressEvent& evt) {
+    DispatchScope dispatch(*this);
+    ButtonID buttonId = evt.buttonId;
+    const uint32_t now = millis();
 
-        if (binding.action) {
-            binding.action(encoderValue);
-            anyTriggered = true;
-        }
+    const uint8_t index = buttonIndex(buttonId);
+    if (index == INVALID_INPUT_INDEX) return;
+
+    auto& state = buttonStates_[index];
+    pressed_.set(index);
+    state.pressTime = now;
+
+    if (now - state.releaseTime < System::Input::DOUBLE_TAP_WINDOW_MS) {
+        state.tapCount++;
+    } else {
+        state.tapCount = 1;
     }
 
-    return anyTriggered;
+    armLongPress(index, 0);
+
+    triggerMatchingButtonBindings(buttonId, ButtonBindingType::PRESS);
+
+    auto matches = gestureEngine_.onPress(index, static_cast<uint32_t>(pressed_.to_ulong()), now);
+    for (uint8_t i = 0; i < matches.count; ++i) {
+        fireGesture(matches.ids[i]);
+    }
 }
 
-bool InputBinding::triggerGlobalEncoderBindings(EncoderID encoderId, float encoderValue) {
-    bool anyTriggered = false;
+HOT_CODE void InputBinding::onButtonRelease(const ButtonReleaseEvent& evt) {
+    DispatchScope dispatch(*this);
+    ButtonID buttonId = evt.buttonId;
+    const uint32_t now = millis();
 
-    for (auto& binding : encoderBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.encoderId != encoderId) continue;
-        if (binding.scope != nullptr) continue;  // ONLY global bindings
+    const uint8_t index = buttonIndex(buttonId);
+    if (index == INVALID_INPUT_INDEX) return;
 
-        // Handle TURN_WHILE_PRESSED condition
-        if (binding.type == EncoderBindingType::TURN_WHILE_PRESSED) {
-            if (binding.requiredButton.has_value()) {
-                auto it = buttonStates_.find(*binding.requiredButton);
-                if (it == buttonStates_.end() || !it->second) {
-                    continue;  // Required button not pressed, skip this binding
-                }
-            }
-        }
+    checkAndTriggerCombosOnRelease(buttonId);
+
+    pressed_.reset(index);
+    buttonStates_[index].releaseTime = now;
+    longPressTriggered_.reset(index);
+    longPressArmed_.reset(index);
 
-        if (binding.action) {
-            binding.action(encoderValue);
-            anyTriggered = true;
+    triggerMatchingButtonBindings(buttonId, ButtonBindingType::RELEASE);
+
+    fireGesture(gestureEngine_.onRelease(index, static_cast<uint32_t>(pressed_.to_ulong())));
+
+    checkAndTriggerDoubleTap(index, now);
+}
+
+template <typename Table, typename Eligible, typename Fire>
+HOT_CODE void InputBinding::triggerScopedThenGlobal(Table& table, uint32_t controlKey,
+                                                    Eligible eligible, Fire fire) {
+    typename Table::Slots scopedSlots;
+    typename Table::Slots globalSlots;
+    table.collect(tableKey(controlKey, true), scopedSlots);
+    table.collect(tableKey(controlKey, false), globalSlots);
+    if (scopedSlots.empty() && globalSlots.empty()) return;
+
+    // Snapshot: an action may push or pop layers while we iterate
+    const auto ranks = layerRanks_;
+
+    auto rankOf = [&](auto& binding, bool scoped) -> uint8_t {
+        if (!binding.enabled || binding.removed) return LAYER_INACTIVE;
+        const uint8_t rank = ranks[binding.layer];
+        if (rank == LAYER_INACTIVE) return LAYER_INACTIVE;
+        if (scoped && !isBindingActive(binding)) return LAYER_INACTIVE;  // Check scope visibility
+        if (!eligible(binding)) return LAYER_INACTIVE;
+        return rank;
+    };
+
+    // The layer decides first: a global binding of a pushed layer beats a scoped base binding
+    uint8_t top = LAYER_INACTIVE;
+    bool topScoped = false;
+    for (auto slot : scopedSlots) {
+        const uint8_t rank = rankOf(table[slot], true);
+        if (rank != LAYER_INACTIVE && (top == LAYER_INACTIVE || rank > top)) {
+            top = rank;
+            topScoped = true;
         }
     }
+    for (auto slot : globalSlots) {
+        const uint8_t rank = rankOf(table[slot], false);
+        if (rank != LAYER_INACTIVE && (top == LAYER_INACTIVE || rank > top)) {
+            top = rank;
+            topScoped = false;
+        }
+    }
+    if (top == LAYER_INACTIVE) return;
+
+    // Bindings added by an action wait for the next event; removals invalidate the slots
+    const uint32_t generation = table.generation();
+    auto fireTop = [&](const typename Table::Slots& slots, bool scoped) -> bool {
+        bool anyTriggered = false;
+        for (auto slot : slots) {
+            if (table.generation() != generation) break;
+
+            auto& binding = table[slot];
+            if (rankOf(binding, scoped) != top) continue;
+
+            if (fire(binding)) {
+                anyTriggered = true;
+                scopesDirty_ = true;  // Actions may show or hide views
+            }
+        }
+        return anyTriggered;
+    };
 
-    return anyTriggered;
+    // Within the layer, scoped bindings first; globals only if none of them fired
+    if (topScoped && fireTop(scopedSlots, true)) return;
+    if (table.generation() != generation) return;
+    fireTop(globalSlots, false);
 }
 
-void InputBinding::triggerMatchingEncoderBindings(EncoderID encoderId, float encoderValue) {
+HOT_CODE void InputBinding::triggerMatchingButtonBindings(ButtonID buttonId,
+                                                          ButtonBindingType type) {
     if (!bindingsEnabled_) return;
 
-    // PRIORITY 1: Try scoped bindings first
-    if (triggerScopedEncoderBindings(encoderId, encoderValue)) {
-        // Scoped binding(s) handled it - stop propagation to globals
-        return;
-    }
+    auto any = [](ButtonBinding&) { return true; };
+    auto fire = [](ButtonBinding& binding) {
+        if (!binding.action) return false;
+        PluginAccounting::CallbackTimer timer(binding.owner);
+        binding.action();
+        return true;
+    };
 
-    // PRIORITY 2: Fall back to global bindings
-    triggerGlobalEncoderBindings(encoderId, encoderValue);
+    triggerScopedThenGlobal(buttonBindings_, buttonKey(buttonId, type), any, fire);
 }
 
-void InputBinding::checkAndTriggerLongPress(ButtonID buttonId, uint32_t now) {
-    if (!buttonStates_[buttonId]) return;
-    if (longPressTriggered_[buttonId]) return;
+HOT_CODE void InputBinding::triggerMatchingEncoderBindings(EncoderID encoderId,
+                                                           float encoderValue) {
+    if (!bindingsEnabled_) return;
 
-    auto pressTimeIt = buttonPressTime_.find(buttonId);
-    if (pressTimeIt == buttonPressTime_.end()) return;
+    // Handle TURN_WHILE_PRESSED condition
+    auto eligible = [this](EncoderBinding& binding) {
+        return binding.type != EncoderBindingType::TURN_WHILE_PRESSED ||
+               !binding.requiredButton.has_value() || isPressed(*binding.requiredButton);
+    };
+    auto fire = [encoderValue](EncoderBinding& binding) {
+        if (!binding.action) return false;
+        PluginAccounting::CallbackTimer timer(binding.owner);
+        binding.action(encoderValue);
+        return true;
+    };
 
-    bool scopedTriggered = false;
+    triggerScopedThenGlobal(encoderBindings_, encoderKey(encoderId), eligible, fire);
+}
+
+void InputBinding::checkAndTriggerLongPress(uint8_t index, uint32_t now) {
+    if (!pressed_.test(index)) return;
+    if (longPressTriggered_.test(index)) return;
 
-    // PASS 1: Check scoped bindings first (higher priority)
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.type != ButtonBindingType::LONG_PRESS) continue;
-        if (binding.buttonId != buttonId) continue;
-        if (binding.scope == nullptr) continue;  // ONLY scoped bindings
-        if (!isBindingActive(binding)) continue;  // Check scope visibility
+    const uint32_t heldMs = now - buttonStates_[index].pressTime;
 
+    auto elapsed = [heldMs](ButtonBinding& binding) {
         const uint32_t duration =
             binding.longPressMs > 0 ? binding.longPressMs : System::Input::LONG_PRESS_DEFAULT_MS;
-        if ((now - pressTimeIt->second) >= duration) {
-            longPressTriggered_[buttonId] = true;
-            if (binding.action) {
-                binding.action();
-                scopedTriggered = true;
+        return heldMs >= duration;
+    };
+    auto fire = [this, index](ButtonBinding& binding) {
+        longPressTriggered_.set(index);
+        if (!binding.action) return false;
+        PluginAccounting::CallbackTimer timer(binding.owner);
+        binding.action();
+        return true;
+    };
+
+    const uint32_t key = buttonKey(BUTTON_IDS[index], ButtonBindingType::LONG_PRESS);
+    triggerScopedThenGlobal(buttonBindings_, key, elapsed, fire);
+}
+
+void InputBinding::armLongPress(uint8_t index, uint32_t afterMs) {
+    const uint32_t key = buttonKey(BUTTON_IDS[index], ButtonBindingType::LONG_PRESS);
+
+    // Earliest binding duration still ahead of the current hold time
+    bool found = false;
+    uint32_t duration = 0;
+    ButtonTable::Slots slots;
+    for (bool scoped : {true, false}) {
+        buttonBindings_.collect(tableKey(key, scoped), slots);
+        for (auto slot : slots) {
+            const auto& binding = buttonBindings_[slot];
+            if (!binding.enabled || binding.removed) continue;
+            const uint32_t ms =
+                binding.longPressMs > 0 ? binding.longPressMs : System::Input::LONG_PRESS_DEFAULT_MS;
+            if (ms > afterMs && (!found || ms < duration)) {
+                duration = ms;
+                found = true;
             }
         }
     }
 
-    if (scopedTriggered) return;  // Stop propagation if scoped binding triggered
-
-    // PASS 2: Check global bindings (lower priority)
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.type != ButtonBindingType::LONG_PRESS) continue;
-        if (binding.buttonId != buttonId) continue;
-        if (binding.scope != nullptr) continue;  // ONLY global bindings
+    if (!found) {
+        longPressArmed_.reset(index);
+    } else {
+        longPressDeadline_[index] = buttonStates_[index].pressTime + duration;
+        longPressArmed_.set(index);
+    }
+    updateNextDeadline();
+}
 
-        const uint32_t duration =
-            binding.longPressMs > 0 ? binding.longPressMs : System::Input::LONG_PRESS_DEFAULT_MS;
-        if ((now - pressTimeIt->second) >= duration) {
-            longPressTriggered_[buttonId] = true;
-            if (binding.action) {
-                binding.action();
-            }
+void InputBinding::updateNextDeadline() {
+    bool first = true;
+    for (uint8_t i = 0; i < BUTTON_ID_COUNT; ++i) {
+        if (!longPressArmed_.test(i)) continue;
+        if (first || static_cast<int32_t>(longPressDeadline_[i] - nextDeadline_) < 0) {
+            nextDeadline_ = longPressDeadline_[i];
+            first = false;
         }
     }
 }
 
-void InputBinding::checkAndTriggerDoubleTap(ButtonID buttonId, uint32_t now) {
-    auto tapIt = buttonTapCount_.find(buttonId);
-    if (tapIt == buttonTapCount_.end() || tapIt->second < 2) return;
+void InputBinding::checkAndTriggerDoubleTap(uint8_t index, uint32_t now) {
+    auto& state = buttonStates_[index];
+    if (state.tapCount < 2) return;
 
-    auto releaseIt = buttonReleaseTime_.find(buttonId);
-    if (releaseIt == buttonReleaseTime_.end()) return;
-
-    if ((now - releaseIt->second) < System::Input::DOUBLE_TAP_WINDOW_MS) {
-        triggerMatchingButtonBindings(buttonId, ButtonBindingType::DOUBLE_TAP);
-        buttonTapCount_[buttonId] = 0;
+    if ((now - state.releaseTime) < System::Input::DOUBLE_TAP_WINDOW_MS) {
+        triggerMatchingButtonBindings(BUTTON_IDS[index], ButtonBindingType::DOUBLE_TAP);
+        state.tapCount = 0;
     }
 }
 
 void InputBinding::checkAndTriggerCombosOnRelease(ButtonID releasedButtonID) {
-    bool scopedTriggered = false;
-
-    // PASS 1: Check scoped combo bindings first (higher priority)
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.type != ButtonBindingType::COMBO) continue;
-        if (binding.scope == nullptr) continue;  // ONLY scoped bindings
-        if (!isBindingActive(binding)) continue;  // Check scope visibility
-
-        bool isPartOfCombo = (binding.buttonId == releasedButtonID) ||
-                             (binding.secondaryButton.has_value() &&
-                              *binding.secondaryButton == releasedButtonID);
-
-        if (!isPartOfCombo) continue;
-
-        if (binding.secondaryButton.has_value()) {
-            if (isButtonComboActive(binding.buttonId, *binding.secondaryButton)) {
-                if (binding.action) {
-                    binding.action();
-                    scopedTriggered = true;
-                }
-            }
-        }
-    }
-
-    if (scopedTriggered) return;  // Stop propagation if scoped combo triggered
-
-    // PASS 2: Check global combo bindings (lower priority)
-    for (auto& binding : buttonBindings_) {
-        if (!binding.enabled) continue;
-        if (binding.type != ButtonBindingType::COMBO) continue;
-        if (binding.scope != nullptr) continue;  // ONLY global bindings
-
-        bool isPartOfCombo = (binding.buttonId == releasedButtonID) ||
-                             (binding.secondaryButton.has_value() &&
-                              *binding.secondaryButton == releasedButtonID);
-
-        if (!isPartOfCombo) continue;
+    // Combos are indexed under both of their buttons
+    auto held = [this](ButtonBinding& binding) {
+        return binding.secondaryButton.has_value() &&
+               isButtonComboActive(binding.buttonId, *binding.secondaryButton);
+    };
+    auto fire = [](ButtonBinding& binding) {
+        if (!binding.action) return false;
+        PluginAccounting::CallbackTimer timer(binding.owner);
+        binding.action();
+        return true;
+    };
 
-        if (binding.secondaryButton.has_value()) {
-            if (isButtonComboActive(binding.buttonId, *binding.secondaryButton)) {
-                if (binding.action) {
-                    binding.action();
-                }
-            }
-        }
-    }
+    const uint32_t key = buttonKey(releasedButtonID, ButtonBindingType::COMBO);
+    triggerScopedThenGlobal(buttonBindings_, key, held, fire);
 }
 
 bool InputBinding::isButtonComboActive(ButtonID btn1, ButtonID btn2) const {
-    auto it1 = buttonStates_.find(btn1);
-    auto it2 = buttonStates_.find(btn2);
-    return (it1 != buttonStates_.end() && it1->second) &&
-           (it2 != buttonStates_.end() && it2->second);
+    return isPressed(btn1) && isPressed(btn2);
+}
+
+bool InputBinding::isPressed(ButtonID id) const {
+    const uint8_t index = buttonIndex(id);
+    return index != INVALID_INPUT_INDEX && pressed_.test(index);
 }
 
 void InputBinding::processTick(uint32_t currentTimeMs) {
     currentTime_ = currentTimeMs;
+    scopesDirty_ = true;  // Plugins may have toggled LV_OBJ_FLAG_HIDDEN since the last loop
+
+    if (longPressArmed_.none()) return;
+    if (static_cast<int32_t>(currentTime_ - nextDeadline_) < 0) return;
 
-    for (const auto& [buttonId, isPressed] : buttonStates_) {
-        if (isPressed) {
-            checkAndTriggerLongPress(buttonId, currentTime_);
+    DispatchScope dispatch(*this);
+
+    for (uint8_t i = 0; i < BUTTON_ID_COUNT; ++i) {
+        if (!longPressArmed_.test(i)) continue;
+        if (static_cast<int32_t>(currentTime_ - longPressDeadline_[i]) < 0) continue;
+
+        longPressArmed_.reset(i);
+        checkAndTriggerLongPress(i, currentTime_);
+
+        // Nothing fired (e.g. the shortest binding's scope was hidden): wait for the next one
+        if (pressed_.test(i) && !longPressTriggered_.test(i)) {
+            armLongPress(i, currentTime_ - buttonStates_[i].pressTime);
         }
     }
+
+    updateNextDeadline();
 }
 
 void InputBinding::clearBindings() {
+    if (dispatchDepth_ > 0) {
+        removeBindings([](const auto&) { return true; });
+        LOGLN("[InputBinding] Cleared all bindings (after the current dispatch)");
+        return;
+    }
+
     buttonBindings_.clear();
     encoderBindings_.clear();
+    gestures_.clear();
+    gestureEngine_.clear();
+    scopes_.fill(nullptr);
+    visibleScopes_ = 0;
     LOGLN("[InputBinding] Cleared all bindings");
 }
 
@@ -484,20 +704,114 @@ void InputBinding::setBindingsEnabled(bool enabled) {
     LOGF("[InputBinding] Bindings %s\n", enabled ? "enabled" : "disabled");
 }
 
-bool InputBinding::isBindingActive(const ButtonBinding& binding) const {
-    if (binding.scope == nullptr) {
-        return true;
+BindingLayerId InputBinding::createLayer(const char* name) {
+    if (layerCount_ >= System::Memory::MAX_BINDING_LAYERS) {
+        LOGF("[InputBinding] ERROR: Cannot create layer '%s' (max %d)\n", name,
+             static_cast<int>(System::Memory::MAX_BINDING_LAYERS));
+        return INVALID_BINDING_LAYER;
+    }
+
+    BindingLayerId layer = layerCount_++;
+    layerNames_[layer] = name;
+    LOGF("[InputBinding] Created layer %d '%s'\n", layer, name);
+    return layer;
+}
+
+void InputBinding::beginLayer(BindingLayerId layer) {
+    buildLayer_ = (layer < layerCount_) ? layer : BASE_BINDING_LAYER;
+}
+
+void InputBinding::endLayer() {
+    buildLayer_ = BASE_BINDING_LAYER;
+}
+
+bool InputBinding::pushLayer(BindingLayerId layer) {
+    if (layer == BASE_BINDING_LAYER || layer >= layerCount_ ||
+        layerRanks_[layer] != LAYER_INACTIVE) {
+        return false;
     }
 
-    // LV_OBJ_FLAG_HIDDEN is an enum value from LVGL, always available
-    return !lv_obj_has_flag(binding.scope, LV_OBJ_FLAG_HIDDEN);
+    layerStack_[layerDepth_++] = layer;
+    layerRanks_[layer] = layerDepth_;
+    LOGF("[InputBinding] Pushed layer '%s'\n", layerNames_[layer]);
+    return true;
+}
+
+void InputBinding::popLayer() {
+    if (layerDepth_ == 0) return;
+
+    BindingLayerId layer = layerStack_[--layerDepth_];
+    layerRanks_[layer] = LAYER_INACTIVE;
+    LOGF("[InputBinding] Popped layer '%s'\n", layerNames_[layer]);
+}
+
+void InputBinding::clearLayer(BindingLayerId layer) {
+    removeBindings([layer](const auto& binding) { return binding.layer == layer; });
+}
+
+bool InputBinding::isLayerActive(BindingLayerId layer) const {
+    return layer < layerCount_ && layerRanks_[layer] != LAYER_INACTIVE;
+}
+
+void InputBinding::invalidateScopes() {
+    scopesDirty_ = true;
 }
 
-bool InputBinding::isBindingActive(const EncoderBinding& binding) const {
+template <typename Binding>
+bool InputBinding::isBindingActive(const Binding& binding) {
     if (binding.scope == nullptr) {
         return true;
     }
 
-    // LV_OBJ_FLAG_HIDDEN is an enum value from LVGL, always available
-    return !lv_obj_has_flag(binding.scope, LV_OBJ_FLAG_HIDDEN);
+    if (binding.scopeSlot == NO_SCOPE_SLOT) {
+        return isScopeVisible(binding.scope);  // Cache full: evaluate directly
+    }
+
+    if (scopesDirty_) {
+        refreshScopes();
+    }
+    return (visibleScopes_ >> binding.scopeSlot) & 1u;
+}
+
+uint8_t InputBinding::acquireScopeSlot(lv_obj_t* scope) {
+    uint8_t freeSlot = NO_SCOPE_SLOT;
+    for (uint8_t i = 0; i < scopes_.size(); ++i) {
+        if (scopes_[i] == scope) {
+            return i;
+        }
+        if (scopes_[i] == nullptr && freeSlot == NO_SCOPE_SLOT) {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot == NO_SCOPE_SLOT) {
+        LOGLN("[InputBinding] Scope cache full - visibility checked per event");
+        return NO_SCOPE_SLOT;
+    }
+
+    scopes_[freeSlot] = scope;
+    scopesDirty_ = true;
+    return freeSlot;
+}
+
+void InputBinding::refreshScopes() {
+    uint64_t visible = 0;
+    for (uint8_t i = 0; i < scopes_.size(); ++i) {
+        if (scopes_[i] && isScopeVisible(scopes_[i])) {
+            visible |= uint64_t(1) << i;
+        }
+    }
+    visibleScopes_ = visible;
+    scopesDirty_ = false;
+}
+
+bool InputBinding::isScopeVisible(const lv_obj_t* scope) {
+    // A hidden ancestor hides the whole subtree
+    for (const lv_obj_t* obj = scope; obj != nullptr; obj = lv_obj_get_parent(obj)) {
+        // LV_OBJ_FLAG_HIDDEN is an enum value from LVGL, always available
+        if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+            return false;
+        }
+    }
+    return true;
 }
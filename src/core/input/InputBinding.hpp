@@ -1,14 +1,23 @@
 #pragma once
 
+#include <etl/array.h>
+#include <etl/bitset.h>
+#include <etl/vector.h>
+
 #include <cstdint>
-#include <functional>
-#include <unordered_map>
-#include <vector>
+#include <initializer_list>
 
+#include "BindingTable.hpp"
 #include "config/InputID.hpp"
+#include "config/System.hpp"
+#include "GestureEngine.hpp"
 #include "core/event/IEventBus.hpp"
 #include "core/struct/Binding.hpp"
 
+class EncoderChangedEvent;
+class ButtonPressEvent;
+class ButtonReleaseEvent;
+
 /**
  * @brief Centralized input state management and binding system
  *
@@ -23,11 +32,21 @@
  * bindings.onCombo(ButtonID::LEFT_TOP, ButtonID::LEFT_CENTER, []() { reset(); });
  * bindings.onTurnedWhilePressed(EncoderID::NAV, ButtonID::NAV, [](float v) { fineTune(v); });
  * @endcode
+ *
+ * Modes are built once as layers and switched by pushing/popping them:
+ * @code
+ * BindingLayerId config = bindings.createLayer("config");
+ * bindings.beginLayer(config);
+ * bindings.onPressed(ButtonID::NAV, [this]() { save(); });
+ * bindings.endLayer();
+ * bindings.pushLayer(config);  // NAV now saves
+ * bindings.popLayer();         // back to base bindings
+ * @endcode
  */
 class InputBinding {
 public:
-    using ActionCallback = std::function<void()>;
-    using EncoderActionCallback = std::function<void(float normalizedValue)>;
+    using ActionCallback = BindingAction;
+    using EncoderActionCallback = EncoderBindingAction;
 
     explicit InputBinding(IEventBus& eventBus);
     ~InputBinding();
@@ -53,42 +72,176 @@ public:
     void onTurned(EncoderID id, EncoderActionCallback cb, lv_obj_t* scope);
     void onTurnedWhilePressed(EncoderID encoderId, ButtonID buttonId, EncoderActionCallback cb, lv_obj_t* scope);
 
+    /**
+     * @brief Multi-button gestures (compiled into GestureEngine)
+     *
+     * onChord: every listed button held together (2-8 buttons, exact set).
+     * onSequence: buttons pressed in order, each within GESTURE_SEQUENCE_STEP_MS.
+     *   A sequence that starts another one (or is started by it) is rejected.
+     * onHoldTap: tap is pressed and released while hold stays down.
+     *
+     * The same gesture may be bound in several layers and scopes: the top
+     * active layer fires, its scoped binding before its global one.
+     */
+    void onChord(std::initializer_list<ButtonID> buttons, ActionCallback cb);
+    void onSequence(std::initializer_list<ButtonID> buttons, ActionCallback cb);
+    void onHoldTap(ButtonID hold, ButtonID tap, ActionCallback cb);
+
+    void onChord(std::initializer_list<ButtonID> buttons, ActionCallback cb, lv_obj_t* scope);
+    void onSequence(std::initializer_list<ButtonID> buttons, ActionCallback cb, lv_obj_t* scope);
+    void onHoldTap(ButtonID hold, ButtonID tap, ActionCallback cb, lv_obj_t* scope);
+
     void clearScope(lv_obj_t* scope);
 
+    /**
+     * @brief Re-evaluate scope visibility before the next dispatch
+     *
+     * Called on view switches; also done once per processTick() and after
+     * any binding action, which covers scopes hidden or shown by plugins.
+     */
+    void invalidateScopes();
+
+    /**
+     * @brief Create an empty named layer
+     * @param name Static string, kept for logs
+     * @return Layer id, INVALID_BINDING_LAYER if MAX_BINDING_LAYERS reached
+     */
+    BindingLayerId createLayer(const char* name);
+
+    /** @brief Route following on*() registrations to layer (until endLayer) */
+    void beginLayer(BindingLayerId layer);
+    void endLayer();
+
+    /** @brief Activate layer on top of the stack, no allocation or rebuild */
+    bool pushLayer(BindingLayerId layer);
+    void popLayer();
+
+    /** @brief Remove every binding registered in layer (the layer itself stays) */
+    void clearLayer(BindingLayerId layer);
+
+    bool isLayerActive(BindingLayerId layer) const;
+
+    /** @brief Held buttons, bit buttonIndex(id) (InputID.hpp) */
+    uint32_t pressedMask() const {
+        return static_cast<uint32_t>(pressed_.to_ulong());
+    }
+
     void processTick(uint32_t currentTimeMs);
     void clearBindings();
     void setBindingsEnabled(bool enabled);
 
 private:
-    std::vector<ButtonBinding> buttonBindings_;
-    std::vector<EncoderBinding> encoderBindings_;
+    static uint32_t buttonKey(ButtonID id, ButtonBindingType type) {
+        return (static_cast<uint32_t>(id) << 8) | static_cast<uint8_t>(type);
+    }
+
+    static uint32_t encoderKey(EncoderID id) {
+        return static_cast<uint32_t>(id);
+    }
+
+    /**
+     * Table key of one control (and, for buttons, one binding type) split by
+     * scope, so dispatch never filters: scoped first, globals as fallback.
+     */
+    static uint32_t tableKey(uint32_t controlKey, bool scoped) {
+        return (controlKey << 1) | (scoped ? 0u : 1u);
+    }
 
-    void onEncoderChanged(const Event& event);
-    void onButtonPress(const Event& event);
-    void onButtonRelease(const Event& event);
+    using ButtonTable = BindingTable<ButtonBinding, System::Memory::MAX_BUTTON_BINDINGS>;
+    using EncoderTable = BindingTable<EncoderBinding, System::Memory::MAX_ENCODER_BINDINGS>;
+
+    ButtonTable buttonBindings_;    // tableKey(buttonKey())
+    EncoderTable encoderBindings_;  // tableKey(encoderKey())
+
+    void addButtonBinding(ButtonBinding binding);
+    void addEncoderBinding(EncoderBinding binding);
+    void addGesture(GestureType type, std::initializer_list<ButtonID> buttons, ActionCallback cb,
+                    lv_obj_t* scope);
+    bool compileGesture(const GestureBinding& gesture, GestureEngine::GestureId id);
+    void recompileGestures();
+    void fireGesture(GestureEngine::GestureId id);
+
+    etl::vector<GestureBinding, System::Memory::MAX_GESTURES> gestures_;  // Index = GestureId
+    GestureEngine gestureEngine_;
+
+    void onEncoderChanged(const EncoderChangedEvent& event);
+    void onButtonPress(const ButtonPressEvent& event);
+    void onButtonRelease(const ButtonReleaseEvent& event);
 
     void triggerMatchingButtonBindings(ButtonID buttonId, ButtonBindingType type);
     void triggerMatchingEncoderBindings(EncoderID encoderId, float encoderValue);
 
-    // Priority-based triggering helpers (scoped bindings have priority over global)
-    bool triggerScopedButtonBindings(ButtonID buttonId, ButtonBindingType type);
-    bool triggerGlobalButtonBindings(ButtonID buttonId, ButtonBindingType type);
-    bool triggerScopedEncoderBindings(EncoderID encoderId, float encoderValue);
-    bool triggerGlobalEncoderBindings(EncoderID encoderId, float encoderValue);
+    /**
+     * Fire the eligible bindings of the topmost active layer under one
+     * control key. Within that layer scoped bindings come first, globals
+     * only if no scoped binding fired.
+     */
+    template <typename Table, typename Eligible, typename Fire>
+    void triggerScopedThenGlobal(Table& table, uint32_t controlKey, Eligible eligible, Fire fire);
+
+    template <typename Binding>
+    bool isBindingActive(const Binding& binding);
+
+    static constexpr uint8_t NO_SCOPE_SLOT = 0xFF;
+    static_assert(System::Memory::MAX_BINDING_SCOPES <= 64, "visibleScopes_ holds 64 scopes");
+
+    uint8_t acquireScopeSlot(lv_obj_t* scope);
+    void refreshScopes();
+    static bool isScopeVisible(const lv_obj_t* scope);
+
+    /*
+     * Scope visibility cache: one slot per distinct scope object, visibility
+     * packed in a mask and refreshed lazily when dirty, so an active-scope
+     * check during dispatch is a bit test.
+     */
+    etl::array<lv_obj_t*, System::Memory::MAX_BINDING_SCOPES> scopes_ = {};
+    uint64_t visibleScopes_ = 0;
+    bool scopesDirty_ = true;
 
-    bool isBindingActive(const ButtonBinding& binding) const;
-    bool isBindingActive(const EncoderBinding& binding) const;
+    /*
+     * Layers: rank 0 = base, 1..depth = stack position, INACTIVE otherwise.
+     * Push/pop only touch the stack and the rank table.
+     */
+    static constexpr uint8_t LAYER_INACTIVE = 0xFF;
 
-    void checkAndTriggerLongPress(ButtonID buttonId, uint32_t now);
-    void checkAndTriggerDoubleTap(ButtonID buttonId, uint32_t now);
+    etl::array<const char*, System::Memory::MAX_BINDING_LAYERS> layerNames_ = {};
+    etl::array<uint8_t, System::Memory::MAX_BINDING_LAYERS> layerRanks_;
+    etl::array<BindingLayerId, System::Memory::MAX_BINDING_LAYERS> layerStack_ = {};
+    uint8_t layerCount_ = 1;
+    uint8_t layerDepth_ = 0;
+    BindingLayerId buildLayer_ = BASE_BINDING_LAYER;
+
+    void checkAndTriggerLongPress(uint8_t index, uint32_t now);
+    void armLongPress(uint8_t index, uint32_t afterMs);
+    void updateNextDeadline();
+    void checkAndTriggerDoubleTap(uint8_t index, uint32_t now);
     void checkAndTriggerCombosOnRelease(ButtonID releasedButtonID);
     bool isButtonComboActive(ButtonID btn1, ButtonID btn2) const;
 
-    std::unordered_map<ButtonID, bool> buttonStates_;
-    std::unordered_map<ButtonID, uint32_t> buttonPressTime_;
-    std::unordered_map<ButtonID, uint32_t> buttonReleaseTime_;
-    std::unordered_map<ButtonID, uint8_t> buttonTapCount_;
-    std::unordered_map<ButtonID, bool> longPressTriggered_;
+    bool isPressed(ButtonID id) const;
+
+    /**
+     * Per-button timing, indexed by buttonIndex() (InputID.hpp). Fixed size:
+     * no hashing and no allocation on press/release.
+     */
+    struct ButtonState {
+        uint32_t pressTime = 0;
+        uint32_t releaseTime = 0;
+        uint8_t tapCount = 0;
+    };
+
+    etl::array<ButtonState, BUTTON_ID_COUNT> buttonStates_;
+    etl::bitset<BUTTON_ID_COUNT> pressed_;
+    etl::bitset<BUTTON_ID_COUNT> longPressTriggered_;
+
+    /*
+     * Long-press deadlines, armed on press and disarmed on release.
+     * processTick() compares against the earliest one only, so an idle tick
+     * costs a single comparison whatever the number of buttons or bindings.
+     */
+    etl::array<uint32_t, BUTTON_ID_COUNT> longPressDeadline_ = {};
+    etl::bitset<BUTTON_ID_COUNT> longPressArmed_;
+    uint32_t nextDeadline_ = 0;
 
     IEventBus& eventBus_;
     SubscriptionId encoderSub_;
@@ -98,4 +251,28 @@ private:
     bool bindingsEnabled_ = true;
     uint32_t currentTime_ = 0;
 
+    /*
+     * Removals during a dispatch (an action unbinding itself or another
+     * binding) only mark bindings removed: compacting would move or destroy
+     * the callback being executed. The outermost dispatch compacts on exit.
+     */
+    struct DispatchScope {
+        explicit DispatchScope(InputBinding& owner) : owner_(owner) {
+            ++owner_.dispatchDepth_;
+        }
+        ~DispatchScope() {
+            if (--owner_.dispatchDepth_ == 0 && owner_.removalsPending_) {
+                owner_.compactRemoved();
+            }
+        }
+        InputBinding& owner_;
+    };
+
+    template <typename Predicate>
+    void removeBindings(Predicate predicate);
+    void compactRemoved();
+
+    uint8_t dispatchDepth_ = 0;
+    bool removalsPending_ = false;
+
 };
@@ -4,6 +4,43 @@
 #include <functional>
 
 #include "../../Type.hpp"
+#include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
+
+/**
+ * @brief Where a MIDI event comes from
+ *
+ * Local: a control of this unit (source = control id), Host: received on a
+ * MIDI input, Plugin: sent by plugin code through ControllerAPI::sendCC()
+ * (source = the sender's PluginAccounting owner).
+ */
+enum class MidiOrigin : uint8_t { Local, Host, Plugin };
+
+constexpr uint8_t midiOriginBit(MidiOrigin origin) {
+    return static_cast<uint8_t>(1u << static_cast<uint8_t>(origin));
+}
+
+constexpr uint8_t MIDI_ORIGIN_ALL = 0x07;
+
+/** @brief MIDI realtime status bytes */
+namespace MidiRealtime {
+constexpr uint8_t CLOCK = 0xF8;
+constexpr uint8_t START = 0xFA;
+constexpr uint8_t CONTINUE = 0xFB;
+constexpr uint8_t STOP = 0xFC;
+constexpr uint8_t ACTIVE_SENSING = 0xFE;
+constexpr uint8_t SYSTEM_RESET = 0xFF;
+}  // namespace MidiRealtime
+
+/**
+ * @brief Realtime fast-lane listener: status byte, micros() when decoded
+ *
+ * Called directly from the USB read loop, bypassing EventBus. Keep it short.
+ */
+using MidiRealtimeCallback = InplaceFunction<void(uint8_t status, uint32_t timestampUs),
+                                             System::Memory::EVENT_CALLBACK_SIZE>;
+using MidiRealtimeListenerId = uint8_t;
+constexpr MidiRealtimeListenerId INVALID_REALTIME_LISTENER = 0xFF;
 
 /**
  * @brief Interface for MIDI input ports
@@ -1,6 +1,22 @@
 #pragma once
 
 #include "../../Type.hpp"
+#include "core/midi/Ump.hpp"
+
+/** @brief One Control Change, for batch sends */
+struct MidiCCMessage {
+    MidiChannelValue channel;  // 0-15
+    MidiCCValue cc;
+    uint8_t value;
+};
+
+/**
+ * @brief USB MIDI virtual port a message is sent on (System::Midi::USB_CABLE_*)
+ *
+ * Auto picks by message kind: CCs and program changes on Control, notes,
+ * pitch bend and pressure on Performance, streamed SysEx on Bulk.
+ */
+enum class MidiTraffic : uint8_t { Auto, Control, Performance, Bulk };
 
 class MidiOutput {
 protected:
@@ -11,7 +27,18 @@ public:
         return false;
     }
 
+    /**
+     * @brief Tag the next message with the micros() of the input edge that caused it
+     *
+     * Used for edge-to-send latency tracing; 0 means unknown. Outputs that don't
+     * trace latency ignore it.
+     */
+    virtual void setEdgeTimestamp(uint32_t timestampUs) {
+        (void)timestampUs;
+    }
+
     virtual void sendCc(MidiChannelValue ch, MidiCCValue cc, uint8_t value, uint8_t source) {
+        (void)source;
         sendControlChange(ch, cc, value);
     }
 
@@ -23,9 +50,91 @@ public:
 
     virtual void sendProgramChange(MidiChannelValue ch, uint8_t program) = 0;
 
+    /** @param value 14-bit, 0-16383 (8192 = center) */
     virtual void sendPitchBend(MidiChannelValue ch, uint16_t value) = 0;
 
     virtual void sendChannelPressure(MidiChannelValue ch, uint8_t pressure) = 0;
 
     virtual void sendSysEx(const uint8_t* data, uint16_t length) = 0;
+
+    virtual void sendPolyPressure(MidiChannelValue ch, MidiNoteValue note, uint8_t pressure) {
+        (void)ch;
+        (void)note;
+        (void)pressure;
+    }
+
+    /** @brief Single-byte realtime message (0xF8-0xFF), sent without delay */
+    virtual void sendRealtime(uint8_t status) {
+        (void)status;
+    }
+
+    /**
+     * @brief Note Off for every note still sounding, on all channels
+     *
+     * Outputs that don't track notes do nothing.
+     */
+    virtual void panic() {}
+
+    /**
+     * @brief The host negotiated UMP: sendUmp() reaches it without downconversion
+     */
+    virtual bool supportsUmp() const {
+        return false;
+    }
+
+    /**
+     * @brief Send a Universal MIDI Packet (channel voice messages)
+     *
+     * Default: MIDI 1.0 fallback. MIDI 2.0 values are scaled down to 7/14 bits
+     * and sent through the send*() methods above; per-note controllers and
+     * per-note pitch bend have no MIDI 1.0 equivalent and are dropped.
+     */
+    virtual void sendUmp(const Ump::Packet& packet) {
+        const uint8_t ch = packet.channel();
+        const uint8_t index = packet.index();
+
+        if (packet.messageType() == Ump::MT_MIDI1_CHANNEL_VOICE) {
+            const uint8_t data2 = static_cast<uint8_t>(packet.words[0] & 0x7F);
+            switch (packet.opcode()) {
+                case Ump::NOTE_OFF: sendNoteOff(ch, index, data2); break;
+                case Ump::NOTE_ON: sendNoteOn(ch, index, data2); break;
+                case Ump::CONTROL_CHANGE: sendControlChange(ch, index, data2); break;
+                case Ump::PROGRAM_CHANGE: sendProgramChange(ch, index); break;
+                case Ump::CHANNEL_PRESSURE: sendChannelPressure(ch, index); break;
+                case Ump::PITCH_BEND:
+                    sendPitchBend(ch, static_cast<uint16_t>((data2 << 7) | index));
+                    break;
+                default: break;
+            }
+            return;
+        }
+        if (packet.messageType() != Ump::MT_MIDI2_CHANNEL_VOICE) return;
+
+        const uint32_t value = packet.words[1];
+        switch (packet.opcode()) {
+            case Ump::NOTE_OFF:
+                sendNoteOff(ch, index, static_cast<uint8_t>(Ump::scaleDown(value >> 16, 16, 7)));
+                break;
+            case Ump::NOTE_ON: {
+                // MIDI 1.0 velocity 0 means note off: keep the note sounding
+                uint8_t velocity = static_cast<uint8_t>(Ump::scaleDown(value >> 16, 16, 7));
+                sendNoteOn(ch, index, velocity == 0 ? 1 : velocity);
+                break;
+            }
+            case Ump::CONTROL_CHANGE:
+                sendControlChange(ch, index, static_cast<uint8_t>(Ump::scaleDown(value, 32, 7)));
+                break;
+            case Ump::PROGRAM_CHANGE:
+                sendProgramChange(ch, static_cast<uint8_t>((value >> 24) & 0x7F));
+                break;
+            case Ump::CHANNEL_PRESSURE:
+                sendChannelPressure(ch, static_cast<uint8_t>(Ump::scaleDown(value, 32, 7)));
+                break;
+            case Ump::PITCH_BEND:
+                sendPitchBend(ch, static_cast<uint16_t>(Ump::scaleDown(value, 32, 14)));
+                break;
+            default:
+                break;
+        }
+    }
 };
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+
+/**
+ * @brief Recognizes host feedback of CCs this unit just sent
+ *
+ * Outputs stamp every CC they send (sent()); an input asks isEcho() before
+ * publishing a received CC. A CC that arrives within ECHO_SUPPRESS_MS of a
+ * send on the same channel/controller is host feedback, usually of a value
+ * a knob has already moved past, and is not worth redrawing or re-applying.
+ *
+ * Stamps are 16-bit milliseconds (one cell per channel/CC, 4 KB), so a CC
+ * arriving a multiple of ~65 s after the last send can be taken for an echo.
+ */
+class EchoFilter {
+public:
+    void sent(uint8_t channel, uint8_t controller, uint32_t nowMs) {
+        stamps_[channel & 0x0F][controller & 0x7F] = stamp(nowMs);
+    }
+
+    bool isEcho(uint8_t channel, uint8_t controller, uint32_t nowMs) const {
+        if (WINDOW_MS == 0) return false;
+        const uint16_t last = stamps_[channel & 0x0F][controller & 0x7F];
+        return last != NEVER && static_cast<uint16_t>(stamp(nowMs) - last) < WINDOW_MS;
+    }
+
+private:
+    static constexpr uint16_t WINDOW_MS = System::Midi::ECHO_SUPPRESS_MS;
+    static constexpr uint16_t NEVER = 0;
+
+    static uint16_t stamp(uint32_t nowMs) {
+        const uint16_t value = static_cast<uint16_t>(nowMs);
+        return value == NEVER ? 1 : value;
+    }
+
+    uint16_t stamps_[16][128] = {};
+};
@@ -0,0 +1,172 @@
+#include "MidiClock.hpp"
+
+#include <Arduino.h>
+
+#include "core/event/Events.hpp"
+#include "core/interface/midi/MidiInput.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+constexpr uint8_t MIN_FIT_TICKS = 3;
+
+/* An interval this many fitted periods long means the clock stopped and resumed */
+constexpr float GAP_PERIODS = 4.0f;
+
+/* Phase never reaches the next beat before its tick arrives */
+constexpr float MAX_EXTRAPOLATION = 0.999f;
+
+/* One song position "MIDI beat" is a sixteenth note */
+constexpr uint32_t TICKS_PER_SONG_POSITION = System::Midi::CLOCK_PPQN / 4;
+}  // namespace
+
+MidiClock::MidiClock(IEventBus& eventBus) : eventBus_(eventBus) {
+    songPositionSub_ =
+        eventBus_.on<MidiSongPositionEvent>([this](const MidiSongPositionEvent& e) {
+            tick_ = e.beats * TICKS_PER_SONG_POSITION;
+        });
+}
+
+MidiClock::~MidiClock() {
+    if (songPositionSub_ != 0) {
+        eventBus_.off(songPositionSub_);
+    }
+}
+
+void MidiClock::onRealtime(uint8_t status, uint32_t timestampUs) {
+    switch (status) {
+        case MidiRealtime::CLOCK:
+            onTick(timestampUs);
+            break;
+        case MidiRealtime::START:
+            tick_ = 0;
+            running_ = true;
+            break;
+        case MidiRealtime::CONTINUE:
+            running_ = true;
+            break;
+        case MidiRealtime::STOP:
+        case MidiRealtime::SYSTEM_RESET:
+            running_ = false;
+            break;
+        default:
+            break;
+    }
+}
+
+void MidiClock::onTick(uint32_t timestampUs) {
+    const uint32_t interval = timestampUs - lastTickUs_;
+    if (tickCount_ > 0 &&
+        (interval > TIMEOUT_US || (periodUs_ > 0.0f && interval > periodUs_ * GAP_PERIODS))) {
+        resetFit();
+    }
+    lastTickUs_ = timestampUs;
+
+    if (tickCount_ < FIT_TICKS) {
+        tickTimes_[(tickHead_ + tickCount_) % FIT_TICKS] = timestampUs;
+        ++tickCount_;
+    } else {
+        tickTimes_[tickHead_] = timestampUs;
+        tickHead_ = static_cast<uint8_t>((tickHead_ + 1) % FIT_TICKS);
+    }
+    fit();
+
+    if (!running_) return;
+
+    const uint32_t current = tick_++;
+    for (auto& listener : listeners_) {
+        if (listener) {
+            listener(current);
+        }
+    }
+}
+
+void MidiClock::resetFit() {
+    tickHead_ = 0;
+    tickCount_ = 0;
+    periodUs_ = 0.0f;
+}
+
+/*
+ * Least-squares line through (i, t_i - t_0): the slope is the tick period,
+ * the line's value at the newest index its de-jittered timestamp.
+ */
+void MidiClock::fit() {
+    if (tickCount_ < MIN_FIT_TICKS) return;
+
+    const uint32_t origin = tickTimes_[tickHead_];
+    const float n = static_cast<float>(tickCount_);
+    const float meanX = (n - 1.0f) * 0.5f;
+
+    float meanY = 0.0f;
+    for (uint8_t i = 0; i < tickCount_; ++i) {
+        meanY += static_cast<float>(tickTimes_[(tickHead_ + i) % FIT_TICKS] - origin);
+    }
+    meanY /= n;
+
+    float sxy = 0.0f;
+    float sxx = 0.0f;
+    for (uint8_t i = 0; i < tickCount_; ++i) {
+        const float dx = static_cast<float>(i) - meanX;
+        const uint32_t offset = tickTimes_[(tickHead_ + i) % FIT_TICKS] - origin;
+        const float dy = static_cast<float>(offset) - meanY;
+        sxy += dx * dy;
+        sxx += dx * dx;
+    }
+
+    periodUs_ = sxy / sxx;
+    fittedLastUs_ = origin + static_cast<uint32_t>(meanY + periodUs_ * (n - 1.0f - meanX));
+}
+
+MidiClock::ListenerId MidiClock::addTickListener(TickCallback callback) {
+    for (size_t i = 0; i < listeners_.size(); ++i) {
+        if (!listeners_[i]) {
+            listeners_[i] = std::move(callback);
+            return static_cast<ListenerId>(i);
+        }
+    }
+
+    LOGF("[MidiClock] ERROR: Cannot add tick listener (max %d)\n",
+         static_cast<int>(System::Memory::MAX_CLOCK_LISTENERS));
+    return INVALID_LISTENER;
+}
+
+void MidiClock::removeTickListener(ListenerId id) {
+    if (id < listeners_.size()) {
+        listeners_[id] = nullptr;
+    }
+}
+
+bool MidiClock::hasSignal() const {
+    return periodUs_ > 0.0f && micros() - lastTickUs_ <= TIMEOUT_US;
+}
+
+float MidiClock::bpm() const {
+    if (!hasSignal()) return 0.0f;
+    return 60000000.0f / (periodUs_ * System::Midi::CLOCK_PPQN);
+}
+
+float MidiClock::beatPhase() const {
+    if (!running_ || !hasSignal() || tick_ == 0) return 0.0f;
+
+    // tick_ - 1 is the latest tick; extrapolate at most one period past it
+    const int32_t sinceUs = static_cast<int32_t>(micros() - fittedLastUs_);
+    float sinceTick = static_cast<float>(sinceUs) / periodUs_;
+    if (sinceTick < 0.0f) sinceTick = 0.0f;
+    if (sinceTick > MAX_EXTRAPOLATION) sinceTick = MAX_EXTRAPOLATION;
+
+    const float ticks = static_cast<float>((tick_ - 1) % System::Midi::CLOCK_PPQN) + sinceTick;
+    return ticks / System::Midi::CLOCK_PPQN;
+}
+
+uint32_t MidiClock::tickTimeUs(uint32_t tick) const {
+    if (!running_ || !hasSignal() || tick_ == 0) return 0;
+
+    // fittedLastUs_ is the time of tick tick_ - 1
+    const int32_t ahead = static_cast<int32_t>(tick - (tick_ - 1));
+    return fittedLastUs_ + static_cast<uint32_t>(static_cast<int32_t>(ahead * periodUs_));
+}
+
+uint32_t MidiClock::nextTick(uint32_t ticks) const {
+    if (ticks == 0) return tick_;
+    return ((tick_ + ticks - 1) / ticks) * ticks;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <etl/array.h>
+
+#include <cstdint>
+
+#include "config/System.hpp"
+#include "core/event/IEventBus.hpp"
+#include "core/util/InplaceFunction.hpp"
+
+/**
+ * @brief Follows incoming MIDI clock: tempo, song position and beat phase
+ *
+ * Fed from the realtime fast lane (onRealtime), with tick timestamps taken
+ * in the USB handler. The tick period is a least-squares fit over the last
+ * CLOCK_FIT_TICKS ticks, so USB and host scheduling jitter averages out
+ * instead of showing up in bpm() or beatPhase().
+ *
+ * Song position pointer messages (MidiSongPositionEvent) realign the tick
+ * count; Start resets it, Stop freezes it.
+ */
+class MidiClock {
+public:
+    using TickCallback = InplaceFunction<void(uint32_t tick), System::Memory::EVENT_CALLBACK_SIZE>;
+    using ListenerId = uint8_t;
+    static constexpr ListenerId INVALID_LISTENER = 0xFF;
+
+    explicit MidiClock(IEventBus& eventBus);
+    ~MidiClock();
+
+    MidiClock(const MidiClock&) = delete;
+    MidiClock& operator=(const MidiClock&) = delete;
+
+    /** @brief Realtime fast-lane entry point (see MidiRealtimeCallback) */
+    void onRealtime(uint8_t status, uint32_t timestampUs);
+
+    /**
+     * @brief Call on every clock tick while running, with the tick index since Start
+     * @return Listener id, INVALID_LISTENER if MAX_CLOCK_LISTENERS reached
+     */
+    ListenerId addTickListener(TickCallback callback);
+    void removeTickListener(ListenerId id);
+
+    /** @brief Tempo, 0 until enough ticks arrived or after CLOCK_TIMEOUT_MS without one */
+    float bpm() const;
+
+    /** @brief Clock ticks are arriving (regardless of transport state) */
+    bool hasSignal() const;
+
+    bool isRunning() const {
+        return running_;
+    }
+
+    /** @brief Ticks since Start / song position (24 per quarter note) */
+    uint32_t tick() const {
+        return tick_;
+    }
+
+    uint32_t beat() const {
+        return tick_ / System::Midi::CLOCK_PPQN;
+    }
+
+    /**
+     * @brief Position inside the current quarter note, 0.0-1.0
+     *
+     * Interpolated between ticks from the fitted period, so it advances
+     * smoothly at display frame rate. 0 when stopped or without signal.
+     */
+    float beatPhase() const;
+
+    /**
+     * @brief Predicted micros() of a tick, from the fitted period
+     * @return 0 when stopped or without signal
+     */
+    uint32_t tickTimeUs(uint32_t tick) const;
+
+    /** @brief First tick still to come that is a multiple of ticks (24 = next beat) */
+    uint32_t nextTick(uint32_t ticks) const;
+
+private:
+    static constexpr size_t FIT_TICKS = System::Midi::CLOCK_FIT_TICKS;
+    static constexpr uint32_t TIMEOUT_US = System::Midi::CLOCK_TIMEOUT_MS * 1000;
+
+    void onTick(uint32_t timestampUs);
+    void resetFit();
+    void fit();
+
+    IEventBus& eventBus_;
+    SubscriptionId songPositionSub_ = 0;
+
+    etl::array<uint32_t, FIT_TICKS> tickTimes_ = {};  // Ring, oldest at tickHead_ when full
+    uint8_t tickHead_ = 0;
+    uint8_t tickCount_ = 0;
+
+    float periodUs_ = 0.0f;      // Fitted tick period, 0 = not locked
+    uint32_t fittedLastUs_ = 0;  // Fitted time of the latest tick
+    uint32_t lastTickUs_ = 0;
+
+    uint32_t tick_ = 0;
+    bool running_ = false;
+
+    etl::array<TickCallback, System::Memory::MAX_CLOCK_LISTENERS> listeners_;
+};
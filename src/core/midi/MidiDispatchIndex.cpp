@@ -0,0 +1,71 @@
+#include "MidiDispatchIndex.hpp"
+
+#include <string.h>
+
+#include <utility>
+
+#include "log/Macros.hpp"
+
+MidiDispatchIndex::MidiDispatchIndex() {
+    memset(table_, 0, sizeof(table_));
+}
+
+MidiDispatchIndex::FilterId MidiDispatchIndex::add(Kind kind, uint8_t channel, uint8_t first,
+                                                   uint8_t last, Callback callback,
+                                                   uint8_t origins) {
+    if (kind >= KIND_COUNT || (channel > 15 && channel != ANY_CHANNEL) || first > last ||
+        last > 127 || !callback) {
+        LOGLN("[MidiDispatchIndex] ERROR: Invalid filter");
+        return INVALID_FILTER;
+    }
+
+    for (size_t i = 0; i < filters_.size(); ++i) {
+        Filter& filter = filters_[i];
+        // A slot removed by a running callback still holds that callback
+        if (filter.active || (removedDuringDispatch_ & (1u << i))) continue;
+
+        filter.callback = std::move(callback);
+        filter.kind = kind;
+        filter.channel = channel;
+        filter.first = first;
+        filter.last = last;
+        filter.origins = origins;
+        filter.owner = PluginAccounting::currentOwner();
+        filter.active = true;
+        ++kindCounts_[kind];
+        apply(static_cast<FilterId>(i), true);
+        return static_cast<FilterId>(i);
+    }
+
+    LOGF("[MidiDispatchIndex] ERROR: Cannot add filter (max %d)\n", static_cast<int>(FILTERS));
+    return INVALID_FILTER;
+}
+
+void MidiDispatchIndex::remove(FilterId id) {
+    if (id >= filters_.size() || !filters_[id].active) return;
+
+    apply(id, false);
+    Filter& filter = filters_[id];
+    filter.active = false;
+    --kindCounts_[filter.kind];
+    // Keep the callback: remove() may run from inside it, the slot is reused on add()
+    // once no dispatch is running
+    if (dispatchDepth_ != 0) {
+        removedDuringDispatch_ = static_cast<Mask>(removedDuringDispatch_ | (1u << id));
+    }
+}
+
+void MidiDispatchIndex::apply(FilterId id, bool set) {
+    const Filter& filter = filters_[id];
+    const Mask bit = static_cast<Mask>(1u << id);
+    const uint8_t firstChannel = filter.channel == ANY_CHANNEL ? 0 : filter.channel;
+    const uint8_t lastChannel = filter.channel == ANY_CHANNEL ? 15 : filter.channel;
+
+    for (uint8_t channel = firstChannel; channel <= lastChannel; ++channel) {
+        Mask* row = table_[filter.kind][channel];
+        for (uint16_t number = filter.first; number <= filter.last; ++number) {
+            row[number] = set ? static_cast<Mask>(row[number] | bit)
+                              : static_cast<Mask>(row[number] & ~bit);
+        }
+    }
+}
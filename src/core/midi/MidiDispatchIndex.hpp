@@ -0,0 +1,94 @@
+#pragma once
+
+#include <etl/array.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/interface/midi/MidiInput.hpp"
+#include "core/util/InplaceFunction.hpp"
+#include "core/util/PluginAccounting.hpp"
+
+/**
+ * @brief Channel x number -> callbacks index for filtered MIDI subscriptions
+ *
+ * Each filter (message kind, channel or any, number range) owns one bit;
+ * the bits are set in a 16 x 128 table per kind when it is added. Dispatching
+ * a CC or note is one table load, then a call per set bit: a callback only
+ * runs for the controllers and notes it asked for.
+ *
+ * Dispatch is fed by one EventBus listener per kind (see ControllerAPI),
+ * instead of one listener per plugin callback.
+ */
+class MidiDispatchIndex {
+public:
+    using Callback = InplaceFunction<void(uint8_t channel, uint8_t number, uint8_t value),
+                                     System::Memory::EVENT_CALLBACK_SIZE>;
+    using FilterId = uint8_t;
+    static constexpr FilterId INVALID_FILTER = 0xFF;
+    static constexpr uint8_t ANY_CHANNEL = 0xFF;
+
+    enum Kind : uint8_t { CC, NOTE_ON, NOTE_OFF, KIND_COUNT };
+
+    MidiDispatchIndex();
+
+    /**
+     * @param channel 0-15, or ANY_CHANNEL
+     * @param first,last Controller or note range, inclusive (0-127)
+     * @param origins midiOriginBit() of each origin wanted (checked for CC only)
+     * @return Filter id, INVALID_FILTER on bad arguments or when
+     *         System::Memory::MAX_FILTERED_MIDI_CALLBACKS filters exist
+     */
+    FilterId add(Kind kind, uint8_t channel, uint8_t first, uint8_t last, Callback callback,
+                 uint8_t origins = MIDI_ORIGIN_ALL);
+    void remove(FilterId id);
+
+    bool hasFilters(Kind kind) const {
+        return kind < KIND_COUNT && kindCounts_[kind] != 0;
+    }
+
+    /** @param sender Owner of a MidiOrigin::Plugin CC: its own filters are skipped */
+    void dispatch(Kind kind, uint8_t channel, uint8_t number, uint8_t value,
+                  uint8_t originBit = MIDI_ORIGIN_ALL,
+                  uint8_t sender = PluginAccounting::NO_OWNER) {
+        Mask mask = table_[kind][channel & 0x0F][number & 0x7F];
+        ++dispatchDepth_;
+        while (mask != 0) {
+            const uint8_t i = static_cast<uint8_t>(__builtin_ctz(mask));
+            mask &= static_cast<Mask>(mask - 1);
+            Filter& filter = filters_[i];
+            // A callback may remove filters: check before each call
+            if (filter.active && (filter.origins & originBit) &&
+                (sender == PluginAccounting::NO_OWNER || filter.owner != sender)) {
+                PluginAccounting::CallbackTimer timer(filter.owner);
+                filter.callback(channel, number, value);
+            }
+        }
+        if (--dispatchDepth_ == 0) removedDuringDispatch_ = 0;
+    }
+
+private:
+    using Mask = uint16_t;
+    static constexpr size_t FILTERS = System::Memory::MAX_FILTERED_MIDI_CALLBACKS;
+    static_assert(FILTERS <= sizeof(Mask) * 8, "Filter masks are 16 bits");
+
+    struct Filter {
+        Callback callback;
+        Kind kind = CC;
+        uint8_t channel = ANY_CHANNEL;
+        uint8_t first = 0;
+        uint8_t last = 0;
+        uint8_t origins = MIDI_ORIGIN_ALL;
+        uint8_t owner = PluginAccounting::NO_OWNER;
+        bool active = false;
+    };
+
+    /** @brief Set or clear the filter's bit in every cell it covers */
+    void apply(FilterId id, bool set);
+
+    etl::array<Filter, FILTERS> filters_;
+    etl::array<uint8_t, KIND_COUNT> kindCounts_{};
+    uint8_t dispatchDepth_ = 0;
+    Mask removedDuringDispatch_ = 0;  // Slots add() keeps off until the dispatch returns
+    Mask table_[KIND_COUNT][16][128];
+};
@@ -1,34 +1,59 @@
 #include "MidiMapper.hpp"
 
+#include <Arduino.h>
+
 #include "../event/Events.hpp"
 #include "../event/IEventBus.hpp"
 #include "../event/UnifiedEventTypes.hpp"
 #include "../interface/midi/MidiOutput.hpp"
+#include "core/util/MemoryPlacement.hpp"
+#include "log/Macros.hpp"
 
-using InputEvent::ButtonPress;
-using InputEvent::EncoderChanged;
+namespace {
+uint16_t ccCoalesceKey(const Event& e) {
+    const auto& cc = static_cast<const MidiCCEvent&>(e);
+    return static_cast<uint16_t>((cc.channel << 7) | cc.controller);
+}
 
-MidiMapper::MidiMapper(
-    MidiOutput& midiOut, IEventBus& eventBus,
-    const etl::vector<MidiCCMapping, System::Memory::MAX_MIDI_MAPPINGS>& mappings)
-    : midiOut_(midiOut), eventBus_(eventBus), encoderSub_(0), buttonSub_(0) {
-    for (const auto& mapping : mappings) {
-        MidiConfig config{mapping.channel, mapping.cc};
+constexpr uint8_t CC_LSB_OFFSET = 32;
+constexpr uint8_t CC_DATA_ENTRY_MSB = 6;
+constexpr uint8_t CC_DATA_ENTRY_LSB = 38;
+constexpr uint8_t CC_NRPN_LSB = 98;
+constexpr uint8_t CC_NRPN_MSB = 99;
+constexpr int32_t RELATIVE_MAX_DELTA = 63;
 
-        if (mapping.inputId >= 300 && mapping.inputId < 500) {
-            encoders_[mapping.inputId] = config;
-        } else if (mapping.inputId >= 10 && mapping.inputId < 100) {
-            buttons_[mapping.inputId] = config;
-        }
+/** @param delta -63..63 */
+HOT_CODE uint8_t encodeRelative(MidiResolution resolution, int32_t delta) {
+    switch (resolution) {
+        case MidiResolution::RelativeOffset:
+            return static_cast<uint8_t>(64 + delta);
+        case MidiResolution::RelativeSigned:
+            return static_cast<uint8_t>(delta < 0 ? 0x40 | -delta : delta);
+        default:
+            return static_cast<uint8_t>(delta & 0x7F);
     }
+}
+}  // namespace
 
-    encoderSub_ = eventBus_.on(EventCategory::Input, EncoderChanged, [this](const Event& e) {
-        onEncoderChangedEvent(static_cast<const EncoderChangedEvent&>(e));
-    });
+MidiMapper::MidiMapper(MidiOutput& midiOut, IEventBus& eventBus, const Mappings& mappings)
+    : midiOut_(midiOut), eventBus_(eventBus), encoderSub_(0), buttonSub_(0) {
+    setMappings(mappings);
+
+    // Encoder-driven CC notifications are posted: only the latest value per
+    // channel/CC reaches plugins when the loop falls behind
+    eventBus_.coalesce(EventCategory::MIDI, MidiEvent::CC, ccCoalesceKey);
+
+    encoderSub_ = eventBus_.on<EncoderChangedEvent>(
+        [this](const EncoderChangedEvent& e) { onEncoderChangedEvent(e); });
 
-    buttonSub_ = eventBus_.on(EventCategory::Input, ButtonPress, [this](const Event& e) {
-        onButtonPressEvent(static_cast<const ButtonPressEvent&>(e));
+    buttonSub_ = eventBus_.on<ButtonPressEvent>(
+        [this](const ButtonPressEvent& e) { onButtonPressEvent(e); });
+
+    modeSub_ = eventBus_.on<SystemModeChangedEvent>([this](const SystemModeChangedEvent& e) {
+        setLearning(e.mode == SystemMode::MidiLearn);
     });
+
+    ccInSub_ = eventBus_.on<MidiCCEvent>([this](const MidiCCEvent& e) { onIncomingCc(e); });
 }
 
 MidiMapper::~MidiMapper() {
@@ -38,42 +63,313 @@ MidiMapper::~MidiMapper() {
     if (buttonSub_ != 0) {
         eventBus_.off(buttonSub_);
     }
+    if (modeSub_ != 0) {
+        eventBus_.off(modeSub_);
+    }
+    if (ccInSub_ != 0) {
+        eventBus_.off(ccInSub_);
+    }
 }
 
-const MidiMapper::MidiConfig* MidiMapper::findEncoder(EncoderID id) const {
-    auto it = encoders_.find(static_cast<uint16_t>(id));
-    return (it != encoders_.end()) ? &it->second : nullptr;
+void MidiMapper::setMappings(const Mappings& mappings) {
+    for (auto& selected : selectedNrpn_) {
+        selected = NO_NRPN;
+    }
+    for (MidiConfig& config : encoders_) {
+        config = MidiConfig{};
+    }
+    for (MidiConfig& config : buttons_) {
+        config = MidiConfig{};
+    }
+    learnTarget_ = nullptr;
+
+    for (const auto& mapping : mappings) {
+        const uint8_t index = mapping.inputIndex();
+        if (index == INVALID_INPUT_INDEX) {
+            LOGF("[MidiMapper] WARNING: No control %d, mapping ignored\n", mapping.inputId);
+            continue;
+        }
+
+        MidiConfig& config = (mapping.kind == MidiInputKind::Encoder) ? encoders_[index]
+                                                                       : buttons_[index];
+        config = MidiConfig{};
+        config.mapped = true;
+        config.channel = mapping.channel;
+        config.control = mapping.cc;
+        config.resolution = mapping.resolution;
+        // The LSB goes out on cc + 32: above CC 31 it would land on another MSB
+        if (config.resolution == MidiResolution::CC14 && config.control >= CC_LSB_OFFSET) {
+            LOGF("[MidiMapper] WARNING: 14-bit CC %d above 31, sent as 7-bit\n", config.control);
+            config.resolution = MidiResolution::CC7;
+        }
+    }
 }
 
-const MidiMapper::MidiConfig* MidiMapper::findButton(ButtonID id) const {
-    auto it = buttons_.find(static_cast<uint16_t>(id));
-    return (it != buttons_.end()) ? &it->second : nullptr;
+MidiMapper::MidiConfig* MidiMapper::findEncoder(EncoderID id) {
+    const uint8_t index = encoderIndex(id);
+    if (index == INVALID_INPUT_INDEX || !encoders_[index].mapped) return nullptr;
+    return &encoders_[index];
 }
 
-void MidiMapper::onEncoderChangedEvent(const EncoderChangedEvent& event) {
-    const auto* config = findEncoder(event.encoderId);
+MidiMapper::MidiConfig* MidiMapper::findButton(ButtonID id) {
+    const uint8_t index = buttonIndex(id);
+    if (index == INVALID_INPUT_INDEX || !buttons_[index].mapped) return nullptr;
+    return &buttons_[index];
+}
+
+HOT_CODE void MidiMapper::update() {
+    const uint32_t nowUs = micros();
+    for (uint8_t i = 0; i < ENCODER_ID_COUNT; ++i) {
+        MidiConfig& config = encoders_[i];
+        if (config.hasPending && nowUs - config.lastSendUs >= ENCODER_RATE_LIMIT_US) {
+            config.hasPending = false;
+            sendEncoder(config, static_cast<uint8_t>(ENCODER_IDS[i]), config.pendingValue,
+                        config.pendingTimestampUs, nowUs);
+        }
+    }
+}
+
+void MidiMapper::exportMappings(Mappings& out) const {
+    out.clear();
+    for (uint8_t i = 0; i < ENCODER_ID_COUNT; ++i) {
+        const MidiConfig& config = encoders_[i];
+        if (config.mapped) {
+            out.push_back(
+                MidiCCMapping(ENCODER_IDS[i], config.channel, config.control, config.resolution));
+        }
+    }
+    for (uint8_t i = 0; i < BUTTON_ID_COUNT; ++i) {
+        const MidiConfig& config = buttons_[i];
+        if (config.mapped) {
+            out.push_back(MidiCCMapping(BUTTON_IDS[i], config.channel, config.control));
+        }
+    }
+}
+
+void MidiMapper::setLearning(bool learning) {
+    if (learning == learning_) return;
+    learning_ = learning;
+    learnTarget_ = nullptr;
+    LOGF("[MidiMapper] MIDI learn %s\n", learning ? "on" : "off");
+}
+
+HOT_CODE void MidiMapper::onIncomingCc(const MidiCCEvent& event) {
+    if (!learnTarget_ || event.origin != MidiOrigin::Host) {
+        return;
+    }
+
+    MidiConfig& config = *learnTarget_;
+    learnTarget_ = nullptr;
+
+    config.mapped = true;
+    config.channel = event.channel;
+    config.control = event.controller;
+    // A learned CC can't carry an NRPN number, nor an LSB pair above CC 31
+    if (config.resolution == MidiResolution::NRPN ||
+        (config.resolution == MidiResolution::CC14 && config.control >= CC_LSB_OFFSET)) {
+        config.resolution = MidiResolution::CC7;
+    }
+    config.lastMsb = UNSENT;
+    config.lastLsb = UNSENT;
+    config.hasPending = false;
+    config.pendingDelta = 0;
+    config.lastInput = UNSENT;
+
+    LOGF("[MidiMapper] Learned ch %d CC %d\n", config.channel + 1, config.control);
+    if (onLearn_) {
+        onLearn_();
+    }
+}
+
+HOT_CODE void MidiMapper::onEncoderChangedEvent(const EncoderChangedEvent& event) {
+    if (learning_) {
+        // Unmapped controls can be learned too
+        const uint8_t index = encoderIndex(event.encoderId);
+        if (index != INVALID_INPUT_INDEX) {
+            learnTarget_ = &encoders_[index];
+        }
+        return;
+    }
+
+    auto* config = findEncoder(event.encoderId);
     if (!config) {
         return;
     }
 
-    uint8_t value = static_cast<uint8_t>(event.normalizedValue * 127.0f);
+    if (isRelative(config->resolution)) {
+        // An absolute encoder counts no detents: one step per 7-bit value it moves
+        const uint8_t input = event.value.to7Bit();
+        int32_t delta = event.delta;
+        if (delta == 0 && config->lastInput != UNSENT) {
+            delta = static_cast<int32_t>(input) - config->lastInput;
+        }
+        config->lastInput = input;
+        config->pendingDelta += delta;
+    }
 
-    midiOut_.sendControlChange(config->channel, config->control, value);
+    const uint32_t nowUs = micros();
+    if (config->lastMsb != UNSENT && nowUs - config->lastSendUs < ENCODER_RATE_LIMIT_US) {
+        // Too soon: keep the latest value, update() sends it when the window ends
+        if (!config->hasPending) {
+            config->pendingTimestampUs = event.timestampUs;  // Latency from the first edge
+        }
+        config->pendingValue = event.value;
+        config->hasPending = true;
+        return;
+    }
 
-    MidiCCEvent midiEvent(config->channel, config->control, value, static_cast<uint8_t>(event.encoderId));
-    eventBus_.emit(midiEvent);
+    config->hasPending = false;
+    sendEncoder(*config, static_cast<uint8_t>(event.encoderId), event.value, event.timestampUs,
+                nowUs);
+}
+
+HOT_CODE void MidiMapper::sendEncoder(MidiConfig& config, uint8_t source, UNorm16 normalized,
+                                      uint32_t timestampUs, uint32_t nowUs) {
+    if (isRelative(config.resolution)) {
+        sendRelative(config, source, normalized, timestampUs, nowUs);
+        return;
+    }
+
+    uint8_t value = normalized.to7Bit();
+
+    MidiResolution resolution = config.resolution;
+    if (resolution == MidiResolution::UMP && !midiOut_.supportsUmp()) {
+        resolution = (config.control < CC_LSB_OFFSET) ? MidiResolution::CC14 : MidiResolution::CC7;
+    }
+
+    if (resolution == MidiResolution::UMP) {
+        midiOut_.setEdgeTimestamp(timestampUs);
+        if (!sendUmp(config, normalized)) {
+            return;
+        }
+    } else if (resolution == MidiResolution::CC7) {
+        if (isDuplicate(config, value, nowUs)) {
+            return;
+        }
+        midiOut_.setEdgeTimestamp(timestampUs);
+        midiOut_.sendControlChange(config.channel, config.control, value);
+        config.lastMsb = value;
+    } else {
+        const uint16_t value14 = normalized.to14Bit();
+        midiOut_.setEdgeTimestamp(timestampUs);
+        if (!sendHighResolution(config, value14)) {
+            return;
+        }
+        value = static_cast<uint8_t>(value14 >> 7);  // Plugins see the MSB
+    }
+    config.lastSendUs = nowUs;
+
+    MidiCCEvent midiEvent(config.channel, config.control, value, source, MidiOrigin::Local);
+    eventBus_.post(midiEvent);
+}
+
+HOT_CODE void MidiMapper::sendRelative(MidiConfig& config, uint8_t source, UNorm16 value,
+                                       uint32_t timestampUs, uint32_t nowUs) {
+    const int32_t delta = constrain(config.pendingDelta, -RELATIVE_MAX_DELTA, RELATIVE_MAX_DELTA);
+    if (delta == 0) {
+        return;
+    }
+
+    // A faster spin than one message can carry: the rest goes in the next window
+    config.pendingDelta -= delta;
+    if (config.pendingDelta != 0) {
+        config.hasPending = true;
+        config.pendingTimestampUs = timestampUs;
+        config.pendingValue = value;  // update() posts it with the rest
+    }
+
+    // No duplicate check: two equal deltas are two moves
+    const uint8_t encoded = encodeRelative(config.resolution, delta);
+    midiOut_.setEdgeTimestamp(timestampUs);
+    midiOut_.sendControlChange(config.channel, config.control, encoded);
+    config.lastMsb = encoded;
+    config.lastSendUs = nowUs;
+
+    // Plugins get the position, as with absolute mappings: 0x41 would read as "65"
+    MidiCCEvent midiEvent(config.channel, config.control, value.to7Bit(), source,
+                          MidiOrigin::Local);
+    eventBus_.post(midiEvent);
+}
+
+HOT_CODE bool MidiMapper::isDuplicate(const MidiConfig& config, uint8_t value, uint32_t nowUs) {
+    return value == config.lastMsb && nowUs - config.lastSendUs < DUPLICATE_CHECK_US;
 }
 
-void MidiMapper::onButtonPressEvent(const ButtonPressEvent& event) {
-    const auto* config = findButton(event.buttonId);
+HOT_CODE bool MidiMapper::sendUmp(MidiConfig& config, UNorm16 normalized) {
+    const uint32_t value = normalized.to32Bit();
+    if (config.lastMsb != UNSENT && value == config.lastUmpValue) {
+        return false;
+    }
+
+    midiOut_.sendUmp(Ump::controlChange(0, config.channel, config.control, value));
+    config.lastUmpValue = value;
+    config.lastMsb = static_cast<uint8_t>(value >> 25);  // Marks the mapping as sent
+    return true;
+}
+
+HOT_CODE bool MidiMapper::sendHighResolution(MidiConfig& config, uint16_t value14) {
+    uint8_t msb = static_cast<uint8_t>((value14 >> 7) & 0x7F);
+    uint8_t lsb = static_cast<uint8_t>(value14 & 0x7F);
+    bool msbChanged = msb != config.lastMsb;
+    bool lsbChanged = lsb != config.lastLsb;
+
+    if (!msbChanged && !lsbChanged) {
+        return false;
+    }
+
+    uint8_t msbControl = config.control;
+    uint8_t lsbControl = static_cast<uint8_t>(config.control + CC_LSB_OFFSET);
+
+    if (config.resolution == MidiResolution::NRPN) {
+        // Parameter select is sticky on the receiver, only resend it when it moves
+        uint8_t& selected = selectedNrpn_[config.channel & 0x0F];
+        if (selected != config.control) {
+            midiOut_.sendControlChange(config.channel, CC_NRPN_MSB, 0);
+            midiOut_.sendControlChange(config.channel, CC_NRPN_LSB, config.control);
+            selected = config.control;
+            msbChanged = lsbChanged = true;
+        }
+        msbControl = CC_DATA_ENTRY_MSB;
+        lsbControl = CC_DATA_ENTRY_LSB;
+    }
+
+    if (msbChanged) {
+        midiOut_.sendControlChange(config.channel, msbControl, msb);
+        config.lastMsb = msb;
+    }
+    if (lsbChanged) {
+        midiOut_.sendControlChange(config.channel, lsbControl, lsb);
+        config.lastLsb = lsb;
+    }
+    return true;
+}
+
+HOT_CODE void MidiMapper::onButtonPressEvent(const ButtonPressEvent& event) {
+    if (learning_) {
+        const uint8_t index = buttonIndex(event.buttonId);
+        if (event.pressed && index != INVALID_INPUT_INDEX) {
+            learnTarget_ = &buttons_[index];
+        }
+        return;
+    }
+
+    auto* config = findButton(event.buttonId);
     if (!config) {
         return;
     }
 
     uint8_t value = event.pressed ? 127 : 0;
+    const uint32_t nowUs = micros();
+    if (isDuplicate(*config, value, nowUs)) {
+        return;
+    }
 
+    midiOut_.setEdgeTimestamp(event.timestampUs);
     midiOut_.sendControlChange(config->channel, config->control, value);
+    config->lastMsb = value;
+    config->lastSendUs = nowUs;
 
-    MidiCCEvent midiEvent(config->channel, config->control, value, static_cast<uint8_t>(event.buttonId));
+    MidiCCEvent midiEvent(config->channel, config->control, value,
+                          static_cast<uint8_t>(event.buttonId), MidiOrigin::Local);
     eventBus_.emit(midiEvent);
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <etl/flat_map.h>
+#include <etl/array.h>
 #include <etl/vector.h>
 
 #include "../Type.hpp"
@@ -8,35 +8,122 @@
 #include "../struct/MidiCCMapping.hpp"
 #include "config/InputID.hpp"
 #include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
+#include "core/util/UNorm16.hpp"
 
 class MidiOutput;
 class EncoderChangedEvent;
 class ButtonPressEvent;
+class MidiCCEvent;
 
+/**
+ * @brief Sends the MIDI messages mapped to encoders and buttons
+ *
+ * Output is governed to avoid flooding the host: a CC is not resent with the
+ * same value inside System::Midi::DUPLICATE_CHECK_MS, and each encoder sends
+ * at most once per ENCODER_RATE_LIMIT_MS. Values arriving faster are held and
+ * the latest one is sent by update() once the window has passed, so the final
+ * position of a sweep always goes out. Relative mappings send deltas instead:
+ * detents turned inside the window add up and go out as one message. On an
+ * encoder in absolute mode (no detent count) a step is one 7-bit value of
+ * travel. The MidiCCEvent posted for plugins carries the encoder's 7-bit
+ * value either way, not the relative-encoded byte sent to the host.
+ *
+ * MIDI learn: while the system is in SystemMode::MidiLearn, touching a control
+ * selects it (nothing is sent) and the next CC received from the host rebinds
+ * it to that channel/CC. The learn callback then fires, e.g. to persist
+ * exportMappings().
+ */
 class MidiMapper {
 public:
-    MidiMapper(MidiOutput& midiOut, IEventBus& eventBus,
-               const etl::vector<MidiCCMapping, System::Memory::MAX_MIDI_MAPPINGS>& mappings);
+    using Mappings = etl::vector<MidiCCMapping, System::Memory::MAX_MIDI_MAPPINGS>;
+    using LearnCallback = InplaceFunction<void(), System::Memory::EVENT_CALLBACK_SIZE>;
+
+    MidiMapper(MidiOutput& midiOut, IEventBus& eventBus, const Mappings& mappings);
     ~MidiMapper();
 
+    /** @brief Send rate-limited encoder values whose window has elapsed (once per loop) */
+    void update();
+
+    /** @brief A rate-limited value is waiting for update() */
+    bool hasPending() const {
+        for (const MidiConfig& config : encoders_) {
+            if (config.hasPending) return true;
+        }
+        return false;
+    }
+
+    /** @brief Current mappings, including learned ones */
+    void exportMappings(Mappings& out) const;
+
+    /** @brief Replace every mapping (e.g. a recalled preset); controls not listed are unmapped */
+    void setMappings(const Mappings& mappings);
+
+    /** @brief Called after each control rebound in learn mode */
+    void setLearnCallback(LearnCallback callback) {
+        onLearn_ = std::move(callback);
+    }
+
+    bool isLearning() const {
+        return learning_;
+    }
+
 private:
+    static constexpr uint32_t DUPLICATE_CHECK_US =
+        static_cast<uint32_t>(System::Midi::DUPLICATE_CHECK_MS * 1000.0f);
+    static constexpr uint32_t ENCODER_RATE_LIMIT_US =
+        static_cast<uint32_t>(System::Midi::ENCODER_RATE_LIMIT_MS * 1000.0f);
+
+    static constexpr uint8_t UNSENT = 0xFF;
+    static constexpr uint8_t NO_NRPN = 0xFF;
+
     struct MidiConfig {
-        uint8_t channel;
-        uint8_t control;
+        bool mapped = false;
+        uint8_t channel = 0;
+        uint8_t control = 0;
+        MidiResolution resolution = MidiResolution::CC7;
+        uint8_t lastMsb = UNSENT;  // Last value sent, UNSENT before the first send
+        uint8_t lastLsb = UNSENT;
+        uint32_t lastUmpValue = 0;
+        uint32_t lastSendUs = 0;
+        bool hasPending = false;  // Rate-limited value waiting for update()
+        UNorm16 pendingValue;
+        uint32_t pendingTimestampUs = 0;
+        int32_t pendingDelta = 0;  // Relative modes: detents not sent yet
+        uint8_t lastInput = UNSENT;  // Relative modes: last 7-bit encoder value seen
     };
 
     void onEncoderChangedEvent(const EncoderChangedEvent& event);
     void onButtonPressEvent(const ButtonPressEvent& event);
+    void onIncomingCc(const MidiCCEvent& event);
+    void setLearning(bool learning);
 
-    const MidiConfig* findEncoder(EncoderID id) const;
-    const MidiConfig* findButton(ButtonID id) const;
+    void sendEncoder(MidiConfig& config, uint8_t source, UNorm16 value,
+                     uint32_t timestampUs, uint32_t nowUs);
+    bool sendHighResolution(MidiConfig& config, uint16_t value14);
+    bool sendUmp(MidiConfig& config, UNorm16 value);
+    void sendRelative(MidiConfig& config, uint8_t source, UNorm16 value, uint32_t timestampUs,
+                      uint32_t nowUs);
+    static bool isDuplicate(const MidiConfig& config, uint8_t value, uint32_t nowUs);
+
+    MidiConfig* findEncoder(EncoderID id);
+    MidiConfig* findButton(ButtonID id);
 
     MidiOutput& midiOut_;
     IEventBus& eventBus_;
 
-    etl::flat_map<uint16_t, MidiConfig, System::Memory::MAX_MIDI_MAPPINGS> encoders_;
-    etl::flat_map<uint16_t, MidiConfig, System::Memory::MAX_MIDI_MAPPINGS> buttons_;
+    // Indexed by encoderIndex() / buttonIndex(), unmapped controls have mapped == false
+    etl::array<MidiConfig, ENCODER_ID_COUNT> encoders_;
+    etl::array<MidiConfig, BUTTON_ID_COUNT> buttons_;
+
+    uint8_t selectedNrpn_[16];  // NRPN parameter last selected per channel
+
+    bool learning_ = false;
+    MidiConfig* learnTarget_ = nullptr;  // Control touched last in learn mode
+    LearnCallback onLearn_;
 
     SubscriptionId encoderSub_;
     SubscriptionId buttonSub_;
+    SubscriptionId modeSub_ = 0;
+    SubscriptionId ccInSub_ = 0;
 };
@@ -0,0 +1,107 @@
+#include "MidiRouter.hpp"
+
+#include "core/interface/midi/MidiOutput.hpp"
+#include "log/Macros.hpp"
+
+static_assert(System::Memory::MAX_MIDI_OUTPUT_PORTS <= 8, "Destination masks are 8 bits");
+
+MidiRouter::PortId MidiRouter::addOutput(MidiOutput& output) {
+    if (outputCount_ >= OUTPUTS) {
+        LOGF("[MidiRouter] ERROR: Cannot add output (max %d)\n", static_cast<int>(OUTPUTS));
+        return INVALID_PORT;
+    }
+    outputs_[outputCount_] = &output;
+    return outputCount_++;
+}
+
+MidiRouter::RouteId MidiRouter::addRoute(PortId source, PortId destination, uint16_t channelMask,
+                                         uint16_t typeMask) {
+    if (source >= INPUTS || destination >= outputCount_) {
+        LOGF("[MidiRouter] ERROR: Unknown port in route %d -> %d\n", source, destination);
+        return INVALID_ROUTE;
+    }
+
+    for (size_t i = 0; i < routes_.size(); ++i) {
+        if (!routes_[i].active) {
+            routes_[i] = {true, source, destination, channelMask, typeMask};
+            rebuild();
+            return static_cast<RouteId>(i);
+        }
+    }
+
+    LOGF("[MidiRouter] ERROR: Cannot add route (max %d)\n",
+         static_cast<int>(System::Memory::MAX_MIDI_ROUTES));
+    return INVALID_ROUTE;
+}
+
+void MidiRouter::removeRoute(RouteId id) {
+    if (id < routes_.size() && routes_[id].active) {
+        routes_[id].active = false;
+        rebuild();
+    }
+}
+
+void MidiRouter::clearRoutes() {
+    for (auto& route : routes_) {
+        route.active = false;
+    }
+    rebuild();
+}
+
+void MidiRouter::rebuild() {
+    table_.fill(0);
+    for (const auto& route : routes_) {
+        if (!route.active) continue;
+
+        const uint8_t bit = static_cast<uint8_t>(1u << route.destination);
+        for (uint8_t type = 0; type < TYPE_COUNT; ++type) {
+            if (!(route.typeMask & (1u << type))) continue;
+            for (uint8_t channel = 0; channel < 16; ++channel) {
+                // SysEx / realtime have no channel: any channel bit enables them (slot 0)
+                const bool channelless = type >= SYSEX;
+                if (channelless ? (channel == 0 && route.channelMask != 0)
+                                : (route.channelMask & (1u << channel)) != 0) {
+                    table_[tableIndex(route.source, static_cast<Type>(type), channel)] |= bit;
+                }
+            }
+        }
+    }
+}
+
+void MidiRouter::sendChannel(uint8_t destinations, Type type, uint8_t channel, uint8_t data1,
+                             uint16_t data2) {
+    const uint8_t value = static_cast<uint8_t>(data2);
+    for (uint8_t port = 0; destinations != 0; ++port, destinations >>= 1) {
+        if (!(destinations & 1)) continue;
+
+        MidiOutput& out = *outputs_[port];
+        switch (type) {
+            case NOTE_OFF: out.sendNoteOff(channel, data1, value); break;
+            case NOTE_ON: out.sendNoteOn(channel, data1, value); break;
+            case POLY_PRESSURE: out.sendPolyPressure(channel, data1, value); break;
+            case CONTROL_CHANGE: out.sendControlChange(channel, data1, value); break;
+            case PROGRAM_CHANGE: out.sendProgramChange(channel, data1); break;
+            case CHANNEL_PRESSURE: out.sendChannelPressure(channel, data1); break;
+            case PITCH_BEND: out.sendPitchBend(channel, data2); break;
+            default: break;
+        }
+    }
+}
+
+void MidiRouter::routeSysEx(PortId source, const uint8_t* data, uint16_t length) {
+    uint8_t destinations = table_[tableIndex(source, SYSEX, 0)];
+    for (uint8_t port = 0; destinations != 0; ++port, destinations >>= 1) {
+        if (destinations & 1) {
+            outputs_[port]->sendSysEx(data, length);
+        }
+    }
+}
+
+void MidiRouter::routeRealtime(PortId source, uint8_t status) {
+    uint8_t destinations = table_[tableIndex(source, REALTIME, 0)];
+    for (uint8_t port = 0; destinations != 0; ++port, destinations >>= 1) {
+        if (destinations & 1) {
+            outputs_[port]->sendRealtime(status);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <etl/array.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+
+class MidiOutput;
+
+/**
+ * @brief MIDI thru matrix: input port x channel x message type -> output ports
+ *
+ * Inputs call route*() from their receive handlers, before emitting on the
+ * EventBus, so forwarded traffic never goes through the bus or a plugin.
+ * Routes are compiled into a destination table on every change; routing a
+ * message is one table load and a send per destination bit.
+ *
+ * Port numbers: inputs are numbered by the caller (MidiPort), outputs in
+ * addOutput() order. Make sure no route sends a port back to itself through
+ * an external loop.
+ */
+namespace MidiPort {
+constexpr uint8_t USB = 0;  // USB input, and USB output (first addOutput())
+constexpr uint8_t DIN = 1;  // DIN output (SerialMidiOut, System::Midi::DIN_OUTPUT_SERIAL)
+}
+
+class MidiRouter {
+public:
+    using PortId = uint8_t;
+    using RouteId = uint8_t;
+    static constexpr PortId INVALID_PORT = 0xFF;
+    static constexpr RouteId INVALID_ROUTE = 0xFF;
+
+    enum Type : uint8_t {
+        NOTE_OFF,
+        NOTE_ON,
+        POLY_PRESSURE,
+        CONTROL_CHANGE,
+        PROGRAM_CHANGE,
+        CHANNEL_PRESSURE,
+        PITCH_BEND,
+        SYSEX,     // Complete messages only, channel ignored
+        REALTIME,  // Clock, start, stop..., channel ignored
+        TYPE_COUNT
+    };
+
+    static constexpr uint16_t ALL_CHANNELS = 0xFFFF;
+    static constexpr uint16_t ALL_TYPES = (1u << TYPE_COUNT) - 1;
+    static constexpr uint16_t CHANNEL_TYPES = (1u << SYSEX) - 1;
+
+    static constexpr uint16_t typeBit(Type type) {
+        return static_cast<uint16_t>(1u << type);
+    }
+
+    /** @return Output port id, INVALID_PORT if MAX_MIDI_OUTPUT_PORTS reached */
+    PortId addOutput(MidiOutput& output);
+
+    /**
+     * @brief Forward messages from source to destination
+     * @param channelMask Bit n = channel n (0-15)
+     * @param typeMask typeBit() of each Type forwarded
+     * @return Route id, INVALID_ROUTE if ports are unknown or MAX_MIDI_ROUTES reached
+     */
+    RouteId addRoute(PortId source, PortId destination, uint16_t channelMask = ALL_CHANNELS,
+                     uint16_t typeMask = ALL_TYPES);
+    void removeRoute(RouteId id);
+    void clearRoutes();
+
+    /** @param data2 Second data byte, or the 14-bit value (0-16383) for PITCH_BEND */
+    void routeChannel(PortId source, Type type, uint8_t channel, uint8_t data1, uint16_t data2) {
+        const uint8_t destinations = table_[tableIndex(source, type, channel)];
+        if (destinations != 0) {
+            sendChannel(destinations, type, channel, data1, data2);
+        }
+    }
+
+    void routeSysEx(PortId source, const uint8_t* data, uint16_t length);
+    void routeRealtime(PortId source, uint8_t status);
+
+private:
+    static constexpr size_t INPUTS = System::Memory::MAX_MIDI_INPUT_PORTS;
+    static constexpr size_t OUTPUTS = System::Memory::MAX_MIDI_OUTPUT_PORTS;
+
+    struct Route {
+        bool active;
+        PortId source;
+        PortId destination;
+        uint16_t channelMask;
+        uint16_t typeMask;
+    };
+
+    static size_t tableIndex(PortId source, Type type, uint8_t channel) {
+        return ((static_cast<size_t>(source % INPUTS) * TYPE_COUNT) + type) * 16 + (channel & 0x0F);
+    }
+
+    void rebuild();
+    void sendChannel(uint8_t destinations, Type type, uint8_t channel, uint8_t data1,
+                     uint16_t data2);
+
+    etl::array<MidiOutput*, OUTPUTS> outputs_ = {};
+    uint8_t outputCount_ = 0;
+    etl::array<Route, System::Memory::MAX_MIDI_ROUTES> routes_ = {};
+
+    // Output port bitmask per (source, type, channel)
+    etl::array<uint8_t, INPUTS * TYPE_COUNT * 16> table_ = {};
+};
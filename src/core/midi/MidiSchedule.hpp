@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config/System.hpp"
+
+/**
+ * @brief Fixed-capacity min-heap of MIDI messages ordered by deadline
+ *
+ * Deadlines are micros() values compared by difference, so the heap stays
+ * ordered across the 32-bit wrap as long as every deadline is within ~35
+ * minutes of the others. Not synchronized: callers sharing it with an ISR
+ * must guard push() and pop().
+ */
+class MidiSchedule {
+public:
+    struct Message {
+        uint32_t deadlineUs;
+        uint8_t status;  // Channel voice status byte, channel included
+        uint8_t data1;
+        uint8_t data2;
+    };
+
+    static constexpr size_t CAPACITY = System::Memory::MAX_SCHEDULED_MIDI;
+
+    /** @return false when full */
+    bool push(const Message& message) {
+        if (size_ >= CAPACITY) return false;
+
+        size_t child = size_++;
+        while (child > 0) {
+            const size_t parent = (child - 1) / 2;
+            if (!earlier(message, heap_[parent])) break;
+            heap_[child] = heap_[parent];
+            child = parent;
+        }
+        heap_[child] = message;
+        return true;
+    }
+
+    /** @brief Earliest message; only valid when !empty() */
+    const Message& top() const {
+        return heap_[0];
+    }
+
+    void pop() {
+        if (size_ == 0) return;
+
+        const Message last = heap_[--size_];
+        size_t parent = 0;
+        for (;;) {
+            size_t child = 2 * parent + 1;
+            if (child >= size_) break;
+            if (child + 1 < size_ && earlier(heap_[child + 1], heap_[child])) {
+                ++child;
+            }
+            if (!earlier(heap_[child], last)) break;
+            heap_[parent] = heap_[child];
+            parent = child;
+        }
+        heap_[parent] = last;
+    }
+
+    bool isDue(uint32_t nowUs) const {
+        return size_ > 0 && static_cast<int32_t>(nowUs - heap_[0].deadlineUs) >= 0;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    void clear() {
+        size_ = 0;
+    }
+
+    /** @brief Every queued message, in heap (not deadline) order */
+    const Message* begin() const {
+        return heap_;
+    }
+
+    const Message* end() const {
+        return heap_ + size_;
+    }
+
+private:
+    static bool earlier(const Message& a, const Message& b) {
+        return static_cast<int32_t>(a.deadlineUs - b.deadlineUs) < 0;
+    }
+
+    Message heap_[CAPACITY];
+    size_t size_ = 0;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Sounding notes, one bit per channel/note (16 x 128 bits)
+ *
+ * mark()/clear() are a single bit operation; forEachActive() walks set bits
+ * a word at a time, so a panic only visits notes that are actually on.
+ */
+class NoteTracker {
+public:
+    static constexpr uint8_t CHANNELS = 16;
+    static constexpr uint8_t NOTES = 128;
+
+    void mark(uint8_t channel, uint8_t note) {
+        word(channel, note) |= bit(note);
+    }
+
+    void clear(uint8_t channel, uint8_t note) {
+        word(channel, note) &= ~bit(note);
+    }
+
+    bool isActive(uint8_t channel, uint8_t note) const {
+        return (words_[channel & 0x0F][(note & 0x7F) >> 5] & bit(note)) != 0;
+    }
+
+    bool any() const {
+        for (const auto& channel : words_) {
+            for (uint32_t word : channel) {
+                if (word != 0) return true;
+            }
+        }
+        return false;
+    }
+
+    void reset() {
+        for (auto& channel : words_) {
+            for (uint32_t& word : channel) {
+                word = 0;
+            }
+        }
+    }
+
+    /** @brief fn(channel, note) for every active note, lowest channel and note first */
+    template <typename Fn>
+    void forEachActive(Fn&& fn) const {
+        for (uint8_t channel = 0; channel < CHANNELS; ++channel) {
+            for (uint8_t w = 0; w < WORDS_PER_CHANNEL; ++w) {
+                uint32_t bits = words_[channel][w];
+                while (bits != 0) {
+                    const uint8_t offset = static_cast<uint8_t>(__builtin_ctz(bits));
+                    fn(channel, static_cast<uint8_t>((w << 5) | offset));
+                    bits &= bits - 1;
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr uint8_t WORDS_PER_CHANNEL = NOTES / 32;
+
+    static uint32_t bit(uint8_t note) {
+        return 1u << (note & 0x1F);
+    }
+
+    uint32_t& word(uint8_t channel, uint8_t note) {
+        return words_[channel & 0x0F][(note & 0x7F) >> 5];
+    }
+
+    uint32_t words_[CHANNELS][WORDS_PER_CHANNEL] = {};
+};
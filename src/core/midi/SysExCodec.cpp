@@ -0,0 +1,288 @@
+#include "SysExCodec.hpp"
+
+#include <string.h>
+
+namespace {
+
+/*
+ * Little-endian word tricks (Cortex-M7). Unaligned 32-bit loads/stores are
+ * legal on the M7, memcpy compiles down to single LDR/STR.
+ */
+inline uint32_t load32(const uint8_t* p) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+inline void store32(uint8_t* p, uint32_t word) {
+    memcpy(p, &word, sizeof(word));
+}
+
+/** @brief Top bit of each byte of word, packed into bits 0-3 */
+inline uint8_t gatherHighBits(uint32_t word) {
+    return static_cast<uint8_t>((((word & 0x80808080u) >> 7) * 0x01020408u) >> 24) & 0x0F;
+}
+
+/** @brief Bits 0-3 spread to the top bit of each byte */
+inline uint32_t spreadHighBits(uint8_t bits) {
+    return (static_cast<uint32_t>(bits & 0x0F) * 0x10204080u) & 0x80808080u;
+}
+
+constexpr uint32_t LOW_BITS = 0x7F7F7F7Fu;
+
+}  // namespace
+
+namespace SysExCodec {
+
+size_t pack(const uint8_t* in, size_t length, uint8_t* out, size_t capacity) {
+    const size_t packed = packedSize(length);
+    if (capacity < packed) {
+        return 0;
+    }
+
+    size_t read = 0;
+    size_t written = 0;
+
+    // Full groups: 7 bytes in, 8 out, two word operations each way
+    while (length - read >= 8) {  // Second load reads one byte past the group
+        const uint32_t lo = load32(in + read);
+        const uint32_t hi = load32(in + read + 4) & 0x00FFFFFFu;
+        out[written] = gatherHighBits(lo) | static_cast<uint8_t>(gatherHighBits(hi) << 4);
+        store32(out + written + 1, lo & LOW_BITS);
+        const uint32_t tail = hi & LOW_BITS;
+        out[written + 5] = static_cast<uint8_t>(tail);
+        out[written + 6] = static_cast<uint8_t>(tail >> 8);
+        out[written + 7] = static_cast<uint8_t>(tail >> 16);
+        read += 7;
+        written += 8;
+    }
+
+    // Last group(s), byte by byte
+    while (read < length) {
+        const size_t count = (length - read < 7) ? length - read : 7;
+        uint8_t header = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t byte = in[read + i];
+            header |= static_cast<uint8_t>((byte >> 7) << i);
+            out[written + 1 + i] = byte & 0x7F;
+        }
+        out[written] = header;
+        read += count;
+        written += count + 1;
+    }
+
+    return written;
+}
+
+size_t unpack(const uint8_t* in, size_t length, uint8_t* out, size_t capacity) {
+    const size_t unpacked = unpackedSize(length);
+    if (capacity < unpacked) {
+        return 0;
+    }
+
+    size_t read = 0;
+    size_t written = 0;
+
+    // Full groups; both words are loaded before anything is stored (in-place safe)
+    while (length - read >= 8) {
+        const uint8_t header = in[read];
+        const uint32_t lo = load32(in + read + 1);
+        const uint8_t b4 = in[read + 5];
+        const uint8_t b5 = in[read + 6];
+        const uint8_t b6 = in[read + 7];
+
+        store32(out + written, (lo & LOW_BITS) | spreadHighBits(header));
+        const uint8_t high = header >> 4;
+        out[written + 4] = static_cast<uint8_t>((b4 & 0x7F) | ((high & 0x01) << 7));
+        out[written + 5] = static_cast<uint8_t>((b5 & 0x7F) | ((high & 0x02) << 6));
+        out[written + 6] = static_cast<uint8_t>((b6 & 0x7F) | ((high & 0x04) << 5));
+        read += 8;
+        written += 7;
+    }
+
+    // Short trailing group
+    if (read < length) {
+        const uint8_t header = in[read];
+        const size_t count = length - read - 1;
+        for (size_t i = 0; i < count; ++i) {
+            out[written + i] =
+                static_cast<uint8_t>((in[read + 1 + i] & 0x7F) | (((header >> i) & 0x01) << 7));
+        }
+        written += count;
+    }
+
+    return written;
+}
+
+}  // namespace SysExCodec
+
+/*
+ * SysExReader
+ */
+bool SysExReader::take(size_t count, const uint8_t*& bytes) {
+    if (failed_ || length_ - position_ < count) {
+        failed_ = true;
+        return false;
+    }
+
+    bytes = data_ + position_;
+    for (size_t i = 0; i < count; ++i) {
+        if (bytes[i] & 0x80) {
+            failed_ = true;
+            return false;
+        }
+    }
+    position_ += count;
+    return true;
+}
+
+bool SysExReader::readU7(uint8_t& value) {
+    const uint8_t* bytes;
+    if (!take(1, bytes)) return false;
+    value = bytes[0];
+    return true;
+}
+
+bool SysExReader::readU14(uint16_t& value) {
+    const uint8_t* bytes;
+    if (!take(2, bytes)) return false;
+    value = static_cast<uint16_t>((bytes[0] << 7) | bytes[1]);
+    return true;
+}
+
+bool SysExReader::readU16(uint16_t& value) {
+    const uint8_t* bytes;
+    if (!take(3, bytes)) return false;
+    value = static_cast<uint16_t>((bytes[0] << 14) | (bytes[1] << 7) | bytes[2]);
+    return true;
+}
+
+bool SysExReader::readU32(uint32_t& value) {
+    const uint8_t* bytes;
+    if (!take(5, bytes)) return false;
+    value = 0;
+    for (size_t i = 0; i < 5; ++i) {
+        value = (value << 7) | bytes[i];
+    }
+    return true;
+}
+
+bool SysExReader::readNormalized(float& value) {
+    uint16_t raw;
+    if (!readU14(raw)) return false;
+    value = static_cast<float>(raw) / 16383.0f;
+    return true;
+}
+
+bool SysExReader::readBool(bool& value) {
+    uint8_t raw;
+    if (!readU7(raw)) return false;
+    value = raw != 0;
+    return true;
+}
+
+bool SysExReader::readString(char* out, size_t capacity) {
+    uint8_t length;
+    const uint8_t* bytes;
+    if (capacity == 0 || !readU7(length) || !take(length, bytes)) {
+        return false;
+    }
+
+    const size_t copied = (length < capacity - 1) ? length : capacity - 1;
+    memcpy(out, bytes, copied);
+    out[copied] = '\0';
+    return true;
+}
+
+bool SysExReader::readBytes(uint8_t* out, size_t count) {
+    const uint8_t* bytes;
+    if (!take(count, bytes)) return false;
+    memcpy(out, bytes, count);
+    return true;
+}
+
+bool SysExReader::skip(size_t count) {
+    const uint8_t* bytes;
+    return take(count, bytes);
+}
+
+/*
+ * SysExWriter
+ */
+uint8_t* SysExWriter::reserve(size_t count) {
+    if (failed_ || capacity_ - position_ < count) {
+        failed_ = true;
+        return nullptr;
+    }
+
+    uint8_t* bytes = data_ + position_;
+    position_ += count;
+    return bytes;
+}
+
+bool SysExWriter::writeU7(uint8_t value) {
+    uint8_t* bytes = reserve(1);
+    if (!bytes) return false;
+    bytes[0] = value & 0x7F;
+    return true;
+}
+
+bool SysExWriter::writeU14(uint16_t value) {
+    uint8_t* bytes = reserve(2);
+    if (!bytes) return false;
+    if (value > 0x3FFF) value = 0x3FFF;
+    bytes[0] = static_cast<uint8_t>(value >> 7);
+    bytes[1] = static_cast<uint8_t>(value & 0x7F);
+    return true;
+}
+
+bool SysExWriter::writeU16(uint16_t value) {
+    uint8_t* bytes = reserve(3);
+    if (!bytes) return false;
+    bytes[0] = static_cast<uint8_t>(value >> 14);
+    bytes[1] = static_cast<uint8_t>((value >> 7) & 0x7F);
+    bytes[2] = static_cast<uint8_t>(value & 0x7F);
+    return true;
+}
+
+bool SysExWriter::writeU32(uint32_t value) {
+    uint8_t* bytes = reserve(5);
+    if (!bytes) return false;
+    for (size_t i = 5; i-- > 0;) {
+        bytes[i] = static_cast<uint8_t>(value & 0x7F);
+        value >>= 7;
+    }
+    return true;
+}
+
+bool SysExWriter::writeNormalized(float value) {
+    if (value < 0.0f) value = 0.0f;
+    if (value > 1.0f) value = 1.0f;
+    return writeU14(static_cast<uint16_t>(value * 16383.0f + 0.5f));
+}
+
+bool SysExWriter::writeBool(bool value) {
+    return writeU7(value ? 1 : 0);
+}
+
+bool SysExWriter::writeString(const char* text) {
+    size_t length = text ? strlen(text) : 0;
+    if (length > 0x7F) length = 0x7F;
+
+    uint8_t* bytes = reserve(length + 1);
+    if (!bytes) return false;
+    bytes[0] = static_cast<uint8_t>(length);
+    for (size_t i = 0; i < length; ++i) {
+        bytes[1 + i] = static_cast<uint8_t>(text[i]) & 0x7F;
+    }
+    return true;
+}
+
+bool SysExWriter::writeBytes(const uint8_t* in, size_t count) {
+    uint8_t* bytes = reserve(count);
+    if (!bytes) return false;
+    for (size_t i = 0; i < count; ++i) {
+        bytes[i] = in[i] & 0x7F;
+    }
+    return true;
+}
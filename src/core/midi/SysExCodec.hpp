@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 8-bit <-> 7-bit SysEx payload codec
+ *
+ * Groups of up to 7 raw bytes are sent as one header byte holding their top
+ * bits (bit i = MSB of byte i) followed by the 7 low-bit bytes:
+ *
+ *   raw    b0 b1 b2 b3 b4 b5 b6
+ *   packed hdr b0&7F b1&7F ... b6&7F
+ *
+ * The trailing group may be shorter. pack()/unpack() work a 32-bit word at a
+ * time and unpack() may decode in place (out == in).
+ */
+namespace SysExCodec {
+
+constexpr size_t packedSize(size_t rawLength) {
+    return rawLength + (rawLength + 6) / 7;
+}
+
+constexpr size_t unpackedSize(size_t packedLength) {
+    return packedLength - (packedLength + 7) / 8;
+}
+
+/**
+ * @brief Encode raw bytes into 7-bit safe bytes
+ * @return Bytes written, 0 if capacity < packedSize(length)
+ */
+size_t pack(const uint8_t* in, size_t length, uint8_t* out, size_t capacity);
+
+/**
+ * @brief Decode 7-bit bytes back to raw bytes (out may equal in)
+ * @return Bytes written, 0 if capacity < unpackedSize(length)
+ */
+size_t unpack(const uint8_t* in, size_t length, uint8_t* out, size_t capacity);
+
+}  // namespace SysExCodec
+
+/**
+ * @brief Bounds-checked reader over a 7-bit SysEx payload
+ *
+ * Reads fail (return false) once the payload is exhausted or a byte has its
+ * top bit set; the failure is sticky, so a message can be parsed with a
+ * chain of reads and checked once with ok().
+ */
+class SysExReader {
+public:
+    SysExReader(const uint8_t* data, size_t length) : data_(data), length_(length) {}
+
+    bool readU7(uint8_t& value);
+
+    /** @brief 14-bit value, MSB first (2 bytes) */
+    bool readU14(uint16_t& value);
+
+    /** @brief 16-bit value, 3 bytes MSB first (2 + 7 + 7 bits) */
+    bool readU16(uint16_t& value);
+
+    /** @brief 32-bit value, 5 bytes MSB first (4 + 4 * 7 bits) */
+    bool readU32(uint32_t& value);
+
+    /** @brief Value scaled from 14 bits to 0.0-1.0 */
+    bool readNormalized(float& value);
+
+    bool readBool(bool& value);
+
+    /**
+     * @brief Length-prefixed 7-bit string (1 length byte, then the characters)
+     * @param out Null-terminated on success; truncated to capacity - 1
+     */
+    bool readString(char* out, size_t capacity);
+
+    /** @brief Raw 7-bit bytes, copied as-is */
+    bool readBytes(uint8_t* out, size_t count);
+
+    bool skip(size_t count);
+
+    size_t remaining() const {
+        return failed_ ? 0 : length_ - position_;
+    }
+
+    size_t position() const {
+        return position_;
+    }
+
+    bool ok() const {
+        return !failed_;
+    }
+
+private:
+    bool take(size_t count, const uint8_t*& bytes);
+
+    const uint8_t* data_;
+    size_t length_;
+    size_t position_ = 0;
+    bool failed_ = false;
+};
+
+/**
+ * @brief Bounds-checked writer producing a 7-bit SysEx payload
+ *
+ * Mirror of SysExReader; values that don't fit their field are clamped.
+ * Writes fail (sticky) once the buffer is full.
+ */
+class SysExWriter {
+public:
+    SysExWriter(uint8_t* data, size_t capacity) : data_(data), capacity_(capacity) {}
+
+    bool writeU7(uint8_t value);
+    bool writeU14(uint16_t value);
+    bool writeU16(uint16_t value);
+    bool writeU32(uint32_t value);
+    bool writeNormalized(float value);
+    bool writeBool(bool value);
+
+    /** @brief Length-prefixed string, truncated to 127 characters */
+    bool writeString(const char* text);
+
+    bool writeBytes(const uint8_t* bytes, size_t count);
+
+    size_t size() const {
+        return position_;
+    }
+
+    bool ok() const {
+        return !failed_;
+    }
+
+private:
+    uint8_t* reserve(size_t count);
+
+    uint8_t* data_;
+    size_t capacity_;
+    size_t position_ = 0;
+    bool failed_ = false;
+};
@@ -0,0 +1,118 @@
+#include "SysExRouter.hpp"
+
+#include <utility>
+
+#include "log/Macros.hpp"
+
+SysExRouter::SysExRouter() {
+    rebuild();
+}
+
+SysExRouter::HandlerId SysExRouter::add(const uint8_t* prefix, uint8_t length, Handler handler) {
+    if (prefix == nullptr || length == 0 || length > MAX_PREFIX || !handler) {
+        LOGLN("[SysExRouter] ERROR: Invalid prefix");
+        return INVALID_HANDLER;
+    }
+    for (uint8_t i = 0; i < length; ++i) {
+        if (prefix[i] & 0x80) {
+            LOGLN("[SysExRouter] ERROR: Prefix bytes must be 7-bit");
+            return INVALID_HANDLER;
+        }
+    }
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        Entry& entry = entries_[i];
+        if (entry.active) continue;
+
+        for (uint8_t b = 0; b < length; ++b) {
+            entry.prefix[b] = prefix[b];
+        }
+        entry.length = length;
+        entry.handler = std::move(handler);
+        entry.owner = PluginAccounting::currentOwner();
+        entry.active = true;
+
+        if (!insert(static_cast<HandlerId>(i))) {
+            entry.active = false;
+            rebuild();  // Drop the nodes a failed insert may have added
+            return INVALID_HANDLER;
+        }
+        ++activeCount_;
+        return static_cast<HandlerId>(i);
+    }
+
+    LOGF("[SysExRouter] ERROR: Cannot add handler (max %d)\n", static_cast<int>(HANDLERS));
+    return INVALID_HANDLER;
+}
+
+void SysExRouter::remove(HandlerId id) {
+    if (id >= entries_.size() || !entries_[id].active) return;
+
+    // The handler object stays: remove() may run from inside it
+    entries_[id].active = false;
+    --activeCount_;
+    rebuild();
+}
+
+bool SysExRouter::route(const uint8_t* data, uint16_t length) {
+    if (length < 2 || data[0] != 0xF0) return false;
+
+    // Longest prefix wins: remember the deepest node with a handler on the way down
+    HandlerId match = INVALID_HANDLER;
+    uint8_t node = ROOT;
+    const uint16_t end = length - 1;  // No prefix reaches the trailing 0xF7
+    for (uint16_t i = 1; i < end && i <= MAX_PREFIX; ++i) {
+        node = findChild(node, data[i]);
+        if (node == NO_NODE) break;
+        if (nodes_[node].handler != INVALID_HANDLER) {
+            match = nodes_[node].handler;
+        }
+    }
+
+    if (match == INVALID_HANDLER) return false;
+    PluginAccounting::CallbackTimer timer(entries_[match].owner);
+    entries_[match].handler(data, length);
+    return true;
+}
+
+uint8_t SysExRouter::findChild(uint8_t node, uint8_t byte) const {
+    for (uint8_t child = nodes_[node].child; child != NO_NODE; child = nodes_[child].sibling) {
+        if (nodes_[child].byte == byte) return child;
+    }
+    return NO_NODE;
+}
+
+bool SysExRouter::insert(HandlerId id) {
+    const Entry& entry = entries_[id];
+    uint8_t node = ROOT;
+    for (uint8_t i = 0; i < entry.length; ++i) {
+        uint8_t next = findChild(node, entry.prefix[i]);
+        if (next == NO_NODE) {
+            if (nodes_.full()) {
+                LOGLN("[SysExRouter] ERROR: Prefix trie full");
+                return false;
+            }
+            nodes_.push_back({entry.prefix[i], NO_NODE, nodes_[node].child, INVALID_HANDLER});
+            next = static_cast<uint8_t>(nodes_.size() - 1);
+            nodes_[node].child = next;
+        }
+        node = next;
+    }
+
+    if (nodes_[node].handler != INVALID_HANDLER) {
+        LOGLN("[SysExRouter] ERROR: Duplicate prefix");
+        return false;
+    }
+    nodes_[node].handler = id;
+    return true;
+}
+
+void SysExRouter::rebuild() {
+    nodes_.clear();
+    nodes_.push_back({0, NO_NODE, NO_NODE, INVALID_HANDLER});
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        if (entries_[i].active) {
+            insert(static_cast<HandlerId>(i));
+        }
+    }
+}
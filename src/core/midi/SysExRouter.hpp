@@ -0,0 +1,81 @@
+#pragma once
+
+#include <etl/array.h>
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
+#include "core/util/PluginAccounting.hpp"
+
+/**
+ * @brief Routes complete SysEx messages to handlers by byte prefix
+ *
+ * A prefix is the bytes after 0xF0: manufacturer ID (1 byte, or 0x00 and
+ * two more) followed by the protocol's command bytes. Prefixes are compiled
+ * into a trie on every change (first-child / next-sibling, 4 bytes a node);
+ * a message walks it once and goes to the handler of the longest prefix it
+ * starts with. Messages no prefix matches are dropped without calling
+ * anything.
+ *
+ * @code
+ * const uint8_t prefix[] = {0x7D, 0x10};  // Manufacturer, command
+ * router.add(prefix, sizeof(prefix), [](const uint8_t* data, uint16_t length) {});
+ * @endcode
+ */
+class SysExRouter {
+public:
+    /** data is the whole message, 0xF0 to 0xF7, only valid during the call */
+    using Handler = InplaceFunction<void(const uint8_t* data, uint16_t length),
+                                    System::Memory::EVENT_CALLBACK_SIZE>;
+    using HandlerId = uint8_t;
+    static constexpr HandlerId INVALID_HANDLER = 0xFF;
+    static constexpr uint8_t MAX_PREFIX = System::Memory::MAX_SYSEX_PREFIX_LENGTH;
+
+    SysExRouter();
+
+    /**
+     * @param prefix Bytes after 0xF0 (1 to MAX_PREFIX, each 0x00-0x7F)
+     * @return Handler id, INVALID_HANDLER on a bad or duplicate prefix, or when
+     *         System::Memory::MAX_SYSEX_HANDLERS handlers exist
+     */
+    HandlerId add(const uint8_t* prefix, uint8_t length, Handler handler);
+    void remove(HandlerId id);
+
+    bool empty() const {
+        return activeCount_ == 0;
+    }
+
+    /** @return true if a handler took the message */
+    bool route(const uint8_t* data, uint16_t length);
+
+private:
+    static constexpr uint8_t ROOT = 0;
+    static constexpr uint8_t NO_NODE = 0xFF;
+    static constexpr size_t HANDLERS = System::Memory::MAX_SYSEX_HANDLERS;
+    static constexpr size_t NODES = HANDLERS * MAX_PREFIX + 1;
+
+    struct Entry {
+        Handler handler;
+        etl::array<uint8_t, MAX_PREFIX> prefix;
+        uint8_t length = 0;
+        uint8_t owner = PluginAccounting::NO_OWNER;
+        bool active = false;
+    };
+
+    struct Node {
+        uint8_t byte;
+        uint8_t child;
+        uint8_t sibling;
+        HandlerId handler;
+    };
+
+    uint8_t findChild(uint8_t node, uint8_t byte) const;
+    bool insert(HandlerId id);
+    void rebuild();
+
+    etl::array<Entry, HANDLERS> entries_;
+    etl::vector<Node, NODES> nodes_;
+    uint8_t activeCount_ = 0;
+};
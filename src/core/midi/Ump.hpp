@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Universal MIDI Packet (MIDI 2.0) encoding
+ *
+ * Builds and inspects MIDI 2.0 channel voice packets (message type 0x4,
+ * 64 bits) and MIDI 1.0 channel voice packets (type 0x2, 32 bits). Values
+ * follow the UMP specification: 16-bit velocity, 32-bit controllers and
+ * pitch bend, and per-note controllers / pitch bend.
+ *
+ * The scale helpers implement the spec's min-center-max bit scaling, so a
+ * value converted up and back down is unchanged.
+ */
+namespace Ump {
+
+constexpr uint8_t MT_MIDI1_CHANNEL_VOICE = 0x2;
+constexpr uint8_t MT_MIDI2_CHANNEL_VOICE = 0x4;
+
+/* MIDI 2.0 channel voice opcodes (high nibble of the status byte) */
+constexpr uint8_t REGISTERED_PER_NOTE_CONTROLLER = 0x0;
+constexpr uint8_t ASSIGNABLE_PER_NOTE_CONTROLLER = 0x1;
+constexpr uint8_t PER_NOTE_PITCH_BEND = 0x6;
+constexpr uint8_t NOTE_OFF = 0x8;
+constexpr uint8_t NOTE_ON = 0x9;
+constexpr uint8_t POLY_PRESSURE = 0xA;
+constexpr uint8_t CONTROL_CHANGE = 0xB;
+constexpr uint8_t PROGRAM_CHANGE = 0xC;
+constexpr uint8_t CHANNEL_PRESSURE = 0xD;
+constexpr uint8_t PITCH_BEND = 0xE;
+
+struct Packet {
+    uint32_t words[2];
+    uint8_t wordCount;  // 1 (MIDI 1.0 type) or 2 (MIDI 2.0 type)
+
+    constexpr uint8_t messageType() const {
+        return static_cast<uint8_t>(words[0] >> 28);
+    }
+
+    constexpr uint8_t group() const {
+        return static_cast<uint8_t>((words[0] >> 24) & 0x0F);
+    }
+
+    constexpr uint8_t opcode() const {
+        return static_cast<uint8_t>((words[0] >> 20) & 0x0F);
+    }
+
+    constexpr uint8_t channel() const {
+        return static_cast<uint8_t>((words[0] >> 16) & 0x0F);
+    }
+
+    /** @brief Note or controller index */
+    constexpr uint8_t index() const {
+        return static_cast<uint8_t>((words[0] >> 8) & 0x7F);
+    }
+
+    constexpr uint8_t indexLow() const {
+        return static_cast<uint8_t>(words[0] & 0xFF);
+    }
+};
+
+/*
+ * Bit scaling (min-center-max)
+ */
+constexpr uint32_t scaleUp(uint32_t value, uint8_t srcBits, uint8_t dstBits) {
+    const uint8_t shift = dstBits - srcBits;
+    const uint32_t center = 1u << (srcBits - 1);
+    if (value <= center) {
+        return value << shift;
+    }
+
+    // Above center: repeat the lower bits to reach the full destination range
+    const uint8_t repeatBits = srcBits - 1;
+    const uint32_t repeatMask = (1u << repeatBits) - 1;
+    uint32_t repeat = value & repeatMask;
+    repeat = (shift > repeatBits) ? repeat << (shift - repeatBits) : repeat >> (repeatBits - shift);
+    uint32_t result = value << shift;
+    while (repeat != 0) {
+        result |= repeat;
+        repeat >>= repeatBits;
+    }
+    return result;
+}
+
+constexpr uint32_t scaleDown(uint32_t value, uint8_t srcBits, uint8_t dstBits) {
+    return value >> (srcBits - dstBits);
+}
+
+/** @brief 0.0-1.0 to the full 32-bit range */
+constexpr uint32_t fromNormalized(float normalized) {
+    return normalized <= 0.0f   ? 0u
+           : normalized >= 1.0f ? 0xFFFFFFFFu
+                                : static_cast<uint32_t>(normalized * 4294967295.0f);
+}
+
+/*
+ * MIDI 2.0 channel voice (64-bit)
+ */
+constexpr uint32_t header(uint8_t group, uint8_t opcode, uint8_t channel, uint8_t index,
+                          uint8_t indexLow) {
+    return (static_cast<uint32_t>(MT_MIDI2_CHANNEL_VOICE) << 28) |
+           (static_cast<uint32_t>(group & 0x0F) << 24) |
+           (static_cast<uint32_t>(opcode & 0x0F) << 20) |
+           (static_cast<uint32_t>(channel & 0x0F) << 16) |
+           (static_cast<uint32_t>(index & 0x7F) << 8) | indexLow;
+}
+
+constexpr Packet controlChange(uint8_t group, uint8_t channel, uint8_t controller,
+                               uint32_t value) {
+    return {{header(group, CONTROL_CHANGE, channel, controller, 0), value}, 2};
+}
+
+constexpr Packet noteOn(uint8_t group, uint8_t channel, uint8_t note, uint16_t velocity,
+                        uint8_t attributeType = 0, uint16_t attribute = 0) {
+    return {{header(group, NOTE_ON, channel, note, attributeType),
+             (static_cast<uint32_t>(velocity) << 16) | attribute},
+            2};
+}
+
+constexpr Packet noteOff(uint8_t group, uint8_t channel, uint8_t note, uint16_t velocity,
+                         uint8_t attributeType = 0, uint16_t attribute = 0) {
+    return {{header(group, NOTE_OFF, channel, note, attributeType),
+             (static_cast<uint32_t>(velocity) << 16) | attribute},
+            2};
+}
+
+constexpr Packet polyPressure(uint8_t group, uint8_t channel, uint8_t note, uint32_t value) {
+    return {{header(group, POLY_PRESSURE, channel, note, 0), value}, 2};
+}
+
+constexpr Packet channelPressure(uint8_t group, uint8_t channel, uint32_t value) {
+    return {{header(group, CHANNEL_PRESSURE, channel, 0, 0), value}, 2};
+}
+
+/** @brief value: 0x80000000 = center */
+constexpr Packet pitchBend(uint8_t group, uint8_t channel, uint32_t value) {
+    return {{header(group, PITCH_BEND, channel, 0, 0), value}, 2};
+}
+
+constexpr Packet perNotePitchBend(uint8_t group, uint8_t channel, uint8_t note, uint32_t value) {
+    return {{header(group, PER_NOTE_PITCH_BEND, channel, note, 0), value}, 2};
+}
+
+constexpr Packet perNoteController(uint8_t group, uint8_t channel, uint8_t note,
+                                   uint8_t controller, uint32_t value, bool registered) {
+    return {{header(group,
+                    registered ? REGISTERED_PER_NOTE_CONTROLLER : ASSIGNABLE_PER_NOTE_CONTROLLER,
+                    channel, note, controller),
+             value},
+            2};
+}
+
+/*
+ * MIDI 1.0 channel voice (32-bit)
+ */
+constexpr Packet midi1(uint8_t group, uint8_t status, uint8_t data1, uint8_t data2) {
+    return {{(static_cast<uint32_t>(MT_MIDI1_CHANNEL_VOICE) << 28) |
+                 (static_cast<uint32_t>(group & 0x0F) << 24) |
+                 (static_cast<uint32_t>(status) << 16) |
+                 (static_cast<uint32_t>(data1 & 0x7F) << 8) | (data2 & 0x7F),
+             0},
+            1};
+}
+
+}  // namespace Ump
@@ -0,0 +1,85 @@
+#include "ParameterStore.hpp"
+
+#include "log/Macros.hpp"
+
+ParameterStore::Index ParameterStore::add(uint16_t id, const char* name, uint16_t discreteCount) {
+    const Index existing = find(id);
+    if (existing != INVALID_INDEX) {
+        return existing;
+    }
+    if (params_.full()) {
+        LOGF("[ParameterStore] ERROR: Cannot add parameter %u (max %d)\n", id,
+             static_cast<int>(System::Memory::MAX_PARAMETERS));
+        return INVALID_INDEX;
+    }
+
+    Parameter param;
+    param.id = id;
+    param.value = 0.0f;
+    param.discreteCount = discreteCount;
+    param.name.assign(name);
+    param.dirty = 0;
+    params_.push_back(param);
+
+    const Index index = static_cast<Index>(params_.size() - 1);
+    mark(index, DIRTY_VALUE | DIRTY_ENCODER | DIRTY_NAME | DIRTY_DISCRETE);
+    return index;
+}
+
+void ParameterStore::clear() {
+    params_.clear();
+    dirtyQueue_.clear();
+}
+
+ParameterStore::Index ParameterStore::find(uint16_t id) const {
+    for (size_t i = 0; i < params_.size(); ++i) {
+        if (params_[i].id == id) return static_cast<Index>(i);
+    }
+    return INVALID_INDEX;
+}
+
+void ParameterStore::setValue(Index index, float value, MidiOrigin origin) {
+    if (index >= params_.size()) return;
+
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    if (params_[index].value == value) return;
+    params_[index].value = value;
+
+    uint8_t bits = DIRTY_VALUE;
+    if (origin != MidiOrigin::Local) bits |= DIRTY_ENCODER;  // The user's turn is already there
+    if (origin != MidiOrigin::Host) bits |= DIRTY_MIDI;      // No echo to the host
+    mark(index, bits);
+}
+
+void ParameterStore::setDisplay(Index index, const char* text) {
+    if (index >= params_.size() || params_[index].display.holds(text)) return;
+    params_[index].display.assign(text);
+    mark(index, DIRTY_DISPLAY);
+}
+
+void ParameterStore::setName(Index index, const char* name) {
+    if (index >= params_.size() || params_[index].name.holds(name)) return;
+    params_[index].name.assign(name);
+    mark(index, DIRTY_NAME);
+}
+
+void ParameterStore::setDiscreteCount(Index index, uint16_t count) {
+    if (index >= params_.size() || params_[index].discreteCount == count) return;
+    params_[index].discreteCount = count;
+    mark(index, DIRTY_DISCRETE);
+}
+
+void ParameterStore::markAllDirty() {
+    for (size_t i = 0; i < params_.size(); ++i) {
+        mark(static_cast<Index>(i),
+             DIRTY_VALUE | DIRTY_ENCODER | DIRTY_DISPLAY | DIRTY_NAME | DIRTY_DISCRETE);
+    }
+}
+
+void ParameterStore::mark(Index index, uint8_t bits) {
+    Parameter& param = params_[index];
+    if (param.dirty == 0) {
+        dirtyQueue_.push_back(index);
+    }
+    param.dirty |= bits;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <etl/vector.h>
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/interface/midi/MidiInput.hpp"
+#include "core/util/InlineString.hpp"
+
+/**
+ * @brief Fixed-capacity table of plugin parameters with per-field dirty bits
+ *
+ * One entry per parameter: id, normalized value, name, display text and
+ * discrete count. Setters compare against the stored field and only mark
+ * what actually changed, so a host resending a whole page costs a compare
+ * per field and leaves unchanged parameters clean. Changed entries are
+ * queued once; consumers walk only them (consumeDirty()).
+ *
+ * The origin of a value change picks who must follow it: the widget always,
+ * the encoder unless the user turned it (Local), MIDI out unless the host
+ * sent it (Host, no echo).
+ */
+class ParameterStore {
+public:
+    using Index = uint8_t;
+    static constexpr Index INVALID_INDEX = 0xFF;
+
+    enum Dirty : uint8_t {
+        DIRTY_VALUE = 1 << 0,     // Widget value
+        DIRTY_ENCODER = 1 << 1,   // Encoder position follows the value
+        DIRTY_MIDI = 1 << 2,      // Value goes out as MIDI
+        DIRTY_DISPLAY = 1 << 3,
+        DIRTY_NAME = 1 << 4,
+        DIRTY_DISCRETE = 1 << 5,
+    };
+
+    using Name = InlineString<System::Memory::PARAMETER_NAME_LENGTH>;
+    using Display = InlineString<System::Memory::PARAMETER_DISPLAY_LENGTH>;
+
+    struct Parameter {
+        uint16_t id;
+        float value;
+        uint16_t discreteCount;  // 0 = continuous
+        Name name;
+        Display display;
+        uint8_t dirty;
+    };
+
+    /**
+     * @return Index of the new (or existing) parameter, INVALID_INDEX when
+     *         System::Memory::MAX_PARAMETERS are stored
+     */
+    Index add(uint16_t id, const char* name = nullptr, uint16_t discreteCount = 0);
+    void clear();
+
+    /** @return INVALID_INDEX if unknown (linear scan: resolve once, keep the index) */
+    Index find(uint16_t id) const;
+
+    /** @param value Normalized 0.0-1.0, clamped */
+    void setValue(Index index, float value, MidiOrigin origin = MidiOrigin::Plugin);
+    void setDisplay(Index index, const char* text);
+    void setName(Index index, const char* name);
+    void setDiscreteCount(Index index, uint16_t count);
+
+    /** @brief Mark every field of every parameter (e.g. after a view rebuild) */
+    void markAllDirty();
+
+    const Parameter* get(Index index) const {
+        return index < params_.size() ? &params_[index] : nullptr;
+    }
+
+    size_t size() const {
+        return params_.size();
+    }
+
+    bool hasDirty() const {
+        return !dirtyQueue_.empty();
+    }
+
+    /**
+     * @brief Hand each changed parameter to fn(index, parameter, dirtyBits), then clean it
+     *
+     * Setters called from fn mark the parameter again for the next pass.
+     */
+    template <typename Fn>
+    void consumeDirty(Fn&& fn) {
+        const size_t count = dirtyQueue_.size();
+        for (size_t i = 0; i < count; ++i) {
+            const Index index = dirtyQueue_[i];
+            Parameter& param = params_[index];
+            const uint8_t dirty = param.dirty;
+            param.dirty = 0;
+            fn(index, static_cast<const Parameter&>(param), dirty);
+        }
+        // Entries re-marked by fn were appended after `count`
+        dirtyQueue_.erase(dirtyQueue_.begin(), dirtyQueue_.begin() + count);
+    }
+
+private:
+    void mark(Index index, uint8_t bits);
+
+    etl::vector<Parameter, System::Memory::MAX_PARAMETERS> params_;
+    // Twice the table: an entry re-marked during consumeDirty() is queued again
+    etl::vector<Index, 2 * System::Memory::MAX_PARAMETERS> dirtyQueue_;
+};
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <etl/vector.h>
+
 #include <cstdint>
-#include <functional>
 #include <optional>
 
+#include "config/System.hpp"
 #include "core/Type.hpp"
+#include "core/util/InplaceFunction.hpp"
+#include "core/util/PluginAccounting.hpp"
 
 typedef struct _lv_obj_t lv_obj_t;
 
@@ -12,6 +16,21 @@ namespace Common::UI {
 class IView;
 }
 
+/**
+ * @brief Binding layer handle (see InputBinding::createLayer)
+ *
+ * Layer 0 is the base layer, always active. Other layers only dispatch while
+ * pushed on the layer stack; the topmost layer with a matching binding wins.
+ */
+using BindingLayerId = uint8_t;
+constexpr BindingLayerId BASE_BINDING_LAYER = 0;
+constexpr BindingLayerId INVALID_BINDING_LAYER = 0xFF;
+
+/** @brief Binding callbacks, stored inline (captures limited to BINDING_CALLBACK_SIZE) */
+using BindingAction = InplaceFunction<void(), System::Memory::BINDING_CALLBACK_SIZE>;
+using EncoderBindingAction =
+    InplaceFunction<void(float), System::Memory::BINDING_CALLBACK_SIZE>;  // Normalized value
+
 /**
  * @brief Button input binding definition
  *
@@ -20,16 +39,20 @@ class IView;
  *
  * Bindings can be scoped to LVGL objects:
  * - scope = nullptr: Global binding (always active)
- * - scope = lv_obj_t*: Scoped binding (active only if object visible)
+ * - scope = lv_obj_t*: Scoped binding (active only if object and all its parents are visible)
  */
 struct ButtonBinding {
     ButtonBindingType type;
     ButtonID buttonId;
-    std::optional<ButtonID> secondaryButton;  // For COMBO
+    std::optional<ButtonID> secondaryButton = std::nullopt;  // For COMBO
     uint32_t longPressMs = 0;                 // For LONG_PRESS
-    std::function<void()> action;
+    BindingAction action;
     bool enabled = true;
     lv_obj_t* scope = nullptr;                // nullptr = global, otherwise scoped to LVGL object
+    uint8_t scopeSlot = 0xFF;                 // Visibility cache slot (assigned by InputBinding)
+    BindingLayerId layer = BASE_BINDING_LAYER;
+    uint8_t owner = PluginAccounting::currentOwner();  // Plugin charged for action()
+    bool removed = false;  // Cleared during a dispatch, compacted after it
 };
 
 /**
@@ -40,13 +63,41 @@ struct ButtonBinding {
  *
  * Bindings can be scoped to LVGL objects:
  * - scope = nullptr: Global binding (always active)
- * - scope = lv_obj_t*: Scoped binding (active only if object visible)
+ * - scope = lv_obj_t*: Scoped binding (active only if object and all its parents are visible)
  */
 struct EncoderBinding {
     EncoderBindingType type;
     EncoderID encoderId;
-    std::optional<ButtonID> requiredButton;  // For TURN_WHILE_PRESSED
-    std::function<void(float)> action;       // Receives normalized value (0.0-1.0)
+    std::optional<ButtonID> requiredButton = std::nullopt;  // For TURN_WHILE_PRESSED
+    EncoderBindingAction action;             // Receives normalized value (0.0-1.0)
     bool enabled = true;
     lv_obj_t* scope = nullptr;                // nullptr = global, otherwise scoped to LVGL object
+    uint8_t scopeSlot = 0xFF;                 // Visibility cache slot (assigned by InputBinding)
+    BindingLayerId layer = BASE_BINDING_LAYER;
+    uint8_t owner = PluginAccounting::currentOwner();  // Plugin charged for action()
+    bool removed = false;  // Cleared during a dispatch, compacted after it
+};
+
+enum class GestureType : uint8_t {
+    CHORD,     // All buttons held together (exact set)
+    SEQUENCE,  // Buttons pressed in order
+    HOLD_TAP   // buttons[0] held while buttons[1] is tapped
+};
+
+/**
+ * @brief Multi-button gesture binding definition
+ *
+ * Compiled into GestureEngine tables by InputBinding. Scope and layer rules
+ * are the same as for ButtonBinding.
+ */
+struct GestureBinding {
+    GestureType type;
+    etl::vector<ButtonID, System::Memory::MAX_GESTURE_LENGTH> buttons{};
+    BindingAction action;
+    bool enabled = true;
+    lv_obj_t* scope = nullptr;
+    uint8_t scopeSlot = 0xFF;
+    BindingLayerId layer = BASE_BINDING_LAYER;
+    uint8_t owner = PluginAccounting::currentOwner();  // Plugin charged for action()
+    bool removed = false;  // Cleared during a dispatch, compacted after it
 };
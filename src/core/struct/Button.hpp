@@ -4,6 +4,19 @@
 
 namespace Hardware {
 
+/*
+ * DebounceMode - Per-button debouncing algorithm
+ *
+ * Lockout: Accept an edge immediately, then ignore changes for BUTTON_DEBOUNCE_MS
+ * Integrator: Counter saturating at DEBOUNCE_INTEGRATOR_SAMPLES, flips at either end
+ * SampleHistory: Flips once the last DEBOUNCE_STABLE_SAMPLES samples all agree
+ */
+enum class DebounceMode : uint8_t {
+    Lockout,
+    Integrator,
+    SampleHistory
+};
+
 /*
  * Hardware button setup definition
  *
@@ -13,6 +26,7 @@ namespace Hardware {
 struct Button {
     ButtonID id;
     GpioPin pin;
+    DebounceMode debounce = DebounceMode::SampleHistory;
 };
 
 }  // namespace Hardware
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Type.hpp"
+#include "config/System.hpp"
 
 namespace Hardware {
 
@@ -15,6 +16,41 @@ enum class EncoderMode : uint8_t {
     Relative   // Infini, position cumulative (±1.0 par cran)
 };
 
+/*
+ * EncoderTakeover - How an Absolute encoder follows external values
+ *
+ * Applies to values pushed by the host or a plugin (ControllerAPI::
+ * setEncoderPosition, parameter sync) that differ from the encoder's own:
+ * Jump: the encoder moves to the value at once (no jump on the next tick)
+ * Pickup: the encoder keeps its position and stays silent until it reaches
+ *         or crosses the value, then follows
+ * Scale: the first ticks start from the value and are scaled so that value
+ *        and encoder reach the end stop together, then follow
+ */
+enum class EncoderTakeover : uint8_t {
+    Jump,
+    Pickup,
+    Scale,
+};
+
+/*
+ * EncoderAcceleration - Velocity curve for Absolute mode
+ *
+ * Each tick moves the virtual position by a multiplier interpolated linearly
+ * from the (smoothed) time since the previous tick: x1 at slowIntervalUs or
+ * slower, maxMultiplier at fastIntervalUs or faster. maxMultiplier <= 1
+ * disables acceleration.
+ */
+struct EncoderAcceleration {
+    uint32_t slowIntervalUs = System::Input::ENCODER_ACCEL_SLOW_US;
+    uint32_t fastIntervalUs = System::Input::ENCODER_ACCEL_FAST_US;
+    uint8_t maxMultiplier = 1;
+
+    constexpr bool isEnabled() const {
+        return maxMultiplier > 1 && slowIntervalUs > fastIntervalUs;
+    }
+};
+
 /*
  * Hardware encoder setup definition
  *
@@ -27,6 +63,8 @@ enum class EncoderMode : uint8_t {
  * - ppr: Pulses per revolution (mechanical spec)
  * - stepsPerDetent: Hardware pulses per physical detent (mode full = x4)
  * - mode: Absolute (parameter) or Relative (navigation)
+ * - acceleration: Velocity curve (Absolute mode, disabled by default)
+ * - takeover: External value policy (Absolute mode, Jump by default)
  */
 struct Encoder {
     EncoderID id;
@@ -35,6 +73,8 @@ struct Encoder {
     uint16_t ppr = 24;
     uint8_t stepsPerDetent = 1;
     EncoderMode mode = EncoderMode::Absolute;
+    EncoderAcceleration acceleration = {};
+    EncoderTakeover takeover = EncoderTakeover::Jump;
 };
 
 }  // namespace Hardware
@@ -13,14 +13,66 @@
  * Type-safe constructors ensure only ButtonID or EncoderID can be used for mappings,
  * providing IDE autocomplete and preventing invalid input IDs at compile time.
  */
+
+/**
+ * @brief Output resolution of an encoder mapping
+ *
+ * - CC7:  one 7-bit CC (cc = 0-127)
+ * - CC14: MSB on cc, LSB on cc + 32 (cc = 0-31)
+ * - NRPN: parameter number cc (0-127) through CC 99/98, data on CC 6/38
+ * - UMP:  MIDI 2.0 32-bit CC (cc = 0-127) when the output supports UMP,
+ *         otherwise CC14 for cc 0-31 and CC7 above
+ *
+ * High-resolution modes only send the half (MSB/LSB) that changed.
+ *
+ * Relative modes send the detents turned since the last message on one CC
+ * (Relative-mode encoders only, at most +-63 a message):
+ * - RelativeTwos:   two's complement, +1 = 1, -1 = 127
+ * - RelativeOffset: binary offset, +1 = 65, -1 = 63
+ * - RelativeSigned: sign-magnitude, +1 = 1, -1 = 65
+ */
+enum class MidiResolution : uint8_t {
+    CC7,
+    CC14,
+    NRPN,
+    UMP,
+    RelativeTwos,
+    RelativeOffset,
+    RelativeSigned
+};
+
+constexpr bool isRelative(MidiResolution resolution) {
+    return resolution >= MidiResolution::RelativeTwos;
+}
+
+/** @brief Kind of control a mapping is wired to (set by the constructor used) */
+enum class MidiInputKind : uint8_t { Button, Encoder };
+
 struct MidiCCMapping {
     uint16_t inputId;
+    MidiInputKind kind;
     uint8_t channel;
     uint8_t cc;
+    MidiResolution resolution;
 
     constexpr MidiCCMapping(ButtonID buttonId, uint8_t channel, uint8_t cc)
-        : inputId(static_cast<uint16_t>(buttonId)), channel(channel), cc(cc) {}
+        : inputId(static_cast<uint16_t>(buttonId)),
+          kind(MidiInputKind::Button),
+          channel(channel),
+          cc(cc),
+          resolution(MidiResolution::CC7) {}
+
+    constexpr MidiCCMapping(EncoderID encoderId, uint8_t channel, uint8_t cc,
+                            MidiResolution resolution = MidiResolution::CC7)
+        : inputId(static_cast<uint16_t>(encoderId)),
+          kind(MidiInputKind::Encoder),
+          channel(channel),
+          cc(cc),
+          resolution(resolution) {}
 
-    constexpr MidiCCMapping(EncoderID encoderId, uint8_t channel, uint8_t cc)
-        : inputId(static_cast<uint16_t>(encoderId)), channel(channel), cc(cc) {}
+    /** @brief Dense index of the control (buttonIndex() / encoderIndex()) */
+    constexpr uint8_t inputIndex() const {
+        return kind == MidiInputKind::Button ? buttonIndex(static_cast<ButtonID>(inputId))
+                                             : encoderIndex(static_cast<EncoderID>(inputId));
+    }
 };
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/System.hpp"
+
+/**
+ * @brief Snapshot of the controller state, stored as is (FlashPresetStore)
+ *
+ * Absolute encoders (position and discrete steps), plugin parameter values
+ * and MIDI mappings. Values are UNorm16 raw fractions; every field is a
+ * fixed-size array with its count, so saving and loading are one copy.
+ */
+struct Preset {
+    static constexpr uint32_t MAGIC = 0x50534554;  // "PSET"
+    static constexpr uint8_t VERSION = 1;
+
+    struct EncoderState {
+        uint16_t encoderId;
+        uint16_t value;
+        uint8_t discreteSteps;  // 0 = continuous
+    };
+
+    struct ParameterValue {
+        uint16_t id;
+        uint16_t value;
+    };
+
+    struct Mapping {
+        uint16_t inputId;
+        uint8_t kind;  // MidiInputKind
+        uint8_t channel;
+        uint8_t cc;
+        uint8_t resolution;  // MidiResolution
+    };
+
+    uint32_t magic = MAGIC;
+    uint8_t version = VERSION;
+    uint8_t encoderCount = 0;
+    uint8_t parameterCount = 0;
+    uint8_t mappingCount = 0;
+    EncoderState encoders[System::Hardware::ENCODERS_COUNT];
+    ParameterValue parameters[System::Memory::MAX_PARAMETERS];
+    Mapping mappings[System::Memory::MAX_MIDI_MAPPINGS];
+
+    bool valid() const {
+        return magic == MAGIC && version == VERSION &&
+               encoderCount <= System::Hardware::ENCODERS_COUNT &&
+               parameterCount <= System::Memory::MAX_PARAMETERS &&
+               mappingCount <= System::Memory::MAX_MIDI_MAPPINGS;
+    }
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include "core/util/Utf8.hpp"
+
+/**
+ * @brief Fixed-capacity, null-terminated string stored by value
+ *
+ * Trivially copyable (no heap, no internal pointers), so it can travel
+ * inside events, including events copied by IEventBus::post().
+ * Input longer than Capacity is truncated, on a UTF-8 code point boundary.
+ *
+ * @tparam Capacity Maximum number of characters, excluding the terminator
+ */
+template <size_t Capacity>
+class InlineString {
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    InlineString() : length_(0) {
+        data_[0] = '\0';
+    }
+
+    InlineString(const char* text) {
+        assign(text);
+    }
+
+    void assign(const char* text) {
+        const size_t length = storedLength(text);
+        if (length) memcpy(data_, text, length);
+        data_[length] = '\0';
+        length_ = static_cast<decltype(length_)>(length);
+    }
+
+    const char* c_str() const {
+        return data_;
+    }
+
+    size_t length() const {
+        return length_;
+    }
+
+    bool empty() const {
+        return length_ == 0;
+    }
+
+    bool operator==(const char* other) const {
+        return other && strcmp(data_, other) == 0;
+    }
+
+    /** @brief True when assign(text) would store what is already held (nullptr is "") */
+    bool holds(const char* text) const {
+        const size_t length = storedLength(text);
+        return length == length_ && (length == 0 || memcmp(data_, text, length) == 0);
+    }
+
+private:
+    static_assert(Capacity < 256, "InlineString capacity must fit in 8 bits");
+
+    /** @brief Bytes of text assign() keeps: up to Capacity, never half a code point */
+    static size_t storedLength(const char* text) {
+        return Utf8::safeLength(text, Capacity);
+    }
+
+    char data_[Capacity + 1];
+    unsigned char length_;
+};
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Fixed-size, heap-free replacement for std::function
+ *
+ * The callable is stored inside the object itself. A callable whose captures
+ * do not fit in Capacity bytes is rejected at compile time instead of
+ * silently falling back to the heap.
+ *
+ * @code
+ * InplaceFunction<void(int), 8> fn = [this](int v) { apply(v); };
+ * @endcode
+ *
+ * @tparam Signature Call signature, e.g. void(const Event&)
+ * @tparam Capacity Inline storage in bytes
+ */
+template <typename Signature, size_t Capacity>
+class InplaceFunction;
+
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    InplaceFunction() noexcept : invoke_(nullptr), manage_(nullptr) {}
+    InplaceFunction(std::nullptr_t) noexcept : InplaceFunction() {}
+
+    template <typename F, typename D = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<D, InplaceFunction>::value>::type>
+    InplaceFunction(F&& f) : invoke_(nullptr), manage_(nullptr) {
+        static_assert(sizeof(D) <= Capacity,
+                      "Callable captures too much state for InplaceFunction - capture less "
+                      "(e.g. a pointer) or raise the capacity");
+        static_assert(alignof(D) <= alignof(Storage), "Callable alignment too strict");
+        // Copies of the function copy the callable, as std::function does
+        static_assert(std::is_copy_constructible<D>::value,
+                      "Callable must be copyable - capture a pointer instead of a move-only "
+                      "object (e.g. a std::unique_ptr)");
+
+        if (isNull(f)) {
+            return;
+        }
+
+        new (&storage_) D(std::forward<F>(f));
+        invoke_ = &invokeImpl<D>;
+        manage_ = &manageImpl<D>;
+    }
+
+    InplaceFunction(const InplaceFunction& other) : invoke_(nullptr), manage_(nullptr) {
+        copyFrom(other);
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept : invoke_(nullptr), manage_(nullptr) {
+        moveFrom(other);
+    }
+
+    ~InplaceFunction() {
+        reset();
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& other) {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    R operator()(Args... args) const {
+        return invoke_(const_cast<Storage*>(&storage_), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept {
+        return invoke_ != nullptr;
+    }
+
+    void reset() noexcept {
+        if (manage_) {
+            manage_(Operation::Destroy, &storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+private:
+    using Storage = typename std::aligned_storage<Capacity, alignof(void*)>::type;
+
+    enum class Operation { Copy, Move, Destroy };
+
+    using InvokeFn = R (*)(Storage*, Args&&...);
+    using ManageFn = void (*)(Operation, Storage*, Storage*);
+
+    template <typename D>
+    static R invokeImpl(Storage* storage, Args&&... args) {
+        return (*reinterpret_cast<D*>(storage))(std::forward<Args>(args)...);
+    }
+
+    template <typename D>
+    static void manageImpl(Operation op, Storage* dst, Storage* src) {
+        switch (op) {
+            case Operation::Copy:
+                new (dst) D(*reinterpret_cast<const D*>(src));
+                break;
+            case Operation::Move:
+                new (dst) D(std::move(*reinterpret_cast<D*>(src)));
+                reinterpret_cast<D*>(src)->~D();
+                break;
+            case Operation::Destroy:
+                reinterpret_cast<D*>(dst)->~D();
+                break;
+        }
+    }
+
+    template <typename F>
+    static bool isNull(const F& f) {
+        return isNullImpl(f, std::is_pointer<F>());
+    }
+
+    template <typename F>
+    static bool isNullImpl(const F& f, std::true_type) {
+        return f == nullptr;
+    }
+
+    template <typename F>
+    static bool isNullImpl(const F&, std::false_type) {
+        return false;
+    }
+
+    void copyFrom(const InplaceFunction& other) {
+        if (other.manage_) {
+            other.manage_(Operation::Copy, &storage_, const_cast<Storage*>(&other.storage_));
+            invoke_ = other.invoke_;
+            manage_ = other.manage_;
+        }
+    }
+
+    void moveFrom(InplaceFunction& other) noexcept {
+        if (other.manage_) {
+            other.manage_(Operation::Move, &storage_, &other.storage_);
+            invoke_ = other.invoke_;
+            manage_ = other.manage_;
+            other.invoke_ = nullptr;
+            other.manage_ = nullptr;
+        }
+    }
+
+    Storage storage_;
+    InvokeFn invoke_;
+    ManageFn manage_;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+
+/**
+ * @brief Log2-bucketed latency histogram in microseconds
+ *
+ * Bucket 0 holds samples below 2 us, bucket i holds [2^i, 2^(i+1)) us and the
+ * last bucket everything above. Recording is a count-leading-zeros and an
+ * increment, cheap enough for the MIDI send path.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint8_t BUCKET_COUNT = 20;  // Last bucket: >= ~0.5 s
+
+    LatencyHistogram() {
+        reset();
+    }
+
+    void record(uint32_t latencyUs) {
+        uint8_t bucket = latencyUs < 2 ? 0 : static_cast<uint8_t>(31 - __builtin_clz(latencyUs));
+        if (bucket >= BUCKET_COUNT) {
+            bucket = BUCKET_COUNT - 1;
+        }
+        ++buckets_[bucket];
+        ++count_;
+        totalUs_ += latencyUs;
+        if (latencyUs > worstUs_) {
+            worstUs_ = latencyUs;
+        }
+    }
+
+    void reset() {
+        for (auto& bucket : buckets_) {
+            bucket = 0;
+        }
+        count_ = 0;
+        totalUs_ = 0;
+        worstUs_ = 0;
+    }
+
+    uint32_t getCount() const {
+        return count_;
+    }
+
+    uint32_t getWorstUs() const {
+        return worstUs_;
+    }
+
+    void dump(Print& out, const char* label) const {
+        if (count_ == 0) {
+            return;
+        }
+        out.printf("[Latency] %s n=%lu avg=%lu us worst=%lu us\n", label, count_,
+                   static_cast<uint32_t>(totalUs_ / count_), worstUs_);
+        for (uint8_t i = 0; i < BUCKET_COUNT; ++i) {
+            if (buckets_[i] != 0) {
+                out.printf("  >=%7lu us %8lu\n", i == 0 ? 0ul : (1ul << i), buckets_[i]);
+            }
+        }
+    }
+
+private:
+    uint32_t buckets_[BUCKET_COUNT];
+    uint32_t count_;
+    uint64_t totalUs_;
+    uint32_t worstUs_;
+};
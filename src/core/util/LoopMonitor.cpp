@@ -0,0 +1,32 @@
+#include "LoopMonitor.hpp"
+
+#include "config/System.hpp"
+
+namespace LoopMonitor {
+
+namespace {
+constexpr uint8_t TRACES = System::Memory::LOOP_OVERRUN_TRACES;
+
+Trace traces[TRACES];
+uint32_t count = 0;
+}  // namespace
+
+void recordOverrun(const Trace& trace) {
+    traces[count % TRACES] = trace;
+    ++count;
+}
+
+uint32_t overruns() {
+    return count;
+}
+
+const Trace* trace(uint8_t age) {
+    if (age >= TRACES || age >= count) return nullptr;
+    return &traces[(count - 1 - age) % TRACES];
+}
+
+void reset() {
+    count = 0;
+}
+
+}  // namespace LoopMonitor
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Main loop passes over System::Loop::PASS_BUDGET_US, with their cause
+ *
+ * LoopScheduler times each pass (idle sleep excluded) and records the ones
+ * over budget here, with the stage that took longest: a lagging knob on
+ * stage leaves a trace of which part of the loop stalled (MIDI-in drain,
+ * input, plugins, UI). The last System::Memory::LOOP_OVERRUN_TRACES traces
+ * are kept; ControllerAPI::getLoopOverrun() reads them.
+ */
+namespace LoopMonitor {
+
+struct Trace {
+    uint32_t timeMs;     // millis() at the end of the pass
+    uint32_t passUs;     // Whole pass
+    const char* stage;   // Longest stage of the pass (LoopScheduler stage name)
+    uint32_t stageUs;
+    uint8_t stagesRun;
+};
+
+void recordOverrun(const Trace& trace);
+
+/** @brief Passes over budget since boot or reset() */
+uint32_t overruns();
+
+/** @param age 0 = most recent @return nullptr past the traces kept */
+const Trace* trace(uint8_t age);
+
+void reset();
+
+}  // namespace LoopMonitor
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <stdint.h>
+
+/**
+ * @brief Tightly coupled memory placement for the input -> MIDI path
+ *
+ * On Teensy 4.1 RAM1 is split between ITCM (code, 0x00000000) and DTCM
+ * (data, 0x20000000), both single-cycle and outside the flash cache. The
+ * core's hot path - encoder and button processing, EventBus dispatch,
+ * InputBinding, MidiMapper and the USB MIDI handlers - is marked HOT_CODE,
+ * so it stays in ITCM whatever else is moved to flash (FLASHMEM) to make
+ * room. Its state lives in MidiStudioApp, a global, hence in DTCM;
+ * checkDtcm() warns at boot if it ends up elsewhere (e.g. allocated on the
+ * heap, which is in RAM2).
+ *
+ * script/hot_set_report.py prints the size of the hot set after each link.
+ */
+#if defined(FASTRUN) && !defined(NATIVE_HAL)
+#define HOT_CODE FASTRUN
+#else
+#define HOT_CODE
+#endif
+
+namespace MemoryPlacement {
+
+constexpr uintptr_t ITCM_START = 0x00000000;
+constexpr uintptr_t ITCM_END = 0x00080000;
+constexpr uintptr_t DTCM_START = 0x20000000;
+constexpr uintptr_t DTCM_END = 0x20080000;
+
+inline bool isItcm(const void* address) {
+    const uintptr_t value = reinterpret_cast<uintptr_t>(address);
+    return value >= ITCM_START && value < ITCM_END;
+}
+
+inline bool isDtcm(const void* address) {
+    const uintptr_t value = reinterpret_cast<uintptr_t>(address);
+    return value >= DTCM_START && value < DTCM_END;
+}
+
+}  // namespace MemoryPlacement
@@ -0,0 +1,68 @@
+#include "PluginAccounting.hpp"
+
+#include "config/System.hpp"
+
+namespace PluginAccounting {
+
+namespace {
+uint8_t current = NO_OWNER;
+Report reports[System::Memory::MAX_PLUGINS];
+const Report NO_REPORT = {};
+
+void charge(Cost& cost, uint32_t cycles) {
+    ++cost.calls;
+    cost.totalCycles += cycles;
+    if (cycles > cost.worstCycles) {
+        cost.worstCycles = cycles;
+    }
+}
+}  // namespace
+
+void begin() {
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+}
+
+uint8_t currentOwner() {
+    return current;
+}
+
+void setCurrentOwner(uint8_t owner) {
+    current = owner;
+}
+
+void chargeUpdate(uint8_t owner, uint32_t cycles) {
+    if (owner < System::Memory::MAX_PLUGINS) {
+        charge(reports[owner].update, cycles);
+    }
+}
+
+void chargeCallback(uint8_t owner, uint32_t cycles) {
+    if (owner < System::Memory::MAX_PLUGINS) {
+        charge(reports[owner].callbacks, cycles);
+    }
+}
+
+void setInitMemory(uint8_t owner, int32_t heapBytes, int32_t lvglBytes) {
+    if (owner < System::Memory::MAX_PLUGINS) {
+        reports[owner].heapBytes = heapBytes;
+        reports[owner].lvglBytes = lvglBytes;
+    }
+}
+
+const Report& report(uint8_t owner) {
+    return owner < System::Memory::MAX_PLUGINS ? reports[owner] : NO_REPORT;
+}
+
+void reset(uint8_t owner, bool memory) {
+    if (owner >= System::Memory::MAX_PLUGINS) return;
+    Report& entry = reports[owner];
+    entry.update = Cost{};
+    entry.callbacks = Cost{};
+    if (memory) {
+        entry.heapBytes = 0;
+        entry.lvglBytes = 0;
+    }
+}
+
+}  // namespace PluginAccounting
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+
+/**
+ * @brief Per-plugin CPU time and memory figures
+ *
+ * Owners are PluginManager integration ids (registration order, 0 to
+ * System::Memory::MAX_PLUGINS - 1). PluginManager records update() cycles
+ * and the heap / LVGL pool growth across initialize(); callback time is
+ * attributed to the plugin that registered the callback.
+ *
+ * PluginManager makes a plugin the current owner (OwnerScope) while its
+ * initialize() and update() run. Registries that store plugin callbacks
+ * (EventBus subscribers, input bindings, MIDI filters, SysEx handlers,
+ * tasks) tag each entry with currentOwner() when it is created and wrap the
+ * call in a CallbackTimer, which charges the DWT cycles to that owner.
+ * Callbacks run with their owner current, so what they register is tagged
+ * too. Times are inclusive: a callback that emits an event also pays for
+ * the subscribers it triggers.
+ *
+ * Entries created outside any plugin (core) have NO_OWNER and cost two
+ * compares.
+ */
+namespace PluginAccounting {
+
+constexpr uint8_t NO_OWNER = 0xFF;
+
+struct Cost {
+    uint32_t calls;
+    uint64_t totalCycles;
+    uint32_t worstCycles;
+};
+
+/** @brief Start the DWT cycle counter (idempotent) */
+void begin();
+
+inline uint32_t cycles() {
+    return ARM_DWT_CYCCNT;
+}
+
+uint8_t currentOwner();
+void setCurrentOwner(uint8_t owner);
+
+struct Report {
+    Cost update;     // update() calls
+    Cost callbacks;  // Event, input, MIDI, SysEx callbacks and tasks
+    int32_t heapBytes;  // malloc heap growth across initialize()
+    int32_t lvglBytes;  // LVGL pool growth across initialize()
+};
+
+inline uint32_t cyclesToUs(uint64_t cycles) {
+    return static_cast<uint32_t>(cycles / (F_CPU_ACTUAL / 1000000));
+}
+
+void chargeUpdate(uint8_t owner, uint32_t cycles);
+void chargeCallback(uint8_t owner, uint32_t cycles);
+void setInitMemory(uint8_t owner, int32_t heapBytes, int32_t lvglBytes);
+
+/** @return Zeroed Report for unknown owners */
+const Report& report(uint8_t owner);
+
+/** @brief Zero the owner's figures (memory too when `memory` is set) */
+void reset(uint8_t owner, bool memory = false);
+
+/** @brief Makes `owner` current for the scope, restoring the previous one */
+class OwnerScope {
+public:
+    explicit OwnerScope(uint8_t owner) : previous_(currentOwner()) {
+        setCurrentOwner(owner);
+    }
+    ~OwnerScope() {
+        setCurrentOwner(previous_);
+    }
+
+    OwnerScope(const OwnerScope&) = delete;
+    OwnerScope& operator=(const OwnerScope&) = delete;
+
+private:
+    uint8_t previous_;
+};
+
+/** @brief Times one callback call and charges it to its owner */
+class CallbackTimer {
+public:
+    explicit CallbackTimer(uint8_t owner)
+        : owner_(owner), previous_(currentOwner()), start_(0) {
+        if (owner_ != NO_OWNER) {
+            setCurrentOwner(owner_);
+            start_ = cycles();
+        }
+    }
+    ~CallbackTimer() {
+        if (owner_ != NO_OWNER) {
+            chargeCallback(owner_, cycles() - start_);
+            setCurrentOwner(previous_);
+        }
+    }
+
+    CallbackTimer(const CallbackTimer&) = delete;
+    CallbackTimer& operator=(const CallbackTimer&) = delete;
+
+private:
+    uint8_t owner_;
+    uint8_t previous_;
+    uint32_t start_;
+};
+
+}  // namespace PluginAccounting
@@ -0,0 +1,108 @@
+#include "PluginArena.hpp"
+
+#include <Arduino.h>
+#include <stdlib.h>
+
+#include "config/System.hpp"
+#include "log/Macros.hpp"
+
+namespace PluginArena {
+
+namespace {
+struct Arena {
+    uint8_t* base;
+    size_t top;
+    Stats stats;
+};
+
+Arena arenas[System::Memory::MAX_PLUGINS];
+const Stats NO_STATS = {};
+
+void* allocateBlock(size_t size) {
+    // extmem_malloc falls back to the heap on boards without PSRAM
+    return System::Memory::PLUGIN_ARENA_PSRAM ? extmem_malloc(size) : malloc(size);
+}
+
+void freeBlock(void* block) {
+    if (System::Memory::PLUGIN_ARENA_PSRAM) {
+        extmem_free(block);
+    } else {
+        free(block);
+    }
+}
+
+Arena* find(uint8_t owner) {
+    return owner < System::Memory::MAX_PLUGINS && arenas[owner].base ? &arenas[owner] : nullptr;
+}
+}  // namespace
+
+bool open(uint8_t owner, size_t capacity) {
+    if (owner >= System::Memory::MAX_PLUGINS) return false;
+    release(owner);
+    if (capacity == 0) return false;
+
+    void* block = allocateBlock(capacity);
+    if (!block) {
+        LOGF("[PluginArena] ERROR: No %u bytes for plugin %u, using the heap\n",
+             static_cast<unsigned>(capacity), static_cast<unsigned>(owner));
+        return false;
+    }
+    arenas[owner] = {static_cast<uint8_t*>(block), 0, {static_cast<uint32_t>(capacity), 0, 0, 0}};
+    return true;
+}
+
+void release(uint8_t owner) {
+    Arena* arena = find(owner);
+    if (!arena) return;
+    freeBlock(arena->base);
+    *arena = {};
+}
+
+void* allocate(uint8_t owner, size_t size, size_t alignment) {
+    Arena* arena = find(owner);
+    if (arena) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(arena->base);
+        const uintptr_t start = (base + arena->top + alignment - 1) & ~(alignment - 1);
+        const size_t offset = start - base;
+        if (offset + size <= arena->stats.capacity) {
+            arena->top = offset + size;
+            arena->stats.used = static_cast<uint32_t>(arena->top);
+            if (arena->stats.used > arena->stats.peak) {
+                arena->stats.peak = arena->stats.used;
+            }
+            return arena->base + offset;
+        }
+        ++arena->stats.overflows;
+    }
+    return malloc(size != 0 ? size : 1);
+}
+
+void deallocate(void* pointer, size_t size) {
+    if (!pointer) return;
+    for (uint8_t owner = 0; owner < System::Memory::MAX_PLUGINS; ++owner) {
+        if (!contains(owner, pointer)) continue;
+
+        // Only the last block can be given back before release()
+        Arena& arena = arenas[owner];
+        const size_t offset = static_cast<uint8_t*>(pointer) - arena.base;
+        if (offset + size == arena.top) {
+            arena.top = offset;
+            arena.stats.used = static_cast<uint32_t>(offset);
+        }
+        return;
+    }
+    free(pointer);
+}
+
+bool contains(uint8_t owner, const void* pointer) {
+    const Arena* arena = find(owner);
+    if (!arena) return false;
+    const uint8_t* address = static_cast<const uint8_t*>(pointer);
+    return address >= arena->base && address < arena->base + arena->stats.capacity;
+}
+
+const Stats& stats(uint8_t owner) {
+    return owner < System::Memory::MAX_PLUGINS ? arenas[owner].stats : NO_STATS;
+}
+
+}  // namespace PluginArena
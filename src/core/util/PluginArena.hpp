@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief One memory block per plugin, released in one step
+ *
+ * PluginManager opens an arena for each plugin before constructing it
+ * (System::Memory::PLUGIN_ARENA_SIZE bytes, in PSRAM with
+ * PLUGIN_ARENA_PSRAM) and places the plugin object at its start. The
+ * plugin allocates from it through ControllerAPI::allocate() and
+ * ControllerAPI::allocator<T>() (std::vector, std::basic_string members).
+ * Allocation bumps a top offset; freeing only rolls it back for the last
+ * block, so buffers are best sized up front. The block goes back to the
+ * heap as a whole with release(): a plugin's churn never fragments the
+ * memory the rest of the firmware uses.
+ *
+ * release() runs no destructor: objects in the arena are destroyed by
+ * their owner first (members of the plugin, by the plugin destructor).
+ * Requests the arena cannot serve (full, or no arena open for the owner)
+ * are passed to malloc and counted in Stats::overflows; deallocate() finds
+ * where a block came from by its address, whatever the current owner.
+ */
+namespace PluginArena {
+
+struct Stats {
+    uint32_t capacity;
+    uint32_t used;       // Top offset, alignment padding included
+    uint32_t peak;
+    uint32_t overflows;  // Allocations passed to malloc
+};
+
+/** @brief Allocate the owner's block (releasing the previous one) @return false on no memory */
+bool open(uint8_t owner, size_t capacity);
+
+/** @brief Give the owner's block back, whatever was allocated from it */
+void release(uint8_t owner);
+
+/** @return Never nullptr unless malloc fails too */
+void* allocate(uint8_t owner, size_t size, size_t alignment = alignof(max_align_t));
+
+/** @brief Give memory from allocate() back, whichever arena (or the heap) it came from */
+void deallocate(void* pointer, size_t size);
+
+/** @brief pointer is inside the owner's block */
+bool contains(uint8_t owner, const void* pointer);
+
+/** @return Zeroed Stats for unknown owners */
+const Stats& stats(uint8_t owner);
+
+/** @brief Standard allocator on one owner's arena, for std containers */
+template <typename T>
+class Allocator {
+public:
+    using value_type = T;
+
+    explicit Allocator(uint8_t owner) : owner_(owner) {}
+
+    template <typename U>
+    Allocator(const Allocator<U>& other) : owner_(other.owner()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(PluginArena::allocate(owner_, count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        PluginArena::deallocate(pointer, count * sizeof(T));
+    }
+
+    uint8_t owner() const {
+        return owner_;
+    }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const {
+        return owner_ == other.owner();
+    }
+
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const {
+        return owner_ != other.owner();
+    }
+
+private:
+    uint8_t owner_;
+};
+
+}  // namespace PluginArena
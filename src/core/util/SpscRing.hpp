@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring buffer
+ *
+ * One context pushes (typically an ISR), one context pops (the main loop).
+ * No locks, no allocation. One cell is kept free to tell full from empty,
+ * so the ring holds Capacity - 1 elements.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam Capacity Number of cells (power of two)
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    SpscRing() : head_(0), tail_(0), dropped_(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /** @brief Producer side. Returns false (and counts a drop) when full */
+    bool push(const T& value) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t next = (head + 1) & MASK;
+        if (next == tail_.load(std::memory_order_acquire)) {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+            return false;
+        }
+
+        items_[head] = value;
+        head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Consumer side. Returns false when empty */
+    bool pop(T& value) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = items_[tail];
+        tail_.store((tail + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        return (head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire)) &
+               MASK;
+    }
+
+    /** @brief Consumer side. Discards everything queued so far */
+    void clear() {
+        tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    uint32_t getDroppedCount() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t MASK = static_cast<uint32_t>(Capacity - 1);
+
+    T items_[Capacity];
+    std::atomic<uint32_t> head_;
+    std::atomic<uint32_t> tail_;
+    std::atomic<uint32_t> dropped_;
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <Arduino.h>
+#include <etl/vector.h>
+#include <stdint.h>
+
+#include "config/System.hpp"
+#include "core/util/PluginAccounting.hpp"
+
+/**
+ * @brief Stackless cooperative task (protothread style)
+ *
+ * A multi-step job written as straight-line code in run(), which the task
+ * runner calls once per loop. TASK_YIELD / TASK_AWAIT / TASK_SLEEP_MS return
+ * to the main loop and resume at the same line on the next call:
+ *
+ * @code
+ * class DumpTask : public Task {
+ *     Status run() override {
+ *         TASK_BEGIN();
+ *         api_.sendSysEx(request, sizeof(request));
+ *         TASK_AWAIT_FOR(replyReceived_, 200);
+ *         if (timedOut()) return fail();
+ *         for (index_ = 0; index_ < count_; ++index_) {
+ *             updateWidget(index_);
+ *             TASK_YIELD();  // One widget per loop
+ *         }
+ *         TASK_END();
+ *     }
+ *     uint8_t index_ = 0;  // State that crosses a yield must be a member
+ * };
+ * @endcode
+ *
+ * The resume point is a switch on __LINE__: locals do not survive a yield,
+ * and run() must not contain a switch of its own around a yield.
+ */
+class Task {
+public:
+    enum class Status : uint8_t { RUNNING, DONE };
+
+    virtual ~Task() = default;
+
+    /** @brief One step, from the last yield to the next one */
+    virtual Status run() = 0;
+
+    /** @brief Start over from TASK_BEGIN on the next run() */
+    void reset() {
+        line_ = 0;
+        timedOut_ = false;
+    }
+
+    /** @brief Last TASK_AWAIT_FOR gave up on its deadline */
+    bool timedOut() const {
+        return timedOut_;
+    }
+
+protected:
+    /** @brief Finish early (from a step, instead of reaching TASK_END) */
+    Status fail() {
+        line_ = 0;
+        return Status::DONE;
+    }
+
+    static bool deadlineReached(uint32_t deadlineMs) {
+        return static_cast<int32_t>(millis() - deadlineMs) >= 0;
+    }
+
+    uint16_t line_ = 0;
+    uint32_t deadlineMs_ = 0;
+    bool timedOut_ = false;
+};
+
+#define TASK_BEGIN() \
+    switch (line_) { \
+        case 0:
+
+#define TASK_YIELD() \
+    do { \
+        line_ = __LINE__; \
+        return Status::RUNNING; \
+        case __LINE__:; \
+    } while (0)
+
+#define TASK_AWAIT(cond) \
+    do { \
+        line_ = __LINE__; \
+        case __LINE__: \
+            if (!(cond)) return Status::RUNNING; \
+    } while (0)
+
+/* cond is evaluated again after the wait to tell success from timeout */
+#define TASK_AWAIT_FOR(cond, ms) \
+    do { \
+        deadlineMs_ = millis() + (ms); \
+        TASK_AWAIT((cond) || deadlineReached(deadlineMs_)); \
+        timedOut_ = !(cond); \
+    } while (0)
+
+#define TASK_SLEEP_MS(ms) \
+    do { \
+        deadlineMs_ = millis() + (ms); \
+        TASK_AWAIT(deadlineReached(deadlineMs_)); \
+    } while (0)
+
+#define TASK_END() \
+    } \
+    line_ = 0; \
+    return Status::DONE
+
+/**
+ * @brief Runs started tasks once per loop until they are done
+ *
+ * Tasks are owned by their plugin; the runner only keeps pointers
+ * (System::Memory::MAX_SCHEDULED_TASKS). A task may start or cancel tasks,
+ * itself included, from its run().
+ */
+class TaskRunner {
+public:
+    /** @return false if already running or the task table is full */
+    bool start(Task& task) {
+        if (isRunning(task) || tasks_.full()) {
+            return false;
+        }
+        task.reset();
+        tasks_.push_back({&task, PluginAccounting::currentOwner()});
+        return true;
+    }
+
+    void cancel(Task& task) {
+        for (Slot& slot : tasks_) {
+            if (slot.task == &task) {
+                slot.task = nullptr;  // Compacted after the current pass
+            }
+        }
+        if (!running_) {
+            compact();
+        }
+    }
+
+    bool isRunning(const Task& task) const {
+        for (const Slot& slot : tasks_) {
+            if (slot.task == &task) return true;
+        }
+        return false;
+    }
+
+    /** @brief One step of every task, in start order */
+    void run() {
+        running_ = true;
+        // Index loop: run() may push new tasks while we walk the table
+        for (size_t i = 0; i < tasks_.size(); ++i) {
+            if (!tasks_[i].task) continue;
+            PluginAccounting::CallbackTimer timer(tasks_[i].owner);
+            if (tasks_[i].task->run() == Task::Status::DONE) {
+                tasks_[i].task = nullptr;
+            }
+        }
+        running_ = false;
+        compact();
+    }
+
+    size_t size() const {
+        return tasks_.size();
+    }
+
+private:
+    void compact() {
+        size_t kept = 0;
+        for (size_t i = 0; i < tasks_.size(); ++i) {
+            if (tasks_[i].task) tasks_[kept++] = tasks_[i];
+        }
+        while (tasks_.size() > kept) {
+            tasks_.pop_back();
+        }
+    }
+
+    struct Slot {
+        Task* task;
+        uint8_t owner;  // PluginAccounting owner at start()
+    };
+
+    etl::vector<Slot, System::Memory::MAX_SCHEDULED_TASKS> tasks_;
+    bool running_ = false;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "core/midi/Ump.hpp"
+
+/**
+ * @brief Normalized 0.0-1.0 value as a 16-bit fraction (0xFFFF = 1.0)
+ *
+ * The encoder -> MIDI path carries values in this form next to the float
+ * API: equality is exact, so unchanged values are recognized as such, and
+ * MIDI resolutions are bit shifts (7 and 14 bits down, 32 bits by the UMP
+ * min-center-max scaling) instead of float multiplies and rounding.
+ *
+ * Trivially copyable, it travels inside events.
+ */
+struct UNorm16 {
+    static constexpr uint16_t MAX_RAW = 0xFFFF;
+
+    uint16_t raw = 0;
+
+    /** @brief position / (span), both integers: exact, position clamped to 0..span */
+    static constexpr UNorm16 fromRatio(int32_t position, int32_t span) {
+        if (span <= 0 || position <= 0) return {0};
+        if (position >= span) return {MAX_RAW};
+        return {static_cast<uint16_t>(
+            (static_cast<uint32_t>(position) * MAX_RAW + static_cast<uint32_t>(span) / 2) /
+            static_cast<uint32_t>(span))};
+    }
+
+    /** @param value Clamped to 0.0-1.0, rounded to nearest */
+    static constexpr UNorm16 fromFloat(float value) {
+        return value <= 0.0f   ? UNorm16{0}
+               : value >= 1.0f ? UNorm16{MAX_RAW}
+                               : UNorm16{static_cast<uint16_t>(value * MAX_RAW + 0.5f)};
+    }
+
+    constexpr float toFloat() const {
+        return raw / static_cast<float>(MAX_RAW);
+    }
+
+    constexpr uint8_t to7Bit() const {
+        return static_cast<uint8_t>(Ump::scaleDown(raw, 16, 7));
+    }
+
+    constexpr uint16_t to14Bit() const {
+        return static_cast<uint16_t>(Ump::scaleDown(raw, 16, 14));
+    }
+
+    /** @brief Full 32-bit range (MIDI 2.0 controllers), exact at 0, center and 1.0 */
+    constexpr uint32_t to32Bit() const {
+        return Ump::scaleUp(raw, 16, 32);
+    }
+
+    /** @return Step of `steps` nearest this value (0..steps-1), exact integer rounding */
+    constexpr uint16_t stepIndex(uint16_t steps) const {
+        if (steps < 2) return 0;
+        const uint32_t last = steps - 1u;
+        return static_cast<uint16_t>((raw * last + MAX_RAW / 2) / MAX_RAW);
+    }
+
+    /** @brief Value of step `index` of `steps` (inverse of stepIndex) */
+    static constexpr UNorm16 fromStep(uint16_t index, uint16_t steps) {
+        return steps < 2 ? UNorm16{0} : fromRatio(index, steps - 1);
+    }
+
+    constexpr bool operator==(UNorm16 other) const {
+        return raw == other.raw;
+    }
+    constexpr bool operator!=(UNorm16 other) const {
+        return raw != other.raw;
+    }
+};
+
+static_assert(UNorm16::fromStep(UNorm16{0x8000}.stepIndex(3), 3).raw == 0x8000,
+              "Center survives a 3-step quantization");
+static_assert(UNorm16{UNorm16::MAX_RAW}.to7Bit() == 127, "Full scale is CC 127");
+static_assert(UNorm16{UNorm16::MAX_RAW}.to14Bit() == 16383, "Full scale is 14-bit 16383");
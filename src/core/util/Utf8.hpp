@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Utf8 {
+
+/**
+ * @brief Bytes of text that fit in maxBytes, never half a code point
+ *
+ * Stops at the NUL or at maxBytes. When the text goes on past maxBytes and
+ * the cut falls inside a multi-byte sequence, the continuation bytes and
+ * their lead byte are left out.
+ *
+ * @param text NUL terminated, or at least maxBytes + 1 bytes long
+ */
+inline size_t safeLength(const char* text, size_t maxBytes) {
+    if (!text) return 0;
+    size_t length = 0;
+    while (length < maxBytes && text[length] != '\0') {
+        ++length;
+    }
+    if (text[length] != '\0') {
+        while (length > 0 && (static_cast<uint8_t>(text[length]) & 0xC0) == 0x80) {
+            --length;
+        }
+    }
+    return length;
+}
+
+}  // namespace Utf8
@@ -0,0 +1,306 @@
+#include "AsyncLog.hpp"
+
+#if defined(DEBUG_LOGS) && !defined(SYNC_LOGS)
+
+#include <stdio.h>
+
+#include <atomic>
+
+namespace AsyncLog {
+
+namespace {
+
+constexpr uint32_t RING_SIZE = System::Memory::LOG_RING_SIZE;
+constexpr uint32_t RING_MASK = RING_SIZE - 1;
+static_assert((RING_SIZE & RING_MASK) == 0, "LOG_RING_SIZE must be a power of two");
+
+/* Records: <size U16> <format pointer> <tagged arguments>, may wrap around */
+uint8_t ring[RING_SIZE];
+std::atomic<uint32_t> head{0};  // Written by push()
+std::atomic<uint32_t> tail{0};  // Written by flush()
+std::atomic<uint32_t> droppedCount{0};
+uint32_t droppedReported = 0;
+
+void copyIn(uint32_t position, const void* bytes, size_t length) {
+    const uint8_t* source = static_cast<const uint8_t*>(bytes);
+    for (size_t i = 0; i < length; ++i) {
+        ring[(position + i) & RING_MASK] = source[i];
+    }
+}
+
+void copyOut(uint32_t position, void* bytes, size_t length) {
+    uint8_t* target = static_cast<uint8_t*>(bytes);
+    for (size_t i = 0; i < length; ++i) {
+        target[i] = ring[(position + i) & RING_MASK];
+    }
+}
+
+/** @brief Reads the tagged arguments of one record in order */
+class ArgReader {
+public:
+    ArgReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    /** @return false once the arguments are used up */
+    bool next(Tag& tag) {
+        if (position_ >= size_) return false;
+        tag = static_cast<Tag>(data_[position_++]);
+        return true;
+    }
+
+    template <typename T>
+    T value() {
+        T result{};
+        if (position_ + sizeof(T) <= size_) {
+            memcpy(&result, data_ + position_, sizeof(T));
+        }
+        position_ += sizeof(T);
+        return result;
+    }
+
+    /** @brief Copy a TAG_STR argument into text (NUL-terminated) */
+    void string(char* text, size_t capacity) {
+        size_t length = position_ < size_ ? data_[position_++] : 0;
+        if (position_ + length > size_) length = size_ - position_;
+        const size_t copied = length < capacity - 1 ? length : capacity - 1;
+        memcpy(text, data_ + position_, copied);
+        text[copied] = '\0';
+        position_ += length;
+    }
+
+    /** @brief Next argument as an int ('*' widths) */
+    int32_t integer() {
+        Tag tag;
+        return next(tag) ? integer(tag) : 0;
+    }
+
+    /** @brief Read the argument whose tag next() returned, as an int */
+    int32_t integer(Tag tag) {
+        switch (tag) {
+            case TAG_I32: return value<int32_t>();
+            case TAG_U32: return static_cast<int32_t>(value<uint32_t>());
+            case TAG_I64: return static_cast<int32_t>(value<int64_t>());
+            case TAG_U64: return static_cast<int32_t>(value<uint64_t>());
+            case TAG_F64: return static_cast<int32_t>(value<double>());
+            case TAG_PTR: value<const void*>(); return 0;
+            case TAG_STR: {
+                char skipped[2];
+                string(skipped, sizeof(skipped));
+                return 0;
+            }
+        }
+        return 0;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t position_ = 0;
+};
+
+bool isFlag(char c) {
+    return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0';
+}
+
+bool isLength(char c) {
+    return c == 'h' || c == 'l' || c == 'L' || c == 'j' || c == 'z' || c == 't' || c == 'q';
+}
+
+/* Appends with snprintf semantics: length keeps counting past capacity */
+void append(char* line, size_t capacity, size_t& length, const char* text) {
+    const int written = snprintf(line + (length < capacity ? length : capacity),
+                                 length < capacity ? capacity - length : 0, "%s", text);
+    if (written > 0) length += static_cast<size_t>(written);
+}
+
+/**
+ * @brief printf over recorded arguments, one conversion at a time
+ *
+ * Each conversion's flags, width and precision are kept; its length
+ * modifier is replaced by the one its recorded argument needs.
+ */
+size_t format(char* line, size_t capacity, const char* fmt, ArgReader& args) {
+    size_t length = 0;
+    char literal[2] = {0, 0};
+    while (*fmt) {
+        if (*fmt != '%') {
+            literal[0] = *fmt++;
+            append(line, capacity, length, literal);
+            continue;
+        }
+        ++fmt;
+        if (*fmt == '%') {
+            ++fmt;
+            append(line, capacity, length, "%");
+            continue;
+        }
+
+        char spec[24] = "%";
+        size_t specLength = 1;
+        auto specAppend = [&](const char* text) {
+            while (*text && specLength < sizeof(spec) - 4) spec[specLength++] = *text++;
+            spec[specLength] = '\0';
+        };
+        char piece[2] = {0, 0};
+        while (*fmt && (isFlag(*fmt) || (*fmt >= '0' && *fmt <= '9') || *fmt == '.' ||
+                        *fmt == '*')) {
+            if (*fmt == '*') {
+                char number[12];
+                snprintf(number, sizeof(number), "%ld", static_cast<long>(args.integer()));
+                specAppend(number);
+            } else {
+                piece[0] = *fmt;
+                specAppend(piece);
+            }
+            ++fmt;
+        }
+        while (*fmt && isLength(*fmt)) ++fmt;
+        const char conversion = *fmt;
+        if (conversion == '\0') break;
+        ++fmt;
+
+        char text[System::Memory::LOG_STRING_LENGTH + 32];
+        Tag tag;
+        if (!args.next(tag)) {
+            append(line, capacity, length, "(?)");
+            continue;
+        }
+        piece[0] = conversion;
+        if (conversion == 's' && tag != TAG_STR) {
+            args.integer(tag);  // Skip it: printf would take it for a pointer
+            append(line, capacity, length, "(?)");
+            continue;
+        }
+        switch (tag) {
+            case TAG_I32:
+            case TAG_U32: {
+                specAppend(piece);
+                const uint32_t bits = args.value<uint32_t>();
+                if (conversion == 'f' || conversion == 'e' || conversion == 'g') {
+                    snprintf(text, sizeof(text), spec, static_cast<double>(bits));
+                } else {
+                    snprintf(text, sizeof(text), spec, static_cast<unsigned>(bits));
+                }
+                break;
+            }
+            case TAG_I64:
+            case TAG_U64:
+                specAppend("ll");
+                specAppend(piece);
+                snprintf(text, sizeof(text), spec, args.value<unsigned long long>());
+                break;
+            case TAG_F64:
+                specAppend(conversion == 'e' || conversion == 'g' ? piece : "f");
+                snprintf(text, sizeof(text), spec, args.value<double>());
+                break;
+            case TAG_PTR:
+                specAppend("p");
+                snprintf(text, sizeof(text), spec, args.value<const void*>());
+                break;
+            case TAG_STR: {
+                char value[System::Memory::LOG_STRING_LENGTH + 1];
+                args.string(value, sizeof(value));
+                specAppend("s");
+                snprintf(text, sizeof(text), spec, value);
+                break;
+            }
+            default:
+                snprintf(text, sizeof(text), "(?)");
+                break;
+        }
+        append(line, capacity, length, text);
+    }
+    return length < capacity ? length : capacity - 1;
+}
+
+/**
+ * @brief Format the oldest record into line
+ * @return Record size in the ring (0: ring empty)
+ */
+uint32_t formatNext(char* line, size_t capacity, size_t& lineLength) {
+    const uint32_t readPos = tail.load(std::memory_order_relaxed);
+    if (readPos == head.load(std::memory_order_acquire)) return 0;
+
+    uint16_t size;
+    copyOut(readPos, &size, sizeof(size));
+    uint8_t data[System::Memory::LOG_RECORD_SIZE];
+    copyOut(readPos + sizeof(size), data, size);
+
+    const char* fmt;
+    memcpy(&fmt, data, sizeof(fmt));
+    ArgReader args(data + sizeof(fmt), size - sizeof(fmt));
+    lineLength = format(line, capacity, fmt, args);
+    return sizeof(size) + size;
+}
+
+size_t reportDropped(char* line, size_t capacity) {
+    const uint32_t count = droppedCount.load(std::memory_order_relaxed);
+    if (count == droppedReported) return 0;
+    const int length = snprintf(line, capacity, "[Log] %lu messages dropped (ring full)\n",
+                                static_cast<unsigned long>(count - droppedReported));
+    return length > 0 ? static_cast<size_t>(length) : 0;
+}
+
+}  // namespace
+
+void push(const Record& record) {
+    const uint32_t total = sizeof(uint16_t) + record.size();
+    const uint32_t writePos = head.load(std::memory_order_relaxed);
+    if (RING_SIZE - (writePos - tail.load(std::memory_order_acquire)) < total) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const uint16_t size = record.size();
+    copyIn(writePos, &size, sizeof(size));
+    copyIn(writePos + sizeof(size), record.data(), size);
+    head.store(writePos + total, std::memory_order_release);
+}
+
+size_t flush(Print& out) {
+    char line[System::Memory::LOG_LINE_LENGTH];
+    size_t printed = 0;
+
+    const size_t dropLength = reportDropped(line, sizeof(line));
+    if (dropLength > 0 && out.availableForWrite() >= static_cast<int>(dropLength)) {
+        out.write(reinterpret_cast<const uint8_t*>(line), dropLength);
+        droppedReported = droppedCount.load(std::memory_order_relaxed);
+    }
+
+    while (printed < System::Loop::LOG_RECORDS_PER_PASS) {
+        size_t length = 0;
+        const uint32_t recordSize = formatNext(line, sizeof(line), length);
+        if (recordSize == 0) break;
+        // Left queued until the USB buffer has room: printing never waits
+        if (out.availableForWrite() < static_cast<int>(length)) break;
+        out.write(reinterpret_cast<const uint8_t*>(line), length);
+        tail.store(tail.load(std::memory_order_relaxed) + recordSize, std::memory_order_release);
+        ++printed;
+    }
+    return printed;
+}
+
+void flushAll(Print& out) {
+    char line[System::Memory::LOG_LINE_LENGTH];
+    const size_t dropLength = reportDropped(line, sizeof(line));
+    if (dropLength > 0) {
+        out.write(reinterpret_cast<const uint8_t*>(line), dropLength);
+        droppedReported = droppedCount.load(std::memory_order_relaxed);
+    }
+
+    size_t length = 0;
+    while (const uint32_t recordSize = formatNext(line, sizeof(line), length)) {
+        out.write(reinterpret_cast<const uint8_t*>(line), length);
+        tail.store(tail.load(std::memory_order_relaxed) + recordSize, std::memory_order_release);
+    }
+}
+
+uint32_t dropped() {
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+bool pending() {
+    return tail.load(std::memory_order_relaxed) != head.load(std::memory_order_acquire);
+}
+
+}  // namespace AsyncLog
+
+#endif
@@ -0,0 +1,159 @@
+#pragma once
+
+/**
+ * @brief Deferred logging: LOG / LOGF / LOGLN record, the main loop prints
+ *
+ * A call copies the format string pointer (its ID: LOGF formats must be
+ * literals) and the raw arguments into a RAM ring, a few stores instead of
+ * a blocking Serial.printf. flush() formats the oldest records during the
+ * "log" loop stage, as far as the USB serial buffer takes them without
+ * waiting; a full ring drops new records and the next flush says how many.
+ *
+ * Strings (%s) are copied, up to System::Memory::LOG_STRING_LENGTH chars,
+ * so buffers may change right after the call. Integers up to 64 bits,
+ * floating point, pointers and chars are supported, as are '*' widths.
+ *
+ * Single producer: log from the main loop only, as with Serial. Used by
+ * DEBUG_LOGS builds unless SYNC_LOGS is defined (blocking prints, e.g.
+ * when the logs before a crash must not be lost).
+ */
+
+#include <Arduino.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "config/System.hpp"
+
+namespace AsyncLog {
+
+enum Tag : uint8_t { TAG_I32, TAG_U32, TAG_I64, TAG_U64, TAG_F64, TAG_PTR, TAG_STR };
+
+/** @brief One record built on the stack, then copied into the ring whole */
+class Record {
+public:
+    explicit Record(const char* format) {
+        put(&format, sizeof(format));
+    }
+
+    void add(const char* text) {
+        if (text == nullptr) text = "(null)";
+        const size_t length = strnlen(text, System::Memory::LOG_STRING_LENGTH);
+        const uint8_t header[2] = {TAG_STR, static_cast<uint8_t>(length)};
+        put(header, sizeof(header));
+        put(text, length);
+    }
+    void add(char* text) {
+        add(static_cast<const char*>(text));
+    }
+    void add(const String& text) {
+        add(text.c_str());
+    }
+
+    template <typename T>
+    void add(const T& value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            addValue(TAG_F64, static_cast<double>(value));
+        } else if constexpr (std::is_pointer_v<T>) {
+            addValue(TAG_PTR, static_cast<const void*>(value));
+        } else if constexpr (std::is_enum_v<T>) {
+            addValue(TAG_I32, static_cast<int32_t>(value));
+        } else if constexpr (sizeof(T) > 4) {
+            if constexpr (std::is_signed_v<T>) {
+                addValue(TAG_I64, static_cast<int64_t>(value));
+            } else {
+                addValue(TAG_U64, static_cast<uint64_t>(value));
+            }
+        } else if constexpr (std::is_signed_v<T>) {
+            addValue(TAG_I32, static_cast<int32_t>(value));
+        } else {
+            addValue(TAG_U32, static_cast<uint32_t>(value));
+        }
+    }
+
+    const uint8_t* data() const {
+        return data_;
+    }
+    uint16_t size() const {
+        return size_;
+    }
+    /** @brief Arguments did not fit in LOG_RECORD_SIZE */
+    bool truncated() const {
+        return truncated_;
+    }
+
+private:
+    template <typename T>
+    void addValue(Tag tag, T value) {
+        const uint8_t header = tag;
+        if (size_ + 1 + sizeof(T) > sizeof(data_)) {
+            truncated_ = true;
+            return;
+        }
+        put(&header, 1);
+        put(&value, sizeof(T));
+    }
+
+    void put(const void* bytes, size_t length) {
+        if (size_ + length > sizeof(data_)) {
+            truncated_ = true;
+            return;
+        }
+        memcpy(data_ + size_, bytes, length);
+        size_ += static_cast<uint16_t>(length);
+    }
+
+    uint8_t data_[System::Memory::LOG_RECORD_SIZE];
+    uint16_t size_ = 0;
+    bool truncated_ = false;
+};
+
+/** @brief Queue a record, or count it as dropped when the ring is full */
+void push(const Record& record);
+
+template <typename... Args>
+void write(const char* format, const Args&... args) {
+    Record record(format);
+    (record.add(args), ...);
+    push(record);
+}
+
+/** @brief Print value the way Serial.print / println would */
+template <typename T>
+void print(const T& value, bool newline) {
+    if constexpr (std::is_floating_point_v<T>) {
+        write(newline ? "%.2f\n" : "%.2f", value);
+    } else if constexpr (std::is_same_v<T, char>) {
+        write(newline ? "%c\n" : "%c", value);
+    } else if constexpr (std::is_integral_v<T>) {
+        if constexpr (std::is_signed_v<T>) {
+            write(newline ? "%ld\n" : "%ld", value);
+        } else {
+            write(newline ? "%lu\n" : "%lu", value);
+        }
+    } else {
+        write(newline ? "%s\n" : "%s", value);
+    }
+}
+
+/**
+ * @brief Format and print queued records without blocking
+ *
+ * Stops at the first record out.availableForWrite() has no room for, or
+ * after System::Loop::LOG_RECORDS_PER_PASS records.
+ * @return Records printed
+ */
+size_t flush(Print& out);
+
+/** @brief Print everything queued, waiting on out as needed */
+void flushAll(Print& out);
+
+/** @brief Records dropped on a full ring since boot */
+uint32_t dropped();
+
+/** @brief Records queued and not printed yet */
+bool pending();
+
+}  // namespace AsyncLog
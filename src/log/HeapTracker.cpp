@@ -0,0 +1,206 @@
+#include "HeapTracker.hpp"
+
+#ifdef HEAP_TRACKING
+
+#include <malloc.h>
+
+#include "config/System.hpp"
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* pointer, size_t size);
+void __real_free(void* pointer);
+
+extern unsigned long _heap_end;
+extern char* __brkval;
+}
+
+namespace HeapTracker {
+
+namespace {
+Stats counters = {};
+uint32_t passStart = 0;  // counters.allocations when the pass began
+
+CallSite sites[System::Memory::MAX_HEAP_CALL_SITES];
+size_t sitesUsed = 0;
+uint32_t sitesDropped = 0;
+
+uint32_t usableSize(void* pointer) {
+    return pointer ? static_cast<uint32_t>(malloc_usable_size(pointer)) : 0;
+}
+
+void recordSite(const void* caller, uint32_t bytes) {
+    for (size_t i = 0; i < sitesUsed; ++i) {
+        if (sites[i].caller == caller) {
+            ++sites[i].count;
+            sites[i].bytes += bytes;
+            return;
+        }
+    }
+    if (sitesUsed == System::Memory::MAX_HEAP_CALL_SITES) {
+        ++sitesDropped;
+        return;
+    }
+    sites[sitesUsed++] = {caller, 1, bytes};
+}
+
+void recordAllocation(void* pointer, const void* caller) {
+    if (!pointer) return;
+    const uint32_t bytes = usableSize(pointer);
+    ++counters.allocations;
+    counters.bytesInUse += bytes;
+    if (counters.bytesInUse > counters.peakBytes) {
+        counters.peakBytes = counters.bytesInUse;
+    }
+    recordSite(caller, bytes);
+}
+
+void recordFree(uint32_t bytes) {
+    ++counters.frees;
+    counters.bytesInUse = counters.bytesInUse > bytes ? counters.bytesInUse - bytes : 0;
+}
+
+void* trackedMalloc(size_t size, const void* caller) {
+    void* pointer = __real_malloc(size);
+    recordAllocation(pointer, caller);
+    return pointer;
+}
+}  // namespace
+
+const Stats& stats() {
+    return counters;
+}
+
+const CallSite& site(size_t index) {
+    return sites[index];
+}
+
+size_t siteCount() {
+    return sitesUsed;
+}
+
+uint32_t droppedSites() {
+    return sitesDropped;
+}
+
+void endPass() {
+    const uint32_t allocations = counters.allocations - passStart;
+    passStart = counters.allocations;
+    ++counters.passes;
+    counters.passAllocations = allocations;
+    if (allocations > counters.peakPassAllocations) {
+        counters.peakPassAllocations = allocations;
+    }
+    if (allocations != 0) {
+        ++counters.passesWithAllocations;
+    }
+}
+
+size_t largestFreeBlock() {
+    // Binary search on the real malloc: the probes are not counted
+    const struct mallinfo heap = mallinfo();
+    const uintptr_t top = reinterpret_cast<uintptr_t>(&_heap_end);
+    const uintptr_t brk = reinterpret_cast<uintptr_t>(__brkval);
+    size_t low = 0;
+    size_t high = static_cast<size_t>(heap.fordblks) + (top > brk ? top - brk : 0);
+    while (low < high) {
+        const size_t middle = low + (high - low + 1) / 2;
+        void* probe = __real_malloc(middle);
+        if (probe) {
+            __real_free(probe);
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return low;
+}
+
+void dump(Print& out) {
+    const struct mallinfo heap = mallinfo();
+    const size_t largest = largestFreeBlock();
+    const uint32_t freeBytes = static_cast<uint32_t>(heap.fordblks);
+    out.printf("[Heap] %lu allocs, %lu frees, %lu B in use (peak %lu B)\n",
+               static_cast<unsigned long>(counters.allocations),
+               static_cast<unsigned long>(counters.frees),
+               static_cast<unsigned long>(counters.bytesInUse),
+               static_cast<unsigned long>(counters.peakBytes));
+    out.printf("[Heap] %lu passes, %lu allocating (last %lu, peak %lu allocs per pass)\n",
+               static_cast<unsigned long>(counters.passes),
+               static_cast<unsigned long>(counters.passesWithAllocations),
+               static_cast<unsigned long>(counters.passAllocations),
+               static_cast<unsigned long>(counters.peakPassAllocations));
+    out.printf("[Heap] %lu B free in chunks, largest block %lu B, fragmentation %.1f%%\n",
+               static_cast<unsigned long>(freeBytes), static_cast<unsigned long>(largest),
+               freeBytes > largest ? 100.0f * (freeBytes - largest) / freeBytes : 0.0f);
+    if (sitesUsed == 0) return;
+    out.println("[Heap] caller       count    bytes");
+    for (size_t i = 0; i < sitesUsed; ++i) {
+        out.printf("  0x%08lx %8lu %8lu\n",
+                   static_cast<unsigned long>(reinterpret_cast<uintptr_t>(sites[i].caller)),
+                   static_cast<unsigned long>(sites[i].count),
+                   static_cast<unsigned long>(sites[i].bytes));
+    }
+    if (sitesDropped != 0) {
+        out.printf("  (%lu allocations from callers past the table)\n",
+                   static_cast<unsigned long>(sitesDropped));
+    }
+}
+
+void reset() {
+    const uint32_t bytesInUse = counters.bytesInUse;
+    counters = {};
+    counters.bytesInUse = bytesInUse;
+    counters.peakBytes = bytesInUse;
+    passStart = 0;
+    sitesUsed = 0;
+    sitesDropped = 0;
+}
+
+}  // namespace HeapTracker
+
+/*
+ * Linker wraps (--wrap=symbol sends calls to __wrap_symbol). operator new is
+ * wrapped for its caller: behind it, every malloc would come from new.cpp.
+ * operator delete reaches free().
+ */
+extern "C" {
+
+void* __wrap_malloc(size_t size) {
+    return HeapTracker::trackedMalloc(size, __builtin_return_address(0));
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    void* pointer = __real_calloc(count, size);
+    HeapTracker::recordAllocation(pointer, __builtin_return_address(0));
+    return pointer;
+}
+
+void* __wrap_realloc(void* pointer, size_t size) {
+    const uint32_t before = HeapTracker::usableSize(pointer);
+    void* moved = __real_realloc(pointer, size);
+    // On failure the block is left as it was
+    if (moved || size == 0) {
+        if (pointer) HeapTracker::recordFree(before);
+        HeapTracker::recordAllocation(moved, __builtin_return_address(0));
+    }
+    return moved;
+}
+
+void __wrap_free(void* pointer) {
+    if (pointer) HeapTracker::recordFree(HeapTracker::usableSize(pointer));
+    __real_free(pointer);
+}
+
+void* __wrap__Znwj(size_t size) {
+    return HeapTracker::trackedMalloc(size, __builtin_return_address(0));
+}
+
+void* __wrap__Znaj(size_t size) {
+    return HeapTracker::trackedMalloc(size, __builtin_return_address(0));
+}
+
+}  // extern "C"
+
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @brief Heap allocation counts per loop pass, peak use and fragmentation
+ *
+ * The linker routes malloc, calloc, realloc, free and operator new through
+ * the tracker (-Wl,--wrap=..., see env:heap). Each allocation is counted,
+ * with the bytes in use and their peak; HEAP_PASS() at the end of a main
+ * loop pass closes the pass, so a steady state that allocates nothing
+ * shows as passesWithAllocations not moving. The callers of the
+ * allocations are kept in a table of System::Memory::MAX_HEAP_CALL_SITES
+ * return addresses (addr2line -e firmware.elf <address> names them).
+ * HEAP_DUMP(Serial) prints the figures and the largest block malloc can
+ * still serve, HEAP_RESET() starts a new window.
+ *
+ * Only HEAP_TRACKING builds (env:heap) track anything: in other builds the
+ * macros compile to nothing. Counters are updated without masking
+ * interrupts: the firmware does not allocate from an ISR.
+ */
+
+#ifdef HEAP_TRACKING
+
+#include <Arduino.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace HeapTracker {
+
+struct Stats {
+    uint32_t allocations;           // malloc / calloc / realloc / new calls
+    uint32_t frees;
+    uint32_t bytesInUse;            // Usable size of the live blocks
+    uint32_t peakBytes;
+    uint32_t passes;                // HEAP_PASS() calls
+    uint32_t passAllocations;       // During the last pass
+    uint32_t peakPassAllocations;
+    uint32_t passesWithAllocations;
+};
+
+struct CallSite {
+    const void* caller;  // Return address of the malloc / new call
+    uint32_t count;
+    uint32_t bytes;
+};
+
+const Stats& stats();
+
+/** @param index 0 to siteCount() - 1 */
+const CallSite& site(size_t index);
+size_t siteCount();
+
+/** @brief Call sites that did not fit in the table */
+uint32_t droppedSites();
+
+void endPass();
+
+/** @brief Largest block malloc can serve now, free chunks and heap top included (probes malloc) */
+size_t largestFreeBlock();
+
+void dump(Print& out);
+
+/** @brief Zero the counters and call sites, bytesInUse kept */
+void reset();
+
+}  // namespace HeapTracker
+
+#define HEAP_PASS() HeapTracker::endPass()
+#define HEAP_DUMP(out) HeapTracker::dump(out)
+#define HEAP_RESET() HeapTracker::reset()
+
+#else
+#define HEAP_PASS() ((void)0)
+#define HEAP_DUMP(out) ((void)0)
+#define HEAP_RESET() ((void)0)
+#endif
@@ -2,7 +2,27 @@
 
 #include <Arduino.h>
 
-#ifdef DEBUG_LOGS
+/*
+ * DEBUG_LOGS builds queue logs in a RAM ring (log/AsyncLog.hpp) that the
+ * "log" loop stage prints, so logging costs about what it costs in a
+ * release build. SYNC_LOGS prints on the spot instead, blocking on Serial.
+ */
+#if defined(DEBUG_LOGS) && !defined(SYNC_LOGS)
+#include "log/AsyncLog.hpp"
+
+#define LOG(msg)                        \
+    do {                                \
+        AsyncLog::print((msg), false);  \
+    } while (0)
+#define LOGF(...)                      \
+    do {                               \
+        AsyncLog::write(__VA_ARGS__);  \
+    } while (0)
+#define LOGLN(msg)                     \
+    do {                               \
+        AsyncLog::print((msg), true);  \
+    } while (0)
+#elif defined(DEBUG_LOGS)
 #define LOG(msg)           \
     do {                   \
         Serial.print(msg); \
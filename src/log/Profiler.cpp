@@ -0,0 +1,88 @@
+#include "Profiler.hpp"
+
+#ifdef SECTION_PROFILING
+
+#include "config/System.hpp"
+#include "log/Macros.hpp"
+
+namespace Profiler {
+
+namespace {
+Section sections[System::Memory::MAX_PROFILE_SECTIONS];
+size_t sectionCount = 0;
+
+float toMicros(uint64_t cycles) {
+    return static_cast<float>(cycles) / static_cast<float>(F_CPU_ACTUAL / 1000000);
+}
+
+uint8_t bucketOf(uint32_t cycles) {
+    const uint32_t us = cycles / (F_CPU_ACTUAL / 1000000);
+    if (us == 0) return 0;
+    const uint8_t bucket = static_cast<uint8_t>(32 - __builtin_clz(us));
+    return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+void clear(Section& entry) {
+    entry.count = 0;
+    entry.totalCycles = 0;
+    entry.minCycles = UINT32_MAX;
+    entry.maxCycles = 0;
+    for (uint32_t& bucket : entry.histogram) {
+        bucket = 0;
+    }
+}
+}  // namespace
+
+Section* section(const char* name) {
+    for (size_t i = 0; i < sectionCount; ++i) {
+        if (sections[i].name == name) return &sections[i];
+    }
+    if (sectionCount == System::Memory::MAX_PROFILE_SECTIONS) {
+        LOGF("[Profiler] ERROR: Cannot add section %s (max %d)\n", name,
+             static_cast<int>(System::Memory::MAX_PROFILE_SECTIONS));
+        return nullptr;
+    }
+
+    if (sectionCount == 0) {
+        ARM_DEMCR |= ARM_DEMCR_TRCENA;
+        ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    }
+    Section& entry = sections[sectionCount++];
+    entry.name = name;
+    clear(entry);
+    return &entry;
+}
+
+void record(Section* section, uint32_t cycles) {
+    if (section == nullptr) return;
+    ++section->count;
+    section->totalCycles += cycles;
+    if (cycles < section->minCycles) section->minCycles = cycles;
+    if (cycles > section->maxCycles) section->maxCycles = cycles;
+    ++section->histogram[bucketOf(cycles)];
+}
+
+void dump(Print& out) {
+    out.println("[Profiler] section          count   min_us   avg_us   max_us  <1,2,4.. us");
+    for (size_t i = 0; i < sectionCount; ++i) {
+        const Section& entry = sections[i];
+        if (entry.count == 0) continue;
+        out.printf("  %-16s %8lu %8.2f %8.2f %8.2f ", entry.name, entry.count,
+                   toMicros(entry.minCycles), toMicros(entry.totalCycles) / entry.count,
+                   toMicros(entry.maxCycles));
+        for (uint32_t bucket : entry.histogram) {
+            out.printf(" %lu", bucket);
+        }
+        out.println();
+    }
+}
+
+void reset() {
+    for (size_t i = 0; i < sectionCount; ++i) {
+        clear(sections[i]);
+    }
+}
+
+}  // namespace Profiler
+
+#endif
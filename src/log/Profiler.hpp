@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @brief Scoped section timing on the DWT cycle counter
+ *
+ * PROFILE_SECTION("name") times the rest of the enclosing block. Per section
+ * it keeps count, min / avg / max and a histogram of power-of-two
+ * microsecond buckets; PROFILE_DUMP(Serial) prints them, PROFILE_RESET()
+ * starts over. Sections register on first use (static string names, up to
+ * System::Memory::MAX_PROFILE_SECTIONS).
+ *
+ * Only SECTION_PROFILING builds (env:profile) measure anything: in other
+ * builds the macros compile to nothing.
+ *
+ * @code
+ * void ButtonController::updateAll() {
+ *     PROFILE_SECTION("buttons");
+ *     ...
+ * }
+ * @endcode
+ */
+
+#ifdef SECTION_PROFILING
+
+#include <Arduino.h>
+
+#include <stdint.h>
+
+namespace Profiler {
+
+/* Bucket i: under 2^i us (0: under 1 us); the last one takes the rest */
+constexpr uint8_t HISTOGRAM_BUCKETS = 12;
+
+struct Section {
+    const char* name;
+    uint32_t count;
+    uint64_t totalCycles;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint32_t histogram[HISTOGRAM_BUCKETS];
+};
+
+/** @return The section named `name` (pointer compare), nullptr when the table is full */
+Section* section(const char* name);
+
+void record(Section* section, uint32_t cycles);
+void dump(Print& out);
+void reset();
+
+inline uint32_t cycles() {
+    return ARM_DWT_CYCCNT;
+}
+
+class Scope {
+public:
+    explicit Scope(Section* section) : section_(section), start_(cycles()) {}
+    ~Scope() {
+        record(section_, cycles() - start_);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    Section* section_;
+    uint32_t start_;
+};
+
+}  // namespace Profiler
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SECTION(name)                                                               \
+    static Profiler::Section* const PROFILE_CONCAT(profileSection_, __LINE__) =             \
+        Profiler::section(name);                                                            \
+    Profiler::Scope PROFILE_CONCAT(profileScope_, __LINE__)(                                \
+        PROFILE_CONCAT(profileSection_, __LINE__))
+#define PROFILE_DUMP(out) Profiler::dump(out)
+#define PROFILE_RESET() Profiler::reset()
+
+#else
+#define PROFILE_SECTION(name) ((void)0)
+#define PROFILE_DUMP(out) ((void)0)
+#define PROFILE_RESET() ((void)0)
+#endif
@@ -7,6 +7,14 @@
  * Update - Poll controllers
  */
 void InputManager::update() {
+    updateEncoders();
+    updateButtons();
+}
+
+void InputManager::updateEncoders() {
     encoders_.flushAllEvents();
+}
+
+void InputManager::updateButtons() {
     buttons_.updateAll();
 }
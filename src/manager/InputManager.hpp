@@ -17,6 +17,10 @@ public:
 
     void update();
 
+    /** @brief update() in two halves, for loops that poll them at different rates */
+    void updateEncoders();
+    void updateButtons();
+
 private:
     EncoderController& encoders_;
     ButtonController& buttons_;
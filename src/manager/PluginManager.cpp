@@ -1,33 +1,141 @@
 #include "PluginManager.hpp"
 
 #include <Arduino.h>
+#include <lvgl.h>
+#include <malloc.h>
 
 #include "adapter/input/encoder/EncoderController.hpp"
 #include "adapter/midi/TeensyUsbMidiIn.hpp"
 #include "core/input/InputBinding.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+
+uint32_t ratePeriodUs(PluginRate rate) {
+    switch (rate) {
+        case PluginRate::HZ_100:
+            return 10000;
+        case PluginRate::HZ_10:
+            return 100000;
+        case PluginRate::EVERY_LOOP:
+        default:
+            return 0;
+    }
+}
+
+/* Wrap-safe "deadline reached" on the 32-bit micros() counter */
+inline bool isDue(uint32_t now, uint32_t dueUs) {
+    return static_cast<int32_t>(now - dueUs) >= 0;
+}
+
+}  // namespace
 
 PluginManager::PluginManager(IEventBus& eventBus, TeensyUsbMidiIn& midiIn,
                              TeensyUsbMidiOut& midiOut, EncoderController& encoders,
-                             ViewManager& viewManager)
-    : bindingService_(eventBus),
+                             ViewManager& viewManager, MidiMapper& midiMapper)
+    : eventBus_(eventBus),
+      bindingService_(eventBus),
+      clock_(eventBus),
       midiOut_(midiOut),
-      api_(bindingService_, eventBus, midiOut_, encoders, viewManager) {}
+      api_(bindingService_, eventBus, midiIn, clock_, midiOut_, encoders, viewManager, tasks_,
+           midiMapper) {
+    PluginAccounting::begin();
+    midiIn.addRealtimeListener(
+        [this](uint8_t status, uint32_t timestampUs) { clock_.onRealtime(status, timestampUs); });
+}
 
 PluginManager::~PluginManager() {
-    for (auto& [name, plugin] : plugins_) {
-        if (plugin) {
-            plugin->cleanup();
+    for (PluginSlot& slot : plugins_) {
+        if (slot.plugin) {
+            slot.plugin->cleanup();
         }
     }
     plugins_.clear();
+    for (uint8_t owner = 0; owner < System::Memory::MAX_PLUGINS; ++owner) {
+        PluginArena::release(owner);
+    }
 }
 
 void PluginManager::update() {
+    const uint32_t loopStart = micros();
+    bool ranAny = false;
+
+    for (PluginSlot& slot : plugins_) {
+        if (!slot.plugin) continue;
+        if (!slot.plugin->isEnabled()) {
+            // Due as soon as it is enabled again: a deadline left behind
+            // would wrap isDue() after ~35 minutes disabled
+            slot.nextDueUs = loopStart;
+            continue;
+        }
+
+        const uint32_t now = micros();
+        if (!isDue(now, slot.nextDueUs)) continue;
+
+        // Loop budget spent: lower priorities stay due and run next loop
+        if (ranAny && now - loopStart >= System::Plugin::LOOP_BUDGET_US) break;
+
+        runSlot(slot);
+        ranAny = true;
+    }
+
+    tasks_.run();
+    api_.syncParameters();
+}
+
+void PluginManager::tickBindings() {
     bindingService_.processTick(millis());
+}
+
+void PluginManager::runSlot(PluginSlot& slot) {
+    const uint32_t start = micros();
+    {
+        PluginAccounting::OwnerScope owner(slot.owner);
+        const uint32_t startCycles = PluginAccounting::cycles();
+        slot.plugin->update();
+        PluginAccounting::chargeUpdate(slot.owner, PluginAccounting::cycles() - startCycles);
+    }
+    const uint32_t elapsed = micros() - start;
 
-    for (const auto& [name, plugin] : plugins_) {
-        if (plugin && plugin->isEnabled()) {
-            plugin->update();
+    slot.nextDueUs = start + ratePeriodUs(slot.rate);
+    if (elapsed > slot.budgetUs) {
+        slot.nextDueUs += System::Plugin::OVERRUN_BACKOFF_US;
+        if (slot.overruns++ == 0) {
+            LOGF("[PluginManager] %s update() took %lu us (budget %lu us), backing off\n",
+                 slot.name.c_str(), static_cast<unsigned long>(elapsed),
+                 static_cast<unsigned long>(slot.budgetUs));
         }
     }
+}
+
+PluginManager::MemorySnapshot PluginManager::memorySnapshot() {
+    lv_mem_monitor_t lvgl;
+    lv_mem_monitor(&lvgl);
+    const struct mallinfo heap = mallinfo();
+    return {static_cast<uint32_t>(heap.uordblks),
+            static_cast<uint32_t>(lvgl.total_size - lvgl.free_size)};
+}
+
+void PluginManager::recordInitMemory(uint8_t owner, const MemorySnapshot& before) {
+    const MemorySnapshot after = memorySnapshot();
+    PluginAccounting::setInitMemory(owner,
+                                    static_cast<int32_t>(after.heapUsed - before.heapUsed),
+                                    static_cast<int32_t>(after.lvglUsed - before.lvglUsed));
+}
+
+PluginManager::PluginSlot* PluginManager::findSlot(const std::string& name) {
+    for (PluginSlot& slot : plugins_) {
+        if (slot.name == name) return &slot;
+    }
+    return nullptr;
+}
+
+void PluginManager::insertSlot(PluginSlot&& slot) {
+    slot.nextDueUs = micros();  // Due now, however long after boot it is added
+    // Stable: a new plugin goes after those of the same priority
+    auto it = plugins_.begin();
+    while (it != plugins_.end() && it->priority >= slot.priority) {
+        ++it;
+    }
+    plugins_.insert(it, std::move(slot));
 }
\ No newline at end of file
@@ -1,37 +1,115 @@
 ﻿/*
  * PluginManager - Plugin system with minimal heap usage
  *
- * Services (InputBinding, MidiOutAdapter) are stack-allocated.
+ * Services (InputBinding, MidiClock, MidiOutAdapter) are stack-allocated.
  * Only plugins themselves are heap-allocated for dynamic load/unload.
+ *
+ * tickBindings() runs the input binding timers; the app calls it at its own
+ * rate (System::Loop::BINDING_TICK_PERIOD_US).
+ *
+ * Plugins sit in a table ordered by priority (highest first) and are
+ * updated at their own rate. Each update() is timed against its budget:
+ * an overrun pushes that plugin back by System::Plugin::OVERRUN_BACKOFF_US,
+ * and once System::Plugin::LOOP_BUDGET_US is spent the remaining plugins
+ * wait for the next loop, so input scanning keeps its share of the loop.
+ *
+ * Each plugin's cycles (update() and the callbacks it registered) and its
+ * heap / LVGL pool growth during initialize() are kept in PluginAccounting,
+ * under its integration id; ControllerAPI::getPluginStats() reads them.
+ *
+ * Each plugin object is placed in its own PluginArena, which also serves
+ * the plugin's ControllerAPI::allocate() calls. The arena is released in
+ * one step once the plugin is destroyed.
  */
 
 #pragma once
 
+#include <etl/vector.h>
+
 #include <memory>
+#include <new>
 #include <string>
-#include <unordered_map>
-#include <vector>
 
 #include "api/ControllerAPI.hpp"
 #include "adapter/midi/TeensyUsbMidiOut.hpp"
+#include "config/System.hpp"
 #include "resource/common/interface/IPlugin.hpp"
+#include "core/event/Events.hpp"
 #include "core/event/IEventBus.hpp"
 #include "core/input/InputBinding.hpp"
+#include "core/midi/MidiClock.hpp"
+#include "core/util/PluginAccounting.hpp"
+#include "core/util/PluginArena.hpp"
+#include "core/util/Task.hpp"
 
 class TeensyUsbMidiIn;
 class EncoderController;
+class MidiMapper;
 class LVGLBridge;
 
+/** @brief How often PluginManager calls a plugin's update() */
+enum class PluginRate : uint8_t {
+    EVERY_LOOP,
+    HZ_100,
+    HZ_10,
+};
+
 class PluginManager {
+public:
+    static constexpr uint8_t PRIORITY_LOW = 64;
+    static constexpr uint8_t PRIORITY_NORMAL = 128;
+    static constexpr uint8_t PRIORITY_HIGH = 192;
+
 private:
+    /** @brief Destroys a plugin in place; its arena is released apart */
+    struct PluginDeleter {
+        PluginDeleter() : memory(nullptr) {}
+        explicit PluginDeleter(void* allocation) : memory(allocation) {}
+
+        // Start of the allocation: IPlugin* is not it when IPlugin is not the first base
+        void* memory;
+
+        void operator()(IPlugin* plugin) const {
+            plugin->~IPlugin();
+            PluginArena::deallocate(memory, 0);  // Frees it if it went to the heap
+        }
+    };
+    using PluginPtr = std::unique_ptr<IPlugin, PluginDeleter>;
+
+    struct PluginSlot {
+        std::string name;
+        PluginPtr plugin;
+        uint8_t priority;
+        uint8_t owner;  // Integration id, PluginAccounting owner
+        PluginRate rate;
+        uint32_t budgetUs;
+        uint32_t nextDueUs;
+        uint32_t overruns;
+    };
+
+    IEventBus& eventBus_;
     InputBinding bindingService_;
+    MidiClock clock_;
     TeensyUsbMidiOut& midiOut_;
+    TaskRunner tasks_;
     ControllerAPI api_;
-    std::unordered_map<std::string, std::unique_ptr<IPlugin>> plugins_;
+    etl::vector<PluginSlot, System::Memory::MAX_PLUGINS> plugins_;
+
+    PluginSlot* findSlot(const std::string& name);
+    void insertSlot(PluginSlot&& slot);
+    void runSlot(PluginSlot& slot);
+
+    struct MemorySnapshot {
+        uint32_t heapUsed;
+        uint32_t lvglUsed;
+    };
+    static MemorySnapshot memorySnapshot();
+    static void recordInitMemory(uint8_t owner, const MemorySnapshot& before);
 
 public:
     PluginManager(IEventBus& eventBus, TeensyUsbMidiIn& midiIn, TeensyUsbMidiOut& midiOut,
-                  EncoderController& encoders, ViewManager& viewManager);
+                  EncoderController& encoders, ViewManager& viewManager,
+                  MidiMapper& midiMapper);
 
     ~PluginManager();
 
@@ -39,23 +117,63 @@ public:
         return api_;
     }
 
+    /**
+     * @brief Create, initialize and schedule a plugin
+     * @param priority Update order, higher first (same priority: registration order)
+     * @param rate How often update() is called
+     * @param budgetUs update() time above which the plugin is backed off
+     */
     template <typename PluginType>
-    bool registerPlugin(const std::string& name) {
+    bool registerPlugin(const std::string& name, uint8_t priority = PRIORITY_NORMAL,
+                        PluginRate rate = PluginRate::EVERY_LOOP,
+                        uint32_t budgetUs = System::Plugin::UPDATE_BUDGET_US) {
         static_assert(std::is_base_of_v<IPlugin, PluginType>,
                       "PluginType must inherit from IIntegrationPlugin");
 
-        if (plugins_.find(name) != plugins_.end()) {
+        if (findSlot(name) != nullptr) {
             return false;
         }
+        if (plugins_.full()) {
+            eventBus_.emit(IntegrationErrorEvent(name.c_str(),
+                                                 static_cast<uint8_t>(plugins_.size()),
+                                                 "plugin table full"));
+            return false;
+        }
+
+        uint8_t integrationId = static_cast<uint8_t>(plugins_.size());
+        PluginAccounting::reset(integrationId, true);
+        PluginArena::open(integrationId, System::Memory::PLUGIN_ARENA_SIZE);
 
-        auto plugin = std::make_unique<PluginType>(api_);
-        if (!plugin->initialize()) {
+        // Everything the plugin registers while constructing is tagged as its own
+        const MemorySnapshot before = memorySnapshot();
+        PluginPtr plugin;
+        bool initialized;
+        {
+            PluginAccounting::OwnerScope owner(integrationId);
+            void* memory =
+                PluginArena::allocate(integrationId, sizeof(PluginType), alignof(PluginType));
+            if (memory) {
+                plugin = PluginPtr(new (memory) PluginType(api_), PluginDeleter{memory});
+            }
+            initialized = plugin && plugin->initialize();
+        }
+        recordInitMemory(integrationId, before);
+
+        if (!initialized) {
+            plugin.reset();
+            PluginArena::release(integrationId);
+            eventBus_.emit(IntegrationErrorEvent(name.c_str(), integrationId, "initialize failed"));
             return false;
         }
 
-        plugins_[name] = std::move(plugin);
+        insertSlot({name, std::move(plugin), priority, integrationId, rate, budgetUs, 0, 0});
+        eventBus_.emit(IntegrationRegisteredEvent(name.c_str(), integrationId));
         return true;
     }
 
+    /** @brief Plugin updates, then tasks and parameter sync */
     void update();
+
+    /** @brief Long-press, repeat and gesture timeouts of the input bindings */
+    void tickBindings();
 };
@@ -24,46 +24,90 @@ ViewManager::ViewManager(LVGLBridge& displayBridge, IEventBus& eventBus)
     lv_obj_set_style_bg_color(pluginScreen_, lv_color_hex(0x000000), 0);
     lv_obj_set_style_pad_all(pluginScreen_, 0, 0);
 
+#ifndef SKIP_SPLASH
     // Create and show splash view on coreScreen_
     splashView_.emplace(coreScreen_);
     if (splashView_) {
         splashView_->init();
         showCoreSplash();
     }
+#endif
 
     // Load coreScreen at boot
     lv_scr_load(coreScreen_);
+
+    encoderWakeSub_ = eventBus_.on(EventCategory::Input, InputEvent::EncoderChanged,
+                                   [this](const Event&) { displayBridge_.wake(); });
+    buttonWakeSub_ = eventBus_.on(EventCategory::Input, InputEvent::ButtonPress,
+                                  [this](const Event&) { displayBridge_.wake(); });
+}
+
+ViewManager::~ViewManager() {
+    if (encoderWakeSub_ != 0) {
+        eventBus_.off(encoderWakeSub_);
+    }
+    if (buttonWakeSub_ != 0) {
+        eventBus_.off(buttonWakeSub_);
+    }
 }
 
-void ViewManager::update() {
+void ViewManager::update(bool inputPending) {
     if (!System::UI::ENABLE_FULL_UI) {
         return;
     }
 
+    // Hardware and fonts are ready by the first update (constructors done)
+    if (!bootCompleteEmitted_ && (System::UI::FAST_BOOT || !splashView_)) {
+        emitBootComplete();
+    }
+
     if (currentPluginView_) {
-        // Plugin view is active
-        displayBridge_.refresh();
+        // Plugin view is active (or still being prepared behind the old screen)
+        stepPreparation();
+        displayBridge_.refresh(inputPending);
     } else if (splashView_ && splashView_->isActive()) {
         // Core splash is active
         splashView_->update();
 
-        // Emit BootComplete once when splash is complete
-        if (!bootCompleteEmitted_ && splashView_->isSplashScreenCompleted()) {
-            LOGLN("[ViewManager] Splash complete - Emitting BootComplete event");
-            eventBus_.emit(SystemBootCompleteEvent());
-            bootCompleteEmitted_ = true;
+        if (splashView_->isSplashScreenCompleted()) {
+            bootSplashDone_ = true;
+            if (!bootCompleteEmitted_) {
+                emitBootComplete();
+            }
+            if (pendingPluginView_) {
+                activatePluginView(*pendingPluginView_);
+            }
         }
 
-        displayBridge_.refresh();
+        displayBridge_.refresh(inputPending);
+    } else if (!splashView_) {
+        displayBridge_.refresh(inputPending);
     }
 }
 
+bool ViewManager::hasWorkDue() const {
+    if (!System::UI::ENABLE_FULL_UI) return false;
+    if (!bootCompleteEmitted_ || preparePhase_ != PreparePhase::NONE) return true;
+    if (splashView_ && splashView_->isActive() && !currentPluginView_) return true;
+    return displayBridge_.hasFrameDue();
+}
+
+void ViewManager::emitBootComplete() {
+    LOGLN("[ViewManager] Boot complete - Emitting BootComplete event");
+    bootCompleteEmitted_ = true;
+    eventBus_.emit(SystemBootCompleteEvent());
+}
+
 void ViewManager::showCoreSplash() {
-    splashView_->setActive(true);
+    if (splashView_) {
+        splashView_->setActive(true);
+    }
 }
 
 void ViewManager::hideCoreSplash() {
-    splashView_->setActive(false);
+    if (splashView_) {
+        splashView_->setActive(false);
+    }
 }
 
 /*
@@ -74,20 +118,144 @@ lv_obj_t* ViewManager::getPluginContainer() {
 }
 
 void ViewManager::showPluginView(UI::IView& view) {
-    hideCoreSplash();
+    // Fast boot: let the boot splash finish, update() loads the view afterwards
+    if (!bootSplashDone_ && splashView_ && splashView_->isActive() &&
+        !splashView_->isSplashScreenCompleted()) {
+        pendingPluginView_ = &view;
+        return;
+    }
+    activatePluginView(view);
+}
+
+bool ViewManager::registerPluginView(UI::IView& view, bool hibernate) {
+    if (RegisteredView* entry = findRegistered(view)) {
+        entry->hibernate = hibernate;
+        return true;
+    }
+    if (registeredViews_.full()) {
+        LOGF("[ViewManager] ERROR: Cannot register view %s (max %d)\n", view.getViewId(),
+             static_cast<int>(System::UI::MAX_PLUGIN_VIEWS));
+        return false;
+    }
+    registeredViews_.push_back({&view, false, hibernate});
+    return true;
+}
+
+void ViewManager::unregisterPluginView(UI::IView& view) {
+    if (currentPluginView_ == &view) {
+        hidePluginView();
+    }
+    if (pendingPluginView_ == &view) {
+        pendingPluginView_ = nullptr;
+    }
+    for (auto it = registeredViews_.begin(); it != registeredViews_.end(); ++it) {
+        if (it->view == &view) {
+            registeredViews_.erase(it);
+            return;
+        }
+    }
+}
+
+void ViewManager::activatePluginView(UI::IView& view) {
+    pendingPluginView_ = nullptr;
+
+    // The previous view frees its tree before the new one builds its own
+    if (currentPluginView_ && currentPluginView_ != &view) {
+        deactivatePluginView();
+    }
+
+    RegisteredView* entry = findRegistered(view);
+    if (entry && !entry->created) {
+        if (!view.create(pluginScreen_)) {
+            LOGF("[ViewManager] ERROR: View %s failed to build\n", view.getViewId());
+            showCoreSplash();
+            lv_scr_load(coreScreen_);
+            return;
+        }
+        entry->created = true;
+    }
+
     currentPluginView_ = &view;
     view.onActivate();
+
+    // Plugin to plugin, the view was built on the screen in use: nothing hidden to prepare
+    if (System::UI::PREPARE_VIEWS_OFFSCREEN && lv_screen_active() != pluginScreen_) {
+        preparePhase_ = PreparePhase::LAYOUT;
+        return;
+    }
+    loadPluginScreen();
+}
+
+void ViewManager::loadPluginScreen() {
+    preparePhase_ = PreparePhase::NONE;
+    hideCoreSplash();
     lv_scr_load(pluginScreen_);
 }
 
+void ViewManager::stepPreparation() {
+    switch (preparePhase_) {
+        case PreparePhase::LAYOUT:
+            // Hidden screen: layout runs now, nothing is rendered until the load
+            lv_obj_update_layout(pluginScreen_);
+            preparePhase_ = PreparePhase::LOAD;
+            break;
+        case PreparePhase::LOAD:
+            loadPluginScreen();
+            break;
+        case PreparePhase::NONE:
+            break;
+    }
+}
+
+void ViewManager::deactivatePluginView() {
+    UI::IView* view = currentPluginView_;
+    currentPluginView_ = nullptr;
+    view->onDeactivate();
+
+    RegisteredView* entry = findRegistered(*view);
+    if (entry && entry->hibernate && entry->created) {
+        view->destroy();
+        entry->created = false;
+    }
+}
+
+ViewManager::RegisteredView* ViewManager::findRegistered(const UI::IView& view) {
+    for (RegisteredView& entry : registeredViews_) {
+        if (entry.view == &view) return &entry;
+    }
+    return nullptr;
+}
+
 void ViewManager::hidePluginView() {
+    pendingPluginView_ = nullptr;
+    preparePhase_ = PreparePhase::NONE;
+
     // Deactivate current plugin view if any
     if (currentPluginView_) {
-        currentPluginView_->onDeactivate();
-        currentPluginView_ = nullptr;
+        deactivatePluginView();
     }
 
     // Return to Core screen and show splash
     showCoreSplash();
     lv_scr_load(coreScreen_);
 }
+
+DisplayStats ViewManager::getDisplayStats() const {
+    return displayBridge_.getStats();
+}
+
+void ViewManager::setDisplayAutoTune(bool enabled) {
+    displayBridge_.setDriverAutoTune(enabled);
+}
+
+void ViewManager::wakeDisplay() {
+    displayBridge_.wake();
+}
+
+void ViewManager::setDebugOverlay(bool enabled) {
+    displayBridge_.setDebugOverlay(enabled);
+}
+
+bool ViewManager::isDebugOverlayEnabled() const {
+    return displayBridge_.isDebugOverlayEnabled();
+}
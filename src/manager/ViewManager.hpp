@@ -9,16 +9,32 @@
  * - ViewManager owns both screens (created at boot, never destroyed)
  * - Plugins receive pluginScreen_ via getPluginContainer()
  * - Screen switching is done via lv_scr_load()
+ *
+ * Plugin views can be registered (registerPluginView) instead of being
+ * shown as-is: their LVGL tree is then built by IView::create() on the first
+ * showPluginView(), and with hibernate set it is freed again (destroy())
+ * once the view is replaced. Only the view on screen holds LVGL memory.
+ *
+ * With System::UI::PREPARE_VIEWS_OFFSCREEN, the screen swap is deferred
+ * when coming from the core screen: the view is built and activated on the
+ * hidden pluginScreen_, update() lays it out on the next frame and loads it
+ * on the one after. The core screen stays up until then, as last rendered
+ * (the splash is not stepped meanwhile). From one plugin view to another the
+ * view is built on pluginScreen_ while it is on display, so there is nothing
+ * to hide it behind: it shows on the next frame.
  */
 
 #pragma once
 
 #include <etl/optional.h>
+#include <etl/vector.h>
 
+#include "adapter/display/ui/DisplayStats.hpp"
+#include "config/System.hpp"
+#include "core/event/IEventBus.hpp"
 #include "ui/view/SplashScreenView.hpp"
 
 class LVGLBridge;
-class IEventBus;
 
 namespace UI {
 class IView;
@@ -27,8 +43,13 @@ class IView;
 class ViewManager {
 public:
     explicit ViewManager(LVGLBridge& displayBridge, IEventBus& eventBus);
+    ~ViewManager();
+
+    /** @param inputPending Forwarded to LVGLBridge::refresh (frame may be dropped) */
+    void update(bool inputPending = false);
 
-    void update();
+    /** @brief update() has a frame, splash step or view switch step to run now */
+    bool hasWorkDue() const;
 
     /**
      * @brief Get plugin screen where plugins should create their UI
@@ -36,6 +57,16 @@ public:
      */
     lv_obj_t* getPluginContainer();
 
+    /**
+     * @brief Build the view on its first show instead of up front
+     * @param hibernate Free its LVGL tree while it is not on screen
+     * @return false if MAX_PLUGIN_VIEWS views are registered
+     */
+    bool registerPluginView(UI::IView& view, bool hibernate = false);
+
+    /** @brief Forget a registered view (hidden first if on screen) */
+    void unregisterPluginView(UI::IView& view);
+
     /**
      * @brief Show a plugin view (loads pluginScreen_)
      * @param view Reference to IView implementation (plugin keeps ownership)
@@ -47,14 +78,44 @@ public:
      */
     void hidePluginView();
 
+    DisplayStats getDisplayStats() const;
+
+    /** @brief Panel driver diff gap / vsync spacing auto-tune */
+    void setDisplayAutoTune(bool enabled);
+
+    /** @brief Leave display idle mode (e.g. the host changed what is on screen) */
+    void wakeDisplay();
+
+    /** @brief Dirty-region heatmap and frame times on top of every screen */
+    void setDebugOverlay(bool enabled);
+    bool isDebugOverlayEnabled() const;
+
 private:
     void showCoreSplash();
     void hideCoreSplash();
+    struct RegisteredView {
+        UI::IView* view;
+        bool created;
+        bool hibernate;
+    };
+
+    /** @brief Off-screen switch progress, stepped once per update() */
+    enum class PreparePhase : uint8_t { NONE, LAYOUT, LOAD };
+
+    void activatePluginView(UI::IView& view);
+    void loadPluginScreen();
+    void stepPreparation();
+    void deactivatePluginView();
+    RegisteredView* findRegistered(const UI::IView& view);
+    void emitBootComplete();
 
     bool bootCompleteEmitted_ = false;
+    bool bootSplashDone_ = false;
 
     LVGLBridge& displayBridge_;
     IEventBus& eventBus_;
+    SubscriptionId encoderWakeSub_ = 0;  // Input wakes the display from idle
+    SubscriptionId buttonWakeSub_ = 0;
 
     lv_obj_t* coreScreen_;    // Screen for Core views (splash, menus, etc.)
     lv_obj_t* pluginScreen_;  // Screen for Plugin views
@@ -62,4 +123,7 @@ private:
     etl::optional<SplashScreenView> splashView_;
 
     UI::IView* currentPluginView_ = nullptr;
+    UI::IView* pendingPluginView_ = nullptr;  // Shown during the splash (FAST_BOOT)
+    PreparePhase preparePhase_ = PreparePhase::NONE;
+    etl::vector<RegisteredView, System::UI::MAX_PLUGIN_VIEWS> registeredViews_;
 };
\ No newline at end of file
@@ -1,14 +1,18 @@
 #include "ui/ViewController.hpp"
 
+#include "adapter/input/button/ButtonController.hpp"
 #include "core/event/Events.hpp"
 #include "core/event/UnifiedEventTypes.hpp"
+#include "log/Macros.hpp"
 #include "manager/ViewManager.hpp"
+#include "ui/view/RenderBenchmarkView.hpp"
 
 using namespace EventCategory;
 using namespace SystemEvent;
 
-ViewController::ViewController(ViewManager& viewManager, IEventBus& eventBus)
-    : viewManager_(viewManager), eventBus_(eventBus) {
+ViewController::ViewController(ViewManager& viewManager, IEventBus& eventBus,
+                               const ButtonController& buttons)
+    : viewManager_(viewManager), eventBus_(eventBus), buttons_(buttons) {
     // ViewController is kept for future Core view navigation
     // Currently, Core only has splash screen, plugins manage their own views
 
@@ -17,6 +21,26 @@ ViewController::ViewController(ViewManager& viewManager, IEventBus& eventBus)
     });
 }
 
+ViewController::~ViewController() = default;
+
 void ViewController::onSystemBootComplete(const Event& event) {
-    // Reserved for future Core view initialization after boot
+    (void)event;
+    if (!renderBenchmarkRequested()) return;
+
+    // Built like a plugin view; a plugin showing its own view replaces it
+    renderBenchmark_ = std::make_unique<RenderBenchmarkView>(viewManager_);
+    if (!viewManager_.registerPluginView(*renderBenchmark_)) {
+        renderBenchmark_.reset();
+        return;
+    }
+    LOGLN("[ViewController] Render benchmark");
+    viewManager_.showPluginView(*renderBenchmark_);
+}
+
+bool ViewController::renderBenchmarkRequested() const {
+#ifdef RENDER_BENCHMARK
+    return true;
+#else
+    return buttons_.isPressed(ButtonID::LEFT_TOP) && buttons_.isPressed(ButtonID::LEFT_BOTTOM);
+#endif
 }
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <memory>
+
 #include "core/event/IEventBus.hpp"
 
+class ButtonController;
+class RenderBenchmarkView;
 class ViewManager;
 class Event;
 
@@ -11,18 +15,32 @@ class Event;
  * Currently minimal as Core only has splash screen.
  * Plugins manage their own views independently.
  *
+ * At boot it shows RenderBenchmarkView instead of leaving the screen to the
+ * plugins, in RENDER_BENCHMARK builds or when LEFT_TOP + LEFT_BOTTOM are
+ * held as the splash ends. MidiStudioApp then leaves the plugins out, so
+ * they neither load the loop nor take the screen.
+ *
  * Reserved for future Core view navigation (menus, settings, etc).
  */
 class ViewController {
 public:
-    ViewController(ViewManager& viewManager, IEventBus& eventBus);
-    ~ViewController() = default;
+    ViewController(ViewManager& viewManager, IEventBus& eventBus,
+                   const ButtonController& buttons);
+    ~ViewController();
+
+    /** @brief The render benchmark took the screen at boot */
+    bool renderBenchmarkActive() const {
+        return renderBenchmark_ != nullptr;
+    }
 
 private:
     ViewManager& viewManager_;
     IEventBus& eventBus_;
+    const ButtonController& buttons_;
 
     SubscriptionId bootCompleteSub_ = 0;
+    std::unique_ptr<RenderBenchmarkView> renderBenchmark_;
 
     void onSystemBootComplete(const Event& event);
+    bool renderBenchmarkRequested() const;
 };
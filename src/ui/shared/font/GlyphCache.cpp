@@ -0,0 +1,137 @@
+#include "GlyphCache.hpp"
+
+#include <string.h>
+
+#include "config/System.hpp"
+#include "log/Macros.hpp"
+
+namespace {
+
+constexpr size_t SLOTS = System::UI::GLYPH_CACHE_SLOTS;
+constexpr size_t SLOT_BYTES = System::UI::GLYPH_CACHE_SLOT_BYTES;
+constexpr size_t WAYS = 2;
+constexpr size_t SETS = SLOTS / WAYS;
+constexpr size_t FONTS = System::UI::GLYPH_CACHE_FONTS;
+constexpr uint8_t EMPTY = 0xFF;
+
+static_assert(SLOTS % WAYS == 0, "GLYPH_CACHE_SLOTS must be even");
+static_assert(SLOT_BYTES <= UINT16_MAX, "GLYPH_CACHE_SLOT_BYTES too large");
+
+using GetBitmapFn = const void* (*)(lv_font_glyph_dsc_t*, lv_draw_buf_t*);
+
+struct Slot {
+    uint32_t gid = 0;
+    uint8_t font = EMPTY;
+    uint8_t width = 0;
+    uint8_t height = 0;
+};
+
+struct Set {
+    Slot ways[WAYS];
+    uint8_t lru = 0;  // Way to evict next
+};
+
+/* Plain globals: DTCM on Teensy 4 */
+Set sets[SETS];
+uint8_t bitmaps[SLOTS][SLOT_BYTES];
+
+lv_font_t wrappers[FONTS];
+const lv_font_t* originals[FONTS];
+GetBitmapFn decoders[FONTS];
+size_t wrapperCount = 0;
+
+GlyphCache::Stats counters = {0, 0, 0};
+
+inline size_t setIndex(uint8_t font, uint32_t gid) {
+    return (gid * 2654435761u + font) % SETS;
+}
+
+/* Rows of width bytes between a packed slot and a strided A8 buffer */
+inline void copyRows(uint8_t* dst, size_t dstStride, const uint8_t* src, size_t srcStride,
+                     uint8_t width, uint8_t height) {
+    for (uint8_t y = 0; y < height; ++y) {
+        memcpy(dst + y * dstStride, src + y * srcStride, width);
+    }
+}
+
+const void* cachedBitmap(lv_font_glyph_dsc_t* glyph, lv_draw_buf_t* drawBuf) {
+    const uint8_t font = static_cast<uint8_t>(glyph->resolved_font - wrappers);
+    const GetBitmapFn decode = decoders[font];
+
+    const size_t size = static_cast<size_t>(glyph->box_w) * glyph->box_h;
+    if (glyph->req_raw_bitmap || !drawBuf || size == 0 || size > SLOT_BYTES ||
+        glyph->box_w > UINT8_MAX || glyph->box_h > UINT8_MAX) {
+        ++counters.bypassed;
+        return decode(glyph, drawBuf);
+    }
+
+    const uint32_t gid = glyph->gid.index;
+    const uint8_t width = static_cast<uint8_t>(glyph->box_w);
+    const uint8_t height = static_cast<uint8_t>(glyph->box_h);
+    const size_t stride = drawBuf->header.stride ? drawBuf->header.stride : width;
+    const size_t setIdx = setIndex(font, gid);
+    Set& set = sets[setIdx];
+
+    for (uint8_t way = 0; way < WAYS; ++way) {
+        const Slot& slot = set.ways[way];
+        if (slot.font == font && slot.gid == gid) {
+            ++counters.hits;
+            set.lru = static_cast<uint8_t>(way ^ 1);
+            copyRows(drawBuf->data, stride, bitmaps[setIdx * WAYS + way], width, width, height);
+            return drawBuf;
+        }
+    }
+
+    const void* result = decode(glyph, drawBuf);
+    if (result != drawBuf) {
+        ++counters.bypassed;  // Static bitmap or nothing: not ours to keep
+        return result;
+    }
+
+    ++counters.misses;
+    const uint8_t way = set.lru;
+    set.ways[way] = {gid, font, width, height};
+    set.lru = static_cast<uint8_t>(way ^ 1);
+    copyRows(bitmaps[setIdx * WAYS + way], width, drawBuf->data, stride, width, height);
+    return result;
+}
+
+}  // namespace
+
+namespace GlyphCache {
+
+const lv_font_t* wrap(const lv_font_t* font) {
+    if (!font) return nullptr;
+
+    for (size_t i = 0; i < wrapperCount; ++i) {
+        if (originals[i] == font) return &wrappers[i];
+    }
+
+    if (wrapperCount == FONTS) {
+        LOGF("[GlyphCache] ERROR: Cannot wrap font (max %d)\n", static_cast<int>(FONTS));
+        return font;
+    }
+
+    const size_t index = wrapperCount++;
+    originals[index] = font;
+    decoders[index] = font->get_glyph_bitmap;
+    wrappers[index] = *font;
+    wrappers[index].get_glyph_bitmap = cachedBitmap;
+    return &wrappers[index];
+}
+
+Stats stats() {
+    return counters;
+}
+
+void resetStats() {
+    counters = {0, 0, 0};
+}
+
+void clear() {
+    for (auto& set : sets) {
+        set = Set();
+    }
+}
+
+}  // namespace GlyphCache
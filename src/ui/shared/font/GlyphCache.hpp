@@ -0,0 +1,38 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+/**
+ * @brief Fast-RAM cache of decoded glyph bitmaps
+ *
+ * wrap() returns a RAM copy of a font whose get_glyph_bitmap first looks in
+ * a small DTCM cache (System::UI::GLYPH_CACHE_*). On a miss the font's own
+ * decoder runs and its A8 output is kept; on a hit the rows are copied
+ * straight into LVGL's draw buffer.
+ *
+ * Meant for the fonts of constantly redrawn labels (parameter values and
+ * names). Glyphs larger than GLYPH_CACHE_SLOT_BYTES pass through uncached.
+ */
+namespace GlyphCache {
+
+struct Stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t bypassed;  // Too large, raw bitmap requested, or not decoded to the buffer
+};
+
+/**
+ * @brief Cached stand-in for font (same wrapper for the same font)
+ * @return font itself once GLYPH_CACHE_FONTS fonts are wrapped
+ */
+const lv_font_t* wrap(const lv_font_t* font);
+
+Stats stats();
+void resetStats();
+
+/** @brief Drop every cached glyph */
+void clear();
+
+}  // namespace GlyphCache
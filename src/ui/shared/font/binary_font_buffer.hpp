@@ -2,15 +2,22 @@
 
 #include <lvgl.h>
 
+/**
+ * @brief Fonts by UI role
+ *
+ * Faces are native lv_font_t constants in flash (data/, generated by
+ * generate_font.sh / script/binfont_to_c.py): no parsing at boot and no LVGL
+ * heap use. Roles using the same face point to the same font.
+ */
 struct FontRegistry {
-    lv_font_t* parameter_label = nullptr;
-    lv_font_t* parameter_value_label = nullptr;
-    lv_font_t* device_label = nullptr;
-    lv_font_t* page_label = nullptr;
-    lv_font_t* tempo_label = nullptr;
-    lv_font_t* list_item_label = nullptr;
-    lv_font_t* splash_title = nullptr;
-    lv_font_t* splash_version = nullptr;
+    const lv_font_t* parameter_label = nullptr;
+    const lv_font_t* parameter_value_label = nullptr;
+    const lv_font_t* device_label = nullptr;
+    const lv_font_t* page_label = nullptr;
+    const lv_font_t* tempo_label = nullptr;
+    const lv_font_t* list_item_label = nullptr;
+    const lv_font_t* splash_title = nullptr;
+    const lv_font_t* splash_version = nullptr;
     const lv_font_t* lvgl_symbols = nullptr;  // LVGL default font with symbols
 };
 
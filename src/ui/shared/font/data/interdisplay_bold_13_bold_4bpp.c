@@ -0,0 +1,2276 @@
+/*
+ * interdisplay_bold_13_bold_4bpp - generated by script/binfont_to_c.py from interdisplay_bold_13_bold_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x6f, 0x93, 0x00, 0xc2, 0x20, 0x0d, 0xe0, 0x13, 0x19, 0x13, 0x55, 0x39, 0xdc, 0x24, 0x00,
+    0x0f, 0x97, 0xf3, 0x00, 0x08, 0x80, 0x40, 0x1e, 0x60, 0x60, 0xc6, 0xca, 0x20, 0x00, 0x4e, 0x82,
+    0x79, 0x00, 0x44, 0xe0, 0x40, 0x40, 0x02, 0x53, 0x2f, 0x12, 0x05, 0xd1, 0x6d, 0x61, 0xd0, 0x78,
+    0x08, 0xa1, 0x5b, 0x03, 0x00, 0x2b, 0x8e, 0xa8, 0x64, 0x06, 0xe8, 0x21, 0x82, 0x48, 0xed, 0x82,
+    0x98, 0x10, 0x11, 0x02, 0x4a, 0x20, 0x02, 0xe0, 0x36, 0x00, 0x80, 0x00, 0x89, 0x80, 0x3e, 0x48,
+    0x00, 0xe4, 0xe9, 0x1f, 0x80, 0x00, 0xd8, 0x98, 0x13, 0xb0, 0x20, 0x2c, 0x17, 0x8e, 0x03, 0x02,
+    0xf1, 0x97, 0x50, 0x1c, 0x02, 0x8f, 0x40, 0x04, 0xfc, 0xe0, 0x2f, 0x40, 0x92, 0xb8, 0x5c, 0x0a,
+    0x02, 0xd0, 0x46, 0xa0, 0x20, 0xa6, 0x69, 0x1b, 0x08, 0x00, 0x64, 0xa0, 0x36, 0x30, 0x04, 0xde,
+    0x52, 0x60, 0x00, 0x05, 0xee, 0x28, 0x05, 0x56, 0x01, 0x53, 0xba, 0x80, 0x0a, 0xaa, 0x00, 0x10,
+    0x55, 0x81, 0x0d, 0xc8, 0x80, 0x08, 0x15, 0x00, 0xac, 0x98, 0x03, 0x54, 0x42, 0x91, 0x78, 0x03,
+    0x97, 0xb8, 0xb5, 0x03, 0xbc, 0xe0, 0x1d, 0x24, 0xfc, 0xd1, 0x02, 0x00, 0x8d, 0xb8, 0x0b, 0x58,
+    0x1c, 0x02, 0xe7, 0x20, 0x2d, 0x60, 0x60, 0x04, 0x04, 0x00, 0x39, 0xa2, 0x06, 0x00, 0x01, 0xaf,
+    0xd4, 0x00, 0xd0, 0xaa, 0x0b, 0x00, 0xca, 0x35, 0x40, 0x10, 0x09, 0x45, 0xe4, 0xc4, 0x02, 0x80,
+    0x83, 0xd0, 0x0d, 0x40, 0x01, 0x14, 0xd8, 0x32, 0x3c, 0x9d, 0x33, 0x87, 0x06, 0xb3, 0xa8, 0x50,
+    0x60, 0x5d, 0x28, 0x00, 0xc1, 0x28, 0xd4, 0x24, 0xa8, 0x80, 0x0f, 0x90, 0x00, 0x80, 0x3c, 0x18,
+    0xc0, 0x00, 0xf0, 0xfe, 0x80, 0x18, 0x14, 0x01, 0x81, 0x60, 0x05, 0x03, 0x00, 0x09, 0x00, 0x08,
+    0x18, 0x00, 0x20, 0x20, 0x02, 0x06, 0x00, 0x08, 0x10, 0x04, 0x62, 0x40, 0x09, 0x0a, 0x00, 0x28,
+    0xa8, 0x00, 0x00, 0xd1, 0xea, 0x16, 0x1c, 0x06, 0x28, 0x00, 0x40, 0x30, 0x20, 0x60, 0xe0, 0x20,
+    0x0b, 0xc3, 0x83, 0x80, 0x80, 0x81, 0xc1, 0x4c, 0x94, 0x6c, 0x38, 0x00, 0x00, 0x0f, 0x80, 0x6d,
+    0x90, 0x8d, 0x00, 0x72, 0x82, 0xf0, 0x03, 0xcc, 0x0e, 0x00, 0x13, 0xe1, 0xfc, 0x00, 0x51, 0x91,
+    0x50, 0x00, 0x00, 0x47, 0x80, 0x7f, 0xa2, 0x08, 0x13, 0x08, 0xee, 0x30, 0x67, 0x3f, 0xf3, 0x87,
+    0xf9, 0xc0, 0x3f, 0xb5, 0x80, 0x20, 0x29, 0x44, 0x30, 0x70, 0x21, 0x20, 0x00, 0x28, 0x8c, 0x02,
+    0xef, 0x80, 0x01, 0x04, 0xe7, 0x70, 0x90, 0x00, 0x9d, 0x40, 0x05, 0x06, 0x00, 0x50, 0x40, 0x06,
+    0x09, 0x00, 0x11, 0x00, 0x03, 0x0f, 0x00, 0x58, 0x20, 0x01, 0x08, 0x40, 0x06, 0x80, 0x04, 0x0c,
+    0x00, 0x68, 0x20, 0x01, 0x0c, 0x40, 0x00, 0x00, 0x46, 0xf5, 0x90, 0x05, 0x2e, 0x08, 0x8d, 0x20,
+    0x26, 0x2d, 0xa9, 0x0b, 0x04, 0x0b, 0x00, 0x30, 0x20, 0x70, 0x10, 0x04, 0x44, 0x00, 0xff, 0x70,
+    0x10, 0x04, 0x44, 0x04, 0x0a, 0x00, 0x30, 0x20, 0x13, 0x1e, 0xd4, 0x85, 0x80, 0x25, 0xc1, 0x11,
+    0xa4, 0x00, 0x04, 0xef, 0x58, 0xb1, 0x00, 0x1b, 0xb8, 0x01, 0x50, 0x01, 0x08, 0x07, 0xff, 0x44,
+    0x02, 0xbe, 0xe4, 0x88, 0x03, 0x11, 0x4d, 0xb4, 0x14, 0x5a, 0xf4, 0x8c, 0x85, 0xec, 0x00, 0xc0,
+    0x04, 0x82, 0x03, 0x42, 0x20, 0x04, 0x7a, 0x1c, 0x01, 0x26, 0x0e, 0x18, 0x01, 0x6c, 0x70, 0xc0,
+    0x0b, 0x40, 0xb5, 0x32, 0x22, 0x00, 0x11, 0x9b, 0x00, 0x02, 0xae, 0xe5, 0x98, 0x03, 0x15, 0x48,
+    0x8d, 0x13, 0x06, 0xba, 0x61, 0x53, 0xe9, 0x24, 0x40, 0xa0, 0x05, 0xb6, 0x7a, 0x01, 0xa9, 0xc3,
+    0x0d, 0x20, 0xd6, 0x2c, 0x28, 0x5e, 0x40, 0x1a, 0x02, 0xa2, 0xb5, 0x6e, 0x14, 0x1e, 0xa8, 0xa9,
+    0x84, 0x00, 0x00, 0xd9, 0xfc, 0x01, 0xcc, 0x60, 0x1e, 0x19, 0x31, 0x00, 0xea, 0x0e, 0x00, 0xe5,
+    0x48, 0x20, 0x0c, 0x36, 0x4e, 0x01, 0xd2, 0x2d, 0x10, 0x11, 0x40, 0x88, 0x11, 0xdc, 0x00, 0x73,
+    0x9f, 0xfc, 0x22, 0xf2, 0x00, 0xfe, 0x00, 0x3f, 0xfe, 0xd0, 0x70, 0x36, 0x69, 0x40, 0x42, 0xe6,
+    0x68, 0x03, 0x0d, 0xd7, 0x50, 0x80, 0x82, 0xa2, 0x17, 0x40, 0xda, 0xe6, 0x8c, 0xe6, 0xd5, 0x00,
+    0x20, 0x32, 0xdc, 0x80, 0x10, 0x19, 0x82, 0xf7, 0x63, 0x38, 0x71, 0x15, 0x4d, 0xa0, 0x00, 0x00,
+    0x46, 0xfd, 0x98, 0x02, 0x5c, 0x55, 0x34, 0x44, 0xc9, 0x95, 0x24, 0x8e, 0x1c, 0x8e, 0x58, 0xbc,
+    0x13, 0x71, 0x76, 0x00, 0x8a, 0xf4, 0xd1, 0x7c, 0x1d, 0x0a, 0x43, 0x10, 0x14, 0x01, 0xa1, 0xc6,
+    0x87, 0xb6, 0xe0, 0xc1, 0x6c, 0x6a, 0x98, 0x20, 0xbf, 0xfe, 0xdc, 0x55, 0x90, 0x00, 0xf5, 0x56,
+    0x05, 0x00, 0x69, 0x17, 0x00, 0x9c, 0x58, 0x03, 0x48, 0x48, 0x04, 0xc2, 0xc2, 0x01, 0x58, 0x40,
+    0x04, 0xa4, 0xc2, 0x01, 0x40, 0x58, 0x04, 0x00, 0x02, 0xbe, 0xe5, 0x90, 0x03, 0x11, 0x36, 0x01,
+    0x8a, 0x55, 0x10, 0x4c, 0xc2, 0xa8, 0x85, 0x13, 0x0f, 0x3b, 0xb1, 0xf8, 0x0f, 0x93, 0xb8, 0xbc,
+    0x58, 0x5e, 0x20, 0xc2, 0xde, 0x02, 0x01, 0xd4, 0x0d, 0x54, 0x60, 0x52, 0xc4, 0x4d, 0x84, 0x00,
+    0x02, 0xbe, 0xd9, 0x00, 0x0e, 0x21, 0x03, 0x58, 0x30, 0xb6, 0x69, 0xa1, 0xf8, 0x60, 0x01, 0x41,
+    0x34, 0x24, 0x91, 0xc3, 0x95, 0x47, 0xb6, 0x40, 0x21, 0x57, 0x17, 0x21, 0xcb, 0x84, 0xe9, 0xe0,
+    0x88, 0x29, 0xab, 0x56, 0x21, 0xd4, 0x56, 0x79, 0x00, 0x3e, 0x57, 0x12, 0x4e, 0x70, 0x10, 0x00,
+    0x82, 0x73, 0xb8, 0x48, 0x3e, 0x67, 0x1e, 0x4e, 0x80, 0x10, 0x0c, 0x9e, 0xc4, 0x09, 0xc2, 0x5d,
+    0x00, 0x00, 0x00, 0xf1, 0x10, 0x03, 0x25, 0xeb, 0x80, 0x17, 0x2d, 0x15, 0xc3, 0xa8, 0xa3, 0xa8,
+    0x80, 0x41, 0xd4, 0x40, 0x2c, 0x56, 0xdb, 0x50, 0x01, 0xd7, 0x32, 0x52, 0x80, 0x43, 0x3d, 0x02,
+    0x00, 0x89, 0x9e, 0x36, 0x6f, 0x2f, 0x7f, 0xf3, 0x44, 0xcf, 0x1b, 0x37, 0x94, 0x50, 0x0f, 0x47,
+    0x38, 0x80, 0x56, 0x71, 0xd2, 0x40, 0xdb, 0x6a, 0xda, 0xe0, 0x04, 0xf2, 0x0e, 0x28, 0xea, 0x09,
+    0x97, 0xb9, 0x56, 0xb0, 0x25, 0xe2, 0x80, 0x40, 0x03, 0xcf, 0xd8, 0x02, 0xc3, 0x50, 0x78, 0x50,
+    0x9a, 0xc0, 0x46, 0xe6, 0x05, 0x06, 0x11, 0x02, 0xd8, 0xc0, 0x00, 0xa8, 0xb0, 0x80, 0x0e, 0x16,
+    0x40, 0x12, 0xf3, 0x00, 0x66, 0xe6, 0x00, 0xc4, 0x24, 0x00, 0x00, 0x00, 0x8a, 0x73, 0xf6, 0x90,
+    0x03, 0x9f, 0x59, 0xd9, 0xdd, 0x74, 0x01, 0x2c, 0x27, 0x5c, 0xd6, 0xba, 0xc0, 0x02, 0xca, 0xd7,
+    0x7e, 0xbf, 0x55, 0xc9, 0x06, 0x06, 0xde, 0x98, 0x01, 0x20, 0x84, 0x0e, 0xc1, 0x6b, 0xe0, 0x03,
+    0x0f, 0xe0, 0x2e, 0x01, 0x02, 0x00, 0x84, 0xf8, 0x0b, 0x80, 0x81, 0x40, 0x02, 0x22, 0x20, 0x3b,
+    0x07, 0x34, 0x87, 0x50, 0x52, 0x0c, 0x0d, 0x8c, 0x24, 0xab, 0x51, 0x05, 0x95, 0xae, 0xf4, 0xb7,
+    0x6a, 0x80, 0x16, 0x13, 0xae, 0x27, 0x24, 0x03, 0x9f, 0x59, 0xde, 0x0e, 0x00, 0x80, 0x00, 0xb3,
+    0xfc, 0x20, 0x1c, 0x46, 0x00, 0x70, 0x0e, 0x50, 0x50, 0xd0, 0x0e, 0xb0, 0x91, 0x41, 0x00, 0x84,
+    0xc4, 0xd0, 0x1c, 0x02, 0x60, 0x40, 0xc0, 0xd0, 0x0a, 0xc1, 0xa7, 0x01, 0x04, 0x04, 0xc0, 0xd9,
+    0x40, 0x08, 0x0c, 0x0b, 0xff, 0x40, 0x70, 0x58, 0x78, 0x04, 0xc0, 0x80, 0x00, 0x4f, 0xfd, 0xac,
+    0x01, 0x89, 0x94, 0xa5, 0x40, 0x24, 0x9a, 0x80, 0xc0, 0x0f, 0x08, 0x70, 0x04, 0xaf, 0x30, 0x8c,
+    0x01, 0x1c, 0x30, 0x88, 0xc0, 0x26, 0xff, 0x4a, 0xf8, 0x07, 0x9c, 0x08, 0x02, 0x48, 0x9c, 0x04,
+    0x00, 0x89, 0xd8, 0xda, 0x80, 0x00, 0x1d, 0xf7, 0x28, 0x80, 0x26, 0xc4, 0x30, 0x5d, 0x20, 0x18,
+    0x0b, 0xde, 0x70, 0x90, 0x41, 0x54, 0x00, 0x43, 0x98, 0x68, 0x60, 0x06, 0x88, 0x00, 0x7f, 0xda,
+    0x18, 0x01, 0xa2, 0x00, 0x82, 0xa8, 0x00, 0x87, 0x30, 0x18, 0x0b, 0xde, 0x70, 0x90, 0x03, 0x5a,
+    0x18, 0x2e, 0x90, 0x00, 0x4f, 0xfb, 0xad, 0x00, 0x30, 0xa1, 0x25, 0xc0, 0x04, 0x97, 0x9a, 0x2e,
+    0x40, 0x1c, 0x52, 0x0a, 0x01, 0xe3, 0x0d, 0x00, 0xff, 0xe1, 0x98, 0x68, 0x07, 0x14, 0x82, 0x80,
+    0x12, 0xb3, 0x45, 0xc8, 0x00, 0x2a, 0x49, 0x70, 0x00, 0x4f, 0xff, 0x38, 0x00, 0x51, 0x31, 0x00,
+    0x12, 0xef, 0x28, 0x07, 0xf9, 0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc,
+    0x97, 0x79, 0x40, 0x02, 0x89, 0x88, 0x4f, 0xff, 0x20, 0x00, 0x51, 0x33, 0x80, 0x12, 0xef, 0x18,
+    0x07, 0xf9, 0x2a, 0xb0, 0x04, 0x2a, 0xb8, 0x02, 0x5f, 0xfc, 0x01, 0xff, 0xcd, 0x00, 0x00, 0x1d,
+    0xf7, 0x28, 0x80, 0x25, 0xc4, 0x30, 0x5d, 0x30, 0x1b, 0x0b, 0xde, 0x80, 0xf0, 0x41, 0x54, 0x00,
+    0x3d, 0xc0, 0x68, 0x60, 0x01, 0xe3, 0x30, 0x01, 0xe9, 0x77, 0x87, 0x43, 0x00, 0x1d, 0xe2, 0x02,
+    0x82, 0xa8, 0x00, 0x71, 0x40, 0x18, 0x0b, 0xdd, 0x40, 0x48, 0x01, 0xb1, 0x0c, 0xcb, 0xa4, 0x00,
+    0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x3f, 0xfa, 0x29, 0x77, 0x48, 0x06, 0x14, 0x48, 0xc0, 0x32, 0xff,
+    0xd4, 0x01, 0xff, 0xd1, 0x00, 0x4f, 0xa0, 0x0f, 0xfe, 0x78, 0x00, 0xcb, 0xf2, 0x01, 0xff, 0xd7,
+    0x7c, 0x20, 0x0d, 0xe6, 0x81, 0xa0, 0x36, 0x13, 0x8e, 0x16, 0x74, 0x46, 0x54, 0x60, 0x4f, 0xa0,
+    0x00, 0xf7, 0xa8, 0x07, 0x68, 0xba, 0x80, 0x69, 0x34, 0x80, 0x0c, 0xcc, 0x2b, 0x00, 0xcf, 0x21,
+    0x60, 0x1c, 0x40, 0x08, 0x00, 0xf5, 0xb0, 0xc8, 0x06, 0x54, 0x81, 0x63, 0x00, 0xe1, 0xb0, 0xe0,
+    0x0f, 0x2a, 0x14, 0x00, 0x4f, 0xa0, 0x0f, 0xff, 0x5a, 0x5d, 0xd4, 0x00, 0x14, 0x49, 0x40, 0x4f,
+    0xf5, 0x80, 0x43, 0xfe, 0xe0, 0x09, 0x04, 0x00, 0xc0, 0x1f, 0x38, 0x02, 0xc0, 0x39, 0x03, 0x40,
+    0x4d, 0x00, 0x31, 0x11, 0x05, 0xc3, 0x40, 0x39, 0x41, 0x34, 0x1c, 0x03, 0xa8, 0x3d, 0x0c, 0x40,
+    0x38, 0x88, 0xa1, 0x60, 0x1f, 0x50, 0x01, 0x80, 0x3e, 0x50, 0x31, 0x00, 0x80, 0x4f, 0xf0, 0x80,
+    0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09, 0x80, 0x3d, 0x03,
+    0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x62, 0x30, 0x0f, 0xb8, 0x03, 0xf1, 0xa8, 0x00, 0x00, 0x1d,
+    0xf6, 0xd0, 0x80, 0x4b, 0x88, 0x66, 0x5f, 0x20, 0x1b, 0x0b, 0xde, 0x71, 0x90, 0x41, 0x54, 0x00,
+    0x40, 0xa0, 0xe8, 0x68, 0x06, 0x50, 0x20, 0x00, 0x80, 0x7d, 0xa1, 0x80, 0x19, 0x40, 0x90, 0x55,
+    0x00, 0x10, 0x28, 0x22, 0x80, 0xbd, 0xe7, 0x19, 0x00, 0x36, 0x21, 0x82, 0xf9, 0x00, 0x4f, 0xfd,
+    0xac, 0x01, 0x0a, 0x99, 0x4a, 0x80, 0x12, 0xb2, 0x83, 0x80, 0x39, 0x01, 0x80, 0x30, 0xc0, 0x38,
+    0x01, 0x7f, 0x98, 0x20, 0x00, 0x2a, 0xa8, 0xe2, 0x00, 0x25, 0x51, 0xc4, 0x03, 0xff, 0x8a, 0x00,
+    0x00, 0x1d, 0xf6, 0xd0, 0x80, 0x4b, 0x88, 0x66, 0x5f, 0x20, 0x1b, 0x0b, 0xde, 0x71, 0x90, 0x41,
+    0x54, 0x00, 0x40, 0xa0, 0xe8, 0x68, 0x06, 0x50, 0x20, 0x00, 0x80, 0x7d, 0xa1, 0x80, 0xae, 0x0a,
+    0x06, 0x82, 0xa8, 0xd1, 0x82, 0x80, 0x30, 0x17, 0xc0, 0x63, 0x40, 0x06, 0xc4, 0x31, 0x21, 0x20,
+    0x08, 0xef, 0xb9, 0xb0, 0xa0, 0x00, 0x4f, 0xfd, 0xac, 0x01, 0x85, 0x50, 0xa5, 0x80, 0x24, 0xab,
+    0xb0, 0x50, 0x07, 0x94, 0x08, 0x03, 0x86, 0x41, 0x00, 0x25, 0xfe, 0x71, 0x80, 0x08, 0x98, 0xc2,
+    0x48, 0x02, 0x79, 0xe0, 0x90, 0x0f, 0x12, 0x8b, 0x00, 0x7a, 0x42, 0x00, 0x01, 0xae, 0xfc, 0x50,
+    0x0b, 0x14, 0xd0, 0xe9, 0x01, 0x08, 0xf6, 0xe8, 0x38, 0x02, 0x23, 0x05, 0xeb, 0x04, 0x40, 0xe7,
+    0x52, 0x88, 0x02, 0xe9, 0x41, 0x6d, 0xc0, 0x95, 0xeb, 0xa8, 0x20, 0x12, 0xa4, 0x00, 0xe0, 0x20,
+    0xe2, 0x9d, 0x7a, 0x0c, 0x03, 0x8a, 0x08, 0x51, 0x00, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44,
+    0xa2, 0xec, 0x41, 0x57, 0x60, 0x0f, 0xff, 0x60, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0x66,
+    0x01, 0x08, 0x0a, 0x82, 0x08, 0x02, 0x80, 0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b,
+    0x00, 0xcf, 0x50, 0x08, 0xbf, 0x82, 0xc3, 0xc0, 0x25, 0x07, 0x06, 0x05, 0x00, 0xb0, 0x34, 0x04,
+    0xc1, 0x00, 0x50, 0x10, 0x01, 0x61, 0xa0, 0x80, 0xa0, 0x13, 0x03, 0x87, 0x87, 0x80, 0x42, 0x62,
+    0x48, 0x0a, 0x01, 0xac, 0x20, 0x54, 0x03, 0x94, 0x14, 0x3c, 0x03, 0x88, 0xc0, 0x0a, 0x01, 0x00,
+    0xdf, 0x30, 0x05, 0x7c, 0x80, 0x13, 0xf1, 0x41, 0x00, 0x0e, 0x08, 0x00, 0xc0, 0x4c, 0x0c, 0x01,
+    0x20, 0x21, 0x03, 0x0c, 0x50, 0x50, 0x40, 0x40, 0x50, 0x40, 0x41, 0x31, 0x2c, 0x0f, 0x0c, 0x30,
+    0x30, 0x02, 0x03, 0xa8, 0xa0, 0x9a, 0x82, 0x00, 0x30, 0x30, 0xd0, 0x15, 0x3c, 0x2c, 0x00, 0x80,
+    0xe1, 0x81, 0x80, 0xe0, 0x60, 0x11, 0x88, 0x20, 0x20, 0x0a, 0x00, 0x64, 0x01, 0x20, 0x30, 0x06,
+    0x00, 0x00, 0x4f, 0xd0, 0x0b, 0x3d, 0x91, 0x4a, 0x01, 0x8c, 0xcc, 0x16, 0x0e, 0x70, 0x1c, 0x00,
+    0x19, 0x0c, 0x18, 0x20, 0x09, 0x8c, 0x09, 0xc0, 0x38, 0x80, 0x88, 0x01, 0xa4, 0x48, 0x24, 0x02,
+    0x46, 0x2d, 0x34, 0x50, 0x05, 0x07, 0x07, 0x85, 0x8c, 0x8b, 0x18, 0x1b, 0x0d, 0x80, 0xaf, 0x80,
+    0x0a, 0x7e, 0xa0, 0x1c, 0x80, 0x58, 0x2c, 0x9c, 0x20, 0x20, 0x1c, 0x42, 0x05, 0x51, 0x86, 0x00,
+    0x28, 0x0b, 0x08, 0x00, 0xcc, 0x40, 0x4c, 0x01, 0xd4, 0x14, 0x01, 0xe1, 0x00, 0xff, 0xe5, 0x80,
+    0x8f, 0xff, 0x6e, 0x91, 0x30, 0x80, 0xad, 0xdd, 0x22, 0x1c, 0x01, 0xbc, 0x24, 0x80, 0x2a, 0x25,
+    0x60, 0x09, 0x94, 0xa8, 0x02, 0x39, 0x0f, 0x00, 0xdc, 0x14, 0x40, 0x14, 0x90, 0x75, 0xdd, 0x46,
+    0x00, 0x44, 0xe0, 0x2f, 0xf6, 0x80, 0x0a, 0xc0, 0x0c, 0xc0, 0x0f, 0xfe, 0x93, 0x30, 0x00, 0x56,
+    0x00, 0x75, 0x00, 0xb2, 0xc0, 0x2c, 0x12, 0x00, 0x28, 0x28, 0x00, 0x87, 0x00, 0x24, 0x40, 0x05,
+    0x80, 0x60, 0x07, 0x0b, 0x00, 0x09, 0x20, 0x04, 0x86, 0x01, 0x60, 0x20, 0x01, 0x03, 0x40, 0x8f,
+    0xf3, 0xe2, 0x00, 0x13, 0x40, 0x3f, 0xfa, 0x49, 0xa0, 0x0c, 0x40, 0x00, 0x01, 0xff, 0x08, 0x01,
+    0x88, 0x92, 0x00, 0x9b, 0xb3, 0x03, 0x83, 0x30, 0x1c, 0x22, 0xf0, 0x6e, 0xf8, 0xaa, 0xbc, 0x40,
+    0x00, 0xc7, 0xf0, 0x07, 0x4e, 0x20, 0x05, 0xdf, 0xe7, 0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40,
+    0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26, 0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x00, 0x5f,
+    0x80, 0x0f, 0xfe, 0x58, 0xdf, 0xe1, 0x00, 0x4c, 0x08, 0x7e, 0x01, 0x25, 0xd8, 0xc9, 0x00, 0x06,
+    0x00, 0x40, 0x10, 0x01, 0x80, 0x10, 0x04, 0x00, 0x97, 0x63, 0x24, 0x00, 0x38, 0x21, 0xf8, 0x00,
+    0x02, 0xbf, 0xd7, 0x01, 0xc4, 0x50, 0x87, 0x61, 0x7a, 0xc4, 0xfe, 0x0d, 0x01, 0xb8, 0xe0, 0xd0,
+    0x1b, 0x96, 0x07, 0x9c, 0x4e, 0x1c, 0x46, 0x08, 0x70, 0x00, 0xec, 0xf1, 0x00, 0xff, 0xe2, 0xa6,
+    0xf4, 0x80, 0x45, 0x64, 0xea, 0x60, 0x05, 0x07, 0x9c, 0x00, 0xb8, 0x34, 0x00, 0x80, 0x0e, 0x0d,
+    0x00, 0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x75, 0x40, 0x00, 0x02, 0xbf, 0xd5, 0x01, 0xc5,
+    0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0, 0x8c, 0xc4, 0x4b, 0x04, 0xdc, 0xc7,
+    0x8e, 0x2b, 0xa3, 0xc0, 0x02, 0xcf, 0x80, 0xb3, 0x4c, 0x03, 0x08, 0x4e, 0x50, 0xc8, 0x92, 0x06,
+    0xc7, 0x70, 0x5a, 0x00, 0x7f, 0xf2, 0x00, 0x04, 0xde, 0x9c, 0xf1, 0x15, 0x9c, 0x99, 0x80, 0x0c,
+    0x12, 0xf4, 0x20, 0x0e, 0x02, 0x00, 0x28, 0x03, 0x83, 0x40, 0x08, 0x00, 0x50, 0x79, 0xc0, 0x08,
+    0xac, 0x9d, 0x4c, 0x02, 0x7f, 0xe9, 0x20, 0x11, 0x66, 0x1e, 0x85, 0x00, 0x6c, 0xa1, 0x16, 0x80,
+    0x5f, 0x80, 0x0f, 0xfe, 0x40, 0xd7, 0xe1, 0x00, 0x19, 0x82, 0x72, 0x00, 0x4c, 0xf0, 0x50, 0x01,
+    0x80, 0x88, 0x03, 0xff, 0x94, 0x00, 0x3e, 0x60, 0x08, 0xf9, 0x97, 0xe0, 0x03, 0xff, 0x8c, 0x00,
+    0x03, 0xe6, 0x00, 0xe3, 0xe6, 0x05, 0xf8, 0x00, 0xff, 0xe8, 0x1c, 0x87, 0x21, 0xa3, 0x00, 0x5f,
+    0x80, 0x0f, 0xfe, 0x6c, 0x7d, 0x00, 0x66, 0x73, 0xa0, 0x09, 0x24, 0xb4, 0x03, 0x18, 0x08, 0x80,
+    0x31, 0xa1, 0xb8, 0x06, 0x4a, 0x18, 0x30, 0x0c, 0x34, 0x1c, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x78,
+    0x5f, 0x7a, 0xea, 0x1a, 0xec, 0x10, 0x04, 0x88, 0x2f, 0x89, 0x9a, 0xc0, 0x09, 0x74, 0x05, 0x7e,
+    0x0c, 0x00, 0x20, 0x60, 0x60, 0x20, 0x10, 0x0f, 0xfe, 0xa8, 0x5f, 0x8a, 0xfc, 0x20, 0x03, 0xb0,
+    0x9c, 0x80, 0x13, 0x3c, 0x14, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x00, 0x02, 0xbf, 0xd8, 0x00,
+    0x0e, 0x22, 0x8b, 0xc0, 0x30, 0xbd, 0x60, 0x38, 0x70, 0x68, 0x00, 0xc0, 0xb8, 0x34, 0x00, 0x60,
+    0x4c, 0x2f, 0x38, 0x0c, 0x03, 0xa8, 0xc2, 0xf2, 0x00, 0x5f, 0x9b, 0xfc, 0x20, 0x09, 0x81, 0x0f,
+    0xc0, 0x24, 0xbb, 0x19, 0x20, 0x00, 0xc0, 0x08, 0x02, 0x00, 0x30, 0x02, 0x00, 0x80, 0x12, 0xec,
+    0x64, 0x80, 0x06, 0x04, 0x3f, 0x00, 0x86, 0xff, 0x08, 0x03, 0xff, 0x8a, 0x00, 0x04, 0xde, 0xac,
+    0xf1, 0x2b, 0x39, 0x03, 0x00, 0x28, 0x33, 0xd0, 0x80, 0x38, 0x34, 0x00, 0xa0, 0x0e, 0x0d, 0x00,
+    0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x74, 0x30, 0x09, 0x37, 0xa0, 0x03, 0xff, 0x8e, 0x00,
+    0x5f, 0x9d, 0xa0, 0x03, 0x0e, 0x00, 0x0f, 0x18, 0x00, 0x80, 0x1f, 0xfc, 0x50, 0x08, 0xef, 0xc4,
+    0x05, 0x72, 0x82, 0xb1, 0x30, 0x74, 0xdb, 0x06, 0x62, 0x66, 0x38, 0x4f, 0x37, 0x0d, 0x51, 0x6b,
+    0x90, 0x41, 0xda, 0x06, 0x02, 0x4c, 0x05, 0x71, 0x00, 0x74, 0x18, 0x72, 0x06, 0xc4, 0x90, 0x36,
+    0x3b, 0x05, 0xa0, 0x07, 0xfc, 0x21, 0x08, 0x12, 0x4b, 0x80, 0x5f, 0x80, 0x07, 0x70, 0x03, 0xff,
+    0x92, 0x20, 0x60, 0x42, 0x0a, 0x09, 0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0xbf, 0x20, 0x07, 0xf0,
+    0x68, 0x50, 0x20, 0x38, 0x38, 0x28, 0x68, 0x50, 0x0a, 0x91, 0x1c, 0x4c, 0x01, 0xe1, 0x02, 0xc0,
+    0x12, 0x82, 0x85, 0x00, 0x66, 0x02, 0x20, 0x00, 0xcf, 0x20, 0xaf, 0x40, 0x8f, 0x6b, 0x04, 0x04,
+    0x0c, 0x04, 0x07, 0x50, 0xc2, 0x11, 0x20, 0x19, 0x09, 0x0a, 0x20, 0x24, 0xd4, 0x14, 0x00, 0xe3,
+    0x46, 0xa1, 0x21, 0x60, 0x0d, 0x03, 0xb2, 0x21, 0x89, 0x80, 0x10, 0x00, 0x80, 0x80, 0x80, 0x00,
+    0x7f, 0x90, 0x8f, 0x77, 0x1b, 0x2b, 0x9b, 0x87, 0x05, 0x07, 0x00, 0x09, 0x01, 0x08, 0x00, 0x88,
+    0x04, 0x40, 0x02, 0x43, 0x02, 0x42, 0x4a, 0x0e, 0x0a, 0x40, 0xbf, 0x20, 0x07, 0xf0, 0x68, 0x28,
+    0x20, 0x38, 0x30, 0x58, 0x68, 0x50, 0x01, 0x4c, 0x9c, 0x8c, 0x01, 0xc1, 0x62, 0xa0, 0x12, 0x0b,
+    0x05, 0x00, 0x67, 0x03, 0x20, 0x0d, 0xc1, 0x60, 0x10, 0xc4, 0x8b, 0x00, 0x46, 0xe7, 0x62, 0x01,
+    0x00, 0x6f, 0xfe, 0x25, 0x77, 0x28, 0x09, 0x9a, 0x20, 0xc1, 0x42, 0x00, 0xa3, 0x94, 0x00, 0x32,
+    0xa9, 0x80, 0x07, 0x20, 0x51, 0x01, 0x50, 0x03, 0xbc, 0x60, 0x00, 0xc2, 0x01, 0x16, 0xf2, 0x00,
+    0x20, 0x99, 0x40, 0x0e, 0x12, 0x20, 0x1f, 0x88, 0x40, 0x07, 0xe1, 0x20, 0x18, 0x4c, 0x00, 0x78,
+    0x32, 0x01, 0x19, 0x10, 0x03, 0xfc, 0xc0, 0xc0, 0x17, 0x84, 0xa0, 0x01, 0x3a, 0xd4, 0x8d, 0x12,
+    0x21, 0x80, 0x7f, 0xf7, 0x80, 0x10, 0x0d, 0x3f, 0x60, 0x0b, 0x44, 0x28, 0x1f, 0x06, 0x80, 0x04,
+    0x04, 0x00, 0xe0, 0xa0, 0x03, 0x3b, 0x40, 0x08, 0x04, 0x04, 0xe5, 0xa0, 0xc0, 0x84, 0x01, 0x08,
+    0x0f, 0x07, 0x04, 0xa9, 0x38, 0x56, 0x68, 0x80, 0x00, 0xf0, 0x80, 0x23, 0xfd, 0x07, 0xd2, 0x0e,
+    0xb0, 0xd8, 0x14, 0x17, 0x67, 0xec, 0xe3, 0x00, 0x00, 0x3e, 0x67, 0x1e, 0x4e, 0x82, 0xa5, 0x64,
+    0x20, 0x07, 0x80, 0x42, 0x02, 0x01, 0x18, 0x18, 0x00, 0xa8, 0x40, 0x33, 0x3c, 0x10, 0x03, 0x24,
+    0x9b, 0x4d, 0x4d, 0x16, 0x82, 0x34, 0x38, 0x13, 0xa8, 0x03, 0xed, 0x0e, 0x04, 0xea, 0x53, 0x45,
+    0xa0, 0xf0, 0xc9, 0x25, 0xc4, 0x00, 0x33, 0xd9, 0x80, 0x00, 0x2e, 0xfe, 0x18, 0x01, 0x28, 0x90,
+    0xf4, 0x43, 0x82, 0xec, 0xe2, 0x80, 0xc0, 0xa1, 0x34, 0xe8, 0x41, 0x0e, 0x6a, 0x5a, 0x20, 0xd0,
+    0xc0, 0x09, 0x50, 0xcf, 0x40, 0x0e, 0x10, 0x15, 0x36, 0x51, 0xb9, 0xda, 0x4f, 0x01, 0x66, 0x19,
+    0x98, 0x00, 0xfe, 0x1e, 0x7b, 0xfe, 0x8a, 0xa0, 0xbc, 0x15, 0xd9, 0x55, 0x20, 0xaf, 0x28, 0xb8,
+    0x2c, 0x07, 0x40, 0x10, 0xbe, 0x00, 0x7f, 0x8e, 0x80, 0x21, 0x7c, 0x07, 0x74, 0xa2, 0xe0, 0x80,
+    0xbd, 0x15, 0xd9, 0x5f, 0x47, 0x16, 0xff, 0xa2, 0x20, 0xbf, 0x30, 0x1f, 0xd0, 0xe0, 0xa0, 0x60,
+    0xa0, 0x51, 0x70, 0xa0, 0x70, 0x04, 0x8c, 0x13, 0x00, 0x4c, 0x0e, 0x16, 0x00, 0x6e, 0x00, 0xb5,
+    0x41, 0xf6, 0x01, 0xf5, 0x41, 0xf6, 0x01, 0xf5, 0x41, 0xf6, 0x01, 0xf5, 0x40, 0x48, 0x43, 0xc8,
+    0x00, 0x00, 0xcd, 0x00, 0xf5, 0x5b, 0x30, 0x01, 0x9a, 0x01, 0xea, 0xb0, 0x04, 0xdf, 0xc3, 0x00,
+    0x59, 0xa9, 0xe8, 0x10, 0x3d, 0x5c, 0x81, 0x1b, 0x53, 0xb8, 0x08, 0x44, 0xb9, 0x62, 0xa5, 0xda,
+    0x88, 0x63, 0x07, 0x2b, 0x02, 0x4b, 0xae, 0xc6, 0x50, 0x4d, 0xa2, 0x60, 0x4e, 0x85, 0x40, 0x24,
+    0x37, 0xe5, 0x32, 0x0d, 0x97, 0x9c, 0x00, 0x00, 0xf3, 0x71, 0xc7, 0x08, 0x06, 0x30, 0x00, 0x00,
+    0x96, 0xfb, 0x64, 0x40, 0x34, 0xd3, 0x3b, 0x9b, 0xcc, 0x00, 0xac, 0xee, 0x64, 0x83, 0xd0, 0x04,
+    0x9f, 0xa4, 0xbc, 0x40, 0x54, 0x0d, 0x31, 0xda, 0x79, 0x47, 0x00, 0x22, 0x73, 0x6f, 0x10, 0x08,
+    0xd2, 0x0b, 0x25, 0x88, 0x70, 0x24, 0xe7, 0x37, 0xa7, 0x89, 0x41, 0x59, 0xf6, 0xed, 0xc7, 0xc0,
+    0x14, 0xd3, 0x3b, 0x9b, 0xcc, 0x00, 0x0a, 0xfe, 0x90, 0x46, 0xc6, 0x61, 0xb3, 0x39, 0x40, 0x10,
+    0x98, 0xa0, 0x0e, 0x3f, 0x20, 0x00, 0x00, 0x57, 0xb5, 0xfa, 0x84, 0x2b, 0x72, 0x3a, 0xa9, 0xcf,
+    0x1c, 0xe0, 0x1c, 0x48, 0x40, 0x84, 0x0a, 0x86, 0x28, 0x74, 0x00, 0x92, 0xe1, 0x2e, 0xa0, 0x68,
+    0x8e, 0x0c, 0x77, 0xe0, 0xaf, 0xf9, 0xc0, 0x3d, 0x90, 0x00, 0x00, 0x3e, 0xf5, 0x08, 0x02, 0xb7,
+    0xfd, 0xb8, 0x06, 0xf3, 0x9a, 0x8b, 0x08, 0xa0, 0xb5, 0x4b, 0x30, 0x09, 0x27, 0x00, 0x08, 0xae,
+    0xb1, 0xb6, 0x66, 0x7e, 0x86, 0xf5, 0x80, 0xa2, 0xff, 0x6e, 0x00, 0x00, 0xe4, 0xff, 0x95, 0x33,
+    0x24, 0x00, 0x00, 0xfa, 0x7f, 0x90, 0x11, 0xa5, 0xe8, 0x04, 0x17, 0x84, 0x15, 0x32, 0x20, 0x00,
+    0xbd, 0xe7, 0x00, 0x00, 0x47, 0x80, 0x4e, 0xe4, 0x08, 0x73, 0x88, 0x18, 0x3c, 0x27, 0xf9, 0xc3,
+    0xfc, 0xe0, 0x0f, 0x20, 0x0a, 0x21, 0xeb, 0x10, 0x47, 0x7f, 0x18, 0x1b, 0xfb, 0x36, 0x66, 0xb4,
+    0xbe, 0xa1, 0x70, 0xdc, 0x5a, 0xca, 0x0d, 0xd0, 0x1a, 0xec, 0x45, 0x0c, 0x0e, 0x4a, 0xc3, 0xe6,
+    0xcc, 0x24, 0xbb, 0xb5, 0xe0, 0x00, 0xeb, 0xe1, 0x34, 0xd1, 0x00, 0x5f, 0x80, 0x07, 0x70, 0x03,
+    0xff, 0x9e, 0x40, 0x22, 0x00, 0xcb, 0x3a, 0x02, 0xc0, 0x04, 0x77, 0x50, 0xd0, 0x00, 0xfa, 0xd7,
+    0xb0, 0x03, 0xff, 0x88, 0x00, 0x05, 0xdf, 0xfa, 0xce, 0x88, 0x1c, 0x42, 0x80, 0x28, 0x20, 0x0f,
+    0xde, 0x01, 0xe6, 0x60, 0x07, 0xa7, 0xb0, 0x03, 0x84, 0xc0, 0x3f, 0xf8, 0xa0, 0x01, 0x04, 0xe7,
+    0x70, 0x90, 0x01, 0x03, 0xa0, 0x22, 0x53, 0x2f, 0x80, 0x4d, 0xfc, 0x70, 0x8c, 0x00, 0xf8, 0x09,
+    0xee, 0x48, 0x3b, 0x44, 0x1a, 0x34, 0x59, 0x84, 0x7a, 0x2e, 0xc4, 0x6e, 0xd3, 0x0d, 0x00, 0x5f,
+    0xb6, 0xfb, 0x00, 0x2b, 0xa7, 0x3a, 0x40, 0x02, 0x11, 0xf8, 0xdd, 0x40, 0x54, 0x08, 0x80, 0xe1,
+    0xa3, 0x50, 0x36, 0x4a, 0xf2, 0x0f, 0x28, 0x00, 0x04, 0x40, 0x06, 0x53, 0x08, 0xbf, 0x00, 0x92,
+    0x84, 0x2d, 0xc0, 0x21, 0xa9, 0x20, 0x30, 0x0d, 0x6a, 0xc0, 0x1e, 0x54, 0xa0, 0x10, 0x0c, 0x35,
+    0x63, 0x7c, 0x81, 0x17, 0x4a, 0xa7, 0x70, 0x06, 0x65, 0xb3, 0x9d, 0x00, 0x8a, 0x68, 0x6c, 0x78,
+    0x28, 0x39, 0x90, 0x23, 0xfc, 0x14, 0x1b, 0x20, 0x1d, 0xc8, 0x00, 0x01, 0x10, 0x06, 0x11, 0x00,
+    0x1b, 0xa8, 0x02, 0x2e, 0x50, 0x09, 0x40, 0x37, 0xba, 0x00, 0x18, 0x80, 0x28, 0x08, 0x00, 0xf9,
+    0x1f, 0xc0, 0x3e, 0x1a, 0x93, 0xbd, 0x80, 0x04, 0x55, 0xab, 0x40, 0x73, 0x90, 0x01, 0x11, 0x41,
+    0x36, 0x84, 0x40, 0x2a, 0xb1, 0x01, 0xab, 0xc0, 0x07, 0x32, 0x80, 0x21, 0x4b, 0xcc, 0x36, 0x40,
+    0x28, 0xef, 0xf1, 0x80, 0x19, 0xd9, 0x00, 0xd8, 0xe0, 0x05, 0x0c, 0x64, 0x00, 0x38, 0xb8, 0x01,
+    0x24, 0x00, 0xe0, 0x51, 0x20, 0x18, 0x7c, 0xcc, 0x1c, 0xc8, 0x01, 0x34, 0x71, 0x3b, 0x8a, 0x40,
+    0x32, 0x3f, 0x99, 0x45, 0x04, 0x7b, 0x01, 0x77, 0x37, 0x95, 0x10, 0xc2, 0x01, 0x85, 0x96, 0xc6,
+    0xb4, 0x80, 0x30, 0xc5, 0x8a, 0x0e, 0x1c, 0x80, 0x56, 0xaa, 0x05, 0xff, 0x1c, 0x80, 0x57, 0x60,
+    0x0e, 0xd6, 0x00, 0x00, 0xb6, 0x40, 0x30, 0x92, 0x80, 0x61, 0xec, 0x00, 0xee, 0xb0, 0x0d, 0x20,
+    0x60, 0x15, 0x32, 0xc0, 0x00, 0xd5, 0x54, 0x02, 0x4a, 0x1a, 0x03, 0xde, 0x81, 0x15, 0x81, 0x45,
+    0x66, 0xa1, 0x0e, 0x00, 0x00, 0x17, 0xc8, 0x07, 0xc5, 0x4c, 0x40, 0x1f, 0x2f, 0x90, 0x07, 0xd9,
+    0xfe, 0x10, 0x0e, 0x23, 0x00, 0x38, 0x07, 0x28, 0x28, 0x68, 0x07, 0x58, 0x48, 0xa0, 0x80, 0x42,
+    0x62, 0x68, 0x0e, 0x01, 0x30, 0x20, 0x60, 0x68, 0x05, 0x60, 0xd3, 0x80, 0x82, 0x02, 0x60, 0x6c,
+    0xa0, 0x04, 0x06, 0x05, 0xff, 0xa0, 0x38, 0x2c, 0x3c, 0x02, 0x60, 0x40, 0x00, 0x00, 0xc9, 0xec,
+    0x01, 0xf4, 0xab, 0x00, 0x7d, 0xb4, 0x01, 0xf6, 0x7f, 0x84, 0x03, 0x88, 0xc0, 0x0e, 0x01, 0xca,
+    0x0a, 0x1a, 0x01, 0xd6, 0x12, 0x28, 0x20, 0x10, 0x98, 0x9a, 0x03, 0x80, 0x4c, 0x08, 0x18, 0x1a,
+    0x01, 0x58, 0x34, 0xe0, 0x20, 0x80, 0x98, 0x1b, 0x28, 0x01, 0x01, 0x81, 0x7f, 0xe8, 0x0e, 0x0b,
+    0x0f, 0x00, 0x98, 0x10, 0x00, 0x00, 0x89, 0xd0, 0x03, 0xef, 0xcb, 0x30, 0x0e, 0x3a, 0xba, 0x50,
+    0x0e, 0x3b, 0xfa, 0x70, 0x0e, 0x23, 0x00, 0x38, 0x07, 0x28, 0x28, 0x68, 0x07, 0x58, 0x48, 0xa0,
+    0x80, 0x42, 0x62, 0x68, 0x0e, 0x01, 0x30, 0x20, 0x60, 0x68, 0x05, 0x60, 0xd3, 0x80, 0x82, 0x02,
+    0x60, 0x6c, 0xa0, 0x04, 0x06, 0x05, 0xff, 0xa0, 0x38, 0x2c, 0x3c, 0x02, 0x60, 0x40, 0x00, 0x00,
+    0x1e, 0xf7, 0xc0, 0x07, 0x17, 0xfb, 0xa0, 0x03, 0x87, 0xba, 0x10, 0x0e, 0x23, 0x00, 0x38, 0x07,
+    0x28, 0x28, 0x68, 0x07, 0x58, 0x48, 0xa0, 0x80, 0x42, 0x62, 0x68, 0x0e, 0x01, 0x30, 0x20, 0x60,
+    0x68, 0x05, 0x60, 0xd3, 0x80, 0x82, 0x02, 0x60, 0x6c, 0xa0, 0x04, 0x06, 0x05, 0xff, 0xa0, 0x38,
+    0x2c, 0x3c, 0x02, 0x60, 0x40, 0x00, 0x00, 0x46, 0x8d, 0x60, 0x07, 0x8c, 0x04, 0x03, 0xd1, 0xc3,
+    0x78, 0x01, 0xec, 0xff, 0x08, 0x07, 0x11, 0x80, 0x1c, 0x03, 0x94, 0x14, 0x34, 0x03, 0xac, 0x24,
+    0x50, 0x40, 0x21, 0x31, 0x34, 0x07, 0x00, 0x98, 0x10, 0x30, 0x34, 0x02, 0xb0, 0x69, 0xc0, 0x41,
+    0x01, 0x30, 0x36, 0x50, 0x02, 0x03, 0x02, 0xff, 0xd0, 0x1c, 0x16, 0x1e, 0x01, 0x30, 0x20, 0x00,
+    0x00, 0x97, 0x24, 0x03, 0xe8, 0xe4, 0x20, 0x0f, 0x47, 0xa1, 0x00, 0x7a, 0x49, 0x84, 0x03, 0x88,
+    0xc0, 0x0e, 0x01, 0xca, 0x0a, 0x1a, 0x01, 0xd6, 0x12, 0x28, 0x20, 0x10, 0x98, 0x9a, 0x03, 0x80,
+    0x4c, 0x08, 0x18, 0x1a, 0x01, 0x58, 0x34, 0xe0, 0x20, 0x80, 0x98, 0x1b, 0x28, 0x01, 0x01, 0x81,
+    0x7f, 0xe8, 0x0e, 0x0b, 0x0f, 0x00, 0x98, 0x10, 0x00, 0x00, 0x8b, 0xff, 0xf6, 0x00, 0x56, 0x06,
+    0x00, 0x44, 0xca, 0x01, 0x38, 0xe0, 0x85, 0xde, 0x90, 0x02, 0x8b, 0x80, 0x7f, 0xa4, 0x2c, 0x02,
+    0xaa, 0xc8, 0x04, 0x66, 0x20, 0x09, 0x57, 0x10, 0x50, 0x1f, 0xf8, 0x43, 0xff, 0x30, 0x30, 0x3b,
+    0xc0, 0x1f, 0x28, 0xac, 0x44, 0x21, 0x77, 0xa3, 0x83, 0x80, 0x39, 0x13, 0x80, 0x00, 0x1d, 0xf7,
+    0x28, 0x80, 0x25, 0xc4, 0x30, 0x5d, 0x20, 0x1b, 0x0b, 0xde, 0x60, 0x90, 0x41, 0x54, 0x00, 0x4b,
+    0x10, 0x68, 0x68, 0x06, 0x99, 0x00, 0x42, 0x01, 0xf7, 0x07, 0x80, 0x68, 0x80, 0x38, 0x31, 0x80,
+    0x21, 0xd0, 0x06, 0x43, 0x31, 0xce, 0x1e, 0x00, 0x6a, 0x33, 0x0a, 0x61, 0x80, 0x4b, 0x88, 0xf6,
+    0x60, 0x1e, 0xb5, 0x40, 0x0f, 0xb0, 0x54, 0x02, 0x00, 0x00, 0x5f, 0x08, 0x07, 0x59, 0xc8, 0x07,
+    0xb6, 0x00, 0x24, 0xff, 0xf3, 0x80, 0x05, 0x13, 0x10, 0x01, 0x2e, 0xf2, 0x80, 0x7f, 0x92, 0xab,
+    0x08, 0x00, 0x55, 0x70, 0x04, 0xbf, 0xf8, 0x40, 0x3f, 0xc9, 0x77, 0x94, 0x00, 0x28, 0x98, 0x80,
+    0x00, 0xd9, 0xa0, 0x1c, 0xa7, 0xe0, 0x1c, 0xbe, 0x40, 0x04, 0xff, 0xf3, 0x80, 0x05, 0x13, 0x10,
+    0x01, 0x2e, 0xf2, 0x80, 0x7f, 0x92, 0xab, 0x08, 0x00, 0x55, 0x70, 0x04, 0xbf, 0xf8, 0x40, 0x3f,
+    0xc9, 0x77, 0x94, 0x00, 0x28, 0x98, 0x80, 0x00, 0x99, 0xc0, 0x39, 0xe2, 0xa4, 0x03, 0xb7, 0xf8,
+    0x41, 0x3e, 0x33, 0x63, 0x9c, 0x00, 0x28, 0x98, 0x80, 0x09, 0x77, 0x94, 0x03, 0xfc, 0x95, 0x58,
+    0x40, 0x02, 0xab, 0x80, 0x25, 0xff, 0xc2, 0x01, 0xfe, 0x4b, 0xbc, 0xa0, 0x01, 0x44, 0xc4, 0x00,
+    0x02, 0xe7, 0x4e, 0x40, 0x0f, 0xf1, 0x73, 0xa7, 0x20, 0x27, 0xff, 0x9c, 0x00, 0x28, 0x98, 0x80,
+    0x09, 0x77, 0x94, 0x03, 0xfc, 0x95, 0x58, 0x40, 0x02, 0xab, 0x80, 0x25, 0xff, 0xc2, 0x01, 0xfe,
+    0x4b, 0xbc, 0xa0, 0x01, 0x44, 0xc4, 0x00, 0x2f, 0x90, 0x2b, 0x62, 0x04, 0xf2, 0x04, 0xfa, 0x00,
+    0xff, 0xec, 0x00, 0x03, 0xf7, 0x0f, 0x57, 0x0c, 0xa0, 0x4f, 0xa0, 0x0f, 0xfe, 0xc8, 0x02, 0x74,
+    0x00, 0x7e, 0x59, 0x9a, 0xae, 0x94, 0xcd, 0xfe, 0x60, 0x0f, 0xff, 0x08, 0x7e, 0x1a, 0xc0, 0x0e,
+    0x10, 0x7e, 0x1a, 0xd0, 0x02, 0x7d, 0x00, 0x7f, 0xfb, 0x00, 0x0a, 0xff, 0xb6, 0x84, 0x03, 0x8d,
+    0x01, 0x78, 0x80, 0x34, 0x5e, 0xc0, 0x70, 0x07, 0xce, 0x46, 0x23, 0x00, 0x88, 0x00, 0xe0, 0xb8,
+    0x81, 0x5c, 0x80, 0x1b, 0x8c, 0x22, 0xd4, 0x1c, 0x14, 0xd8, 0x0d, 0x05, 0xc8, 0xc4, 0x02, 0x8b,
+    0xd8, 0x0f, 0x00, 0xc6, 0x80, 0xbc, 0x60, 0x00, 0x00, 0x16, 0xf7, 0xc8, 0x06, 0x2f, 0xf7, 0x48,
+    0x01, 0x3f, 0xc6, 0x22, 0x3f, 0xb0, 0x0a, 0xc0, 0x3f, 0x29, 0x80, 0x78, 0xc3, 0x80, 0x3c, 0xcc,
+    0x26, 0x00, 0xf4, 0x0c, 0xb8, 0x07, 0x0c, 0x04, 0x00, 0x79, 0x88, 0xc0, 0x3e, 0xe0, 0x0f, 0xc6,
+    0xa0, 0x00, 0x00, 0x0e, 0xe0, 0x07, 0xc3, 0xe6, 0xa0, 0x1f, 0x17, 0xa8, 0x07, 0x8e, 0xfb, 0x68,
+    0x40, 0x25, 0xc4, 0x33, 0x2f, 0x90, 0x0d, 0x85, 0xef, 0x38, 0xc8, 0x20, 0xaa, 0x00, 0x20, 0x50,
+    0x74, 0x34, 0x03, 0x28, 0x10, 0x00, 0x40, 0x3e, 0xd0, 0xc0, 0x0c, 0xa0, 0x48, 0x2a, 0x80, 0x08,
+    0x14, 0x11, 0x40, 0x5e, 0xf3, 0x8c, 0x80, 0x1b, 0x10, 0xc1, 0x7c, 0x80, 0x00, 0xc3, 0xf4, 0x01,
+    0xf4, 0x1d, 0x00, 0x7d, 0x38, 0x01, 0xe3, 0xbe, 0xda, 0x10, 0x09, 0x71, 0x0c, 0xcb, 0xe4, 0x03,
+    0x61, 0x7b, 0xce, 0x32, 0x08, 0x2a, 0x80, 0x08, 0x14, 0x1d, 0x0d, 0x00, 0xca, 0x04, 0x00, 0x10,
+    0x0f, 0xb4, 0x30, 0x03, 0x28, 0x12, 0x0a, 0xa0, 0x02, 0x05, 0x04, 0x50, 0x17, 0xbc, 0xe3, 0x20,
+    0x06, 0xc4, 0x30, 0x5f, 0x20, 0x00, 0x00, 0xce, 0xc0, 0x1f, 0x55, 0xcb, 0x00, 0x71, 0x6e, 0xac,
+    0x40, 0x38, 0x73, 0xe7, 0x44, 0x02, 0x5c, 0x43, 0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82,
+    0x0a, 0xa0, 0x02, 0x05, 0x07, 0x43, 0x40, 0x32, 0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca,
+    0x04, 0x82, 0xa8, 0x00, 0x81, 0x41, 0x14, 0x05, 0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8,
+    0x00, 0x00, 0xae, 0x8b, 0x40, 0x38, 0x9b, 0x35, 0xc0, 0x38, 0xb1, 0xbe, 0x80, 0x38, 0xeb, 0xb6,
+    0x84, 0x02, 0x5c, 0x43, 0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82, 0x0a, 0xa0, 0x02, 0x05,
+    0x07, 0x43, 0x40, 0x32, 0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca, 0x04, 0x82, 0xa8, 0x00,
+    0x81, 0x41, 0x14, 0x05, 0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8, 0x00, 0x00, 0x2f, 0x1b,
+    0xf0, 0x80, 0x7f, 0xf0, 0x97, 0x8d, 0xf8, 0x40, 0x31, 0xdf, 0x6d, 0x08, 0x04, 0xb8, 0x86, 0x65,
+    0xf2, 0x01, 0xb0, 0xbd, 0xe7, 0x19, 0x04, 0x15, 0x40, 0x04, 0x0a, 0x0e, 0x86, 0x80, 0x65, 0x02,
+    0x00, 0x08, 0x07, 0xda, 0x18, 0x01, 0x94, 0x09, 0x05, 0x50, 0x01, 0x02, 0x82, 0x28, 0x0b, 0xde,
+    0x71, 0x90, 0x03, 0x62, 0x18, 0x2f, 0x90, 0x00, 0x00, 0xfe, 0x9c, 0x00, 0x2f, 0x18, 0x09, 0xe2,
+    0xd0, 0x08, 0x43, 0x9d, 0x0e, 0x10, 0x03, 0x00, 0x0a, 0x40, 0x04, 0xb1, 0x54, 0xb0, 0x04, 0x0e,
+    0xd3, 0x22, 0x86, 0xe8, 0xc2, 0x6d, 0x40, 0x00, 0xfc, 0x20, 0x11, 0xdf, 0x72, 0x9b, 0x8c, 0x17,
+    0x10, 0xc5, 0x65, 0x0c, 0x6c, 0x2f, 0x78, 0x03, 0x20, 0xaa, 0x06, 0x88, 0x90, 0x74, 0x34, 0x28,
+    0xf5, 0x40, 0x80, 0x28, 0x5a, 0x30, 0x0b, 0x82, 0x9d, 0xca, 0x0a, 0x04, 0xe0, 0x47, 0x01, 0x02,
+    0x82, 0x02, 0x07, 0xdc, 0x71, 0x90, 0x60, 0xa3, 0x10, 0x5f, 0x20, 0x7f, 0x5c, 0xfe, 0xa1, 0x00,
+    0x00, 0x00, 0x1f, 0xb8, 0x07, 0x8e, 0x60, 0x40, 0x3c, 0xde, 0x20, 0x12, 0x7c, 0x80, 0x4d, 0xee,
+    0x01, 0xff, 0xe3, 0x30, 0x08, 0x40, 0x54, 0x10, 0x40, 0x14, 0x04, 0x2c, 0x3d, 0x9c, 0x48, 0x80,
+    0x98, 0x23, 0x33, 0xd8, 0x00, 0x00, 0xcb, 0xea, 0x01, 0xe8, 0x75, 0x00, 0xf6, 0xc0, 0x04, 0x9f,
+    0x20, 0x13, 0x7b, 0x80, 0x7f, 0xf8, 0xcc, 0x02, 0x10, 0x15, 0x04, 0x10, 0x05, 0x01, 0x0b, 0x0f,
+    0x67, 0x12, 0x20, 0x26, 0x08, 0xcc, 0xf6, 0x00, 0x00, 0x8d, 0xd0, 0x03, 0x87, 0x72, 0xc8, 0x03,
+    0x2c, 0xdc, 0xb8, 0x01, 0x3f, 0x5c, 0x18, 0xfd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08, 0x0a, 0x82,
+    0x08, 0x02, 0x80, 0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x00, 0x4e, 0x85,
+    0xd8, 0x03, 0xe7, 0x00, 0xe9, 0xd0, 0xcb, 0x00, 0x27, 0xc8, 0x04, 0xde, 0xe0, 0x1f, 0xfe, 0x33,
+    0x00, 0x84, 0x05, 0x41, 0x04, 0x01, 0x40, 0x42, 0xc3, 0xd9, 0xc4, 0x88, 0x09, 0x82, 0x33, 0x3d,
+    0x80, 0x00, 0xcd, 0xe8, 0x01, 0xe8, 0x82, 0x00, 0x7b, 0x9c, 0x02, 0xaf, 0x80, 0x0a, 0x7e, 0xa0,
+    0x1c, 0x80, 0x58, 0x2c, 0x9c, 0x20, 0x20, 0x1c, 0x42, 0x05, 0x51, 0x86, 0x00, 0x28, 0x0b, 0x08,
+    0x00, 0xcc, 0x40, 0x4c, 0x01, 0xd4, 0x14, 0x01, 0xe1, 0x00, 0xff, 0xe5, 0x80, 0x5f, 0x90, 0x0f,
+    0xfe, 0x1b, 0x7f, 0x59, 0x80, 0x46, 0xe8, 0x8c, 0x10, 0x02, 0xc5, 0x38, 0x38, 0x07, 0x78, 0x06,
+    0x58, 0xa8, 0x07, 0x00, 0x1b, 0xa2, 0x30, 0x40, 0x0d, 0xfd, 0x66, 0x01, 0xfc, 0x00, 0x03, 0xbf,
+    0xea, 0x10, 0x06, 0xa1, 0x99, 0x70, 0x0c, 0x4f, 0x34, 0x48, 0x8e, 0x0a, 0x00, 0x30, 0x20, 0x08,
+    0xac, 0xa4, 0x03, 0x3a, 0x06, 0x88, 0x04, 0xbe, 0xe9, 0x60, 0x1d, 0x60, 0xc0, 0x11, 0xce, 0x82,
+    0x80, 0x4c, 0xc0, 0x69, 0x00, 0x03, 0xf7, 0x00, 0xc7, 0x30, 0x20, 0x19, 0xbc, 0x40, 0x25, 0xdf,
+    0xe7, 0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40, 0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06,
+    0x26, 0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x00, 0x00, 0x97, 0xd4, 0x03, 0x43, 0xa8, 0x06, 0xd8, 0x00,
+    0x97, 0x7f, 0x9c, 0x0a, 0x82, 0x0e, 0x14, 0xef, 0xd5, 0x03, 0x47, 0xb3, 0x5c, 0x00, 0xea, 0xdf,
+    0x00, 0x18, 0x9a, 0xc0, 0x0c, 0xa9, 0x74, 0x00, 0x00, 0x00, 0x4f, 0xd0, 0x04, 0x8d, 0x4a, 0xc0,
+    0x05, 0xe5, 0xe4, 0x00, 0x26, 0x7f, 0x94, 0x0a, 0x82, 0x0e, 0x14, 0xef, 0xd5, 0x03, 0x47, 0xb3,
+    0x5c, 0x00, 0xea, 0xdf, 0x00, 0x18, 0x9a, 0xc0, 0x0c, 0xa9, 0x74, 0x00, 0x00, 0x02, 0xe9, 0x6a,
+    0x00, 0x2b, 0x04, 0xf8, 0x01, 0xa2, 0x79, 0x40, 0x09, 0xbf, 0xe7, 0x02, 0xa0, 0x83, 0x85, 0x3b,
+    0xf5, 0x40, 0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26, 0xb0, 0x03, 0x2a, 0x5d, 0x00,
+    0x00, 0x09, 0xd0, 0xcb, 0x00, 0xfe, 0x9d, 0x0c, 0xb0, 0x02, 0xef, 0xf3, 0x81, 0x50, 0x41, 0xc2,
+    0x9d, 0xfa, 0xa0, 0x68, 0xf6, 0x6b, 0x80, 0x1d, 0x5b, 0xe0, 0x03, 0x13, 0x58, 0x01, 0x95, 0x2e,
+    0x80, 0x00, 0x00, 0x36, 0xb8, 0x06, 0xbf, 0x90, 0x0e, 0x30, 0x0e, 0xbc, 0x90, 0x09, 0x6c, 0xa5,
+    0xc0, 0xa8, 0x20, 0xe1, 0x4e, 0xfd, 0x50, 0x34, 0x7b, 0x35, 0xc0, 0x0e, 0xad, 0xf0, 0x01, 0x89,
+    0xac, 0x00, 0xca, 0x97, 0x40, 0x00, 0x04, 0xdf, 0xc4, 0x9e, 0xd8, 0x00, 0x15, 0x9b, 0x8d, 0xb3,
+    0xb3, 0xc0, 0x1d, 0x64, 0x40, 0x1a, 0x6c, 0x9c, 0x07, 0x7f, 0xd4, 0x0d, 0xfe, 0x20, 0x16, 0x74,
+    0xc7, 0x05, 0xcc, 0x4c, 0x0f, 0x01, 0xa3, 0x02, 0xdd, 0xa7, 0x02, 0x51, 0x65, 0xfd, 0x9b, 0x50,
+    0x00, 0x02, 0xbf, 0xd7, 0x00, 0x62, 0x28, 0x43, 0xb0, 0xb5, 0x62, 0x7f, 0x83, 0x00, 0x6e, 0x04,
+    0x0c, 0x00, 0x87, 0x81, 0x42, 0xd7, 0x28, 0xc7, 0xd2, 0x30, 0x13, 0x65, 0x1e, 0x40, 0x04, 0xaa,
+    0x18, 0x06, 0xb1, 0x30, 0x00, 0x02, 0xf9, 0x00, 0xc5, 0x4c, 0x40, 0x19, 0x7c, 0x80, 0x22, 0xbf,
+    0xd5, 0x01, 0xc5, 0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0, 0x8c, 0xc4, 0x4b,
+    0x04, 0xdc, 0xc7, 0x8e, 0x2b, 0xa3, 0xc0, 0x00, 0x93, 0xdc, 0x03, 0x42, 0xb8, 0x06, 0xca, 0x00,
+    0x8a, 0xff, 0x54, 0x07, 0x15, 0x86, 0x95, 0x86, 0x27, 0x42, 0x78, 0x27, 0xf8, 0x0b, 0x82, 0x33,
+    0x11, 0x2c, 0x13, 0x73, 0x1e, 0x38, 0xae, 0x8f, 0x00, 0x00, 0x3f, 0xd8, 0x04, 0x71, 0x4a, 0xe0,
+    0x02, 0xd5, 0xf5, 0x00, 0x1c, 0xfe, 0x38, 0x0e, 0x2b, 0x0d, 0x2b, 0x0c, 0x4e, 0x84, 0xf0, 0x4f,
+    0xf0, 0x17, 0x04, 0x66, 0x22, 0x58, 0x26, 0xe6, 0x3c, 0x71, 0x5d, 0x1e, 0x00, 0x08, 0xe1, 0xac,
+    0x00, 0xfe, 0x8e, 0x1a, 0xc0, 0x01, 0x5f, 0xea, 0x80, 0xe2, 0xb0, 0xd2, 0xb0, 0xc4, 0xe8, 0x4f,
+    0x04, 0xff, 0x01, 0x70, 0x46, 0x62, 0x25, 0x82, 0x6e, 0x63, 0xc7, 0x15, 0xd1, 0xe0, 0x3f, 0x80,
+    0x39, 0x71, 0x06, 0xf1, 0x05, 0xf8, 0x00, 0xff, 0xe6, 0x00, 0x05, 0xf6, 0x08, 0x66, 0x06, 0xc8,
+    0x2f, 0xc0, 0x07, 0xff, 0x34, 0x08, 0xfb, 0x04, 0x7b, 0x57, 0x4f, 0x4e, 0x70, 0x5f, 0x80, 0x0f,
+    0xfe, 0x98, 0x8d, 0x0b, 0xb0, 0x08, 0x04, 0xe1, 0x3a, 0x17, 0x80, 0x05, 0xf8, 0x00, 0xff, 0xed,
+    0x00, 0x02, 0x20, 0x00, 0x40, 0x26, 0xda, 0xa8, 0x02, 0x55, 0xd2, 0x01, 0x26, 0x79, 0xf8, 0x04,
+    0x37, 0xcc, 0x50, 0x03, 0x61, 0x44, 0x0c, 0x0c, 0x16, 0x90, 0x42, 0x1c, 0x0a, 0x00, 0x60, 0x07,
+    0x02, 0x00, 0x14, 0x41, 0x82, 0x21, 0x63, 0x00, 0x38, 0x8e, 0xd0, 0xc0, 0x00, 0x00, 0x6d, 0x97,
+    0x00, 0x0c, 0x77, 0x4e, 0x00, 0x3d, 0x6f, 0x90, 0x5f, 0x9a, 0xfc, 0x20, 0x03, 0xb0, 0x9c, 0x80,
+    0x13, 0x3c, 0x14, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x00, 0x01, 0xeb, 0x00, 0xe1, 0xd4, 0x30,
+    0x0e, 0x3f, 0x30, 0x0c, 0x57, 0xfb, 0x00, 0x01, 0xc4, 0x51, 0x78, 0x06, 0x17, 0xac, 0x07, 0x0e,
+    0x0d, 0x00, 0x18, 0x17, 0x06, 0x80, 0x0c, 0x09, 0x85, 0xe7, 0x01, 0x80, 0x75, 0x18, 0x5e, 0x40,
+    0x00, 0x8b, 0xe0, 0x03, 0xa5, 0x20, 0x03, 0xae, 0xc0, 0x18, 0xaf, 0xf6, 0x00, 0x03, 0x88, 0xa2,
+    0xf0, 0x0c, 0x2f, 0x58, 0x0e, 0x1c, 0x1a, 0x00, 0x30, 0x2e, 0x0d, 0x00, 0x18, 0x13, 0x0b, 0xce,
+    0x03, 0x00, 0xea, 0x30, 0xbc, 0x80, 0x00, 0x2f, 0xe8, 0x06, 0x1b, 0x90, 0x90, 0x0d, 0x8d, 0x96,
+    0x01, 0x1c, 0xfe, 0x50, 0x00, 0x71, 0x14, 0x5e, 0x01, 0x85, 0xeb, 0x01, 0xc3, 0x83, 0x40, 0x06,
+    0x05, 0xc1, 0xa0, 0x03, 0x02, 0x61, 0x79, 0xc0, 0x60, 0x1d, 0x46, 0x17, 0x90, 0x00, 0x00, 0x6d,
+    0x9e, 0x80, 0x48, 0x3b, 0x8a, 0x01, 0x26, 0xb7, 0x40, 0x04, 0x55, 0xf9, 0x00, 0x01, 0xc4, 0x51,
+    0x78, 0x06, 0x17, 0xac, 0x07, 0x0e, 0x0d, 0x00, 0x18, 0x17, 0x06, 0x80, 0x0c, 0x09, 0x85, 0xe7,
+    0x01, 0x80, 0x75, 0x18, 0x5e, 0x40, 0x06, 0xe2, 0x8d, 0x00, 0xf0, 0x80, 0x66, 0xe2, 0x9d, 0x00,
+    0x8a, 0xff, 0x60, 0x00, 0x38, 0x8a, 0x2f, 0x00, 0xc2, 0xf5, 0x80, 0xe1, 0xc1, 0xa0, 0x03, 0x02,
+    0xe0, 0xd0, 0x01, 0x81, 0x30, 0xbc, 0xe0, 0x30, 0x0e, 0xa3, 0x0b, 0xc8, 0x00, 0x00, 0x84, 0x03,
+    0xab, 0x88, 0x03, 0x69, 0x18, 0x02, 0x21, 0xeb, 0x30, 0x6e, 0xfe, 0x4f, 0xfb, 0xbf, 0xce, 0x00,
+    0xae, 0x20, 0x0c, 0x44, 0x30, 0x00, 0x00, 0xfe, 0x2b, 0xfe, 0x8d, 0x01, 0xc4, 0x53, 0x77, 0x03,
+    0x0b, 0xd8, 0x01, 0x43, 0x83, 0x75, 0x66, 0x05, 0xc1, 0x76, 0x63, 0x02, 0x60, 0x1d, 0xc0, 0x60,
+    0x75, 0x45, 0x17, 0x90, 0x6a, 0xbf, 0xd8, 0x00, 0x00, 0x01, 0xeb, 0x00, 0xc3, 0xa8, 0x80, 0x0c,
+    0x7e, 0x80, 0x05, 0xf8, 0x00, 0x77, 0x00, 0x3f, 0xf9, 0x22, 0x06, 0x04, 0x20, 0xa0, 0x99, 0x80,
+    0x00, 0xc8, 0x94, 0x08, 0x00, 0x00, 0x8b, 0xe4, 0x03, 0x41, 0xc8, 0x06, 0xac, 0x00, 0x2f, 0xc0,
+    0x03, 0xb8, 0x01, 0xff, 0xc9, 0x10, 0x30, 0x21, 0x05, 0x04, 0xcc, 0x00, 0x06, 0x44, 0xa0, 0x40,
+    0x00, 0x2f, 0xe8, 0x04, 0x55, 0x23, 0x60, 0x02, 0xf6, 0xcb, 0x05, 0xf8, 0x00, 0x77, 0x00, 0x3f,
+    0xf9, 0x22, 0x06, 0x04, 0x20, 0xa0, 0x99, 0x80, 0x00, 0xc8, 0x94, 0x08, 0x00, 0x05, 0xe3, 0x8d,
+    0x10, 0x30, 0x08, 0xc0, 0x0d, 0xc7, 0x1c, 0x2b, 0xf0, 0x00, 0xee, 0x00, 0x7f, 0xf2, 0x44, 0x0c,
+    0x08, 0x41, 0x41, 0x33, 0x00, 0x01, 0x91, 0x28, 0x10, 0x00, 0x00, 0x9b, 0xd0, 0x03, 0xa2, 0x08,
+    0x01, 0xdc, 0xe0, 0x15, 0xf9, 0x00, 0x3f, 0x83, 0x41, 0x41, 0x01, 0xc1, 0x82, 0xc3, 0x42, 0x80,
+    0x0a, 0x64, 0xe4, 0x60, 0x0e, 0x0b, 0x15, 0x00, 0x90, 0x58, 0x28, 0x03, 0x38, 0x19, 0x00, 0x6e,
+    0x0b, 0x00, 0x86, 0x24, 0x58, 0x02, 0x37, 0x3b, 0x10, 0x08, 0x5f, 0x80, 0x0f, 0xfe, 0x58, 0xdf,
+    0xe1, 0x00, 0x4c, 0x0a, 0x7e, 0x01, 0x1d, 0xd1, 0x92, 0x00, 0x10, 0x00, 0x80, 0x20, 0x04, 0x00,
+    0x20, 0x08, 0x00, 0xee, 0x8c, 0x90, 0x00, 0xc0, 0xa7, 0xe0, 0x10, 0xdf, 0xe1, 0x00, 0x7f, 0xf1,
+    0x40, 0x0a, 0xc0, 0xca, 0x00, 0xc2, 0x02, 0x01, 0xab, 0x43, 0x68, 0x01, 0x7e, 0x40, 0x0f, 0xe0,
+    0xd0, 0x50, 0x40, 0x70, 0x60, 0xb0, 0xd0, 0xa0, 0x02, 0x99, 0x39, 0x18, 0x03, 0x82, 0xc5, 0x40,
+    0x24, 0x16, 0x0a, 0x00, 0xce, 0x06, 0x40, 0x1b, 0x82, 0xc0, 0x21, 0x89, 0x16, 0x00, 0x8d, 0xce,
+    0xc4, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x17, 0xfc, 0xe0, 0x1c, 0x59, 0x93, 0x00, 0x7b, 0xf3, 0x00,
+    0x1e, 0x23, 0x00, 0x38, 0x07, 0x28, 0x28, 0x68, 0x07, 0x58, 0x48, 0xa0, 0x80, 0x42, 0x62, 0x68,
+    0x0e, 0x01, 0x30, 0x20, 0x60, 0x68, 0x05, 0x60, 0xd3, 0x80, 0x82, 0x02, 0x60, 0x6c, 0xa0, 0x04,
+    0x06, 0x05, 0xff, 0xa0, 0x38, 0x2c, 0x3c, 0x02, 0x60, 0x40, 0x00, 0x00, 0xfc, 0x9f, 0xf3, 0x00,
+    0x13, 0x32, 0x70, 0x02, 0xf6, 0x6b, 0x01, 0x50, 0x41, 0xc2, 0x9d, 0xfa, 0xa0, 0x68, 0xf6, 0x6b,
+    0x80, 0x1d, 0x5b, 0xe0, 0x03, 0x13, 0x58, 0x01, 0x95, 0x2e, 0x80, 0x00, 0x00, 0x35, 0x83, 0xd0,
+    0x07, 0x33, 0xfc, 0xc8, 0x03, 0xd9, 0xfc, 0x60, 0x1e, 0xcf, 0xf0, 0x80, 0x71, 0x18, 0x01, 0xc0,
+    0x39, 0x41, 0x43, 0x40, 0x3a, 0xc2, 0x45, 0x04, 0x02, 0x13, 0x13, 0x40, 0x70, 0x09, 0x81, 0x03,
+    0x03, 0x40, 0x2b, 0x06, 0x9c, 0x04, 0x10, 0x13, 0x03, 0x65, 0x00, 0x20, 0x30, 0x2f, 0xfd, 0x01,
+    0xc1, 0x61, 0xe0, 0x13, 0x02, 0x00, 0x08, 0xb0, 0x99, 0x00, 0x25, 0xfd, 0x2c, 0x00, 0x39, 0xda,
+    0x40, 0x05, 0xde, 0xe3, 0x81, 0x50, 0x41, 0xc2, 0x9d, 0xfa, 0xa0, 0x68, 0xf6, 0x6b, 0x80, 0x1d,
+    0x5b, 0xe0, 0x03, 0x13, 0x58, 0x01, 0x95, 0x2e, 0x80, 0x00, 0x00, 0xb3, 0xfc, 0x20, 0x1c, 0x46,
+    0x00, 0x70, 0x0e, 0x50, 0x50, 0xd0, 0x0e, 0xb0, 0x91, 0x41, 0x00, 0x84, 0xc4, 0xd0, 0x1c, 0x02,
+    0x60, 0x40, 0xc0, 0xd0, 0x0a, 0xc1, 0xa7, 0x01, 0x04, 0x04, 0xc0, 0xd9, 0x40, 0x08, 0x0c, 0x0b,
+    0xff, 0x40, 0x70, 0x58, 0x78, 0x04, 0xc0, 0x81, 0x9e, 0xa0, 0x11, 0x02, 0x00, 0x7d, 0x60, 0x60,
+    0x1f, 0x51, 0xb9, 0x80, 0x05, 0xdf, 0xe7, 0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40, 0xd1, 0xec,
+    0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26, 0xb0, 0x03, 0x2a, 0x5a, 0x80, 0x06, 0xbb, 0x54, 0x64,
+    0x02, 0x12, 0x20, 0x06, 0x16, 0x39, 0x00, 0x00, 0xc5, 0xf2, 0x01, 0xf4, 0x1c, 0x80, 0x7d, 0x58,
+    0x01, 0xe3, 0xbe, 0xe5, 0x10, 0x04, 0xd8, 0x86, 0x0b, 0xa4, 0x03, 0x01, 0x7b, 0xce, 0x12, 0x08,
+    0x2a, 0x80, 0x08, 0x73, 0x0d, 0x0c, 0x00, 0xd1, 0x00, 0x0f, 0xfb, 0x43, 0x00, 0x34, 0x40, 0x10,
+    0x55, 0x00, 0x10, 0xe6, 0x03, 0x01, 0x7b, 0xce, 0x12, 0x00, 0x6b, 0x43, 0x05, 0xd2, 0x00, 0x00,
+    0x8f, 0xe0, 0x03, 0x42, 0x40, 0x06, 0xbb, 0x00, 0x45, 0x7f, 0xae, 0x03, 0x88, 0xa1, 0x0e, 0xc2,
+    0xf5, 0x89, 0xfc, 0x1a, 0x03, 0x71, 0xc1, 0xa0, 0x37, 0x2c, 0x0f, 0x38, 0x9c, 0x38, 0x8c, 0x10,
+    0xe0, 0x00, 0x85, 0xd4, 0x03, 0xea, 0xba, 0x50, 0x0e, 0x2c, 0xdb, 0x20, 0x0e, 0x1c, 0xfa, 0xd2,
+    0x00, 0x9b, 0x10, 0xc1, 0x74, 0x80, 0x60, 0x2f, 0x79, 0xc2, 0x41, 0x05, 0x50, 0x01, 0x0e, 0x61,
+    0xa1, 0x80, 0x1a, 0x20, 0x01, 0xff, 0x68, 0x60, 0x06, 0x88, 0x02, 0x0a, 0xa0, 0x02, 0x1c, 0xc0,
+    0x60, 0x2f, 0x79, 0xc2, 0x40, 0x0d, 0x68, 0x60, 0xba, 0x40, 0x00, 0x00, 0x37, 0xe0, 0x04, 0x53,
+    0x21, 0x90, 0x01, 0xeb, 0x65, 0x80, 0x0e, 0x7f, 0x14, 0x07, 0x11, 0x42, 0x1d, 0x85, 0xeb, 0x13,
+    0xf8, 0x34, 0x06, 0xe3, 0x83, 0x40, 0x6e, 0x58, 0x1e, 0x71, 0x38, 0x71, 0x18, 0x21, 0xc0, 0x00,
+    0x87, 0x64, 0x03, 0xf1, 0x80, 0x7e, 0x1e, 0x90, 0x0f, 0x1d, 0xf7, 0x28, 0x80, 0x26, 0xc4, 0x30,
+    0x5d, 0x20, 0x18, 0x0b, 0xde, 0x70, 0x90, 0x41, 0x54, 0x00, 0x43, 0x98, 0x68, 0x60, 0x06, 0x88,
+    0x00, 0x7f, 0xda, 0x18, 0x01, 0xa2, 0x00, 0x82, 0xa8, 0x00, 0x87, 0x30, 0x18, 0x0b, 0xde, 0x70,
+    0x90, 0x03, 0x5a, 0x18, 0x2e, 0x90, 0x00, 0x00, 0x17, 0x38, 0x07, 0xbc, 0x03, 0x17, 0x40, 0x04,
+    0x57, 0xfa, 0xe0, 0x38, 0x8a, 0x10, 0xec, 0x2f, 0x58, 0x9f, 0xc1, 0xa0, 0x37, 0x1c, 0x1a, 0x03,
+    0x72, 0xc0, 0xf3, 0x89, 0xc3, 0x88, 0xc1, 0x0e, 0x00, 0x00, 0x13, 0x8a, 0x38, 0x07, 0x16, 0x6d,
+    0x90, 0x07, 0xaa, 0xe9, 0x40, 0x38, 0xea, 0x6e, 0x88, 0x02, 0x6c, 0x43, 0x05, 0xd2, 0x01, 0x80,
+    0xbd, 0xe7, 0x09, 0x04, 0x15, 0x40, 0x04, 0x39, 0x86, 0x86, 0x00, 0x68, 0x80, 0x07, 0xfd, 0xa1,
+    0x80, 0x1a, 0x20, 0x08, 0x2a, 0x80, 0x08, 0x73, 0x01, 0x80, 0xbd, 0xe7, 0x09, 0x00, 0x35, 0xa1,
+    0x82, 0xe9, 0x00, 0x03, 0xf4, 0xca, 0x00, 0x1b, 0xd9, 0x58, 0x05, 0x1b, 0xe2, 0x00, 0x2b, 0xdc,
+    0x70, 0x1c, 0x45, 0x08, 0x76, 0x17, 0xac, 0x4f, 0xe0, 0xd0, 0x1b, 0x8e, 0x0d, 0x01, 0xb9, 0x60,
+    0x79, 0xc4, 0xe1, 0xc4, 0x60, 0x87, 0x00, 0x03, 0x70, 0x56, 0x00, 0xc7, 0x76, 0xa2, 0x00, 0xed,
+    0xca, 0x40, 0x09, 0x3f, 0xa2, 0xec, 0x80, 0x18, 0x50, 0x92, 0xe0, 0x02, 0x4b, 0xcd, 0x17, 0x20,
+    0x0e, 0x29, 0x05, 0x00, 0xf1, 0x86, 0x80, 0x7f, 0xf0, 0xcc, 0x34, 0x03, 0x8a, 0x41, 0x40, 0x09,
+    0x59, 0xa2, 0xe4, 0x00, 0x15, 0x24, 0xb8, 0x00, 0x00, 0xfc, 0xe4, 0x01, 0xd9, 0xe5, 0x02, 0x01,
+    0xfc, 0x40, 0x1f, 0x1f, 0x88, 0x26, 0xf4, 0x80, 0x71, 0x59, 0x3a, 0x98, 0x06, 0x50, 0x79, 0xc0,
+    0x0e, 0xe0, 0xd0, 0x02, 0x00, 0x6e, 0x0d, 0x00, 0x20, 0x06, 0x50, 0x79, 0xc0, 0x0e, 0x2b, 0x27,
+    0x54, 0x00, 0xc0, 0x0a, 0xff, 0xb6, 0x84, 0x03, 0x8d, 0x01, 0x78, 0x80, 0x34, 0x5e, 0xc0, 0x70,
+    0x07, 0xce, 0x46, 0x23, 0x00, 0x88, 0x00, 0xe0, 0xb8, 0x81, 0x5c, 0x80, 0x1b, 0x8c, 0x22, 0xd4,
+    0x1c, 0x14, 0xd8, 0x0d, 0x05, 0xc8, 0xc4, 0x02, 0x8b, 0xd8, 0x0f, 0x00, 0xc6, 0x80, 0xbc, 0x60,
+    0x00, 0x00, 0xec, 0xf1, 0x00, 0xb3, 0xcc, 0x38, 0x02, 0xed, 0x30, 0xb0, 0x4d, 0xcb, 0x00, 0x29,
+    0x59, 0x3a, 0x98, 0x01, 0x41, 0xe7, 0x00, 0x2e, 0x0d, 0x00, 0x20, 0x03, 0x83, 0x40, 0x08, 0x00,
+    0x50, 0x79, 0xc0, 0x08, 0xac, 0x9d, 0x50, 0x00, 0x00, 0x00, 0xff, 0x5f, 0xfb, 0x80, 0x34, 0xe6,
+    0x40, 0x04, 0xfd, 0xcc, 0x6f, 0xb8, 0x00, 0x51, 0x31, 0x00, 0x12, 0xef, 0x28, 0x07, 0xf9, 0x2a,
+    0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc, 0x97, 0x79, 0x40, 0x02, 0x89, 0x88,
+    0x00, 0xfc, 0x5f, 0xf3, 0x80, 0x0b, 0x32, 0x60, 0x01, 0x46, 0x72, 0x00, 0xe2, 0xb0, 0xd2, 0xb0,
+    0xc4, 0xe8, 0x4f, 0x04, 0xff, 0x01, 0x70, 0x46, 0x62, 0x25, 0x82, 0x6e, 0x63, 0xc7, 0x15, 0xd1,
+    0xe0, 0x00, 0x69, 0x8e, 0x90, 0x05, 0x79, 0xc8, 0x40, 0x13, 0x7f, 0xa4, 0x00, 0x9f, 0xfe, 0x70,
+    0x00, 0xa2, 0x62, 0x00, 0x25, 0xde, 0x50, 0x0f, 0xf2, 0x55, 0x61, 0x00, 0x0a, 0xae, 0x00, 0x97,
+    0xff, 0x08, 0x07, 0xf9, 0x2e, 0xf2, 0x80, 0x05, 0x13, 0x10, 0x06, 0xc0, 0x8b, 0x00, 0x33, 0xfb,
+    0x40, 0x05, 0x7f, 0xc6, 0x00, 0x2b, 0xfd, 0x50, 0x1c, 0x56, 0x1a, 0x56, 0x18, 0x9d, 0x09, 0xe0,
+    0x9f, 0xe0, 0x2e, 0x08, 0xcc, 0x44, 0xb0, 0x4d, 0xcc, 0x78, 0xe2, 0xba, 0x3c, 0x00, 0x00, 0xab,
+    0x40, 0x3c, 0x20, 0x1f, 0x5e, 0x80, 0x49, 0xff, 0xe7, 0x00, 0x0a, 0x26, 0x20, 0x02, 0x5d, 0xe5,
+    0x00, 0xff, 0x25, 0x56, 0x10, 0x00, 0xaa, 0xe0, 0x09, 0x7f, 0xf0, 0x80, 0x7f, 0x92, 0xef, 0x28,
+    0x00, 0x51, 0x31, 0x00, 0x00, 0x17, 0x30, 0x06, 0x10, 0x10, 0x0c, 0x7c, 0xe0, 0x11, 0x5f, 0xea,
+    0x80, 0xe2, 0xb0, 0xd2, 0xb0, 0xc4, 0xe8, 0x4f, 0x04, 0xff, 0x01, 0x70, 0x46, 0x62, 0x25, 0x82,
+    0x6e, 0x63, 0xc7, 0x15, 0xd1, 0xe0, 0x4f, 0xff, 0x38, 0x00, 0x51, 0x31, 0x00, 0x12, 0xef, 0x28,
+    0x07, 0xf9, 0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc, 0x97, 0x79, 0x40,
+    0x02, 0x89, 0x89, 0x3f, 0xf1, 0x0b, 0x00, 0x62, 0x28, 0x03, 0x89, 0x4d, 0x80, 0x02, 0xbf, 0xd5,
+    0x01, 0xc5, 0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0, 0x8c, 0xc5, 0x5b, 0x04,
+    0xdc, 0xd7, 0x8e, 0x2b, 0xa8, 0x48, 0x1d, 0xf0, 0x19, 0x80, 0x22, 0x06, 0x10, 0x08, 0xd1, 0x5c,
+    0x00, 0x39, 0x93, 0x88, 0x06, 0xdf, 0xe1, 0x00, 0x9e, 0x2a, 0x40, 0x09, 0xfe, 0x98, 0xff, 0x38,
+    0x00, 0x51, 0x31, 0x00, 0x12, 0xef, 0x28, 0x07, 0xf9, 0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b,
+    0xff, 0x84, 0x03, 0xfc, 0x97, 0x79, 0x40, 0x02, 0x89, 0x88, 0x04, 0xf3, 0xd9, 0x00, 0x23, 0x60,
+    0x48, 0x05, 0x3b, 0x80, 0x11, 0x5e, 0xe2, 0x80, 0xe2, 0xb0, 0xd2, 0xb0, 0xc4, 0xe8, 0x4f, 0x04,
+    0xff, 0x01, 0x70, 0x46, 0x62, 0x25, 0x82, 0x6e, 0x63, 0xc7, 0x15, 0xd1, 0xe0, 0x00, 0x85, 0xd4,
+    0x03, 0xea, 0xba, 0x50, 0x0e, 0x2c, 0xdb, 0x20, 0x0e, 0x1c, 0xfa, 0xd2, 0x00, 0x97, 0x10, 0xc1,
+    0x74, 0xc0, 0x6c, 0x2f, 0x7a, 0x03, 0xc1, 0x05, 0x50, 0x00, 0xf7, 0x01, 0xa1, 0x80, 0x07, 0x8c,
+    0xc0, 0x07, 0xa5, 0xde, 0x1d, 0x0c, 0x00, 0x77, 0x88, 0x0a, 0x0a, 0xa0, 0x01, 0xc5, 0x00, 0x60,
+    0x2f, 0x75, 0x01, 0x20, 0x06, 0xc4, 0x33, 0x2e, 0x90, 0x00, 0x00, 0x37, 0xe8, 0x06, 0x29, 0xa1,
+    0xa0, 0x08, 0xbd, 0x72, 0x80, 0x24, 0xde, 0x9c, 0xf1, 0x15, 0x9c, 0x99, 0x80, 0x0c, 0x12, 0xf4,
+    0x20, 0x0e, 0x02, 0x00, 0x28, 0x03, 0x83, 0x40, 0x08, 0x00, 0x50, 0x79, 0xc0, 0x08, 0xac, 0x9d,
+    0x4c, 0x02, 0x7f, 0xe9, 0x20, 0x11, 0x66, 0x1e, 0x85, 0x00, 0x6c, 0xa1, 0x16, 0x80, 0x00, 0x1e,
+    0x8a, 0xe0, 0x07, 0x1b, 0xf5, 0x48, 0x07, 0xab, 0xfc, 0xa0, 0x1c, 0x77, 0xdc, 0xa2, 0x00, 0x97,
+    0x10, 0xc1, 0x74, 0xc0, 0x6c, 0x2f, 0x7a, 0x03, 0xc1, 0x05, 0x50, 0x00, 0xf7, 0x01, 0xa1, 0x80,
+    0x07, 0x8c, 0xc0, 0x07, 0xa5, 0xde, 0x1d, 0x0c, 0x00, 0x77, 0x88, 0x0a, 0x0a, 0xa0, 0x01, 0xc5,
+    0x00, 0x60, 0x2f, 0x75, 0x01, 0x20, 0x06, 0xc4, 0x33, 0x2e, 0x90, 0x00, 0x05, 0xe0, 0x7c, 0x00,
+    0x95, 0x3e, 0x60, 0x03, 0x57, 0xf2, 0x00, 0x49, 0xbd, 0x39, 0xe2, 0x2b, 0x39, 0x33, 0x00, 0x18,
+    0x25, 0xe8, 0x40, 0x1c, 0x04, 0x00, 0x50, 0x07, 0x06, 0x80, 0x10, 0x00, 0xa0, 0xf3, 0x80, 0x11,
+    0x59, 0x3a, 0x98, 0x04, 0xff, 0xd2, 0x40, 0x22, 0xcc, 0x3d, 0x0a, 0x00, 0xd9, 0x42, 0x2d, 0x00,
+    0x00, 0x87, 0x64, 0x03, 0xf1, 0x80, 0x7e, 0x1e, 0x90, 0x0f, 0x1d, 0xf7, 0x28, 0x80, 0x25, 0xc4,
+    0x30, 0x5d, 0x30, 0x1b, 0x0b, 0xde, 0x80, 0xf0, 0x41, 0x54, 0x00, 0x3d, 0xc0, 0x68, 0x60, 0x01,
+    0xe3, 0x30, 0x01, 0xe9, 0x77, 0x87, 0x43, 0x00, 0x1d, 0xe2, 0x02, 0x82, 0xa8, 0x00, 0x71, 0x40,
+    0x18, 0x0b, 0xdd, 0x40, 0x48, 0x01, 0xb1, 0x0c, 0xcb, 0xa4, 0x00, 0x00, 0x0f, 0x40, 0x07, 0x18,
+    0x07, 0xc5, 0xd0, 0x01, 0x93, 0x7a, 0x73, 0xc4, 0x56, 0x72, 0x66, 0x00, 0x30, 0x4b, 0xd0, 0x80,
+    0x38, 0x08, 0x00, 0xa0, 0x0e, 0x0d, 0x00, 0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x75, 0x30,
+    0x09, 0xff, 0xa4, 0x80, 0x45, 0x98, 0x7a, 0x14, 0x01, 0xb2, 0x84, 0x5a, 0x00, 0x00, 0x1d, 0xf7,
+    0x28, 0x80, 0x25, 0xc4, 0x30, 0x5d, 0x30, 0x1b, 0x0b, 0xde, 0x80, 0xf0, 0x41, 0x54, 0x00, 0x3d,
+    0xc0, 0x68, 0x60, 0x01, 0xe3, 0x30, 0x01, 0xe9, 0x77, 0x87, 0x43, 0x00, 0x1d, 0xe2, 0x02, 0x82,
+    0xa8, 0x00, 0x71, 0x40, 0x18, 0x0b, 0xdd, 0x40, 0x48, 0x01, 0xb1, 0x0c, 0xcb, 0xa4, 0x01, 0x1d,
+    0xdb, 0x68, 0x80, 0x39, 0x29, 0xc0, 0x3e, 0xc2, 0x40, 0x0c, 0x00, 0x00, 0x88, 0xc0, 0x3d, 0x12,
+    0x01, 0xe4, 0xc0, 0x0f, 0x4a, 0x80, 0x64, 0xd9, 0xac, 0xf1, 0x15, 0x9c, 0x99, 0x80, 0x0c, 0x12,
+    0xf4, 0x20, 0x0e, 0x02, 0x00, 0x28, 0x03, 0x83, 0x40, 0x08, 0x00, 0x50, 0x79, 0xc0, 0x08, 0xac,
+    0x9d, 0x4c, 0x02, 0x7f, 0xe9, 0x20, 0x11, 0x66, 0x1e, 0x85, 0x00, 0x6c, 0xa1, 0x16, 0x80, 0x00,
+    0x89, 0xd0, 0x03, 0xdf, 0x96, 0x60, 0x18, 0xea, 0xe9, 0x40, 0x09, 0xf2, 0xe0, 0xa7, 0xf2, 0x01,
+    0xff, 0xd1, 0x4b, 0xba, 0x40, 0x30, 0xa2, 0x46, 0x01, 0x97, 0xfe, 0xa0, 0x0f, 0xfe, 0x88, 0x02,
+    0x74, 0x00, 0xc3, 0xf9, 0x64, 0x01, 0x2d, 0x5c, 0xb8, 0x04, 0x85, 0xfc, 0xa0, 0x1f, 0xfc, 0xa1,
+    0xaf, 0xc2, 0x00, 0x99, 0x82, 0x72, 0x01, 0x26, 0x78, 0x28, 0x04, 0x60, 0x22, 0x00, 0xff, 0xe6,
+    0x80, 0x0e, 0xf0, 0x0d, 0xfe, 0x00, 0xff, 0xac, 0x43, 0xff, 0x00, 0x32, 0x80, 0x1b, 0xb8, 0x01,
+    0xc2, 0x20, 0x99, 0xc0, 0x02, 0x00, 0x91, 0x30, 0x07, 0xbf, 0xf0, 0x07, 0xff, 0x54, 0x05, 0xf8,
+    0x00, 0xc7, 0x40, 0xff, 0x20, 0x03, 0x80, 0x6d, 0x80, 0x08, 0x80, 0x11, 0xd8, 0x40, 0x13, 0x30,
+    0x4e, 0x40, 0x24, 0xcf, 0x05, 0x00, 0x8c, 0x04, 0x40, 0x1f, 0xfc, 0xd0, 0x3d, 0xef, 0x92, 0xff,
+    0x74, 0x8b, 0x75, 0x80, 0x7f, 0xf8, 0x80, 0x2e, 0x95, 0xa5, 0x71, 0xaf, 0x68, 0x87, 0x28, 0xa7,
+    0xc8, 0x07, 0xff, 0x4c, 0x00, 0xe2, 0xff, 0xa0, 0xb3, 0x29, 0x07, 0xc9, 0x10, 0x0f, 0xff, 0x08,
+    0x00, 0xe3, 0xff, 0x98, 0xf3, 0x27, 0x06, 0xcb, 0x10, 0x0f, 0xfe, 0x90, 0x5b, 0x07, 0xa5, 0x0f,
+    0x99, 0x05, 0xff, 0x18, 0x27, 0xd0, 0x07, 0xff, 0x88, 0x7c, 0x09, 0xa6, 0x0f, 0x48, 0x1c, 0xfd,
+    0x20, 0x5f, 0x80, 0x0f, 0xfe, 0x98, 0x04, 0xfa, 0x00, 0xff, 0xec, 0xe0, 0x78, 0x38, 0xb8, 0x38,
+    0x40, 0x03, 0xe6, 0x00, 0xe3, 0xe6, 0x05, 0xf8, 0x00, 0xff, 0xe6, 0xf8, 0x58, 0xa9, 0x90, 0xa9,
+    0xc8, 0x2e, 0x70, 0x08, 0xb9, 0xd3, 0xe8, 0x03, 0xff, 0x9e, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x30,
+    0x4f, 0xa0, 0x0e, 0xff, 0x00, 0x7f, 0xfa, 0x4f, 0x1c, 0x03, 0xe1, 0x3b, 0x02, 0x01, 0x00, 0x88,
+    0x87, 0x98, 0x07, 0x00, 0xde, 0x86, 0x0d, 0x20, 0x3e, 0x61, 0xd8, 0x00, 0xc6, 0x27, 0xcc, 0x3d,
+    0x2b, 0xf0, 0x5f, 0x60, 0x1f, 0xfd, 0x85, 0xf8, 0x00, 0xe2, 0x90, 0x20, 0x03, 0x21, 0xd8, 0x00,
+    0xc4, 0xe8, 0x01, 0xdf, 0x96, 0x60, 0x11, 0xd5, 0xd2, 0x80, 0x46, 0x5f, 0x8c, 0x01, 0xff, 0xdc,
+    0x7c, 0x20, 0x0e, 0xf3, 0x40, 0xd0, 0x10, 0xb0, 0x9c, 0x70, 0xb0, 0x3a, 0x23, 0x2a, 0x30, 0x00,
+    0x08, 0xfb, 0x04, 0x7b, 0x57, 0x4f, 0x4e, 0x70, 0x5f, 0x80, 0x0f, 0xfe, 0xc1, 0xc8, 0x70, 0x21,
+    0xa3, 0x00, 0x4f, 0xa0, 0x00, 0xf7, 0xa8, 0x07, 0x68, 0xba, 0x80, 0x69, 0x34, 0x80, 0x0c, 0xcc,
+    0x2b, 0x00, 0xcf, 0x21, 0x60, 0x1c, 0x40, 0x08, 0x00, 0xf5, 0xb0, 0xc8, 0x06, 0x54, 0x81, 0x63,
+    0x00, 0xe1, 0xb0, 0xe0, 0x0f, 0x2a, 0x14, 0x27, 0xd1, 0x28, 0xdf, 0xc0, 0x05, 0x74, 0x20, 0x1e,
+    0x47, 0x00, 0xc0, 0x5f, 0x80, 0x0f, 0xfe, 0x6c, 0x7d, 0x00, 0x66, 0x73, 0xa0, 0x09, 0x24, 0xb4,
+    0x03, 0x18, 0x08, 0x80, 0x31, 0xa1, 0xb8, 0x06, 0x4a, 0x18, 0x30, 0x0c, 0x34, 0x1c, 0x0b, 0xf2,
+    0xad, 0xfa, 0x01, 0x3d, 0x08, 0x07, 0x79, 0x98, 0x02, 0x00, 0x5f, 0x80, 0x3f, 0xe1, 0x00, 0xdc,
+    0x14, 0x20, 0x14, 0x13, 0x20, 0x04, 0xee, 0x19, 0x00, 0xc6, 0x42, 0xa0, 0x19, 0x3c, 0x28, 0x80,
+    0x31, 0x50, 0x78, 0x00, 0x03, 0xf7, 0x00, 0xde, 0xae, 0x01, 0xb2, 0x80, 0x32, 0x7d, 0x00, 0x7f,
+    0xfa, 0xd2, 0xee, 0xa0, 0x00, 0xa2, 0x4a, 0x00, 0x05, 0xf6, 0x08, 0x66, 0x06, 0xc8, 0x2f, 0xc0,
+    0x07, 0xff, 0x64, 0x4f, 0xa0, 0x0f, 0xff, 0x5a, 0x5d, 0xd4, 0x00, 0x14, 0x49, 0x53, 0xfa, 0xb7,
+    0xfc, 0x00, 0x4a, 0x10, 0x0d, 0x84, 0x60, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x7a, 0x55, 0x1a, 0x83,
+    0x10, 0x80, 0x4f, 0xa0, 0xe7, 0x00, 0xf1, 0x00, 0x74, 0xa0, 0x07, 0x38, 0x80, 0x7f, 0xf4, 0xd2,
+    0xee, 0xa0, 0x00, 0xa2, 0x4a, 0x00, 0x5f, 0x8a, 0xb0, 0x0c, 0x40, 0x17, 0xd0, 0x04, 0xa6, 0x01,
+    0xff, 0xd2, 0x00, 0x4f, 0xa0, 0x0f, 0xfe, 0x81, 0xf3, 0x00, 0x7f, 0xc7, 0xcc, 0x01, 0xfe, 0x4b,
+    0xbc, 0x00, 0x14, 0x4c, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x64, 0x68, 0x80, 0x46, 0x40, 0x1a, 0xf8,
+    0x40, 0x30, 0x80, 0x7f, 0xf0, 0x40, 0x0c, 0xf2, 0x00, 0xff, 0xe2, 0x90, 0x07, 0x2f, 0x38, 0x07,
+    0x41, 0x38, 0x01, 0xcc, 0x23, 0x08, 0x01, 0x00, 0x05, 0x00, 0xd6, 0x60, 0x1e, 0x40, 0x07, 0x5d,
+    0xca, 0x01, 0x1a, 0x24, 0x40, 0x05, 0xf8, 0x00, 0xff, 0xe1, 0x2b, 0x81, 0x01, 0xa1, 0xc0, 0x31,
+    0x8b, 0x80, 0x45, 0xa0, 0x1f, 0xfc, 0x10, 0x00, 0xc7, 0xf0, 0x01, 0xe8, 0x48, 0x00, 0xf5, 0xd8,
+    0x02, 0x4f, 0xf0, 0x80, 0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33,
+    0x09, 0x80, 0x3d, 0x03, 0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x62, 0x30, 0x0f, 0xb8, 0x03, 0xf1,
+    0xa8, 0x00, 0x00, 0x8b, 0xe4, 0x03, 0x41, 0xc8, 0x06, 0xac, 0x00, 0x2f, 0xc5, 0x7e, 0x10, 0x01,
+    0xd8, 0x4e, 0x40, 0x09, 0x9e, 0x0a, 0x00, 0x30, 0x11, 0x00, 0x7f, 0xf2, 0x80, 0x4f, 0xf0, 0x80,
+    0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09, 0x80, 0x3d, 0x03,
+    0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x62, 0x30, 0x0f, 0xb8, 0x03, 0xf1, 0xa8, 0x01, 0x3e, 0x85,
+    0x4a, 0xbe, 0xc0, 0x24, 0xa1, 0x00, 0xf6, 0x11, 0x80, 0x40, 0x5f, 0x8a, 0xfc, 0x20, 0x03, 0xb0,
+    0x9c, 0x80, 0x13, 0x3c, 0x14, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x2f, 0xc2, 0x9f, 0x70, 0x00,
+    0x94, 0xc0, 0x1b, 0x05, 0x40, 0x00, 0x00, 0x1b, 0x82, 0xb0, 0x06, 0x3b, 0xb5, 0x10, 0x07, 0x6e,
+    0x52, 0x00, 0x13, 0xfc, 0x0e, 0xa7, 0xf6, 0x01, 0x58, 0x07, 0xe5, 0x30, 0x0f, 0x18, 0x70, 0x07,
+    0x99, 0x84, 0xc0, 0x1e, 0x81, 0x97, 0x00, 0xe1, 0x80, 0x80, 0x0f, 0x31, 0x18, 0x07, 0xdc, 0x01,
+    0xf8, 0xd4, 0x00, 0x00, 0x03, 0xf5, 0xbb, 0x00, 0x0e, 0x29, 0x68, 0x02, 0x7d, 0xf1, 0x05, 0xf8,
+    0x87, 0x61, 0x00, 0x1d, 0x84, 0xe4, 0x00, 0x99, 0xe0, 0xa0, 0x03, 0x01, 0x10, 0x07, 0xff, 0x28,
+    0x4f, 0xf0, 0x80, 0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09,
+    0x80, 0x3d, 0x01, 0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x72, 0x30, 0x0f, 0xa4, 0x03, 0xf2, 0x20,
+    0x00, 0x9f, 0x40, 0x17, 0x80, 0x7c, 0xb0, 0x04, 0x01, 0xd8, 0x66, 0xb0, 0x5f, 0x8a, 0xfc, 0x20,
+    0x03, 0xb0, 0x9c, 0x00, 0x13, 0x3c, 0x10, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x2f, 0xc0, 0x07,
+    0xc3, 0x22, 0x60, 0x11, 0xb0, 0xc8, 0x00, 0xff, 0xe0, 0xff, 0xd4, 0x01, 0xec, 0xca, 0x00, 0x38,
+    0xe3, 0x7a, 0x04, 0x02, 0x5c, 0x43, 0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82, 0x0a, 0xa0,
+    0x02, 0x05, 0x07, 0x43, 0x40, 0x32, 0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca, 0x04, 0x82,
+    0xa8, 0x00, 0x81, 0x41, 0x14, 0x05, 0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8, 0x00, 0x00,
+    0xff, 0x7f, 0xd2, 0x01, 0xb3, 0x28, 0x00, 0x8a, 0x33, 0xa4, 0x00, 0x38, 0x8a, 0x2f, 0x00, 0xc2,
+    0xf5, 0x80, 0xe1, 0xc1, 0xa0, 0x03, 0x02, 0xe0, 0xd0, 0x01, 0x81, 0x30, 0xbc, 0xe0, 0x30, 0x0e,
+    0xa3, 0x0b, 0xc8, 0x00, 0x00, 0x1e, 0x8a, 0x68, 0x07, 0x1a, 0x75, 0xc0, 0x07, 0xa7, 0xfc, 0xa0,
+    0x1c, 0x77, 0xdb, 0x42, 0x01, 0x2e, 0x21, 0x99, 0x7c, 0x80, 0x6c, 0x2f, 0x79, 0xc6, 0x41, 0x05,
+    0x50, 0x01, 0x02, 0x83, 0xa1, 0xa0, 0x19, 0x40, 0x80, 0x02, 0x01, 0xf6, 0x86, 0x00, 0x65, 0x02,
+    0x41, 0x54, 0x00, 0x40, 0xa0, 0x8a, 0x02, 0xf7, 0x9c, 0x64, 0x00, 0xd8, 0x86, 0x0b, 0xe4, 0x00,
+    0x04, 0xe1, 0x6d, 0x00, 0x91, 0x1d, 0x12, 0x01, 0xab, 0xf9, 0x00, 0x22, 0xbf, 0xd8, 0x00, 0x0e,
+    0x22, 0x8b, 0xc0, 0x30, 0xbd, 0x60, 0x38, 0x70, 0x68, 0x00, 0xc0, 0xb8, 0x34, 0x00, 0x60, 0x4c,
+    0x2f, 0x38, 0x0c, 0x03, 0xa8, 0xc2, 0xf2, 0x00, 0x00, 0xab, 0x8f, 0xdc, 0x03, 0x0a, 0xdf, 0xab,
+    0x80, 0x61, 0xf5, 0xca, 0x00, 0xe3, 0xbe, 0xda, 0x10, 0x09, 0x71, 0x0c, 0xcb, 0xe4, 0x03, 0x61,
+    0x7b, 0xce, 0x32, 0x08, 0x2a, 0x80, 0x08, 0x14, 0x1d, 0x0d, 0x00, 0xca, 0x04, 0x00, 0x10, 0x0f,
+    0xb4, 0x30, 0x03, 0x28, 0x12, 0x0a, 0xa0, 0x02, 0x05, 0x04, 0x50, 0x17, 0xbc, 0xe3, 0x20, 0x06,
+    0xc4, 0x30, 0x5f, 0x20, 0x00, 0x00, 0x5e, 0xa7, 0xb0, 0x00, 0x92, 0x64, 0xcc, 0x00, 0x17, 0xa6,
+    0xc8, 0x04, 0x57, 0xfb, 0x00, 0x01, 0xc4, 0x51, 0x78, 0x06, 0x17, 0xac, 0x07, 0x0e, 0x0d, 0x00,
+    0x18, 0x17, 0x06, 0x80, 0x0c, 0x09, 0x85, 0xe7, 0x01, 0x80, 0x75, 0x18, 0x5e, 0x40, 0x00, 0x1d,
+    0xf7, 0xff, 0xe0, 0x6c, 0x43, 0x40, 0x02, 0x26, 0x51, 0x90, 0xcd, 0xb2, 0x0a, 0xbb, 0xa9, 0x01,
+    0x8c, 0x03, 0xfb, 0x43, 0xc0, 0x3a, 0xab, 0x30, 0x07, 0xe4, 0x55, 0xbf, 0x43, 0xc0, 0x3b, 0xbf,
+    0xe9, 0x40, 0x63, 0x00, 0xfe, 0x19, 0x0c, 0xdb, 0x20, 0xab, 0xba, 0x81, 0xb1, 0x0d, 0x00, 0x08,
+    0x99, 0x40, 0x02, 0xbf, 0xd8, 0x3b, 0xfd, 0x50, 0x1c, 0x45, 0x17, 0xc4, 0x50, 0xa4, 0x61, 0x7a,
+    0xc0, 0x04, 0xd6, 0x07, 0xf0, 0x68, 0x00, 0xc2, 0x7f, 0x81, 0x78, 0x34, 0x00, 0x61, 0x19, 0x88,
+    0x83, 0x0b, 0xc5, 0x80, 0x26, 0xe6, 0x04, 0x5a, 0x8e, 0xcf, 0x8a, 0xe9, 0x0e, 0x00, 0x00, 0xd7,
+    0xc2, 0x01, 0xc8, 0x8d, 0x10, 0x0e, 0x4f, 0x30, 0x09, 0x3f, 0xf6, 0xb0, 0x06, 0x15, 0x42, 0x96,
+    0x00, 0x92, 0xae, 0xc1, 0x40, 0x1e, 0x50, 0x20, 0x0e, 0x19, 0x04, 0x00, 0x97, 0xf9, 0xc6, 0x00,
+    0x22, 0x63, 0x09, 0x20, 0x09, 0xe7, 0x82, 0x40, 0x3c, 0x4a, 0x2c, 0x01, 0xe9, 0x08, 0x00, 0x00,
+    0x27, 0xb8, 0x02, 0x15, 0xc0, 0x19, 0x40, 0xbf, 0x3b, 0x40, 0x06, 0x1c, 0x00, 0x1e, 0x30, 0x01,
+    0x00, 0x3f, 0xf8, 0xa0, 0x4f, 0xfd, 0xac, 0x01, 0x85, 0x50, 0xa5, 0x80, 0x24, 0xab, 0xb0, 0x50,
+    0x07, 0x94, 0x08, 0x03, 0x86, 0x41, 0x00, 0x25, 0xfe, 0x71, 0x80, 0x08, 0x98, 0xc2, 0x48, 0x02,
+    0x79, 0xe0, 0x90, 0x0f, 0x12, 0x8b, 0x00, 0x7a, 0x42, 0x01, 0x3e, 0x8d, 0x4f, 0xf8, 0x03, 0x74,
+    0x80, 0x7c, 0x52, 0x01, 0x80, 0x5f, 0x9d, 0xa0, 0x03, 0x0e, 0x00, 0x0f, 0x18, 0x00, 0x80, 0x1f,
+    0xfc, 0x54, 0xaa, 0x00, 0x1a, 0x80, 0x2c, 0x42, 0x00, 0x00, 0x00, 0x3a, 0x0b, 0x90, 0x06, 0x2b,
+    0xdc, 0x20, 0x0c, 0xb3, 0x74, 0x01, 0x27, 0xfa, 0x63, 0x18, 0x03, 0x0a, 0xa1, 0x4b, 0x00, 0x49,
+    0x57, 0x60, 0xa0, 0x0f, 0x28, 0x10, 0x07, 0x0c, 0x82, 0x00, 0x4b, 0xfc, 0xe3, 0x00, 0x11, 0x31,
+    0x84, 0x90, 0x04, 0xf3, 0xc1, 0x20, 0x1e, 0x25, 0x16, 0x00, 0xf4, 0x84, 0x00, 0x4f, 0x3d, 0x94,
+    0x7c, 0x19, 0x08, 0xec, 0x05, 0xf8, 0xda, 0x00, 0x30, 0xe0, 0x00, 0xf1, 0x80, 0x08, 0x01, 0xff,
+    0xc5, 0x00, 0x00, 0xd7, 0xc2, 0x01, 0xc6, 0x9a, 0x20, 0x1c, 0x7e, 0x60, 0x18, 0x6b, 0xbf, 0x14,
+    0x02, 0xc5, 0x34, 0x3a, 0x40, 0x42, 0x3d, 0xba, 0x0e, 0x00, 0x88, 0xc1, 0x7a, 0xc1, 0x10, 0x39,
+    0xd4, 0xa2, 0x00, 0xba, 0x50, 0x5b, 0x70, 0x25, 0x7a, 0xea, 0x08, 0x04, 0xa9, 0x00, 0x38, 0x08,
+    0x38, 0xa7, 0x5e, 0x83, 0x00, 0xe2, 0x82, 0x14, 0x40, 0x00, 0x00, 0xa3, 0xcc, 0x02, 0x17, 0x93,
+    0x00, 0x87, 0xd8, 0x02, 0x8e, 0xfc, 0x40, 0x57, 0x28, 0x2b, 0x13, 0x07, 0x4d, 0xb0, 0x66, 0x26,
+    0x63, 0x84, 0xf3, 0x70, 0xd5, 0x16, 0xb9, 0x04, 0x1d, 0xa0, 0x60, 0x24, 0xc0, 0x00, 0x95, 0xc4,
+    0x03, 0x96, 0xae, 0x80, 0x38, 0xaf, 0x70, 0x80, 0x21, 0xda, 0xeb, 0x70, 0x0b, 0x14, 0xd0, 0xe9,
+    0x01, 0x08, 0xf6, 0xe8, 0x38, 0x02, 0x23, 0x05, 0xeb, 0x04, 0x40, 0xe7, 0x52, 0x88, 0x02, 0xe9,
+    0x41, 0x6d, 0xc0, 0x95, 0xeb, 0xa8, 0x20, 0x12, 0xa4, 0x00, 0xe0, 0x20, 0xe2, 0x9d, 0x7a, 0x0c,
+    0x03, 0x8a, 0x08, 0x51, 0x00, 0x00, 0x00, 0x5f, 0xb8, 0x04, 0xeb, 0x50, 0x60, 0x05, 0xf5, 0xd2,
+    0x00, 0x57, 0xfb, 0x94, 0x15, 0xca, 0x0a, 0xc4, 0xc1, 0xd3, 0x6c, 0x19, 0x89, 0x98, 0xe1, 0x3c,
+    0xdc, 0x35, 0x45, 0xae, 0x41, 0x07, 0x68, 0x18, 0x09, 0x30, 0x01, 0xae, 0xfc, 0x50, 0x0b, 0x14,
+    0xd0, 0xe9, 0x01, 0x08, 0xf6, 0xe8, 0x38, 0x02, 0x23, 0x05, 0xdb, 0x04, 0x31, 0xcd, 0x91, 0x10,
+    0x03, 0x25, 0x0d, 0xb1, 0xc0, 0x91, 0xef, 0xa8, 0x24, 0x12, 0xec, 0x00, 0x40, 0x10, 0x70, 0x5d,
+    0xaf, 0x06, 0x01, 0xc3, 0x25, 0x07, 0x90, 0x01, 0xe5, 0x96, 0x40, 0x07, 0x25, 0xc8, 0x07, 0x9e,
+    0xf4, 0x02, 0x00, 0x08, 0xef, 0xc4, 0x05, 0x72, 0x82, 0xb1, 0x30, 0x65, 0xdb, 0x06, 0x55, 0x6e,
+    0x68, 0x94, 0xed, 0x9b, 0x22, 0x32, 0x48, 0x02, 0x68, 0x69, 0x28, 0x40, 0x7c, 0x1a, 0x70, 0x08,
+    0x76, 0x80, 0x32, 0xf3, 0x00, 0x00, 0x00, 0x3a, 0x0b, 0x90, 0x06, 0x2b, 0xdc, 0x20, 0x0c, 0xb5,
+    0x74, 0x01, 0x86, 0xae, 0x35, 0x40, 0x2c, 0x53, 0x43, 0xa4, 0x04, 0x23, 0xdb, 0xa0, 0xe0, 0x08,
+    0x8c, 0x17, 0xac, 0x11, 0x03, 0x9d, 0x4a, 0x20, 0x0b, 0xa5, 0x05, 0xb7, 0x02, 0x57, 0xae, 0xa0,
+    0x80, 0x4a, 0x90, 0x03, 0x80, 0x83, 0x8a, 0x75, 0xe8, 0x30, 0x0e, 0x28, 0x21, 0x44, 0x00, 0x09,
+    0xd3, 0xf5, 0x00, 0x48, 0x63, 0x28, 0x05, 0x9b, 0x20, 0x14, 0x7e, 0xe2, 0x02, 0xb9, 0x41, 0x58,
+    0x98, 0x3a, 0x6d, 0x83, 0x31, 0x33, 0x1c, 0x27, 0x9b, 0x86, 0xa8, 0xb5, 0xc8, 0x20, 0xed, 0x03,
+    0x01, 0x26, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44, 0xa2, 0xec, 0x41, 0x57, 0x60, 0x0f, 0xff,
+    0x7c, 0x28, 0x80, 0x73, 0x84, 0x80, 0x75, 0x3e, 0x00, 0x00, 0x05, 0x71, 0x00, 0x74, 0x18, 0x72,
+    0x06, 0xc4, 0x90, 0x36, 0x3b, 0x05, 0xa0, 0x07, 0xfc, 0x21, 0x08, 0x12, 0x4b, 0x80, 0x74, 0xd0,
+    0x00, 0x52, 0x70, 0x04, 0x31, 0x80, 0x00, 0x39, 0x8b, 0x88, 0x04, 0x3b, 0xb0, 0x80, 0x4d, 0x17,
+    0x40, 0x0b, 0xff, 0x4c, 0x7f, 0xc6, 0x88, 0x00, 0x22, 0x51, 0x76, 0x20, 0xab, 0xb0, 0x07, 0xff,
+    0xb0, 0x00, 0xde, 0xa0, 0xd0, 0x20, 0xc1, 0xae, 0x70, 0x7c, 0x81, 0xbe, 0x12, 0x40, 0xd8, 0x0e,
+    0xc1, 0x68, 0x01, 0xff, 0xc2, 0x10, 0x84, 0x00, 0x49, 0x2e, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00,
+    0x44, 0xa2, 0xec, 0x41, 0x57, 0x60, 0x0f, 0xe1, 0x10, 0x00, 0x84, 0x01, 0x7c, 0x41, 0x9e, 0x00,
+    0x9b, 0x10, 0xaa, 0x00, 0x0d, 0x0c, 0x11, 0x00, 0x1f, 0xfc, 0x50, 0x05, 0x71, 0x00, 0x74, 0x18,
+    0x72, 0x06, 0xc4, 0x90, 0x36, 0x49, 0x03, 0x66, 0x0c, 0x2e, 0x49, 0xc1, 0x84, 0x04, 0x21, 0x02,
+    0x49, 0x70, 0x00, 0x16, 0xc2, 0xc8, 0x06, 0x54, 0x1a, 0xc0, 0x0c, 0xd3, 0x2e, 0x50, 0x02, 0x7c,
+    0x00, 0x05, 0xbd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08, 0x0a, 0x82, 0x08, 0x02, 0x80, 0x85, 0x87,
+    0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x00, 0x6d, 0x97, 0x00, 0x0c, 0x77, 0x4e, 0x00,
+    0x3d, 0x6f, 0x90, 0x5f, 0x90, 0x07, 0x70, 0x03, 0xff, 0x92, 0x20, 0x60, 0x42, 0x0a, 0x09, 0x98,
+    0x00, 0x0c, 0x89, 0x40, 0x80, 0x00, 0xff, 0x8f, 0xfe, 0x60, 0x0c, 0x79, 0x93, 0x80, 0x13, 0xe4,
+    0xce, 0x7f, 0x70, 0x0f, 0xff, 0x19, 0x80, 0x42, 0x02, 0xa0, 0x82, 0x00, 0xa0, 0x21, 0x61, 0xec,
+    0xe2, 0x44, 0x04, 0xc1, 0x19, 0x9e, 0xc0, 0x00, 0xfe, 0xff, 0xa8, 0x02, 0xcc, 0xa0, 0x17, 0xec,
+    0xcd, 0x9c, 0x01, 0xff, 0xc9, 0x10, 0x30, 0x21, 0x05, 0x04, 0xcc, 0x00, 0x06, 0x44, 0xa0, 0x40,
+    0x00, 0x3d, 0x04, 0x48, 0x06, 0x66, 0x7a, 0xd8, 0x06, 0x1c, 0xed, 0x20, 0x02, 0x7c, 0x80, 0x83,
+    0x7b, 0x80, 0x7f, 0xf8, 0xcc, 0x02, 0x10, 0x15, 0x04, 0x10, 0x05, 0x01, 0x0b, 0x0f, 0x67, 0x12,
+    0x20, 0x26, 0x08, 0xcc, 0xf6, 0x00, 0x04, 0xe1, 0x6d, 0x00, 0x22, 0x3a, 0x64, 0x01, 0x57, 0xf9,
+    0x01, 0x7e, 0x00, 0x1d, 0xc0, 0x0f, 0xfe, 0x48, 0x81, 0x81, 0x08, 0x28, 0x26, 0x60, 0x00, 0x32,
+    0x25, 0x02, 0x00, 0x00, 0x9b, 0x60, 0x03, 0xd1, 0x8c, 0x20, 0x1d, 0x18, 0xc2, 0x00, 0x4f, 0x96,
+    0xd8, 0x6f, 0x70, 0x0f, 0xff, 0x19, 0x80, 0x42, 0x02, 0xa0, 0x82, 0x00, 0xa0, 0x21, 0x61, 0xec,
+    0xe2, 0x44, 0x04, 0xc1, 0x19, 0x9e, 0xc0, 0x00, 0x1e, 0xd0, 0x06, 0x98, 0x13, 0x00, 0xff, 0x4c,
+    0x09, 0x82, 0xfd, 0xed, 0x77, 0x00, 0x3f, 0xf9, 0x22, 0x06, 0x04, 0x20, 0xa0, 0x99, 0x80, 0x00,
+    0xc8, 0x94, 0x08, 0x00, 0x00, 0xba, 0x9f, 0xcc, 0x02, 0x51, 0x98, 0x93, 0x00, 0x97, 0xcf, 0xd8,
+    0x00, 0x9f, 0x20, 0x13, 0x7b, 0x80, 0x7f, 0xf8, 0xcc, 0x02, 0x10, 0x15, 0x04, 0x10, 0x05, 0x01,
+    0x0b, 0x0f, 0x67, 0x12, 0x20, 0x26, 0x08, 0xcc, 0xf6, 0x00, 0x00, 0x5e, 0xa7, 0xb8, 0x0a, 0x44,
+    0xb3, 0x80, 0xfa, 0xec, 0x82, 0xfc, 0x00, 0x3b, 0x80, 0x1f, 0xfc, 0x91, 0x03, 0x02, 0x10, 0x50,
+    0x4c, 0xc0, 0x00, 0x64, 0x4a, 0x04, 0x00, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0xe2, 0x00,
+    0x60, 0x40, 0x0b, 0x00, 0x88, 0x65, 0x91, 0x68, 0x2a, 0x1a, 0x86, 0xe8, 0x38, 0x00, 0x1b, 0xb0,
+    0x2f, 0x10, 0x06, 0xd0, 0xc0, 0x0f, 0x51, 0x48, 0x04, 0x00, 0x5f, 0x80, 0x07, 0x70, 0x03, 0xff,
+    0x92, 0x20, 0x60, 0x42, 0x0a, 0x09, 0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0x1b, 0xb8, 0x22, 0x80,
+    0x0d, 0xa0, 0x60, 0x1b, 0x8a, 0xc0, 0x00, 0xe3, 0x73, 0x00, 0xfe, 0x2d, 0xcd, 0x10, 0x0f, 0xcf,
+    0x17, 0x0a, 0x01, 0xb7, 0xcc, 0x17, 0x3f, 0xc8, 0x09, 0xf8, 0xa0, 0x80, 0x07, 0x04, 0x00, 0x60,
+    0x26, 0x06, 0x00, 0x90, 0x10, 0x81, 0x86, 0x28, 0x28, 0x20, 0x20, 0x28, 0x20, 0x20, 0x98, 0x96,
+    0x07, 0x86, 0x18, 0x18, 0x01, 0x01, 0xd4, 0x50, 0x4d, 0x41, 0x00, 0x18, 0x18, 0x68, 0x0a, 0x9e,
+    0x16, 0x00, 0x40, 0x70, 0xc0, 0xc0, 0x70, 0x30, 0x08, 0xc4, 0x10, 0x10, 0x05, 0x00, 0x32, 0x00,
+    0x90, 0x18, 0x03, 0x00, 0x00, 0x00, 0xd9, 0xee, 0x01, 0xf4, 0x8d, 0xc1, 0x80, 0x7a, 0x75, 0x3c,
+    0xc0, 0x2c, 0xf2, 0x0a, 0xf4, 0x08, 0xf6, 0xb0, 0x40, 0x40, 0xc0, 0x40, 0x75, 0x0c, 0x21, 0x12,
+    0x01, 0x90, 0x90, 0xa2, 0x02, 0x4d, 0x41, 0x40, 0x0e, 0x34, 0x6a, 0x12, 0x16, 0x00, 0xd0, 0x3b,
+    0x22, 0x18, 0x98, 0x01, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x92, 0x0c, 0x03, 0x8e, 0xc3,
+    0x0c, 0x03, 0x0e, 0xc6, 0x88, 0x02, 0xbe, 0x88, 0x0a, 0xfe, 0xa0, 0x1c, 0x80, 0x58, 0x2c, 0x9c,
+    0x20, 0x20, 0x1c, 0x42, 0x05, 0x51, 0x86, 0x00, 0x28, 0x0b, 0x08, 0x00, 0xcc, 0x40, 0x4c, 0x01,
+    0xd4, 0x14, 0x01, 0xe1, 0x00, 0xff, 0xe5, 0x80, 0x00, 0x57, 0xc8, 0x06, 0x64, 0xb6, 0x60, 0x04,
+    0xdc, 0x9e, 0xc0, 0x0b, 0xf2, 0x00, 0x7f, 0x06, 0x82, 0x82, 0x03, 0x83, 0x05, 0x86, 0x85, 0x00,
+    0x14, 0xc9, 0xc8, 0xc0, 0x1c, 0x16, 0x2a, 0x01, 0x20, 0xb0, 0x50, 0x06, 0x70, 0x32, 0x00, 0xdc,
+    0x16, 0x01, 0x0c, 0x48, 0xb0, 0x04, 0x6e, 0x76, 0x20, 0x10, 0x00, 0x56, 0x06, 0xd0, 0x07, 0xff,
+    0x06, 0xb0, 0x36, 0x80, 0x15, 0xf0, 0x01, 0x4f, 0xd4, 0x03, 0x90, 0x0b, 0x05, 0x93, 0x84, 0x04,
+    0x03, 0x88, 0x40, 0xaa, 0x30, 0xc0, 0x05, 0x01, 0x61, 0x00, 0x19, 0x88, 0x09, 0x80, 0x3a, 0x82,
+    0x80, 0x3c, 0x20, 0x1f, 0xfc, 0xb0, 0x00, 0xd9, 0xa0, 0x1c, 0xa7, 0xe0, 0x1c, 0xbe, 0x40, 0x08,
+    0xff, 0xf6, 0xe9, 0x13, 0x08, 0x0a, 0xdd, 0xd2, 0x21, 0xc0, 0x1b, 0xc2, 0x48, 0x02, 0xa2, 0x56,
+    0x00, 0x99, 0x4a, 0x80, 0x23, 0x90, 0xf0, 0x0d, 0xc1, 0x44, 0x01, 0x49, 0x07, 0x5d, 0xd4, 0x60,
+    0x04, 0x4e, 0x00, 0x00, 0xa3, 0xcc, 0x02, 0x17, 0x93, 0x00, 0x87, 0xd8, 0x00, 0xdf, 0xfc, 0x4a,
+    0xee, 0x50, 0x13, 0x34, 0x41, 0x82, 0x84, 0x01, 0x47, 0x28, 0x00, 0x65, 0x53, 0x00, 0x0e, 0x40,
+    0xa2, 0x02, 0xa0, 0x07, 0x78, 0xc0, 0x00, 0xab, 0x40, 0x3f, 0xf8, 0x55, 0xa0, 0x14, 0x7f, 0xfb,
+    0x74, 0x89, 0x84, 0x05, 0x6e, 0xe9, 0x10, 0xe0, 0x0d, 0xe1, 0x24, 0x01, 0x51, 0x2b, 0x00, 0x4c,
+    0xa5, 0x40, 0x11, 0xc8, 0x78, 0x06, 0xe0, 0xa2, 0x00, 0xa4, 0x83, 0xae, 0xea, 0x30, 0x02, 0x27,
+    0x00, 0x00, 0x37, 0x18, 0x07, 0xfc, 0xdc, 0x60, 0x06, 0xff, 0xe2, 0x57, 0x72, 0x80, 0x99, 0xa2,
+    0x0c, 0x14, 0x20, 0x0a, 0x39, 0x40, 0x03, 0x2a, 0x98, 0x00, 0x72, 0x05, 0x10, 0x15, 0x00, 0x3b,
+    0xc6, 0x00, 0x00, 0x39, 0x8b, 0x88, 0x04, 0x3b, 0xb0, 0x80, 0x4d, 0x17, 0x40, 0x08, 0xff, 0x4c,
+    0x7f, 0xb7, 0x48, 0x98, 0x40, 0x56, 0xee, 0x91, 0x0e, 0x00, 0xde, 0x12, 0x40, 0x15, 0x12, 0xb0,
+    0x04, 0xca, 0x54, 0x01, 0x1c, 0x87, 0x80, 0x6e, 0x0a, 0x20, 0x0a, 0x48, 0x3a, 0xee, 0xa3, 0x00,
+    0x22, 0x70, 0x08, 0xd3, 0xf4, 0x00, 0x40, 0xe3, 0xa0, 0x05, 0x9f, 0x00, 0x06, 0xff, 0xe2, 0x57,
+    0x72, 0x80, 0x99, 0xa2, 0x0c, 0x14, 0x20, 0x0a, 0x39, 0x40, 0x03, 0x2a, 0x98, 0x00, 0x72, 0x05,
+    0x10, 0x15, 0x00, 0x3b, 0xc6, 0x00, 0x0a, 0xfe, 0x45, 0x19, 0x10, 0x67, 0x00, 0xff, 0xe8, 0x00,
+    0x00, 0xb3, 0xfc, 0x20, 0x1c, 0x46, 0x00, 0x70, 0x0e, 0x50, 0x50, 0xd0, 0x0e, 0xb0, 0x91, 0x41,
+    0x00, 0x84, 0xc4, 0xd0, 0x1c, 0x02, 0x60, 0x40, 0xc0, 0xd0, 0x0a, 0xc1, 0xa7, 0x01, 0x04, 0x04,
+    0xc0, 0xd9, 0x40, 0x08, 0x0c, 0x0b, 0xff, 0x40, 0x70, 0x58, 0x78, 0x04, 0xc0, 0x81, 0x9e, 0xa9,
+    0xb0, 0x3f, 0xe0, 0x0d, 0x1e, 0xa2, 0x01, 0xff, 0xc4, 0x8f, 0x51, 0x00, 0x80, 0x05, 0xdf, 0xe7,
+    0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40, 0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26,
+    0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x06, 0xa0, 0x01, 0xf0, 0x00, 0x8c, 0x90, 0x0d, 0x19, 0x20, 0x00,
+    0x00, 0xaf, 0x00, 0x3f, 0x08, 0x07, 0xd7, 0xa0, 0x19, 0x3f, 0xf6, 0xb0, 0x06, 0x26, 0x52, 0x95,
+    0x00, 0x92, 0x6a, 0x03, 0x00, 0x3c, 0x21, 0xc0, 0x12, 0xbc, 0xc2, 0x30, 0x04, 0x70, 0xc2, 0x23,
+    0x00, 0x9b, 0xfd, 0x2b, 0xe0, 0x1e, 0x70, 0x20, 0x09, 0x22, 0x70, 0x10, 0x02, 0x27, 0x63, 0x6a,
+    0x00, 0x00, 0xff, 0x8b, 0x9c, 0x00, 0xbf, 0x00, 0x1f, 0x8b, 0x9c, 0x03, 0xff, 0x80, 0x37, 0xf8,
+    0x40, 0x13, 0x02, 0x1f, 0x80, 0x49, 0x76, 0x32, 0x40, 0x01, 0x80, 0x10, 0x04, 0x00, 0x60, 0x04,
+    0x01, 0x00, 0x25, 0xd8, 0xc9, 0x00, 0x0e, 0x08, 0x7e, 0x00, 0x4f, 0xfd, 0xac, 0x01, 0x89, 0x94,
+    0xa5, 0x40, 0x24, 0x9a, 0x80, 0xc0, 0x0f, 0x08, 0x70, 0x04, 0xaf, 0x30, 0x8c, 0x01, 0x1c, 0x30,
+    0x88, 0xc0, 0x26, 0xff, 0x4a, 0xf8, 0x07, 0x9c, 0x08, 0x02, 0x48, 0x9c, 0x04, 0x00, 0x89, 0xd8,
+    0xda, 0x81, 0x3f, 0xf7, 0x48, 0x80, 0x6a, 0xc0, 0x0f, 0x84, 0x40, 0x1f, 0x5e, 0x80, 0x60, 0x5f,
+    0x80, 0x0f, 0xfe, 0x58, 0xdf, 0xe1, 0x00, 0x4c, 0x08, 0x7e, 0x01, 0x25, 0xd8, 0xc9, 0x00, 0x06,
+    0x00, 0x40, 0x10, 0x01, 0x80, 0x10, 0x04, 0x00, 0x97, 0x63, 0x24, 0x00, 0x38, 0x21, 0xf8, 0x2f,
+    0xc5, 0xfe, 0x10, 0x06, 0xdb, 0x00, 0xf0, 0x80, 0x60, 0x4f, 0xfd, 0xac, 0x01, 0x89, 0x94, 0xa5,
+    0x40, 0x24, 0x9a, 0x80, 0xc0, 0x0f, 0x08, 0x70, 0x04, 0xaf, 0x30, 0x8c, 0x01, 0x1c, 0x30, 0x88,
+    0xc0, 0x26, 0xff, 0x4a, 0xf8, 0x07, 0x9c, 0x08, 0x02, 0x48, 0x9c, 0x04, 0x00, 0x89, 0xd8, 0xda,
+    0x81, 0x3f, 0xf7, 0x48, 0x80, 0x57, 0xfe, 0xe0, 0x0e, 0x9c, 0xc8, 0x02, 0x00, 0x5f, 0x80, 0x0f,
+    0xfe, 0x58, 0xdf, 0xe1, 0x00, 0x4c, 0x08, 0x7e, 0x01, 0x25, 0xd8, 0xc9, 0x00, 0x06, 0x00, 0x40,
+    0x10, 0x01, 0x80, 0x10, 0x04, 0x00, 0x97, 0x63, 0x24, 0x00, 0x38, 0x21, 0xf8, 0x2f, 0xc5, 0xfe,
+    0x10, 0x05, 0xbf, 0xec, 0x00, 0xdf, 0x98, 0xe0, 0x00, 0x00, 0xff, 0xe1, 0x17, 0xc8, 0x07, 0xd0,
+    0x72, 0x01, 0xc7, 0x68, 0x54, 0x40, 0x12, 0xe2, 0x18, 0x2e, 0x90, 0x0d, 0x85, 0xef, 0x30, 0x48,
+    0x20, 0xaa, 0x00, 0x25, 0x88, 0x34, 0x34, 0x03, 0x4c, 0x80, 0x21, 0x00, 0xfb, 0x83, 0xc0, 0x34,
+    0x40, 0x1c, 0x18, 0xc0, 0x10, 0xe8, 0x03, 0x21, 0x98, 0xe7, 0x0f, 0x00, 0x35, 0x19, 0x85, 0x30,
+    0xc0, 0x25, 0xc4, 0x7b, 0x30, 0x0f, 0x5a, 0xa0, 0x07, 0xd8, 0x2a, 0x01, 0x00, 0x00, 0x8f, 0xe0,
+    0x03, 0x42, 0x40, 0x06, 0xbb, 0x00, 0x45, 0x7f, 0xae, 0x00, 0xc4, 0x50, 0x87, 0x61, 0x6a, 0xc4,
+    0xff, 0x06, 0x00, 0xdc, 0x08, 0x18, 0x01, 0x0f, 0x02, 0x85, 0xae, 0x51, 0x8f, 0xa4, 0x60, 0x26,
+    0xca, 0x3c, 0x80, 0x09, 0x54, 0x30, 0x0d, 0x62, 0x60, 0x00, 0x00, 0x17, 0x38, 0x07, 0xef, 0x00,
+    0xf1, 0x74, 0x00, 0x64, 0xff, 0xba, 0xd0, 0x03, 0x0a, 0x12, 0x5c, 0x00, 0x49, 0x79, 0xa2, 0xe4,
+    0x01, 0xc5, 0x20, 0xa0, 0x1e, 0x30, 0xd0, 0x0f, 0xfe, 0x19, 0x86, 0x80, 0x71, 0x48, 0x28, 0x01,
+    0x2b, 0x34, 0x5c, 0x80, 0x02, 0xa4, 0x97, 0x00, 0x00, 0x00, 0xff, 0x5e, 0x80, 0x7c, 0x21, 0x9e,
+    0x20, 0x0b, 0xc0, 0x0f, 0xfe, 0x0a, 0x6f, 0x48, 0x04, 0x56, 0x4e, 0xa6, 0x00, 0x50, 0x79, 0xc0,
+    0x0b, 0x83, 0x40, 0x08, 0x00, 0xe0, 0xd0, 0x02, 0x00, 0x14, 0x1e, 0x70, 0x02, 0x2b, 0x27, 0x54,
+    0x00, 0x00, 0x4f, 0xfb, 0xad, 0x00, 0x30, 0xa1, 0x25, 0xc0, 0x04, 0x97, 0x9a, 0x2e, 0x40, 0x1c,
+    0x52, 0x0a, 0x01, 0xe3, 0x0d, 0x00, 0xff, 0xe1, 0x98, 0x68, 0x07, 0x14, 0x82, 0x80, 0x12, 0xb3,
+    0x45, 0xc8, 0x00, 0x2a, 0x49, 0x70, 0x09, 0xff, 0x75, 0xa0, 0x07, 0x66, 0x00, 0x3f, 0xf8, 0x99,
+    0x80, 0x0c, 0x00, 0x00, 0xec, 0xf1, 0x00, 0xff, 0xe2, 0xa6, 0xf4, 0x80, 0x45, 0x64, 0xea, 0x60,
+    0x05, 0x07, 0x9c, 0x00, 0xb8, 0x34, 0x00, 0x80, 0x0e, 0x0d, 0x00, 0x20, 0x01, 0x41, 0xe7, 0x00,
+    0x22, 0xb2, 0x75, 0x40, 0x09, 0x37, 0xa6, 0xfc, 0x40, 0x03, 0xd2, 0x01, 0xe3, 0x00, 0xc0, 0x4f,
+    0xfb, 0xad, 0x00, 0x30, 0xa1, 0x25, 0xc0, 0x04, 0x97, 0x9a, 0x2e, 0x40, 0x1c, 0x52, 0x0a, 0x01,
+    0xe3, 0x0d, 0x00, 0xff, 0xe1, 0x98, 0x68, 0x07, 0x14, 0x82, 0x80, 0x12, 0xb3, 0x45, 0xc8, 0x00,
+    0x2a, 0x49, 0x70, 0x09, 0xff, 0x75, 0xa0, 0x06, 0xdf, 0xf6, 0x80, 0x77, 0xe6, 0x3c, 0x02, 0x00,
+    0x00, 0xec, 0xf1, 0x00, 0xff, 0xe2, 0xa6, 0xf4, 0x80, 0x45, 0x64, 0xea, 0x60, 0x05, 0x07, 0x9c,
+    0x00, 0xb8, 0x34, 0x00, 0x80, 0x0e, 0x0d, 0x00, 0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x75,
+    0x40, 0x09, 0x37, 0xa6, 0xfc, 0x40, 0x1f, 0xf5, 0x00, 0x6c, 0xca, 0x00, 0x00, 0x4f, 0xfb, 0xad,
+    0x00, 0x30, 0xa1, 0x25, 0xc0, 0x04, 0x97, 0x9a, 0x2e, 0x40, 0x1c, 0x52, 0x0a, 0x01, 0xe3, 0x0d,
+    0x00, 0xff, 0xe1, 0x98, 0x68, 0x07, 0x14, 0x82, 0x80, 0x12, 0xb3, 0x45, 0xc8, 0x00, 0x2a, 0x49,
+    0x70, 0x09, 0xfe, 0xba, 0xb4, 0x00, 0xc3, 0x78, 0x01, 0xe5, 0x09, 0x00, 0xc0, 0x00, 0xec, 0xf1,
+    0x00, 0xff, 0xe2, 0xa6, 0xf4, 0x80, 0x45, 0x64, 0xea, 0x60, 0x05, 0x07, 0x9c, 0x00, 0xb8, 0x34,
+    0x00, 0x80, 0x0e, 0x0d, 0x00, 0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x75, 0x40, 0x09, 0x36,
+    0xea, 0xfc, 0x40, 0x09, 0x4c, 0x01, 0xc6, 0x2a, 0x01, 0x00, 0x4f, 0xfb, 0xad, 0x00, 0x30, 0xa1,
+    0x25, 0xc0, 0x04, 0x97, 0x9a, 0x2e, 0x40, 0x1c, 0x52, 0x0a, 0x01, 0xe3, 0x0d, 0x00, 0xff, 0xe1,
+    0x98, 0x68, 0x07, 0x14, 0x82, 0x80, 0x12, 0xb3, 0x45, 0xc8, 0x00, 0x2a, 0x49, 0x70, 0x09, 0xff,
+    0x75, 0xa0, 0x06, 0x3f, 0xf1, 0x00, 0x61, 0xe7, 0x77, 0x80, 0x40, 0x00, 0xec, 0xf1, 0x00, 0xff,
+    0xe2, 0xa6, 0xf4, 0x80, 0x45, 0x64, 0xea, 0x60, 0x05, 0x07, 0x9c, 0x00, 0xb8, 0x34, 0x00, 0x80,
+    0x0e, 0x0d, 0x00, 0x20, 0x01, 0x41, 0xe7, 0x00, 0x22, 0xb2, 0x75, 0x40, 0x09, 0x37, 0xe2, 0xfc,
+    0x40, 0x0d, 0xde, 0x20, 0x11, 0x4d, 0x2d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x7a, 0x45, 0xc0, 0x3d,
+    0xae, 0x01, 0xd7, 0xfe, 0xe0, 0x0d, 0x39, 0x90, 0x01, 0x3f, 0x73, 0x1b, 0xee, 0x00, 0x14, 0x4c,
+    0x40, 0x04, 0xbb, 0xca, 0x01, 0xfe, 0x4a, 0xac, 0x20, 0x01, 0x55, 0xc0, 0x12, 0xff, 0xe1, 0x00,
+    0xff, 0x25, 0xde, 0x50, 0x00, 0xa2, 0x62, 0x00, 0x02, 0xe8, 0x00, 0xc5, 0x4a, 0x20, 0x19, 0x34,
+    0x40, 0x22, 0xff, 0x9c, 0x00, 0x59, 0x93, 0x00, 0x0a, 0x33, 0x90, 0x07, 0x15, 0x86, 0x95, 0x86,
+    0x27, 0x42, 0x78, 0x27, 0xf8, 0x0b, 0x82, 0x33, 0x11, 0x2c, 0x13, 0x73, 0x1e, 0x38, 0xae, 0x8f,
+    0x00, 0x00, 0xd5, 0x60, 0x1c, 0x8b, 0x20, 0x1c, 0x9e, 0x40, 0x1a, 0xff, 0xdc, 0x01, 0xa7, 0x32,
+    0x00, 0x27, 0xee, 0x63, 0x7d, 0xc0, 0x02, 0x89, 0x88, 0x00, 0x97, 0x79, 0x40, 0x3f, 0xc9, 0x55,
+    0x84, 0x00, 0x2a, 0xb8, 0x02, 0x5f, 0xfc, 0x20, 0x1f, 0xe4, 0xbb, 0xca, 0x00, 0x14, 0x4c, 0x40,
+    0x00, 0x8f, 0xd4, 0x03, 0x4b, 0xa8, 0x06, 0xa8, 0x00, 0x8b, 0xfe, 0x70, 0x01, 0x66, 0x4c, 0x00,
+    0x28, 0xce, 0x40, 0x1c, 0x56, 0x1a, 0x56, 0x18, 0x9d, 0x09, 0xe0, 0x9f, 0xe0, 0x2e, 0x08, 0xcc,
+    0x44, 0xb0, 0x4d, 0xcc, 0x78, 0xe2, 0xba, 0x3c, 0x00, 0x4f, 0xff, 0x38, 0x00, 0x51, 0x31, 0x00,
+    0x12, 0xef, 0x28, 0x07, 0xf9, 0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc,
+    0x97, 0x79, 0x40, 0x02, 0x89, 0x89, 0x3f, 0xfc, 0xe0, 0x02, 0xef, 0x30, 0x0d, 0xcf, 0x1a, 0x20,
+    0x00, 0x02, 0xbf, 0xd5, 0x01, 0xc5, 0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0,
+    0x8c, 0xc4, 0x4b, 0x04, 0xdc, 0xc7, 0x8e, 0x2b, 0xa3, 0xc0, 0x1d, 0xf7, 0x20, 0x02, 0x8e, 0xd0,
+    0x09, 0x1f, 0x02, 0x40, 0x4f, 0xff, 0x38, 0x00, 0x51, 0x31, 0x00, 0x12, 0xef, 0x28, 0x07, 0xf9,
+    0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc, 0x97, 0x79, 0x40, 0x02, 0x89,
+    0x89, 0x3f, 0xfc, 0xe0, 0x08, 0xc5, 0xc2, 0x00, 0x9e, 0x24, 0x08, 0x00, 0x02, 0xbf, 0xd5, 0x01,
+    0xc5, 0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0, 0x8c, 0xc4, 0x4b, 0x04, 0xdc,
+    0xc7, 0x8e, 0x2b, 0xa3, 0xc0, 0x1d, 0xff, 0x40, 0x00, 0x76, 0x5a, 0x80, 0x0e, 0xee, 0x8f, 0x00,
+    0x00, 0x69, 0x8e, 0x90, 0x05, 0x1b, 0xf4, 0x40, 0x9f, 0x42, 0x28, 0xf7, 0x00, 0x0a, 0x26, 0x20,
+    0x02, 0x5d, 0xe5, 0x00, 0xff, 0x25, 0x56, 0x10, 0x00, 0xaa, 0xe0, 0x09, 0x7f, 0xf0, 0x80, 0x7f,
+    0x92, 0xef, 0x28, 0x00, 0x51, 0x31, 0x27, 0xfa, 0x97, 0xbd, 0xc0, 0x24, 0x28, 0x00, 0xe9, 0x5c,
+    0x00, 0x00, 0x06, 0xc0, 0x8b, 0x00, 0x33, 0xfb, 0x40, 0x05, 0x7f, 0xc6, 0x00, 0x2b, 0xfd, 0x50,
+    0x06, 0x2b, 0x0d, 0x2b, 0x0c, 0x4e, 0x84, 0xf8, 0x4f, 0xf0, 0x10, 0x84, 0x66, 0x5b, 0x61, 0x82,
+    0xfb, 0x26, 0xe9, 0xb6, 0x10, 0x11, 0xa5, 0x3c, 0x40, 0x02, 0xb8, 0x20, 0x08, 0x68, 0x88, 0x00,
+    0x00, 0xb2, 0xc0, 0x3e, 0x70, 0x0f, 0x66, 0x00, 0x24, 0xff, 0xf2, 0x00, 0x05, 0x13, 0x38, 0x01,
+    0x2e, 0xf1, 0x80, 0x7f, 0x92, 0xab, 0x00, 0x42, 0xab, 0x80, 0x25, 0xff, 0xc0, 0x1f, 0xfc, 0xd0,
+    0x02, 0xe7, 0x00, 0xf8, 0xb9, 0xc0, 0x05, 0x9f, 0x01, 0x66, 0x98, 0x06, 0x10, 0x9c, 0xa1, 0x91,
+    0x24, 0x0d, 0x8e, 0xe0, 0xb4, 0x00, 0xff, 0xe4, 0x00, 0x00, 0xff, 0xe0, 0xff, 0xd4, 0x01, 0xec,
+    0xca, 0x00, 0x38, 0xe3, 0x75, 0x04, 0x01, 0x2e, 0x21, 0x82, 0xe9, 0x80, 0xd8, 0x5e, 0xf4, 0x07,
+    0x82, 0x0a, 0xa0, 0x01, 0xee, 0x03, 0x43, 0x00, 0x0f, 0x19, 0x80, 0x0f, 0x4b, 0xbc, 0x3a, 0x18,
+    0x00, 0xef, 0x10, 0x14, 0x15, 0x40, 0x03, 0x8a, 0x00, 0xc0, 0x5e, 0xea, 0x02, 0x40, 0x0d, 0x88,
+    0x66, 0x5d, 0x20, 0x00, 0x00, 0xfe, 0x1f, 0xfa, 0x40, 0x21, 0xcc, 0xa0, 0x02, 0x4e, 0xda, 0xdf,
+    0x11, 0x59, 0xc9, 0x98, 0x00, 0xc1, 0x2f, 0x42, 0x00, 0xe0, 0x20, 0x02, 0x80, 0x38, 0x34, 0x00,
+    0x80, 0x05, 0x07, 0x9c, 0x00, 0x8a, 0xc9, 0xd4, 0xc0, 0x27, 0xfe, 0x92, 0x01, 0x16, 0x61, 0xe8,
+    0x50, 0x06, 0xca, 0x11, 0x68, 0x00, 0x00, 0x8b, 0x9c, 0x03, 0xc2, 0x01, 0xf8, 0xf9, 0xc0, 0x24,
+    0xfa, 0x00, 0x97, 0xe4, 0x03, 0xff, 0xa2, 0x97, 0x74, 0x80, 0x61, 0x44, 0x8c, 0x03, 0x2f, 0xfd,
+    0x40, 0x1f, 0xfd, 0x10, 0x3e, 0x60, 0x0f, 0xf8, 0xf9, 0x80, 0x32, 0xfc, 0x00, 0x7f, 0xf2, 0x06,
+    0xbf, 0x08, 0x00, 0xcc, 0x13, 0x90, 0x02, 0x67, 0x82, 0x80, 0x0c, 0x04, 0x40, 0x1f, 0xfc, 0xa0,
+    0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x3f, 0xfa, 0x29, 0x77, 0x48, 0x06, 0x14, 0x48, 0xc0, 0x32, 0xff,
+    0xd4, 0x01, 0xff, 0xd1, 0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x22, 0xe7, 0x00, 0xf0, 0x80, 0x7e, 0x3e,
+    0x70, 0x08, 0x5f, 0x80, 0x0f, 0xfe, 0x40, 0xd7, 0xe1, 0x00, 0x19, 0x82, 0x72, 0x00, 0x4c, 0xf0,
+    0x50, 0x01, 0x80, 0x88, 0x03, 0xff, 0x94, 0xbf, 0x00, 0x0e, 0xe0, 0x00, 0x76, 0x40, 0x38, 0xc0,
+    0x38, 0x7a, 0x40, 0x00, 0x00, 0x3f, 0x0d, 0x60, 0x06, 0xf0, 0x08, 0x40, 0x34, 0x70, 0xd6, 0x80,
+    0x13, 0xe8, 0x02, 0x5f, 0x90, 0x0f, 0xfe, 0x8a, 0x5d, 0xd2, 0x01, 0x85, 0x12, 0x30, 0x0c, 0xbf,
+    0xf5, 0x00, 0x7f, 0xf4, 0x40, 0x8d, 0x0b, 0xb0, 0x04, 0x20, 0x13, 0x80, 0x53, 0xa1, 0x78, 0x01,
+    0x97, 0xe0, 0x03, 0xff, 0x96, 0x35, 0xf8, 0x40, 0x13, 0x30, 0x4e, 0x40, 0x24, 0xcf, 0x05, 0x00,
+    0x8c, 0x04, 0x40, 0x1f, 0xfc, 0xd0, 0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x3f, 0xfa, 0x29, 0x77, 0x48,
+    0x06, 0x14, 0x48, 0xc0, 0x32, 0xff, 0xd4, 0x01, 0xff, 0xd1, 0x43, 0xf0, 0x09, 0x7e, 0x43, 0xac,
+    0x80, 0x38, 0x78, 0x88, 0x01, 0xc0, 0x5f, 0x80, 0x0f, 0xfe, 0x40, 0xd7, 0xe1, 0x00, 0x19, 0x82,
+    0x72, 0x00, 0x4c, 0xf0, 0x50, 0x01, 0x80, 0x88, 0x03, 0xff, 0x94, 0xa3, 0x80, 0x0e, 0xe0, 0x65,
+    0x88, 0x04, 0x5e, 0x82, 0x01, 0x00, 0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x3f, 0xfa, 0x29, 0x77, 0x48,
+    0x06, 0x14, 0x48, 0xc0, 0x32, 0xff, 0xd4, 0x01, 0xff, 0xd1, 0x4f, 0xa0, 0x09, 0x7e, 0x40, 0x0d,
+    0xa5, 0x36, 0x01, 0x99, 0xf5, 0x64, 0x00, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x40, 0xd7, 0xe1, 0x00,
+    0x19, 0x82, 0x72, 0x00, 0x4c, 0xf0, 0x50, 0x01, 0x80, 0x88, 0x03, 0xff, 0x94, 0xbf, 0x00, 0x0e,
+    0xe0, 0x27, 0x13, 0xe8, 0x01, 0x1b, 0x6a, 0x40, 0x04, 0xfa, 0x00, 0xff, 0xf1, 0xa7, 0xd0, 0x0e,
+    0x4a, 0xdb, 0xb7, 0x5e, 0x80, 0x03, 0xe6, 0x00, 0xf8, 0xf9, 0x80, 0x0b, 0xf0, 0x01, 0xff, 0xd4,
+    0x5f, 0x80, 0x2d, 0x96, 0x95, 0x41, 0x8c, 0x00, 0x00, 0x16, 0xa8, 0x05, 0x2e, 0xa0, 0x15, 0xd0,
+    0x02, 0x74, 0x2f, 0x00, 0x40, 0x3a, 0x27, 0xc7, 0x00, 0x3f, 0xfd, 0x60, 0x00, 0x1e, 0xa0, 0x03,
+    0xd1, 0x13, 0x98, 0x5a, 0x31, 0x00, 0x0d, 0x68, 0x65, 0x82, 0xfc, 0x00, 0x7f, 0xf4, 0xc0, 0x00,
+    0xcf, 0xe8, 0x01, 0xc3, 0x10, 0x40, 0x0e, 0x1f, 0x70, 0x09, 0x3e, 0x80, 0x03, 0xde, 0xa0, 0x1d,
+    0xa2, 0xea, 0x01, 0xa4, 0xd2, 0x00, 0x33, 0x30, 0xac, 0x03, 0x3c, 0x85, 0x80, 0x71, 0x00, 0x20,
+    0x03, 0xd6, 0xc3, 0x20, 0x19, 0x52, 0x05, 0x8c, 0x03, 0x86, 0xc3, 0x80, 0x3c, 0xa8, 0x50, 0x00,
+    0x05, 0xf6, 0x00, 0xe8, 0x66, 0x00, 0x76, 0xc8, 0x07, 0x2f, 0xc0, 0x07, 0xff, 0x36, 0x3e, 0x80,
+    0x33, 0x39, 0xd0, 0x04, 0x92, 0x5a, 0x01, 0x8c, 0x04, 0x40, 0x18, 0xd0, 0xdc, 0x03, 0x25, 0x0c,
+    0x18, 0x06, 0x1a, 0x0e, 0x00, 0x4f, 0xa0, 0x00, 0xf7, 0xa8, 0x07, 0x68, 0xba, 0x80, 0x69, 0x34,
+    0x80, 0x0c, 0xcc, 0x2b, 0x00, 0xcf, 0x21, 0x60, 0x1c, 0x40, 0x08, 0x00, 0xf5, 0xb0, 0xc8, 0x06,
+    0x54, 0x81, 0x63, 0x00, 0xe1, 0xb0, 0xe0, 0x0f, 0x2a, 0x14, 0x27, 0xd0, 0x05, 0x7f, 0x00, 0x12,
+    0xf2, 0x00, 0x7f, 0xf0, 0xd7, 0x90, 0x02, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x6c, 0x7d, 0x00, 0x66,
+    0x73, 0xa0, 0x09, 0x24, 0xb4, 0x03, 0x18, 0x08, 0x80, 0x31, 0xa1, 0xb8, 0x06, 0x4a, 0x18, 0x30,
+    0x0c, 0x34, 0x1c, 0x0b, 0xf0, 0x09, 0xfa, 0x01, 0x17, 0x38, 0x07, 0xff, 0x04, 0xb9, 0xc0, 0x20,
+    0x4f, 0xa0, 0x00, 0xf7, 0xa8, 0x07, 0x68, 0xba, 0x80, 0x69, 0x34, 0x80, 0x0c, 0xcc, 0x2b, 0x00,
+    0xcf, 0x21, 0x60, 0x1c, 0x40, 0x08, 0x00, 0xf5, 0xb0, 0xc8, 0x06, 0x54, 0x81, 0x63, 0x00, 0xe1,
+    0xb0, 0xe0, 0x0f, 0x2a, 0x14, 0x27, 0xd0, 0x05, 0x7f, 0x00, 0x05, 0xff, 0x90, 0x03, 0x26, 0x64,
+    0x80, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x6c, 0x7d, 0x00, 0x66, 0x73, 0xa0, 0x09, 0x24, 0xb4, 0x03,
+    0x18, 0x08, 0x80, 0x31, 0xa1, 0xb8, 0x06, 0x4a, 0x18, 0x30, 0x0c, 0x34, 0x1c, 0x0b, 0xf0, 0x09,
+    0xfa, 0x00, 0x2f, 0xfa, 0x00, 0x22, 0xcc, 0xa4, 0x00, 0x00, 0x4f, 0xa0, 0x0f, 0xff, 0x5a, 0x5d,
+    0xd4, 0x00, 0x14, 0x49, 0x53, 0xff, 0xc0, 0x02, 0xe7, 0x00, 0xf7, 0x80, 0x62, 0xe8, 0x00, 0x00,
+    0x5f, 0x80, 0x0f, 0xfe, 0x7a, 0xfc, 0x1f, 0x33, 0x80, 0x13, 0x98, 0x00, 0xfc, 0x5f, 0xf4, 0x00,
+    0x45, 0x99, 0x48, 0x06, 0x7c, 0x91, 0x00, 0xff, 0xf9, 0x25, 0xdd, 0x40, 0x10, 0xa2, 0x4a, 0x09,
+    0xff, 0xe0, 0x08, 0xb9, 0xc0, 0x3e, 0xf0, 0x0e, 0x2e, 0x80, 0x00, 0x00, 0xe3, 0xff, 0x98, 0xf3,
+    0x27, 0x06, 0xcb, 0x10, 0x0f, 0xff, 0x12, 0xfc, 0x00, 0x0f, 0x98, 0x00, 0xe0, 0x19, 0x39, 0x80,
+    0x4f, 0xa0, 0x0f, 0xff, 0x5a, 0x5d, 0xd4, 0x00, 0x14, 0x49, 0x53, 0xff, 0xc0, 0x3f, 0xf4, 0x00,
+    0x07, 0x32, 0x90, 0x00, 0x05, 0xf8, 0x00, 0xff, 0xf1, 0xaf, 0xc0, 0x1f, 0xfc, 0xc7, 0x99, 0x38,
+    0x4f, 0xa0, 0x0f, 0xff, 0x5a, 0x5d, 0xd4, 0x00, 0x14, 0x49, 0x53, 0xff, 0xc0, 0x06, 0xfc, 0x00,
+    0x8e, 0x6c, 0x28, 0x00, 0x05, 0xf8, 0x00, 0xff, 0xf1, 0xaf, 0xc0, 0x02, 0x3e, 0xc1, 0x5f, 0x15,
+    0xc0, 0x00, 0xe2, 0xf9, 0x00, 0xfd, 0x07, 0x20, 0x1f, 0xab, 0x00, 0x32, 0x7f, 0xac, 0x02, 0x1f,
+    0xf7, 0x00, 0x48, 0x20, 0x06, 0x00, 0xf9, 0xc0, 0x16, 0x01, 0xc8, 0x1a, 0x02, 0x68, 0x01, 0x88,
+    0x88, 0x2e, 0x1a, 0x01, 0xca, 0x09, 0xa0, 0xe0, 0x1d, 0x41, 0xe8, 0x62, 0x01, 0xc4, 0x45, 0x0b,
+    0x00, 0xfa, 0x80, 0x0c, 0x01, 0xf2, 0x81, 0x88, 0x04, 0x00, 0x00, 0xe2, 0xf8, 0x00, 0xfd, 0x29,
+    0x00, 0x1f, 0xae, 0xc0, 0x19, 0x7d, 0xeb, 0xa8, 0x6b, 0xb0, 0x40, 0x12, 0x20, 0xbe, 0x26, 0x6b,
+    0x00, 0x25, 0xd0, 0x15, 0xf8, 0x30, 0x00, 0x81, 0x81, 0x80, 0x80, 0x40, 0x3f, 0xfa, 0xa0, 0x00,
+    0xc3, 0xb2, 0x01, 0xfc, 0x60, 0x1f, 0xc3, 0xd2, 0x01, 0x93, 0xfd, 0x60, 0x10, 0xff, 0xb8, 0x02,
+    0x41, 0x00, 0x30, 0x07, 0xce, 0x00, 0xb0, 0x0e, 0x40, 0xd0, 0x13, 0x40, 0x0c, 0x44, 0x41, 0x70,
+    0xd0, 0x0e, 0x50, 0x4d, 0x07, 0x00, 0xea, 0x0f, 0x43, 0x10, 0x0e, 0x22, 0x28, 0x58, 0x07, 0xd4,
+    0x00, 0x60, 0x0f, 0x94, 0x0c, 0x40, 0x20, 0x00, 0xc3, 0xd0, 0x01, 0xf8, 0xc0, 0x3f, 0xc5, 0xd0,
+    0x01, 0x97, 0xde, 0xba, 0x86, 0xbb, 0x04, 0x01, 0x22, 0x0b, 0xe2, 0x66, 0xb0, 0x02, 0x5d, 0x01,
+    0x5f, 0x83, 0x00, 0x08, 0x18, 0x18, 0x08, 0x04, 0x03, 0xff, 0xaa, 0x00, 0x4f, 0xf5, 0x80, 0x43,
+    0xfe, 0xe0, 0x09, 0x04, 0x00, 0xc0, 0x1f, 0x38, 0x02, 0xc0, 0x39, 0x03, 0x40, 0x4d, 0x00, 0x31,
+    0x11, 0x05, 0xc3, 0x40, 0x39, 0x41, 0x34, 0x1c, 0x03, 0xa8, 0x3d, 0x0c, 0x40, 0x38, 0x88, 0xa1,
+    0x60, 0x1f, 0x50, 0x01, 0x80, 0x3e, 0x50, 0x31, 0x00, 0x93, 0xe4, 0x0b, 0xf0, 0x01, 0xfc, 0x01,
+    0x87, 0x64, 0x03, 0xf8, 0xc0, 0x3f, 0x87, 0xa4, 0x03, 0x00, 0x5f, 0x7a, 0xea, 0x1a, 0xec, 0x10,
+    0x04, 0x88, 0x2f, 0x89, 0x9a, 0xc0, 0x09, 0x74, 0x05, 0x7e, 0x0c, 0x00, 0x20, 0x60, 0x60, 0x20,
+    0x10, 0x0f, 0xfe, 0xaa, 0xfc, 0x01, 0x7d, 0x00, 0x3f, 0x40, 0x31, 0x74, 0x00, 0x7f, 0xf1, 0xcb,
+    0xa0, 0x03, 0x00, 0x00, 0x8b, 0x9c, 0x03, 0xf7, 0x80, 0x78, 0xba, 0x00, 0x24, 0xff, 0x08, 0x00,
+    0xfe, 0xc0, 0x2b, 0x00, 0xfc, 0xa6, 0x01, 0xe3, 0x0e, 0x00, 0xf3, 0x30, 0x98, 0x03, 0xd0, 0x32,
+    0xe0, 0x1c, 0x30, 0x10, 0x01, 0xe6, 0x23, 0x00, 0xfb, 0x80, 0x3f, 0x1a, 0x80, 0x00, 0x00, 0x0e,
+    0xc8, 0x07, 0x18, 0x07, 0x0f, 0x48, 0x01, 0x7e, 0x2b, 0xf0, 0x80, 0x0e, 0xc2, 0x72, 0x00, 0x4c,
+    0xf0, 0x50, 0x01, 0x80, 0x88, 0x03, 0xff, 0x94, 0x00, 0x4f, 0xf0, 0x80, 0x0f, 0xec, 0x02, 0xb0,
+    0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09, 0x80, 0x3d, 0x03, 0x2e, 0x01, 0xc3, 0x01,
+    0x00, 0x1e, 0x62, 0x30, 0x0f, 0xb8, 0x03, 0xf1, 0xa8, 0x01, 0x3e, 0x80, 0x2a, 0xfb, 0x00, 0x8b,
+    0x9c, 0x03, 0xf7, 0x80, 0x78, 0xba, 0x00, 0x20, 0x5f, 0x8a, 0xfc, 0x20, 0x03, 0xb0, 0x9c, 0x80,
+    0x13, 0x3c, 0x14, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x2f, 0xc0, 0x03, 0xb8, 0x00, 0x1d, 0x90,
+    0x0e, 0x30, 0x0e, 0x1e, 0x90, 0x00, 0x4f, 0xf0, 0x80, 0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60,
+    0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09, 0x80, 0x3d, 0x03, 0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x62,
+    0x30, 0x0f, 0xb8, 0x03, 0xf1, 0xa8, 0x01, 0x3e, 0x80, 0x2a, 0xfb, 0x00, 0x0f, 0xfd, 0x00, 0x18,
+    0x73, 0x29, 0x00, 0x00, 0x5f, 0x8a, 0xfc, 0x20, 0x03, 0xb0, 0x9c, 0x80, 0x13, 0x3c, 0x14, 0x00,
+    0x60, 0x22, 0x00, 0xff, 0xe5, 0x2f, 0xc0, 0x03, 0xb8, 0x00, 0xff, 0xa8, 0x02, 0xcc, 0xa0, 0x00,
+    0x4f, 0xf0, 0x80, 0x0f, 0xec, 0x02, 0xb0, 0x0f, 0xca, 0x60, 0x1e, 0x30, 0xe0, 0x0f, 0x33, 0x09,
+    0x80, 0x3d, 0x03, 0x2e, 0x01, 0xc3, 0x01, 0x00, 0x1e, 0x62, 0x30, 0x0f, 0xb8, 0x03, 0xf1, 0xa8,
+    0x01, 0x3e, 0x80, 0x2a, 0xfb, 0x00, 0x9b, 0xf0, 0x03, 0x8e, 0x6c, 0x28, 0x00, 0x00, 0x5f, 0x8a,
+    0xfc, 0x20, 0x03, 0xb0, 0x9c, 0x80, 0x13, 0x3c, 0x14, 0x00, 0x60, 0x22, 0x00, 0xff, 0xe5, 0x2f,
+    0xc0, 0x03, 0xb8, 0x00, 0x5f, 0xd1, 0x00, 0x15, 0x51, 0xa8, 0x00, 0x00, 0xc3, 0xae, 0x01, 0xf4,
+    0x0b, 0x80, 0x7d, 0x38, 0x01, 0xe1, 0xce, 0xe5, 0x80, 0x70, 0xef, 0xfa, 0xc0, 0x38, 0xeb, 0xf2,
+    0x84, 0x02, 0x5c, 0x43, 0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82, 0x0a, 0xa0, 0x02, 0x05,
+    0x07, 0x43, 0x40, 0x32, 0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca, 0x04, 0x82, 0xa8, 0x00,
+    0x81, 0x41, 0x14, 0x05, 0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8, 0x00, 0x00, 0x8f, 0xd8,
+    0x03, 0xa9, 0xd8, 0x03, 0x69, 0x5e, 0x80, 0x48, 0x3b, 0x8a, 0x01, 0x26, 0xb7, 0xc0, 0x04, 0x55,
+    0xfb, 0x00, 0x01, 0xc4, 0x51, 0x78, 0x06, 0x17, 0xac, 0x07, 0x0e, 0x0d, 0x00, 0x18, 0x17, 0x06,
+    0x80, 0x0c, 0x09, 0x85, 0xe7, 0x01, 0x80, 0x75, 0x18, 0x5e, 0x40, 0x00, 0x15, 0x13, 0x48, 0x07,
+    0x32, 0x0f, 0xa8, 0x07, 0x27, 0x1c, 0xe0, 0x07, 0x0e, 0x77, 0x28, 0x03, 0x87, 0x7f, 0xd4, 0x01,
+    0xc7, 0x5f, 0x94, 0x20, 0x12, 0xe2, 0x19, 0x97, 0xc8, 0x06, 0xc2, 0xf7, 0x9c, 0x64, 0x10, 0x55,
+    0x00, 0x10, 0x28, 0x3a, 0x1a, 0x01, 0x94, 0x08, 0x00, 0x20, 0x1f, 0x68, 0x60, 0x06, 0x50, 0x24,
+    0x15, 0x40, 0x04, 0x0a, 0x08, 0xa0, 0x2f, 0x79, 0xc6, 0x40, 0x0d, 0x88, 0x60, 0xbe, 0x40, 0x00,
+    0x03, 0xa1, 0x78, 0x00, 0x99, 0x0f, 0x0c, 0x02, 0x53, 0x98, 0x60, 0x09, 0x1b, 0x71, 0x40, 0x24,
+    0xa6, 0xf8, 0x00, 0x8a, 0xbf, 0x60, 0x00, 0x38, 0x8a, 0x2f, 0x00, 0xc2, 0xf5, 0x80, 0xe1, 0xc1,
+    0xa0, 0x03, 0x02, 0xe0, 0xd0, 0x01, 0x81, 0x30, 0xbc, 0xe0, 0x30, 0x0e, 0xa3, 0x0b, 0xc8, 0x00,
+    0x00, 0xb2, 0x40, 0x3f, 0x7b, 0x18, 0x07, 0xc7, 0xe6, 0x01, 0xf7, 0xfd, 0x40, 0x1e, 0xcc, 0xa0,
+    0x03, 0x8e, 0x37, 0xa0, 0x40, 0x25, 0xc4, 0x33, 0x2f, 0x90, 0x0d, 0x85, 0xef, 0x38, 0xc8, 0x20,
+    0xaa, 0x00, 0x20, 0x50, 0x74, 0x34, 0x03, 0x28, 0x10, 0x00, 0x40, 0x3e, 0xd0, 0xc0, 0x0c, 0xa0,
+    0x48, 0x2a, 0x80, 0x08, 0x14, 0x11, 0x40, 0x5e, 0xf3, 0x8c, 0x80, 0x1b, 0x10, 0xc1, 0x7c, 0x80,
+    0x01, 0xda, 0x00, 0xe1, 0xf7, 0x20, 0x0e, 0x2d, 0x20, 0x0e, 0xff, 0xa4, 0x03, 0x66, 0x50, 0x01,
+    0x14, 0x67, 0x48, 0x00, 0x71, 0x14, 0x5e, 0x01, 0x85, 0xeb, 0x01, 0xc3, 0x83, 0x40, 0x06, 0x05,
+    0xc1, 0xa0, 0x03, 0x02, 0x61, 0x79, 0xc0, 0x60, 0x1d, 0x46, 0x17, 0x90, 0x00, 0x00, 0xed, 0x80,
+    0x0f, 0x9c, 0x20, 0x03, 0xe7, 0xd0, 0x0f, 0xbf, 0xea, 0x00, 0xf6, 0x65, 0x00, 0x1c, 0x71, 0xbd,
+    0x02, 0x01, 0x2e, 0x21, 0x99, 0x7c, 0x80, 0x6c, 0x2f, 0x79, 0xc6, 0x41, 0x05, 0x50, 0x01, 0x02,
+    0x83, 0xa1, 0xa0, 0x19, 0x40, 0x80, 0x02, 0x01, 0xf6, 0x86, 0x00, 0x65, 0x02, 0x41, 0x54, 0x00,
+    0x40, 0xa0, 0x8a, 0x02, 0xf7, 0x9c, 0x64, 0x00, 0xd8, 0x86, 0x0b, 0xe4, 0x00, 0x00, 0x8b, 0xdc,
+    0x03, 0xa9, 0x5c, 0x03, 0xa2, 0x80, 0x3b, 0xfe, 0x90, 0x0d, 0x99, 0x40, 0x04, 0x51, 0x9d, 0x20,
+    0x01, 0xc4, 0x51, 0x78, 0x06, 0x17, 0xac, 0x07, 0x0e, 0x0d, 0x00, 0x18, 0x17, 0x06, 0x80, 0x0c,
+    0x09, 0x85, 0xe7, 0x01, 0x80, 0x75, 0x18, 0x5e, 0x40, 0x00, 0xdb, 0x80, 0x1c, 0xc7, 0xa0, 0x1c,
+    0xdc, 0x20, 0x04, 0xff, 0xda, 0xc0, 0x10, 0xa9, 0x94, 0xa8, 0x01, 0x2b, 0x28, 0x38, 0x03, 0x90,
+    0x18, 0x03, 0x0c, 0x03, 0x80, 0x17, 0xf9, 0x82, 0x00, 0x02, 0xaa, 0x8e, 0x20, 0x02, 0x55, 0x1c,
+    0x40, 0x3f, 0xf8, 0xa0, 0x00, 0xdb, 0xa0, 0x0e, 0x63, 0xf0, 0x0e, 0x6e, 0x20, 0x02, 0xfc, 0xdf,
+    0xe1, 0x00, 0x4c, 0x08, 0x7e, 0x01, 0x25, 0xd8, 0xc9, 0x00, 0x06, 0x00, 0x40, 0x10, 0x01, 0x80,
+    0x10, 0x04, 0x00, 0x97, 0x63, 0x24, 0x00, 0x30, 0x21, 0xf8, 0x04, 0x37, 0xf8, 0x40, 0x1f, 0xfc,
+    0x50, 0x00, 0xaf, 0x00, 0x3c, 0xe2, 0x01, 0xec, 0xd0, 0x09, 0x3f, 0xf6, 0xb0, 0x04, 0x2a, 0x65,
+    0x2a, 0x00, 0x4a, 0xca, 0x0e, 0x00, 0xe4, 0x06, 0x00, 0xc3, 0x00, 0xe0, 0x05, 0xfe, 0x60, 0x80,
+    0x00, 0xaa, 0xa3, 0x88, 0x00, 0x95, 0x47, 0x10, 0x0f, 0xfe, 0x28, 0x00, 0xaf, 0x00, 0x3e, 0x10,
+    0x0f, 0x5e, 0x80, 0x4b, 0xf3, 0x7f, 0x84, 0x01, 0x30, 0x21, 0xf8, 0x04, 0x97, 0x63, 0x24, 0x00,
+    0x18, 0x01, 0x00, 0x40, 0x06, 0x00, 0x40, 0x10, 0x02, 0x5d, 0x8c, 0x90, 0x00, 0xc0, 0x87, 0xe0,
+    0x10, 0xdf, 0xe1, 0x00, 0x7f, 0xf1, 0x40, 0x00, 0xa3, 0x44, 0x03, 0xc2, 0x60, 0x1f, 0x4f, 0x08,
+    0x04, 0x9f, 0xfb, 0x58, 0x03, 0x0a, 0xa1, 0x4b, 0x00, 0x49, 0x57, 0x60, 0xa0, 0x0f, 0x28, 0x10,
+    0x07, 0x0c, 0x82, 0x00, 0x4b, 0xfc, 0xe3, 0x00, 0x11, 0x31, 0x84, 0x90, 0x04, 0xf3, 0xc1, 0x20,
+    0x1e, 0x25, 0x16, 0x00, 0xf4, 0x84, 0x00, 0x02, 0xe7, 0x00, 0x08, 0x06, 0x3e, 0x70, 0x5f, 0x9d,
+    0xa0, 0x03, 0x0e, 0x00, 0x0f, 0x18, 0x00, 0x80, 0x1f, 0xfc, 0x50, 0x4f, 0xfd, 0xac, 0x01, 0x85,
+    0x50, 0xa5, 0x80, 0x24, 0xab, 0xb0, 0x50, 0x07, 0x94, 0x08, 0x03, 0x86, 0x41, 0x00, 0x25, 0xfe,
+    0x71, 0x80, 0x08, 0x98, 0xc2, 0x48, 0x02, 0x79, 0xe0, 0x90, 0x0f, 0x12, 0x8b, 0x00, 0x7a, 0x42,
+    0x01, 0x3e, 0x80, 0x07, 0xfc, 0x01, 0xa3, 0x84, 0x03, 0xf1, 0x80, 0x7a, 0x38, 0x80, 0x20, 0x5f,
+    0x9d, 0xa0, 0x03, 0x0e, 0x00, 0x0f, 0x18, 0x00, 0x80, 0x1f, 0xfc, 0x55, 0xf8, 0x00, 0x1f, 0x30,
+    0x01, 0xc0, 0x32, 0x73, 0x00, 0x00, 0x00, 0xff, 0xa7, 0xfe, 0x00, 0xeb, 0xcc, 0x80, 0x24, 0xfd,
+    0xcc, 0x73, 0x00, 0x61, 0x54, 0x29, 0x60, 0x09, 0x2a, 0xec, 0x14, 0x01, 0xe5, 0x02, 0x00, 0xe1,
+    0x90, 0x40, 0x09, 0x7f, 0x9c, 0x60, 0x02, 0x26, 0x30, 0x92, 0x00, 0x9e, 0x78, 0x24, 0x03, 0xc4,
+    0xa2, 0xc0, 0x1e, 0x90, 0x80, 0x4f, 0xa0, 0x01, 0xff, 0x00, 0x68, 0xe1, 0x00, 0xfc, 0x60, 0x1e,
+    0x8e, 0x20, 0x08, 0x00, 0xe2, 0xff, 0x9c, 0xb3, 0x26, 0x5c, 0xae, 0xb0, 0x03, 0x0e, 0x00, 0x0f,
+    0x18, 0x00, 0x80, 0x1f, 0xfc, 0x55, 0xf8, 0x00, 0x1f, 0x30, 0x01, 0xc0, 0x32, 0x73, 0x00, 0x00,
+    0x4f, 0xfd, 0xac, 0x01, 0x85, 0x50, 0xa5, 0x80, 0x24, 0xab, 0xb0, 0x50, 0x07, 0x94, 0x08, 0x03,
+    0x86, 0x41, 0x00, 0x25, 0xfe, 0x71, 0x80, 0x08, 0x98, 0xc2, 0x48, 0x02, 0x79, 0xe0, 0x90, 0x0f,
+    0x12, 0x8b, 0x00, 0x7a, 0x42, 0x01, 0x3e, 0x80, 0x07, 0xfc, 0x01, 0x4f, 0xfc, 0x20, 0x1a, 0x33,
+    0x21, 0x00, 0x00, 0x05, 0xf9, 0xda, 0x00, 0x98, 0x70, 0x02, 0x3c, 0x60, 0x09, 0x00, 0x3f, 0xf9,
+    0x2b, 0xf0, 0x00, 0x3f, 0xf9, 0x80, 0xf3, 0x27, 0x00, 0x00, 0xa3, 0x44, 0x03, 0xc2, 0x60, 0x1f,
+    0x4f, 0x08, 0x06, 0x1a, 0xef, 0xc5, 0x00, 0xb1, 0x4d, 0x0e, 0x90, 0x10, 0x8f, 0x6e, 0x83, 0x80,
+    0x22, 0x30, 0x5e, 0xb0, 0x44, 0x0e, 0x75, 0x28, 0x80, 0x2e, 0x94, 0x16, 0xdc, 0x09, 0x5e, 0xba,
+    0x82, 0x01, 0x2a, 0x40, 0x0e, 0x02, 0x0e, 0x29, 0xd7, 0xa0, 0xc0, 0x38, 0xa0, 0x85, 0x10, 0x00,
+    0x00, 0x37, 0x18, 0x07, 0xfc, 0xdc, 0x60, 0x14, 0x77, 0xe2, 0x02, 0xb9, 0x41, 0x58, 0x98, 0x3a,
+    0x6d, 0x83, 0x31, 0x33, 0x1c, 0x27, 0x9b, 0x86, 0xa8, 0xb5, 0xc8, 0x20, 0xed, 0x03, 0x01, 0x26,
+    0x00, 0x01, 0xae, 0xfc, 0x50, 0x0b, 0x14, 0xd0, 0xe9, 0x01, 0x08, 0xf6, 0xe8, 0x38, 0x02, 0x23,
+    0x05, 0xeb, 0x04, 0x40, 0xe7, 0x52, 0x88, 0x02, 0xe9, 0x41, 0x6d, 0xc0, 0x95, 0xeb, 0xa8, 0x20,
+    0x12, 0xa4, 0x00, 0xe0, 0x20, 0xe2, 0x9d, 0x7a, 0x0c, 0x03, 0x8a, 0x08, 0x51, 0x00, 0x01, 0x57,
+    0x7e, 0xb8, 0x07, 0x47, 0x10, 0x07, 0xe3, 0x00, 0x80, 0x08, 0xef, 0xc4, 0x05, 0x72, 0x82, 0xb1,
+    0x30, 0x74, 0xdb, 0x06, 0x62, 0x66, 0x38, 0x4f, 0x37, 0x0d, 0x51, 0x6b, 0x90, 0x41, 0xda, 0x06,
+    0x02, 0x4c, 0x1f, 0x7f, 0x58, 0x02, 0x6e, 0x30, 0x0f, 0xe0, 0x00, 0x55, 0xa4, 0x80, 0x77, 0x72,
+    0x74, 0x03, 0x91, 0x75, 0x00, 0x30, 0xd7, 0x7e, 0x28, 0x05, 0x8a, 0x68, 0x74, 0x80, 0x84, 0x7b,
+    0x74, 0x1c, 0x01, 0x11, 0x82, 0xf5, 0x82, 0x20, 0x73, 0xa9, 0x44, 0x01, 0x74, 0xa0, 0xb6, 0xe0,
+    0x4a, 0xf5, 0xd4, 0x10, 0x09, 0x52, 0x00, 0x70, 0x10, 0x71, 0x4e, 0xbd, 0x06, 0x01, 0xc5, 0x04,
+    0x28, 0x80, 0x00, 0x00, 0x1d, 0x08, 0x06, 0x64, 0x20, 0x0c, 0xbc, 0x60, 0x1d, 0x1e, 0xc0, 0x11,
+    0xbc, 0x30, 0x04, 0x7e, 0xe0, 0x14, 0x77, 0xe2, 0x02, 0xb9, 0x41, 0x58, 0x98, 0x3a, 0x6d, 0x83,
+    0x31, 0x33, 0x1c, 0x27, 0x9b, 0x86, 0xa8, 0xb5, 0xc8, 0x20, 0xed, 0x03, 0x01, 0x26, 0x00, 0x00,
+    0x9b, 0x00, 0x3e, 0xe1, 0x10, 0x07, 0x48, 0x76, 0x90, 0x06, 0xb7, 0xd4, 0x20, 0x0c, 0x5d, 0x90,
+    0x01, 0x86, 0xbf, 0x71, 0x40, 0x2c, 0x53, 0x43, 0xa4, 0x04, 0x23, 0xdb, 0xa0, 0xe0, 0x08, 0x8c,
+    0x17, 0xac, 0x11, 0x03, 0x9d, 0x4a, 0x20, 0x0b, 0xa5, 0x05, 0xb7, 0x02, 0x57, 0xae, 0xa0, 0x80,
+    0x4a, 0x90, 0x03, 0x80, 0x83, 0x8a, 0x75, 0xe8, 0x30, 0x0e, 0x28, 0x21, 0x44, 0x00, 0x00, 0x26,
+    0x10, 0x06, 0x12, 0x10, 0x0a, 0x21, 0xb8, 0xa0, 0x08, 0x1c, 0x65, 0x00, 0xb3, 0xa4, 0x02, 0x8e,
+    0xe6, 0x20, 0x2b, 0x94, 0x15, 0x89, 0x83, 0xa6, 0xd8, 0x33, 0x13, 0x31, 0xc2, 0x79, 0xb8, 0x6a,
+    0x8b, 0x5c, 0x82, 0x0e, 0xd0, 0x30, 0x12, 0x60, 0x00, 0xa3, 0x44, 0x03, 0xc2, 0x60, 0x1f, 0x4f,
+    0x08, 0x06, 0x1a, 0xef, 0xc5, 0x00, 0xb1, 0x4d, 0x0e, 0x90, 0x10, 0x8f, 0x6e, 0x83, 0x80, 0x22,
+    0x30, 0x5e, 0xb0, 0x44, 0x0e, 0x75, 0x28, 0x80, 0x2e, 0x94, 0x16, 0xdc, 0x09, 0x5e, 0xba, 0x82,
+    0x01, 0x2a, 0x40, 0x0e, 0x02, 0x0e, 0x29, 0xd7, 0xa0, 0xc0, 0x38, 0xa0, 0x85, 0x10, 0x00, 0x15,
+    0x77, 0xeb, 0x80, 0x74, 0x71, 0x00, 0x7e, 0x30, 0x08, 0x00, 0x37, 0x18, 0x07, 0xfc, 0xdc, 0x60,
+    0x14, 0x77, 0xe2, 0x02, 0xb9, 0x41, 0x58, 0x98, 0x3a, 0x6d, 0x83, 0x31, 0x33, 0x1c, 0x27, 0x9b,
+    0x86, 0xa8, 0xb5, 0xc8, 0x20, 0xed, 0x03, 0x01, 0x26, 0x0f, 0xbf, 0xac, 0x01, 0x37, 0x18, 0x07,
+    0xf0, 0x00, 0xab, 0x40, 0x3f, 0xf8, 0x55, 0xa0, 0x15, 0xff, 0xfc, 0x68, 0x80, 0x02, 0x25, 0x17,
+    0x62, 0x0a, 0xbb, 0x00, 0x7f, 0xfb, 0x00, 0x09, 0xd1, 0x00, 0x8c, 0x02, 0x9e, 0x10, 0x05, 0xf9,
+    0x00, 0x7b, 0x90, 0x36, 0x24, 0x81, 0xb1, 0xd8, 0x2d, 0x00, 0x3f, 0xe1, 0x08, 0x40, 0x92, 0x5c,
+    0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44, 0xa2, 0xec, 0x41, 0x57, 0x60, 0x0f, 0xff, 0x7e, 0xf8,
+    0x80, 0x75, 0x68, 0x07, 0xff, 0x0a, 0xb4, 0x02, 0x00, 0x05, 0x71, 0x00, 0x74, 0x18, 0x72, 0x06,
+    0xc4, 0x90, 0x36, 0x3b, 0x05, 0xa0, 0x07, 0xfc, 0x21, 0x08, 0x12, 0x4b, 0x80, 0x7b, 0xf0, 0x03,
+    0xb2, 0x01, 0x18, 0x04, 0x3d, 0x20, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44, 0xa2, 0xec, 0x41,
+    0x57, 0x60, 0x0f, 0xff, 0x7e, 0xf8, 0x80, 0x6b, 0xff, 0x80, 0x34, 0xe6, 0x40, 0x00, 0x05, 0x71,
+    0x00, 0x74, 0x18, 0x72, 0x06, 0xc4, 0x90, 0x36, 0x3b, 0x05, 0xa0, 0x07, 0xfc, 0x21, 0x08, 0x12,
+    0x4b, 0x80, 0x7b, 0xf0, 0x1f, 0xf5, 0x06, 0x65, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44, 0xa2,
+    0xec, 0x41, 0x57, 0x60, 0x0f, 0xff, 0x7e, 0xf8, 0x80, 0x61, 0xef, 0x40, 0x0d, 0xa9, 0x34, 0x20,
+    0x00, 0x05, 0x71, 0x00, 0xba, 0x0c, 0x01, 0xc8, 0x1b, 0x01, 0x24, 0x0d, 0x80, 0xec, 0x16, 0x80,
+    0x1f, 0xfc, 0x21, 0x08, 0x40, 0x04, 0x92, 0xe0, 0x00, 0xf7, 0xe0, 0x00, 0xbf, 0xa2, 0x05, 0x54,
+    0x6a, 0x00, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08, 0x0a, 0x82, 0x08, 0x02,
+    0x80, 0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x9f, 0x7f, 0x60, 0x03, 0x4e,
+    0x86, 0x58, 0x07, 0xce, 0x01, 0x00, 0x5f, 0x80, 0x07, 0x70, 0x03, 0xff, 0x92, 0x20, 0x60, 0x42,
+    0x0a, 0x09, 0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0x1b, 0xb8, 0xdd, 0xc0, 0x4e, 0x47, 0xe2, 0x00,
+    0xc2, 0x00, 0x00, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08, 0x0a, 0x82, 0x08,
+    0x02, 0x80, 0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x9f, 0x7f, 0x60, 0x03,
+    0x16, 0xc3, 0x48, 0x06, 0x54, 0x08, 0xd0, 0x00, 0x5f, 0x80, 0x07, 0x70, 0x03, 0xff, 0x92, 0x20,
+    0x60, 0x42, 0x0a, 0x09, 0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0x1b, 0xb8, 0xdd, 0xc0, 0x05, 0xd9,
+    0x34, 0x00, 0x4d, 0xd2, 0x80, 0x00, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08,
+    0x0a, 0x82, 0x08, 0x02, 0x80, 0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x9f,
+    0x7b, 0x60, 0x03, 0xab, 0xb0, 0x03, 0x95, 0x58, 0x50, 0x00, 0x00, 0x5f, 0x80, 0x07, 0x70, 0x03,
+    0xff, 0x92, 0x20, 0x60, 0x42, 0x0a, 0x09, 0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0x1b, 0xbd, 0xfb,
+    0x80, 0x04, 0xee, 0x10, 0x00, 0x6a, 0x57, 0x80, 0x00, 0xc9, 0xa6, 0x01, 0xe9, 0xa3, 0x00, 0xf6,
+    0xb8, 0x07, 0x26, 0xf7, 0x1c, 0x03, 0x2e, 0x7f, 0x9c, 0x00, 0x9f, 0x02, 0x33, 0x7b, 0x80, 0x7f,
+    0xf8, 0xcc, 0x02, 0x10, 0x15, 0x04, 0x10, 0x05, 0x01, 0x0b, 0x0f, 0x67, 0x12, 0x20, 0x26, 0x08,
+    0xcc, 0xf6, 0x00, 0x00, 0x8b, 0xd8, 0x03, 0x5b, 0xb0, 0x05, 0xa5, 0x5c, 0x00, 0x31, 0xdd, 0x38,
+    0x00, 0xf5, 0xbe, 0x41, 0x7e, 0x40, 0x1d, 0xc0, 0x0f, 0xfe, 0x48, 0x81, 0x81, 0x08, 0x28, 0x26,
+    0x60, 0x00, 0x32, 0x25, 0x02, 0x00, 0x00, 0x35, 0x85, 0xb8, 0x06, 0xe6, 0x06, 0xf0, 0x0d, 0x1a,
+    0x1b, 0x00, 0x18, 0xff, 0xe6, 0x00, 0xc7, 0x99, 0x38, 0x01, 0x3e, 0x4c, 0xe7, 0xf7, 0x00, 0xff,
+    0xf1, 0x98, 0x04, 0x20, 0x2a, 0x08, 0x20, 0x0a, 0x02, 0x16, 0x1e, 0xce, 0x24, 0x40, 0x4c, 0x11,
+    0x99, 0xec, 0x00, 0x04, 0xc2, 0x8a, 0x00, 0x09, 0x01, 0x30, 0x01, 0x78, 0xab, 0x00, 0x2f, 0xfa,
+    0x80, 0x2c, 0xca, 0x01, 0x7e, 0xcc, 0xd9, 0xc0, 0x1f, 0xfc, 0x91, 0x03, 0x02, 0x10, 0x50, 0x4c,
+    0xc0, 0x00, 0x64, 0x4a, 0x04, 0x00, 0x00, 0x26, 0xf7, 0x1c, 0x03, 0x97, 0xfe, 0x70, 0x0b, 0x3d,
+    0x08, 0x44, 0x5f, 0xc1, 0x61, 0xe0, 0x12, 0x83, 0x83, 0x02, 0x80, 0x58, 0x1a, 0x02, 0x60, 0x80,
+    0x28, 0x08, 0x00, 0xb0, 0xd0, 0x40, 0x50, 0x09, 0x81, 0xc3, 0xc3, 0xc0, 0x21, 0x31, 0x24, 0x05,
+    0x00, 0xd6, 0x10, 0x2a, 0x01, 0xca, 0x0a, 0x1e, 0x01, 0xc4, 0x60, 0x05, 0x00, 0x80, 0x02, 0xe9,
+    0x5a, 0x00, 0x95, 0xc6, 0xbc, 0x02, 0x68, 0x87, 0x28, 0x02, 0xf8, 0xc0, 0x7f, 0x83, 0x42, 0x81,
+    0x01, 0xc1, 0xc1, 0x43, 0x42, 0x80, 0x54, 0x88, 0xe2, 0x60, 0x0f, 0x08, 0x16, 0x00, 0x94, 0x14,
+    0x28, 0x03, 0x30, 0x11, 0x00, 0x00, 0xcf, 0x50, 0x08, 0xbf, 0x82, 0xc3, 0xc0, 0x25, 0x07, 0x06,
+    0x05, 0x00, 0xb0, 0x34, 0x04, 0xc1, 0x00, 0x50, 0x10, 0x01, 0x61, 0xa0, 0x80, 0xa0, 0x13, 0x03,
+    0x87, 0x87, 0x80, 0x42, 0x62, 0x48, 0x0a, 0x01, 0xac, 0x20, 0x54, 0x03, 0x94, 0x14, 0x3c, 0x03,
+    0x88, 0xc0, 0x0a, 0x01, 0xec, 0xff, 0x00, 0x7c, 0x7c, 0xc0, 0x1f, 0x38, 0x07, 0xf2, 0x73, 0x00,
+    0x60, 0xbf, 0x20, 0x07, 0xf0, 0x68, 0x50, 0x20, 0x38, 0x38, 0x28, 0x68, 0x50, 0x0a, 0x91, 0x1c,
+    0x4c, 0x01, 0xe1, 0x02, 0xc0, 0x12, 0x82, 0x85, 0x00, 0x66, 0x02, 0x20, 0x06, 0x9f, 0xd0, 0x0e,
+    0x3e, 0x60, 0x0f, 0xfe, 0x09, 0xf3, 0x00, 0x40, 0x00, 0xc9, 0xec, 0x01, 0xfe, 0x47, 0x80, 0x0f,
+    0xfa, 0x38, 0x03, 0xdb, 0xe6, 0x00, 0xaf, 0x90, 0x02, 0x7e, 0x28, 0x20, 0x01, 0xc1, 0x00, 0x18,
+    0x09, 0x81, 0x80, 0x24, 0x04, 0x20, 0x61, 0x8a, 0x0a, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x26, 0x25,
+    0x81, 0xe1, 0x86, 0x06, 0x00, 0x40, 0x75, 0x14, 0x13, 0x50, 0x40, 0x06, 0x06, 0x1a, 0x02, 0xa7,
+    0x85, 0x80, 0x10, 0x1c, 0x30, 0x30, 0x1c, 0x0c, 0x02, 0x31, 0x04, 0x04, 0x01, 0x40, 0x0c, 0x80,
+    0x24, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x9f, 0xcc, 0x03, 0xf3, 0xaf, 0x80, 0x7f, 0x56, 0x00, 0x76,
+    0x79, 0x05, 0x7a, 0x04, 0x7b, 0x58, 0x20, 0x20, 0x60, 0x20, 0x3a, 0x86, 0x10, 0x89, 0x00, 0xc8,
+    0x48, 0x51, 0x01, 0x26, 0xa0, 0xa0, 0x07, 0x1a, 0x35, 0x09, 0x0b, 0x00, 0x68, 0x1d, 0x91, 0x0c,
+    0x4c, 0x00, 0x80, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0xf3, 0xfa, 0x00, 0x7f, 0xa6, 0x10, 0x03,
+    0xfd, 0xce, 0x01, 0xdb, 0xe6, 0x00, 0xaf, 0x90, 0x02, 0x7e, 0x28, 0x20, 0x01, 0xc1, 0x00, 0x18,
+    0x09, 0x81, 0x80, 0x24, 0x04, 0x20, 0x61, 0x8a, 0x0a, 0x08, 0x08, 0x0a, 0x08, 0x08, 0x26, 0x25,
+    0x81, 0xe1, 0x86, 0x06, 0x00, 0x40, 0x75, 0x14, 0x13, 0x50, 0x40, 0x06, 0x06, 0x1a, 0x02, 0xa7,
+    0x85, 0x80, 0x10, 0x1c, 0x30, 0x30, 0x1c, 0x0c, 0x02, 0x31, 0x04, 0x04, 0x01, 0x40, 0x0c, 0x80,
+    0x24, 0x06, 0x00, 0xc0, 0x00, 0x00, 0xe9, 0xf2, 0x00, 0xf8, 0x9a, 0xc8, 0x03, 0xe2, 0xf4, 0x00,
+    0xd9, 0xe4, 0x15, 0xe8, 0x11, 0xed, 0x60, 0x80, 0x81, 0x80, 0x80, 0xea, 0x18, 0x42, 0x24, 0x03,
+    0x21, 0x21, 0x44, 0x04, 0x9a, 0x82, 0x80, 0x1c, 0x68, 0xd4, 0x24, 0x2c, 0x01, 0xa0, 0x76, 0x44,
+    0x31, 0x30, 0x02, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0xd5, 0x81, 0xb4, 0x01, 0xf8, 0x40,
+    0x3f, 0xf8, 0x17, 0x81, 0xb4, 0x01, 0xb7, 0xcc, 0x01, 0x5f, 0x20, 0x04, 0xfc, 0x50, 0x40, 0x03,
+    0x82, 0x00, 0x30, 0x13, 0x03, 0x00, 0x48, 0x08, 0x40, 0xc3, 0x14, 0x14, 0x10, 0x10, 0x14, 0x10,
+    0x10, 0x4c, 0x4b, 0x03, 0xc3, 0x0c, 0x0c, 0x00, 0x80, 0xea, 0x28, 0x26, 0xa0, 0x80, 0x0c, 0x0c,
+    0x34, 0x05, 0x4f, 0x0b, 0x00, 0x20, 0x38, 0x60, 0x60, 0x38, 0x18, 0x04, 0x62, 0x08, 0x08, 0x02,
+    0x80, 0x19, 0x00, 0x48, 0x0c, 0x01, 0x80, 0x00, 0x00, 0xb2, 0x87, 0x9c, 0x03, 0xc2, 0x01, 0xfe,
+    0xda, 0x1e, 0x70, 0x0b, 0x3c, 0x82, 0xbd, 0x02, 0x3d, 0xac, 0x10, 0x10, 0x30, 0x10, 0x1d, 0x43,
+    0x08, 0x44, 0x80, 0x64, 0x24, 0x28, 0x80, 0x93, 0x50, 0x50, 0x03, 0x8d, 0x1a, 0x84, 0x85, 0x80,
+    0x34, 0x0e, 0xc8, 0x86, 0x26, 0x00, 0x40, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0xe5, 0xe4, 0x00,
+    0xff, 0xe5, 0xaf, 0x20, 0x07, 0x6f, 0x98, 0x02, 0xbe, 0x40, 0x09, 0xf8, 0xa0, 0x80, 0x07, 0x04,
+    0x00, 0x60, 0x26, 0x06, 0x00, 0x90, 0x10, 0x81, 0x86, 0x28, 0x28, 0x20, 0x20, 0x28, 0x20, 0x20,
+    0x98, 0x96, 0x07, 0x86, 0x18, 0x18, 0x01, 0x01, 0xd4, 0x50, 0x4d, 0x41, 0x00, 0x18, 0x18, 0x68,
+    0x0a, 0x9e, 0x16, 0x00, 0x40, 0x70, 0xc0, 0xc0, 0x70, 0x30, 0x08, 0xc4, 0x10, 0x10, 0x05, 0x00,
+    0x32, 0x00, 0x90, 0x18, 0x03, 0x00, 0x00, 0x00, 0xcf, 0xc4, 0x01, 0xff, 0xc7, 0x7e, 0x20, 0x0d,
+    0x9e, 0x41, 0x5e, 0x81, 0x1e, 0xd6, 0x08, 0x08, 0x18, 0x08, 0x0e, 0xa1, 0x84, 0x22, 0x40, 0x32,
+    0x12, 0x14, 0x40, 0x49, 0xa8, 0x28, 0x01, 0xc6, 0x8d, 0x42, 0x42, 0xc0, 0x1a, 0x07, 0x64, 0x43,
+    0x13, 0x00, 0x20, 0x01, 0x01, 0x01, 0x00, 0x00, 0xdf, 0x30, 0x05, 0x7c, 0x80, 0x13, 0xf1, 0x41,
+    0x00, 0x0e, 0x08, 0x00, 0xc0, 0x4c, 0x0c, 0x01, 0x20, 0x21, 0x03, 0x0c, 0x50, 0x50, 0x40, 0x40,
+    0x50, 0x40, 0x41, 0x31, 0x2c, 0x0f, 0x0c, 0x30, 0x30, 0x02, 0x03, 0xa8, 0xa0, 0x9a, 0x82, 0x00,
+    0x30, 0x30, 0xd0, 0x15, 0x3c, 0x2c, 0x00, 0x80, 0xe1, 0x81, 0x80, 0xe0, 0x60, 0x11, 0x88, 0x20,
+    0x20, 0x0a, 0x00, 0x64, 0x01, 0x20, 0x30, 0x06, 0x00, 0x68, 0xfe, 0x00, 0xbf, 0xce, 0x01, 0xf2,
+    0xf2, 0x00, 0x7f, 0xf2, 0xd7, 0x90, 0x03, 0x80, 0xcf, 0x20, 0xaf, 0x40, 0x8f, 0x6b, 0x04, 0x04,
+    0x0c, 0x04, 0x07, 0x50, 0xc2, 0x11, 0x20, 0x19, 0x09, 0x0a, 0x20, 0x24, 0xd4, 0x14, 0x00, 0xe3,
+    0x46, 0xa1, 0x21, 0x60, 0x0d, 0x03, 0xb2, 0x21, 0x89, 0x80, 0x10, 0x00, 0x80, 0x80, 0x80, 0x1b,
+    0xfc, 0x61, 0x3f, 0x40, 0x1e, 0x7e, 0x20, 0x0f, 0xfe, 0x3b, 0xf1, 0x00, 0x60, 0x00, 0x93, 0x94,
+    0x03, 0xff, 0x86, 0x9c, 0xa0, 0x12, 0x7e, 0x80, 0x59, 0xec, 0x8a, 0x50, 0x0c, 0x66, 0x60, 0xb0,
+    0x73, 0x80, 0xe0, 0x00, 0xc8, 0x60, 0xc1, 0x00, 0x4c, 0x60, 0x4e, 0x01, 0xc4, 0x04, 0x40, 0x0d,
+    0x22, 0x41, 0x20, 0x12, 0x31, 0x69, 0xa2, 0x80, 0x28, 0x38, 0x3c, 0x2c, 0x64, 0x58, 0xc0, 0xd8,
+    0x6c, 0x00, 0x2f, 0x20, 0x07, 0x84, 0x03, 0x2f, 0x28, 0x01, 0xfe, 0x42, 0x3d, 0xdc, 0x6c, 0xae,
+    0x6e, 0x1c, 0x14, 0x1c, 0x00, 0x24, 0x04, 0x20, 0x02, 0x20, 0x11, 0x00, 0x09, 0x0c, 0x09, 0x09,
+    0x28, 0x38, 0x29, 0x00, 0x00, 0x4e, 0x86, 0x50, 0x06, 0x30, 0x08, 0x40, 0x35, 0x68, 0x65, 0x80,
+    0x13, 0xf4, 0x02, 0xcf, 0x64, 0x52, 0x80, 0x63, 0x33, 0x05, 0x83, 0x9c, 0x07, 0x00, 0x06, 0x43,
+    0x06, 0x08, 0x02, 0x63, 0x02, 0x70, 0x0e, 0x20, 0x22, 0x00, 0x69, 0x12, 0x09, 0x00, 0x91, 0x8b,
+    0x4d, 0x14, 0x01, 0x41, 0xc1, 0xe1, 0x63, 0x22, 0xc6, 0x06, 0xc3, 0x60, 0x0a, 0xc0, 0xca, 0x00,
+    0x84, 0x04, 0x02, 0xad, 0x0d, 0xa0, 0x7f, 0x90, 0x8f, 0x77, 0x1b, 0x2b, 0x9b, 0x87, 0x05, 0x07,
+    0x00, 0x09, 0x01, 0x08, 0x00, 0x88, 0x04, 0x40, 0x02, 0x43, 0x02, 0x42, 0x4a, 0x0e, 0x0a, 0x40,
+    0x00, 0x97, 0x90, 0x03, 0xff, 0x86, 0xbc, 0x80, 0x15, 0x7c, 0x00, 0x53, 0xf5, 0x00, 0xe4, 0x02,
+    0xc1, 0x64, 0xe1, 0x01, 0x00, 0xe2, 0x10, 0x2a, 0x8c, 0x30, 0x01, 0x40, 0x58, 0x40, 0x06, 0x62,
+    0x02, 0x60, 0x0e, 0xa0, 0xa0, 0x0f, 0x08, 0x07, 0xff, 0x2c, 0x00, 0x2f, 0x20, 0x07, 0xc2, 0x01,
+    0xcb, 0xca, 0x01, 0x5f, 0x90, 0x03, 0xf8, 0x34, 0x14, 0x10, 0x1c, 0x18, 0x2c, 0x34, 0x28, 0x00,
+    0xa6, 0x4e, 0x46, 0x00, 0xe0, 0xb1, 0x50, 0x09, 0x05, 0x82, 0x80, 0x33, 0x81, 0x90, 0x06, 0xe0,
+    0xb0, 0x08, 0x62, 0x45, 0x80, 0x23, 0x73, 0xb1, 0x00, 0x80, 0x00, 0x99, 0xc0, 0x39, 0xa2, 0xe8,
+    0x03, 0x0e, 0xec, 0x41, 0x1f, 0x19, 0xd1, 0xbb, 0x22, 0x61, 0x01, 0x5b, 0xba, 0x44, 0x38, 0x03,
+    0x78, 0x49, 0x00, 0x54, 0x4a, 0xc0, 0x13, 0x29, 0x50, 0x04, 0x72, 0x1e, 0x01, 0xb8, 0x28, 0x80,
+    0x29, 0x20, 0xeb, 0xba, 0x8c, 0x00, 0x89, 0xc0, 0x00, 0x5f, 0xc0, 0x05, 0x0b, 0x6e, 0x80, 0x08,
+    0xe4, 0xf4, 0x06, 0xff, 0xe2, 0x57, 0x72, 0x80, 0x99, 0xa2, 0x0c, 0x14, 0x20, 0x0a, 0x39, 0x40,
+    0x03, 0x2a, 0x98, 0x00, 0x72, 0x05, 0x10, 0x15, 0x00, 0x3b, 0xc6, 0x00, 0x8f, 0xff, 0x6e, 0x91,
+    0x30, 0x80, 0xad, 0xdd, 0x22, 0x1c, 0x01, 0xbc, 0x24, 0x80, 0x2a, 0x25, 0x60, 0x09, 0x94, 0xa8,
+    0x02, 0x39, 0x0f, 0x00, 0xdc, 0x14, 0x40, 0x14, 0x90, 0x75, 0xdd, 0x46, 0x00, 0x44, 0xea, 0xff,
+    0xf7, 0x00, 0x55, 0xa0, 0x1f, 0xfc, 0x2a, 0xd0, 0x08, 0x6f, 0xfe, 0x25, 0x77, 0x28, 0x09, 0x9a,
+    0x20, 0xc1, 0x42, 0x00, 0xa3, 0x94, 0x00, 0x32, 0xa9, 0x80, 0x07, 0x20, 0x51, 0x01, 0x50, 0x03,
+    0xbc, 0x6d, 0xff, 0xc4, 0x00, 0x6e, 0x30, 0x0f, 0xf9, 0xb8, 0xc0, 0x00, 0x8f, 0xff, 0x6e, 0x91,
+    0x30, 0x80, 0xad, 0xdd, 0x22, 0x1c, 0x01, 0xbc, 0x24, 0x80, 0x2a, 0x25, 0x60, 0x09, 0x94, 0xa8,
+    0x02, 0x39, 0x0f, 0x00, 0xdc, 0x14, 0x40, 0x14, 0x90, 0x75, 0xdd, 0x46, 0x00, 0x44, 0xea, 0xff,
+    0xf7, 0x00, 0x2f, 0xfe, 0x00, 0xd3, 0x99, 0x00, 0x00, 0x6f, 0xfe, 0x25, 0x77, 0x28, 0x09, 0x9a,
+    0x20, 0xc1, 0x42, 0x00, 0xa3, 0x94, 0x00, 0x32, 0xa9, 0x80, 0x07, 0x20, 0x51, 0x01, 0x50, 0x03,
+    0xbc, 0x6d, 0xff, 0xc4, 0x0d, 0xff, 0x18, 0x01, 0xf3, 0x23, 0x00, 0x5f, 0x80, 0x0f, 0xfe, 0x40,
+    0xd7, 0xe1, 0x00, 0x19, 0x82, 0x72, 0x00, 0x4c, 0xf0, 0x50, 0x01, 0x80, 0x88, 0x03, 0xff, 0x94,
+    0xbf, 0x00, 0x0e, 0xe0, 0x03, 0xfe, 0xa0, 0x0b, 0x32, 0x80, 0x00, 0x1d, 0x82, 0xe5, 0x03, 0x01,
+    0x03, 0x1e, 0x83, 0xe6, 0x00, 0x5f, 0x90, 0x07, 0xee, 0x40, 0xd8, 0x09, 0x20, 0x6c, 0x07, 0x60,
+    0xb4, 0x00, 0xff, 0xe1, 0x08, 0x42, 0x00, 0x24, 0x97, 0x00, 0x00, 0xd3, 0xa8, 0x01, 0xf0, 0xaf,
+    0x78, 0x07, 0xf9, 0xc0, 0x3e, 0x15, 0xe8, 0x00, 0xd9, 0xe4, 0x06, 0x40, 0x08, 0xf6, 0xb0, 0x40,
+    0x40, 0xc0, 0x40, 0x75, 0x0c, 0x21, 0x12, 0x01, 0x90, 0x90, 0xa2, 0x02, 0x4d, 0x41, 0x40, 0x0e,
+    0x34, 0x6a, 0x12, 0x16, 0x00, 0xd0, 0x3b, 0x22, 0x18, 0x98, 0x01, 0x00, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x00, 0x3e, 0xb8, 0x07, 0x4e, 0x48, 0x07, 0x4e, 0x48, 0x05, 0x7e, 0xba, 0xff, 0xc1, 0xa0,
+    0xa0, 0x80, 0xe0, 0xc1, 0x61, 0xa1, 0x40, 0x05, 0x32, 0x72, 0x30, 0x07, 0x05, 0x8a, 0x80, 0x48,
+    0x2c, 0x14, 0x01, 0x9c, 0x0c, 0x80, 0x37, 0x05, 0x80, 0x43, 0x12, 0x2c, 0x01, 0x1b, 0x9d, 0x88,
+    0x04, 0x00, 0x00, 0xb0, 0x40, 0x39, 0x1c, 0x03, 0xff, 0x80, 0x8e, 0x01, 0x2e, 0x9f, 0xb8, 0x15,
+    0x04, 0x1c, 0x29, 0xdf, 0xaa, 0x06, 0x8f, 0x66, 0xb8, 0x01, 0xd5, 0xbe, 0x00, 0x31, 0x35, 0x80,
+    0x19, 0x52, 0xe8, 0x00, 0x00, 0x0b, 0xc0, 0x03, 0x80, 0x59, 0x80, 0x05, 0x7f, 0x22, 0x8c, 0x88,
+    0x33, 0x80, 0x7f, 0xf4, 0x00, 0x02, 0xcf, 0x90, 0xe3, 0x5c, 0xf3, 0x05, 0x0d, 0x10, 0xd4, 0x20,
+    0x01, 0x08, 0x07, 0xff, 0x34, 0x04, 0xcf, 0xfd, 0x60, 0x0a, 0x34, 0x62, 0x01, 0x03, 0x14, 0xbb,
+    0x10, 0xd8, 0x38, 0x08, 0x70, 0x68, 0x80, 0x65, 0x30, 0x83, 0x00, 0xcf, 0x0a, 0x98, 0x40, 0x11,
+    0x3d, 0x30, 0x28, 0x07, 0x8c, 0x04, 0x02, 0x49, 0xb5, 0x04, 0x00, 0x8d, 0x95, 0x30, 0x80, 0x00,
+    0x47, 0x7f, 0x80, 0x25, 0x73, 0x77, 0x00, 0x42, 0x0f, 0x50, 0x01, 0x22, 0x17, 0x74, 0x60, 0x0a,
+    0x43, 0x52, 0xc1, 0x05, 0x1c, 0xa6, 0x07, 0x30, 0x40, 0x07, 0x87, 0x10, 0x20, 0x03, 0x03, 0x45,
+    0x47, 0x6d, 0x45, 0x42, 0x98, 0xd5, 0x30, 0x00, 0x00, 0xb3, 0xfc, 0x20, 0x1c, 0x46, 0x00, 0x70,
+    0x0e, 0x50, 0x50, 0xd0, 0x0e, 0xb0, 0x91, 0x41, 0x00, 0x84, 0xc4, 0xd0, 0x1c, 0x02, 0x60, 0x40,
+    0xc0, 0xd0, 0x0a, 0xc1, 0xa7, 0x01, 0x04, 0x04, 0xc0, 0xd9, 0x40, 0x08, 0x0c, 0x0b, 0xff, 0x40,
+    0x70, 0x58, 0x78, 0x04, 0xc0, 0x81, 0x9e, 0xa0, 0x10, 0xff, 0x80, 0x31, 0xf3, 0x00, 0x7f, 0x08,
+    0x07, 0xc7, 0xce, 0x01, 0x80, 0x05, 0xdf, 0xe7, 0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40, 0xd1,
+    0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26, 0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x06, 0xbb, 0x5f,
+    0xe0, 0x00, 0x9c, 0xa0, 0x1f, 0xc0, 0x00, 0xa3, 0x9c, 0x03, 0xe9, 0x5f, 0x00, 0xf8, 0x6a, 0x00,
+    0x3e, 0xce, 0xf1, 0x00, 0xe2, 0x30, 0x03, 0x80, 0x72, 0x82, 0x86, 0x80, 0x75, 0x84, 0x8a, 0x08,
+    0x04, 0x26, 0x26, 0x80, 0xe0, 0x13, 0x02, 0x06, 0x06, 0x80, 0x56, 0x0d, 0x38, 0x08, 0x20, 0x26,
+    0x06, 0xca, 0x00, 0x40, 0x60, 0x5f, 0xfa, 0x03, 0x82, 0xc3, 0xc0, 0x26, 0x04, 0x00, 0x00, 0x57,
+    0xb8, 0x06, 0xa3, 0x10, 0x0e, 0xc6, 0x00, 0x97, 0x7f, 0x9c, 0x0a, 0x82, 0x0e, 0x14, 0xef, 0xd5,
+    0x03, 0x47, 0xb3, 0x5c, 0x00, 0xea, 0xdf, 0x00, 0x18, 0x9a, 0xc0, 0x0c, 0xa9, 0x74, 0x00, 0x00,
+    0x00, 0xf5, 0x40, 0x07, 0xc8, 0x89, 0x00, 0xe5, 0xcd, 0xe1, 0x00, 0xc5, 0x54, 0x76, 0x00, 0xe3,
+    0xd6, 0xf4, 0x00, 0xe1, 0xef, 0xe3, 0x00, 0xe2, 0x30, 0x03, 0x80, 0x72, 0x82, 0x86, 0x80, 0x75,
+    0x84, 0x8a, 0x08, 0x04, 0x26, 0x26, 0x80, 0xe0, 0x13, 0x02, 0x06, 0x06, 0x80, 0x56, 0x0d, 0x38,
+    0x08, 0x20, 0x26, 0x06, 0xca, 0x00, 0x40, 0x60, 0x5f, 0xfa, 0x03, 0x82, 0xc3, 0xc0, 0x26, 0x04,
+    0x00, 0x00, 0xeb, 0x70, 0x0c, 0xac, 0xe0, 0x08, 0xff, 0x68, 0x01, 0x1e, 0x95, 0x40, 0x06, 0xd5,
+    0xd7, 0x00, 0x3f, 0xfb, 0x14, 0x0a, 0x82, 0x0e, 0x14, 0xef, 0xd5, 0x03, 0x47, 0xb3, 0x5c, 0x00,
+    0xea, 0xdf, 0x00, 0x18, 0x9a, 0xc0, 0x0c, 0xa9, 0x74, 0x00, 0x00, 0x00, 0xc5, 0xa8, 0x01, 0xf1,
+    0x5c, 0x80, 0x79, 0x73, 0xf4, 0x03, 0x8a, 0xa8, 0xec, 0x01, 0xc7, 0xad, 0xe8, 0x01, 0xc3, 0xdf,
+    0xc6, 0x01, 0xc4, 0x60, 0x07, 0x00, 0xe5, 0x05, 0x0d, 0x00, 0xeb, 0x09, 0x14, 0x10, 0x08, 0x4c,
+    0x4d, 0x01, 0xc0, 0x26, 0x04, 0x0c, 0x0d, 0x00, 0xac, 0x1a, 0x70, 0x10, 0x40, 0x4c, 0x0d, 0x94,
+    0x00, 0x80, 0xc0, 0xbf, 0xf4, 0x07, 0x05, 0x87, 0x80, 0x4c, 0x08, 0x00, 0x00, 0x8f, 0x4c, 0x03,
+    0x1a, 0xc0, 0x05, 0x1e, 0x56, 0x00, 0x47, 0xa5, 0x50, 0x01, 0xb5, 0x75, 0xc0, 0x0f, 0xfe, 0xc5,
+    0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5, 0x40, 0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26,
+    0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x00, 0x00, 0xc3, 0xf8, 0x01, 0xf1, 0xd3, 0x00, 0x7b, 0x3a, 0xe0,
+    0x03, 0x8a, 0x73, 0x58, 0x03, 0x8a, 0x7f, 0x14, 0x03, 0x88, 0xc0, 0x0e, 0x01, 0xca, 0x0a, 0x1a,
+    0x01, 0xd6, 0x12, 0x28, 0x20, 0x10, 0x98, 0x9a, 0x03, 0x80, 0x4c, 0x08, 0x18, 0x1a, 0x01, 0x58,
+    0x34, 0xe0, 0x20, 0x80, 0x98, 0x1b, 0x28, 0x01, 0x01, 0x81, 0x7f, 0xe8, 0x0e, 0x0b, 0x0f, 0x00,
+    0x98, 0x10, 0x00, 0x00, 0x8b, 0xe8, 0x03, 0x15, 0x18, 0x05, 0x1f, 0xe9, 0x00, 0x23, 0xd2, 0xa8,
+    0x00, 0xda, 0xba, 0xe0, 0x07, 0xff, 0x62, 0x81, 0x50, 0x41, 0xc2, 0x9d, 0xfa, 0xa0, 0x68, 0xf6,
+    0x6b, 0x80, 0x1d, 0x5b, 0xe0, 0x03, 0x13, 0x58, 0x01, 0x95, 0x2e, 0x80, 0x00, 0x00, 0x1f, 0x7f,
+    0x40, 0x07, 0x1d, 0x34, 0x40, 0x03, 0x86, 0x82, 0x54, 0x03, 0x8f, 0x67, 0x58, 0x03, 0x8b, 0xfd,
+    0xa4, 0x01, 0xc4, 0x60, 0x07, 0x00, 0xe5, 0x05, 0x0d, 0x00, 0xeb, 0x09, 0x14, 0x10, 0x08, 0x4c,
+    0x4d, 0x01, 0xc0, 0x26, 0x04, 0x0c, 0x0d, 0x00, 0xac, 0x1a, 0x70, 0x10, 0x40, 0x4c, 0x0d, 0x94,
+    0x00, 0x80, 0xc0, 0xbf, 0xf4, 0x07, 0x05, 0x87, 0x80, 0x4c, 0x08, 0x00, 0x02, 0xe8, 0x59, 0x00,
+    0x53, 0x7d, 0xe8, 0x02, 0x02, 0x11, 0x00, 0x04, 0x7a, 0x55, 0x00, 0x1b, 0x57, 0x5c, 0x00, 0xff,
+    0xec, 0x50, 0x2a, 0x08, 0x38, 0x53, 0xbf, 0x54, 0x0d, 0x1e, 0xcd, 0x70, 0x03, 0xab, 0x7c, 0x00,
+    0x62, 0x6b, 0x00, 0x32, 0xa5, 0xd0, 0x00, 0x00, 0x89, 0xd0, 0x03, 0xef, 0xcb, 0x30, 0x0e, 0x3a,
+    0xba, 0x50, 0x0e, 0x3b, 0xfa, 0x70, 0x0e, 0x23, 0x00, 0x38, 0x07, 0x28, 0x28, 0x68, 0x07, 0x58,
+    0x48, 0xa0, 0x80, 0x42, 0x62, 0x68, 0x0e, 0x01, 0x30, 0x20, 0x60, 0x68, 0x05, 0x60, 0xd3, 0x80,
+    0x82, 0x02, 0x60, 0x6c, 0xa0, 0x04, 0x06, 0x05, 0xff, 0xa0, 0x38, 0x2c, 0x3c, 0x02, 0x60, 0x40,
+    0xcf, 0x50, 0x08, 0x7f, 0xc0, 0x18, 0xf9, 0x80, 0x3f, 0x84, 0x03, 0xe3, 0xe7, 0x00, 0xc0, 0x00,
+    0x4f, 0xd0, 0x04, 0x8d, 0x4a, 0xc0, 0x05, 0xe5, 0xe4, 0x00, 0x26, 0x7f, 0x94, 0x0a, 0x82, 0x0e,
+    0x14, 0xef, 0xd5, 0x03, 0x47, 0xb3, 0x5c, 0x00, 0xea, 0xdf, 0x00, 0x18, 0x9a, 0xc0, 0x0c, 0xa9,
+    0x74, 0x00, 0x1a, 0xed, 0x7f, 0x80, 0x02, 0x72, 0x80, 0x7f, 0x00, 0x00, 0xc5, 0xa6, 0x01, 0xf4,
+    0xa1, 0x80, 0x73, 0x5d, 0xba, 0x80, 0x39, 0x9f, 0xe6, 0x40, 0x1e, 0xcf, 0xe3, 0x00, 0xf6, 0x7f,
+    0x84, 0x03, 0x88, 0xc0, 0x0e, 0x01, 0xca, 0x0a, 0x1a, 0x01, 0xd6, 0x12, 0x28, 0x20, 0x10, 0x98,
+    0x9a, 0x03, 0x80, 0x4c, 0x08, 0x18, 0x1a, 0x01, 0x58, 0x34, 0xe0, 0x20, 0x80, 0x98, 0x1b, 0x28,
+    0x01, 0x01, 0x81, 0x7f, 0xe8, 0x0e, 0x0b, 0x0f, 0x00, 0x98, 0x10, 0x00, 0x00, 0x93, 0x48, 0x03,
+    0x45, 0x10, 0x02, 0x2f, 0x3a, 0x40, 0x12, 0xfe, 0x96, 0x00, 0x1c, 0xed, 0x20, 0x02, 0xef, 0x71,
+    0xc0, 0xa8, 0x20, 0xe1, 0x4e, 0xfd, 0x50, 0x34, 0x7b, 0x35, 0xc0, 0x0e, 0xad, 0xf0, 0x01, 0x89,
+    0xac, 0x00, 0xca, 0x97, 0x40, 0x00, 0x00, 0xb1, 0x80, 0x3f, 0x44, 0x00, 0x3e, 0x6f, 0xe7, 0xa0,
+    0x0e, 0x67, 0xf9, 0x90, 0x07, 0xb3, 0xf8, 0xc0, 0x3d, 0x9f, 0xe1, 0x00, 0xe2, 0x30, 0x03, 0x80,
+    0x72, 0x82, 0x86, 0x80, 0x75, 0x84, 0x8a, 0x08, 0x04, 0x26, 0x26, 0x80, 0xe0, 0x13, 0x02, 0x06,
+    0x06, 0x80, 0x56, 0x0d, 0x38, 0x08, 0x20, 0x26, 0x06, 0xca, 0x00, 0x40, 0x60, 0x5f, 0xfa, 0x03,
+    0x82, 0xc3, 0xc0, 0x26, 0x04, 0x00, 0x01, 0xc5, 0x00, 0xc3, 0x30, 0x01, 0xa3, 0xb6, 0x64, 0x00,
+    0x97, 0xf4, 0xb0, 0x00, 0xe7, 0x69, 0x00, 0x17, 0x7b, 0x8e, 0x05, 0x41, 0x07, 0x0a, 0x77, 0xea,
+    0x81, 0xa3, 0xd9, 0xae, 0x00, 0x75, 0x6f, 0x80, 0x0c, 0x4d, 0x60, 0x06, 0x54, 0xba, 0x00, 0x00,
+    0x00, 0x9b, 0xd8, 0x03, 0xcd, 0xad, 0x74, 0x01, 0xcc, 0xec, 0x72, 0x01, 0xec, 0xfe, 0x30, 0x0f,
+    0x67, 0xf8, 0x40, 0x38, 0x8c, 0x00, 0xe0, 0x1c, 0xa0, 0xa1, 0xa0, 0x1d, 0x61, 0x22, 0x82, 0x01,
+    0x09, 0x89, 0xa0, 0x38, 0x04, 0xc0, 0x81, 0x81, 0xa0, 0x15, 0x83, 0x4e, 0x02, 0x08, 0x09, 0x81,
+    0xb2, 0x80, 0x10, 0x18, 0x17, 0xfe, 0x80, 0xe0, 0xb0, 0xf0, 0x09, 0x81, 0x00, 0x00, 0x47, 0xa8,
+    0x06, 0x85, 0x10, 0x0a, 0x2e, 0xb6, 0x40, 0x12, 0xfe, 0x96, 0x00, 0x1c, 0xed, 0x20, 0x02, 0xef,
+    0x71, 0xc0, 0xa8, 0x20, 0xe1, 0x4e, 0xfd, 0x50, 0x34, 0x7b, 0x35, 0xc0, 0x0e, 0xad, 0xf0, 0x01,
+    0x89, 0xac, 0x00, 0xca, 0x97, 0x40, 0x00, 0x00, 0x1f, 0x7f, 0x48, 0x07, 0x2a, 0xbd, 0x80, 0x3c,
+    0xcf, 0xed, 0x40, 0x1e, 0xce, 0xe1, 0x80, 0x7b, 0x3b, 0xc4, 0x03, 0x88, 0xc0, 0x0e, 0x01, 0xca,
+    0x0a, 0x1a, 0x01, 0xd6, 0x12, 0x28, 0x20, 0x10, 0x98, 0x9a, 0x03, 0x80, 0x4c, 0x08, 0x18, 0x1a,
+    0x01, 0x58, 0x34, 0xe0, 0x20, 0x80, 0x98, 0x1b, 0x28, 0x01, 0x01, 0x81, 0x7f, 0xe8, 0x0e, 0x0b,
+    0x0f, 0x00, 0x98, 0x10, 0x00, 0x02, 0xe9, 0x5a, 0x00, 0x2b, 0x75, 0xf0, 0x04, 0x4e, 0x9a, 0x00,
+    0x66, 0x7b, 0xd8, 0x00, 0x73, 0xb4, 0x80, 0x0b, 0xbd, 0xc7, 0x02, 0xa0, 0x83, 0x85, 0x3b, 0xf5,
+    0x40, 0xd1, 0xec, 0xd7, 0x00, 0x3a, 0xb7, 0xc0, 0x06, 0x26, 0xb0, 0x03, 0x2a, 0x5d, 0x00, 0x00,
+    0x00, 0x35, 0x83, 0xd0, 0x07, 0x33, 0xfc, 0xc8, 0x03, 0xd9, 0xfc, 0x60, 0x1e, 0xcf, 0xf0, 0x80,
+    0x71, 0x18, 0x01, 0xc0, 0x39, 0x41, 0x43, 0x40, 0x3a, 0xc2, 0x45, 0x04, 0x02, 0x13, 0x13, 0x40,
+    0x70, 0x09, 0x81, 0x03, 0x03, 0x40, 0x2b, 0x06, 0x9c, 0x04, 0x10, 0x13, 0x03, 0x65, 0x00, 0x20,
+    0x30, 0x2f, 0xfd, 0x01, 0xc1, 0x61, 0xe0, 0x13, 0x02, 0x06, 0x7a, 0x80, 0x43, 0xfe, 0x00, 0xc7,
+    0xcc, 0x01, 0xfc, 0x20, 0x1f, 0x1f, 0x38, 0x06, 0x00, 0x08, 0xb0, 0x99, 0x00, 0x25, 0xfd, 0x2c,
+    0x00, 0x39, 0xda, 0x40, 0x05, 0xde, 0xe3, 0x81, 0x50, 0x41, 0xc2, 0x9d, 0xfa, 0xa0, 0x68, 0xf6,
+    0x6b, 0x80, 0x1d, 0x5b, 0xe0, 0x03, 0x13, 0x58, 0x01, 0x95, 0x2e, 0x80, 0x03, 0x5d, 0xaf, 0xf0,
+    0x00, 0x4e, 0x50, 0x0f, 0xe0, 0x4f, 0xff, 0x38, 0x00, 0x51, 0x31, 0x00, 0x12, 0xef, 0x28, 0x07,
+    0xf9, 0x2a, 0xb0, 0x80, 0x05, 0x57, 0x00, 0x4b, 0xff, 0x84, 0x03, 0xfc, 0x97, 0x79, 0x40, 0x02,
+    0x89, 0x89, 0x3f, 0xfc, 0xe0, 0x15, 0x68, 0x07, 0x84, 0x03, 0xeb, 0xd0, 0x08, 0x02, 0xbf, 0xd5,
+    0x01, 0xc5, 0x61, 0xa5, 0x61, 0x89, 0xd0, 0x9e, 0x09, 0xfe, 0x02, 0xe0, 0x8c, 0xc4, 0x4b, 0x04,
+    0xdc, 0xc7, 0x8e, 0x2b, 0xa3, 0xc0, 0x1d, 0xff, 0x40, 0x04, 0x7c, 0xe0, 0x18, 0x40, 0x40, 0x00,
+    0x00, 0x0f, 0x60, 0x80, 0x61, 0xb2, 0x00, 0xf2, 0xf8, 0x80, 0x13, 0xfe, 0xef, 0xf3, 0x80, 0x05,
+    0x13, 0x10, 0x01, 0x2e, 0xf2, 0x80, 0x7f, 0x92, 0xab, 0x08, 0x00, 0x55, 0x70, 0x04, 0xbf, 0xf8,
+    0x40, 0x3f, 0xc9, 0x77, 0x94, 0x00, 0x28, 0x98, 0x80, 0x00, 0x47, 0xc0, 0x06, 0x84, 0x00, 0xf5,
+    0xc0, 0x04, 0x57, 0xfa, 0xa0, 0x38, 0xac, 0x34, 0xac, 0x31, 0x3a, 0x13, 0xc1, 0x3f, 0xc0, 0x5c,
+    0x11, 0x98, 0x89, 0x60, 0x9b, 0x98, 0xf1, 0xc5, 0x74, 0x78, 0x00, 0x00, 0x57, 0x7e, 0x88, 0x05,
+    0x1f, 0xba, 0x10, 0x4f, 0xde, 0xdf, 0xf3, 0x80, 0x05, 0x13, 0x10, 0x01, 0x2e, 0xf2, 0x80, 0x7f,
+    0x92, 0xab, 0x08, 0x00, 0x55, 0x70, 0x04, 0xbf, 0xf8, 0x40, 0x3f, 0xc9, 0x77, 0x94, 0x00, 0x28,
+    0x98, 0x80, 0x01, 0xea, 0x4b, 0x00, 0x3a, 0x6d, 0xe8, 0x01, 0xed, 0xf9, 0x80, 0x07, 0x5f, 0x8a,
+    0x03, 0x8a, 0xc3, 0x4a, 0xc3, 0x13, 0xa1, 0x3c, 0x13, 0xfc, 0x05, 0xc1, 0x19, 0x88, 0x96, 0x09,
+    0xb9, 0x8f, 0x1c, 0x57, 0x47, 0x80, 0x00, 0xe4, 0xd2, 0x00, 0xe9, 0xb2, 0x00, 0xaf, 0x3d, 0x80,
+    0x2b, 0x05, 0xf0, 0x0d, 0x37, 0x3e, 0x00, 0x4f, 0xdf, 0xf6, 0xfb, 0x80, 0x05, 0x13, 0x10, 0x01,
+    0x2e, 0xf2, 0x80, 0x7f, 0x92, 0xab, 0x08, 0x00, 0x55, 0x70, 0x04, 0xbf, 0xf8, 0x40, 0x3f, 0xc9,
+    0x77, 0x94, 0x00, 0x28, 0x98, 0x80, 0x00, 0xea, 0x90, 0x0c, 0x88, 0x80, 0x03, 0xff, 0xb8, 0x40,
+    0xa2, 0x55, 0xc0, 0x2c, 0x6c, 0x40, 0x0a, 0x3f, 0xcc, 0x03, 0x8a, 0xc3, 0x4a, 0xc3, 0x13, 0xa1,
+    0x3c, 0x13, 0xfc, 0x05, 0xc1, 0x19, 0x88, 0x96, 0x09, 0xb9, 0x8f, 0x1c, 0x57, 0x47, 0x80, 0x00,
+    0xd3, 0x40, 0x1e, 0x84, 0x40, 0x06, 0xbd, 0xc4, 0x00, 0xac, 0x17, 0xc0, 0x34, 0xdc, 0xf8, 0x01,
+    0x3f, 0x7f, 0xdb, 0xee, 0x00, 0x14, 0x4c, 0x40, 0x04, 0xbb, 0xca, 0x01, 0xfe, 0x4a, 0xac, 0x20,
+    0x01, 0x55, 0xc0, 0x12, 0xff, 0xe1, 0x00, 0xff, 0x25, 0xde, 0x50, 0x00, 0xa2, 0x62, 0x00, 0x00,
+    0x8b, 0x50, 0x03, 0x15, 0xc8, 0x04, 0xff, 0xba, 0x00, 0x14, 0x4a, 0xb8, 0x05, 0x8d, 0x88, 0x01,
+    0x47, 0xf9, 0x80, 0x71, 0x58, 0x69, 0x58, 0x62, 0x74, 0x27, 0x82, 0x7f, 0x80, 0xb8, 0x23, 0x31,
+    0x12, 0xc1, 0x37, 0x31, 0xe3, 0x8a, 0xe8, 0xf0, 0x00, 0x00, 0xd3, 0xc8, 0x01, 0x8a, 0xd5, 0x80,
+    0x25, 0xcf, 0x32, 0x00, 0xd9, 0x8d, 0x10, 0x4f, 0xad, 0xea, 0xe7, 0x00, 0x0a, 0x26, 0x20, 0x02,
+    0x5d, 0xe5, 0x00, 0xff, 0x25, 0x56, 0x10, 0x00, 0xaa, 0xe0, 0x09, 0x7f, 0xf0, 0x80, 0x7f, 0x92,
+    0xef, 0x28, 0x00, 0x51, 0x31, 0x00, 0x00, 0xdf, 0x80, 0x1d, 0x8c, 0x01, 0x3f, 0xc5, 0x00, 0x0a,
+    0x25, 0x5c, 0x02, 0xc6, 0xc4, 0x00, 0xa3, 0xfc, 0xc0, 0x38, 0xac, 0x34, 0xac, 0x31, 0x3a, 0x13,
+    0xc1, 0x3f, 0xc0, 0x5c, 0x11, 0x98, 0x89, 0x60, 0x9b, 0x98, 0xf1, 0xc5, 0x74, 0x78, 0x00, 0x00,
+    0x5f, 0xf7, 0x04, 0x02, 0xa7, 0x77, 0x88, 0x05, 0x0a, 0x54, 0x01, 0xab, 0x2e, 0x04, 0x13, 0xf3,
+    0xbf, 0x39, 0xc0, 0x02, 0x89, 0x88, 0x00, 0x97, 0x79, 0x40, 0x3f, 0xc9, 0x55, 0x84, 0x00, 0x2a,
+    0xb8, 0x02, 0x5f, 0xfc, 0x20, 0x1f, 0xe4, 0xbb, 0xca, 0x00, 0x14, 0x4c, 0x40, 0x01, 0xe9, 0x4b,
+    0x00, 0x3b, 0xbe, 0xb8, 0x00, 0xdd, 0x2a, 0xa0, 0x01, 0x44, 0xab, 0x80, 0x58, 0xd8, 0x80, 0x14,
+    0x7f, 0x98, 0x07, 0x15, 0x86, 0x95, 0x86, 0x27, 0x42, 0x78, 0x27, 0xf8, 0x0b, 0x82, 0x33, 0x11,
+    0x2c, 0x13, 0x73, 0x1e, 0x38, 0xae, 0x8f, 0x00, 0x00, 0x99, 0xc0, 0x39, 0xe2, 0xa4, 0x03, 0xb7,
+    0xf8, 0x41, 0x3e, 0x33, 0x63, 0x9c, 0x00, 0x28, 0x98, 0x80, 0x09, 0x77, 0x94, 0x03, 0xfc, 0x95,
+    0x58, 0x40, 0x02, 0xab, 0x80, 0x25, 0xff, 0xc2, 0x01, 0xfe, 0x4b, 0xbc, 0xa0, 0x01, 0x44, 0xc4,
+    0x9f, 0xfe, 0x70, 0x0a, 0xb4, 0x03, 0xc2, 0x01, 0xf5, 0xe8, 0x04, 0x00, 0x00, 0x3f, 0xd8, 0x04,
+    0x71, 0x4a, 0xe0, 0x02, 0xd5, 0xf5, 0x00, 0x1c, 0xfe, 0x38, 0x0e, 0x2b, 0x0d, 0x2b, 0x0c, 0x4e,
+    0x84, 0xf0, 0x4f, 0xf0, 0x17, 0x04, 0x66, 0x22, 0x58, 0x26, 0xe6, 0x3c, 0x71, 0x5d, 0x1e, 0x00,
+    0xef, 0xfa, 0x00, 0x23, 0xe7, 0x00, 0xc2, 0x02, 0x00, 0x00, 0x8e, 0x80, 0x85, 0x10, 0x05, 0x48,
+    0x27, 0x50, 0x07, 0xff, 0x64, 0x9f, 0x79, 0x30, 0x06, 0x3a, 0xfc, 0x00, 0x7f, 0xf1, 0x80, 0x4f,
+    0xa0, 0x0f, 0xfe, 0x7a, 0x7d, 0x17, 0x38, 0x04, 0x5c, 0xe0, 0x3e, 0x60, 0x08, 0xf9, 0x97, 0xe0,
+    0x03, 0xff, 0x8c, 0xbf, 0x07, 0xcc, 0x01, 0x1f, 0x30, 0x00, 0x1d, 0xf6, 0xd0, 0x80, 0x4b, 0x88,
+    0x66, 0x5f, 0x20, 0x1b, 0x0b, 0xde, 0x71, 0x90, 0x41, 0x54, 0x00, 0x40, 0xa0, 0xe8, 0x68, 0x06,
+    0x50, 0x20, 0x00, 0x80, 0x7d, 0xa1, 0x80, 0x19, 0x40, 0x90, 0x55, 0x00, 0x10, 0x28, 0x22, 0x80,
+    0xbd, 0xe7, 0x19, 0x00, 0x36, 0x21, 0x82, 0xf9, 0x00, 0x47, 0x7d, 0xca, 0x10, 0x0f, 0x75, 0x00,
+    0x7e, 0x33, 0x00, 0x60, 0x02, 0xbf, 0xd8, 0x00, 0x0e, 0x22, 0x8b, 0xc0, 0x30, 0xbd, 0x60, 0x38,
+    0x70, 0x68, 0x00, 0xc0, 0xb8, 0x34, 0x00, 0x60, 0x4c, 0x2f, 0x38, 0x0c, 0x03, 0xa8, 0xc2, 0xf2,
+    0x00, 0x3b, 0xfd, 0x80, 0x0c, 0x3d, 0x20, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x97, 0xa8, 0x03, 0xe5,
+    0x66, 0x00, 0x7e, 0x9c, 0x00, 0xf1, 0xdf, 0xed, 0x08, 0x04, 0xb8, 0x86, 0x65, 0xf2, 0x01, 0xb0,
+    0xbd, 0xe7, 0x19, 0x04, 0x15, 0x40, 0x04, 0x0a, 0x0e, 0x86, 0x80, 0x65, 0x02, 0x00, 0x08, 0x07,
+    0xda, 0x18, 0x01, 0x94, 0x09, 0x05, 0x50, 0x01, 0x02, 0x82, 0x28, 0x0b, 0xde, 0x71, 0x90, 0x03,
+    0x62, 0x18, 0x2f, 0x90, 0x00, 0x00, 0x3f, 0xd0, 0x07, 0x3b, 0x00, 0x7d, 0x34, 0x01, 0x8a, 0xff,
+    0x60, 0x00, 0x38, 0x8a, 0x2f, 0x00, 0xc2, 0xf5, 0x80, 0xe1, 0xc1, 0xa0, 0x03, 0x02, 0xe0, 0xd0,
+    0x01, 0x81, 0x30, 0xbc, 0xe0, 0x30, 0x0e, 0xa3, 0x0b, 0xc8, 0x00, 0x00, 0xf4, 0x58, 0x07, 0xc2,
+    0xf0, 0x01, 0xc5, 0x95, 0xe6, 0x01, 0xde, 0xad, 0x20, 0x1c, 0x33, 0x2c, 0xd0, 0x0e, 0x2f, 0xec,
+    0xe1, 0x00, 0x97, 0x10, 0xcc, 0xbe, 0x40, 0x36, 0x17, 0xbc, 0xe3, 0x20, 0x82, 0xa8, 0x00, 0x81,
+    0x41, 0xd0, 0xd0, 0x0c, 0xa0, 0x40, 0x01, 0x00, 0xfb, 0x43, 0x00, 0x32, 0x81, 0x20, 0xaa, 0x00,
+    0x20, 0x50, 0x45, 0x01, 0x7b, 0xce, 0x32, 0x00, 0x6c, 0x43, 0x05, 0xf2, 0x00, 0x00, 0xe9, 0xa0,
+    0x0e, 0x26, 0x80, 0x09, 0x7f, 0xe2, 0x00, 0x0d, 0xc0, 0x48, 0x06, 0xd7, 0xca, 0x00, 0x8e, 0x3f,
+    0x2c, 0x00, 0x38, 0x8a, 0x2f, 0x00, 0xc2, 0xf5, 0x80, 0xe1, 0xc1, 0xa0, 0x03, 0x02, 0xe0, 0xd0,
+    0x01, 0x81, 0x30, 0xbc, 0xe0, 0x30, 0x0e, 0xa3, 0x0b, 0xc8, 0x00, 0x00, 0xeb, 0x70, 0x0f, 0xd1,
+    0x22, 0x01, 0xc5, 0x91, 0xc2, 0x01, 0xde, 0xad, 0x20, 0x1c, 0x33, 0x2c, 0xd0, 0x0e, 0x2f, 0xec,
+    0xe1, 0x00, 0x97, 0x10, 0xcc, 0xbe, 0x40, 0x36, 0x17, 0xbc, 0xe3, 0x20, 0x82, 0xa8, 0x00, 0x81,
+    0x41, 0xd0, 0xd0, 0x0c, 0xa0, 0x40, 0x01, 0x00, 0xfb, 0x43, 0x00, 0x32, 0x81, 0x20, 0xaa, 0x00,
+    0x20, 0x50, 0x45, 0x01, 0x7b, 0xce, 0x32, 0x00, 0x6c, 0x43, 0x05, 0xf2, 0x00, 0x00, 0x87, 0x18,
+    0x03, 0x86, 0x20, 0x01, 0x97, 0xe7, 0x80, 0x21, 0xb8, 0x09, 0x00, 0xda, 0xf9, 0x40, 0x11, 0xc7,
+    0xe5, 0x80, 0x07, 0x11, 0x45, 0xe0, 0x18, 0x5e, 0xb0, 0x1c, 0x38, 0x34, 0x00, 0x60, 0x5c, 0x1a,
+    0x00, 0x30, 0x26, 0x17, 0x9c, 0x06, 0x01, 0xd4, 0x61, 0x79, 0x00, 0x00, 0xed, 0xd0, 0x80, 0x7d,
+    0x82, 0x20, 0x0e, 0x3d, 0xac, 0x00, 0xf7, 0x23, 0x48, 0x07, 0x0c, 0xcb, 0x34, 0x03, 0x8b, 0xfb,
+    0x38, 0x40, 0x25, 0xc4, 0x33, 0x2f, 0x90, 0x0d, 0x85, 0xef, 0x38, 0xc8, 0x20, 0xaa, 0x00, 0x20,
+    0x50, 0x74, 0x34, 0x03, 0x28, 0x10, 0x00, 0x40, 0x3e, 0xd0, 0xc0, 0x0c, 0xa0, 0x48, 0x2a, 0x80,
+    0x08, 0x14, 0x11, 0x40, 0x5e, 0xf3, 0x8c, 0x80, 0x1b, 0x10, 0xc1, 0x7c, 0x80, 0x00, 0xdd, 0xa0,
+    0x1e, 0xc6, 0x00, 0xcb, 0xfe, 0xb0, 0x08, 0x6e, 0x02, 0x40, 0x36, 0xbe, 0x50, 0x04, 0x71, 0xf9,
+    0x60, 0x01, 0xc4, 0x51, 0x78, 0x06, 0x17, 0xac, 0x07, 0x0e, 0x0d, 0x00, 0x18, 0x17, 0x06, 0x80,
+    0x0c, 0x09, 0x85, 0xe7, 0x01, 0x80, 0x75, 0x18, 0x5e, 0x40, 0x00, 0xb3, 0x05, 0xc0, 0x1c, 0x63,
+    0x1a, 0xe0, 0x1c, 0x7f, 0x91, 0x20, 0x1e, 0x93, 0x97, 0x00, 0xe1, 0xeb, 0xc2, 0x00, 0xe2, 0xee,
+    0x7f, 0x84, 0x02, 0x5c, 0x43, 0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82, 0x0a, 0xa0, 0x02,
+    0x05, 0x07, 0x43, 0x40, 0x32, 0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca, 0x04, 0x82, 0xa8,
+    0x00, 0x81, 0x41, 0x14, 0x05, 0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8, 0x00, 0x00, 0x6d,
+    0x96, 0x80, 0x48, 0xdd, 0x94, 0x01, 0x27, 0x51, 0xb8, 0x04, 0x37, 0x01, 0x20, 0x1b, 0x5f, 0x28,
+    0x02, 0x38, 0xfc, 0xb0, 0x00, 0xe2, 0x28, 0xbc, 0x03, 0x0b, 0xd6, 0x03, 0x87, 0x06, 0x80, 0x0c,
+    0x0b, 0x83, 0x40, 0x06, 0x04, 0xc2, 0xf3, 0x80, 0xc0, 0x3a, 0x8c, 0x2f, 0x20, 0x00, 0x00, 0xce,
+    0xc0, 0x1f, 0x55, 0xcb, 0x00, 0x71, 0x6e, 0xac, 0x40, 0x38, 0x73, 0xe7, 0x44, 0x02, 0x5c, 0x43,
+    0x32, 0xf9, 0x00, 0xd8, 0x5e, 0xf3, 0x8c, 0x82, 0x0a, 0xa0, 0x02, 0x05, 0x07, 0x43, 0x40, 0x32,
+    0x81, 0x00, 0x04, 0x03, 0xed, 0x0c, 0x00, 0xca, 0x04, 0x82, 0xa8, 0x00, 0x81, 0x41, 0x14, 0x05,
+    0xef, 0x38, 0xc8, 0x01, 0xb1, 0x0c, 0x17, 0xc8, 0x02, 0x3b, 0xee, 0x50, 0x80, 0x7b, 0xa8, 0x03,
+    0xf1, 0x98, 0x03, 0x00, 0x00, 0x2f, 0xe8, 0x06, 0x1b, 0x90, 0x90, 0x0d, 0x8d, 0x96, 0x01, 0x1c,
+    0xfe, 0x50, 0x00, 0x71, 0x14, 0x5e, 0x01, 0x85, 0xeb, 0x01, 0xc3, 0x83, 0x40, 0x06, 0x05, 0xc1,
+    0xa0, 0x03, 0x02, 0x61, 0x79, 0xc0, 0x60, 0x1d, 0x46, 0x17, 0x90, 0x01, 0xdf, 0xec, 0x00, 0x61,
+    0xe9, 0x00, 0xf8, 0x40, 0x20, 0x00, 0xc3, 0xf4, 0x01, 0xf4, 0x1d, 0x00, 0x7d, 0x38, 0x0d, 0xe8,
+    0x00, 0x3b, 0xef, 0xf4, 0x80, 0x4b, 0x88, 0xa6, 0x00, 0x74, 0x1b, 0x0d, 0xbc, 0x90, 0x10, 0x41,
+    0x62, 0x00, 0x30, 0xb0, 0x68, 0x78, 0x06, 0x50, 0x30, 0x00, 0x80, 0x7d, 0xa1, 0xa0, 0x19, 0x40,
+    0x90, 0x55, 0x00, 0x10, 0x26, 0x22, 0x80, 0xbd, 0xe7, 0x0e, 0x00, 0x36, 0x21, 0x82, 0xf1, 0x00,
+    0x00, 0x8b, 0xe0, 0x03, 0xa5, 0x26, 0x8c, 0x02, 0xbb, 0x1a, 0xb0, 0x15, 0xff, 0xb4, 0x90, 0x71,
+    0x21, 0x41, 0xc5, 0x85, 0xdd, 0x40, 0xa1, 0xc1, 0xa0, 0x03, 0x02, 0xe0, 0xd0, 0x01, 0x81, 0x30,
+    0xbc, 0xe0, 0x38, 0x0e, 0xa3, 0x0b, 0xc0, 0x00, 0x00, 0x0e, 0xe0, 0x07, 0xc3, 0xe6, 0xa0, 0x1f,
+    0x17, 0xa8, 0x37, 0xa0, 0x00, 0xef, 0xbf, 0xd2, 0x01, 0x2e, 0x22, 0x98, 0x01, 0xd0, 0x6c, 0x36,
+    0xf2, 0x40, 0x41, 0x05, 0x88, 0x00, 0xc2, 0xc1, 0xa1, 0xe0, 0x19, 0x40, 0xc0, 0x02, 0x01, 0xf6,
+    0x86, 0x80, 0x65, 0x02, 0x41, 0x54, 0x00, 0x40, 0x98, 0x8a, 0x02, 0xf7, 0x9c, 0x38, 0x00, 0xd8,
+    0x86, 0x0b, 0xc4, 0x00, 0x01, 0xeb, 0x00, 0xe1, 0xd4, 0x31, 0xa3, 0x00, 0x1f, 0x99, 0x95, 0x80,
+    0xaf, 0xfd, 0xa4, 0x83, 0x89, 0x0a, 0x0e, 0x2c, 0x2e, 0xea, 0x05, 0x0e, 0x0d, 0x00, 0x18, 0x17,
+    0x06, 0x80, 0x0c, 0x09, 0x85, 0xe7, 0x01, 0xc0, 0x75, 0x18, 0x5e, 0x00, 0x00, 0x97, 0xa8, 0x03,
+    0xe5, 0x66, 0x00, 0x7e, 0x9c, 0x06, 0xf4, 0x00, 0x1d, 0xff, 0xd2, 0x01, 0x2e, 0x22, 0x98, 0x01,
+    0xd0, 0x6c, 0x36, 0xf2, 0x40, 0x41, 0x05, 0x88, 0x00, 0xc2, 0xc1, 0xa1, 0xe0, 0x19, 0x40, 0xc0,
+    0x02, 0x01, 0xf6, 0x86, 0x80, 0x65, 0x02, 0x41, 0x54, 0x00, 0x40, 0x98, 0x8a, 0x02, 0xf7, 0x9c,
+    0x38, 0x00, 0xd8, 0x86, 0x0b, 0xc4, 0x00, 0x00, 0x3f, 0xd0, 0x07, 0x3b, 0x00, 0xd1, 0x80, 0x53,
+    0x46, 0xac, 0x05, 0x7f, 0xed, 0x24, 0x1c, 0x48, 0x50, 0x71, 0x61, 0x77, 0x50, 0x28, 0x70, 0x68,
+    0x00, 0xc0, 0xb8, 0x34, 0x00, 0x60, 0x4c, 0x2f, 0x38, 0x0e, 0x03, 0xa8, 0xc2, 0xf0, 0x00, 0x00,
+    0xae, 0x8b, 0x40, 0x38, 0x9b, 0x35, 0xc0, 0x38, 0xb1, 0xbe, 0x9b, 0xd0, 0x00, 0x75, 0xdf, 0xe9,
+    0x00, 0x97, 0x11, 0x4c, 0x00, 0xe8, 0x36, 0x1b, 0x79, 0x20, 0x20, 0x82, 0xc4, 0x00, 0x61, 0x60,
+    0xd0, 0xf0, 0x0c, 0xa0, 0x60, 0x01, 0x00, 0xfb, 0x43, 0x40, 0x32, 0x81, 0x20, 0xaa, 0x00, 0x20,
+    0x4c, 0x45, 0x01, 0x7b, 0xce, 0x1c, 0x00, 0x6c, 0x43, 0x05, 0xe2, 0x00, 0x00, 0x4d, 0xab, 0x80,
+    0x65, 0x8b, 0x3b, 0x40, 0x06, 0x1f, 0x32, 0x08, 0x15, 0xff, 0xb4, 0x90, 0x71, 0x21, 0x41, 0xc5,
+    0x85, 0xdd, 0x40, 0xa1, 0xc1, 0xa0, 0x03, 0x02, 0xe0, 0xd0, 0x01, 0x81, 0x30, 0xbc, 0xe0, 0x38,
+    0x0e, 0xa3, 0x0b, 0xc0, 0x00, 0x00, 0xf9, 0xbd, 0x00, 0x07, 0x7d, 0xfe, 0x90, 0x09, 0x71, 0x14,
+    0xc0, 0x0e, 0x83, 0x61, 0xb7, 0x92, 0x02, 0x08, 0x2c, 0x40, 0x06, 0x16, 0x0d, 0x0f, 0x00, 0xca,
+    0x06, 0x00, 0x10, 0x0f, 0xb4, 0x34, 0x03, 0x28, 0x12, 0x0a, 0xa0, 0x02, 0x04, 0xc4, 0x50, 0x17,
+    0xbc, 0xe1, 0xc0, 0x06, 0xc4, 0x30, 0x5e, 0x20, 0x08, 0xef, 0xb9, 0x42, 0x01, 0xee, 0xa0, 0x0f,
+    0xc6, 0x60, 0x0c, 0x00, 0x00, 0xe1, 0x72, 0x00, 0xe3, 0x87, 0x02, 0xbf, 0xf6, 0x92, 0x0e, 0x24,
+    0x28, 0x38, 0xb0, 0xbb, 0xa8, 0x14, 0x38, 0x34, 0x00, 0x60, 0x5c, 0x1a, 0x00, 0x30, 0x26, 0x17,
+    0x9c, 0x07, 0x01, 0xd4, 0x61, 0x78, 0x00, 0x1d, 0xfe, 0xc0, 0x06, 0x1e, 0x90, 0x0f, 0x84, 0x02,
+    0x00, 0x4f, 0x90, 0x09, 0xbd, 0xc0, 0x3f, 0xfc, 0x66, 0x01, 0x08, 0x0a, 0x82, 0x08, 0x02, 0x80,
+    0x85, 0x87, 0xb3, 0x89, 0x10, 0x13, 0x04, 0x66, 0x7b, 0x00, 0x9f, 0x7f, 0x60, 0x03, 0x93, 0x98,
+    0x03, 0xf1, 0x80, 0x40, 0x5f, 0x80, 0x07, 0x70, 0x03, 0xff, 0x92, 0x20, 0x60, 0x42, 0x0a, 0x09,
+    0x98, 0x00, 0x0c, 0x89, 0x40, 0x80, 0x1b, 0xb8, 0xdd, 0xc0, 0x0b, 0x6c, 0x03, 0xc2, 0x00, 0x00,
+    0x00, 0xa7, 0x98, 0x03, 0xd0, 0x42, 0x01, 0xe1, 0xd7, 0x00, 0x93, 0xe4, 0x04, 0x1b, 0xdc, 0x03,
+    0xff, 0xc6, 0x60, 0x10, 0x80, 0xa8, 0x20, 0x80, 0x28, 0x08, 0x58, 0x7b, 0x38, 0x91, 0x01, 0x30,
+    0x46, 0x67, 0xb0, 0x00, 0x00, 0x37, 0xd8, 0x06, 0x66, 0x08, 0x07, 0x4d, 0x00, 0x17, 0xe0, 0x01,
+    0xdc, 0x00, 0xff, 0xe4, 0x88, 0x18, 0x10, 0x82, 0x82, 0x66, 0x00, 0x03, 0x22, 0x50, 0x20, 0x00,
+    0x00, 0xcb, 0xea, 0x01, 0xf4, 0x3a, 0x8d, 0x28, 0x06, 0xd8, 0x03, 0x5d, 0x4f, 0x90, 0x09, 0xb4,
+    0x34, 0x03, 0xf3, 0xa8, 0x07, 0xef, 0x00, 0xff, 0xea, 0x98, 0x04, 0x20, 0x20, 0xa0, 0x82, 0x00,
+    0xa0, 0x20, 0x16, 0x1e, 0xce, 0x24, 0x40, 0x02, 0x60, 0x8c, 0xcf, 0x60, 0x00, 0x00, 0x8b, 0xe4,
+    0x03, 0xd0, 0x72, 0x94, 0x20, 0x15, 0x60, 0x12, 0x82, 0xfc, 0x00, 0x3a, 0x48, 0x40, 0x3e, 0xd0,
+    0x0f, 0x84, 0x03, 0xfe, 0x10, 0x30, 0x21, 0x00, 0x94, 0x13, 0x30, 0x01, 0x86, 0x44, 0xa0, 0x40,
+    0x20, 0x00, 0x1f, 0xb8, 0x07, 0xc7, 0x30, 0x20, 0x34, 0xa0, 0x13, 0x78, 0x81, 0xae, 0xa7, 0xc8,
+    0x04, 0xda, 0x1a, 0x01, 0xf9, 0xd4, 0x03, 0xf7, 0x80, 0x7f, 0xf5, 0x4c, 0x02, 0x10, 0x10, 0x50,
+    0x41, 0x00, 0x50, 0x10, 0x0b, 0x0f, 0x67, 0x12, 0x20, 0x01, 0x30, 0x46, 0x67, 0xb0, 0x00, 0x01,
+    0xeb, 0x00, 0xf0, 0xea, 0x20, 0x12, 0x84, 0x00, 0x7e, 0x80, 0x4a, 0x0b, 0xf0, 0x00, 0xe9, 0x21,
+    0x00, 0xfb, 0x40, 0x3e, 0x10, 0x0f, 0xf8, 0x40, 0xc0, 0x84, 0x02, 0x50, 0x4c, 0xc0, 0x06, 0x19,
+    0x12, 0x81, 0x00, 0x80, 0x00, 0xa7, 0x98, 0x03, 0xe8, 0x21, 0x01, 0x95, 0x00, 0x87, 0x5c, 0x0d,
+    0xb5, 0x3e, 0x40, 0x41, 0xb4, 0x34, 0x03, 0xf3, 0xa8, 0x07, 0xef, 0x00, 0xff, 0xea, 0x98, 0x04,
+    0x20, 0x20, 0xa0, 0x82, 0x00, 0xa0, 0x20, 0x16, 0x1e, 0xce, 0x24, 0x40, 0x02, 0x60, 0x8c, 0xcf,
+    0x60, 0x00, 0x00, 0x37, 0xd8, 0x07, 0x99, 0x82, 0x09, 0x42, 0x01, 0x4d, 0x01, 0x28, 0x2f, 0xc0,
+    0x03, 0xa4, 0x84, 0x03, 0xed, 0x00, 0xf8, 0x40, 0x3f, 0xe1, 0x03, 0x02, 0x10, 0x09, 0x41, 0x33,
+    0x00, 0x18, 0x64, 0x4a, 0x04, 0x02, 0x00, 0x00, 0x16, 0xc2, 0xc8, 0x07, 0x2a, 0x0d, 0x60, 0xca,
+    0x80, 0x1a, 0x65, 0xca, 0x6d, 0xa9, 0xf0, 0x00, 0x16, 0xd0, 0xd0, 0x0f, 0xce, 0xa0, 0x1f, 0xbc,
+    0x03, 0xff, 0xaa, 0x60, 0x10, 0x80, 0x82, 0x82, 0x08, 0x02, 0x80, 0x80, 0x58, 0x7b, 0x38, 0x91,
+    0x00, 0x09, 0x82, 0x33, 0x3d, 0x80, 0x00, 0x00, 0x6d, 0x97, 0x00, 0x63, 0x1d, 0xd3, 0xa5, 0x08,
+    0x1e, 0xb7, 0xc9, 0x28, 0x2f, 0xc8, 0x03, 0xa4, 0x84, 0x03, 0xed, 0x00, 0xf8, 0x40, 0x3f, 0xe1,
+    0x03, 0x02, 0x10, 0x09, 0x41, 0x33, 0x00, 0x18, 0x64, 0x4a, 0x04, 0x02, 0x00, 0x00, 0xf8, 0x5d,
+    0x00, 0x3e, 0x38, 0xc4, 0xf9, 0x00, 0x9b, 0x43, 0x40, 0x3f, 0x3a, 0x80, 0x7e, 0xf0, 0x0f, 0xfe,
+    0xa9, 0x80, 0x42, 0x02, 0x0a, 0x08, 0x20, 0x0a, 0x02, 0x01, 0x61, 0xec, 0xe2, 0x44, 0x00, 0x26,
+    0x08, 0xcc, 0xf6, 0x01, 0x9f, 0x7f, 0x60, 0x03, 0xc9, 0xcc, 0x01, 0xfc, 0x60, 0x18, 0x00, 0xf1,
+    0x38, 0x07, 0xc9, 0x02, 0xbf, 0x00, 0x0e, 0x91, 0x10, 0x07, 0xdc, 0x01, 0xf0, 0x80, 0x7f, 0xc2,
+    0x06, 0x04, 0x20, 0x12, 0x82, 0x66, 0x00, 0x30, 0xc8, 0x94, 0x08, 0x06, 0x6e, 0xe3, 0x77, 0x00,
+    0x3b, 0x6c, 0x03, 0xf0, 0x80, 0x60, 0x00, 0x27, 0xb0, 0x07, 0x91, 0xe0, 0x03, 0xe8, 0xe0, 0x0d,
+    0x5f, 0x00, 0x14, 0xfd, 0x40, 0x39, 0x00, 0xb0, 0x59, 0x38, 0x40, 0x40, 0x38, 0x84, 0x0a, 0xa3,
+    0x0c, 0x00, 0x50, 0x16, 0x10, 0x01, 0x98, 0x80, 0x98, 0x03, 0xa8, 0x28, 0x03, 0xc2, 0x01, 0xff,
+    0xcb, 0x00, 0x04, 0xf6, 0x00, 0xe4, 0x78, 0x00, 0xf4, 0x70, 0x06, 0xbf, 0x20, 0x07, 0xf0, 0x68,
+    0x28, 0x20, 0x38, 0x30, 0x58, 0x68, 0x50, 0x01, 0x4c, 0x9c, 0x8c, 0x01, 0xc1, 0x62, 0xa0, 0x12,
+    0x0b, 0x05, 0x00, 0x67, 0x03, 0x20, 0x0d, 0xc1, 0x60, 0x10, 0xc4, 0x8b, 0x00, 0x46, 0xe7, 0x62,
+    0x01, 0x00, 0xaf, 0x80, 0x0a, 0x7e, 0xa0, 0x1c, 0x80, 0x58, 0x2c, 0x9c, 0x20, 0x20, 0x1c, 0x42,
+    0x05, 0x51, 0x86, 0x00, 0x28, 0x0b, 0x08, 0x00, 0xcc, 0x40, 0x4c, 0x01, 0xd4, 0x14, 0x01, 0xe1,
+    0x00, 0xff, 0xe7, 0x37, 0xb8, 0x07, 0x93, 0x90, 0x03, 0xc2, 0x02, 0x01, 0xe5, 0xe5, 0x00, 0x80,
+    0xbf, 0x20, 0x07, 0xf0, 0x68, 0x28, 0x20, 0x38, 0x30, 0x58, 0x68, 0x50, 0x01, 0x4c, 0x9c, 0x8c,
+    0x01, 0xc1, 0x62, 0xa0, 0x12, 0x0b, 0x05, 0x00, 0x67, 0x03, 0x20, 0x0d, 0xc1, 0x60, 0x10, 0xc4,
+    0x8b, 0x30, 0x80, 0xdc, 0xed, 0x66, 0x00, 0xbf, 0x55, 0x32, 0xc0, 0x00, 0xab, 0x94, 0x03, 0xd6,
+    0x66, 0x00, 0xf0, 0xe3, 0x00, 0x55, 0xf0, 0x02, 0x13, 0xf5, 0x00, 0xe4, 0x02, 0xc1, 0x64, 0xe1,
+    0x01, 0x00, 0xe2, 0x10, 0x2a, 0x8c, 0x30, 0x01, 0x40, 0x58, 0x40, 0x06, 0x62, 0x02, 0x60, 0x0e,
+    0xa0, 0xa0, 0x0f, 0x08, 0x07, 0xff, 0x2c, 0x00, 0x5f, 0xb0, 0x07, 0x59, 0x18, 0x07, 0xb5, 0x40,
+    0x2b, 0xf2, 0x00, 0x7f, 0x06, 0x82, 0x82, 0x03, 0x83, 0x05, 0x86, 0x85, 0x00, 0x14, 0xc9, 0xc8,
+    0xc0, 0x1c, 0x16, 0x2a, 0x01, 0x20, 0xb0, 0x50, 0x06, 0x70, 0x32, 0x00, 0xdc, 0x16, 0x01, 0x0c,
+    0x48, 0xb0, 0x04, 0x6e, 0x76, 0x20, 0x10, 0x00, 0x2e, 0xf7, 0x18, 0x03, 0x27, 0xe7, 0xb0, 0x02,
+    0xbe, 0x48, 0x83, 0x3f, 0x50, 0x0e, 0x40, 0x2c, 0x16, 0x4e, 0x10, 0x10, 0x0e, 0x21, 0x02, 0xa8,
+    0xc3, 0x00, 0x14, 0x05, 0x84, 0x00, 0x66, 0x20, 0x26, 0x00, 0xea, 0x0a, 0x00, 0xf0, 0x80, 0x7f,
+    0xf2, 0xc0, 0x03, 0xe8, 0x68, 0x00, 0xad, 0x8a, 0x70, 0x02, 0x98, 0xae, 0x40, 0x05, 0xf1, 0x00,
+    0xff, 0x06, 0x82, 0x82, 0x03, 0x83, 0x05, 0x86, 0x85, 0x00, 0x14, 0xc9, 0xc8, 0xc0, 0x1c, 0x16,
+    0x2a, 0x01, 0x20, 0xb0, 0x50, 0x06, 0x70, 0x32, 0x00, 0xdc, 0x16, 0x01, 0x0c, 0x48, 0xb0, 0x04,
+    0x6e, 0x76, 0x20, 0x10, 0xff, 0x07, 0xf8, 0x03, 0xff, 0xfe, 0x00, 0xb0, 0x05, 0xde, 0x30, 0x02,
+    0x00, 0x11, 0x33, 0x80, 0x02, 0xfb, 0x1f, 0xb0, 0x03, 0xe8, 0x27, 0x02, 0x7a, 0xb5, 0x81, 0xd8,
+    0x1e, 0xa0, 0xb0, 0x3a, 0x83, 0x90, 0x80, 0x7f, 0xfa, 0x80, 0x00, 0x85, 0x90, 0x03, 0x2f, 0x4e,
+    0x80, 0x49, 0x43, 0x52, 0x01, 0x48, 0x6a, 0x88, 0x00, 0x48, 0x87, 0x3e, 0x80, 0xa0, 0xc1, 0xa3,
+    0x62, 0x01, 0x91, 0x00, 0xaa, 0x05, 0x00, 0xce, 0x2a, 0x39, 0x68, 0x46, 0x14, 0xc4, 0x88, 0xf0,
+    0x00, 0x00, 0xe1, 0x00, 0xe6, 0xeb, 0x00, 0xd1, 0x21, 0xe0, 0x12, 0x39, 0x7a, 0x80, 0x50, 0x12,
+    0x22, 0x00, 0x8c, 0x92, 0x7d, 0x00, 0x81, 0x83, 0x46, 0x80, 0x39, 0x10, 0x26, 0x40, 0xa0, 0x1e,
+    0x61, 0xbb, 0x21, 0x18, 0x4b, 0xaa, 0x93, 0xc0, 0x0c, 0xf4, 0x00, 0xbb, 0xc8, 0x20, 0x3c, 0x00,
+    0xa2, 0xa4, 0x08, 0x48, 0x41, 0x21, 0x00, 0x14, 0x05, 0x99, 0x94, 0x80, 0x25, 0x26, 0x90, 0x80,
+    0x0a, 0x78, 0x81, 0x54, 0x40, 0x07, 0x62, 0x20, 0x02, 0x00, 0x2d, 0x0c, 0x90, 0x52, 0x00, 0xb4,
+    0x32, 0x42, 0x00, 0x33, 0xb1, 0x0d, 0x90, 0x06, 0x00, 0x07, 0xf8, 0x00, 0x7f, 0x80, 0x0c, 0x0a,
+    0x08, 0x0a, 0x00, 0x13, 0x22, 0x68, 0x70, 0x05, 0x40, 0x8e, 0x28, 0x01, 0x38, 0x58, 0xb8, 0x05,
+    0x3e, 0x04, 0x1a, 0x00, 0x86, 0x52, 0x01, 0x40, 0x01, 0x85, 0xc0, 0x30, 0x04, 0x61, 0x96, 0x14,
+    0x01, 0x43, 0x10, 0x51, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x8c, 0x04, 0xef, 0x80, 0x18, 0x8c, 0x04, 0xef, 0x80, 0x58, 0x8f, 0xb1, 0xdf,
+    0xe0, 0x88, 0xf2, 0x3b, 0xf8, 0xc0, 0x88, 0xff, 0xe0, 0xbb, 0xff, 0xf0, 0x40, 0x88, 0xff, 0xe0,
+    0xbb, 0xff, 0xf0, 0x40, 0x8d, 0x4d, 0x82, 0x20, 0x90, 0x80, 0x7f, 0xfe, 0x80, 0x0f, 0xfe, 0xe0,
+    0xff, 0xee, 0x0f, 0xfe, 0xe0, 0x0b, 0xa0, 0x42, 0x40, 0xe0, 0x64, 0x00, 0x19, 0x62, 0x60, 0x60,
+    0x42, 0x12, 0x00, 0x39, 0x34, 0x60, 0xe1, 0x32, 0x40, 0x00, 0xaf, 0x1f, 0x02, 0x40, 0x61, 0x71,
+    0x00, 0x0b, 0xa0, 0xf5, 0x04, 0x24, 0x06, 0x40, 0xed, 0x02, 0x06, 0x4e, 0x61, 0x00, 0x19, 0x65,
+    0x92, 0x23, 0x07, 0xb1, 0x30, 0x23, 0x20, 0x10, 0x91, 0x30, 0x00, 0x39, 0x37, 0x90, 0x46, 0x0a,
+    0x50, 0xe1, 0x32, 0x40, 0x24, 0x10, 0xc0, 0x00, 0xaf, 0x2f, 0xa0, 0xf0, 0x13, 0x60, 0x40, 0x64,
+    0x20, 0x17, 0x1a, 0x70, 0x00, 0x00, 0x1f, 0xd0, 0x07, 0xf0, 0xfe, 0x02, 0xfc, 0x0c, 0x30, 0x14,
+    0x60, 0x3d, 0x03, 0xb9, 0x00, 0x04, 0x04, 0x01, 0x84, 0x38, 0x03, 0xb9, 0x80, 0x00, 0x00, 0x1f,
+    0xd0, 0x04, 0x4c, 0x02, 0x42, 0x2d, 0xa0, 0x4d, 0x91, 0xa8, 0x03, 0xaa, 0x03, 0x90, 0x3b, 0x8c,
+    0x76, 0x81, 0x36, 0x46, 0xa0, 0x0e, 0xa8, 0x0a, 0x80, 0xca, 0x40, 0x02, 0x02, 0x00, 0xc2, 0x1c,
+    0x00, 0x00, 0x00, 0x08, 0x05, 0x3d, 0xc3, 0x26, 0x01, 0x80, 0x0c, 0x25, 0x02, 0x70, 0x00, 0x64,
+    0x00, 0x75, 0xd0, 0x80, 0x11, 0x00, 0xde, 0xb1, 0x22, 0x00, 0x01, 0x04, 0xe7, 0x70, 0x90, 0x01,
+    0x00, 0x08, 0x27, 0x39, 0x75, 0x38, 0x91, 0x91, 0x00, 0x01, 0x00, 0x08, 0x07, 0x27, 0x39, 0x75,
+    0x07, 0x68, 0x38, 0x91, 0x91, 0x00, 0x98, 0x00, 0x01, 0x04, 0xe7, 0x70, 0x90, 0x00, 0x05, 0xee,
+    0x28, 0x05, 0x56, 0x01, 0xfa, 0x9d, 0xd4, 0x00, 0x55, 0x50, 0x07, 0xc4, 0x15, 0x60, 0x43, 0x72,
+    0x20, 0x1f, 0x10, 0x2a, 0x01, 0x59, 0x30, 0x07, 0xf5, 0x44, 0x29, 0x17, 0x80, 0x3f, 0xcb, 0xdc,
+    0x5a, 0x81, 0xde, 0x70, 0x6e, 0xd4, 0x00, 0xe9, 0x27, 0xe6, 0x88, 0x24, 0xc9, 0x28, 0x03, 0x1b,
+    0x70, 0x16, 0xb0, 0x68, 0x36, 0x88, 0x80, 0x2e, 0x72, 0x02, 0xd6, 0x0d, 0x06, 0xd1, 0x10, 0x02,
+    0x02, 0x00, 0x1c, 0xd1, 0x04, 0x99, 0x3d, 0x00, 0x05, 0xee, 0x28, 0x05, 0x56, 0x01, 0xff, 0xc0,
+    0xa7, 0x75, 0x00, 0x15, 0x54, 0x01, 0xff, 0x10, 0x55, 0x81, 0x0d, 0xc8, 0x80, 0x7f, 0xc4, 0x0a,
+    0x80, 0x56, 0x4c, 0x01, 0xff, 0xc1, 0xa8, 0x85, 0x22, 0xf0, 0x07, 0xff, 0x09, 0x7b, 0x8b, 0x50,
+    0x3b, 0xce, 0x0d, 0xda, 0x81, 0x3d, 0x84, 0x01, 0xa4, 0x9f, 0x9a, 0x20, 0x93, 0x24, 0xa5, 0x6b,
+    0x08, 0x00, 0x8d, 0xb8, 0x0b, 0x58, 0x34, 0x1b, 0x47, 0x09, 0x51, 0xc0, 0x2e, 0x72, 0x02, 0xd6,
+    0x0d, 0x06, 0xd1, 0xc2, 0x54, 0x70, 0x04, 0x04, 0x00, 0x39, 0xa2, 0x09, 0x32, 0x7a, 0x56, 0xa0,
+    0x80, 0x1f, 0x82, 0x0d, 0x70, 0x70, 0x52, 0x00, 0x1f, 0x80, 0xdc, 0x20, 0xd0, 0x25, 0x70, 0x70,
+    0x07, 0x82, 0x90, 0xa2, 0x00, 0x1f, 0x80, 0xdc, 0x09, 0xf0, 0x20, 0xd0, 0x25, 0x02, 0x20, 0x38,
+    0x38, 0x03, 0xc1, 0xdc, 0x00, 0x52, 0x14, 0x40, 0x37, 0x80, 0x4f, 0x55, 0x01, 0x08, 0xbc, 0x1b,
+    0xc0, 0x4f, 0x50, 0xf9, 0x50, 0x20, 0x22, 0x08, 0xbc, 0x1d, 0xc0, 0xde, 0x1e, 0xc0, 0x4f, 0x50,
+    0xf9, 0x0c, 0xd0, 0x50, 0x20, 0x22, 0x02, 0x90, 0x08, 0xbc, 0x1d, 0xc1, 0x80, 0x13, 0x78, 0x7b,
+    0x03, 0xa0, 0x80, 0x00, 0x4f, 0xb0, 0x04, 0xad, 0x32, 0x20, 0x1b, 0x96, 0x67, 0x00, 0x00, 0x57,
+    0xb0, 0x42, 0xb3, 0x15, 0xce, 0x41, 0xc4, 0x84, 0x0a, 0x87, 0x40, 0x09, 0x2e, 0xa0, 0x5f, 0xb0,
+    0x02, 0xba, 0x40, 0x02, 0x11, 0xd4, 0x05, 0x41, 0xc3, 0x46, 0x89, 0x5e, 0x54, 0x00, 0x00, 0xd5,
+    0xa0, 0x1e, 0x8b, 0x27, 0x8a, 0x00, 0xde, 0x86, 0x67, 0x00, 0xd9, 0x70, 0x8c, 0xa7, 0xc2, 0x0a,
+    0xaf, 0x00, 0x0f, 0x28, 0x84, 0x8b, 0xac, 0x26, 0x58, 0x05, 0xea, 0x5a, 0xe2, 0x01, 0x9e, 0x8d,
+    0xe2, 0x80, 0x00, 0x6f, 0x92, 0xfc, 0x30, 0x0f, 0x84, 0x00, 0xe2, 0x00, 0x30, 0x0d, 0xe0, 0x1e,
+    0x10, 0x16, 0x32, 0x03, 0x22, 0x6a, 0x86, 0xc2, 0x73, 0x8f, 0x5b, 0x89, 0x01, 0x18, 0x05, 0xdf,
+    0xd5, 0x03, 0xa3, 0x52, 0xa3, 0x54, 0xaa, 0x40, 0x23, 0x5f, 0xce, 0x81, 0x80, 0x09, 0x95, 0x90,
+    0x00, 0x20, 0xf2, 0x01, 0x69, 0x48, 0x06, 0x5c, 0x10, 0x0d, 0x3c, 0x60, 0x1b, 0xc4, 0x40, 0x00,
+    0x12, 0x2e, 0x0d, 0xdf, 0x34, 0x55, 0x72, 0x00, 0x00, 0xff, 0x9f, 0xa1, 0x4c, 0x91, 0xa7, 0x91,
+    0xe5, 0xab, 0x36, 0xe5, 0x6d, 0x01, 0xfb, 0x6e, 0xd9, 0xd8, 0xa0, 0x00, 0x00, 0xff, 0xe0, 0x1c,
+    0xe7, 0xfb, 0xb2, 0x08, 0x1f, 0x0a, 0xe6, 0xa1, 0x17, 0x4d, 0xb6, 0xdd, 0x95, 0xa3, 0x70, 0xc0,
+    0x00, 0xfe, 0x2d, 0x30, 0x0a, 0x4c, 0x80, 0x08, 0x88, 0x10, 0x04, 0x93, 0x00, 0x1c, 0x80, 0x21,
+    0x84, 0x27, 0x04, 0x1a, 0x7a, 0x05, 0xe1, 0x8d, 0x00, 0x00, 0x85, 0xd4, 0x03, 0xd3, 0x14, 0x60,
+    0x1c, 0xc0, 0x0a, 0x00, 0xe8, 0x24, 0xb0, 0x08, 0x5c, 0xb6, 0x91, 0x40, 0x17, 0x16, 0x4d, 0x34,
+    0xa2, 0xa0, 0x0a, 0xa0, 0x03, 0x86, 0x09, 0x26, 0x08, 0xe0, 0x08, 0x89, 0x41, 0xde, 0xc0, 0x00,
+    0xf4, 0x60, 0x07, 0x8d, 0xf8, 0x03, 0xdc, 0xe4, 0x01, 0xd0, 0x10, 0x01, 0xc4, 0xfc, 0x01, 0xee,
+    0x73, 0x00, 0xe7, 0x18, 0x00, 0xe2, 0x89, 0x00, 0xf7, 0x32, 0x00, 0x73, 0x14, 0x00, 0x78, 0x2f,
+    0xf6, 0x80, 0x0a, 0xc0, 0x0c, 0xc0, 0x0f, 0x84, 0x00, 0x98, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x7f,
+    0x99, 0x80, 0x02, 0xb0, 0x8f, 0xf3, 0xe2, 0x00, 0x13, 0x40, 0x3c, 0x22, 0x00, 0x4c, 0x00, 0x29,
+    0x80, 0x05, 0xe0, 0x1f, 0xe4, 0xd0, 0x06, 0x20, 0x00, 0x03, 0xcf, 0xd8, 0x00, 0x0c, 0xf7, 0x2c,
+    0x80, 0xb0, 0xd4, 0x1e, 0x02, 0x98, 0x95, 0x3c, 0x14, 0x26, 0xb0, 0x10, 0x50, 0xf2, 0xd0, 0x88,
+    0xdc, 0xc0, 0xa0, 0xc3, 0xda, 0x00, 0x60, 0x21, 0x10, 0x2d, 0x8c, 0x00, 0x8d, 0x85, 0x20, 0x11,
+    0x51, 0x61, 0x00, 0x5a, 0x74, 0xc0, 0x13, 0x85, 0x90, 0x06, 0x33, 0x28, 0x06, 0x5e, 0x60, 0x0e,
+    0xec, 0x00, 0xe6, 0xe6, 0x00, 0xee, 0xc0, 0x0e, 0x21, 0x20, 0x0e, 0x26, 0x00, 0x80, 0x03, 0xcf,
+    0xd8, 0x00, 0x7f, 0x80, 0xb0, 0xd4, 0x1e, 0x00, 0x32, 0x84, 0xd6, 0x02, 0x00, 0x04, 0x1b, 0x98,
+    0x14, 0x14, 0x04, 0x00, 0x22, 0x05, 0xb2, 0x80, 0x01, 0x80, 0x45, 0x45, 0x82, 0x01, 0xe7, 0x08,
+    0x10, 0x01, 0x88, 0x04, 0xbc, 0xa0, 0x16, 0xe0, 0x04, 0xdc, 0xc0, 0x17, 0x68, 0x04, 0x42, 0x40,
+    0x11, 0x30, 0x00, 0x6f, 0x90, 0x2b, 0xee, 0x48, 0x81, 0x80, 0x5e, 0x8a, 0x4d, 0x40, 0x10, 0xa1,
+    0x35, 0xe0, 0xa0, 0x08, 0x01, 0x3a, 0x40, 0x84, 0x80, 0x2f, 0x01, 0x03, 0xc0, 0xe0, 0x0f, 0xb0,
+    0x30, 0xc1, 0xc0, 0x40, 0x02, 0x0e, 0x60, 0x03, 0xe6, 0x00, 0x0f, 0x48, 0x04, 0x9c, 0xe0, 0x03,
+    0xe9, 0x00, 0x9c, 0x48, 0x00, 0x22, 0xe0, 0x08, 0xbf, 0xfc, 0xba, 0xcc, 0x30, 0x66, 0x4c, 0xac,
+    0x08, 0x02, 0xe0, 0x10, 0x08, 0xc4, 0x03, 0x31, 0x00, 0x61, 0x70, 0x0c, 0x44, 0x00, 0xe1, 0x00,
+    0x88, 0x38, 0x00, 0x4f, 0xfb, 0xa4, 0x03, 0x31, 0x8b, 0x50, 0x05, 0x4a, 0x00, 0x50, 0x0f, 0xfe,
+    0x19, 0x80, 0x78, 0xb8, 0x03, 0x5e, 0xe8, 0x80, 0x31, 0x10, 0x03, 0xff, 0x8e, 0x00, 0x03, 0xcf,
+    0xfa, 0xc3, 0x4c, 0x38, 0x80, 0x84, 0x00, 0x22, 0x02, 0x00, 0xfa, 0x84, 0x38, 0xc0, 0x0b, 0xdc,
+    0xfe, 0xa0, 0x1f, 0xfb, 0xa8, 0x02, 0x88, 0x0a, 0xc8, 0x00, 0x44, 0x00, 0x50, 0x0f, 0x28, 0x02,
+    0x64, 0x07, 0x03, 0xdd, 0x7e, 0x08, 0x00, 0x98, 0x03, 0x28, 0xc8, 0xa8, 0x02, 0x70, 0x3e, 0x40,
+    0x1e, 0x00, 0x3f, 0x00, 0x72, 0x82, 0xf0, 0x03, 0x64, 0x23, 0x40, 0x3e, 0x57, 0x12, 0x4e, 0x70,
+    0x10, 0x0c, 0x7e, 0xe6, 0x1a, 0x08, 0xc1, 0xe8, 0x00, 0x00, 0xe1, 0x00, 0xf2, 0x5f, 0xfb, 0xbf,
+    0xa4, 0x82, 0x2c, 0x1e, 0x6a, 0x1d, 0x74, 0xe7, 0xae, 0x19, 0x5e, 0x73, 0x4c, 0x44, 0x01, 0xf1,
+    0x00, 0x7f, 0xff, 0xc0, 0x28, 0xe8, 0x53, 0x24, 0x69, 0xf3, 0x89, 0x6a, 0xcd, 0xb9, 0x5a, 0x30,
+    0x7e, 0xdb, 0xb6, 0x76, 0x28, 0x00, 0x00, 0x3d, 0x00, 0x13, 0x74, 0x38, 0xe9, 0x4a, 0x8a, 0xc7,
+    0x22, 0x26, 0x73, 0xb8, 0x4c, 0x40, 0x55, 0x71, 0x90, 0x07, 0xca, 0xae, 0x22, 0x1d, 0xd9, 0x35,
+    0x0e, 0x08, 0x59, 0x87, 0x0c, 0x65, 0x07, 0xde, 0xf7, 0x00, 0x00, 0xf1, 0xf9, 0x83, 0xa8, 0x05,
+    0xce, 0x69, 0x14, 0x00, 0x70, 0x80, 0x52, 0x50, 0x28, 0xe0, 0x00, 0xed, 0x07, 0x31, 0x80, 0x73,
+    0x14, 0x80, 0x71, 0x4d, 0x04, 0x69, 0x80, 0x25, 0x50, 0x18, 0x90, 0x19, 0x6c, 0x01, 0x4e, 0xc3,
+    0x16, 0x20, 0x04, 0x81, 0x00, 0x08, 0xed, 0x70, 0x0c, 0x4c, 0x8d, 0x1d, 0x59, 0x45, 0xd5, 0x7a,
+    0x88, 0x0e, 0x00, 0x00, 0xc2, 0x20, 0x0f, 0x25, 0xff, 0x73, 0xfa, 0x88, 0x1e, 0xc1, 0xe6, 0xa1,
+    0x99, 0xa8, 0xfd, 0x70, 0xca, 0xf1, 0x9c, 0x80, 0x03, 0x4f, 0x33, 0x01, 0x64, 0x07, 0xe1, 0x02,
+    0x18, 0x1a, 0x1f, 0xa0, 0x04, 0x99, 0x28, 0x01, 0x24, 0xb2, 0x10, 0x12, 0x31, 0x5c, 0x87, 0x59,
+    0x00, 0x1f, 0x80, 0xdc, 0x09, 0xf0, 0x5f, 0x52, 0x0d, 0x02, 0x50, 0x22, 0x01, 0x02, 0x38, 0x38,
+    0x03, 0xc1, 0xdc, 0x1e, 0x22, 0x05, 0x21, 0x44, 0x03, 0x78, 0x7b, 0x00, 0x00, 0x03, 0xcf, 0xe8,
+    0x00, 0xc3, 0x86, 0xc6, 0xec, 0x01, 0x38, 0x3c, 0xfa, 0x80, 0x61, 0x0d, 0x5d, 0x59, 0xff, 0x00,
+    0x46, 0x00, 0x48, 0x88, 0x10, 0x2f, 0x40, 0x95, 0x4c, 0x07, 0x04, 0xe0, 0xdb, 0xa9, 0x00, 0x3f,
+    0x38, 0x2d, 0x54, 0x01, 0x0e, 0x80, 0x91, 0x14, 0x03, 0xc9, 0x11, 0x00, 0x00, 0xe9, 0x19, 0x00,
+    0xc7, 0x7c, 0xdb, 0xe0, 0x13, 0x62, 0x08, 0x1c, 0x10, 0x0c, 0x05, 0xbf, 0x10, 0xc0, 0x20, 0xaa,
+    0x09, 0xd3, 0x18, 0x68, 0x61, 0x72, 0xb4, 0xc8, 0x03, 0x2a, 0xb8, 0x40, 0x2e, 0x0c, 0xe3, 0x10,
+    0x88, 0x03, 0x82, 0x83, 0xdc, 0x39, 0x80, 0xd8, 0x34, 0xeb, 0x84, 0x80, 0x11, 0x4c, 0x00, 0xba,
+    0x40, 0x11, 0xc5, 0xf5, 0x10, 0x00, 0x00, 0x26, 0x7e, 0xc0, 0x04, 0xd6, 0x64, 0x47, 0xc0, 0x19,
+    0x0d, 0xd7, 0x99, 0x99, 0x01, 0xc8, 0x01, 0xd2, 0x9a, 0x1a, 0x7a, 0xd1, 0x84, 0x01, 0x8a, 0x50,
+    0x83, 0x43, 0x40, 0x09, 0xf8, 0x28, 0x0e, 0x81, 0x95, 0x6e, 0x30, 0x10, 0x10, 0x86, 0xc0, 0xf4,
+    0x60, 0x2d, 0xa0, 0x00, 0x00, 0x77, 0xff, 0x50, 0x06, 0x44, 0xda, 0x01, 0xae, 0xf3, 0x80, 0x7f,
+    0xf0, 0x6a, 0xb1, 0x80, 0x65, 0x5c, 0xc0, 0x1b, 0xff, 0x28, 0x07, 0xfb, 0x84, 0x3c, 0x80, 0x37,
+    0x08, 0x79, 0x00, 0x40, 0x00, 0x2e, 0xfe, 0x18, 0x01, 0x28, 0x90, 0xf4, 0x43, 0x82, 0xad, 0xc5,
+    0x01, 0x81, 0x02, 0x69, 0xe0, 0xc3, 0xb8, 0xaa, 0x29, 0x40, 0xbf, 0x40, 0x04, 0xa0, 0x5f, 0xa0,
+    0x02, 0x54, 0x2f, 0xd5, 0x46, 0xea, 0x3d, 0x1b, 0x49, 0xe0, 0x2a, 0xc6, 0x66, 0x00, 0x00, 0xf1,
+    0x90, 0x04, 0x2a, 0x42, 0x83, 0x88, 0x81, 0x04, 0xae, 0xe5, 0xf0, 0x4d, 0xf8, 0x80, 0x0a, 0x90,
+    0x06, 0x90, 0x58, 0x00, 0xeb, 0xc0, 0xeb, 0xe1, 0xc0, 0x01, 0x0f, 0x01, 0x00, 0xf8, 0x54, 0x03,
+    0xf9, 0x80, 0x3f, 0xd4, 0x60, 0x1e, 0x5f, 0xb2, 0xef, 0x80, 0x4f, 0x90, 0x2f, 0xf1, 0x00, 0x07,
+    0xf4, 0x03, 0x48, 0x07, 0xf2, 0x20, 0x03, 0xe1, 0x08, 0x00, 0xec, 0x01, 0x03, 0xfe, 0x02, 0x7d,
+    0x02, 0xd0, 0x1c, 0x02, 0x7e, 0x02, 0xf2, 0x1c, 0x02, 0x6f, 0x03, 0xdd, 0x20, 0x00, 0x98, 0x03,
+    0xa4, 0x03, 0xf8, 0x9c, 0x02, 0x00, 0x4f, 0xfd, 0xac, 0x01, 0xf0, 0xa9, 0x94, 0xaa, 0xbd, 0xc0,
+    0x24, 0xac, 0xa0, 0x90, 0x0f, 0xe4, 0x03, 0xa0, 0x8d, 0x00, 0xc3, 0x00, 0x6a, 0x09, 0x60, 0x05,
+    0xfe, 0x61, 0xef, 0x0c, 0x60, 0x00, 0xaa, 0x9f, 0xc8, 0x03, 0xc9, 0x54, 0x81, 0x00, 0xbc, 0x03,
+    0xf8, 0x41, 0x5c, 0x03, 0xf2, 0x20, 0xa8, 0x4f, 0xfd, 0xac, 0x01, 0xfe, 0x15, 0x42, 0x96, 0x00,
+    0xfe, 0x4a, 0xbb, 0x05, 0x00, 0x7f, 0xf0, 0x14, 0x08, 0x23, 0xbf, 0x0c, 0x03, 0x86, 0x41, 0x15,
+    0xca, 0x0b, 0x00, 0x25, 0xfe, 0x71, 0x82, 0x06, 0x4d, 0xb0, 0x08, 0x98, 0xc2, 0x49, 0x91, 0x73,
+    0x1a, 0x01, 0x3c, 0xf0, 0x48, 0x02, 0x76, 0x49, 0x90, 0x03, 0x12, 0x8b, 0x33, 0x6c, 0x84, 0x1c,
+    0x03, 0xa4, 0x21, 0xde, 0xb1, 0xa3, 0x00, 0x8f, 0x30, 0x03, 0x7c, 0x80, 0x5f, 0x7a, 0x08, 0x00,
+    0xc0, 0x40, 0x02, 0x06, 0x20, 0x68, 0x01, 0x00, 0x84, 0x0c, 0x0d, 0x85, 0x73, 0x44, 0x41, 0xf9,
+    0x01, 0xce, 0xe0, 0xeb, 0x0b, 0x07, 0xc0, 0x3a, 0x96, 0x0d, 0x90, 0xb0, 0x6e, 0x03, 0xb8, 0xd0,
+    0x51, 0x3f, 0x60, 0x70, 0xaa, 0x09, 0x11, 0x46, 0xc7, 0x41, 0x81, 0x44, 0x00, 0xa0, 0x04, 0x04,
+    0x00, 0x20, 0x06, 0xc0, 0x13, 0x00, 0x20, 0x60, 0x00, 0x3f, 0xfe, 0xd4, 0x0f, 0xd0, 0x01, 0x3b,
+    0x98, 0xa8, 0x03, 0x93, 0x0a, 0x8c, 0x44, 0x01, 0xc6, 0xac, 0xe0, 0x1f, 0xec, 0x50, 0x0f, 0xdd,
+    0xe5, 0x60, 0xe0, 0x1c, 0x8e, 0xe5, 0x38, 0x00, 0x00, 0xec, 0xf1, 0x00, 0xff, 0xb3, 0xcc, 0x38,
+    0x13, 0x49, 0x8c, 0x38, 0xac, 0x9d, 0x4c, 0x00, 0xa0, 0xf3, 0x80, 0x17, 0x06, 0x80, 0x10, 0x01,
+    0xc1, 0xa0, 0x04, 0x00, 0x28, 0x3c, 0xe0, 0x04, 0x56, 0x4e, 0xa8, 0x01, 0x26, 0xf4, 0xdf, 0x88,
+    0x9d, 0xfc, 0x05, 0x11, 0xe0, 0x00, 0x00, 0x9f, 0x7f, 0x58, 0x02, 0xa8, 0x23, 0x36, 0x80, 0x0d,
+    0x4b, 0xb3, 0xa8, 0x23, 0x00, 0xbf, 0xa4, 0x42, 0x54, 0x27, 0xfd, 0x20, 0x09, 0x50, 0x9f, 0xb0,
+    0x0a, 0x68, 0x17, 0xe8, 0x02, 0x15, 0x05, 0x30, 0x13, 0x00, 0xa4, 0x37, 0x3a, 0x00, 0x26, 0xa2,
+    0x32, 0xd0, 0x00, 0x05, 0xf8, 0x00, 0xb7, 0xe4, 0x03, 0xeb, 0x24, 0x90, 0x0f, 0x42, 0x15, 0x00,
+    0x79, 0x9c, 0x7c, 0x40, 0x19, 0x40, 0xf2, 0x03, 0xbe, 0x81, 0x66, 0x01, 0x85, 0x9a, 0x07, 0x90,
+    0x04, 0x08, 0xaa, 0x48, 0x03, 0x33, 0xd8, 0x70, 0x80, 0x70, 0x82, 0xb1, 0x58, 0x07, 0xe9, 0x35,
+    0x60, 0x00, 0xbf, 0xff, 0x8d, 0x10, 0x00, 0x44, 0xa2, 0xec, 0x41, 0x57, 0x60, 0x0e, 0xd6, 0x00,
+    0x98, 0x82, 0x58, 0x02, 0xf1, 0x0e, 0x60, 0x0b, 0x04, 0x35, 0x80, 0x2f, 0x10, 0x70, 0x0d, 0x46,
+    0x01, 0xff, 0xc0, 0x00, 0x00, 0x95, 0xc0, 0x3f, 0xf8, 0x49, 0x37, 0x1f, 0xb4, 0x60, 0x1f, 0xec,
+    0x61, 0x06, 0x75, 0xc6, 0x00, 0xfe, 0x9f, 0x40, 0x8a, 0xd1, 0x91, 0x00, 0xfc, 0x20, 0x1c, 0x4c,
+    0x0e, 0x09, 0x9f, 0xac, 0x01, 0xfd, 0xa1, 0xe5, 0x64, 0xc7, 0x2a, 0x01, 0xff, 0x58, 0x54, 0xe8,
+    0x48, 0x07, 0xe2, 0x0e, 0x20, 0x40, 0x30, 0x23, 0xcf, 0x40, 0x20, 0x05, 0x02, 0xb8, 0x20, 0x18,
+    0x15, 0x99, 0x00, 0x36, 0x70, 0x98, 0x80, 0x15, 0x3c, 0x15, 0x44, 0x33, 0x5a, 0x38, 0xbc, 0x80,
+    0x50, 0x86, 0xec, 0x57, 0xd8, 0x95, 0xdb, 0x00, 0x19, 0xb7, 0xa0, 0x03, 0xff, 0xb2, 0x00, 0x0c,
+    0xff, 0xb5, 0x40, 0x39, 0x50, 0xa8, 0xc0, 0x34, 0x5c, 0x05, 0x05, 0x18, 0x6f, 0x40, 0x35, 0x00,
+    0x7f, 0x51, 0x86, 0xf3, 0x03, 0xd0, 0x05, 0xbe, 0xc3, 0x20, 0x19, 0x9e, 0x78, 0x40, 0x35, 0xc3,
+    0x00, 0x7f, 0xf0, 0x00, 0x00, 0xc6, 0x40, 0x1f, 0xa2, 0x80, 0x3c, 0xda, 0x8f, 0x88, 0x01, 0x3c,
+    0x90, 0x88, 0xed, 0x00, 0x60, 0x35, 0x5a, 0x82, 0x01, 0xc1, 0x88, 0x00, 0xb9, 0xe1, 0xc1, 0xe0,
+    0x04, 0x8b, 0xb0, 0x04, 0x20, 0x03, 0x77, 0x87, 0x43, 0x00, 0x0f, 0xe0, 0x01, 0x51, 0x47, 0x01,
+    0x90, 0x50, 0x05, 0x04, 0x23, 0x30, 0x60, 0x00, 0x9a, 0xe2, 0x4f, 0xe4, 0x01, 0x14, 0x2a, 0xa0,
+    0x40, 0x00, 0x00, 0xb3, 0xfc, 0x01, 0xe1, 0x30, 0x02, 0x80, 0x72, 0x01, 0x87, 0x80, 0x77, 0x84,
+    0x02, 0x00, 0x72, 0x82, 0x20, 0x4c, 0x01, 0x7e, 0x00, 0xe4, 0x0c, 0xe0, 0xb5, 0x09, 0xed, 0x01,
+    0xe0, 0xc5, 0x09, 0xec, 0x01, 0xf0, 0x90, 0x4f, 0xee, 0x40, 0x30, 0x70, 0x70, 0x04, 0xa0, 0xc0,
+    0x00, 0x00, 0x2e, 0xff, 0x48, 0x04, 0x54, 0x4a, 0x6d, 0x00, 0x13, 0xd5, 0x20, 0x03, 0x6b, 0xd7,
+    0xd0, 0x3a, 0x05, 0x57, 0xca, 0x15, 0x5f, 0x28, 0x40, 0x26, 0x66, 0x50, 0x08, 0xcc, 0x55, 0x62,
+    0x08, 0x0f, 0x58, 0xc4, 0x00, 0x39, 0x25, 0x35, 0xb0, 0x00, 0x00, 0xca, 0x60, 0x1f, 0xa6, 0xc0,
+    0x3c, 0xfc, 0x6f, 0xca, 0x01, 0x4c, 0x00, 0x90, 0xd2, 0x01, 0x30, 0xfa, 0xd5, 0x02, 0x01, 0x01,
+    0x04, 0x00, 0xb5, 0x21, 0xc1, 0xa0, 0x19, 0x54, 0x1e, 0x1e, 0x01, 0xf1, 0x02, 0x00, 0x43, 0x98,
+    0x05, 0x23, 0x87, 0xea, 0x35, 0x00, 0x70, 0xb9, 0xb2, 0x14, 0x00, 0x0f, 0xe0, 0x4e, 0x74, 0x40,
+    0x21, 0x75, 0xb6, 0x00, 0x80, 0xaf, 0xff, 0x83, 0x19, 0xbe, 0x06, 0x99, 0xf8, 0x2b, 0xff, 0xe0,
+    0xc6, 0x60, 0x82, 0xb3, 0x01, 0xa6, 0x44, 0x17, 0x32, 0x00, 0xff, 0xec, 0x80, 0x27, 0x7e, 0x5a,
+    0x88, 0xd4, 0x53, 0x94, 0x41, 0x6d, 0x39, 0x44, 0x13, 0x73, 0xba, 0x30, 0xab, 0x6c, 0xd3, 0x45,
+    0x13, 0x10, 0xbb, 0x00, 0x12, 0x03, 0xc0, 0x33, 0xb2, 0x48, 0x06, 0x93, 0x66, 0x00, 0x06, 0xf7,
+    0x00, 0xfa, 0x7c, 0x02, 0x59, 0x02, 0x90, 0x08, 0x54, 0x01, 0x40, 0x19, 0xc0, 0x94, 0x02, 0x21,
+    0x09, 0x92, 0x52, 0x35, 0x00, 0x58, 0xa2, 0x01, 0x85, 0x81, 0x00, 0x2a, 0xf1, 0x71, 0x00, 0x88,
+    0x93, 0x00, 0x00, 0x00, 0xc6, 0x40, 0x1e, 0x1c, 0x90, 0x0e, 0x16, 0x06, 0x40, 0x08, 0xbe, 0x00,
+    0xae, 0x40, 0x12, 0x2e, 0x06, 0x66, 0x51, 0x43, 0x90, 0x7f, 0x0e, 0x50, 0x50, 0x08, 0xc1, 0x80,
+    0x02, 0x01, 0x84, 0xc0, 0x03, 0xff, 0xda, 0xc0, 0x18, 0x59, 0x87, 0x2c, 0x01, 0x2c, 0xcb, 0x42,
+    0xc0, 0x3c, 0x60, 0x60, 0x1c, 0x30, 0x0b, 0x18, 0x09, 0xfc, 0xe3, 0x3a, 0xa0, 0x4c, 0xf3, 0xe5,
+    0xaa, 0x04, 0xc6, 0xc2, 0x13, 0x40, 0x9b, 0x40, 0x10, 0xb0, 0x00, 0x84, 0x02, 0x00, 0x00, 0xa9,
+    0xb4, 0xc0, 0x38, 0x74, 0xd8, 0x02, 0x1d, 0x44, 0x0d, 0x48, 0x03, 0x48, 0x90, 0x44, 0x66, 0x09,
+    0xa3, 0x88, 0x40, 0x69, 0x01, 0x43, 0xfa, 0xe4, 0x90, 0x11, 0x04, 0x80, 0xc8, 0x4d, 0x08, 0x03,
+    0x85, 0xc3, 0x6a, 0x62, 0x0e, 0x48, 0x00, 0x56, 0x77, 0x58, 0x00, 0x10, 0x90, 0x80, 0x74, 0x37,
+    0x20, 0x04, 0x9e, 0xb0, 0x76, 0xe0, 0x18, 0x99, 0x46, 0x14, 0x02, 0x49, 0xa8, 0x0c, 0x00, 0xf0,
+    0x87, 0x00, 0x4a, 0xf3, 0x08, 0xc0, 0x11, 0xc3, 0x08, 0x8c, 0x02, 0x6f, 0xf4, 0xaf, 0x80, 0x79,
+    0xc0, 0x80, 0x24, 0x89, 0xc0, 0x40, 0x08, 0x9d, 0x8d, 0xa8, 0x13, 0xd6, 0x0e, 0xe4, 0x40, 0x28,
+    0x6e, 0x40, 0x08, 0x00, 0xf9, 0x7b, 0xec, 0x4e, 0x9e, 0x8c, 0x6c, 0x65, 0x60, 0x03, 0xec, 0x16,
+    0x35, 0x04, 0x79, 0xcb, 0x13, 0xe7, 0x69, 0x2b, 0x97, 0x68, 0xb0, 0x00, 0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 29, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 75, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 131, .adv_w = 192, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 190, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 234, .adv_w = 64, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 241, .adv_w = 64, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 274, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 300, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 322, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 342, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 349, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 354, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 359, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 391, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 434, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 448, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 489, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 530, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 567, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 607, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 648, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 680, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 720, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 761, .adv_w = 48, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 772, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 786, .adv_w = 144, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 817, .adv_w = 144, .box_w = 7, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 829, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 856, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 891, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 974, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1021, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1061, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1108, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1145, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1174, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1198, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1248, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1269, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1274, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1294, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1332, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1343, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1389, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1422, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1470, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1504, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1558, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1596, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1642, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1656, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1681, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1728, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1794, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1838, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1872, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1907, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1921, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1951, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1964, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 1977, .adv_w = 96, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1984, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 1990, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2015, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2048, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2073, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2107, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2132, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2151, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2192, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2214, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2224, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2239, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2267, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2272, .adv_w = 176, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2298, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2316, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2345, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2381, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2416, .adv_w = 80, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2429, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2454, .adv_w = 80, .box_w = 5, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2474, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2492, .adv_w = 112, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2520, .adv_w = 176, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2560, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2586, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2625, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2650, .adv_w = 96, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2686, .adv_w = 80, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2693, .adv_w = 96, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2728, .adv_w = 144, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2744, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2745, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2760, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2793, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2833, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2873, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2914, .adv_w = 64, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2924, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2967, .adv_w = 128, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 2975, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3030, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3046, .adv_w = 128, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3071, .adv_w = 144, .box_w = 7, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3082, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 3115, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 3122, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3139, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3163, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3176, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3189, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 3195, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3221, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3245, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3250, .adv_w = 64, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3257, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3263, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3279, .adv_w = 128, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3304, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3355, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3412, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3475, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3508, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3565, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3621, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3679, .adv_w = 144, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3734, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3792, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3849, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3901, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3961, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4000, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4039, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4080, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4119, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4131, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4142, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4156, .adv_w = 48, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4170, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4216, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4258, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4316, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4374, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4433, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4493, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4552, .adv_w = 144, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4583, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4641, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4677, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4712, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4749, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4785, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4829, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4862, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4901, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4935, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4969, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5005, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5041, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5074, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5110, .adv_w = 176, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5153, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5189, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5223, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5257, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5293, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5326, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5338, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5349, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5362, .adv_w = 48, .box_w = 6, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5377, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5421, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5450, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5488, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5526, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5566, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5606, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5645, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5670, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5705, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5733, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5760, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5789, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5818, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5866, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5905, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5955, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6011, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6044, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6102, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6138, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6196, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6231, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6287, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6321, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6379, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6415, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6471, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6505, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6563, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6599, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6648, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6691, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6737, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6777, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6816, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6849, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6890, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6926, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6964, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6998, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7037, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7072, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7114, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7149, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7210, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7262, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7324, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7376, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7435, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7485, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7547, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7599, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7631, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7665, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7694, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7724, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7735, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7748, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7760, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7772, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7785, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7798, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7809, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7825, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7835, .adv_w = 48, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7840, .adv_w = 176, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7864, .adv_w = 96, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7887, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7920, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7938, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7987, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8026, .adv_w = 112, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8052, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8072, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8083, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8104, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8114, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8134, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8147, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8165, .adv_w = 80, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8182, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8213, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8231, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8274, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8301, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8346, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8374, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8420, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8448, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8492, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8518, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8575, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8612, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8672, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8712, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8773, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8814, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8866, .adv_w = 192, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8910, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8959, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8980, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9029, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9050, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9101, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9122, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9178, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9213, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9270, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9306, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9363, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9398, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9455, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9491, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9514, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9542, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9569, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9595, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9627, .adv_w = 80, .box_w = 5, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9650, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9688, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9717, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9751, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9776, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9814, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9843, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9879, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9908, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9946, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9975, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10010, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10038, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10117, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10170, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10216, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10266, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10310, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10355, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10390, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10433, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10466, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10514, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10550, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10560, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10621, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10656, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10705, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10746, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10799, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10841, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10893, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10937, .adv_w = 144, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11005, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11050, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11097, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11138, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 11187, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11231, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11280, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11325, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11373, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11418, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11467, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11513, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11560, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11601, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11648, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11689, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11729, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11764, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11804, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11840, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11890, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11936, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11968, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11993, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12052, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12102, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12132, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12160, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12194, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12228, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12261, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12294, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12326, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12358, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12392, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12424, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12437, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12456, .adv_w = 48, .box_w = 6, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12476, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12495, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12544, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12581, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12632, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12672, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12722, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12762, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12784, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12795, .adv_w = 112, .box_w = 8, .box_h = 17, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 12827, .adv_w = 48, .box_w = 5, .box_h = 17, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 12848, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12868, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12880, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12900, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12913, .adv_w = 192, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12970, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13007, .adv_w = 192, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13063, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13100, .adv_w = 192, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13162, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13203, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13246, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13273, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13320, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13350, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13396, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13424, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13470, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13499, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13565, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13611, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13680, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13728, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13792, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13837, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13901, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13945, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13988, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14033, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14075, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14119, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14167, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14187, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14239, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14262, .adv_w = 128, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14323, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14352, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14403, .adv_w = 80, .box_w = 6, .box_h = 10, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14425, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14480, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14513, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14569, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14602, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14659, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14703, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14766, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14808, .adv_w = 128, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14873, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14913, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14935, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14961, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14985, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15015, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15038, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15065, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15089, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15122, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15158, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15187, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15224, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15254, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15291, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15320, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15363, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15398, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15443, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15478, .adv_w = 144, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15534, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15574, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15633, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15672, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15749, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15800, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15877, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15929, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16008, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16060, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16135, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16184, .adv_w = 208, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16264, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16317, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16369, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16404, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16460, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16496, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16538, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16586, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16632, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16668, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16713, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16748, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16793, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16827, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16859, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16890, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16945, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16994, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17029, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17045, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17061, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17103, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17144, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17205, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17238, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17294, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17328, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17393, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17435, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17500, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17542, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17603, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17645, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17708, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17751, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17823, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17867, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17932, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17974, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18038, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18080, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18141, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18183, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18245, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18288, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18361, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18405, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18445, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18480, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18521, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18555, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18594, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18630, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18678, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18719, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18767, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18809, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18854, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18895, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18941, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18984, .adv_w = 128, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19036, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19082, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19093, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19103, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19114, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19129, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19188, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19227, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19285, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19323, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19389, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19435, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19501, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19547, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19613, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19658, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19726, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19774, .adv_w = 160, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19844, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19893, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19952, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19992, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20052, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20092, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20151, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20191, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20252, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20293, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20356, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20401, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20436, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20464, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20500, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20528, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20573, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20609, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20655, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20692, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20738, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20775, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20823, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20861, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20910, .adv_w = 128, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20950, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20994, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21042, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21088, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21131, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21175, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21223, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21266, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21316, .adv_w = 192, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21332, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21354, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21393, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21432, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21481, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21526, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21527, .adv_w = 240, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21528, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21529, .adv_w = 208, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21530, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21531, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21532, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21533, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21534, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21535, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21536, .adv_w = 16, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21537, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21538, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21543, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21548, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 21553, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21558, .adv_w = 208, .box_w = 13, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21565, .adv_w = 208, .box_w = 13, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21572, .adv_w = 112, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 21581, .adv_w = 96, .box_w = 7, .box_h = 3, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 21589, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21596, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21603, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21610, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21617, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21630, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21643, .adv_w = 80, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21656, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21669, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 21694, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21730, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 21743, .adv_w = 96, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 21754, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21759, .adv_w = 96, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21769, .adv_w = 160, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21784, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21789, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21790, .adv_w = 272, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21864, .adv_w = 352, .box_w = 21, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21953, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21960, .adv_w = 112, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21973, .adv_w = 160, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21994, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 22001, .adv_w = 112, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 22014, .adv_w = 160, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 22035, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22046, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 22062, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 22078, .adv_w = 160, .box_w = 10, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22115, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22142, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22176, .adv_w = 96, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 22184, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22204, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 22224, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22249, .adv_w = 160, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 22282, .adv_w = 96, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 22287, .adv_w = 32, .box_w = 9, .box_h = 10, .ofs_x = -3, .ofs_y = 0},
+    {.bitmap_index = 22319, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22340, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22361, .adv_w = 240, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22430, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22483, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22536, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22563, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22590, .adv_w = 128, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 22610, .adv_w = 128, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 22630, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 22651, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22665, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22710, .adv_w = 112, .box_w = 6, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 22746, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22789, .adv_w = 160, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 22803, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22824, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22849, .adv_w = 208, .box_w = 13, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 22876, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22877, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22924, .adv_w = 144, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 22982, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23028, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 23060, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23102, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 23148, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23190, .adv_w = 192, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23239, .adv_w = 240, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23303, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23369, .adv_w = 192, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23400, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23446, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23491, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23538, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23572, .adv_w = 288, .box_w = 18, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23663, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23700, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 23762, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23809, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23850, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 23909, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23933, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23966, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24003, .adv_w = 160, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24036, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24078, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24122, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24179, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_9[] = {
+    0x0, 0x8,
+};
+
+static const uint8_t glyph_id_ofs_list_11[] = {
+    0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 0, 8, 9, 10, 11, 12,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 160, .range_length = 13, .glyph_id_start = 96,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 174, .range_length = 155, .glyph_id_start = 109,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 330, .range_length = 54, .glyph_id_start = 264,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7680, .range_length = 156, .glyph_id_start = 318,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7837, .range_length = 99, .glyph_id_start = 474,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8192, .range_length = 12, .glyph_id_start = 573,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8208, .range_length = 24, .glyph_id_start = 585,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8239, .range_length = 39, .glyph_id_start = 609,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8279, .range_length = 9, .glyph_id_start = 648,
+     .unicode_list = unicode_list_9, .glyph_id_ofs_list = NULL, .list_length = 2,
+     .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},
+    {.range_start = 8352, .range_length = 16, .glyph_id_start = 650,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8369, .range_length = 16, .glyph_id_start = 666,
+     .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_11, .list_length = 16,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 12,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_bold_13_bold_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 19,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
@@ -0,0 +1,2519 @@
+/*
+ * interdisplay_bold_14_bold_4bpp - generated by script/binfont_to_c.py from interdisplay_bold_14_bold_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x5f, 0xc0, 0x08, 0x41, 0xc0, 0x27, 0x00, 0xc2, 0x01, 0x09, 0xe9, 0x52, 0xaa, 0x7d, 0xc5,
+    0x00, 0x0f, 0xc2, 0xf9, 0x00, 0x38, 0x06, 0x10, 0x30, 0x10, 0x31, 0x10, 0x78, 0x7d, 0x86, 0xb0,
+    0x00, 0x37, 0x88, 0x6d, 0x80, 0x5c, 0x02, 0x04, 0x60, 0x11, 0x90, 0x08, 0x70, 0x1f, 0xa1, 0x7f,
+    0x04, 0xd0, 0x20, 0x12, 0x90, 0x27, 0x9c, 0x84, 0x52, 0x0d, 0xac, 0x70, 0x75, 0x38, 0x50, 0xb1,
+    0x82, 0x28, 0x89, 0x47, 0x94, 0xbf, 0x82, 0x3c, 0x00, 0xcc, 0x02, 0x03, 0x00, 0x8c, 0x81, 0x81,
+    0x80, 0x00, 0x00, 0xc8, 0x20, 0x1f, 0x5a, 0x80, 0x72, 0xd8, 0x43, 0x00, 0x53, 0x48, 0x07, 0x32,
+    0x02, 0x60, 0x90, 0x70, 0x62, 0x60, 0x26, 0x0c, 0x84, 0x66, 0x01, 0x50, 0x01, 0xed, 0x0a, 0x01,
+    0x42, 0xe8, 0x80, 0x0f, 0xae, 0x00, 0x5d, 0x21, 0x40, 0x80, 0xa3, 0x0a, 0x7b, 0x80, 0x00, 0xa0,
+    0x0a, 0x02, 0xc8, 0x73, 0x86, 0x14, 0x83, 0x02, 0x83, 0x28, 0x36, 0xc8, 0x36, 0x48, 0x04, 0x4c,
+    0x1a, 0x60, 0x00, 0x03, 0xdf, 0x90, 0x08, 0x79, 0xc0, 0x2d, 0x18, 0x66, 0x00, 0x2c, 0xdc, 0x00,
+    0x22, 0x97, 0x2f, 0x04, 0x5e, 0x00, 0x84, 0x58, 0x65, 0xe1, 0x2c, 0x60, 0x1b, 0x57, 0x5d, 0xa0,
+    0xe4, 0x03, 0x8f, 0x3a, 0x0d, 0xea, 0x3f, 0xca, 0x01, 0xef, 0x57, 0x79, 0x68, 0x03, 0x9c, 0xad,
+    0x42, 0x24, 0x0c, 0x02, 0x28, 0x80, 0x80, 0x7f, 0x4a, 0x30, 0x28, 0x4c, 0x09, 0x80, 0x15, 0x24,
+    0x00, 0x70, 0xeb, 0x40, 0x00, 0x00, 0x4f, 0x7c, 0x80, 0x73, 0xb0, 0x0b, 0x38, 0x06, 0xc0, 0xff,
+    0x07, 0x00, 0x62, 0x02, 0x70, 0xf0, 0x0d, 0x01, 0xb2, 0xac, 0x01, 0x94, 0x04, 0x54, 0x2e, 0x60,
+    0x56, 0x2a, 0x34, 0xb0, 0xa1, 0x41, 0x34, 0x8b, 0x40, 0x40, 0x17, 0x05, 0x08, 0x89, 0x02, 0x81,
+    0xb7, 0xc4, 0x0c, 0x40, 0xac, 0xc8, 0x1a, 0x47, 0x40, 0x0f, 0xc0, 0x03, 0x80, 0x80, 0x0c, 0x43,
+    0xec, 0x00, 0x4e, 0x10, 0x13, 0x11, 0x01, 0x41, 0xc0, 0x18, 0x18, 0x00, 0x50, 0x70, 0x00, 0x81,
+    0x00, 0x80, 0x80, 0x0c, 0x0c, 0x00, 0x60, 0x60, 0x01, 0x01, 0x00, 0x88, 0x0c, 0x00, 0x80, 0x80,
+    0x0d, 0x0b, 0x00, 0x21, 0x19, 0x00, 0x7c, 0x50, 0x33, 0x48, 0x20, 0x98, 0x82, 0x82, 0x01, 0x86,
+    0x86, 0x81, 0x00, 0x83, 0x03, 0x80, 0x4e, 0x01, 0x10, 0x30, 0x78, 0x68, 0x20, 0x21, 0x10, 0x4e,
+    0x82, 0x40, 0x00, 0xb9, 0x40, 0x2a, 0x62, 0x3c, 0x30, 0xd9, 0x39, 0x71, 0x03, 0x30, 0x00, 0xc8,
+    0x21, 0x49, 0xd9, 0x43, 0x64, 0x37, 0xd4, 0x04, 0x3d, 0x04, 0x00, 0x00, 0x27, 0xb8, 0x07, 0xff,
+    0x1f, 0xbe, 0xc2, 0x3f, 0xc2, 0xa6, 0x40, 0x46, 0x61, 0xbc, 0x90, 0xac, 0xc0, 0x07, 0xfc, 0xcc,
+    0x30, 0x08, 0x01, 0x11, 0xf4, 0x30, 0x61, 0x02, 0x71, 0x08, 0x2c, 0xcc, 0xa2, 0x67, 0xc0, 0x06,
+    0x26, 0x9e, 0x51, 0x40, 0x00, 0xb7, 0x80, 0x21, 0x24, 0x00, 0x90, 0x30, 0x02, 0xc0, 0x40, 0x09,
+    0x04, 0x80, 0x02, 0x48, 0x01, 0x20, 0x60, 0x05, 0x80, 0x80, 0x12, 0x09, 0x00, 0x04, 0x90, 0x02,
+    0x40, 0xc0, 0x0b, 0x01, 0x00, 0x24, 0x12, 0x00, 0x80, 0x00, 0x36, 0xfe, 0xb0, 0x04, 0xd2, 0x42,
+    0x53, 0x00, 0x32, 0x17, 0xd8, 0x0e, 0x28, 0x08, 0x80, 0x35, 0x07, 0x20, 0x30, 0x0b, 0x03, 0xfc,
+    0x1c, 0x01, 0x18, 0x1f, 0x80, 0x80, 0x46, 0x06, 0x41, 0x80, 0x16, 0x07, 0xa0, 0x22, 0x00, 0xd4,
+    0x10, 0x60, 0x2f, 0xb0, 0x1c, 0x81, 0xe4, 0x84, 0xa2, 0x00, 0x00, 0x02, 0xcf, 0xb6, 0xd3, 0x00,
+    0x69, 0x38, 0x03, 0xb7, 0x40, 0x05, 0x00, 0xff, 0xeb, 0x00, 0x01, 0x9e, 0xfc, 0x40, 0x06, 0xb0,
+    0x88, 0xec, 0xd0, 0xcb, 0xb8, 0xe1, 0x24, 0x34, 0x21, 0x60, 0xcc, 0xe7, 0x00, 0x20, 0x28, 0x06,
+    0x48, 0x08, 0x00, 0x96, 0xc2, 0xc4, 0x00, 0xd4, 0x16, 0x80, 0x08, 0x91, 0xc4, 0x00, 0x33, 0x80,
+    0x3b, 0x75, 0x62, 0x00, 0x12, 0x29, 0x80, 0x00, 0x4f, 0x7e, 0xb0, 0x05, 0x8c, 0x06, 0x53, 0x00,
+    0x66, 0x2e, 0xcc, 0x03, 0x01, 0x67, 0x80, 0x04, 0x08, 0x04, 0xc9, 0xef, 0x4b, 0xc0, 0x36, 0x20,
+    0x08, 0x07, 0x5f, 0xc9, 0xe8, 0x36, 0xb8, 0x01, 0x84, 0x46, 0x44, 0xa1, 0x03, 0x10, 0x24, 0x32,
+    0xfc, 0xc0, 0x28, 0x86, 0x30, 0x19, 0x45, 0x00, 0x00, 0xcf, 0xfe, 0x70, 0x0c, 0x50, 0x01, 0xf4,
+    0x81, 0x80, 0x72, 0xa2, 0xa0, 0x06, 0x1b, 0x1b, 0x00, 0xeb, 0x18, 0x10, 0x0c, 0x8a, 0x8c, 0x01,
+    0xda, 0x09, 0xfe, 0x70, 0x8c, 0xe3, 0x3c, 0x20, 0x4a, 0xf9, 0x99, 0x82, 0xa4, 0x03, 0xf8, 0x2f,
+    0xff, 0x30, 0x80, 0x08, 0xb1, 0xb8, 0x2e, 0xee, 0x51, 0x01, 0xbf, 0xd4, 0x03, 0x04, 0x53, 0x2b,
+    0x30, 0x02, 0x76, 0x40, 0x43, 0x7d, 0x80, 0x18, 0x15, 0xad, 0x40, 0x38, 0xd2, 0x40, 0x12, 0x0a,
+    0xa2, 0x3e, 0xd7, 0x08, 0x0c, 0x60, 0x23, 0xc3, 0x00, 0x00, 0x36, 0xff, 0x40, 0x04, 0xd2, 0x46,
+    0x2f, 0x20, 0x08, 0x1e, 0xce, 0x45, 0x04, 0x16, 0x7a, 0x88, 0x60, 0x18, 0x2c, 0xab, 0x62, 0x07,
+    0x81, 0x4f, 0xc0, 0x50, 0x04, 0x6c, 0x0e, 0x22, 0x2e, 0x07, 0x00, 0x8c, 0x00, 0xe0, 0x86, 0x08,
+    0x42, 0x42, 0xc1, 0x9b, 0x61, 0x20, 0x09, 0x81, 0x22, 0x4b, 0x80, 0xbf, 0xff, 0x31, 0x08, 0xe0,
+    0x0a, 0x7b, 0xb0, 0x01, 0xc0, 0x33, 0x82, 0x88, 0x06, 0x90, 0x80, 0x0c, 0xc2, 0x84, 0x01, 0xac,
+    0x20, 0x03, 0x29, 0x19, 0x80, 0x34, 0x04, 0x00, 0x64, 0x22, 0x20, 0x06, 0x80, 0x80, 0x0c, 0x00,
+    0x01, 0x9e, 0xfd, 0x60, 0x0b, 0x18, 0xd0, 0xa5, 0xc0, 0xc8, 0x76, 0xe8, 0x2c, 0x08, 0x03, 0xcc,
+    0x03, 0x23, 0xb7, 0x47, 0x00, 0x03, 0x22, 0x20, 0x31, 0x81, 0xd1, 0xe7, 0xba, 0xe8, 0x58, 0x39,
+    0x84, 0x01, 0x8f, 0x82, 0x80, 0x0c, 0x02, 0x61, 0x3d, 0xbc, 0x05, 0x11, 0x62, 0x9a, 0x14, 0x50,
+    0x00, 0x01, 0xae, 0xfc, 0x40, 0x0b, 0x14, 0x04, 0xec, 0xc1, 0x88, 0xfb, 0x90, 0x10, 0x1c, 0x16,
+    0x00, 0x60, 0x40, 0xe0, 0xc0, 0x03, 0x80, 0x09, 0xc5, 0x3b, 0x24, 0x02, 0x1c, 0x41, 0x28, 0x30,
+    0x31, 0x15, 0x7f, 0x39, 0x88, 0x93, 0x34, 0x00, 0xe0, 0xe0, 0xa4, 0x7d, 0xb0, 0x36, 0x00, 0xc5,
+    0x02, 0x4c, 0x20, 0x00, 0x2e, 0x84, 0x14, 0x68, 0xe0, 0x72, 0x00, 0xcc, 0x4d, 0x3c, 0xa2, 0x80,
+    0x2e, 0x97, 0x14, 0x59, 0xe0, 0x63, 0x00, 0xc2, 0x23, 0xe8, 0x60, 0xc2, 0x04, 0xe2, 0x10, 0x00,
+    0xf3, 0x00, 0x67, 0xe9, 0x01, 0x8e, 0x81, 0x58, 0xe7, 0x07, 0xea, 0x70, 0x5e, 0x81, 0x04, 0x05,
+    0xc5, 0x00, 0x5e, 0x21, 0xd6, 0xb0, 0x1d, 0xe2, 0x94, 0x80, 0x47, 0x5a, 0xc0, 0xdf, 0xff, 0x39,
+    0x17, 0xab, 0x77, 0xd5, 0xbb, 0xe7, 0x22, 0xf0, 0x51, 0x00, 0xf4, 0xf4, 0x08, 0x06, 0xb0, 0x7e,
+    0x91, 0x00, 0x3f, 0x40, 0xb7, 0x48, 0x00, 0x5f, 0xa0, 0x18, 0x80, 0x07, 0x70, 0x04, 0x6b, 0x98,
+    0x43, 0xbd, 0x19, 0x33, 0x5e, 0x20, 0x01, 0x33, 0x08, 0x01, 0x80, 0x02, 0xbf, 0xf5, 0x90, 0x0e,
+    0x20, 0x89, 0x30, 0x1c, 0x57, 0xb8, 0x62, 0xa5, 0x12, 0x00, 0x70, 0x14, 0x73, 0x07, 0x42, 0x40,
+    0x0a, 0xa0, 0xf0, 0x02, 0x15, 0x2c, 0x10, 0x0c, 0xb4, 0x01, 0xc3, 0x88, 0x01, 0xc9, 0x3a, 0x01,
+    0xcc, 0x28, 0x01, 0x00, 0x00, 0x86, 0x33, 0xfd, 0xb2, 0x40, 0x1c, 0x9e, 0xe6, 0x46, 0x66, 0xd6,
+    0x00, 0x8e, 0xc6, 0x7f, 0x73, 0xac, 0x65, 0x40, 0x1e, 0x16, 0xd5, 0xfb, 0x57, 0xa1, 0x60, 0x46,
+    0xa9, 0x6a, 0x82, 0xa0, 0x50, 0x2a, 0x81, 0xe4, 0x8b, 0x78, 0x60, 0x04, 0x0d, 0xe0, 0x66, 0x07,
+    0x80, 0x10, 0x00, 0x40, 0x40, 0x1f, 0xfc, 0x13, 0xe0, 0x65, 0x0c, 0x00, 0x20, 0x01, 0x03, 0x94,
+    0x3c, 0x51, 0xaf, 0x0c, 0x36, 0xc1, 0x8c, 0xca, 0x94, 0xa8, 0x36, 0xa6, 0x6b, 0x10, 0xf0, 0xb7,
+    0xaf, 0xd4, 0xbf, 0xd4, 0x00, 0x1d, 0x8c, 0xfe, 0x63, 0x79, 0x40, 0x39, 0x3d, 0xcc, 0xf2, 0x88,
+    0x04, 0x00, 0x00, 0xa3, 0xfd, 0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4,
+    0x0e, 0x80, 0xa0, 0x19, 0x43, 0x30, 0x16, 0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22,
+    0x20, 0x50, 0x05, 0x81, 0xff, 0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07,
+    0xb0, 0xa0, 0x0c, 0xe1, 0x40, 0x3f, 0xfd, 0xd6, 0x40, 0x18, 0xcc, 0x29, 0x80, 0x11, 0x66, 0x38,
+    0x04, 0xc0, 0x38, 0x44, 0x04, 0x00, 0x2b, 0xb7, 0x04, 0x88, 0x04, 0x88, 0x11, 0x78, 0x04, 0x5f,
+    0xed, 0x16, 0x50, 0x0e, 0x26, 0x0c, 0x00, 0xf2, 0x00, 0x80, 0x0b, 0x31, 0xc6, 0x14, 0x01, 0x19,
+    0x84, 0xf0, 0x80, 0x00, 0x15, 0x77, 0xeb, 0x00, 0x47, 0x8a, 0x20, 0x53, 0x40, 0x0e, 0x13, 0xde,
+    0xa0, 0x54, 0x41, 0x06, 0x90, 0xab, 0x86, 0x98, 0x28, 0x80, 0x51, 0xf3, 0xe0, 0x60, 0x1f, 0x78,
+    0x18, 0x07, 0xc6, 0x08, 0x01, 0xa3, 0xe5, 0x08, 0x6c, 0x81, 0x5c, 0x30, 0x38, 0x13, 0x7e, 0x81,
+    0x54, 0x07, 0xaa, 0x20, 0x53, 0x40, 0x00, 0x3f, 0xfd, 0xb0, 0x20, 0x1c, 0x20, 0x4f, 0x82, 0x01,
+    0x17, 0x7e, 0x91, 0x28, 0x03, 0xc5, 0xe0, 0x82, 0x01, 0xe2, 0x20, 0x28, 0x07, 0xc2, 0x02, 0x01,
+    0xf0, 0x80, 0x80, 0x78, 0x88, 0x0a, 0x01, 0xc5, 0xc0, 0x82, 0x00, 0x2e, 0xfd, 0x31, 0xa0, 0x0c,
+    0x20, 0x4f, 0xe2, 0x00, 0x3f, 0xff, 0x84, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05,
+    0xdd, 0xa4, 0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8,
+    0x40, 0x3f, 0xff, 0x68, 0x07, 0xc2, 0x00, 0x2f, 0xfd, 0x80, 0x1f, 0xfc, 0x62, 0xff, 0xd0, 0x01,
+    0x08, 0xef, 0x00, 0x17, 0x76, 0x70, 0x0f, 0xfe, 0x60, 0x00, 0x15, 0x77, 0xeb, 0x00, 0x47, 0x8a,
+    0x20, 0x53, 0x60, 0x0e, 0x13, 0xcf, 0xa0, 0x45, 0x42, 0x0d, 0x30, 0x59, 0x43, 0x30, 0x28, 0x80,
+    0x4d, 0x6d, 0xe0, 0x60, 0x07, 0xff, 0xb3, 0xc0, 0xc0, 0x04, 0x86, 0x00, 0x30, 0x51, 0x05, 0xbb,
+    0x03, 0x21, 0x05, 0x10, 0x24, 0x87, 0x87, 0x02, 0x6f, 0xd8, 0xaa, 0x80, 0xf5, 0x44, 0x0a, 0x28,
+    0x00, 0x3f, 0xd0, 0x0d, 0xbe, 0x80, 0x1f, 0xfd, 0x42, 0xff, 0xc4, 0x01, 0xff, 0xc2, 0x2f, 0xfc,
+    0x40, 0x1f, 0xfd, 0xe0, 0x3f, 0xd0, 0x0f, 0xfe, 0x90, 0x00, 0xef, 0xf1, 0x00, 0x7f, 0xf7, 0x04,
+    0xc4, 0x03, 0xa3, 0x1c, 0x03, 0xb8, 0x30, 0x10, 0x00, 0x4c, 0x0b, 0xf6, 0x0c, 0x03, 0x86, 0x02,
+    0xf2, 0x00, 0x3f, 0xd0, 0x0a, 0x3f, 0x84, 0x03, 0x91, 0xc3, 0x44, 0x03, 0x15, 0x84, 0x98, 0x07,
+    0x78, 0x33, 0x00, 0x3a, 0x88, 0x92, 0x01, 0xc4, 0xa0, 0x42, 0x01, 0xe1, 0x40, 0xa0, 0x0f, 0x55,
+    0x01, 0x14, 0x03, 0x12, 0x0c, 0x85, 0x80, 0x7c, 0xc6, 0x32, 0x01, 0xf7, 0x83, 0x18, 0x3f, 0xd0,
+    0x0f, 0xff, 0xd9, 0x7f, 0xe7, 0x00, 0xfb, 0xc0, 0x3f, 0xf8, 0x03, 0x3f, 0xfb, 0x00, 0x32, 0x80,
+    0x56, 0x01, 0xf7, 0x80, 0x08, 0xc0, 0x38, 0x81, 0x40, 0x0a, 0x06, 0x01, 0x85, 0x01, 0x02, 0xc1,
+    0x00, 0x30, 0xe8, 0x68, 0x98, 0xe8, 0x07, 0x38, 0x3a, 0x03, 0x80, 0x78, 0x4c, 0x64, 0x34, 0x03,
+    0xea, 0x03, 0x14, 0x00, 0xf9, 0xc0, 0x0e, 0x01, 0xf8, 0x4c, 0x34, 0x03, 0x00, 0x3f, 0xf2, 0x00,
+    0x57, 0xec, 0x01, 0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36, 0x18, 0x00, 0xfa,
+    0x01, 0x88, 0x03, 0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20, 0x1f, 0x22, 0x00,
+    0x3f, 0xa4, 0x02, 0x00, 0x00, 0x15, 0x77, 0xe3, 0x00, 0x63, 0xd5, 0x10, 0x39, 0x90, 0x05, 0xc0,
+    0x7b, 0xd2, 0x0c, 0x80, 0x84, 0x1a, 0x42, 0xce, 0x1e, 0x06, 0x0a, 0x20, 0x15, 0x82, 0x87, 0x81,
+    0x80, 0x62, 0x01, 0x0f, 0x03, 0x00, 0xc4, 0x02, 0x06, 0x08, 0x01, 0xac, 0x14, 0x10, 0x86, 0xc8,
+    0x59, 0xc3, 0x80, 0x1c, 0x09, 0xbd, 0x20, 0xca, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x00, 0x3f,
+    0xfd, 0xd4, 0x20, 0x18, 0x46, 0x5c, 0x00, 0x8b, 0xb9, 0xa2, 0x4a, 0x01, 0xc4, 0xe0, 0x40, 0x1c,
+    0x4e, 0x04, 0x00, 0x2e, 0xe6, 0x89, 0x28, 0x04, 0x23, 0x2e, 0x00, 0x45, 0xfe, 0xea, 0x10, 0x0f,
+    0xfe, 0x80, 0x00, 0x15, 0x77, 0xe3, 0x00, 0x63, 0xd5, 0x10, 0x39, 0x90, 0x05, 0xc0, 0x7b, 0xd2,
+    0x0c, 0x80, 0x84, 0x1a, 0x42, 0xce, 0x1e, 0x06, 0x0a, 0x20, 0x15, 0x82, 0x87, 0x81, 0x80, 0x62,
+    0x01, 0x0f, 0x03, 0x00, 0xc4, 0x01, 0x18, 0x20, 0x1e, 0xbd, 0x82, 0x02, 0x10, 0xd8, 0xa4, 0x38,
+    0x78, 0x03, 0x81, 0x35, 0x80, 0x0a, 0x80, 0x03, 0xd5, 0x10, 0x30, 0x60, 0x0c, 0x55, 0xdf, 0x98,
+    0x44, 0x00, 0x3f, 0xfd, 0xd4, 0x40, 0x18, 0x46, 0x5c, 0x10, 0x01, 0x77, 0x44, 0x2e, 0x01, 0xc2,
+    0xa1, 0xc0, 0x1e, 0x40, 0xe0, 0x01, 0x6e, 0xbc, 0xc5, 0x80, 0x22, 0x20, 0x0f, 0x80, 0x45, 0xfc,
+    0x02, 0x60, 0x1c, 0x2c, 0x10, 0x01, 0xeb, 0x05, 0x10, 0x0e, 0x24, 0x08, 0x00, 0x00, 0x47, 0x7e,
+    0xc0, 0x05, 0x8e, 0x22, 0x27, 0xb0, 0x33, 0x06, 0xf6, 0x8a, 0x1b, 0x80, 0x90, 0x15, 0x40, 0xa0,
+    0x8b, 0x61, 0x10, 0xe4, 0x18, 0x64, 0xf7, 0xee, 0x00, 0x2c, 0xea, 0x50, 0x85, 0x55, 0xb0, 0xad,
+    0x38, 0x60, 0x24, 0x10, 0x00, 0xc0, 0x54, 0x87, 0x7b, 0xd0, 0x28, 0x31, 0xc8, 0x44, 0xba, 0x40,
+    0xbf, 0xff, 0xa4, 0x40, 0x3f, 0x57, 0xf9, 0x81, 0xff, 0xd2, 0x01, 0xff, 0xfc, 0x00, 0x4f, 0xc0,
+    0x0d, 0xfe, 0x20, 0x0f, 0xff, 0x83, 0x81, 0x00, 0x42, 0x00, 0x33, 0x00, 0xc0, 0x0d, 0x81, 0x08,
+    0x40, 0x3f, 0xf2, 0x84, 0x80, 0x1e, 0x8c, 0x00, 0x98, 0x80, 0x00, 0xcf, 0x80, 0x0d, 0x3f, 0x56,
+    0x0a, 0x01, 0x9c, 0x3d, 0x40, 0x88, 0x00, 0x31, 0x05, 0x23, 0x04, 0x00, 0x20, 0x20, 0x02, 0xc3,
+    0x40, 0x16, 0x1a, 0x00, 0x50, 0x40, 0x13, 0x07, 0x00, 0x11, 0x01, 0x50, 0x10, 0x40, 0x25, 0x0c,
+    0xc0, 0x68, 0x06, 0xa0, 0x47, 0x07, 0x00, 0xc4, 0x50, 0x98, 0x80, 0x72, 0x80, 0x2c, 0x02, 0x00,
+    0xdf, 0x60, 0x01, 0xff, 0x88, 0x00, 0xff, 0x88, 0x18, 0x00, 0x40, 0x02, 0x00, 0x30, 0x13, 0x01,
+    0xc0, 0x1a, 0x00, 0xf0, 0x02, 0x86, 0x20, 0x10, 0x82, 0x08, 0x20, 0x08, 0x81, 0x04, 0x81, 0x48,
+    0x55, 0x08, 0x50, 0x0c, 0x00, 0x81, 0x8e, 0x18, 0x60, 0xba, 0x08, 0x00, 0xc0, 0x3c, 0x04, 0xc0,
+    0xc4, 0x0c, 0x00, 0x20, 0x2a, 0x80, 0xd0, 0x0c, 0xc0, 0x80, 0x01, 0x21, 0x33, 0x00, 0x0d, 0x00,
+    0xc0, 0x32, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0xd8, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x00, 0x00,
+    0x4f, 0xf1, 0x00, 0x13, 0xfc, 0x28, 0xa1, 0x20, 0x09, 0x08, 0x10, 0xb0, 0x44, 0x39, 0x11, 0xc0,
+    0x03, 0x21, 0x30, 0x1c, 0x01, 0x98, 0xc8, 0x18, 0xc0, 0x3a, 0xc0, 0x1a, 0x01, 0xc3, 0x20, 0x09,
+    0x00, 0xeb, 0x15, 0x22, 0x38, 0x04, 0x8a, 0x37, 0x21, 0x04, 0x00, 0xa0, 0x81, 0x45, 0x09, 0x09,
+    0x13, 0x60, 0x05, 0x82, 0x28, 0xaf, 0xb0, 0x08, 0x7f, 0xcb, 0x00, 0x88, 0x00, 0x48, 0x1a, 0x93,
+    0x04, 0x00, 0xb8, 0x78, 0x02, 0x00, 0xd2, 0x01, 0x0c, 0x00, 0x30, 0x12, 0xc1, 0x20, 0x19, 0xc4,
+    0x81, 0x48, 0x03, 0xa0, 0x01, 0x00, 0x1e, 0x40, 0x12, 0x00, 0xff, 0xea, 0x80, 0x7f, 0xff, 0x9c,
+    0x03, 0xf9, 0xff, 0xf3, 0x81, 0x38, 0x06, 0x47, 0x0e, 0x00, 0xc3, 0x41, 0x26, 0x01, 0xb4, 0x55,
+    0x80, 0x34, 0x19, 0x50, 0x06, 0x57, 0x0e, 0x00, 0xc5, 0x41, 0x26, 0x01, 0xac, 0x01, 0x3f, 0xf9,
+    0xcc, 0x03, 0xef, 0x00, 0x1b, 0xb8, 0x41, 0x12, 0x30, 0x00, 0xf9, 0x00, 0x7f, 0xf8, 0xc6, 0xc4,
+    0x02, 0x43, 0x00, 0xde, 0x00, 0xc8, 0x24, 0x01, 0x60, 0x20, 0x04, 0x81, 0x80, 0x10, 0x92, 0x00,
+    0x64, 0x12, 0x00, 0xb0, 0x10, 0x02, 0x40, 0xc0, 0x08, 0x49, 0x00, 0x32, 0x09, 0x00, 0x58, 0x08,
+    0x01, 0x20, 0x60, 0x04, 0x24, 0x80, 0x00, 0x6b, 0xb4, 0x72, 0x25, 0x16, 0x01, 0xff, 0xda, 0x58,
+    0x00, 0x69, 0x80, 0x00, 0x00, 0x67, 0xa0, 0x04, 0x66, 0x1f, 0x00, 0xa4, 0xad, 0x08, 0x05, 0x69,
+    0x42, 0x81, 0x81, 0x81, 0x98, 0x00, 0xbb, 0xf3, 0xa2, 0x7b, 0x40, 0x25, 0x20, 0x38, 0xf0, 0x1e,
+    0x25, 0x00, 0x03, 0xbf, 0xea, 0x10, 0x06, 0xa2, 0x09, 0x68, 0x09, 0x26, 0xf0, 0x10, 0x0a, 0x3a,
+    0xf8, 0x02, 0x3d, 0x71, 0x90, 0x0a, 0xc2, 0x69, 0x80, 0x2e, 0x0b, 0x9c, 0x00, 0x99, 0x84, 0xf0,
+    0x01, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x64, 0xff, 0x30, 0x04, 0x8c, 0x43, 0x2a, 0x01, 0x6e, 0xa0,
+    0x24, 0x00, 0x84, 0x0c, 0x04, 0x01, 0xfe, 0x42, 0x06, 0x02, 0x00, 0xb7, 0x50, 0x12, 0x00, 0x46,
+    0x21, 0x95, 0x00, 0x01, 0xae, 0xfa, 0x10, 0x06, 0x28, 0x12, 0xe0, 0x29, 0x1f, 0x69, 0x92, 0x68,
+    0x58, 0x03, 0x3d, 0x04, 0x03, 0x84, 0x30, 0x2c, 0x01, 0x9c, 0x8a, 0x47, 0xda, 0x64, 0x81, 0x8a,
+    0x04, 0xb8, 0x00, 0x00, 0xe5, 0xfa, 0x00, 0xff, 0xe2, 0x96, 0x7e, 0x10, 0x05, 0x86, 0x25, 0x00,
+    0x06, 0x13, 0xee, 0x20, 0x03, 0xc2, 0xc0, 0x1c, 0x01, 0xfe, 0xf0, 0xb0, 0x07, 0x00, 0x1c, 0x4f,
+    0xb8, 0x80, 0x01, 0xd3, 0x12, 0x80, 0x00, 0x01, 0xaf, 0xea, 0x10, 0x06, 0x2a, 0x12, 0xe0, 0x29,
+    0x35, 0x6a, 0x92, 0x68, 0x37, 0x71, 0x40, 0xc0, 0x0d, 0x77, 0x97, 0x40, 0x91, 0x07, 0xe2, 0xa4,
+    0x99, 0x70, 0xc6, 0x18, 0xa6, 0x8b, 0x80, 0x00, 0x01, 0xbf, 0xe0, 0x64, 0x14, 0x0e, 0x09, 0xae,
+    0x60, 0x8e, 0x72, 0x02, 0x49, 0x40, 0xaa, 0x00, 0x7f, 0xf3, 0x40, 0x02, 0xcf, 0xc7, 0xfa, 0x0c,
+    0x31, 0x14, 0x00, 0x18, 0x4f, 0xb5, 0x00, 0x1e, 0x16, 0x00, 0xe0, 0x0f, 0xf7, 0x85, 0x80, 0x38,
+    0x00, 0xe2, 0x7d, 0xa8, 0x00, 0x1d, 0x31, 0x14, 0x00, 0x06, 0xeb, 0xf3, 0xc0, 0x85, 0x67, 0x29,
+    0xc2, 0x83, 0xd0, 0x94, 0xec, 0x80, 0x4f, 0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18, 0x02, 0x48, 0x11,
+    0x49, 0x00, 0x5d, 0xe6, 0x08, 0x00, 0x31, 0x04, 0x01, 0x00, 0x38, 0x07, 0xff, 0x44, 0x3e, 0x96,
+    0x15, 0x55, 0xea, 0x5d, 0x00, 0x7f, 0xf2, 0x40, 0x03, 0xe9, 0x06, 0x15, 0x05, 0xbd, 0x04, 0xba,
+    0x00, 0xff, 0xe8, 0x88, 0x01, 0x6c, 0x0f, 0x45, 0x24, 0x4f, 0xb0, 0x0f, 0xfe, 0x69, 0x7f, 0x90,
+    0x02, 0x1c, 0x09, 0x40, 0x03, 0xe8, 0xb3, 0x00, 0x23, 0x30, 0x48, 0x07, 0xce, 0x01, 0x8b, 0x02,
+    0x08, 0x02, 0x63, 0x70, 0xe0, 0x0e, 0x82, 0x37, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x90, 0x4f, 0xa8,
+    0xfe, 0x45, 0xef, 0x90, 0x09, 0x50, 0xc6, 0xec, 0xa0, 0xcc, 0x00, 0x0e, 0x60, 0x42, 0xae, 0x03,
+    0xc0, 0x0a, 0x00, 0x20, 0x60, 0x20, 0x30, 0x0f, 0xff, 0x20, 0x4f, 0xb8, 0xfe, 0x60, 0x09, 0x18,
+    0x86, 0x48, 0x00, 0x3d, 0xa8, 0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x00,
+    0x01, 0xae, 0xfb, 0x20, 0x06, 0x28, 0x0a, 0x60, 0xa9, 0x13, 0xb8, 0x82, 0xda, 0x14, 0x00, 0xe0,
+    0xd1, 0x00, 0xfb, 0x02, 0xc0, 0x1c, 0x1a, 0xa4, 0x7d, 0xa8, 0x2c, 0x18, 0xa0, 0x49, 0x82, 0x00,
+    0x4f, 0xba, 0xfe, 0x60, 0x09, 0x1d, 0x46, 0x54, 0x00, 0x3b, 0x52, 0x12, 0x00, 0x40, 0x03, 0x81,
+    0x00, 0x04, 0x00, 0x60, 0x19, 0x08, 0x14, 0x08, 0x02, 0xdd, 0x40, 0x48, 0x01, 0x1c, 0x86, 0x54,
+    0x02, 0x8f, 0xe6, 0x00, 0xff, 0xe2, 0x80, 0x02, 0xcf, 0xc7, 0xfa, 0x0c, 0x31, 0x28, 0x00, 0x30,
+    0x9f, 0x71, 0x00, 0x1e, 0x16, 0x00, 0xe0, 0x0f, 0xf7, 0x85, 0x80, 0x38, 0x00, 0xe2, 0x7d, 0xc4,
+    0x00, 0x0e, 0x98, 0x94, 0x00, 0x47, 0x9f, 0x84, 0x01, 0xff, 0xc6, 0x00, 0x4f, 0xbb, 0x78, 0x04,
+    0x88, 0x30, 0x0d, 0xd8, 0x01, 0x18, 0x80, 0x67, 0x00, 0xff, 0xe4, 0x80, 0x05, 0xdf, 0xd7, 0x03,
+    0xa2, 0x60, 0x86, 0x50, 0x59, 0xf5, 0x04, 0x05, 0xd8, 0xf6, 0x2d, 0x71, 0x5a, 0x95, 0xbc, 0xc5,
+    0x82, 0x0b, 0x54, 0xc8, 0x1d, 0x28, 0x98, 0xda, 0x80, 0x0a, 0xf6, 0x00, 0xf7, 0x28, 0x4e, 0xb8,
+    0x81, 0x24, 0xa0, 0x5c, 0x80, 0x7f, 0xc6, 0x01, 0x84, 0x22, 0x42, 0x4c, 0x50, 0x4f, 0xb0, 0x04,
+    0x7b, 0x80, 0x7f, 0xf5, 0x1c, 0x14, 0x41, 0x40, 0x06, 0x22, 0xef, 0x20, 0x0a, 0x88, 0x15, 0xc0,
+    0x00, 0xcf, 0x50, 0x04, 0xfc, 0x50, 0x78, 0x01, 0x02, 0x9c, 0x10, 0x08, 0xb0, 0x98, 0xa2, 0x82,
+    0x80, 0x28, 0x33, 0x01, 0x40, 0x07, 0x05, 0x42, 0x20, 0x00, 0x4c, 0x82, 0x80, 0x35, 0x00, 0x14,
+    0x00, 0x00, 0xcf, 0x40, 0x5f, 0xc0, 0x07, 0x79, 0xa0, 0x60, 0x68, 0x18, 0x08, 0x80, 0xec, 0x10,
+    0x10, 0x00, 0x88, 0x05, 0x03, 0x03, 0x13, 0x50, 0x3c, 0x0c, 0x00, 0x28, 0x30, 0x71, 0x62, 0x82,
+    0x00, 0x30, 0x24, 0x11, 0x0a, 0x64, 0x40, 0x03, 0x80, 0x98, 0x60, 0x82, 0x00, 0x42, 0x40, 0x80,
+    0x80, 0x0d, 0x00, 0x00, 0x6f, 0xb0, 0x2f, 0xe1, 0x63, 0x44, 0x48, 0x40, 0x87, 0x85, 0x21, 0xb0,
+    0x00, 0xd8, 0x43, 0x80, 0x31, 0x00, 0x18, 0x02, 0x54, 0x20, 0x90, 0x00, 0xd8, 0x7a, 0x94, 0x04,
+    0x0b, 0x15, 0x83, 0x90, 0xbf, 0x50, 0x04, 0xfb, 0xe8, 0x78, 0x01, 0xc1, 0x5c, 0x14, 0x0c, 0x4c,
+    0x85, 0x41, 0x2c, 0x2c, 0x01, 0xe1, 0xa8, 0x0c, 0x00, 0x50, 0x73, 0x30, 0x80, 0x4c, 0x21, 0x40,
+    0x1b, 0x40, 0x0e, 0x01, 0x88, 0x10, 0x40, 0x03, 0x72, 0x1c, 0x01, 0x90, 0x1d, 0x40, 0x20, 0x5f,
+    0xfe, 0x91, 0x33, 0x80, 0x02, 0x99, 0x89, 0x02, 0x80, 0x01, 0x50, 0x70, 0x05, 0xc1, 0x26, 0x00,
+    0x93, 0x56, 0x00, 0x1b, 0x03, 0x5d, 0x9d, 0x80, 0x06, 0x88, 0xd0, 0x00, 0x92, 0x5c, 0x00, 0x96,
+    0xd8, 0x00, 0xd0, 0x7b, 0x00, 0x18, 0x60, 0x07, 0xe1, 0x40, 0x70, 0x3e, 0x16, 0x30, 0x0c, 0x20,
+    0x03, 0xd1, 0x72, 0x00, 0x12, 0x83, 0x00, 0x42, 0x01, 0xc6, 0x04, 0x01, 0x78, 0x4b, 0x80, 0x19,
+    0xc7, 0x40, 0x12, 0x09, 0xd6, 0x00, 0xff, 0xf3, 0x80, 0x58, 0x50, 0x0b, 0x5e, 0x98, 0x01, 0x12,
+    0x14, 0x01, 0x20, 0x08, 0x07, 0xf1, 0x81, 0x18, 0x00, 0x60, 0x31, 0x40, 0x3f, 0x40, 0x62, 0x80,
+    0x81, 0x18, 0x00, 0xc0, 0x38, 0x40, 0x40, 0x0b, 0xa0, 0xa0, 0x0d, 0x05, 0x90, 0x00, 0x04, 0xee,
+    0x40, 0x2e, 0x90, 0x50, 0x83, 0xf5, 0x11, 0x81, 0xc7, 0x48, 0x0c, 0x88, 0x00, 0x2e, 0x97, 0x14,
+    0x58, 0xe1, 0xd4, 0x25, 0xd0, 0x00, 0x80, 0x4e, 0x0e, 0x01, 0x08, 0x06, 0x10, 0x00, 0x99, 0xc0,
+    0x38, 0xf3, 0x06, 0x01, 0x3e, 0x2a, 0x64, 0x01, 0x40, 0x2a, 0x85, 0xc9, 0x41, 0xb3, 0x6d, 0xc3,
+    0x83, 0x80, 0x0b, 0x04, 0x21, 0xc0, 0x05, 0x83, 0xb0, 0x6c, 0xdb, 0x71, 0x37, 0x05, 0x50, 0xb9,
+    0x04, 0x62, 0x22, 0xe0, 0x02, 0x3d, 0xc4, 0x00, 0x00, 0x00, 0x1e, 0x7f, 0x38, 0x04, 0x58, 0x62,
+    0x28, 0x70, 0x05, 0x02, 0xf6, 0x84, 0x80, 0x08, 0x3c, 0x09, 0x54, 0x01, 0xf5, 0x58, 0x4a, 0x85,
+    0x7d, 0x80, 0x5e, 0x40, 0x49, 0x80, 0x13, 0x28, 0x55, 0xb8, 0x06, 0x10, 0x30, 0x04, 0x58, 0xc3,
+    0x04, 0xee, 0x9d, 0x04, 0x40, 0x02, 0x28, 0x64, 0x00, 0x01, 0x00, 0xf0, 0x80, 0x3e, 0x2b, 0xfd,
+    0x8d, 0xea, 0x0c, 0xee, 0x9a, 0x69, 0x34, 0x01, 0x2d, 0x65, 0xa6, 0x01, 0x07, 0xb0, 0x0d, 0x04,
+    0x60, 0x24, 0x01, 0x84, 0x1c, 0x08, 0x80, 0x18, 0x81, 0xc1, 0x60, 0x40, 0x28, 0x23, 0x03, 0x1f,
+    0x76, 0xc5, 0x33, 0x00, 0x2d, 0xe6, 0x1f, 0x14, 0x01, 0x69, 0x3d, 0xcb, 0x3b, 0x30, 0xbf, 0x60,
+    0x05, 0xfb, 0x78, 0x50, 0x12, 0x0b, 0x21, 0x9d, 0x41, 0x20, 0x09, 0x09, 0x61, 0x70, 0x02, 0x8a,
+    0x8b, 0x00, 0x1b, 0xc4, 0x00, 0xfa, 0x0f, 0x92, 0x05, 0x9c, 0x02, 0x6a, 0x00, 0x33, 0x03, 0x7e,
+    0x01, 0x7e, 0x83, 0xe4, 0x81, 0x67, 0x00, 0x9a, 0x80, 0x0c, 0xc0, 0x00, 0xbf, 0x10, 0x0f, 0xfe,
+    0x05, 0x68, 0x88, 0x80, 0x35, 0xf8, 0x80, 0x7f, 0xf0, 0x2b, 0x44, 0x02, 0xbf, 0xd7, 0x00, 0xbd,
+    0x08, 0x90, 0x80, 0x24, 0x7b, 0x84, 0x60, 0x20, 0x46, 0x6d, 0x70, 0x03, 0x8e, 0x59, 0x80, 0x0d,
+    0xd0, 0xd3, 0x1c, 0x2c, 0x2b, 0x2c, 0x60, 0x38, 0x2c, 0x51, 0xc0, 0x0c, 0x8b, 0xd6, 0xce, 0x00,
+    0xbb, 0x22, 0x02, 0x80, 0x02, 0x97, 0x21, 0x40, 0x7d, 0x60, 0x10, 0x81, 0x92, 0x7c, 0x86, 0x80,
+    0x31, 0xcd, 0x6d, 0x00, 0x04, 0x00, 0x20, 0x35, 0xcb, 0x5d, 0x10, 0x7a, 0x86, 0x80, 0x00, 0xcb,
+    0x57, 0x04, 0x01, 0xc3, 0x94, 0xa8, 0xfa, 0xc0, 0x1b, 0x4d, 0xfb, 0xec, 0xa5, 0x40, 0x0c, 0x71,
+    0x04, 0x76, 0xc1, 0xb0, 0x05, 0x0b, 0xdd, 0x46, 0xac, 0x8a, 0x01, 0xa2, 0xa5, 0x72, 0x42, 0x81,
+    0x00, 0x5a, 0x2a, 0x37, 0x80, 0x01, 0x02, 0x7d, 0x15, 0x1b, 0xb3, 0x81, 0x02, 0x90, 0x9d, 0x72,
+    0x7c, 0x82, 0x84, 0x8d, 0x45, 0x46, 0x71, 0xb8, 0x00, 0x68, 0x6e, 0x2f, 0x15, 0x50, 0x01, 0x26,
+    0xa9, 0x9d, 0x34, 0x00, 0x00, 0x08, 0xef, 0xb1, 0x57, 0x99, 0x24, 0xae, 0x06, 0x01, 0x36, 0x77,
+    0x80, 0x3c, 0x28, 0xc0, 0x14, 0x59, 0xe0, 0x00, 0x00, 0x3f, 0xe2, 0x7f, 0x08, 0x1c, 0x0f, 0xd0,
+    0x50, 0x8b, 0x42, 0xbc, 0x61, 0x01, 0x04, 0x4e, 0x60, 0xa0, 0x05, 0x50, 0xcc, 0x83, 0x80, 0x2a,
+    0x25, 0x05, 0x39, 0x00, 0xbd, 0xc6, 0xdc, 0x44, 0x00, 0x7c, 0xce, 0x7e, 0x33, 0xee, 0x9f, 0xfb,
+    0x80, 0x3c, 0x2f, 0xa0, 0x00, 0x2e, 0xfe, 0x20, 0x04, 0xf1, 0x0c, 0xaa, 0x30, 0x14, 0xfd, 0x6f,
+    0xe4, 0x0a, 0xb9, 0x07, 0xb1, 0x2a, 0x00, 0x6f, 0x30, 0x13, 0x47, 0x10, 0xc2, 0x14, 0x41, 0xa5,
+    0x69, 0x66, 0xb9, 0x05, 0x1e, 0xfe, 0xa4, 0x80, 0x51, 0xfb, 0xf0, 0x00, 0x00, 0x01, 0x1c, 0x9d,
+    0xd5, 0x2d, 0xdd, 0x00, 0x00, 0x84, 0x02, 0x7f, 0xe8, 0x02, 0x86, 0x77, 0x1b, 0x84, 0xc0, 0xa3,
+    0x03, 0xa8, 0x99, 0x9a, 0x29, 0x50, 0x27, 0x31, 0x40, 0x00, 0x00, 0x27, 0xb8, 0x07, 0xfd, 0xdf,
+    0x61, 0x1f, 0xe0, 0x44, 0x18, 0x12, 0x20, 0x2a, 0xe0, 0x2a, 0xec, 0x01, 0x33, 0xa0, 0x05, 0x59,
+    0xc9, 0xf9, 0x80, 0x43, 0x3f, 0x00, 0x0a, 0xfe, 0x50, 0x65, 0xa5, 0xa0, 0x7d, 0x51, 0x10, 0x09,
+    0xda, 0xd0, 0x16, 0x24, 0xb8, 0x51, 0x04, 0xe0, 0x80, 0x09, 0xfe, 0x80, 0x44, 0x53, 0xb8, 0x53,
+    0x65, 0x9c, 0x49, 0x75, 0xdc, 0x6f, 0x48, 0x20, 0x05, 0x6a, 0x78, 0x30, 0x01, 0x52, 0x0a, 0xb0,
+    0x34, 0xb2, 0x00, 0x4f, 0xb0, 0x04, 0x7b, 0x80, 0x7f, 0xf6, 0xd4, 0x00, 0x60, 0x1c, 0x3b, 0x88,
+    0x12, 0x60, 0x03, 0x12, 0xb4, 0x15, 0x00, 0x3e, 0x72, 0x5f, 0xb0, 0x07, 0xff, 0x18, 0x03, 0xcf,
+    0xfc, 0x65, 0x86, 0x04, 0x40, 0x05, 0x00, 0x57, 0x60, 0x01, 0x00, 0x7c, 0x40, 0x1f, 0x50, 0x07,
+    0xc5, 0x88, 0x26, 0x01, 0x8e, 0xf9, 0x40, 0x3f, 0xf9, 0xe0, 0x06, 0x26, 0x9e, 0x51, 0x40, 0x08,
+    0x00, 0x13, 0xb8, 0x0b, 0x20, 0x1f, 0x54, 0x00, 0x3c, 0xf3, 0x80, 0x0a, 0xa0, 0x00, 0x20, 0x1f,
+    0xf0, 0x00, 0xfd, 0x1f, 0xec, 0x20, 0x57, 0x6a, 0x2f, 0x0f, 0x09, 0x56, 0x22, 0x00, 0x7d, 0xe1,
+    0x4c, 0xc2, 0x22, 0xc2, 0x4a, 0xf8, 0x00, 0x5f, 0xd3, 0xff, 0x10, 0x01, 0x58, 0xa6, 0x41, 0xe0,
+    0x14, 0x9a, 0x8a, 0x95, 0x00, 0x56, 0x17, 0xc0, 0x82, 0x07, 0x01, 0xf4, 0x14, 0x22, 0xd0, 0xa8,
+    0x17, 0x40, 0x56, 0xa7, 0x38, 0x80, 0x00, 0x3d, 0xe0, 0x0c, 0xfe, 0x21, 0x2c, 0x01, 0x8a, 0x24,
+    0x42, 0xb4, 0x03, 0x49, 0xb0, 0x07, 0xca, 0x9c, 0x01, 0xfa, 0xdc, 0x84, 0x40, 0x1d, 0x27, 0x03,
+    0xdc, 0x00, 0x37, 0x9b, 0x48, 0x59, 0x00, 0x61, 0xe5, 0x43, 0x5b, 0x00, 0xce, 0x76, 0x1f, 0x06,
+    0x01, 0x14, 0x40, 0x44, 0x71, 0x41, 0x41, 0x26, 0xc0, 0x3b, 0xa9, 0x0b, 0x09, 0xd0, 0x08, 0x88,
+    0xda, 0x20, 0x2b, 0xc0, 0x0c, 0xba, 0x20, 0x09, 0x72, 0x00, 0x86, 0xe8, 0x40, 0x15, 0x40, 0x0d,
+    0x66, 0xe0, 0x10, 0x80, 0x64, 0x5e, 0x00, 0xfe, 0x96, 0x30, 0x0f, 0xd0, 0x72, 0xff, 0xe6, 0x00,
+    0x3e, 0x9b, 0xd8, 0xc3, 0xac, 0x80, 0x04, 0xfd, 0x14, 0x72, 0x34, 0x40, 0x27, 0x3a, 0x00, 0x1a,
+    0xc5, 0x00, 0x06, 0x24, 0x40, 0x0f, 0x56, 0x80, 0x0a, 0x36, 0x00, 0x14, 0x05, 0xf8, 0x02, 0x34,
+    0x02, 0x2c, 0xcc, 0x00, 0x09, 0xeb, 0x10, 0x08, 0xfd, 0x01, 0x5a, 0x9a, 0x00, 0x2f, 0x54, 0x05,
+    0xf4, 0x60, 0x09, 0xca, 0xc0, 0x37, 0xa5, 0x01, 0x44, 0x04, 0x00, 0x93, 0xc9, 0xe1, 0x26, 0xc0,
+    0x13, 0x27, 0x25, 0xaa, 0x70, 0x67, 0x99, 0x6f, 0x7b, 0x5b, 0x92, 0x88, 0x06, 0x10, 0x83, 0x80,
+    0xb8, 0x00, 0xe3, 0x69, 0x08, 0x54, 0x00, 0xee, 0x64, 0x05, 0x4e, 0x0e, 0x00, 0x39, 0xc0, 0x03,
+    0xf7, 0x02, 0x00, 0x0b, 0xe2, 0x00, 0x22, 0x1e, 0xa8, 0x00, 0xab, 0x84, 0x03, 0x90, 0x48, 0x03,
+    0xaa, 0x4c, 0x03, 0x8f, 0x00, 0x3d, 0x2a, 0x01, 0x87, 0x05, 0x80, 0x36, 0x1c, 0xc8, 0x02, 0x52,
+    0x56, 0x03, 0x73, 0x00, 0x08, 0x02, 0x20, 0xc8, 0x09, 0xdc, 0x42, 0x51, 0xc4, 0x11, 0x2e, 0x00,
+    0x00, 0x0a, 0x98, 0x07, 0xc3, 0xd8, 0x20, 0x1f, 0x50, 0xc8, 0x07, 0xc3, 0xd0, 0x01, 0xf4, 0x7f,
+    0xa0, 0x03, 0xca, 0x00, 0x50, 0x0e, 0x22, 0x08, 0x88, 0x80, 0x1a, 0x81, 0xd0, 0x14, 0x03, 0x28,
+    0x66, 0x02, 0xc0, 0x22, 0x20, 0x23, 0x81, 0x90, 0x01, 0x40, 0xc4, 0x44, 0x0a, 0x00, 0xb0, 0x3f,
+    0xf1, 0x05, 0x81, 0x18, 0x11, 0x60, 0x31, 0x50, 0x2d, 0xdc, 0x20, 0xf6, 0x14, 0x01, 0x9c, 0x28,
+    0x00, 0xe3, 0x51, 0x00, 0xf0, 0xe7, 0x08, 0x07, 0xa4, 0x68, 0x03, 0xe8, 0xe1, 0x00, 0xf4, 0x7f,
+    0xa0, 0x03, 0xca, 0x00, 0x50, 0x0e, 0x22, 0x08, 0x88, 0x80, 0x1a, 0x81, 0xd0, 0x14, 0x03, 0x28,
+    0x66, 0x02, 0xc0, 0x22, 0x20, 0x23, 0x81, 0x90, 0x01, 0x40, 0xc4, 0x44, 0x0a, 0x00, 0xb0, 0x3f,
+    0xf1, 0x05, 0x81, 0x18, 0x11, 0x60, 0x31, 0x50, 0x2d, 0xdc, 0x20, 0xf6, 0x14, 0x01, 0x9c, 0x28,
+    0x00, 0xce, 0xe0, 0x0f, 0x9e, 0x20, 0xe0, 0x1c, 0x51, 0x32, 0x82, 0x00, 0xc5, 0xec, 0xcf, 0x20,
+    0x0e, 0x8f, 0xf4, 0x00, 0x79, 0x40, 0x0a, 0x01, 0xc4, 0x41, 0x11, 0x10, 0x03, 0x50, 0x3a, 0x02,
+    0x80, 0x65, 0x0c, 0xc0, 0x58, 0x04, 0x44, 0x04, 0x70, 0x32, 0x00, 0x28, 0x18, 0x88, 0x81, 0x40,
+    0x16, 0x07, 0xfe, 0x20, 0xb0, 0x23, 0x02, 0x2c, 0x06, 0x2a, 0x05, 0xbb, 0x84, 0x1e, 0xc2, 0x80,
+    0x33, 0x85, 0x00, 0x00, 0xff, 0xe0, 0xe6, 0x9e, 0xa0, 0x06, 0x42, 0xbc, 0x34, 0x00, 0xcb, 0x8d,
+    0xde, 0x01, 0xc3, 0x5f, 0xd2, 0x01, 0xe5, 0x00, 0x28, 0x07, 0x11, 0x04, 0x44, 0x40, 0x0d, 0x40,
+    0xe8, 0x0a, 0x01, 0x94, 0x33, 0x01, 0x60, 0x11, 0x10, 0x11, 0xc0, 0xc8, 0x00, 0xa0, 0x62, 0x22,
+    0x05, 0x00, 0x58, 0x1f, 0xf8, 0x82, 0xc0, 0x8c, 0x08, 0xb0, 0x18, 0xa8, 0x16, 0xee, 0x10, 0x7b,
+    0x0a, 0x00, 0xce, 0x14, 0x00, 0x00, 0x8c, 0x00, 0x60, 0x1d, 0x18, 0xee, 0xc8, 0x00, 0xda, 0x04,
+    0x40, 0xd0, 0x0c, 0xbe, 0xaa, 0xf5, 0x00, 0xe8, 0xff, 0x40, 0x07, 0x94, 0x00, 0xa0, 0x1c, 0x44,
+    0x11, 0x11, 0x00, 0x35, 0x03, 0xa0, 0x28, 0x06, 0x50, 0xcc, 0x05, 0x80, 0x44, 0x40, 0x47, 0x03,
+    0x20, 0x02, 0x81, 0x88, 0x88, 0x14, 0x01, 0x60, 0x7f, 0xe2, 0x0b, 0x02, 0x30, 0x22, 0xc0, 0x62,
+    0xa0, 0x5b, 0xb8, 0x41, 0xec, 0x28, 0x03, 0x38, 0x50, 0x00, 0x93, 0xb8, 0x80, 0x1e, 0xe9, 0x97,
+    0x00, 0x7b, 0xa6, 0x5c, 0x01, 0xe4, 0xee, 0x20, 0x07, 0xa3, 0xfd, 0x00, 0x1e, 0x50, 0x02, 0x80,
+    0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80, 0xa0, 0x19, 0x43, 0x30, 0x16, 0x01, 0x11, 0x01,
+    0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50, 0x05, 0x81, 0xff, 0x88, 0x2c, 0x08, 0xc0, 0x8b,
+    0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0, 0x0c, 0xe1, 0x40, 0x00, 0xdb, 0xff, 0xfb, 0x00,
+    0x24, 0x20, 0x0f, 0xce, 0x01, 0x70, 0x4c, 0x03, 0x7f, 0xeb, 0x00, 0x0a, 0x83, 0x00, 0x7f, 0x9c,
+    0x18, 0x02, 0x6e, 0xec, 0xa0, 0x0a, 0x0a, 0x00, 0xc2, 0x38, 0xc0, 0xcc, 0x1f, 0x94, 0x0d, 0xff,
+    0x98, 0x28, 0x00, 0x66, 0x20, 0x0f, 0xce, 0x1d, 0xfe, 0x80, 0x0f, 0x94, 0x50, 0x40, 0x33, 0x7f,
+    0xeb, 0xe0, 0xd0, 0x0f, 0xf3, 0x80, 0x00, 0x15, 0x77, 0xeb, 0x00, 0x47, 0x8a, 0x20, 0x53, 0x40,
+    0x0e, 0x13, 0xde, 0xa0, 0x54, 0x41, 0x06, 0x90, 0xab, 0x86, 0x98, 0x28, 0x80, 0x51, 0xf3, 0xe0,
+    0x60, 0x1f, 0x78, 0x18, 0x07, 0xc6, 0x08, 0x01, 0xa3, 0xe5, 0x08, 0x6c, 0x81, 0x5c, 0x30, 0x38,
+    0x13, 0x7e, 0x81, 0x54, 0x07, 0xaa, 0x00, 0x29, 0xa0, 0x08, 0xaa, 0x4b, 0x98, 0x03, 0xcd, 0x5e,
+    0x01, 0xf5, 0x45, 0x80, 0x40, 0x00, 0x22, 0x80, 0x7c, 0x34, 0xe0, 0x1e, 0x56, 0x90, 0x0f, 0xa7,
+    0x80, 0x31, 0xff, 0xfc, 0x20, 0x1f, 0x84, 0x00, 0x5f, 0xfc, 0x01, 0xff, 0xc0, 0x2e, 0xed, 0x20,
+    0x18, 0x47, 0x18, 0x04, 0x5f, 0xfa, 0x80, 0x3f, 0xf9, 0x25, 0xff, 0xc0, 0x1f, 0xc2, 0x00, 0x00,
+    0xc2, 0xa6, 0x01, 0xe8, 0xa1, 0x00, 0xe2, 0x69, 0x20, 0x0e, 0x2f, 0x60, 0x08, 0xff, 0xfe, 0x10,
+    0x0f, 0xc2, 0x00, 0x2f, 0xfe, 0x00, 0xff, 0xe0, 0x17, 0x76, 0x90, 0x0c, 0x23, 0x8c, 0x02, 0x2f,
+    0xfd, 0x40, 0x1f, 0xfc, 0x92, 0xff, 0xe0, 0x0f, 0xe1, 0x00, 0x00, 0x92, 0x08, 0x03, 0x8a, 0xdb,
+    0xc0, 0x3a, 0x4f, 0xce, 0x00, 0x35, 0xe0, 0xf4, 0x00, 0x0f, 0xff, 0xe1, 0x00, 0xfc, 0x20, 0x02,
+    0xff, 0xe0, 0x0f, 0xfe, 0x01, 0x77, 0x69, 0x00, 0xc2, 0x38, 0xc0, 0x22, 0xff, 0xd4, 0x01, 0xff,
+    0xc9, 0x2f, 0xfe, 0x00, 0xfe, 0x10, 0x00, 0x10, 0x81, 0x08, 0x04, 0x5b, 0xe3, 0xbe, 0x01, 0x19,
+    0x28, 0x91, 0x00, 0x21, 0xdb, 0x0d, 0xc0, 0x01, 0xff, 0xfc, 0x20, 0x1f, 0x84, 0x00, 0x5f, 0xfc,
+    0x01, 0xff, 0xc0, 0x2e, 0xed, 0x20, 0x18, 0x47, 0x18, 0x04, 0x5f, 0xfa, 0x80, 0x3f, 0xf9, 0x25,
+    0xff, 0xc0, 0x1f, 0xc2, 0x00, 0x25, 0x20, 0x38, 0xf0, 0x1e, 0x25, 0x03, 0xf5, 0x03, 0xfd, 0x00,
+    0xff, 0xee, 0x00, 0x00, 0x22, 0x00, 0x07, 0x78, 0x00, 0x83, 0x80, 0x05, 0xe0, 0x00, 0xff, 0x40,
+    0x3f, 0xfd, 0x00, 0x01, 0x86, 0x00, 0xad, 0xa5, 0x01, 0x55, 0xab, 0x42, 0xbe, 0x75, 0xc2, 0x07,
+    0xfa, 0x01, 0xff, 0xf2, 0x00, 0x13, 0x00, 0x18, 0x56, 0x25, 0x62, 0x98, 0xb6, 0x8b, 0x47, 0x13,
+    0xf1, 0x81, 0xfe, 0x80, 0x7f, 0xfc, 0x80, 0x09, 0xff, 0xd8, 0xc0, 0x1f, 0x08, 0x1c, 0xd0, 0x07,
+    0x3f, 0x7d, 0x02, 0xa8, 0x03, 0xe5, 0x80, 0x90, 0x76, 0x07, 0x96, 0x05, 0x03, 0x0a, 0x00, 0x9b,
+    0x40, 0xc0, 0x2d, 0x60, 0x7f, 0xb0, 0x20, 0x0f, 0xf2, 0x01, 0x80, 0x7c, 0xb0, 0x12, 0x01, 0x9f,
+    0xbe, 0x81, 0x54, 0x01, 0xc2, 0x07, 0x34, 0x00, 0x00, 0x00, 0xff, 0xe0, 0xdf, 0x26, 0x30, 0x06,
+    0x34, 0x8b, 0x37, 0x00, 0xc7, 0xad, 0xfc, 0x20, 0x03, 0xff, 0x30, 0x00, 0x6f, 0xd8, 0x02, 0x90,
+    0x0f, 0xe2, 0x60, 0x0f, 0x84, 0x20, 0x40, 0x3c, 0x6c, 0x30, 0x01, 0xf4, 0x03, 0x10, 0x07, 0x86,
+    0x02, 0x40, 0x3e, 0x72, 0x45, 0x00, 0xfa, 0x40, 0x40, 0x3e, 0x44, 0x00, 0x7f, 0x48, 0x04, 0x00,
+    0x00, 0x91, 0x00, 0x1f, 0xd9, 0x68, 0x01, 0xfa, 0x0e, 0x00, 0x3f, 0xb3, 0x00, 0x1f, 0x15, 0x77,
+    0xe3, 0x00, 0x63, 0xd5, 0x10, 0x39, 0x90, 0x05, 0xc0, 0x7b, 0xd2, 0x0c, 0x80, 0x84, 0x1a, 0x42,
+    0xce, 0x1e, 0x06, 0x0a, 0x20, 0x15, 0x82, 0x87, 0x81, 0x80, 0x62, 0x01, 0x0f, 0x03, 0x00, 0xc4,
+    0x02, 0x06, 0x08, 0x01, 0xac, 0x14, 0x10, 0x86, 0xc8, 0x59, 0xc3, 0x80, 0x1c, 0x09, 0xbd, 0x20,
+    0xca, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x00, 0x00, 0xe2, 0x52, 0x00, 0xfd, 0xd6, 0x60, 0x1f,
+    0x21, 0xe8, 0x80, 0x7c, 0x9e, 0x60, 0x1e, 0x2a, 0xef, 0xc6, 0x00, 0xc7, 0xaa, 0x20, 0x73, 0x20,
+    0x0b, 0x80, 0xf7, 0xa4, 0x19, 0x01, 0x08, 0x34, 0x85, 0x9c, 0x3c, 0x0c, 0x14, 0x40, 0x2b, 0x05,
+    0x0f, 0x03, 0x00, 0xc4, 0x02, 0x1e, 0x06, 0x01, 0x88, 0x04, 0x0c, 0x10, 0x03, 0x58, 0x28, 0x21,
+    0x0d, 0x90, 0xb3, 0x87, 0x00, 0x38, 0x13, 0x7a, 0x41, 0x94, 0x00, 0x7a, 0xa2, 0x07, 0x32, 0x00,
+    0x00, 0x00, 0xcd, 0x02, 0x01, 0xf2, 0x4b, 0x50, 0x07, 0xd4, 0xba, 0x8c, 0x01, 0xee, 0xa3, 0xf6,
+    0x00, 0xe2, 0xae, 0xfc, 0x60, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a, 0x41, 0x90,
+    0x10, 0x83, 0x48, 0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c, 0x40, 0x21,
+    0xe0, 0x60, 0x18, 0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38, 0x70, 0x03,
+    0x81, 0x37, 0xa4, 0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x00, 0x00, 0xff, 0xe1, 0x67, 0xfc,
+    0xc0, 0x1e, 0xfc, 0xc6, 0xb0, 0x07, 0x8c, 0xe2, 0x00, 0xf1, 0x57, 0x7e, 0x30, 0x06, 0x3d, 0x51,
+    0x03, 0x99, 0x00, 0x5c, 0x07, 0xbd, 0x20, 0xc8, 0x08, 0x41, 0xa4, 0x2c, 0xe1, 0xe0, 0x60, 0xa2,
+    0x01, 0x58, 0x28, 0x78, 0x18, 0x06, 0x20, 0x10, 0xf0, 0x30, 0x0c, 0x40, 0x20, 0x60, 0x80, 0x1a,
+    0xc1, 0x41, 0x08, 0x6c, 0x85, 0x9c, 0x38, 0x01, 0xc0, 0x9b, 0xd2, 0x0c, 0xa0, 0x03, 0xd5, 0x10,
+    0x39, 0x90, 0x00, 0x00, 0x8c, 0x40, 0xc4, 0x03, 0x93, 0x29, 0x33, 0x40, 0x39, 0x84, 0xd8, 0x54,
+    0x03, 0x8b, 0xa0, 0xba, 0x40, 0x38, 0xab, 0xbf, 0x18, 0x03, 0x1e, 0xa8, 0x81, 0xcc, 0x80, 0x2e,
+    0x03, 0xde, 0x90, 0x64, 0x04, 0x20, 0xd2, 0x16, 0x70, 0xf0, 0x30, 0x51, 0x00, 0xac, 0x14, 0x3c,
+    0x0c, 0x03, 0x10, 0x08, 0x78, 0x18, 0x06, 0x20, 0x10, 0x30, 0x40, 0x0d, 0x60, 0xa0, 0x84, 0x36,
+    0x42, 0xce, 0x1c, 0x00, 0xe0, 0x4d, 0xe9, 0x06, 0x50, 0x01, 0xea, 0x88, 0x1c, 0xc8, 0x00, 0x00,
+    0x01, 0x00, 0xf3, 0xe0, 0x80, 0x32, 0x43, 0x8b, 0x06, 0xcd, 0x42, 0x54, 0xb9, 0x0f, 0x00, 0x14,
+    0x20, 0x0d, 0x00, 0x9c, 0x40, 0x16, 0x00, 0x68, 0x1c, 0x25, 0x90, 0xc0, 0xd3, 0xc2, 0x50, 0xac,
+    0x30, 0x1f, 0xd0, 0x00, 0x00, 0xfe, 0x10, 0x08, 0xab, 0xbf, 0x1a, 0xb0, 0x00, 0x7a, 0xa2, 0x07,
+    0x2a, 0xa0, 0x07, 0x01, 0xef, 0x18, 0x03, 0x41, 0x08, 0x34, 0x8c, 0xc0, 0x0e, 0x03, 0x05, 0x11,
+    0x60, 0xd0, 0x28, 0x78, 0x18, 0x68, 0xd2, 0x00, 0x87, 0x81, 0xc9, 0xca, 0x10, 0x08, 0x18, 0x2b,
+    0x34, 0x16, 0x0a, 0x08, 0x01, 0x58, 0xb3, 0x87, 0x01, 0x00, 0x5b, 0xd2, 0x0c, 0xa0, 0x81, 0x4a,
+    0x20, 0x73, 0x20, 0x03, 0x6a, 0xd7, 0x7e, 0x30, 0x04, 0x00, 0x00, 0x0a, 0x98, 0x07, 0xc3, 0x3a,
+    0x01, 0xfb, 0x81, 0xc0, 0x3e, 0x2e, 0x70, 0x0c, 0x9f, 0x80, 0x1b, 0xfc, 0x40, 0x1f, 0xff, 0x07,
+    0x02, 0x00, 0x84, 0x00, 0x66, 0x01, 0x80, 0x1b, 0x02, 0x10, 0x80, 0x7f, 0xe5, 0x09, 0x00, 0x3d,
+    0x18, 0x01, 0x31, 0x00, 0x00, 0xe3, 0x50, 0x0f, 0x8b, 0x3c, 0x03, 0xeb, 0x2a, 0x00, 0xfa, 0x74,
+    0x03, 0x27, 0xe0, 0x06, 0xff, 0x10, 0x07, 0xff, 0xc1, 0xc0, 0x80, 0x21, 0x00, 0x19, 0x80, 0x60,
+    0x06, 0xc0, 0x84, 0x20, 0x1f, 0xf9, 0x42, 0x40, 0x0f, 0x46, 0x00, 0x4c, 0x40, 0x00, 0x00, 0xce,
+    0xe0, 0x0f, 0xa2, 0x61, 0x80, 0x38, 0xde, 0xde, 0x48, 0x03, 0x1f, 0xac, 0x79, 0x00, 0x13, 0xf0,
+    0x03, 0x7f, 0x88, 0x03, 0xff, 0xe0, 0xe0, 0x40, 0x10, 0x80, 0x0c, 0xc0, 0x30, 0x03, 0x60, 0x42,
+    0x10, 0x0f, 0xfc, 0xa1, 0x20, 0x07, 0xa3, 0x00, 0x26, 0x20, 0x00, 0x00, 0x8c, 0x00, 0x60, 0x1d,
+    0x38, 0xd1, 0x8e, 0x01, 0xbc, 0x0b, 0x80, 0xc0, 0x33, 0x7a, 0x37, 0xa0, 0x01, 0x3f, 0x00, 0x37,
+    0xf8, 0x80, 0x3f, 0xfe, 0x0e, 0x04, 0x01, 0x08, 0x00, 0xcc, 0x03, 0x00, 0x36, 0x04, 0x21, 0x00,
+    0xff, 0xca, 0x12, 0x00, 0x7a, 0x30, 0x02, 0x62, 0x00, 0x00, 0xe4, 0x40, 0x07, 0xc7, 0x78, 0x01,
+    0xf4, 0x1c, 0x00, 0x7d, 0x78, 0x01, 0xab, 0xec, 0x02, 0x1f, 0xf2, 0xc0, 0x22, 0x00, 0x12, 0x06,
+    0xa4, 0xc1, 0x00, 0x2e, 0x1e, 0x00, 0x80, 0x34, 0x80, 0x43, 0x00, 0x0c, 0x04, 0xb0, 0x48, 0x06,
+    0x71, 0x20, 0x52, 0x00, 0xe8, 0x00, 0x40, 0x07, 0x90, 0x04, 0x80, 0x3f, 0xfa, 0xa0, 0x4f, 0xc0,
+    0x0f, 0xfe, 0x29, 0xff, 0xb5, 0xc0, 0x39, 0x0c, 0xa2, 0x00, 0x11, 0xde, 0x68, 0x38, 0x07, 0x88,
+    0x40, 0x3e, 0x61, 0x10, 0x04, 0x7f, 0xe9, 0x0b, 0x00, 0xc8, 0x86, 0xc5, 0x00, 0x8e, 0xed, 0x26,
+    0x01, 0xff, 0x00, 0x01, 0xae, 0xfd, 0x60, 0x0b, 0x54, 0x44, 0x52, 0xc0, 0x46, 0x1d, 0xc7, 0x0d,
+    0x01, 0x03, 0x10, 0xe0, 0x20, 0x0e, 0xb9, 0x38, 0x00, 0xc2, 0x80, 0x6c, 0x01, 0x87, 0xf0, 0x60,
+    0x80, 0x38, 0xd0, 0x10, 0x03, 0xce, 0x06, 0x01, 0x0e, 0x71, 0x02, 0x00, 0x63, 0x13, 0xc1, 0x00,
+    0x02, 0xfb, 0x00, 0xe2, 0x94, 0x30, 0x0e, 0x6b, 0x10, 0x0c, 0x77, 0x6c, 0xa1, 0x00, 0x6a, 0x20,
+    0x96, 0x80, 0x92, 0x6f, 0x01, 0x00, 0xa3, 0xaf, 0x80, 0x23, 0xd7, 0x19, 0x00, 0xac, 0x26, 0x98,
+    0x02, 0xe0, 0xb9, 0xc0, 0x09, 0x98, 0x4f, 0x00, 0x10, 0x00, 0x87, 0xf0, 0x03, 0xa4, 0x78, 0x03,
+    0xb3, 0x04, 0x01, 0x1d, 0xdb, 0x28, 0x40, 0x1a, 0x88, 0x25, 0xa0, 0x24, 0x9b, 0xc0, 0x40, 0x28,
+    0xeb, 0xe0, 0x08, 0xf5, 0xc6, 0x40, 0x2b, 0x09, 0xa6, 0x00, 0xb8, 0x2e, 0x70, 0x02, 0x66, 0x13,
+    0xc0, 0x04, 0x00, 0x00, 0x2f, 0xf0, 0x80, 0x45, 0x52, 0x5a, 0x01, 0x1e, 0xb6, 0x70, 0x04, 0x53,
+    0xfd, 0x02, 0x00, 0xd4, 0x41, 0x2d, 0x01, 0x24, 0xde, 0x02, 0x01, 0x47, 0x5f, 0x00, 0x47, 0xae,
+    0x32, 0x01, 0x58, 0x4d, 0x30, 0x05, 0xc1, 0x73, 0x80, 0x13, 0x30, 0x9e, 0x00, 0x20, 0x01, 0xdc,
+    0x2f, 0x20, 0x03, 0x0a, 0x69, 0x90, 0x01, 0xb6, 0x3b, 0x00, 0x22, 0xaf, 0xf5, 0x08, 0x03, 0x51,
+    0x04, 0xb4, 0x04, 0x93, 0x78, 0x08, 0x05, 0x1d, 0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34,
+    0xc0, 0x17, 0x05, 0xce, 0x00, 0x4c, 0xc2, 0x78, 0x00, 0x80, 0x08, 0xe3, 0x7e, 0x30, 0x01, 0x8b,
+    0x68, 0xb0, 0x02, 0xb1, 0x6a, 0xd4, 0x00, 0x51, 0xfd, 0xc1, 0x00, 0x6a, 0x20, 0x96, 0x80, 0x92,
+    0x6f, 0x01, 0x00, 0xa3, 0xaf, 0x80, 0x23, 0xd7, 0x19, 0x00, 0xac, 0x26, 0x98, 0x02, 0xe0, 0xb9,
+    0xc0, 0x09, 0x98, 0x4f, 0x00, 0x10, 0x00, 0x37, 0x69, 0x00, 0x6b, 0xb3, 0xd0, 0x06, 0xba, 0x7a,
+    0x00, 0xcd, 0xfa, 0x40, 0x11, 0xdf, 0xf5, 0x08, 0x03, 0x51, 0x04, 0xb4, 0x04, 0x93, 0x78, 0x08,
+    0x05, 0x1d, 0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34, 0xc0, 0x17, 0x05, 0xce, 0x00, 0x4c,
+    0xc2, 0x78, 0x00, 0x80, 0x03, 0xcf, 0xe7, 0x3d, 0xfd, 0x50, 0x00, 0xe1, 0xa1, 0x46, 0x1a, 0x9d,
+    0x28, 0x02, 0x2e, 0xda, 0x00, 0xcb, 0xc0, 0x80, 0x11, 0x4f, 0xf0, 0x03, 0x7b, 0x40, 0x81, 0x24,
+    0x2a, 0xc0, 0x17, 0x7c, 0x18, 0x16, 0xac, 0x00, 0x74, 0x5f, 0xd0, 0xd0, 0x8a, 0xc1, 0x0d, 0x9c,
+    0x4f, 0x05, 0x70, 0x52, 0xcb, 0x36, 0x09, 0x60, 0x00, 0x01, 0xae, 0xfa, 0x10, 0x06, 0x28, 0x12,
+    0xe0, 0x29, 0x1f, 0x69, 0x92, 0x68, 0x58, 0x03, 0x3d, 0x04, 0x03, 0x84, 0x30, 0x2c, 0x01, 0x9c,
+    0x8a, 0x47, 0xda, 0x64, 0x81, 0x8a, 0x24, 0xb8, 0x00, 0x1a, 0x74, 0x81, 0x00, 0xd2, 0x30, 0x01,
+    0xda, 0x9e, 0x00, 0x00, 0x01, 0xec, 0x00, 0xe1, 0xa3, 0x50, 0x0e, 0x4b, 0x60, 0x0c, 0x35, 0x7b,
+    0x42, 0x00, 0xc5, 0x42, 0x5c, 0x05, 0x26, 0xad, 0x52, 0x4d, 0x06, 0xee, 0x28, 0x18, 0x01, 0xae,
+    0xf2, 0xe8, 0x12, 0x20, 0xfc, 0x54, 0x93, 0x2e, 0x18, 0xc3, 0x14, 0xd1, 0x70, 0x00, 0x00, 0xdd,
+    0xa0, 0x1c, 0xe3, 0xc0, 0x1c, 0x98, 0x60, 0x10, 0xd6, 0x6d, 0x08, 0x03, 0x15, 0x09, 0x70, 0x14,
+    0x9a, 0xb5, 0x49, 0x34, 0x1b, 0xb8, 0xa0, 0x60, 0x06, 0xbb, 0xcb, 0xa0, 0x48, 0x83, 0xf1, 0x52,
+    0x4c, 0xb8, 0x63, 0x0c, 0x53, 0x45, 0xc0, 0x00, 0x00, 0x27, 0xf8, 0x80, 0x21, 0xa7, 0x5f, 0x00,
+    0xd9, 0x15, 0xe0, 0x1a, 0x3f, 0xa0, 0x40, 0x18, 0xa8, 0x4b, 0x80, 0xa4, 0xd5, 0xaa, 0x49, 0xa0,
+    0xdd, 0xc5, 0x03, 0x00, 0x35, 0xde, 0x5d, 0x02, 0x44, 0x1f, 0x8a, 0x92, 0x65, 0xc3, 0x18, 0x62,
+    0x9a, 0x2e, 0x00, 0x06, 0xf4, 0x6f, 0x40, 0x07, 0x81, 0x70, 0x18, 0x02, 0x6d, 0xa2, 0xdc, 0x00,
+    0x3d, 0xfd, 0xc1, 0x00, 0x62, 0xa1, 0x2e, 0x02, 0x93, 0x56, 0xa9, 0x26, 0x83, 0x77, 0x14, 0x0c,
+    0x00, 0xd7, 0x79, 0x74, 0x09, 0x10, 0x7e, 0x2a, 0x49, 0x97, 0x0c, 0x61, 0x8a, 0x68, 0xb8, 0x00,
+    0x4f, 0x90, 0x47, 0x61, 0x08, 0xb3, 0x04, 0xb9, 0x00, 0xff, 0xe8, 0x00, 0x02, 0xfa, 0x00, 0x41,
+    0x58, 0x03, 0xbc, 0x41, 0x2e, 0x40, 0x3f, 0xfb, 0x20, 0x08, 0xfd, 0x10, 0x57, 0xb1, 0xa0, 0x5f,
+    0x4c, 0xb0, 0x02, 0x7d, 0x80, 0x7f, 0xf8, 0x00, 0xae, 0x19, 0xe2, 0x61, 0x25, 0x11, 0x6e, 0x1e,
+    0xe1, 0x8b, 0xfd, 0x18, 0x07, 0xff, 0x7c, 0x03, 0xb4, 0x05, 0x20, 0x01, 0x05, 0xf4, 0x80, 0x71,
+    0x0b, 0x90, 0x00, 0xb7, 0x52, 0x8e, 0x00, 0x1a, 0xfd, 0x38, 0x00, 0x61, 0xb1, 0x98, 0x15, 0x85,
+    0xa6, 0x1c, 0x37, 0xc3, 0x00, 0x18, 0x04, 0x20, 0x60, 0x18, 0xf4, 0x28, 0x01, 0xc1, 0x8a, 0x47,
+    0xba, 0x52, 0x50, 0xc5, 0x23, 0x5c, 0x00, 0x00, 0x5e, 0xa6, 0x30, 0x00, 0x92, 0xec, 0x6e, 0x00,
+    0x2d, 0x6f, 0xe1, 0x04, 0xf9, 0x8f, 0xf3, 0x00, 0x48, 0xc4, 0x32, 0x40, 0x01, 0xed, 0x40, 0x40,
+    0x01, 0x00, 0x0c, 0x04, 0x00, 0xe0, 0x1f, 0xfd, 0x10, 0x00, 0x6f, 0x00, 0x7b, 0x85, 0xc0, 0x38,
+    0xf1, 0x00, 0x30, 0xd6, 0xe5, 0x90, 0x03, 0x14, 0x05, 0x30, 0x54, 0x89, 0xdc, 0x41, 0x6d, 0x0a,
+    0x00, 0x70, 0x68, 0x80, 0x7d, 0x81, 0x60, 0x0e, 0x0d, 0x52, 0x3e, 0xd4, 0x16, 0x0c, 0x50, 0x24,
+    0xc1, 0x00, 0x00, 0xd9, 0xc2, 0x01, 0x94, 0xe8, 0x40, 0x33, 0x62, 0x00, 0x43, 0x5b, 0x96, 0x40,
+    0x0c, 0x50, 0x14, 0xc1, 0x52, 0x27, 0x71, 0x05, 0xb4, 0x28, 0x01, 0xc1, 0xa2, 0x01, 0xf6, 0x05,
+    0x80, 0x38, 0x35, 0x48, 0xfb, 0x50, 0x58, 0x31, 0x40, 0x93, 0x04, 0x00, 0x17, 0xf9, 0x00, 0x37,
+    0xab, 0xd0, 0x80, 0x5f, 0x51, 0x80, 0x10, 0xc7, 0x7c, 0x98, 0x03, 0x14, 0x05, 0x30, 0x54, 0x89,
+    0xdc, 0x41, 0x6d, 0x0a, 0x00, 0x70, 0x68, 0x80, 0x7d, 0x81, 0x60, 0x0e, 0x0d, 0x52, 0x3e, 0xd4,
+    0x16, 0x0c, 0x50, 0x24, 0xc1, 0x00, 0x00, 0x5e, 0x9e, 0x28, 0x00, 0xd2, 0xf0, 0x90, 0x00, 0x7a,
+    0xdf, 0xe1, 0x00, 0x0c, 0x77, 0xd1, 0x00, 0x31, 0x40, 0x53, 0x05, 0x48, 0x9d, 0xc4, 0x16, 0xd0,
+    0xa0, 0x07, 0x06, 0x88, 0x07, 0xd8, 0x16, 0x00, 0xe0, 0xd5, 0x23, 0xed, 0x41, 0x60, 0xc5, 0x02,
+    0x4c, 0x10, 0x04, 0xf6, 0x4f, 0x60, 0x01, 0x87, 0x10, 0x78, 0x01, 0xee, 0x1a, 0xe4, 0x00, 0x3d,
+    0xcf, 0xf1, 0x00, 0x31, 0x40, 0x53, 0x05, 0x48, 0x9d, 0xc4, 0x16, 0xd0, 0xa0, 0x07, 0x06, 0x88,
+    0x07, 0xd8, 0x16, 0x00, 0xe0, 0xd5, 0x23, 0xed, 0x41, 0x60, 0xc5, 0x02, 0x4c, 0x10, 0x00, 0x0b,
+    0x90, 0x07, 0x4c, 0x40, 0x03, 0xb0, 0x30, 0x03, 0x93, 0xd8, 0x02, 0xdf, 0xff, 0x03, 0x99, 0xf8,
+    0x2b, 0x36, 0xf7, 0x30, 0x01, 0x4c, 0x58, 0x07, 0x60, 0x60, 0x04, 0x00, 0x00, 0xfe, 0x1a, 0xef,
+    0xbb, 0x40, 0x62, 0x80, 0xa2, 0x29, 0x48, 0x9d, 0x40, 0x05, 0xd0, 0xa2, 0xa6, 0x0d, 0x10, 0xec,
+    0x8c, 0x00, 0x60, 0x33, 0x5c, 0x1a, 0xa0, 0x06, 0xd4, 0x16, 0x61, 0x28, 0x12, 0x60, 0xb6, 0x57,
+    0x7d, 0x90, 0x00, 0x00, 0x6f, 0x00, 0x7b, 0xc5, 0xc0, 0x38, 0xb0, 0xc0, 0x24, 0xfb, 0x34, 0x8f,
+    0x70, 0x0f, 0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d, 0xe4, 0x01, 0x51, 0x02, 0xb8, 0x00,
+    0x00, 0xd9, 0xe4, 0x01, 0x90, 0xe8, 0x80, 0x33, 0xda, 0x80, 0x13, 0xec, 0xd2, 0x3d, 0xc0, 0x3f,
+    0xfa, 0x8e, 0x0a, 0x20, 0xa0, 0x03, 0x11, 0x77, 0x90, 0x05, 0x44, 0x0a, 0xe0, 0x00, 0x00, 0x17,
+    0xf9, 0x00, 0x21, 0xf6, 0x8b, 0x20, 0x00, 0xec, 0xbf, 0x90, 0x27, 0xd8, 0x02, 0x3d, 0xc0, 0x3f,
+    0xfa, 0x8e, 0x0a, 0x20, 0xa0, 0x03, 0x11, 0x77, 0x90, 0x05, 0x44, 0x0a, 0xe0, 0x00, 0x04, 0xf6,
+    0x3f, 0x70, 0x01, 0x07, 0xa8, 0x68, 0x01, 0xae, 0x5a, 0xe8, 0x13, 0xfc, 0x00, 0xcf, 0x70, 0x0f,
+    0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d, 0xe4, 0x01, 0x51, 0x02, 0xb8, 0x00, 0x00, 0x8b,
+    0xec, 0x03, 0xa0, 0x68, 0x03, 0xbb, 0x04, 0x01, 0x7e, 0xa8, 0x53, 0xef, 0xa1, 0xe0, 0x07, 0x05,
+    0x70, 0x50, 0x31, 0x32, 0x15, 0x04, 0xb0, 0xb0, 0x07, 0x86, 0xa0, 0x30, 0x01, 0x41, 0xcc, 0xc2,
+    0x01, 0x30, 0x85, 0x00, 0x6d, 0x00, 0x38, 0x06, 0x20, 0x41, 0x00, 0x0d, 0xc8, 0x70, 0x06, 0x40,
+    0x75, 0x00, 0x80, 0x4f, 0xb0, 0x0f, 0xfe, 0x64, 0xff, 0x30, 0x04, 0x8c, 0x43, 0x2a, 0x01, 0x6e,
+    0xa0, 0x24, 0x00, 0x84, 0x0c, 0x06, 0x01, 0xfe, 0x42, 0x06, 0x03, 0x00, 0xb7, 0x50, 0x12, 0x00,
+    0x47, 0x21, 0x85, 0x00, 0xa3, 0xf9, 0xc0, 0x3f, 0xf8, 0xa0, 0x09, 0xe2, 0x8e, 0x20, 0x02, 0x88,
+    0x8c, 0x58, 0x01, 0xb8, 0x75, 0x88, 0x17, 0xcc, 0x03, 0x5e, 0xfa, 0x1e, 0x00, 0x70, 0x57, 0x05,
+    0x03, 0x13, 0x21, 0x50, 0x4b, 0x0b, 0x00, 0x78, 0x6a, 0x03, 0x00, 0x14, 0x1c, 0xcc, 0x20, 0x13,
+    0x08, 0x50, 0x06, 0xd0, 0x03, 0x80, 0x62, 0x04, 0x10, 0x00, 0xdc, 0x87, 0x00, 0x64, 0x07, 0x50,
+    0x08, 0x00, 0x84, 0x70, 0x07, 0xbb, 0xb0, 0x07, 0xae, 0xf0, 0x07, 0x91, 0x30, 0x07, 0xa3, 0xfd,
+    0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80, 0xa0, 0x19, 0x43,
+    0x30, 0x16, 0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50, 0x05, 0x81, 0xff,
+    0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0, 0x0c, 0xe1, 0x40,
+    0x00, 0x08, 0xe0, 0x08, 0xbb, 0xac, 0x00, 0x8a, 0xee, 0xe0, 0x0c, 0x89, 0x18, 0x04, 0x77, 0xfd,
+    0x42, 0x00, 0xd4, 0x41, 0x2d, 0x01, 0x24, 0xde, 0x02, 0x01, 0x47, 0x5f, 0x00, 0x47, 0xae, 0x32,
+    0x01, 0x58, 0x4d, 0x30, 0x05, 0xc1, 0x73, 0x80, 0x13, 0x30, 0x9e, 0x00, 0x20, 0x00, 0x13, 0x80,
+    0x1c, 0x80, 0x3a, 0x0c, 0xd0, 0x01, 0xc5, 0x19, 0x88, 0x20, 0x0e, 0x7e, 0xe3, 0x80, 0x7a, 0x3b,
+    0x90, 0x01, 0xe5, 0x00, 0x28, 0x07, 0x11, 0x04, 0x44, 0x40, 0x0d, 0x40, 0xe8, 0x0a, 0x01, 0x94,
+    0x33, 0x01, 0x60, 0x11, 0x10, 0x11, 0xc0, 0xc8, 0x00, 0xa0, 0x62, 0x22, 0x05, 0x00, 0x58, 0x1f,
+    0xf8, 0x82, 0xc0, 0x8c, 0x08, 0xb0, 0x18, 0xa8, 0x16, 0xee, 0x10, 0x7b, 0x0a, 0x00, 0xce, 0x14,
+    0x00, 0x06, 0xd1, 0x4f, 0x10, 0x03, 0x33, 0xae, 0x04, 0x02, 0xbd, 0xe7, 0x00, 0x8e, 0xf7, 0xe8,
+    0x40, 0x1a, 0x88, 0x25, 0xa0, 0x24, 0x9b, 0xc0, 0x40, 0x28, 0xeb, 0xe0, 0x08, 0xf5, 0xc6, 0x40,
+    0x2b, 0x09, 0xa6, 0x00, 0xb8, 0x2e, 0x70, 0x02, 0x66, 0x13, 0xc0, 0x04, 0x00, 0x00, 0xa3, 0xfd,
+    0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80, 0xa0, 0x19, 0x43,
+    0x30, 0x16, 0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50, 0x05, 0x81, 0xff,
+    0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0, 0x0c, 0xe1, 0x59,
+    0xee, 0x01, 0x88, 0x24, 0x03, 0xe4, 0x03, 0x00, 0xf9, 0x82, 0x00, 0x03, 0xbf, 0xea, 0x10, 0x06,
+    0xa2, 0x09, 0x68, 0x09, 0x26, 0xf0, 0x10, 0x0a, 0x3a, 0xf8, 0x02, 0x3d, 0x71, 0x90, 0x0a, 0xc2,
+    0x69, 0x80, 0x2e, 0x0b, 0x9c, 0x00, 0x99, 0x84, 0xf6, 0x01, 0xa7, 0xfb, 0x81, 0x40, 0x1c, 0xa1,
+    0xa0, 0x1d, 0x62, 0xe0, 0x00, 0x00, 0xe2, 0x52, 0x00, 0xfb, 0xe0, 0x80, 0x3c, 0xa5, 0xc0, 0x1f,
+    0x2f, 0x98, 0x07, 0x15, 0x77, 0xeb, 0x00, 0x47, 0x8a, 0x20, 0x53, 0x40, 0x0e, 0x13, 0xde, 0xa0,
+    0x54, 0x41, 0x06, 0x90, 0xab, 0x86, 0x98, 0x28, 0x80, 0x51, 0xf3, 0xe0, 0x60, 0x1f, 0x78, 0x18,
+    0x07, 0xc6, 0x08, 0x01, 0xa3, 0xe5, 0x08, 0x6c, 0x81, 0x5c, 0x30, 0x38, 0x13, 0x7e, 0x81, 0x54,
+    0x07, 0xaa, 0x20, 0x53, 0x40, 0x00, 0x00, 0xdb, 0xc2, 0x01, 0x94, 0xa8, 0x40, 0x33, 0x62, 0x00,
+    0x43, 0x5b, 0x94, 0x20, 0x0c, 0x50, 0x25, 0xc0, 0x52, 0x3e, 0xd3, 0x24, 0xd0, 0xb0, 0x06, 0x7a,
+    0x08, 0x07, 0x08, 0x60, 0x58, 0x03, 0x39, 0x14, 0x8f, 0xb4, 0xc9, 0x03, 0x14, 0x09, 0x70, 0x00,
+    0x00, 0xcc, 0xe2, 0x01, 0xe4, 0x99, 0x58, 0x07, 0x0d, 0x35, 0x2a, 0x80, 0x30, 0xf4, 0xa7, 0xa8,
+    0x06, 0x2a, 0xef, 0xd6, 0x00, 0x8f, 0x14, 0x40, 0xa6, 0x80, 0x1c, 0x27, 0xbd, 0x40, 0xa8, 0x82,
+    0x0d, 0x21, 0x57, 0x0d, 0x30, 0x51, 0x00, 0xa3, 0xe7, 0xc0, 0xc0, 0x3e, 0xf0, 0x30, 0x0f, 0x8c,
+    0x10, 0x03, 0x47, 0xca, 0x10, 0xd9, 0x02, 0xb8, 0x60, 0x70, 0x26, 0xfd, 0x02, 0xa8, 0x0f, 0x54,
+    0x40, 0xa6, 0x80, 0x00, 0x1f, 0xf8, 0xc0, 0x21, 0xd6, 0x66, 0x88, 0x05, 0x93, 0x2c, 0x00, 0xd1,
+    0xdf, 0x00, 0x16, 0x28, 0x12, 0xe0, 0x29, 0x1f, 0x69, 0x92, 0x68, 0x58, 0x03, 0x3d, 0x04, 0x03,
+    0x84, 0x30, 0x2c, 0x01, 0x9c, 0x8a, 0x47, 0xda, 0x64, 0x81, 0x8a, 0x04, 0xb8, 0x00, 0x00, 0xc2,
+    0x60, 0x1f, 0xb3, 0x06, 0x01, 0xf3, 0x88, 0x80, 0x3e, 0xae, 0x20, 0x0e, 0x2a, 0xef, 0xd6, 0x00,
+    0x8f, 0x14, 0x40, 0xa6, 0x80, 0x1c, 0x27, 0xbd, 0x40, 0xa8, 0x82, 0x0d, 0x21, 0x57, 0x0d, 0x30,
+    0x51, 0x00, 0xa3, 0xe7, 0xc0, 0xc0, 0x3e, 0xf0, 0x30, 0x0f, 0x8c, 0x10, 0x03, 0x47, 0xca, 0x10,
+    0xd9, 0x02, 0xb8, 0x60, 0x70, 0x26, 0xfd, 0x02, 0xa8, 0x0f, 0x54, 0x40, 0xa6, 0x80, 0x00, 0xb7,
+    0x40, 0x1c, 0x24, 0x41, 0x00, 0xc3, 0xba, 0x10, 0x08, 0x6b, 0x36, 0x84, 0x01, 0x8a, 0x04, 0xb8,
+    0x0a, 0x47, 0xda, 0x64, 0x9a, 0x16, 0x00, 0xcf, 0x41, 0x00, 0xe1, 0x0c, 0x0b, 0x00, 0x67, 0x22,
+    0x91, 0xf6, 0x99, 0x20, 0x62, 0x81, 0x2e, 0x00, 0x00, 0x0b, 0x98, 0x3a, 0x00, 0x61, 0xdd, 0x4c,
+    0x94, 0x03, 0xac, 0x1a, 0x84, 0x03, 0x87, 0xbd, 0x00, 0x38, 0xab, 0xbf, 0x58, 0x02, 0x3c, 0x51,
+    0x02, 0x9a, 0x00, 0x70, 0x9e, 0xf5, 0x02, 0xa2, 0x08, 0x34, 0x85, 0x5c, 0x34, 0xc1, 0x44, 0x02,
+    0x8f, 0x9f, 0x03, 0x00, 0xfb, 0xc0, 0xc0, 0x3e, 0x30, 0x40, 0x0d, 0x1f, 0x28, 0x43, 0x64, 0x0a,
+    0xe1, 0x81, 0xc0, 0x9b, 0xf4, 0x0a, 0xa0, 0x3d, 0x51, 0x02, 0x9a, 0x00, 0x02, 0xf7, 0x77, 0x90,
+    0x00, 0xae, 0x21, 0x44, 0x01, 0x26, 0xe9, 0x40, 0x21, 0xac, 0xda, 0x10, 0x06, 0x28, 0x12, 0xe8,
+    0x29, 0x1f, 0x69, 0x99, 0x34, 0x2c, 0x01, 0xb8, 0xa2, 0x01, 0x84, 0xc7, 0x02, 0xc0, 0x19, 0xea,
+    0xa2, 0x3e, 0xd3, 0x15, 0x0c, 0x50, 0x24, 0xc0, 0x00, 0x02, 0x82, 0x24, 0x10, 0x06, 0x24, 0x9e,
+    0x42, 0x00, 0xee, 0x43, 0xe0, 0x0f, 0x17, 0xf8, 0x80, 0x31, 0xff, 0xed, 0x81, 0x00, 0xe1, 0x02,
+    0x7c, 0x10, 0x08, 0xbb, 0xf4, 0x89, 0x40, 0x1e, 0x2f, 0x04, 0x10, 0x0f, 0x11, 0x01, 0x40, 0x3e,
+    0x10, 0x10, 0x0f, 0x84, 0x04, 0x03, 0xc4, 0x40, 0x50, 0x0e, 0x2e, 0x04, 0x10, 0x01, 0x77, 0xe9,
+    0x8d, 0x00, 0x61, 0x02, 0x7f, 0x10, 0x00, 0x00, 0xfc, 0xda, 0x01, 0xe5, 0xfa, 0x13, 0x00, 0xff,
+    0x10, 0x07, 0xf3, 0xe0, 0x00, 0xb3, 0xf0, 0x80, 0x3d, 0x86, 0x25, 0x00, 0x1c, 0xc2, 0x7d, 0xc4,
+    0x00, 0xef, 0x0b, 0x00, 0x70, 0x07, 0xff, 0x13, 0xc2, 0xc0, 0x1c, 0x01, 0xce, 0x27, 0xdc, 0x40,
+    0x0e, 0x1d, 0x31, 0x28, 0x00, 0xe0, 0x09, 0xff, 0xd8, 0xc0, 0x1f, 0x08, 0x1c, 0xd0, 0x07, 0x3f,
+    0x7d, 0x02, 0xa8, 0x03, 0xe5, 0x80, 0x90, 0x76, 0x07, 0x96, 0x05, 0x03, 0x0a, 0x00, 0x9b, 0x40,
+    0xc0, 0x2d, 0x60, 0x7f, 0xb0, 0x20, 0x0f, 0xf2, 0x01, 0x80, 0x7c, 0xb0, 0x12, 0x01, 0x9f, 0xbe,
+    0x81, 0x54, 0x01, 0xc2, 0x07, 0x34, 0x00, 0x00, 0x00, 0xc2, 0xff, 0x60, 0x1a, 0x7a, 0x01, 0x28,
+    0x02, 0xbb, 0x28, 0x0c, 0x01, 0x66, 0xc6, 0x82, 0x10, 0x61, 0x89, 0x40, 0x04, 0xc2, 0x7d, 0xc4,
+    0x00, 0xbc, 0x2c, 0x01, 0xc0, 0x1f, 0xfc, 0x0f, 0x0b, 0x00, 0x70, 0x04, 0xe2, 0x7d, 0xc4, 0x00,
+    0x87, 0x4c, 0x4a, 0x00, 0x20, 0x00, 0x84, 0x60, 0x0e, 0x9e, 0xe9, 0x80, 0x35, 0xde, 0x70, 0x0c,
+    0x48, 0x90, 0x80, 0x0f, 0xff, 0xe1, 0x00, 0xfc, 0x20, 0x02, 0xff, 0xe0, 0x0f, 0xfe, 0x01, 0x77,
+    0x69, 0x00, 0xc2, 0x38, 0xc0, 0x22, 0xff, 0xd4, 0x01, 0xff, 0xc9, 0x2f, 0xfe, 0x00, 0xfe, 0x10,
+    0x00, 0x08, 0xe0, 0x0d, 0xdd, 0x78, 0x06, 0xbb, 0xa8, 0x03, 0x22, 0x60, 0x08, 0x6b, 0xfa, 0x84,
+    0x01, 0x8a, 0x84, 0xb8, 0x0a, 0x4d, 0x5a, 0xa4, 0x9a, 0x0d, 0xdc, 0x50, 0x30, 0x03, 0x5d, 0xe5,
+    0xd0, 0x24, 0x41, 0xf8, 0xa9, 0x26, 0x5c, 0x31, 0x86, 0x29, 0xa2, 0xe0, 0x00, 0x00, 0x39, 0x02,
+    0x28, 0x06, 0xbb, 0x0c, 0x68, 0x06, 0xe7, 0xe1, 0x80, 0x0c, 0x5d, 0xba, 0x00, 0x8f, 0xfe, 0xdf,
+    0xf8, 0x40, 0x3f, 0x08, 0x00, 0xbf, 0xf8, 0x03, 0xff, 0x80, 0x5d, 0xda, 0x40, 0x30, 0x8e, 0x30,
+    0x08, 0xbf, 0xf5, 0x00, 0x7f, 0xf2, 0x4b, 0xff, 0x80, 0x3f, 0x84, 0x05, 0xe1, 0x2f, 0x20, 0x02,
+    0xa7, 0x6b, 0x90, 0x05, 0x5d, 0xc8, 0x00, 0x86, 0xbb, 0xe8, 0x40, 0x18, 0xa8, 0x4b, 0x80, 0xa4,
+    0xd5, 0xaa, 0x49, 0xa0, 0xdd, 0xc5, 0x03, 0x00, 0x35, 0xde, 0x5d, 0x02, 0x44, 0x1f, 0x8a, 0x92,
+    0x65, 0xc3, 0x18, 0x62, 0x9a, 0x2e, 0x00, 0x00, 0xc8, 0x01, 0xf5, 0x5b, 0x80, 0x7b, 0x40, 0xc0,
+    0x3c, 0xfe, 0x80, 0x11, 0xff, 0xfc, 0x20, 0x1f, 0x84, 0x00, 0x5f, 0xfc, 0x01, 0xff, 0xc0, 0x2e,
+    0xed, 0x20, 0x18, 0x47, 0x18, 0x04, 0x5f, 0xfa, 0x80, 0x3f, 0xf9, 0x25, 0xff, 0xc0, 0x1f, 0xc2,
+    0x00, 0x00, 0x0e, 0xe0, 0x07, 0x19, 0x18, 0x07, 0x16, 0x68, 0x06, 0x1a, 0xcc, 0x50, 0x80, 0x31,
+    0x50, 0x97, 0x01, 0x49, 0xab, 0x54, 0x93, 0x41, 0xbb, 0x8a, 0x06, 0x00, 0x6b, 0xbc, 0xba, 0x04,
+    0x88, 0x3f, 0x15, 0x24, 0xcb, 0x86, 0x30, 0xc5, 0x34, 0x5c, 0x00, 0x3f, 0xff, 0x84, 0x03, 0xf0,
+    0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd, 0xa4, 0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50,
+    0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x4f, 0xff, 0x40, 0x38, 0x80, 0x75, 0x00, 0x7e, 0xb1,
+    0x71, 0x00, 0x01, 0xaf, 0xea, 0x10, 0x06, 0x2a, 0x12, 0xe0, 0x29, 0x35, 0x6a, 0x92, 0x68, 0x37,
+    0x71, 0x40, 0xc0, 0x0d, 0x77, 0x97, 0x40, 0x91, 0x07, 0x0e, 0xa4, 0x99, 0x70, 0x68, 0x18, 0xa6,
+    0x80, 0xa2, 0x03, 0x5e, 0x81, 0x60, 0x1c, 0x80, 0xe0, 0x1c, 0xe1, 0x00, 0x00, 0x00, 0x3a, 0x83,
+    0x28, 0x06, 0x1a, 0x89, 0x60, 0x0c, 0xc8, 0xee, 0x30, 0x0e, 0xbf, 0x80, 0x08, 0xff, 0xfe, 0x10,
+    0x0f, 0xc2, 0x00, 0x2f, 0xfe, 0x00, 0xff, 0xe0, 0x17, 0x76, 0x90, 0x0c, 0x23, 0x8c, 0x02, 0x2f,
+    0xfd, 0x40, 0x1f, 0xfc, 0x92, 0xff, 0xe0, 0x0f, 0xe1, 0x00, 0x03, 0xf6, 0x8e, 0x10, 0x01, 0xcc,
+    0x9e, 0x84, 0x02, 0x6d, 0xe4, 0x00, 0x86, 0xb7, 0xe8, 0x40, 0x18, 0xa8, 0x4b, 0x80, 0xa4, 0xd5,
+    0xaa, 0x49, 0xa0, 0xdd, 0xc5, 0x03, 0x00, 0x35, 0xde, 0x5d, 0x02, 0x44, 0x1f, 0x8a, 0x92, 0x65,
+    0xc3, 0x18, 0x62, 0x9a, 0x2e, 0x00, 0x00, 0xcc, 0xe2, 0x01, 0xe5, 0x99, 0x58, 0x07, 0x0d, 0xb5,
+    0x2a, 0x80, 0x30, 0xf4, 0xa7, 0xa8, 0x06, 0x2a, 0xef, 0xd6, 0x00, 0x8f, 0x14, 0x40, 0xa6, 0xc0,
+    0x1c, 0x27, 0x9f, 0x40, 0x8a, 0x84, 0x1a, 0x60, 0xb2, 0x86, 0x60, 0x51, 0x00, 0x9a, 0xdb, 0xc0,
+    0xc0, 0x0f, 0xff, 0x67, 0x81, 0x80, 0x09, 0x0c, 0x00, 0x60, 0xa2, 0x0b, 0x76, 0x06, 0x42, 0x0a,
+    0x20, 0x49, 0x0f, 0x0e, 0x04, 0xdf, 0xb1, 0x55, 0x01, 0xea, 0x88, 0x14, 0x50, 0x00, 0x00, 0x1f,
+    0xf8, 0xc0, 0x21, 0xd6, 0x66, 0x88, 0x00, 0x72, 0x65, 0x80, 0x11, 0x77, 0xe2, 0xf5, 0x06, 0x18,
+    0x8a, 0x00, 0x0c, 0x27, 0xda, 0x80, 0x0f, 0x0b, 0x00, 0x70, 0x07, 0xfb, 0xc2, 0xc0, 0x1c, 0x00,
+    0x71, 0x3e, 0xd4, 0x00, 0x0e, 0x98, 0x8a, 0x00, 0x03, 0x75, 0xf9, 0xe0, 0x42, 0xb3, 0x94, 0xe1,
+    0x41, 0xe8, 0x4a, 0x76, 0x40, 0x00, 0x0c, 0x00, 0x14, 0xc0, 0x30, 0xbb, 0x0d, 0xb0, 0x07, 0x54,
+    0xf2, 0x28, 0x07, 0x2f, 0x6d, 0x00, 0x71, 0x57, 0xee, 0x98, 0x02, 0x3c, 0x51, 0x02, 0x9b, 0x00,
+    0x70, 0x9e, 0x7d, 0x02, 0x2a, 0x10, 0x69, 0x82, 0xca, 0x19, 0x81, 0x44, 0x02, 0x6b, 0x6f, 0x03,
+    0x00, 0x3f, 0xfd, 0x9e, 0x06, 0x00, 0x24, 0x30, 0x01, 0x82, 0x88, 0x2d, 0xd8, 0x19, 0x08, 0x28,
+    0x81, 0x24, 0x3c, 0x38, 0x13, 0x7e, 0xc5, 0x54, 0x07, 0xaa, 0x20, 0x51, 0x40, 0x00, 0x03, 0xf2,
+    0x27, 0xa0, 0x00, 0xdb, 0x74, 0xc8, 0x01, 0x4f, 0x72, 0x40, 0x22, 0xce, 0xd7, 0xfa, 0x0c, 0x31,
+    0x14, 0x00, 0x18, 0x4f, 0xb5, 0x00, 0x1e, 0x16, 0x00, 0xe0, 0x0f, 0xf7, 0x85, 0x80, 0x38, 0x00,
+    0xe2, 0x7d, 0xa8, 0x00, 0x1d, 0x31, 0x14, 0x00, 0x06, 0xeb, 0xf3, 0xc0, 0x85, 0x67, 0x29, 0xc2,
+    0x83, 0xd0, 0x94, 0xec, 0x80, 0x00, 0xc2, 0x60, 0x1f, 0xbf, 0x0c, 0x03, 0xe5, 0x11, 0x00, 0x7d,
+    0x7c, 0x40, 0x1c, 0x55, 0xdf, 0xac, 0x01, 0x1e, 0x28, 0x81, 0x4d, 0x80, 0x38, 0x4f, 0x3e, 0x81,
+    0x15, 0x08, 0x34, 0xc1, 0x65, 0x0c, 0xc0, 0xa2, 0x01, 0x35, 0xb7, 0x81, 0x80, 0x1f, 0xfe, 0xcf,
+    0x03, 0x00, 0x12, 0x18, 0x00, 0xc1, 0x44, 0x16, 0xec, 0x0c, 0x84, 0x14, 0x40, 0x92, 0x1e, 0x1c,
+    0x09, 0xbf, 0x62, 0xaa, 0x03, 0xd5, 0x10, 0x28, 0xa0, 0x00, 0x00, 0xb3, 0x40, 0x3c, 0x64, 0x20,
+    0x1d, 0xba, 0x10, 0x08, 0xb3, 0x79, 0xfe, 0x83, 0x0c, 0x45, 0x00, 0x06, 0x13, 0xed, 0x40, 0x07,
+    0x85, 0x80, 0x38, 0x03, 0xfd, 0xe1, 0x60, 0x0e, 0x00, 0x38, 0x9f, 0x6a, 0x00, 0x07, 0x4c, 0x45,
+    0x00, 0x01, 0xba, 0xfc, 0xf0, 0x21, 0x59, 0xca, 0x70, 0xa0, 0xf4, 0x25, 0x3b, 0x20, 0x00, 0x15,
+    0x77, 0xeb, 0x00, 0x47, 0x8a, 0x20, 0x53, 0x60, 0x0e, 0x13, 0xcf, 0xa0, 0x45, 0x42, 0x0d, 0x30,
+    0x59, 0x43, 0x30, 0x28, 0x80, 0x4d, 0x6d, 0xe0, 0x60, 0x07, 0xff, 0xb3, 0xc0, 0xc0, 0x04, 0x86,
+    0x00, 0x30, 0x51, 0x05, 0xbb, 0x03, 0x21, 0x05, 0x10, 0x24, 0x87, 0x87, 0x02, 0x6f, 0xd8, 0xaa,
+    0x80, 0xf5, 0x44, 0x0a, 0x28, 0x02, 0x2a, 0xef, 0xd7, 0x00, 0xf7, 0x70, 0x03, 0xe1, 0x13, 0x00,
+    0x7c, 0x4b, 0x20, 0x18, 0x00, 0xc6, 0x01, 0xe6, 0xc1, 0x00, 0xec, 0x21, 0x00, 0xe1, 0x60, 0x0f,
+    0x5d, 0x80, 0x31, 0x67, 0xe3, 0xfd, 0x06, 0x18, 0x8a, 0x00, 0x0c, 0x27, 0xda, 0x80, 0x0f, 0x0b,
+    0x00, 0x70, 0x07, 0xfb, 0xc2, 0xc0, 0x1c, 0x00, 0x71, 0x3e, 0xd4, 0x00, 0x0e, 0x98, 0x8a, 0x00,
+    0x03, 0x75, 0xf9, 0xe0, 0x42, 0xb3, 0x94, 0xe1, 0x41, 0xe8, 0x4a, 0x76, 0x40, 0x00, 0xce, 0xe0,
+    0x0f, 0x9e, 0x20, 0xe0, 0x1c, 0x51, 0x09, 0x83, 0x00, 0xc5, 0xee, 0xde, 0x60, 0x03, 0xfd, 0x00,
+    0xdb, 0xe8, 0x01, 0xff, 0xd4, 0x2f, 0xfc, 0x40, 0x1f, 0xfc, 0x22, 0xff, 0xc4, 0x01, 0xff, 0xde,
+    0x00, 0x02, 0x85, 0x00, 0xf7, 0x35, 0x18, 0x06, 0x73, 0xc4, 0xe0, 0x0c, 0xfe, 0x57, 0xa0, 0x1c,
+    0x9f, 0x60, 0x1f, 0xfc, 0xf7, 0xee, 0x30, 0x06, 0x48, 0x11, 0x49, 0x00, 0x6e, 0xf3, 0x04, 0x00,
+    0x8c, 0x41, 0x00, 0x40, 0x27, 0x00, 0xff, 0xea, 0x00, 0x0d, 0xf3, 0x00, 0x9f, 0xe8, 0x03, 0x38,
+    0x07, 0xd6, 0x41, 0x7f, 0xf4, 0x02, 0xcc, 0x84, 0x27, 0x32, 0x60, 0x4b, 0x23, 0x09, 0xcc, 0x98,
+    0x04, 0x80, 0x3f, 0xf8, 0x59, 0xff, 0x40, 0x07, 0xff, 0x8c, 0x05, 0xfd, 0x11, 0x00, 0x49, 0x40,
+    0x5d, 0xc0, 0x09, 0x5c, 0x01, 0x78, 0x01, 0x0e, 0x02, 0x1e, 0xf3, 0x00, 0x64, 0x81, 0x14, 0x90,
+    0x06, 0xef, 0x30, 0x40, 0x08, 0xc4, 0x10, 0x04, 0x02, 0x70, 0x0f, 0xfe, 0xa0, 0x00, 0xf0, 0xf6,
+    0x17, 0x8b, 0x12, 0x69, 0x8b, 0x6c, 0x76, 0x00, 0x97, 0xe0, 0x07, 0xff, 0xc8, 0x2e, 0xa3, 0xf0,
+    0xa5, 0x3c, 0x50, 0xaa, 0x4f, 0x50, 0x12, 0xfd, 0x00, 0x7f, 0xf8, 0x00, 0x01, 0x1c, 0x5d, 0xd6,
+    0x95, 0xdd, 0xe0, 0x89, 0x18, 0x1f, 0xe8, 0x07, 0xff, 0x9c, 0x01, 0x1c, 0x9d, 0xd5, 0x2d, 0xdd,
+    0x02, 0x17, 0xe6, 0x01, 0xff, 0xd7, 0x00, 0x45, 0x00, 0x40, 0x8a, 0xc5, 0x9c, 0x55, 0x3a, 0x6c,
+    0x01, 0x5b, 0xc8, 0x00, 0x3d, 0xc0, 0x0f, 0xff, 0x90, 0x8c, 0x06, 0xf0, 0x90, 0xf9, 0xa0, 0x1c,
+    0xdf, 0x50, 0x02, 0x6d, 0x80, 0x7f, 0xf8, 0x00, 0x03, 0xfd, 0x00, 0xff, 0xec, 0xb8, 0x18, 0x70,
+    0x58, 0x28, 0x18, 0x30, 0x58, 0x03, 0xe9, 0x06, 0x15, 0x05, 0xbd, 0x04, 0xba, 0x00, 0xff, 0xe6,
+    0x88, 0x38, 0x48, 0x79, 0x18, 0xb9, 0x28, 0xf8, 0x03, 0x13, 0xcc, 0x08, 0x9c, 0xba, 0x8f, 0xf4,
+    0x03, 0xff, 0xa4, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x48, 0x3f, 0xd0, 0x0e, 0x5f, 0xc0, 0x0f, 0xff,
+    0x80, 0x80, 0x7f, 0x7f, 0x00, 0x7f, 0x10, 0x18, 0x68, 0x28, 0x06, 0xa0, 0xcc, 0x38, 0x68, 0x06,
+    0x78, 0x23, 0x35, 0x20, 0x3e, 0x90, 0xbe, 0x16, 0x15, 0x05, 0x12, 0x5b, 0xd0, 0xcc, 0x1a, 0x5d,
+    0x07, 0xe1, 0x00, 0x7f, 0xf9, 0x53, 0xec, 0x0c, 0x03, 0xb0, 0x40, 0x80, 0x23, 0x1a, 0x00, 0x00,
+    0xe7, 0x70, 0x07, 0x9a, 0x26, 0x00, 0x30, 0xcb, 0xdb, 0x98, 0x04, 0x3f, 0x0b, 0xe6, 0x01, 0xdf,
+    0xe2, 0x00, 0xff, 0xf1, 0x09, 0x88, 0x07, 0xa3, 0x1c, 0x03, 0xdc, 0x18, 0x08, 0x00, 0x20, 0x60,
+    0x5f, 0xb0, 0x60, 0x00, 0xe1, 0x80, 0xbc, 0x80, 0x00, 0x08, 0xfd, 0x10, 0x57, 0xb1, 0xa0, 0x5f,
+    0x4c, 0xb0, 0x02, 0x7d, 0x80, 0x7f, 0xf8, 0x44, 0x03, 0x2d, 0x81, 0x80, 0x34, 0x52, 0x40, 0x00,
+    0x3f, 0xd0, 0x0a, 0x3f, 0x84, 0x03, 0x91, 0xc3, 0x44, 0x03, 0x15, 0x84, 0x98, 0x07, 0x78, 0x33,
+    0x00, 0x3a, 0x88, 0x92, 0x01, 0xc4, 0xa0, 0x42, 0x01, 0xe1, 0x40, 0xa0, 0x0f, 0x55, 0x01, 0x14,
+    0x03, 0x12, 0x0c, 0x85, 0x80, 0x7c, 0xc6, 0x32, 0x01, 0xf7, 0x83, 0x19, 0xbf, 0x40, 0x23, 0xff,
+    0x18, 0x04, 0x9f, 0x00, 0x1f, 0x18, 0x50, 0x07, 0xe7, 0x20, 0x0c, 0x00, 0x4f, 0xb0, 0x0f, 0xfe,
+    0x69, 0x7f, 0x90, 0x02, 0x1c, 0x09, 0x40, 0x03, 0xe8, 0xb3, 0x00, 0x23, 0x30, 0x48, 0x07, 0xce,
+    0x01, 0x8b, 0x02, 0x08, 0x02, 0x63, 0x70, 0xe0, 0x0e, 0x82, 0x37, 0x4f, 0xb0, 0x06, 0xfb, 0x80,
+    0x07, 0xec, 0x03, 0x94, 0x38, 0x03, 0x85, 0x54, 0x01, 0x00, 0x4f, 0xb0, 0x06, 0x7c, 0x00, 0x67,
+    0x32, 0x80, 0x08, 0xa0, 0x3c, 0x02, 0x5c, 0x08, 0x20, 0x08, 0x44, 0x02, 0x01, 0x92, 0xc2, 0x48,
+    0x03, 0x23, 0x07, 0x00, 0x74, 0x91, 0xc0, 0x00, 0x22, 0x00, 0x38, 0xef, 0x00, 0x3a, 0x0e, 0x00,
+    0x3a, 0xf0, 0x03, 0x8f, 0xf4, 0x03, 0xff, 0xf6, 0x5f, 0xf9, 0xc0, 0x3e, 0xf0, 0x00, 0x22, 0x00,
+    0x0b, 0x66, 0x00, 0x84, 0x70, 0x06, 0xd8, 0x01, 0x3e, 0xc0, 0x3f, 0xfd, 0x00, 0x3f, 0xd0, 0x0f,
+    0xff, 0xd9, 0x7f, 0xe7, 0x00, 0xfb, 0xcf, 0xff, 0xd0, 0x01, 0x7e, 0x00, 0x72, 0x04, 0x80, 0x79,
+    0x54, 0x01, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x92, 0x7d, 0xaf, 0xbe, 0x03, 0x0c, 0x08, 0x00, 0xd1,
+    0x60, 0x03, 0xfd, 0x01, 0x70, 0x0f, 0x98, 0x03, 0xd3, 0x40, 0x1f, 0xfe, 0x82, 0xff, 0xce, 0x01,
+    0xf7, 0x80, 0x00, 0x97, 0x45, 0x3e, 0xcc, 0x84, 0x03, 0x08, 0x06, 0x6e, 0x00, 0xff, 0xf2, 0x80,
+    0x3f, 0xe0, 0x0f, 0xfe, 0x69, 0x10, 0x03, 0x87, 0x74, 0x01, 0xc2, 0x46, 0x01, 0xed, 0xc0, 0x0f,
+    0xfe, 0x40, 0xff, 0xe7, 0x00, 0xfb, 0xc0, 0x4f, 0xb0, 0x0f, 0xfe, 0x62, 0xfa, 0x80, 0x58, 0x18,
+    0x01, 0x44, 0x40, 0x10, 0xb8, 0x80, 0x7f, 0xf1, 0x80, 0x0b, 0xf6, 0x00, 0xff, 0xe7, 0x0b, 0xd8,
+    0x07, 0xa2, 0x00, 0x1c, 0x80, 0x08, 0xb0, 0x0b, 0x80, 0x0e, 0xe0, 0x0f, 0xb8, 0x03, 0xb9, 0x00,
+    0x3f, 0xd3, 0xff, 0x80, 0x3f, 0xc0, 0x04, 0xfb, 0x00, 0xff, 0xe1, 0x33, 0x80, 0x45, 0x85, 0x60,
+    0x0b, 0x60, 0x02, 0x02, 0xd8, 0x04, 0x20, 0x1f, 0xfc, 0x20, 0x00, 0xe3, 0x51, 0x00, 0xfb, 0x64,
+    0x40, 0x3c, 0xe3, 0xc0, 0x1f, 0x3f, 0x90, 0x04, 0x7f, 0xe4, 0x00, 0xaf, 0xd8, 0x02, 0x90, 0x0f,
+    0xe2, 0x60, 0x0f, 0x84, 0x20, 0x40, 0x3c, 0x6c, 0x30, 0x01, 0xf4, 0x03, 0x10, 0x07, 0x86, 0x02,
+    0x40, 0x3e, 0x72, 0x45, 0x00, 0xfa, 0x40, 0x40, 0x3e, 0x44, 0x00, 0x7f, 0x48, 0x04, 0x00, 0x00,
+    0xd9, 0xe4, 0x01, 0x90, 0xe8, 0x80, 0x33, 0xda, 0x80, 0x13, 0xee, 0xee, 0x60, 0x09, 0x18, 0x86,
+    0x48, 0x00, 0x3d, 0xa8, 0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x00, 0x3f,
+    0xf2, 0x00, 0x57, 0xec, 0x01, 0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36, 0x18,
+    0x00, 0xfa, 0x01, 0x88, 0x03, 0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20, 0x1f,
+    0x22, 0x00, 0x3f, 0xa4, 0x02, 0x3f, 0xd0, 0x08, 0xbf, 0xcc, 0x01, 0xbf, 0x40, 0x3e, 0x30, 0xb0,
+    0x0f, 0x9d, 0x5c, 0x03, 0x00, 0x4f, 0xb8, 0xfe, 0x60, 0x09, 0x18, 0x86, 0x48, 0x00, 0x3d, 0xa8,
+    0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x9f, 0x60, 0x08, 0xf7, 0x00, 0xbf,
+    0x40, 0x38, 0x82, 0x80, 0x38, 0x55, 0x80, 0x20, 0x00, 0x0c, 0x10, 0xc1, 0x80, 0x61, 0x3e, 0xa5,
+    0x30, 0x0e, 0xa3, 0x4e, 0x00, 0xf0, 0xff, 0x8c, 0x02, 0x3f, 0xf2, 0x00, 0x57, 0xec, 0x01, 0x48,
+    0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36, 0x18, 0x00, 0xfa, 0x01, 0x88, 0x03, 0xc3,
+    0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20, 0x1f, 0x22, 0x00, 0x3f, 0xa4, 0x02, 0x00,
+    0x01, 0xe9, 0x6f, 0x30, 0x00, 0xeb, 0x4d, 0x18, 0x04, 0x7f, 0xe5, 0x00, 0x27, 0xdc, 0x7f, 0x30,
+    0x04, 0x8c, 0x43, 0x24, 0x00, 0x1e, 0xd4, 0x04, 0x00, 0x10, 0x00, 0xc0, 0x40, 0x0e, 0x01, 0xff,
+    0xd1, 0x00, 0x3f, 0xf2, 0x00, 0x57, 0xec, 0x01, 0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20,
+    0x1e, 0x36, 0x18, 0x00, 0xfa, 0x01, 0x88, 0x03, 0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d,
+    0x20, 0x20, 0x1f, 0x22, 0x00, 0x3f, 0xa4, 0x02, 0x3f, 0xd0, 0x08, 0x90, 0x03, 0xe2, 0xd4, 0x05,
+    0x00, 0xe1, 0x21, 0x73, 0x00, 0x4f, 0xb8, 0xfe, 0x60, 0x09, 0x18, 0x86, 0x48, 0x00, 0x3d, 0xa8,
+    0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x9f, 0x60, 0x01, 0x00, 0xf5, 0xb0,
+    0x10, 0x06, 0x50, 0x55, 0x00, 0x00, 0x84, 0x70, 0x07, 0xd5, 0xdd, 0x18, 0x07, 0xa2, 0xee, 0x20,
+    0x0f, 0x1a, 0x24, 0x20, 0x1c, 0x55, 0xdf, 0x8c, 0x01, 0x8f, 0x54, 0x40, 0xe6, 0x40, 0x17, 0x01,
+    0xef, 0x48, 0x32, 0x02, 0x10, 0x69, 0x0b, 0x38, 0x78, 0x18, 0x28, 0x80, 0x56, 0x0a, 0x1e, 0x06,
+    0x01, 0x88, 0x04, 0x3c, 0x0c, 0x03, 0x10, 0x08, 0x18, 0x20, 0x06, 0xb0, 0x50, 0x42, 0x1b, 0x21,
+    0x67, 0x0e, 0x00, 0x70, 0x26, 0xf4, 0x83, 0x28, 0x00, 0xf5, 0x44, 0x0e, 0x64, 0x00, 0x00, 0x00,
+    0x08, 0xe0, 0x0d, 0xfd, 0xd0, 0x06, 0xab, 0xb8, 0x03, 0x22, 0x60, 0x08, 0x6b, 0xbe, 0xc8, 0x01,
+    0x8a, 0x02, 0x98, 0x2a, 0x44, 0xee, 0x20, 0xb6, 0x85, 0x00, 0x38, 0x34, 0x40, 0x3e, 0xc0, 0xb0,
+    0x07, 0x06, 0xa9, 0x1f, 0x6a, 0x0b, 0x06, 0x28, 0x12, 0x60, 0x80, 0x00, 0xa0, 0x41, 0x50, 0x03,
+    0xcc, 0xc1, 0xb2, 0x00, 0xf5, 0x47, 0x23, 0x00, 0x79, 0x3f, 0x68, 0x03, 0xc5, 0x5d, 0xb8, 0xc0,
+    0x18, 0xf5, 0x44, 0x0e, 0x64, 0x01, 0x70, 0x1e, 0xf4, 0x83, 0x20, 0x21, 0x06, 0x90, 0xb3, 0x87,
+    0x81, 0x82, 0x88, 0x05, 0x60, 0xa1, 0xe0, 0x60, 0x18, 0x80, 0x43, 0xc0, 0xc0, 0x31, 0x00, 0x81,
+    0x82, 0x00, 0x6b, 0x05, 0x04, 0x21, 0xb2, 0x16, 0x70, 0xe0, 0x07, 0x02, 0x6f, 0x48, 0x32, 0x80,
+    0x0f, 0x54, 0x40, 0xe6, 0x40, 0x00, 0x03, 0xf2, 0x1e, 0x40, 0x01, 0xbe, 0xf2, 0x20, 0x02, 0x8e,
+    0xe5, 0x00, 0x43, 0x5f, 0xd6, 0x40, 0x0c, 0x50, 0x14, 0xc1, 0x52, 0x27, 0x71, 0x05, 0xb4, 0x28,
+    0x01, 0xc1, 0xa2, 0x01, 0xf6, 0x05, 0x80, 0x38, 0x35, 0x48, 0xfb, 0x50, 0x58, 0x31, 0x40, 0x93,
+    0x04, 0x00, 0x85, 0x48, 0x8a, 0x40, 0x1c, 0xd4, 0x3f, 0x04, 0x01, 0xd4, 0xa8, 0x5e, 0x01, 0xed,
+    0xa7, 0xf2, 0x00, 0xe2, 0xae, 0xfc, 0x60, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a,
+    0x41, 0x90, 0x10, 0x83, 0x48, 0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c,
+    0x40, 0x21, 0xe0, 0x60, 0x18, 0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38,
+    0x70, 0x03, 0x81, 0x37, 0xa4, 0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x00, 0x00, 0x47, 0x9e,
+    0xf0, 0x80, 0x19, 0x50, 0xb4, 0x40, 0x17, 0x63, 0xc3, 0x00, 0x0f, 0xfa, 0xe0, 0x80, 0x18, 0xa0,
+    0x29, 0x82, 0xa4, 0x4e, 0xe2, 0x0b, 0x68, 0x50, 0x03, 0x83, 0x44, 0x03, 0xec, 0x0b, 0x00, 0x70,
+    0x6a, 0x91, 0xf6, 0xa0, 0xb0, 0x62, 0x81, 0x26, 0x08, 0x00, 0x15, 0x77, 0xff, 0xf0, 0x1e, 0xa8,
+    0x80, 0x7e, 0x10, 0xe0, 0x4d, 0xfa, 0x04, 0xff, 0xdc, 0x84, 0x36, 0x40, 0x1f, 0xc6, 0x08, 0x01,
+    0xc9, 0xdd, 0x9f, 0xc0, 0x80, 0x3c, 0x23, 0xbf, 0xc0, 0x40, 0x1c, 0x9f, 0xfa, 0x0c, 0x10, 0x03,
+    0xfe, 0x42, 0x1b, 0x20, 0x0f, 0xf7, 0x02, 0x6f, 0xd0, 0x27, 0xfe, 0xe0, 0x3d, 0x51, 0x00, 0xfc,
+    0x20, 0x01, 0xae, 0xfb, 0x27, 0xef, 0xc4, 0x00, 0x62, 0x80, 0xa6, 0xc0, 0x19, 0xac, 0xd4, 0x89,
+    0xdc, 0x30, 0x06, 0x6d, 0x04, 0xe8, 0x50, 0x01, 0x00, 0x1b, 0xd4, 0x0e, 0x20, 0x1f, 0x5d, 0xee,
+    0xc0, 0xb0, 0x02, 0x00, 0x19, 0x1f, 0xd1, 0x48, 0xfb, 0x4c, 0x01, 0xba, 0xc4, 0x30, 0xc5, 0x02,
+    0x4d, 0x81, 0x23, 0xb4, 0x00, 0x00, 0xe5, 0x30, 0x0f, 0x45, 0x38, 0x07, 0x0b, 0xb9, 0x00, 0x38,
+    0x7e, 0x00, 0x23, 0xff, 0xdd, 0x44, 0x01, 0x84, 0x65, 0xc1, 0x00, 0x17, 0x74, 0x42, 0xe0, 0x1c,
+    0x2a, 0x1c, 0x01, 0xe4, 0x0e, 0x00, 0x16, 0xeb, 0xcc, 0x58, 0x02, 0x22, 0x00, 0xf8, 0x04, 0x5f,
+    0xc0, 0x26, 0x01, 0xc2, 0xc1, 0x00, 0x1e, 0xb0, 0x51, 0x00, 0xe2, 0x40, 0x80, 0x00, 0x0f, 0xe0,
+    0x05, 0x21, 0xc0, 0x16, 0x69, 0x02, 0x7f, 0xa7, 0xc0, 0x24, 0x41, 0x80, 0x6e, 0xc0, 0x08, 0xc4,
+    0x03, 0x38, 0x07, 0xff, 0x24, 0x3f, 0xfd, 0xd4, 0x40, 0x18, 0x46, 0x5c, 0x10, 0x01, 0x77, 0x44,
+    0x2e, 0x01, 0xc2, 0xa1, 0xc0, 0x1e, 0x40, 0xe0, 0x01, 0x6e, 0xbc, 0xc5, 0x80, 0x22, 0x20, 0x0f,
+    0x80, 0x45, 0xfc, 0x02, 0x60, 0x1c, 0x2c, 0x10, 0x01, 0xeb, 0x05, 0x10, 0x0e, 0x24, 0x08, 0x3f,
+    0xd0, 0x0a, 0xfe, 0x40, 0x27, 0xf5, 0x00, 0xf6, 0x0a, 0x80, 0x78, 0xa0, 0x03, 0x00, 0x4f, 0xbb,
+    0x78, 0x04, 0x88, 0x30, 0x0d, 0xd8, 0x01, 0x18, 0x80, 0x67, 0x00, 0xff, 0xe4, 0xa7, 0xd8, 0x04,
+    0xbe, 0xe0, 0x16, 0x03, 0x00, 0x43, 0x02, 0x01, 0x00, 0x00, 0x33, 0x01, 0x58, 0x03, 0x14, 0xc5,
+    0x18, 0x06, 0x45, 0x75, 0x50, 0x07, 0x57, 0xd0, 0x04, 0x7f, 0xfb, 0xa8, 0x80, 0x30, 0x8c, 0xb8,
+    0x20, 0x02, 0xee, 0x88, 0x5c, 0x03, 0x85, 0x43, 0x80, 0x3c, 0x81, 0xc0, 0x02, 0xdd, 0x79, 0x8b,
+    0x00, 0x44, 0x40, 0x1f, 0x00, 0x8b, 0xf8, 0x04, 0xc0, 0x38, 0x58, 0x20, 0x03, 0xd6, 0x0a, 0x20,
+    0x1c, 0x48, 0x10, 0x00, 0x3f, 0x5a, 0xd1, 0x39, 0xa5, 0xf1, 0x06, 0xff, 0x10, 0x27, 0xdd, 0xbc,
+    0x02, 0x44, 0x18, 0x06, 0xec, 0x00, 0x8c, 0x40, 0x33, 0x80, 0x7f, 0xf2, 0x40, 0x00, 0xe5, 0x30,
+    0x0f, 0x3d, 0x38, 0x07, 0xa5, 0xd0, 0x03, 0xdd, 0x00, 0x1d, 0x1d, 0xfb, 0x00, 0x16, 0x38, 0x88,
+    0x9e, 0xc0, 0xcc, 0x1b, 0xda, 0x28, 0x6e, 0x02, 0x40, 0x55, 0x02, 0x82, 0x2d, 0x84, 0x43, 0x90,
+    0x61, 0x93, 0xdf, 0xb8, 0x00, 0xb3, 0xa9, 0x42, 0x15, 0x56, 0xc2, 0xb4, 0xe1, 0x80, 0x90, 0x40,
+    0x03, 0x01, 0x52, 0x1d, 0xef, 0x40, 0xa0, 0xc7, 0x21, 0x12, 0xe9, 0x00, 0x00, 0x8f, 0xe8, 0x03,
+    0x41, 0x50, 0x06, 0xfc, 0x00, 0x97, 0x6f, 0x1c, 0x0e, 0x89, 0x82, 0x19, 0x41, 0x67, 0xd4, 0x10,
+    0x17, 0x63, 0xd8, 0xb5, 0xc5, 0x6a, 0x56, 0xf3, 0x16, 0x08, 0x2d, 0x53, 0x20, 0x74, 0xa2, 0x63,
+    0x6a, 0x00, 0x00, 0x8e, 0x10, 0x03, 0xda, 0xd4, 0x20, 0x1a, 0x43, 0xce, 0x80, 0x34, 0xf0, 0xed,
+    0x80, 0x68, 0xef, 0xd8, 0x00, 0xb1, 0xc4, 0x44, 0xf6, 0x06, 0x60, 0xde, 0xd1, 0x43, 0x70, 0x12,
+    0x02, 0xa8, 0x14, 0x11, 0x6c, 0x22, 0x1c, 0x83, 0x0c, 0x9e, 0xfd, 0xc0, 0x05, 0x9d, 0x4a, 0x10,
+    0xaa, 0xb6, 0x15, 0xa7, 0x0c, 0x04, 0x82, 0x00, 0x18, 0x0a, 0x90, 0xef, 0x7a, 0x05, 0x06, 0x39,
+    0x08, 0x97, 0x48, 0x00, 0x47, 0xe0, 0x04, 0xaf, 0x45, 0x20, 0x04, 0xd5, 0xfb, 0x00, 0x27, 0xfb,
+    0x14, 0x0e, 0x89, 0x82, 0x19, 0x41, 0x67, 0xd4, 0x10, 0x17, 0x63, 0xd8, 0xb5, 0xc5, 0x6a, 0x56,
+    0xf3, 0x16, 0x08, 0x2d, 0x53, 0x20, 0x74, 0xa2, 0x63, 0x6a, 0x00, 0x00, 0x47, 0x7e, 0xc0, 0x05,
+    0x8e, 0x22, 0x27, 0xb0, 0x33, 0x06, 0xf6, 0x8a, 0x1b, 0x80, 0x90, 0x15, 0x40, 0xa0, 0x8b, 0x61,
+    0x10, 0xe4, 0x18, 0x64, 0xf7, 0xee, 0x00, 0x2c, 0xea, 0x50, 0x85, 0x55, 0xb0, 0xad, 0x38, 0x60,
+    0x24, 0x10, 0x00, 0xc0, 0x54, 0x87, 0x7b, 0xd0, 0x28, 0x31, 0xc8, 0x44, 0xba, 0x40, 0x31, 0xa1,
+    0x34, 0x40, 0x1d, 0xb0, 0x60, 0x1c, 0x98, 0x64, 0x00, 0x00, 0x05, 0xdf, 0xd7, 0x03, 0xa2, 0x60,
+    0x86, 0x50, 0x59, 0xf5, 0x04, 0x05, 0xd8, 0xf6, 0x2d, 0x71, 0x5a, 0x95, 0xbc, 0xc5, 0x82, 0x0b,
+    0x54, 0xc8, 0x1d, 0x28, 0x98, 0x9a, 0x81, 0x70, 0x5e, 0x40, 0x36, 0x32, 0x80, 0x45, 0x86, 0x80,
+    0x00, 0x00, 0x3c, 0x04, 0x40, 0x03, 0x23, 0xcb, 0xe0, 0x06, 0x36, 0x62, 0xa0, 0x07, 0x4f, 0xd0,
+    0x07, 0x47, 0x7f, 0x48, 0x80, 0x31, 0xc4, 0x66, 0xc0, 0x33, 0x06, 0xf7, 0x0c, 0x91, 0xc0, 0x48,
+    0x07, 0x3d, 0x10, 0x22, 0xd8, 0x40, 0x0d, 0x86, 0x4f, 0x7e, 0xe0, 0x02, 0xce, 0xa5, 0x08, 0x56,
+    0xd8, 0x15, 0xa7, 0x0c, 0x32, 0x62, 0x00, 0x18, 0x0a, 0x98, 0xef, 0x7a, 0x05, 0x06, 0x39, 0x08,
+    0x97, 0x48, 0x07, 0xf3, 0xcb, 0x00, 0x3a, 0xe1, 0x50, 0x05, 0x5b, 0xe2, 0x00, 0x5d, 0xd6, 0x38,
+    0x1d, 0x13, 0x04, 0x32, 0x82, 0xcf, 0xa8, 0x20, 0x2e, 0xc7, 0xb1, 0x6b, 0x8a, 0xd4, 0xad, 0xe6,
+    0x2c, 0x10, 0x5a, 0xa6, 0x40, 0xe9, 0x44, 0xc6, 0xd4, 0x00, 0xbf, 0xff, 0xa4, 0x40, 0x3f, 0x57,
+    0xf9, 0x81, 0xff, 0xd2, 0x01, 0xff, 0xff, 0x91, 0xc0, 0x0f, 0xae, 0xc2, 0x01, 0xcd, 0x66, 0x20,
+    0x00, 0x0a, 0xf6, 0x00, 0xf7, 0x28, 0x4e, 0xb8, 0x81, 0x24, 0xa0, 0x5c, 0x80, 0x7f, 0xc6, 0x01,
+    0x84, 0x22, 0x42, 0x48, 0x50, 0x06, 0x4f, 0xc0, 0x0a, 0x98, 0x00, 0x87, 0x70, 0x00, 0x32, 0x83,
+    0x30, 0x03, 0x1d, 0x44, 0x90, 0x06, 0x54, 0x76, 0x40, 0x0e, 0xbf, 0x90, 0x0a, 0xff, 0xfe, 0x91,
+    0x00, 0xfd, 0x5f, 0xe6, 0x07, 0xff, 0x48, 0x07, 0xff, 0xf0, 0x00, 0xd3, 0x40, 0x26, 0x24, 0x00,
+    0xbc, 0x70, 0x20, 0x0d, 0x71, 0xca, 0x13, 0xa0, 0xe2, 0x04, 0x81, 0x28, 0x17, 0x20, 0x1f, 0xfc,
+    0x23, 0x00, 0xe1, 0x08, 0x90, 0x04, 0x98, 0xa0, 0x00, 0xbf, 0xff, 0xa4, 0x40, 0x3f, 0x57, 0xf9,
+    0x81, 0xff, 0xd2, 0x01, 0xff, 0xc7, 0x9f, 0x60, 0x7f, 0x70, 0x06, 0x30, 0x04, 0xc6, 0x00, 0x59,
+    0x60, 0x79, 0x40, 0x0f, 0xfe, 0x80, 0x0a, 0xf6, 0x00, 0xf7, 0x28, 0x4e, 0xb8, 0x81, 0x24, 0x20,
+    0x54, 0x7a, 0x84, 0x66, 0xa0, 0x3f, 0x18, 0x87, 0x18, 0x10, 0x44, 0x84, 0x98, 0xa0, 0x00, 0xff,
+    0xe0, 0x17, 0x7f, 0xc4, 0x01, 0x8f, 0x73, 0x1c, 0x40, 0x18, 0x4c, 0xe1, 0x00, 0x93, 0xf0, 0x03,
+    0x7f, 0x88, 0x03, 0xff, 0xe0, 0xe0, 0x40, 0x10, 0x80, 0x0c, 0xc0, 0x30, 0x03, 0x60, 0x42, 0x10,
+    0x0f, 0xfc, 0xa1, 0x20, 0x07, 0xa3, 0x00, 0x26, 0x20, 0x00, 0x00, 0x5e, 0xa6, 0x30, 0x00, 0x92,
+    0xec, 0x6e, 0x00, 0x2d, 0x6f, 0xe1, 0x04, 0xf9, 0x00, 0x4f, 0xb8, 0x07, 0xff, 0x51, 0xc1, 0x44,
+    0x14, 0x00, 0x62, 0x2e, 0xf2, 0x00, 0xa8, 0x81, 0x5c, 0x00, 0x00, 0x00, 0x84, 0x70, 0x07, 0xbb,
+    0xaf, 0x00, 0xf5, 0xdd, 0x40, 0x1e, 0x44, 0xc0, 0x12, 0x7e, 0x00, 0x6f, 0xf1, 0x00, 0x7f, 0xfc,
+    0x1c, 0x08, 0x02, 0x10, 0x01, 0x98, 0x06, 0x00, 0x6c, 0x08, 0x42, 0x01, 0xff, 0x94, 0x24, 0x00,
+    0xf4, 0x60, 0x04, 0xc4, 0x00, 0x00, 0x08, 0xe0, 0x0d, 0xfd, 0xd0, 0x80, 0x55, 0x77, 0x08, 0x04,
+    0x89, 0x80, 0x09, 0xf6, 0x00, 0x8f, 0x70, 0x0f, 0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d,
+    0xe4, 0x01, 0x51, 0x02, 0xb8, 0x00, 0x00, 0x1b, 0x00, 0x1c, 0x80, 0x3a, 0x49, 0x20, 0xc0, 0x31,
+    0xbe, 0xdc, 0x88, 0x07, 0x47, 0x71, 0x80, 0x24, 0xfc, 0x01, 0x10, 0x7f, 0x88, 0x03, 0xff, 0xe0,
+    0xe0, 0x40, 0x10, 0x80, 0x0c, 0xc0, 0x30, 0x03, 0x60, 0x42, 0x10, 0x0f, 0xfc, 0xa1, 0x20, 0x07,
+    0xa3, 0x00, 0x26, 0x20, 0x00, 0x02, 0xf3, 0x1e, 0x50, 0x01, 0x3e, 0x72, 0x28, 0x05, 0x1d, 0xca,
+    0x00, 0x27, 0xd8, 0x8a, 0x3d, 0xc0, 0x3f, 0xfa, 0x8e, 0x0a, 0x20, 0xa0, 0x03, 0x11, 0x77, 0x90,
+    0x05, 0x44, 0x0a, 0xe0, 0x00, 0x00, 0x97, 0xb4, 0xc0, 0x3d, 0xd0, 0x94, 0x01, 0xee, 0x87, 0xa0,
+    0x0f, 0x2f, 0x70, 0xc0, 0x24, 0xfc, 0x00, 0xdf, 0xe2, 0x00, 0xff, 0xf8, 0x38, 0x10, 0x04, 0x20,
+    0x03, 0x30, 0x0c, 0x00, 0xd8, 0x10, 0x84, 0x03, 0xff, 0x28, 0x48, 0x01, 0xe8, 0xc0, 0x09, 0x88,
+    0x00, 0x00, 0x1e, 0xf2, 0x80, 0x6a, 0x48, 0x90, 0x0d, 0x49, 0x12, 0x01, 0x8f, 0x79, 0x40, 0x09,
+    0xf6, 0x00, 0x8f, 0x70, 0x0f, 0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d, 0xe4, 0x01, 0x51,
+    0x02, 0xb8, 0x00, 0x00, 0x89, 0x44, 0xd0, 0x03, 0xba, 0x0b, 0x34, 0x03, 0x11, 0xc7, 0x9c, 0x80,
+    0x62, 0xf5, 0xcc, 0x00, 0x49, 0xf8, 0x01, 0xbf, 0xc4, 0x01, 0xff, 0xf0, 0x70, 0x20, 0x08, 0x40,
+    0x06, 0x60, 0x18, 0x01, 0xb0, 0x21, 0x08, 0x07, 0xfe, 0x50, 0x90, 0x03, 0xd1, 0x80, 0x13, 0x10,
+    0x00, 0x00, 0x3f, 0xa6, 0xf0, 0x80, 0x29, 0x48, 0x9a, 0x20, 0x08, 0xb5, 0xc3, 0x04, 0xfe, 0x13,
+    0xbf, 0x70, 0x0f, 0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d, 0xe4, 0x01, 0x51, 0x02, 0xb8,
+    0x00, 0x4f, 0xc0, 0x0d, 0xfe, 0x20, 0x0f, 0xff, 0x83, 0x81, 0x00, 0x42, 0x01, 0x18, 0x0c, 0x00,
+    0xd8, 0x00, 0x82, 0x01, 0xff, 0x94, 0x14, 0x00, 0xf4, 0x60, 0x13, 0x50, 0x04, 0xbc, 0x25, 0xd2,
+    0x01, 0xc8, 0x22, 0x20, 0x0f, 0x39, 0x9a, 0xc0, 0x20, 0x4f, 0xb0, 0x04, 0x7b, 0x80, 0x7f, 0xf5,
+    0x1c, 0x14, 0x41, 0x40, 0x06, 0x22, 0xef, 0x20, 0x0a, 0x88, 0x14, 0xc3, 0x81, 0x37, 0xe0, 0xcd,
+    0x20, 0x19, 0x00, 0x06, 0x01, 0x9c, 0xcc, 0x80, 0x00, 0xf3, 0xb8, 0x03, 0xfe, 0x88, 0x9c, 0x03,
+    0xf8, 0xde, 0x62, 0x04, 0x01, 0xf8, 0xfd, 0x9f, 0xc8, 0x03, 0x6f, 0xb0, 0x00, 0xff, 0xc4, 0x00,
+    0x7f, 0xc4, 0x0c, 0x00, 0x20, 0x01, 0x00, 0x18, 0x09, 0x80, 0xe0, 0x0d, 0x00, 0x78, 0x01, 0x43,
+    0x10, 0x08, 0x41, 0x04, 0x10, 0x04, 0x40, 0x82, 0x40, 0xa4, 0x2a, 0x84, 0x28, 0x06, 0x00, 0x40,
+    0xc7, 0x0c, 0x30, 0x5d, 0x04, 0x00, 0x60, 0x1e, 0x02, 0x60, 0x62, 0x06, 0x00, 0x10, 0x15, 0x40,
+    0x68, 0x06, 0x60, 0x40, 0x00, 0x90, 0x99, 0x80, 0x06, 0x80, 0x60, 0x19, 0x00, 0x08, 0x00, 0x40,
+    0x02, 0x00, 0x6c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd1, 0xfa, 0x20, 0x1f, 0x2b,
+    0xd8, 0xd0, 0x07, 0xcb, 0xe9, 0x96, 0x01, 0xb3, 0xd0, 0x17, 0xf0, 0x01, 0xde, 0x68, 0x18, 0x1a,
+    0x06, 0x02, 0x20, 0x3b, 0x04, 0x04, 0x00, 0x22, 0x01, 0x40, 0xc0, 0xc4, 0xd4, 0x0f, 0x03, 0x00,
+    0x0a, 0x0c, 0x1c, 0x58, 0xa0, 0x80, 0x0c, 0x09, 0x04, 0x42, 0x99, 0x10, 0x00, 0xe0, 0x26, 0x18,
+    0x20, 0x80, 0x10, 0x90, 0x20, 0x20, 0x03, 0x40, 0x00, 0x00, 0xc8, 0x60, 0x1f, 0x4d, 0x61, 0x80,
+    0x72, 0x35, 0x37, 0x08, 0x06, 0x4f, 0x49, 0xd1, 0x00, 0x57, 0xd8, 0x04, 0x3f, 0xe5, 0x80, 0x44,
+    0x00, 0x24, 0x0d, 0x49, 0x82, 0x00, 0x5c, 0x3c, 0x01, 0x00, 0x69, 0x00, 0x86, 0x00, 0x18, 0x09,
+    0x60, 0x90, 0x0c, 0xe2, 0x40, 0xa4, 0x01, 0xd0, 0x00, 0x80, 0x0f, 0x20, 0x09, 0x00, 0x7f, 0xf5,
+    0x40, 0x00, 0x3f, 0xf0, 0x80, 0x49, 0x14, 0x5a, 0x01, 0x27, 0xae, 0x60, 0x01, 0x7e, 0xa0, 0x09,
+    0xf7, 0xd0, 0xf0, 0x03, 0x82, 0xb8, 0x28, 0x18, 0x99, 0x0a, 0x82, 0x58, 0x58, 0x03, 0xc3, 0x50,
+    0x18, 0x00, 0xa0, 0xe6, 0x61, 0x00, 0x98, 0x42, 0x80, 0x36, 0x80, 0x1c, 0x03, 0x10, 0x20, 0x80,
+    0x06, 0xe4, 0x38, 0x03, 0x20, 0x3a, 0x80, 0x40, 0x00, 0x09, 0x80, 0x0c, 0x03, 0xab, 0x16, 0xb1,
+    0x40, 0x31, 0x8b, 0x68, 0x30, 0x06, 0x8e, 0x37, 0xf3, 0x00, 0x57, 0xd8, 0x04, 0x3f, 0xe5, 0x80,
+    0x44, 0x00, 0x24, 0x0d, 0x49, 0x82, 0x00, 0x5c, 0x3c, 0x01, 0x00, 0x69, 0x00, 0x86, 0x00, 0x18,
+    0x09, 0x60, 0x90, 0x0c, 0xe2, 0x40, 0xa4, 0x01, 0xd0, 0x00, 0x80, 0x0f, 0x20, 0x09, 0x00, 0x7f,
+    0xf5, 0x40, 0x00, 0xc2, 0xa6, 0x01, 0xe8, 0xa0, 0x0f, 0x13, 0x49, 0x80, 0x71, 0x7b, 0x00, 0x4f,
+    0xff, 0xf3, 0x80, 0x7f, 0x3f, 0xfe, 0x70, 0x27, 0x00, 0xc8, 0xe1, 0xc0, 0x18, 0x68, 0x24, 0xc0,
+    0x36, 0x8a, 0xb0, 0x06, 0x83, 0x2a, 0x00, 0xca, 0xe1, 0xc0, 0x18, 0xa8, 0x24, 0xc0, 0x35, 0x80,
+    0x27, 0xff, 0x39, 0x80, 0x7d, 0xe0, 0x00, 0x8f, 0xe4, 0x03, 0x41, 0x48, 0x06, 0xfc, 0x00, 0x2f,
+    0xfa, 0xfb, 0xe4, 0x4c, 0xe0, 0x00, 0xa6, 0x62, 0x40, 0xa0, 0x00, 0x54, 0x1c, 0x01, 0x70, 0x49,
+    0x80, 0x24, 0xd5, 0x80, 0x06, 0xc0, 0xd7, 0x67, 0x60, 0x01, 0xa2, 0x34, 0x00, 0xc8, 0x01, 0xf4,
+    0xdb, 0x80, 0x7b, 0x80, 0x80, 0x3c, 0xfe, 0xa0, 0x13, 0xff, 0xfc, 0xe0, 0x1f, 0xcf, 0xff, 0x9c,
+    0x09, 0xc0, 0x32, 0x38, 0x70, 0x06, 0x1a, 0x09, 0x30, 0x0d, 0xa2, 0xac, 0x01, 0xa0, 0xca, 0x80,
+    0x32, 0xb8, 0x70, 0x06, 0x2a, 0x09, 0x30, 0x0d, 0x60, 0x09, 0xff, 0xce, 0x60, 0x1f, 0x78, 0x00,
+    0x27, 0xc0, 0x06, 0x20, 0x30, 0x0c, 0xd7, 0x40, 0x05, 0xff, 0x5f, 0x7c, 0x89, 0x9c, 0x00, 0x14,
+    0xcc, 0x48, 0x14, 0x00, 0x0a, 0x83, 0x80, 0x2e, 0x09, 0x30, 0x04, 0x9a, 0xb0, 0x00, 0xd8, 0x1a,
+    0xec, 0xec, 0x00, 0x34, 0x46, 0x80, 0x00, 0x3a, 0x83, 0x30, 0x03, 0x0d, 0x44, 0x90, 0x06, 0x64,
+    0x76, 0x40, 0x0e, 0xbf, 0x90, 0x09, 0xff, 0xfe, 0x70, 0x0f, 0xe7, 0xff, 0xce, 0x04, 0xe0, 0x19,
+    0x1c, 0x38, 0x03, 0x0d, 0x04, 0x98, 0x06, 0xd1, 0x56, 0x00, 0xd0, 0x65, 0x40, 0x19, 0x5c, 0x38,
+    0x03, 0x15, 0x04, 0x98, 0x06, 0xb0, 0x04, 0xff, 0xe7, 0x30, 0x0f, 0xbc, 0x07, 0xf3, 0xdb, 0x00,
+    0x3b, 0x60, 0x58, 0x05, 0x3f, 0xa0, 0x05, 0xff, 0xe9, 0x13, 0x38, 0x00, 0x29, 0x98, 0x90, 0x28,
+    0x00, 0x15, 0x07, 0x00, 0x5c, 0x12, 0x60, 0x09, 0x35, 0x60, 0x01, 0xb0, 0x35, 0xd9, 0xd8, 0x00,
+    0x68, 0x8d, 0x00, 0x08, 0xef, 0x32, 0x71, 0x41, 0x60, 0x3b, 0x20, 0x03, 0x80, 0x7f, 0xf6, 0x40,
+    0x00, 0xa3, 0xfd, 0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80,
+    0xa0, 0x19, 0x43, 0x30, 0x16, 0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50,
+    0x05, 0x81, 0xff, 0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0,
+    0x0c, 0xe1, 0x59, 0xee, 0x5b, 0xa2, 0x9f, 0xc0, 0x0a, 0xea, 0x96, 0x01, 0xff, 0xc4, 0xba, 0xa5,
+    0x80, 0x40, 0x03, 0xbf, 0xea, 0x10, 0x06, 0xa2, 0x09, 0x68, 0x09, 0x26, 0xf0, 0x10, 0x0a, 0x3a,
+    0xf8, 0x02, 0x3d, 0x71, 0x90, 0x0a, 0xc2, 0x69, 0x80, 0x2e, 0x0b, 0x9c, 0x00, 0x99, 0x84, 0xf0,
+    0x01, 0xa6, 0xc2, 0x7b, 0xc0, 0x28, 0xa6, 0x60, 0x07, 0xff, 0x02, 0x29, 0x98, 0x00, 0x00, 0x00,
+    0xc8, 0x01, 0xf5, 0x5b, 0x00, 0x7b, 0x40, 0x80, 0x3c, 0xfe, 0x80, 0x11, 0xff, 0xee, 0xb2, 0x00,
+    0xc6, 0x61, 0x4c, 0x00, 0x8b, 0x31, 0xc0, 0x26, 0x01, 0xc2, 0x20, 0x20, 0x01, 0x5d, 0xb8, 0x24,
+    0x40, 0x24, 0x40, 0x8b, 0xc0, 0x22, 0xff, 0x68, 0xb2, 0x80, 0x71, 0x30, 0x60, 0x07, 0x90, 0x04,
+    0x00, 0x59, 0x8e, 0x30, 0xa0, 0x08, 0xcc, 0x27, 0x84, 0x00, 0x00, 0xd9, 0xa0, 0x1e, 0x32, 0x10,
+    0x4f, 0xb0, 0xdd, 0x08, 0x07, 0x11, 0x00, 0x3f, 0xf8, 0x33, 0xfc, 0xc0, 0x12, 0x31, 0x0c, 0xa8,
+    0x05, 0xba, 0x80, 0x90, 0x02, 0x10, 0x30, 0x10, 0x07, 0xf9, 0x08, 0x18, 0x08, 0x02, 0xdd, 0x40,
+    0x48, 0x01, 0x18, 0x86, 0x54, 0x3f, 0xfd, 0xd6, 0x40, 0x18, 0xcc, 0x29, 0x80, 0x11, 0x66, 0x38,
+    0x04, 0xc0, 0x38, 0x44, 0x04, 0x00, 0x2b, 0xb7, 0x04, 0x88, 0x04, 0x88, 0x11, 0x78, 0x04, 0x5f,
+    0xed, 0x16, 0x50, 0x0e, 0x26, 0x0c, 0x00, 0xf2, 0x00, 0x80, 0x0b, 0x31, 0xc6, 0x14, 0x01, 0x19,
+    0x84, 0xf0, 0x8f, 0xff, 0xb0, 0xc0, 0x33, 0xfa, 0x00, 0x7b, 0x40, 0x80, 0x3d, 0x76, 0x60, 0x08,
+    0x4f, 0xb0, 0x0f, 0xfe, 0x64, 0xff, 0x30, 0x04, 0x8c, 0x43, 0x2a, 0x01, 0x6e, 0xa0, 0x24, 0x00,
+    0x84, 0x0c, 0x04, 0x01, 0xfe, 0x42, 0x06, 0x02, 0x00, 0xb7, 0x50, 0x12, 0x00, 0x46, 0x21, 0x95,
+    0x4f, 0xb9, 0xfe, 0x60, 0x0d, 0x3c, 0x40, 0x1c, 0xa2, 0xc0, 0x1d, 0xb6, 0x80, 0x00, 0x3f, 0xfd,
+    0xd6, 0x40, 0x18, 0xcc, 0x29, 0x80, 0x11, 0x66, 0x38, 0x04, 0xc0, 0x38, 0x44, 0x04, 0x00, 0x2b,
+    0xb7, 0x04, 0x88, 0x04, 0x88, 0x11, 0x78, 0x04, 0x5f, 0xed, 0x16, 0x50, 0x0e, 0x26, 0x0c, 0x00,
+    0xf2, 0x00, 0x80, 0x0b, 0x31, 0xc6, 0x14, 0x01, 0x19, 0x84, 0xf0, 0x8f, 0xfb, 0xb6, 0x18, 0x05,
+    0x1d, 0xd3, 0x00, 0x6b, 0xbc, 0xe0, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x64, 0xff, 0x30, 0x04, 0x8c,
+    0x43, 0x2a, 0x01, 0x6e, 0xa0, 0x24, 0x00, 0x84, 0x0c, 0x04, 0x01, 0xfe, 0x42, 0x06, 0x02, 0x00,
+    0xb7, 0x50, 0x12, 0x00, 0x46, 0x21, 0x95, 0x4f, 0xa8, 0xef, 0x60, 0x0a, 0xbb, 0xa3, 0x00, 0xa2,
+    0xee, 0x20, 0x00, 0x00, 0xe2, 0x52, 0x00, 0xfb, 0xe0, 0x80, 0x3c, 0xa5, 0xc0, 0x1f, 0x2f, 0x98,
+    0x07, 0x15, 0x77, 0xeb, 0x00, 0x47, 0x8a, 0x20, 0x53, 0x40, 0x0e, 0x13, 0xde, 0xa0, 0x54, 0x41,
+    0x06, 0x90, 0xab, 0x86, 0x98, 0x28, 0x80, 0x51, 0xf3, 0xe0, 0x60, 0x1f, 0x78, 0x18, 0x07, 0xc6,
+    0x08, 0x01, 0xa3, 0xe5, 0x08, 0x6c, 0x81, 0x5c, 0x30, 0x38, 0x13, 0x7e, 0x81, 0x54, 0x07, 0xaa,
+    0x00, 0x29, 0xa0, 0x08, 0xaa, 0x4b, 0x98, 0x03, 0xcd, 0x5e, 0x01, 0xf5, 0x45, 0x80, 0x40, 0x00,
+    0xdb, 0xc2, 0x01, 0x94, 0xa8, 0x40, 0x33, 0x62, 0x00, 0x43, 0x5b, 0x94, 0x20, 0x0c, 0x50, 0x25,
+    0xc0, 0x52, 0x3e, 0xd3, 0x24, 0xd0, 0xb0, 0x06, 0x7a, 0x08, 0x07, 0x08, 0x60, 0x58, 0x03, 0x39,
+    0x14, 0x8f, 0xb4, 0xc9, 0x03, 0x14, 0x49, 0x70, 0x00, 0x34, 0xe9, 0x02, 0x01, 0xa4, 0x60, 0x03,
+    0xb5, 0x3c, 0x00, 0x00, 0x00, 0x88, 0x80, 0x1f, 0x0e, 0xe8, 0x40, 0x3c, 0x24, 0x41, 0x00, 0xfb,
+    0x74, 0x01, 0xc7, 0xff, 0xb6, 0x04, 0x03, 0x84, 0x09, 0xf0, 0x40, 0x22, 0xef, 0xd2, 0x25, 0x00,
+    0x78, 0xbc, 0x10, 0x40, 0x3c, 0x44, 0x05, 0x00, 0xf8, 0x40, 0x40, 0x3e, 0x10, 0x10, 0x0f, 0x11,
+    0x01, 0x40, 0x38, 0xb8, 0x10, 0x40, 0x05, 0xdf, 0xa6, 0x34, 0x01, 0x84, 0x09, 0xfc, 0x40, 0x00,
+    0x47, 0x18, 0x07, 0x18, 0xb0, 0x07, 0x56, 0x2a, 0xbe, 0x80, 0x02, 0x60, 0x1f, 0xfc, 0x12, 0xcf,
+    0xc2, 0x00, 0xb0, 0xc4, 0xa0, 0x00, 0xc2, 0x7d, 0xc4, 0x00, 0x78, 0x58, 0x03, 0x80, 0x3f, 0xde,
+    0x16, 0x00, 0xe0, 0x03, 0x89, 0xf7, 0x10, 0x00, 0x3a, 0x62, 0x50, 0x00, 0x00, 0x3f, 0xfd, 0xb0,
+    0x20, 0x1c, 0x20, 0x4f, 0x82, 0x01, 0x17, 0x7e, 0x91, 0x28, 0x03, 0xc5, 0xe0, 0x82, 0x01, 0xe2,
+    0x20, 0x28, 0x07, 0xc2, 0x02, 0x01, 0xf0, 0x80, 0x80, 0x78, 0x88, 0x0a, 0x01, 0xc5, 0xc0, 0x82,
+    0x00, 0x2e, 0xfd, 0x31, 0xa0, 0x0c, 0x20, 0x4f, 0xe2, 0x07, 0xff, 0xb6, 0x04, 0x03, 0xa3, 0x8c,
+    0x03, 0xe3, 0x16, 0x00, 0xfa, 0xad, 0x40, 0x30, 0x00, 0xe5, 0xfa, 0x00, 0xff, 0xe2, 0x96, 0x7e,
+    0x10, 0x05, 0x86, 0x25, 0x00, 0x06, 0x13, 0xee, 0x20, 0x03, 0xc2, 0xc0, 0x1c, 0x01, 0xfe, 0xf0,
+    0xb0, 0x07, 0x00, 0x1c, 0x4f, 0xb8, 0x80, 0x01, 0xd3, 0x12, 0x80, 0x08, 0xf3, 0xf1, 0xfe, 0x80,
+    0x2c, 0xd1, 0x00, 0xe2, 0x21, 0x80, 0x76, 0x60, 0x80, 0x00, 0x3f, 0xfd, 0xb0, 0x20, 0x1c, 0x20,
+    0x4f, 0x82, 0x01, 0x17, 0x7e, 0x91, 0x28, 0x03, 0xc5, 0xe0, 0x82, 0x01, 0xe2, 0x20, 0x28, 0x07,
+    0xc2, 0x02, 0x01, 0xf0, 0x80, 0x80, 0x78, 0x88, 0x0a, 0x01, 0xc5, 0xc0, 0x82, 0x00, 0x2e, 0xfd,
+    0x31, 0xa0, 0x0c, 0x20, 0x4f, 0xe2, 0x07, 0xfd, 0xd6, 0x40, 0x80, 0x6b, 0xee, 0x90, 0x03, 0xa6,
+    0xee, 0x50, 0x08, 0x00, 0xe5, 0xfa, 0x00, 0xff, 0xe2, 0x96, 0x7e, 0x10, 0x05, 0x86, 0x25, 0x00,
+    0x06, 0x13, 0xee, 0x20, 0x03, 0xc2, 0xc0, 0x1c, 0x01, 0xfe, 0xf0, 0xb0, 0x07, 0x00, 0x1c, 0x4f,
+    0xb8, 0x80, 0x01, 0xd3, 0x12, 0x80, 0x08, 0xf7, 0xb5, 0xbe, 0x80, 0x19, 0xdd, 0x08, 0x05, 0x37,
+    0x70, 0x80, 0x3f, 0xfd, 0xb0, 0x20, 0x1c, 0x20, 0x4f, 0x82, 0x01, 0x17, 0x7e, 0x91, 0x28, 0x03,
+    0xc5, 0xe0, 0x82, 0x01, 0xe2, 0x20, 0x28, 0x07, 0xc2, 0x02, 0x01, 0xf0, 0x80, 0x80, 0x78, 0x88,
+    0x0a, 0x01, 0xc5, 0xc0, 0x82, 0x00, 0x2e, 0xfd, 0x31, 0xa0, 0x0c, 0x20, 0x4f, 0xe2, 0x07, 0xff,
+    0xb6, 0x04, 0x03, 0xaf, 0xc4, 0x03, 0xe4, 0x51, 0x00, 0xf0, 0xac, 0x80, 0x70, 0x00, 0xe5, 0xfa,
+    0x00, 0xff, 0xe2, 0x96, 0x7e, 0x10, 0x05, 0x86, 0x25, 0x00, 0x06, 0x13, 0xee, 0x20, 0x03, 0xc2,
+    0xc0, 0x1c, 0x01, 0xfe, 0xf0, 0xb0, 0x07, 0x00, 0x1c, 0x4f, 0xb8, 0x80, 0x01, 0xd3, 0x12, 0x80,
+    0x08, 0xf3, 0xf1, 0xfe, 0x80, 0x2e, 0xd0, 0x0e, 0x21, 0xa0, 0x0e, 0x15, 0x60, 0x08, 0x3f, 0xfd,
+    0xb0, 0x20, 0x1c, 0x20, 0x4f, 0x82, 0x01, 0x17, 0x7e, 0x91, 0x28, 0x03, 0xc5, 0xe0, 0x82, 0x01,
+    0xe2, 0x20, 0x28, 0x07, 0xc2, 0x02, 0x01, 0xf0, 0x80, 0x80, 0x78, 0x88, 0x0a, 0x01, 0xc5, 0xc0,
+    0x82, 0x00, 0x2e, 0xfd, 0x31, 0xa0, 0x0c, 0x20, 0x4f, 0xe2, 0x07, 0xff, 0xb6, 0x04, 0x03, 0x0e,
+    0xfc, 0x00, 0x7a, 0x86, 0xdd, 0x80, 0x20, 0x00, 0xe5, 0xfa, 0x00, 0xff, 0xe2, 0x96, 0x7e, 0x10,
+    0x05, 0x86, 0x25, 0x00, 0x06, 0x13, 0xee, 0x20, 0x03, 0xc2, 0xc0, 0x1c, 0x01, 0xfe, 0xf0, 0xb0,
+    0x07, 0x00, 0x1c, 0x4f, 0xb8, 0x80, 0x01, 0xd3, 0x12, 0x80, 0x08, 0xf3, 0xb5, 0xfe, 0x80, 0x07,
+    0xdc, 0x60, 0x08, 0x75, 0xa6, 0x46, 0x00, 0x00, 0x3f, 0x98, 0x07, 0x9d, 0x20, 0x03, 0xe9, 0xf1,
+    0x00, 0xe9, 0xdb, 0xe6, 0x00, 0xd7, 0x79, 0xc0, 0x31, 0x22, 0x42, 0x00, 0x3f, 0xff, 0x84, 0x03,
+    0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd, 0xa4, 0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff,
+    0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x40, 0x01, 0xec, 0x00, 0xe1, 0xd3, 0x40, 0x0e,
+    0x2c, 0x71, 0x00, 0xdd, 0x98, 0xf0, 0x0d, 0x77, 0x50, 0x06, 0x44, 0xc0, 0x10, 0xd7, 0xf5, 0x08,
+    0x03, 0x15, 0x09, 0x70, 0x14, 0x9a, 0xb5, 0x49, 0x34, 0x1b, 0xb8, 0xa0, 0x60, 0x06, 0xbb, 0xcb,
+    0xa0, 0x48, 0x83, 0xf1, 0x52, 0x4c, 0xb8, 0x63, 0x0c, 0x53, 0x45, 0xc0, 0x00, 0x00, 0xcd, 0xe8,
+    0x01, 0xe8, 0x74, 0x00, 0xe2, 0xa9, 0x00, 0xe9, 0xdb, 0xe6, 0x00, 0xd7, 0x79, 0xc0, 0x31, 0x22,
+    0x42, 0x00, 0x3f, 0xff, 0x84, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd, 0xa4,
+    0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x40, 0x00,
+    0xdb, 0x80, 0x1c, 0xc5, 0xc0, 0x18, 0x57, 0x0c, 0x03, 0x76, 0x63, 0xc0, 0x35, 0xdd, 0x40, 0x19,
+    0x13, 0x00, 0x43, 0x5f, 0xd4, 0x20, 0x0c, 0x54, 0x25, 0xc0, 0x52, 0x6a, 0xd5, 0x24, 0xd0, 0x6e,
+    0xe2, 0x81, 0x80, 0x1a, 0xef, 0x2e, 0x81, 0x22, 0x0f, 0xc5, 0x49, 0x32, 0xe1, 0x8c, 0x31, 0x4d,
+    0x17, 0x00, 0x3f, 0xff, 0x84, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd, 0xa4,
+    0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x4f, 0xff,
+    0xe1, 0x00, 0xb3, 0xe4, 0x03, 0xa8, 0x71, 0x9c, 0x00, 0x00, 0x01, 0xaf, 0xea, 0x10, 0x06, 0x2a,
+    0x12, 0xe0, 0x29, 0x35, 0x6a, 0x92, 0x68, 0x37, 0x71, 0x40, 0xc0, 0x0d, 0x77, 0x97, 0x40, 0x91,
+    0x19, 0x02, 0xa4, 0x99, 0x6e, 0x26, 0x18, 0xa6, 0x8b, 0x80, 0x01, 0xae, 0xe5, 0x08, 0x04, 0xbd,
+    0xc3, 0x00, 0x8e, 0xa5, 0xf4, 0x40, 0x3f, 0xff, 0x84, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f,
+    0xf8, 0x05, 0xdd, 0xa4, 0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8,
+    0x03, 0xf8, 0x4f, 0xff, 0xe1, 0x00, 0x3f, 0xcc, 0xac, 0x03, 0x4c, 0x1b, 0xf8, 0x00, 0x01, 0xaf,
+    0xea, 0x10, 0x06, 0x2a, 0x12, 0xe0, 0x29, 0x35, 0x6a, 0x92, 0x68, 0x37, 0x71, 0x40, 0xc0, 0x0d,
+    0x77, 0x97, 0x40, 0x91, 0x07, 0xe2, 0xa4, 0x99, 0x70, 0xc6, 0x18, 0xa6, 0x8b, 0x80, 0x01, 0xaf,
+    0xf5, 0x08, 0x00, 0x77, 0x4d, 0xc6, 0x00, 0x40, 0xb8, 0x53, 0x00, 0x00, 0x39, 0x02, 0x28, 0x06,
+    0xbb, 0x0c, 0x68, 0x06, 0xe7, 0xe1, 0x80, 0x0c, 0x5d, 0xba, 0x00, 0x8f, 0xfe, 0xdf, 0xf8, 0x40,
+    0x3f, 0x08, 0x00, 0xbf, 0xf8, 0x03, 0xff, 0x80, 0x5d, 0xda, 0x40, 0x30, 0x8e, 0x30, 0x08, 0xbf,
+    0xf5, 0x00, 0x7f, 0xf2, 0x4b, 0xff, 0x80, 0x3f, 0x84, 0xff, 0xdc, 0x39, 0xfe, 0x10, 0x08, 0x6f,
+    0x04, 0x03, 0x9a, 0xd0, 0x40, 0x00, 0x05, 0xe1, 0x2f, 0x20, 0x02, 0xa7, 0x6b, 0x90, 0x05, 0x5d,
+    0xc8, 0x00, 0x86, 0xbb, 0xe8, 0x40, 0x18, 0xa8, 0x4b, 0x80, 0xa4, 0xd5, 0xaa, 0x49, 0xa0, 0xdd,
+    0xc5, 0x03, 0x00, 0x35, 0xde, 0x5d, 0x02, 0x44, 0x1f, 0x8a, 0x92, 0x65, 0xc3, 0x18, 0x62, 0x9a,
+    0x2e, 0x00, 0x06, 0x9d, 0x20, 0x40, 0x34, 0x8c, 0x00, 0x76, 0xa7, 0x80, 0x00, 0x00, 0x84, 0xc0,
+    0x3d, 0xb8, 0xa0, 0x1c, 0xa2, 0xc0, 0x1d, 0x3c, 0x60, 0x03, 0xff, 0xf6, 0x80, 0x7c, 0x20, 0x02,
+    0xff, 0xd8, 0x01, 0xff, 0xc6, 0x2f, 0xfd, 0x00, 0x10, 0x8e, 0xf0, 0x01, 0x77, 0x67, 0x00, 0xff,
+    0xe6, 0x00, 0x00, 0x19, 0x00, 0x0b, 0x30, 0x00, 0x31, 0x50, 0x00, 0xf5, 0x80, 0x06, 0xff, 0x81,
+    0x90, 0x50, 0x38, 0x26, 0xb9, 0x82, 0x39, 0xc8, 0x09, 0x25, 0x02, 0xa8, 0x01, 0xff, 0xcd, 0x00,
+    0x00, 0x84, 0x70, 0x07, 0xb7, 0xba, 0x20, 0x0e, 0xfb, 0xb8, 0x80, 0x38, 0xd1, 0x20, 0x0e, 0x2a,
+    0xef, 0xd6, 0x00, 0x8f, 0x14, 0x40, 0xa6, 0xc0, 0x1c, 0x27, 0x9f, 0x40, 0x8a, 0x84, 0x1a, 0x60,
+    0xb2, 0x86, 0x60, 0x51, 0x00, 0x9a, 0xdb, 0xc0, 0xc0, 0x0f, 0xff, 0x67, 0x81, 0x80, 0x09, 0x0c,
+    0x00, 0x60, 0xa2, 0x0b, 0x76, 0x06, 0x42, 0x0a, 0x20, 0x49, 0x0f, 0x0e, 0x04, 0xdf, 0xb1, 0x55,
+    0x01, 0xea, 0x88, 0x14, 0x50, 0x00, 0x00, 0x08, 0xe0, 0x0d, 0xdd, 0x80, 0x35, 0xde, 0x00, 0xc8,
+    0x98, 0x02, 0x2c, 0xfc, 0x7f, 0xa0, 0xc3, 0x11, 0x40, 0x01, 0x84, 0xfb, 0x50, 0x01, 0xe1, 0x60,
+    0x0e, 0x00, 0xff, 0x78, 0x58, 0x03, 0x80, 0x0e, 0x27, 0xda, 0x80, 0x01, 0xd3, 0x11, 0x40, 0x00,
+    0x6e, 0xbf, 0x3c, 0x08, 0x56, 0x72, 0x9c, 0x28, 0x3d, 0x09, 0x4e, 0xc8, 0x00, 0xc4, 0x40, 0x0f,
+    0xdb, 0xa1, 0x00, 0xf8, 0xc8, 0x40, 0x3e, 0xcd, 0x00, 0xc7, 0xfa, 0x01, 0xb7, 0xd0, 0x03, 0xff,
+    0xa8, 0x5f, 0xf8, 0x80, 0x3f, 0xf8, 0x45, 0xff, 0x88, 0x03, 0xff, 0xbc, 0x00, 0x03, 0x10, 0x0e,
+    0x5c, 0xd0, 0x0e, 0x61, 0x50, 0x0e, 0x3e, 0x90, 0x0e, 0x4f, 0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18,
+    0x02, 0x48, 0x11, 0x49, 0x00, 0x5d, 0xe6, 0x08, 0x00, 0x31, 0x04, 0x01, 0x00, 0x38, 0x07, 0xff,
+    0x44, 0x3f, 0xd0, 0x0d, 0xbe, 0x80, 0x1f, 0xfd, 0x42, 0xff, 0xc4, 0x01, 0xff, 0xc2, 0x2f, 0xfc,
+    0x40, 0x1f, 0xfd, 0xe3, 0xfd, 0x00, 0xdb, 0xe8, 0x01, 0xb3, 0x40, 0x3f, 0x19, 0x08, 0x07, 0xdb,
+    0xa1, 0x00, 0x80, 0x4f, 0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18, 0x02, 0x48, 0x11, 0x49, 0x00, 0x5d,
+    0xe6, 0x08, 0x00, 0x31, 0x04, 0x01, 0x00, 0x38, 0x07, 0xff, 0x45, 0x3e, 0xc0, 0x11, 0xee, 0x01,
+    0x66, 0x88, 0x07, 0x19, 0x18, 0x07, 0x6e, 0x10, 0x00, 0x00, 0x8c, 0x00, 0x60, 0x1c, 0xf9, 0x0f,
+    0x90, 0x01, 0x88, 0x34, 0xc3, 0x80, 0x32, 0xfa, 0xa7, 0xb0, 0x00, 0xff, 0x40, 0x36, 0xfa, 0x00,
+    0x7f, 0xf5, 0x0b, 0xff, 0x10, 0x07, 0xff, 0x08, 0xbf, 0xf1, 0x00, 0x7f, 0xf7, 0x80, 0x13, 0x01,
+    0x30, 0x0d, 0xb8, 0x7b, 0x86, 0x01, 0x30, 0x92, 0x88, 0x80, 0x2a, 0xe1, 0x9e, 0x20, 0x0c, 0x9f,
+    0x60, 0x1f, 0xfc, 0xf7, 0xee, 0x30, 0x06, 0x48, 0x11, 0x49, 0x00, 0x6e, 0xf3, 0x04, 0x00, 0x8c,
+    0x41, 0x00, 0x40, 0x27, 0x00, 0xff, 0xea, 0x00, 0x3f, 0xd0, 0x0d, 0xbe, 0x80, 0x1f, 0xfd, 0x42,
+    0xff, 0xc4, 0x01, 0xff, 0xc2, 0x2f, 0xfc, 0x40, 0x1f, 0xfd, 0x63, 0x00, 0xf8, 0xd1, 0x80, 0x36,
+    0xfa, 0x04, 0x2b, 0x80, 0x7d, 0xa6, 0x80, 0x1e, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18,
+    0x02, 0x48, 0x11, 0x49, 0x00, 0x5d, 0xe6, 0x08, 0x00, 0x31, 0x04, 0x01, 0x00, 0x38, 0x07, 0xff,
+    0x2d, 0xc0, 0x39, 0x0e, 0x80, 0x11, 0xee, 0x1f, 0x0a, 0x01, 0x8b, 0x4d, 0xc0, 0x30, 0x3f, 0xd0,
+    0x0d, 0xbe, 0x80, 0x1f, 0xfd, 0x42, 0xff, 0xc4, 0x01, 0xff, 0xc2, 0x2f, 0xfc, 0x40, 0x1f, 0xfd,
+    0xe3, 0xfd, 0x10, 0x00, 0xef, 0xa0, 0x00, 0xf9, 0x55, 0xc6, 0x01, 0x8e, 0x6e, 0xd0, 0x60, 0x00,
+    0x4f, 0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18, 0x02, 0x48, 0x11, 0x49, 0x00, 0x5d, 0xe6, 0x08, 0x00,
+    0x31, 0x04, 0x01, 0x00, 0x38, 0x07, 0xff, 0x45, 0x3e, 0x80, 0x13, 0xee, 0x05, 0xcc, 0xbc, 0x80,
+    0x02, 0xa8, 0xa7, 0x40, 0x00, 0x03, 0xfd, 0x00, 0xff, 0xf9, 0x9f, 0xe8, 0x00, 0xbb, 0x1b, 0xc5,
+    0x4a, 0xe1, 0x44, 0x03, 0xe9, 0x00, 0x98, 0x54, 0x02, 0x5b, 0xd0, 0x09, 0x2e, 0x80, 0x3f, 0xfc,
+    0x29, 0xf6, 0x00, 0x3e, 0xc6, 0xf0, 0xa5, 0x48, 0x70, 0x00, 0x00, 0x0f, 0xd0, 0x05, 0x05, 0x40,
+    0x27, 0x1e, 0x61, 0xb8, 0x5d, 0x88, 0xc2, 0x4a, 0x2d, 0x5c, 0x33, 0xc4, 0x07, 0xfa, 0x01, 0xff,
+    0xf2, 0x00, 0x00, 0x84, 0x40, 0x11, 0x74, 0x80, 0x52, 0x90, 0x17, 0xb4, 0x3c, 0x2a, 0x46, 0xe2,
+    0x7f, 0xa5, 0x98, 0x21, 0x6f, 0xa3, 0x00, 0xff, 0xef, 0x80, 0x00, 0xe4, 0x40, 0x07, 0xc7, 0x78,
+    0x01, 0xf4, 0x1c, 0x00, 0x7d, 0x78, 0x01, 0x8f, 0xf4, 0x02, 0x8f, 0xe1, 0x00, 0xe4, 0x70, 0xd1,
+    0x00, 0xc5, 0x61, 0x26, 0x01, 0xde, 0x0c, 0xc0, 0x0e, 0xa2, 0x24, 0x80, 0x71, 0x28, 0x10, 0x80,
+    0x78, 0x50, 0x28, 0x03, 0xd5, 0x40, 0x45, 0x00, 0xc4, 0x83, 0x21, 0x60, 0x1f, 0x31, 0x8c, 0x80,
+    0x7d, 0xe0, 0xc6, 0x00, 0x00, 0x22, 0x00, 0x39, 0x6c, 0xc0, 0x3a, 0x11, 0xc0, 0x3b, 0x6c, 0x03,
+    0x93, 0xec, 0x03, 0xff, 0x9a, 0x5f, 0xe4, 0x00, 0x87, 0x02, 0x50, 0x00, 0xfa, 0x2c, 0xc0, 0x08,
+    0xcc, 0x12, 0x01, 0xf3, 0x80, 0x62, 0xc0, 0x82, 0x00, 0x98, 0xdc, 0x38, 0x03, 0xa0, 0x8d, 0xc0,
+    0x3f, 0xd0, 0x0a, 0x3f, 0x84, 0x03, 0x91, 0xc3, 0x44, 0x03, 0x15, 0x84, 0x98, 0x07, 0x78, 0x33,
+    0x00, 0x3a, 0x88, 0x92, 0x01, 0xc4, 0xa0, 0x42, 0x01, 0xe1, 0x40, 0xa0, 0x0f, 0x55, 0x01, 0x14,
+    0x03, 0x12, 0x0c, 0x85, 0x80, 0x7c, 0xc6, 0x32, 0x01, 0xf7, 0x83, 0x19, 0xbf, 0x40, 0x23, 0xff,
+    0x18, 0x04, 0x5d, 0x40, 0x1f, 0x30, 0xb8, 0x07, 0xc9, 0x98, 0x00, 0xc0, 0x4f, 0xb0, 0x0f, 0xfe,
+    0x69, 0x7f, 0x90, 0x02, 0x1c, 0x09, 0x40, 0x03, 0xe8, 0xb3, 0x00, 0x23, 0x30, 0x48, 0x07, 0xce,
+    0x01, 0x8b, 0x02, 0x08, 0x02, 0x63, 0x70, 0xe0, 0x0e, 0x82, 0x37, 0x4f, 0xb0, 0x06, 0xfb, 0x80,
+    0x5b, 0x80, 0x1c, 0x24, 0x60, 0x1c, 0x39, 0xa0, 0x10, 0x3f, 0xd0, 0x0a, 0x3f, 0x84, 0x03, 0x91,
+    0xc3, 0x44, 0x03, 0x15, 0x84, 0x98, 0x07, 0x78, 0x33, 0x00, 0x3a, 0x88, 0x92, 0x01, 0xc4, 0xa0,
+    0x42, 0x01, 0xe1, 0x40, 0xa0, 0x0f, 0x55, 0x01, 0x14, 0x03, 0x12, 0x0c, 0x85, 0x80, 0x7c, 0xc6,
+    0x32, 0x01, 0xf7, 0x83, 0x19, 0xbf, 0x44, 0x62, 0xff, 0x18, 0x00, 0xbb, 0xad, 0x00, 0xe2, 0xbb,
+    0xbc, 0x02, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x69, 0x7f, 0x90, 0x02, 0x1c, 0x09, 0x40, 0x03, 0xe8,
+    0xb3, 0x00, 0x23, 0x30, 0x48, 0x07, 0xce, 0x01, 0x8b, 0x02, 0x08, 0x02, 0x63, 0x70, 0xe0, 0x0e,
+    0x82, 0x37, 0x4f, 0xa1, 0x16, 0x7b, 0x80, 0x3b, 0xb0, 0x06, 0xbb, 0xc0, 0x00, 0x3f, 0xd0, 0x0f,
+    0xff, 0xd9, 0x7f, 0xe7, 0x00, 0xfb, 0xcf, 0xff, 0xd0, 0x01, 0x6e, 0x80, 0x38, 0x48, 0x82, 0x01,
+    0x87, 0x74, 0x20, 0x00, 0x4f, 0xb0, 0x0f, 0xfe, 0x92, 0x7d, 0x9f, 0x4b, 0x0a, 0xaa, 0xf4, 0x01,
+    0x1c, 0x01, 0x8b, 0xba, 0xd0, 0x0c, 0x57, 0x77, 0x80, 0x72, 0x24, 0x60, 0x1c, 0x7f, 0xa0, 0x1f,
+    0xff, 0xf0, 0x0e, 0x2f, 0xfc, 0xe0, 0x1f, 0xbc, 0x0f, 0xff, 0xd0, 0x01, 0xb7, 0x40, 0x1e, 0x12,
+    0x20, 0x80, 0x70, 0xee, 0x84, 0x00, 0x00, 0x01, 0x1c, 0x9d, 0xd5, 0x2d, 0xdd, 0x02, 0x89, 0x18,
+    0x27, 0xd8, 0x07, 0xff, 0xa1, 0x3e, 0xc0, 0x07, 0xd2, 0x00, 0x61, 0x50, 0x02, 0xde, 0x80, 0x3f,
+    0xd0, 0x0f, 0xff, 0xd9, 0x7f, 0xe7, 0x00, 0xfb, 0xcf, 0xfb, 0xb7, 0xc0, 0x03, 0xbb, 0x00, 0x6b,
+    0xbc, 0x00, 0x00, 0x04, 0xfb, 0x00, 0xff, 0xf4, 0x2f, 0x50, 0xa7, 0x75, 0x4b, 0x77, 0x40, 0x3f,
+    0xd0, 0x0f, 0xff, 0xd9, 0x7f, 0xe7, 0x00, 0xfb, 0xcf, 0xff, 0xd0, 0x00, 0x4f, 0xf1, 0x80, 0x45,
+    0x4e, 0xed, 0x20, 0x00, 0x04, 0xfb, 0x00, 0xff, 0xf9, 0xa7, 0xd8, 0x05, 0x1f, 0xa2, 0x0a, 0xf6,
+    0x3a, 0x00, 0x00, 0xf1, 0x29, 0x00, 0x7f, 0x75, 0x98, 0x07, 0xe4, 0x3a, 0x10, 0x0f, 0xc9, 0xe8,
+    0x01, 0x8f, 0xfe, 0x00, 0xcf, 0xfe, 0xc0, 0x0c, 0xa0, 0x15, 0x80, 0x7d, 0xe0, 0x02, 0x30, 0x0e,
+    0x20, 0x50, 0x02, 0x81, 0x80, 0x61, 0x40, 0x40, 0xb0, 0x40, 0x0c, 0x3a, 0x1a, 0x26, 0x3a, 0x01,
+    0xce, 0x0e, 0x80, 0xe0, 0x1e, 0x13, 0x19, 0x0d, 0x00, 0xfa, 0x80, 0xc5, 0x00, 0x3e, 0x70, 0x03,
+    0x80, 0x7e, 0x13, 0x0d, 0x00, 0xc0, 0x00, 0xf5, 0xf9, 0x00, 0x7e, 0x34, 0x92, 0x00, 0xfc, 0x36,
+    0xc0, 0x19, 0x3e, 0xa3, 0xf0, 0x17, 0xbe, 0x40, 0x25, 0x43, 0x1b, 0xb2, 0x83, 0x30, 0x00, 0x39,
+    0x81, 0x0a, 0xb8, 0x0f, 0x00, 0x28, 0x00, 0x81, 0x80, 0x80, 0xc0, 0x3f, 0xfc, 0x80, 0x00, 0xe1,
+    0x30, 0x0f, 0xf6, 0xe2, 0x00, 0x7f, 0x28, 0xb0, 0x07, 0xf4, 0xf1, 0x00, 0x63, 0xff, 0x80, 0x33,
+    0xff, 0xb0, 0x03, 0x28, 0x05, 0x60, 0x1f, 0x78, 0x00, 0x8c, 0x03, 0x88, 0x14, 0x00, 0xa0, 0x60,
+    0x18, 0x50, 0x10, 0x2c, 0x10, 0x03, 0x0e, 0x86, 0x89, 0x8e, 0x80, 0x73, 0x83, 0xa0, 0x38, 0x07,
+    0x84, 0xc6, 0x43, 0x40, 0x3e, 0xa0, 0x31, 0x40, 0x0f, 0x9c, 0x00, 0xe0, 0x1f, 0x84, 0xc3, 0x40,
+    0x30, 0x00, 0xea, 0xe2, 0x00, 0xfe, 0x71, 0x10, 0x07, 0xf6, 0x60, 0xc0, 0x32, 0x7d, 0x47, 0xf9,
+    0xd7, 0xbe, 0x40, 0x25, 0x43, 0x1b, 0xb2, 0x83, 0x30, 0x00, 0x39, 0x81, 0x0a, 0xb8, 0x0f, 0x00,
+    0x28, 0x00, 0x81, 0x80, 0x80, 0xc0, 0x3f, 0xfc, 0x80, 0x3f, 0xf8, 0x03, 0x3f, 0xfb, 0x00, 0x32,
+    0x80, 0x56, 0x01, 0xf7, 0x80, 0x08, 0xc0, 0x38, 0x81, 0x40, 0x0a, 0x06, 0x01, 0x85, 0x01, 0x02,
+    0xc1, 0x00, 0x30, 0xe8, 0x68, 0x98, 0xe8, 0x07, 0x38, 0x3a, 0x03, 0x80, 0x78, 0x4c, 0x64, 0x34,
+    0x03, 0xea, 0x03, 0x14, 0x00, 0xf9, 0xc0, 0x0e, 0x01, 0xf8, 0x4c, 0x34, 0x03, 0x1f, 0xe8, 0x03,
+    0x3d, 0x01, 0x7f, 0x00, 0x3a, 0x78, 0x80, 0x3f, 0x94, 0x58, 0x03, 0xfb, 0x6d, 0x00, 0x30, 0x4f,
+    0xa8, 0xfe, 0x45, 0xef, 0x90, 0x09, 0x50, 0xc6, 0xec, 0xa0, 0xcc, 0x00, 0x0e, 0x60, 0x42, 0xae,
+    0x03, 0xc0, 0x0a, 0x00, 0x20, 0x60, 0x20, 0x30, 0x0f, 0xff, 0x22, 0x7d, 0x80, 0x33, 0xc8, 0x17,
+    0xe8, 0x03, 0xab, 0x88, 0x03, 0xf9, 0xc4, 0x40, 0x1f, 0xd9, 0x83, 0x00, 0xc0, 0x00, 0xc4, 0x40,
+    0x0f, 0xdb, 0xa2, 0x00, 0xf8, 0xc8, 0xc0, 0x3e, 0xcd, 0x10, 0x08, 0xff, 0xc8, 0x01, 0x5f, 0xb0,
+    0x05, 0x20, 0x1f, 0xc4, 0xc0, 0x1f, 0x08, 0x40, 0x80, 0x78, 0xd8, 0x60, 0x03, 0xe8, 0x06, 0x20,
+    0x0f, 0x0c, 0x04, 0x80, 0x7c, 0xe4, 0x8a, 0x01, 0xf4, 0x80, 0x80, 0x7c, 0x88, 0x00, 0xfe, 0x90,
+    0x08, 0x00, 0xb3, 0x44, 0x03, 0x8c, 0x8c, 0x03, 0xb7, 0x08, 0x00, 0x9f, 0x75, 0x9c, 0xc0, 0x12,
+    0x31, 0x0c, 0x90, 0x00, 0x7b, 0x50, 0x10, 0x00, 0x40, 0x03, 0x01, 0x00, 0x38, 0x07, 0xff, 0x44,
+    0x3f, 0xf2, 0x00, 0x57, 0xec, 0x01, 0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36,
+    0x18, 0x00, 0xfa, 0x01, 0x88, 0x03, 0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20,
+    0x1f, 0x22, 0x00, 0x3f, 0xa4, 0x02, 0x3f, 0xd0, 0x08, 0xbf, 0xcc, 0x01, 0xb3, 0x44, 0x03, 0xe3,
+    0x23, 0x00, 0xfb, 0x70, 0x80, 0x20, 0x4f, 0xb8, 0xfe, 0x60, 0x09, 0x18, 0x86, 0x48, 0x00, 0x3d,
+    0xa8, 0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x9f, 0x60, 0x08, 0xf7, 0x00,
+    0xb3, 0x44, 0x03, 0x8c, 0x8c, 0x03, 0xb7, 0x08, 0x00, 0x00, 0x3f, 0xf2, 0x00, 0x57, 0xec, 0x01,
+    0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36, 0x18, 0x00, 0xfa, 0x01, 0x88, 0x03,
+    0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20, 0x1f, 0x22, 0x00, 0x3f, 0xa4, 0x02,
+    0x3f, 0xd1, 0x18, 0xff, 0xcc, 0x01, 0x7f, 0x74, 0x20, 0x1d, 0x57, 0x70, 0x80, 0x00, 0x4f, 0xb8,
+    0xfe, 0x60, 0x09, 0x18, 0x86, 0x48, 0x00, 0x3d, 0xa8, 0x08, 0x00, 0x20, 0x01, 0x80, 0x80, 0x1c,
+    0x03, 0xff, 0xa2, 0x9f, 0x42, 0x29, 0xf7, 0x00, 0x7f, 0x74, 0x20, 0x15, 0x5d, 0xc2, 0x00, 0x3f,
+    0xf2, 0x00, 0x57, 0xec, 0x01, 0x48, 0x07, 0xf1, 0x30, 0x07, 0xc2, 0x10, 0x20, 0x1e, 0x36, 0x18,
+    0x00, 0xfa, 0x01, 0x88, 0x03, 0xc3, 0x01, 0x20, 0x1f, 0x39, 0x22, 0x80, 0x7d, 0x20, 0x20, 0x1f,
+    0x22, 0x00, 0x3f, 0xa4, 0x02, 0x3f, 0xd0, 0x08, 0xbf, 0xcc, 0x01, 0x1f, 0xf9, 0x00, 0x38, 0x75,
+    0xa2, 0xc8, 0x00, 0x00, 0x4f, 0xb8, 0xfe, 0x60, 0x09, 0x18, 0x86, 0x48, 0x00, 0x3d, 0xa8, 0x08,
+    0x00, 0x20, 0x01, 0x80, 0x80, 0x1c, 0x03, 0xff, 0xa2, 0x9f, 0x60, 0x08, 0xf7, 0x00, 0x17, 0xf9,
+    0x40, 0x21, 0xc6, 0x9a, 0x30, 0x00, 0x00, 0xeb, 0xe1, 0x00, 0xf8, 0xd2, 0x84, 0x03, 0xe3, 0xe4,
+    0x00, 0xfa, 0x79, 0x2a, 0x00, 0x3c, 0xd1, 0x6b, 0x60, 0x1e, 0xc6, 0xee, 0x18, 0x07, 0x14, 0xf7,
+    0xeb, 0x00, 0x63, 0xd5, 0x10, 0x39, 0x90, 0x05, 0xc0, 0x7b, 0xd2, 0x0c, 0x80, 0x84, 0x1a, 0x42,
+    0xce, 0x1e, 0x06, 0x0a, 0x20, 0x15, 0x82, 0x87, 0x81, 0x80, 0x62, 0x01, 0x0f, 0x03, 0x00, 0xc4,
+    0x02, 0x06, 0x08, 0x01, 0xac, 0x14, 0x10, 0x86, 0xc8, 0x59, 0xc3, 0x80, 0x1c, 0x09, 0xbd, 0x20,
+    0xca, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x00, 0x00, 0xdb, 0xa0, 0x0e, 0x62, 0xf0, 0x0e, 0x7e,
+    0x20, 0x0d, 0x78, 0xb8, 0xa0, 0x03, 0x4b, 0xb1, 0x20, 0x00, 0xf5, 0xbf, 0xc2, 0x00, 0x18, 0xef,
+    0xa2, 0x00, 0x62, 0x80, 0xa6, 0x0a, 0x91, 0x3b, 0x88, 0x2d, 0xa1, 0x40, 0x0e, 0x0d, 0x10, 0x0f,
+    0xb0, 0x2c, 0x01, 0xc1, 0xaa, 0x47, 0xda, 0x82, 0xc1, 0x8a, 0x04, 0x98, 0x20, 0x00, 0x17, 0x42,
+    0x7a, 0x80, 0x78, 0x40, 0x23, 0x00, 0xe2, 0xf8, 0x4f, 0x60, 0x0f, 0x4f, 0x25, 0x40, 0x07, 0x0b,
+    0x5d, 0x2d, 0x80, 0x70, 0xea, 0xf7, 0x0c, 0x03, 0x8a, 0x3b, 0xf5, 0x80, 0x31, 0xea, 0x88, 0x1c,
+    0xc8, 0x02, 0xe0, 0x3d, 0xe9, 0x06, 0x40, 0x42, 0x0d, 0x21, 0x67, 0x0f, 0x03, 0x05, 0x10, 0x0a,
+    0xc1, 0x43, 0xc0, 0xc0, 0x31, 0x00, 0x87, 0x81, 0x80, 0x62, 0x01, 0x03, 0x04, 0x00, 0xd6, 0x0a,
+    0x08, 0x43, 0x64, 0x2c, 0xe1, 0xc0, 0x0e, 0x04, 0xde, 0x90, 0x65, 0x00, 0x1e, 0xa8, 0x81, 0xcc,
+    0x80, 0x00, 0x04, 0xf5, 0x6f, 0x30, 0x0c, 0x60, 0x07, 0x00, 0x27, 0xb3, 0x3d, 0x00, 0x2c, 0xd3,
+    0xc5, 0x00, 0x19, 0x5e, 0x12, 0x00, 0x0b, 0x1b, 0xbc, 0x40, 0x28, 0xee, 0x51, 0x00, 0x31, 0x40,
+    0x53, 0x05, 0x48, 0x9d, 0xc4, 0x16, 0xd0, 0xa0, 0x07, 0x06, 0x88, 0x07, 0xd8, 0x16, 0x00, 0xe0,
+    0xd5, 0x23, 0xed, 0x41, 0x60, 0xc5, 0x02, 0x4c, 0x10, 0x00, 0xab, 0xc4, 0x03, 0xf5, 0x14, 0x00,
+    0x7e, 0x1f, 0xa1, 0x00, 0xfa, 0xb7, 0x38, 0xc0, 0x3d, 0x17, 0x71, 0x00, 0x78, 0xd1, 0x21, 0x00,
+    0xe2, 0xae, 0xfc, 0x60, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a, 0x41, 0x90, 0x10,
+    0x83, 0x48, 0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c, 0x40, 0x21, 0xe0,
+    0x60, 0x18, 0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38, 0x70, 0x03, 0x81,
+    0x37, 0xa4, 0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x00, 0x00, 0x66, 0x80, 0x7b, 0x89, 0x80,
+    0x38, 0xf1, 0x44, 0x03, 0x7e, 0x63, 0x80, 0x35, 0x5d, 0xc0, 0x19, 0x13, 0x00, 0x43, 0x5d, 0xf6,
+    0x40, 0x0c, 0x50, 0x14, 0xc1, 0x52, 0x27, 0x71, 0x05, 0xb4, 0x28, 0x01, 0xc1, 0xa2, 0x01, 0xf6,
+    0x05, 0x80, 0x38, 0x35, 0x48, 0xfb, 0x50, 0x58, 0x31, 0x40, 0x93, 0x04, 0x00, 0xe9, 0xf2, 0x00,
+    0xf8, 0x5a, 0x88, 0x03, 0xc2, 0x78, 0x80, 0x1f, 0x56, 0xe7, 0x18, 0x07, 0xa2, 0xee, 0x30, 0x0f,
+    0x1a, 0x24, 0x01, 0xe2, 0xae, 0xfc, 0x60, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a,
+    0x41, 0x90, 0x10, 0x83, 0x48, 0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c,
+    0x40, 0x21, 0xe0, 0x60, 0x18, 0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38,
+    0x70, 0x03, 0x81, 0x37, 0xa4, 0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x00, 0x00, 0xd9, 0xc2,
+    0x01, 0x90, 0xf4, 0x40, 0x21, 0x7c, 0x20, 0x0d, 0xf9, 0x8e, 0x00, 0xd5, 0x77, 0x00, 0x64, 0x4c,
+    0x01, 0x0d, 0x77, 0xd9, 0x00, 0x31, 0x40, 0x53, 0x05, 0x48, 0x9d, 0xc4, 0x16, 0xd0, 0xa0, 0x07,
+    0x06, 0x88, 0x07, 0xd8, 0x16, 0x00, 0xe0, 0xd5, 0x23, 0xed, 0x41, 0x60, 0xc5, 0x02, 0x4c, 0x10,
+    0x00, 0xc2, 0xa4, 0x01, 0xeb, 0xa0, 0x0f, 0x1a, 0xd1, 0x00, 0x71, 0xfa, 0x80, 0x47, 0xff, 0xba,
+    0x84, 0x03, 0x08, 0xcb, 0x80, 0x11, 0x77, 0x34, 0x49, 0x40, 0x38, 0x9c, 0x08, 0x03, 0x89, 0xc0,
+    0x80, 0x05, 0xdc, 0xd1, 0x25, 0x00, 0x84, 0x65, 0xc0, 0x08, 0xbf, 0xdd, 0x42, 0x01, 0xff, 0xd0,
+    0x00, 0x00, 0xcf, 0xea, 0x01, 0xd2, 0xca, 0x01, 0x86, 0xe4, 0x00, 0x9f, 0x76, 0xae, 0x60, 0x09,
+    0x1d, 0x46, 0x54, 0x00, 0x3b, 0x52, 0x12, 0x00, 0x40, 0x03, 0x81, 0x00, 0x04, 0x00, 0x60, 0x19,
+    0x08, 0x14, 0x08, 0x02, 0xdd, 0x40, 0x48, 0x01, 0x1c, 0x86, 0x54, 0x02, 0x8f, 0xe6, 0x00, 0xff,
+    0xe2, 0x80, 0x00, 0x85, 0x00, 0x3e, 0xab, 0x60, 0x0f, 0x18, 0x10, 0x07, 0xa3, 0xd0, 0x02, 0x3f,
+    0xfd, 0xd4, 0x20, 0x18, 0x46, 0x5c, 0x00, 0x8b, 0xb9, 0xa2, 0x4a, 0x01, 0xc4, 0xe0, 0x40, 0x1c,
+    0x4e, 0x04, 0x00, 0x2e, 0xe6, 0x89, 0x28, 0x04, 0x23, 0x2e, 0x00, 0x45, 0xfe, 0xea, 0x10, 0x0f,
+    0xfe, 0x80, 0x00, 0x9f, 0xd0, 0x03, 0xb4, 0x08, 0x03, 0xae, 0xcc, 0x00, 0x4f, 0xbb, 0xb9, 0x80,
+    0x24, 0x75, 0x19, 0x50, 0x00, 0xed, 0x48, 0x48, 0x01, 0x00, 0x0e, 0x04, 0x00, 0x10, 0x01, 0x80,
+    0x64, 0x20, 0x50, 0x20, 0x0b, 0x75, 0x01, 0x20, 0x04, 0x72, 0x19, 0x50, 0x0a, 0x3f, 0x98, 0x03,
+    0xff, 0x8a, 0x00, 0x00, 0xc8, 0x01, 0xf4, 0x5c, 0x80, 0x7b, 0x43, 0xc0, 0x3c, 0xbe, 0xc0, 0x11,
+    0xff, 0xee, 0xa2, 0x00, 0xc2, 0x32, 0xe0, 0x80, 0x0b, 0xba, 0x21, 0x70, 0x0e, 0x15, 0x0e, 0x00,
+    0xf2, 0x07, 0x00, 0x0b, 0x75, 0xe6, 0x2c, 0x01, 0x11, 0x00, 0x7c, 0x02, 0x2f, 0xe0, 0x13, 0x00,
+    0xe1, 0x60, 0x80, 0x0f, 0x58, 0x28, 0x80, 0x71, 0x20, 0x40, 0x01, 0xeb, 0x00, 0x8c, 0x54, 0x02,
+    0x2c, 0xc0, 0x01, 0x3e, 0x27, 0xc0, 0x24, 0x41, 0x80, 0x6e, 0xc0, 0x08, 0xc4, 0x03, 0x38, 0x07,
+    0xff, 0x24, 0x3f, 0xfd, 0xd4, 0x40, 0x18, 0x46, 0x5c, 0x10, 0x01, 0x77, 0x44, 0x2e, 0x01, 0xc2,
+    0xa1, 0xc0, 0x1e, 0x40, 0xe0, 0x01, 0x6e, 0xbc, 0xc5, 0x80, 0x22, 0x20, 0x0f, 0x80, 0x45, 0xfc,
+    0x02, 0x60, 0x1c, 0x2c, 0x10, 0x01, 0xeb, 0x05, 0x10, 0x0e, 0x24, 0x08, 0x3f, 0xd0, 0x0a, 0xfe,
+    0x40, 0x24, 0xf7, 0x00, 0xf1, 0x86, 0x80, 0x79, 0xee, 0x80, 0x20, 0x4f, 0xbb, 0x78, 0x04, 0x88,
+    0x30, 0x0d, 0xd8, 0x01, 0x18, 0x80, 0x67, 0x00, 0xff, 0xe4, 0xa7, 0xd8, 0x04, 0x7d, 0x20, 0x13,
+    0x0a, 0x80, 0x4b, 0x7a, 0x01, 0x00, 0x00, 0x84, 0x60, 0x0e, 0x7e, 0xea, 0x00, 0x32, 0xdd, 0xd4,
+    0x01, 0x89, 0x12, 0x20, 0x01, 0xff, 0xee, 0xa2, 0x00, 0xc2, 0x32, 0xe0, 0x80, 0x0b, 0xba, 0x21,
+    0x70, 0x0e, 0x15, 0x0e, 0x00, 0xf2, 0x07, 0x00, 0x0b, 0x75, 0xe6, 0x2c, 0x01, 0x11, 0x00, 0x7c,
+    0x02, 0x2f, 0xe0, 0x13, 0x00, 0xe1, 0x60, 0x80, 0x0f, 0x58, 0x28, 0x80, 0x71, 0x20, 0x41, 0xfe,
+    0x80, 0x57, 0xf2, 0x01, 0x27, 0xb8, 0x07, 0x8c, 0x34, 0x03, 0xcf, 0x74, 0x01, 0x00, 0x01, 0x1c,
+    0x03, 0xdd, 0x60, 0x0d, 0xdd, 0x20, 0x97, 0xfe, 0xb0, 0x09, 0x10, 0x60, 0x1b, 0xb0, 0x02, 0x31,
+    0x00, 0xce, 0x01, 0xff, 0xc9, 0x4f, 0xb0, 0x08, 0xfa, 0x40, 0x26, 0x15, 0x00, 0x96, 0xf4, 0x02,
+    0x00, 0x3f, 0xfd, 0xd4, 0x40, 0x18, 0x46, 0x5c, 0x10, 0x01, 0x77, 0x44, 0x2e, 0x01, 0xc2, 0xa1,
+    0xc0, 0x1e, 0x40, 0xe0, 0x01, 0x6e, 0xbc, 0xc5, 0x80, 0x22, 0x20, 0x0f, 0x80, 0x45, 0xfc, 0x02,
+    0x60, 0x1c, 0x2c, 0x10, 0x01, 0xeb, 0x05, 0x10, 0x0e, 0x24, 0x08, 0x3f, 0xd1, 0x1a, 0xfe, 0x40,
+    0x0d, 0xdd, 0x48, 0x06, 0x7b, 0xbc, 0x00, 0x00, 0x04, 0xfb, 0xb7, 0x80, 0x64, 0x41, 0x80, 0x77,
+    0x60, 0x06, 0x31, 0x00, 0xe7, 0x00, 0xff, 0xe6, 0xaf, 0x50, 0x80, 0x13, 0xba, 0xa0, 0x02, 0xdd,
+    0xd0, 0x00, 0x00, 0x00, 0xc8, 0x01, 0xf4, 0x5c, 0x80, 0x7b, 0x43, 0xc0, 0x3c, 0xbe, 0xc0, 0x1d,
+    0x1d, 0xfb, 0x00, 0x16, 0x38, 0x88, 0x9e, 0xc0, 0xcc, 0x1b, 0xda, 0x28, 0x6e, 0x02, 0x40, 0x55,
+    0x02, 0x82, 0x2d, 0x84, 0x43, 0x90, 0x61, 0x93, 0xdf, 0xb8, 0x00, 0xb3, 0xa9, 0x42, 0x15, 0x56,
+    0xc2, 0xb4, 0xe1, 0x80, 0x90, 0x40, 0x03, 0x01, 0x52, 0x1d, 0xef, 0x40, 0xa0, 0xc7, 0x21, 0x12,
+    0xe9, 0x00, 0x00, 0x27, 0xc0, 0x06, 0x20, 0x30, 0x0c, 0xd7, 0x40, 0x12, 0xed, 0xe3, 0x81, 0xd1,
+    0x30, 0x43, 0x28, 0x2c, 0xfa, 0x82, 0x02, 0xec, 0x7b, 0x16, 0xb8, 0xad, 0x4a, 0xde, 0x62, 0xc1,
+    0x05, 0xaa, 0x64, 0x0e, 0x94, 0x4c, 0x6d, 0x40, 0x00, 0x47, 0x7e, 0xc0, 0x05, 0x8e, 0x22, 0x27,
+    0xb0, 0x33, 0x06, 0xf6, 0x8a, 0x1b, 0x80, 0x90, 0x15, 0x40, 0xa0, 0x8b, 0x61, 0x10, 0xe4, 0x18,
+    0x64, 0xf7, 0xee, 0x00, 0x2c, 0xea, 0x50, 0x85, 0x55, 0xb0, 0xad, 0x38, 0x60, 0x24, 0x10, 0x00,
+    0xc0, 0x54, 0x87, 0x7b, 0xd0, 0x28, 0x31, 0xc8, 0x44, 0xba, 0x40, 0x31, 0xbf, 0xd4, 0x40, 0x19,
+    0x3d, 0xc0, 0x3c, 0x61, 0xa0, 0x1e, 0x7b, 0xa0, 0x08, 0x05, 0xdf, 0xd7, 0x03, 0xa2, 0x60, 0x86,
+    0x50, 0x59, 0xf5, 0x04, 0x05, 0xd8, 0xf6, 0x2d, 0x71, 0x5a, 0x95, 0xbc, 0xc5, 0x82, 0x0b, 0x54,
+    0xc8, 0x1d, 0x28, 0x98, 0xda, 0x81, 0x73, 0xfa, 0x40, 0x24, 0xf8, 0x00, 0xc4, 0x06, 0x01, 0x9a,
+    0xe8, 0x00, 0x00, 0x00, 0x3f, 0x08, 0x07, 0x8d, 0x0b, 0xd0, 0x03, 0x25, 0x52, 0x10, 0x03, 0xd2,
+    0xe0, 0x1d, 0x1d, 0xfb, 0x00, 0x16, 0x38, 0x88, 0x9e, 0xc0, 0xcc, 0x1b, 0xda, 0x28, 0x6e, 0x02,
+    0x40, 0x55, 0x02, 0x82, 0x2d, 0x84, 0x43, 0x90, 0x61, 0x93, 0xdf, 0xb8, 0x00, 0xb3, 0xa9, 0x42,
+    0x15, 0x56, 0xc2, 0xb4, 0xe1, 0x80, 0x90, 0x40, 0x03, 0x01, 0x52, 0x1d, 0xef, 0x40, 0xa0, 0xc7,
+    0x21, 0x12, 0xe9, 0x00, 0x00, 0xfe, 0x3f, 0x70, 0x0f, 0xf8, 0xfd, 0xc0, 0x38, 0xff, 0x00, 0x37,
+    0x0e, 0x80, 0x43, 0x38, 0x20, 0x05, 0xcb, 0xf7, 0x03, 0xa2, 0x60, 0x86, 0x50, 0x59, 0xf5, 0x04,
+    0x05, 0xd8, 0xf6, 0x2d, 0x71, 0x5a, 0x95, 0xbc, 0xc5, 0x82, 0x0b, 0x54, 0xc8, 0x1d, 0x28, 0x98,
+    0xda, 0x80, 0x00, 0x93, 0xd8, 0x03, 0xc4, 0x02, 0x01, 0xcc, 0x3c, 0x2e, 0x01, 0x8a, 0x26, 0x44,
+    0x01, 0x91, 0x9d, 0x54, 0x01, 0xd3, 0xf4, 0x01, 0xd1, 0xdf, 0xd2, 0x20, 0x0c, 0x71, 0x19, 0xb0,
+    0x0c, 0xc1, 0xbd, 0xc3, 0x24, 0x70, 0x12, 0x01, 0xcf, 0x44, 0x08, 0xb6, 0x10, 0x03, 0x61, 0x93,
+    0xdf, 0xb8, 0x00, 0xb3, 0xa9, 0x42, 0x15, 0xb6, 0x05, 0x69, 0xc3, 0x0c, 0x98, 0x80, 0x06, 0x02,
+    0xa6, 0x3b, 0xde, 0x81, 0x41, 0x8e, 0x42, 0x25, 0xd2, 0x00, 0x00, 0x84, 0x03, 0x93, 0xa4, 0x03,
+    0x38, 0x70, 0x04, 0xd9, 0x8b, 0xb0, 0x01, 0x97, 0x06, 0x80, 0x2a, 0xed, 0x10, 0x02, 0xef, 0x6b,
+    0x81, 0xd1, 0x30, 0x43, 0x28, 0x2c, 0xfa, 0x82, 0x02, 0xec, 0x7b, 0x16, 0xb8, 0xad, 0x4a, 0xde,
+    0x62, 0xc1, 0x05, 0xaa, 0x64, 0x0e, 0x94, 0x4c, 0x6d, 0x40, 0x00, 0xc8, 0x01, 0xf4, 0x5c, 0x80,
+    0x7b, 0x43, 0xc0, 0x3c, 0xbe, 0xc0, 0x1d, 0x1d, 0xfb, 0x00, 0x16, 0x38, 0x88, 0x9e, 0xc0, 0xcc,
+    0x1b, 0xda, 0x28, 0x6e, 0x02, 0x40, 0x55, 0x02, 0x82, 0x2d, 0x84, 0x43, 0x90, 0x61, 0x93, 0xdf,
+    0xb8, 0x00, 0xb3, 0xa9, 0x42, 0x15, 0x56, 0xc2, 0xb4, 0xe1, 0x80, 0x90, 0x40, 0x03, 0x01, 0x52,
+    0x1d, 0xef, 0x40, 0xa0, 0xc7, 0x21, 0x12, 0xe9, 0x00, 0xc6, 0xff, 0x51, 0x00, 0x64, 0xf7, 0x00,
+    0xf1, 0x86, 0x80, 0x79, 0xee, 0x80, 0x20, 0x00, 0x27, 0xc0, 0x06, 0x20, 0x30, 0x0c, 0xd7, 0x40,
+    0x12, 0xed, 0xe3, 0x81, 0xd1, 0x30, 0x43, 0x28, 0x2c, 0xfa, 0x82, 0x02, 0xec, 0x7b, 0x16, 0xb8,
+    0xad, 0x4a, 0xde, 0x62, 0xc1, 0x05, 0xaa, 0x64, 0x0e, 0x94, 0x4c, 0x6d, 0x40, 0xb9, 0xfd, 0x20,
+    0x12, 0x7c, 0x00, 0x62, 0x03, 0x00, 0xcd, 0x74, 0x00, 0x00, 0x00, 0xc8, 0x01, 0xf4, 0xdb, 0x80,
+    0x7b, 0xc0, 0x80, 0x3c, 0xde, 0xa0, 0x15, 0xff, 0xfd, 0x22, 0x01, 0xfa, 0xbf, 0xcc, 0x0f, 0xfe,
+    0x90, 0x0f, 0xff, 0xe0, 0x01, 0x40, 0x0a, 0xec, 0xc0, 0x0d, 0x02, 0x00, 0x3f, 0xa0, 0x02, 0xbd,
+    0x80, 0x3d, 0xca, 0x13, 0xae, 0x20, 0x49, 0x28, 0x17, 0x20, 0x1f, 0xf1, 0x80, 0x61, 0x08, 0x90,
+    0x93, 0x14, 0x00, 0xbf, 0xff, 0xa4, 0x40, 0x3f, 0x57, 0xf9, 0x81, 0xff, 0xd2, 0x01, 0xff, 0xff,
+    0x9f, 0x80, 0x0f, 0x3f, 0xa8, 0x07, 0xb8, 0x08, 0x03, 0xd3, 0x6e, 0x01, 0x00, 0x0a, 0xf6, 0x00,
+    0xf7, 0x28, 0x4e, 0xb8, 0x81, 0x24, 0xa0, 0x5c, 0x80, 0x7f, 0xc6, 0x01, 0x84, 0x22, 0x42, 0x4c,
+    0x50, 0x07, 0x3f, 0x40, 0x1b, 0xa0, 0x00, 0x91, 0x04, 0x07, 0x74, 0x20, 0xbf, 0xff, 0xa4, 0x40,
+    0x3f, 0x57, 0xf9, 0x81, 0xff, 0xd2, 0x01, 0xff, 0xff, 0x8e, 0x90, 0x0e, 0x8e, 0xe9, 0x80, 0x35,
+    0x5d, 0xc8, 0x00, 0x00, 0x0a, 0xf6, 0x00, 0xf7, 0x28, 0x4e, 0xb8, 0x81, 0x24, 0xa0, 0x5c, 0x80,
+    0x7f, 0xc6, 0x01, 0x84, 0x22, 0x42, 0x4c, 0x50, 0x01, 0xbd, 0x81, 0xdd, 0x82, 0xef, 0x00, 0xbf,
+    0xff, 0xa4, 0x40, 0x3f, 0x57, 0xf9, 0x81, 0xff, 0xd2, 0x01, 0xff, 0xff, 0x9f, 0x80, 0x0f, 0x67,
+    0xd0, 0x07, 0x50, 0xe2, 0x40, 0x00, 0x05, 0x83, 0x00, 0xbd, 0xd4, 0x03, 0xf7, 0x28, 0x4e, 0x83,
+    0x88, 0x12, 0x04, 0xa0, 0x5c, 0x80, 0x7f, 0xf0, 0x8c, 0x03, 0x84, 0x22, 0x40, 0x12, 0x62, 0x80,
+    0x01, 0xcf, 0xd0, 0x02, 0x7f, 0x90, 0x0a, 0x9d, 0xd4, 0x40, 0x4f, 0xc0, 0x0d, 0xfe, 0x20, 0x0f,
+    0xff, 0x83, 0x81, 0x00, 0x42, 0x00, 0x33, 0x00, 0xc0, 0x0d, 0x81, 0x08, 0x40, 0x3f, 0xf2, 0x84,
+    0x80, 0x1e, 0x8c, 0x00, 0x98, 0x80, 0x12, 0xff, 0xd0, 0x60, 0x1a, 0x71, 0xa3, 0x1c, 0x03, 0x78,
+    0x17, 0x01, 0x80, 0x00, 0x4f, 0xb0, 0x04, 0x7b, 0x80, 0x7f, 0xf5, 0x1c, 0x14, 0x41, 0x40, 0x06,
+    0x22, 0xef, 0x20, 0x0a, 0x88, 0x15, 0xc0, 0x24, 0xef, 0xab, 0xe7, 0x04, 0xcb, 0x4c, 0xa0, 0x03,
+    0x89, 0xb0, 0x98, 0x00, 0x4f, 0xc0, 0x0d, 0xfe, 0x20, 0x0f, 0xff, 0x83, 0x81, 0x00, 0x42, 0x00,
+    0x33, 0x00, 0xc0, 0x0d, 0x81, 0x08, 0x40, 0x3f, 0xf2, 0x84, 0x80, 0x1e, 0x8c, 0x00, 0x98, 0x80,
+    0x12, 0xe7, 0xfa, 0xcc, 0x03, 0x0e, 0xe9, 0xb8, 0xc0, 0x32, 0x05, 0xc2, 0x98, 0x00, 0x4f, 0xb0,
+    0x04, 0x7b, 0x80, 0x7f, 0xf5, 0x1c, 0x14, 0x41, 0x40, 0x06, 0x22, 0xef, 0x20, 0x0a, 0x88, 0x15,
+    0xc0, 0x24, 0xdf, 0xa8, 0xf7, 0x00, 0x57, 0x3d, 0xb8, 0x00, 0x56, 0xec, 0xaa, 0x00, 0x4f, 0xc0,
+    0x0d, 0xfe, 0x20, 0x0f, 0xff, 0x83, 0x81, 0x00, 0x42, 0x00, 0x33, 0x00, 0xc0, 0x0d, 0x81, 0x08,
+    0x40, 0x3f, 0xf2, 0x84, 0x80, 0x1e, 0x8c, 0x00, 0x98, 0x80, 0x12, 0xe7, 0x72, 0xcc, 0x03, 0x97,
+    0xb8, 0x60, 0x1c, 0x75, 0x2f, 0xa2, 0x00, 0x00, 0x4f, 0xb0, 0x04, 0x7b, 0x80, 0x7f, 0xf5, 0x1c,
+    0x14, 0x41, 0x40, 0x06, 0x22, 0xef, 0x20, 0x0a, 0x88, 0x15, 0xc0, 0x24, 0xde, 0xb8, 0xf7, 0x00,
+    0x17, 0x71, 0xc0, 0x37, 0xa5, 0xc2, 0x00, 0x00, 0xc3, 0xd6, 0x01, 0xf4, 0x9d, 0x00, 0x7d, 0x3a,
+    0x20, 0x1e, 0xdc, 0x3e, 0x30, 0x0c, 0xa1, 0x58, 0x66, 0x00, 0xc9, 0xef, 0xda, 0x01, 0x27, 0xe9,
+    0x00, 0x87, 0xf8, 0x80, 0x3f, 0xfe, 0x0e, 0x04, 0x01, 0x08, 0x00, 0xcc, 0x03, 0x00, 0x36, 0x04,
+    0x21, 0x00, 0xff, 0xca, 0x12, 0x00, 0x7a, 0x30, 0x02, 0x62, 0x00, 0x00, 0xdb, 0xa0, 0x0e, 0x52,
+    0xf0, 0x0e, 0x4e, 0x20, 0x0d, 0x7e, 0xb8, 0xc0, 0x02, 0x48, 0xb3, 0x70, 0x01, 0x6b, 0x7f, 0x08,
+    0x27, 0xc8, 0x02, 0x7d, 0xc0, 0x3f, 0xfa, 0x8e, 0x0a, 0x20, 0xa0, 0x03, 0x11, 0x77, 0x90, 0x05,
+    0x44, 0x0a, 0xe0, 0x00, 0x00, 0x37, 0x9c, 0x71, 0x00, 0x61, 0x06, 0x11, 0x00, 0x73, 0xe2, 0x5e,
+    0x10, 0x07, 0x67, 0x6e, 0x80, 0x3d, 0x77, 0x50, 0x07, 0x91, 0x30, 0x04, 0x9f, 0x80, 0x1b, 0xfc,
+    0x40, 0x1f, 0xff, 0x07, 0x02, 0x00, 0x84, 0x00, 0x66, 0x01, 0x80, 0x1b, 0x02, 0x10, 0x80, 0x7f,
+    0xe5, 0x09, 0x00, 0x3d, 0x18, 0x01, 0x31, 0x00, 0x00, 0x08, 0x00, 0x40, 0x25, 0xe7, 0x77, 0x28,
+    0x01, 0x84, 0x60, 0x60, 0x01, 0x84, 0xc8, 0x08, 0x02, 0xdb, 0xb8, 0x40, 0x23, 0x44, 0x80, 0x09,
+    0xf6, 0x00, 0x8f, 0x70, 0x0f, 0xfe, 0xa3, 0x82, 0x88, 0x28, 0x00, 0xc4, 0x5d, 0xe4, 0x01, 0x51,
+    0x02, 0xb8, 0x00, 0x00, 0xff, 0xe0, 0xee, 0x8f, 0x8c, 0x03, 0x28, 0x56, 0x19, 0x80, 0x32, 0x7b,
+    0xf6, 0x80, 0x59, 0xf2, 0x40, 0x21, 0x3f, 0x56, 0x0a, 0x01, 0x9c, 0x3d, 0x40, 0x88, 0x00, 0x31,
+    0x05, 0x23, 0x04, 0x00, 0x20, 0x20, 0x02, 0xc3, 0x40, 0x16, 0x1a, 0x00, 0x50, 0x40, 0x13, 0x07,
+    0x00, 0x11, 0x01, 0x50, 0x10, 0x40, 0x25, 0x0c, 0xc0, 0x68, 0x06, 0xa0, 0x47, 0x07, 0x00, 0xc4,
+    0x50, 0x98, 0x80, 0x72, 0x80, 0x2c, 0x02, 0x00, 0x01, 0xdc, 0x2f, 0x20, 0x03, 0x85, 0xe9, 0x10,
+    0x00, 0xfe, 0xfd, 0xa0, 0x0c, 0xe7, 0x01, 0x9f, 0x8a, 0x0f, 0x00, 0x20, 0x53, 0x82, 0x01, 0x16,
+    0x13, 0x14, 0x50, 0x50, 0x05, 0x06, 0x60, 0x28, 0x00, 0xe0, 0xa8, 0x44, 0x00, 0x09, 0x90, 0x50,
+    0x06, 0xa0, 0x02, 0x80, 0x00, 0xcf, 0x80, 0x0d, 0x3f, 0x56, 0x0a, 0x01, 0x9c, 0x3d, 0x40, 0x88,
+    0x00, 0x31, 0x05, 0x23, 0x04, 0x00, 0x20, 0x20, 0x02, 0xc3, 0x40, 0x16, 0x1a, 0x00, 0x50, 0x40,
+    0x13, 0x07, 0x00, 0x11, 0x01, 0x50, 0x10, 0x40, 0x25, 0x0c, 0xc0, 0x68, 0x06, 0xa0, 0x47, 0x07,
+    0x00, 0xc4, 0x50, 0x98, 0x80, 0x72, 0x80, 0x2c, 0x03, 0xd1, 0xfe, 0x70, 0x0f, 0x0e, 0xe0, 0x07,
+    0xc6, 0x46, 0x01, 0xf1, 0x66, 0x80, 0x60, 0xcf, 0x50, 0x04, 0xfc, 0x50, 0x78, 0x01, 0x02, 0x9c,
+    0x10, 0x08, 0xb0, 0x98, 0xa2, 0x82, 0x80, 0x28, 0x33, 0x01, 0x40, 0x07, 0x05, 0x42, 0x20, 0x00,
+    0x4c, 0x82, 0x80, 0x35, 0x00, 0x14, 0x03, 0x37, 0xf8, 0x80, 0x30, 0xf5, 0x80, 0x71, 0x8a, 0x80,
+    0x71, 0x66, 0x00, 0x20, 0x00, 0xc2, 0xa6, 0x01, 0xff, 0x0c, 0xe0, 0x80, 0x7f, 0xda, 0x32, 0x01,
+    0xff, 0x0f, 0x40, 0x07, 0xb7, 0xd8, 0x00, 0x7f, 0xe2, 0x00, 0x3f, 0xe2, 0x06, 0x00, 0x10, 0x00,
+    0x80, 0x0c, 0x04, 0xc0, 0x70, 0x06, 0x80, 0x3c, 0x00, 0xa1, 0x88, 0x04, 0x20, 0x82, 0x08, 0x02,
+    0x20, 0x41, 0x20, 0x52, 0x15, 0x42, 0x14, 0x03, 0x00, 0x20, 0x63, 0x86, 0x18, 0x2e, 0x82, 0x00,
+    0x30, 0x0f, 0x01, 0x30, 0x31, 0x03, 0x00, 0x08, 0x0a, 0xa0, 0x34, 0x03, 0x30, 0x20, 0x00, 0x48,
+    0x4c, 0xc0, 0x03, 0x40, 0x30, 0x0c, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x36, 0x00, 0x30, 0x01,
+    0x80, 0x0c, 0x00, 0x00, 0x00, 0x93, 0xe4, 0x03, 0xf9, 0x1d, 0x88, 0x03, 0xfa, 0x2c, 0x03, 0xd9,
+    0xe8, 0x0b, 0x7c, 0x00, 0xef, 0x34, 0x0c, 0x0d, 0x03, 0x01, 0x10, 0x1d, 0x82, 0x02, 0x00, 0x11,
+    0x00, 0xa0, 0x60, 0x62, 0x6a, 0x07, 0x81, 0x80, 0x05, 0x06, 0x0e, 0x2c, 0x50, 0x40, 0x06, 0x04,
+    0x82, 0x21, 0x4c, 0x88, 0x00, 0x70, 0x13, 0x0c, 0x10, 0x40, 0x08, 0x48, 0x10, 0x10, 0x01, 0xa0,
+    0x00, 0x00, 0xf8, 0xd4, 0x40, 0x3f, 0xc3, 0x9c, 0x20, 0x1f, 0xe8, 0x1a, 0x00, 0xff, 0xa7, 0x84,
+    0x03, 0xb7, 0xd8, 0x00, 0x7f, 0xe2, 0x00, 0x3f, 0xe2, 0x06, 0x00, 0x10, 0x00, 0x80, 0x0c, 0x04,
+    0xc0, 0x70, 0x06, 0x80, 0x3c, 0x00, 0xa1, 0x88, 0x04, 0x20, 0x82, 0x08, 0x02, 0x20, 0x41, 0x20,
+    0x52, 0x15, 0x42, 0x14, 0x03, 0x00, 0x20, 0x63, 0x86, 0x18, 0x2e, 0x82, 0x00, 0x30, 0x0f, 0x01,
+    0x30, 0x31, 0x03, 0x00, 0x08, 0x0a, 0xa0, 0x34, 0x03, 0x30, 0x20, 0x00, 0x48, 0x4c, 0xc0, 0x03,
+    0x40, 0x30, 0x0c, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x36, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00,
+    0x00, 0x00, 0xe2, 0xfb, 0x00, 0xfe, 0x81, 0xa0, 0x0f, 0xee, 0xc1, 0x00, 0xd9, 0xe8, 0x0b, 0x7c,
+    0x00, 0xef, 0x34, 0x0c, 0x0d, 0x03, 0x01, 0x10, 0x1d, 0x82, 0x02, 0x00, 0x11, 0x00, 0xa0, 0x60,
+    0x62, 0x6a, 0x07, 0x81, 0x80, 0x05, 0x06, 0x0e, 0x2c, 0x50, 0x40, 0x06, 0x04, 0x82, 0x21, 0x4c,
+    0x88, 0x00, 0x70, 0x13, 0x0c, 0x10, 0x40, 0x08, 0x48, 0x10, 0x10, 0x01, 0xa0, 0x00, 0x00, 0xe3,
+    0x00, 0x18, 0x07, 0xf4, 0x63, 0xc6, 0x40, 0x07, 0xee, 0x03, 0xd0, 0xd0, 0x0f, 0xcd, 0xe8, 0xbe,
+    0xa0, 0x1b, 0x7d, 0x80, 0x07, 0xfe, 0x20, 0x03, 0xfe, 0x20, 0x60, 0x01, 0x00, 0x08, 0x00, 0xc0,
+    0x4c, 0x07, 0x00, 0x68, 0x03, 0xc0, 0x0a, 0x18, 0x80, 0x42, 0x08, 0x20, 0x80, 0x22, 0x04, 0x12,
+    0x05, 0x21, 0x54, 0x21, 0x40, 0x30, 0x02, 0x06, 0x38, 0x61, 0x82, 0xe8, 0x20, 0x03, 0x00, 0xf0,
+    0x13, 0x03, 0x10, 0x30, 0x00, 0x80, 0xaa, 0x03, 0x40, 0x33, 0x02, 0x00, 0x04, 0x84, 0xcc, 0x00,
+    0x34, 0x03, 0x00, 0xc8, 0x00, 0x40, 0x02, 0x00, 0x10, 0x03, 0x60, 0x03, 0x00, 0x18, 0x00, 0xc0,
+    0x00, 0x00, 0xa7, 0x86, 0x78, 0x80, 0x3c, 0xa2, 0x4a, 0x2c, 0x01, 0xed, 0xc3, 0xdc, 0x40, 0x0b,
+    0x3d, 0x05, 0xbf, 0x4c, 0x3b, 0xcd, 0x03, 0x03, 0x40, 0xc0, 0x44, 0x07, 0x60, 0x80, 0x80, 0x04,
+    0x40, 0x28, 0x18, 0x18, 0x9a, 0x81, 0xe0, 0x60, 0x01, 0x41, 0x83, 0x8b, 0x14, 0x10, 0x01, 0x81,
+    0x20, 0x88, 0x53, 0x22, 0x00, 0x1c, 0x04, 0xc3, 0x04, 0x10, 0x02, 0x12, 0x04, 0x04, 0x00, 0x68,
+    0x00, 0x00, 0xf1, 0x10, 0x03, 0xfe, 0x1d, 0xd0, 0x07, 0xfc, 0x24, 0x60, 0x1f, 0xfc, 0x0d, 0xc0,
+    0x0f, 0x6f, 0xb0, 0x00, 0xff, 0xc4, 0x00, 0x7f, 0xc4, 0x0c, 0x00, 0x20, 0x01, 0x00, 0x18, 0x09,
+    0x80, 0xe0, 0x0d, 0x00, 0x78, 0x01, 0x43, 0x10, 0x08, 0x41, 0x04, 0x10, 0x04, 0x40, 0x82, 0x40,
+    0xa4, 0x2a, 0x84, 0x28, 0x06, 0x00, 0x40, 0xc7, 0x0c, 0x30, 0x5d, 0x04, 0x00, 0x60, 0x1e, 0x02,
+    0x60, 0x62, 0x06, 0x00, 0x10, 0x15, 0x40, 0x68, 0x06, 0x60, 0x40, 0x00, 0x90, 0x99, 0x80, 0x06,
+    0x80, 0x60, 0x19, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x6c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0xc7, 0xd2, 0x01, 0xfc, 0xc2, 0xa0, 0x1f, 0xcb, 0x7a, 0x01, 0xd9, 0xe8, 0x0b, 0x7a,
+    0x00, 0xef, 0x34, 0x0c, 0x0d, 0x03, 0x01, 0x10, 0x1d, 0x82, 0x02, 0x00, 0x11, 0x00, 0xa0, 0x60,
+    0x62, 0x6a, 0x07, 0x81, 0x80, 0x05, 0x06, 0x0e, 0x2c, 0x50, 0x40, 0x06, 0x04, 0x82, 0x21, 0x4c,
+    0x88, 0x00, 0x70, 0x13, 0x0c, 0x10, 0x40, 0x08, 0x48, 0x10, 0x10, 0x01, 0xa0, 0x00, 0xdf, 0x60,
+    0x01, 0xff, 0x88, 0x00, 0xff, 0x88, 0x18, 0x00, 0x40, 0x02, 0x00, 0x30, 0x13, 0x01, 0xc0, 0x1a,
+    0x00, 0xf0, 0x02, 0x86, 0x20, 0x10, 0x82, 0x08, 0x20, 0x08, 0x81, 0x04, 0x81, 0x48, 0x55, 0x08,
+    0x50, 0x0c, 0x00, 0x81, 0x8e, 0x18, 0x60, 0xba, 0x08, 0x00, 0xc0, 0x3c, 0x04, 0xc0, 0xc4, 0x0c,
+    0x00, 0x20, 0x2a, 0x80, 0xd0, 0x0c, 0xc0, 0x80, 0x01, 0x21, 0x33, 0x00, 0x0d, 0x00, 0xc0, 0x32,
+    0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0xd8, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x03, 0x2f, 0xf9, 0x00,
+    0x09, 0xfe, 0x40, 0x0f, 0xdb, 0x80, 0x1f, 0xf0, 0x91, 0x80, 0x7f, 0xc3, 0x9a, 0x01, 0xe0, 0xcf,
+    0x40, 0x5f, 0xc0, 0x07, 0x79, 0xa0, 0x60, 0x68, 0x18, 0x08, 0x80, 0xec, 0x10, 0x10, 0x00, 0x88,
+    0x05, 0x03, 0x03, 0x13, 0x50, 0x3c, 0x0c, 0x00, 0x28, 0x30, 0x71, 0x62, 0x82, 0x00, 0x30, 0x24,
+    0x11, 0x0a, 0x64, 0x40, 0x03, 0x80, 0x98, 0x60, 0x82, 0x00, 0x42, 0x40, 0x80, 0x80, 0x0d, 0x00,
+    0xdb, 0xf0, 0x03, 0xfe, 0x40, 0x0f, 0x1f, 0x48, 0x07, 0xf3, 0x0a, 0x80, 0x7f, 0x2d, 0xe8, 0x07,
+    0x00, 0x00, 0xc6, 0x40, 0x1f, 0x16, 0x60, 0x03, 0xe3, 0x15, 0x00, 0xf8, 0x7a, 0xc0, 0x32, 0x7f,
+    0x88, 0x00, 0x9f, 0xe1, 0x45, 0x09, 0x00, 0x48, 0x40, 0x85, 0x82, 0x21, 0xc8, 0x8e, 0x00, 0x19,
+    0x09, 0x80, 0xe0, 0x0c, 0xc6, 0x40, 0xc6, 0x01, 0xd6, 0x00, 0xd0, 0x0e, 0x19, 0x00, 0x48, 0x07,
+    0x58, 0xa9, 0x11, 0xc0, 0x24, 0x51, 0xb9, 0x08, 0x20, 0x05, 0x04, 0x0a, 0x28, 0x48, 0x48, 0x9b,
+    0x00, 0x2c, 0x11, 0x40, 0x00, 0x17, 0x48, 0x07, 0x30, 0xa8, 0x07, 0x25, 0xe8, 0x04, 0xdf, 0x68,
+    0x7f, 0xc2, 0xc6, 0x88, 0x90, 0x81, 0x0f, 0x0a, 0x43, 0x60, 0x01, 0xb0, 0x87, 0x00, 0x62, 0x00,
+    0x30, 0x04, 0xa8, 0x41, 0x20, 0x01, 0xb0, 0xf5, 0x28, 0x08, 0x16, 0x2b, 0x07, 0x20, 0x00, 0x8c,
+    0x00, 0x60, 0x1d, 0x58, 0xb3, 0x8c, 0x01, 0xb4, 0x1b, 0x80, 0x80, 0x33, 0xf9, 0xbf, 0xa0, 0x01,
+    0x3f, 0xc4, 0x00, 0x4f, 0xf0, 0xa2, 0x84, 0x80, 0x24, 0x20, 0x42, 0xc1, 0x10, 0xe4, 0x47, 0x00,
+    0x0c, 0x84, 0xc0, 0x70, 0x06, 0x63, 0x20, 0x63, 0x00, 0xeb, 0x00, 0x68, 0x07, 0x0c, 0x80, 0x24,
+    0x03, 0xac, 0x54, 0x88, 0xe0, 0x12, 0x28, 0xdc, 0x84, 0x10, 0x02, 0x82, 0x05, 0x14, 0x24, 0x24,
+    0x4d, 0x80, 0x16, 0x08, 0xa0, 0x09, 0xe2, 0x8e, 0x20, 0x02, 0x88, 0x8c, 0x58, 0x01, 0xb8, 0x75,
+    0x88, 0x0d, 0xd0, 0x07, 0x9c, 0x2c, 0x68, 0x89, 0x08, 0x10, 0xf0, 0xa4, 0x36, 0x00, 0x1b, 0x08,
+    0x70, 0x06, 0x20, 0x03, 0x00, 0x4a, 0x84, 0x12, 0x00, 0x1b, 0x0f, 0x52, 0x80, 0x81, 0x62, 0xb0,
+    0x72, 0x00, 0x00, 0xc6, 0x20, 0x1f, 0x1e, 0x60, 0x03, 0xe1, 0x13, 0x80, 0x7c, 0x5d, 0x40, 0x1a,
+    0xbe, 0xc0, 0x21, 0xff, 0x2c, 0x02, 0x20, 0x01, 0x20, 0x6a, 0x4c, 0x10, 0x02, 0xe1, 0xe0, 0x08,
+    0x03, 0x48, 0x04, 0x30, 0x00, 0xc0, 0x4b, 0x04, 0x80, 0x67, 0x12, 0x05, 0x20, 0x0e, 0x80, 0x04,
+    0x00, 0x79, 0x00, 0x48, 0x03, 0xff, 0xaa, 0x00, 0x00, 0x17, 0x48, 0x07, 0x30, 0xa8, 0x07, 0x26,
+    0x68, 0x05, 0x7e, 0xa6, 0x33, 0xef, 0xa1, 0xe0, 0x07, 0x05, 0x70, 0x50, 0x31, 0x32, 0x15, 0x04,
+    0xb0, 0xb0, 0x07, 0x86, 0xa0, 0x30, 0x01, 0x41, 0xcc, 0xc2, 0x01, 0x30, 0x85, 0x00, 0x6d, 0x00,
+    0x38, 0x06, 0x20, 0x41, 0x00, 0x0d, 0xc8, 0x70, 0x06, 0x40, 0x75, 0x00, 0x80, 0x00, 0x92, 0x0c,
+    0x03, 0x86, 0xdb, 0x80, 0x3a, 0x8b, 0xce, 0x40, 0x35, 0xe8, 0xf4, 0x80, 0x1f, 0xff, 0xe7, 0x00,
+    0xfe, 0x7f, 0xfc, 0xe0, 0x4e, 0x01, 0x91, 0xc3, 0x80, 0x30, 0xd0, 0x49, 0x80, 0x6d, 0x15, 0x60,
+    0x0d, 0x06, 0x54, 0x01, 0x95, 0xc3, 0x80, 0x31, 0x50, 0x49, 0x80, 0x6b, 0x00, 0x4f, 0xfe, 0x73,
+    0x00, 0xfb, 0xc0, 0x00, 0x4f, 0xe0, 0x04, 0xcc, 0xb1, 0xa0, 0x03, 0x7a, 0x6d, 0x02, 0xff, 0xf4,
+    0x89, 0x9c, 0x00, 0x14, 0xcc, 0x48, 0x14, 0x00, 0x0a, 0x83, 0x80, 0x2e, 0x09, 0x30, 0x04, 0x9a,
+    0xb0, 0x00, 0xd8, 0x1a, 0xec, 0xec, 0x00, 0x34, 0x46, 0x80, 0x7f, 0xff, 0x9c, 0x03, 0xf9, 0xff,
+    0xf3, 0x81, 0x38, 0x06, 0x47, 0x0e, 0x00, 0xc3, 0x41, 0x26, 0x01, 0xb4, 0x55, 0x80, 0x34, 0x19,
+    0x50, 0x06, 0x57, 0x0e, 0x00, 0xc5, 0x41, 0x26, 0x01, 0xac, 0x01, 0x3f, 0xf9, 0xcc, 0x03, 0xef,
+    0xaf, 0xff, 0xa0, 0x02, 0x7f, 0x50, 0x0f, 0x70, 0x10, 0x07, 0xa6, 0xdc, 0x02, 0x00, 0x5f, 0xfe,
+    0x91, 0x33, 0x80, 0x02, 0x99, 0x89, 0x02, 0x80, 0x01, 0x50, 0x70, 0x05, 0xc1, 0x26, 0x00, 0x93,
+    0x56, 0x00, 0x1b, 0x03, 0x5d, 0x9d, 0x80, 0x06, 0x88, 0xd5, 0xff, 0xea, 0x00, 0x27, 0xc0, 0x06,
+    0x20, 0x30, 0x0c, 0xd7, 0x40, 0x00, 0x7f, 0xff, 0x9c, 0x03, 0xf9, 0xff, 0xf3, 0x81, 0x38, 0x06,
+    0x47, 0x0e, 0x00, 0xc3, 0x41, 0x26, 0x01, 0xb4, 0x55, 0x80, 0x34, 0x19, 0x50, 0x06, 0x57, 0x0e,
+    0x00, 0xc5, 0x41, 0x26, 0x01, 0xac, 0x01, 0x3f, 0xf9, 0xcc, 0x03, 0xef, 0xaf, 0xf7, 0x75, 0xfe,
+    0x80, 0x04, 0x77, 0x4c, 0x01, 0xaa, 0xee, 0x40, 0x00, 0x5f, 0xfe, 0x91, 0x33, 0x80, 0x02, 0x99,
+    0x89, 0x02, 0x80, 0x01, 0x50, 0x70, 0x05, 0xc1, 0x26, 0x00, 0x93, 0x56, 0x00, 0x1b, 0x03, 0x5d,
+    0x9d, 0x80, 0x06, 0x88, 0xd5, 0xfe, 0xed, 0x40, 0xbd, 0xd5, 0x80, 0x12, 0xee, 0x90, 0x00, 0x4f,
+    0xb0, 0x0f, 0xfe, 0x63, 0xf7, 0x18, 0x02, 0x48, 0x11, 0x49, 0x00, 0x5d, 0xe6, 0x08, 0x00, 0x31,
+    0x04, 0x01, 0x00, 0x38, 0x07, 0xff, 0x45, 0x3e, 0x84, 0x53, 0xee, 0x00, 0xfe, 0xe8, 0x40, 0x2a,
+    0xbb, 0x84, 0x00, 0x02, 0x10, 0x21, 0x2d, 0xc1, 0xdf, 0x31, 0x71, 0x25, 0x1e, 0xa0, 0xdb, 0x00,
+    0x57, 0xb0, 0x07, 0xee, 0x50, 0x9d, 0x07, 0x10, 0x24, 0x09, 0x40, 0xb9, 0x00, 0xff, 0xe1, 0x18,
+    0x07, 0x08, 0x44, 0x80, 0x24, 0xc5, 0x00, 0x00, 0xcb, 0xd6, 0x01, 0xfd, 0x7a, 0x0a, 0x01, 0xff,
+    0xc8, 0x8d, 0x05, 0x00, 0xd9, 0xe8, 0x06, 0x2e, 0x00, 0xef, 0x34, 0x0c, 0x0d, 0x03, 0x01, 0x10,
+    0x1d, 0x82, 0x02, 0x00, 0x11, 0x00, 0xa0, 0x60, 0x62, 0x6a, 0x07, 0x81, 0x80, 0x05, 0x06, 0x0e,
+    0x2c, 0x50, 0x40, 0x06, 0x04, 0x82, 0x21, 0x4c, 0x88, 0x00, 0x70, 0x13, 0x0c, 0x10, 0x40, 0x08,
+    0x48, 0x10, 0x10, 0x01, 0xa0, 0x00, 0x00, 0x3f, 0xe0, 0x80, 0x69, 0xb7, 0x70, 0x06, 0x9b, 0x67,
+    0x00, 0xcf, 0xfa, 0x20, 0x0b, 0xf5, 0x00, 0x4f, 0xbe, 0x87, 0x80, 0x1c, 0x15, 0xc1, 0x40, 0xc4,
+    0xc8, 0x54, 0x12, 0xc2, 0xc0, 0x1e, 0x1a, 0x80, 0xc0, 0x05, 0x07, 0x33, 0x08, 0x04, 0xc2, 0x14,
+    0x01, 0xb4, 0x00, 0xe0, 0x18, 0x81, 0x04, 0x00, 0x37, 0x21, 0xc0, 0x19, 0x01, 0xd4, 0x02, 0x00,
+    0x00, 0xad, 0x80, 0x3d, 0xf0, 0x01, 0xef, 0x80, 0x0f, 0x5b, 0x00, 0x63, 0xbf, 0xea, 0x10, 0x06,
+    0xa2, 0x09, 0x68, 0x09, 0x26, 0xf0, 0x10, 0x0a, 0x3a, 0xf8, 0x02, 0x3d, 0x71, 0x90, 0x0a, 0xc2,
+    0x69, 0x80, 0x2e, 0x0b, 0x9c, 0x00, 0x99, 0x84, 0xf0, 0x01, 0x00, 0x01, 0x30, 0x0b, 0xf0, 0xc0,
+    0x0a, 0x22, 0x00, 0x5f, 0x10, 0x02, 0x3b, 0xcc, 0x9c, 0x50, 0x58, 0x0e, 0xc8, 0x00, 0xe0, 0x1f,
+    0xfd, 0x90, 0x00, 0x2d, 0x50, 0x16, 0x95, 0x43, 0xc0, 0xdd, 0xc4, 0x06, 0xab, 0x20, 0x99, 0x20,
+    0x01, 0x48, 0x03, 0xff, 0xa4, 0x00, 0x02, 0xbe, 0xff, 0xc8, 0x00, 0xf4, 0x02, 0x20, 0x06, 0x22,
+    0x07, 0x6d, 0x02, 0x20, 0x04, 0x08, 0x0e, 0x06, 0x80, 0x3d, 0xc0, 0xe0, 0x1e, 0x12, 0x06, 0xe5,
+    0x00, 0xc3, 0xfe, 0x90, 0xb0, 0x0f, 0x98, 0x04, 0x80, 0x3c, 0x60, 0x03, 0x00, 0x8b, 0x32, 0x05,
+    0x10, 0x08, 0x4c, 0xc5, 0x14, 0x00, 0x00, 0x2e, 0xff, 0xa0, 0x02, 0x2a, 0x23, 0x37, 0x00, 0x4c,
+    0x07, 0x98, 0x60, 0x09, 0x14, 0xfa, 0x48, 0x02, 0x45, 0x01, 0x6d, 0x40, 0x05, 0x05, 0x7c, 0x04,
+    0x81, 0x08, 0x94, 0x1c, 0x08, 0x40, 0x06, 0x01, 0xe2, 0x02, 0x30, 0x40, 0x11, 0x03, 0x86, 0x6d,
+    0x84, 0x00, 0x22, 0x04, 0x54, 0xb0, 0x00, 0x00, 0xa3, 0xfd, 0x00, 0x1e, 0x50, 0x02, 0x80, 0x71,
+    0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80, 0xa0, 0x19, 0x43, 0x30, 0x16, 0x01, 0x11, 0x01, 0x1c,
+    0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50, 0x05, 0x81, 0xff, 0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01,
+    0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0, 0x0c, 0xe1, 0x59, 0xee, 0x01, 0xa7, 0xf0, 0x03, 0x6e,
+    0x80, 0x3e, 0x12, 0x20, 0x80, 0x78, 0x77, 0x42, 0x01, 0x00, 0x03, 0xbf, 0xea, 0x10, 0x06, 0xa2,
+    0x09, 0x68, 0x09, 0x26, 0xf0, 0x10, 0x0a, 0x3a, 0xf8, 0x02, 0x3d, 0x71, 0x90, 0x0a, 0xc2, 0x69,
+    0x80, 0x2e, 0x0b, 0x9c, 0x00, 0x99, 0x84, 0xf0, 0x01, 0xa7, 0xf9, 0x7f, 0xc0, 0x11, 0x75, 0x00,
+    0x70, 0x89, 0xc0, 0x38, 0xf3, 0x00, 0x10, 0x00, 0x93, 0xf4, 0x40, 0x3c, 0x92, 0x40, 0x1f, 0x93,
+    0x04, 0x03, 0xd1, 0xb9, 0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e,
+    0x80, 0xa0, 0x19, 0x43, 0x30, 0x16, 0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20,
+    0x50, 0x05, 0x81, 0xff, 0x88, 0x2c, 0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0,
+    0xa0, 0x0c, 0xe1, 0x40, 0x00, 0x3f, 0xe0, 0x07, 0x33, 0x04, 0x03, 0x86, 0xbc, 0x03, 0x1d, 0xe6,
+    0x28, 0x40, 0x1a, 0x88, 0x25, 0xa0, 0x24, 0x9b, 0xc0, 0x40, 0x28, 0xeb, 0xe0, 0x08, 0xf5, 0xc6,
+    0x40, 0x2b, 0x09, 0xa6, 0x00, 0xb8, 0x2e, 0x70, 0x02, 0x66, 0x13, 0xc0, 0x04, 0x00, 0x00, 0xf8,
+    0x40, 0x3f, 0x37, 0x10, 0x07, 0xdb, 0x44, 0x01, 0x8f, 0xfd, 0x0a, 0x01, 0x87, 0x5d, 0xda, 0x20,
+    0x18, 0x7e, 0x21, 0xe2, 0x01, 0xd3, 0xfe, 0x90, 0x0f, 0x28, 0x01, 0x40, 0x38, 0x88, 0x22, 0x22,
+    0x00, 0x6a, 0x07, 0x40, 0x50, 0x0c, 0xa1, 0x98, 0x0b, 0x00, 0x88, 0x80, 0x8e, 0x06, 0x40, 0x05,
+    0x03, 0x11, 0x10, 0x28, 0x02, 0xc0, 0xff, 0xc4, 0x16, 0x04, 0x60, 0x45, 0x80, 0xc5, 0x40, 0xb7,
+    0x70, 0x83, 0xd8, 0x50, 0x06, 0x70, 0xa0, 0x00, 0xf0, 0x80, 0x7a, 0x7c, 0x40, 0x30, 0xb5, 0x08,
+    0x01, 0x7f, 0xdc, 0x80, 0x02, 0xa8, 0x2d, 0x00, 0xd8, 0xfb, 0xe0, 0x10, 0xc7, 0xfa, 0x44, 0x01,
+    0xa8, 0x82, 0x5a, 0x02, 0x49, 0xbc, 0x04, 0x02, 0x8e, 0xbe, 0x00, 0x8f, 0x5c, 0x64, 0x02, 0xb0,
+    0x9a, 0x60, 0x0b, 0x82, 0xe7, 0x00, 0x26, 0x61, 0x3c, 0x00, 0x40, 0x00, 0xe1, 0x00, 0xfe, 0x8e,
+    0x00, 0xfd, 0x28, 0xa0, 0x1c, 0x7f, 0xe9, 0x50, 0x0c, 0x3a, 0xee, 0xd1, 0x00, 0xc3, 0xf1, 0x0f,
+    0x10, 0x0e, 0x9f, 0xf4, 0x80, 0x79, 0x40, 0x0a, 0x01, 0xc4, 0x41, 0x11, 0x10, 0x03, 0x50, 0x3a,
+    0x02, 0x80, 0x65, 0x0c, 0xc0, 0x58, 0x04, 0x44, 0x04, 0x70, 0x32, 0x00, 0x28, 0x18, 0x88, 0x81,
+    0x40, 0x16, 0x07, 0xfe, 0x20, 0xb0, 0x23, 0x02, 0x2c, 0x06, 0x2a, 0x05, 0xbb, 0x84, 0x1e, 0xc2,
+    0x80, 0x33, 0x85, 0x00, 0x00, 0xc2, 0x01, 0xf6, 0x58, 0x07, 0xbd, 0x0c, 0x02, 0x5f, 0xce, 0x30,
+    0x01, 0x54, 0x16, 0x80, 0x6c, 0x7d, 0xf0, 0x08, 0x63, 0xfd, 0x22, 0x00, 0xd4, 0x41, 0x2d, 0x01,
+    0x24, 0xde, 0x02, 0x01, 0x47, 0x5f, 0x00, 0x47, 0xae, 0x32, 0x01, 0x58, 0x4d, 0x30, 0x05, 0xc1,
+    0x73, 0x80, 0x13, 0x30, 0x9e, 0x00, 0x20, 0x00, 0xea, 0xe4, 0x00, 0xfa, 0xcc, 0x40, 0x3d, 0x13,
+    0xea, 0x01, 0xd0, 0xcf, 0x40, 0x1c, 0x4d, 0x12, 0xc4, 0x01, 0x8b, 0x99, 0x9c, 0x40, 0x1d, 0x1f,
+    0xe8, 0x00, 0xf2, 0x80, 0x14, 0x03, 0x88, 0x82, 0x22, 0x20, 0x06, 0xa0, 0x74, 0x05, 0x00, 0xca,
+    0x19, 0x80, 0xb0, 0x08, 0x88, 0x08, 0xe0, 0x64, 0x00, 0x50, 0x31, 0x11, 0x02, 0x80, 0x2c, 0x0f,
+    0xfc, 0x41, 0x60, 0x46, 0x04, 0x58, 0x0c, 0x54, 0x0b, 0x77, 0x08, 0x3d, 0x85, 0x00, 0x67, 0x0a,
+    0x00, 0x00, 0xdb, 0xc4, 0x01, 0xde, 0x20, 0x19, 0x7f, 0x70, 0x80, 0x05, 0x50, 0x7e, 0x01, 0xb1,
+    0xf7, 0xc0, 0x21, 0x8f, 0xf4, 0x88, 0x03, 0x51, 0x04, 0xb4, 0x04, 0x93, 0x78, 0x08, 0x05, 0x1d,
+    0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34, 0xc0, 0x17, 0x05, 0xce, 0x00, 0x4c, 0xc2, 0x78,
+    0x00, 0x80, 0x00, 0xb3, 0x4b, 0x50, 0x03, 0x21, 0x46, 0x9a, 0x00, 0x64, 0xc0, 0x9e, 0x00, 0xf2,
+    0x54, 0xb0, 0x07, 0x14, 0xc4, 0x24, 0x80, 0x31, 0x7b, 0xbb, 0xc8, 0x03, 0xa3, 0xfd, 0x00, 0x1e,
+    0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00, 0xd4, 0x0e, 0x80, 0xa0, 0x19, 0x43, 0x30, 0x16,
+    0x01, 0x11, 0x01, 0x1c, 0x0c, 0x80, 0x0a, 0x06, 0x22, 0x20, 0x50, 0x05, 0x81, 0xff, 0x88, 0x2c,
+    0x08, 0xc0, 0x8b, 0x01, 0x8a, 0x81, 0x6e, 0xe1, 0x07, 0xb0, 0xa0, 0x0c, 0xe1, 0x40, 0x04, 0xef,
+    0xf7, 0x08, 0x01, 0x73, 0x75, 0xc2, 0x00, 0x17, 0xdc, 0x10, 0x08, 0xaa, 0x0b, 0x40, 0x36, 0x3e,
+    0xf8, 0x04, 0x31, 0xfe, 0x91, 0x00, 0x6a, 0x20, 0x96, 0x80, 0x92, 0x6f, 0x01, 0x00, 0xa3, 0xaf,
+    0x80, 0x23, 0xd7, 0x19, 0x00, 0xac, 0x26, 0x98, 0x02, 0xe0, 0xb9, 0xc0, 0x09, 0x98, 0x4f, 0x00,
+    0x10, 0x00, 0xce, 0xe0, 0x0f, 0x9e, 0x20, 0xe0, 0x1c, 0x51, 0x32, 0x82, 0x00, 0xc5, 0xec, 0xcf,
+    0x20, 0x0e, 0x8f, 0xf4, 0x00, 0x79, 0x40, 0x0a, 0x01, 0xc4, 0x41, 0x11, 0x10, 0x03, 0x50, 0x3a,
+    0x02, 0x80, 0x65, 0x0c, 0xc0, 0x58, 0x04, 0x44, 0x04, 0x70, 0x32, 0x00, 0x28, 0x18, 0x88, 0x81,
+    0x40, 0x16, 0x07, 0xfe, 0x20, 0xb0, 0x23, 0x02, 0x2c, 0x06, 0x2a, 0x05, 0xbb, 0x84, 0x1e, 0xc2,
+    0x80, 0x33, 0x85, 0x67, 0xb8, 0x06, 0x9f, 0xc0, 0x0d, 0xba, 0x00, 0xf8, 0x48, 0x82, 0x01, 0xe1,
+    0xdd, 0x08, 0x04, 0x00, 0x00, 0x2f, 0xf0, 0x80, 0x45, 0x52, 0x5a, 0x01, 0x1e, 0xb6, 0x70, 0x04,
+    0x53, 0xfd, 0x02, 0x00, 0xd4, 0x41, 0x2d, 0x01, 0x24, 0xde, 0x02, 0x01, 0x47, 0x5f, 0x00, 0x47,
+    0xae, 0x32, 0x01, 0x58, 0x4d, 0x30, 0x05, 0xc1, 0x73, 0x80, 0x13, 0x30, 0x9e, 0x00, 0x34, 0xff,
+    0x2f, 0xf8, 0x02, 0x2e, 0xa0, 0x0e, 0x11, 0x38, 0x07, 0x1e, 0x60, 0x02, 0x00, 0x00, 0xf0, 0x80,
+    0x7e, 0xe8, 0x00, 0xf9, 0x55, 0x20, 0x1c, 0x7e, 0xf3, 0xe6, 0x01, 0x8d, 0xb7, 0x4c, 0x60, 0x1d,
+    0x3d, 0xc9, 0x00, 0xf4, 0x77, 0x20, 0x03, 0xca, 0x00, 0x50, 0x0e, 0x22, 0x08, 0x88, 0x80, 0x1a,
+    0x81, 0xd0, 0x14, 0x03, 0x28, 0x66, 0x02, 0xc0, 0x22, 0x20, 0x23, 0x81, 0x90, 0x01, 0x40, 0xc4,
+    0x44, 0x0a, 0x00, 0xb0, 0x3f, 0xf1, 0x05, 0x81, 0x18, 0x11, 0x60, 0x31, 0x50, 0x2d, 0xdc, 0x20,
+    0xf6, 0x14, 0x01, 0x9c, 0x28, 0x00, 0xc2, 0x20, 0x0e, 0x1e, 0x60, 0x0e, 0x83, 0x70, 0x09, 0xb6,
+    0x21, 0xe2, 0x00, 0x66, 0x75, 0xc0, 0x80, 0x57, 0xbc, 0xe0, 0x11, 0xde, 0xfd, 0x08, 0x03, 0x51,
+    0x04, 0xb4, 0x04, 0x93, 0x78, 0x08, 0x05, 0x1d, 0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34,
+    0xc0, 0x17, 0x05, 0xce, 0x00, 0x4c, 0xc2, 0x78, 0x00, 0x80, 0x00, 0x84, 0x03, 0xfa, 0x38, 0x03,
+    0xf4, 0xaa, 0x80, 0x3c, 0x7f, 0x2f, 0xe6, 0x01, 0x8d, 0xb7, 0x4c, 0x60, 0x1d, 0x3d, 0xc9, 0x00,
+    0xf4, 0x77, 0x20, 0x03, 0xca, 0x00, 0x50, 0x0e, 0x22, 0x08, 0x88, 0x80, 0x1a, 0x81, 0xd0, 0x14,
+    0x03, 0x28, 0x66, 0x02, 0xc0, 0x22, 0x20, 0x23, 0x81, 0x90, 0x01, 0x40, 0xc4, 0x44, 0x0a, 0x00,
+    0xb0, 0x3f, 0xf1, 0x05, 0x81, 0x18, 0x11, 0x60, 0x31, 0x50, 0x2d, 0xdc, 0x20, 0xf6, 0x14, 0x01,
+    0x9c, 0x28, 0x00, 0x08, 0x07, 0xdb, 0x60, 0x1e, 0xe4, 0x30, 0x0c, 0xdf, 0xcf, 0xe2, 0x00, 0x66,
+    0x75, 0xc0, 0x80, 0x57, 0xbc, 0xe0, 0x11, 0xde, 0xfd, 0x08, 0x03, 0x51, 0x04, 0xb4, 0x04, 0x93,
+    0x78, 0x08, 0x05, 0x1d, 0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34, 0xc0, 0x17, 0x05, 0xce,
+    0x00, 0x4c, 0xc2, 0x78, 0x00, 0x80, 0x00, 0x8b, 0xf0, 0x03, 0xe2, 0x91, 0x00, 0xf0, 0xa3, 0xe2,
+    0x08, 0x06, 0x3b, 0x22, 0x59, 0x80, 0x62, 0x8c, 0xc3, 0x90, 0x07, 0x3f, 0x72, 0x00, 0x3d, 0x1d,
+    0xc8, 0x00, 0xf2, 0x80, 0x14, 0x03, 0x88, 0x82, 0x22, 0x20, 0x06, 0xa0, 0x74, 0x05, 0x00, 0xca,
+    0x19, 0x80, 0xb0, 0x08, 0x88, 0x08, 0xe0, 0x64, 0x00, 0x50, 0x31, 0x11, 0x02, 0x80, 0x2c, 0x0f,
+    0xfc, 0x41, 0x60, 0x46, 0x04, 0x58, 0x0c, 0x54, 0x0b, 0x77, 0x08, 0x3d, 0x85, 0x00, 0x67, 0x0a,
+    0x00, 0x00, 0x2f, 0xc8, 0x07, 0x2b, 0x98, 0x06, 0x6d, 0xaf, 0xf0, 0x80, 0x19, 0x9b, 0x50, 0x20,
+    0x15, 0xef, 0x38, 0x04, 0x77, 0xbf, 0x42, 0x00, 0xd4, 0x41, 0x2d, 0x01, 0x24, 0xde, 0x02, 0x01,
+    0x47, 0x5f, 0x00, 0x47, 0xae, 0x32, 0x01, 0x58, 0x4d, 0x30, 0x05, 0xc1, 0x73, 0x80, 0x13, 0x30,
+    0x9e, 0x00, 0x20, 0x00, 0xaf, 0x4f, 0x14, 0x03, 0x1a, 0xc6, 0x12, 0x00, 0x61, 0x85, 0xfb, 0x00,
+    0xf4, 0x91, 0xd1, 0x80, 0x62, 0x7d, 0xc8, 0x20, 0x0e, 0x8e, 0xe3, 0x80, 0x7a, 0x3b, 0x90, 0x01,
+    0xe5, 0x00, 0x28, 0x07, 0x11, 0x04, 0x44, 0x40, 0x0d, 0x40, 0xe8, 0x0a, 0x01, 0x94, 0x33, 0x01,
+    0x60, 0x11, 0x10, 0x11, 0xc0, 0xc8, 0x00, 0xa0, 0x62, 0x22, 0x05, 0x00, 0x58, 0x1f, 0xf8, 0x82,
+    0xc0, 0x8c, 0x08, 0xb0, 0x18, 0xa8, 0x16, 0xee, 0x10, 0x7b, 0x0a, 0x00, 0xce, 0x14, 0x00, 0x03,
+    0xef, 0xf7, 0x08, 0x00, 0xb3, 0x75, 0xc2, 0x00, 0x7f, 0x37, 0xf1, 0x00, 0x30, 0xf5, 0x48, 0x80,
+    0x59, 0xbc, 0xc0, 0x11, 0xde, 0xfd, 0x08, 0x03, 0x51, 0x04, 0xb4, 0x04, 0x93, 0x78, 0x08, 0x05,
+    0x1d, 0x7c, 0x01, 0x1e, 0xb8, 0xc8, 0x05, 0x61, 0x34, 0xc0, 0x17, 0x05, 0xce, 0x00, 0x4c, 0xc2,
+    0x78, 0x00, 0x80, 0x00, 0x13, 0x80, 0x1c, 0x80, 0x3a, 0x0c, 0xd0, 0x01, 0xc5, 0x19, 0x88, 0x20,
+    0x0e, 0x7e, 0xe3, 0x80, 0x7a, 0x3b, 0x90, 0x01, 0xe5, 0x00, 0x28, 0x07, 0x11, 0x04, 0x44, 0x40,
+    0x0d, 0x40, 0xe8, 0x0a, 0x01, 0x94, 0x33, 0x01, 0x60, 0x11, 0x10, 0x11, 0xc0, 0xc8, 0x00, 0xa0,
+    0x62, 0x22, 0x05, 0x00, 0x58, 0x1f, 0xf8, 0x82, 0xc0, 0x8c, 0x08, 0xb0, 0x18, 0xa8, 0x16, 0xee,
+    0x10, 0x7b, 0x0a, 0x00, 0xce, 0x15, 0x9e, 0xe0, 0x1a, 0x7f, 0x00, 0x36, 0xe8, 0x03, 0xe1, 0x22,
+    0x08, 0x07, 0x87, 0x74, 0x20, 0x10, 0x06, 0xd1, 0x4f, 0x10, 0x03, 0x33, 0xae, 0x04, 0x02, 0xbd,
+    0xe7, 0x00, 0x8e, 0xf7, 0xe8, 0x40, 0x1a, 0x88, 0x25, 0xa0, 0x24, 0x9b, 0xc0, 0x40, 0x28, 0xeb,
+    0xe0, 0x08, 0xf5, 0xc6, 0x40, 0x2b, 0x09, 0xa6, 0x00, 0xb8, 0x2e, 0x70, 0x02, 0x66, 0x13, 0xc0,
+    0x06, 0x9f, 0xe5, 0xff, 0x00, 0x45, 0xd4, 0x01, 0xc2, 0x27, 0x00, 0xe3, 0xcc, 0x00, 0x40, 0x3f,
+    0xff, 0x84, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd, 0xa4, 0x03, 0x08, 0xe3,
+    0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x4f, 0xff, 0xe1, 0x00, 0x9f,
+    0xd0, 0x03, 0xda, 0x06, 0x01, 0xea, 0xb7, 0x00, 0x80, 0x01, 0xaf, 0xea, 0x10, 0x06, 0x2a, 0x12,
+    0xe0, 0x29, 0x35, 0x6a, 0x92, 0x68, 0x37, 0x71, 0x40, 0xc0, 0x0d, 0x77, 0x97, 0x40, 0x91, 0x07,
+    0xe2, 0xa4, 0x99, 0x70, 0xc6, 0x18, 0xa6, 0x8b, 0x80, 0x01, 0xaf, 0xf5, 0x08, 0x04, 0x3b, 0x80,
+    0x1c, 0x64, 0x60, 0x1c, 0x59, 0xa0, 0x10, 0x00, 0xbb, 0xd8, 0x03, 0xd8, 0x22, 0x00, 0xf1, 0x5b,
+    0x80, 0x47, 0xff, 0x57, 0xfc, 0x20, 0x1f, 0x84, 0x00, 0x5f, 0xfc, 0x01, 0xff, 0xc0, 0x2e, 0xed,
+    0x20, 0x18, 0x47, 0x18, 0x04, 0x5f, 0xfa, 0x80, 0x3f, 0xf9, 0x25, 0xff, 0xc0, 0x1f, 0xc2, 0x00,
+    0x00, 0x37, 0xe8, 0x07, 0x3c, 0x10, 0x07, 0x0a, 0x60, 0x06, 0x1a, 0xcd, 0xa1, 0x00, 0x62, 0xa1,
+    0x2e, 0x02, 0x93, 0x56, 0xa9, 0x26, 0x83, 0x77, 0x14, 0x0c, 0x00, 0xd7, 0x79, 0x74, 0x09, 0x10,
+    0x7e, 0x2a, 0x49, 0x97, 0x0c, 0x61, 0x8a, 0x68, 0xb8, 0x00, 0x00, 0xff, 0x9b, 0xdd, 0xd6, 0x01,
+    0xae, 0x2e, 0x38, 0x03, 0x73, 0xe6, 0xa8, 0x00, 0xff, 0x3f, 0xdb, 0xfe, 0x10, 0x0f, 0xc2, 0x00,
+    0x2f, 0xfe, 0x00, 0xff, 0xe0, 0x17, 0x76, 0x90, 0x0c, 0x23, 0x8c, 0x02, 0x2f, 0xfd, 0x40, 0x1f,
+    0xfc, 0x92, 0xff, 0xe0, 0x0f, 0xe1, 0x00, 0x00, 0x66, 0x0f, 0x8c, 0x00, 0xa3, 0x78, 0x66, 0x00,
+    0x27, 0xbf, 0x68, 0x06, 0x8f, 0xf5, 0x08, 0x03, 0x15, 0x09, 0x70, 0x14, 0x9a, 0xb5, 0x49, 0x34,
+    0x1b, 0xb8, 0xa0, 0x60, 0x06, 0xbb, 0xcb, 0xa0, 0x48, 0x83, 0xf1, 0x52, 0x4c, 0xb8, 0x63, 0x0c,
+    0x53, 0x45, 0xc0, 0x00, 0x00, 0xf0, 0x88, 0x03, 0xc3, 0xd2, 0x01, 0xe7, 0x58, 0x00, 0xd9, 0xfe,
+    0xa0, 0x0d, 0x25, 0x6c, 0xc0, 0x0d, 0x1c, 0x9c, 0xe0, 0x03, 0xfe, 0xff, 0x77, 0x3c, 0x40, 0x3f,
+    0x08, 0x00, 0xbf, 0xf8, 0x03, 0xff, 0x80, 0x5d, 0xda, 0x40, 0x30, 0x8e, 0x30, 0x08, 0xbf, 0xf5,
+    0x00, 0x7f, 0xf2, 0x4b, 0xff, 0x80, 0x3f, 0x84, 0x00, 0xf0, 0x80, 0x79, 0xf8, 0x80, 0x3a, 0x64,
+    0x40, 0x04, 0xff, 0x63, 0x00, 0x06, 0x9d, 0x3c, 0x03, 0x6c, 0x5f, 0x08, 0x05, 0x3f, 0xd2, 0x01,
+    0x62, 0xa1, 0x2e, 0x02, 0x93, 0x56, 0xa9, 0x26, 0x83, 0x77, 0x14, 0x0c, 0x00, 0xd7, 0x79, 0x74,
+    0x09, 0x10, 0x7e, 0x2a, 0x49, 0x97, 0x0c, 0x61, 0x8a, 0x68, 0xb8, 0x00, 0x00, 0xe1, 0x00, 0xf8,
+    0xf9, 0x40, 0x3c, 0x73, 0xe0, 0x1d, 0x9f, 0xea, 0x00, 0xd2, 0x56, 0xcc, 0x00, 0xd1, 0xc9, 0xce,
+    0x00, 0x3f, 0xef, 0xf7, 0x73, 0xc4, 0x03, 0xf0, 0x80, 0x0b, 0xff, 0x80, 0x3f, 0xf8, 0x05, 0xdd,
+    0xa4, 0x03, 0x08, 0xe3, 0x00, 0x8b, 0xff, 0x50, 0x07, 0xff, 0x24, 0xbf, 0xf8, 0x03, 0xf8, 0x40,
+    0x00, 0xc2, 0x01, 0xf5, 0x68, 0x07, 0xa8, 0xd4, 0x02, 0x4f, 0xec, 0x50, 0x00, 0xd3, 0xa7, 0x80,
+    0x6d, 0x8b, 0xe1, 0x00, 0xa7, 0xfa, 0x40, 0x2c, 0x54, 0x25, 0xc0, 0x52, 0x6a, 0xd5, 0x24, 0xd0,
+    0x6e, 0xe2, 0x81, 0x80, 0x1a, 0xef, 0x2e, 0x81, 0x22, 0x0f, 0xc5, 0x49, 0x32, 0xe1, 0x8c, 0x31,
+    0x4d, 0x17, 0x00, 0x00, 0xc9, 0xf4, 0x01, 0xe4, 0x71, 0x00, 0xe4, 0x8c, 0xa0, 0x0c, 0x56, 0xb2,
+    0x20, 0x1a, 0x53, 0x02, 0x00, 0x35, 0xd8, 0x76, 0x00, 0x07, 0xff, 0xf0, 0x80, 0x7e, 0x10, 0x01,
+    0x7f, 0xf0, 0x07, 0xff, 0x00, 0xbb, 0xb4, 0x80, 0x61, 0x1c, 0x60, 0x11, 0x7f, 0xea, 0x00, 0xff,
+    0xe4, 0x97, 0xff, 0x00, 0x7f, 0x08, 0x00, 0xd7, 0xc8, 0x01, 0xd4, 0x01, 0xf0, 0xe2, 0x00, 0x49,
+    0xfe, 0x00, 0xc3, 0x4e, 0x9e, 0x01, 0xb6, 0x2f, 0x84, 0x02, 0x9f, 0xe9, 0x00, 0xb1, 0x50, 0x97,
+    0x01, 0x49, 0xab, 0x54, 0x93, 0x41, 0xbb, 0x8a, 0x06, 0x00, 0x6b, 0xbc, 0xba, 0x04, 0x88, 0x3f,
+    0x15, 0x24, 0xcb, 0x86, 0x30, 0xc5, 0x34, 0x5c, 0x00, 0x00, 0x37, 0x3b, 0xac, 0x03, 0x5c, 0xdc,
+    0x70, 0x06, 0xf4, 0x9c, 0x50, 0x0c, 0x7b, 0x7e, 0x01, 0xd4, 0x78, 0x50, 0x01, 0xaf, 0x4b, 0xa0,
+    0x00, 0x7f, 0xff, 0x08, 0x07, 0xe1, 0x00, 0x17, 0xff, 0x00, 0x7f, 0xf0, 0x0b, 0xbb, 0x48, 0x06,
+    0x11, 0xc6, 0x01, 0x17, 0xfe, 0xa0, 0x0f, 0xfe, 0x49, 0x7f, 0xf0, 0x07, 0xf0, 0x80, 0x02, 0xdf,
+    0xf7, 0x10, 0x00, 0xff, 0x75, 0xe4, 0x00, 0x16, 0xdd, 0x18, 0x04, 0x34, 0xe9, 0xe0, 0x1b, 0x62,
+    0xf8, 0x40, 0x29, 0xfe, 0x90, 0x0b, 0x15, 0x09, 0x70, 0x14, 0x9a, 0xb5, 0x49, 0x34, 0x1b, 0xb8,
+    0xa0, 0x60, 0x06, 0xbb, 0xcb, 0xa0, 0x48, 0x83, 0xf1, 0x52, 0x4c, 0xb8, 0x63, 0x0c, 0x53, 0x45,
+    0xc0, 0x00, 0x00, 0x92, 0x08, 0x03, 0x8a, 0xdb, 0xc0, 0x3a, 0x4f, 0xce, 0x00, 0x35, 0xe0, 0xf4,
+    0x00, 0x0f, 0xff, 0xe1, 0x00, 0xfc, 0x20, 0x02, 0xff, 0xe0, 0x0f, 0xfe, 0x01, 0x77, 0x69, 0x00,
+    0xc2, 0x38, 0xc0, 0x22, 0xff, 0xd4, 0x01, 0xff, 0xc9, 0x2f, 0xfe, 0x00, 0xfe, 0x13, 0xff, 0xf8,
+    0x40, 0x27, 0xf4, 0x00, 0xf6, 0x81, 0x80, 0x7a, 0xad, 0xc0, 0x20, 0x00, 0x27, 0xf8, 0x80, 0x21,
+    0xa7, 0x5f, 0x00, 0xd9, 0x15, 0xe0, 0x1a, 0x3f, 0xa0, 0x40, 0x18, 0xa8, 0x4b, 0x80, 0xa4, 0xd5,
+    0xaa, 0x49, 0xa0, 0xdd, 0xc5, 0x03, 0x00, 0x35, 0xde, 0x5d, 0x02, 0x44, 0x1f, 0x8a, 0x92, 0x65,
+    0xc3, 0x18, 0x62, 0x9a, 0x2e, 0x00, 0x06, 0xbf, 0xd4, 0x20, 0x10, 0xee, 0x00, 0x71, 0x91, 0x80,
+    0x71, 0x66, 0x80, 0x40, 0x7f, 0xb0, 0x66, 0x80, 0x6b, 0xc0, 0xf3, 0xc0, 0x3f, 0xfb, 0xa0, 0x9f,
+    0xa8, 0x56, 0x1e, 0xd4, 0xba, 0x00, 0xff, 0xe4, 0x80, 0x3f, 0xd0, 0x0f, 0xfe, 0x91, 0xfe, 0x97,
+    0x50, 0x89, 0xcf, 0x30, 0x00, 0x3e, 0x96, 0x15, 0x55, 0xea, 0x5d, 0x00, 0x7f, 0xf2, 0x53, 0xec,
+    0xfa, 0x58, 0x55, 0x57, 0xa0, 0x00, 0x15, 0x77, 0xe3, 0x00, 0x63, 0xd5, 0x10, 0x39, 0x90, 0x05,
+    0xc0, 0x7b, 0xd2, 0x0c, 0x80, 0x84, 0x1a, 0x42, 0xce, 0x1e, 0x06, 0x0a, 0x20, 0x15, 0x82, 0x87,
+    0x81, 0x80, 0x62, 0x01, 0x0f, 0x03, 0x00, 0xc4, 0x02, 0x06, 0x08, 0x01, 0xac, 0x14, 0x10, 0x86,
+    0xc8, 0x59, 0xc3, 0x80, 0x1c, 0x09, 0xbd, 0x20, 0xca, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x62,
+    0xae, 0xfc, 0x60, 0x0f, 0xab, 0x88, 0x03, 0xf3, 0x8b, 0x00, 0x7e, 0xcc, 0x20, 0x06, 0x00, 0x01,
+    0xae, 0xfb, 0x20, 0x06, 0x28, 0x0a, 0x60, 0xa9, 0x13, 0xb8, 0x82, 0xda, 0x14, 0x00, 0xe0, 0xd1,
+    0x00, 0xfb, 0x02, 0xc0, 0x1c, 0x1a, 0xa4, 0x7d, 0xa8, 0x2c, 0x18, 0xa0, 0x49, 0x82, 0x03, 0x5d,
+    0xf6, 0x40, 0x1b, 0x34, 0x03, 0xc6, 0x42, 0x01, 0xdb, 0x82, 0x00, 0x00, 0x00, 0x87, 0xf8, 0xc0,
+    0x3e, 0x1b, 0x17, 0x00, 0xfc, 0xb6, 0x80, 0x1e, 0x2a, 0xfb, 0xc6, 0x00, 0xc7, 0xaa, 0x20, 0x73,
+    0x20, 0x0b, 0x80, 0xf7, 0xa4, 0x19, 0x01, 0x08, 0x34, 0x85, 0x9c, 0x3c, 0x0c, 0x14, 0x40, 0x2b,
+    0x05, 0x0f, 0x03, 0x00, 0xc4, 0x02, 0x1e, 0x06, 0x01, 0x88, 0x04, 0x0c, 0x10, 0x03, 0x58, 0x28,
+    0x21, 0x0d, 0x90, 0xb3, 0x87, 0x00, 0x38, 0x13, 0x7a, 0x41, 0x94, 0x00, 0x7a, 0xa2, 0x07, 0x32,
+    0x00, 0x00, 0x00, 0x27, 0xf0, 0x80, 0x64, 0x91, 0x00, 0xf2, 0x60, 0x80, 0x43, 0x59, 0x8b, 0x20,
+    0x06, 0x28, 0x0a, 0x60, 0xa9, 0x13, 0xb8, 0x82, 0xda, 0x14, 0x00, 0xe0, 0xd1, 0x00, 0xfb, 0x02,
+    0xc0, 0x1c, 0x1a, 0xa4, 0x7d, 0xa8, 0x2c, 0x18, 0xa0, 0x49, 0x82, 0x00, 0x00, 0xf1, 0x7b, 0x80,
+    0x7e, 0xb4, 0x70, 0x0f, 0x45, 0x52, 0xc0, 0x3c, 0x8e, 0x90, 0x01, 0xf4, 0xae, 0xa2, 0x80, 0x7b,
+    0x68, 0xfd, 0x40, 0x38, 0xab, 0xbf, 0x18, 0x03, 0x1e, 0xa8, 0x81, 0xcc, 0x80, 0x2e, 0x03, 0xde,
+    0x90, 0x64, 0x04, 0x20, 0xd2, 0x16, 0x70, 0xf0, 0x30, 0x51, 0x00, 0xac, 0x14, 0x3c, 0x0c, 0x03,
+    0x10, 0x08, 0x78, 0x18, 0x06, 0x20, 0x10, 0x30, 0x40, 0x0d, 0x60, 0xa0, 0x84, 0x36, 0x42, 0xce,
+    0x1c, 0x00, 0xe0, 0x4d, 0xe9, 0x06, 0x50, 0x01, 0xea, 0x88, 0x1c, 0xc8, 0x00, 0x00, 0x00, 0xf0,
+    0x88, 0x03, 0x97, 0x88, 0x03, 0xa1, 0xcc, 0x00, 0x5f, 0xe9, 0x80, 0x0b, 0xd5, 0xa8, 0x40, 0x03,
+    0xd5, 0x3a, 0x01, 0xa7, 0xbe, 0x0c, 0x01, 0x8a, 0x02, 0x98, 0x2a, 0x44, 0xee, 0x20, 0xb6, 0x85,
+    0x00, 0x38, 0x34, 0x40, 0x3e, 0xc0, 0xb0, 0x07, 0x06, 0xa9, 0x1f, 0x6a, 0x0b, 0x06, 0x28, 0x12,
+    0x60, 0x80, 0x00, 0xe8, 0xf1, 0x00, 0xfd, 0x07, 0x00, 0x1f, 0x45, 0x74, 0x00, 0x79, 0x1d, 0x24,
+    0x40, 0x3d, 0x2b, 0xa8, 0xa0, 0x1e, 0xda, 0x3f, 0x50, 0x0e, 0x2a, 0xef, 0xc6, 0x00, 0xc7, 0xaa,
+    0x20, 0x73, 0x20, 0x0b, 0x80, 0xf7, 0xa4, 0x19, 0x01, 0x08, 0x34, 0x85, 0x9c, 0x3c, 0x0c, 0x14,
+    0x40, 0x2b, 0x05, 0x0f, 0x03, 0x00, 0xc4, 0x02, 0x1e, 0x06, 0x01, 0x88, 0x04, 0x0c, 0x10, 0x03,
+    0x58, 0x28, 0x21, 0x0d, 0x90, 0xb3, 0x87, 0x00, 0x38, 0x13, 0x7a, 0x41, 0x94, 0x00, 0x7a, 0xa2,
+    0x07, 0x32, 0x00, 0x00, 0x00, 0xc2, 0x20, 0x0f, 0x47, 0x80, 0x7a, 0x4d, 0xc0, 0x22, 0xff, 0x4b,
+    0x80, 0x5e, 0xad, 0x42, 0x00, 0x1e, 0xa9, 0xd0, 0x0d, 0x3d, 0xf0, 0x60, 0x0c, 0x50, 0x14, 0xc1,
+    0x52, 0x27, 0x71, 0x05, 0xb4, 0x28, 0x01, 0xc1, 0xa2, 0x01, 0xf6, 0x05, 0x80, 0x38, 0x35, 0x48,
+    0xfb, 0x50, 0x58, 0x31, 0x40, 0x93, 0x04, 0x00, 0xe7, 0xf8, 0x00, 0xfc, 0xca, 0x01, 0xf9, 0x5a,
+    0x60, 0x03, 0xc7, 0x53, 0x20, 0x0f, 0xb9, 0x29, 0x54, 0x01, 0xec, 0xb4, 0xe4, 0x00, 0xe2, 0xbe,
+    0xfd, 0x70, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a, 0x41, 0x90, 0x10, 0x83, 0x48,
+    0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c, 0x40, 0x21, 0xe0, 0x60, 0x18,
+    0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38, 0x70, 0x03, 0x81, 0x37, 0xa4,
+    0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x00, 0x00, 0xd3, 0xca, 0x01, 0xd0, 0x46, 0x01, 0xc3,
+    0xcc, 0x01, 0x17, 0xf9, 0x80, 0x37, 0xab, 0x50, 0x80, 0x07, 0xaa, 0x74, 0x03, 0x4f, 0x7c, 0x18,
+    0x03, 0x14, 0x05, 0x30, 0x54, 0x89, 0xdc, 0x41, 0x6d, 0x0a, 0x00, 0x70, 0x68, 0x80, 0x7d, 0x81,
+    0x60, 0x0e, 0x0d, 0x52, 0x3e, 0xd4, 0x16, 0x0c, 0x50, 0x24, 0xc1, 0x00, 0x00, 0xa7, 0x96, 0x60,
+    0x03, 0xcd, 0x76, 0x6b, 0x00, 0xf6, 0xb5, 0xe9, 0x80, 0x7d, 0x95, 0x60, 0x1f, 0x72, 0x5b, 0x20,
+    0x07, 0xba, 0xd3, 0x54, 0x03, 0x8a, 0x3b, 0xf9, 0xc0, 0x31, 0xea, 0x88, 0x1c, 0xc8, 0x02, 0xe0,
+    0x3d, 0xe9, 0x06, 0x40, 0x42, 0x0d, 0x21, 0x67, 0x0f, 0x03, 0x05, 0x10, 0x0a, 0xc1, 0x43, 0xc0,
+    0xc0, 0x31, 0x00, 0x87, 0x81, 0x80, 0x62, 0x01, 0x03, 0x04, 0x00, 0xd6, 0x0a, 0x08, 0x43, 0x64,
+    0x2c, 0xe1, 0xc0, 0x0e, 0x04, 0xde, 0x90, 0x65, 0x00, 0x1e, 0xa8, 0x81, 0xcc, 0x80, 0x00, 0x01,
+    0xdf, 0xf8, 0xc0, 0x03, 0xfb, 0xae, 0x30, 0x0d, 0xba, 0x50, 0x0d, 0xea, 0xd4, 0x20, 0x01, 0xea,
+    0x9d, 0x00, 0xd3, 0xdf, 0x06, 0x00, 0xc5, 0x01, 0x4c, 0x15, 0x22, 0x77, 0x10, 0x5b, 0x42, 0x80,
+    0x1c, 0x1a, 0x20, 0x1f, 0x60, 0x58, 0x03, 0x83, 0x54, 0x8f, 0xb5, 0x05, 0x83, 0x14, 0x09, 0x30,
+    0x40, 0x00, 0xcd, 0x02, 0x01, 0xf2, 0x4b, 0x50, 0x07, 0xd4, 0xba, 0x8c, 0x01, 0xee, 0xa3, 0xf6,
+    0x00, 0xe2, 0xae, 0xfc, 0x60, 0x0c, 0x7a, 0xa2, 0x07, 0x32, 0x00, 0xb8, 0x0f, 0x7a, 0x41, 0x90,
+    0x10, 0x83, 0x48, 0x59, 0xc3, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x50, 0xf0, 0x30, 0x0c, 0x40, 0x21,
+    0xe0, 0x60, 0x18, 0x80, 0x40, 0xc1, 0x00, 0x35, 0x82, 0x82, 0x10, 0xd9, 0x0b, 0x38, 0x70, 0x03,
+    0x81, 0x37, 0xa4, 0x19, 0x40, 0x07, 0xaa, 0x20, 0x73, 0x20, 0x0c, 0x55, 0xdf, 0x8c, 0x01, 0xf5,
+    0x71, 0x00, 0x7e, 0x71, 0x60, 0x0f, 0xd9, 0x84, 0x00, 0xc0, 0x00, 0x17, 0xf9, 0x00, 0x37, 0xab,
+    0xd0, 0x80, 0x5f, 0x51, 0x80, 0x10, 0xc7, 0x7c, 0x98, 0x03, 0x14, 0x05, 0x30, 0x54, 0x89, 0xdc,
+    0x41, 0x6d, 0x0a, 0x00, 0x70, 0x68, 0x80, 0x7d, 0x81, 0x60, 0x0e, 0x0d, 0x52, 0x3e, 0xd4, 0x16,
+    0x0c, 0x50, 0x24, 0xc1, 0x01, 0xae, 0xfb, 0x20, 0x0d, 0x9a, 0x01, 0xe3, 0x21, 0x00, 0xed, 0xc1,
+    0x00, 0x00, 0x00, 0xe2, 0x52, 0x00, 0xfd, 0xd6, 0x60, 0x1f, 0x21, 0xe8, 0xe7, 0x80, 0x72, 0x79,
+    0x80, 0x78, 0xab, 0xbf, 0xe3, 0x30, 0x00, 0xf5, 0x44, 0x02, 0x1d, 0x00, 0x70, 0x1e, 0xf4, 0x80,
+    0xb0, 0x21, 0x06, 0x90, 0xb3, 0x85, 0x81, 0x82, 0x88, 0x05, 0x60, 0x61, 0xe0, 0x60, 0x18, 0x80,
+    0x2f, 0x03, 0x00, 0xc4, 0x02, 0x06, 0x08, 0x01, 0xac, 0x10, 0x10, 0x86, 0xc8, 0x59, 0xc3, 0x80,
+    0x1c, 0x09, 0xbd, 0x20, 0xc8, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x00, 0x00, 0xd9, 0xc2, 0x01,
+    0x94, 0xe9, 0x1c, 0x02, 0x6c, 0x4e, 0x90, 0x1a, 0xdc, 0xf4, 0x50, 0xc5, 0x01, 0x00, 0x52, 0x91,
+    0x3b, 0x88, 0x0d, 0xa1, 0x40, 0x0e, 0x0d, 0x10, 0x0f, 0xb0, 0x2c, 0x01, 0xc1, 0xaa, 0x47, 0xda,
+    0x82, 0xc1, 0x8a, 0x04, 0x98, 0x20, 0x00, 0x91, 0x00, 0x1f, 0xd9, 0x68, 0x01, 0xfa, 0x0e, 0x00,
+    0x19, 0xe0, 0x1d, 0x98, 0x00, 0xf8, 0xab, 0xbf, 0xe3, 0x30, 0x00, 0xf5, 0x44, 0x02, 0x1d, 0x00,
+    0x70, 0x1e, 0xf4, 0x80, 0xb0, 0x21, 0x06, 0x90, 0xb3, 0x85, 0x81, 0x82, 0x88, 0x05, 0x60, 0x61,
+    0xe0, 0x60, 0x18, 0x80, 0x2f, 0x03, 0x00, 0xc4, 0x02, 0x06, 0x08, 0x01, 0xac, 0x10, 0x10, 0x86,
+    0xc8, 0x59, 0xc3, 0x80, 0x1c, 0x09, 0xbd, 0x20, 0xc8, 0x00, 0x3d, 0x51, 0x03, 0x99, 0x00, 0x00,
+    0x00, 0x6f, 0x00, 0x7b, 0x85, 0xc1, 0x5c, 0x00, 0x78, 0x81, 0xd2, 0x03, 0x5b, 0x9e, 0x8a, 0x18,
+    0xa0, 0x20, 0x0a, 0x52, 0x27, 0x71, 0x01, 0xb4, 0x28, 0x01, 0xc1, 0xa2, 0x01, 0xf6, 0x05, 0x80,
+    0x38, 0x35, 0x48, 0xfb, 0x50, 0x58, 0x31, 0x40, 0x93, 0x04, 0x00, 0x87, 0xf9, 0x00, 0x3e, 0x1d,
+    0x17, 0x0c, 0xf0, 0x0e, 0x2e, 0x30, 0x0f, 0x15, 0x77, 0x3f, 0xc6, 0x60, 0x01, 0xea, 0x88, 0x04,
+    0x3a, 0x00, 0xe0, 0x3d, 0xe9, 0x01, 0x60, 0x42, 0x0d, 0x21, 0x67, 0x0b, 0x03, 0x05, 0x10, 0x0a,
+    0xc0, 0xc3, 0xc0, 0xc0, 0x31, 0x00, 0x5e, 0x06, 0x01, 0x88, 0x04, 0x0c, 0x10, 0x03, 0x58, 0x20,
+    0x21, 0x0d, 0x90, 0xb3, 0x87, 0x00, 0x38, 0x13, 0x7a, 0x41, 0x90, 0x00, 0x7a, 0xa2, 0x07, 0x32,
+    0x00, 0x00, 0x00, 0x27, 0xf0, 0x80, 0x64, 0x91, 0x05, 0x70, 0x09, 0x30, 0x7a, 0x40, 0x6b, 0x31,
+    0xe8, 0xa1, 0x8a, 0x02, 0x00, 0xa5, 0x22, 0x77, 0x10, 0x1b, 0x42, 0x80, 0x1c, 0x1a, 0x20, 0x1f,
+    0x60, 0x58, 0x03, 0x83, 0x54, 0x8f, 0xb5, 0x05, 0x83, 0x14, 0x09, 0x30, 0x40, 0x00, 0xff, 0xe1,
+    0x67, 0xfc, 0xc0, 0x1e, 0xff, 0x6e, 0x9b, 0x3c, 0x03, 0x18, 0x11, 0x00, 0x3c, 0x55, 0xdf, 0xf1,
+    0x98, 0x00, 0x7a, 0xa2, 0x01, 0x0e, 0x80, 0x38, 0x0f, 0x7a, 0x40, 0x58, 0x10, 0x83, 0x48, 0x59,
+    0xc2, 0xc0, 0xc1, 0x44, 0x02, 0xb0, 0x30, 0xf0, 0x30, 0x0c, 0x40, 0x17, 0x81, 0x80, 0x62, 0x01,
+    0x03, 0x04, 0x00, 0xd6, 0x08, 0x08, 0x43, 0x64, 0x2c, 0xe1, 0xc0, 0x0e, 0x04, 0xde, 0x90, 0x64,
+    0x00, 0x1e, 0xa8, 0x81, 0xcc, 0x80, 0x00, 0x00, 0x3f, 0x17, 0x00, 0x6b, 0xb6, 0x23, 0x40, 0x03,
+    0x57, 0xab, 0x58, 0x06, 0xfb, 0xfc, 0x8a, 0x18, 0xa0, 0x20, 0x0a, 0x52, 0x27, 0x71, 0x01, 0xb4,
+    0x28, 0x01, 0xc1, 0xa2, 0x01, 0xf6, 0x05, 0x80, 0x38, 0x35, 0x48, 0xfb, 0x50, 0x58, 0x31, 0x40,
+    0x93, 0x04, 0x00, 0xfd, 0x9e, 0x01, 0xff, 0xc2, 0x2a, 0xef, 0xf8, 0xcc, 0x00, 0x3d, 0x51, 0x00,
+    0x87, 0x40, 0x1c, 0x07, 0xbd, 0x20, 0x2c, 0x08, 0x41, 0xa4, 0x2c, 0xe1, 0x60, 0x60, 0xa2, 0x01,
+    0x58, 0x18, 0x78, 0x18, 0x06, 0x20, 0x0b, 0xc0, 0xc0, 0x31, 0x00, 0x81, 0x82, 0x00, 0x6b, 0x04,
+    0x04, 0x21, 0xb2, 0x16, 0x70, 0xe0, 0x07, 0x02, 0x6f, 0x48, 0x32, 0x00, 0x0f, 0x54, 0x40, 0xe6,
+    0x40, 0x18, 0xab, 0xbf, 0x18, 0x03, 0xea, 0xe2, 0x00, 0xfc, 0xe2, 0xc0, 0x1f, 0xb3, 0x08, 0x01,
+    0x80, 0x00, 0xf5, 0xf0, 0x07, 0xf0, 0xd7, 0x7f, 0x91, 0x43, 0x14, 0x04, 0x01, 0x4a, 0x44, 0xee,
+    0x20, 0x36, 0x85, 0x00, 0x38, 0x34, 0x40, 0x3e, 0xc0, 0xb0, 0x07, 0x06, 0xa9, 0x1f, 0x6a, 0x0b,
+    0x06, 0x28, 0x12, 0x60, 0x80, 0xd7, 0x7d, 0x90, 0x06, 0xcd, 0x00, 0xf1, 0x90, 0x80, 0x76, 0xe0,
+    0x80, 0x00, 0x4f, 0xc0, 0x0d, 0xfe, 0x20, 0x0f, 0xff, 0x83, 0x81, 0x00, 0x42, 0x00, 0x33, 0x00,
+    0xc0, 0x0d, 0x81, 0x08, 0x40, 0x3f, 0xf2, 0x84, 0x80, 0x1e, 0x8c, 0x00, 0x98, 0x80, 0x12, 0xe7,
+    0xfa, 0xcc, 0x03, 0x87, 0x70, 0x03, 0xe3, 0x23, 0x00, 0xf8, 0xb3, 0x40, 0x30, 0x4f, 0xb0, 0x04,
+    0x7b, 0x80, 0x7f, 0xf5, 0x1c, 0x14, 0x41, 0x40, 0x06, 0x22, 0xef, 0x20, 0x0a, 0x88, 0x15, 0xc0,
+    0x24, 0xdf, 0xa8, 0xf7, 0x00, 0xab, 0x88, 0x03, 0x9c, 0x58, 0x03, 0xb3, 0x08, 0x00, 0x00, 0x00,
+    0x9b, 0xf4, 0x03, 0xe7, 0x83, 0x00, 0xf8, 0x53, 0x40, 0x32, 0x7e, 0x01, 0x98, 0x3f, 0xc4, 0x01,
+    0xff, 0xf0, 0x70, 0x20, 0x08, 0x40, 0x06, 0x60, 0x18, 0x01, 0xb0, 0x21, 0x08, 0x07, 0xfe, 0x50,
+    0x90, 0x03, 0xd1, 0x80, 0x13, 0x10, 0x00, 0x00, 0x1f, 0xf1, 0x00, 0x63, 0xa1, 0x00, 0xf3, 0xe1,
+    0x00, 0x13, 0xec, 0x8e, 0x3d, 0xc0, 0x3f, 0xfa, 0x8e, 0x0a, 0x20, 0xa0, 0x03, 0x11, 0x77, 0x90,
+    0x05, 0x44, 0x0a, 0xe0, 0x00, 0x00, 0xe3, 0x50, 0x0f, 0xc5, 0x9e, 0x01, 0xfa, 0xca, 0x81, 0xf4,
+    0xc0, 0x34, 0xe8, 0x03, 0x89, 0xd3, 0xf0, 0x03, 0x7b, 0x03, 0x00, 0x7f, 0x59, 0x00, 0x7f, 0x30,
+    0x07, 0xff, 0x85, 0xc0, 0x80, 0x21, 0x00, 0x18, 0x18, 0x0c, 0x00, 0xd8, 0x10, 0x80, 0x20, 0x1f,
+    0xf9, 0x42, 0x40, 0x27, 0xa3, 0x00, 0x26, 0x20, 0x00, 0x00, 0xd9, 0xe4, 0x01, 0xc8, 0x74, 0x4e,
+    0xc0, 0x13, 0xda, 0x84, 0xd2, 0x7d, 0x9a, 0x47, 0x8a, 0x80, 0x7c, 0xd2, 0x01, 0xf7, 0x00, 0x7f,
+    0xf1, 0xdc, 0x14, 0x41, 0x40, 0x23, 0x11, 0x77, 0x90, 0x06, 0xa2, 0x05, 0x70, 0x08, 0x00, 0x0a,
+    0x98, 0x07, 0xe1, 0x9d, 0x00, 0xfe, 0xe0, 0x70, 0x03, 0xe9, 0x80, 0x45, 0xce, 0x00, 0xe2, 0x74,
+    0xfc, 0x00, 0xde, 0xc0, 0xc0, 0x1f, 0xd6, 0x40, 0x1f, 0xcc, 0x01, 0xff, 0xe1, 0x70, 0x20, 0x08,
+    0x40, 0x06, 0x06, 0x03, 0x00, 0x36, 0x04, 0x20, 0x08, 0x07, 0xfe, 0x50, 0x90, 0x09, 0xe8, 0xc0,
+    0x09, 0x88, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x7d, 0xe2, 0xe0, 0x07, 0x60, 0x01, 0x61, 0x80, 0x26,
+    0x93, 0xec, 0xd2, 0x3c, 0x54, 0x03, 0xe6, 0x90, 0x0f, 0xb8, 0x03, 0xff, 0x8e, 0xe0, 0xa2, 0x0a,
+    0x01, 0x18, 0x8b, 0xbc, 0x80, 0x35, 0x10, 0x2b, 0x80, 0x40, 0x00, 0x9b, 0xf4, 0x03, 0xf3, 0xc1,
+    0x80, 0x12, 0x08, 0x02, 0x14, 0xd0, 0x06, 0x3b, 0x27, 0xe0, 0x19, 0x83, 0xdc, 0x18, 0x03, 0xfa,
+    0xc8, 0x03, 0xf9, 0x80, 0x3f, 0xfc, 0x2e, 0x04, 0x01, 0x08, 0x00, 0xc0, 0xc0, 0x60, 0x06, 0xc0,
+    0x84, 0x01, 0x00, 0xff, 0xca, 0x12, 0x01, 0x3d, 0x18, 0x01, 0x31, 0x00, 0x00, 0x00, 0x1f, 0xf1,
+    0x00, 0x71, 0xd0, 0x80, 0x1d, 0x80, 0x27, 0xc2, 0x09, 0xa4, 0xfb, 0x23, 0x8f, 0x15, 0x00, 0xf9,
+    0xa4, 0x03, 0xee, 0x00, 0xff, 0xe3, 0xb8, 0x28, 0x82, 0x80, 0x46, 0x22, 0xef, 0x20, 0x0d, 0x44,
+    0x0a, 0xe0, 0x10, 0x00, 0xff, 0xe0, 0x97, 0x7f, 0xc4, 0x01, 0xc7, 0xb9, 0x8e, 0x26, 0xc3, 0x00,
+    0x09, 0x9c, 0x21, 0xe6, 0xe9, 0xf8, 0x01, 0xbd, 0x81, 0x80, 0x3f, 0xac, 0x80, 0x3f, 0x98, 0x03,
+    0xff, 0xc2, 0xe0, 0x40, 0x10, 0x80, 0x0c, 0x0c, 0x06, 0x00, 0x6c, 0x08, 0x40, 0x10, 0x0f, 0xfc,
+    0xa1, 0x20, 0x13, 0xd1, 0x80, 0x13, 0x10, 0x00, 0x00, 0x00, 0x5e, 0xa6, 0x30, 0x04, 0x49, 0x76,
+    0x37, 0x73, 0x01, 0x6b, 0x7f, 0x0c, 0xd2, 0x7c, 0x80, 0x27, 0xc5, 0x40, 0x3e, 0x69, 0x00, 0xfb,
+    0x80, 0x3f, 0xf8, 0xee, 0x0a, 0x20, 0xa0, 0x11, 0x88, 0xbb, 0xc8, 0x03, 0x51, 0x02, 0xb8, 0x04,
+    0x00, 0x00, 0xfd, 0x1e, 0x80, 0x1f, 0x84, 0x00, 0x9f, 0x80, 0x1b, 0xd8, 0x18, 0x03, 0xfa, 0xc8,
+    0x03, 0xf9, 0x80, 0x3f, 0xfc, 0x2e, 0x04, 0x01, 0x08, 0x00, 0xc0, 0xc0, 0x60, 0x06, 0xc0, 0x84,
+    0x01, 0x00, 0xff, 0xca, 0x12, 0x01, 0x3d, 0x18, 0x01, 0x31, 0x00, 0x32, 0xe7, 0xfa, 0xcc, 0x03,
+    0xc3, 0xb8, 0x01, 0xf8, 0xc8, 0xc0, 0x3f, 0x16, 0x68, 0x07, 0x00, 0x00, 0xfb, 0xb0, 0x03, 0xf3,
+    0xa7, 0xd8, 0x02, 0x3c, 0x48, 0x03, 0xe6, 0x90, 0x0f, 0xb8, 0x03, 0xff, 0x8e, 0xe0, 0xa2, 0x0a,
+    0x01, 0x18, 0x8b, 0xbc, 0x80, 0x35, 0x10, 0x2b, 0x80, 0x64, 0xdf, 0xa8, 0xf7, 0x00, 0xd5, 0xc4,
+    0x01, 0xe7, 0x16, 0x00, 0xf6, 0x61, 0x00, 0x20, 0x00, 0x12, 0x90, 0x07, 0xc5, 0x1e, 0x01, 0xfb,
+    0x89, 0x80, 0x3e, 0x3f, 0x60, 0x0d, 0x5f, 0x60, 0x10, 0xff, 0x96, 0x01, 0x10, 0x00, 0x90, 0x35,
+    0x26, 0x08, 0x01, 0x70, 0xf0, 0x04, 0x01, 0xa4, 0x02, 0x18, 0x00, 0x60, 0x25, 0x82, 0x40, 0x33,
+    0x89, 0x02, 0x90, 0x07, 0x40, 0x02, 0x00, 0x3c, 0x80, 0x24, 0x01, 0xff, 0xd5, 0x00, 0x03, 0xfa,
+    0x00, 0xe3, 0x85, 0x20, 0x0e, 0x7b, 0x00, 0xd7, 0xea, 0x85, 0x3e, 0xfa, 0x1e, 0x00, 0x70, 0x57,
+    0x05, 0x03, 0x13, 0x21, 0x50, 0x4b, 0x0b, 0x00, 0x78, 0x6a, 0x03, 0x00, 0x14, 0x1c, 0xcc, 0x20,
+    0x13, 0x08, 0x50, 0x06, 0xd0, 0x03, 0x80, 0x62, 0x04, 0x10, 0x00, 0xdc, 0x87, 0x00, 0x64, 0x07,
+    0x50, 0x08, 0xaf, 0xb0, 0x08, 0x7f, 0xcb, 0x00, 0x88, 0x00, 0x48, 0x1a, 0x93, 0x04, 0x00, 0xb8,
+    0x78, 0x02, 0x00, 0xd2, 0x01, 0x0c, 0x00, 0x30, 0x12, 0xc1, 0x20, 0x19, 0xc4, 0x81, 0x48, 0x03,
+    0xa0, 0x01, 0x00, 0x1e, 0x40, 0x12, 0x00, 0xff, 0xec, 0x17, 0xf0, 0x07, 0xc3, 0xd6, 0x01, 0xf1,
+    0x0a, 0x80, 0x7c, 0x79, 0x80, 0x0c, 0x00, 0xbf, 0x50, 0x04, 0xfb, 0xe8, 0x78, 0x01, 0xc1, 0x5c,
+    0x14, 0x0c, 0x4c, 0x85, 0x41, 0x2c, 0x2c, 0x01, 0xe1, 0xa8, 0x0c, 0x00, 0x50, 0x73, 0x30, 0x80,
+    0x4c, 0x21, 0x40, 0x1b, 0x40, 0x0e, 0x01, 0x88, 0x10, 0x40, 0x03, 0x72, 0x1c, 0xf2, 0x00, 0x40,
+    0x75, 0x86, 0x31, 0xff, 0x40, 0x65, 0x98, 0x00, 0x9f, 0xf0, 0x03, 0xe6, 0x60, 0x80, 0x7c, 0x35,
+    0xe0, 0x1a, 0xbe, 0xc0, 0xc8, 0x7f, 0xcb, 0x00, 0x88, 0x00, 0x48, 0x1a, 0x93, 0x04, 0x00, 0xb8,
+    0x78, 0x02, 0x00, 0xd2, 0x01, 0x0c, 0x00, 0x30, 0x12, 0xc1, 0x20, 0x19, 0xc4, 0x81, 0x48, 0x03,
+    0xa0, 0x01, 0x00, 0x1e, 0x40, 0x12, 0x00, 0xff, 0xea, 0x80, 0x00, 0x47, 0xd8, 0x07, 0x4a, 0xb8,
+    0x07, 0x0f, 0x70, 0x02, 0xbf, 0x54, 0x29, 0xf7, 0xd0, 0xf0, 0x03, 0x82, 0xb8, 0x28, 0x18, 0x99,
+    0x0a, 0x82, 0x58, 0x58, 0x03, 0xc3, 0x50, 0x18, 0x00, 0xa0, 0xe6, 0x61, 0x00, 0x98, 0x42, 0x80,
+    0x36, 0x80, 0x1c, 0x03, 0x10, 0x20, 0x80, 0x06, 0xe4, 0x38, 0x03, 0x20, 0x3a, 0x80, 0x40, 0x00,
+    0xff, 0xe0, 0x0f, 0x61, 0x79, 0x00, 0x66, 0x24, 0xd3, 0x20, 0x0c, 0xdb, 0x1d, 0x80, 0x15, 0x7d,
+    0x08, 0x08, 0xbf, 0xcb, 0x00, 0x88, 0x00, 0x48, 0x1a, 0x93, 0x04, 0x00, 0xb8, 0x78, 0x02, 0x00,
+    0xd2, 0x01, 0x0c, 0x00, 0x30, 0x12, 0xc1, 0x20, 0x19, 0xc4, 0x81, 0x48, 0x03, 0xa0, 0x01, 0x00,
+    0x1e, 0x40, 0x12, 0x00, 0xff, 0xea, 0x80, 0x02, 0xeb, 0x3f, 0x10, 0x05, 0x29, 0x62, 0x08, 0x02,
+    0x6a, 0x7a, 0xc0, 0x17, 0xc8, 0x03, 0x3e, 0xfa, 0x1e, 0x00, 0x70, 0x57, 0x05, 0x03, 0x13, 0x21,
+    0x50, 0x4b, 0x0b, 0x00, 0x78, 0x6a, 0x03, 0x00, 0x14, 0x1c, 0xcc, 0x20, 0x13, 0x08, 0x50, 0x06,
+    0xd0, 0x03, 0x80, 0x62, 0x04, 0x10, 0x00, 0xdc, 0x87, 0x00, 0x64, 0x07, 0x50, 0x08, 0xef, 0x3a,
+    0xf7, 0x00, 0xff, 0xff, 0x80, 0x7f, 0xf2, 0x31, 0x42, 0x3f, 0xf0, 0x80, 0x7f, 0xc0, 0x01, 0xff,
+    0x0e, 0x7a, 0x8b, 0x70, 0x03, 0x8c, 0x2b, 0x9e, 0xc0, 0x16, 0x41, 0x16, 0x28, 0x00, 0x41, 0x03,
+    0x40, 0x0f, 0xff, 0x98, 0x00, 0xff, 0x8e, 0xb8, 0x03, 0x36, 0x28, 0x06, 0x39, 0x09, 0xe0, 0x0a,
+    0x02, 0x18, 0x40, 0x24, 0x06, 0x2e, 0x80, 0x20, 0x11, 0x81, 0xd4, 0x40, 0xc0, 0xe4, 0x24, 0x40,
+    0xc0, 0x08, 0x04, 0x41, 0x12, 0x02, 0x01, 0x04, 0x85, 0xec, 0x84, 0x83, 0xc9, 0x15, 0x4a, 0x00,
+    0x00, 0xc7, 0x20, 0x1d, 0x18, 0xc6, 0x01, 0x43, 0x85, 0x18, 0x00, 0xdc, 0x31, 0x40, 0x28, 0x07,
+    0x31, 0x00, 0x90, 0x24, 0xba, 0x00, 0x40, 0x46, 0x07, 0x43, 0x03, 0x03, 0x90, 0xf3, 0x03, 0x00,
+    0x28, 0x30, 0x90, 0x98, 0x28, 0x30, 0x58, 0x66, 0x24, 0x3c, 0x1a, 0x48, 0xca, 0x90, 0x0a, 0xf8,
+    0x00, 0x9b, 0xf4, 0x01, 0x00, 0xe2, 0x00, 0xb0, 0x80, 0x01, 0x28, 0x30, 0x21, 0x11, 0x40, 0x28,
+    0x09, 0x0f, 0x0b, 0x00, 0xc4, 0xa3, 0x28, 0x2c, 0x01, 0x37, 0x28, 0x30, 0x48, 0x04, 0x92, 0x22,
+    0x00, 0x0b, 0x80, 0x5c, 0x19, 0xe0, 0x09, 0x00, 0xff, 0x30, 0x06, 0xe0, 0xcf, 0x08, 0x10, 0x0c,
+    0x90, 0x20, 0xee, 0x00, 0xe0, 0x03, 0x86, 0x00, 0x1c, 0x28, 0x0b, 0xc8, 0x02, 0x5c, 0x80, 0x88,
+    0x06, 0x0a, 0x0a, 0x00, 0x50, 0xb4, 0x02, 0x20, 0x02, 0x81, 0x30, 0x14, 0x02, 0x22, 0x1a, 0x85,
+    0x00, 0x1f, 0x88, 0x08, 0xa0, 0x58, 0x10, 0x09, 0x40, 0x1c, 0x1b, 0xc0, 0x0b, 0x00, 0xf8, 0x8c,
+    0x01, 0xa1, 0xbc, 0x16, 0x01, 0x34, 0x08, 0x9d, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xcc, 0xa0, 0x67, 0x88, 0x2c, 0xcc, 0xa0, 0x67, 0x88,
+    0x6c, 0xcf, 0x9f, 0xcc, 0xfe, 0xe0, 0xcc, 0xf8, 0xcf, 0xe0, 0xcc, 0xff, 0xe1, 0x19, 0xff, 0xf0,
+    0x80, 0xcc, 0xff, 0xe1, 0x19, 0xff, 0xf0, 0x80, 0x12, 0x01, 0x20, 0x9d, 0x6f, 0xd0, 0x0f, 0xff,
+    0xf8, 0x07, 0xff, 0x40, 0x0f, 0xff, 0x28, 0x6e, 0xf9, 0x43, 0x77, 0xca, 0x1b, 0xbe, 0x50, 0x09,
+    0xd0, 0x46, 0x12, 0x22, 0x07, 0x2f, 0x38, 0x01, 0x1b, 0xb4, 0x81, 0x18, 0x30, 0x81, 0x00, 0x01,
+    0x12, 0xf4, 0x90, 0x67, 0x02, 0x11, 0x80, 0xaf, 0x3c, 0x06, 0x70, 0x21, 0x17, 0x07, 0xc0, 0x09,
+    0xd0, 0xbb, 0x02, 0x30, 0x20, 0x88, 0x88, 0x60, 0x48, 0x1c, 0x81, 0xcb, 0xce, 0xdc, 0xc0, 0x01,
+    0x10, 0x08, 0xdd, 0xa9, 0xd0, 0x40, 0x84, 0x18, 0xc1, 0x9c, 0x08, 0x40, 0x84, 0x41, 0x00, 0x01,
+    0x10, 0x08, 0x2f, 0x4c, 0x72, 0x90, 0x61, 0x02, 0x70, 0x23, 0x10, 0x91, 0x81, 0x20, 0x00, 0xaf,
+    0x3d, 0xf0, 0xc0, 0x64, 0x02, 0x70, 0x2c, 0x06, 0x11, 0x72, 0x01, 0x07, 0xc0, 0xf3, 0x00, 0x00,
+    0xbf, 0xc0, 0x1f, 0xfc, 0x0b, 0xb0, 0x02, 0xec, 0x02, 0x88, 0x00, 0x22, 0x00, 0x7f, 0xc0, 0x0f,
+    0xf0, 0x07, 0xff, 0x00, 0x48, 0x03, 0xc4, 0xc0, 0x1e, 0xda, 0x00, 0x80, 0x00, 0xbf, 0xc0, 0x1f,
+    0xf0, 0xff, 0x80, 0x1f, 0xe0, 0x14, 0x40, 0x01, 0x10, 0x00, 0xbb, 0x00, 0x2e, 0xc0, 0x3f, 0xe0,
+    0x07, 0xf8, 0x05, 0x10, 0x00, 0x44, 0x00, 0x2e, 0xc0, 0x0b, 0xb0, 0x07, 0xff, 0x00, 0x88, 0x01,
+    0xe6, 0x60, 0x04, 0x00, 0x01, 0xaa, 0x08, 0x03, 0x15, 0x58, 0x04, 0x40, 0x01, 0x14, 0x01, 0x88,
+    0x2c, 0x45, 0x60, 0x00, 0x43, 0x00, 0x8f, 0x20, 0x03, 0x3e, 0x00, 0x49, 0xc0, 0x33, 0x64, 0x0c,
+    0xc0, 0x08, 0x06, 0x26, 0x9e, 0x51, 0x40, 0x06, 0x20, 0x46, 0x06, 0x9e, 0x0b, 0x93, 0x51, 0x40,
+    0x41, 0x20, 0x06, 0x20, 0x46, 0x01, 0x71, 0x69, 0xe0, 0xb9, 0x39, 0x8b, 0x51, 0x40, 0x41, 0x2c,
+    0x0c, 0x00, 0x06, 0x26, 0x9e, 0x51, 0x40, 0x00, 0x03, 0xdf, 0x90, 0x08, 0x79, 0xc0, 0x3f, 0x68,
+    0xc3, 0x30, 0x01, 0x66, 0xe0, 0x1f, 0x08, 0xa5, 0xcb, 0xc1, 0x17, 0x80, 0x3f, 0x08, 0xb0, 0xcb,
+    0xc2, 0x58, 0xc0, 0x3f, 0xb5, 0x75, 0xda, 0x0e, 0x40, 0x3f, 0xc7, 0x9d, 0x06, 0xf5, 0x1f, 0xe5,
+    0x06, 0xff, 0x30, 0x07, 0xbd, 0x5d, 0xe5, 0xa2, 0x96, 0x64, 0x88, 0x06, 0x72, 0xb5, 0x08, 0x90,
+    0xa0, 0x8b, 0x04, 0x00, 0x8a, 0x20, 0x20, 0x1f, 0xfc, 0x29, 0x46, 0x05, 0x09, 0x81, 0xa0, 0xb8,
+    0x04, 0x00, 0x2a, 0x48, 0x00, 0xe1, 0xd6, 0x8a, 0x51, 0x14, 0x20, 0x03, 0xdf, 0x90, 0x08, 0x79,
+    0xc0, 0x3f, 0xf8, 0x3a, 0x30, 0xcc, 0x00, 0x59, 0xb8, 0x07, 0xff, 0x00, 0x45, 0x2e, 0x5e, 0x08,
+    0xbc, 0x01, 0xff, 0xc1, 0x11, 0x61, 0x97, 0x84, 0xb1, 0x80, 0x7f, 0xf0, 0xb5, 0x75, 0xda, 0x0e,
+    0x40, 0x3f, 0xf8, 0x67, 0x9d, 0x06, 0xf5, 0x1f, 0xe5, 0x06, 0xff, 0x30, 0x2f, 0xfa, 0x00, 0x3d,
+    0xea, 0xef, 0x2d, 0x14, 0xb3, 0x24, 0xa9, 0x5d, 0xc6, 0x01, 0x9c, 0xad, 0x42, 0x24, 0x28, 0x22,
+    0xc2, 0x82, 0x60, 0x14, 0x02, 0x28, 0x80, 0x80, 0x7f, 0xf1, 0xe5, 0x18, 0x14, 0x26, 0x06, 0x82,
+    0xe0, 0x28, 0x22, 0x41, 0x00, 0x0a, 0x92, 0x00, 0x38, 0x75, 0xa2, 0x94, 0x45, 0x15, 0xab, 0xc1,
+    0x00, 0x0f, 0xc2, 0x05, 0x10, 0xc7, 0x07, 0x5b, 0x20, 0x0f, 0xc0, 0x8f, 0x42, 0x05, 0x02, 0x05,
+    0x10, 0xc0, 0x12, 0x17, 0x07, 0x07, 0x70, 0x2d, 0x90, 0x7c, 0x00, 0x0f, 0xc0, 0x8f, 0x40, 0xfc,
+    0x20, 0x50, 0x20, 0x51, 0x05, 0x10, 0xc0, 0x12, 0x12, 0x0c, 0x70, 0x70, 0x77, 0x03, 0x83, 0xad,
+    0x90, 0x7c, 0x02, 0xd9, 0x00, 0x4f, 0x85, 0x02, 0x12, 0x10, 0x77, 0x04, 0x78, 0x4f, 0x80, 0xcf,
+    0x05, 0x02, 0x05, 0x02, 0x12, 0x10, 0xc0, 0x10, 0x77, 0x03, 0x83, 0x84, 0x78, 0x15, 0xa8, 0x4f,
+    0x80, 0xcf, 0x04, 0xf8, 0x50, 0x20, 0x50, 0x24, 0x02, 0x12, 0x10, 0xc0, 0x10, 0x21, 0x07, 0x70,
+    0x38, 0x38, 0x3b, 0x82, 0x3c, 0x0a, 0xd4, 0x23, 0xc0, 0x00, 0x0c, 0x18, 0x06, 0xa7, 0xd1, 0x00,
+    0x2a, 0x61, 0xd8, 0x0d, 0xb9, 0xf2, 0xa8, 0x00, 0x3f, 0xe0, 0x00, 0xe0, 0x74, 0x07, 0x42, 0x84,
+    0x10, 0x44, 0x80, 0x05, 0x50, 0xd0, 0x05, 0x44, 0xac, 0x01, 0x7b, 0x88, 0x00, 0x5f, 0xd0, 0x09,
+    0x58, 0xa8, 0x02, 0x93, 0x57, 0x00, 0xac, 0x2c, 0x00, 0x70, 0x1c, 0x03, 0xa1, 0x64, 0x0a, 0xd4,
+    0x80, 0x00, 0x00, 0xff, 0xe0, 0x3f, 0xb0, 0x06, 0x3c, 0xf0, 0xec, 0x30, 0x02, 0x9b, 0x4b, 0x1a,
+    0x85, 0xc4, 0x06, 0x46, 0x21, 0x4e, 0x26, 0x20, 0x26, 0x22, 0xce, 0x91, 0x51, 0x9e, 0xb0, 0x82,
+    0x7a, 0x62, 0x80, 0x05, 0xb7, 0xfb, 0x96, 0xc0, 0x05, 0x22, 0x03, 0x44, 0x00, 0x5f, 0xc0, 0xef,
+    0x30, 0x0c, 0x60, 0x01, 0x07, 0x00, 0xff, 0x0b, 0x80, 0x42, 0x01, 0x84, 0x03, 0xfc, 0x62, 0x7a,
+    0x0a, 0x60, 0x54, 0xa1, 0x54, 0x15, 0x9f, 0x0d, 0x94, 0x71, 0x40, 0x41, 0x50, 0x05, 0xcf, 0xe9,
+    0x00, 0x1d, 0x19, 0x0b, 0x50, 0x29, 0xce, 0xe8, 0x14, 0x1b, 0x3b, 0x82, 0x02, 0x01, 0x78, 0xe8,
+    0x40, 0x04, 0x40, 0x32, 0xc0, 0x10, 0x84, 0x30, 0x06, 0x59, 0x50, 0x0e, 0x11, 0x00, 0x7a, 0x22,
+    0x00, 0xec, 0x0c, 0x00, 0x80, 0x8b, 0xbe, 0x94, 0x4f, 0x38, 0x48, 0x20, 0x0f, 0x24, 0x88, 0x36,
+    0xf5, 0xdd, 0x9f, 0x64, 0x29, 0xd0, 0x4a, 0x88, 0x15, 0xbb, 0x00, 0x00, 0x91, 0xa1, 0xd8, 0x80,
+    0x33, 0xf5, 0xcb, 0xc4, 0xee, 0x20, 0x3c, 0xb5, 0xf7, 0xfb, 0x69, 0xec, 0x5f, 0xa1, 0x04, 0x00,
+    0x4b, 0x7c, 0x20, 0x00, 0xca, 0x40, 0x10, 0xd4, 0x80, 0x56, 0x10, 0x00, 0x35, 0x51, 0x80, 0x3c,
+    0x2c, 0x00, 0xa6, 0x06, 0x00, 0x81, 0x09, 0x06, 0x28, 0x82, 0x21, 0xa5, 0x9e, 0x50, 0x00, 0xc2,
+    0x40, 0x1f, 0x1e, 0x62, 0x40, 0x3d, 0xe4, 0x2c, 0x60, 0x1d, 0x20, 0x04, 0x30, 0x0e, 0x47, 0x4e,
+    0x00, 0xcd, 0x9b, 0xaa, 0xff, 0x48, 0x02, 0x4c, 0xd7, 0x2a, 0x0c, 0xc0, 0x60, 0x04, 0xd0, 0x00,
+    0x5c, 0x31, 0x10, 0x64, 0xe2, 0xc2, 0x0b, 0x54, 0x40, 0x8c, 0x80, 0x00, 0xbc, 0xc5, 0xa1, 0x99,
+    0x00, 0x00, 0xf2, 0x79, 0x80, 0x7a, 0x58, 0xc0, 0x3a, 0x0e, 0x40, 0x38, 0xde, 0x80, 0x3d, 0xea,
+    0x80, 0x1c, 0xe5, 0x60, 0x1c, 0x51, 0x01, 0x00, 0xe9, 0x36, 0x00, 0xe5, 0x4e, 0x00, 0xe1, 0xb8,
+    0x20, 0x0e, 0xb3, 0x70, 0x0f, 0x00, 0x1b, 0xb8, 0x41, 0x12, 0x30, 0x00, 0xf9, 0x00, 0x7f, 0xf1,
+    0x46, 0x84, 0x02, 0x53, 0x00, 0x0f, 0x90, 0x07, 0xff, 0x14, 0x6c, 0x40, 0x24, 0x30, 0x6b, 0xb4,
+    0x72, 0x25, 0x16, 0x01, 0xff, 0xc2, 0x5f, 0x00, 0x6a, 0x00, 0x22, 0xc0, 0x3f, 0xf8, 0x4b, 0x00,
+    0x0d, 0x30, 0x00, 0x02, 0xbf, 0xf5, 0x90, 0x00, 0xaf, 0xfd, 0x44, 0x03, 0x88, 0x22, 0x4c, 0x01,
+    0xc4, 0x21, 0x5f, 0x07, 0x15, 0xee, 0x18, 0xab, 0x0b, 0x6f, 0x11, 0x10, 0xa2, 0x40, 0x0e, 0x02,
+    0x71, 0x60, 0x01, 0x07, 0x47, 0x30, 0x74, 0x24, 0x43, 0x90, 0x41, 0x9c, 0x01, 0x54, 0x1e, 0x00,
+    0x6b, 0x74, 0xd0, 0x08, 0x54, 0xb0, 0x40, 0x22, 0x43, 0xb1, 0x00, 0xcb, 0x40, 0x1e, 0x5a, 0x00,
+    0xe1, 0xc4, 0x00, 0xe2, 0xc5, 0x00, 0xe4, 0x9d, 0x00, 0xe5, 0x9e, 0x00, 0xe6, 0x14, 0x00, 0xe7,
+    0x14, 0x00, 0x80, 0x02, 0xbf, 0xf5, 0x90, 0x37, 0xd8, 0xe2, 0x08, 0x93, 0x00, 0xc0, 0x0e, 0x29,
+    0xdc, 0x31, 0x40, 0x08, 0x9e, 0x00, 0x0e, 0x01, 0x85, 0x20, 0xc1, 0x50, 0x50, 0x40, 0x39, 0xe8,
+    0x74, 0x02, 0x30, 0x0a, 0x07, 0xcc, 0x03, 0xc4, 0x08, 0x20, 0x07, 0x01, 0x00, 0x14, 0xc8, 0x02,
+    0x38, 0xa0, 0x02, 0x4e, 0x80, 0x4d, 0x1c, 0x00, 0x61, 0x40, 0x09, 0x45, 0x00, 0x5f, 0xc0, 0x03,
+    0xef, 0xeb, 0x00, 0x74, 0x40, 0xd4, 0xe5, 0x84, 0x1c, 0x1c, 0x3e, 0xa8, 0x14, 0x01, 0xa6, 0x84,
+    0x02, 0x77, 0x00, 0x4c, 0xa0, 0x52, 0x1c, 0x00, 0x10, 0x08, 0xf4, 0xa1, 0x40, 0x3d, 0x41, 0x2e,
+    0x02, 0x7a, 0x01, 0x09, 0xb8, 0x00, 0xa9, 0x40, 0x2b, 0xa1, 0x00, 0x2c, 0xf8, 0x05, 0xd2, 0xa0,
+    0x07, 0x14, 0x00, 0x90, 0x5c, 0x00, 0x00, 0xbf, 0xfd, 0x66, 0x45, 0x00, 0xc6, 0xeb, 0xc0, 0x80,
+    0x26, 0x0f, 0x00, 0x84, 0x08, 0x02, 0x20, 0x60, 0x0b, 0xc0, 0x40, 0x22, 0x02, 0x00, 0x84, 0x03,
+    0x98, 0x80, 0x31, 0x08, 0x00, 0x3f, 0xfd, 0x86, 0x01, 0x11, 0x00, 0xf0, 0x80, 0x17, 0x00, 0x15,
+    0x00, 0x7c, 0x40, 0x1f, 0x10, 0x07, 0xd4, 0x01, 0x85, 0x30, 0x80, 0x25, 0xeb, 0x30, 0x0f, 0xfe,
+    0x68, 0x01, 0xbf, 0xfc, 0x61, 0xa8, 0x10, 0xe0, 0x01, 0x30, 0x01, 0x70, 0x07, 0xf8, 0x48, 0x03,
+    0xee, 0x20, 0xa9, 0x00, 0x8f, 0x75, 0x99, 0x18, 0x0f, 0xfd, 0x86, 0x01, 0x2d, 0x01, 0xe8, 0x04,
+    0x6e, 0x00, 0x14, 0x00, 0xff, 0xe1, 0xa8, 0x01, 0xb4, 0x01, 0x42, 0x19, 0x96, 0xfa, 0x80, 0x00,
+    0x88, 0x40, 0x21, 0x0f, 0x41, 0x00, 0x6c, 0x86, 0xfa, 0x04, 0x21, 0x3b, 0x28, 0x19, 0x80, 0x06,
+    0x60, 0xd8, 0x39, 0x71, 0x0a, 0x61, 0x3c, 0x30, 0x2e, 0x80, 0x41, 0x40, 0x68, 0xe0, 0x03, 0x90,
+    0x07, 0x84, 0x40, 0x5d, 0x40, 0x42, 0xc0, 0x04, 0x20, 0x06, 0x00, 0x80, 0x01, 0x7c, 0xef, 0xf6,
+    0xca, 0x00, 0x13, 0xe0, 0x55, 0x48, 0x2d, 0x76, 0x00, 0x4f, 0x6d, 0xd5, 0xe7, 0xd9, 0x02, 0x38,
+    0x80, 0x79, 0x24, 0x03, 0xff, 0xfe, 0x01, 0xff, 0xca, 0x58, 0x20, 0x0f, 0x24, 0x80, 0xb6, 0xf5,
+    0xd5, 0xe7, 0xd9, 0x02, 0x7c, 0x12, 0xa9, 0x05, 0xae, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x43, 0x8c,
+    0x09, 0x80, 0x06, 0xa0, 0xb5, 0x01, 0xc1, 0x01, 0xc0, 0x29, 0x60, 0x9b, 0x02, 0xea, 0x07, 0xf0,
+    0x00, 0x96, 0x00, 0x80, 0x7f, 0x09, 0x60, 0x08, 0x17, 0x28, 0x3f, 0x89, 0x4c, 0x82, 0x60, 0x45,
+    0xe2, 0x03, 0xe0, 0x05, 0xa0, 0xb5, 0x01, 0xc7, 0x05, 0xc0, 0x00, 0x00, 0xfa, 0xb4, 0x07, 0x74,
+    0x20, 0x04, 0x5e, 0x04, 0x22, 0x20, 0x02, 0x58, 0xc1, 0x08, 0x88, 0x10, 0x72, 0x00, 0x1d, 0xd0,
+    0x9b, 0xd0, 0x07, 0xde, 0xa8, 0x01, 0xe7, 0x2b, 0x00, 0xf1, 0x44, 0x04, 0xbb, 0x00, 0x29, 0x36,
+    0x0a, 0x13, 0x30, 0x2a, 0x70, 0x02, 0x84, 0xcc, 0x37, 0x04, 0x00, 0x2e, 0xc0, 0x00, 0x19, 0xee,
+    0x5a, 0x00, 0x0c, 0x00, 0xc0, 0x69, 0x7d, 0xb8, 0xa3, 0xbd, 0xba, 0x73, 0x24, 0x70, 0x00, 0x0b,
+    0x45, 0x4c, 0x20, 0x06, 0x9e, 0x97, 0x56, 0x7b, 0xe5, 0x07, 0x48, 0xce, 0xff, 0x6d, 0x3d, 0x8b,
+    0xeb, 0x98, 0x80, 0x09, 0x67, 0x84, 0x02, 0x0f, 0xa2, 0x00, 0x0e, 0x50, 0x0e, 0x48, 0x0a, 0xa8,
+    0x10, 0x7c, 0x25, 0xc0, 0x36, 0xaa, 0x8c, 0x03, 0x21, 0x63, 0x80, 0x6c, 0x71, 0x64, 0x03, 0x19,
+    0x01, 0xcb, 0x06, 0xda, 0x00, 0x0f, 0xc0, 0x8f, 0x40, 0xfc, 0x08, 0xf4, 0x20, 0x50, 0x20, 0x51,
+    0x05, 0x01, 0x05, 0x10, 0xc0, 0x12, 0x12, 0x0c, 0x02, 0x20, 0xb8, 0x38, 0x3b, 0x81, 0xc1, 0xc1,
+    0xdc, 0x0b, 0x64, 0x1f, 0x00, 0xb6, 0x41, 0xf0, 0x00, 0x00, 0x02, 0xbf, 0xeb, 0x20, 0x0d, 0x88,
+    0x64, 0x98, 0x01, 0x28, 0xa6, 0x62, 0x1c, 0x40, 0x04, 0x06, 0x1f, 0x0d, 0xdf, 0x60, 0x1e, 0x44,
+    0x8c, 0x80, 0xc0, 0x03, 0x77, 0x42, 0x8a, 0x68, 0x0d, 0xdc, 0x21, 0x88, 0x40, 0x04, 0x48, 0xc0,
+    0xaf, 0xc0, 0x7f, 0xe2, 0x00, 0xe1, 0xbb, 0xa0, 0x03, 0xc8, 0x91, 0x80, 0x00, 0xf1, 0x08, 0x80,
+    0x3c, 0x88, 0x62, 0x00, 0x8a, 0xba, 0xed, 0x46, 0x00, 0x3c, 0x51, 0x02, 0x25, 0x00, 0x38, 0x52,
+    0xdd, 0xc0, 0xa8, 0x82, 0x0b, 0x2b, 0x15, 0x0e, 0x30, 0x50, 0xf3, 0x35, 0x7d, 0x78, 0x18, 0x00,
+    0xf0, 0x02, 0xf0, 0x34, 0xcb, 0x40, 0x08, 0xc1, 0xf1, 0x48, 0x8f, 0xd2, 0x84, 0x45, 0x42, 0x58,
+    0x1c, 0x0e, 0x12, 0xb7, 0xa0, 0x55, 0x01, 0xb2, 0x80, 0x0a, 0x68, 0x02, 0x2a, 0x6f, 0xd6, 0x00,
+    0xd0, 0x10, 0x01, 0xc0, 0x00, 0x1d, 0xf7, 0xda, 0x00, 0x49, 0x88, 0x20, 0x96, 0xa0, 0x0a, 0x05,
+    0xee, 0x40, 0x50, 0xa0, 0x95, 0x08, 0x9e, 0x1c, 0xcc, 0x08, 0x10, 0xe7, 0xf8, 0x5e, 0x02, 0x0f,
+    0x38, 0xe2, 0x1e, 0x02, 0x00, 0x17, 0xc5, 0x03, 0x04, 0x00, 0x0c, 0x4d, 0x12, 0x09, 0x48, 0x1c,
+    0x2a, 0x10, 0x50, 0x30, 0x13, 0x85, 0x80, 0x13, 0x10, 0x41, 0x2d, 0x40, 0x00, 0x6f, 0xff, 0x90,
+    0x03, 0xf9, 0xc0, 0x35, 0xff, 0xe3, 0x00, 0xff, 0xe6, 0x5f, 0xfd, 0xc0, 0x1c, 0x23, 0x88, 0x03,
+    0xab, 0xba, 0xc0, 0x07, 0x90, 0x5b, 0x80, 0x76, 0x80, 0x25, 0xc0, 0x38, 0x88, 0x04, 0x01, 0xc0,
+    0x00, 0x26, 0x7f, 0x40, 0x04, 0x76, 0x62, 0x27, 0x80, 0x05, 0x03, 0x76, 0x83, 0x80, 0x08, 0x30,
+    0x0a, 0xa4, 0x25, 0x02, 0xbe, 0xd5, 0x82, 0x14, 0x1f, 0x24, 0x02, 0x85, 0x07, 0xc9, 0x00, 0xa1,
+    0x81, 0xf2, 0x40, 0x21, 0x00, 0x59, 0x94, 0x58, 0xc3, 0x07, 0x6e, 0x9d, 0x04, 0x40, 0x02, 0x28,
+    0x64, 0x00, 0x00, 0xf1, 0x38, 0x06, 0x16, 0x40, 0x53, 0x8a, 0x44, 0x00, 0x16, 0x63, 0x6b, 0x14,
+    0xae, 0xd8, 0x01, 0x1a, 0x28, 0x01, 0x20, 0x0d, 0x00, 0x07, 0x34, 0x00, 0xa7, 0x50, 0x20, 0x03,
+    0x81, 0x00, 0x63, 0x01, 0x00, 0xd4, 0x01, 0xff, 0x30, 0x07, 0xf9, 0x04, 0x03, 0xfd, 0xc4, 0x20,
+    0x1e, 0x4f, 0xa5, 0xae, 0xf1, 0x09, 0xf7, 0x00, 0x1f, 0xf3, 0x00, 0x53, 0xf0, 0x01, 0xa0, 0x40,
+    0x3f, 0x86, 0x00, 0x3f, 0x85, 0x88, 0x03, 0xb0, 0x00, 0x21, 0xbe, 0xc0, 0xe7, 0xe0, 0x0d, 0x20,
+    0x96, 0x06, 0x38, 0x00, 0x40, 0x02, 0x10, 0x10, 0xb0, 0x01, 0x96, 0x62, 0x40, 0xc6, 0xe0, 0x06,
+    0x67, 0x00, 0x46, 0x20, 0x1c, 0x4e, 0x01, 0xfe, 0x81, 0x00, 0x80, 0x3f, 0xfd, 0xd4, 0x20, 0x1f,
+    0x84, 0x65, 0xc0, 0xae, 0x40, 0x08, 0xbb, 0x9a, 0x24, 0xa2, 0x30, 0x07, 0x89, 0xc2, 0x90, 0x2b,
+    0x00, 0x38, 0x9c, 0x00, 0x20, 0x68, 0x00, 0x2e, 0xe6, 0x89, 0x7a, 0x84, 0xc0, 0x04, 0x23, 0x2e,
+    0x00, 0x7c, 0x5f, 0xee, 0xa1, 0x00, 0xff, 0xe7, 0x90, 0x5c, 0x00, 0x7f, 0x59, 0x8a, 0x00, 0x3f,
+    0xfd, 0xd4, 0x40, 0x1f, 0xf0, 0x8c, 0xb8, 0x20, 0x1f, 0xc5, 0xdd, 0x10, 0xb8, 0x07, 0xff, 0x00,
+    0x54, 0x38, 0x27, 0xbe, 0xcc, 0x03, 0xe4, 0x0e, 0x96, 0x26, 0x4d, 0x10, 0x01, 0x6e, 0xbc, 0xc5,
+    0xd0, 0x22, 0x64, 0x86, 0x01, 0x11, 0x00, 0x70, 0x50, 0x2f, 0x3a, 0x08, 0x00, 0x5f, 0xc0, 0x20,
+    0x09, 0x83, 0x33, 0xe9, 0x80, 0x61, 0x60, 0x80, 0x7f, 0xce, 0x40, 0x40, 0x0e, 0xb0, 0x51, 0xc7,
+    0xa6, 0x60, 0x20, 0x07, 0x12, 0x04, 0x53, 0x24, 0x05, 0x18, 0x8f, 0x60, 0x0b, 0xfc, 0x40, 0x02,
+    0xfb, 0xc0, 0xc0, 0x01, 0x80, 0x10, 0x00, 0x81, 0x88, 0x08, 0x00, 0x40, 0x06, 0x80, 0x30, 0x12,
+    0x40, 0x7f, 0xd0, 0x00, 0x4f, 0xf2, 0x87, 0xda, 0x83, 0x50, 0x12, 0x04, 0x40, 0x0f, 0xed, 0x41,
+    0xa8, 0x09, 0x02, 0x20, 0x07, 0xf1, 0x80, 0x2a, 0x13, 0x80, 0x66, 0x0a, 0xe1, 0x33, 0x0b, 0x83,
+    0x19, 0x19, 0x02, 0x90, 0x01, 0x00, 0x8c, 0x00, 0x80, 0x28, 0x01, 0xb0, 0x00, 0x80, 0x0c, 0x00,
+    0x60, 0x06, 0x50, 0x06, 0x00, 0x10, 0x00, 0x60, 0x00, 0x2f, 0xfe, 0xea, 0x05, 0xfa, 0x00, 0x91,
+    0x20, 0x57, 0x00, 0xe2, 0xbf, 0x8b, 0x0d, 0x00, 0xf1, 0xdf, 0x88, 0x08, 0x07, 0xff, 0x25, 0x6a,
+    0x00, 0x3f, 0x1e, 0xcf, 0xd8, 0x60, 0x07, 0x8c, 0xe0, 0x66, 0x00, 0x00, 0xc2, 0xff, 0x60, 0x1a,
+    0x7a, 0x01, 0x28, 0x02, 0xbb, 0x28, 0x0c, 0x01, 0x66, 0xc6, 0x82, 0x10, 0x61, 0x89, 0x40, 0x04,
+    0xc2, 0x7d, 0xc4, 0x00, 0xbc, 0x2c, 0x01, 0xc0, 0x1f, 0xfc, 0x0f, 0x0b, 0x00, 0x70, 0x04, 0xe2,
+    0x7d, 0xc4, 0x00, 0x87, 0x4c, 0x4a, 0x00, 0x31, 0xe7, 0xe3, 0xfd, 0x00, 0xdd, 0xf9, 0x40, 0xd1,
+    0x3c, 0x40, 0x00, 0x00, 0x8e, 0xff, 0xd4, 0x20, 0x02, 0xc4, 0x00, 0x2b, 0x80, 0x38, 0x17, 0xb8,
+    0xec, 0x04, 0x63, 0x42, 0x28, 0x08, 0xd0, 0x1f, 0xf8, 0x82, 0x98, 0x17, 0x76, 0x20, 0xa6, 0x05,
+    0xdd, 0x08, 0x02, 0xa8, 0x03, 0x9a, 0x60, 0x02, 0x52, 0x1a, 0x21, 0x70, 0x0b, 0x81, 0xbf, 0xa1,
+    0x80, 0x07, 0x88, 0x22, 0x57, 0x00, 0x04, 0xfc, 0x00, 0x97, 0xfc, 0xa0, 0x1e, 0x3a, 0x08, 0x50,
+    0x0e, 0x2d, 0x06, 0x70, 0x0e, 0x1f, 0x14, 0x90, 0x05, 0x50, 0x0f, 0xc8, 0x17, 0x74, 0x02, 0x20,
+    0x00, 0x80, 0x04, 0x88, 0x17, 0x60, 0x08, 0x42, 0x7f, 0xc0, 0x1d, 0x56, 0x12, 0x40, 0x1c, 0x6a,
+    0xb0, 0x70, 0x07, 0xea, 0x13, 0x80, 0x0f, 0xda, 0x0e, 0x60, 0xbf, 0xff, 0xa4, 0x40, 0x3f, 0x57,
+    0xf9, 0x81, 0xff, 0xd2, 0x01, 0xc5, 0x00, 0x1c, 0x60, 0x80, 0x1d, 0x8a, 0x0d, 0x80, 0x1b, 0xd8,
+    0x1f, 0xc0, 0x35, 0x30, 0x3d, 0x80, 0x6e, 0x50, 0x0f, 0x9c, 0xc0, 0x3f, 0xf8, 0x40, 0x00, 0x92,
+    0x10, 0x03, 0xff, 0x8b, 0x8f, 0x80, 0x1f, 0xfc, 0x32, 0x75, 0x07, 0xfd, 0x70, 0x0f, 0xfe, 0x02,
+    0xc1, 0x01, 0x19, 0x46, 0x88, 0x07, 0xf9, 0xb1, 0xc1, 0x73, 0xd4, 0xa8, 0x03, 0xfc, 0x26, 0x01,
+    0xd4, 0x08, 0x40, 0x99, 0xfd, 0x00, 0x1f, 0xf2, 0x02, 0x1d, 0x99, 0x0b, 0xc8, 0x07, 0xf8, 0x40,
+    0x64, 0x23, 0x74, 0x0c, 0x20, 0x4e, 0x60, 0x1c, 0x20, 0x2e, 0x0e, 0x04, 0x60, 0xa7, 0xb0, 0x80,
+    0x1c, 0xa0, 0xa6, 0x01, 0xf5, 0x06, 0x30, 0x20, 0x01, 0x84, 0x46, 0x20, 0xc0, 0x46, 0x0b, 0xc1,
+    0x2e, 0x07, 0xdb, 0x21, 0x40, 0x14, 0xe6, 0x82, 0x8b, 0xaa, 0x82, 0xa4, 0x08, 0xed, 0x00, 0x2a,
+    0x20, 0x5a, 0x00, 0x57, 0xf2, 0xb7, 0x7e, 0x20, 0x06, 0x4e, 0xfa, 0x00, 0xff, 0xef, 0x00, 0x0b,
+    0xff, 0xba, 0x44, 0x03, 0x84, 0x85, 0xa8, 0x03, 0xa3, 0x74, 0x08, 0x41, 0x28, 0x13, 0xfa, 0x00,
+    0xd5, 0x84, 0x08, 0xdd, 0x28, 0x3a, 0xc2, 0x04, 0x6e, 0x94, 0x1d, 0x61, 0x02, 0x36, 0x80, 0x16,
+    0xa2, 0x00, 0x8d, 0xa0, 0x54, 0x00, 0xc4, 0x6b, 0x34, 0x01, 0xd7, 0x94, 0xc0, 0x1f, 0xfc, 0x10,
+    0x00, 0xff, 0xe1, 0x2f, 0x80, 0x7c, 0x9e, 0x0e, 0x20, 0x1a, 0xad, 0x42, 0x39, 0x00, 0x12, 0xa0,
+    0x40, 0x41, 0x62, 0x26, 0x0a, 0x80, 0xd3, 0x09, 0x70, 0x25, 0x00, 0xbe, 0x33, 0x81, 0x00, 0x31,
+    0xba, 0x00, 0x7b, 0xfe, 0xce, 0x02, 0x00, 0x90, 0xc0, 0x08, 0x08, 0x20, 0x0b, 0xb0, 0x31, 0x20,
+    0x66, 0x01, 0xa0, 0x38, 0x28, 0x88, 0xc1, 0x20, 0xe8, 0x03, 0xb2, 0x60, 0xd9, 0x00, 0x19, 0xa4,
+    0x24, 0xc0, 0x00, 0x00, 0xa3, 0xfd, 0x00, 0x1e, 0x50, 0x02, 0x80, 0x71, 0x10, 0x44, 0x44, 0x00,
+    0xca, 0x0e, 0x80, 0xa0, 0x1a, 0xc3, 0x3c, 0x2c, 0x01, 0x7e, 0x61, 0x54, 0x03, 0xfb, 0xa6, 0x04,
+    0xdd, 0x18, 0x35, 0x51, 0x81, 0x37, 0x46, 0x0d, 0x5e, 0x00, 0xdd, 0xb0, 0x01, 0xe6, 0x06, 0x45,
+    0x19, 0x01, 0xd8, 0x58, 0x06, 0x50, 0xb0, 0x02, 0xbe, 0xfc, 0x50, 0x07, 0xa0, 0x11, 0xd1, 0x10,
+    0xcd, 0xda, 0x40, 0x0d, 0x13, 0xff, 0x10, 0x6c, 0x3b, 0xfa, 0x16, 0xab, 0xcb, 0xbb, 0xfa, 0x40,
+    0x6a, 0xb8, 0xc0, 0x95, 0x5f, 0x44, 0xe0, 0x7d, 0xc5, 0x04, 0x2b, 0x31, 0x11, 0xd1, 0x80, 0x00,
+    0xc2, 0x80, 0x1f, 0x9e, 0x80, 0x3e, 0x7b, 0x1a, 0x30, 0x08, 0x76, 0x08, 0x17, 0x1c, 0x01, 0x44,
+    0x45, 0x17, 0x08, 0x32, 0x40, 0xfc, 0x08, 0x50, 0xa4, 0x04, 0x20, 0x0a, 0xf2, 0xf8, 0x08, 0x03,
+    0x09, 0x90, 0x07, 0xfb, 0x81, 0x40, 0x31, 0xc2, 0xb8, 0x1a, 0x00, 0x5e, 0xfa, 0x2e, 0x17, 0x61,
+    0xc3, 0x19, 0x08, 0x60, 0x20, 0x31, 0xa1, 0x00, 0x4e, 0xa8, 0x4f, 0x20, 0x06, 0x2c, 0x16, 0x00,
+    0x80, 0xaf, 0xff, 0xa8, 0x8b, 0xfa, 0x37, 0x7e, 0x8a, 0xff, 0xfa, 0x88, 0xa1, 0x01, 0x22, 0xa3,
+    0x74, 0xc0, 0xdb, 0xa8, 0x00, 0xff, 0xf0, 0x80, 0x03, 0x3f, 0x03, 0x66, 0x78, 0x88, 0xee, 0x10,
+    0x4d, 0x20, 0x22, 0x81, 0x20, 0x88, 0x22, 0x00, 0xc4, 0x9f, 0xc0, 0x06, 0xa0, 0x5b, 0xa3, 0x59,
+    0x00, 0x30, 0x84, 0x50, 0x04, 0x3a, 0x10, 0x60, 0x18, 0xe8, 0x34, 0x40, 0x32, 0xc0, 0xe8, 0x00,
+    0x04, 0xfc, 0x00, 0xfc, 0x5a, 0xc0, 0x11, 0xc8, 0x0b, 0x28, 0x04, 0xa0, 0x03, 0xd0, 0x0c, 0xea,
+    0x07, 0x2c, 0x01, 0x3b, 0x80, 0xb5, 0x48, 0x80, 0x92, 0x02, 0x41, 0xba, 0x02, 0x20, 0x04, 0x60,
+    0x20, 0x1e, 0x80, 0x60, 0x0c, 0x7e, 0x85, 0x00, 0x1c, 0x2d, 0x80, 0x00, 0x00, 0xc6, 0x80, 0x1f,
+    0xba, 0xc8, 0x03, 0xc4, 0x60, 0xe0, 0x1d, 0x1a, 0x21, 0x58, 0x20, 0x06, 0x71, 0x10, 0x11, 0xd0,
+    0x02, 0x03, 0x4c, 0x38, 0x90, 0xc8, 0x48, 0xc0, 0x02, 0xa0, 0x82, 0x0c, 0x01, 0xb8, 0x39, 0xc0,
+    0x3f, 0x80, 0x01, 0xff, 0xdd, 0x44, 0x01, 0xc4, 0x40, 0x5c, 0x10, 0x0d, 0xba, 0xe4, 0x16, 0x00,
+    0xfb, 0x43, 0x40, 0x3e, 0xd0, 0x26, 0xd0, 0x06, 0x63, 0x90, 0x2b, 0x8c, 0x00, 0x66, 0x14, 0xc2,
+    0x8e, 0x00, 0x7f, 0xd6, 0x61, 0x1c, 0x00, 0xff, 0x18, 0x05, 0x36, 0x00, 0xcc, 0x18, 0x04, 0x2a,
+    0x00, 0x33, 0x00, 0x60, 0x00, 0x9b, 0x1e, 0xc0, 0x38, 0xa8, 0xe1, 0x50, 0x02, 0x2c, 0x30, 0x21,
+    0xb5, 0x00, 0x48, 0x99, 0xa8, 0x82, 0x80, 0x08, 0x34, 0x00, 0x65, 0x05, 0x20, 0x23, 0x71, 0x16,
+    0x81, 0x80, 0x05, 0x6d, 0xa9, 0xfd, 0x88, 0x48, 0x40, 0x3e, 0x90, 0xb0, 0x0f, 0x0d, 0x82, 0xf6,
+    0x66, 0x53, 0x30, 0x00, 0x4c, 0xf1, 0x00, 0x00, 0x22, 0x9b, 0x00, 0x76, 0x72, 0x50, 0x04, 0x7e,
+    0xe9, 0x07, 0x64, 0x01, 0x8c, 0xc0, 0x98, 0x01, 0x16, 0x63, 0x80, 0x4c, 0x03, 0x84, 0x40, 0x40,
+    0x02, 0xbb, 0x70, 0x48, 0x80, 0x48, 0x81, 0x17, 0x80, 0x45, 0xfe, 0xd1, 0x65, 0x00, 0xe2, 0x60,
+    0xc0, 0x0f, 0x20, 0x08, 0x00, 0xb3, 0x1c, 0x61, 0x40, 0x11, 0x98, 0x53, 0x08, 0xfd, 0xd2, 0x0e,
+    0xcc, 0x02, 0xce, 0x4a, 0x00, 0x80, 0x03, 0xcf, 0xc3, 0x1c, 0x26, 0x17, 0x60, 0xc9, 0xd4, 0xe0,
+    0x20, 0x0b, 0x01, 0xc1, 0x01, 0x52, 0x3e, 0xdc, 0x2e, 0x9e, 0x9d, 0x67, 0x07, 0x27, 0x59, 0xb8,
+    0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17, .adv_w = 112, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 32, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 82, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 147, .adv_w = 208, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 213, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 265, .adv_w = 64, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 273, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 310, .adv_w = 80, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 338, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 363, .adv_w = 144, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 386, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 394, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 399, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 404, .adv_w = 80, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 441, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 491, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 506, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 551, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 600, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 639, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 681, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 731, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 768, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 817, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 868, .adv_w = 48, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 880, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 895, .adv_w = 144, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 925, .adv_w = 144, .box_w = 7, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 936, .adv_w = 144, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 971, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1012, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1106, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1157, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1203, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1255, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1300, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1329, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1353, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1409, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1428, .adv_w = 64, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1433, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1458, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1502, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1512, .adv_w = 208, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1565, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1604, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1663, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1698, .adv_w = 160, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1762, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1805, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1856, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1870, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1899, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1952, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2032, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2085, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2125, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2164, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2179, .adv_w = 80, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2215, .adv_w = 80, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2228, .adv_w = 96, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2246, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2251, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 2258, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2290, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2323, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2355, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2391, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2424, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2443, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2486, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2510, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2520, .adv_w = 48, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2537, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2569, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2574, .adv_w = 192, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2602, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2624, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2656, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2695, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2732, .adv_w = 80, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2748, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2777, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2797, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2817, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2850, .adv_w = 176, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2900, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2932, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2975, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3003, .adv_w = 96, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3042, .adv_w = 80, .box_w = 3, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3049, .adv_w = 96, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3086, .adv_w = 144, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3100, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3101, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3117, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3161, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3209, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3262, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3308, .adv_w = 64, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3323, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3380, .adv_w = 128, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 3390, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3461, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3480, .adv_w = 144, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3513, .adv_w = 144, .box_w = 7, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3524, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 3565, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 3572, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3594, .adv_w = 144, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3622, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3641, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3660, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 3667, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3694, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3722, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3727, .adv_w = 80, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3736, .adv_w = 64, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3745, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3767, .adv_w = 144, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3799, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3858, .adv_w = 176, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3924, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3993, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4032, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4096, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4160, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4227, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4293, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4361, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4427, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4486, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4549, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4591, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4634, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4678, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4725, .adv_w = 64, .box_w = 4, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4739, .adv_w = 64, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4755, .adv_w = 64, .box_w = 6, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4773, .adv_w = 64, .box_w = 6, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4791, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4841, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4896, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4968, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5041, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5115, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5187, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5264, .adv_w = 144, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5300, .adv_w = 160, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5370, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5412, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5454, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5499, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5545, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5598, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5635, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5680, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5721, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5763, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5806, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5850, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5894, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5940, .adv_w = 192, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5993, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6036, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6078, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6120, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6163, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6208, .adv_w = 48, .box_w = 4, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6220, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6233, .adv_w = 48, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6248, .adv_w = 48, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6263, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6311, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6345, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6386, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6427, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6470, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6514, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6558, .adv_w = 144, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6588, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6627, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6656, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6686, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6718, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6750, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6803, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6842, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6897, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6960, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7005, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7073, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7117, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7179, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7221, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7286, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7328, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7395, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7438, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7502, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7544, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7612, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7657, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7719, .adv_w = 160, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7766, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7816, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7861, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7904, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7949, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7995, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8039, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8081, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8123, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8162, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8205, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8250, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8294, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8366, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8421, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8494, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8549, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8618, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8670, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8740, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8797, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8833, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8873, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8906, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8941, .adv_w = 64, .box_w = 6, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8957, .adv_w = 48, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8972, .adv_w = 64, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8986, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8999, .adv_w = 64, .box_w = 6, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9017, .adv_w = 48, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9032, .adv_w = 64, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 9045, .adv_w = 48, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 9064, .adv_w = 64, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9076, .adv_w = 48, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9081, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9108, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9135, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9177, .adv_w = 48, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 9200, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9260, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9306, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9335, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9357, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9373, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9395, .adv_w = 48, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9406, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9426, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9440, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9463, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9481, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9510, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9530, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9583, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9615, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9669, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9704, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9760, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9794, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9845, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9877, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9951, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9995, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10070, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10113, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10189, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10233, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10289, .adv_w = 208, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10341, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10397, .adv_w = 80, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10421, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10478, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10505, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10564, .adv_w = 80, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10589, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10652, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10690, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10755, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10795, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10858, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10897, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10962, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11002, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11025, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11053, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11082, .adv_w = 96, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11113, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11142, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11166, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11210, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11243, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11285, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11318, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11365, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11397, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11441, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11475, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11521, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11553, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11593, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11624, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11722, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11785, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11841, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11896, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11954, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12006, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12044, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12095, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12134, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12188, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12227, .adv_w = 64, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12240, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12306, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12351, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12410, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12453, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12512, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12558, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12615, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12659, .adv_w = 160, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12735, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12788, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12847, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12893, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12952, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13002, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13059, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13106, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13165, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13214, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13271, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13319, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13369, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13421, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13471, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13522, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13562, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13606, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13646, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13691, .adv_w = 144, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13750, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13805, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13842, .adv_w = 80, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13872, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13942, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13996, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14029, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14065, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14099, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14137, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14174, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14216, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14249, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14286, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14320, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14357, .adv_w = 64, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14371, .adv_w = 48, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14394, .adv_w = 64, .box_w = 6, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14418, .adv_w = 48, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14442, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14500, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14544, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14604, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14649, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14707, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14749, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14772, .adv_w = 48, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 14783, .adv_w = 128, .box_w = 9, .box_h = 19, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 14823, .adv_w = 48, .box_w = 5, .box_h = 19, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 14847, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14867, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14879, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14900, .adv_w = 48, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14914, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14982, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15022, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15089, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15129, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15199, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15245, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15297, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15328, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15382, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 15418, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15470, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15503, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15556, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15590, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15672, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15725, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15810, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15865, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15946, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15996, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16077, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16128, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16177, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16226, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16274, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16323, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16378, .adv_w = 80, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16402, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16459, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16486, .adv_w = 144, .box_w = 9, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16558, .adv_w = 80, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16593, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16648, .adv_w = 80, .box_w = 7, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 16675, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16738, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16776, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16841, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 16883, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16948, .adv_w = 112, .box_w = 7, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16994, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17066, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17114, .adv_w = 144, .box_w = 9, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17191, .adv_w = 112, .box_w = 7, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17242, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17268, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17299, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17325, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17356, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17380, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17407, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17430, .adv_w = 80, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17466, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17508, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17540, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17582, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17614, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17656, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17687, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17739, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17780, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17832, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17875, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17944, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17989, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18055, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18100, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18196, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18257, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18353, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18414, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18513, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18577, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18673, .adv_w = 176, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18734, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18831, .adv_w = 176, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 18897, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18964, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19006, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19077, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19122, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19176, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19229, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19283, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19322, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19374, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19414, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19465, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19503, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19539, .adv_w = 80, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 19575, .adv_w = 176, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19638, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19696, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19739, .adv_w = 64, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19762, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19782, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19830, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19879, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19946, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19991, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20052, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20094, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20167, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20219, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20292, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20343, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20417, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20466, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20542, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20593, .adv_w = 160, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20676, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20733, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20805, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20858, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20930, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20982, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21057, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21107, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21183, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21235, .adv_w = 160, .box_w = 10, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21318, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21375, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21417, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21463, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21504, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21546, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21591, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21636, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21688, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21740, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21792, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21843, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21894, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21945, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21998, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22050, .adv_w = 144, .box_w = 9, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22107, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22164, .adv_w = 64, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22175, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22185, .adv_w = 64, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22197, .adv_w = 48, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22213, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22287, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 22332, .adv_w = 160, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22402, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22444, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22526, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22578, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22660, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22711, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22792, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22844, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22927, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22977, .adv_w = 160, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23066, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23122, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23196, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23238, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23312, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23354, .adv_w = 160, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23426, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23469, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23543, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23586, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23665, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23714, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23757, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 23791, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23831, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23861, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23913, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23950, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24004, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24042, .adv_w = 160, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24093, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24131, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24185, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24225, .adv_w = 160, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24283, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24328, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24382, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24434, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24487, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24535, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24586, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24639, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24695, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24750, .adv_w = 192, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 24766, .adv_w = 160, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24788, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24832, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24878, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24933, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24986, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24987, .adv_w = 256, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24988, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24989, .adv_w = 224, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24990, .adv_w = 80, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24991, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24992, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24993, .adv_w = 144, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24994, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24995, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24996, .adv_w = 16, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24997, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24998, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 25003, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 25008, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 25014, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 25018, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 25025, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 25032, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 25044, .adv_w = 96, .box_w = 8, .box_h = 4, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 25055, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25063, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 25071, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25079, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25087, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25103, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 25119, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25135, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25151, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 25180, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25220, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 25236, .adv_w = 96, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 25250, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25255, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25266, .adv_w = 160, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25282, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 25287, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25288, .adv_w = 288, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25371, .adv_w = 368, .box_w = 23, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25473, .adv_w = 64, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25481, .adv_w = 112, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25499, .adv_w = 176, .box_w = 10, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25525, .adv_w = 64, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25533, .adv_w = 112, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25551, .adv_w = 176, .box_w = 10, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25577, .adv_w = 112, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 25591, .adv_w = 80, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 25613, .adv_w = 80, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 25634, .adv_w = 176, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 25677, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25709, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25749, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 25754, .adv_w = 192, .box_w = 12, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 25771, .adv_w = 192, .box_w = 12, .box_h = 4, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 25795, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 25822, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25868, .adv_w = 96, .box_w = 4, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 25873, .adv_w = 48, .box_w = 9, .box_h = 11, .ofs_x = -3, .ofs_y = 0},
+    {.bitmap_index = 25910, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25934, .adv_w = 80, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 25955, .adv_w = 256, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26035, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26093, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26151, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 26181, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26209, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 26232, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 26255, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26280, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26300, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 26347, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 26395, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26446, .adv_w = 160, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 26462, .adv_w = 192, .box_w = 12, .box_h = 4, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 26486, .adv_w = 160, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 26517, .adv_w = 224, .box_w = 14, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 26553, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26554, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26604, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26676, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26732, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 26768, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26818, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26872, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26923, .adv_w = 208, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26975, .adv_w = 256, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27050, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27129, .adv_w = 208, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27163, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 27219, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27270, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27322, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27358, .adv_w = 320, .box_w = 20, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 27471, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27520, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 27587, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27639, .adv_w = 160, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 27679, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 27745, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27768, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27808, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27852, .adv_w = 160, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27890, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27940, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 27991, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 28054, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_9[] = {
+    0x0, 0x8,
+};
+
+static const uint8_t glyph_id_ofs_list_11[] = {
+    0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 0, 8, 9, 10, 11, 12,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 160, .range_length = 13, .glyph_id_start = 96,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 174, .range_length = 155, .glyph_id_start = 109,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 330, .range_length = 54, .glyph_id_start = 264,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7680, .range_length = 156, .glyph_id_start = 318,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7837, .range_length = 99, .glyph_id_start = 474,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8192, .range_length = 12, .glyph_id_start = 573,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8208, .range_length = 24, .glyph_id_start = 585,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8239, .range_length = 39, .glyph_id_start = 609,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8279, .range_length = 9, .glyph_id_start = 648,
+     .unicode_list = unicode_list_9, .glyph_id_ofs_list = NULL, .list_length = 2,
+     .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},
+    {.range_start = 8352, .range_length = 16, .glyph_id_start = 650,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8369, .range_length = 16, .glyph_id_start = 666,
+     .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_11, .list_length = 16,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 12,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_bold_14_bold_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 22,
+    .base_line = 5,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
@@ -0,0 +1,472 @@
+/*
+ * interdisplay_bold_20_bold_4bpp - generated by script/binfont_to_c.py from interdisplay_bold_20_bold_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x1f, 0xf8, 0x04, 0x03, 0xe1, 0x00, 0xff, 0xe1, 0x18, 0x00, 0x40, 0x3f, 0x8c, 0x04, 0x03,
+    0xe4, 0x48, 0x01, 0x7b, 0x20, 0x0c, 0x9f, 0x02, 0x10, 0x11, 0x13, 0x03, 0x88, 0x9f, 0xf0, 0x47,
+    0xf8, 0x04, 0x02, 0xf0, 0x0b, 0xc0, 0x40, 0x21, 0x01, 0x03, 0x01, 0x00, 0xe1, 0x03, 0x03, 0x05,
+    0x44, 0x03, 0x22, 0x00, 0x00, 0xc9, 0xfc, 0x00, 0x2f, 0xf0, 0x07, 0x8c, 0x14, 0x00, 0xe0, 0x40,
+    0x1e, 0xe0, 0x20, 0x06, 0x83, 0x80, 0x63, 0x44, 0x00, 0x11, 0x06, 0x00, 0x42, 0x00, 0x6d, 0x90,
+    0x35, 0xd9, 0x01, 0x6d, 0x00, 0x44, 0x01, 0xfe, 0x50, 0x1f, 0xb0, 0x1f, 0xf6, 0x80, 0x3f, 0xc6,
+    0x01, 0x10, 0x10, 0x01, 0x80, 0x40, 0x3d, 0xe0, 0xa0, 0x03, 0x05, 0x00, 0xd7, 0xec, 0x0d, 0xfe,
+    0x80, 0x4f, 0x90, 0x02, 0x80, 0x7f, 0xbc, 0x01, 0x54, 0x00, 0x55, 0xd8, 0x01, 0x16, 0xe0, 0x04,
+    0x60, 0x02, 0xa2, 0x80, 0x19, 0x04, 0x02, 0x60, 0x20, 0x01, 0x00, 0x04, 0x03, 0xb4, 0x1c, 0x00,
+    0xa0, 0x60, 0x18, 0x00, 0xe3, 0xa5, 0x00, 0xff, 0x32, 0xe8, 0x07, 0xf2, 0xf0, 0x23, 0x00, 0x79,
+    0x7e, 0x90, 0x0e, 0x79, 0x00, 0x24, 0xa0, 0x0f, 0x0d, 0x98, 0x02, 0x00, 0x0b, 0x20, 0xca, 0x00,
+    0x90, 0x01, 0x80, 0x28, 0xc0, 0x68, 0x00, 0x80, 0x1c, 0x60, 0x1b, 0x2f, 0x40, 0x08, 0x00, 0xc9,
+    0x00, 0x8d, 0x0c, 0x01, 0x22, 0x00, 0x30, 0x7d, 0x81, 0x00, 0x8b, 0xd8, 0x03, 0x13, 0xf9, 0x80,
+    0x43, 0x3f, 0x00, 0x20, 0x01, 0xd0, 0x13, 0x31, 0x01, 0x03, 0x68, 0x80, 0xa2, 0xe6, 0x24, 0x03,
+    0x12, 0x00, 0x05, 0x40, 0x08, 0x80, 0x08, 0x90, 0x00, 0xc2, 0xa0, 0x0b, 0x80, 0x5d, 0x10, 0x33,
+    0x05, 0x98, 0x00, 0x80, 0x80, 0x03, 0xc0, 0x01, 0xc9, 0x30, 0x08, 0xe3, 0x88, 0x03, 0x36, 0x50,
+    0x3e, 0x38, 0x07, 0xff, 0x10, 0x04, 0xcf, 0xd7, 0x00, 0xe1, 0xef, 0x20, 0x01, 0xd9, 0x89, 0x43,
+    0x80, 0x6a, 0x19, 0x20, 0x04, 0x83, 0x75, 0x05, 0x00, 0x4a, 0x86, 0xc0, 0x10, 0x86, 0x02, 0x01,
+    0x00, 0x06, 0xc3, 0x80, 0x30, 0x86, 0x02, 0x01, 0x00, 0x28, 0x64, 0x80, 0x34, 0x83, 0x75, 0x05,
+    0x02, 0xa1, 0xb0, 0x07, 0x1d, 0x98, 0x8a, 0x1c, 0x6c, 0x38, 0x03, 0xe4, 0xcf, 0xe7, 0x0a, 0x19,
+    0x26, 0xcc, 0x40, 0x07, 0xe5, 0x43, 0x68, 0x93, 0x33, 0xe0, 0x07, 0x86, 0xc3, 0x81, 0xc2, 0xf4,
+    0x4d, 0x00, 0x3a, 0x86, 0x48, 0xc0, 0x90, 0x9c, 0x0c, 0x03, 0x2a, 0x1b, 0x00, 0x7f, 0xf0, 0x06,
+    0xc3, 0x80, 0x04, 0x04, 0x40, 0x40, 0x20, 0x0a, 0x86, 0x48, 0x00, 0x2c, 0x1b, 0xe4, 0x45, 0x00,
+    0x2a, 0x1b, 0x00, 0x69, 0x71, 0x04, 0xc0, 0x00, 0x00, 0x9b, 0x3f, 0xa8, 0x40, 0x3e, 0x79, 0x30,
+    0x15, 0xc0, 0x0f, 0xa0, 0x06, 0x14, 0x09, 0x40, 0x38, 0x80, 0x10, 0xf4, 0x20, 0x40, 0x1c, 0x40,
+    0x01, 0x02, 0x10, 0x40, 0x0f, 0x28, 0x4a, 0xe0, 0x29, 0x80, 0x7a, 0xc4, 0x54, 0x2f, 0x40, 0x1f,
+    0x48, 0x80, 0x06, 0x40, 0xa2, 0x02, 0x00, 0x97, 0x02, 0x01, 0xd0, 0x77, 0x8c, 0x09, 0x80, 0xf6,
+    0x00, 0xeb, 0xc0, 0x04, 0x08, 0x00, 0xa0, 0x75, 0x05, 0x50, 0x20, 0x00, 0xc0, 0x18, 0x00, 0xa3,
+    0x00, 0xbc, 0x00, 0x80, 0x05, 0xb7, 0x93, 0x00, 0x9c, 0x00, 0x32, 0x00, 0x48, 0x60, 0x0d, 0xc2,
+    0x00, 0x6c, 0x51, 0x01, 0x5d, 0xa0, 0x2a, 0x00, 0x9f, 0xf0, 0x08, 0x05, 0xe0, 0x20, 0x20, 0x60,
+    0x10, 0x82, 0xa2, 0x00, 0x00, 0x5f, 0xf0, 0x81, 0xa0, 0x28, 0x85, 0x00, 0x38, 0x00, 0xe0, 0x05,
+    0x01, 0x10, 0x18, 0x01, 0x00, 0x0a, 0x00, 0xd0, 0x06, 0x00, 0x08, 0x00, 0xc0, 0x06, 0x00, 0x08,
+    0x07, 0x18, 0x07, 0xe7, 0x00, 0x18, 0x00, 0x40, 0x0c, 0x00, 0xd0, 0x01, 0x80, 0x0c, 0x01, 0xa0,
+    0x04, 0x00, 0x28, 0x04, 0xa0, 0x04, 0x00, 0x70, 0x03, 0x80, 0x08, 0x60, 0xa2, 0x00, 0x6f, 0xf3,
+    0x00, 0x1c, 0x01, 0x60, 0x01, 0x40, 0x23, 0x00, 0x68, 0x02, 0xc0, 0x08, 0x00, 0x30, 0x01, 0x00,
+    0x10, 0x02, 0x40, 0x01, 0x00, 0x08, 0x00, 0xc0, 0x01, 0x00, 0x10, 0x03, 0xc0, 0x3f, 0xef, 0x00,
+    0x18, 0x00, 0x80, 0x02, 0x00, 0x70, 0x02, 0x80, 0x08, 0x04, 0x40, 0xa0, 0x07, 0x00, 0x78, 0x03,
+    0x40, 0x0a, 0x02, 0x80, 0xc0, 0x08, 0x00, 0x00, 0x00, 0xa3, 0xcc, 0x03, 0x38, 0x78, 0x00, 0x58,
+    0x1a, 0x37, 0x81, 0x3a, 0x45, 0xd8, 0x98, 0x20, 0x60, 0x45, 0x0a, 0x01, 0x43, 0x82, 0xf2, 0x88,
+    0x0c, 0xe9, 0x38, 0xcc, 0x83, 0x58, 0x08, 0x9c, 0xde, 0x00, 0x9d, 0x00, 0xd8, 0xe2, 0x01, 0x00,
+    0x00, 0xd5, 0xf8, 0x01, 0xff, 0xd9, 0x7f, 0xf9, 0x40, 0xff, 0xe8, 0x00, 0xff, 0x92, 0x22, 0x20,
+    0x18, 0x8a, 0xcd, 0xdf, 0x01, 0x3b, 0xc6, 0x01, 0xff, 0xce, 0xe9, 0x90, 0x06, 0x00, 0x08, 0xa8,
+    0x07, 0x52, 0x10, 0x06, 0x10, 0x01, 0x18, 0x08, 0xa0, 0x40, 0x00, 0x56, 0x6e, 0x48, 0x99, 0xe8,
+    0x00, 0xf8, 0x02, 0x61, 0x00, 0x64, 0xe0, 0x10, 0x81, 0x01, 0x30, 0x38, 0x00, 0x00, 0xcd, 0xfe,
+    0x10, 0x0d, 0x80, 0x42, 0x01, 0x90, 0x10, 0x03, 0x10, 0x86, 0x00, 0x65, 0x00, 0x20, 0x06, 0xc0,
+    0x31, 0x00, 0xc8, 0x08, 0x01, 0x8c, 0x01, 0x80, 0x19, 0x00, 0x08, 0x01, 0xb0, 0x0c, 0x03, 0x90,
+    0x2c, 0x03, 0x20, 0x01, 0x00, 0x36, 0x00, 0x0c, 0x03, 0x20, 0x20, 0x07, 0x18, 0x60, 0x06, 0x40,
+    0x02, 0x00, 0x6d, 0x01, 0x30, 0x0c, 0x80, 0x80, 0x1c, 0x00, 0x00, 0x8a, 0x77, 0xf6, 0x48, 0x03,
+    0x93, 0x58, 0x80, 0x9b, 0x50, 0x02, 0x2b, 0x00, 0x23, 0xa0, 0x02, 0xc4, 0x01, 0x00, 0x07, 0xb8,
+    0xb7, 0x00, 0x58, 0x01, 0x40, 0x10, 0x01, 0x40, 0x01, 0x40, 0xc0, 0x0a, 0x01, 0xca, 0x00, 0x37,
+    0x00, 0x10, 0x07, 0x10, 0x01, 0xc4, 0x01, 0xe0, 0x1d, 0xe0, 0x01, 0x10, 0x03, 0xc0, 0x3b, 0xc0,
+    0x02, 0xe0, 0x02, 0x00, 0xe2, 0x00, 0x39, 0x80, 0x14, 0x03, 0x94, 0x00, 0x60, 0xa0, 0x08, 0x00,
+    0xa0, 0x00, 0xa0, 0x08, 0x00, 0x3d, 0xc5, 0xb8, 0x02, 0x00, 0x05, 0x60, 0x04, 0x74, 0x00, 0x59,
+    0x00, 0x49, 0xaa, 0x40, 0x4b, 0xa8, 0x00, 0x00, 0x00, 0x0d, 0x7f, 0xac, 0x17, 0xd4, 0x02, 0x8a,
+    0x10, 0x0c, 0x40, 0x96, 0x01, 0x15, 0x5b, 0x80, 0x50, 0xa0, 0x1f, 0xff, 0x80, 0x00, 0x9b, 0x3f,
+    0xd8, 0xe0, 0x1d, 0x92, 0x60, 0x03, 0x8d, 0x10, 0x04, 0x98, 0x0b, 0x30, 0x40, 0xa0, 0x00, 0xc0,
+    0x0f, 0x99, 0x78, 0x01, 0x80, 0xc0, 0x0c, 0x20, 0x01, 0x40, 0x00, 0x95, 0x52, 0xc0, 0x33, 0x80,
+    0x04, 0x4a, 0xa2, 0x00, 0x90, 0xc1, 0x00, 0x3e, 0x4b, 0x00, 0x48, 0x07, 0x96, 0xc0, 0x16, 0x40,
+    0x1c, 0xf4, 0x00, 0xb4, 0x00, 0xea, 0x80, 0x1d, 0x40, 0x0c, 0x38, 0xa0, 0x5e, 0x40, 0x18, 0x70,
+    0xc0, 0x09, 0x31, 0x18, 0x48, 0x80, 0x13, 0x3b, 0xf1, 0x00, 0x7f, 0xf0, 0x00, 0x00, 0x9b, 0x3b,
+    0xf6, 0x48, 0x03, 0x5c, 0x98, 0x81, 0x36, 0xa0, 0x02, 0x10, 0x05, 0xe1, 0x00, 0x14, 0x00, 0x60,
+    0x06, 0x43, 0xda, 0x00, 0xa0, 0x4c, 0x49, 0x00, 0x46, 0x00, 0x70, 0x77, 0x30, 0x04, 0xae, 0x06,
+    0x60, 0x0c, 0xbf, 0xea, 0x06, 0xd0, 0x0f, 0xf1, 0x18, 0x07, 0x25, 0xd3, 0x02, 0x69, 0x01, 0x98,
+    0x44, 0x8b, 0x30, 0x00, 0xb3, 0xcc, 0x58, 0x06, 0x40, 0x01, 0x10, 0x00, 0xa4, 0x01, 0x50, 0x00,
+    0x44, 0xc0, 0x0c, 0x97, 0xb6, 0x00, 0x48, 0x49, 0x80, 0xb4, 0x20, 0x02, 0x4c, 0x01, 0x92, 0x62,
+    0x02, 0xd8, 0xc0, 0x00, 0x00, 0xf2, 0xff, 0xd4, 0x01, 0xf0, 0xd8, 0x07, 0xfd, 0x42, 0x01, 0xfe,
+    0x54, 0x05, 0x00, 0xfc, 0x36, 0x07, 0x20, 0x1f, 0xa8, 0x43, 0x84, 0x03, 0xe6, 0x40, 0x72, 0x00,
+    0xf8, 0x64, 0x0a, 0x00, 0x3f, 0x50, 0x03, 0x80, 0x3f, 0x2a, 0x01, 0xa3, 0xba, 0x80, 0x0c, 0xe6,
+    0x40, 0x03, 0x88, 0x9c, 0x00, 0x71, 0x40, 0x1f, 0xfc, 0x17, 0xff, 0xf6, 0x80, 0x17, 0xe4, 0x03,
+    0xff, 0x9c, 0x00, 0x0c, 0xff, 0xfd, 0x00, 0x01, 0x00, 0xff, 0x8c, 0x05, 0xdf, 0xd8, 0x00, 0x10,
+    0x28, 0x8f, 0x20, 0x06, 0x70, 0x35, 0x30, 0x0c, 0x20, 0x07, 0xcc, 0x56, 0x72, 0x00, 0x0c, 0x00,
+    0x66, 0x00, 0x86, 0xd0, 0x03, 0xa7, 0xb8, 0xe0, 0x09, 0x03, 0x66, 0x53, 0x08, 0xa0, 0xc0, 0x8c,
+    0x66, 0x4a, 0x01, 0x90, 0x00, 0xc9, 0xba, 0x60, 0x0c, 0x20, 0x01, 0x62, 0x25, 0x80, 0x42, 0xe0,
+    0x05, 0x24, 0x02, 0xd8, 0x87, 0x88, 0x28, 0x85, 0x10, 0x13, 0xb8, 0x40, 0xec, 0x00, 0x3b, 0x04,
+    0x00, 0x38, 0xc1, 0x00, 0x00, 0x8a, 0xb7, 0xfa, 0x8c, 0x03, 0x26, 0xa9, 0x00, 0xae, 0x30, 0x00,
+    0x6c, 0x00, 0xd0, 0xa0, 0x09, 0x20, 0x80, 0x06, 0x4b, 0xd4, 0x88, 0x90, 0x1c, 0x10, 0xc9, 0x51,
+    0xfb, 0x8c, 0x42, 0x07, 0x5b, 0x57, 0xd0, 0x00, 0x60, 0x03, 0x28, 0x06, 0x7a, 0x01, 0x00, 0x09,
+    0xe7, 0xd0, 0x01, 0x4c, 0x03, 0x69, 0x82, 0xc0, 0x02, 0x84, 0x00, 0x42, 0x01, 0x28, 0x00, 0x94,
+    0x00, 0x60, 0x18, 0x40, 0x02, 0x23, 0x01, 0x60, 0x0a, 0x00, 0x1a, 0x10, 0x00, 0x9a, 0x8c, 0x40,
+    0x16, 0x04, 0x70, 0x02, 0xb9, 0x80, 0x28, 0x40, 0x11, 0x68, 0x20, 0x4d, 0xa8, 0x00, 0x9f, 0xff,
+    0xe9, 0x00, 0xff, 0xb1, 0x9b, 0xc4, 0x00, 0x15, 0x99, 0xf0, 0x05, 0x20, 0x1e, 0x62, 0x06, 0x10,
+    0x0f, 0x58, 0x02, 0xc0, 0x3c, 0xa4, 0x0a, 0x40, 0x1e, 0x80, 0x04, 0x00, 0x79, 0x48, 0x14, 0x80,
+    0x3d, 0x00, 0x08, 0x00, 0xf2, 0x90, 0x29, 0x00, 0x7a, 0x00, 0x12, 0x01, 0xe5, 0x20, 0x43, 0x00,
+    0xf4, 0x00, 0x20, 0x03, 0xca, 0x40, 0x86, 0x01, 0xc0, 0x00, 0x9f, 0x3f, 0xdb, 0x24, 0x01, 0x0e,
+    0xc1, 0x80, 0x09, 0xb5, 0x00, 0x10, 0x40, 0x53, 0x24, 0x00, 0x50, 0x01, 0x00, 0x18, 0xcc, 0xb2,
+    0x01, 0x20, 0x60, 0x0f, 0xe2, 0x08, 0x00, 0x63, 0x32, 0xc8, 0x20, 0x00, 0x7a, 0xa5, 0x32, 0x43,
+    0xb7, 0x00, 0x0c, 0x28, 0x06, 0x39, 0x20, 0x05, 0x28, 0x37, 0x72, 0x40, 0xb0, 0x4d, 0x00, 0xa4,
+    0x44, 0xcc, 0x01, 0x66, 0x00, 0x1c, 0x03, 0x78, 0x03, 0x44, 0x00, 0x80, 0x1b, 0x00, 0x04, 0x82,
+    0x03, 0x8c, 0xb4, 0xa0, 0x0a, 0x0d, 0x10, 0x39, 0xa5, 0x00, 0x49, 0x01, 0xfb, 0x90, 0x00, 0x9b,
+    0x58, 0x00, 0x00, 0x9f, 0x7f, 0xd8, 0xe0, 0x18, 0xb6, 0x08, 0x00, 0x71, 0x80, 0x17, 0x10, 0x0b,
+    0xb8, 0x40, 0xe4, 0x0c, 0xc0, 0x5f, 0x10, 0xf2, 0x06, 0x16, 0x00, 0x28, 0x80, 0x06, 0x80, 0x0e,
+    0x20, 0x02, 0x00, 0xda, 0x00, 0xf5, 0x00, 0x2b, 0x88, 0x9d, 0x40, 0x04, 0x30, 0x00, 0x8e, 0xe4,
+    0x08, 0x06, 0x79, 0x10, 0x08, 0x6c, 0x00, 0x20, 0x06, 0xeb, 0xac, 0xe6, 0x00, 0x10, 0xc4, 0x15,
+    0x14, 0xc2, 0xc0, 0x18, 0x2e, 0xeb, 0x00, 0x85, 0x80, 0x50, 0x18, 0x07, 0x5e, 0x3c, 0x42, 0x00,
+    0x12, 0x60, 0x50, 0xe2, 0x0c, 0xc0, 0x0b, 0x20, 0x80, 0x4e, 0xa4, 0x00, 0x00, 0x09, 0xf8, 0x02,
+    0x60, 0x70, 0x21, 0x01, 0x00, 0x64, 0xf8, 0x00, 0x98, 0x40, 0x3f, 0xf8, 0x04, 0xc2, 0x00, 0xc9,
+    0xc0, 0x21, 0x02, 0x02, 0x60, 0x70, 0x00, 0x09, 0xf8, 0x01, 0x60, 0x71, 0x18, 0x04, 0x41, 0x93,
+    0x80, 0x02, 0x62, 0x00, 0xff, 0xe2, 0xf7, 0xe8, 0x00, 0x41, 0x40, 0x80, 0x18, 0x0c, 0x00, 0x40,
+    0x20, 0x30, 0x01, 0xac, 0x80, 0x00, 0x00, 0xfc, 0x30, 0x80, 0x1e, 0x29, 0xe7, 0x10, 0x0c, 0x75,
+    0xac, 0x01, 0xc9, 0x78, 0xa0, 0x03, 0xa5, 0x3c, 0xb4, 0x00, 0x2e, 0x61, 0x42, 0x8c, 0x06, 0x3a,
+    0x8c, 0x03, 0xc3, 0xc6, 0x01, 0xd6, 0xa0, 0x06, 0xdb, 0x40, 0x08, 0xab, 0x58, 0x00, 0x97, 0xae,
+    0x01, 0x14, 0xf3, 0x80, 0x0a, 0x14, 0x03, 0x0c, 0x7c, 0x08, 0x07, 0xf3, 0xf4, 0x88, 0x28, 0x8f,
+    0xe3, 0x77, 0xff, 0x28, 0x07, 0xfc, 0xbf, 0xff, 0xcc, 0x01, 0xff, 0x14, 0x47, 0xf1, 0xbb, 0xff,
+    0x94, 0x03, 0xfe, 0x00, 0x39, 0x10, 0x0f, 0xce, 0xdd, 0x44, 0x01, 0xe7, 0x00, 0x2e, 0xd9, 0x80,
+    0x63, 0xb4, 0x00, 0x26, 0x61, 0x00, 0x24, 0xbd, 0x60, 0x01, 0xde, 0xa0, 0x04, 0x53, 0xf0, 0x40,
+    0x5c, 0x01, 0xc5, 0xe6, 0x01, 0xe4, 0xbd, 0x71, 0x04, 0x90, 0x6d, 0xb4, 0x00, 0x2e, 0x59, 0xa4,
+    0x90, 0x01, 0xb6, 0x8c, 0x03, 0x0b, 0xf4, 0x90, 0x06, 0x68, 0xe8, 0x10, 0x0f, 0x00, 0x00, 0x0c,
+    0xef, 0xf5, 0xa0, 0x04, 0x5e, 0xc4, 0x02, 0x97, 0x00, 0x0f, 0x10, 0x38, 0x50, 0x03, 0x99, 0x88,
+    0x13, 0x1e, 0xa0, 0x00, 0x80, 0x66, 0xe0, 0x08, 0x80, 0x23, 0xcc, 0x28, 0x05, 0x20, 0x05, 0x00,
+    0xe3, 0xd3, 0x07, 0x20, 0x0c, 0x78, 0x41, 0x30, 0x01, 0xde, 0x00, 0xc6, 0x00, 0xf1, 0x02, 0x18,
+    0x07, 0xd1, 0x3e, 0x01, 0xf9, 0x01, 0x40, 0x3e, 0x1d, 0x9c, 0x00, 0xf8, 0x80, 0x04, 0x01, 0xf1,
+    0xa8, 0x40, 0x06, 0x00, 0x00, 0xf2, 0xd6, 0xff, 0xbb, 0x20, 0x80, 0x3f, 0x97, 0xa9, 0x48, 0x00,
+    0x26, 0xfb, 0x00, 0x1f, 0x45, 0x08, 0x0b, 0x44, 0xba, 0x00, 0x1f, 0x04, 0x03, 0x3b, 0x80, 0x6f,
+    0xa5, 0xda, 0x2f, 0x94, 0x0e, 0x80, 0x22, 0x80, 0x2f, 0x45, 0xcf, 0xe8, 0xae, 0xc6, 0x04, 0x60,
+    0x05, 0x80, 0x3c, 0x5e, 0x8c, 0x05, 0xd4, 0x01, 0x24, 0x16, 0x00, 0x70, 0x52, 0x24, 0x01, 0xd5,
+    0x08, 0x03, 0x58, 0x11, 0x0c, 0x43, 0xc2, 0x80, 0x71, 0x55, 0xc0, 0x19, 0xc0, 0x0e, 0xe0, 0x03,
+    0x01, 0x82, 0x00, 0x46, 0x20, 0x10, 0x80, 0x08, 0x40, 0x04, 0x0e, 0x06, 0x01, 0x88, 0x03, 0xe1,
+    0x00, 0x10, 0x30, 0x18, 0x06, 0x20, 0x0f, 0x0b, 0x80, 0x18, 0x34, 0x10, 0x02, 0x31, 0x00, 0x90,
+    0x00, 0x46, 0x00, 0xf0, 0x50, 0x1c, 0x45, 0xe0, 0x06, 0xa4, 0x80, 0xa0, 0x28, 0x29, 0x12, 0x00,
+    0xee, 0x88, 0xc1, 0x2c, 0x82, 0xc0, 0x10, 0x00, 0xf1, 0x7a, 0x30, 0x18, 0xc7, 0x10, 0x3b, 0x50,
+    0x01, 0x40, 0x17, 0xa2, 0xe7, 0xf3, 0x84, 0x77, 0xe2, 0x00, 0x67, 0x70, 0x0d, 0xec, 0xbb, 0x3c,
+    0xe4, 0x80, 0x7e, 0x8a, 0x10, 0x26, 0x89, 0x86, 0x36, 0x10, 0x0f, 0xcb, 0xd4, 0xa4, 0x00, 0x13,
+    0x6b, 0x10, 0x0c, 0x00, 0x00, 0xef, 0xfc, 0x60, 0x1f, 0xc8, 0x01, 0xa8, 0x03, 0xfb, 0x80, 0x33,
+    0x80, 0x7f, 0x28, 0x0a, 0x80, 0xa0, 0x07, 0xca, 0x00, 0x7f, 0x00, 0x68, 0x07, 0xde, 0x00, 0xd5,
+    0x00, 0x38, 0x07, 0xca, 0x00, 0x40, 0x40, 0x14, 0x00, 0xe5, 0x00, 0x28, 0x03, 0x40, 0x1a, 0x01,
+    0xdc, 0x00, 0xf0, 0x03, 0x80, 0x1c, 0x03, 0x90, 0x01, 0x5f, 0xee, 0x00, 0x0a, 0x00, 0x4c, 0x01,
+    0xfe, 0xe0, 0x0b, 0x40, 0x0a, 0xef, 0xc0, 0x05, 0x00, 0x0a, 0x00, 0x2e, 0x23, 0x84, 0x00, 0xa0,
+    0xe0, 0x03, 0x10, 0x0e, 0x70, 0x07, 0x86, 0x80, 0x2c, 0x03, 0xda, 0x00, 0x50, 0x00, 0xef, 0xff,
+    0x6c, 0x08, 0x07, 0xf1, 0x3f, 0x88, 0x06, 0x88, 0x98, 0x00, 0x30, 0x01, 0x9d, 0xe9, 0x90, 0x01,
+    0x40, 0x3f, 0x28, 0x01, 0xc0, 0x3e, 0x28, 0x00, 0x78, 0x06, 0xff, 0xb5, 0x0a, 0xd0, 0x03, 0xf8,
+    0xb4, 0x03, 0xa6, 0xa9, 0x04, 0x0d, 0x60, 0x19, 0x95, 0x4f, 0x82, 0x08, 0x40, 0x1f, 0x09, 0x00,
+    0x18, 0x03, 0xe1, 0x20, 0x0f, 0x3b, 0xd1, 0xe2, 0x02, 0x80, 0x14, 0x44, 0xe2, 0x00, 0xa0, 0x0f,
+    0xc2, 0xb8, 0x80, 0x00, 0x00, 0xc9, 0x7b, 0xfd, 0x6a, 0x01, 0xc3, 0x76, 0x42, 0x01, 0x4a, 0xb0,
+    0x0d, 0xa8, 0x00, 0x13, 0x10, 0x02, 0x58, 0x01, 0xcc, 0x01, 0x5d, 0x9d, 0x40, 0x04, 0x50, 0xa0,
+    0x04, 0xa8, 0x04, 0xb0, 0x00, 0xe2, 0x20, 0x0b, 0x00, 0x73, 0x4c, 0xb9, 0x80, 0x0a, 0x01, 0xe1,
+    0x66, 0x28, 0x80, 0x04, 0x03, 0xfc, 0x20, 0x01, 0x00, 0xff, 0x30, 0x01, 0x40, 0x3c, 0x2c, 0xc5,
+    0x22, 0x00, 0xb0, 0x07, 0x34, 0xcb, 0x82, 0x80, 0x12, 0xa0, 0x12, 0xc0, 0x03, 0x81, 0xcc, 0x01,
+    0x5d, 0x9d, 0x40, 0x04, 0x50, 0x06, 0xa0, 0x00, 0x4c, 0x40, 0x09, 0x60, 0x10, 0xdd, 0x20, 0x80,
+    0xa5, 0x58, 0x00, 0xef, 0xfe, 0xda, 0x40, 0x0f, 0xf1, 0x2d, 0xd8, 0x40, 0x39, 0x56, 0x20, 0x02,
+    0x68, 0x07, 0x5d, 0x53, 0x70, 0x40, 0xdc, 0x03, 0xf1, 0xd0, 0x02, 0x40, 0x3f, 0x90, 0x40, 0x48,
+    0x03, 0xf9, 0x40, 0x0c, 0x01, 0xfc, 0x20, 0x02, 0x00, 0xfe, 0x10, 0x01, 0x00, 0x7f, 0x28, 0x01,
+    0x80, 0x3f, 0x20, 0x80, 0x90, 0x07, 0xc7, 0x40, 0x09, 0x00, 0xd7, 0x54, 0xdc, 0x10, 0x37, 0x00,
+    0xca, 0xb1, 0x00, 0x13, 0x40, 0x3f, 0x12, 0xdd, 0x84, 0x00, 0x00, 0xef, 0xff, 0xe8, 0x00, 0xff,
+    0xe1, 0x22, 0x7d, 0xa0, 0x15, 0x5d, 0xf9, 0x40, 0x3f, 0xf9, 0xbd, 0xff, 0xe0, 0x0f, 0xfe, 0x1a,
+    0xb3, 0x78, 0x03, 0x5c, 0xcf, 0x80, 0x3f, 0xf9, 0xd5, 0x77, 0xe5, 0x00, 0x91, 0x3e, 0xd0, 0x0f,
+    0xf8, 0xef, 0xff, 0xe3, 0x00, 0xff, 0xe1, 0x22, 0x7c, 0x20, 0x15, 0x5d, 0xf8, 0x80, 0x3f, 0xf9,
+    0xb7, 0x33, 0xce, 0x01, 0x95, 0x9b, 0xb0, 0x03, 0xff, 0x87, 0xdf, 0xfd, 0x60, 0x1f, 0xfe, 0xc0,
+    0x00, 0xc9, 0x7d, 0xfd, 0x6a, 0x01, 0xc3, 0x76, 0x41, 0x01, 0x4a, 0xc1, 0x00, 0xb5, 0x00, 0x02,
+    0x62, 0x00, 0x3c, 0x00, 0x39, 0x80, 0x2b, 0xb3, 0xac, 0x40, 0x9c, 0x28, 0x01, 0x2a, 0x01, 0x25,
+    0x88, 0xb0, 0x88, 0x02, 0xc0, 0x1c, 0xbd, 0xcb, 0x60, 0x02, 0x80, 0x66, 0x6e, 0x51, 0x00, 0x08,
+    0x04, 0x53, 0x3d, 0x42, 0x00, 0x10, 0x0f, 0xf3, 0x00, 0x14, 0x02, 0x2f, 0xf8, 0x00, 0x24, 0x40,
+    0x16, 0x00, 0xe5, 0x00, 0x28, 0x50, 0x02, 0x58, 0x02, 0x4b, 0x00, 0x70, 0x39, 0x80, 0x27, 0xb3,
+    0xac, 0x41, 0x14, 0x01, 0x88, 0x00, 0x13, 0x10, 0x02, 0x50, 0x06, 0xbb, 0x20, 0x80, 0xa5, 0x58,
+    0x80, 0xef, 0xf0, 0x80, 0x75, 0xff, 0x90, 0x03, 0xff, 0xf1, 0xdf, 0xfc, 0x80, 0x1f, 0xfc, 0x74,
+    0x4f, 0x08, 0x07, 0xaa, 0xef, 0x94, 0x03, 0xff, 0xf0, 0x00, 0xef, 0xf0, 0x80, 0x7f, 0xfb, 0x00,
+    0x00, 0xfb, 0x7f, 0xc6, 0x01, 0xff, 0xff, 0x00, 0xff, 0xe0, 0xae, 0x61, 0x00, 0x3e, 0x33, 0xc0,
+    0x1e, 0x12, 0x00, 0x60, 0x00, 0x88, 0x00, 0x34, 0x00, 0x26, 0xd6, 0x80, 0x0c, 0x42, 0x40, 0x04,
+    0xa0, 0x17, 0x80, 0x1a, 0xd0, 0x40, 0x5b, 0x4c, 0x00, 0xef, 0xf0, 0x80, 0x69, 0xff, 0x70, 0x80,
+    0x7c, 0xcc, 0x00, 0x68, 0x80, 0x79, 0x24, 0x01, 0x46, 0x01, 0xe2, 0xa0, 0x03, 0xa8, 0x07, 0xde,
+    0x20, 0xb0, 0x01, 0xf5, 0x90, 0x1d, 0x00, 0x7d, 0x08, 0x00, 0xe0, 0x0f, 0xcc, 0x01, 0x40, 0x07,
+    0xf0, 0x88, 0x15, 0x40, 0x1f, 0xaa, 0x00, 0x16, 0x20, 0x1e, 0x94, 0x64, 0x01, 0xb0, 0x0f, 0x38,
+    0x02, 0x40, 0x0a, 0x80, 0x1f, 0x8a, 0x00, 0x14, 0x01, 0xfc, 0xe4, 0x03, 0x20, 0x1f, 0xdc, 0x00,
+    0x64, 0x00, 0xef, 0xf0, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfc, 0x15, 0x77, 0xce, 0x01, 0x22, 0x7b,
+    0x00, 0x3f, 0xc0, 0xef, 0xfa, 0x80, 0x3d, 0x9f, 0xf6, 0x00, 0x65, 0x00, 0xe1, 0x30, 0x0f, 0xe5,
+    0x00, 0xcc, 0x01, 0xfe, 0xf0, 0x0d, 0x60, 0x1f, 0x8c, 0x14, 0x02, 0x23, 0x04, 0x00, 0xf2, 0x00,
+    0x14, 0x00, 0xa0, 0x0c, 0x00, 0xf5, 0x80, 0x38, 0x01, 0x60, 0x04, 0x00, 0xf1, 0x88, 0x20, 0x11,
+    0x82, 0x08, 0x07, 0xcc, 0x00, 0x54, 0x00, 0x68, 0x07, 0xeb, 0x00, 0x66, 0x80, 0x1c, 0x03, 0xf1,
+    0x90, 0x3a, 0x02, 0x08, 0x07, 0xf2, 0x80, 0x80, 0x34, 0x03, 0xfd, 0x40, 0x19, 0x80, 0x3f, 0xc4,
+    0x60, 0x04, 0x00, 0xff, 0xe0, 0x58, 0x03, 0x80, 0x3c, 0x00, 0xef, 0xf4, 0x00, 0x74, 0xff, 0x98,
+    0x02, 0x72, 0x00, 0xff, 0xe0, 0x70, 0x07, 0xff, 0x00, 0xd8, 0x03, 0xff, 0x81, 0x02, 0x01, 0xfc,
+    0xe0, 0x30, 0x01, 0xfd, 0x22, 0x0c, 0x60, 0x1f, 0xd6, 0x00, 0xf0, 0x0f, 0xe5, 0x40, 0x36, 0x00,
+    0xfe, 0x90, 0x04, 0x00, 0x7f, 0x13, 0x80, 0xb0, 0x07, 0xf4, 0x10, 0x07, 0xff, 0x02, 0x40, 0x3f,
+    0xf8, 0x08, 0xa0, 0x1f, 0xfc, 0x0b, 0x00, 0xc0, 0x00, 0xc9, 0x7d, 0xfb, 0x48, 0x01, 0xe1, 0xbb,
+    0x20, 0x81, 0x2d, 0xd0, 0x07, 0x6a, 0x00, 0x04, 0xc4, 0x00, 0xb6, 0x01, 0x39, 0x80, 0x2b, 0xb3,
+    0xa4, 0x00, 0x8c, 0x00, 0xa0, 0x04, 0xa8, 0x04, 0xd0, 0x00, 0xa0, 0x22, 0x00, 0xb0, 0x07, 0x38,
+    0x00, 0xc5, 0x80, 0x0a, 0x01, 0xf1, 0x80, 0x08, 0x40, 0x02, 0x01, 0xf3, 0x80, 0x18, 0x40, 0x02,
+    0x01, 0xf3, 0x80, 0x19, 0x80, 0x05, 0x00, 0xf8, 0xc0, 0x04, 0x50, 0x0b, 0x00, 0x73, 0x00, 0x0c,
+    0x42, 0x80, 0x12, 0xa0, 0x13, 0x48, 0x02, 0x80, 0x0e, 0x60, 0x0a, 0xec, 0xe9, 0x00, 0x23, 0x00,
+    0x5a, 0x80, 0x01, 0x31, 0x00, 0x2d, 0x80, 0x61, 0xba, 0x41, 0x01, 0x4b, 0xa0, 0x08, 0xef, 0xfe,
+    0xec, 0x70, 0x0f, 0xe1, 0x38, 0xc0, 0x0e, 0x55, 0x8c, 0x00, 0x72, 0x01, 0xae, 0xa9, 0x96, 0x00,
+    0x60, 0x0f, 0xc8, 0x40, 0x01, 0x00, 0xfc, 0x60, 0x1f, 0xc5, 0x42, 0x04, 0x20, 0x17, 0x7f, 0xb5,
+    0x40, 0x10, 0x01, 0xfe, 0x95, 0x00, 0xca, 0xa6, 0x79, 0xe6, 0x00, 0xeb, 0xa9, 0x86, 0x10, 0x0f,
+    0xff, 0x38, 0x00, 0xc9, 0x7d, 0xfb, 0x48, 0x01, 0xe1, 0xbb, 0x20, 0x81, 0x2d, 0xd0, 0x07, 0x6a,
+    0x00, 0x04, 0xc4, 0x00, 0xb6, 0x01, 0x39, 0x80, 0x2b, 0xb3, 0xa4, 0x00, 0x8c, 0x00, 0xa0, 0x04,
+    0xa8, 0x04, 0xd0, 0x00, 0xa0, 0x22, 0x00, 0xb0, 0x07, 0x38, 0x00, 0xc5, 0x80, 0x0a, 0x01, 0xf1,
+    0x80, 0x08, 0x40, 0x02, 0x01, 0xf3, 0x80, 0x18, 0x40, 0x02, 0x01, 0xf3, 0x80, 0x19, 0x80, 0x05,
+    0x00, 0x12, 0x20, 0x00, 0x60, 0x02, 0x28, 0x05, 0x80, 0x15, 0x6e, 0xe0, 0x01, 0x88, 0x50, 0x02,
+    0x54, 0xa8, 0x22, 0x00, 0x09, 0x00, 0x39, 0x80, 0x2b, 0xa0, 0x03, 0x2a, 0x80, 0x2d, 0x40, 0x00,
+    0x98, 0x06, 0xb0, 0x0c, 0x37, 0x48, 0x20, 0x2a, 0x21, 0x40, 0x1e, 0x5b, 0xef, 0xea, 0xa0, 0x23,
+    0x80, 0xef, 0xff, 0x63, 0x80, 0x7f, 0x8e, 0x34, 0x40, 0x32, 0xb3, 0x10, 0x00, 0x56, 0x01, 0xae,
+    0x65, 0x78, 0x00, 0x51, 0x00, 0xf8, 0xcc, 0x00, 0x20, 0x0f, 0xc2, 0x00, 0x10, 0x0f, 0x0c, 0x90,
+    0x09, 0x00, 0x5d, 0xfe, 0xe6, 0x00, 0x58, 0x07, 0xf0, 0xd2, 0x80, 0x67, 0x73, 0x00, 0x4a, 0x01,
+    0xd3, 0x12, 0x60, 0x2c, 0x01, 0xfa, 0x00, 0x16, 0x01, 0xf9, 0x08, 0x09, 0x40, 0x3f, 0x40, 0x02,
+    0x00, 0x3f, 0x29, 0x01, 0x28, 0x00, 0x96, 0xfb, 0xfa, 0xd4, 0x03, 0xae, 0x90, 0x40, 0x52, 0xa8,
+    0x01, 0x42, 0x00, 0x11, 0x8c, 0x00, 0xac, 0x00, 0x60, 0x05, 0x5c, 0xe5, 0x00, 0x28, 0x00, 0x20,
+    0x05, 0x00, 0x95, 0x0d, 0xc0, 0x04, 0x00, 0xa2, 0x00, 0xaf, 0x2c, 0x01, 0x20, 0x05, 0xdd, 0x53,
+    0x08, 0x06, 0x4b, 0x20, 0x01, 0x2c, 0xf4, 0x80, 0x64, 0xdd, 0x4a, 0x88, 0x01, 0xac, 0x00, 0x22,
+    0x02, 0x6a, 0xea, 0x00, 0x21, 0xa7, 0x72, 0xc0, 0x32, 0xa8, 0x00, 0xca, 0x00, 0x44, 0x00, 0x42,
+    0x80, 0x06, 0x14, 0x00, 0x5d, 0xa6, 0xb8, 0x40, 0x8c, 0x28, 0x80, 0x08, 0xca, 0x00, 0x1e, 0x00,
+    0x0e, 0xc9, 0x88, 0x00, 0xdf, 0xcc, 0x00, 0x9f, 0xff, 0xf9, 0x00, 0x3f, 0xf8, 0x3e, 0x89, 0x80,
+    0x24, 0x4c, 0xcc, 0xbb, 0xa4, 0x00, 0x57, 0x78, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x80, 0xff,
+    0x80, 0x3d, 0xdf, 0xe0, 0x0f, 0xff, 0xf8, 0x07, 0xff, 0x48, 0x40, 0x3f, 0x08, 0x04, 0x60, 0x04,
+    0x00, 0xc4, 0x00, 0x10, 0x40, 0x04, 0x90, 0x00, 0x78, 0x00, 0x81, 0x60, 0x02, 0xdc, 0xc7, 0x18,
+    0x02, 0x40, 0xac, 0x02, 0x33, 0x00, 0x54, 0x60, 0x04, 0xe7, 0x20, 0x01, 0x36, 0xa8, 0x00, 0xbf,
+    0xf4, 0x00, 0x79, 0x7f, 0xda, 0x1a, 0x00, 0x50, 0x0f, 0x78, 0x01, 0x41, 0xc0, 0x04, 0x40, 0x0e,
+    0x50, 0x05, 0x80, 0xa0, 0x01, 0x40, 0x32, 0x00, 0x08, 0xc0, 0x1a, 0x00, 0xa0, 0x0d, 0xa0, 0x05,
+    0x00, 0x98, 0x00, 0x44, 0x00, 0x9c, 0x01, 0x60, 0x19, 0x00, 0x0a, 0x00, 0x31, 0x02, 0x30, 0x0d,
+    0xc0, 0x0b, 0x00, 0x58, 0x01, 0x40, 0x39, 0x40, 0x06, 0x20, 0xa0, 0x0b, 0x00, 0xf2, 0x80, 0x10,
+    0x88, 0x04, 0x60, 0x1e, 0xf0, 0x07, 0xa0, 0x01, 0x40, 0x3e, 0x50, 0x02, 0x60, 0x02, 0xc0, 0x3f,
+    0x28, 0x0a, 0x81, 0x18, 0x07, 0xee, 0x00, 0xca, 0x01, 0xfc, 0x80, 0x1a, 0xc0, 0x38, 0xcf, 0xf3,
+    0x00, 0x6b, 0xff, 0x48, 0x06, 0x7f, 0xf5, 0xa0, 0x03, 0x00, 0x32, 0x80, 0x10, 0x03, 0x60, 0x03,
+    0x30, 0x00, 0x70, 0x08, 0x84, 0x00, 0x42, 0x01, 0x20, 0x01, 0x10, 0x00, 0x21, 0x00, 0x20, 0x06,
+    0x40, 0x01, 0x00, 0x04, 0xc1, 0x00, 0x08, 0x00, 0xc0, 0x10, 0x06, 0x00, 0x10, 0x00, 0x80, 0x0c,
+    0x00, 0x68, 0x01, 0x01, 0x4c, 0x10, 0x01, 0x80, 0x0c, 0x00, 0x20, 0x01, 0x00, 0x84, 0x31, 0x00,
+    0x84, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x18, 0x20, 0x01, 0x34, 0x00, 0xa2, 0x40, 0x24, 0x01, 0x20,
+    0x00, 0xfc, 0x00, 0x68, 0x00, 0xc5, 0x00, 0x38, 0x06, 0xd0, 0x02, 0xa0, 0x20, 0x09, 0x82, 0x60,
+    0x03, 0x00, 0x32, 0x00, 0x30, 0x83, 0x00, 0x08, 0x06, 0x60, 0x02, 0x00, 0x62, 0x10, 0x50, 0x02,
+    0x00, 0x30, 0x00, 0x80, 0x42, 0x01, 0xc8, 0x01, 0x8c, 0x00, 0xa0, 0x19, 0x00, 0x3d, 0x80, 0x12,
+    0x00, 0x42, 0x60, 0x16, 0x80, 0x79, 0x00, 0x2c, 0x00, 0xc8, 0x01, 0x28, 0x04, 0x00, 0x2f, 0xf9,
+    0x00, 0x31, 0xff, 0xc4, 0x48, 0x00, 0x50, 0x06, 0xe0, 0x04, 0x90, 0x39, 0x80, 0xc0, 0x02, 0x08,
+    0x0d, 0x80, 0x2e, 0x00, 0x39, 0x11, 0xc0, 0x1c, 0x01, 0x8a, 0x00, 0x1d, 0xc0, 0x04, 0x10, 0x07,
+    0x39, 0x01, 0x98, 0x0d, 0xc0, 0x3e, 0xe0, 0x0d, 0xc0, 0x1f, 0x8c, 0x80, 0x04, 0x40, 0x0f, 0xce,
+    0x40, 0x02, 0x80, 0x0f, 0x8a, 0x00, 0x33, 0x98, 0x07, 0xb8, 0x01, 0x0e, 0x00, 0xe0, 0x0e, 0x73,
+    0x03, 0x78, 0x20, 0x28, 0x00, 0x8e, 0x00, 0x1c, 0x00, 0x90, 0x03, 0x98, 0x03, 0x80, 0x10, 0x40,
+    0x04, 0x60, 0x07, 0x04, 0x10, 0x13, 0x80, 0x68, 0x10, 0x27, 0x00, 0x9f, 0xf6, 0x00, 0x7b, 0xbf,
+    0xcd, 0x00, 0x03, 0x50, 0x0d, 0x02, 0x04, 0xc3, 0x00, 0x08, 0x00, 0x85, 0xc0, 0x12, 0x00, 0x72,
+    0x02, 0x70, 0x04, 0x00, 0x11, 0x00, 0x14, 0x00, 0x24, 0x49, 0x80, 0x12, 0x01, 0x94, 0xc0, 0x66,
+    0x00, 0x0c, 0x40, 0x1d, 0xe0, 0x07, 0x50, 0x04, 0x00, 0x78, 0xd8, 0x03, 0x40, 0x80, 0x7d, 0x00,
+    0x10, 0xb8, 0x07, 0xe1, 0x70, 0x04, 0x80, 0x7f, 0xf0, 0x44, 0x03, 0xff, 0xe2, 0x00, 0x4f, 0xff,
+    0xf8, 0x40, 0x3f, 0xf8, 0x2c, 0x89, 0xf0, 0x80, 0x04, 0x45, 0x77, 0xef, 0x10, 0x05, 0x00, 0x7c,
+    0x54, 0x00, 0x84, 0x00, 0xfb, 0x84, 0x15, 0xc0, 0x3e, 0xa3, 0x02, 0xa0, 0x0f, 0x9d, 0x40, 0x1e,
+    0x01, 0xf1, 0xc0, 0x02, 0xc8, 0x03, 0xc3, 0xa0, 0x07, 0x40, 0x0f, 0xb4, 0x41, 0x20, 0x03, 0xe9,
+    0x30, 0x2a, 0x00, 0xf9, 0x58, 0x00, 0x35, 0x77, 0xe1, 0x20, 0x08, 0xd1, 0x3e, 0x30, 0x0f, 0xfe,
+    0x08, 0xbf, 0xfc, 0x01, 0xfa, 0x28, 0x02, 0x55, 0x00, 0x7f, 0xfc, 0xd5, 0x40, 0x14, 0x50, 0x07,
+    0x00, 0xdf, 0xa0, 0x0e, 0x40, 0x40, 0x0e, 0xd0, 0x13, 0x00, 0xc8, 0x00, 0x40, 0x0e, 0x30, 0xc0,
+    0x0e, 0x40, 0x40, 0x0e, 0xc0, 0x01, 0x80, 0x64, 0x00, 0x20, 0x07, 0x20, 0x58, 0x07, 0x60, 0x18,
+    0x07, 0x20, 0x01, 0x00, 0x31, 0x80, 0x30, 0x03, 0x90, 0x10, 0x03, 0xb0, 0x0c, 0x40, 0x32, 0x80,
+    0x10, 0x03, 0x10, 0x86, 0x00, 0x72, 0x02, 0x00, 0x76, 0x01, 0x08, 0x5f, 0xfc, 0xa0, 0x1e, 0x4a,
+    0x40, 0x08, 0x54, 0xc0, 0x3f, 0xff, 0xe2, 0xa6, 0x01, 0x25, 0x20, 0x07, 0xf0, 0x00, 0x96, 0x1c,
+    0x03, 0x86, 0x9e, 0x10, 0x03, 0x30, 0x10, 0x78, 0x06, 0x90, 0xe1, 0x43, 0x00, 0x30, 0x99, 0xa4,
+    0x24, 0x01, 0x61, 0x20, 0xc0, 0xa4, 0xa4, 0x2a, 0x02, 0xa1, 0x60, 0x55, 0xfe, 0x2a, 0xaf, 0xf0,
+    0x07, 0xf8, 0x03, 0x30, 0x80, 0x5f, 0x98, 0x00, 0xb4, 0x49, 0x40, 0x03, 0x41, 0x00, 0x00, 0x00,
+    0x15, 0x6f, 0xf5, 0x98, 0x04, 0x7a, 0xa4, 0x02, 0x98, 0xa0, 0x0f, 0x00, 0x45, 0xb8, 0x02, 0x00,
+    0x0a, 0xd0, 0xe9, 0x04, 0x04, 0x00, 0x99, 0x2b, 0x45, 0x90, 0x06, 0x5e, 0xd9, 0x74, 0x00, 0xc3,
+    0x42, 0x0d, 0x7c, 0x60, 0x12, 0x00, 0x22, 0x50, 0x48, 0x02, 0x10, 0x06, 0x11, 0x28, 0x40, 0x24,
+    0x20, 0x4d, 0xd2, 0x10, 0x06, 0xf5, 0x10, 0x3d, 0x10, 0x08, 0xff, 0x70, 0x07, 0xff, 0x80, 0xaf,
+    0xfa, 0x88, 0x03, 0xbd, 0x00, 0x57, 0x08, 0x02, 0x12, 0x68, 0x20, 0x19, 0x00, 0xd5, 0x2f, 0x80,
+    0x04, 0x10, 0x00, 0xa8, 0x00, 0x54, 0x00, 0xa0, 0x02, 0x00, 0xc4, 0x00, 0x10, 0x01, 0x00, 0x62,
+    0x00, 0x08, 0x00, 0x54, 0x00, 0x2a, 0x00, 0x50, 0x0a, 0xa6, 0x30, 0x00, 0x82, 0x00, 0x12, 0x67,
+    0x20, 0x19, 0x00, 0x8f, 0x10, 0x05, 0x70, 0x80, 0x00, 0x9f, 0x7f, 0xac, 0xc0, 0x21, 0xd8, 0x20,
+    0x14, 0xc6, 0x00, 0x59, 0x01, 0x43, 0x00, 0x24, 0x44, 0xa0, 0x38, 0xf3, 0x00, 0x06, 0x40, 0x03,
+    0x88, 0x01, 0xf3, 0x0c, 0x60, 0x0e, 0x00, 0xc6, 0x61, 0x30, 0x07, 0x00, 0x63, 0x31, 0x20, 0x01,
+    0xc4, 0x00, 0xf9, 0x85, 0x15, 0x01, 0xc7, 0x98, 0x00, 0x28, 0x59, 0x01, 0x43, 0x00, 0x24, 0x80,
+    0x75, 0xc8, 0x05, 0x31, 0x80, 0x00, 0xfd, 0xfe, 0xe0, 0x0f, 0xfe, 0xb9, 0x57, 0x7d, 0x08, 0x06,
+    0x2c, 0x51, 0x05, 0xc0, 0x0d, 0xc2, 0x05, 0x0c, 0x40, 0x11, 0x18, 0x0e, 0x3c, 0xc8, 0x02, 0x70,
+    0x03, 0x88, 0x01, 0x80, 0x23, 0x00, 0x70, 0x06, 0x20, 0x01, 0x80, 0x38, 0x03, 0x10, 0x01, 0xc0,
+    0x0e, 0x20, 0x06, 0x00, 0x88, 0xc0, 0x72, 0x26, 0x40, 0x1b, 0xc0, 0x04, 0xec, 0x42, 0x01, 0x1e,
+    0xa0, 0x82, 0xe0, 0x04, 0x00, 0x00, 0x9f, 0x7f, 0xa8, 0x80, 0x21, 0xd8, 0x20, 0x15, 0xd4, 0x00,
+    0x59, 0x03, 0x54, 0x88, 0x50, 0x89, 0x41, 0xa5, 0x5b, 0x40, 0x5d, 0x00, 0x0d, 0xdd, 0x68, 0x03,
+    0xcc, 0x02, 0x11, 0xc0, 0x02, 0x30, 0x04, 0x7f, 0xfa, 0xd0, 0x01, 0x60, 0x11, 0x5d, 0x94, 0x54,
+    0x0e, 0x95, 0x5e, 0x88, 0x70, 0xb2, 0x05, 0xaa, 0x10, 0x49, 0x00, 0xeb, 0x90, 0x0a, 0x63, 0x00,
+    0x00, 0x0c, 0xf7, 0xf8, 0x02, 0xb6, 0x10, 0x0e, 0x40, 0x04, 0x50, 0x04, 0x20, 0x2e, 0xa1, 0xbe,
+    0x00, 0x1f, 0xf0, 0x07, 0xf4, 0xd0, 0x05, 0x54, 0x04, 0x50, 0x00, 0xaa, 0x80, 0x3f, 0xfd, 0xa0,
+    0x00, 0x15, 0x77, 0xd0, 0xf7, 0xf0, 0x16, 0x28, 0x82, 0xe0, 0x06, 0xe1, 0x02, 0x86, 0x21, 0x00,
+    0x11, 0x80, 0xeb, 0xcd, 0x00, 0x4e, 0x00, 0x70, 0x09, 0x40, 0x23, 0x00, 0x70, 0x06, 0x20, 0x01,
+    0x80, 0x38, 0x03, 0x10, 0x01, 0xc0, 0x0e, 0x01, 0x30, 0x04, 0x46, 0x03, 0xaf, 0x32, 0x00, 0xde,
+    0x00, 0x28, 0x62, 0x10, 0x08, 0xf5, 0x44, 0x17, 0x00, 0x31, 0xb4, 0xf7, 0xd0, 0x08, 0x10, 0x4d,
+    0xe4, 0x22, 0x34, 0x01, 0x61, 0x02, 0x0f, 0x76, 0x30, 0x37, 0x02, 0xf6, 0x20, 0x01, 0xc6, 0x00,
+    0xff, 0x70, 0x07, 0xff, 0x70, 0x6b, 0xbe, 0xc8, 0x03, 0x6a, 0x88, 0x26, 0x00, 0x42, 0x6a, 0x80,
+    0x01, 0x60, 0x0a, 0xea, 0xdc, 0x01, 0xe0, 0x12, 0x00, 0x2c, 0x00, 0x60, 0x01, 0x00, 0xf0, 0x80,
+    0x7f, 0xf9, 0x80, 0x0a, 0xf9, 0x02, 0x50, 0x60, 0x22, 0x01, 0x80, 0x37, 0x58, 0x00, 0xfd, 0xe0,
+    0x0f, 0xff, 0x38, 0x00, 0x57, 0xc8, 0x00, 0x94, 0x18, 0x00, 0x44, 0x03, 0x00, 0xb7, 0x58, 0x01,
+    0x7e, 0xf0, 0x07, 0xff, 0xdd, 0x24, 0x00, 0x41, 0xec, 0x00, 0xa0, 0x08, 0xa1, 0x80, 0xff, 0x70,
+    0x07, 0xff, 0x8f, 0x7f, 0xce, 0x01, 0xeb, 0x20, 0x57, 0x00, 0xe9, 0x40, 0x3a, 0x00, 0xe7, 0x60,
+    0x2d, 0x00, 0xe1, 0x80, 0x07, 0x88, 0x07, 0xf2, 0x00, 0x7c, 0x40, 0x09, 0x10, 0x0f, 0x63, 0x00,
+    0x28, 0x03, 0x84, 0x52, 0x20, 0x8c, 0x01, 0xf5, 0x00, 0x24, 0x80, 0x3c, 0x8c, 0x00, 0xe0, 0x00,
+    0xff, 0x70, 0x07, 0xff, 0x78, 0xff, 0x60, 0xdf, 0xf4, 0x80, 0xcf, 0x7d, 0x90, 0x04, 0x38, 0x80,
+    0x2d, 0x78, 0xc2, 0x09, 0x80, 0x11, 0x0d, 0x40, 0x01, 0x0e, 0x68, 0x40, 0x58, 0x02, 0xd5, 0x75,
+    0x00, 0x43, 0x2d, 0x80, 0x3c, 0x00, 0x22, 0x00, 0x10, 0x01, 0x40, 0x0c, 0x00, 0x30, 0x0f, 0xff,
+    0xf8, 0x07, 0xff, 0x24, 0xff, 0x69, 0x57, 0x7d, 0x90, 0x04, 0x78, 0xa2, 0x09, 0x80, 0x10, 0x9c,
+    0x40, 0x00, 0x2c, 0x01, 0x7b, 0xba, 0x40, 0x1e, 0x00, 0x12, 0x00, 0x28, 0x00, 0xc0, 0x3f, 0x84,
+    0x03, 0xff, 0xcc, 0x00, 0x00, 0x9f, 0x7f, 0xad, 0x00, 0x30, 0xec, 0x10, 0x0a, 0x5c, 0x00, 0x56,
+    0x40, 0x4e, 0xc0, 0x07, 0x40, 0x15, 0x01, 0xc8, 0x99, 0x00, 0x3c, 0x10, 0x00, 0xe2, 0x00, 0x60,
+    0x02, 0x01, 0x80, 0x38, 0x03, 0x08, 0x04, 0x60, 0x0e, 0x00, 0xc2, 0x01, 0x20, 0x01, 0xc4, 0x00,
+    0xc0, 0x04, 0x01, 0x50, 0x1c, 0x89, 0x90, 0x03, 0xc0, 0x16, 0x40, 0x4e, 0xc0, 0x07, 0x40, 0x00,
+    0xec, 0x10, 0x0a, 0x5c, 0x00, 0x00, 0xff, 0x69, 0xe7, 0xf5, 0x10, 0x06, 0x2c, 0x30, 0x15, 0xc2,
+    0x00, 0xc3, 0x56, 0x80, 0x32, 0x01, 0xb5, 0x52, 0xc4, 0x10, 0x40, 0x02, 0x60, 0x13, 0x80, 0x14,
+    0x00, 0x40, 0x18, 0x40, 0x02, 0x00, 0x20, 0x0c, 0x40, 0x01, 0x00, 0x0a, 0x80, 0x05, 0x40, 0x0a,
+    0x01, 0x54, 0xc7, 0x80, 0x10, 0x40, 0x02, 0x4c, 0xe2, 0x03, 0x20, 0x1b, 0x10, 0x05, 0x70, 0x80,
+    0x30, 0xdf, 0xf5, 0x10, 0x07, 0xff, 0x5c, 0x00, 0x15, 0x77, 0xd0, 0xf7, 0xf0, 0x16, 0x28, 0x82,
+    0xe0, 0x80, 0x5c, 0x20, 0x50, 0xc4, 0x01, 0x11, 0x80, 0xe3, 0xcc, 0x80, 0x27, 0x00, 0x38, 0x80,
+    0x18, 0x02, 0x30, 0x07, 0x00, 0x62, 0x00, 0x18, 0x03, 0x80, 0x31, 0x00, 0x1c, 0x00, 0xe2, 0x00,
+    0x60, 0x08, 0x8c, 0x07, 0x22, 0x64, 0x01, 0xbc, 0x00, 0x4e, 0xc6, 0x01, 0x8f, 0x50, 0x41, 0x74,
+    0x03, 0x8a, 0xfb, 0xe8, 0x40, 0x3f, 0xfb, 0x00, 0xff, 0x62, 0xef, 0x98, 0x00, 0x68, 0x80, 0x31,
+    0x03, 0x41, 0x00, 0x57, 0x2e, 0x20, 0x12, 0x00, 0x70, 0x80, 0x7f, 0xf6, 0xc0, 0x00, 0x2e, 0x77,
+    0xeb, 0x80, 0x53, 0x46, 0x20, 0x51, 0xa0, 0x2c, 0x03, 0x78, 0xa0, 0x4c, 0x40, 0x02, 0x43, 0xb6,
+    0x61, 0x98, 0x40, 0xf6, 0x5e, 0xe5, 0x43, 0x44, 0x09, 0xa7, 0x6c, 0x40, 0xfb, 0x21, 0x40, 0x09,
+    0x67, 0x32, 0x77, 0x56, 0x80, 0x1c, 0x19, 0x92, 0x87, 0x40, 0x06, 0x36, 0x02, 0xbc, 0x70, 0x04,
+    0x84, 0xda, 0x08, 0x0b, 0x69, 0x00, 0x00, 0x44, 0x18, 0x03, 0x3b, 0xac, 0x03, 0xfb, 0x7c, 0x00,
+    0x5f, 0xe0, 0x0f, 0xa6, 0x80, 0x03, 0x54, 0x45, 0x00, 0x1a, 0xa8, 0x03, 0xff, 0xa8, 0x4c, 0xa0,
+    0x04, 0x00, 0x4d, 0x00, 0x29, 0x44, 0x00, 0x00, 0xff, 0x70, 0x04, 0x7f, 0xeb, 0x00, 0xff, 0xf6,
+    0x38, 0x04, 0x20, 0x26, 0x00, 0xd0, 0x09, 0x40, 0x19, 0x56, 0xc0, 0x14, 0x00, 0x4a, 0x88, 0x00,
+    0x8e, 0x88, 0x06, 0x24, 0x02, 0x00, 0xbf, 0xf2, 0x00, 0x45, 0xfe, 0xce, 0x00, 0x68, 0x04, 0xa0,
+    0x0b, 0x50, 0x03, 0x80, 0x56, 0x00, 0x60, 0x50, 0x13, 0x01, 0x30, 0x41, 0x0f, 0x00, 0x58, 0x38,
+    0x03, 0x40, 0x0a, 0x00, 0x50, 0xd0, 0x03, 0x80, 0x4c, 0x04, 0x44, 0x04, 0x10, 0x0b, 0x40, 0x12,
+    0x00, 0xe0, 0x0c, 0x82, 0x08, 0x00, 0x50, 0x0e, 0x70, 0x09, 0x40, 0x3d, 0x40, 0x17, 0x80, 0x40,
+    0xbf, 0xf1, 0x80, 0x0f, 0xfd, 0x20, 0x17, 0x7f, 0x87, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x08,
+    0x40, 0x85, 0x40, 0x18, 0x00, 0xb0, 0x01, 0x08, 0x20, 0x01, 0x40, 0x88, 0x08, 0x00, 0x30, 0x09,
+    0x03, 0x00, 0x16, 0x00, 0x40, 0x01, 0xa0, 0x01, 0x43, 0x01, 0x00, 0x4c, 0x01, 0xa0, 0x05, 0x30,
+    0x3c, 0x04, 0x11, 0x02, 0x00, 0x48, 0x00, 0xcc, 0x05, 0xa0, 0x13, 0x80, 0x30, 0x03, 0x20, 0x3a,
+    0x02, 0x11, 0x02, 0xc0, 0x0e, 0x01, 0xb4, 0x08, 0x04, 0xc1, 0x00, 0x80, 0xc4, 0x03, 0x20, 0x04,
+    0x80, 0x0c, 0x00, 0x90, 0x03, 0x88, 0x80, 0x0c, 0x00, 0x28, 0x05, 0x60, 0x10, 0x4f, 0xf6, 0x00,
+    0x5d, 0xfe, 0x24, 0x50, 0x36, 0x08, 0x10, 0x82, 0x0b, 0x10, 0x82, 0x70, 0x37, 0x00, 0x0c, 0x00,
+    0xe0, 0x03, 0xc0, 0x33, 0x18, 0x08, 0x39, 0x80, 0x74, 0x80, 0x54, 0x01, 0xe8, 0x00, 0xa4, 0x03,
+    0xa4, 0x80, 0x81, 0x18, 0x02, 0x36, 0x03, 0xc0, 0x04, 0x08, 0x03, 0x80, 0x1e, 0x30, 0x03, 0x61,
+    0x04, 0x0c, 0x60, 0xe4, 0x0a, 0x80, 0xbf, 0xf2, 0x00, 0x45, 0xfe, 0xce, 0x00, 0x68, 0x05, 0x40,
+    0x0a, 0x51, 0x07, 0x00, 0x94, 0x00, 0xe0, 0xe0, 0x28, 0x04, 0x40, 0x51, 0x0a, 0x00, 0x68, 0x50,
+    0x03, 0xc0, 0x06, 0x40, 0xe0, 0xa0, 0x2a, 0x01, 0x50, 0x0a, 0x90, 0x38, 0x06, 0x60, 0x05, 0x80,
+    0x28, 0x03, 0x0a, 0x00, 0x81, 0x18, 0x07, 0x70, 0x05, 0x40, 0x1e, 0x50, 0x09, 0x40, 0x3c, 0x60,
+    0x03, 0x20, 0x0c, 0x8b, 0xe0, 0x09, 0x00, 0xef, 0xa3, 0x02, 0x50, 0x0f, 0xc9, 0xe0, 0x1c, 0x00,
+    0x1f, 0xff, 0xce, 0x01, 0xfe, 0x19, 0x9d, 0x00, 0x12, 0x83, 0x36, 0xb0, 0x05, 0x10, 0x06, 0x93,
+    0x06, 0x50, 0x0c, 0xac, 0x07, 0x20, 0x18, 0xa8, 0x07, 0x80, 0x3b, 0xc0, 0x14, 0x40, 0x1a, 0x88,
+    0x0c, 0x99, 0xa3, 0x15, 0x00, 0x1c, 0xce, 0xb0, 0x0f, 0xf0, 0x00, 0x8a, 0x77, 0xc4, 0x00, 0x38,
+    0xc4, 0x01, 0x98, 0x40, 0xa4, 0x40, 0x1c, 0x00, 0xe6, 0x00, 0x8c, 0x00, 0x40, 0x1f, 0xfc, 0x01,
+    0x00, 0xf0, 0xa0, 0x00, 0x40, 0x15, 0xc0, 0x07, 0x00, 0x9c, 0x00, 0xf0, 0x01, 0xe7, 0x60, 0x0b,
+    0x6c, 0x01, 0x20, 0x19, 0x0c, 0x00, 0x20, 0x19, 0x80, 0x3f, 0xf8, 0x66, 0x00, 0x20, 0x0d, 0xc0,
+    0x0f, 0x60, 0x09, 0x84, 0x0e, 0x44, 0x00, 0x38, 0xa4, 0x00, 0x00, 0xdf, 0xc3, 0x01, 0x00, 0xff,
+    0xfc, 0x80, 0x5f, 0xd8, 0x10, 0x0e, 0x27, 0xd0, 0x09, 0x20, 0x40, 0xcc, 0x00, 0x17, 0x90, 0x02,
+    0x80, 0x62, 0x00, 0x08, 0x07, 0xff, 0x0f, 0xc0, 0x33, 0x00, 0x10, 0x03, 0x19, 0x80, 0xf9, 0xc0,
+    0x2c, 0x50, 0x1d, 0x00, 0xa5, 0x40, 0x38, 0x98, 0x07, 0x28, 0x00, 0xe0, 0x06, 0x30, 0x0f, 0x78,
+    0x07, 0xff, 0x00, 0x80, 0x02, 0x00, 0x16, 0x90, 0x01, 0x00, 0x12, 0x44, 0x0d, 0x00, 0x31, 0x36,
+    0x80, 0x40, 0x00, 0x34, 0x20, 0x04, 0x26, 0x41, 0x92, 0xf7, 0x40, 0x09, 0xc9, 0x53, 0x00, 0x97,
+    0x65, 0xc0, 0xb0, 0x0b, 0xa8, 0x09, 0x80, 0x15, 0xeb, 0x62, 0xba, 0x80, 0x34, 0x60, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 80, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 29, .adv_w = 144, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 52, .adv_w = 208, .box_w = 14, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 147, .adv_w = 208, .box_w = 13, .box_h = 20, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 261, .adv_w = 304, .box_w = 17, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 376, .adv_w = 208, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 472, .adv_w = 80, .box_w = 4, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 484, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 542, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 600, .adv_w = 176, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 640, .adv_w = 208, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 670, .adv_w = 80, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 683, .adv_w = 144, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 690, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 701, .adv_w = 112, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 762, .adv_w = 208, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 856, .adv_w = 128, .box_w = 7, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 877, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 957, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1044, .adv_w = 208, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1107, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1188, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1278, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1337, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1426, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1517, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1543, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1574, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1630, .adv_w = 208, .box_w = 11, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1652, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1710, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1780, .adv_w = 320, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1956, .adv_w = 224, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2046, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2116, .adv_w = 240, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2211, .adv_w = 224, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2283, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2321, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2352, .adv_w = 240, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2449, .adv_w = 224, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2474, .adv_w = 80, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2480, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2521, .adv_w = 224, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2594, .adv_w = 176, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2611, .adv_w = 288, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2698, .adv_w = 240, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2760, .adv_w = 240, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2862, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2914, .adv_w = 240, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3025, .adv_w = 208, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3093, .adv_w = 208, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3191, .adv_w = 208, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3215, .adv_w = 224, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3263, .adv_w = 224, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3358, .adv_w = 320, .box_w = 20, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3502, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3595, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3662, .adv_w = 208, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3729, .adv_w = 112, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3745, .adv_w = 112, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3803, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3821, .adv_w = 144, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 3851, .adv_w = 160, .box_w = 10, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3858, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 3871, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3930, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3992, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4053, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4117, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4176, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4208, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4288, .adv_w = 192, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4323, .adv_w = 80, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4339, .adv_w = 80, .box_w = 6, .box_h = 19, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4366, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4416, .adv_w = 80, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4421, .adv_w = 288, .box_w = 16, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4468, .adv_w = 192, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4500, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4566, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4631, .adv_w = 192, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4696, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4717, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4774, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4808, .adv_w = 192, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4838, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4896, .adv_w = 256, .box_w = 17, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4989, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5046, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 5120, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5162, .adv_w = 144, .box_w = 8, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5227, .adv_w = 112, .box_w = 3, .box_h = 25, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5234, .adv_w = 144, .box_w = 8, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5298, .adv_w = 208, .box_w = 11, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_bold_20_bold_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 25,
+    .base_line = 5,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 2,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
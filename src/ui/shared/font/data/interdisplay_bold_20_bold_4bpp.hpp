@@ -1,7 +0,0 @@
-#pragma once
-
-#include <Arduino.h>
-
-
-extern const uint8_t interdisplay_bold_20_bold_4bpp_bin[] PROGMEM;
-extern const uint32_t interdisplay_bold_20_bold_4bpp_bin_len;
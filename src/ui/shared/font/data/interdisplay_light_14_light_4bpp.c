@@ -0,0 +1,2104 @@
+/*
+ * interdisplay_light_14_light_4bpp - generated by script/binfont_to_c.py from interdisplay_light_14_light_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x0f, 0x00, 0x08, 0x07, 0xfc, 0x60, 0x1d, 0xe0, 0x01, 0x01, 0xd1, 0x00, 0xd2, 0xb1, 0x31,
+    0x70, 0x05, 0x0d, 0x80, 0x00, 0x91, 0xc0, 0x16, 0x01, 0xc6, 0x60, 0x03, 0x80, 0x77, 0x30, 0x01,
+    0xc0, 0x24, 0xb6, 0x9b, 0xc6, 0xb2, 0x04, 0xb3, 0xbb, 0x55, 0xd8, 0x80, 0x04, 0xa0, 0x0f, 0x50,
+    0x0a, 0xf9, 0x2e, 0xcf, 0x0e, 0x00, 0xbb, 0x4d, 0xd8, 0xad, 0xc0, 0x2d, 0x50, 0x17, 0x00, 0xe6,
+    0x10, 0x23, 0x00, 0x80, 0x00, 0x89, 0x00, 0x3c, 0x9c, 0x20, 0x12, 0xee, 0x9f, 0x1c, 0x01, 0x79,
+    0xe9, 0xb6, 0x64, 0x41, 0x00, 0xbc, 0x08, 0x58, 0x02, 0x33, 0x07, 0xe5, 0xa2, 0x80, 0x45, 0x56,
+    0xdf, 0xa4, 0x01, 0x8a, 0xae, 0xcb, 0x20, 0x18, 0x8d, 0x51, 0x40, 0x05, 0x1c, 0x19, 0xb0, 0xf1,
+    0xe8, 0x03, 0x10, 0x7a, 0x30, 0x00, 0x04, 0xbb, 0x18, 0x05, 0x0c, 0x00, 0x8b, 0xb7, 0x80, 0x0c,
+    0x98, 0x00, 0xe0, 0x1d, 0xf6, 0x01, 0x38, 0x89, 0xc2, 0xa0, 0x40, 0x2f, 0xbb, 0x4a, 0x9a, 0x00,
+    0x63, 0xaa, 0x1c, 0xc9, 0xaa, 0x00, 0x3a, 0xbc, 0xf2, 0xb9, 0x80, 0x27, 0xc3, 0x5c, 0x04, 0xc0,
+    0x01, 0x63, 0x81, 0x70, 0x3e, 0x80, 0x3a, 0x40, 0x08, 0x35, 0xec, 0x00, 0x01, 0xbb, 0x61, 0x80,
+    0x68, 0xeb, 0xee, 0x00, 0x63, 0x60, 0x30, 0x0e, 0x9f, 0x2c, 0x80, 0x0c, 0x6d, 0xb2, 0xa0, 0x1a,
+    0x05, 0x4c, 0x04, 0xc1, 0x0e, 0xea, 0xd1, 0x16, 0x07, 0xa0, 0x0d, 0x99, 0x58, 0x25, 0x88, 0x0a,
+    0x19, 0x01, 0xc6, 0xe6, 0xf5, 0xe8, 0x00, 0xd1, 0x7a, 0x00, 0x08, 0x40, 0x54, 0x55, 0x06, 0x60,
+    0x15, 0x40, 0x22, 0x03, 0x00, 0x18, 0x83, 0x90, 0x65, 0x83, 0xa8, 0x0a, 0x20, 0x58, 0x05, 0x50,
+    0x01, 0x10, 0x19, 0xa0, 0xe4, 0x04, 0xc0, 0x03, 0x01, 0x20, 0x56, 0x0c, 0xf0, 0x55, 0xc0, 0x00,
+    0x00, 0x14, 0x80, 0x0e, 0x44, 0x4b, 0x07, 0x7e, 0xe7, 0x05, 0x0a, 0x9a, 0xa7, 0x76, 0x3b, 0x71,
+    0x11, 0xe0, 0x10, 0x00, 0x15, 0x80, 0x7f, 0xab, 0x39, 0x73, 0x0b, 0x59, 0xcb, 0x98, 0x50, 0x0f,
+    0xf0, 0x80, 0x40, 0x00, 0xda, 0x06, 0x80, 0xb8, 0x00, 0x2c, 0xcc, 0x00, 0x03, 0x01, 0xd1, 0x00,
+    0x00, 0x94, 0x03, 0x40, 0x04, 0x68, 0x01, 0x5e, 0x00, 0x48, 0xa0, 0x01, 0x00, 0xc9, 0x60, 0x17,
+    0xa0, 0x04, 0xe6, 0x00, 0x34, 0x00, 0xaf, 0x00, 0x24, 0x40, 0x04, 0x00, 0x00, 0x3e, 0xe5, 0x08,
+    0x02, 0x3b, 0x73, 0xb4, 0x00, 0xb2, 0x00, 0x45, 0x52, 0x20, 0x03, 0x6e, 0x17, 0x00, 0x66, 0x20,
+    0x0f, 0xc5, 0xc0, 0x19, 0x89, 0x10, 0x01, 0xb7, 0x01, 0x64, 0x00, 0x8a, 0xa0, 0x81, 0xdc, 0xed,
+    0x00, 0x02, 0xcc, 0x2f, 0x48, 0x36, 0x38, 0x18, 0x07, 0xff, 0x3c, 0x02, 0xbd, 0xd4, 0x80, 0x5f,
+    0x1b, 0xae, 0xa0, 0x44, 0x18, 0x01, 0xd0, 0x12, 0x00, 0x3e, 0x10, 0x09, 0xdc, 0x01, 0xcb, 0x72,
+    0x01, 0x9b, 0xb0, 0x03, 0x3e, 0x58, 0x06, 0x9e, 0xa0, 0x0c, 0xac, 0xb9, 0x98, 0x40, 0x01, 0xad,
+    0xcb, 0x20, 0x06, 0x76, 0xe4, 0x78, 0x0a, 0xa0, 0x00, 0xc4, 0x86, 0x00, 0x25, 0x72, 0x00, 0xa7,
+    0xa6, 0x80, 0x34, 0xf4, 0x68, 0x8c, 0x01, 0x25, 0xba, 0xd8, 0x07, 0x0a, 0x3a, 0x00, 0x0e, 0x98,
+    0x33, 0xb7, 0x51, 0xe2, 0x00, 0x00, 0xc3, 0xd0, 0x01, 0xeb, 0x50, 0x0f, 0x28, 0x68, 0x07, 0x0c,
+    0x58, 0x07, 0xaa, 0x44, 0x03, 0x9c, 0x90, 0x03, 0x8a, 0xa4, 0x03, 0xd4, 0x19, 0x95, 0xb6, 0x0c,
+    0x6e, 0x65, 0x6d, 0x82, 0x01, 0xfc, 0x00, 0x0f, 0xcc, 0xd2, 0x02, 0x59, 0x9a, 0x40, 0xd8, 0x03,
+    0xc2, 0x28, 0xcd, 0x80, 0x03, 0xa6, 0x63, 0x46, 0x41, 0x75, 0x00, 0x12, 0x82, 0x23, 0x00, 0xcc,
+    0x6d, 0x00, 0x19, 0x8d, 0xd4, 0xc0, 0x0e, 0xe1, 0x17, 0xc6, 0x63, 0xe8, 0x00, 0x00, 0x46, 0xe5,
+    0x08, 0x02, 0x07, 0x73, 0xe8, 0x00, 0xd2, 0x00, 0x51, 0x12, 0x20, 0x03, 0x50, 0x88, 0x9f, 0x31,
+    0x22, 0x06, 0xc3, 0x98, 0xfd, 0x00, 0x2b, 0x00, 0x19, 0x86, 0x8e, 0x01, 0xce, 0x4e, 0xc0, 0x05,
+    0x74, 0x0b, 0xcd, 0xcf, 0xf0, 0x00, 0x8c, 0xcd, 0xba, 0x8c, 0xcd, 0x4a, 0x01, 0xd5, 0x20, 0x19,
+    0xd4, 0x40, 0x35, 0x40, 0x06, 0x7a, 0x00, 0xc3, 0x4e, 0x01, 0xa6, 0x80, 0x30, 0xab, 0x80, 0x69,
+    0xa0, 0x0c, 0x00, 0x02, 0xbc, 0xc4, 0x88, 0x03, 0xfd, 0x98, 0xfa, 0x00, 0x90, 0x00, 0xca, 0x00,
+    0x75, 0x00, 0x43, 0x00, 0x2e, 0x7b, 0x87, 0x00, 0x0d, 0x9e, 0xe6, 0x50, 0x2a, 0xc0, 0x07, 0x13,
+    0x30, 0x80, 0x79, 0xd4, 0xc0, 0x08, 0xc6, 0x3f, 0x1b, 0xae, 0xc0, 0x00, 0x02, 0xbc, 0xd9, 0x00,
+    0x0f, 0xfb, 0x37, 0xa4, 0x1d, 0x50, 0x00, 0xe8, 0x26, 0x01, 0xe2, 0x45, 0x50, 0x02, 0x0d, 0xc7,
+    0xfd, 0x98, 0xe4, 0x70, 0x2a, 0xcc, 0x33, 0x08, 0x8e, 0x01, 0x08, 0x09, 0x51, 0x80, 0x2a, 0x80,
+    0x0f, 0x8c, 0xdc, 0x60, 0x00, 0x1e, 0x11, 0x68, 0x81, 0x80, 0x7e, 0x30, 0x1d, 0x10, 0x1e, 0x11,
+    0x68, 0x81, 0x80, 0x7e, 0xd0, 0x24, 0x04, 0xc0, 0x65, 0x00, 0x00, 0xff, 0x9b, 0x44, 0x00, 0xda,
+    0x3a, 0x2b, 0x9d, 0x8e, 0x00, 0xe6, 0x91, 0x00, 0xaf, 0xb6, 0x44, 0x02, 0x4c, 0xc6, 0xc0, 0x06,
+    0x5c, 0xe1, 0x00, 0x7c, 0xce, 0x17, 0xcc, 0xe1, 0x00, 0xf9, 0xf3, 0x38, 0x40, 0x10, 0x0f, 0x35,
+    0x98, 0x06, 0x78, 0x85, 0x10, 0x04, 0x77, 0x33, 0x08, 0x04, 0x7e, 0x88, 0x00, 0x26, 0x6e, 0x29,
+    0xe6, 0xea, 0x44, 0x1b, 0xa4, 0x40, 0x20, 0x05, 0xcc, 0x94, 0x0e, 0x77, 0x36, 0x09, 0x28, 0x40,
+    0x51, 0xdc, 0xc0, 0x12, 0x38, 0x04, 0x59, 0x64, 0x01, 0x7f, 0x98, 0x02, 0x21, 0x30, 0x0c, 0x70,
+    0x01, 0xc2, 0xc0, 0x1c, 0x9c, 0x01, 0x00, 0x00, 0x86, 0x33, 0x2b, 0x60, 0x0e, 0x4d, 0xcc, 0xd5,
+    0xd6, 0x20, 0x03, 0x8c, 0x40, 0x08, 0x63, 0xa8, 0x01, 0x1e, 0x03, 0x59, 0x70, 0xea, 0x28, 0x2e,
+    0x61, 0x5d, 0x94, 0xa0, 0x0e, 0xd5, 0x50, 0x13, 0xa0, 0x0d, 0x00, 0x15, 0x42, 0x20, 0x16, 0x00,
+    0x84, 0x00, 0x23, 0x80, 0x58, 0x02, 0x10, 0x00, 0x89, 0x54, 0x04, 0x08, 0x03, 0x7e, 0x0d, 0x62,
+    0xe6, 0x1b, 0xf9, 0x5c, 0x79, 0xce, 0x11, 0xe0, 0x37, 0x96, 0x57, 0x92, 0x00, 0x38, 0xc4, 0x00,
+    0xc8, 0x01, 0xc9, 0xb9, 0x9e, 0x00, 0x80, 0x00, 0x93, 0xc8, 0x03, 0xdc, 0xf4, 0x01, 0xc2, 0xf0,
+    0xa0, 0x1c, 0xea, 0x08, 0x80, 0x0d, 0x54, 0x0a, 0xe0, 0x08, 0x9c, 0x80, 0xdc, 0x40, 0x14, 0xd9,
+    0x91, 0xb8, 0x01, 0x77, 0x32, 0xfa, 0x04, 0x70, 0x0c, 0x20, 0x5d, 0xc0, 0x0e, 0xaa, 0x00, 0xec,
+    0xcc, 0xc0, 0x16, 0x66, 0xd6, 0x00, 0xf4, 0x68, 0x07, 0xc2, 0x01, 0xc3, 0x1c, 0x00, 0xcc, 0xb8,
+    0x90, 0x01, 0x99, 0x7f, 0xb0, 0x03, 0xcc, 0x24, 0x01, 0xc6, 0x04, 0x19, 0x9a, 0x3c, 0x00, 0x00,
+    0x15, 0x6e, 0xb1, 0x40, 0x23, 0xfe, 0xdd, 0x74, 0xb0, 0x03, 0xb8, 0x80, 0x02, 0xd8, 0x03, 0x13,
+    0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00, 0xff, 0x98, 0x80, 0x3c, 0x40, 0x6c, 0x60, 0x18, 0x70,
+    0x01, 0xdc, 0x30, 0x01, 0x6c, 0x00, 0x0f, 0xe7, 0x75, 0xd2, 0xc0, 0x00, 0xec, 0xcc, 0xe0, 0x16,
+    0x66, 0xfb, 0x00, 0xf4, 0x02, 0x80, 0x7b, 0xf8, 0x03, 0xca, 0xc0, 0x1e, 0x30, 0x0f, 0x99, 0xc0,
+    0x3d, 0xfe, 0x00, 0xe8, 0x05, 0x0c, 0xcd, 0xf6, 0x00, 0xec, 0xce, 0x60, 0xcc, 0xe6, 0x00, 0xff,
+    0xe5, 0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x98, 0xec, 0xce, 0x30, 0xcc, 0xe3,
+    0x00, 0xff, 0xe5, 0x66, 0x69, 0x00, 0x66, 0x69, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x15, 0x6e, 0xb1,
+    0x00, 0x23, 0xfe, 0xdd, 0x74, 0xa8, 0x03, 0xb8, 0x80, 0x02, 0xcb, 0x03, 0x13, 0x00, 0xc3, 0x80,
+    0xca, 0x01, 0xe2, 0x00, 0xf3, 0xe6, 0x35, 0x19, 0x40, 0x27, 0xcc, 0x33, 0x98, 0x98, 0x06, 0x15,
+    0x30, 0xee, 0x20, 0x00, 0xb6, 0x00, 0x07, 0xfd, 0xba, 0xe8, 0x60, 0x00, 0xe0, 0x0e, 0x3b, 0x00,
+    0xff, 0xea, 0xe6, 0x77, 0x00, 0x33, 0x3b, 0x80, 0x3f, 0xf9, 0xa0, 0xe0, 0x0f, 0xe0, 0x00, 0xe8,
+    0x60, 0x0f, 0xfe, 0xb9, 0x10, 0x03, 0x9e, 0xc0, 0x21, 0x34, 0x40, 0x80, 0xa2, 0x06, 0x77, 0x36,
+    0x44, 0xe0, 0x0c, 0xd8, 0x01, 0xcb, 0x58, 0x01, 0x96, 0x34, 0x03, 0x24, 0x60, 0x80, 0x47, 0x76,
+    0x10, 0x0d, 0xd7, 0x61, 0x00, 0xde, 0x91, 0x40, 0x18, 0x81, 0x49, 0xc0, 0x3d, 0x34, 0x60, 0x1e,
+    0xee, 0x00, 0xe0, 0x0f, 0xff, 0x56, 0x67, 0x00, 0xf8, 0x00, 0xf5, 0x68, 0xa8, 0x07, 0x0a, 0x00,
+    0x11, 0x40, 0x33, 0x30, 0x01, 0x52, 0x01, 0xaa, 0x80, 0x03, 0x03, 0x00, 0x23, 0x98, 0x05, 0x34,
+    0x00, 0xf9, 0x00, 0xca, 0x82, 0x4e, 0x60, 0x1c, 0xaf, 0x54, 0x00, 0xf4, 0xda, 0xb0, 0x07, 0x85,
+    0xd4, 0x03, 0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20, 0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0, 0x3d, 0x34,
+    0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d, 0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1, 0xa0, 0x00,
+    0x00, 0x15, 0x6e, 0xad, 0x00, 0x23, 0xf9, 0xdd, 0x4c, 0x28, 0x03, 0xb8, 0x60, 0x02, 0xd8, 0x13,
+    0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07, 0xf9, 0x94, 0x03, 0xdf, 0xa6, 0x26, 0x01,
+    0x85, 0x10, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc, 0x6e, 0xba, 0x14, 0x00, 0xec, 0xcb, 0x60,
+    0x01, 0x99, 0x69, 0x38, 0x07, 0x45, 0x00, 0x78, 0x40, 0x30, 0xcd, 0x06, 0x65, 0xba, 0x60, 0xcc,
+    0xcc, 0x01, 0xff, 0xca, 0x00, 0x00, 0x15, 0x6e, 0xad, 0x00, 0x23, 0xf9, 0xdd, 0x4c, 0x28, 0x03,
+    0xb8, 0x60, 0x02, 0xd8, 0x13, 0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07, 0xf9, 0x94,
+    0x02, 0x20, 0x07, 0xe9, 0x89, 0x80, 0x2d, 0xc5, 0x10, 0x1d, 0xc3, 0x09, 0xbc, 0x81, 0x03, 0xf8,
+    0xdd, 0x00, 0x10, 0x02, 0x2b, 0xdd, 0x64, 0x58, 0x00, 0xec, 0xcb, 0x60, 0x02, 0xcc, 0xb4, 0x64,
+    0x03, 0xd2, 0xe0, 0x1e, 0x10, 0x0f, 0xad, 0x80, 0x19, 0x97, 0x64, 0x00, 0x33, 0x23, 0x40, 0x0f,
+    0x44, 0x80, 0x79, 0x5d, 0x00, 0x3d, 0x10, 0x00, 0x02, 0xad, 0xd6, 0x18, 0x03, 0xfd, 0xba, 0xfd,
+    0x12, 0x15, 0x00, 0x1c, 0xa1, 0x14, 0x01, 0x3a, 0x85, 0x7d, 0xb9, 0x00, 0x49, 0xb2, 0x1d, 0x60,
+    0x18, 0x9f, 0x0e, 0x16, 0x40, 0x36, 0x12, 0x3a, 0x00, 0x07, 0xfc, 0x39, 0xfb, 0xb7, 0x28, 0x8c,
+    0xc6, 0xf6, 0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xff, 0xa0, 0x0e, 0x00, 0xe3, 0xb0, 0x0f,
+    0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde, 0x20,
+    0xa4, 0x00, 0xe6, 0x8e, 0xe0, 0x07, 0x55, 0x11, 0xc4, 0x02, 0x20, 0x20, 0x57, 0x00, 0xaa, 0x80,
+    0x0a, 0xa0, 0x04, 0xae, 0x00, 0x20, 0x20, 0x37, 0x10, 0x0a, 0xa8, 0x15, 0xc0, 0x19, 0x94, 0x11,
+    0x00, 0x1c, 0xf0, 0xa0, 0x1e, 0xe7, 0xa0, 0x08, 0xb3, 0x00, 0x8f, 0xc8, 0x02, 0x3b, 0xc4, 0x00,
+    0x90, 0xd4, 0x02, 0xbd, 0x5b, 0x00, 0xb2, 0x30, 0x02, 0x44, 0x10, 0x80, 0x4c, 0x8c, 0x00, 0x11,
+    0x10, 0x22, 0x01, 0x10, 0x08, 0x80, 0x44, 0x00, 0x33, 0x43, 0x70, 0x33, 0x01, 0x9a, 0x00, 0x54,
+    0x04, 0x50, 0x44, 0x02, 0x20, 0x02, 0x13, 0x10, 0x00, 0x81, 0xb0, 0x06, 0xb8, 0xb0, 0x09, 0x23,
+    0x00, 0x32, 0x24, 0x01, 0x5a, 0x28, 0x00, 0x4c, 0x00, 0xc3, 0xa2, 0x8a, 0xe0, 0x15, 0x40, 0x84,
+    0xd1, 0x83, 0x92, 0x80, 0x5f, 0xc7, 0x52, 0x01, 0x8a, 0xb3, 0x80, 0x3d, 0xc2, 0xc0, 0x1c, 0xa5,
+    0xf0, 0x40, 0x10, 0xc5, 0x0c, 0xf0, 0x05, 0x52, 0x20, 0x8a, 0xe0, 0xe4, 0x80, 0x14, 0xd9, 0x80,
+    0x88, 0x00, 0x76, 0x24, 0x29, 0x80, 0x4e, 0xc8, 0x1d, 0xc0, 0x01, 0x55, 0x80, 0x0d, 0x60, 0x3a,
+    0x44, 0x02, 0x84, 0x96, 0x40, 0x0e, 0xf6, 0xb0, 0x0f, 0x11, 0x04, 0x03, 0xff, 0xa4, 0x00, 0x4c,
+    0xce, 0xdf, 0x04, 0xcc, 0xe4, 0x80, 0x0f, 0x31, 0x38, 0x07, 0x1d, 0xd0, 0x07, 0x0f, 0x70, 0x40,
+    0x3a, 0xac, 0xc0, 0x39, 0xc9, 0x80, 0x39, 0x2e, 0x40, 0x38, 0x67, 0x80, 0x3d, 0x27, 0xd9, 0x9c,
+    0x00, 0xbb, 0x23, 0x5a, 0x00, 0x7f, 0xf3, 0xda, 0xd0, 0x60, 0x0d, 0x84, 0x01, 0x7a, 0x80, 0x49,
+    0x80, 0x10, 0xb8, 0x06, 0x45, 0x00, 0xaf, 0x00, 0x23, 0x40, 0x0c, 0xe4, 0x01, 0x7a, 0x80, 0x49,
+    0x80, 0x10, 0xb8, 0x00, 0x4b, 0xb2, 0x53, 0x00, 0x7f, 0xf3, 0xd2, 0x98, 0x00, 0x6c, 0x80, 0x4d,
+    0x4a, 0x20, 0x0a, 0x78, 0x80, 0x3d, 0x82, 0x29, 0x00, 0xcc, 0xf1, 0x80, 0x1d, 0x01, 0xb6, 0x00,
+    0x04, 0xcc, 0x94, 0x0a, 0x73, 0x1b, 0x02, 0x58, 0x01, 0x09, 0x03, 0x5d, 0x48, 0x01, 0x76, 0xea,
+    0x1c, 0x00, 0x60, 0x03, 0x50, 0x50, 0xcc, 0x52, 0x00, 0x2c, 0x00, 0xff, 0xe6, 0x36, 0x62, 0xc4,
+    0x00, 0x63, 0x98, 0xfd, 0x00, 0x13, 0x80, 0x11, 0xcc, 0x18, 0x03, 0x13, 0x03, 0x00, 0x62, 0x60,
+    0x27, 0x00, 0x23, 0x98, 0x18, 0xe6, 0x3f, 0x40, 0x02, 0xbc, 0xc3, 0x80, 0x3e, 0x33, 0x1c, 0xca,
+    0xa3, 0x00, 0x42, 0x97, 0x00, 0x42, 0x65, 0xc0, 0x10, 0x9a, 0xa8, 0xc0, 0x10, 0x81, 0xf1, 0x98,
+    0xe7, 0x00, 0x00, 0xf7, 0x00, 0x7f, 0xf0, 0xcf, 0x31, 0x68, 0x03, 0xdc, 0xcb, 0xd0, 0x75, 0x20,
+    0x04, 0x88, 0xb8, 0x03, 0x10, 0xf0, 0x06, 0x27, 0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98, 0xd0, 0x00,
+    0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73, 0x25, 0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00, 0xd5, 0xde,
+    0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x03, 0xc8, 0x0a, 0x88, 0x01, 0xb8, 0x5a, 0x7c,
+    0x5a, 0x7c, 0x00, 0x7f, 0xf2, 0x00, 0x03, 0xcc, 0x5a, 0x70, 0xf7, 0x32, 0xf4, 0x1d, 0x48, 0x01,
+    0x22, 0x2e, 0x00, 0xc4, 0x3c, 0x01, 0x89, 0xd4, 0x80, 0x12, 0x22, 0xee, 0x66, 0x34, 0x02, 0xcc,
+    0x90, 0x01, 0xc4, 0x00, 0x77, 0x07, 0xce, 0x63, 0xa4, 0x2c, 0x00, 0xff, 0xe4, 0xc6, 0x6c, 0x00,
+    0x0f, 0x31, 0xa4, 0xc0, 0x68, 0x00, 0xec, 0x00, 0xe7, 0x00, 0xff, 0xe5, 0x00, 0x2c, 0x2d, 0x01,
+    0x2c, 0x00, 0xff, 0xe0, 0x00, 0x02, 0xc0, 0x2d, 0x00, 0x08, 0x0e, 0x00, 0x7f, 0xf2, 0x89, 0xd7,
+    0xe0, 0x2c, 0x00, 0xff, 0xe5, 0xae, 0x08, 0x04, 0xbd, 0x82, 0x00, 0x6e, 0xb0, 0x08, 0xe8, 0x03,
+    0x8f, 0x0a, 0x40, 0x3a, 0x49, 0x80, 0x3a, 0xe9, 0x00, 0x2c, 0x00, 0xff, 0xe3, 0x00, 0x2c, 0x8a,
+    0xc6, 0x5a, 0xa8, 0x00, 0x75, 0x4c, 0xbd, 0xaa, 0x64, 0x01, 0x90, 0x01, 0xf0, 0x00, 0x84, 0x01,
+    0xe7, 0x00, 0x84, 0x03, 0xff, 0xaa, 0x00, 0x2c, 0x8a, 0xb8, 0x00, 0x1d, 0x52, 0xc1, 0x80, 0xc8,
+    0x01, 0x78, 0x01, 0xff, 0xd0, 0x00, 0x02, 0xbc, 0xc3, 0x80, 0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18,
+    0x02, 0x64, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66,
+    0x39, 0xc0, 0x2c, 0x7a, 0xa8, 0x40, 0x06, 0x55, 0x49, 0xd0, 0x01, 0x28, 0x00, 0xdc, 0xc1, 0x80,
+    0x31, 0x30, 0x28, 0x06, 0x26, 0x00, 0x38, 0x01, 0x5c, 0xc0, 0x87, 0x31, 0xda, 0x01, 0x36, 0x62,
+    0xc4, 0x03, 0xff, 0x8a, 0x00, 0x03, 0xcc, 0x5a, 0xf0, 0xf7, 0x32, 0xf0, 0x1d, 0x48, 0x01, 0x22,
+    0x2e, 0x00, 0xc4, 0x3c, 0x01, 0x89, 0xd4, 0x80, 0x12, 0x22, 0xee, 0x66, 0x34, 0x00, 0x79, 0x92,
+    0x00, 0x7f, 0xf0, 0xc0, 0x2b, 0x9b, 0x00, 0x25, 0xd8, 0x00, 0x64, 0x01, 0xff, 0xca, 0x00, 0x07,
+    0xcb, 0xb0, 0x9e, 0x62, 0xfe, 0xc5, 0xc4, 0x12, 0x0a, 0x2f, 0x24, 0x05, 0x6b, 0x37, 0xd6, 0xc0,
+    0x0a, 0x09, 0xb9, 0x75, 0xc0, 0x05, 0x10, 0x07, 0x10, 0x5a, 0xfc, 0x5a, 0xfc, 0x00, 0x7f, 0xf0,
+    0x44, 0x02, 0xff, 0x40, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04, 0x46, 0x00,
+    0xe0, 0x07, 0x7e, 0x5e, 0x00, 0x95, 0x00, 0x92, 0xae, 0x40, 0x2f, 0x92, 0x02, 0x01, 0x73, 0x09,
+    0xb0, 0x6a, 0x00, 0x2a, 0x05, 0x30, 0x04, 0xb4, 0x80, 0x1a, 0x96, 0x80, 0x00, 0xa4, 0x00, 0x36,
+    0x00, 0x5a, 0x1f, 0xa0, 0x0d, 0x01, 0x03, 0x70, 0x54, 0x01, 0x7a, 0x70, 0xbf, 0x00, 0x31, 0x3d,
+    0xbe, 0x82, 0x20, 0x01, 0xab, 0x8a, 0x2e, 0x4e, 0x20, 0x07, 0xc6, 0x20, 0xb9, 0xd0, 0x08, 0x5d,
+    0x00, 0x0a, 0x88, 0x00, 0x00, 0x4c, 0x00, 0xb0, 0xd2, 0xe0, 0x22, 0xcc, 0x1c, 0xe0, 0xdc, 0x02,
+    0x87, 0x80, 0x0d, 0xf5, 0xe0, 0x15, 0x51, 0x6a, 0x41, 0x81, 0x81, 0x8d, 0x40, 0x95, 0x00, 0x92,
+    0xae, 0x40, 0x2e, 0x92, 0x02, 0x01, 0x73, 0x0a, 0xa0, 0x35, 0x00, 0x19, 0x42, 0xd8, 0x02, 0x48,
+    0x61, 0x00, 0xad, 0xe4, 0x03, 0x19, 0x18, 0x06, 0x6b, 0x00, 0x87, 0x35, 0x80, 0x20, 0x4c, 0xcb,
+    0x74, 0x99, 0x93, 0x48, 0x04, 0xe6, 0x80, 0x04, 0xb8, 0x00, 0x0c, 0xe8, 0x05, 0x52, 0x20, 0x05,
+    0x48, 0xcc, 0x58, 0x00, 0x15, 0x30, 0x02, 0x39, 0x80, 0x02, 0xa0, 0x13, 0x80, 0x61, 0x10, 0x1f,
+    0xa8, 0x00, 0xf9, 0x40, 0x21, 0x18, 0x03, 0xf3, 0x80, 0x62, 0x40, 0x0a, 0x3d, 0x80, 0x84, 0x00,
+    0xff, 0xe9, 0x00, 0x4b, 0x30, 0x02, 0x4f, 0x80, 0x44, 0x20, 0x1f, 0xe2, 0x00, 0xa3, 0x54, 0x01,
+    0x3a, 0xa0, 0x01, 0x20, 0x0f, 0xfe, 0x01, 0xb0, 0x01, 0x22, 0x40, 0x00, 0x06, 0xcb, 0x50, 0x46,
+    0x0f, 0xca, 0xdc, 0xf7, 0x00, 0x00, 0x1e, 0x11, 0x50, 0x82, 0x80, 0x3c, 0x03, 0x84, 0x03, 0xff,
+    0x82, 0x00, 0x00, 0xa8, 0x80, 0x33, 0x3d, 0x90, 0x02, 0xb9, 0xb3, 0xcc, 0xc3, 0x02, 0xfc, 0x88,
+    0xd0, 0x08, 0xdc, 0x03, 0xe4, 0xd0, 0x08, 0xdc, 0xc6, 0x05, 0xf9, 0x02, 0xb9, 0xb3, 0xcc, 0x00,
+    0xcf, 0x64, 0x00, 0x00, 0x26, 0x6e, 0x18, 0x00, 0x67, 0x75, 0xdc, 0x00, 0x3d, 0x08, 0x12, 0x20,
+    0x04, 0x40, 0x14, 0xa0, 0x08, 0x80, 0x39, 0x6e, 0xae, 0xca, 0x00, 0x58, 0x5b, 0xb2, 0x80, 0x42,
+    0x20, 0x0f, 0x17, 0x00, 0x4e, 0x8d, 0x37, 0x99, 0x5a, 0x80, 0x38, 0x3a, 0xcb, 0x64, 0x83, 0x34,
+    0x43, 0x2f, 0xae, 0x45, 0xec, 0x80, 0x10, 0xca, 0xa4, 0x00, 0xea, 0xd0, 0x0f, 0xe5, 0x40, 0x0e,
+    0xac, 0x10, 0xa0, 0x09, 0x98, 0x86, 0x9f, 0x99, 0x75, 0xc8, 0x0c, 0x30, 0x09, 0x30, 0x01, 0x10,
+    0x00, 0xa3, 0xc0, 0x08, 0x06, 0x08, 0xe6, 0x01, 0x44, 0x03, 0xe0, 0x03, 0x18, 0x38, 0x98, 0x04,
+    0x54, 0x10, 0x34, 0x40, 0x02, 0xab, 0x1b, 0xa2, 0x00, 0x15, 0x50, 0x6a, 0x84, 0x00, 0x2a, 0xa0,
+    0xd5, 0x08, 0x03, 0xfc, 0x00, 0x0c, 0x00, 0xfa, 0x01, 0x00, 0x2c, 0x00, 0xfa, 0x40, 0x02, 0xbc,
+    0xc2, 0x00, 0x23, 0xf3, 0x64, 0x02, 0x70, 0x1e, 0x00, 0x76, 0xb0, 0x18, 0x1c, 0x5e, 0x60, 0x81,
+    0x6d, 0x6b, 0xfc, 0x6f, 0x66, 0x07, 0x36, 0x3b, 0x52, 0x5b, 0x80, 0x33, 0x7d, 0xc4, 0x04, 0x02,
+    0xca, 0x00, 0x49, 0x01, 0x00, 0x5d, 0x37, 0x3c, 0x00, 0x00, 0xe2, 0xd0, 0x5a, 0x2c, 0x05, 0xb0,
+    0x00, 0x8e, 0xb7, 0x2d, 0x40, 0x3a, 0x3e, 0x77, 0x27, 0xec, 0x02, 0x63, 0xc6, 0xcd, 0xaa, 0x64,
+    0x80, 0x2e, 0x92, 0x77, 0x5f, 0x2e, 0x82, 0x3b, 0xfc, 0x20, 0xf0, 0x08, 0xa0, 0x1f, 0xfc, 0x01,
+    0x1b, 0xfc, 0x21, 0x12, 0x08, 0xa1, 0x74, 0x93, 0xba, 0x08, 0x74, 0x10, 0x63, 0xc6, 0xcd, 0xaa,
+    0x64, 0x80, 0x51, 0xf3, 0xba, 0x9f, 0xb0, 0x00, 0x07, 0xbb, 0x20, 0x27, 0x5d, 0x48, 0x24, 0x23,
+    0x18, 0xa5, 0x0a, 0xa8, 0x33, 0x94, 0xd4, 0x2a, 0x6e, 0x08, 0x00, 0x00, 0x34, 0x96, 0x08, 0x2e,
+    0xc7, 0x70, 0x4e, 0x6b, 0x60, 0x80, 0x40, 0x0c, 0x40, 0x02, 0xfd, 0xbd, 0x40, 0x01, 0xcc, 0x57,
+    0x88, 0x7c, 0xce, 0x7c, 0xcc, 0x20, 0x1c, 0xc0, 0x00, 0x25, 0x5d, 0x18, 0x04, 0xe7, 0x57, 0x6a,
+    0x50, 0x3e, 0x7b, 0x97, 0x9e, 0x1b, 0xd0, 0x04, 0xd0, 0x6a, 0x00, 0x4d, 0x48, 0x01, 0x5e, 0x83,
+    0xd1, 0x06, 0xa1, 0x8c, 0x50, 0x5c, 0xf0, 0x84, 0x65, 0xdd, 0x4a, 0x00, 0x0b, 0xb9, 0x80, 0x05,
+    0xba, 0x30, 0x3f, 0xba, 0xf0, 0x0f, 0x8f, 0xee, 0xde, 0x00, 0x00, 0x15, 0x80, 0x7f, 0xab, 0x7d,
+    0x37, 0x49, 0x5b, 0xe9, 0xba, 0x40, 0x0f, 0xe2, 0xb0, 0x0a, 0xb3, 0x39, 0x00, 0x0a, 0xbb, 0x12,
+    0x95, 0xfd, 0xac, 0x01, 0x08, 0x01, 0xaa, 0x01, 0xf3, 0x00, 0xd0, 0x37, 0x00, 0x08, 0xbb, 0x11,
+    0x95, 0xc4, 0x0e, 0x81, 0xcc, 0x01, 0x35, 0x43, 0x49, 0xfe, 0x2f, 0xbd, 0xb0, 0x0a, 0x42, 0x04,
+    0x00, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xfa, 0x4e, 0x01, 0x19, 0x00, 0x34, 0x02, 0x3b, 0xaa, 0x68,
+    0xb8, 0x02, 0x6a, 0x89, 0x6e, 0x01, 0xff, 0xc4, 0x00, 0x04, 0xcf, 0xde, 0x62, 0xb3, 0x08, 0x60,
+    0xa0, 0x0f, 0x08, 0x07, 0xb4, 0x03, 0xc8, 0xe0, 0x1e, 0x8e, 0xb4, 0x00, 0xc2, 0x82, 0x01, 0xff,
+    0xc4, 0x00, 0x00, 0x87, 0xc4, 0x5a, 0x20, 0x05, 0x00, 0x7b, 0x05, 0x69, 0x4e, 0x80, 0x2b, 0xb3,
+    0xf8, 0x2b, 0x00, 0x7f, 0x80, 0x05, 0xcc, 0x30, 0x1f, 0x66, 0x4b, 0x7e, 0x00, 0x9f, 0x10, 0x0e,
+    0xde, 0x00, 0x56, 0x26, 0xe6, 0x05, 0x80, 0x4b, 0x1c, 0x30, 0x02, 0x75, 0xef, 0x90, 0x01, 0x76,
+    0x7b, 0x82, 0x00, 0xee, 0x30, 0x08, 0x38, 0xa4, 0x68, 0x27, 0x44, 0xf0, 0x80, 0x3c, 0x80, 0x0d,
+    0x84, 0x00, 0x80, 0x0d, 0x12, 0x40, 0x60, 0x19, 0x09, 0x40, 0x3c, 0x31, 0x40, 0x1f, 0x5f, 0x82,
+    0xa0, 0x01, 0x25, 0x88, 0xcd, 0x18, 0x01, 0x1e, 0xc0, 0x44, 0x00, 0x37, 0x48, 0x4c, 0x08, 0x05,
+    0x12, 0x42, 0xb3, 0xea, 0x44, 0x15, 0x01, 0xca, 0x8b, 0x20, 0x02, 0x20, 0x06, 0x21, 0x06, 0x9a,
+    0x00, 0x87, 0x84, 0x1b, 0xc0, 0x35, 0x78, 0x07, 0xcd, 0x86, 0x01, 0xe2, 0xd7, 0x00, 0xcf, 0xe1,
+    0x32, 0x5c, 0xb1, 0x03, 0x77, 0x69, 0x4e, 0x44, 0x00, 0x07, 0x8c, 0x18, 0x0c, 0x20, 0x0f, 0xa0,
+    0x08, 0xfa, 0x02, 0x24, 0x40, 0x09, 0x16, 0x04, 0x2a, 0x01, 0x48, 0xd3, 0x80, 0x08, 0xa9, 0x00,
+    0xcc, 0xa0, 0x5b, 0x5c, 0xa0, 0x02, 0xd5, 0x02, 0x5a, 0xb5, 0x00, 0x75, 0x00, 0x04, 0x55, 0x47,
+    0x09, 0x90, 0x80, 0x12, 0x40, 0x25, 0x05, 0x00, 0x94, 0x2b, 0x96, 0x64, 0x0f, 0x20, 0x08, 0xa8,
+    0x9e, 0x06, 0x05, 0x00, 0xd1, 0xa4, 0x9c, 0xe0, 0x19, 0x09, 0x83, 0x8a, 0x89, 0x40, 0x1d, 0x60,
+    0x0a, 0xa9, 0xd4, 0x00, 0xb1, 0x00, 0x3b, 0x90, 0x03, 0x98, 0x40, 0x3a, 0x0c, 0x03, 0x18, 0x90,
+    0x04, 0xdf, 0xe0, 0x08, 0xaf, 0x08, 0x02, 0x75, 0x00, 0x99, 0x8e, 0xa2, 0x03, 0x6a, 0x51, 0xb9,
+    0xb0, 0x60, 0x00, 0x9c, 0x03, 0xf9, 0x80, 0x3e, 0x73, 0x00, 0xf9, 0x28, 0x80, 0x3d, 0xcf, 0x40,
+    0x1c, 0x2f, 0x0a, 0x01, 0xce, 0xa0, 0x88, 0x00, 0xd5, 0x40, 0xae, 0x00, 0x89, 0xc8, 0x0d, 0xc4,
+    0x01, 0x4d, 0x99, 0x1b, 0x80, 0x17, 0x73, 0x2f, 0xa0, 0x47, 0x00, 0xc2, 0x05, 0xdc, 0x00, 0xea,
+    0xa0, 0x00, 0xc2, 0xc0, 0x1f, 0x30, 0x07, 0xe1, 0x60, 0x0f, 0x24, 0x90, 0x07, 0xb9, 0xe8, 0x03,
+    0x85, 0xe1, 0x40, 0x39, 0xd4, 0x11, 0x00, 0x1a, 0xa8, 0x15, 0xc0, 0x11, 0x39, 0x01, 0xb8, 0x80,
+    0x29, 0xb3, 0x23, 0x70, 0x02, 0xee, 0x65, 0xf4, 0x08, 0xe0, 0x18, 0x40, 0xbb, 0x80, 0x1d, 0x54,
+    0x00, 0x00, 0x89, 0xc4, 0x03, 0x8a, 0x16, 0xc4, 0x03, 0x15, 0x15, 0x08, 0x07, 0x27, 0x90, 0x07,
+    0xb9, 0xe8, 0x03, 0x85, 0xe1, 0x40, 0x39, 0xd4, 0x11, 0x00, 0x1a, 0xa8, 0x15, 0xc0, 0x11, 0x39,
+    0x01, 0xb8, 0x80, 0x29, 0xb3, 0x23, 0x70, 0x02, 0xee, 0x65, 0xf4, 0x08, 0xe0, 0x18, 0x40, 0xbb,
+    0x80, 0x1d, 0x54, 0x00, 0x00, 0x0d, 0x2a, 0x20, 0x03, 0x2c, 0x87, 0x20, 0x06, 0x43, 0x5a, 0x00,
+    0xf2, 0x79, 0x00, 0x7b, 0x9e, 0x80, 0x38, 0x5e, 0x14, 0x03, 0x9d, 0x41, 0x10, 0x01, 0xaa, 0x81,
+    0x5c, 0x01, 0x13, 0x90, 0x1b, 0x88, 0x02, 0x9b, 0x32, 0x37, 0x00, 0x2e, 0xe6, 0x5f, 0x40, 0x8e,
+    0x01, 0x84, 0x0b, 0xb8, 0x01, 0xd5, 0x40, 0x00, 0xff, 0x9e, 0x02, 0x54, 0x03, 0x3c, 0x04, 0x28,
+    0x07, 0x27, 0x98, 0x07, 0xb9, 0xe8, 0x03, 0x85, 0xe1, 0x40, 0x39, 0xd4, 0x11, 0x00, 0x1a, 0xa8,
+    0x15, 0xc0, 0x11, 0x39, 0x01, 0xb8, 0x80, 0x29, 0xb3, 0x23, 0x70, 0x02, 0xee, 0x65, 0xf4, 0x08,
+    0xe0, 0x18, 0x40, 0xbb, 0x80, 0x1d, 0x54, 0x00, 0x00, 0x9a, 0x94, 0x03, 0xdb, 0x52, 0x01, 0xed,
+    0xa9, 0x00, 0xf1, 0x2b, 0x80, 0x7b, 0x9e, 0x80, 0x38, 0x5e, 0x14, 0x03, 0x9d, 0x41, 0x10, 0x01,
+    0xaa, 0x81, 0x5c, 0x01, 0x13, 0x90, 0x1b, 0x88, 0x02, 0x9b, 0x32, 0x37, 0x00, 0x2e, 0xe6, 0x5f,
+    0x40, 0x8e, 0x01, 0x84, 0x0b, 0xb8, 0x01, 0xd5, 0x40, 0x00, 0xc9, 0xdd, 0x66, 0x68, 0x00, 0xd1,
+    0x8d, 0x19, 0x9a, 0x00, 0x24, 0x72, 0x00, 0xff, 0x7c, 0x00, 0x7f, 0x8d, 0xcc, 0x03, 0xfd, 0x10,
+    0x00, 0xaf, 0x33, 0x20, 0x12, 0x46, 0x61, 0xaf, 0x33, 0x20, 0x45, 0x66, 0x4c, 0x01, 0xe2, 0x75,
+    0x00, 0xff, 0x5c, 0x00, 0x74, 0x66, 0x69, 0x00, 0x00, 0x15, 0x6e, 0xb1, 0x40, 0x23, 0xfe, 0xdd,
+    0x74, 0xb0, 0x03, 0xb8, 0x80, 0x02, 0xd8, 0x03, 0x13, 0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00,
+    0xff, 0x98, 0x80, 0x3c, 0x40, 0x6c, 0x60, 0x18, 0x70, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x00, 0x0f,
+    0xe7, 0xbf, 0xa5, 0x80, 0x22, 0xaa, 0x5e, 0x28, 0x07, 0xda, 0x60, 0x1f, 0x09, 0xb0, 0x04, 0x00,
+    0x00, 0x38, 0x07, 0xb4, 0xc0, 0x3a, 0xdc, 0x02, 0xec, 0xd8, 0xcc, 0x30, 0x66, 0x73, 0x00, 0x7f,
+    0xf2, 0xb3, 0x38, 0x43, 0x33, 0x84, 0x03, 0xff, 0x87, 0x99, 0xcc, 0x00, 0x00, 0x89, 0x40, 0x3a,
+    0x18, 0x03, 0xb0, 0xc0, 0x1d, 0x98, 0xac, 0xc3, 0x06, 0x67, 0x30, 0x07, 0xff, 0x2b, 0x33, 0x84,
+    0x33, 0x38, 0x40, 0x3f, 0xf8, 0x79, 0x9c, 0xc0, 0x00, 0x1b, 0x80, 0x64, 0xa4, 0xa0, 0x09, 0x24,
+    0xe8, 0x01, 0xd9, 0x9c, 0xc1, 0x99, 0xcc, 0x01, 0xff, 0xca, 0xcc, 0xe1, 0x0c, 0xce, 0x10, 0x0f,
+    0xfe, 0x1e, 0x67, 0x30, 0x00, 0xfd, 0x2a, 0x18, 0x60, 0x08, 0x50, 0xd3, 0x0e, 0xdc, 0xc6, 0xe3,
+    0x06, 0x67, 0x30, 0x07, 0xff, 0x2b, 0x33, 0x84, 0x33, 0x38, 0x40, 0x3f, 0xf8, 0x79, 0x9c, 0xc0,
+    0x61, 0x06, 0x60, 0x84, 0x00, 0x7f, 0xf1, 0x80, 0x07, 0x06, 0x00, 0x1b, 0x85, 0x80, 0x7f, 0xf4,
+    0x40, 0x01, 0x71, 0x02, 0xb5, 0xb2, 0x25, 0x15, 0x10, 0x03, 0x80, 0x3f, 0xfc, 0x60, 0x00, 0xe6,
+    0x90, 0x86, 0x64, 0x04, 0xb0, 0x0f, 0x08, 0x07, 0xff, 0x88, 0x09, 0xdc, 0xca, 0x88, 0x03, 0x46,
+    0x65, 0xde, 0x40, 0x1f, 0x24, 0x48, 0x07, 0xe5, 0x50, 0x80, 0x7e, 0x23, 0xa6, 0xac, 0x90, 0x0e,
+    0xa6, 0xac, 0x90, 0x08, 0x88, 0x01, 0xf2, 0xa8, 0x03, 0xe4, 0x89, 0x00, 0xa3, 0x32, 0xdc, 0x20,
+    0x00, 0x00, 0x34, 0x84, 0x00, 0x6e, 0x89, 0xe0, 0x0d, 0x03, 0x2c, 0x00, 0xf6, 0x00, 0xee, 0x1b,
+    0x20, 0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0, 0x3d, 0x34, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00,
+    0x3d, 0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1, 0xa0, 0x00, 0x00, 0x89, 0x40, 0x3f, 0x14, 0x88, 0x07,
+    0xef, 0x20, 0x0f, 0x15, 0x77, 0x2d, 0x00, 0x23, 0xf9, 0xdd, 0x4c, 0x28, 0x03, 0xb8, 0x60, 0x02,
+    0xd8, 0x13, 0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07, 0xf9, 0x94, 0x03, 0xdf, 0xa6,
+    0x26, 0x01, 0x85, 0x10, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc, 0x6e, 0xba, 0x14, 0x00, 0x00,
+    0xe4, 0x30, 0x0f, 0xd0, 0x40, 0x1f, 0x0c, 0x08, 0x07, 0x15, 0x64, 0xda, 0x00, 0x47, 0xf3, 0xba,
+    0x98, 0x50, 0x07, 0x70, 0xc0, 0x05, 0xb0, 0x26, 0x26, 0x01, 0x85, 0x10, 0xca, 0x01, 0xef, 0xd0,
+    0x0f, 0xf3, 0x28, 0x07, 0xbf, 0x4c, 0x4c, 0x03, 0x0a, 0x20, 0x3b, 0x86, 0x00, 0x2d, 0x81, 0x03,
+    0xf8, 0xdd, 0x74, 0x28, 0x00, 0x00, 0xc8, 0xc0, 0x1f, 0x31, 0x9a, 0x40, 0x3c, 0xce, 0xb2, 0x01,
+    0xc5, 0x5b, 0xab, 0x40, 0x08, 0xfe, 0x77, 0x53, 0x0a, 0x00, 0xee, 0x18, 0x00, 0xb6, 0x04, 0xc4,
+    0xc0, 0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x65, 0x00, 0xf7, 0xe9, 0x89, 0x80, 0x61,
+    0x44, 0x07, 0x70, 0xc0, 0x05, 0xb0, 0x20, 0x7f, 0x1b, 0xae, 0x85, 0x00, 0x00, 0x96, 0x46, 0x00,
+    0x3d, 0xb3, 0x2f, 0x00, 0xf4, 0x04, 0x38, 0x07, 0x15, 0x6e, 0xad, 0x00, 0x23, 0xf9, 0xdd, 0x4c,
+    0x28, 0x03, 0xb8, 0x60, 0x02, 0xd8, 0x13, 0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07,
+    0xf9, 0x94, 0x03, 0xdf, 0xa6, 0x26, 0x01, 0x85, 0x10, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc,
+    0x6e, 0xba, 0x14, 0x00, 0x00, 0xff, 0xe0, 0xe1, 0x87, 0x00, 0x7b, 0x4c, 0x3c, 0x03, 0xc2, 0x00,
+    0x10, 0x0e, 0x2a, 0xdd, 0x5a, 0x00, 0x47, 0xf3, 0xba, 0x98, 0x50, 0x07, 0x70, 0xc0, 0x05, 0xb0,
+    0x26, 0x26, 0x01, 0x85, 0x10, 0xca, 0x01, 0xef, 0xd0, 0x0f, 0xf3, 0x28, 0x07, 0xbf, 0x4c, 0x4c,
+    0x03, 0x0a, 0x20, 0x3b, 0x86, 0x00, 0x2d, 0x81, 0x03, 0xf8, 0xdd, 0x74, 0x28, 0x00, 0x62, 0x00,
+    0x98, 0x57, 0x88, 0x23, 0x04, 0xfb, 0x92, 0x34, 0x00, 0x26, 0x7a, 0x00, 0xab, 0x7f, 0xc6, 0x11,
+    0xae, 0x3b, 0xe3, 0x0e, 0x00, 0x1c, 0x10, 0x00, 0xff, 0xe0, 0x15, 0x6e, 0xad, 0x30, 0x40, 0xfe,
+    0x77, 0x53, 0x60, 0x21, 0xdc, 0x30, 0x02, 0xa0, 0x88, 0xc4, 0xc0, 0x09, 0x76, 0x44, 0x32, 0x80,
+    0x0a, 0x74, 0x3f, 0x40, 0x37, 0x48, 0x80, 0x4c, 0xa1, 0x54, 0x40, 0x07, 0xe9, 0x8d, 0x03, 0x00,
+    0x05, 0x10, 0x0a, 0xae, 0x00, 0x16, 0xc0, 0x82, 0x5f, 0xee, 0xba, 0x14, 0x01, 0x89, 0x7b, 0xac,
+    0x40, 0x00, 0x00, 0x90, 0xc0, 0x3e, 0x68, 0x00, 0xf8, 0xb8, 0x03, 0xb8, 0x00, 0xa0, 0x03, 0xb0,
+    0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde,
+    0x20, 0x00, 0xe6, 0x10, 0x0f, 0x16, 0x88, 0x07, 0x86, 0x40, 0x37, 0x00, 0x0c, 0x80, 0xec, 0x03,
+    0xff, 0xd0, 0xe2, 0x06, 0x20, 0x18, 0xc8, 0x2f, 0x44, 0x00, 0x95, 0x20, 0xd3, 0xbb, 0x77, 0x88,
+    0x00, 0xcc, 0x80, 0x1e, 0x92, 0xc5, 0x00, 0xe9, 0x48, 0x50, 0x0b, 0x80, 0x38, 0xec, 0x03, 0xff,
+    0xd0, 0xe2, 0x06, 0x20, 0x18, 0xc8, 0x2f, 0x44, 0x00, 0x95, 0x20, 0xd3, 0xbb, 0x77, 0x88, 0x00,
+    0xff, 0x87, 0x41, 0x2c, 0x03, 0x0e, 0x02, 0x50, 0x07, 0x08, 0x00, 0x40, 0x2e, 0x00, 0xe3, 0xb0,
+    0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde,
+    0x20, 0x00, 0xc2, 0xc0, 0x1f, 0x49, 0x80, 0x7d, 0xca, 0x01, 0x44, 0x00, 0x0c, 0x00, 0xc4, 0x85,
+    0x30, 0x09, 0xd9, 0x03, 0xb8, 0x00, 0x2a, 0xb0, 0x01, 0xac, 0x07, 0x48, 0x80, 0x50, 0x92, 0xc8,
+    0x01, 0xde, 0xd6, 0x01, 0xe2, 0x20, 0x80, 0x7f, 0xf4, 0x80, 0x0e, 0x00, 0xff, 0xe1, 0x8e, 0x65,
+    0x22, 0x00, 0x1c, 0xcd, 0xa0, 0x1e, 0x57, 0x20, 0x0f, 0xfe, 0x0a, 0xb9, 0x00, 0xe6, 0x6d, 0x00,
+    0x0e, 0x65, 0x22, 0x01, 0xfc, 0x00, 0x1a, 0xcd, 0x70, 0x05, 0xfe, 0x6e, 0x28, 0x22, 0x80, 0x3f,
+    0x00, 0x38, 0x44, 0x01, 0x87, 0xa4, 0x02, 0x8e, 0x31, 0x00, 0xa3, 0xf7, 0x00, 0x39, 0x40, 0x80,
+    0x31, 0x09, 0x00, 0x27, 0x3b, 0x80, 0x00, 0x00, 0x61, 0x80, 0x77, 0xd0, 0x07, 0x1c, 0x00, 0x64,
+    0xcd, 0xc5, 0x02, 0x9c, 0xc6, 0xc0, 0x96, 0x00, 0x42, 0x40, 0xd7, 0x52, 0x00, 0x5d, 0xba, 0x87,
+    0x00, 0x18, 0x00, 0xd4, 0x14, 0x33, 0x14, 0x80, 0x00, 0x00, 0x8e, 0xc0, 0x3a, 0xa0, 0x03, 0xa0,
+    0xc0, 0x24, 0xcd, 0xc5, 0x02, 0x9c, 0xc6, 0xc0, 0x96, 0x00, 0x42, 0x40, 0xd7, 0x52, 0x00, 0x5d,
+    0xba, 0x87, 0x00, 0x18, 0x00, 0xd4, 0x14, 0x33, 0x14, 0x80, 0x00, 0x00, 0x2e, 0xa8, 0x04, 0x7f,
+    0xbe, 0x40, 0x03, 0xa0, 0xa2, 0x00, 0x26, 0x64, 0xa0, 0x53, 0x98, 0xd8, 0x12, 0xc0, 0x08, 0x48,
+    0x1a, 0xea, 0x40, 0x0b, 0xb7, 0x50, 0xe0, 0x03, 0x00, 0x1a, 0x82, 0x86, 0x62, 0x90, 0x00, 0x01,
+    0xb6, 0x45, 0x00, 0x24, 0x17, 0x20, 0x01, 0x4d, 0x28, 0x40, 0x09, 0x99, 0x28, 0x14, 0xe6, 0x36,
+    0x04, 0xb0, 0x02, 0x12, 0x06, 0xba, 0x90, 0x02, 0xed, 0xd4, 0x38, 0x00, 0xc0, 0x06, 0xa0, 0xa1,
+    0x98, 0xa4, 0x00, 0x06, 0x90, 0x96, 0x00, 0x34, 0x04, 0x30, 0x04, 0x20, 0x20, 0x12, 0x66, 0x4a,
+    0x05, 0x39, 0x8d, 0x81, 0x2c, 0x00, 0x84, 0x81, 0xae, 0xa4, 0x00, 0xbb, 0x75, 0x0e, 0x00, 0x30,
+    0x01, 0xa8, 0x28, 0x66, 0x29, 0x00, 0x00, 0x35, 0x30, 0x06, 0xaa, 0x80, 0x35, 0x54, 0x01, 0x9a,
+    0x98, 0x02, 0x4c, 0xc9, 0x40, 0xa7, 0x31, 0xb0, 0x25, 0x80, 0x10, 0x90, 0x35, 0xd4, 0x80, 0x17,
+    0x6e, 0xa1, 0xc0, 0x06, 0x00, 0x35, 0x05, 0x0c, 0xc5, 0x20, 0x00, 0x05, 0xcc, 0x8d, 0x33, 0x24,
+    0x02, 0x8d, 0xcd, 0xe8, 0xdc, 0xd8, 0x23, 0xf1, 0x01, 0x68, 0x10, 0x18, 0xb1, 0x7a, 0xbb, 0x2c,
+    0x5d, 0xde, 0x09, 0xd5, 0x76, 0x58, 0xbb, 0xd2, 0x24, 0x00, 0x27, 0xf0, 0x0a, 0x95, 0x41, 0x76,
+    0x9d, 0xec, 0xbb, 0x62, 0x80, 0x02, 0xbc, 0xc3, 0x80, 0x3e, 0x33, 0x1c, 0xca, 0xa3, 0x00, 0x42,
+    0x97, 0x00, 0x42, 0x65, 0xc0, 0x10, 0x9a, 0xa8, 0xc0, 0x10, 0x81, 0xf1, 0xfb, 0xce, 0x05, 0x6d,
+    0xae, 0x01, 0x86, 0x04, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x74, 0xd0, 0x07, 0x0e, 0x80,
+    0x62, 0xbd, 0xc6, 0x00, 0x7c, 0xe6, 0x4a, 0xb1, 0x00, 0x2e, 0x49, 0x6e, 0xea, 0x01, 0xab, 0xbd,
+    0x8f, 0x44, 0x00, 0x79, 0x1f, 0x9c, 0xc7, 0xc8, 0x00, 0xda, 0x01, 0xcd, 0x60, 0x1c, 0xec, 0x01,
+    0x15, 0xee, 0x30, 0x03, 0xe7, 0x32, 0x55, 0x88, 0x01, 0x72, 0x4b, 0x77, 0x50, 0x0d, 0x5d, 0xec,
+    0x7a, 0x20, 0x03, 0xc8, 0xfc, 0xe6, 0x3e, 0x40, 0x00, 0x1e, 0x40, 0x04, 0x31, 0xa0, 0xa0, 0x01,
+    0xb1, 0x85, 0x00, 0x15, 0xe6, 0x18, 0x01, 0xf3, 0x99, 0x2a, 0xc4, 0x00, 0xb9, 0x25, 0xbb, 0xa8,
+    0x06, 0xae, 0xf6, 0x3d, 0x10, 0x01, 0xe4, 0x7e, 0x73, 0x1f, 0x20, 0x03, 0xc0, 0x59, 0x00, 0x1e,
+    0x82, 0xc0, 0x04, 0x20, 0x01, 0x00, 0x15, 0xe6, 0x18, 0x01, 0xf3, 0x99, 0x2a, 0xc4, 0x00, 0xb9,
+    0x25, 0xbb, 0xa8, 0x06, 0xae, 0xf6, 0x3d, 0x10, 0x01, 0xe4, 0x7e, 0x73, 0x1f, 0x20, 0x0d, 0x10,
+    0x86, 0x05, 0x70, 0x2c, 0x00, 0xff, 0xe3, 0x00, 0x06, 0x80, 0xd8, 0x0b, 0x02, 0xc0, 0x0f, 0xfe,
+    0x38, 0x08, 0xc3, 0x05, 0xfc, 0x91, 0x57, 0x0a, 0x10, 0x2c, 0x00, 0xff, 0xea, 0x00, 0x96, 0x0b,
+    0x38, 0x60, 0xa3, 0x10, 0x00, 0x80, 0x0b, 0x00, 0x3f, 0xfa, 0x80, 0x00, 0x18, 0x07, 0xcd, 0x6d,
+    0x44, 0x01, 0x18, 0xd4, 0x90, 0x04, 0x95, 0xbe, 0x01, 0x14, 0xdd, 0x95, 0xc0, 0x1f, 0x37, 0x5d,
+    0x40, 0xaa, 0x20, 0x03, 0x98, 0x17, 0x00, 0x62, 0x12, 0xe0, 0x0c, 0x22, 0x55, 0x18, 0x02, 0x54,
+    0x01, 0xf1, 0x98, 0x18, 0x00, 0x00, 0x54, 0x05, 0x00, 0x07, 0x66, 0xa4, 0x00, 0x2e, 0x34, 0x60,
+    0x59, 0x15, 0x70, 0x00, 0x3a, 0xa5, 0x83, 0x01, 0x90, 0x02, 0xf0, 0x03, 0xff, 0xa0, 0x00, 0x00,
+    0x3b, 0x80, 0x3c, 0xf6, 0x01, 0xf6, 0x80, 0x71, 0x5e, 0xe3, 0x80, 0x5f, 0x19, 0x8e, 0x70, 0x55,
+    0x18, 0x02, 0x64, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c,
+    0x66, 0x39, 0xc0, 0x00, 0xda, 0x20, 0x1c, 0xb4, 0x20, 0x1c, 0x8e, 0x01, 0x8a, 0xf7, 0x1c, 0x02,
+    0xf8, 0xcc, 0x73, 0x82, 0xa8, 0xc0, 0x13, 0x20, 0x2e, 0x00, 0xc6, 0x05, 0xc0, 0x18, 0xc1, 0x54,
+    0x60, 0x09, 0x90, 0x03, 0xe3, 0x31, 0xce, 0x00, 0x00, 0x16, 0x48, 0x07, 0x4e, 0xf3, 0x00, 0x6b,
+    0x17, 0x60, 0x08, 0xaf, 0x30, 0xe0, 0x17, 0xc6, 0x63, 0x9c, 0x15, 0x46, 0x00, 0x99, 0x01, 0x70,
+    0x06, 0x30, 0x2e, 0x00, 0xc6, 0x0a, 0xa3, 0x00, 0x4c, 0x80, 0x1f, 0x19, 0x8e, 0x70, 0x00, 0x00,
+    0x5c, 0x84, 0x80, 0x43, 0x91, 0x54, 0x00, 0x85, 0xc6, 0x8c, 0x02, 0x2b, 0xcc, 0x38, 0x05, 0xf1,
+    0x98, 0xe7, 0x05, 0x51, 0x80, 0x26, 0x40, 0x5c, 0x01, 0x8c, 0x0b, 0x80, 0x31, 0x82, 0xa8, 0xc0,
+    0x13, 0x20, 0x07, 0xc6, 0x63, 0x9c, 0x00, 0x02, 0xd0, 0x5a, 0x00, 0x8b, 0x01, 0x6c, 0x03, 0x08,
+    0x00, 0x40, 0x22, 0xbc, 0xc3, 0x80, 0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18, 0x02, 0x64, 0x05, 0xc0,
+    0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66, 0x39, 0xc0, 0x00, 0x26,
+    0x00, 0x72, 0x78, 0x07, 0x8c, 0x02, 0xad, 0xde, 0x4a, 0xdd, 0xe4, 0x00, 0x26, 0x80, 0x72, 0x78,
+    0x04, 0x00, 0x00, 0xfe, 0x2b, 0xcc, 0x4d, 0x80, 0x3e, 0x33, 0x58, 0x41, 0x54, 0x61, 0x56, 0x80,
+    0x5c, 0x15, 0xc8, 0x60, 0x5d, 0x18, 0xa0, 0x60, 0xae, 0x6c, 0x13, 0x20, 0x43, 0x0c, 0xc7, 0x38,
+    0x26, 0x5e, 0x61, 0xc0, 0x00, 0x00, 0x3b, 0x80, 0x39, 0xec, 0x03, 0xd8, 0x01, 0x16, 0x00, 0x47,
+    0x40, 0x1f, 0xfc, 0x93, 0x00, 0xce, 0x02, 0x23, 0x00, 0x70, 0x03, 0xbf, 0x2f, 0x00, 0x00, 0xda,
+    0x20, 0x19, 0xac, 0x40, 0x33, 0x30, 0x00, 0x58, 0x01, 0x1d, 0x00, 0x7f, 0xf2, 0x4c, 0x03, 0x38,
+    0x08, 0x8c, 0x01, 0xc0, 0x0e, 0xfc, 0xbc, 0x00, 0x00, 0x16, 0x48, 0x06, 0x8d, 0xf6, 0x00, 0xa8,
+    0x59, 0x80, 0x58, 0x01, 0x1d, 0x00, 0x7f, 0xf2, 0x4c, 0x03, 0x38, 0x08, 0x8c, 0x01, 0xc0, 0x0e,
+    0xfc, 0xbc, 0x00, 0x02, 0xd0, 0x5a, 0x00, 0x16, 0x02, 0xd8, 0x04, 0x20, 0x01, 0x02, 0xc0, 0x08,
+    0xe8, 0x03, 0xff, 0x92, 0x60, 0x19, 0xc0, 0x44, 0x60, 0x0e, 0x00, 0x77, 0xe5, 0xe0, 0x00, 0x00,
+    0x8a, 0xc0, 0x3a, 0xe0, 0x03, 0xa4, 0xc0, 0x12, 0xa0, 0x12, 0x55, 0xc8, 0x05, 0xd2, 0x40, 0x40,
+    0x2e, 0x61, 0x54, 0x06, 0xa0, 0x03, 0x28, 0x5b, 0x00, 0x49, 0x0c, 0x20, 0x15, 0xbc, 0x80, 0x63,
+    0x23, 0x00, 0xcd, 0x60, 0x10, 0xe6, 0xb0, 0x04, 0x00, 0x2c, 0x00, 0xff, 0xe6, 0x36, 0x62, 0xc4,
+    0x00, 0x63, 0x98, 0xfd, 0x00, 0x13, 0x80, 0x11, 0xcc, 0x18, 0x03, 0x13, 0x03, 0x00, 0x62, 0x60,
+    0x27, 0x00, 0x23, 0x98, 0x18, 0xe6, 0x3f, 0x40, 0x26, 0xcc, 0x58, 0x80, 0x7f, 0xf1, 0x40, 0x06,
+    0x90, 0x86, 0x00, 0x34, 0x04, 0xb0, 0x04, 0x20, 0x20, 0x09, 0x50, 0x09, 0x2a, 0xe4, 0x02, 0xe9,
+    0x20, 0x20, 0x17, 0x30, 0xaa, 0x03, 0x50, 0x01, 0x94, 0x2d, 0x80, 0x24, 0x86, 0x10, 0x0a, 0xde,
+    0x40, 0x31, 0x91, 0x80, 0x66, 0xb0, 0x08, 0x73, 0x58, 0x02, 0x00, 0x00, 0x1d, 0xdc, 0x40, 0x18,
+    0xee, 0xe2, 0x00, 0xe4, 0xf2, 0x00, 0xf7, 0x3d, 0x00, 0x70, 0xbc, 0x28, 0x07, 0x3a, 0x82, 0x20,
+    0x03, 0x55, 0x02, 0xb8, 0x02, 0x27, 0x20, 0x37, 0x10, 0x05, 0x36, 0x64, 0x6e, 0x00, 0x5d, 0xcc,
+    0xbe, 0x81, 0x1c, 0x03, 0x08, 0x17, 0x70, 0x03, 0xaa, 0x80, 0x03, 0xbb, 0x8c, 0x00, 0x77, 0x71,
+    0x80, 0x13, 0x32, 0x50, 0x29, 0xcc, 0x6c, 0x09, 0x60, 0x04, 0x24, 0x0d, 0x75, 0x20, 0x05, 0xdb,
+    0xa8, 0x70, 0x01, 0x80, 0x0d, 0x41, 0x43, 0x31, 0x48, 0x00, 0x00, 0x11, 0x00, 0xc8, 0x03, 0x15,
+    0xd5, 0x90, 0x07, 0x4d, 0x40, 0x07, 0x93, 0xc8, 0x03, 0xdc, 0xf4, 0x01, 0xc2, 0xf0, 0xa0, 0x1c,
+    0xea, 0x08, 0x80, 0x0d, 0x54, 0x0a, 0xe0, 0x08, 0x9c, 0x80, 0xdc, 0x40, 0x14, 0xd9, 0x91, 0xb8,
+    0x01, 0x77, 0x32, 0xfa, 0x04, 0x70, 0x0c, 0x20, 0x5d, 0xc0, 0x0e, 0xaa, 0x00, 0x04, 0x70, 0x74,
+    0x00, 0x20, 0x48, 0x20, 0x04, 0xf2, 0xe0, 0x12, 0x66, 0x4a, 0x05, 0x39, 0x8d, 0x81, 0x2c, 0x00,
+    0x84, 0x81, 0xae, 0xa4, 0x00, 0xbb, 0x75, 0x0e, 0x00, 0x30, 0x01, 0xa8, 0x28, 0x66, 0x29, 0x00,
+    0x00, 0x93, 0xc8, 0x03, 0xdc, 0xb4, 0x01, 0xc2, 0x90, 0xc0, 0x1c, 0xe8, 0x44, 0x40, 0x0d, 0x5e,
+    0x17, 0xc0, 0x11, 0x1a, 0x02, 0xa8, 0x40, 0x14, 0x82, 0x04, 0x47, 0x00, 0x33, 0x33, 0x23, 0xa0,
+    0x43, 0xdc, 0xcb, 0xcc, 0xba, 0x00, 0x30, 0xbd, 0xd2, 0x80, 0x71, 0x68, 0x07, 0x8c, 0x50, 0x03,
+    0xc4, 0xd0, 0x00, 0x04, 0xcc, 0x94, 0x0a, 0x73, 0x1b, 0x02, 0x58, 0x01, 0x09, 0x03, 0x5d, 0x48,
+    0x01, 0x76, 0xea, 0x1c, 0x00, 0x60, 0x03, 0x50, 0x50, 0xcc, 0x51, 0x38, 0x4e, 0x63, 0x59, 0x00,
+    0x37, 0xc8, 0x07, 0x6f, 0x10, 0x00, 0xe4, 0x30, 0x0f, 0xd0, 0x40, 0x1f, 0x0c, 0x08, 0x07, 0x15,
+    0x64, 0xe2, 0x80, 0x47, 0xfd, 0xba, 0xe9, 0x60, 0x07, 0x71, 0x00, 0x05, 0xb0, 0x06, 0x26, 0x01,
+    0x87, 0x01, 0x94, 0x03, 0xc4, 0x01, 0xff, 0x31, 0x00, 0x78, 0x80, 0xd8, 0xc0, 0x30, 0xe0, 0x03,
+    0xb8, 0x60, 0x02, 0xd8, 0x00, 0x1f, 0xce, 0xeb, 0xa5, 0x80, 0x00, 0xda, 0x20, 0x19, 0x68, 0x40,
+    0x32, 0x38, 0x04, 0x57, 0xb8, 0xe0, 0x0f, 0x8c, 0xc7, 0x32, 0xa8, 0xc0, 0x10, 0xa5, 0xc0, 0x10,
+    0x99, 0x70, 0x04, 0x26, 0xaa, 0x30, 0x04, 0x20, 0x7c, 0x66, 0x39, 0xc0, 0x00, 0xca, 0xa0, 0x0f,
+    0x9c, 0xc2, 0x00, 0x3c, 0xec, 0xb0, 0x01, 0xc5, 0x5b, 0xac, 0x50, 0x08, 0xff, 0xb7, 0x5d, 0x2c,
+    0x00, 0xee, 0x20, 0x00, 0xb6, 0x00, 0xc4, 0xc0, 0x30, 0xe0, 0x32, 0x80, 0x78, 0x80, 0x3f, 0xe6,
+    0x20, 0x0f, 0x10, 0x1b, 0x18, 0x06, 0x1c, 0x00, 0x77, 0x0c, 0x00, 0x5b, 0x00, 0x03, 0xf9, 0xdd,
+    0x74, 0xb0, 0x00, 0x00, 0x16, 0x48, 0x06, 0x9d, 0xe6, 0x00, 0xac, 0x5d, 0x80, 0x05, 0x79, 0x87,
+    0x00, 0x7c, 0x66, 0x39, 0x95, 0x46, 0x00, 0x85, 0x2e, 0x00, 0x84, 0xcb, 0x80, 0x21, 0x35, 0x51,
+    0x80, 0x21, 0x03, 0xe3, 0x31, 0xce, 0x00, 0x00, 0xff, 0xe1, 0x34, 0x00, 0x7e, 0x68, 0x00, 0xff,
+    0xe2, 0x15, 0x6e, 0xb1, 0x40, 0x23, 0xfe, 0xdd, 0x74, 0xb0, 0x03, 0xb8, 0x80, 0x02, 0xd8, 0x03,
+    0x13, 0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00, 0xff, 0x98, 0x80, 0x3c, 0x40, 0x6c, 0x60, 0x18,
+    0x70, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x00, 0x0f, 0xe7, 0x75, 0xd2, 0xc0, 0x00, 0x00, 0xad, 0x00,
+    0x3a, 0x90, 0x03, 0x84, 0x03, 0x15, 0xe6, 0x1c, 0x01, 0xf1, 0x98, 0xe6, 0x55, 0x18, 0x02, 0x14,
+    0xb8, 0x02, 0x13, 0x2e, 0x00, 0x84, 0xd5, 0x46, 0x00, 0x84, 0x0f, 0x8c, 0xc7, 0x38, 0x00, 0x94,
+    0x41, 0x80, 0x3c, 0x97, 0x48, 0x01, 0xe1, 0xaa, 0x10, 0x07, 0x15, 0x6e, 0xb1, 0x40, 0x23, 0xfe,
+    0xdd, 0x74, 0xb0, 0x03, 0xb8, 0x80, 0x02, 0xd8, 0x03, 0x13, 0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2,
+    0x00, 0xff, 0x98, 0x80, 0x3c, 0x40, 0x6c, 0x60, 0x18, 0x70, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x00,
+    0x0f, 0xe7, 0x75, 0xd2, 0xc0, 0x00, 0x00, 0x58, 0xc3, 0x00, 0x53, 0xa0, 0xc0, 0x11, 0x64, 0x00,
+    0x45, 0x79, 0x87, 0x00, 0x7c, 0x66, 0x39, 0x95, 0x46, 0x00, 0x85, 0x2e, 0x00, 0x84, 0xcb, 0x80,
+    0x21, 0x35, 0x51, 0x80, 0x21, 0x03, 0xe3, 0x31, 0xce, 0x00, 0x06, 0x01, 0x50, 0x0c, 0x95, 0x68,
+    0x01, 0x8a, 0xa8, 0x20, 0x17, 0x66, 0x67, 0x00, 0xb3, 0x37, 0xd8, 0x07, 0xa0, 0x14, 0x03, 0xdf,
+    0xc0, 0x1e, 0x56, 0x00, 0xf1, 0x80, 0x7c, 0xce, 0x01, 0xef, 0xf0, 0x07, 0x40, 0x28, 0x66, 0x6f,
+    0xb0, 0x00, 0x00, 0xf8, 0x54, 0x03, 0xdc, 0x7e, 0x01, 0xf8, 0x80, 0x3e, 0x28, 0x03, 0xcc, 0x5a,
+    0x00, 0x43, 0xdc, 0xcb, 0xd0, 0x09, 0xd4, 0x80, 0x12, 0x20, 0x01, 0xe0, 0x0c, 0x40, 0x01, 0xe0,
+    0x0c, 0x40, 0x07, 0x52, 0x00, 0x48, 0x80, 0x07, 0xb9, 0x98, 0xd0, 0x08, 0x09, 0xdc, 0xca, 0x88,
+    0x03, 0x46, 0x65, 0xde, 0x40, 0x1f, 0x24, 0x48, 0x07, 0xe5, 0x50, 0x80, 0x7e, 0x23, 0xa6, 0xac,
+    0x90, 0x0e, 0xa6, 0xac, 0x90, 0x08, 0x88, 0x01, 0xf2, 0xa8, 0x03, 0xe4, 0x89, 0x00, 0xa3, 0x32,
+    0xdc, 0x20, 0x00, 0x00, 0xf7, 0x00, 0x7a, 0xec, 0x36, 0x20, 0x1a, 0xec, 0x36, 0x20, 0x79, 0x8b,
+    0x40, 0x08, 0x7b, 0x99, 0x7a, 0x01, 0x3a, 0x90, 0x02, 0x44, 0x00, 0x3c, 0x01, 0x88, 0x00, 0x3c,
+    0x01, 0x88, 0x00, 0xea, 0x40, 0x09, 0x10, 0x00, 0xf7, 0x33, 0x1a, 0x01, 0x00, 0x05, 0xbb, 0x80,
+    0x25, 0xbb, 0x80, 0x1d, 0x99, 0xcc, 0x19, 0x9c, 0xc0, 0x1f, 0xfc, 0xac, 0xce, 0x10, 0xcc, 0xe1,
+    0x00, 0xff, 0xe1, 0xe6, 0x73, 0x00, 0x00, 0x5d, 0xca, 0x01, 0x5d, 0xca, 0x00, 0x2b, 0xcc, 0x30,
+    0x03, 0xe7, 0x32, 0x55, 0x88, 0x01, 0x72, 0x4b, 0x77, 0x50, 0x0d, 0x5d, 0xec, 0x7a, 0x20, 0x03,
+    0xc8, 0xfc, 0xe6, 0x3e, 0x40, 0x04, 0x10, 0x40, 0x09, 0x62, 0x8c, 0x02, 0x19, 0xa7, 0x00, 0x76,
+    0x67, 0x30, 0x66, 0x73, 0x00, 0x7f, 0xf2, 0xb3, 0x38, 0x43, 0x33, 0x84, 0x03, 0xff, 0x87, 0x99,
+    0xcc, 0x00, 0x01, 0xa0, 0x47, 0x00, 0x0f, 0xce, 0x38, 0x04, 0xb3, 0x00, 0x11, 0x5e, 0x61, 0x80,
+    0x1f, 0x39, 0x92, 0xac, 0x40, 0x0b, 0x92, 0x5b, 0xba, 0x80, 0x6a, 0xef, 0x63, 0xd1, 0x00, 0x1e,
+    0x47, 0xe7, 0x31, 0xf2, 0x00, 0x00, 0xfe, 0x3c, 0x00, 0xe3, 0xd0, 0x0b, 0xb3, 0x1b, 0x98, 0x60,
+    0xcc, 0xe6, 0x00, 0xff, 0xe5, 0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x98, 0x00,
+    0xb0, 0xc0, 0x3b, 0x4c, 0x03, 0x84, 0x03, 0x15, 0xe6, 0x18, 0x01, 0xf3, 0x99, 0x2a, 0xc4, 0x00,
+    0xb9, 0x25, 0xbb, 0xa8, 0x06, 0xae, 0xf6, 0x3d, 0x10, 0x01, 0xe4, 0x7e, 0x73, 0x1f, 0x20, 0xec,
+    0xce, 0x60, 0xcc, 0xe6, 0x00, 0xff, 0xe5, 0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33,
+    0x6c, 0x76, 0x66, 0x6a, 0x00, 0xcc, 0x64, 0x01, 0x95, 0x60, 0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73,
+    0x25, 0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00, 0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3f, 0x0f, 0xce,
+    0x62, 0x30, 0x0a, 0xf2, 0xe4, 0x80, 0x35, 0x30, 0x07, 0x3e, 0x10, 0x03, 0x30, 0x30, 0x04, 0x75,
+    0x42, 0x00, 0xd3, 0x48, 0x00, 0xec, 0xce, 0x60, 0xcc, 0xe6, 0x00, 0xff, 0xe5, 0x66, 0x70, 0x86,
+    0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x98, 0x01, 0xb1, 0x95, 0x00, 0x0c, 0xef, 0x28, 0x04, 0x58,
+    0xe0, 0x11, 0x5e, 0x61, 0x80, 0x1f, 0x39, 0x92, 0xac, 0x40, 0x0b, 0x92, 0x5b, 0xba, 0x80, 0x6a,
+    0xef, 0x63, 0xd1, 0x00, 0x1e, 0x47, 0xe7, 0x31, 0xf2, 0x00, 0x00, 0xca, 0xa0, 0x0f, 0x9c, 0xc2,
+    0x00, 0x3c, 0xec, 0xb0, 0x01, 0xc5, 0x5b, 0xac, 0x40, 0x08, 0xff, 0xb7, 0x5d, 0x2a, 0x00, 0xee,
+    0x20, 0x00, 0xb2, 0xc0, 0xc4, 0xc0, 0x30, 0xe0, 0x32, 0x80, 0x78, 0x80, 0x3c, 0xf9, 0x8d, 0x46,
+    0x50, 0x09, 0xf3, 0x0c, 0xe6, 0x26, 0x01, 0x85, 0x4c, 0x3b, 0x88, 0x00, 0x2d, 0x80, 0x01, 0xff,
+    0x6e, 0xba, 0x18, 0x00, 0x00, 0x16, 0x48, 0x04, 0x33, 0xbc, 0xa0, 0x01, 0xb1, 0x75, 0x00, 0x1e,
+    0x62, 0xd3, 0x87, 0xb9, 0x97, 0xa0, 0xea, 0x40, 0x09, 0x11, 0x70, 0x06, 0x21, 0xe0, 0x0c, 0x4e,
+    0xa4, 0x00, 0x91, 0x17, 0x73, 0x31, 0xa0, 0x16, 0x64, 0x80, 0x0e, 0x20, 0x03, 0xb8, 0x3e, 0x73,
+    0x1d, 0x20, 0x00, 0x94, 0x00, 0xa0, 0x1e, 0x6a, 0xa0, 0x80, 0x78, 0xea, 0x88, 0x01, 0xc5, 0x5b,
+    0xac, 0x40, 0x08, 0xff, 0xb7, 0x5d, 0x2a, 0x00, 0xee, 0x20, 0x00, 0xb2, 0xc0, 0xc4, 0xc0, 0x30,
+    0xe0, 0x32, 0x80, 0x78, 0x80, 0x3c, 0xf9, 0x8d, 0x46, 0x50, 0x09, 0xf3, 0x0c, 0xe6, 0x26, 0x01,
+    0x85, 0x4c, 0x3b, 0x88, 0x00, 0x2d, 0x80, 0x01, 0xff, 0x6e, 0xba, 0x18, 0x00, 0x00, 0x50, 0x1b,
+    0x80, 0x5d, 0x36, 0xe0, 0x12, 0x4c, 0x00, 0x47, 0x98, 0xb4, 0xe1, 0xee, 0x65, 0xe8, 0x3a, 0x90,
+    0x02, 0x44, 0x5c, 0x01, 0x88, 0x78, 0x03, 0x13, 0xa9, 0x00, 0x24, 0x45, 0xdc, 0xcc, 0x68, 0x05,
+    0x99, 0x20, 0x03, 0x88, 0x00, 0xee, 0x0f, 0x9c, 0xc7, 0x48, 0x00, 0xff, 0xe1, 0x3c, 0x00, 0x7e,
+    0x78, 0x00, 0xff, 0xe2, 0x15, 0x6e, 0xb1, 0x00, 0x23, 0xfe, 0xdd, 0x74, 0xa8, 0x03, 0xb8, 0x80,
+    0x02, 0xcb, 0x03, 0x13, 0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00, 0xf3, 0xe6, 0x35, 0x19, 0x40,
+    0x27, 0xcc, 0x33, 0x98, 0x98, 0x06, 0x15, 0x30, 0xee, 0x20, 0x00, 0xb6, 0x00, 0x07, 0xfd, 0xba,
+    0xe8, 0x60, 0x00, 0x00, 0xac, 0xc0, 0x3a, 0x8c, 0x03, 0x84, 0x03, 0x1e, 0x62, 0xd3, 0x87, 0xb9,
+    0x97, 0xa0, 0xea, 0x40, 0x09, 0x11, 0x70, 0x06, 0x21, 0xe0, 0x0c, 0x4e, 0xa4, 0x00, 0x91, 0x17,
+    0x73, 0x31, 0xa0, 0x16, 0x64, 0x80, 0x0e, 0x20, 0x03, 0xb8, 0x3e, 0x73, 0x1d, 0x20, 0x00, 0x15,
+    0x6e, 0xb1, 0x00, 0x23, 0xfe, 0xdd, 0x74, 0xa8, 0x03, 0xb8, 0x80, 0x02, 0xcb, 0x03, 0x13, 0x00,
+    0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00, 0xf3, 0xe6, 0x35, 0x19, 0x40, 0x27, 0xcc, 0x33, 0x98, 0x98,
+    0x06, 0x15, 0x30, 0xee, 0x20, 0x00, 0xb6, 0x00, 0x07, 0xfd, 0xba, 0xe8, 0x60, 0x08, 0xab, 0xbf,
+    0x10, 0x03, 0xd2, 0x01, 0xfc, 0x24, 0x01, 0x80, 0x00, 0xff, 0x24, 0x00, 0x76, 0xd8, 0x07, 0x61,
+    0x00, 0x47, 0x93, 0x49, 0xc3, 0xdc, 0xcb, 0xd0, 0x75, 0x20, 0x04, 0x88, 0xb8, 0x03, 0x10, 0xf0,
+    0x06, 0x27, 0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98, 0xd0, 0x0b, 0x32, 0x40, 0x07, 0x10, 0x01, 0xdc,
+    0x1f, 0x39, 0x8e, 0x90, 0x00, 0x99, 0x00, 0x3a, 0x4b, 0x18, 0x03, 0x4a, 0x43, 0x00, 0x38, 0x03,
+    0x8e, 0xc0, 0x3f, 0xfa, 0xb9, 0x9d, 0xc0, 0x0c, 0xce, 0xe0, 0x0f, 0xfe, 0x68, 0x03, 0x70, 0x0e,
+    0x4a, 0x4a, 0x10, 0x09, 0x24, 0xe8, 0x40, 0x31, 0x60, 0x07, 0xff, 0x32, 0x33, 0x60, 0x02, 0x3c,
+    0xc6, 0x93, 0x00, 0x0d, 0x00, 0x1d, 0x80, 0x1e, 0x70, 0x0f, 0xfe, 0x68, 0x0d, 0x10, 0x0c, 0x5a,
+    0x01, 0xff, 0x39, 0x6e, 0x66, 0xe2, 0x77, 0x16, 0xe6, 0x6e, 0x27, 0x00, 0xff, 0xe0, 0x6e, 0x66,
+    0xe0, 0x0d, 0xb9, 0x9b, 0x80, 0x3f, 0xfa, 0x80, 0x02, 0xc0, 0x0e, 0x3f, 0x3b, 0x90, 0x08, 0xfc,
+    0xee, 0x40, 0x3d, 0x19, 0xb0, 0x01, 0x1e, 0x63, 0x49, 0x80, 0x06, 0x80, 0x0e, 0xc0, 0x0f, 0x38,
+    0x07, 0xff, 0x34, 0x1a, 0x53, 0x55, 0x70, 0x4a, 0x24, 0xb4, 0x20, 0x0e, 0x00, 0xff, 0xf1, 0x80,
+    0x4b, 0x47, 0x23, 0xa2, 0xe2, 0x71, 0x69, 0x00, 0x16, 0x00, 0x7f, 0xf5, 0x00, 0x3b, 0xb8, 0xcd,
+    0x77, 0x18, 0x03, 0x80, 0x3f, 0xfc, 0x60, 0x5b, 0xb8, 0x56, 0xee, 0x10, 0x2c, 0x00, 0xff, 0xea,
+    0x00, 0x23, 0x03, 0x22, 0x5d, 0x59, 0x04, 0x54, 0x00, 0x5c, 0x01, 0xff, 0xe3, 0x00, 0x74, 0x0a,
+    0x17, 0xc9, 0xf1, 0x08, 0x95, 0x00, 0x16, 0x00, 0x7f, 0xf5, 0x00, 0x0e, 0x00, 0xff, 0xe2, 0x8b,
+    0xba, 0x61, 0x30, 0x02, 0xc0, 0x2d, 0x00, 0x08, 0x16, 0x00, 0x7f, 0xf1, 0x48, 0x22, 0x88, 0x50,
+    0x9a, 0x00, 0x00, 0xdc, 0x00, 0xf0, 0x07, 0x80, 0x7f, 0xf4, 0x00, 0x2c, 0x00, 0xff, 0xe0, 0x00,
+    0xe0, 0x0f, 0x43, 0x80, 0x7f, 0xf8, 0xc4, 0x80, 0x3e, 0x5b, 0x00, 0xc4, 0x00, 0x54, 0x00, 0x91,
+    0xc0, 0x03, 0x37, 0x57, 0x04, 0x00, 0x2c, 0x08, 0x72, 0xd0, 0x87, 0x01, 0x00, 0x8b, 0x01, 0xd8,
+    0x03, 0xff, 0xa4, 0x58, 0x01, 0xef, 0x30, 0x04, 0x9a, 0x80, 0x00, 0xe6, 0x40, 0x0e, 0x83, 0x33,
+    0x80, 0x68, 0x57, 0x70, 0x07, 0x43, 0x00, 0x7f, 0xf7, 0x48, 0x80, 0x1e, 0x7b, 0x00, 0x84, 0xc1,
+    0x10, 0x20, 0x28, 0x80, 0x19, 0xdc, 0xd9, 0x10, 0x00, 0x08, 0xc3, 0x04, 0xfc, 0x91, 0x47, 0x0a,
+    0x10, 0x1c, 0x00, 0xff, 0xed, 0x13, 0x80, 0x17, 0xe0, 0x00, 0x00, 0xe0, 0x0c, 0xd8, 0x01, 0xcb,
+    0x58, 0x01, 0x96, 0x34, 0x03, 0x24, 0x60, 0x80, 0x47, 0x76, 0x10, 0x0d, 0xd7, 0x61, 0x00, 0xde,
+    0x91, 0x40, 0x18, 0x81, 0x49, 0xc0, 0x3d, 0x34, 0x60, 0x1e, 0xee, 0x07, 0x00, 0x14, 0x0f, 0x40,
+    0x24, 0xd0, 0x0f, 0x65, 0x00, 0x60, 0x2c, 0x00, 0xff, 0xe5, 0xae, 0x08, 0x04, 0xbd, 0x82, 0x00,
+    0x6e, 0xb0, 0x08, 0xe8, 0x03, 0x8f, 0x0a, 0x40, 0x3a, 0x49, 0x80, 0x3a, 0xe9, 0x0b, 0x01, 0x83,
+    0x10, 0x00, 0x58, 0x01, 0xc9, 0xe0, 0x10, 0x2c, 0x00, 0x0e, 0x10, 0x04, 0x3b, 0xe4, 0x00, 0x1d,
+    0xf3, 0x00, 0x1f, 0xd1, 0x80, 0x47, 0x94, 0x40, 0x18, 0xbb, 0x84, 0x01, 0x8b, 0xb8, 0x40, 0x07,
+    0x00, 0xcc, 0x01, 0xc6, 0xe0, 0x1a, 0xc0, 0x3f, 0xfd, 0x59, 0x9c, 0x00, 0x02, 0x50, 0x86, 0x0c,
+    0x32, 0xa0, 0x0f, 0xfe, 0x80, 0xe0, 0x0f, 0xff, 0x56, 0x67, 0x76, 0x47, 0x66, 0x00, 0x1e, 0x60,
+    0x1c, 0x20, 0x00, 0x2c, 0x00, 0xff, 0xe3, 0x1c, 0x39, 0x7b, 0x80, 0xe0, 0x1c, 0x00, 0xe6, 0x00,
+    0xc3, 0xc0, 0x1c, 0x80, 0x1f, 0xfd, 0x5c, 0xce, 0x00, 0x2c, 0x49, 0x00, 0xb8, 0x00, 0xaa, 0x00,
+    0x09, 0x00, 0x7f, 0xf3, 0x00, 0xe0, 0x0f, 0xfe, 0x68, 0xf0, 0x06, 0x1f, 0x00, 0xe1, 0x00, 0xff,
+    0xe1, 0x0e, 0x67, 0x00, 0x2c, 0x00, 0xff, 0xe4, 0x26, 0x80, 0x13, 0xc0, 0x22, 0x00, 0xfc, 0x00,
+    0x09, 0x50, 0x0f, 0xfe, 0x63, 0x68, 0x80, 0x49, 0x5f, 0x82, 0x00, 0xa2, 0x89, 0x10, 0x0a, 0x58,
+    0x80, 0x38, 0xc0, 0x3f, 0xf8, 0xb1, 0x99, 0x90, 0x02, 0xc0, 0x0f, 0xf8, 0xec, 0x7c, 0x2c, 0x38,
+    0xc0, 0x44, 0x01, 0xff, 0xc2, 0x00, 0x00, 0xca, 0x40, 0x1e, 0x92, 0x00, 0xe2, 0xf0, 0x0b, 0xd8,
+    0x08, 0xc0, 0x1c, 0x36, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x2b, 0x80, 0x7a, 0x68, 0x80, 0x3d, 0x3c,
+    0x01, 0xe4, 0x44, 0x00, 0x7a, 0x14, 0xc0, 0x3d, 0xde, 0x01, 0xe3, 0x40, 0x00, 0x00, 0xda, 0x20,
+    0x19, 0xac, 0x40, 0x33, 0x30, 0x00, 0x59, 0x15, 0x70, 0x00, 0x3a, 0xa5, 0x83, 0x01, 0x90, 0x02,
+    0xf0, 0x03, 0xff, 0xa0, 0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20, 0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0,
+    0x3d, 0x34, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d, 0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1,
+    0xa0, 0x70, 0x01, 0x08, 0x23, 0x80, 0x2f, 0x30, 0x0f, 0x84, 0x02, 0x00, 0x2c, 0x8a, 0xb8, 0x00,
+    0x1d, 0x52, 0xc1, 0x80, 0xc8, 0x01, 0x78, 0x01, 0xff, 0xd0, 0x2c, 0x05, 0x13, 0xa0, 0x0a, 0x04,
+    0x03, 0x12, 0x80, 0x40, 0x00, 0x30, 0x0a, 0x80, 0x64, 0xab, 0x40, 0x0c, 0x55, 0x41, 0x00, 0x7b,
+    0x00, 0x77, 0x0d, 0x90, 0x07, 0xa7, 0x80, 0x3c, 0x8a, 0xe0, 0x1e, 0x9a, 0x20, 0x0f, 0x4f, 0x00,
+    0x79, 0x11, 0x00, 0x1e, 0x85, 0x30, 0x0f, 0x77, 0x80, 0x78, 0xd0, 0x00, 0x00, 0x59, 0x43, 0x00,
+    0x55, 0x3e, 0xc0, 0x10, 0xdb, 0x80, 0x0b, 0x22, 0xae, 0x00, 0x07, 0x54, 0xb0, 0x60, 0x32, 0x00,
+    0x5e, 0x00, 0x7f, 0xf4, 0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20, 0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0,
+    0x3d, 0x34, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d, 0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1,
+    0xa0, 0x70, 0x07, 0x40, 0x07, 0xc2, 0x60, 0x1c, 0xd9, 0x40, 0x2c, 0x8a, 0xb8, 0x00, 0x1d, 0x52,
+    0xc5, 0x80, 0xc8, 0x01, 0xb8, 0x01, 0xce, 0x01, 0xff, 0xca, 0x2c, 0x00, 0xff, 0xe2, 0x47, 0x70,
+    0x00, 0x9e, 0xed, 0x40, 0x1e, 0x7b, 0xb5, 0x00, 0x71, 0x56, 0xea, 0xd0, 0x02, 0x3f, 0x9d, 0xd4,
+    0xc2, 0x80, 0x3b, 0x86, 0x00, 0x2d, 0x81, 0x31, 0x30, 0x0c, 0x28, 0x86, 0x50, 0x0f, 0x7e, 0x80,
+    0x7f, 0x99, 0x40, 0x3d, 0xfa, 0x62, 0x60, 0x18, 0x51, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x08, 0x1f,
+    0xc6, 0xeb, 0xa1, 0x40, 0x00, 0x5d, 0xcc, 0x01, 0xae, 0xe6, 0x00, 0x8a, 0xf3, 0x0e, 0x01, 0x7c,
+    0x66, 0x39, 0xc1, 0x54, 0x60, 0x09, 0x90, 0x17, 0x00, 0x63, 0x02, 0xe0, 0x0c, 0x60, 0xaa, 0x30,
+    0x04, 0xc8, 0x01, 0xf1, 0x98, 0xe7, 0x00, 0x00, 0x94, 0x00, 0xa0, 0x1e, 0x6a, 0xa0, 0x07, 0xc7,
+    0x54, 0x50, 0x0e, 0x2a, 0xdd, 0x5a, 0x00, 0x47, 0xf3, 0xba, 0x98, 0x50, 0x07, 0x70, 0xc0, 0x05,
+    0xb0, 0x26, 0x26, 0x01, 0x85, 0x10, 0xca, 0x01, 0xef, 0xd0, 0x0f, 0xf3, 0x28, 0x07, 0xbf, 0x4c,
+    0x4c, 0x03, 0x0a, 0x20, 0x3b, 0x86, 0x00, 0x2d, 0x81, 0x03, 0xf8, 0xdd, 0x74, 0x28, 0x00, 0x00,
+    0x50, 0x1c, 0x00, 0x6e, 0x9b, 0x80, 0x0c, 0x93, 0x00, 0x18, 0xaf, 0x30, 0xe0, 0x17, 0xc6, 0x63,
+    0x9c, 0x15, 0x46, 0x00, 0x99, 0x01, 0x70, 0x06, 0x30, 0x2e, 0x00, 0xc6, 0x0a, 0xa3, 0x00, 0x4c,
+    0x80, 0x1f, 0x19, 0x8e, 0x70, 0x00, 0x00, 0xcc, 0x0c, 0x20, 0x1c, 0x5a, 0x78, 0x20, 0x1c, 0x32,
+    0xd6, 0x01, 0xc5, 0x3f, 0x14, 0x80, 0x11, 0xfc, 0xee, 0xa6, 0x14, 0x01, 0xdc, 0x30, 0x01, 0x6c,
+    0x09, 0x89, 0x80, 0x61, 0x44, 0x32, 0x80, 0x7b, 0xf4, 0x03, 0xfc, 0xca, 0x01, 0xef, 0xd3, 0x13,
+    0x00, 0xc2, 0x88, 0x0e, 0xe1, 0x80, 0x0b, 0x60, 0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0x25,
+    0x25, 0x00, 0x6e, 0x9f, 0xb0, 0x0d, 0x67, 0x42, 0x01, 0x15, 0x66, 0xb8, 0x05, 0xf1, 0x98, 0xe7,
+    0x05, 0x51, 0x80, 0x26, 0x40, 0x5c, 0x01, 0x8c, 0x0b, 0x80, 0x31, 0x82, 0xa8, 0xc0, 0x13, 0x20,
+    0x07, 0xc6, 0x63, 0x9c, 0x00, 0x00, 0x1d, 0xe6, 0x3b, 0x73, 0x35, 0x82, 0x7c, 0x66, 0x1a, 0xf3,
+    0x35, 0x84, 0xf1, 0x80, 0x7f, 0x1b, 0x10, 0x07, 0xf9, 0x8c, 0x03, 0xff, 0x8d, 0x79, 0x99, 0x58,
+    0xc0, 0x3a, 0xf3, 0x32, 0x9b, 0x10, 0x07, 0xfd, 0x3e, 0x60, 0x1f, 0xe4, 0xe8, 0xcc, 0x35, 0xe6,
+    0x6b, 0x00, 0x02, 0xbc, 0xc3, 0x82, 0xe6, 0x46, 0x00, 0xf8, 0xcc, 0x75, 0xf6, 0x63, 0x78, 0x55,
+    0x46, 0x00, 0x94, 0x80, 0x00, 0xdb, 0x17, 0x00, 0x77, 0xdd, 0xd5, 0xe5, 0xc0, 0x1d, 0xd7, 0x76,
+    0x42, 0xa8, 0xc0, 0x12, 0x72, 0x01, 0x5a, 0x07, 0xc6, 0x63, 0xb3, 0xb3, 0x2e, 0x40, 0x00, 0x89,
+    0x40, 0x3d, 0x0c, 0x01, 0xef, 0x30, 0x0b, 0xb3, 0x13, 0xb0, 0x01, 0x66, 0x5a, 0x32, 0x01, 0xe9,
+    0x70, 0x0f, 0x08, 0x07, 0xd6, 0xc0, 0x0c, 0xcb, 0xb2, 0x00, 0x19, 0x91, 0xa0, 0x07, 0xa2, 0x40,
+    0x3c, 0xae, 0x80, 0x1e, 0x88, 0x00, 0x00, 0x1d, 0x80, 0x53, 0x20, 0x0a, 0x88, 0x0a, 0xe6, 0xc0,
+    0x09, 0x76, 0x00, 0x19, 0x00, 0x7f, 0xf2, 0x80, 0xec, 0xcb, 0x60, 0x02, 0xcc, 0xb4, 0x64, 0x03,
+    0xd2, 0xe0, 0x1e, 0x10, 0x0f, 0xad, 0x80, 0x19, 0x97, 0x64, 0x00, 0x33, 0x23, 0x40, 0x0f, 0x44,
+    0x80, 0x79, 0x5d, 0x00, 0x3d, 0x10, 0x0e, 0x01, 0x40, 0x4c, 0x00, 0x9c, 0xc0, 0x3d, 0xec, 0x01,
+    0x80, 0x2b, 0x9b, 0x00, 0x25, 0xd8, 0x00, 0x64, 0x01, 0xff, 0xca, 0x38, 0x00, 0x9c, 0x80, 0x2f,
+    0x70, 0x08, 0x03, 0x30, 0x30, 0x06, 0x3a, 0xa1, 0x00, 0x74, 0xd2, 0x00, 0x5d, 0x99, 0x6c, 0x00,
+    0x59, 0x96, 0x8c, 0x80, 0x7a, 0x5c, 0x03, 0xc2, 0x01, 0xf5, 0xb0, 0x03, 0x32, 0xec, 0x80, 0x06,
+    0x64, 0x68, 0x01, 0xe8, 0x90, 0x0f, 0x2b, 0xa0, 0x07, 0xa2, 0x00, 0x00, 0x2b, 0x0b, 0x22, 0x7e,
+    0x79, 0x02, 0x62, 0x01, 0x5c, 0xd8, 0x01, 0x2e, 0xc0, 0x03, 0x20, 0x0f, 0xfe, 0x50, 0x00, 0xc6,
+    0x60, 0x0f, 0x79, 0x00, 0x70, 0xc0, 0x80, 0x45, 0x59, 0x38, 0x60, 0x0f, 0xf6, 0xeb, 0xf4, 0x48,
+    0x54, 0x00, 0x72, 0x84, 0x50, 0x04, 0xea, 0x15, 0xf6, 0xe4, 0x01, 0x26, 0xc8, 0x75, 0x80, 0x62,
+    0x7c, 0x38, 0x59, 0x00, 0xd8, 0x48, 0xe8, 0x00, 0x1f, 0xf0, 0xe7, 0xee, 0xdc, 0xa0, 0x00, 0x9a,
+    0x00, 0x35, 0x40, 0x06, 0xd0, 0x09, 0xf2, 0xac, 0x4f, 0x31, 0x7f, 0x62, 0xe2, 0x09, 0x05, 0x17,
+    0x92, 0x02, 0xb5, 0x9b, 0xeb, 0x60, 0x05, 0x04, 0xdc, 0xba, 0xe0, 0x00, 0x91, 0x80, 0x39, 0xb0,
+    0xa4, 0x03, 0x34, 0x24, 0x80, 0x45, 0x5b, 0xac, 0x30, 0x07, 0xfb, 0x75, 0xfa, 0x24, 0x2a, 0x00,
+    0x39, 0x42, 0x28, 0x02, 0x75, 0x0a, 0xfb, 0x72, 0x00, 0x93, 0x64, 0x3a, 0xc0, 0x31, 0x3e, 0x1c,
+    0x2c, 0x80, 0x6c, 0x24, 0x74, 0x00, 0x0f, 0xf8, 0x73, 0xf7, 0x6e, 0x50, 0x00, 0x4e, 0x10, 0x01,
+    0xbb, 0x64, 0x41, 0x9c, 0x6c, 0x41, 0xf2, 0xec, 0x27, 0x98, 0xbf, 0xb1, 0x71, 0x04, 0x82, 0x8b,
+    0xc9, 0x01, 0x5a, 0xcd, 0xf5, 0xb0, 0x02, 0x82, 0x6e, 0x5d, 0x70, 0x02, 0xad, 0xd6, 0x18, 0x03,
+    0xfd, 0xba, 0xfd, 0x12, 0x15, 0x00, 0x1c, 0xa1, 0x14, 0x01, 0x3a, 0x85, 0x7d, 0xb9, 0x00, 0x49,
+    0xb2, 0x1d, 0x60, 0x18, 0x9f, 0x0e, 0x16, 0x40, 0x36, 0x12, 0x3a, 0x00, 0x07, 0xfc, 0x39, 0xfd,
+    0xfb, 0xca, 0x05, 0x79, 0x38, 0xa0, 0x18, 0x7d, 0x00, 0x39, 0xc0, 0xc0, 0x00, 0x07, 0xcb, 0xb0,
+    0x9e, 0x62, 0xfe, 0xc5, 0xc4, 0x12, 0x0a, 0x2f, 0x24, 0x05, 0x6b, 0x37, 0xd6, 0xc0, 0x0a, 0x09,
+    0xb9, 0xf5, 0xc0, 0xfa, 0xf6, 0x60, 0x11, 0x28, 0x04, 0x47, 0xa0, 0x00, 0x00, 0x29, 0x03, 0x00,
+    0x64, 0x8a, 0x40, 0x0c, 0x35, 0x42, 0x00, 0x8a, 0xb7, 0x58, 0x60, 0x0f, 0xf6, 0xeb, 0xf4, 0x48,
+    0x54, 0x00, 0x72, 0x84, 0x50, 0x04, 0xea, 0x15, 0xf6, 0xe4, 0x01, 0x26, 0xc8, 0x75, 0x80, 0x62,
+    0x7c, 0x38, 0x59, 0x00, 0xd8, 0x48, 0xe8, 0x00, 0x1f, 0xf0, 0xe7, 0xee, 0xdc, 0xa0, 0x06, 0x81,
+    0xb1, 0x06, 0x0d, 0x91, 0x00, 0x46, 0x10, 0x01, 0xf2, 0xec, 0x47, 0x98, 0xb8, 0x80, 0xb8, 0x81,
+    0xd1, 0x45, 0xe4, 0x90, 0xad, 0x66, 0xfa, 0xd8, 0x01, 0x41, 0x37, 0x2e, 0xb8, 0x8c, 0xc6, 0xf6,
+    0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xff, 0x0c, 0x01, 0xf1, 0x50, 0x07, 0xc7, 0xaa, 0x01,
+    0xe6, 0x32, 0x00, 0x80, 0x05, 0x10, 0x0b, 0x88, 0x01, 0x6b, 0xf0, 0x16, 0xbf, 0x00, 0x1f, 0xfc,
+    0x51, 0x00, 0xdf, 0xb0, 0x00, 0x57, 0x80, 0x08, 0xdc, 0x00, 0x25, 0xa0, 0x00, 0x00, 0x21, 0x03,
+    0x00, 0x72, 0x45, 0x10, 0x07, 0xaa, 0x88, 0x01, 0x46, 0x63, 0x7b, 0x32, 0x08, 0xcc, 0x72, 0xe6,
+    0x40, 0x1f, 0xff, 0xd0, 0x00, 0xb4, 0x18, 0x58, 0x34, 0xbe, 0xd7, 0xf2, 0xd7, 0xe0, 0x03, 0xff,
+    0x82, 0x20, 0x17, 0xfa, 0x00, 0x8c, 0xc6, 0xf6, 0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xfa,
+    0x29, 0x98, 0x4c, 0x90, 0x09, 0x33, 0x09, 0x92, 0x01, 0xff, 0xd1, 0x00, 0x05, 0x10, 0x07, 0x10,
+    0x5a, 0xfc, 0x5a, 0xfc, 0x52, 0xfb, 0xd2, 0xfb, 0x80, 0x70, 0x80, 0x5f, 0xe8, 0x00, 0x00, 0xa2,
+    0x01, 0x00, 0x1e, 0xaa, 0x60, 0x07, 0x41, 0x52, 0x00, 0x5c, 0x01, 0xc7, 0x60, 0x1f, 0xfe, 0x87,
+    0x10, 0x31, 0x00, 0xc6, 0x41, 0x7a, 0x20, 0x04, 0xa9, 0x06, 0x9d, 0xdb, 0xbc, 0x40, 0x00, 0x5c,
+    0x84, 0x80, 0x07, 0x22, 0xa8, 0x00, 0x17, 0x1a, 0x30, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26,
+    0x01, 0x9c, 0x04, 0x46, 0x00, 0xe0, 0x07, 0x7e, 0x5e, 0x00, 0x00, 0xae, 0xe7, 0x00, 0xeb, 0xb9,
+    0xc0, 0x2e, 0x00, 0xe3, 0xb0, 0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02,
+    0x54, 0x83, 0x4e, 0xed, 0xde, 0x20, 0x00, 0x5d, 0xcc, 0x01, 0x5d, 0xcc, 0x05, 0x80, 0x11, 0xd0,
+    0x07, 0xff, 0x24, 0xc0, 0x33, 0x80, 0x88, 0xc0, 0x1c, 0x00, 0xef, 0xcb, 0xc0, 0x00, 0x00, 0x94,
+    0x00, 0x80, 0x1c, 0x75, 0x46, 0x00, 0xe6, 0xaa, 0x10, 0x05, 0xc0, 0x1c, 0x76, 0x01, 0xff, 0xe8,
+    0x71, 0x03, 0x10, 0x0c, 0x64, 0x17, 0xa2, 0x00, 0x4a, 0x90, 0x69, 0xdd, 0xbb, 0xc4, 0x00, 0x50,
+    0x1c, 0x00, 0x5d, 0x37, 0x00, 0x12, 0x4c, 0x00, 0x0b, 0x00, 0x23, 0xa0, 0x0f, 0xfe, 0x49, 0x80,
+    0x67, 0x01, 0x11, 0x80, 0x38, 0x01, 0xdf, 0x97, 0x80, 0x00, 0x00, 0x8a, 0xa0, 0x03, 0xd7, 0x00,
+    0x60, 0x1d, 0x70, 0x26, 0x01, 0x70, 0x15, 0x48, 0x1d, 0x80, 0x7f, 0xfa, 0x1c, 0x40, 0xc4, 0x03,
+    0x19, 0x05, 0xe8, 0x80, 0x12, 0xa4, 0x1a, 0x77, 0x6e, 0xf1, 0x00, 0x00, 0x1d, 0x40, 0x06, 0x98,
+    0x12, 0x00, 0xa6, 0x00, 0x80, 0x23, 0xa9, 0x00, 0x16, 0x00, 0x47, 0x40, 0x1f, 0xfc, 0x93, 0x00,
+    0xce, 0x02, 0x23, 0x00, 0x70, 0x03, 0xbf, 0x2f, 0x00, 0x00, 0x85, 0x81, 0x80, 0x39, 0x86, 0x0c,
+    0x03, 0x89, 0xf9, 0x40, 0x2e, 0x05, 0x06, 0x03, 0xb0, 0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63,
+    0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde, 0x20, 0x00, 0x25, 0x25, 0x00, 0x5d, 0x1f,
+    0x60, 0x15, 0x15, 0x88, 0x16, 0x00, 0x47, 0x40, 0x1f, 0xfc, 0x93, 0x00, 0xce, 0x02, 0x23, 0x00,
+    0x70, 0x03, 0xbf, 0x2f, 0x00, 0x0e, 0x00, 0xe3, 0xb0, 0x0f, 0xff, 0x43, 0xa8, 0x18, 0x80, 0x63,
+    0x10, 0xbd, 0x10, 0x02, 0x45, 0x83, 0x4e, 0xeb, 0xae, 0x50, 0x00, 0xb9, 0x0b, 0xcc, 0x01, 0xd7,
+    0x61, 0x00, 0xf2, 0xd8, 0x04, 0x00, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04,
+    0x46, 0x00, 0xe0, 0x07, 0x7e, 0x5e, 0xb8, 0x1e, 0x62, 0xed, 0xe0, 0x19, 0x18, 0x80, 0x32, 0xbb,
+    0x80, 0x00, 0xe1, 0x71, 0x00, 0xfe, 0x2b, 0x5b, 0x20, 0x0f, 0xc5, 0x45, 0x44, 0x01, 0xac, 0xc0,
+    0x23, 0xf2, 0x00, 0x8e, 0xf1, 0x00, 0x24, 0x35, 0x00, 0xaf, 0x56, 0xc0, 0x2c, 0x8c, 0x00, 0x91,
+    0x04, 0x20, 0x13, 0x23, 0x00, 0x04, 0x44, 0x08, 0x80, 0x44, 0x02, 0x20, 0x11, 0x00, 0x0c, 0xd0,
+    0xdc, 0x0c, 0xc0, 0x66, 0x80, 0x15, 0x01, 0x14, 0x11, 0x00, 0x88, 0x00, 0x84, 0xc4, 0x00, 0x20,
+    0x6c, 0x01, 0xae, 0x2c, 0x02, 0x48, 0xc0, 0x0c, 0x89, 0x00, 0x56, 0x8a, 0x00, 0x00, 0x00, 0xd5,
+    0x84, 0x01, 0xf3, 0x7e, 0xc0, 0x07, 0xcc, 0xa3, 0x40, 0x1a, 0x90, 0x00, 0xd8, 0x01, 0x68, 0x7e,
+    0x80, 0x34, 0x04, 0x0d, 0xc1, 0x50, 0x05, 0xe9, 0xc2, 0xfc, 0x00, 0xc4, 0xf6, 0xfa, 0x08, 0x80,
+    0x06, 0xae, 0x28, 0xb9, 0x38, 0x80, 0x1f, 0x18, 0x82, 0xe7, 0x40, 0x21, 0x74, 0x00, 0x2a, 0x20,
+    0x00, 0x00, 0x00, 0x89, 0xc0, 0x3c, 0x70, 0xb4, 0x20, 0x18, 0xe8, 0xa8, 0x40, 0x11, 0x00, 0x0e,
+    0xc4, 0x85, 0x30, 0x09, 0xd9, 0x03, 0xb8, 0x00, 0x2a, 0xb0, 0x01, 0xac, 0x07, 0x48, 0x80, 0x50,
+    0x92, 0xc8, 0x01, 0xde, 0xd6, 0x01, 0xe2, 0x20, 0x80, 0x7f, 0xf4, 0x80, 0x00, 0x2e, 0x30, 0x04,
+    0x59, 0x8f, 0x30, 0x01, 0x48, 0x49, 0x84, 0xa8, 0x04, 0x95, 0x72, 0x01, 0x74, 0x90, 0x10, 0x0b,
+    0x98, 0x55, 0x01, 0xa8, 0x00, 0xca, 0x16, 0xc0, 0x12, 0x43, 0x08, 0x05, 0x6f, 0x20, 0x18, 0xc8,
+    0xc0, 0x33, 0x58, 0x04, 0x39, 0xac, 0x01, 0x00, 0x00, 0xff, 0xa1, 0xc2, 0x90, 0x03, 0x43, 0x85,
+    0xa0, 0x02, 0x20, 0x01, 0x08, 0x62, 0x42, 0x98, 0x04, 0xec, 0x81, 0xdc, 0x00, 0x15, 0x58, 0x00,
+    0xd6, 0x03, 0xa4, 0x40, 0x28, 0x49, 0x64, 0x00, 0xef, 0x6b, 0x00, 0xf1, 0x10, 0x40, 0x3f, 0xfa,
+    0x40, 0x00, 0xc4, 0x80, 0x1f, 0x43, 0x80, 0x7d, 0xe6, 0x01, 0x26, 0x65, 0x39, 0xbe, 0x09, 0x99,
+    0xc9, 0x00, 0x1e, 0x62, 0x70, 0x0e, 0x3b, 0xa0, 0x0e, 0x1e, 0xe0, 0x80, 0x75, 0x59, 0x80, 0x73,
+    0x93, 0x00, 0x72, 0x5c, 0x80, 0x70, 0xcf, 0x00, 0x7a, 0x4f, 0xb3, 0x38, 0x00, 0x00, 0x9d, 0xc0,
+    0x1a, 0xdc, 0x03, 0x60, 0x01, 0x33, 0x2d, 0xd2, 0x66, 0x4d, 0x20, 0x13, 0x9a, 0x00, 0x12, 0xe0,
+    0x00, 0x33, 0xa0, 0x15, 0x48, 0x80, 0x15, 0x23, 0x31, 0x60, 0x00, 0xff, 0xe0, 0x25, 0x80, 0x7c,
+    0x94, 0x01, 0x93, 0x32, 0xdc, 0xdf, 0x04, 0xcc, 0xe4, 0x80, 0x0f, 0x31, 0x38, 0x07, 0x1d, 0xd0,
+    0x07, 0x0f, 0x70, 0x40, 0x3a, 0xac, 0xc0, 0x39, 0xc9, 0x80, 0x39, 0x2e, 0x40, 0x38, 0x67, 0x80,
+    0x3d, 0x27, 0xd9, 0x9c, 0x00, 0x00, 0x1d, 0x80, 0x63, 0xa0, 0x0e, 0x10, 0x02, 0x66, 0x5b, 0xa4,
+    0xcc, 0x9a, 0x40, 0x27, 0x34, 0x00, 0x25, 0xc0, 0x00, 0x67, 0x40, 0x2a, 0x91, 0x00, 0x2a, 0x46,
+    0x62, 0xc0, 0x00, 0x21, 0x83, 0x00, 0x72, 0x4d, 0x10, 0x07, 0xaa, 0x88, 0x01, 0x26, 0x67, 0x6f,
+    0x82, 0x66, 0x72, 0x40, 0x07, 0x98, 0x9c, 0x03, 0x8e, 0xe8, 0x03, 0x87, 0xb8, 0x20, 0x1d, 0x56,
+    0x60, 0x1c, 0xe4, 0xc0, 0x1c, 0x97, 0x20, 0x1c, 0x33, 0xc0, 0x1e, 0x93, 0xec, 0xce, 0x00, 0x05,
+    0x81, 0xb0, 0x02, 0xfd, 0x50, 0x02, 0x7b, 0x10, 0x4c, 0xcb, 0x74, 0x99, 0x93, 0x48, 0x04, 0xe6,
+    0x80, 0x04, 0xb8, 0x00, 0x0c, 0xe8, 0x05, 0x52, 0x20, 0x05, 0x48, 0xcc, 0x58, 0x09, 0xc3, 0x15,
+    0xc3, 0x30, 0x07, 0xff, 0x4c, 0x00, 0x93, 0xc8, 0x03, 0xdc, 0xf4, 0x01, 0xc2, 0xf0, 0xa0, 0x1c,
+    0xea, 0x08, 0x80, 0x0d, 0x54, 0x0a, 0xe0, 0x08, 0x9c, 0x80, 0xdc, 0x40, 0x14, 0xd9, 0x91, 0xb8,
+    0x01, 0x77, 0x32, 0xfa, 0x04, 0x70, 0x0c, 0x20, 0x5d, 0xc0, 0x0e, 0xaa, 0x90, 0x03, 0x9a, 0x00,
+    0x26, 0xa5, 0x00, 0xf6, 0xd4, 0x80, 0x7b, 0x6a, 0x40, 0x20, 0x04, 0xcc, 0x94, 0x0a, 0x73, 0x1b,
+    0x02, 0x58, 0x01, 0x09, 0x03, 0x5d, 0x48, 0x01, 0x76, 0xea, 0x1c, 0x00, 0x60, 0x03, 0x50, 0x50,
+    0xcc, 0x52, 0x00, 0x26, 0x1b, 0x68, 0xc0, 0x1f, 0x5e, 0x01, 0xff, 0x7d, 0x78, 0x00, 0x00, 0x25,
+    0x00, 0x79, 0x2c, 0x03, 0x76, 0x63, 0x71, 0x80, 0x2c, 0xcd, 0xac, 0x01, 0xe8, 0xd0, 0x0f, 0x84,
+    0x03, 0x86, 0x38, 0x01, 0x99, 0x71, 0x20, 0x03, 0x32, 0xff, 0x60, 0x07, 0x98, 0x48, 0x03, 0x8c,
+    0x08, 0x33, 0x34, 0x78, 0x00, 0x00, 0xff, 0x8e, 0xc0, 0x22, 0xc0, 0x3b, 0x00, 0xff, 0xe4, 0xb6,
+    0x62, 0xc4, 0x00, 0x63, 0x98, 0xfd, 0x00, 0x13, 0x80, 0x11, 0xcc, 0x18, 0x03, 0x13, 0x03, 0x00,
+    0x62, 0x60, 0x27, 0x00, 0x23, 0x98, 0x18, 0xe6, 0x3f, 0x40, 0xec, 0xcc, 0xc0, 0x16, 0x66, 0xd6,
+    0x00, 0xf4, 0x68, 0x07, 0xc2, 0x01, 0xc3, 0x1c, 0x00, 0xcc, 0xb8, 0x90, 0x01, 0x99, 0x7f, 0xb0,
+    0x03, 0xcc, 0x24, 0x01, 0xc6, 0x04, 0x19, 0x9a, 0x3c, 0x3b, 0x33, 0x59, 0x00, 0x61, 0x00, 0xf1,
+    0xd0, 0x06, 0x00, 0x2c, 0x00, 0xff, 0xe6, 0x36, 0x62, 0xc4, 0x00, 0x63, 0x98, 0xfd, 0x00, 0x13,
+    0x80, 0x11, 0xcc, 0x18, 0x03, 0x13, 0x03, 0x00, 0x62, 0x60, 0x27, 0x00, 0x23, 0x98, 0x18, 0xe6,
+    0x3f, 0x40, 0xb1, 0xb3, 0x16, 0x20, 0x1c, 0x20, 0x1e, 0x68, 0x00, 0x80, 0xec, 0xcc, 0xc0, 0x16,
+    0x66, 0xd6, 0x00, 0xf4, 0x68, 0x07, 0xc2, 0x01, 0xc3, 0x1c, 0x00, 0xcc, 0xb8, 0x90, 0x01, 0x99,
+    0x7f, 0xb0, 0x03, 0xcc, 0x24, 0x01, 0xc6, 0x04, 0x19, 0x9a, 0x3c, 0x3b, 0x33, 0x59, 0x00, 0x1a,
+    0xee, 0x00, 0x80, 0x2c, 0x00, 0xff, 0xe6, 0x36, 0x62, 0xc4, 0x00, 0x63, 0x98, 0xfd, 0x00, 0x13,
+    0x80, 0x11, 0xcc, 0x18, 0x03, 0x13, 0x03, 0x00, 0x62, 0x60, 0x27, 0x00, 0x23, 0x98, 0x18, 0xe6,
+    0x3f, 0x40, 0xb1, 0xb3, 0x16, 0x20, 0x14, 0x5d, 0xa8, 0x00, 0x00, 0x00, 0xeb, 0x30, 0x0f, 0x87,
+    0xcc, 0x03, 0x8a, 0xb2, 0x71, 0x40, 0x23, 0xfe, 0xdd, 0x74, 0xb0, 0x03, 0xb8, 0x80, 0x02, 0xd8,
+    0x03, 0x13, 0x00, 0xc3, 0x80, 0xca, 0x01, 0xe2, 0x00, 0xff, 0x98, 0x80, 0x3c, 0x40, 0x6c, 0x60,
+    0x18, 0x70, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x00, 0x0f, 0xe7, 0xbf, 0xa5, 0x80, 0x22, 0xaa, 0x5e,
+    0x28, 0x07, 0xda, 0x60, 0x1f, 0x09, 0xb0, 0x04, 0x00, 0x00, 0xda, 0x20, 0x19, 0x68, 0x40, 0x32,
+    0x38, 0x04, 0x57, 0xb8, 0xe0, 0x0f, 0x8c, 0xc7, 0x32, 0xa8, 0xc0, 0x10, 0xa5, 0xc0, 0x10, 0x99,
+    0x70, 0x04, 0x26, 0xaa, 0x30, 0x04, 0x20, 0x7c, 0x7e, 0xf3, 0x81, 0x5b, 0x6b, 0x80, 0x61, 0x81,
+    0x00, 0xe3, 0x00, 0x00, 0x00, 0xff, 0x43, 0x80, 0x7a, 0x1c, 0x03, 0x76, 0x66, 0x70, 0x0b, 0x33,
+    0x7d, 0x80, 0x7a, 0x01, 0x40, 0x3d, 0xfc, 0x01, 0xe5, 0x60, 0x0f, 0x18, 0x07, 0xcc, 0xe0, 0x1e,
+    0xff, 0x00, 0x74, 0x02, 0x86, 0x66, 0xfb, 0x00, 0x00, 0xff, 0x68, 0x80, 0x76, 0x88, 0x70, 0x07,
+    0xff, 0x0c, 0xf3, 0x16, 0x80, 0x3d, 0xcc, 0xbd, 0x07, 0x52, 0x00, 0x48, 0x8b, 0x80, 0x31, 0x0f,
+    0x00, 0x62, 0x75, 0x20, 0x04, 0x88, 0xbb, 0x99, 0x8d, 0x00, 0xec, 0xcc, 0xe0, 0x16, 0x66, 0xfb,
+    0x00, 0xf4, 0x02, 0x80, 0x7b, 0xf8, 0x03, 0xca, 0xc0, 0x1e, 0x30, 0x0f, 0x99, 0xc0, 0x3d, 0xfe,
+    0x00, 0xe8, 0x05, 0x0c, 0xcd, 0xf6, 0x1d, 0x99, 0x9c, 0x03, 0x08, 0x07, 0xd0, 0xc0, 0x18, 0x00,
+    0xf7, 0x00, 0x7f, 0xf0, 0xcf, 0x31, 0x68, 0x03, 0xdc, 0xcb, 0xd0, 0x75, 0x20, 0x04, 0x88, 0xb8,
+    0x03, 0x10, 0xf0, 0x06, 0x27, 0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98, 0xd0, 0x01, 0xe6, 0x49, 0xc0,
+    0x10, 0x80, 0x7a, 0x8c, 0x00, 0x00, 0xec, 0xcc, 0xe0, 0x16, 0x66, 0xfb, 0x00, 0xf4, 0x02, 0x80,
+    0x7b, 0xf8, 0x03, 0xca, 0xc0, 0x1e, 0x30, 0x0f, 0x99, 0xc0, 0x3d, 0xfe, 0x00, 0xe8, 0x05, 0x0c,
+    0xcd, 0xf6, 0x1d, 0x99, 0x9c, 0x02, 0xab, 0xb3, 0x80, 0x40, 0x00, 0xf7, 0x00, 0x7f, 0xf0, 0xcf,
+    0x31, 0x68, 0x03, 0xdc, 0xcb, 0xd0, 0x75, 0x20, 0x04, 0x88, 0xb8, 0x03, 0x10, 0xf0, 0x06, 0x27,
+    0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98, 0xd0, 0x01, 0xe6, 0x49, 0xc0, 0x0b, 0xb9, 0x80, 0xec, 0xcc,
+    0xe0, 0x16, 0x66, 0xfb, 0x00, 0xf4, 0x02, 0x80, 0x7b, 0xf8, 0x03, 0xca, 0xc0, 0x1e, 0x30, 0x0f,
+    0x99, 0xc0, 0x3d, 0xfe, 0x00, 0xe8, 0x05, 0x0c, 0xcd, 0xf6, 0x1d, 0x91, 0xb8, 0xe0, 0x1a, 0x04,
+    0x03, 0xcc, 0x01, 0xc0, 0x00, 0xf7, 0x00, 0x7f, 0xf0, 0xcf, 0x31, 0x68, 0x03, 0xdc, 0xcb, 0xd0,
+    0x75, 0x20, 0x04, 0x88, 0xb8, 0x03, 0x10, 0xf0, 0x06, 0x27, 0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98,
+    0xd0, 0x01, 0xe4, 0xe2, 0x70, 0x05, 0x20, 0x1c, 0x68, 0x01, 0x00, 0xec, 0xcc, 0xe0, 0x16, 0x66,
+    0xfb, 0x00, 0xf4, 0x02, 0x80, 0x7b, 0xf8, 0x03, 0xca, 0xc0, 0x1e, 0x30, 0x0f, 0x99, 0xc0, 0x3d,
+    0xfe, 0x00, 0xe8, 0x05, 0x0c, 0xcd, 0xf6, 0x1d, 0x99, 0x9c, 0x03, 0x4c, 0x00, 0x75, 0x53, 0x9c,
+    0x02, 0x00, 0x00, 0xf7, 0x00, 0x7f, 0xf0, 0xcf, 0x31, 0x68, 0x03, 0xdc, 0xcb, 0xd0, 0x75, 0x20,
+    0x04, 0x88, 0xb8, 0x03, 0x10, 0xf0, 0x06, 0x27, 0x52, 0x00, 0x48, 0x8b, 0xb9, 0x98, 0xd0, 0x01,
+    0xe6, 0x49, 0xc0, 0x01, 0xb7, 0x00, 0xd5, 0x4f, 0x50, 0x00, 0x01, 0x50, 0x0e, 0x1e, 0x20, 0x0e,
+    0xa6, 0x00, 0xcb, 0x5f, 0x60, 0x12, 0xdd, 0xc0, 0x0e, 0xcc, 0xe6, 0x0c, 0xce, 0x60, 0x0f, 0xfe,
+    0x56, 0x67, 0x08, 0x66, 0x70, 0x80, 0x7f, 0xf0, 0xf3, 0x39, 0x80, 0x00, 0x52, 0x00, 0x75, 0xf8,
+    0x07, 0x0d, 0x80, 0x75, 0xdc, 0xa0, 0x15, 0xdc, 0xa0, 0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73, 0x25,
+    0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00, 0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63,
+    0xe4, 0x00, 0x85, 0x80, 0x3a, 0x4c, 0x03, 0xb9, 0x40, 0x25, 0xbd, 0xb0, 0x09, 0x6e, 0xe0, 0x07,
+    0x66, 0x73, 0x06, 0x67, 0x30, 0x07, 0xff, 0x2b, 0x33, 0x84, 0x33, 0x38, 0x40, 0x3f, 0xf8, 0x79,
+    0x9c, 0xc0, 0x00, 0xd8, 0x40, 0x19, 0xa8, 0x80, 0x33, 0x30, 0x03, 0x5d, 0xca, 0x01, 0x5d, 0xca,
+    0x00, 0x2b, 0xcc, 0x30, 0x03, 0xe7, 0x32, 0x55, 0x88, 0x01, 0x72, 0x4b, 0x77, 0x50, 0x0d, 0x5d,
+    0xec, 0x7a, 0x20, 0x03, 0xc8, 0xfc, 0xe6, 0x3e, 0x40, 0xec, 0xce, 0x60, 0xcc, 0xe6, 0x00, 0xff,
+    0xe5, 0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x9b, 0xb3, 0x39, 0x80, 0x0d, 0x42,
+    0x01, 0x2f, 0xdd, 0x08, 0x00, 0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73, 0x25, 0x58, 0x80, 0x17, 0x24,
+    0xb7, 0x75, 0x00, 0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x0a, 0xf3, 0x10,
+    0x01, 0x15, 0xb8, 0x04, 0x33, 0x5c, 0xa0, 0x00, 0xec, 0xce, 0x60, 0xcc, 0xe6, 0x00, 0xff, 0xe5,
+    0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x9b, 0xb3, 0x39, 0x80, 0x3f, 0x25, 0x54,
+    0x00, 0x00, 0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73, 0x25, 0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00,
+    0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x0a, 0xf3, 0x10, 0x01, 0xfe, 0xaa,
+    0x90, 0x00, 0x07, 0x30, 0xa1, 0x00, 0x3d, 0xcf, 0x88, 0x76, 0x22, 0xce, 0x30, 0x66, 0x73, 0x00,
+    0x7f, 0xf2, 0xb3, 0x38, 0x43, 0x33, 0x84, 0x03, 0xff, 0x87, 0x98, 0xec, 0xc3, 0x76, 0x61, 0xf3,
+    0x0c, 0x00, 0x13, 0x60, 0x0c, 0x44, 0xf0, 0x00, 0x01, 0x80, 0x28, 0x00, 0x09, 0x02, 0xd8, 0x05,
+    0x34, 0x06, 0x00, 0x28, 0x6b, 0x60, 0x07, 0xce, 0x64, 0xab, 0x10, 0x02, 0xe4, 0x96, 0xee, 0xa0,
+    0x1a, 0xbb, 0xd8, 0xf4, 0x40, 0x07, 0x91, 0xf9, 0xfc, 0xf9, 0x02, 0xb6, 0xc8, 0x00, 0xc3, 0x00,
+    0x1e, 0x31, 0x00, 0x00, 0xfe, 0x5a, 0x00, 0xe5, 0xb0, 0x0b, 0xb3, 0x1b, 0x98, 0x30, 0xcc, 0xe3,
+    0x00, 0xff, 0xe5, 0x66, 0x69, 0x00, 0x66, 0x69, 0x00, 0xff, 0xe5, 0x00, 0x00, 0xe2, 0xc0, 0x01,
+    0x68, 0x00, 0xf6, 0x02, 0xa2, 0x00, 0x6e, 0x16, 0x9f, 0x16, 0x9f, 0x00, 0x1f, 0xfc, 0x80, 0x00,
+    0xa2, 0xed, 0x20, 0x1e, 0x8b, 0xb4, 0x80, 0x71, 0x56, 0xeb, 0x10, 0x02, 0x3f, 0xed, 0xd7, 0x4a,
+    0x80, 0x3b, 0x88, 0x00, 0x2c, 0xb0, 0x31, 0x30, 0x0c, 0x38, 0x0c, 0xa0, 0x1e, 0x20, 0x0f, 0x3e,
+    0x63, 0x51, 0x94, 0x02, 0x7c, 0xc3, 0x39, 0x89, 0x80, 0x61, 0x53, 0x0e, 0xe2, 0x00, 0x0b, 0x60,
+    0x00, 0x7f, 0xdb, 0xae, 0x86, 0x00, 0x00, 0x5d, 0xca, 0x01, 0x5d, 0xca, 0x00, 0x3c, 0xc5, 0xa7,
+    0x0f, 0x73, 0x2f, 0x41, 0xd4, 0x80, 0x12, 0x22, 0xe0, 0x0c, 0x43, 0xc0, 0x18, 0x9d, 0x48, 0x01,
+    0x22, 0x2e, 0xe6, 0x63, 0x40, 0x2c, 0xc9, 0x00, 0x1c, 0x40, 0x07, 0x70, 0x7c, 0xe6, 0x3a, 0x40,
+    0x00, 0xff, 0xa5, 0x40, 0x3d, 0x0a, 0x01, 0x70, 0x00, 0x40, 0x07, 0x60, 0x1f, 0xfd, 0x5c, 0xce,
+    0xe0, 0x06, 0x67, 0x70, 0x07, 0xff, 0x34, 0x00, 0xf8, 0xf0, 0x03, 0x8f, 0x40, 0x38, 0xb4, 0x03,
+    0xff, 0x93, 0x19, 0xb0, 0x00, 0x3c, 0xc6, 0x93, 0x01, 0xa0, 0x03, 0xb0, 0x03, 0x9c, 0x03, 0xff,
+    0x94, 0x00, 0xe0, 0x0e, 0x3b, 0x00, 0xff, 0xea, 0xe6, 0x77, 0x00, 0x33, 0x3b, 0x80, 0x3f, 0xf9,
+    0xbc, 0x01, 0xc7, 0x60, 0x10, 0x80, 0x7d, 0x0a, 0x01, 0x00, 0x2c, 0x00, 0xff, 0xe4, 0xc6, 0x6c,
+    0x00, 0x0f, 0x31, 0xa4, 0xc0, 0x68, 0x00, 0xec, 0x00, 0xe7, 0x00, 0xff, 0xe5, 0x16, 0x00, 0x47,
+    0x40, 0x10, 0x80, 0x7a, 0x90, 0x00, 0x00, 0x00, 0xfe, 0x1e, 0x03, 0xc0, 0x08, 0x7c, 0x0f, 0x40,
+    0x1c, 0x02, 0x00, 0x13, 0xb0, 0x0f, 0xfe, 0xae, 0x67, 0x70, 0x03, 0x33, 0xb8, 0x03, 0xff, 0x9a,
+    0x00, 0x00, 0xfd, 0x2c, 0x18, 0x60, 0x14, 0x30, 0x69, 0x80, 0x42, 0x58, 0x20, 0x1f, 0xfc, 0xb8,
+    0xcd, 0x80, 0x08, 0xf3, 0x1a, 0x4c, 0x00, 0x34, 0x00, 0x76, 0x00, 0x79, 0xc0, 0x3f, 0xf9, 0xa0,
+    0x0e, 0x00, 0xe3, 0xb0, 0x0f, 0xfe, 0xd6, 0x67, 0x70, 0x05, 0x99, 0xdc, 0x01, 0xff, 0xc8, 0x10,
+    0x0f, 0xcc, 0x01, 0xc7, 0x60, 0x6e, 0x01, 0xe1, 0x2d, 0x00, 0xf0, 0x2c, 0x00, 0xff, 0xe4, 0xc6,
+    0x6c, 0x00, 0x0f, 0x31, 0xa4, 0xc0, 0x68, 0x00, 0xec, 0x00, 0xe7, 0x00, 0xff, 0xe2, 0x10, 0x07,
+    0x13, 0x00, 0x47, 0x42, 0x4c, 0x01, 0x88, 0x9e, 0x01, 0x80, 0xe0, 0x0e, 0x3b, 0x00, 0xff, 0xea,
+    0xe6, 0x77, 0x00, 0x33, 0x3b, 0x80, 0x3f, 0xf9, 0xbc, 0x01, 0xc7, 0x60, 0x08, 0x00, 0x38, 0x06,
+    0xea, 0xa2, 0x00, 0x00, 0x2c, 0x00, 0xff, 0xe4, 0xc6, 0x6c, 0x00, 0x0f, 0x31, 0xa4, 0xc0, 0x68,
+    0x00, 0xec, 0x00, 0xe7, 0x00, 0xff, 0xe5, 0x16, 0x00, 0x47, 0x40, 0x07, 0x01, 0x60, 0x0d, 0x36,
+    0x80, 0x00, 0x00, 0x70, 0x07, 0xff, 0x97, 0x80, 0x3e, 0x2a, 0xa8, 0x80, 0x02, 0xc0, 0x08, 0xb4,
+    0x03, 0x08, 0x04, 0x58, 0x01, 0xff, 0xd5, 0x2c, 0x00, 0xf9, 0x2a, 0xa0, 0x00, 0x00, 0x9c, 0x02,
+    0x5f, 0x00, 0xd0, 0x0d, 0x0b, 0x2c, 0xc8, 0x09, 0x60, 0x07, 0x00, 0x7f, 0xf8, 0xc0, 0x00, 0x0b,
+    0x00, 0x56, 0x80, 0x15, 0x10, 0x4a, 0x86, 0x1c, 0x28, 0x69, 0x89, 0x60, 0x80, 0x7f, 0xf4, 0xc0,
+    0x00, 0x85, 0x80, 0x3d, 0x26, 0x01, 0xee, 0x50, 0x0b, 0x80, 0x0c, 0x0d, 0x80, 0x1c, 0xb5, 0x80,
+    0x19, 0x63, 0x40, 0x32, 0x46, 0x08, 0x04, 0x77, 0x61, 0x00, 0xdd, 0x76, 0x10, 0x0d, 0xe9, 0x14,
+    0x01, 0x88, 0x14, 0x9c, 0x03, 0xd3, 0x46, 0x01, 0xee, 0xe0, 0x00, 0x02, 0x50, 0x0e, 0x86, 0x00,
+    0xec, 0x30, 0x0c, 0x54, 0x01, 0xff, 0xcb, 0x5c, 0x10, 0x09, 0x7b, 0x04, 0x00, 0xdd, 0x60, 0x11,
+    0xd0, 0x07, 0x1e, 0x14, 0x80, 0x74, 0x93, 0x00, 0x75, 0xd2, 0x00, 0xe0, 0x0c, 0xd8, 0x01, 0xcb,
+    0x58, 0x01, 0x96, 0x34, 0x03, 0x24, 0x60, 0x80, 0x47, 0x76, 0x10, 0x0d, 0xd7, 0x61, 0x00, 0xde,
+    0x91, 0x40, 0x18, 0x81, 0x49, 0xc0, 0x3d, 0x34, 0x60, 0x1e, 0xee, 0x07, 0x00, 0x63, 0xd0, 0x0c,
+    0x20, 0x1e, 0x2c, 0x00, 0xc0, 0x2c, 0x00, 0xff, 0xe5, 0xae, 0x08, 0x04, 0xbd, 0x82, 0x00, 0x6e,
+    0xb0, 0x08, 0xe8, 0x03, 0x8f, 0x0a, 0x40, 0x3a, 0x49, 0x80, 0x3a, 0xe9, 0x0b, 0x00, 0x2c, 0x40,
+    0x08, 0x40, 0x3d, 0xe2, 0x00, 0x00, 0xe0, 0x0c, 0xd8, 0x01, 0xcb, 0x58, 0x01, 0x96, 0x34, 0x03,
+    0x24, 0x60, 0x80, 0x47, 0x76, 0x10, 0x0d, 0xd7, 0x61, 0x00, 0xde, 0x91, 0x40, 0x18, 0x81, 0x49,
+    0xc0, 0x3d, 0x34, 0x60, 0x1e, 0xee, 0x07, 0x00, 0x63, 0xd0, 0x02, 0x5d, 0xc4, 0x00, 0x00, 0x2c,
+    0x00, 0xff, 0xe5, 0xae, 0x08, 0x04, 0xbd, 0x82, 0x00, 0x6e, 0xb0, 0x08, 0xe8, 0x03, 0x8f, 0x0a,
+    0x40, 0x3a, 0x49, 0x80, 0x3a, 0xe9, 0x0b, 0x00, 0x2c, 0x40, 0x2b, 0xb8, 0xc0, 0xe0, 0x0f, 0xff,
+    0x56, 0x67, 0x76, 0x67, 0x00, 0x04, 0x03, 0xa5, 0x80, 0x00, 0x2c, 0x00, 0xff, 0xe3, 0x16, 0x00,
+    0x96, 0x80, 0x3b, 0xb8, 0xc0, 0x23, 0xbb, 0x8c, 0x03, 0xb8, 0x03, 0xff, 0xf9, 0x99, 0xc0, 0x0e,
+    0xcc, 0xe0, 0x0c, 0x20, 0x1f, 0x4b, 0x00, 0x00, 0x5b, 0xb8, 0x56, 0xee, 0x10, 0x2c, 0x00, 0xff,
+    0xf2, 0x16, 0x00, 0x61, 0x00, 0x8b, 0x40, 0x00, 0xe0, 0x0f, 0xff, 0x56, 0x67, 0x76, 0x67, 0x04,
+    0xdd, 0xa0, 0x00, 0x02, 0xc0, 0x0f, 0xff, 0x21, 0x60, 0x01, 0x6e, 0xe1, 0x00, 0xe0, 0x0f, 0xff,
+    0x56, 0x67, 0x76, 0x67, 0x00, 0x26, 0x00, 0x2a, 0xdd, 0x40, 0x00, 0x02, 0xc0, 0x0f, 0xff, 0x21,
+    0x60, 0x04, 0xd6, 0x20, 0x9f, 0x54, 0x10, 0x00, 0xe5, 0x20, 0x0f, 0xd2, 0x40, 0x1f, 0x17, 0x80,
+    0x6f, 0x80, 0x01, 0x18, 0x02, 0xb4, 0x54, 0x03, 0x85, 0x00, 0x08, 0xa0, 0x19, 0x98, 0x00, 0xa9,
+    0x00, 0xd5, 0x40, 0x01, 0x81, 0x80, 0x11, 0xcc, 0x02, 0x9a, 0x00, 0x7c, 0x80, 0x65, 0x41, 0x27,
+    0x30, 0x0e, 0x57, 0xaa, 0x00, 0x7a, 0x6d, 0x58, 0x03, 0xc2, 0xea, 0x01, 0x80, 0x00, 0xf6, 0x88,
+    0x07, 0xe5, 0xa1, 0x00, 0xfc, 0xae, 0x01, 0x8b, 0x22, 0xb1, 0x96, 0xaa, 0x00, 0x1d, 0x53, 0x2f,
+    0x6a, 0x99, 0x00, 0x64, 0x00, 0x7c, 0x00, 0x21, 0x00, 0x79, 0xc0, 0x21, 0x00, 0xff, 0xea, 0x80,
+    0x00, 0xff, 0xe1, 0x43, 0x00, 0x7e, 0x96, 0x00, 0xdf, 0x00, 0x01, 0x00, 0xab, 0x45, 0x40, 0x38,
+    0x50, 0x00, 0x8a, 0x01, 0x99, 0x80, 0x0a, 0x90, 0x0d, 0x54, 0x00, 0x18, 0x18, 0x01, 0x1c, 0xc0,
+    0x29, 0xa0, 0x07, 0xc8, 0x06, 0x54, 0x12, 0x73, 0x00, 0xe5, 0x7a, 0xa0, 0x07, 0xa6, 0xd5, 0x80,
+    0x3c, 0x2e, 0xa0, 0x18, 0x00, 0xeb, 0x40, 0x0f, 0xea, 0x40, 0x0f, 0xe1, 0x00, 0xe2, 0xc8, 0xac,
+    0x65, 0xaa, 0x80, 0x07, 0x54, 0xcb, 0xda, 0xa6, 0x40, 0x19, 0x00, 0x1f, 0x00, 0x08, 0x40, 0x1e,
+    0x70, 0x08, 0x40, 0x3f, 0xfa, 0xa0, 0xf8, 0x00, 0xf5, 0x68, 0xa8, 0x07, 0x0a, 0x00, 0x11, 0x40,
+    0x33, 0x30, 0x01, 0x52, 0x01, 0xaa, 0x80, 0x03, 0x03, 0x00, 0x23, 0x98, 0x05, 0x34, 0x00, 0xf9,
+    0x00, 0xca, 0x82, 0x4e, 0x60, 0x1c, 0xaf, 0x54, 0x00, 0xf4, 0xda, 0xb0, 0x07, 0x85, 0xd4, 0x03,
+    0x70, 0x05, 0x50, 0x00, 0x1d, 0x00, 0xc2, 0x01, 0xfd, 0x2c, 0x01, 0x80, 0x2c, 0x8a, 0xc6, 0x5a,
+    0xa8, 0x00, 0x75, 0x4c, 0xbd, 0xaa, 0x64, 0x01, 0x90, 0x01, 0xf0, 0x00, 0x84, 0x01, 0xe7, 0x00,
+    0x84, 0x03, 0xff, 0xaa, 0x58, 0x01, 0x51, 0x80, 0x0a, 0xc0, 0x38, 0x40, 0x3f, 0xd4, 0x80, 0x18,
+    0x00, 0xff, 0xa1, 0xc0, 0x3d, 0x0e, 0x01, 0x7b, 0x00, 0x77, 0x0d, 0x90, 0x07, 0xa7, 0x80, 0x3c,
+    0x8a, 0xe0, 0x1e, 0x9a, 0x20, 0x0f, 0x4f, 0x00, 0x79, 0x11, 0x00, 0x1e, 0x85, 0x30, 0x0f, 0x77,
+    0x80, 0x78, 0xd0, 0x00, 0x00, 0xad, 0x00, 0x3a, 0x90, 0x03, 0x84, 0x02, 0x2c, 0x8a, 0xb8, 0x00,
+    0x1d, 0x52, 0xc1, 0x80, 0xc8, 0x01, 0x78, 0x01, 0xff, 0xd0, 0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20,
+    0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0, 0x3d, 0x34, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d,
+    0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1, 0xa0, 0x70, 0x07, 0x47, 0x00, 0x42, 0x01, 0xf4, 0xb8, 0x04,
+    0x00, 0x2c, 0x8a, 0xb8, 0x00, 0x1d, 0x52, 0xc1, 0x80, 0xc8, 0x01, 0x78, 0x01, 0xff, 0xd0, 0x2c,
+    0x00, 0x8e, 0x80, 0x21, 0x00, 0xf5, 0x20, 0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20, 0x0f, 0x4f, 0x00,
+    0x79, 0x15, 0xc0, 0x3d, 0x34, 0x40, 0x1e, 0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d, 0x0a, 0x60, 0x1e,
+    0xef, 0x00, 0xf1, 0xa0, 0x70, 0x07, 0x47, 0x00, 0x26, 0xed, 0x00, 0x00, 0x2c, 0x8a, 0xb8, 0x00,
+    0x1d, 0x52, 0xc1, 0x80, 0xc8, 0x01, 0x78, 0x01, 0xff, 0xd0, 0x2c, 0x00, 0x8e, 0x80, 0x17, 0x73,
+    0x00, 0xf6, 0x00, 0xee, 0x1b, 0x20, 0x0f, 0x4f, 0x00, 0x79, 0x15, 0xc0, 0x3d, 0x34, 0x40, 0x1e,
+    0x9e, 0x00, 0xf2, 0x22, 0x00, 0x3d, 0x0a, 0x60, 0x1e, 0xef, 0x00, 0xf1, 0xa0, 0x70, 0x07, 0x47,
+    0x00, 0x53, 0x20, 0x0e, 0x9d, 0xc9, 0x00, 0x00, 0x2c, 0x8a, 0xb8, 0x00, 0x1d, 0x52, 0xc1, 0x80,
+    0xc8, 0x01, 0x78, 0x01, 0xff, 0xd0, 0x2c, 0x00, 0x8e, 0x80, 0x03, 0x4e, 0x01, 0xaa, 0x3d, 0x80,
+    0x00, 0xe3, 0x40, 0x0f, 0x86, 0x10, 0x03, 0xe1, 0xb0, 0x0f, 0x96, 0x69, 0xc0, 0x3c, 0xb3, 0x4e,
+    0x01, 0xc5, 0x5b, 0xab, 0x40, 0x08, 0xfe, 0x77, 0x53, 0x0a, 0x00, 0xee, 0x18, 0x00, 0xb6, 0x04,
+    0xc4, 0xc0, 0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x65, 0x00, 0xf7, 0xe9, 0x89, 0x80,
+    0x61, 0x44, 0x07, 0x70, 0xc0, 0x05, 0xb0, 0x20, 0x7f, 0x1b, 0xae, 0x85, 0x00, 0x00, 0xd8, 0x40,
+    0x1c, 0xd4, 0x40, 0x1a, 0x79, 0xa0, 0x03, 0x75, 0x52, 0xc0, 0x33, 0x95, 0x18, 0x04, 0x57, 0x98,
+    0x70, 0x0b, 0xe3, 0x31, 0xce, 0x0a, 0xa3, 0x00, 0x4c, 0x80, 0xb8, 0x03, 0x18, 0x17, 0x00, 0x63,
+    0x05, 0x51, 0x80, 0x26, 0x40, 0x0f, 0x8c, 0xc7, 0x38, 0x00, 0x00, 0xb4, 0x87, 0x80, 0x3d, 0x84,
+    0x3e, 0x01, 0xe4, 0x9a, 0x60, 0x0f, 0x2c, 0xd3, 0x80, 0x71, 0x56, 0xea, 0xd0, 0x02, 0x3f, 0x9d,
+    0xd4, 0xc2, 0x80, 0x3b, 0x86, 0x00, 0x2d, 0x81, 0x31, 0x30, 0x0c, 0x28, 0x86, 0x50, 0x0f, 0x7e,
+    0x80, 0x7f, 0x99, 0x40, 0x3d, 0xfa, 0x62, 0x60, 0x18, 0x51, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x08,
+    0x1f, 0xc6, 0xeb, 0xa1, 0x40, 0x00, 0xfe, 0x3c, 0x05, 0xa0, 0x08, 0xda, 0x10, 0xc0, 0x36, 0xd5,
+    0xd0, 0x06, 0x72, 0xa3, 0x00, 0x8a, 0xf3, 0x0e, 0x01, 0x7c, 0x66, 0x39, 0xc1, 0x54, 0x60, 0x09,
+    0x90, 0x17, 0x00, 0x63, 0x02, 0xe0, 0x0c, 0x60, 0xaa, 0x30, 0x04, 0xc8, 0x01, 0xf1, 0x98, 0xe7,
+    0x00, 0x00, 0x89, 0x00, 0x3f, 0x17, 0x10, 0x07, 0xea, 0x20, 0x0f, 0x9e, 0xed, 0x20, 0x1e, 0x7b,
+    0xb4, 0x80, 0x71, 0x56, 0xea, 0xd0, 0x02, 0x3f, 0x9d, 0xd4, 0xc2, 0x80, 0x3b, 0x86, 0x00, 0x2d,
+    0x81, 0x31, 0x30, 0x0c, 0x28, 0x86, 0x50, 0x0f, 0x7e, 0x80, 0x7f, 0x99, 0x40, 0x3d, 0xfa, 0x62,
+    0x60, 0x18, 0x51, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x08, 0x1f, 0xc6, 0xeb, 0xa1, 0x40, 0x00, 0x4a,
+    0x80, 0x7a, 0x78, 0x03, 0xeb, 0x00, 0xf5, 0xdc, 0xc0, 0x1a, 0xee, 0x60, 0x08, 0xaf, 0x30, 0xe0,
+    0x17, 0xc6, 0x63, 0x9c, 0x15, 0x46, 0x00, 0x99, 0x01, 0x70, 0x06, 0x30, 0x2e, 0x00, 0xc6, 0x0a,
+    0xa3, 0x00, 0x4c, 0x80, 0x1f, 0x19, 0x8e, 0x70, 0x00, 0x00, 0xe3, 0x40, 0x0f, 0xd0, 0xa0, 0x1f,
+    0xac, 0x40, 0x3c, 0xf7, 0x69, 0x00, 0xf3, 0xdd, 0xa4, 0x03, 0x8a, 0xb7, 0x56, 0x80, 0x11, 0xfc,
+    0xee, 0xa6, 0x14, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x09, 0x89, 0x80, 0x61, 0x44, 0x32, 0x80, 0x7b,
+    0xf4, 0x03, 0xfc, 0xca, 0x01, 0xef, 0xd3, 0x13, 0x00, 0xc2, 0x88, 0x0e, 0xe1, 0x80, 0x0b, 0x60,
+    0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0xd8, 0x40, 0x1c, 0xb6, 0x40, 0x1c, 0xae, 0x01, 0xd7,
+    0x73, 0x00, 0x6b, 0xb9, 0x80, 0x22, 0xbc, 0xc3, 0x80, 0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18, 0x02,
+    0x64, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66, 0x39,
+    0xc0, 0x00, 0x8c, 0xc0, 0x1d, 0xe4, 0x01, 0x86, 0x04, 0x01, 0xd9, 0xb1, 0xb0, 0x00, 0xcc, 0xb4,
+    0x9c, 0x03, 0xa2, 0x80, 0x3c, 0x20, 0x18, 0x66, 0x83, 0x32, 0xdd, 0x30, 0x66, 0x66, 0x00, 0xff,
+    0xe5, 0x00, 0x00, 0xcd, 0x00, 0x1e, 0xa8, 0x00, 0xf6, 0x00, 0x45, 0x8f, 0x55, 0x08, 0x00, 0xca,
+    0xa9, 0x3a, 0x00, 0x25, 0x00, 0x1b, 0x98, 0x30, 0x06, 0x26, 0x05, 0x00, 0xc4, 0xc0, 0x07, 0x00,
+    0x2b, 0x98, 0x10, 0xe6, 0x3b, 0x40, 0x26, 0xcc, 0x58, 0x80, 0x7f, 0xf1, 0x40, 0x00, 0xfe, 0x59,
+    0x00, 0xe5, 0x80, 0x0b, 0xb3, 0x1b, 0xa8, 0x00, 0x66, 0x5a, 0x4e, 0x01, 0xd1, 0x40, 0x1e, 0x10,
+    0x0c, 0x33, 0x41, 0x99, 0x6e, 0x98, 0x33, 0x33, 0x00, 0x7f, 0xf2, 0x80, 0x00, 0x8f, 0x00, 0x3c,
+    0x7a, 0x01, 0xf0, 0x80, 0x45, 0x8f, 0x55, 0x08, 0x00, 0xca, 0xa9, 0x3a, 0x00, 0x25, 0x00, 0x1b,
+    0x98, 0x30, 0x06, 0x26, 0x05, 0x00, 0xc4, 0xc0, 0x07, 0x00, 0x2b, 0x98, 0x10, 0xe6, 0x3b, 0x40,
+    0x26, 0xcc, 0x58, 0x80, 0x7f, 0xf1, 0x40, 0x00, 0xff, 0x1e, 0x00, 0x78, 0xf4, 0x03, 0x76, 0x63,
+    0x75, 0x00, 0x16, 0x65, 0xa3, 0x20, 0x1e, 0x97, 0x00, 0xf0, 0x80, 0x7d, 0x6c, 0x00, 0xcc, 0xbb,
+    0x20, 0x01, 0x99, 0x1a, 0x00, 0x7a, 0x24, 0x03, 0xca, 0xe8, 0x01, 0xe8, 0x80, 0x00, 0x00, 0x70,
+    0x06, 0xf0, 0x0c, 0x20, 0x02, 0xb9, 0xb0, 0x02, 0x5d, 0x80, 0x06, 0x40, 0x1f, 0xfc, 0xa0, 0xec,
+    0xcb, 0x60, 0x02, 0xcc, 0xb4, 0x64, 0x03, 0xd2, 0xe0, 0x1e, 0x10, 0x0f, 0xad, 0x80, 0x19, 0x97,
+    0x64, 0x00, 0x33, 0x23, 0x40, 0x0f, 0x44, 0x80, 0x79, 0x5d, 0x00, 0x3d, 0x10, 0x0e, 0x00, 0xc9,
+    0x80, 0x18, 0x40, 0x3c, 0x5a, 0x01, 0x80, 0x2b, 0x9b, 0x00, 0x25, 0xd8, 0x00, 0x64, 0x01, 0xff,
+    0xca, 0x2c, 0x00, 0xc2, 0x01, 0x16, 0x80, 0x40, 0x05, 0xbb, 0x80, 0x32, 0xdd, 0xc0, 0x17, 0x66,
+    0x5b, 0x00, 0x16, 0x65, 0xa3, 0x20, 0x1e, 0x97, 0x00, 0xf0, 0x80, 0x7d, 0x6c, 0x00, 0xcc, 0xbb,
+    0x20, 0x01, 0x99, 0x1a, 0x00, 0x7a, 0x24, 0x03, 0xca, 0xe8, 0x01, 0xe8, 0x80, 0x70, 0x06, 0x4c,
+    0x00, 0xc2, 0x01, 0xe2, 0xd0, 0x0c, 0x00, 0x3b, 0xb8, 0xcd, 0x77, 0x19, 0x5c, 0xd8, 0x01, 0x2e,
+    0xc0, 0x03, 0x20, 0x0f, 0xfe, 0x51, 0x60, 0x06, 0x10, 0x08, 0xb4, 0x02, 0x00, 0xec, 0xcb, 0x60,
+    0x02, 0xcc, 0xb4, 0x64, 0x03, 0xd2, 0xe0, 0x1e, 0x10, 0x0f, 0xad, 0x80, 0x19, 0x97, 0x64, 0x00,
+    0x33, 0x23, 0x40, 0x0f, 0x44, 0x80, 0x79, 0x5d, 0x00, 0x3d, 0x10, 0x0e, 0x00, 0xc9, 0x80, 0x05,
+    0xbb, 0x84, 0x00, 0x00, 0x02, 0xb9, 0xb0, 0x09, 0x2e, 0xc0, 0x11, 0x90, 0x07, 0xff, 0x3c, 0xb0,
+    0x02, 0x5b, 0xb8, 0x40, 0x00, 0xff, 0x96, 0x40, 0x3c, 0xb0, 0x01, 0xf0, 0x80, 0x62, 0xad, 0xd6,
+    0x18, 0x03, 0xfd, 0xba, 0xfd, 0x12, 0x15, 0x00, 0x1c, 0xa1, 0x14, 0x01, 0x3a, 0x85, 0x7d, 0xb9,
+    0x00, 0x49, 0xb2, 0x1d, 0x60, 0x18, 0x9f, 0x0e, 0x16, 0x40, 0x36, 0x12, 0x3a, 0x00, 0x07, 0xfc,
+    0x39, 0xfb, 0xb7, 0x28, 0x00, 0x1d, 0x80, 0x63, 0xa0, 0x0e, 0x10, 0x09, 0xf2, 0xec, 0x27, 0x98,
+    0xbf, 0xb1, 0x71, 0x04, 0x82, 0x8b, 0xc9, 0x01, 0x5a, 0xcd, 0xf5, 0xb0, 0x02, 0x82, 0x6e, 0x5d,
+    0x70, 0x02, 0xad, 0xd6, 0x18, 0x03, 0xfd, 0xba, 0xfd, 0x12, 0x15, 0x00, 0x1c, 0xa1, 0x14, 0x01,
+    0x3a, 0x85, 0x7d, 0xb9, 0x00, 0x49, 0xb2, 0x1d, 0x60, 0x18, 0x9f, 0x0e, 0x16, 0x40, 0x36, 0x12,
+    0x3a, 0x00, 0x07, 0xfc, 0x39, 0xfb, 0xb7, 0x28, 0x15, 0xee, 0xb1, 0x40, 0x38, 0x40, 0x3c, 0xb6,
+    0x01, 0x00, 0x07, 0xcb, 0xb0, 0x9e, 0x62, 0xfe, 0xc5, 0xc4, 0x12, 0x0a, 0x2f, 0x24, 0x05, 0x6b,
+    0x37, 0xd6, 0xc0, 0x0a, 0x09, 0xb9, 0x75, 0xc0, 0xf9, 0x76, 0x30, 0x08, 0x40, 0x31, 0xd0, 0x00,
+    0x00, 0x0e, 0x81, 0x00, 0x61, 0xca, 0x70, 0x0e, 0x18, 0x50, 0x08, 0xab, 0x7f, 0x0c, 0x01, 0xfe,
+    0xdd, 0x7e, 0x89, 0x0a, 0x80, 0x0e, 0x50, 0x8a, 0x00, 0x9d, 0x42, 0xbe, 0xdc, 0x80, 0x24, 0xd9,
+    0x0e, 0xb0, 0x0c, 0x4f, 0x87, 0x0b, 0x20, 0x1b, 0x09, 0x1d, 0x00, 0x03, 0xfe, 0x1c, 0xfd, 0xdb,
+    0x94, 0x00, 0x1e, 0x00, 0x63, 0xd0, 0x0e, 0x4c, 0x00, 0x87, 0xb0, 0x02, 0x1b, 0x00, 0x9f, 0x2e,
+    0xc2, 0x79, 0x8b, 0xfb, 0x17, 0x10, 0x48, 0x28, 0xbc, 0x90, 0x14, 0xac, 0xdf, 0x5a, 0x00, 0x28,
+    0x26, 0xe5, 0xd7, 0x00, 0x00, 0xff, 0x96, 0x40, 0x39, 0x11, 0x0a, 0x01, 0x96, 0xac, 0x40, 0x30,
+    0xdd, 0x90, 0x02, 0x2a, 0xdc, 0xc1, 0x80, 0x3f, 0xdb, 0xaf, 0xd1, 0x21, 0x50, 0x01, 0xca, 0x11,
+    0x40, 0x13, 0xa8, 0x57, 0xdb, 0x90, 0x04, 0x9b, 0x21, 0xd6, 0x01, 0x89, 0xf0, 0xe1, 0x64, 0x03,
+    0x61, 0x23, 0xa0, 0x00, 0x7f, 0xc3, 0x9f, 0xbb, 0x72, 0x80, 0x00, 0x1d, 0x80, 0x4b, 0x75, 0x62,
+    0x0a, 0x15, 0x22, 0x00, 0x8b, 0x20, 0x03, 0xe5, 0xd8, 0x8f, 0x31, 0x73, 0x62, 0xe2, 0x05, 0x25,
+    0x17, 0x92, 0x42, 0xb5, 0x9b, 0xeb, 0x40, 0x05, 0x04, 0xcc, 0x5d, 0x70, 0x00, 0xff, 0x96, 0x40,
+    0x3c, 0xb0, 0x01, 0x8a, 0xb7, 0x30, 0x60, 0x0f, 0xf6, 0xeb, 0xf4, 0x48, 0x54, 0x00, 0x72, 0x84,
+    0x50, 0x04, 0xea, 0x15, 0xf6, 0xe4, 0x01, 0x26, 0xc8, 0x75, 0x80, 0x62, 0x7c, 0x38, 0x59, 0x00,
+    0xd8, 0x48, 0xe8, 0x00, 0x1f, 0xf0, 0xe7, 0xee, 0xdc, 0xa0, 0x57, 0xba, 0xc5, 0x00, 0xe1, 0x00,
+    0xf2, 0xd8, 0x04, 0x00, 0x00, 0x1d, 0x80, 0x63, 0xa0, 0x0e, 0x10, 0x09, 0xf2, 0xec, 0x27, 0x98,
+    0xbf, 0xb1, 0x71, 0x04, 0x82, 0x8b, 0xc9, 0x01, 0x5a, 0xcd, 0xf5, 0xb0, 0x02, 0x82, 0x6e, 0x5d,
+    0x70, 0x3e, 0x5d, 0x8c, 0x02, 0x10, 0x0c, 0x74, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x25, 0x80, 0x7c,
+    0x94, 0x01, 0xa3, 0x31, 0xbf, 0x99, 0x04, 0x66, 0x39, 0x73, 0x20, 0x0f, 0xff, 0xe8, 0x0b, 0x30,
+    0x05, 0x18, 0x01, 0xc4, 0x01, 0xa4, 0x16, 0xbf, 0x16, 0xbf, 0x00, 0x1f, 0xfc, 0x11, 0x00, 0xbf,
+    0xd0, 0x00, 0x8c, 0xc6, 0xf6, 0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xff, 0xe0, 0x76, 0x01,
+    0xf8, 0x40, 0x3e, 0x4a, 0x00, 0xc0, 0x05, 0x10, 0x07, 0x10, 0x5a, 0xfc, 0x5a, 0xfc, 0x00, 0x7f,
+    0xf0, 0x44, 0x02, 0xff, 0x40, 0x2e, 0x40, 0x00, 0x40, 0x03, 0xe0, 0x00, 0x8c, 0xc6, 0xf6, 0x64,
+    0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xff, 0xe0, 0x76, 0x01, 0xe6, 0xbb, 0x80, 0x20, 0x05, 0x10,
+    0x0b, 0x88, 0x01, 0x6b, 0xf0, 0x16, 0xbf, 0x00, 0x1f, 0xfc, 0x51, 0x00, 0xdf, 0xe8, 0x00, 0x2e,
+    0x40, 0x1d, 0xdc, 0x40, 0x8c, 0xc6, 0xf6, 0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3f, 0xff, 0xe0,
+    0x76, 0x01, 0xf3, 0xd0, 0x80, 0x73, 0x7c, 0x50, 0x04, 0x00, 0x05, 0x10, 0x0b, 0x88, 0x01, 0x6b,
+    0xf0, 0x16, 0xbf, 0x00, 0x1f, 0xfc, 0x51, 0x00, 0xdf, 0xe8, 0x00, 0x2e, 0x40, 0x01, 0x2c, 0xc0,
+    0xfa, 0xa0, 0x80, 0x0e, 0x00, 0xe3, 0xb0, 0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd,
+    0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde, 0x20, 0x05, 0xcd, 0xd5, 0x10, 0x06, 0x10, 0x00, 0x80,
+    0x61, 0xc0, 0x4a, 0x00, 0x00, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04, 0x46,
+    0x00, 0xe0, 0x07, 0x7e, 0x5e, 0x00, 0x0f, 0x31, 0x6d, 0x40, 0x01, 0x00, 0x08, 0x00, 0xb0, 0x12,
+    0x80, 0x0e, 0x00, 0xe3, 0xb0, 0x0f, 0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02,
+    0x54, 0x83, 0x4e, 0xed, 0xde, 0x20, 0x05, 0xcd, 0xd5, 0x10, 0x07, 0xff, 0x06, 0x6a, 0x8c, 0x00,
+    0x00, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04, 0x46, 0x00, 0xe0, 0x07, 0x7e,
+    0x5e, 0x00, 0x0f, 0x31, 0x6d, 0x40, 0x1f, 0xd3, 0x54, 0x50, 0x00, 0x0e, 0x00, 0xe3, 0xb0, 0x0f,
+    0xff, 0x43, 0x88, 0x18, 0x80, 0x63, 0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde, 0x20,
+    0x05, 0xcd, 0xd5, 0x10, 0x06, 0x1b, 0x80, 0x0f, 0x54, 0xfb, 0x80, 0x00, 0x2c, 0x00, 0x8e, 0x80,
+    0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04, 0x46, 0x00, 0xe0, 0x07, 0x7e, 0x5e, 0x00, 0x0f, 0x31, 0x6d,
+    0x40, 0x01, 0xb8, 0x00, 0xd5, 0x3e, 0xc0, 0x00, 0x00, 0xe5, 0x10, 0x0f, 0x26, 0x08, 0x07, 0x92,
+    0x40, 0x3c, 0xf5, 0x28, 0x01, 0xcf, 0x52, 0x80, 0x17, 0x00, 0x71, 0xd8, 0x07, 0xff, 0xa1, 0xc4,
+    0x0c, 0x40, 0x31, 0x90, 0x5e, 0x88, 0x01, 0x2a, 0x41, 0xa7, 0x76, 0xef, 0x10, 0x00, 0xd8, 0x40,
+    0x19, 0xa8, 0x80, 0x29, 0xe6, 0x80, 0x0b, 0xaa, 0x96, 0x01, 0x39, 0x51, 0x81, 0x60, 0x04, 0x74,
+    0x01, 0xff, 0xc9, 0x30, 0x0c, 0xe0, 0x22, 0x30, 0x07, 0x00, 0x3b, 0xf2, 0xf0, 0x00, 0x00, 0x16,
+    0x82, 0x50, 0x06, 0x2c, 0x04, 0xb0, 0x0e, 0xbb, 0x9c, 0x03, 0xaa, 0xec, 0xc0, 0x17, 0x00, 0x71,
+    0xd8, 0x07, 0xff, 0xa1, 0xc4, 0x0c, 0x40, 0x31, 0x90, 0x5e, 0x88, 0x01, 0x2a, 0x41, 0xa7, 0x76,
+    0xef, 0x10, 0x00, 0xfc, 0x78, 0x0b, 0x40, 0x03, 0xd0, 0x5b, 0x00, 0xaa, 0xec, 0xe0, 0x15, 0xdc,
+    0xc0, 0x58, 0x01, 0x1d, 0x00, 0x7f, 0xf2, 0x4c, 0x03, 0x38, 0x08, 0x8c, 0x01, 0xc0, 0x0e, 0xfc,
+    0xbc, 0x00, 0x00, 0x0d, 0x22, 0x40, 0x19, 0x24, 0xb9, 0x00, 0x32, 0x9b, 0x50, 0x05, 0x48, 0x01,
+    0xcd, 0x1d, 0xc0, 0x0e, 0xaa, 0x23, 0x88, 0x04, 0x40, 0x40, 0xae, 0x01, 0x55, 0x00, 0x15, 0x40,
+    0x09, 0x5c, 0x00, 0x40, 0x40, 0x6e, 0x20, 0x15, 0x50, 0x2b, 0x80, 0x33, 0x28, 0x22, 0x00, 0x39,
+    0xe1, 0x40, 0x3d, 0xcf, 0x40, 0x10, 0x01, 0xb6, 0x46, 0x00, 0x2f, 0x97, 0x38, 0x01, 0x12, 0xa1,
+    0x09, 0x50, 0x09, 0x2a, 0xe4, 0x02, 0xf9, 0x20, 0x20, 0x17, 0x30, 0x9b, 0x06, 0xa0, 0x02, 0xa0,
+    0x53, 0x00, 0x4b, 0x48, 0x01, 0xa9, 0x68, 0x00, 0x00, 0xa4, 0x00, 0xe6, 0x8e, 0xe0, 0x07, 0x55,
+    0x11, 0xc4, 0x02, 0x20, 0x20, 0x57, 0x00, 0xaa, 0x80, 0x0a, 0xa0, 0x04, 0xae, 0x00, 0x20, 0x20,
+    0x37, 0x10, 0x0a, 0xa8, 0x15, 0xc0, 0x19, 0x94, 0x11, 0x00, 0x1c, 0xf0, 0xa0, 0x1e, 0xe7, 0xa0,
+    0x0f, 0x27, 0x90, 0x07, 0xc2, 0x01, 0xf0, 0xf8, 0x06, 0x00, 0x95, 0x00, 0x92, 0xae, 0x40, 0x2f,
+    0x92, 0x02, 0x01, 0x73, 0x09, 0xb0, 0x6a, 0x00, 0x2a, 0x05, 0x30, 0x04, 0xb4, 0x80, 0x1a, 0x96,
+    0x80, 0x31, 0x79, 0x80, 0x70, 0x80, 0x7b, 0xc0, 0x20, 0x00, 0xe7, 0x00, 0xff, 0xe0, 0xb0, 0x07,
+    0xfc, 0xe6, 0x01, 0xeb, 0x30, 0x08, 0xe8, 0x80, 0x23, 0xbc, 0x40, 0x09, 0x0d, 0x40, 0x2b, 0xd5,
+    0xb0, 0x0b, 0x23, 0x00, 0x24, 0x41, 0x08, 0x04, 0xc8, 0xc0, 0x01, 0x11, 0x02, 0x20, 0x11, 0x00,
+    0x88, 0x04, 0x40, 0x03, 0x34, 0x37, 0x03, 0x30, 0x19, 0xa0, 0x05, 0x40, 0x45, 0x04, 0x40, 0x22,
+    0x00, 0x21, 0x31, 0x00, 0x08, 0x1b, 0x00, 0x6b, 0x8b, 0x00, 0x92, 0x30, 0x03, 0x22, 0x40, 0x15,
+    0xa2, 0x80, 0x00, 0x00, 0x87, 0x40, 0x3f, 0x86, 0x94, 0x03, 0xf9, 0xd4, 0x03, 0xa9, 0x00, 0x0d,
+    0x80, 0x16, 0x87, 0xe8, 0x03, 0x40, 0x40, 0xdc, 0x15, 0x00, 0x5e, 0x9c, 0x2f, 0xc0, 0x0c, 0x4f,
+    0x6f, 0xa0, 0x88, 0x00, 0x6a, 0xe2, 0x8b, 0x93, 0x88, 0x01, 0xf1, 0x88, 0x2e, 0x74, 0x02, 0x17,
+    0x40, 0x02, 0xa2, 0x00, 0x00, 0x00, 0xf9, 0x80, 0x3f, 0xe7, 0x00, 0xff, 0xe0, 0x0b, 0x00, 0x75,
+    0x98, 0x04, 0x72, 0x40, 0x11, 0xde, 0x20, 0x04, 0x86, 0xa0, 0x15, 0xea, 0xd8, 0x05, 0x91, 0x80,
+    0x12, 0x20, 0x84, 0x02, 0x64, 0x60, 0x00, 0x88, 0x81, 0x10, 0x08, 0x80, 0x44, 0x02, 0x20, 0x01,
+    0x9a, 0x1b, 0x81, 0x98, 0x0c, 0xd0, 0x02, 0xa0, 0x22, 0x82, 0x20, 0x11, 0x00, 0x10, 0x98, 0x80,
+    0x04, 0x0d, 0x80, 0x35, 0xc5, 0x80, 0x49, 0x18, 0x01, 0x91, 0x20, 0x0a, 0xd1, 0x40, 0x00, 0x00,
+    0xe8, 0x60, 0x0f, 0xe4, 0x60, 0x0f, 0xec, 0x00, 0xea, 0x40, 0x03, 0x60, 0x05, 0xa1, 0xfa, 0x00,
+    0xd0, 0x10, 0x37, 0x05, 0x40, 0x17, 0xa7, 0x0b, 0xf0, 0x03, 0x13, 0xdb, 0xe8, 0x22, 0x00, 0x1a,
+    0xb8, 0xa2, 0xe4, 0xe2, 0x00, 0x7c, 0x62, 0x0b, 0x9d, 0x00, 0x85, 0xd0, 0x00, 0xa8, 0x80, 0x00,
+    0x00, 0xff, 0xe2, 0xb4, 0x84, 0xb0, 0x07, 0xe6, 0x80, 0x86, 0x00, 0xd6, 0x60, 0x11, 0x79, 0x80,
+    0x47, 0x78, 0x80, 0x12, 0x1a, 0x80, 0x57, 0xab, 0x60, 0x16, 0x46, 0x00, 0x48, 0x82, 0x10, 0x09,
+    0x91, 0x80, 0x02, 0x22, 0x04, 0x40, 0x22, 0x01, 0x10, 0x08, 0x80, 0x06, 0x68, 0x6e, 0x06, 0x60,
+    0x33, 0x40, 0x0a, 0x80, 0x8a, 0x08, 0x80, 0x44, 0x00, 0x42, 0x62, 0x00, 0x10, 0x36, 0x00, 0xd7,
+    0x16, 0x01, 0x24, 0x60, 0x06, 0x44, 0x80, 0x2b, 0x45, 0x00, 0x00, 0x00, 0xad, 0x03, 0x44, 0x03,
+    0xd4, 0x81, 0x82, 0x01, 0xe1, 0x00, 0x08, 0x06, 0xa4, 0x00, 0x36, 0x00, 0x5a, 0x1f, 0xa0, 0x0d,
+    0x01, 0x03, 0x70, 0x54, 0x01, 0x7a, 0x70, 0xbf, 0x00, 0x31, 0x3d, 0xbe, 0x82, 0x20, 0x01, 0xab,
+    0x8a, 0x2e, 0x4e, 0x20, 0x07, 0xc6, 0x20, 0xb9, 0xd0, 0x08, 0x5d, 0x00, 0x0a, 0x88, 0x00, 0x00,
+    0x00, 0xff, 0xe3, 0xf0, 0x07, 0xff, 0x03, 0xc0, 0x3d, 0x66, 0x01, 0x1f, 0x10, 0x04, 0x77, 0x88,
+    0x01, 0x21, 0xa8, 0x05, 0x7a, 0xb6, 0x01, 0x64, 0x60, 0x04, 0x88, 0x21, 0x00, 0x99, 0x18, 0x00,
+    0x22, 0x20, 0x44, 0x02, 0x20, 0x11, 0x00, 0x88, 0x00, 0x66, 0x86, 0xe0, 0x66, 0x03, 0x34, 0x00,
+    0xa8, 0x08, 0xa0, 0x88, 0x04, 0x40, 0x04, 0x26, 0x20, 0x01, 0x03, 0x60, 0x0d, 0x71, 0x60, 0x12,
+    0x46, 0x00, 0x64, 0x48, 0x02, 0xb4, 0x50, 0x00, 0x00, 0xc9, 0x40, 0x1f, 0xc9, 0x60, 0x1f, 0xe1,
+    0x00, 0xea, 0x40, 0x03, 0x60, 0x05, 0xa1, 0xfa, 0x00, 0xd0, 0x10, 0x37, 0x05, 0x40, 0x17, 0xa7,
+    0x0b, 0xf0, 0x03, 0x13, 0xdb, 0xe8, 0x22, 0x00, 0x1a, 0xb8, 0xa2, 0xe4, 0xe2, 0x00, 0x7c, 0x62,
+    0x0b, 0x9d, 0x00, 0x85, 0xd0, 0x00, 0xa8, 0x80, 0x00, 0xb3, 0x00, 0x8f, 0xc8, 0x02, 0x3b, 0xc4,
+    0x00, 0x90, 0xd4, 0x02, 0xbd, 0x5b, 0x00, 0xb2, 0x30, 0x02, 0x44, 0x10, 0x80, 0x4c, 0x8c, 0x00,
+    0x11, 0x10, 0x22, 0x01, 0x10, 0x08, 0x80, 0x44, 0x00, 0x33, 0x43, 0x70, 0x33, 0x01, 0x9a, 0x00,
+    0x54, 0x04, 0x50, 0x44, 0x02, 0x20, 0x02, 0x13, 0x10, 0x00, 0x81, 0xb0, 0x06, 0xb8, 0xb0, 0x09,
+    0x23, 0x00, 0x32, 0x24, 0x01, 0x5a, 0x28, 0x06, 0x3f, 0x30, 0x08, 0xfc, 0x80, 0x3f, 0x08, 0x07,
+    0xff, 0x03, 0xc0, 0x3c, 0x00, 0xa4, 0x00, 0x36, 0x00, 0x5a, 0x1f, 0xa0, 0x0d, 0x01, 0x03, 0x70,
+    0x54, 0x01, 0x7a, 0x70, 0xbf, 0x00, 0x31, 0x3d, 0xbe, 0x82, 0x20, 0x01, 0xab, 0x8a, 0x2e, 0x4e,
+    0x20, 0x07, 0xc6, 0x20, 0xb9, 0xd0, 0x08, 0x5d, 0x00, 0x0a, 0x88, 0x00, 0xd9, 0x00, 0x02, 0xf2,
+    0x00, 0xf8, 0x40, 0x3f, 0x92, 0xc0, 0x38, 0x00, 0xff, 0xe0, 0x16, 0x80, 0x7c, 0x58, 0x01, 0x93,
+    0x00, 0x02, 0x03, 0xa2, 0x8a, 0xe0, 0x15, 0x40, 0x84, 0xd1, 0x83, 0x92, 0x80, 0x5f, 0xc7, 0x52,
+    0x01, 0x8a, 0xb3, 0x80, 0x3d, 0xc2, 0xc0, 0x1c, 0xa5, 0xf0, 0x40, 0x10, 0xc5, 0x0c, 0xf0, 0x05,
+    0x52, 0x20, 0x8a, 0xe0, 0xe4, 0x80, 0x14, 0xd9, 0x80, 0x00, 0xb8, 0x03, 0xde, 0x01, 0xe1, 0x00,
+    0x93, 0x00, 0x2c, 0x34, 0xb8, 0x08, 0xb3, 0x07, 0x38, 0x37, 0x00, 0xa1, 0xe0, 0x03, 0x7d, 0x78,
+    0x05, 0x54, 0x5a, 0x90, 0x60, 0x60, 0x63, 0x50, 0x00, 0xff, 0xa1, 0xc2, 0xd0, 0x03, 0x4b, 0x85,
+    0x20, 0x01, 0x30, 0x40, 0x02, 0x2d, 0x14, 0x57, 0x00, 0xaa, 0x04, 0x26, 0x8c, 0x1c, 0x94, 0x02,
+    0xfe, 0x3a, 0x90, 0x0c, 0x55, 0x9c, 0x01, 0xee, 0x16, 0x00, 0xe5, 0x2f, 0x82, 0x00, 0x86, 0x28,
+    0x67, 0x80, 0x2a, 0x91, 0x04, 0x57, 0x07, 0x24, 0x00, 0xa6, 0xcc, 0x06, 0x80, 0x96, 0x00, 0x34,
+    0x84, 0x30, 0x04, 0x20, 0x20, 0x04, 0xc0, 0x0b, 0x0d, 0x2e, 0x02, 0x2c, 0xc1, 0xce, 0x0d, 0xc0,
+    0x28, 0x78, 0x00, 0xdf, 0x5e, 0x01, 0x55, 0x16, 0xa4, 0x18, 0x18, 0x18, 0xd4, 0x00, 0xff, 0xe0,
+    0x16, 0x80, 0x7c, 0x58, 0x01, 0xa2, 0x00, 0x01, 0x00, 0x62, 0x42, 0x98, 0x04, 0xec, 0x81, 0xdc,
+    0x00, 0x15, 0x58, 0x00, 0xd6, 0x03, 0xa4, 0x40, 0x28, 0x49, 0x64, 0x00, 0xef, 0x6b, 0x00, 0xf1,
+    0x10, 0x40, 0x3f, 0xfa, 0x40, 0x00, 0xb8, 0x03, 0xde, 0x01, 0xe1, 0x00, 0xa5, 0x40, 0x24, 0xab,
+    0x90, 0x0b, 0xa4, 0x80, 0x80, 0x5c, 0xc2, 0xa8, 0x0d, 0x40, 0x06, 0x50, 0xb6, 0x00, 0x92, 0x18,
+    0x40, 0x2b, 0x79, 0x00, 0xc6, 0x46, 0x01, 0x9a, 0xc0, 0x21, 0xcd, 0x60, 0x08, 0x00, 0x8d, 0xc0,
+    0x3c, 0x94, 0x94, 0x01, 0xc9, 0x27, 0x40, 0x12, 0x66, 0x76, 0xf8, 0x26, 0x67, 0x24, 0x00, 0x79,
+    0x89, 0xc0, 0x38, 0xee, 0x80, 0x38, 0x7b, 0x82, 0x01, 0xd5, 0x66, 0x01, 0xce, 0x4c, 0x01, 0xc9,
+    0x72, 0x01, 0xc3, 0x3c, 0x01, 0xe9, 0x3e, 0xcc, 0xe0, 0x00, 0x00, 0x4e, 0x10, 0x01, 0x7f, 0x60,
+    0x00, 0xac, 0x34, 0x09, 0x99, 0x6e, 0x93, 0x32, 0x69, 0x00, 0x9c, 0xd0, 0x00, 0x97, 0x00, 0x01,
+    0x9d, 0x00, 0xaa, 0x44, 0x00, 0xa9, 0x19, 0x8b, 0x00, 0x4c, 0xce, 0xdf, 0x04, 0xcc, 0xe4, 0x80,
+    0x0f, 0x31, 0x38, 0x07, 0x1d, 0xd0, 0x07, 0x0f, 0x70, 0x40, 0x3a, 0xac, 0xc0, 0x39, 0xc9, 0x80,
+    0x39, 0x2e, 0x40, 0x38, 0x67, 0x80, 0x3d, 0x27, 0xd9, 0x9c, 0x11, 0xd9, 0x9e, 0x00, 0xe1, 0x00,
+    0xf9, 0x28, 0x03, 0x00, 0x4c, 0xcb, 0x74, 0x99, 0x93, 0x48, 0x04, 0xe6, 0x80, 0x04, 0xb8, 0x00,
+    0x0c, 0xe8, 0x05, 0x52, 0x20, 0x05, 0x48, 0xcc, 0x5a, 0xfe, 0x65, 0x60, 0x10, 0x80, 0x63, 0xa0,
+    0x00, 0x4c, 0xce, 0xdf, 0x04, 0xcc, 0xe4, 0x80, 0x0f, 0x31, 0x38, 0x07, 0x1d, 0xd0, 0x07, 0x0f,
+    0x70, 0x40, 0x3a, 0xac, 0xc0, 0x39, 0xc9, 0x80, 0x39, 0x2e, 0x40, 0x38, 0x67, 0x80, 0x3d, 0x27,
+    0xd9, 0x9c, 0x11, 0xd9, 0x9e, 0x00, 0x9a, 0xee, 0x00, 0x80, 0x4c, 0xcb, 0x74, 0x99, 0x93, 0x48,
+    0x04, 0xe6, 0x80, 0x04, 0xb8, 0x00, 0x0c, 0xe8, 0x05, 0x52, 0x20, 0x05, 0x48, 0xcc, 0x5a, 0xfe,
+    0x65, 0x60, 0xb7, 0x70, 0x00, 0x2c, 0x00, 0xff, 0xe4, 0xc6, 0x6c, 0x00, 0x0f, 0x31, 0xa4, 0xc0,
+    0x68, 0x00, 0xec, 0x00, 0xe7, 0x00, 0xff, 0xe5, 0x16, 0x00, 0x47, 0x40, 0x0b, 0xb9, 0x80, 0x2c,
+    0x05, 0xa2, 0xd0, 0x5b, 0x01, 0x61, 0x10, 0x03, 0x48, 0x01, 0x6b, 0xf0, 0x16, 0xbf, 0x00, 0x1f,
+    0xfc, 0x51, 0x00, 0xdf, 0xe8, 0x00, 0x00, 0xd3, 0x44, 0x01, 0xf1, 0x8c, 0x58, 0x07, 0xc6, 0x31,
+    0x60, 0x1a, 0x90, 0x01, 0xec, 0x40, 0x0d, 0x0f, 0xd0, 0x06, 0x80, 0x81, 0xb8, 0x2a, 0x00, 0xbd,
+    0x38, 0x5f, 0x80, 0x18, 0x9e, 0xdf, 0x41, 0x10, 0x00, 0xd5, 0xc5, 0x17, 0x27, 0x10, 0x03, 0xe3,
+    0x10, 0x5c, 0xe8, 0x04, 0x2e, 0x80, 0x05, 0x44, 0x00, 0x00, 0x00, 0x2d, 0x30, 0x06, 0xea, 0xa0,
+    0x06, 0xea, 0xa0, 0x02, 0x55, 0x54, 0xc9, 0x57, 0x20, 0x17, 0x49, 0x01, 0x00, 0xb9, 0x85, 0x50,
+    0x1a, 0x80, 0x0c, 0xa1, 0x6c, 0x01, 0x24, 0x30, 0x80, 0x56, 0xf2, 0x01, 0x8c, 0x8c, 0x03, 0x35,
+    0x80, 0x43, 0x9a, 0xc0, 0x10, 0x00, 0xa8, 0x40, 0x3b, 0xdc, 0x03, 0xbd, 0xc0, 0x3a, 0x84, 0x02,
+    0x4c, 0xc9, 0x40, 0xa7, 0x31, 0xb0, 0x25, 0x80, 0x10, 0x90, 0x35, 0xd4, 0x80, 0x17, 0x6e, 0xa1,
+    0xc0, 0x06, 0x00, 0x35, 0x05, 0x0c, 0xc5, 0x20, 0x00, 0x00, 0xea, 0x50, 0x05, 0xa8, 0x02, 0x30,
+    0xc5, 0x70, 0xcc, 0x01, 0xff, 0xd3, 0x00, 0x00, 0x16, 0x68, 0x80, 0x26, 0xb4, 0x43, 0x12, 0xa0,
+    0x01, 0x83, 0xd0, 0x01, 0xff, 0xd9, 0x00, 0x1b, 0xcc, 0xbd, 0x82, 0xfb, 0x31, 0xe6, 0xc0, 0x8a,
+    0x03, 0xdc, 0x00, 0xea, 0x82, 0x00, 0xc4, 0xd3, 0x00, 0x18, 0xb7, 0x3e, 0xc0, 0x3c, 0xec, 0x20,
+    0x1e, 0x13, 0x00, 0xe5, 0x02, 0x00, 0x46, 0x6e, 0x68, 0x00, 0x04, 0xcc, 0x90, 0x01, 0x1d, 0x98,
+    0x40, 0x02, 0x50, 0x80, 0x6e, 0x6c, 0xa2, 0x06, 0xce, 0xd8, 0xf1, 0xbb, 0x00, 0x0a, 0x98, 0xc4,
+    0x02, 0x2e, 0x31, 0x00, 0x8b, 0xaa, 0x00, 0x05, 0x4c, 0xfd, 0x98, 0xee, 0x08, 0x00, 0x93, 0xc8,
+    0x03, 0xdc, 0xb4, 0x01, 0xc2, 0x90, 0xc0, 0x1c, 0xe8, 0x44, 0x40, 0x0d, 0x5e, 0x17, 0xc0, 0x11,
+    0x1a, 0x02, 0xa8, 0x40, 0x14, 0x82, 0x04, 0x47, 0x00, 0x33, 0x33, 0x23, 0xa0, 0x43, 0xdc, 0xcb,
+    0xcc, 0xba, 0x00, 0x30, 0xbd, 0x51, 0x40, 0x3a, 0x20, 0x01, 0x84, 0x03, 0xe1, 0xf0, 0x0c, 0x00,
+    0x04, 0xcc, 0x94, 0x0a, 0x73, 0x1b, 0x02, 0x58, 0x01, 0x09, 0x03, 0x5d, 0x48, 0x01, 0x76, 0xea,
+    0x1c, 0x00, 0x60, 0x03, 0x50, 0x50, 0xcc, 0x52, 0x00, 0x27, 0x31, 0x34, 0x60, 0x10, 0x80, 0x7b,
+    0xc0, 0x20, 0x00, 0x96, 0x88, 0x03, 0xca, 0x60, 0x1f, 0xa0, 0x80, 0x3c, 0x9c, 0x40, 0x1e, 0xe7,
+    0xa0, 0x0e, 0x17, 0x85, 0x00, 0xe7, 0x50, 0x44, 0x00, 0x6a, 0xa0, 0x57, 0x00, 0x44, 0xe4, 0x06,
+    0xe2, 0x00, 0xa6, 0xcc, 0x8d, 0xc0, 0x0b, 0xb9, 0x97, 0xd0, 0x23, 0x80, 0x61, 0x02, 0xee, 0x00,
+    0x75, 0x50, 0x00, 0x2d, 0xa0, 0x06, 0x52, 0x60, 0x0e, 0x82, 0x00, 0x93, 0x37, 0x14, 0x0a, 0x73,
+    0x1b, 0x02, 0x58, 0x01, 0x09, 0x03, 0x5d, 0x48, 0x01, 0x76, 0xea, 0x1c, 0x00, 0x60, 0x03, 0x50,
+    0x50, 0xcc, 0x52, 0x00, 0x00, 0xf6, 0x10, 0x07, 0x96, 0x48, 0x03, 0x3d, 0x9a, 0x80, 0x63, 0x0b,
+    0xe2, 0x00, 0xc6, 0x6f, 0xa2, 0x00, 0xee, 0x7a, 0x00, 0xe1, 0x78, 0x50, 0x0e, 0x75, 0x04, 0x40,
+    0x06, 0xaa, 0x05, 0x70, 0x04, 0x4e, 0x40, 0x6e, 0x20, 0x0a, 0x6c, 0xc8, 0xdc, 0x00, 0xbb, 0x99,
+    0x7d, 0x02, 0x38, 0x06, 0x10, 0x2e, 0xe0, 0x07, 0x55, 0x00, 0x00, 0xe8, 0x20, 0x0c, 0x9e, 0x40,
+    0x05, 0xd1, 0x70, 0x01, 0xf6, 0xf1, 0x00, 0x0e, 0xc2, 0xc8, 0x00, 0x99, 0x92, 0x81, 0x4e, 0x63,
+    0x60, 0x4b, 0x00, 0x21, 0x20, 0x6b, 0xa9, 0x00, 0x2e, 0xdd, 0x43, 0x80, 0x0c, 0x00, 0x6a, 0x0a,
+    0x19, 0x8a, 0x40, 0x00, 0x00, 0xc4, 0xa0, 0x1f, 0x14, 0x88, 0x07, 0x0b, 0xf9, 0x00, 0x75, 0x0c,
+    0x98, 0x06, 0x38, 0x6e, 0x20, 0x0c, 0x6f, 0xec, 0x40, 0x1d, 0xcf, 0x40, 0x1c, 0x2f, 0x0a, 0x01,
+    0xce, 0xa0, 0x88, 0x00, 0xd5, 0x40, 0xae, 0x00, 0x89, 0xc8, 0x0d, 0xc4, 0x01, 0x4d, 0x99, 0x1b,
+    0x80, 0x17, 0x73, 0x2f, 0xa0, 0x47, 0x00, 0xc2, 0x05, 0xdc, 0x00, 0xea, 0xa0, 0x00, 0x85, 0x40,
+    0x38, 0x71, 0x00, 0x25, 0xdd, 0x20, 0x00, 0xbb, 0x7c, 0x80, 0x05, 0x61, 0x64, 0x00, 0x4c, 0xc9,
+    0x40, 0xa7, 0x31, 0xb0, 0x25, 0x80, 0x10, 0x90, 0x35, 0xd4, 0x80, 0x17, 0x6e, 0xa1, 0xc0, 0x06,
+    0x00, 0x35, 0x05, 0x0c, 0xc5, 0x20, 0x00, 0x00, 0xc5, 0x2a, 0x01, 0xe3, 0xc3, 0x00, 0xe9, 0x96,
+    0xb0, 0x06, 0x2b, 0x8a, 0x10, 0x0c, 0x4d, 0xe0, 0x20, 0x1d, 0xcf, 0x40, 0x1c, 0x2f, 0x0a, 0x01,
+    0xce, 0xa0, 0x88, 0x00, 0xd5, 0x40, 0xae, 0x00, 0x89, 0xc8, 0x0d, 0xc4, 0x01, 0x4d, 0x99, 0x1b,
+    0x80, 0x17, 0x73, 0x2f, 0xa0, 0x47, 0x00, 0xc2, 0x05, 0xdc, 0x00, 0xea, 0xa0, 0x00, 0x8a, 0x58,
+    0x03, 0x16, 0x88, 0x04, 0xba, 0x0e, 0x00, 0x2e, 0xdf, 0x20, 0x01, 0x58, 0x59, 0x00, 0x13, 0x32,
+    0x50, 0x29, 0xcc, 0x6c, 0x09, 0x60, 0x04, 0x24, 0x0d, 0x75, 0x20, 0x05, 0xdb, 0xa8, 0x70, 0x01,
+    0x80, 0x0d, 0x41, 0x43, 0x31, 0x48, 0x00, 0x00, 0x14, 0xd4, 0x88, 0x06, 0x2a, 0x0b, 0x10, 0x0c,
+    0x51, 0x09, 0x10, 0x0c, 0x56, 0x56, 0x20, 0x1c, 0x9e, 0x40, 0x1e, 0xe7, 0xa0, 0x0e, 0x17, 0x85,
+    0x00, 0xe7, 0x50, 0x44, 0x00, 0x6a, 0xa0, 0x57, 0x00, 0x44, 0xe4, 0x06, 0xe2, 0x00, 0xa6, 0xcc,
+    0x8d, 0xc0, 0x0b, 0xb9, 0x97, 0xd0, 0x23, 0x80, 0x61, 0x02, 0xee, 0x00, 0x75, 0x50, 0x01, 0xa5,
+    0x34, 0x00, 0x2c, 0x84, 0xa8, 0x01, 0x1a, 0x38, 0x40, 0x05, 0xdb, 0xe4, 0x00, 0x2b, 0x0b, 0x20,
+    0x02, 0x66, 0x4a, 0x05, 0x39, 0x8d, 0x81, 0x2c, 0x00, 0x84, 0x81, 0xae, 0xa4, 0x00, 0xbb, 0x75,
+    0x0e, 0x00, 0x30, 0x01, 0xa8, 0x28, 0x66, 0x29, 0x00, 0x00, 0x85, 0xc0, 0x3e, 0xa1, 0xa0, 0x0e,
+    0x38, 0x6e, 0x20, 0x0c, 0x6f, 0xec, 0x40, 0x1d, 0xcb, 0x40, 0x1c, 0x29, 0x0c, 0x01, 0xce, 0x84,
+    0x44, 0x00, 0xd5, 0xe1, 0x7c, 0x01, 0x11, 0xa0, 0x2a, 0x84, 0x01, 0x48, 0x20, 0x44, 0x70, 0x03,
+    0x33, 0x32, 0x3a, 0x04, 0x3d, 0xcc, 0xbc, 0xcb, 0xa0, 0x03, 0x0b, 0xd5, 0x14, 0x03, 0xa2, 0x00,
+    0x18, 0x40, 0x3e, 0x1f, 0x00, 0xc0, 0x00, 0x2e, 0xa8, 0x04, 0x7f, 0xbe, 0x40, 0x03, 0xa0, 0xa2,
+    0x00, 0x26, 0x64, 0xa0, 0x53, 0x98, 0xd8, 0x12, 0xc0, 0x08, 0x48, 0x1a, 0xea, 0x40, 0x0b, 0xb7,
+    0x50, 0xe0, 0x03, 0x00, 0x1a, 0x82, 0x86, 0x62, 0x90, 0x01, 0x39, 0x89, 0xa3, 0x00, 0x84, 0x03,
+    0xde, 0x01, 0x00, 0x00, 0xe7, 0x00, 0xf9, 0xc0, 0x3c, 0x64, 0x28, 0x40, 0x1d, 0x4d, 0x46, 0x01,
+    0x8f, 0xab, 0x04, 0x03, 0x89, 0x5c, 0x03, 0xdc, 0xf4, 0x01, 0xc2, 0xf0, 0xa0, 0x1c, 0xea, 0x08,
+    0x80, 0x0d, 0x54, 0x0a, 0xe0, 0x08, 0x9c, 0x80, 0xdc, 0x40, 0x14, 0xd9, 0x91, 0xb8, 0x01, 0x77,
+    0x32, 0xfa, 0x04, 0x70, 0x0c, 0x20, 0x5d, 0xc0, 0x0e, 0xaa, 0x00, 0x00, 0xce, 0x01, 0xd2, 0x60,
+    0x12, 0x3c, 0x99, 0x80, 0x08, 0x12, 0x06, 0x01, 0x3c, 0xb8, 0x04, 0x99, 0x92, 0x81, 0x4e, 0x63,
+    0x60, 0x4b, 0x00, 0x21, 0x20, 0x6b, 0xa9, 0x00, 0x2e, 0xdd, 0x43, 0x80, 0x0c, 0x00, 0x6a, 0x0a,
+    0x19, 0x8a, 0x40, 0x00, 0x00, 0x9c, 0x03, 0xf7, 0xa8, 0x07, 0x8e, 0x80, 0xc8, 0x03, 0xa9, 0x68,
+    0xc0, 0x31, 0xf5, 0x60, 0x80, 0x71, 0x2b, 0x80, 0x7b, 0x9e, 0x80, 0x38, 0x5e, 0x14, 0x03, 0x9d,
+    0x41, 0x10, 0x01, 0xaa, 0x81, 0x5c, 0x01, 0x13, 0x90, 0x1b, 0x88, 0x02, 0x9b, 0x32, 0x37, 0x00,
+    0x2e, 0xe6, 0x5f, 0x40, 0x8e, 0x01, 0x84, 0x0b, 0xb8, 0x01, 0xd5, 0x40, 0x00, 0x38, 0x07, 0x8e,
+    0x00, 0x32, 0x1c, 0x39, 0x80, 0x10, 0x24, 0x0c, 0x02, 0x79, 0x70, 0x09, 0x33, 0x25, 0x02, 0x9c,
+    0xc6, 0xc0, 0x96, 0x00, 0x42, 0x40, 0xd7, 0x52, 0x00, 0x5d, 0xba, 0x87, 0x00, 0x18, 0x00, 0xd4,
+    0x14, 0x33, 0x14, 0x80, 0x00, 0x00, 0x96, 0x88, 0x03, 0xca, 0x60, 0x1e, 0x45, 0x95, 0x30, 0x0c,
+    0x85, 0x20, 0x60, 0x1c, 0x6c, 0xa0, 0x1e, 0xe7, 0xa0, 0x0e, 0x17, 0x85, 0x00, 0xe7, 0x50, 0x44,
+    0x00, 0x6a, 0xa0, 0x57, 0x00, 0x44, 0xe4, 0x06, 0xe2, 0x00, 0xa6, 0xcc, 0x8d, 0xc0, 0x0b, 0xb9,
+    0x97, 0xd0, 0x23, 0x80, 0x61, 0x02, 0xee, 0x00, 0x75, 0x50, 0x00, 0x2d, 0x18, 0x06, 0x52, 0x10,
+    0x09, 0x1e, 0x14, 0xc0, 0x08, 0x12, 0x06, 0x01, 0x3c, 0xb8, 0x04, 0x99, 0x92, 0x81, 0x4e, 0x63,
+    0x60, 0x4b, 0x00, 0x21, 0x20, 0x6b, 0xa9, 0x00, 0x2e, 0xdd, 0x43, 0x80, 0x0c, 0x00, 0x6a, 0x0a,
+    0x19, 0x8a, 0x40, 0x00, 0x00, 0x14, 0xd4, 0x90, 0x07, 0x45, 0x58, 0x07, 0x0b, 0x05, 0x98, 0x06,
+    0x31, 0xac, 0x10, 0x0e, 0x25, 0x70, 0x0f, 0x73, 0xd0, 0x07, 0x0b, 0xc2, 0x80, 0x73, 0xa8, 0x22,
+    0x00, 0x35, 0x50, 0x2b, 0x80, 0x22, 0x72, 0x03, 0x71, 0x00, 0x53, 0x66, 0x46, 0xe0, 0x05, 0xdc,
+    0xcb, 0xe8, 0x11, 0xc0, 0x30, 0x81, 0x77, 0x00, 0x3a, 0xa8, 0x00, 0x00, 0x53, 0x1a, 0x80, 0x0f,
+    0x8e, 0x50, 0x00, 0xe6, 0xba, 0xa0, 0x04, 0x09, 0x04, 0x00, 0x9e, 0x5c, 0x02, 0x4c, 0xc9, 0x40,
+    0xa7, 0x31, 0xb0, 0x25, 0x80, 0x10, 0x90, 0x35, 0xd4, 0x80, 0x17, 0x6e, 0xa1, 0xc0, 0x06, 0x00,
+    0x35, 0x05, 0x0c, 0xc5, 0x20, 0x00, 0x00, 0x23, 0x04, 0x18, 0x06, 0x41, 0x9e, 0x30, 0x0e, 0x36,
+    0x40, 0x0f, 0x72, 0xd0, 0x07, 0x0a, 0x43, 0x00, 0x73, 0xa1, 0x11, 0x00, 0x35, 0x78, 0x5f, 0x00,
+    0x44, 0x68, 0x0a, 0xa1, 0x00, 0x52, 0x08, 0x11, 0x1c, 0x00, 0xcc, 0xcc, 0x8e, 0x81, 0x0f, 0x73,
+    0x2f, 0x32, 0xe8, 0x00, 0xc2, 0xf5, 0x45, 0x00, 0xe8, 0x80, 0x06, 0x10, 0x0f, 0x87, 0xc0, 0x30,
+    0x05, 0x50, 0x2a, 0x00, 0x13, 0x03, 0x14, 0x00, 0x39, 0x58, 0x20, 0x04, 0x96, 0x95, 0x02, 0x9c,
+    0xc6, 0xc0, 0x96, 0x00, 0x42, 0x40, 0xd7, 0x52, 0x00, 0x5d, 0xba, 0x87, 0x00, 0x18, 0x00, 0xd4,
+    0x14, 0x33, 0x14, 0x80, 0x09, 0xcc, 0x4d, 0x18, 0x04, 0x20, 0x1e, 0xf0, 0x08, 0xec, 0xce, 0x60,
+    0xcc, 0xe6, 0x00, 0xff, 0xe5, 0x66, 0x70, 0x86, 0x67, 0x08, 0x07, 0xff, 0x0f, 0x33, 0x9b, 0xb3,
+    0x39, 0x80, 0x21, 0x00, 0xe3, 0xd0, 0x08, 0x02, 0xbc, 0xc3, 0x00, 0x3e, 0x73, 0x25, 0x58, 0x80,
+    0x17, 0x24, 0xb7, 0x75, 0x00, 0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x0a,
+    0xf3, 0x10, 0x01, 0x84, 0x03, 0xda, 0x60, 0x00, 0x00, 0x35, 0x08, 0x06, 0x61, 0x10, 0x07, 0x50,
+    0x05, 0xd9, 0x8d, 0xcc, 0x30, 0x66, 0x73, 0x00, 0x7f, 0xf2, 0xb3, 0x38, 0x43, 0x33, 0x84, 0x03,
+    0xff, 0x87, 0x99, 0xcc, 0x00, 0x00, 0x15, 0x38, 0x06, 0x2c, 0x20, 0x0e, 0x75, 0x00, 0x8a, 0xf7,
+    0x18, 0x01, 0xf3, 0x99, 0x2a, 0xc4, 0x00, 0xb9, 0x25, 0xbb, 0xa8, 0x06, 0xae, 0xf6, 0x3d, 0x10,
+    0x01, 0xe4, 0x7e, 0x73, 0x1f, 0x20, 0x03, 0xa3, 0x62, 0x00, 0x2d, 0xa7, 0x90, 0x01, 0x85, 0xe4,
+    0x01, 0xd9, 0x9c, 0xc1, 0x99, 0xcc, 0x01, 0xff, 0xca, 0xcc, 0xe1, 0x0c, 0xce, 0x10, 0x0f, 0xfe,
+    0x1e, 0x67, 0x30, 0x00, 0x5c, 0x0c, 0x80, 0x0b, 0x6a, 0xe8, 0x00, 0x4c, 0x54, 0x60, 0x02, 0xbc,
+    0xc3, 0x00, 0x3e, 0x73, 0x25, 0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00, 0xd5, 0xde, 0xc7, 0xa2,
+    0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x00, 0xc3, 0x82, 0x01, 0x9f, 0xc4, 0x01, 0x36, 0xa6, 0x00,
+    0x5c, 0xba, 0x10, 0xe9, 0x96, 0x2e, 0xb0, 0x66, 0x73, 0x00, 0x7f, 0xf2, 0xb3, 0x38, 0x43, 0x33,
+    0x84, 0x03, 0xff, 0x87, 0x99, 0xcc, 0x00, 0x00, 0xe6, 0x40, 0x0c, 0x3e, 0x80, 0x02, 0xc9, 0x90,
+    0x00, 0x7b, 0x41, 0x40, 0x03, 0x83, 0x0a, 0x00, 0x2b, 0xcc, 0x30, 0x03, 0xe7, 0x32, 0x55, 0x88,
+    0x01, 0x72, 0x4b, 0x77, 0x50, 0x0d, 0x5d, 0xec, 0x7a, 0x20, 0x03, 0xc8, 0xfc, 0xe6, 0x3e, 0x40,
+    0x00, 0x90, 0xc0, 0x39, 0x7c, 0x03, 0x13, 0x41, 0x00, 0x06, 0x47, 0x08, 0x00, 0xb2, 0xdc, 0x21,
+    0xd1, 0xd9, 0x5a, 0xc1, 0x99, 0xcc, 0x01, 0xff, 0xca, 0xcc, 0xe1, 0x0c, 0xce, 0x10, 0x0f, 0xfe,
+    0x1e, 0x67, 0x30, 0x00, 0xce, 0x01, 0xe2, 0x70, 0x08, 0xb7, 0x4e, 0x01, 0x76, 0x0a, 0x00, 0x5a,
+    0x32, 0xa0, 0x02, 0xac, 0xc3, 0x80, 0x3e, 0x73, 0x25, 0x58, 0x80, 0x17, 0x24, 0xb7, 0x75, 0x00,
+    0xd5, 0xde, 0xc7, 0xa2, 0x00, 0x3c, 0x8f, 0xce, 0x63, 0xe4, 0x00, 0x92, 0x8c, 0x03, 0x2e, 0x80,
+    0x43, 0x52, 0x26, 0x00, 0x3b, 0x85, 0x00, 0x77, 0x37, 0x3f, 0x18, 0x33, 0x39, 0x80, 0x3f, 0xf9,
+    0x59, 0x9c, 0x21, 0x99, 0xc2, 0x01, 0xff, 0xc3, 0xcc, 0xe6, 0x00, 0x00, 0xd3, 0x00, 0x1d, 0x62,
+    0x01, 0x16, 0xd4, 0x80, 0x5d, 0x82, 0x80, 0x16, 0x8c, 0xa8, 0x00, 0xab, 0x30, 0xe0, 0x0f, 0x9c,
+    0xc9, 0x56, 0x20, 0x05, 0xc9, 0x2d, 0xdd, 0x40, 0x35, 0x77, 0xb1, 0xe8, 0x80, 0x0f, 0x23, 0xf3,
+    0x98, 0xf9, 0x00, 0x03, 0x9a, 0x80, 0x08, 0xf4, 0xe4, 0x02, 0x3e, 0xba, 0x00, 0x8a, 0x8a, 0x80,
+    0x1d, 0xb9, 0x8d, 0xc6, 0x0c, 0xce, 0x60, 0x0f, 0xfe, 0x56, 0x67, 0x08, 0x66, 0x70, 0x80, 0x7f,
+    0xf0, 0xf3, 0x39, 0x80, 0x00, 0x4b, 0x8b, 0x80, 0x07, 0xd2, 0xd0, 0x00, 0x29, 0xc4, 0x60, 0x17,
+    0x60, 0xa0, 0x05, 0xa3, 0x2a, 0x00, 0x2a, 0xcc, 0x38, 0x03, 0xe7, 0x32, 0x55, 0x88, 0x01, 0x72,
+    0x4b, 0x77, 0x50, 0x0d, 0x5d, 0xec, 0x7a, 0x20, 0x03, 0xc8, 0xfc, 0xe6, 0x3e, 0x40, 0x00, 0x13,
+    0x80, 0x61, 0x91, 0x80, 0x09, 0x65, 0xb8, 0x43, 0xa3, 0xb2, 0xb5, 0x83, 0x33, 0x98, 0x03, 0xff,
+    0x95, 0x99, 0xc2, 0x19, 0x9c, 0x20, 0x1f, 0xfc, 0x3c, 0xce, 0x6e, 0xcc, 0xe6, 0x00, 0x84, 0x03,
+    0x8f, 0x40, 0x20, 0x00, 0x1e, 0x40, 0x04, 0x31, 0xa0, 0xa0, 0x01, 0xb1, 0x85, 0x00, 0x15, 0xe6,
+    0x18, 0x01, 0xf3, 0x99, 0x2a, 0xc4, 0x00, 0xb9, 0x25, 0xbb, 0xa8, 0x06, 0xae, 0xf6, 0x3d, 0x10,
+    0x01, 0xe4, 0x7e, 0x73, 0x1f, 0x20, 0x57, 0x98, 0x80, 0x0c, 0x20, 0x1e, 0xd3, 0x00, 0x00, 0x4a,
+    0x34, 0x20, 0x04, 0x98, 0x78, 0x07, 0xff, 0x40, 0x6c, 0x16, 0x71, 0x0b, 0x02, 0xc0, 0x0f, 0xfe,
+    0x38, 0x0e, 0x00, 0xff, 0xe8, 0xf0, 0x00, 0x40, 0x1e, 0x00, 0x2c, 0x2d, 0x01, 0x2c, 0x00, 0xff,
+    0xe0, 0x16, 0x00, 0x96, 0x80, 0x00, 0x15, 0x6e, 0xad, 0x00, 0x23, 0xf9, 0xdd, 0x4c, 0x28, 0x03,
+    0xb8, 0x60, 0x02, 0xd8, 0x13, 0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07, 0xf9, 0x94,
+    0x03, 0xdf, 0xa6, 0x26, 0x01, 0x85, 0x10, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc, 0x6e, 0xba,
+    0x14, 0x02, 0x2b, 0xdd, 0x62, 0x00, 0x7c, 0x20, 0x1f, 0x9a, 0x00, 0x30, 0x02, 0xbc, 0xc3, 0x80,
+    0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18, 0x02, 0x64, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a,
+    0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66, 0x39, 0xc0, 0x05, 0x79, 0x87, 0x00, 0xe1, 0x00, 0xfa, 0x90,
+    0x02, 0x00, 0x00, 0xd1, 0x20, 0x1f, 0xa0, 0x80, 0x3f, 0xa8, 0x03, 0xc5, 0x5b, 0x96, 0x80, 0x11,
+    0xfc, 0xee, 0xa6, 0x14, 0x01, 0xdc, 0x30, 0x01, 0x6c, 0x09, 0x89, 0x80, 0x61, 0x44, 0x32, 0x80,
+    0x7b, 0xf4, 0x03, 0xfc, 0xca, 0x01, 0xef, 0xd3, 0x13, 0x00, 0xc2, 0x88, 0x0e, 0xe1, 0x80, 0x0b,
+    0x60, 0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0x15, 0x40, 0x07, 0x17, 0xf0, 0x07, 0x91, 0x80,
+    0x31, 0x5e, 0xe3, 0x80, 0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18, 0x02, 0x64, 0x05, 0xc0, 0x18, 0xc0,
+    0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66, 0x39, 0xc0, 0x00, 0xf0, 0xc8, 0x07,
+    0xeb, 0xa0, 0x0f, 0x44, 0xd9, 0x80, 0x74, 0x75, 0x58, 0x07, 0xa1, 0x8e, 0x80, 0x38, 0xab, 0x75,
+    0x68, 0x01, 0x1f, 0xce, 0xea, 0x61, 0x40, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x98, 0x98, 0x06, 0x14,
+    0x43, 0x28, 0x07, 0xbf, 0x40, 0x3f, 0xcc, 0xa0, 0x1e, 0xfd, 0x31, 0x30, 0x0c, 0x28, 0x80, 0xee,
+    0x18, 0x00, 0xb6, 0x04, 0x0f, 0xe3, 0x75, 0xd0, 0xa0, 0x00, 0x00, 0xe5, 0x50, 0x07, 0x0e, 0x28,
+    0x04, 0x59, 0x12, 0x01, 0xbb, 0x79, 0x80, 0x36, 0x0b, 0xb0, 0x04, 0x57, 0x98, 0x70, 0x0b, 0xe3,
+    0x31, 0xce, 0x0a, 0xa3, 0x00, 0x4c, 0x80, 0xb8, 0x03, 0x18, 0x17, 0x00, 0x63, 0x05, 0x51, 0x80,
+    0x26, 0x40, 0x0f, 0x8c, 0xc7, 0x38, 0x00, 0x00, 0xe5, 0x20, 0x0f, 0xcd, 0x00, 0x1f, 0x23, 0x78,
+    0x07, 0x8f, 0xf0, 0x03, 0xe5, 0xa9, 0x30, 0x0e, 0x2c, 0xc6, 0xe9, 0x00, 0x23, 0xf9, 0xdd, 0x4c,
+    0x28, 0x03, 0xb8, 0x60, 0x02, 0xd8, 0x13, 0x13, 0x00, 0xc2, 0x88, 0x65, 0x00, 0xf7, 0xe8, 0x07,
+    0xf9, 0x94, 0x03, 0xdf, 0xa6, 0x26, 0x01, 0x85, 0x10, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc,
+    0x6e, 0xba, 0x14, 0x00, 0x00, 0xce, 0x01, 0xf1, 0x40, 0x06, 0x2d, 0xc8, 0x00, 0xd3, 0xe0, 0xa0,
+    0x1a, 0x8a, 0x50, 0x02, 0x2a, 0xcc, 0x30, 0x05, 0xf1, 0x98, 0xe7, 0x05, 0x51, 0x80, 0x26, 0x40,
+    0x5c, 0x01, 0x8c, 0x0b, 0x80, 0x31, 0x82, 0xa8, 0xc0, 0x13, 0x20, 0x07, 0xc6, 0x63, 0x9c, 0x00,
+    0x00, 0xe6, 0xa1, 0x00, 0xf9, 0x80, 0x3f, 0x3c, 0xd0, 0x80, 0x73, 0x7e, 0x40, 0x07, 0x92, 0x16,
+    0x80, 0x38, 0xa3, 0x75, 0x28, 0x01, 0x1f, 0xce, 0xea, 0x61, 0x40, 0x1d, 0xc3, 0x00, 0x16, 0xc0,
+    0x98, 0x98, 0x06, 0x14, 0x43, 0x28, 0x07, 0xbf, 0x40, 0x3f, 0xcc, 0xa0, 0x1e, 0xfd, 0x31, 0x30,
+    0x0c, 0x28, 0x80, 0xee, 0x18, 0x00, 0xb6, 0x04, 0x0f, 0xe3, 0x75, 0xd0, 0xa0, 0x00, 0x00, 0xd3,
+    0x20, 0x0f, 0x41, 0x80, 0x62, 0xd8, 0xa0, 0x0d, 0x3e, 0x0a, 0x01, 0xa8, 0xa5, 0x00, 0x22, 0xac,
+    0xc3, 0x00, 0x5f, 0x19, 0x8e, 0x70, 0x55, 0x18, 0x02, 0x64, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03,
+    0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00, 0x7c, 0x66, 0x39, 0xc0, 0x00, 0x96, 0x69, 0xc0, 0x3c, 0xbe,
+    0x4e, 0x01, 0xe5, 0xee, 0x40, 0x07, 0x9a, 0x1a, 0x80, 0x38, 0xa7, 0x75, 0x28, 0x01, 0x1f, 0xce,
+    0xea, 0x61, 0x40, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x98, 0x98, 0x06, 0x14, 0x43, 0x28, 0x07, 0xbf,
+    0x40, 0x3f, 0xcc, 0xa0, 0x1e, 0xfd, 0x31, 0x30, 0x0c, 0x28, 0x80, 0xee, 0x18, 0x00, 0xb6, 0x04,
+    0x0f, 0xe3, 0x75, 0xd0, 0xa0, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x6e, 0xaa, 0x58, 0x06, 0x5f, 0x33,
+    0x00, 0x69, 0xf0, 0x50, 0x0d, 0x45, 0x28, 0x01, 0x15, 0x66, 0x18, 0x02, 0xf8, 0xcc, 0x73, 0x82,
+    0xa8, 0xc0, 0x13, 0x20, 0x2e, 0x00, 0xc6, 0x05, 0xc0, 0x18, 0xc1, 0x54, 0x60, 0x09, 0x90, 0x03,
+    0xe3, 0x31, 0xce, 0x00, 0x00, 0xc8, 0xa0, 0x1f, 0x1f, 0xe2, 0x80, 0x79, 0x6a, 0x4c, 0x03, 0x8b,
+    0x31, 0xba, 0x40, 0x08, 0xfe, 0x77, 0x53, 0x0a, 0x00, 0xee, 0x18, 0x00, 0xb6, 0x04, 0xc4, 0xc0,
+    0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x65, 0x00, 0xf7, 0xe9, 0x89, 0x80, 0x61, 0x44,
+    0x07, 0x70, 0xc0, 0x05, 0xb0, 0x20, 0x7f, 0x1b, 0xae, 0x85, 0x00, 0x8a, 0xf7, 0x58, 0x80, 0x1f,
+    0x08, 0x07, 0xe6, 0x80, 0x0c, 0x00, 0x00, 0x16, 0x48, 0x07, 0x4e, 0xf3, 0x00, 0x6b, 0x17, 0x60,
+    0x08, 0xaf, 0x30, 0xe0, 0x17, 0xc6, 0x63, 0x9c, 0x15, 0x46, 0x00, 0x99, 0x01, 0x70, 0x06, 0x30,
+    0x2e, 0x00, 0xc6, 0x0a, 0xa3, 0x00, 0x4c, 0x80, 0x1f, 0x19, 0x8e, 0x70, 0x01, 0x5e, 0x61, 0xc0,
+    0x38, 0x40, 0x3e, 0xa4, 0x00, 0x80, 0x00, 0xe4, 0x30, 0x0f, 0xd0, 0x40, 0x48, 0x01, 0x86, 0x04,
+    0x1f, 0x40, 0x05, 0x59, 0x5f, 0xe8, 0xd0, 0x3f, 0xed, 0xed, 0x38, 0x40, 0xee, 0x20, 0x00, 0xb6,
+    0x04, 0xc4, 0xc0, 0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x62, 0x00, 0xf7, 0x69, 0xb1,
+    0x80, 0x61, 0x54, 0x0e, 0xe1, 0x80, 0x0b, 0x60, 0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0xda,
+    0x20, 0x1c, 0xb4, 0x2c, 0x20, 0x12, 0x38, 0x69, 0x81, 0x55, 0xe7, 0x99, 0x07, 0xdd, 0x63, 0xf8,
+    0x2a, 0x84, 0x01, 0x12, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32, 0x00,
+    0x7c, 0x66, 0x39, 0xc0, 0x00, 0x89, 0x40, 0x3f, 0x14, 0x88, 0x00, 0x90, 0x03, 0x79, 0x00, 0x1f,
+    0x40, 0x05, 0x5d, 0xbf, 0xe8, 0xd0, 0x3f, 0xed, 0xed, 0x38, 0x40, 0xee, 0x20, 0x00, 0xb6, 0x04,
+    0xc4, 0xc0, 0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x62, 0x00, 0xf7, 0x69, 0xb1, 0x80,
+    0x61, 0x54, 0x0e, 0xe1, 0x80, 0x0b, 0x60, 0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0x3b, 0x80,
+    0x3c, 0xf6, 0x00, 0x61, 0x00, 0xb4, 0x01, 0xa6, 0x05, 0x57, 0x9e, 0x64, 0x1f, 0x75, 0x8f, 0xe0,
+    0xaa, 0x10, 0x04, 0x48, 0x17, 0x00, 0x63, 0x02, 0xe0, 0x0c, 0x60, 0xaa, 0x30, 0x04, 0xc8, 0x01,
+    0xf1, 0x98, 0xe7, 0x00, 0x00, 0xd1, 0x20, 0x1f, 0xa0, 0x80, 0x04, 0x80, 0x1d, 0x40, 0x07, 0xd0,
+    0x01, 0x56, 0xff, 0xd1, 0xa0, 0x7f, 0xdb, 0xda, 0x70, 0x81, 0xdc, 0x40, 0x01, 0x6c, 0x09, 0x89,
+    0x80, 0x61, 0x44, 0x32, 0x80, 0x7b, 0xf4, 0x03, 0xfc, 0xc4, 0x01, 0xee, 0xd3, 0x63, 0x00, 0xc2,
+    0xa8, 0x1d, 0xc3, 0x00, 0x16, 0xc0, 0x81, 0xfc, 0x6e, 0xba, 0x14, 0x00, 0x00, 0x15, 0x40, 0x07,
+    0x17, 0xf0, 0x38, 0x80, 0x48, 0xc1, 0x86, 0x05, 0x57, 0x9e, 0x64, 0x1f, 0x75, 0x8f, 0xe0, 0xaa,
+    0x10, 0x04, 0x48, 0x17, 0x00, 0x63, 0x02, 0xe0, 0x0c, 0x60, 0xaa, 0x30, 0x04, 0xc8, 0x01, 0xf1,
+    0x98, 0xe7, 0x00, 0x00, 0x96, 0x46, 0x00, 0x3d, 0xb3, 0x2f, 0x02, 0x40, 0x0a, 0x02, 0x1c, 0x1f,
+    0x40, 0x05, 0x5b, 0xdf, 0xe8, 0xd0, 0x3f, 0xed, 0xed, 0x38, 0x40, 0xee, 0x20, 0x00, 0xb6, 0x04,
+    0xc4, 0xc0, 0x30, 0xa2, 0x19, 0x40, 0x3d, 0xfa, 0x01, 0xfe, 0x62, 0x00, 0xf7, 0x69, 0xb1, 0x80,
+    0x61, 0x54, 0x0e, 0xe1, 0x80, 0x0b, 0x60, 0x40, 0xfe, 0x37, 0x5d, 0x0a, 0x00, 0x00, 0x5c, 0x84,
+    0x80, 0x43, 0x91, 0x54, 0x51, 0x01, 0x71, 0xa3, 0xe3, 0x02, 0xaa, 0x67, 0x99, 0x07, 0xdd, 0x63,
+    0xf8, 0x2a, 0x84, 0x01, 0x12, 0x05, 0xc0, 0x18, 0xc0, 0xb8, 0x03, 0x18, 0x2a, 0x8c, 0x01, 0x32,
+    0x00, 0x7c, 0x66, 0x39, 0xc0, 0x00, 0xfc, 0xb2, 0x00, 0x2a, 0xde, 0xff, 0x46, 0x01, 0xff, 0x6f,
+    0x69, 0xc2, 0x87, 0x71, 0x00, 0x05, 0xb0, 0x26, 0x26, 0x01, 0x85, 0x10, 0xca, 0x01, 0xef, 0xd0,
+    0x0f, 0xf3, 0x10, 0x07, 0xbb, 0x4d, 0x8c, 0x03, 0x0a, 0xa0, 0x77, 0x0c, 0x00, 0x5b, 0x02, 0x07,
+    0xf1, 0xba, 0xe8, 0x50, 0x08, 0xaf, 0x75, 0x88, 0x01, 0xf0, 0x80, 0x7e, 0x68, 0x00, 0xc0, 0x00,
+    0xf5, 0x90, 0x15, 0x53, 0x3c, 0x88, 0x1f, 0x75, 0x8f, 0xc0, 0xaa, 0x10, 0x04, 0x48, 0x17, 0x00,
+    0x63, 0x02, 0xe0, 0x0c, 0x60, 0xaa, 0x30, 0x04, 0xc8, 0x01, 0xf1, 0x98, 0xe7, 0x00, 0x15, 0xe6,
+    0x1c, 0x03, 0x84, 0x03, 0xea, 0x40, 0x08, 0x0e, 0x00, 0xe3, 0xb0, 0x0f, 0xff, 0x43, 0x88, 0x18,
+    0x80, 0x63, 0x20, 0xbd, 0x10, 0x02, 0x54, 0x83, 0x4e, 0xed, 0xde, 0x20, 0x05, 0xcd, 0xd5, 0x10,
+    0x07, 0x08, 0x07, 0xeb, 0x50, 0x08, 0x2c, 0x00, 0x8e, 0x80, 0x3f, 0xf9, 0x26, 0x01, 0x9c, 0x04,
+    0x46, 0x00, 0xe0, 0x07, 0x7e, 0x5e, 0x00, 0x0f, 0x31, 0x6d, 0x40, 0x10, 0x80, 0x7a, 0xd0, 0x00,
+    0x00, 0x00, 0x86, 0x58, 0x03, 0xc3, 0x5c, 0x01, 0xf1, 0xc0, 0x06, 0xe0, 0x0e, 0x3b, 0x00, 0xff,
+    0xf4, 0x38, 0x81, 0x88, 0x06, 0x32, 0x0b, 0xd1, 0x00, 0x25, 0x48, 0x34, 0xee, 0xdd, 0xe2, 0x00,
+    0x00, 0x15, 0x40, 0x06, 0x2f, 0xe0, 0x0e, 0x56, 0x00, 0x16, 0x00, 0x47, 0x40, 0x1f, 0xfc, 0x93,
+    0x00, 0xce, 0x02, 0x23, 0x00, 0x70, 0x03, 0xbf, 0x2f, 0x00, 0x00, 0xe6, 0x10, 0x0f, 0x8b, 0x44,
+    0x00, 0xe0, 0x18, 0x64, 0x02, 0x90, 0xe0, 0x01, 0x90, 0x1f, 0x48, 0x07, 0xe5, 0x70, 0x0f, 0xff,
+    0x1b, 0x88, 0x00, 0xc4, 0x03, 0x19, 0x00, 0x2f, 0x44, 0x00, 0x95, 0x20, 0x06, 0x9d, 0xdb, 0xbc,
+    0x40, 0x00, 0xda, 0x20, 0x1c, 0xd6, 0x21, 0x00, 0x13, 0x30, 0x00, 0xa5, 0x80, 0x11, 0xec, 0x00,
+    0x79, 0xd4, 0x03, 0xff, 0x88, 0x60, 0x19, 0xc0, 0x02, 0x23, 0x00, 0x70, 0x05, 0xdf, 0x97, 0x80,
+    0x00, 0x00, 0x90, 0xc0, 0x3f, 0x34, 0x00, 0x67, 0x00, 0x8b, 0x80, 0x34, 0x87, 0x00, 0x14, 0x00,
+    0x7d, 0x20, 0x1f, 0x95, 0xc0, 0x3f, 0xfc, 0x6e, 0x20, 0x03, 0x10, 0x0c, 0x64, 0x00, 0xbd, 0x10,
+    0x02, 0x54, 0x80, 0x1a, 0x77, 0x6e, 0xf1, 0x00, 0x00, 0x3b, 0x80, 0x3c, 0xf6, 0x01, 0x40, 0x05,
+    0x80, 0x12, 0x96, 0x00, 0x47, 0xb0, 0x01, 0xe7, 0x50, 0x0f, 0xfe, 0x21, 0x80, 0x67, 0x00, 0x08,
+    0x8c, 0x01, 0xc0, 0x17, 0x7e, 0x5e, 0x00, 0x00, 0x00, 0x86, 0x58, 0x03, 0xe1, 0xae, 0x00, 0x9c,
+    0x03, 0x1c, 0x00, 0x52, 0x1c, 0x01, 0xc7, 0xd2, 0x01, 0xf9, 0x5c, 0x03, 0xff, 0xc6, 0xe2, 0x00,
+    0x31, 0x00, 0xc6, 0x40, 0x0b, 0xd1, 0x00, 0x25, 0x48, 0x01, 0xa7, 0x76, 0xef, 0x10, 0x00, 0x00,
+    0x15, 0x40, 0x07, 0x17, 0xf0, 0x02, 0x40, 0x25, 0x60, 0x02, 0x16, 0x00, 0x47, 0xb0, 0x01, 0xe7,
+    0x50, 0x0f, 0xfe, 0x21, 0x80, 0x67, 0x00, 0x08, 0x8c, 0x01, 0xc0, 0x17, 0x7e, 0x5e, 0x00, 0x00,
+    0x00, 0xa2, 0x01, 0x00, 0x1f, 0x55, 0x30, 0x00, 0xc0, 0x14, 0x15, 0x20, 0x02, 0x03, 0x80, 0x38,
+    0xfa, 0x40, 0x3f, 0x2b, 0x80, 0x7f, 0xf8, 0xdc, 0x40, 0x06, 0x20, 0x18, 0xc8, 0x01, 0x7a, 0x20,
+    0x04, 0xa9, 0x00, 0x34, 0xee, 0xdd, 0xe2, 0x00, 0x00, 0x5c, 0x84, 0x80, 0x43, 0x91, 0x54, 0x06,
+    0x01, 0x71, 0xa3, 0x0b, 0x2c, 0x00, 0x8f, 0x60, 0x03, 0xce, 0xa0, 0x1f, 0xfc, 0x43, 0x00, 0xce,
+    0x00, 0x11, 0x18, 0x03, 0x80, 0x2e, 0xfc, 0xbc, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xe0, 0x0e, 0x3e,
+    0x60, 0x0f, 0xcb, 0x00, 0x1f, 0xfe, 0x37, 0x10, 0x01, 0x88, 0x06, 0x32, 0x00, 0x5e, 0x88, 0x01,
+    0x2a, 0x40, 0x0d, 0x3b, 0xb7, 0x78, 0x80, 0x4b, 0x9b, 0xaa, 0x20, 0x0f, 0x08, 0x07, 0xf5, 0xa8,
+    0x06, 0x00, 0x00, 0xfb, 0x4b, 0x00, 0x23, 0xdb, 0x00, 0xf3, 0xb0, 0x07, 0xff, 0x10, 0xc0, 0x33,
+    0x80, 0x04, 0x46, 0x00, 0xe0, 0x0b, 0xbf, 0x2f, 0x00, 0x23, 0xcc, 0x5b, 0x50, 0x06, 0x10, 0x0f,
+    0xad, 0x00, 0x20, 0x00, 0x9c, 0x03, 0xf7, 0xa8, 0x07, 0xd0, 0x01, 0xd1, 0x00, 0x02, 0x80, 0x31,
+    0x21, 0x4c, 0x02, 0x76, 0x40, 0xee, 0x00, 0x0a, 0xac, 0x00, 0x6b, 0x01, 0xd2, 0x20, 0x14, 0x24,
+    0xb2, 0x00, 0x77, 0xb5, 0x80, 0x78, 0x88, 0x20, 0x1f, 0xfd, 0x20, 0x00, 0x59, 0x80, 0x74, 0xc8,
+    0x03, 0x8a, 0x80, 0x29, 0x50, 0x09, 0x2a, 0xe4, 0x02, 0xe9, 0x20, 0x20, 0x17, 0x30, 0xaa, 0x03,
+    0x50, 0x01, 0x94, 0x2d, 0x80, 0x24, 0x86, 0x10, 0x0a, 0xde, 0x40, 0x31, 0x91, 0x80, 0x66, 0xb0,
+    0x08, 0x73, 0x58, 0x02, 0x00, 0x88, 0x00, 0x76, 0x24, 0x29, 0x80, 0x4e, 0xc8, 0x1d, 0xc0, 0x01,
+    0x55, 0x80, 0x0d, 0x60, 0x3a, 0x44, 0x02, 0x84, 0x96, 0x40, 0x0e, 0xf6, 0xb0, 0x0f, 0x11, 0x04,
+    0x03, 0xff, 0xaa, 0x3a, 0x01, 0xf8, 0x40, 0x3e, 0x2c, 0x00, 0xc0, 0x95, 0x00, 0x92, 0xae, 0x40,
+    0x2e, 0x92, 0x02, 0x01, 0x73, 0x0a, 0xa0, 0x35, 0x00, 0x19, 0x42, 0xd8, 0x02, 0x48, 0x61, 0x00,
+    0xad, 0xe4, 0x03, 0x19, 0x18, 0x06, 0x6b, 0x01, 0x01, 0xcd, 0x65, 0xb0, 0x00, 0x00, 0x9a, 0x84,
+    0x03, 0xcc, 0x01, 0xfd, 0x62, 0x01, 0x44, 0x00, 0x02, 0x00, 0xc4, 0x85, 0x30, 0x09, 0xd9, 0x03,
+    0xb8, 0x00, 0x2a, 0xb0, 0x01, 0xac, 0x07, 0x48, 0x80, 0x50, 0x92, 0xc8, 0x01, 0xde, 0xd6, 0x01,
+    0xe2, 0x20, 0x80, 0x7f, 0xf4, 0x80, 0x00, 0x25, 0xa0, 0x06, 0x42, 0x60, 0x0e, 0x92, 0x00, 0x4a,
+    0x80, 0x49, 0x57, 0x20, 0x17, 0x49, 0x01, 0x00, 0xb9, 0x85, 0x50, 0x1a, 0x80, 0x0c, 0xa1, 0x6c,
+    0x01, 0x24, 0x30, 0x80, 0x56, 0xf2, 0x01, 0x8c, 0x8c, 0x03, 0x35, 0x80, 0x43, 0x9a, 0xc0, 0x10,
+    0x00, 0x15, 0x22, 0x98, 0x06, 0x78, 0x2f, 0x30, 0x0c, 0xa4, 0xd4, 0x01, 0x44, 0x00, 0x3b, 0x12,
+    0x14, 0xc0, 0x27, 0x64, 0x0e, 0xe0, 0x00, 0xaa, 0xc0, 0x06, 0xb0, 0x1d, 0x22, 0x01, 0x42, 0x4b,
+    0x20, 0x07, 0x7b, 0x58, 0x07, 0x88, 0x82, 0x01, 0xff, 0xd2, 0x00, 0x01, 0xb6, 0x46, 0x00, 0x2f,
+    0x97, 0x38, 0x01, 0x12, 0xa1, 0x09, 0x50, 0x09, 0x2a, 0xe4, 0x02, 0xe9, 0x20, 0x20, 0x17, 0x30,
+    0xaa, 0x03, 0x50, 0x01, 0x94, 0x2d, 0x80, 0x24, 0x86, 0x10, 0x0a, 0xde, 0x40, 0x31, 0x91, 0x80,
+    0x66, 0xb0, 0x08, 0x73, 0x58, 0x02, 0x00, 0x1d, 0x08, 0x60, 0x0f, 0xff, 0xf8, 0x07, 0xfc, 0x58,
+    0xf3, 0xfe, 0xcc, 0x28, 0x09, 0x56, 0x70, 0xb7, 0x8b, 0x9c, 0xb7, 0x8b, 0x9c, 0x00, 0xff, 0xef,
+    0x00, 0x00, 0x94, 0x40, 0x24, 0xdc, 0x00, 0x86, 0xba, 0x44, 0x00, 0xce, 0x66, 0x00, 0xb3, 0x01,
+    0x7a, 0x40, 0xec, 0x11, 0x0f, 0x00, 0x38, 0x01, 0x4c, 0x94, 0x80, 0x23, 0x0a, 0xb1, 0x05, 0x02,
+    0x38, 0xcc, 0x77, 0x80, 0x00, 0xfe, 0x5d, 0x00, 0xc9, 0x38, 0x01, 0x0d, 0x68, 0x80, 0x4e, 0xe1,
+    0x30, 0x0b, 0x30, 0x17, 0xa4, 0x0c, 0xc0, 0x88, 0x78, 0x07, 0x29, 0x93, 0x28, 0x06, 0x39, 0xb1,
+    0x05, 0x31, 0x38, 0xcc, 0x77, 0x80, 0x0c, 0x50, 0x0c, 0xf6, 0x11, 0x00, 0x0d, 0x50, 0x08, 0x28,
+    0x00, 0x51, 0x30, 0x04, 0xc0, 0x02, 0x60, 0x02, 0x51, 0x33, 0x02, 0x00, 0x68, 0x84, 0xc8, 0x02,
+    0x6d, 0x94, 0x75, 0x00, 0x1d, 0x6f, 0x85, 0x80, 0x78, 0x44, 0xc0, 0x11, 0xa7, 0x7e, 0x80, 0x60,
+    0x07, 0xa0, 0x0a, 0x24, 0x19, 0x40, 0x26, 0xa0, 0x14, 0x50, 0x33, 0x80, 0x1d, 0xc0, 0xb5, 0x00,
+    0x95, 0x42, 0xd4, 0x01, 0x9e, 0x08, 0x80, 0x08, 0xd4, 0x6b, 0x00, 0x31, 0x6c, 0x03, 0x00, 0x70,
+    0xa0, 0x80, 0x18, 0x3a, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2c, 0xcc, 0x00, 0x2c, 0xcc, 0x00, 0x3c, 0xcf, 0x90, 0xcc, 0xf8, 0xcc, 0xff,
+    0xe1, 0x00, 0xcc, 0xff, 0xe1, 0x00, 0x84, 0x84, 0x00, 0xff, 0xf8, 0x00, 0x4c, 0xcf, 0x26, 0x67,
+    0x93, 0x33, 0xc0, 0x0a, 0x00, 0x30, 0x1b, 0x01, 0xd0, 0x00, 0x00, 0xda, 0x02, 0xe0, 0xb8, 0x00,
+    0x00, 0x15, 0xbe, 0x6a, 0x80, 0x85, 0xcd, 0x42, 0x0a, 0x00, 0x0a, 0x0b, 0x06, 0x21, 0x36, 0x5c,
+    0x3a, 0x76, 0x00, 0x00, 0xed, 0x2c, 0x17, 0x75, 0xae, 0x6a, 0x00, 0x00, 0xc5, 0x6b, 0x0f, 0x9b,
+    0x7a, 0xa6, 0x60, 0x85, 0xc2, 0xcd, 0xb7, 0x42, 0x5d, 0x0a, 0x28, 0x00, 0x00, 0x2c, 0x80, 0x7e,
+    0x5b, 0x97, 0xb8, 0x5b, 0x97, 0xb8, 0x00, 0x08, 0x80, 0x3b, 0xc0, 0x33, 0x88, 0x06, 0x36, 0x00,
+    0x00, 0x00, 0x2c, 0x80, 0x7e, 0x5b, 0x97, 0xb8, 0x5b, 0x97, 0xb8, 0x00, 0xf2, 0xdc, 0xbd, 0xc2,
+    0xdc, 0xbd, 0xc0, 0x00, 0x44, 0x01, 0x9f, 0xc0, 0x30, 0x88, 0x00, 0x00, 0x05, 0x82, 0x04, 0xa7,
+    0xd0, 0x20, 0x08, 0x9d, 0x05, 0xc8, 0x51, 0x00, 0x77, 0xb8, 0x00, 0x70, 0x8e, 0xec, 0x40, 0x03,
+    0x01, 0xd1, 0x00, 0x03, 0x00, 0x18, 0x0e, 0x89, 0x68, 0x00, 0x03, 0x00, 0x18, 0x00, 0xc0, 0x74,
+    0x4b, 0x40, 0xb4, 0x00, 0x00, 0x87, 0xc4, 0x5a, 0x20, 0x00, 0x04, 0xbb, 0x18, 0x05, 0x0c, 0x01,
+    0xf4, 0x5d, 0xbc, 0x00, 0x64, 0xc0, 0x1f, 0x38, 0x07, 0x7d, 0x80, 0x7e, 0x71, 0x13, 0x85, 0x40,
+    0x80, 0x7e, 0xfb, 0xb4, 0xa9, 0xa0, 0x07, 0xf1, 0xd5, 0x0e, 0x64, 0xd5, 0x00, 0x35, 0x44, 0x00,
+    0xea, 0xf3, 0xca, 0xe6, 0xb9, 0xa8, 0x00, 0xcf, 0x86, 0xb8, 0x09, 0x8c, 0x60, 0xa4, 0x00, 0x2c,
+    0x70, 0x2e, 0x07, 0xd7, 0x10, 0x23, 0x00, 0x74, 0x80, 0x10, 0x6b, 0xda, 0x6a, 0xf4, 0x40, 0x04,
+    0xbb, 0x18, 0x05, 0x0c, 0x01, 0xff, 0x45, 0xdb, 0xc0, 0x06, 0x4c, 0x01, 0xff, 0x38, 0x07, 0x7d,
+    0x80, 0x7f, 0xf0, 0x1c, 0x44, 0xe1, 0x50, 0x20, 0x1f, 0xfc, 0x0f, 0xbb, 0x4a, 0x9a, 0x00, 0x7f,
+    0xf0, 0x4e, 0xa8, 0x73, 0x26, 0xa8, 0x01, 0xaa, 0x20, 0x2d, 0x48, 0x07, 0x57, 0x9e, 0x57, 0x35,
+    0xcd, 0x41, 0x75, 0x64, 0x00, 0x4f, 0x86, 0xb8, 0x09, 0x8c, 0x60, 0xaa, 0xc0, 0x43, 0x00, 0x16,
+    0x38, 0x17, 0x03, 0xeb, 0x88, 0x12, 0x68, 0x11, 0x00, 0x1d, 0x20, 0x04, 0x1a, 0xf6, 0x9a, 0xbd,
+    0x32, 0xb8, 0x80, 0x4b, 0x1c, 0x23, 0x44, 0x00, 0x4b, 0x0e, 0x01, 0xc1, 0x20, 0x23, 0x32, 0x82,
+    0x20, 0xec, 0x00, 0x4b, 0x0e, 0x0a, 0x41, 0xc1, 0x20, 0x65, 0x23, 0x32, 0x80, 0x05, 0x10, 0x76,
+    0x10, 0x00, 0x77, 0x27, 0x19, 0x07, 0x80, 0x77, 0x16, 0x02, 0x71, 0x08, 0x19, 0x03, 0x00, 0x3c,
+    0x20, 0x00, 0x77, 0x16, 0x06, 0x8a, 0x71, 0x08, 0x39, 0x19, 0x03, 0x06, 0x38, 0x78, 0x40, 0x3b,
+    0x00, 0x01, 0xe4, 0x00, 0x56, 0xc0, 0x29, 0x9a, 0x64, 0x00, 0x00, 0x34, 0x80, 0x17, 0x64, 0x0e,
+    0x6c, 0x00, 0x20, 0x20, 0x02, 0xfd, 0x00, 0x8e, 0x64, 0x00, 0x4b, 0x00, 0x27, 0x50, 0x01, 0x76,
+    0x00, 0x1d, 0xc0, 0x71, 0x64, 0xe8, 0x00, 0x00, 0xfe, 0x60, 0xd3, 0x38, 0x01, 0xd9, 0x29, 0xc0,
+    0x09, 0xf8, 0xbc, 0xfd, 0x08, 0x7e, 0x56, 0x1f, 0x01, 0x90, 0xae, 0xe1, 0x80, 0x06, 0xb4, 0x39,
+    0xc0, 0x10, 0x18, 0x66, 0x50, 0x00, 0x0f, 0x00, 0x70, 0x00, 0x40, 0x3f, 0xf9, 0x66, 0x00, 0x30,
+    0x0f, 0xde, 0x00, 0xf0, 0x00, 0x80, 0x04, 0x07, 0x44, 0xb4, 0x00, 0x06, 0xcc, 0x59, 0x02, 0x56,
+    0x62, 0x38, 0x01, 0xe6, 0x86, 0x20, 0x86, 0xc6, 0x40, 0x1d, 0x9d, 0xe0, 0x19, 0xf0, 0x80, 0x21,
+    0xa0, 0x0e, 0x46, 0x00, 0xe1, 0x20, 0x0e, 0x6b, 0x00, 0x80, 0x3c, 0xce, 0xb0, 0x10, 0x0f, 0xc2,
+    0x0b, 0x8c, 0x40, 0x11, 0xcd, 0x0a, 0x6f, 0x75, 0xfd, 0x1f, 0x62, 0x00, 0x01, 0x7c, 0xdd, 0xad,
+    0x40, 0x09, 0xa5, 0x9b, 0xb4, 0xed, 0x8a, 0xe2, 0x80, 0x62, 0x8a, 0x10, 0x00, 0xca, 0x20, 0x11,
+    0x78, 0x80, 0x51, 0x00, 0x09, 0xb0, 0x80, 0x03, 0x0a, 0x01, 0x5e, 0xc0, 0x01, 0x74, 0xfe, 0x01,
+    0x5c, 0x12, 0x40, 0x00, 0x85, 0x44, 0x03, 0xcf, 0x30, 0x01, 0xc5, 0xe6, 0xa8, 0x01, 0x8b, 0x1e,
+    0x50, 0x03, 0x2a, 0xa1, 0x50, 0x40, 0x13, 0xf2, 0x0d, 0xf6, 0x46, 0x0a, 0x06, 0x28, 0xce, 0x7e,
+    0xde, 0x66, 0x6a, 0x40, 0x3c, 0xc8, 0x00, 0x00, 0xf9, 0xa0, 0x03, 0xc5, 0x50, 0x01, 0xee, 0xe0,
+    0x07, 0xa2, 0x88, 0x03, 0x8c, 0xcc, 0x01, 0xef, 0xa0, 0x0f, 0x4c, 0x08, 0x07, 0x28, 0x20, 0x07,
+    0x0c, 0xc8, 0x03, 0xd5, 0xe0, 0x1e, 0x00, 0xbb, 0x23, 0x5a, 0x00, 0x7f, 0xad, 0x02, 0xd0, 0x03,
+    0xff, 0x80, 0xd6, 0x80, 0x4b, 0xb2, 0x53, 0x00, 0x7f, 0x25, 0x02, 0x50, 0x07, 0xff, 0x05, 0x29,
+    0x80, 0x05, 0xcc, 0x94, 0x00, 0xb9, 0x92, 0x01, 0xce, 0xe6, 0xc1, 0x1c, 0xee, 0x6c, 0x92, 0x50,
+    0x80, 0xa3, 0xa4, 0x88, 0x0a, 0x3b, 0x98, 0x02, 0x47, 0x72, 0x80, 0x48, 0xe0, 0x11, 0x65, 0x90,
+    0x04, 0x59, 0x64, 0x01, 0x7f, 0x98, 0x03, 0x7f, 0x98, 0x02, 0x21, 0x30, 0x0c, 0x6c, 0x60, 0x18,
+    0xe0, 0x03, 0x8b, 0xc0, 0x38, 0x58, 0x03, 0x85, 0x80, 0x39, 0x38, 0x03, 0x93, 0x80, 0x20, 0x05,
+    0xcc, 0x94, 0x01, 0xc0, 0x73, 0xb9, 0xb0, 0x40, 0x12, 0x48, 0x80, 0xa3, 0x80, 0x4e, 0xa0, 0x12,
+    0x38, 0x07, 0x8b, 0x20, 0x80, 0x3d, 0xfe, 0x50, 0x01, 0x80, 0x44, 0xc6, 0x01, 0xf1, 0x40, 0x06,
+    0x90, 0x0c, 0x20, 0x19, 0xc0, 0x24, 0xe0, 0x08, 0x74, 0x00, 0x0f, 0x00, 0x35, 0xd5, 0xa0, 0x00,
+    0x41, 0x36, 0xea, 0xe0, 0x80, 0x22, 0xf0, 0x09, 0x58, 0x02, 0x64, 0x00, 0x0a, 0x28, 0x07, 0x93,
+    0x24, 0x40, 0xc0, 0x21, 0x9c, 0x40, 0x0f, 0x13, 0x08, 0x05, 0xe0, 0x11, 0xc8, 0x06, 0x10, 0x0f,
+    0xc3, 0xa2, 0x00, 0x5e, 0x00, 0x80, 0x8c, 0xcb, 0xca, 0x33, 0x23, 0x20, 0x0c, 0x20, 0x1f, 0xe1,
+    0x60, 0x0c, 0x42, 0x01, 0x98, 0x80, 0x31, 0xf0, 0x06, 0xe3, 0x00, 0xc2, 0xc0, 0x00, 0xec, 0xfe,
+    0x80, 0x0b, 0x04, 0x4f, 0x20, 0x1e, 0x60, 0x0f, 0xfe, 0x09, 0x80, 0x71, 0x70, 0x05, 0xb9, 0xa4,
+    0x01, 0x19, 0x80, 0x3f, 0xf8, 0xa0, 0x08, 0xcd, 0xca, 0x97, 0x36, 0xf6, 0x70, 0x0f, 0xf9, 0xc0,
+    0x3a, 0x5c, 0xdb, 0x98, 0xdc, 0xdc, 0x60, 0x3c, 0x03, 0x96, 0x00, 0xed, 0x00, 0xff, 0xb4, 0xf0,
+    0x0e, 0x58, 0x00, 0x0a, 0x00, 0x04, 0x47, 0x80, 0x47, 0x74, 0x76, 0x85, 0x08, 0x8d, 0x63, 0xbf,
+    0x73, 0x83, 0x91, 0x12, 0xc0, 0x1e, 0x11, 0x68, 0x81, 0x80, 0x7e, 0xd0, 0x03, 0x90, 0x7b, 0x82,
+    0xa8, 0x02, 0x9d, 0xff, 0x75, 0xa8, 0x01, 0xbb, 0x31, 0xfe, 0xef, 0xcb, 0x07, 0xc5, 0x10, 0x09,
+    0x26, 0x80, 0x40, 0x3f, 0x08, 0x07, 0xff, 0xdc, 0x40, 0x3f, 0x08, 0x26, 0x29, 0x00, 0x05, 0x26,
+    0x81, 0x7b, 0x3f, 0xbf, 0xdd, 0x96, 0x00, 0x00, 0x32, 0x00, 0x1d, 0xc0, 0x30, 0xae, 0x51, 0x0b,
+    0x54, 0xe4, 0x44, 0x1b, 0x5e, 0x6d, 0x09, 0x02, 0xb0, 0x90, 0x00, 0xc8, 0x03, 0x19, 0x00, 0x08,
+    0x15, 0x84, 0x4d, 0x79, 0xb4, 0x49, 0xc8, 0x88, 0x37, 0x28, 0x9b, 0x57, 0x70, 0x02, 0x14, 0x00,
+    0xf0, 0xe0, 0x80, 0x7a, 0xe0, 0x45, 0xce, 0x00, 0x52, 0x40, 0x02, 0x90, 0x0c, 0xc0, 0x00, 0x6d,
+    0x42, 0xbc, 0x03, 0xcf, 0x86, 0x01, 0xc5, 0x8e, 0x01, 0xee, 0xa0, 0x06, 0x58, 0x02, 0x24, 0x40,
+    0x0a, 0x60, 0x84, 0xa0, 0x14, 0xc0, 0x00, 0x08, 0xbc, 0x71, 0x02, 0x30, 0x8b, 0xc2, 0xbc, 0x90,
+    0x00, 0x01, 0x8c, 0xef, 0xeb, 0x50, 0x02, 0x6f, 0x75, 0xff, 0x65, 0x8a, 0xe3, 0x10, 0x00, 0x52,
+    0x68, 0x40, 0x03, 0x45, 0x30, 0x05, 0xff, 0x50, 0x29, 0x22, 0x0d, 0x97, 0x0c, 0xc4, 0xc0, 0x53,
+    0x58, 0x00, 0x4b, 0x0e, 0x0a, 0x45, 0x91, 0xc1, 0x20, 0x65, 0x2f, 0x23, 0x32, 0x80, 0x07, 0x91,
+    0x23, 0xb0, 0x80, 0xa2, 0x00, 0x00, 0x01, 0xab, 0xb3, 0x80, 0x6a, 0xfb, 0xb6, 0x18, 0x04, 0xaa,
+    0x00, 0x51, 0x00, 0x71, 0xf5, 0x52, 0xd0, 0x03, 0x25, 0xdc, 0x80, 0xee, 0x00, 0xfa, 0x7f, 0xc9,
+    0x76, 0x90, 0x0a, 0x3d, 0x2e, 0xd2, 0x01, 0xff, 0xc2, 0x4b, 0xb9, 0x00, 0x00, 0xe7, 0x19, 0x00,
+    0xc5, 0x5b, 0x1a, 0x01, 0x8f, 0xfb, 0xe6, 0x91, 0x40, 0x1d, 0xc4, 0x57, 0xec, 0xb0, 0x31, 0x30,
+    0xf1, 0x01, 0xc0, 0x65, 0x01, 0xf5, 0xb0, 0x20, 0x0c, 0xed, 0xa6, 0x01, 0x31, 0x07, 0x08, 0x04,
+    0x40, 0x6c, 0x9e, 0x98, 0x03, 0x80, 0x0e, 0xa1, 0xc4, 0x2d, 0x80, 0x01, 0xbe, 0xbe, 0xf4, 0xb0,
+    0x00, 0x7b, 0xef, 0x71, 0x40, 0x00, 0x00, 0x1d, 0xee, 0xac, 0xc0, 0x24, 0xe8, 0xdd, 0x47, 0x18,
+    0x02, 0x7c, 0xc0, 0x07, 0xfe, 0x03, 0x62, 0x00, 0xc5, 0xe0, 0xc6, 0x00, 0x42, 0x46, 0x20, 0x0e,
+    0xd9, 0xc3, 0x00, 0x31, 0x80, 0x45, 0x0a, 0x60, 0x6c, 0x40, 0x0d, 0x02, 0xe0, 0x04, 0xf9, 0x80,
+    0x0f, 0xe0, 0x00, 0x9d, 0x0f, 0x51, 0xc8, 0x00, 0x00, 0x56, 0xe6, 0x67, 0x00, 0xa7, 0x33, 0x38,
+    0x07, 0xff, 0x4a, 0x73, 0x30, 0x80, 0x53, 0x99, 0x84, 0x2d, 0x6d, 0xc0, 0x3a, 0xd6, 0xdc, 0x03,
+    0xff, 0x82, 0x00, 0x00, 0x26, 0x64, 0x60, 0x02, 0x9d, 0xcd, 0xe1, 0x04, 0xa1, 0x01, 0xa5, 0x01,
+    0x10, 0x04, 0xe8, 0xb7, 0x79, 0x40, 0x0b, 0x2b, 0x76, 0x50, 0x02, 0xcb, 0x5d, 0x94, 0x00, 0xb0,
+    0xf7, 0x65, 0x00, 0x8b, 0x80, 0x27, 0x46, 0x9b, 0xcc, 0xad, 0x40, 0x00, 0xf1, 0x08, 0x06, 0x40,
+    0x43, 0x0e, 0x44, 0x00, 0x06, 0x6b, 0x22, 0xcf, 0x76, 0x00, 0x15, 0xc5, 0xad, 0x44, 0xa2, 0x81,
+    0x08, 0x08, 0x9c, 0x01, 0xe4, 0x01, 0x98, 0x03, 0xfd, 0x46, 0x01, 0xf9, 0x50, 0x03, 0xfb, 0xac,
+    0x03, 0xc3, 0xa4, 0xe5, 0x84, 0x00, 0x67, 0x00, 0x0d, 0x80, 0x0e, 0xe0, 0x0c, 0xc4, 0x01, 0xfd,
+    0x12, 0x01, 0xfc, 0xee, 0x40, 0x0f, 0x51, 0x50, 0x56, 0x5d, 0x86, 0xca, 0x8a, 0xb2, 0x1e, 0xec,
+    0x36, 0x54, 0x55, 0x7a, 0xbb, 0x63, 0x65, 0x45, 0x57, 0x6e, 0x08, 0x1b, 0x20, 0x0f, 0x77, 0x80,
+    0x7f, 0x1d, 0x08, 0x00, 0xec, 0xcb, 0x60, 0x03, 0xb3, 0x2d, 0x27, 0x67, 0x00, 0xf4, 0x50, 0x07,
+    0xf1, 0x5d, 0x58, 0x06, 0x19, 0x95, 0xd5, 0x86, 0x65, 0xba, 0x60, 0x0d, 0x99, 0x98, 0x03, 0xff,
+    0x95, 0xe0, 0x1f, 0x9d, 0x2c, 0xec, 0xcb, 0x60, 0x03, 0xfb, 0x32, 0xd1, 0x90, 0x0f, 0xfe, 0x04,
+    0xb8, 0x07, 0xff, 0x00, 0x40, 0x0b, 0x97, 0x63, 0x00, 0xf5, 0xb0, 0x46, 0x5d, 0x70, 0x03, 0x32,
+    0xec, 0x80, 0x01, 0x00, 0xe8, 0x03, 0x32, 0x34, 0x00, 0x74, 0xed, 0x18, 0x07, 0x44, 0x80, 0x0a,
+    0xf6, 0x74, 0x40, 0x32, 0xba, 0x0e, 0x80, 0x0c, 0xc0, 0x1e, 0x88, 0x0c, 0xd4, 0xd4, 0x08, 0x0e,
+    0x00, 0xd1, 0x80, 0x1b, 0x08, 0x14, 0xc0, 0x24, 0x30, 0x0c, 0x44, 0x0c, 0x40, 0x08, 0x54, 0xc0,
+    0x06, 0xa0, 0x04, 0xd0, 0x01, 0xbe, 0x20, 0x01, 0x30, 0x01, 0xeb, 0x98, 0xd7, 0xb8, 0xcc, 0x4d,
+    0x10, 0x62, 0xc6, 0x16, 0x69, 0x66, 0x0f, 0x48, 0x31, 0xeb, 0x0f, 0x70, 0xf7, 0x47, 0x84, 0x19,
+    0xa7, 0x51, 0x98, 0xd7, 0x4d, 0xc2, 0x00, 0x9a, 0x94, 0x00, 0x6e, 0x86, 0x01, 0xda, 0x24, 0x01,
+    0x3b, 0x80, 0x20, 0xdb, 0xba, 0x84, 0x2c, 0x4e, 0xee, 0xc9, 0x06, 0x00, 0x98, 0xd4, 0xc0, 0x3b,
+    0xd8, 0x03, 0xf8, 0x4c, 0x03, 0xe2, 0x80, 0x31, 0x00, 0xa3, 0x31, 0xb0, 0x00, 0x00, 0xf7, 0x00,
+    0x7f, 0xf0, 0xee, 0xc3, 0x62, 0x07, 0x98, 0x0f, 0x1b, 0x11, 0x77, 0x32, 0xf4, 0x02, 0x75, 0x20,
+    0x04, 0x88, 0x00, 0x78, 0x03, 0x10, 0x00, 0x78, 0x03, 0x10, 0x01, 0xd4, 0x80, 0x12, 0x20, 0x01,
+    0xee, 0x66, 0x34, 0x03, 0x1e, 0x64, 0x9c, 0x01, 0xff, 0x1e, 0x67, 0x58, 0x00, 0x00, 0x9b, 0x76,
+    0x60, 0x09, 0xf7, 0x37, 0x30, 0x00, 0x1a, 0xb1, 0x01, 0xa0, 0x03, 0xa8, 0x07, 0xa2, 0x09, 0x77,
+    0x40, 0x02, 0x17, 0xee, 0xe8, 0x00, 0x42, 0xfd, 0xda, 0x40, 0x28, 0xb6, 0xbb, 0x48, 0x06, 0x56,
+    0x70, 0x09, 0x40, 0x2c, 0xfd, 0xd6, 0x18, 0x00, 0x05, 0x90, 0x08, 0xb4, 0xc0, 0x38, 0xbf, 0xc6,
+    0x01, 0x8b, 0xfc, 0x40, 0x18, 0xbf, 0xc4, 0x00, 0xb8, 0x6d, 0x3e, 0xcc, 0x4d, 0xc0, 0x59, 0xfe,
+    0x62, 0x40, 0x0c, 0x9f, 0xc2, 0x01, 0xe2, 0x8a, 0x00, 0xf9, 0x4a, 0x00, 0x3e, 0x94, 0x50, 0x8c,
+    0xc6, 0xf6, 0x64, 0x11, 0x98, 0xe5, 0xcc, 0x80, 0x3e, 0x10, 0x0e, 0x76, 0xc7, 0x00, 0x86, 0x64,
+    0x38, 0xc0, 0x1a, 0xf8, 0x6d, 0x80, 0x35, 0x70, 0xd3, 0x00, 0x47, 0x7c, 0xe2, 0x01, 0x88, 0xc0,
+    0x3f, 0xf8, 0x60, 0x00, 0x94, 0x80, 0x3f, 0xf8, 0x4b, 0x54, 0xfd, 0xc8, 0x10, 0x0f, 0xf3, 0x42,
+    0x46, 0xe6, 0xe1, 0x00, 0x7f, 0x19, 0x00, 0x65, 0x99, 0x00, 0x7f, 0xf1, 0x11, 0x84, 0x1b, 0x31,
+    0x64, 0x01, 0xfe, 0x62, 0x6f, 0xcc, 0x4f, 0x88, 0x07, 0xfd, 0x52, 0x00, 0x25, 0x70, 0x0f, 0xe6,
+    0x21, 0x00, 0xdc, 0x22, 0xbc, 0x50, 0x0c, 0x62, 0x22, 0x10, 0x0b, 0x85, 0x8b, 0x0f, 0xc4, 0x07,
+    0xa0, 0x06, 0xc0, 0x06, 0xae, 0xa9, 0xc9, 0xdb, 0xb4, 0x20, 0x03, 0xf7, 0x5f, 0xc2, 0x5b, 0xd2,
+    0x99, 0xb8, 0xa0, 0x12, 0xee, 0xb0, 0xc0, 0x3f, 0xfb, 0x20, 0x0b, 0xdc, 0xc9, 0x00, 0x37, 0x66,
+    0x36, 0x44, 0x21, 0x7e, 0xed, 0x41, 0x8b, 0x0b, 0xf7, 0x7a, 0x96, 0x17, 0xee, 0xf5, 0x2c, 0x2f,
+    0xdd, 0xa4, 0x31, 0x40, 0x1d, 0x98, 0x9e, 0x10, 0x0b, 0xb3, 0x16, 0x60, 0x1f, 0xfc, 0x80, 0x00,
+    0xff, 0xe1, 0x2c, 0x00, 0x78, 0xaa, 0xda, 0xcc, 0x02, 0x3f, 0xeb, 0x68, 0xe5, 0x00, 0x77, 0x10,
+    0x00, 0x79, 0x00, 0x62, 0x60, 0x18, 0x64, 0x59, 0x40, 0x3c, 0x82, 0x01, 0xcd, 0x98, 0xd4, 0x75,
+    0x00, 0x9b, 0x30, 0xce, 0x40, 0x80, 0x18, 0x58, 0xc3, 0xa5, 0x4c, 0x13, 0x64, 0x00, 0x59, 0xb6,
+    0xdb, 0xc8, 0x01, 0x0c, 0x4c, 0xc4, 0x00, 0x00, 0x00, 0x93, 0xc8, 0x03, 0xdc, 0xf4, 0x01, 0xc2,
+    0xf0, 0xa0, 0x1c, 0xea, 0x08, 0xa0, 0x07, 0xb9, 0x4b, 0x5b, 0xb2, 0xbc, 0x26, 0x5e, 0x14, 0xab,
+    0xeb, 0xdd, 0xc3, 0x8a, 0xe1, 0x97, 0x76, 0x02, 0xa9, 0xc0, 0x30, 0xa9, 0xf6, 0x80, 0x76, 0xd0,
+    0x03, 0xcc, 0xa8, 0x40, 0x1b, 0xd9, 0x8d, 0x90, 0x06, 0x10, 0x03, 0xfc, 0x11, 0xd9, 0x93, 0x5a,
+    0x46, 0x66, 0xec, 0x40, 0x0f, 0xd1, 0xba, 0xcc, 0xc9, 0x07, 0xb9, 0x96, 0xa0, 0x80, 0x80, 0x1a,
+    0x80, 0x6f, 0x76, 0xca, 0x00, 0x00, 0xcc, 0xe0, 0x1e, 0x3b, 0x89, 0xd6, 0x00, 0x8f, 0xa2, 0x13,
+    0x9a, 0xe0, 0x0e, 0xe1, 0x80, 0x06, 0xe4, 0x0c, 0x4c, 0x03, 0xb0, 0x19, 0x40, 0x3c, 0x40, 0x1f,
+    0xf3, 0x10, 0x07, 0x88, 0x0d, 0x88, 0x03, 0x0e, 0x00, 0x3b, 0xcc, 0x00, 0x3b, 0x20, 0x03, 0xe8,
+    0x84, 0xe5, 0x38, 0x04, 0x77, 0x13, 0xac, 0x01, 0xe5, 0x40, 0x0c, 0x00, 0x7c, 0xcf, 0x53, 0xe6,
+    0x7a, 0x9f, 0x31, 0xba, 0xcc, 0x53, 0xe6, 0x21, 0x33, 0x14, 0x01, 0xff, 0xe4, 0x00, 0x23, 0x3e,
+    0x1a, 0x98, 0xce, 0x84, 0x8a, 0xbd, 0x3b, 0x59, 0xbb, 0x48, 0xe2, 0xdc, 0xcc, 0x3e, 0xa2, 0x26,
+    0x94, 0x30, 0x8d, 0xcf, 0xa0, 0x05, 0x1e, 0x20, 0x04, 0x3f, 0x46, 0x01, 0x8b, 0x78, 0x40, 0x31,
+    0xc6, 0x80, 0x00, 0x00, 0x78, 0x07, 0xc2, 0xe0, 0x11, 0x06, 0x90, 0x01, 0xe4, 0x30, 0x40, 0x0f,
+    0x61, 0xb8, 0x00, 0x5d, 0x0c, 0x80, 0x47, 0xd0, 0x10, 0x3f, 0x20, 0x0c, 0x86, 0x01, 0x92, 0xa4,
+    0x02, 0xdf, 0xf0, 0x80, 0x00, 0xc6, 0x01, 0xfb, 0x88, 0x03, 0x8a, 0x0a, 0x10, 0x02, 0x3c, 0xe2,
+    0xc8, 0x70, 0x07, 0xd3, 0x02, 0x65, 0x08, 0xc8, 0x01, 0x95, 0x0d, 0x80, 0x3b, 0x88, 0x40, 0x3e,
+    0xf0, 0x05, 0xec, 0xc6, 0xd8, 0x80, 0x4f, 0x98, 0xde, 0xc0, 0x0f, 0x94, 0x48, 0x03, 0xff, 0x86,
+    0xc0, 0x55, 0x0f, 0x99, 0x7e, 0x85, 0x43, 0xe6, 0x52, 0x21, 0x50, 0xf9, 0x80, 0x0d, 0x50, 0xf9,
+    0x80, 0x0f, 0xfe, 0x08, 0x00, 0xb4, 0x28, 0x80, 0x32, 0x1e, 0xad, 0x00, 0x4b, 0x01, 0xaa, 0x54,
+    0x00, 0x8e, 0x30, 0x04, 0x31, 0x90, 0x90, 0x06, 0xb4, 0x17, 0x08, 0x0e, 0x35, 0x42, 0x70, 0x50,
+    0x41, 0x23, 0x17, 0x20, 0x0f, 0xa7, 0x88, 0x03, 0x8b, 0x8b, 0x75, 0x99, 0x28, 0x01, 0x01, 0x00,
+    0xe9, 0x48, 0x40, 0x0b, 0x92, 0x16, 0x5c, 0x02, 0xcc, 0xb7, 0x18, 0x03, 0xd1, 0xa0, 0x1f, 0x08,
+    0x07, 0x0c, 0x70, 0x03, 0x32, 0xe2, 0x40, 0x06, 0x65, 0xfe, 0xc0, 0x0f, 0x30, 0x90, 0x07, 0x18,
+    0x10, 0x66, 0x5b, 0x1e, 0x1c, 0x90, 0xb3, 0x64, 0x00, 0x94, 0x84, 0x00, 0x80, 0x02, 0xac, 0xb4,
+    0x01, 0xf9, 0xca, 0x00, 0x35, 0x18, 0x0a, 0x00, 0x7e, 0x6a, 0x30, 0x14, 0x01, 0xf9, 0xca, 0x00,
+    0x8a, 0xb2, 0xd0, 0x17, 0x33, 0x88,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13, .adv_w = 80, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 20, .adv_w = 128, .box_w = 10, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 68, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 118, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 172, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 215, .adv_w = 48, .box_w = 1, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 218, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 237, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 256, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 275, .adv_w = 144, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 291, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 297, .adv_w = 96, .box_w = 5, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 300, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 304, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 332, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 369, .adv_w = 80, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 379, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 414, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 453, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 487, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 525, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 566, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 595, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 636, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 677, .adv_w = 48, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 686, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 698, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 723, .adv_w = 144, .box_w = 7, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 733, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 759, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 791, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 871, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 911, .adv_w = 144, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 943, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 988, .adv_w = 144, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1017, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1035, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1052, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1100, .adv_w = 160, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1115, .adv_w = 48, .box_w = 1, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1118, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1137, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1170, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1176, .adv_w = 192, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1219, .adv_w = 160, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1248, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1293, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1317, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1369, .adv_w = 144, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1400, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1439, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1451, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1472, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1512, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1575, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1616, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1647, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1681, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1689, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1716, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1724, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 1737, .adv_w = 96, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1740, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 1744, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1769, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1800, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1826, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1856, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1880, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1894, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1929, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1949, .adv_w = 48, .box_w = 2, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1957, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 1969, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1993, .adv_w = 48, .box_w = 2, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1998, .adv_w = 192, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2023, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2038, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2066, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2101, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2132, .adv_w = 64, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2143, .adv_w = 112, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2165, .adv_w = 64, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2180, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2197, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2221, .adv_w = 160, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2261, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2285, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2318, .adv_w = 112, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2339, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2366, .adv_w = 64, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2371, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2396, .adv_w = 144, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2405, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2406, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2418, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2451, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2490, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2522, .adv_w = 112, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2565, .adv_w = 48, .box_w = 2, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2574, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2617, .adv_w = 128, .box_w = 5, .box_h = 3, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 2624, .adv_w = 192, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2680, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 2699, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2721, .adv_w = 144, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2728, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2764, .adv_w = 96, .box_w = 5, .box_h = 1, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 2767, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2778, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 2797, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2813, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2829, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 2833, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2857, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2882, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2887, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2894, .adv_w = 64, .box_w = 3, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2901, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 2919, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2941, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2986, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3037, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3091, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3122, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3169, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3217, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3268, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3319, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3368, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3417, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3464, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3520, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3548, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3576, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3604, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3632, .adv_w = 48, .box_w = 2, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3640, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3649, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3662, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3674, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3713, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3753, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3807, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3861, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3916, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3972, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4030, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4055, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4114, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4145, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4176, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4207, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4241, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4282, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4310, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4343, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4377, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4411, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4447, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4483, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4518, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4555, .adv_w = 192, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4597, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4632, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4664, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4696, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4731, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4766, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4776, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4785, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4798, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4811, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4853, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4879, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4915, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4952, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4991, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5031, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5070, .adv_w = 144, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5090, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5125, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5150, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5176, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5203, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5231, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5273, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5311, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5355, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5402, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5434, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5485, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5520, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5571, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5605, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5658, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5692, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5747, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5783, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5837, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5870, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5926, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5962, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6002, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6044, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6083, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6125, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6150, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6181, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6210, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6245, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6271, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6303, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 6330, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6363, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6391, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6426, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6484, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6530, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6589, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6634, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6691, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6734, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6792, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6836, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6861, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6892, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6920, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6947, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6960, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6973, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6983, .adv_w = 48, .box_w = 5, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6993, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7006, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7019, .adv_w = 48, .box_w = 2, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7027, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7042, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7051, .adv_w = 48, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7056, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7078, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7098, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7129, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7147, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7190, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7223, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7247, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7260, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7269, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7283, .adv_w = 48, .box_w = 2, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7291, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7305, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7317, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7332, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7344, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7368, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7382, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7421, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7445, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7484, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7508, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7548, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7573, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7610, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7632, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7684, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7719, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7775, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7814, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7870, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7909, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7954, .adv_w = 208, .box_w = 13, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7998, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8038, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8056, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 8097, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8114, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8156, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8174, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8222, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8251, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8300, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8331, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8381, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8412, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8462, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8493, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8516, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8541, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8564, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8581, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8604, .adv_w = 64, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8622, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8654, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8682, .adv_w = 160, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8710, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8734, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8766, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8794, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8827, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8857, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8890, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8917, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8950, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8977, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9054, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9106, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9148, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9192, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9233, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9277, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9306, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9349, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9378, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9423, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9453, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9461, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9514, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9550, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9589, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9626, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 9667, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9708, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 9747, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9787, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9849, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9892, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9928, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9962, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 9999, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10038, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 10074, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10110, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10148, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10187, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10226, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10266, .adv_w = 128, .box_w = 7, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10299, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10337, .adv_w = 128, .box_w = 7, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10370, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10409, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10437, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10472, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10498, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10530, .adv_w = 128, .box_w = 7, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10568, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10611, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10636, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10655, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10710, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10752, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10775, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10802, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10826, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10855, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10881, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10912, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10939, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10970, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10996, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11026, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11036, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11053, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11070, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11088, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11131, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11163, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11205, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11238, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11279, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11309, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11322, .adv_w = 48, .box_w = 2, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11330, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11352, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11368, .adv_w = 112, .box_w = 6, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11379, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 11389, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11403, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11415, .adv_w = 192, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11469, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11504, .adv_w = 192, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11556, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11590, .adv_w = 192, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11644, .adv_w = 192, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11680, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11716, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11739, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11777, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11800, .adv_w = 160, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 11836, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11857, .adv_w = 160, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11896, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11920, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11981, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12026, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12085, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12129, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12190, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12233, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12294, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12337, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12370, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12413, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12444, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12487, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12526, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12543, .adv_w = 144, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 12583, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12600, .adv_w = 144, .box_w = 8, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 12647, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12669, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 12708, .adv_w = 64, .box_w = 6, .box_h = 9, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 12724, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12772, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12801, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12850, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12880, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12929, .adv_w = 112, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12964, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13018, .adv_w = 112, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13052, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13108, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13146, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13166, .adv_w = 64, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13186, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13206, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13228, .adv_w = 128, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13246, .adv_w = 64, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13268, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13290, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13315, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13349, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13377, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13409, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13435, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13468, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13496, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13533, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13566, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13602, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13634, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13686, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13721, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13770, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13801, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13875, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13925, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13999, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14048, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14123, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14176, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14248, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14297, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14373, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14423, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14473, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14504, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14555, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14589, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14629, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14669, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14714, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14745, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14788, .adv_w = 112, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14817, .adv_w = 128, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14858, .adv_w = 112, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14885, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 14911, .adv_w = 64, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14934, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14986, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15029, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15065, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15079, .adv_w = 64, .box_w = 6, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15095, .adv_w = 144, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15130, .adv_w = 96, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15165, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15216, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15250, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15298, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15332, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15386, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15428, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15485, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15527, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15581, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15623, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15678, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15721, .adv_w = 144, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15782, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15827, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15883, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15924, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15980, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16021, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16074, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16116, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16171, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16214, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16272, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16317, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 16343, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16376, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16405, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16438, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16467, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16502, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16535, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16576, .adv_w = 128, .box_w = 7, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16611, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16650, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16683, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16723, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16756, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16798, .adv_w = 128, .box_w = 7, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 16835, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16879, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16888, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16897, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16906, .adv_w = 48, .box_w = 2, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16917, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16972, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17010, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17063, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17100, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17162, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17207, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17268, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17312, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17374, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17418, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17478, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17524, .adv_w = 160, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17590, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17638, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17694, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17732, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17789, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17828, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17884, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17923, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17981, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18021, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18079, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18119, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18150, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18177, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18208, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18234, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18273, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18305, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18344, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18376, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18415, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18448, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18488, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18522, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18562, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18595, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18635, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18677, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18715, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18749, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18790, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18832, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18875, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18919, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18932, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18945, .adv_w = 96, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18980, .adv_w = 96, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19014, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19056, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19095, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19096, .adv_w = 240, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19097, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19098, .adv_w = 224, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19099, .adv_w = 80, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19100, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19101, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19102, .adv_w = 144, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19103, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19104, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19105, .adv_w = 16, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19106, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19107, .adv_w = 64, .box_w = 6, .box_h = 1, .ofs_x = -1, .ofs_y = 3},
+    {.bitmap_index = 19110, .adv_w = 64, .box_w = 6, .box_h = 1, .ofs_x = -1, .ofs_y = 3},
+    {.bitmap_index = 19113, .adv_w = 144, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 19116, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 19118, .adv_w = 224, .box_w = 14, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 19122, .adv_w = 224, .box_w = 14, .box_h = 1, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 19126, .adv_w = 96, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 19132, .adv_w = 96, .box_w = 7, .box_h = 3, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 19139, .adv_w = 32, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19146, .adv_w = 32, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 19152, .adv_w = 32, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19157, .adv_w = 32, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19162, .adv_w = 64, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19171, .adv_w = 64, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 19179, .adv_w = 64, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19187, .adv_w = 64, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19196, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 19217, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19244, .adv_w = 112, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 19254, .adv_w = 112, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 2},
+    {.bitmap_index = 19263, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19267, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19274, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19284, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 19289, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19290, .adv_w = 256, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19359, .adv_w = 336, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19443, .adv_w = 32, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19448, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19459, .adv_w = 112, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19474, .adv_w = 32, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19479, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19490, .adv_w = 112, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 19505, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19514, .adv_w = 64, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 19530, .adv_w = 64, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 19543, .adv_w = 112, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19574, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19595, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19626, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 19629, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19644, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 19660, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19683, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 19716, .adv_w = 112, .box_w = 5, .box_h = 1, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 19719, .adv_w = 32, .box_w = 9, .box_h = 10, .ofs_x = -4, .ofs_y = 0},
+    {.bitmap_index = 19751, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19764, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19777, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19839, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19882, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19926, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19950, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 19974, .adv_w = 128, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 19988, .adv_w = 128, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 20002, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 20021, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20033, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20071, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 20111, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20151, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 20161, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20178, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20194, .adv_w = 144, .box_w = 9, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20213, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20214, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20252, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 20310, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20360, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20387, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20427, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 20472, .adv_w = 160, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20516, .adv_w = 176, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20549, .adv_w = 240, .box_w = 14, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20607, .adv_w = 192, .box_w = 14, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20675, .adv_w = 160, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20701, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20749, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20792, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20831, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20867, .adv_w = 288, .box_w = 18, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20954, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20991, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21048, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21088, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21125, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21180, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21198, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21235, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21268, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21297, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21332, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21373, .adv_w = 144, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 21421, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_9[] = {
+    0x0, 0x8,
+};
+
+static const uint8_t glyph_id_ofs_list_11[] = {
+    0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 0, 8, 9, 10, 11, 12,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 160, .range_length = 13, .glyph_id_start = 96,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 174, .range_length = 155, .glyph_id_start = 109,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 330, .range_length = 54, .glyph_id_start = 264,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7680, .range_length = 156, .glyph_id_start = 318,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7837, .range_length = 99, .glyph_id_start = 474,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8192, .range_length = 12, .glyph_id_start = 573,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8208, .range_length = 24, .glyph_id_start = 585,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8239, .range_length = 39, .glyph_id_start = 609,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8279, .range_length = 9, .glyph_id_start = 648,
+     .unicode_list = unicode_list_9, .glyph_id_ofs_list = NULL, .list_length = 2,
+     .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},
+    {.range_start = 8352, .range_length = 16, .glyph_id_start = 650,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8369, .range_length = 16, .glyph_id_start = 666,
+     .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_11, .list_length = 16,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 12,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_light_14_light_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 19,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
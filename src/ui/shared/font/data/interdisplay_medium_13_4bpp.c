@@ -0,0 +1,2187 @@
+/*
+ * interdisplay_medium_13_4bpp - generated by script/binfont_to_c.py from interdisplay_medium_13_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x3f, 0x30, 0x0e, 0x11, 0x00, 0x7c, 0x60, 0x11, 0x78, 0x95, 0x90, 0xa8, 0x80, 0xe4, 0xc7,
+    0x00, 0x38, 0x9b, 0x88, 0x41, 0x72, 0x00, 0x00, 0x44, 0x00, 0xf4, 0x02, 0x3e, 0x06, 0x60, 0x04,
+    0xc4, 0x1a, 0x40, 0xbe, 0x57, 0xee, 0xd8, 0xb6, 0x1d, 0xc2, 0xad, 0x01, 0x31, 0x11, 0x20, 0xed,
+    0x1f, 0xf8, 0x38, 0xfd, 0x23, 0x60, 0xf4, 0xc9, 0xcc, 0x81, 0x48, 0x00, 0x6c, 0x1b, 0xc0, 0x00,
+    0x00, 0x8d, 0x00, 0x3c, 0x9c, 0x01, 0x93, 0x61, 0x74, 0xc0, 0x6d, 0x98, 0x83, 0xa2, 0xa1, 0x3c,
+    0x5a, 0x28, 0xc1, 0x7e, 0x03, 0xea, 0x52, 0xce, 0xf0, 0x80, 0x1b, 0xd8, 0xe7, 0x88, 0xdc, 0x39,
+    0x38, 0x6d, 0xa1, 0x00, 0x30, 0xa9, 0xdd, 0x27, 0x0d, 0x06, 0x48, 0x9b, 0x71, 0x00, 0x1a, 0xde,
+    0x04, 0x00, 0x05, 0xed, 0x20, 0x00, 0xf1, 0x80, 0x2b, 0x6a, 0x40, 0x16, 0xc6, 0x04, 0x06, 0x8a,
+    0x08, 0xf0, 0x00, 0x20, 0x34, 0x50, 0xae, 0x00, 0xd5, 0xb5, 0x32, 0x73, 0x00, 0xcb, 0xda, 0xcf,
+    0x15, 0xd4, 0x01, 0xd3, 0x48, 0xfe, 0xca, 0x01, 0x43, 0xa6, 0xa0, 0xae, 0x80, 0x0d, 0xac, 0x35,
+    0x05, 0x74, 0x01, 0xd6, 0x20, 0xaf, 0xcc, 0xa0, 0x01, 0xbf, 0xc3, 0x00, 0xd6, 0xd6, 0xfe, 0x01,
+    0x99, 0x53, 0x04, 0x03, 0x5b, 0x32, 0x2c, 0x03, 0x38, 0x4c, 0x30, 0x06, 0xb0, 0x1f, 0x05, 0x40,
+    0x54, 0xca, 0x75, 0xb2, 0x0d, 0x22, 0x24, 0xd0, 0xb8, 0x59, 0x49, 0x88, 0x08, 0x00, 0xe9, 0x32,
+    0xe8, 0xa8, 0x00, 0xe4, 0x00, 0x1b, 0xc1, 0x00, 0x00, 0xf6, 0xc0, 0x21, 0x50, 0x69, 0x10, 0x15,
+    0x00, 0x05, 0xc0, 0x01, 0x20, 0x10, 0x10, 0x10, 0x20, 0x01, 0x70, 0x01, 0x10, 0x00, 0xa3, 0x20,
+    0x33, 0x50, 0x00, 0xcf, 0xa0, 0x05, 0x24, 0x02, 0x3d, 0x00, 0x22, 0x80, 0x38, 0x80, 0x04, 0x20,
+    0x07, 0x01, 0x06, 0x01, 0x02, 0x20, 0x03, 0x1c, 0x05, 0x24, 0x18, 0x8c, 0x00, 0x00, 0x25, 0x00,
+    0x0b, 0x0c, 0x26, 0x0a, 0x25, 0x46, 0x0a, 0x08, 0x8a, 0xc5, 0x10, 0x7c, 0x40, 0x46, 0xe1, 0x20,
+    0x00, 0x3d, 0x80, 0x7f, 0xf1, 0x7f, 0xd0, 0x9f, 0xe3, 0xdd, 0x31, 0xee, 0x8c, 0x89, 0xce, 0x44,
+    0x00, 0x97, 0xc0, 0x20, 0x04, 0x04, 0xb0, 0x24, 0x0f, 0xd0, 0x00, 0x00, 0xe4, 0xff, 0xb9, 0x37,
+    0x6c, 0x00, 0x2b, 0x21, 0x51, 0x00, 0x00, 0x9c, 0x80, 0x05, 0x06, 0x00, 0x43, 0x10, 0x06, 0x20,
+    0x04, 0xb8, 0x00, 0x30, 0x40, 0x02, 0x20, 0x02, 0xcc, 0x00, 0x48, 0x80, 0x02, 0x09, 0x80, 0x31,
+    0x00, 0x24, 0xc0, 0x08, 0x00, 0x46, 0xf4, 0x80, 0x50, 0xf7, 0x67, 0xb0, 0x17, 0xa6, 0x5d, 0x42,
+    0x50, 0x50, 0x01, 0x8a, 0x90, 0x80, 0x62, 0xf0, 0x0f, 0x84, 0x84, 0x03, 0x17, 0x28, 0x28, 0x00,
+    0xc5, 0x05, 0xed, 0x97, 0x50, 0xc2, 0x1a, 0xec, 0xf6, 0x00, 0x03, 0xdf, 0x6c, 0x10, 0xfc, 0xa0,
+    0x93, 0x00, 0xff, 0xe7, 0x00, 0x02, 0xbf, 0xd7, 0x00, 0x60, 0x5a, 0xc3, 0x20, 0xca, 0x42, 0xd3,
+    0x51, 0x00, 0x0c, 0x09, 0x40, 0x02, 0xf6, 0x01, 0x0e, 0x13, 0x80, 0x07, 0x07, 0x40, 0x05, 0x8d,
+    0x82, 0x05, 0x81, 0x06, 0x72, 0x89, 0x66, 0x5a, 0x00, 0x02, 0xae, 0xe5, 0x08, 0x03, 0xda, 0xe1,
+    0xe8, 0x08, 0x3d, 0x5a, 0xd0, 0x0b, 0x4c, 0x0b, 0x54, 0x03, 0x7e, 0x85, 0x00, 0x6d, 0x97, 0xc0,
+    0x26, 0x02, 0x6e, 0x34, 0x69, 0x20, 0x0c, 0xe8, 0x5c, 0x88, 0xe2, 0x30, 0xc6, 0xaa, 0x36, 0x00,
+    0x00, 0xd3, 0xee, 0x01, 0x8d, 0x80, 0x3d, 0xec, 0x40, 0x19, 0xca, 0x00, 0x30, 0xc4, 0x04, 0x03,
+    0x51, 0xb0, 0x06, 0x54, 0xe0, 0x0e, 0xf0, 0xdf, 0xf1, 0x46, 0xde, 0xee, 0x16, 0xf1, 0x22, 0xc7,
+    0xc4, 0x00, 0x2f, 0xfe, 0x80, 0x10, 0xac, 0xca, 0x81, 0xc1, 0x4c, 0xe2, 0x00, 0x9f, 0xb9, 0x20,
+    0x01, 0x0c, 0xa8, 0x68, 0x06, 0x8b, 0x46, 0x86, 0x02, 0x50, 0x08, 0xc4, 0x1f, 0x48, 0x00, 0x62,
+    0x0e, 0x3c, 0x8d, 0x12, 0x03, 0x8f, 0x76, 0x87, 0x00, 0x00, 0x46, 0xf4, 0x80, 0x50, 0xf7, 0x67,
+    0xa0, 0x03, 0xd3, 0x2c, 0x20, 0x20, 0x28, 0x01, 0xb8, 0x08, 0x5b, 0x7a, 0x84, 0x04, 0x55, 0x34,
+    0xfa, 0x04, 0x1c, 0x88, 0x93, 0x27, 0x00, 0xf1, 0x92, 0x7a, 0x2c, 0x98, 0x85, 0xa5, 0x5a, 0x68,
+    0x00, 0xaf, 0xfe, 0x88, 0x66, 0x56, 0x1c, 0x46, 0x78, 0x58, 0x03, 0x4b, 0x00, 0x66, 0x19, 0x00,
+    0xd0, 0xe2, 0x01, 0x30, 0xc8, 0x06, 0xb6, 0x10, 0x09, 0x4a, 0xc0, 0x34, 0xa9, 0x00, 0x40, 0x02,
+    0xbf, 0xe9, 0x00, 0xbd, 0xee, 0x1a, 0x00, 0x4a, 0x51, 0x95, 0x00, 0x4f, 0xc4, 0xd2, 0xc0, 0x1a,
+    0xfd, 0x88, 0xe0, 0x0c, 0x6c, 0xa4, 0x90, 0x62, 0xb3, 0x5b, 0x61, 0x00, 0xfc, 0xe1, 0x68, 0xd0,
+    0x62, 0x2c, 0x0b, 0x84, 0xd0, 0x00, 0x02, 0xbf, 0xd7, 0x00, 0x0e, 0x05, 0xda, 0x18, 0x10, 0x6d,
+    0x1a, 0x20, 0x06, 0x20, 0x10, 0x8c, 0x83, 0x00, 0x76, 0x06, 0x54, 0xff, 0x8a, 0x01, 0x2f, 0xef,
+    0xe0, 0x12, 0x60, 0x90, 0x6a, 0x02, 0x95, 0x24, 0x37, 0x80, 0xeb, 0xda, 0x52, 0x00, 0x3e, 0x31,
+    0x51, 0x2b, 0x20, 0x0f, 0x15, 0x90, 0xa8, 0x80, 0x3e, 0x31, 0x51, 0x2b, 0x20, 0x0f, 0x1f, 0x8b,
+    0x18, 0xea, 0x05, 0xc8, 0x00, 0x00, 0xf0, 0x80, 0x70, 0xcf, 0x00, 0x43, 0x3c, 0xb4, 0x00, 0x9e,
+    0x2b, 0xc5, 0x00, 0x38, 0xf2, 0x00, 0x6e, 0x9b, 0xd6, 0x00, 0xcf, 0xd5, 0x1c, 0x01, 0xcf, 0xd2,
+    0x00, 0x00, 0xfb, 0x3f, 0xf8, 0x7b, 0x33, 0x84, 0x8c, 0xf8, 0x33, 0xff, 0x87, 0xb3, 0x38, 0x40,
+    0x20, 0x0f, 0x75, 0x98, 0x06, 0xf1, 0xcb, 0x30, 0x01, 0xd6, 0x96, 0x59, 0x00, 0x0a, 0x91, 0x0c,
+    0x09, 0x78, 0x3a, 0x95, 0x63, 0xb4, 0x41, 0xba, 0xa2, 0x00, 0x80, 0x04, 0xcf, 0xd4, 0x02, 0xb5,
+    0xb4, 0xb2, 0x51, 0x94, 0x90, 0x47, 0xe0, 0x01, 0x82, 0x80, 0x49, 0x8e, 0x60, 0x02, 0xb8, 0x80,
+    0x04, 0xe0, 0xe0, 0x19, 0x30, 0x03, 0x8a, 0x00, 0x39, 0x94, 0x40, 0x00, 0x00, 0x8a, 0x73, 0xf2,
+    0x48, 0x03, 0x9b, 0x4e, 0x72, 0x4f, 0x54, 0x02, 0x39, 0xba, 0x53, 0x5a, 0xa8, 0x80, 0x1e, 0xe8,
+    0x01, 0xca, 0xa9, 0x02, 0x39, 0x04, 0xde, 0xaf, 0x09, 0x40, 0x71, 0x11, 0x5c, 0xf1, 0x80, 0x0c,
+    0x08, 0xa0, 0x53, 0x40, 0xa0, 0x0c, 0xc4, 0x40, 0x00, 0x80, 0x7c, 0xce, 0x22, 0x52, 0x52, 0x90,
+    0x48, 0x22, 0xd2, 0x55, 0x19, 0xaf, 0x69, 0xc0, 0x0e, 0x74, 0x5d, 0xe7, 0x8f, 0xc3, 0x00, 0x1c,
+    0xdd, 0x29, 0xa3, 0x98, 0x07, 0x36, 0x9c, 0xe5, 0x63, 0x80, 0x40, 0x00, 0xab, 0xd8, 0x03, 0xca,
+    0x5a, 0x01, 0xca, 0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03, 0x2e, 0x82, 0x50, 0x04, 0xa0, 0xe1,
+    0xe6, 0x20, 0x0e, 0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b, 0x60, 0xc0, 0xc6, 0x77, 0x99, 0x6a,
+    0x08, 0x04, 0xa0, 0xa0, 0x2f, 0xfd, 0xac, 0x01, 0x4e, 0x5b, 0xc9, 0x80, 0x08, 0xd2, 0x81, 0x40,
+    0x39, 0xc1, 0x00, 0x17, 0xfe, 0x8a, 0x20, 0x04, 0xee, 0x3d, 0x30, 0x00, 0x88, 0x70, 0xb4, 0x01,
+    0xfe, 0x23, 0x48, 0x5b, 0x00, 0x4e, 0x5a, 0xc3, 0x80, 0x00, 0x1d, 0xf7, 0x28, 0x80, 0x09, 0x81,
+    0x10, 0x7c, 0x10, 0x95, 0xb6, 0x66, 0x0c, 0x19, 0x48, 0x04, 0x39, 0x85, 0x03, 0x00, 0xc6, 0xa0,
+    0x1f, 0xc4, 0x04, 0x01, 0x8d, 0x50, 0xa0, 0x02, 0x1c, 0xc0, 0x4a, 0xdb, 0x33, 0x46, 0xc1, 0x30,
+    0x22, 0x0d, 0x84, 0x00, 0x2f, 0xfb, 0xac, 0xc0, 0x34, 0x5d, 0x87, 0x14, 0x02, 0x34, 0x5a, 0x6b,
+    0x00, 0xfa, 0xc5, 0x00, 0x3c, 0x40, 0x40, 0x1f, 0xfc, 0x32, 0x02, 0x00, 0xf5, 0x8a, 0x00, 0x0d,
+    0x16, 0xda, 0xc0, 0x28, 0xbb, 0x06, 0x28, 0x00, 0x2f, 0xff, 0x18, 0x02, 0x2e, 0xf1, 0x80, 0x0d,
+    0x13, 0x00, 0x7f, 0xd7, 0xff, 0x68, 0x05, 0x39, 0x97, 0x00, 0x44, 0x67, 0x80, 0x3f, 0xe3, 0x44,
+    0xc0, 0x14, 0x5d, 0xe3, 0x00, 0x2f, 0xff, 0x00, 0x51, 0x77, 0x80, 0x23, 0x44, 0xc0, 0x1f, 0xfc,
+    0x7b, 0xff, 0xa8, 0x02, 0x9c, 0xca, 0x00, 0x22, 0x33, 0x88, 0x03, 0xff, 0x8a, 0x00, 0x00, 0x1d,
+    0xf7, 0x28, 0x40, 0x09, 0x81, 0x10, 0x7f, 0x10, 0x94, 0xb6, 0x66, 0x0c, 0x19, 0x40, 0x04, 0x37,
+    0x8a, 0x06, 0x01, 0x91, 0x40, 0x3b, 0x3f, 0xe2, 0x03, 0x00, 0x76, 0xb1, 0x21, 0x48, 0x00, 0x88,
+    0x8e, 0x12, 0xb6, 0xcc, 0xc2, 0xb0, 0x4c, 0x08, 0x83, 0x70, 0x80, 0x2f, 0x40, 0x0d, 0xec, 0x01,
+    0xff, 0xd1, 0xbf, 0xfc, 0x01, 0xa7, 0x33, 0x00, 0x62, 0x33, 0xc0, 0x1f, 0xfd, 0x10, 0x2f, 0x40,
+    0x0f, 0xfe, 0x78, 0x00, 0xc5, 0xe6, 0x01, 0xff, 0xd7, 0x57, 0x00, 0xe2, 0x80, 0x03, 0x80, 0xa0,
+    0x4a, 0xc1, 0x10, 0xe5, 0x28, 0x7c, 0x00, 0x2f, 0x40, 0x00, 0xee, 0x80, 0x3d, 0x47, 0x80, 0x1d,
+    0x29, 0xa2, 0x01, 0x9d, 0xac, 0xc0, 0x36, 0xc1, 0xa0, 0x07, 0x32, 0x9a, 0x80, 0x73, 0x52, 0xd8,
+    0x80, 0x6d, 0x0b, 0x0b, 0x00, 0xf0, 0xd2, 0xa8, 0x03, 0xc8, 0xb6, 0x20, 0x2f, 0x40, 0x0f, 0xff,
+    0x59, 0xa2, 0x46, 0x00, 0x8b, 0xba, 0x00, 0x2f, 0xf0, 0x07, 0x5f, 0xb0, 0x04, 0xc0, 0x10, 0xa0,
+    0x06, 0x2a, 0x00, 0x98, 0x44, 0x01, 0x29, 0x88, 0x02, 0xdc, 0x03, 0x60, 0xb0, 0x11, 0xd0, 0x06,
+    0x77, 0x50, 0x50, 0x98, 0x07, 0x51, 0x11, 0x58, 0x03, 0xc6, 0x50, 0x54, 0x01, 0xf5, 0x29, 0x90,
+    0x07, 0xcc, 0x14, 0x01, 0x80, 0x2f, 0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec, 0x03, 0xe9,
+    0x08, 0x00, 0xf0, 0xc3, 0x90, 0x07, 0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6, 0x40, 0x3e,
+    0xb2, 0x00, 0xf8, 0x60, 0x00, 0x00, 0x00, 0x1d, 0xf6, 0xc8, 0x80, 0x49, 0x81, 0x14, 0x9e, 0x20,
+    0x09, 0x5b, 0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31, 0x81, 0x00, 0x7f,
+    0x94, 0x08, 0x03, 0x18, 0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6, 0x7c, 0x0b, 0x00, 0x26,
+    0x04, 0x52, 0x78, 0x80, 0x2f, 0xfd, 0x88, 0x01, 0x46, 0x53, 0xd9, 0x80, 0x0c, 0xcb, 0x65, 0x60,
+    0x1e, 0x11, 0x00, 0x73, 0x1e, 0x80, 0x2f, 0xfd, 0x30, 0x80, 0x09, 0xcd, 0xf7, 0x00, 0x88, 0xc8,
+    0x03, 0xff, 0x8e, 0x00, 0x00, 0x1d, 0xf6, 0xc8, 0x80, 0x49, 0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b,
+    0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31, 0x81, 0x00, 0x7f, 0x1a, 0x81,
+    0x01, 0x18, 0x18, 0x88, 0xca, 0x00, 0x18, 0xb2, 0x80, 0x09, 0x5b, 0x44, 0x51, 0xd8, 0x01, 0x30,
+    0x21, 0x48, 0x44, 0x01, 0x1d, 0xf7, 0x36, 0xcc, 0x00, 0x2f, 0xfd, 0xaa, 0x01, 0x46, 0x5b, 0xd2,
+    0x00, 0x0c, 0xc9, 0x47, 0xc0, 0x1e, 0x70, 0x0f, 0x2a, 0x78, 0x02, 0xff, 0xd5, 0x0a, 0x00, 0x9c,
+    0x80, 0x50, 0x08, 0x8d, 0xc6, 0x00, 0x3d, 0x0a, 0x40, 0x1c, 0xc3, 0x00, 0x02, 0xbe, 0xe5, 0x90,
+    0x03, 0x1e, 0x20, 0xd8, 0x08, 0x3c, 0xcc, 0xe1, 0x47, 0x0a, 0x00, 0x1f, 0xa1, 0xbb, 0xba, 0x94,
+    0x02, 0x8d, 0x91, 0xad, 0x12, 0x42, 0x7b, 0xd2, 0x94, 0xb1, 0x00, 0x11, 0x05, 0xc7, 0x55, 0x54,
+    0x54, 0x38, 0xd7, 0x4d, 0x66, 0x00, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a,
+    0x20, 0xc0, 0x3f, 0xfd, 0x80, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc, 0x6e, 0x01, 0xc2, 0x41,
+    0x80, 0x13, 0x83, 0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28, 0x00, 0xbc, 0x00, 0xef,
+    0x6d, 0x31, 0x00, 0x94, 0x1d, 0xc0, 0xc0, 0x17, 0x98, 0x89, 0x2c, 0x02, 0x5a, 0x00, 0x71, 0x88,
+    0x28, 0x38, 0x01, 0x41, 0xc3, 0xd0, 0x40, 0x25, 0xa0, 0x5d, 0x00, 0xde, 0x6a, 0x0e, 0x01, 0x94,
+    0x2d, 0x04, 0x03, 0x94, 0x74, 0x02, 0x00, 0xca, 0x00, 0xab, 0xc8, 0x00, 0x5e, 0x89, 0x00, 0x4e,
+    0x08, 0x00, 0x40, 0x4c, 0x12, 0x01, 0x24, 0xc0, 0x06, 0x18, 0x20, 0x20, 0x20, 0xea, 0x00, 0x1d,
+    0x00, 0x09, 0x81, 0x88, 0x81, 0x21, 0x2c, 0x00, 0x62, 0x02, 0x61, 0x0a, 0x20, 0x10, 0x00, 0x82,
+    0x44, 0x40, 0x4f, 0xc3, 0x00, 0x8c, 0x2c, 0x48, 0x31, 0x16, 0xc0, 0x32, 0x32, 0x00, 0x10, 0x8d,
+    0x00, 0x36, 0x06, 0x00, 0x08, 0x40, 0xc0, 0x00, 0x4f, 0x40, 0x0a, 0xb8, 0x11, 0x68, 0x00, 0x8b,
+    0x40, 0x0b, 0x09, 0x0a, 0x54, 0x00, 0x0c, 0x35, 0x85, 0x80, 0x66, 0x44, 0x58, 0x80, 0x73, 0x06,
+    0x00, 0x74, 0x1c, 0x31, 0x80, 0x46, 0xf6, 0xe9, 0xc0, 0x17, 0x22, 0x84, 0x94, 0x04, 0x15, 0x00,
+    0x0a, 0x1c, 0x80, 0x9e, 0x10, 0x09, 0xfc, 0xa0, 0x20, 0x00, 0x32, 0xc4, 0x32, 0xc4, 0x10, 0x10,
+    0x00, 0x72, 0x92, 0x68, 0x10, 0x0a, 0x53, 0xc9, 0x80, 0x32, 0x20, 0xa4, 0x03, 0xda, 0x08, 0x01,
+    0xff, 0xd2, 0x00, 0x7f, 0xff, 0x53, 0x5d, 0xe8, 0x0c, 0x14, 0x49, 0x65, 0x58, 0x03, 0x50, 0x58,
+    0x06, 0x74, 0xd1, 0x00, 0x8e, 0x20, 0x60, 0x1b, 0x91, 0xc0, 0x35, 0x1d, 0x00, 0x66, 0x56, 0x54,
+    0x48, 0xb0, 0x1e, 0xef, 0x48, 0x0f, 0xf4, 0x00, 0x26, 0x40, 0x02, 0x10, 0x0f, 0xfe, 0xb5, 0xc0,
+    0x6e, 0xa4, 0x62, 0x00, 0xb2, 0x80, 0x2c, 0x40, 0x09, 0x0c, 0x40, 0x04, 0x28, 0x01, 0x3e, 0x00,
+    0x58, 0x80, 0x12, 0x11, 0x00, 0x02, 0x48, 0x01, 0x2e, 0x00, 0x58, 0x80, 0x12, 0x09, 0x80, 0x7f,
+    0xf0, 0xb4, 0x80, 0x04, 0x80, 0x3f, 0xfa, 0xcf, 0x60, 0x06, 0xdd, 0x08, 0x01, 0xfc, 0x00, 0x99,
+    0x45, 0x00, 0x13, 0x2b, 0x80, 0x72, 0x36, 0x23, 0x00, 0xff, 0xf6, 0xef, 0x80, 0x3f, 0x13, 0x78,
+    0x00, 0x05, 0xdf, 0xc3, 0x02, 0xa5, 0xc6, 0xd0, 0x3c, 0x82, 0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc,
+    0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x5a, 0x6f,
+    0x48, 0x06, 0x99, 0x5b, 0xc0, 0x05, 0xe8, 0xb2, 0xc0, 0x11, 0x80, 0x08, 0x40, 0x23, 0x00, 0x10,
+    0x80, 0x5e, 0x8b, 0x2c, 0x01, 0x4c, 0xad, 0xe0, 0x00, 0x02, 0xbf, 0xd5, 0x01, 0xc1, 0xb5, 0xa3,
+    0x71, 0xb4, 0x89, 0x0e, 0x21, 0x00, 0x31, 0xf1, 0x08, 0x01, 0x8d, 0xc6, 0xce, 0x24, 0x07, 0x5b,
+    0x16, 0x8c, 0x00, 0xe9, 0xb0, 0x0f, 0xfe, 0x1a, 0x6f, 0x51, 0x80, 0xdb, 0xee, 0x94, 0x1c, 0x68,
+    0xdd, 0x03, 0x8c, 0x02, 0x30, 0xe3, 0x00, 0x8c, 0x1c, 0x68, 0xdd, 0x00, 0x6d, 0xf7, 0x4c, 0x00,
+    0x03, 0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e, 0x0e, 0xe8, 0xb7, 0x87, 0x3f,
+    0xdb, 0x6e, 0x36, 0x4f, 0xa8, 0x38, 0xb9, 0x72, 0xa0, 0x02, 0xcf, 0x0b, 0x1d, 0x02, 0x72, 0xe4,
+    0x5f, 0xf2, 0x2f, 0x08, 0x00, 0x40, 0x3f, 0xf8, 0x80, 0x04, 0xdf, 0xaa, 0x58, 0xda, 0xf7, 0xa8,
+    0x38, 0xc0, 0xaa, 0x83, 0x8c, 0x02, 0x20, 0xe2, 0x00, 0x8c, 0x1c, 0x28, 0xdd, 0x00, 0x6d, 0xf7,
+    0x4c, 0x00, 0x5d, 0xea, 0x51, 0x17, 0x49, 0x31, 0xf8, 0xda, 0xec, 0x41, 0x40, 0x3f, 0x10, 0x0f,
+    0xfe, 0x43, 0xef, 0x40, 0x05, 0x50, 0xee, 0x40, 0x07, 0x2c, 0x89, 0x80, 0x0c, 0x00, 0x5e, 0x01,
+    0xff, 0xc9, 0x00, 0x3e, 0x12, 0x71, 0x14, 0x81, 0xf8, 0x80, 0x7f, 0xf1, 0x80, 0x03, 0xe1, 0x02,
+    0x71, 0x01, 0x90, 0x01, 0xf8, 0x80, 0x7f, 0xf3, 0x5c, 0x02, 0xc1, 0x13, 0x3c, 0x00, 0x3f, 0x10,
+    0x0f, 0xfe, 0x54, 0x79, 0x80, 0x4e, 0xeb, 0x30, 0x04, 0xc5, 0xa0, 0x04, 0xe0, 0xe0, 0x1b, 0x13,
+    0x80, 0x31, 0x51, 0xd0, 0x06, 0x1d, 0x57, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x78, 0x3f, 0x5d, 0xd2,
+    0xab, 0x79, 0xc0, 0x2e, 0x97, 0xa9, 0x93, 0xc1, 0x00, 0x21, 0x20, 0x21, 0x20, 0x1c, 0x00, 0x40,
+    0x60, 0xe0, 0x20, 0x1f, 0xfd, 0x70, 0x3f, 0x5d, 0xe8, 0x00, 0xa6, 0x1d, 0xc8, 0x00, 0xe5, 0x91,
+    0x30, 0x01, 0x80, 0x0b, 0xc0, 0x3f, 0xf9, 0x20, 0x02, 0xbf, 0xd5, 0x01, 0xc1, 0xca, 0xa2, 0x38,
+    0xd9, 0xb9, 0x77, 0x08, 0x40, 0x08, 0xdc, 0x42, 0x00, 0x56, 0x71, 0xb3, 0x73, 0xe1, 0xd6, 0xca,
+    0xa2, 0x00, 0x3f, 0x5d, 0xe9, 0x00, 0xd3, 0x2b, 0x78, 0x00, 0xbd, 0x16, 0x58, 0x02, 0x30, 0x01,
+    0x08, 0x04, 0x60, 0x02, 0x10, 0x0b, 0xd1, 0x65, 0x80, 0x29, 0x95, 0xbc, 0x00, 0x49, 0xbd, 0x20,
+    0x1f, 0xfc, 0x60, 0x04, 0xdf, 0xaa, 0x58, 0xda, 0xf7, 0xa8, 0x38, 0xc0, 0xaa, 0x83, 0x8c, 0x02,
+    0x20, 0xe2, 0x00, 0x8c, 0x1c, 0x28, 0xdd, 0x00, 0x6d, 0xf7, 0x94, 0x00, 0x9b, 0xd2, 0x60, 0x1f,
+    0xfc, 0x30, 0x3f, 0x7e, 0x20, 0x06, 0x51, 0x00, 0x21, 0x00, 0x22, 0x00, 0xff, 0xe2, 0x80, 0x08,
+    0xef, 0xa1, 0x47, 0xbc, 0x78, 0x70, 0x01, 0xfd, 0x9c, 0xc7, 0xc8, 0x89, 0x77, 0x41, 0xe9, 0x8a,
+    0x01, 0x2b, 0xde, 0xbf, 0x00, 0x05, 0x40, 0x07, 0x68, 0x72, 0x37, 0xf8, 0xd7, 0x85, 0xcc, 0x40,
+    0x3f, 0x85, 0x48, 0x24, 0x34, 0x3f, 0x10, 0x06, 0x40, 0x07, 0xff, 0x1c, 0x40, 0x22, 0x00, 0x18,
+    0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x8c, 0x00, 0xac, 0x00, 0xba, 0x38, 0xc4, 0x0c, 0x69, 0x05,
+    0x82, 0x8c, 0x81, 0xec, 0x1e, 0x80, 0x14, 0x6c, 0x2e, 0x00, 0x32, 0x85, 0x10, 0x0a, 0x87, 0x80,
+    0x00, 0xbb, 0x00, 0x2f, 0x00, 0x15, 0x9a, 0x80, 0x04, 0x31, 0x04, 0xb7, 0x03, 0x42, 0x34, 0x21,
+    0x51, 0x34, 0xc4, 0x46, 0x29, 0x10, 0x13, 0x13, 0x71, 0x31, 0x00, 0x16, 0x86, 0x88, 0x24, 0xd0,
+    0x01, 0x8a, 0x00, 0x10, 0x10, 0x00, 0x5f, 0x20, 0x5f, 0x25, 0x57, 0x0d, 0xc9, 0x05, 0x96, 0x2b,
+    0x00, 0x05, 0x8b, 0xc0, 0x22, 0x73, 0x90, 0x0b, 0x97, 0x0e, 0x01, 0xca, 0xc2, 0x9c, 0xc0, 0xac,
+    0x00, 0xba, 0x38, 0xc4, 0x0c, 0x69, 0x05, 0xc2, 0x8c, 0x81, 0xe8, 0x1e, 0x80, 0x14, 0x6a, 0x2e,
+    0x00, 0x32, 0xb4, 0x10, 0x0a, 0x87, 0x80, 0x30, 0x82, 0x80, 0x47, 0x6e, 0x01, 0x16, 0x34, 0x00,
+    0x40, 0x6f, 0xfd, 0x8d, 0xba, 0xb0, 0xa0, 0x22, 0x42, 0x30, 0x02, 0x0a, 0x80, 0x08, 0xfa, 0x20,
+    0x34, 0xc2, 0x44, 0x71, 0x6d, 0xd7, 0x00, 0x00, 0x15, 0xd8, 0x01, 0x0f, 0x20, 0x07, 0xb2, 0x00,
+    0x84, 0x02, 0x30, 0x09, 0x45, 0x41, 0x29, 0x8c, 0x15, 0xd8, 0xc0, 0x60, 0x54, 0x02, 0x30, 0x0c,
+    0x38, 0x01, 0x42, 0xe0, 0x01, 0x3f, 0x40, 0x9a, 0x00, 0xff, 0xe9, 0x00, 0x7c, 0x40, 0x03, 0x2d,
+    0x00, 0x06, 0x84, 0x40, 0x01, 0x00, 0xf1, 0x80, 0x08, 0x2c, 0x40, 0x14, 0xd2, 0x00, 0xa5, 0xa0,
+    0x20, 0x82, 0x00, 0x8c, 0x00, 0xa0, 0x21, 0x11, 0x00, 0x27, 0xdc, 0x00, 0x00, 0x00, 0xf0, 0x88,
+    0x1f, 0xf5, 0x8b, 0xd0, 0x23, 0x26, 0xf4, 0xd4, 0x38, 0xd3, 0x76, 0x00, 0x00, 0x3e, 0x31, 0x21,
+    0x2c, 0x21, 0xd2, 0x32, 0x00, 0x84, 0x02, 0x10, 0x0f, 0x9c, 0x00, 0xb4, 0x03, 0x98, 0xa0, 0x40,
+    0x17, 0x22, 0xbe, 0x28, 0x8c, 0x3c, 0x37, 0xc1, 0x30, 0x1d, 0x60, 0x0f, 0xb0, 0x4c, 0x07, 0x59,
+    0x0f, 0x0b, 0x0d, 0xc3, 0x20, 0x13, 0xc4, 0x00, 0xe5, 0x22, 0x00, 0x00, 0x2e, 0xfd, 0x08, 0x00,
+    0xa9, 0x6d, 0xe8, 0x01, 0x43, 0x09, 0x08, 0x00, 0x25, 0x00, 0x25, 0x00, 0x0c, 0x02, 0x15, 0x08,
+    0x64, 0xff, 0x28, 0x02, 0x58, 0xb7, 0x4a, 0x00, 0x1e, 0x02, 0x20, 0x08, 0x15, 0xb1, 0x99, 0x78,
+    0x68, 0xd3, 0x31, 0x4c, 0x20, 0x00, 0xfe, 0x2c, 0x5b, 0xec, 0x5b, 0x42, 0x7a, 0xdd, 0x4d, 0xb2,
+    0x02, 0xdb, 0x1a, 0xe1, 0x09, 0x02, 0x00, 0x44, 0x6a, 0x01, 0xf8, 0x48, 0x10, 0x02, 0x23, 0x40,
+    0x2a, 0x62, 0x5c, 0x10, 0x27, 0xba, 0xd8, 0x82, 0x28, 0xcb, 0x00, 0xb6, 0xa5, 0x08, 0x10, 0xa1,
+    0x4a, 0x83, 0xd0, 0x82, 0xd8, 0x93, 0xc0, 0x0c, 0x1e, 0x48, 0x09, 0xc2, 0x44, 0xe1, 0x4e, 0xb0,
+    0xee, 0x0a, 0x75, 0x87, 0x70, 0x53, 0xac, 0x3b, 0x82, 0x01, 0xf0, 0xe4, 0x00, 0xf4, 0x33, 0x08,
+    0x01, 0xc8, 0x01, 0xe8, 0x60, 0x03, 0xcf, 0xc3, 0x00, 0x7b, 0xdb, 0xf8, 0x00, 0xb1, 0x2a, 0x40,
+    0x13, 0x0e, 0x2a, 0x05, 0x2d, 0x3a, 0x60, 0x85, 0x3c, 0xb8, 0x4a, 0x6a, 0x10, 0x68, 0x75, 0x4c,
+    0x73, 0x40, 0x5e, 0x68, 0x92, 0x02, 0x1a, 0x6b, 0x01, 0xd6, 0x13, 0x00, 0x0c, 0x4f, 0x24, 0x80,
+    0x1f, 0xf7, 0x90, 0x00, 0x28, 0x05, 0x53, 0xa8, 0x7e, 0x00, 0x00, 0xff, 0xe1, 0x2d, 0xfe, 0xc8,
+    0x80, 0x69, 0xac, 0xb8, 0x2f, 0x30, 0x02, 0xb6, 0xfd, 0x47, 0xbf, 0x00, 0x22, 0x0a, 0xaa, 0x5b,
+    0xb1, 0xa8, 0x12, 0x5d, 0x24, 0x51, 0xae, 0x80, 0x04, 0x60, 0x03, 0x08, 0x80, 0x04, 0x8b, 0x42,
+    0xb8, 0x29, 0xa1, 0x51, 0x2f, 0xd5, 0x2c, 0x08, 0x0e, 0x59, 0xd9, 0x8f, 0x8a, 0x10, 0x06, 0x2d,
+    0xe6, 0x17, 0x10, 0x03, 0x47, 0x6f, 0xe1, 0x80, 0x00, 0x09, 0xdc, 0x54, 0x3d, 0xaa, 0x30, 0x5e,
+    0x85, 0x8d, 0xe8, 0x53, 0xee, 0x00, 0x00, 0x56, 0x17, 0x40, 0x42, 0x77, 0x16, 0x15, 0xea, 0xca,
+    0x81, 0xc4, 0xf0, 0x48, 0x0a, 0xa0, 0x5f, 0x44, 0x12, 0x7a, 0x1d, 0x80, 0xaf, 0xfd, 0x91, 0xbb,
+    0x38, 0x11, 0x6c, 0x40, 0x00, 0x46, 0xf4, 0x88, 0x02, 0x87, 0x3f, 0xb0, 0x10, 0x6b, 0x29, 0x54,
+    0xe7, 0xa0, 0xfd, 0x57, 0x80, 0x12, 0x5e, 0x00, 0x12, 0x81, 0xe4, 0xef, 0x0d, 0xaa, 0x1c, 0x15,
+    0xc2, 0x87, 0x3b, 0x98, 0x00, 0x2e, 0xe9, 0x4b, 0xfe, 0x50, 0x07, 0xdc, 0x23, 0x9e, 0x4e, 0x73,
+    0x2d, 0x14, 0x7e, 0xb9, 0x0a, 0xee, 0x20, 0x00, 0x35, 0x00, 0x70, 0x88, 0x02, 0xef, 0x84, 0xff,
+    0x1e, 0x6b, 0x1e, 0xe8, 0xc8, 0x9c, 0xe4, 0x40, 0x09, 0xec, 0x02, 0xef, 0xfe, 0x3c, 0xcf, 0x18,
+    0x1a, 0xeb, 0x27, 0x0e, 0x05, 0x6a, 0x45, 0x50, 0x4c, 0x61, 0x43, 0x1e, 0x40, 0x0a, 0xec, 0x33,
+    0x17, 0x35, 0x1c, 0x6a, 0x52, 0xce, 0xbc, 0x21, 0x72, 0xf0, 0x0b, 0x93, 0x69, 0x00, 0x3f, 0x10,
+    0x06, 0x40, 0x07, 0xff, 0x28, 0x40, 0x32, 0x80, 0x08, 0x03, 0x42, 0x48, 0x18, 0x80, 0x12, 0x8e,
+    0xd9, 0x00, 0x13, 0xd4, 0x9a, 0xa0, 0x1f, 0xfc, 0x40, 0x04, 0xcf, 0xf9, 0xce, 0xcc, 0x2c, 0x82,
+    0xc0, 0x24, 0x10, 0x10, 0x0f, 0x60, 0x07, 0x95, 0x80, 0x3d, 0x3d, 0x60, 0x1c, 0x28, 0x01, 0xff,
+    0xc5, 0x00, 0x2b, 0x21, 0x51, 0x00, 0x10, 0x05, 0x98, 0x4f, 0x14, 0x39, 0x00, 0x4d, 0xd1, 0x28,
+    0x36, 0x80, 0x7c, 0x00, 0x09, 0xee, 0x38, 0x33, 0xe6, 0xc2, 0x63, 0x91, 0x9d, 0x8e, 0x46, 0x73,
+    0x3e, 0x6c, 0x20, 0x5f, 0x3a, 0xd0, 0x02, 0xbe, 0xc0, 0xd8, 0x02, 0x17, 0xb8, 0xb0, 0x02, 0xaa,
+    0x61, 0xc0, 0xd5, 0xba, 0x84, 0x56, 0xaa, 0x33, 0x80, 0x02, 0x20, 0x06, 0x41, 0x07, 0xcb, 0x00,
+    0x9a, 0x04, 0x12, 0x40, 0x22, 0x8e, 0x00, 0x18, 0x06, 0xe8, 0x20, 0x0f, 0x3b, 0x98, 0x03, 0xc7,
+    0x34, 0x3d, 0x20, 0x07, 0x9e, 0xb1, 0xd4, 0x30, 0x0a, 0x5d, 0x62, 0xf0, 0x02, 0x47, 0xa0, 0x6a,
+    0x85, 0x41, 0xaa, 0x00, 0x3b, 0x61, 0x50, 0x79, 0x00, 0x33, 0x50, 0x00, 0x02, 0x20, 0x06, 0x31,
+    0x06, 0xdb, 0x00, 0x97, 0x84, 0x0a, 0x00, 0x22, 0xbf, 0x00, 0x20, 0x06, 0xe8, 0x20, 0x0f, 0x3b,
+    0x98, 0x03, 0x08, 0x8e, 0x69, 0xb6, 0xc8, 0x1a, 0x3a, 0x86, 0x30, 0xe8, 0x01, 0x28, 0x80, 0xe3,
+    0x4b, 0x05, 0x49, 0x00, 0x2f, 0x79, 0x8c, 0x70, 0x00, 0x6c, 0xb6, 0x40, 0x09, 0xc8, 0x00, 0x87,
+    0x48, 0x10, 0x71, 0x88, 0x01, 0x6a, 0x40, 0x93, 0xc8, 0x40, 0xaf, 0x00, 0x10, 0xf3, 0xa0, 0xdf,
+    0x00, 0x4a, 0xe0, 0x01, 0xb7, 0x30, 0x09, 0xeb, 0xc4, 0x1e, 0x47, 0x68, 0x0b, 0x7b, 0x2e, 0x42,
+    0x98, 0x40, 0x21, 0x97, 0x47, 0x2f, 0x00, 0xc8, 0xf0, 0x14, 0x94, 0x8a, 0x00, 0x9a, 0x10, 0xdd,
+    0x52, 0x28, 0x03, 0x50, 0x03, 0x25, 0x80, 0x00, 0x0f, 0x28, 0x06, 0x15, 0x60, 0x0e, 0x82, 0x00,
+    0xec, 0x50, 0x0c, 0xe0, 0xc0, 0x14, 0x42, 0xc8, 0x00, 0x6f, 0x68, 0x01, 0x28, 0x20, 0x03, 0x9d,
+    0x02, 0x52, 0x45, 0x4a, 0x92, 0xd2, 0xc8, 0x00, 0x17, 0x98, 0x07, 0x8a, 0x60, 0x03, 0xec, 0x46,
+    0x00, 0xf2, 0x96, 0x80, 0x72, 0x84, 0x20, 0x80, 0x6f, 0x45, 0x17, 0x00, 0xcb, 0xa0, 0x94, 0x01,
+    0x28, 0x38, 0x79, 0x88, 0x03, 0x83, 0xbe, 0x81, 0x80, 0x09, 0x19, 0x92, 0xd8, 0x30, 0x31, 0x9d,
+    0xe6, 0x5a, 0x82, 0x01, 0x28, 0x28, 0x00, 0xcf, 0xa0, 0x1f, 0x57, 0x00, 0x7a, 0x89, 0x40, 0x3c,
+    0xa5, 0xa0, 0x1c, 0xa1, 0x08, 0x20, 0x1b, 0xd1, 0x45, 0xc0, 0x32, 0xe8, 0x25, 0x00, 0x4a, 0x0e,
+    0x1e, 0x62, 0x00, 0xe0, 0xef, 0xa0, 0x60, 0x02, 0x46, 0x64, 0xb6, 0x0c, 0x0c, 0x67, 0x79, 0x96,
+    0xa0, 0x80, 0x4a, 0x0a, 0x00, 0x00, 0x8d, 0xc4, 0x03, 0x87, 0xb6, 0x80, 0x39, 0x62, 0xb0, 0x80,
+    0x32, 0x7f, 0x84, 0x80, 0x39, 0x4b, 0x40, 0x39, 0x42, 0x10, 0x40, 0x37, 0xa2, 0x8b, 0x80, 0x65,
+    0xd0, 0x4a, 0x00, 0x94, 0x1c, 0x3c, 0xc4, 0x01, 0xc1, 0xdf, 0x40, 0xc0, 0x04, 0x8c, 0xc9, 0x6c,
+    0x18, 0x18, 0xce, 0xf3, 0x2d, 0x41, 0x00, 0x94, 0x14, 0x00, 0x26, 0xeb, 0x04, 0x03, 0x26, 0xeb,
+    0x04, 0x03, 0xab, 0xd8, 0x03, 0xca, 0x5a, 0x01, 0xca, 0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03,
+    0x2e, 0x82, 0x50, 0x04, 0xa0, 0xe1, 0xe6, 0x20, 0x0e, 0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b,
+    0x60, 0xc0, 0xc6, 0x77, 0x99, 0x6a, 0x08, 0x04, 0xa0, 0xa0, 0x00, 0x2b, 0x04, 0x18, 0x06, 0xcc,
+    0x02, 0xa8, 0x03, 0x4d, 0x06, 0xb0, 0x07, 0x57, 0xb0, 0x07, 0x94, 0xb4, 0x03, 0x94, 0x21, 0x04,
+    0x03, 0x7a, 0x28, 0xb8, 0x06, 0x5d, 0x04, 0xa0, 0x09, 0x41, 0xc3, 0xcc, 0x40, 0x1c, 0x1d, 0xf4,
+    0x0c, 0x00, 0x48, 0xcc, 0x96, 0xc1, 0x81, 0x8c, 0xef, 0x32, 0xd4, 0x10, 0x09, 0x41, 0x40, 0x00,
+    0xa3, 0x14, 0x03, 0x85, 0x76, 0x00, 0x38, 0x57, 0x60, 0x03, 0xc4, 0x66, 0x00, 0xf2, 0x96, 0x80,
+    0x72, 0x84, 0x20, 0x80, 0x6f, 0x45, 0x17, 0x00, 0xcb, 0xa0, 0x94, 0x01, 0x28, 0x38, 0x79, 0x88,
+    0x03, 0x83, 0xbe, 0x81, 0x80, 0x09, 0x19, 0x92, 0xd8, 0x30, 0x31, 0x9d, 0xe6, 0x5a, 0x82, 0x01,
+    0x28, 0x28, 0x00, 0xdd, 0xff, 0xf2, 0x80, 0x4a, 0x36, 0x0d, 0x77, 0x90, 0x02, 0x95, 0x40, 0xf4,
+    0x4c, 0x20, 0x02, 0x39, 0x00, 0xff, 0x59, 0x18, 0x07, 0xf9, 0xac, 0x02, 0x9f, 0xfc, 0x00, 0x60,
+    0x9f, 0xf0, 0x4f, 0xfe, 0x00, 0x5a, 0xee, 0xc0, 0x1f, 0x21, 0x49, 0x14, 0x1e, 0x89, 0x87, 0x8c,
+    0xc0, 0x19, 0xae, 0xf2, 0x00, 0x00, 0x1d, 0xf7, 0x28, 0x80, 0x09, 0x81, 0x10, 0x7c, 0x10, 0x94,
+    0xb6, 0x66, 0x0c, 0x19, 0x40, 0x04, 0x37, 0x8a, 0x06, 0x01, 0x91, 0x40, 0x3f, 0x88, 0x08, 0x03,
+    0x1a, 0x20, 0x60, 0x02, 0x1d, 0xe0, 0xb5, 0xb5, 0x56, 0x8c, 0x02, 0xd8, 0x55, 0x1f, 0x48, 0x00,
+    0x96, 0xb1, 0x64, 0x01, 0xd5, 0x86, 0x01, 0xea, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x80, 0x79, 0xd9,
+    0x40, 0x22, 0xff, 0x25, 0x7f, 0x8c, 0x01, 0x17, 0x78, 0xc0, 0x06, 0x89, 0x80, 0x3f, 0xeb, 0xff,
+    0xb4, 0x02, 0x9c, 0xcb, 0x80, 0x22, 0x33, 0xc0, 0x1f, 0xf1, 0xa2, 0x60, 0x0a, 0x2e, 0xf1, 0x80,
+    0x00, 0xd9, 0x00, 0x1c, 0x81, 0x00, 0x02, 0xff, 0x59, 0xff, 0x8c, 0x01, 0x17, 0x78, 0xc0, 0x06,
+    0x89, 0x80, 0x3f, 0xeb, 0xff, 0xb4, 0x02, 0x9c, 0xcb, 0x80, 0x22, 0x33, 0xc0, 0x1f, 0xf1, 0xa2,
+    0x60, 0x0a, 0x2e, 0xf1, 0x80, 0x00, 0x99, 0x80, 0x1c, 0xb7, 0x4c, 0x01, 0x8f, 0xf8, 0x40, 0x05,
+    0xf3, 0xba, 0x8f, 0x30, 0x04, 0x5d, 0xe3, 0x00, 0x1a, 0x26, 0x00, 0xff, 0xaf, 0xfe, 0xd0, 0x0a,
+    0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x7f, 0xc6, 0x89, 0x80, 0x28, 0xbb, 0xc6, 0x00, 0x00, 0x41,
+    0x12, 0x40, 0x33, 0x3b, 0x38, 0x80, 0x5c, 0xa9, 0xc2, 0x05, 0xff, 0xe3, 0x00, 0x45, 0xde, 0x30,
+    0x01, 0xa2, 0x60, 0x0f, 0xfa, 0xff, 0xed, 0x00, 0xa7, 0x32, 0xe0, 0x08, 0x8c, 0xf0, 0x07, 0xfc,
+    0x68, 0x98, 0x02, 0x8b, 0xbc, 0x60, 0x0d, 0x60, 0x04, 0xd8, 0x01, 0x89, 0x00, 0x3f, 0xfb, 0x00,
+    0x04, 0xf1, 0x0f, 0xa1, 0x24, 0x10, 0x0f, 0xfe, 0xc8, 0x01, 0x72, 0x00, 0x6e, 0xbc, 0x0a, 0xa9,
+    0x06, 0x49, 0xe2, 0x60, 0x1f, 0xfe, 0x10, 0x37, 0x06, 0x55, 0x50, 0x6e, 0x9b, 0x42, 0xe0, 0x0b,
+    0xd0, 0x03, 0xff, 0xc4, 0x00, 0x0a, 0xff, 0xb6, 0x00, 0x31, 0x65, 0xd3, 0x68, 0x04, 0x26, 0x8f,
+    0x84, 0xe0, 0x1e, 0x25, 0xb0, 0x0f, 0xb4, 0xb5, 0x4f, 0xfc, 0x20, 0x17, 0xa1, 0x6e, 0x84, 0x34,
+    0x88, 0x22, 0x22, 0x01, 0x2d, 0x80, 0x04, 0xd1, 0xf0, 0xdc, 0x00, 0x59, 0x76, 0x6c, 0x00, 0x00,
+    0x0e, 0x6e, 0x90, 0x03, 0x0e, 0x6e, 0x90, 0x00, 0x5f, 0x60, 0x1b, 0xd8, 0x00, 0x8a, 0x01, 0xf1,
+    0xd8, 0x07, 0xd2, 0x10, 0x01, 0xe1, 0x87, 0x20, 0x0f, 0x31, 0x48, 0x07, 0xdc, 0x88, 0x00, 0xf1,
+    0xac, 0x80, 0x7d, 0x64, 0x01, 0xf0, 0xc0, 0x00, 0x00, 0xa6, 0x80, 0x3f, 0x42, 0x10, 0x07, 0xc3,
+    0xc4, 0x01, 0xe3, 0xbe, 0xd9, 0x10, 0x09, 0x30, 0x22, 0x93, 0xc4, 0x01, 0x2b, 0x6c, 0xf8, 0x10,
+    0x06, 0x52, 0x01, 0x0c, 0xb0, 0x28, 0x18, 0x06, 0x30, 0x20, 0x0f, 0xf2, 0x81, 0x00, 0x63, 0x02,
+    0x32, 0x80, 0x08, 0x65, 0x40, 0x12, 0xb6, 0xcf, 0x81, 0x60, 0x04, 0xc0, 0x8a, 0x4f, 0x10, 0x00,
+    0x00, 0xee, 0x50, 0x0f, 0x9d, 0x14, 0x03, 0xe7, 0xa0, 0x0f, 0x1d, 0xf6, 0xc8, 0x80, 0x49, 0x81,
+    0x14, 0x9e, 0x20, 0x09, 0x5b, 0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31,
+    0x81, 0x00, 0x7f, 0x94, 0x08, 0x03, 0x18, 0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6, 0x7c,
+    0x0b, 0x00, 0x26, 0x04, 0x52, 0x78, 0x80, 0x00, 0xce, 0xa0, 0x1f, 0x58, 0x73, 0x80, 0x7a, 0xde,
+    0xdc, 0x03, 0x8e, 0xfb, 0x64, 0x40, 0x24, 0xc0, 0x8a, 0x4f, 0x10, 0x04, 0xad, 0xb3, 0xe0, 0x40,
+    0x19, 0x48, 0x04, 0x32, 0xc0, 0xa0, 0x60, 0x18, 0xc0, 0x80, 0x3f, 0xca, 0x04, 0x01, 0x8c, 0x08,
+    0xca, 0x00, 0x21, 0x95, 0x00, 0x4a, 0xdb, 0x3e, 0x05, 0x80, 0x13, 0x02, 0x29, 0x3c, 0x40, 0x00,
+    0xa6, 0x8e, 0x80, 0x3c, 0xb3, 0xfe, 0x00, 0xf6, 0x1e, 0x28, 0x07, 0x1d, 0xf6, 0xc8, 0x80, 0x49,
+    0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b, 0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0,
+    0x31, 0x81, 0x00, 0x7f, 0x94, 0x08, 0x03, 0x18, 0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6,
+    0x7c, 0x0b, 0x00, 0x26, 0x04, 0x52, 0x78, 0x80, 0x00, 0x0c, 0x89, 0xb8, 0x07, 0x1b, 0x92, 0xd0,
+    0x07, 0x17, 0x1b, 0x68, 0x07, 0x1d, 0xf6, 0xc8, 0x80, 0x49, 0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b,
+    0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31, 0x81, 0x00, 0x7f, 0x94, 0x08,
+    0x03, 0x18, 0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6, 0x7c, 0x0b, 0x00, 0x26, 0x04, 0x52,
+    0x78, 0x80, 0x75, 0x00, 0x15, 0x00, 0xd2, 0x96, 0x00, 0x1a, 0x6b, 0x12, 0x80, 0x0e, 0x22, 0xf0,
+    0x00, 0xe2, 0xc5, 0x20, 0x53, 0x5b, 0xc5, 0x05, 0x58, 0x01, 0xfc, 0x00, 0x00, 0xff, 0xe0, 0x1d,
+    0xf7, 0x29, 0x78, 0x41, 0x30, 0x22, 0x0f, 0x4c, 0x21, 0x2b, 0x6c, 0xc0, 0x01, 0x01, 0x94, 0x00,
+    0x28, 0x19, 0x41, 0x40, 0x82, 0x13, 0xf4, 0x08, 0x02, 0x57, 0xd2, 0x00, 0x88, 0x1e, 0xa4, 0xc0,
+    0xc0, 0x90, 0x61, 0x98, 0x03, 0x2a, 0x00, 0x20, 0x25, 0x7c, 0x0b, 0x05, 0x1b, 0x0a, 0xa2, 0x78,
+    0x82, 0xea, 0x5f, 0xec, 0x88, 0x00, 0x00, 0xb5, 0x80, 0x3e, 0x9b, 0x00, 0xf9, 0x34, 0x03, 0x17,
+    0x98, 0x04, 0x3e, 0xa0, 0x1f, 0xfe, 0x37, 0x00, 0xe1, 0x20, 0xc0, 0x09, 0xc1, 0x81, 0xdd, 0x2b,
+    0x12, 0xa4, 0x11, 0x29, 0x4b, 0x14, 0x00, 0x00, 0xc9, 0xc2, 0x01, 0xe8, 0x80, 0x80, 0x7b, 0x18,
+    0x02, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc, 0x6e, 0x01, 0xc2, 0x41, 0x80, 0x13, 0x83, 0x03,
+    0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28, 0x00, 0x00, 0x89, 0xcc, 0x03, 0x8b, 0xcb, 0x8c,
+    0x03, 0x16, 0xae, 0x98, 0x00, 0xbc, 0xc0, 0x21, 0xf5, 0x00, 0xff, 0xf1, 0xb8, 0x07, 0x09, 0x06,
+    0x00, 0x4e, 0x0c, 0x0e, 0xe9, 0x58, 0x95, 0x20, 0x89, 0x4a, 0x58, 0xa0, 0x00, 0x00, 0x1b, 0x83,
+    0x28, 0x06, 0x5a, 0x0d, 0xd0, 0x06, 0x6d, 0x0b, 0x80, 0x01, 0x79, 0x80, 0x43, 0xea, 0x01, 0xff,
+    0xe3, 0x70, 0x0e, 0x12, 0x0c, 0x00, 0x9c, 0x18, 0x1d, 0xd2, 0xb1, 0x2a, 0x41, 0x12, 0x94, 0xb1,
+    0x40, 0x00, 0x00, 0xd3, 0x60, 0x1e, 0x17, 0xa0, 0x0a, 0x78, 0x45, 0xc2, 0xfe, 0x50, 0x10, 0x00,
+    0x19, 0x62, 0x19, 0x62, 0x08, 0x08, 0x00, 0x39, 0x49, 0x34, 0x08, 0x05, 0x29, 0xe4, 0xc0, 0x19,
+    0x10, 0x52, 0x01, 0xed, 0x04, 0x00, 0xff, 0xe9, 0x00, 0x3f, 0x30, 0x0f, 0xfe, 0x1e, 0x7f, 0x48,
+    0x06, 0xac, 0xa4, 0xa0, 0x09, 0x8d, 0x2d, 0x40, 0x3c, 0x60, 0x20, 0x18, 0x64, 0xc4, 0x01, 0x9f,
+    0xc1, 0xc0, 0x15, 0x6f, 0x61, 0x00, 0x4c, 0x42, 0x01, 0x00, 0x02, 0xbf, 0xd6, 0x00, 0xbd, 0xa9,
+    0x65, 0x00, 0x4a, 0x16, 0x0b, 0x40, 0xc1, 0x80, 0x02, 0x20, 0x0e, 0x43, 0xb0, 0x0d, 0x36, 0xa4,
+    0x01, 0xae, 0xc3, 0xe0, 0x18, 0x92, 0x04, 0xc0, 0x22, 0x48, 0x02, 0x00, 0xa2, 0xde, 0xc4, 0x02,
+    0xf3, 0x00, 0xc5, 0x30, 0x01, 0xcd, 0x60, 0x19, 0x77, 0xf0, 0xc0, 0xa9, 0x71, 0xb4, 0x0f, 0x20,
+    0xb4, 0x46, 0xae, 0xfb, 0x00, 0x33, 0x37, 0xa0, 0x03, 0x39, 0xc0, 0x01, 0x96, 0xfa, 0xc0, 0x00,
+    0x00, 0x9f, 0x40, 0x3a, 0xb8, 0x03, 0xb4, 0xc0, 0x25, 0xdf, 0xc3, 0x02, 0xa5, 0xc6, 0xd0, 0x3c,
+    0x82, 0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc, 0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00,
+    0x00, 0x00, 0x4f, 0xa8, 0x04, 0x88, 0xcb, 0x20, 0x02, 0x69, 0xf1, 0x00, 0x17, 0x7f, 0x0c, 0x0a,
+    0x97, 0x1b, 0x40, 0xf2, 0x0b, 0x44, 0x6a, 0xef, 0xb0, 0x03, 0x33, 0x7a, 0x00, 0x33, 0x9c, 0x00,
+    0x19, 0x6f, 0xac, 0x00, 0x00, 0x02, 0xe6, 0x93, 0x00, 0x24, 0x72, 0x98, 0x01, 0x99, 0x18, 0x01,
+    0x2e, 0xfe, 0x18, 0x15, 0x2e, 0x36, 0x81, 0xe4, 0x16, 0x88, 0xd5, 0xdf, 0x60, 0x06, 0x66, 0xf4,
+    0x00, 0x67, 0x38, 0x00, 0x32, 0xdf, 0x58, 0x00, 0x09, 0xa0, 0xd6, 0x00, 0x66, 0x01, 0x54, 0x00,
+    0x56, 0x08, 0x30, 0x02, 0xef, 0xe1, 0x81, 0x52, 0xe3, 0x68, 0x1e, 0x41, 0x68, 0x8d, 0x5d, 0xf6,
+    0x00, 0x66, 0x6f, 0x40, 0x06, 0x73, 0x80, 0x03, 0x2d, 0xf5, 0x80, 0x00, 0x00, 0x3e, 0xa0, 0x06,
+    0xbc, 0x80, 0x0f, 0xfa, 0xf2, 0x00, 0x25, 0xa2, 0x83, 0x02, 0xa5, 0xc6, 0xd0, 0x3c, 0x82, 0xd1,
+    0x1a, 0xbb, 0xec, 0x00, 0xcc, 0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0x00, 0x05,
+    0xdf, 0xb2, 0x9e, 0xd7, 0x02, 0xa5, 0xc0, 0xd5, 0xd8, 0x83, 0x1e, 0x41, 0xc0, 0x41, 0xab, 0xd0,
+    0xae, 0x76, 0x05, 0x77, 0x1c, 0xd6, 0x65, 0x94, 0x17, 0xfe, 0xdd, 0x18, 0x30, 0xf0, 0x49, 0x13,
+    0xa1, 0x97, 0x34, 0xbd, 0x77, 0x4b, 0x40, 0x02, 0xbf, 0xd5, 0x00, 0x60, 0xda, 0xd1, 0xb0, 0xd2,
+    0x44, 0x03, 0x88, 0x02, 0x73, 0xf3, 0x00, 0x90, 0x94, 0x5c, 0x56, 0xd8, 0xaa, 0x7a, 0x9d, 0x01,
+    0x78, 0xf2, 0x00, 0x37, 0xf0, 0x06, 0x18, 0x70, 0x00, 0x00, 0x73, 0x00, 0x75, 0x58, 0x07, 0x26,
+    0x80, 0x63, 0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e, 0x0e, 0xe8, 0xb7, 0x87,
+    0x3f, 0xdb, 0x6e, 0x36, 0x4f, 0xa8, 0x38, 0xb9, 0x72, 0xa0, 0x00, 0x93, 0x84, 0x03, 0x45, 0x88,
+    0x06, 0xc5, 0x00, 0x8f, 0x3f, 0x0c, 0x07, 0x57, 0x2f, 0x05, 0xc6, 0x4d, 0xc9, 0xb8, 0x3b, 0xa2,
+    0xde, 0x1c, 0xff, 0x6d, 0xb8, 0xd9, 0x3e, 0xa0, 0xe2, 0xe5, 0xca, 0x80, 0x00, 0x37, 0xc0, 0x04,
+    0x51, 0xac, 0x60, 0x02, 0xe2, 0xe3, 0x00, 0x1e, 0x7e, 0x18, 0x0e, 0xae, 0x5e, 0x0b, 0x8c, 0x9b,
+    0x93, 0x70, 0x77, 0x45, 0xbc, 0x39, 0xfe, 0xdb, 0x71, 0xb2, 0x7d, 0x41, 0xc5, 0xcb, 0x95, 0x00,
+    0x07, 0xc0, 0xb8, 0x00, 0x25, 0x86, 0xe0, 0x00, 0xdc, 0x19, 0x00, 0x07, 0x9f, 0x86, 0x03, 0xab,
+    0x97, 0x82, 0xe3, 0x26, 0xe4, 0xdc, 0x1d, 0xd1, 0x6f, 0x0e, 0x7f, 0xb6, 0xdc, 0x6c, 0x9f, 0x50,
+    0x71, 0x72, 0xe5, 0x40, 0x1f, 0x40, 0x1a, 0xf0, 0x02, 0xd8, 0x00, 0xfc, 0x40, 0x3f, 0xf9, 0x80,
+    0x06, 0xd0, 0x05, 0xf0, 0x03, 0x4c, 0x0f, 0xc4, 0x03, 0xff, 0x9a, 0x00, 0x09, 0xf6, 0x04, 0x5d,
+    0xb2, 0x4c, 0x2d, 0x20, 0x3f, 0x10, 0x0f, 0xfe, 0x98, 0x8b, 0x0d, 0x6d, 0xd0, 0x2a, 0xcc, 0x10,
+    0x60, 0x7e, 0x20, 0x1f, 0xfd, 0x30, 0x00, 0x18, 0x07, 0x0f, 0x54, 0x50, 0x00, 0x51, 0x0d, 0x40,
+    0x01, 0xce, 0x49, 0x00, 0x14, 0x71, 0xb9, 0x8e, 0x2f, 0xe0, 0xd3, 0x84, 0x0a, 0xa1, 0x71, 0x00,
+    0x46, 0xfc, 0x40, 0x12, 0x2b, 0x8c, 0x9b, 0x1d, 0x0e, 0xae, 0x5d, 0x18, 0x00, 0x6c, 0xab, 0x80,
+    0x09, 0x32, 0x14, 0x00, 0x52, 0xba, 0x40, 0x7e, 0xbb, 0xd0, 0x01, 0x4c, 0x3b, 0x90, 0x01, 0xcb,
+    0x22, 0x60, 0x03, 0x00, 0x17, 0x80, 0x7f, 0xf2, 0x40, 0x00, 0x6b, 0x80, 0x77, 0x50, 0x07, 0x1e,
+    0x80, 0x62, 0xbf, 0xd5, 0x01, 0xc1, 0xca, 0xa2, 0x38, 0xd9, 0xb9, 0x77, 0x08, 0x40, 0x08, 0xdc,
+    0x42, 0x00, 0x56, 0x71, 0xb3, 0x73, 0xe1, 0xd6, 0xca, 0xa2, 0x00, 0x00, 0x8f, 0xc8, 0x03, 0x4c,
+    0x88, 0x03, 0x53, 0x00, 0x45, 0x7f, 0xaa, 0x03, 0x83, 0x95, 0x44, 0x71, 0xb3, 0x72, 0xee, 0x10,
+    0x80, 0x11, 0xb8, 0x84, 0x00, 0xac, 0xe3, 0x66, 0xe7, 0xc3, 0xad, 0x95, 0x44, 0x00, 0x00, 0x2f,
+    0xc8, 0x04, 0x57, 0x88, 0xa0, 0x02, 0xe3, 0xd5, 0x00, 0x15, 0xfe, 0xa8, 0x0e, 0x0e, 0x55, 0x11,
+    0xc6, 0xcd, 0xcb, 0xb8, 0x42, 0x00, 0x46, 0xe2, 0x10, 0x02, 0xb3, 0x8d, 0x9b, 0x9f, 0x0e, 0xb6,
+    0x55, 0x10, 0x00, 0x6c, 0xab, 0x80, 0x09, 0x32, 0x14, 0x00, 0x52, 0xba, 0x40, 0x02, 0xbf, 0xd5,
+    0x01, 0xc1, 0xca, 0xa2, 0x38, 0xd9, 0xb9, 0x77, 0x08, 0x40, 0x08, 0xdc, 0x42, 0x00, 0x56, 0x71,
+    0xb3, 0x73, 0xe1, 0xd6, 0xca, 0xa2, 0x00, 0x05, 0xd0, 0xa9, 0x00, 0x32, 0x87, 0xe0, 0x00, 0xe0,
+    0x15, 0x40, 0x02, 0xbf, 0xd5, 0x01, 0xc1, 0xca, 0xa2, 0x38, 0xd9, 0xb9, 0x77, 0x08, 0x40, 0x08,
+    0xdc, 0x42, 0x00, 0x56, 0x71, 0xb3, 0x73, 0xe1, 0xd6, 0xca, 0xa2, 0x00, 0x00, 0x46, 0x00, 0x77,
+    0x30, 0x07, 0x35, 0x00, 0x5d, 0xff, 0xc5, 0x99, 0xe2, 0x21, 0xdf, 0x99, 0x80, 0x2e, 0x50, 0x08,
+    0x00, 0xfc, 0x57, 0xfb, 0x16, 0x38, 0x36, 0xee, 0xe7, 0x1b, 0x57, 0x2f, 0xe2, 0x0d, 0x94, 0x6e,
+    0x3a, 0x94, 0x56, 0x71, 0x61, 0x73, 0xe6, 0x51, 0xba, 0xa2, 0x3d, 0x67, 0xea, 0x80, 0x00, 0x6b,
+    0x80, 0x77, 0x50, 0x07, 0x1e, 0x80, 0x47, 0xe2, 0x00, 0xc8, 0x00, 0xff, 0xe3, 0x88, 0x04, 0x40,
+    0x03, 0x03, 0x08, 0x5a, 0x10, 0x05, 0xb5, 0x91, 0x80, 0x00, 0x8f, 0xc8, 0x03, 0x4c, 0x88, 0x03,
+    0x53, 0x00, 0x0f, 0xc4, 0x01, 0x90, 0x01, 0xff, 0xc7, 0x10, 0x08, 0x80, 0x06, 0x06, 0x10, 0xb4,
+    0x20, 0x0b, 0x6b, 0x23, 0x00, 0x00, 0x2f, 0xc8, 0x04, 0x51, 0xaa, 0xa0, 0x01, 0x69, 0x62, 0x81,
+    0xf8, 0x80, 0x32, 0x00, 0x3f, 0xf8, 0xe2, 0x01, 0x10, 0x00, 0xc0, 0xc2, 0x16, 0x84, 0x01, 0x6d,
+    0x64, 0x60, 0x00, 0x05, 0xd0, 0xa9, 0x00, 0x32, 0x87, 0xe0, 0x00, 0xe0, 0x15, 0x40, 0x7e, 0x20,
+    0x0c, 0x80, 0x0f, 0xfe, 0x38, 0x80, 0x44, 0x00, 0x30, 0x30, 0x85, 0xa1, 0x00, 0x5b, 0x59, 0x18,
+    0x00, 0x00, 0x9f, 0x40, 0x3a, 0xb8, 0x03, 0xb4, 0xc0, 0x15, 0x80, 0x17, 0x47, 0x18, 0x81, 0x8d,
+    0x20, 0xb8, 0x51, 0x90, 0x3d, 0x03, 0xd0, 0x02, 0x8d, 0x45, 0xc0, 0x06, 0x56, 0x82, 0x01, 0x50,
+    0xf0, 0x06, 0x10, 0x50, 0x08, 0xed, 0xc0, 0x22, 0xc6, 0x80, 0x08, 0x3f, 0x10, 0x0f, 0xfe, 0x5a,
+    0x6f, 0x48, 0x06, 0x99, 0x5b, 0xc0, 0x05, 0xe8, 0xb2, 0xc0, 0x11, 0x80, 0x08, 0x40, 0x23, 0x00,
+    0x10, 0x80, 0x5e, 0x8b, 0x2c, 0x01, 0x4c, 0xad, 0xe0, 0x02, 0x4d, 0xe9, 0x00, 0xff, 0xe3, 0x00,
+    0x09, 0xa0, 0xd5, 0x00, 0x66, 0x01, 0x58, 0x00, 0xac, 0x10, 0x61, 0x58, 0x01, 0x74, 0x71, 0x88,
+    0x18, 0xd2, 0x0b, 0x85, 0x19, 0x03, 0xd0, 0x3d, 0x00, 0x28, 0xd4, 0x5c, 0x00, 0x65, 0x68, 0x20,
+    0x15, 0x0f, 0x00, 0x61, 0x05, 0x00, 0x8e, 0xdc, 0x02, 0x2c, 0x68, 0x00, 0x80, 0x00, 0x2f, 0x74,
+    0x40, 0x19, 0x7f, 0xe2, 0x00, 0xeb, 0xe7, 0x00, 0xf2, 0x96, 0x80, 0x72, 0x84, 0x20, 0x80, 0x6f,
+    0x45, 0x17, 0x00, 0xcb, 0xa0, 0x94, 0x01, 0x28, 0x38, 0x79, 0x88, 0x03, 0x83, 0xbe, 0x81, 0x80,
+    0x09, 0x19, 0x92, 0xd8, 0x30, 0x31, 0x9d, 0xe6, 0x5a, 0x82, 0x01, 0x28, 0x28, 0x05, 0xee, 0x88,
+    0x00, 0xbf, 0xf1, 0x00, 0x17, 0x3b, 0x4c, 0x0a, 0x97, 0x1b, 0x40, 0xf2, 0x0b, 0x44, 0x6a, 0xef,
+    0xb0, 0x03, 0x33, 0x7a, 0x00, 0x33, 0x9c, 0x00, 0x19, 0x6f, 0xac, 0x00, 0x00, 0x00, 0x34, 0x05,
+    0x98, 0x06, 0x62, 0xe3, 0x30, 0x07, 0x57, 0x40, 0x07, 0xab, 0xd8, 0x03, 0xca, 0x5a, 0x01, 0xca,
+    0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03, 0x2e, 0x82, 0x50, 0x04, 0xa0, 0xe1, 0xe6, 0x20, 0x0e,
+    0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b, 0x60, 0xc0, 0xc6, 0x77, 0x99, 0x6a, 0x08, 0x04, 0xa0,
+    0xa0, 0x06, 0x90, 0xc3, 0x00, 0x31, 0xf2, 0x18, 0x05, 0x5d, 0x00, 0x12, 0xef, 0xe1, 0x81, 0x52,
+    0xe3, 0x68, 0x1e, 0x41, 0x68, 0x8d, 0x5d, 0xf6, 0x00, 0x66, 0x6f, 0x40, 0x06, 0x73, 0x80, 0x03,
+    0x2d, 0xf5, 0x80, 0x00, 0x00, 0xab, 0xd8, 0x03, 0xca, 0x1a, 0x01, 0xca, 0x0e, 0x82, 0x01, 0xbc,
+    0x64, 0x1c, 0x03, 0x2b, 0x89, 0x50, 0x04, 0xa1, 0x80, 0xa6, 0x20, 0x0e, 0x04, 0x0c, 0x06, 0x00,
+    0x20, 0x77, 0xd8, 0x58, 0x30, 0x4e, 0x64, 0xa6, 0x5a, 0x4c, 0x67, 0x40, 0x2d, 0xe8, 0x06, 0x10,
+    0x40, 0x0f, 0x59, 0x18, 0x07, 0xac, 0xe8, 0x05, 0xdf, 0xc4, 0x02, 0xa5, 0xc6, 0xa0, 0x3c, 0x82,
+    0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc, 0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0xab,
+    0xf7, 0x14, 0x40, 0x32, 0x78, 0x07, 0x2d, 0x08, 0x00, 0xc3, 0xc8, 0x01, 0xe9, 0x74, 0x00, 0xf4,
+    0x48, 0x07, 0x1d, 0xf7, 0x28, 0x80, 0x09, 0x81, 0x10, 0x7c, 0x10, 0x95, 0xb6, 0x66, 0x0c, 0x19,
+    0x48, 0x04, 0x39, 0x85, 0x03, 0x00, 0xc6, 0xa0, 0x1f, 0xc4, 0x04, 0x01, 0x8d, 0x50, 0xa0, 0x02,
+    0x1c, 0xc0, 0x4a, 0xdb, 0x33, 0x46, 0xc1, 0x30, 0x22, 0x0d, 0x84, 0x00, 0x00, 0x8f, 0xc8, 0x03,
+    0x44, 0x90, 0x06, 0xb6, 0x00, 0x8a, 0xff, 0x54, 0x07, 0x06, 0xd6, 0x8d, 0xc6, 0xd2, 0x24, 0x38,
+    0x84, 0x00, 0xc7, 0xc4, 0x20, 0x06, 0x37, 0x1b, 0x38, 0x90, 0x1d, 0x6c, 0x5a, 0x30, 0x00, 0xce,
+    0xa0, 0x1e, 0xb0, 0xe6, 0x00, 0xeb, 0x7b, 0x60, 0x0c, 0x77, 0xdc, 0xa2, 0x00, 0x26, 0x04, 0x41,
+    0xf0, 0x42, 0x56, 0xd9, 0x98, 0x30, 0x65, 0x20, 0x10, 0xe6, 0x14, 0x0c, 0x03, 0x1a, 0x80, 0x7f,
+    0x10, 0x10, 0x06, 0x35, 0x42, 0x80, 0x08, 0x73, 0x01, 0x2b, 0x6c, 0xcd, 0x1b, 0x04, 0xc0, 0x88,
+    0x36, 0x10, 0x00, 0x2f, 0xc8, 0x04, 0x57, 0x88, 0xa0, 0x02, 0xe3, 0xd5, 0x00, 0x15, 0xfe, 0xa8,
+    0x0e, 0x0d, 0xad, 0x1b, 0x8d, 0xa4, 0x48, 0x71, 0x08, 0x01, 0x8f, 0x88, 0x40, 0x0c, 0x6e, 0x36,
+    0x71, 0x20, 0x3a, 0xd8, 0xb4, 0x60, 0x00, 0xd0, 0x80, 0x1f, 0x29, 0x80, 0x7d, 0xae, 0x01, 0xc7,
+    0x7d, 0xca, 0x20, 0x02, 0x60, 0x44, 0x1f, 0x04, 0x25, 0x6d, 0x99, 0x83, 0x06, 0x52, 0x01, 0x0e,
+    0x61, 0x40, 0xc0, 0x31, 0xa8, 0x07, 0xf1, 0x01, 0x00, 0x63, 0x54, 0x28, 0x00, 0x87, 0x30, 0x12,
+    0xb6, 0xcc, 0xd1, 0xb0, 0x4c, 0x08, 0x83, 0x61, 0x00, 0x00, 0x0f, 0x20, 0x06, 0x17, 0x60, 0x0e,
+    0x92, 0x00, 0x8a, 0xff, 0x54, 0x07, 0x06, 0xd6, 0x8d, 0xc6, 0xd2, 0x24, 0x38, 0x84, 0x00, 0xc7,
+    0xc4, 0x20, 0x06, 0x37, 0x1b, 0x38, 0x90, 0x1d, 0x6c, 0x5a, 0x30, 0x00, 0x9c, 0x51, 0x40, 0x38,
+    0xb2, 0x10, 0x03, 0x97, 0x70, 0x40, 0x31, 0xdf, 0x72, 0x88, 0x00, 0x98, 0x11, 0x07, 0xc1, 0x09,
+    0x5b, 0x66, 0x60, 0xc1, 0x94, 0x80, 0x43, 0x98, 0x50, 0x30, 0x0c, 0x6a, 0x01, 0xfc, 0x40, 0x40,
+    0x18, 0xd5, 0x0a, 0x00, 0x21, 0xcc, 0x04, 0xad, 0xb3, 0x34, 0x6c, 0x13, 0x02, 0x20, 0xd8, 0x40,
+    0x02, 0xe2, 0xd5, 0x00, 0x14, 0x6a, 0x28, 0x04, 0xdf, 0x20, 0x11, 0x5f, 0xeb, 0x00, 0xe0, 0xe5,
+    0x4a, 0x38, 0xd9, 0xbe, 0xaf, 0x10, 0x80, 0x08, 0x78, 0x84, 0x01, 0x08, 0xe3, 0x69, 0x0e, 0xe1,
+    0xd6, 0xb5, 0xa3, 0x00, 0x01, 0x70, 0x44, 0x00, 0x61, 0xda, 0xa2, 0x80, 0x75, 0x6e, 0x84, 0x02,
+    0x2f, 0xf4, 0x6d, 0x98, 0x06, 0x8b, 0xb0, 0xe2, 0x80, 0x46, 0x8b, 0x4d, 0x60, 0x1f, 0x58, 0xa0,
+    0x07, 0x88, 0x08, 0x03, 0xff, 0x86, 0x40, 0x40, 0x1e, 0xb1, 0x40, 0x01, 0xa2, 0xdb, 0x58, 0x05,
+    0x17, 0x60, 0xc5, 0x00, 0x00, 0xf8, 0x98, 0x03, 0xa6, 0xdf, 0x40, 0x3f, 0x10, 0x07, 0xcb, 0x20,
+    0x9b, 0xd4, 0x60, 0x10, 0xdb, 0xee, 0x94, 0x02, 0x71, 0xa3, 0x74, 0x00, 0xb8, 0xc0, 0x23, 0x00,
+    0xb8, 0xc0, 0x23, 0x00, 0x9c, 0x68, 0xdd, 0x00, 0x21, 0xb7, 0xdd, 0x30, 0x04, 0x00, 0x0a, 0xff,
+    0xb6, 0x00, 0x31, 0x65, 0xd3, 0x68, 0x04, 0x26, 0x8f, 0x84, 0xe0, 0x1e, 0x25, 0xb0, 0x0f, 0xb4,
+    0xb5, 0x4f, 0xfc, 0x20, 0x17, 0xa1, 0x6e, 0x84, 0x34, 0x88, 0x22, 0x22, 0x01, 0x2d, 0x80, 0x04,
+    0xd1, 0xf0, 0xdc, 0x00, 0x59, 0x76, 0x6c, 0x00, 0x00, 0xe9, 0xb0, 0x0d, 0x3c, 0xc9, 0x20, 0x14,
+    0x7a, 0x9c, 0x02, 0x6f, 0xd8, 0x38, 0x8a, 0xdf, 0x74, 0xa0, 0x07, 0x1a, 0x37, 0x40, 0x07, 0x18,
+    0x04, 0x60, 0x0e, 0x30, 0x08, 0xc0, 0x0e, 0x34, 0x6e, 0x80, 0x01, 0xb7, 0xdd, 0x30, 0x00, 0x00,
+    0x57, 0x73, 0x00, 0x35, 0xff, 0xb4, 0x00, 0x5f, 0xdd, 0xbc, 0xc0, 0x11, 0x77, 0x8c, 0x00, 0x68,
+    0x98, 0x03, 0xfe, 0xbf, 0xfb, 0x40, 0x29, 0xcc, 0xb8, 0x02, 0x23, 0x3c, 0x01, 0xff, 0x1a, 0x26,
+    0x00, 0xa2, 0xef, 0x18, 0x03, 0xee, 0x90, 0x00, 0x7f, 0xf2, 0x00, 0x0f, 0x7b, 0x4c, 0x07, 0x57,
+    0x2f, 0x05, 0xc6, 0x4d, 0xc9, 0xb8, 0x3b, 0xa2, 0xde, 0x1c, 0xff, 0x6d, 0xb8, 0xd9, 0x3e, 0xa0,
+    0xe2, 0xe5, 0xca, 0x80, 0x00, 0x59, 0x96, 0x00, 0x68, 0xef, 0x80, 0x0c, 0x7b, 0xa4, 0x00, 0x17,
+    0xff, 0x8c, 0x01, 0x17, 0x78, 0xc0, 0x06, 0x89, 0x80, 0x3f, 0xeb, 0xff, 0xb4, 0x02, 0x9c, 0xcb,
+    0x80, 0x22, 0x33, 0xc0, 0x1f, 0xf1, 0xa2, 0x60, 0x0a, 0x2e, 0xf1, 0x80, 0x04, 0xb0, 0xa5, 0x00,
+    0x21, 0x70, 0x28, 0x05, 0x3d, 0x40, 0x11, 0xe7, 0xe1, 0x80, 0xea, 0xe5, 0xe0, 0xb8, 0xc9, 0xb9,
+    0x37, 0x07, 0x74, 0x5b, 0xc3, 0x9f, 0xed, 0xb7, 0x1b, 0x27, 0xd4, 0x1c, 0x5c, 0xb9, 0x50, 0x00,
+    0x95, 0x80, 0x3d, 0x98, 0x00, 0xf4, 0xd0, 0x04, 0x5f, 0xfe, 0x30, 0x04, 0x5d, 0xe3, 0x00, 0x1a,
+    0x26, 0x00, 0xff, 0xaf, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x7f, 0xc6, 0x89,
+    0x80, 0x28, 0xbb, 0xc6, 0x00, 0x00, 0x17, 0x18, 0x06, 0x37, 0x20, 0x0c, 0x32, 0x20, 0x11, 0xe7,
+    0xe1, 0x80, 0xea, 0xe5, 0xe0, 0xb8, 0xc9, 0xb9, 0x37, 0x07, 0x74, 0x5b, 0xc3, 0x9f, 0xed, 0xb7,
+    0x1b, 0x27, 0xd4, 0x1c, 0x5c, 0xb9, 0x50, 0x2f, 0xff, 0x18, 0x02, 0x2e, 0xf1, 0x80, 0x0d, 0x13,
+    0x00, 0x7f, 0xf1, 0xef, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x46, 0x89, 0x80,
+    0x28, 0xbb, 0xc6, 0x5f, 0xf9, 0x8c, 0xc0, 0x1c, 0xd4, 0x01, 0xe6, 0x93, 0x00, 0x03, 0xcf, 0xc3,
+    0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e, 0x0e, 0xe8, 0xb7, 0x87, 0x3f, 0xdb, 0x6e, 0x36,
+    0x4f, 0xae, 0x38, 0xb9, 0x22, 0xc0, 0x79, 0xc1, 0x60, 0x19, 0x41, 0x00, 0x32, 0x1f, 0x00, 0x00,
+    0x39, 0x11, 0xc0, 0x31, 0x7f, 0x08, 0x06, 0x5b, 0xa6, 0x00, 0x17, 0xfa, 0x65, 0xfe, 0x30, 0x04,
+    0x5d, 0xe3, 0x00, 0x1a, 0x26, 0x00, 0xff, 0xaf, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf,
+    0x00, 0x7f, 0xc6, 0x89, 0x80, 0x28, 0xbb, 0xc6, 0x00, 0x03, 0xe2, 0xd4, 0x00, 0x1c, 0xea, 0xa0,
+    0x04, 0xff, 0x00, 0x11, 0xe7, 0xe1, 0x80, 0xea, 0xe5, 0xe0, 0xb8, 0xc9, 0xb9, 0x37, 0x07, 0x74,
+    0x5b, 0xc3, 0x9f, 0xed, 0xb7, 0x1b, 0x27, 0xd4, 0x1c, 0x5c, 0xb9, 0x50, 0x00, 0xce, 0xa0, 0x1e,
+    0xb0, 0xe6, 0x00, 0xeb, 0x7b, 0x60, 0x0c, 0x77, 0xdc, 0xa1, 0x00, 0x26, 0x04, 0x41, 0xfc, 0x42,
+    0x52, 0xd9, 0x98, 0x30, 0x65, 0x00, 0x10, 0xde, 0x28, 0x18, 0x06, 0x45, 0x00, 0xec, 0xff, 0x88,
+    0x0c, 0x01, 0xda, 0xc4, 0x85, 0x20, 0x02, 0x22, 0x38, 0x4a, 0xdb, 0x33, 0x0a, 0xc1, 0x30, 0x22,
+    0x0d, 0xc2, 0x00, 0x00, 0x37, 0xc8, 0x04, 0x57, 0xaa, 0x80, 0x02, 0xd2, 0xc4, 0x00, 0x26, 0xfd,
+    0x52, 0xc6, 0xd7, 0xbd, 0x41, 0xc6, 0x05, 0x54, 0x1c, 0x60, 0x11, 0x07, 0x10, 0x04, 0x60, 0xe1,
+    0x46, 0xe8, 0x03, 0x6f, 0xba, 0x60, 0x02, 0xef, 0x52, 0x88, 0xba, 0x49, 0x8f, 0xc6, 0xd7, 0x62,
+    0x0a, 0x00, 0x00, 0xb4, 0x5a, 0x40, 0x3a, 0xf2, 0xac, 0x03, 0x9b, 0x70, 0x80, 0x31, 0xdf, 0x72,
+    0x84, 0x00, 0x98, 0x11, 0x07, 0xf1, 0x09, 0x4b, 0x66, 0x60, 0xc1, 0x94, 0x00, 0x43, 0x78, 0xa0,
+    0x60, 0x19, 0x14, 0x03, 0xb3, 0xfe, 0x20, 0x30, 0x07, 0x6b, 0x12, 0x14, 0x80, 0x08, 0x88, 0xe1,
+    0x2b, 0x6c, 0xcc, 0x2b, 0x04, 0xc0, 0x88, 0x37, 0x08, 0x03, 0xc0, 0x96, 0x00, 0x1a, 0x71, 0xb0,
+    0x05, 0x1d, 0x40, 0x12, 0x6f, 0xd5, 0x2c, 0x6d, 0x7b, 0xd4, 0x1c, 0x60, 0x55, 0x41, 0xc6, 0x01,
+    0x10, 0x71, 0x00, 0x46, 0x0e, 0x14, 0x6e, 0x80, 0x36, 0xfb, 0xa6, 0x00, 0x2e, 0xf5, 0x28, 0x8b,
+    0xa4, 0x98, 0xfc, 0x6d, 0x76, 0x20, 0xa0, 0x00, 0xd0, 0x80, 0x1f, 0x29, 0x80, 0x7d, 0xae, 0x01,
+    0xc7, 0x7d, 0xca, 0x10, 0x02, 0x60, 0x44, 0x1f, 0xc4, 0x25, 0x2d, 0x99, 0x83, 0x06, 0x50, 0x01,
+    0x0d, 0xe2, 0x81, 0x80, 0x64, 0x50, 0x0e, 0xcf, 0xf8, 0x80, 0xc0, 0x1d, 0xac, 0x48, 0x52, 0x00,
+    0x22, 0x23, 0x84, 0xad, 0xb3, 0x30, 0xac, 0x13, 0x02, 0x20, 0xdc, 0x20, 0x00, 0x0f, 0x20, 0x06,
+    0x17, 0x60, 0x0e, 0x92, 0x00, 0x93, 0x7e, 0xa9, 0x63, 0x6b, 0xde, 0xa0, 0xe3, 0x02, 0xaa, 0x0e,
+    0x30, 0x08, 0x83, 0x88, 0x02, 0x30, 0x70, 0xa3, 0x74, 0x01, 0xb7, 0xdd, 0x30, 0x01, 0x77, 0xa9,
+    0x44, 0x5d, 0x24, 0xc7, 0xe3, 0x6b, 0xb1, 0x05, 0x00, 0x00, 0x1d, 0xf7, 0x28, 0x40, 0x09, 0x81,
+    0x10, 0x7f, 0x10, 0x94, 0xb6, 0x66, 0x0c, 0x19, 0x40, 0x04, 0x37, 0x8a, 0x06, 0x01, 0x91, 0x40,
+    0x3b, 0x3f, 0xe2, 0x03, 0x00, 0x76, 0xb1, 0x21, 0x48, 0x00, 0x88, 0x8e, 0x12, 0xb6, 0xcc, 0xc2,
+    0xb0, 0x4c, 0x08, 0x83, 0x70, 0x80, 0x0e, 0xed, 0x94, 0x20, 0x18, 0x68, 0x03, 0xe5, 0x32, 0x00,
+    0x80, 0x00, 0x84, 0x40, 0x1d, 0x6c, 0x01, 0xc8, 0xa0, 0x1d, 0x26, 0x01, 0x26, 0xc5, 0xd5, 0x8d,
+    0xaf, 0x7a, 0x83, 0x8c, 0x0a, 0xa8, 0x38, 0xc0, 0x22, 0x0e, 0x20, 0x08, 0xc1, 0xc2, 0x8d, 0xd0,
+    0x06, 0xdf, 0x74, 0xc0, 0x05, 0xde, 0xa5, 0x11, 0x74, 0x93, 0x1f, 0x8d, 0xae, 0xc4, 0x14, 0x00,
+    0x85, 0xcc, 0x03, 0xd5, 0xbc, 0x20, 0x18, 0xb2, 0xa1, 0x40, 0x05, 0xec, 0xe0, 0xa9, 0xec, 0x01,
+    0xff, 0xd1, 0xbf, 0xfc, 0x01, 0xa7, 0x33, 0x00, 0x62, 0x33, 0xc0, 0x1f, 0xfd, 0x10, 0x02, 0x71,
+    0x00, 0xef, 0xda, 0x00, 0xc7, 0x15, 0x84, 0x01, 0x1b, 0x7b, 0x10, 0x07, 0xff, 0x29, 0xf7, 0xa0,
+    0x03, 0x54, 0x3b, 0x90, 0x02, 0xe5, 0x91, 0x30, 0x08, 0xc0, 0x05, 0xe0, 0x1f, 0xfc, 0xc0, 0x0e,
+    0x70, 0x0d, 0x92, 0x01, 0xff, 0x50, 0xc7, 0x76, 0x36, 0x5b, 0x17, 0xcc, 0xc4, 0xaa, 0x10, 0x7d,
+    0xdc, 0x46, 0x01, 0x36, 0x66, 0x20, 0x0d, 0xc6, 0x78, 0x40, 0x3f, 0xfa, 0x80, 0x03, 0xf1, 0x00,
+    0xc5, 0x81, 0xfc, 0x20, 0x02, 0xa0, 0xdf, 0x10, 0x09, 0x81, 0x73, 0xa0, 0x03, 0x54, 0x3b, 0x90,
+    0x02, 0xe5, 0x91, 0x30, 0x08, 0xc0, 0x05, 0xe0, 0x1f, 0xfc, 0xc0, 0x2c, 0xdd, 0x19, 0x66, 0xe8,
+    0xc0, 0xbd, 0x00, 0x3f, 0xfc, 0x40, 0x2e, 0x68, 0x44, 0x47, 0x22, 0x19, 0x91, 0x80, 0x03, 0xf1,
+    0x00, 0xff, 0xe9, 0x80, 0x2e, 0xe9, 0x0b, 0xfe, 0x40, 0x3e, 0x50, 0x0f, 0xff, 0x10, 0x5e, 0xe8,
+    0x97, 0xfe, 0x20, 0x2e, 0x00, 0xff, 0xea, 0x00, 0x3b, 0x09, 0x53, 0x2e, 0x35, 0x09, 0xea, 0x00,
+    0x17, 0xa0, 0x07, 0xff, 0x88, 0x6a, 0x0c, 0x36, 0x0e, 0x43, 0x0a, 0xe8, 0x00, 0x1f, 0x88, 0x07,
+    0xff, 0x4c, 0x2f, 0x40, 0x0f, 0xfe, 0x7a, 0x12, 0xc5, 0x0b, 0x42, 0x00, 0x03, 0xe1, 0x02, 0x71,
+    0x01, 0x90, 0x01, 0xf8, 0x80, 0x7f, 0xf3, 0x68, 0xc4, 0x4d, 0x00, 0x29, 0x62, 0x00, 0x09, 0x12,
+    0x72, 0x27, 0x19, 0x7a, 0x00, 0x7f, 0xf3, 0xc0, 0x3f, 0x10, 0x0f, 0xfe, 0x30, 0x2f, 0x40, 0x0e,
+    0xf6, 0x00, 0xff, 0xf4, 0x9c, 0x00, 0x7e, 0x67, 0x10, 0x20, 0x20, 0x09, 0x02, 0x97, 0x81, 0x40,
+    0x21, 0xb6, 0xa0, 0xb1, 0x00, 0x3e, 0x16, 0xd0, 0x27, 0x15, 0x50, 0x0c, 0x81, 0xc0, 0x1f, 0x8b,
+    0x78, 0x07, 0xff, 0x64, 0xfc, 0x40, 0x38, 0x70, 0xc0, 0x29, 0x48, 0x00, 0x00, 0xc4, 0xe6, 0x01,
+    0x8b, 0xcb, 0x8c, 0x02, 0x2d, 0x5d, 0x30, 0x0c, 0x5e, 0x60, 0x1f, 0xfd, 0xd5, 0x70, 0x0f, 0x14,
+    0x00, 0x1c, 0x04, 0x10, 0x25, 0x60, 0x88, 0x07, 0x29, 0x43, 0xe0, 0x00, 0x09, 0xf6, 0x04, 0x5d,
+    0xb2, 0x4c, 0x2d, 0x20, 0x3f, 0x10, 0x0f, 0xfe, 0xa3, 0x80, 0x6c, 0x11, 0x03, 0x3c, 0x00, 0x00,
+    0x2f, 0x40, 0x00, 0xee, 0x80, 0x3d, 0x47, 0x80, 0x1d, 0x29, 0xa2, 0x01, 0x9d, 0xac, 0xc0, 0x36,
+    0xc1, 0xa0, 0x07, 0x32, 0x9a, 0x80, 0x73, 0x52, 0xd8, 0x80, 0x6d, 0x0b, 0x0b, 0x00, 0xf0, 0xd2,
+    0xa8, 0x03, 0xc8, 0xb6, 0x25, 0xe8, 0x4a, 0x15, 0xc2, 0x01, 0x5f, 0x80, 0x7c, 0xbc, 0x01, 0x80,
+    0x3f, 0x10, 0x0f, 0xfe, 0x54, 0x79, 0x80, 0x4e, 0xeb, 0x30, 0x04, 0xc5, 0xa0, 0x04, 0xe0, 0xe0,
+    0x1b, 0x13, 0x80, 0x31, 0x51, 0xd0, 0x06, 0x1d, 0x57, 0x3f, 0x06, 0x3f, 0x70, 0x02, 0x58, 0x07,
+    0x6a, 0x80, 0x40, 0x3f, 0x10, 0x5f, 0x40, 0x08, 0xaa, 0x10, 0x00, 0x7e, 0xae, 0x01, 0x69, 0x50,
+    0x06, 0xa0, 0x80, 0x0c, 0x96, 0xec, 0x01, 0x92, 0x64, 0x60, 0x04, 0xf1, 0x00, 0xdf, 0x42, 0x01,
+    0x12, 0x08, 0x07, 0xff, 0xac, 0xd1, 0x23, 0x00, 0x45, 0xdd, 0x00, 0x06, 0xd0, 0x05, 0xf0, 0x19,
+    0x10, 0x03, 0xff, 0xb2, 0x00, 0x2f, 0x40, 0x0f, 0xff, 0x59, 0xa2, 0x46, 0x00, 0x8b, 0xba, 0x0b,
+    0xfd, 0x3d, 0xf6, 0x00, 0x29, 0x00, 0xe7, 0x41, 0x00, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x79, 0x48,
+    0xb5, 0x06, 0xd0, 0x00, 0x2f, 0x42, 0xf0, 0x0f, 0x10, 0x07, 0x1c, 0x00, 0x70, 0xa8, 0x07, 0xff,
+    0x50, 0xd1, 0x23, 0x00, 0x45, 0xdd, 0x00, 0x3f, 0x1f, 0x20, 0x0c, 0x40, 0x14, 0x80, 0x66, 0x00,
+    0xff, 0xe9, 0x80, 0x1f, 0x40, 0x0f, 0xfe, 0x82, 0x70, 0x80, 0x66, 0x71, 0x00, 0xc5, 0x20, 0x1f,
+    0xf1, 0xa2, 0x46, 0x00, 0x8b, 0xba, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x45, 0x20, 0x00, 0xdc, 0x80,
+    0x07, 0xac, 0x01, 0xff, 0xc3, 0x00, 0x0b, 0xb0, 0x07, 0xff, 0x31, 0x78, 0x03, 0x92, 0xa4, 0x02,
+    0x74, 0x2e, 0x70, 0x0b, 0x09, 0x84, 0x03, 0x5b, 0x00, 0x7e, 0x74, 0x4c, 0x01, 0x1d, 0xde, 0x20,
+    0x03, 0xf1, 0x00, 0xff, 0xe1, 0x68, 0x85, 0x05, 0x8a, 0x28, 0x30, 0x27, 0x80, 0x7f, 0xf1, 0x80,
+    0x00, 0xc7, 0xe4, 0x01, 0xe9, 0x82, 0x00, 0x17, 0xd8, 0x53, 0x87, 0xb0, 0x01, 0x14, 0x03, 0xe3,
+    0xb0, 0x0f, 0xa4, 0x20, 0x03, 0xc3, 0x0e, 0x40, 0x1e, 0x62, 0x90, 0x0f, 0xb9, 0x10, 0x01, 0xe3,
+    0x59, 0x00, 0xfa, 0xc8, 0x03, 0xe1, 0x80, 0x00, 0x00, 0x8f, 0xc8, 0x03, 0x4c, 0x88, 0x03, 0x53,
+    0x00, 0x0f, 0xd7, 0x7a, 0x00, 0x29, 0x87, 0x72, 0x00, 0x39, 0x64, 0x4c, 0x00, 0x60, 0x02, 0xf0,
+    0x0f, 0xfe, 0x48, 0x2f, 0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec, 0x03, 0xe9, 0x08, 0x00,
+    0xf0, 0xc3, 0x90, 0x07, 0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6, 0x40, 0x3e, 0xb2, 0x00,
+    0xf8, 0x60, 0x00, 0x5e, 0x80, 0xc2, 0xfe, 0xc0, 0x11, 0xc8, 0x80, 0x79, 0x54, 0x01, 0x80, 0x3f,
+    0x5d, 0xe8, 0x00, 0xa6, 0x1d, 0xc8, 0x00, 0xe5, 0x91, 0x30, 0x01, 0x80, 0x0b, 0xc0, 0x3f, 0xf9,
+    0x27, 0xe2, 0xc3, 0x90, 0x00, 0x39, 0x10, 0x0c, 0x8c, 0x01, 0x00, 0x00, 0x13, 0x82, 0xa0, 0x06,
+    0x2c, 0xab, 0x50, 0x0e, 0xad, 0xd0, 0x80, 0x0b, 0xec, 0x5c, 0xc3, 0xd8, 0x00, 0x8a, 0x01, 0xf1,
+    0xd8, 0x07, 0xd2, 0x10, 0x01, 0xe1, 0x87, 0x20, 0x0f, 0x31, 0x48, 0x07, 0xdc, 0x88, 0x00, 0xf1,
+    0xac, 0x80, 0x7d, 0x64, 0x01, 0xf0, 0xc0, 0x00, 0x02, 0xe2, 0xd5, 0x00, 0x15, 0xeb, 0xa8, 0x04,
+    0xbf, 0x40, 0x03, 0xf5, 0xde, 0x80, 0x0a, 0x61, 0xdc, 0x80, 0x0e, 0x59, 0x13, 0x00, 0x18, 0x00,
+    0xbc, 0x03, 0xff, 0x92, 0x00, 0x2f, 0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec, 0x03, 0xe9,
+    0x08, 0x00, 0xf0, 0xc3, 0x90, 0x07, 0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6, 0x40, 0x3e,
+    0xb2, 0x00, 0xf8, 0x60, 0x00, 0x5e, 0x80, 0x13, 0x80, 0x7c, 0x28, 0x01, 0xf2, 0x5a, 0xb0, 0x3f,
+    0x5d, 0xe7, 0x00, 0xa6, 0x1e, 0x0c, 0x01, 0xcb, 0x22, 0x80, 0x03, 0x00, 0x17, 0x80, 0x7f, 0xf2,
+    0x4f, 0xc4, 0x03, 0xf1, 0x97, 0x00, 0x45, 0x8a, 0xe0, 0x00, 0xb7, 0xb9, 0x20, 0x1e, 0xcf, 0xf4,
+    0x80, 0x71, 0xd7, 0xe4, 0x88, 0x04, 0x98, 0x11, 0x49, 0xe2, 0x00, 0x95, 0xb6, 0x7c, 0x08, 0x03,
+    0x29, 0x00, 0x86, 0x58, 0x14, 0x0c, 0x03, 0x18, 0x10, 0x07, 0xf9, 0x40, 0x80, 0x31, 0x81, 0x19,
+    0x40, 0x04, 0x32, 0xa0, 0x09, 0x5b, 0x67, 0xc0, 0xb0, 0x02, 0x60, 0x45, 0x27, 0x88, 0x00, 0x02,
+    0xee, 0x98, 0x00, 0x5f, 0xf3, 0x00, 0x0a, 0xbb, 0x14, 0x07, 0x07, 0x2a, 0x88, 0xe3, 0x66, 0xe5,
+    0xdc, 0x21, 0x00, 0x23, 0x71, 0x08, 0x01, 0x59, 0xc6, 0xcd, 0xcf, 0x87, 0x5b, 0x2a, 0x88, 0x00,
+    0x00, 0xb4, 0x56, 0x80, 0x3d, 0x19, 0x30, 0x01, 0xe5, 0xdc, 0x20, 0x0e, 0x3b, 0xed, 0x91, 0x00,
+    0x93, 0x02, 0x29, 0x3c, 0x40, 0x12, 0xb6, 0xcf, 0x81, 0x00, 0x65, 0x20, 0x10, 0xcb, 0x02, 0x81,
+    0x80, 0x63, 0x02, 0x00, 0xff, 0x28, 0x10, 0x06, 0x30, 0x23, 0x28, 0x00, 0x86, 0x54, 0x01, 0x2b,
+    0x6c, 0xf8, 0x16, 0x00, 0x4c, 0x08, 0xa4, 0xf1, 0x00, 0x03, 0xd0, 0x97, 0x00, 0x1a, 0xf1, 0xb8,
+    0x05, 0x1d, 0x40, 0x11, 0x5f, 0xea, 0x80, 0xe0, 0xe5, 0x51, 0x1c, 0x6c, 0xdc, 0xbb, 0x84, 0x20,
+    0x04, 0x6e, 0x21, 0x00, 0x2b, 0x38, 0xd9, 0xb9, 0xf0, 0xeb, 0x65, 0x51, 0x00, 0x00, 0x9b, 0x4f,
+    0x88, 0x03, 0xae, 0x3e, 0xc8, 0x03, 0xb5, 0x71, 0x40, 0x38, 0xef, 0xb6, 0x44, 0x02, 0x4c, 0x08,
+    0xa4, 0xf1, 0x00, 0x4a, 0xdb, 0x3e, 0x04, 0x01, 0x94, 0x80, 0x43, 0x2c, 0x0a, 0x06, 0x01, 0x8c,
+    0x08, 0x03, 0xfc, 0xa0, 0x40, 0x18, 0xc0, 0x8c, 0xa0, 0x02, 0x19, 0x50, 0x04, 0xad, 0xb3, 0xe0,
+    0x58, 0x01, 0x30, 0x22, 0x93, 0xc4, 0x00, 0x00, 0x55, 0x1f, 0x40, 0x02, 0x93, 0x2f, 0x00, 0x0f,
+    0x1f, 0x10, 0x00, 0xaf, 0xf5, 0x40, 0x70, 0x72, 0xa8, 0x8e, 0x36, 0x6e, 0x5d, 0xc2, 0x10, 0x02,
+    0x37, 0x10, 0x80, 0x15, 0x9c, 0x6c, 0xdc, 0xf8, 0x75, 0xb2, 0xa8, 0x80, 0x00, 0x1d, 0xf7, 0xff,
+    0xd2, 0x0b, 0x83, 0x76, 0x24, 0xbb, 0xe0, 0xb6, 0xa5, 0x41, 0x24, 0x4c, 0x48, 0x30, 0x01, 0x8c,
+    0x03, 0x88, 0x04, 0x03, 0x2f, 0xfe, 0x30, 0x0f, 0x93, 0x33, 0x19, 0x00, 0x80, 0x62, 0x33, 0xc0,
+    0x83, 0x00, 0x1f, 0xf5, 0xb5, 0xb2, 0x09, 0x22, 0x62, 0x05, 0xc0, 0x8b, 0x24, 0xbb, 0xe0, 0x02,
+    0xbf, 0xc5, 0x1b, 0xed, 0x40, 0x1c, 0x1c, 0xba, 0xf1, 0xda, 0xb2, 0x71, 0xb3, 0x72, 0x1b, 0x37,
+    0x3b, 0xe2, 0x10, 0x02, 0x07, 0xf7, 0x0c, 0xb8, 0x84, 0x00, 0xa1, 0x9f, 0xed, 0xa7, 0x18, 0x36,
+    0x30, 0x82, 0x4d, 0x71, 0xd5, 0xca, 0xa6, 0x8e, 0x5c, 0x30, 0x00, 0xd7, 0x20, 0x1c, 0x6d, 0x20,
+    0x02, 0xff, 0x61, 0x6a, 0x80, 0x51, 0x96, 0xf4, 0x80, 0x03, 0x32, 0x51, 0xf0, 0x07, 0x9c, 0x03,
+    0xca, 0x9e, 0x00, 0xbf, 0xf5, 0x42, 0x80, 0x27, 0x20, 0x14, 0x02, 0x23, 0x71, 0x80, 0x0f, 0x42,
+    0x90, 0x07, 0x30, 0xc0, 0x00, 0x36, 0x80, 0x57, 0xc0, 0x16, 0x98, 0x1f, 0xbf, 0x10, 0x03, 0x28,
+    0x80, 0x10, 0x80, 0x11, 0x00, 0x7f, 0xf1, 0x40, 0x2f, 0xfd, 0xaa, 0x01, 0x46, 0x5b, 0xd2, 0x00,
+    0x0c, 0xc9, 0x47, 0xc0, 0x1e, 0x70, 0x0f, 0x2a, 0x78, 0x02, 0xff, 0xd5, 0x0a, 0x00, 0x9c, 0x80,
+    0x50, 0x08, 0x8d, 0xc6, 0x00, 0x3d, 0x0a, 0x40, 0x1c, 0xc3, 0x05, 0xe8, 0x68, 0x1d, 0x40, 0x14,
+    0x60, 0x07, 0x96, 0x80, 0x20, 0x3f, 0x7e, 0x20, 0x06, 0x51, 0x00, 0x21, 0x00, 0x22, 0x00, 0xff,
+    0xe2, 0x94, 0x88, 0x01, 0xa8, 0x02, 0xda, 0x00, 0x80, 0x00, 0x31, 0x8b, 0x80, 0x62, 0xea, 0x00,
+    0xe4, 0x8c, 0x70, 0x01, 0x7f, 0xaa, 0x35, 0x40, 0x28, 0xcb, 0x7a, 0x40, 0x01, 0x99, 0x28, 0xf8,
+    0x03, 0xce, 0x01, 0xe5, 0x4f, 0x00, 0x5f, 0xfa, 0xa1, 0x40, 0x13, 0x90, 0x0a, 0x01, 0x11, 0xb8,
+    0xc0, 0x07, 0xa1, 0x48, 0x03, 0x98, 0x60, 0x4d, 0x2e, 0x24, 0x5d, 0x82, 0x08, 0xf6, 0x03, 0xf7,
+    0xe2, 0x00, 0x65, 0x10, 0x02, 0x10, 0x02, 0x20, 0x0f, 0xfe, 0x28, 0x00, 0xd9, 0x00, 0x1c, 0x83,
+    0x00, 0x1c, 0x9a, 0x01, 0x8a, 0xfb, 0x96, 0x40, 0x0c, 0x78, 0x83, 0x60, 0x20, 0xf3, 0x33, 0x85,
+    0x1c, 0x28, 0x00, 0x7e, 0x86, 0xee, 0xea, 0x50, 0x0a, 0x36, 0x46, 0xb4, 0x49, 0x09, 0xef, 0x4a,
+    0x52, 0xc4, 0x00, 0x44, 0x17, 0x1d, 0x55, 0x51, 0x50, 0xe3, 0x5d, 0x35, 0x98, 0x00, 0xaa, 0x80,
+    0x11, 0x25, 0x80, 0x45, 0xc2, 0x00, 0x8e, 0xfa, 0x14, 0x7b, 0xc7, 0x87, 0x00, 0x1f, 0xd9, 0xcc,
+    0x7c, 0x88, 0x97, 0x74, 0x1e, 0x98, 0xa0, 0x12, 0xbd, 0xeb, 0xf0, 0x00, 0x99, 0x80, 0x1d, 0x19,
+    0xd4, 0x01, 0xa2, 0xa2, 0x80, 0x22, 0xbe, 0xe5, 0x90, 0x03, 0x1e, 0x20, 0xd8, 0x08, 0x3c, 0xcc,
+    0xe1, 0x47, 0x0a, 0x00, 0x1f, 0xa1, 0xbb, 0xba, 0x94, 0x02, 0x8d, 0x91, 0xad, 0x12, 0x42, 0x7b,
+    0xd2, 0x94, 0xb1, 0x00, 0x11, 0x05, 0xc7, 0x55, 0x54, 0x54, 0x38, 0xd7, 0x4d, 0x66, 0x00, 0x00,
+    0x67, 0x90, 0x02, 0x1a, 0xbc, 0x01, 0x14, 0xba, 0x00, 0x8e, 0xfa, 0x14, 0x7b, 0xc7, 0x87, 0x00,
+    0x1f, 0xd9, 0xcc, 0x7c, 0x88, 0x97, 0x74, 0x1e, 0x98, 0xa0, 0x12, 0xbd, 0xeb, 0xf0, 0x02, 0xae,
+    0xe5, 0x90, 0x03, 0x1e, 0x20, 0xd8, 0x08, 0x3e, 0xcc, 0xe1, 0x47, 0x05, 0x00, 0x1f, 0xa1, 0xb4,
+    0x75, 0x28, 0x05, 0x3b, 0x23, 0x5a, 0x24, 0x64, 0xf7, 0xa5, 0x29, 0x82, 0x00, 0x22, 0x0b, 0x86,
+    0xa2, 0x24, 0xb4, 0x70, 0x2e, 0xc9, 0x28, 0x07, 0x94, 0xb8, 0xc0, 0x19, 0x76, 0x40, 0x39, 0xef,
+    0x00, 0x00, 0x08, 0xef, 0xa1, 0x47, 0xbc, 0x78, 0x70, 0x01, 0xfd, 0x9c, 0x5f, 0xc8, 0x0b, 0x76,
+    0x3c, 0xbf, 0x19, 0x33, 0x4f, 0xbc, 0x3c, 0x11, 0xa7, 0x46, 0x00, 0x39, 0xb0, 0x09, 0x67, 0xc0,
+    0x00, 0x31, 0x93, 0x00, 0x64, 0xef, 0x50, 0x0c, 0x5b, 0xa3, 0x00, 0x8a, 0xfb, 0x96, 0x40, 0x0c,
+    0x78, 0x83, 0x60, 0x20, 0xf3, 0x33, 0x85, 0x1c, 0x28, 0x00, 0x7e, 0x86, 0xee, 0xea, 0x50, 0x0a,
+    0x36, 0x46, 0xb4, 0x49, 0x09, 0xef, 0x4a, 0x52, 0xc4, 0x00, 0x44, 0x17, 0x1d, 0x55, 0x51, 0x50,
+    0xe3, 0x5d, 0x35, 0x98, 0x08, 0xa4, 0xd0, 0x04, 0x35, 0x70, 0x05, 0x9c, 0x60, 0x08, 0xef, 0xa1,
+    0x47, 0xbc, 0x78, 0x70, 0x01, 0xfd, 0x9c, 0xc7, 0xc8, 0x89, 0x77, 0x41, 0xe9, 0x8a, 0x01, 0x2b,
+    0xde, 0xbf, 0x00, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a, 0x20, 0xc0, 0x3f,
+    0xfd, 0xf8, 0x60, 0x1e, 0x42, 0x60, 0x0e, 0x56, 0x50, 0x00, 0x05, 0x40, 0x0b, 0xb4, 0x01, 0xc8,
+    0xde, 0x1e, 0x6b, 0xc0, 0x2e, 0x62, 0x01, 0xff, 0xc0, 0x15, 0x20, 0x07, 0x16, 0x80, 0x11, 0x6c,
+    0x02, 0x99, 0x08, 0x02, 0x58, 0x40, 0x00, 0x39, 0x11, 0xc0, 0x31, 0x7f, 0x10, 0x06, 0x5b, 0xa5,
+    0x00, 0x57, 0xfa, 0x65, 0xfe, 0xb8, 0xbb, 0x19, 0xae, 0xd0, 0x48, 0x86, 0x74, 0x41, 0x80, 0x7f,
+    0xfb, 0x00, 0x00, 0xa2, 0x41, 0x94, 0x38, 0x37, 0x30, 0xbc, 0x8d, 0x65, 0xe6, 0xbc, 0x02, 0xe6,
+    0x20, 0x1f, 0xfc, 0x01, 0x52, 0x00, 0x48, 0x68, 0x00, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68,
+    0x24, 0x43, 0x3a, 0x20, 0xc0, 0x3f, 0xf8, 0xb1, 0xea, 0x9f, 0x20, 0x09, 0xd4, 0x3d, 0x80, 0x00,
+    0x90, 0xb9, 0x08, 0x07, 0xff, 0x14, 0x05, 0x40, 0x07, 0x68, 0x72, 0x37, 0xf8, 0xd7, 0xb0, 0xd7,
+    0xf1, 0x17, 0xc4, 0x0c, 0x40, 0x54, 0x82, 0x43, 0x40, 0x00, 0xb1, 0xd9, 0x80, 0x18, 0xd0, 0x6d,
+    0x00, 0x31, 0xc3, 0x69, 0x00, 0x0b, 0xcc, 0x02, 0x1f, 0x50, 0x0f, 0xff, 0x1b, 0x80, 0x70, 0x90,
+    0x60, 0x04, 0xe0, 0xc0, 0xee, 0x95, 0x89, 0x52, 0x08, 0x94, 0xa5, 0x8a, 0x00, 0x00, 0x6c, 0xab,
+    0x80, 0x09, 0x32, 0x14, 0x00, 0x52, 0xba, 0x40, 0x7e, 0x20, 0x0c, 0x80, 0x0f, 0xfe, 0x38, 0x80,
+    0x44, 0x00, 0x30, 0x30, 0x85, 0xa1, 0x00, 0x5b, 0x59, 0x18, 0x00, 0x00, 0x17, 0x74, 0xa0, 0x18,
+    0xbf, 0xe5, 0x00, 0x17, 0x98, 0x8e, 0xf5, 0x00, 0xff, 0xf1, 0xb8, 0x07, 0x09, 0x06, 0x00, 0x4e,
+    0x0c, 0x0e, 0xe9, 0x58, 0x95, 0x20, 0x89, 0x4a, 0x58, 0xa0, 0x00, 0x02, 0xee, 0x98, 0x00, 0x5f,
+    0xf3, 0x01, 0xf8, 0x08, 0xb2, 0x00, 0x3f, 0xf8, 0xe2, 0x01, 0x10, 0x00, 0xc0, 0xc2, 0x16, 0x84,
+    0x01, 0x6d, 0x64, 0x60, 0x00, 0x00, 0x1d, 0x84, 0xa8, 0x06, 0x32, 0xe3, 0x50, 0x0e, 0x9e, 0xa0,
+    0x08, 0xbc, 0xc0, 0x21, 0xf5, 0x00, 0xff, 0xf1, 0xb8, 0x07, 0x09, 0x06, 0x00, 0x4e, 0x0c, 0x0e,
+    0xe9, 0x58, 0x95, 0x20, 0x89, 0x4a, 0x58, 0xa0, 0x00, 0x03, 0xd0, 0x97, 0x00, 0x1a, 0xf1, 0xb8,
+    0x05, 0x1d, 0x40, 0x03, 0xf1, 0x00, 0x64, 0x00, 0x7f, 0xf1, 0xc4, 0x02, 0x20, 0x01, 0x81, 0x84,
+    0x2d, 0x08, 0x02, 0xda, 0xc8, 0xc0, 0x00, 0x97, 0x5c, 0x03, 0xd3, 0x96, 0x01, 0xff, 0xc3, 0x9c,
+    0xb0, 0x08, 0xbc, 0xd7, 0x5c, 0x7d, 0x40, 0x3f, 0xfc, 0x6e, 0x01, 0xc2, 0x41, 0x80, 0x13, 0x83,
+    0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28, 0x00, 0x00, 0x26, 0xb8, 0x06, 0x8f, 0xb0,
+    0x0f, 0xfa, 0x3e, 0xc0, 0x07, 0xeb, 0xaf, 0x90, 0x01, 0xff, 0xc7, 0x10, 0x08, 0x80, 0x06, 0x06,
+    0x10, 0xb4, 0x20, 0x0b, 0x6b, 0x23, 0x00, 0x00, 0xaa, 0x63, 0x00, 0x30, 0xa5, 0x37, 0x00, 0x61,
+    0xe3, 0xe2, 0x00, 0x17, 0x98, 0x04, 0x3e, 0xa0, 0x1f, 0xfe, 0x37, 0x00, 0xe1, 0x20, 0xc0, 0x09,
+    0xc1, 0x81, 0xdd, 0x2b, 0x12, 0xa4, 0x11, 0x29, 0x4b, 0x14, 0x00, 0x00, 0x55, 0x1f, 0x40, 0x02,
+    0x93, 0x2f, 0x00, 0x0f, 0x1f, 0x10, 0x1f, 0x88, 0x03, 0x20, 0x03, 0xff, 0x8e, 0x20, 0x11, 0x00,
+    0x0c, 0x0c, 0x21, 0x68, 0x40, 0x16, 0xd6, 0x46, 0x00, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfd,
+    0x44, 0x08, 0x01, 0x20, 0x30, 0x3c, 0x31, 0x2d, 0x99, 0x82, 0x21, 0x7b, 0x45, 0xa0, 0x13, 0xf8,
+    0xbe, 0x08, 0x06, 0x41, 0x80, 0x0f, 0x39, 0x68, 0x04, 0x00, 0x3f, 0x10, 0x06, 0x40, 0x07, 0xff,
+    0x1c, 0x40, 0x22, 0x00, 0x18, 0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x88, 0x00, 0x4d, 0xed, 0x39,
+    0x00, 0xde, 0xa2, 0x01, 0xbd, 0x60, 0x00, 0xe4, 0x70, 0x0f, 0xf1, 0x56, 0xc8, 0x07, 0xf3, 0xd5,
+    0x38, 0x40, 0x36, 0x50, 0x01, 0x7b, 0xd4, 0x40, 0xbd, 0x12, 0x00, 0x9c, 0x10, 0x00, 0x80, 0x98,
+    0x24, 0x02, 0x49, 0x80, 0x0c, 0x30, 0x40, 0x40, 0x41, 0xd4, 0x00, 0x3a, 0x00, 0x13, 0x03, 0x11,
+    0x02, 0x42, 0x58, 0x00, 0xc4, 0x04, 0xc2, 0x14, 0x40, 0x20, 0x01, 0x04, 0x88, 0x80, 0x9f, 0x86,
+    0x01, 0x18, 0x58, 0x90, 0x62, 0x2d, 0x80, 0x64, 0x64, 0x00, 0x21, 0x1a, 0x00, 0x6c, 0x0c, 0x00,
+    0x10, 0x81, 0x80, 0x00, 0x00, 0x87, 0x78, 0x40, 0x3d, 0x75, 0x14, 0x01, 0xea, 0x76, 0xb0, 0x0a,
+    0xec, 0x00, 0xbc, 0x00, 0x56, 0x6a, 0x00, 0x10, 0xc4, 0x12, 0xdc, 0x0d, 0x08, 0xd0, 0x85, 0x44,
+    0xd3, 0x11, 0x18, 0xa4, 0x40, 0x4c, 0x4d, 0xc4, 0xc4, 0x00, 0x5a, 0x1a, 0x20, 0x93, 0x40, 0x06,
+    0x28, 0x00, 0x40, 0x40, 0x00, 0x00, 0x91, 0xc0, 0x3c, 0x55, 0xb2, 0x01, 0xcf, 0x54, 0xe1, 0x00,
+    0x4f, 0x22, 0x01, 0xdb, 0xca, 0x02, 0x00, 0x03, 0x2c, 0x43, 0x2c, 0x41, 0x01, 0x00, 0x07, 0x29,
+    0x26, 0x81, 0x00, 0xa5, 0x3c, 0x98, 0x03, 0x22, 0x0a, 0x40, 0x3d, 0xa0, 0x80, 0x1f, 0xfd, 0x20,
+    0x00, 0x4f, 0xa8, 0x04, 0xaa, 0xd8, 0x20, 0x02, 0xe1, 0x69, 0x05, 0x60, 0x05, 0xd1, 0xc6, 0x20,
+    0x63, 0x48, 0x2e, 0x14, 0x64, 0x0f, 0x40, 0xf4, 0x00, 0xa3, 0x51, 0x70, 0x01, 0x95, 0xa0, 0x80,
+    0x54, 0x3c, 0x01, 0x84, 0x14, 0x02, 0x3b, 0x70, 0x08, 0xb1, 0xa0, 0x02, 0x00, 0x00, 0x32, 0x84,
+    0x10, 0x06, 0xdd, 0x0b, 0x30, 0x03, 0x5c, 0x0f, 0x20, 0x02, 0x78, 0x40, 0x27, 0xf2, 0x80, 0x80,
+    0x00, 0xcb, 0x10, 0xcb, 0x10, 0x40, 0x40, 0x01, 0xca, 0x49, 0xa0, 0x40, 0x29, 0x4f, 0x26, 0x00,
+    0xc8, 0x82, 0x90, 0x0f, 0x68, 0x20, 0x07, 0xff, 0x48, 0x00, 0xdb, 0x00, 0x1c, 0x83, 0x00, 0x07,
+    0xff, 0x59, 0xff, 0xa9, 0xae, 0xf4, 0x06, 0x0a, 0x24, 0xb2, 0xac, 0x01, 0xa8, 0x2c, 0x03, 0x3a,
+    0x68, 0x80, 0x47, 0x10, 0x30, 0x0d, 0xc8, 0xe0, 0x1a, 0x8e, 0x80, 0x33, 0x2b, 0x2a, 0x24, 0x58,
+    0x0f, 0x77, 0xa4, 0x00, 0xaa, 0x80, 0x11, 0x25, 0x80, 0x45, 0xc2, 0x0d, 0xff, 0xb1, 0xb7, 0x56,
+    0x14, 0x04, 0x48, 0x46, 0x00, 0x41, 0x50, 0x01, 0x1f, 0x44, 0x06, 0x98, 0x48, 0x8e, 0x2d, 0xba,
+    0xe0, 0x00, 0x95, 0x80, 0x3d, 0x98, 0x00, 0xf4, 0xd0, 0x04, 0xff, 0xfe, 0xa6, 0xbb, 0xd0, 0x18,
+    0x28, 0x92, 0xca, 0xb0, 0x06, 0xa0, 0xb0, 0x0c, 0xe9, 0xa2, 0x01, 0x1c, 0x40, 0xc0, 0x37, 0x23,
+    0x80, 0x6a, 0x3a, 0x00, 0xcc, 0xac, 0xa8, 0x91, 0x60, 0x3d, 0xde, 0x90, 0x00, 0x3e, 0x00, 0x63,
+    0x40, 0x0c, 0x90, 0x00, 0x6f, 0xfd, 0x8d, 0xba, 0xb0, 0xa0, 0x22, 0x42, 0x30, 0x02, 0x0a, 0x80,
+    0x08, 0xfa, 0x20, 0x34, 0xc2, 0x44, 0x71, 0x6d, 0xd7, 0x00, 0x00, 0x39, 0x11, 0xc0, 0x31, 0x7f,
+    0x10, 0x06, 0x5b, 0xa5, 0x00, 0x3f, 0xfa, 0x65, 0xfe, 0xa6, 0xbb, 0xd0, 0x18, 0x28, 0x92, 0xca,
+    0xb0, 0x06, 0xa0, 0xb0, 0x0c, 0xe9, 0xa2, 0x01, 0x1c, 0x40, 0xc0, 0x37, 0x23, 0x80, 0x6a, 0x3a,
+    0x00, 0xcc, 0xac, 0xa8, 0x91, 0x60, 0x3d, 0xde, 0x90, 0x08, 0xa4, 0xd0, 0x04, 0x0d, 0x78, 0x05,
+    0x7c, 0x40, 0xdf, 0xfb, 0x1b, 0x75, 0x61, 0x40, 0x44, 0x84, 0x60, 0x04, 0x15, 0x00, 0x11, 0xf4,
+    0x40, 0x69, 0x84, 0x88, 0xe2, 0xdb, 0xae, 0x00, 0x08, 0xe7, 0x27, 0xb7, 0x10, 0x40, 0x0f, 0xfe,
+    0x88, 0x00, 0xab, 0xd8, 0x03, 0xca, 0x5a, 0x01, 0xca, 0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03,
+    0x2e, 0x82, 0x50, 0x04, 0xa0, 0xe1, 0xe6, 0x20, 0x0e, 0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b,
+    0x60, 0xc0, 0xc6, 0x77, 0x99, 0x6a, 0x08, 0x04, 0xa0, 0xb7, 0x60, 0x7d, 0x40, 0xf7, 0x00, 0xaf,
+    0x20, 0x03, 0xff, 0x87, 0x7b, 0x00, 0x10, 0x05, 0xdf, 0xc3, 0x02, 0xa5, 0xc6, 0xd0, 0x3c, 0x82,
+    0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc, 0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0xaa,
+    0x00, 0xfc, 0x40, 0x17, 0x90, 0x01, 0xff, 0x5e, 0xc0, 0x00, 0x00, 0x99, 0x80, 0x1e, 0xcc, 0x00,
+    0x7a, 0xa8, 0x01, 0x17, 0xfe, 0xd6, 0x00, 0xa7, 0x2d, 0xe4, 0xc0, 0x04, 0x69, 0x40, 0xa0, 0x1c,
+    0xe0, 0x80, 0x0b, 0xff, 0x45, 0x10, 0x02, 0x77, 0x1e, 0x98, 0x00, 0x44, 0x38, 0x5a, 0x00, 0xff,
+    0x11, 0xa4, 0x2d, 0x80, 0x27, 0x2d, 0x61, 0xc0, 0x00, 0x97, 0x40, 0x23, 0xf1, 0x65, 0x00, 0xf1,
+    0xc0, 0x07, 0xff, 0x05, 0x37, 0xa4, 0x03, 0x4c, 0xad, 0xe0, 0x02, 0xf4, 0x59, 0x60, 0x08, 0xc0,
+    0x04, 0x20, 0x11, 0x80, 0x08, 0x40, 0x2f, 0x45, 0x96, 0x00, 0xa6, 0x56, 0xf0, 0x00, 0x2f, 0xfd,
+    0x88, 0x01, 0x4e, 0x5b, 0x58, 0x80, 0x08, 0xd2, 0xc1, 0xc0, 0x38, 0x40, 0xc0, 0x3a, 0x05, 0x00,
+    0x17, 0xfe, 0x7b, 0x10, 0x04, 0xee, 0x45, 0x40, 0x00, 0x88, 0x6e, 0xa8, 0x00, 0x23, 0x47, 0x45,
+    0x00, 0x4e, 0x5c, 0xbc, 0x97, 0xfe, 0xe9, 0x00, 0xca, 0xc0, 0x1e, 0xcc, 0x00, 0x40, 0x3f, 0x10,
+    0x0f, 0xfe, 0x5a, 0x6f, 0x48, 0x06, 0x99, 0x5b, 0xc0, 0x05, 0xe8, 0xb2, 0xc0, 0x11, 0x80, 0x08,
+    0x40, 0x23, 0x00, 0x10, 0x80, 0x5e, 0x8b, 0x2c, 0x01, 0x4c, 0xad, 0xe0, 0x0f, 0xd7, 0x7a, 0x40,
+    0x39, 0xd0, 0x03, 0xd9, 0x80, 0x08, 0x2f, 0xfd, 0xac, 0x01, 0x4e, 0x5b, 0xc9, 0x80, 0x08, 0xd2,
+    0x81, 0x40, 0x39, 0xc1, 0x00, 0x17, 0xfe, 0x8a, 0x20, 0x04, 0xee, 0x3d, 0x30, 0x00, 0x88, 0x70,
+    0xb4, 0x01, 0xfe, 0x23, 0x48, 0x5b, 0x00, 0x4e, 0x5a, 0xc3, 0x97, 0xfe, 0xd7, 0x00, 0xab, 0xb9,
+    0x80, 0x1a, 0xff, 0xda, 0x00, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x5a, 0x6f, 0x48, 0x06, 0x99, 0x5b,
+    0xc0, 0x05, 0xe8, 0xb2, 0xc0, 0x11, 0x80, 0x08, 0x40, 0x23, 0x00, 0x10, 0x80, 0x5e, 0x8b, 0x2c,
+    0x01, 0x4c, 0xad, 0xe0, 0x0f, 0xd7, 0x7a, 0x40, 0x36, 0x77, 0x24, 0x03, 0x6f, 0xfa, 0x00, 0x00,
+    0x00, 0xc3, 0xe8, 0x01, 0xe6, 0x62, 0x00, 0x63, 0xb9, 0x7a, 0x20, 0x02, 0x60, 0x44, 0x1f, 0x04,
+    0x25, 0x2d, 0x99, 0x83, 0x06, 0x50, 0x01, 0x0d, 0xe2, 0x81, 0x80, 0x64, 0x50, 0x0f, 0xe2, 0x02,
+    0x00, 0xc6, 0x88, 0x18, 0x00, 0x87, 0x78, 0x2d, 0x6d, 0x55, 0xa3, 0x00, 0xb6, 0x15, 0x47, 0xd2,
+    0x00, 0x25, 0xac, 0x59, 0x00, 0x75, 0x61, 0x80, 0x7a, 0x80, 0xc0, 0x00, 0x00, 0x8f, 0xc8, 0x03,
+    0x44, 0x90, 0x06, 0xb6, 0x00, 0x8a, 0xff, 0x54, 0x01, 0x83, 0x6b, 0x46, 0xc3, 0x49, 0x10, 0x0e,
+    0x20, 0x09, 0xcf, 0xcc, 0x02, 0x42, 0x51, 0x71, 0x5b, 0x62, 0xa9, 0xea, 0x74, 0x05, 0xe3, 0xc8,
+    0x00, 0xdf, 0xc0, 0x18, 0x61, 0xc0, 0x00, 0x00, 0xa0, 0xc0, 0x3e, 0x56, 0x00, 0xfb, 0x54, 0x03,
+    0x17, 0xfd, 0xd6, 0x60, 0x1a, 0x2e, 0xc3, 0x8a, 0x01, 0x1a, 0x2d, 0x35, 0x80, 0x7d, 0x62, 0x80,
+    0x1e, 0x20, 0x20, 0x0f, 0xfe, 0x19, 0x01, 0x00, 0x7a, 0xc5, 0x00, 0x06, 0x8b, 0x6d, 0x60, 0x14,
+    0x5d, 0x83, 0x14, 0x00, 0x00, 0x3e, 0x80, 0x72, 0x50, 0x4d, 0x80, 0x0d, 0xc0, 0x3f, 0xe4, 0xde,
+    0xa3, 0x01, 0xb7, 0xdd, 0x28, 0x38, 0xd1, 0xba, 0x07, 0x18, 0x04, 0x61, 0xc6, 0x01, 0x18, 0x38,
+    0xd1, 0xba, 0x00, 0xdb, 0xee, 0x98, 0x00, 0x2f, 0xfb, 0xac, 0xc0, 0x34, 0x5d, 0x87, 0x14, 0x02,
+    0x34, 0x5a, 0x6b, 0x00, 0xfa, 0xc5, 0x00, 0x3c, 0x40, 0x40, 0x1f, 0xfc, 0x32, 0x02, 0x00, 0xf5,
+    0x8a, 0x00, 0x0d, 0x16, 0xda, 0xc0, 0x28, 0xbb, 0x06, 0x28, 0x17, 0xfd, 0xd6, 0x60, 0x1c, 0xe8,
+    0x01, 0xf5, 0x98, 0x06, 0x00, 0x00, 0xe9, 0xb0, 0x0f, 0xfe, 0x1a, 0x6f, 0x51, 0x80, 0xdb, 0xee,
+    0x94, 0x1c, 0x68, 0xdd, 0x03, 0x8c, 0x02, 0x30, 0xe3, 0x00, 0x8c, 0x1c, 0x68, 0xdd, 0x00, 0x6d,
+    0xf7, 0x4c, 0x00, 0x4d, 0xea, 0x9b, 0x00, 0xa4, 0x80, 0x30, 0xbb, 0x00, 0x00, 0x2f, 0xfb, 0xac,
+    0xc0, 0x34, 0x5d, 0x87, 0x14, 0x02, 0x34, 0x5a, 0x6b, 0x00, 0xfa, 0xc5, 0x00, 0x3c, 0x40, 0x40,
+    0x1f, 0xfc, 0x32, 0x02, 0x00, 0xf5, 0x8a, 0x00, 0x0d, 0x16, 0xda, 0xc0, 0x28, 0xbb, 0x06, 0x28,
+    0x17, 0xfd, 0xd6, 0x60, 0x1b, 0x7b, 0x90, 0x01, 0xd9, 0xfe, 0x80, 0x08, 0x00, 0xe9, 0xb0, 0x0f,
+    0xfe, 0x1a, 0x6f, 0x51, 0x80, 0xdb, 0xee, 0x94, 0x1c, 0x68, 0xdd, 0x03, 0x8c, 0x02, 0x30, 0xe3,
+    0x00, 0x8c, 0x1c, 0x68, 0xdd, 0x00, 0x6d, 0xf7, 0x4c, 0x00, 0x4d, 0xea, 0x9b, 0x02, 0xee, 0x94,
+    0x00, 0x5f, 0xf2, 0x80, 0x2f, 0xfb, 0xac, 0xc0, 0x34, 0x5d, 0x87, 0x14, 0x02, 0x34, 0x5a, 0x6b,
+    0x00, 0xfa, 0xc5, 0x00, 0x3c, 0x40, 0x40, 0x1f, 0xfc, 0x32, 0x02, 0x00, 0xf5, 0x8a, 0x00, 0x0d,
+    0x16, 0xda, 0xc0, 0x28, 0xbb, 0x06, 0x28, 0x17, 0xfa, 0xb2, 0xcc, 0x03, 0xa8, 0x03, 0xe4, 0x22,
+    0x00, 0x60, 0x00, 0xe9, 0xb0, 0x0f, 0xfe, 0x1a, 0x6f, 0x51, 0x80, 0xdb, 0xee, 0x94, 0x1c, 0x68,
+    0xdd, 0x03, 0x8c, 0x02, 0x30, 0xe3, 0x00, 0x8c, 0x1c, 0x68, 0xdd, 0x00, 0x6d, 0xf7, 0x4c, 0x00,
+    0x4d, 0x8b, 0x9b, 0x00, 0x24, 0x08, 0x06, 0x37, 0x00, 0x80, 0x2f, 0xfb, 0xac, 0xc0, 0x34, 0x5d,
+    0x87, 0x14, 0x02, 0x34, 0x5a, 0x6b, 0x00, 0xfa, 0xc5, 0x00, 0x3c, 0x40, 0x40, 0x1f, 0xfc, 0x32,
+    0x02, 0x00, 0xf5, 0x8a, 0x00, 0x0d, 0x16, 0xda, 0xc0, 0x28, 0xbb, 0x06, 0x28, 0x17, 0xfd, 0xd6,
+    0x60, 0x18, 0xb6, 0x80, 0x3d, 0xf0, 0x10, 0x01, 0x00, 0x00, 0xe9, 0xb0, 0x0f, 0xfe, 0x1a, 0x6f,
+    0x51, 0x80, 0xdb, 0xee, 0x94, 0x1c, 0x68, 0xdd, 0x03, 0x8c, 0x02, 0x30, 0xe3, 0x00, 0x8c, 0x1c,
+    0x68, 0xdd, 0x00, 0x6d, 0xf7, 0x4c, 0x00, 0x4d, 0xea, 0x9b, 0x00, 0x2f, 0x40, 0x04, 0x57, 0x8a,
+    0x80, 0x00, 0x00, 0x35, 0x00, 0x79, 0x98, 0x80, 0x1e, 0xc4, 0x00, 0xea, 0xee, 0x60, 0x06, 0xbf,
+    0xf6, 0x80, 0x0b, 0xfb, 0xb7, 0x98, 0x02, 0x2e, 0xf1, 0x80, 0x0d, 0x13, 0x00, 0x7f, 0xd7, 0xff,
+    0x68, 0x05, 0x39, 0x97, 0x00, 0x44, 0x67, 0x80, 0x3f, 0xe3, 0x44, 0xc0, 0x14, 0x5d, 0xe3, 0x00,
+    0x00, 0x5a, 0x00, 0x77, 0xc0, 0x07, 0x26, 0x00, 0x63, 0xee, 0x90, 0x00, 0x7f, 0xf2, 0x00, 0x0f,
+    0x7b, 0x4c, 0x07, 0x57, 0x2f, 0x05, 0xc6, 0x4d, 0xc9, 0xb8, 0x3b, 0xa2, 0xde, 0x1c, 0xff, 0x6d,
+    0xb8, 0xd9, 0x3e, 0xa0, 0xe2, 0xe5, 0xca, 0x80, 0x00, 0xd2, 0xe0, 0x1c, 0x68, 0xe0, 0x1c, 0x7a,
+    0x01, 0xd5, 0xdc, 0xc0, 0x0d, 0x7f, 0xed, 0x00, 0x17, 0xf7, 0x6f, 0x30, 0x04, 0x5d, 0xe3, 0x00,
+    0x1a, 0x26, 0x00, 0xff, 0xaf, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x7f, 0xc6,
+    0x89, 0x80, 0x28, 0xbb, 0xc6, 0x00, 0x00, 0x8f, 0x04, 0x03, 0x45, 0x08, 0x06, 0xb6, 0x00, 0x8f,
+    0xba, 0x40, 0x01, 0xff, 0xc8, 0x00, 0x3d, 0xed, 0x30, 0x1d, 0x5c, 0xbc, 0x17, 0x19, 0x37, 0x26,
+    0xe0, 0xee, 0x8b, 0x78, 0x73, 0xfd, 0xb6, 0xe3, 0x64, 0xfa, 0x83, 0x8b, 0x97, 0x2a, 0x00, 0x2f,
+    0xff, 0x18, 0x02, 0x2e, 0xf1, 0x80, 0x0d, 0x13, 0x00, 0x7f, 0xf1, 0xef, 0xfe, 0xd0, 0x0a, 0x73,
+    0x2e, 0x00, 0x88, 0xcf, 0x00, 0x46, 0x89, 0x80, 0x28, 0xbb, 0xc6, 0x5f, 0xfe, 0x30, 0x0a, 0xf0,
+    0x40, 0x35, 0x1d, 0xd0, 0x00, 0x03, 0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e,
+    0x0e, 0xe8, 0xb7, 0x87, 0x3f, 0xd7, 0x2e, 0x36, 0x4f, 0x6e, 0x38, 0xb9, 0x74, 0x80, 0x79, 0xfa,
+    0xa0, 0x13, 0x73, 0x80, 0x47, 0x19, 0x48, 0x00, 0x2f, 0xff, 0x18, 0x02, 0x2e, 0xf1, 0x80, 0x0d,
+    0x13, 0x00, 0x7f, 0xf1, 0xef, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x46, 0x89,
+    0x80, 0x28, 0xbb, 0xc6, 0x5f, 0xfe, 0x30, 0x03, 0xe1, 0x60, 0x06, 0xbe, 0xe2, 0x00, 0x00, 0x03,
+    0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e, 0x0e, 0xe8, 0xb7, 0x87, 0x3f, 0xdb,
+    0x6e, 0x36, 0x4f, 0xa8, 0x38, 0xb9, 0x72, 0xa0, 0x79, 0xfa, 0xc0, 0x01, 0xd7, 0x65, 0x00, 0x2a,
+    0x82, 0x1c, 0x00, 0x00, 0x59, 0x96, 0x00, 0x68, 0xef, 0x80, 0x01, 0x7e, 0x11, 0x2f, 0xcc, 0x01,
+    0x17, 0x78, 0xc0, 0x06, 0x89, 0x80, 0x3f, 0xf8, 0xf7, 0xff, 0x68, 0x05, 0x39, 0x97, 0x00, 0x44,
+    0x67, 0x80, 0x23, 0x44, 0xc0, 0x14, 0x5d, 0xe3, 0x2f, 0xf5, 0x37, 0xf8, 0xc0, 0x24, 0x18, 0x00,
+    0xe6, 0x4c, 0x00, 0x00, 0x05, 0x90, 0x86, 0x00, 0x22, 0x01, 0x10, 0x00, 0x1b, 0xdb, 0x20, 0x01,
+    0x51, 0x59, 0x80, 0x31, 0x72, 0xf0, 0x58, 0x64, 0xdc, 0x9b, 0x83, 0xba, 0x2d, 0xf1, 0xff, 0xba,
+    0xd8, 0x58, 0x57, 0x90, 0x6e, 0x7e, 0xa1, 0x41, 0x38, 0xb5, 0xc0, 0x37, 0xf0, 0x06, 0x19, 0x70,
+    0x00, 0x00, 0x99, 0x40, 0x3d, 0xb8, 0x01, 0xeb, 0x90, 0x08, 0xbf, 0xfc, 0x01, 0x45, 0xde, 0x00,
+    0x8d, 0x13, 0x00, 0x7f, 0xf1, 0xef, 0xfe, 0xa0, 0x0a, 0x73, 0x28, 0x00, 0x88, 0xce, 0x20, 0x0f,
+    0xfe, 0x28, 0x01, 0x90, 0x01, 0x39, 0x01, 0xf1, 0x01, 0x67, 0x85, 0x8e, 0x81, 0x39, 0x72, 0x2f,
+    0xf9, 0x17, 0x84, 0x00, 0x20, 0x1f, 0xfc, 0x40, 0x00, 0xbb, 0xa8, 0x00, 0xef, 0xfa, 0x00, 0x31,
+    0xd7, 0xfa, 0x84, 0x00, 0x98, 0x11, 0x07, 0xf1, 0x09, 0x4b, 0x66, 0x60, 0xc1, 0x94, 0x00, 0x43,
+    0x78, 0xa0, 0x60, 0x19, 0x14, 0x03, 0xb3, 0xfe, 0x20, 0x30, 0x07, 0x6b, 0x12, 0x14, 0x80, 0x08,
+    0x88, 0xe1, 0x2b, 0x6c, 0xcc, 0x2b, 0x04, 0xc0, 0x88, 0x37, 0x08, 0x02, 0xee, 0x94, 0x00, 0x5f,
+    0xf2, 0x80, 0x13, 0x3a, 0xea, 0xc6, 0xd7, 0xbd, 0x41, 0xc6, 0x05, 0x54, 0x1c, 0x60, 0x11, 0x07,
+    0x10, 0x04, 0x60, 0xe1, 0x46, 0xe8, 0x03, 0x6f, 0xba, 0x60, 0x02, 0xef, 0x52, 0x88, 0xba, 0x49,
+    0x8f, 0xc6, 0xd7, 0x62, 0x0a, 0x00, 0x00, 0xd2, 0x40, 0x1e, 0x17, 0x60, 0x0f, 0x0f, 0x20, 0x04,
+    0x5e, 0x80, 0x1b, 0xd8, 0x03, 0xff, 0xa3, 0x7f, 0xf8, 0x03, 0x4e, 0x66, 0x00, 0xc4, 0x67, 0x80,
+    0x3f, 0xfa, 0x20, 0x19, 0x00, 0xe2, 0x71, 0x00, 0xc7, 0xc2, 0x01, 0x8f, 0xc4, 0x03, 0xff, 0x90,
+    0xfb, 0xd0, 0x01, 0x54, 0x3b, 0x90, 0x01, 0xcb, 0x22, 0x60, 0x03, 0x00, 0x17, 0x80, 0x7f, 0xf2,
+    0x40, 0x2f, 0x40, 0x0d, 0xec, 0x01, 0xff, 0xda, 0xbf, 0xfc, 0x01, 0xa7, 0x33, 0x00, 0x62, 0x33,
+    0xc0, 0x1f, 0xfc, 0x82, 0xf4, 0x00, 0xde, 0xc0, 0x1a, 0x48, 0x03, 0xc2, 0xec, 0x01, 0x00, 0x3f,
+    0x10, 0x0f, 0xfe, 0x43, 0xef, 0x40, 0x05, 0x50, 0xee, 0x40, 0x07, 0x2c, 0x89, 0x80, 0x0c, 0x00,
+    0x5e, 0x01, 0xff, 0xc9, 0x3f, 0x10, 0x06, 0x40, 0x05, 0x24, 0x01, 0x85, 0xd8, 0x00, 0x00, 0x00,
+    0x1c, 0x03, 0x28, 0x06, 0x65, 0x0c, 0xc0, 0x06, 0x5d, 0x0a, 0x90, 0x01, 0x7a, 0x00, 0x6f, 0x60,
+    0x0f, 0xfe, 0x8d, 0xff, 0xe0, 0x0d, 0x39, 0x98, 0x03, 0x11, 0x9e, 0x00, 0xff, 0xe8, 0x80, 0x56,
+    0x07, 0x30, 0x0b, 0x34, 0x29, 0x40, 0x29, 0xb0, 0xd6, 0x00, 0xc7, 0xe2, 0x01, 0xff, 0xcb, 0x7d,
+    0xe8, 0x00, 0xd5, 0x0e, 0xe4, 0x00, 0xb9, 0x64, 0x4c, 0x02, 0x30, 0x01, 0x78, 0x07, 0xff, 0x30,
+    0x2f, 0x40, 0x0d, 0xec, 0x01, 0xff, 0xda, 0xbf, 0xfc, 0x01, 0xa7, 0x33, 0x00, 0x62, 0x33, 0xc0,
+    0x1f, 0xfc, 0x82, 0x36, 0x00, 0xde, 0xc1, 0x38, 0x01, 0xe2, 0xe4, 0x00, 0xf0, 0x3f, 0x10, 0x0f,
+    0xfe, 0x43, 0xef, 0x40, 0x05, 0x50, 0xee, 0x40, 0x07, 0x2c, 0x89, 0x80, 0x0c, 0x00, 0x5e, 0x01,
+    0xff, 0xc9, 0x32, 0x00, 0xb2, 0x02, 0xf0, 0x03, 0x1e, 0xa8, 0x06, 0x00, 0x2f, 0x40, 0x0d, 0xec,
+    0x01, 0xff, 0xd1, 0xbf, 0xfc, 0x01, 0xa7, 0x33, 0x00, 0x62, 0x33, 0xc0, 0x1f, 0xfd, 0x12, 0xf4,
+    0x00, 0xde, 0xc0, 0x03, 0xb0, 0x76, 0x00, 0xc6, 0x5d, 0x8e, 0x00, 0x00, 0x3f, 0x10, 0x0f, 0xfe,
+    0x43, 0xef, 0x40, 0x05, 0x50, 0xee, 0x40, 0x07, 0x2c, 0x89, 0x80, 0x0c, 0x00, 0x5e, 0x01, 0xff,
+    0xc9, 0x3f, 0x10, 0x06, 0x40, 0x15, 0x83, 0xb0, 0x00, 0x89, 0xd6, 0xe0, 0x00, 0x02, 0xf4, 0x00,
+    0xff, 0xf1, 0x97, 0xa0, 0x03, 0x1d, 0x98, 0x8a, 0x10, 0x80, 0x03, 0xe1, 0x00, 0x13, 0x88, 0x00,
+    0x64, 0x02, 0x3f, 0x10, 0x0f, 0xfe, 0xa1, 0xf8, 0x81, 0x6b, 0x41, 0xa5, 0x7a, 0x98, 0x00, 0x15,
+    0x88, 0x02, 0x74, 0x40, 0x16, 0xc0, 0xf8, 0x18, 0xe7, 0x61, 0x66, 0x8b, 0xe6, 0x80, 0x1f, 0xfe,
+    0x10, 0x00, 0x25, 0x80, 0x53, 0xe1, 0x35, 0xb2, 0xb9, 0xe0, 0xac, 0xaa, 0x08, 0x30, 0x3f, 0x10,
+    0x0f, 0xfe, 0x98, 0x00, 0xd1, 0x80, 0x1e, 0x16, 0xe0, 0x08, 0xbd, 0x07, 0x8f, 0x74, 0x01, 0xea,
+    0x3c, 0x00, 0xe9, 0x4d, 0x10, 0x0c, 0xed, 0x66, 0x01, 0xb6, 0x0d, 0x00, 0x39, 0x94, 0xd4, 0x03,
+    0x9a, 0x96, 0xc4, 0x03, 0x68, 0x58, 0x58, 0x07, 0x86, 0x95, 0x40, 0x1e, 0x45, 0xb1, 0x00, 0x06,
+    0xd0, 0x0e, 0xbe, 0x00, 0xc6, 0x44, 0x00, 0xff, 0xe5, 0x47, 0x98, 0x04, 0xee, 0xb3, 0x00, 0x4c,
+    0x5a, 0x00, 0x4e, 0x0e, 0x01, 0xb1, 0x38, 0x03, 0x15, 0x1d, 0x00, 0x61, 0xd5, 0x70, 0x2f, 0x40,
+    0x00, 0xee, 0x80, 0x3d, 0x47, 0x80, 0x1d, 0x29, 0xa2, 0x01, 0x9d, 0xac, 0xc0, 0x36, 0xc1, 0xa0,
+    0x07, 0x32, 0x9a, 0x80, 0x73, 0x52, 0xd8, 0x80, 0x6d, 0x0b, 0x0b, 0x00, 0xf0, 0xd2, 0xa8, 0x03,
+    0xc8, 0xb6, 0x25, 0xe8, 0x01, 0x57, 0x08, 0x04, 0x70, 0x01, 0xf3, 0x28, 0x06, 0x00, 0x3f, 0x10,
+    0x0f, 0xfe, 0x54, 0x79, 0x80, 0x4e, 0xeb, 0x30, 0x04, 0xc5, 0xa0, 0x04, 0xe0, 0xe0, 0x1b, 0x13,
+    0x80, 0x31, 0x51, 0xd0, 0x06, 0x1d, 0x57, 0x3f, 0x10, 0x3f, 0x70, 0x00, 0xc8, 0x80, 0x63, 0x72,
+    0x00, 0x00, 0x2f, 0x40, 0x00, 0xee, 0x80, 0x3d, 0x47, 0x80, 0x1d, 0x29, 0xa2, 0x01, 0x9d, 0xac,
+    0xc0, 0x36, 0xc1, 0xa0, 0x07, 0x32, 0x9a, 0x80, 0x73, 0x52, 0xd8, 0x80, 0x6d, 0x0b, 0x0b, 0x00,
+    0xf0, 0xd2, 0xa8, 0x03, 0xc8, 0xb6, 0x25, 0xe8, 0x01, 0x57, 0x08, 0x01, 0xfb, 0xa1, 0x00, 0xcf,
+    0xff, 0x08, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x54, 0x79, 0x80, 0x4e, 0xeb, 0x30, 0x04, 0xc5, 0xa0,
+    0x04, 0xe0, 0xe0, 0x1b, 0x13, 0x80, 0x31, 0x51, 0xd0, 0x06, 0x1d, 0x57, 0x3f, 0x10, 0x3f, 0x70,
+    0x3e, 0xe9, 0x00, 0x07, 0xff, 0x20, 0x00, 0x2f, 0x40, 0x0f, 0xff, 0x59, 0xa2, 0x46, 0x00, 0x8b,
+    0xba, 0x0b, 0xff, 0xac, 0x02, 0x83, 0x00, 0xe5, 0x60, 0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x79, 0xf8,
+    0x94, 0x83, 0x38, 0x80, 0x2e, 0xe9, 0x00, 0x22, 0xff, 0x90, 0x03, 0x1f, 0x28, 0x07, 0xff, 0xcc,
+    0xd1, 0x23, 0x00, 0xa2, 0xee, 0x80, 0x2f, 0xfe, 0xb0, 0x0d, 0x06, 0x01, 0xe5, 0x60, 0x00, 0x5e,
+    0xe8, 0x97, 0xfe, 0x20, 0x2e, 0x00, 0xff, 0xf2, 0x1f, 0x88, 0x00, 0xa4, 0x02, 0x67, 0x10, 0x00,
+    0x2f, 0x40, 0x0f, 0xff, 0x59, 0xa2, 0x46, 0x00, 0x8b, 0xba, 0x0b, 0xff, 0xac, 0x01, 0xdd, 0x38,
+    0x05, 0xff, 0x38, 0x00, 0x03, 0xf1, 0x00, 0xff, 0xf1, 0x9f, 0x88, 0x2f, 0x74, 0x4b, 0xff, 0x10,
+    0x2f, 0x40, 0x0f, 0xff, 0x59, 0xa2, 0x46, 0x00, 0x8b, 0xba, 0x0b, 0xff, 0xac, 0x00, 0x7b, 0x00,
+    0x10, 0xec, 0xa3, 0x00, 0x03, 0xf1, 0x00, 0xff, 0xf1, 0x9f, 0x88, 0x01, 0xf5, 0x01, 0x2b, 0xa8,
+    0x80, 0x00, 0xe3, 0xf2, 0x00, 0xfd, 0x30, 0x40, 0x11, 0x7f, 0x80, 0x14, 0xe1, 0x7e, 0xc0, 0x13,
+    0x00, 0x42, 0x80, 0x18, 0xa8, 0x02, 0x61, 0x10, 0x04, 0xa6, 0x20, 0x0b, 0x70, 0x0d, 0x82, 0xc0,
+    0x47, 0x40, 0x19, 0xdd, 0x41, 0x42, 0x60, 0x1d, 0x44, 0x45, 0x60, 0x0f, 0x19, 0x41, 0x50, 0x07,
+    0xd4, 0xa6, 0x40, 0x1f, 0x30, 0x50, 0x06, 0x00, 0x00, 0xe4, 0xe1, 0x00, 0xfd, 0x16, 0x20, 0x1f,
+    0xb1, 0x40, 0x31, 0xfa, 0xee, 0x95, 0x5b, 0xce, 0x01, 0x74, 0xbd, 0x4c, 0x9e, 0x08, 0x01, 0x09,
+    0x01, 0x09, 0x00, 0xe0, 0x02, 0x03, 0x07, 0x01, 0x00, 0xff, 0xeb, 0x80, 0x00, 0xe9, 0x20, 0x0f,
+    0xc2, 0xec, 0x01, 0xf8, 0x79, 0x00, 0x31, 0x7f, 0x80, 0x3a, 0xfd, 0x80, 0x26, 0x00, 0x85, 0x00,
+    0x31, 0x50, 0x04, 0xc2, 0x20, 0x09, 0x4c, 0x40, 0x16, 0xe0, 0x1b, 0x05, 0x80, 0x8e, 0x80, 0x33,
+    0xba, 0x82, 0x84, 0xc0, 0x3a, 0x88, 0x8a, 0xc0, 0x1e, 0x32, 0x82, 0xa0, 0x0f, 0xa9, 0x4c, 0x80,
+    0x3e, 0x60, 0xa0, 0x0c, 0x00, 0x00, 0xc5, 0xc6, 0x01, 0xf8, 0xdc, 0x80, 0x3f, 0x0c, 0x88, 0x06,
+    0x3f, 0x5d, 0xd2, 0xab, 0x79, 0xc0, 0x2e, 0x97, 0xa9, 0x93, 0xc1, 0x00, 0x21, 0x20, 0x21, 0x20,
+    0x1c, 0x00, 0x40, 0x60, 0xe0, 0x20, 0x1f, 0xfd, 0x70, 0x2f, 0xf0, 0x07, 0x5f, 0xb0, 0x04, 0xc0,
+    0x10, 0xa0, 0x06, 0x2a, 0x00, 0x98, 0x44, 0x01, 0x29, 0x88, 0x02, 0xdc, 0x03, 0x60, 0xb0, 0x11,
+    0xd0, 0x06, 0x77, 0x50, 0x50, 0x98, 0x07, 0x51, 0x11, 0x58, 0x03, 0xc6, 0x50, 0x54, 0x01, 0xf5,
+    0x29, 0x90, 0x07, 0xcc, 0x14, 0x01, 0x8b, 0xcc, 0x07, 0xd8, 0x01, 0xcc, 0x01, 0xd2, 0x40, 0x1f,
+    0x85, 0xdc, 0x01, 0x80, 0x3f, 0x5d, 0xd2, 0xab, 0x79, 0xc0, 0x2e, 0x97, 0xa9, 0x93, 0xc1, 0x00,
+    0x21, 0x20, 0x21, 0x20, 0x1c, 0x00, 0x40, 0x60, 0xe0, 0x20, 0x1f, 0xfd, 0x73, 0xf1, 0x01, 0xf3,
+    0x00, 0x7a, 0x80, 0x61, 0x91, 0x00, 0xfc, 0x6e, 0x40, 0x18, 0x00, 0xd2, 0x40, 0x1e, 0x17, 0x60,
+    0x0f, 0x0f, 0x20, 0x04, 0x5f, 0x60, 0x1b, 0xd8, 0x00, 0x8a, 0x01, 0xf1, 0xd8, 0x07, 0xd2, 0x10,
+    0x01, 0xe1, 0x87, 0x20, 0x0f, 0x31, 0x48, 0x07, 0xdc, 0x88, 0x00, 0xf1, 0xac, 0x80, 0x7d, 0x64,
+    0x01, 0xf0, 0xc0, 0x00, 0x00, 0x0f, 0x20, 0x06, 0x17, 0x60, 0x0e, 0x92, 0x00, 0x1f, 0xae, 0xf4,
+    0x00, 0x53, 0x0e, 0xe4, 0x00, 0x72, 0xc8, 0x98, 0x00, 0xc0, 0x05, 0xe0, 0x1f, 0xfc, 0x90, 0x2f,
+    0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec, 0x03, 0xe9, 0x08, 0x00, 0xf0, 0xc3, 0x90, 0x07,
+    0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6, 0x40, 0x3e, 0xb2, 0x00, 0xf8, 0x60, 0x00, 0x5e,
+    0x80, 0x13, 0xfb, 0x00, 0x69, 0x20, 0x0f, 0x0b, 0xb8, 0x02, 0x00, 0x3f, 0x5d, 0xe8, 0x00, 0xa6,
+    0x1d, 0xc8, 0x00, 0xe5, 0x91, 0x30, 0x01, 0x80, 0x0b, 0xc0, 0x3f, 0xf9, 0x27, 0xe2, 0x00, 0xc8,
+    0x00, 0xa4, 0x80, 0x30, 0xbb, 0x00, 0x00, 0x2f, 0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec,
+    0x03, 0xe9, 0x08, 0x00, 0xf0, 0xc3, 0x90, 0x07, 0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6,
+    0x40, 0x3e, 0xb2, 0x00, 0xf8, 0x60, 0x00, 0x5e, 0x80, 0x13, 0xfb, 0x00, 0x07, 0xba, 0x60, 0x0c,
+    0x3f, 0xf3, 0x00, 0x00, 0x3f, 0x5d, 0xe8, 0x00, 0xa6, 0x1d, 0xc8, 0x00, 0xe5, 0x91, 0x30, 0x01,
+    0x80, 0x0b, 0xc0, 0x3f, 0xf9, 0x27, 0xe2, 0x00, 0xc8, 0x02, 0xee, 0x98, 0x00, 0x5f, 0xf3, 0x00,
+    0x2f, 0xb0, 0x0d, 0xec, 0x00, 0x45, 0x00, 0xf8, 0xec, 0x03, 0xe9, 0x08, 0x00, 0xf0, 0xc3, 0x90,
+    0x07, 0x98, 0xa4, 0x03, 0xee, 0x44, 0x00, 0x78, 0xd6, 0x40, 0x3e, 0xb2, 0x00, 0xf8, 0x60, 0x00,
+    0x5e, 0x80, 0x13, 0xfb, 0x00, 0x49, 0xb0, 0x01, 0xc5, 0x5c, 0xaa, 0x00, 0x00, 0x3f, 0x5d, 0xe8,
+    0x00, 0xa6, 0x1d, 0xc8, 0x00, 0xe5, 0x91, 0x30, 0x01, 0x80, 0x0b, 0xc0, 0x3f, 0xf9, 0x27, 0xe2,
+    0x00, 0xc8, 0x00, 0x26, 0xb8, 0x04, 0x55, 0xd4, 0xa0, 0x00, 0x00, 0xeb, 0x30, 0x0f, 0x9c, 0x4c,
+    0x03, 0xe7, 0xa0, 0x0f, 0xab, 0xb8, 0xe0, 0x1e, 0xae, 0xe3, 0x80, 0x71, 0xdf, 0x6c, 0x88, 0x04,
+    0x98, 0x11, 0x49, 0xe2, 0x00, 0x95, 0xb6, 0x7c, 0x08, 0x03, 0x29, 0x00, 0x86, 0x58, 0x14, 0x0c,
+    0x03, 0x18, 0x10, 0x07, 0xf9, 0x40, 0x80, 0x31, 0x81, 0x19, 0x40, 0x04, 0x32, 0xa0, 0x09, 0x5b,
+    0x67, 0xc0, 0xb0, 0x02, 0x60, 0x45, 0x27, 0x88, 0x00, 0x00, 0x8b, 0x04, 0x03, 0x4d, 0x08, 0x06,
+    0xb6, 0x00, 0x87, 0x37, 0x48, 0x00, 0x1c, 0xdd, 0x20, 0x00, 0xaf, 0xf5, 0x40, 0x70, 0x72, 0xa8,
+    0x8e, 0x36, 0x6e, 0x5d, 0xc2, 0x10, 0x02, 0x37, 0x10, 0x80, 0x15, 0x9c, 0x6c, 0xdc, 0xf8, 0x75,
+    0xb2, 0xa8, 0x80, 0x00, 0x0b, 0x81, 0xa8, 0x07, 0x1c, 0x92, 0x70, 0x07, 0x17, 0x13, 0xd8, 0x07,
+    0xab, 0x74, 0xc0, 0x1e, 0xad, 0xd3, 0x00, 0x71, 0xdf, 0x6c, 0x88, 0x04, 0x98, 0x11, 0x49, 0xe2,
+    0x00, 0x95, 0xb6, 0x7c, 0x08, 0x03, 0x29, 0x00, 0x86, 0x58, 0x14, 0x0c, 0x03, 0x18, 0x10, 0x07,
+    0xf9, 0x40, 0x80, 0x31, 0x81, 0x19, 0x40, 0x04, 0x32, 0xa0, 0x09, 0x5b, 0x67, 0xc0, 0xb0, 0x02,
+    0x60, 0x45, 0x27, 0x88, 0x00, 0x02, 0x60, 0x53, 0x00, 0x3d, 0x87, 0x58, 0x01, 0x74, 0x2e, 0x00,
+    0x03, 0x9b, 0xa4, 0x00, 0x0e, 0x6e, 0x90, 0x00, 0x57, 0xfa, 0xa0, 0x38, 0x39, 0x54, 0x47, 0x1b,
+    0x37, 0x2e, 0xe1, 0x08, 0x01, 0x1b, 0x88, 0x40, 0x0a, 0xce, 0x36, 0x6e, 0x7c, 0x3a, 0xd9, 0x54,
+    0x40, 0x00, 0xa2, 0x00, 0x1f, 0xa5, 0x88, 0x03, 0xe1, 0xe2, 0x00, 0xfb, 0x7b, 0x92, 0x01, 0xec,
+    0xff, 0x48, 0x07, 0x1d, 0x7e, 0x48, 0x80, 0x49, 0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b, 0x67, 0xc0,
+    0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31, 0x81, 0x00, 0x7f, 0x94, 0x08, 0x03, 0x18,
+    0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6, 0x7c, 0x0b, 0x00, 0x26, 0x04, 0x52, 0x78, 0x80,
+    0x00, 0x5a, 0x80, 0x74, 0x40, 0x03, 0x8f, 0x40, 0x31, 0x77, 0x4c, 0x00, 0x2f, 0xf9, 0x80, 0x05,
+    0x5d, 0x8a, 0x03, 0x83, 0x95, 0x44, 0x71, 0xb3, 0x72, 0xee, 0x10, 0x80, 0x11, 0xb8, 0x84, 0x00,
+    0xac, 0xe3, 0x66, 0xe7, 0xc3, 0xad, 0x95, 0x44, 0x00, 0x00, 0xeb, 0x40, 0x0f, 0x98, 0x10, 0x03,
+    0xe6, 0xb0, 0x0f, 0xb7, 0xb9, 0x20, 0x1e, 0xcf, 0xf4, 0x80, 0x71, 0xd7, 0xe4, 0x88, 0x04, 0x98,
+    0x11, 0x49, 0xe2, 0x00, 0x95, 0xb6, 0x7c, 0x08, 0x03, 0x29, 0x00, 0x86, 0x58, 0x14, 0x0c, 0x03,
+    0x18, 0x10, 0x07, 0xf9, 0x40, 0x80, 0x31, 0x81, 0x19, 0x40, 0x04, 0x32, 0xa0, 0x09, 0x5b, 0x67,
+    0xc0, 0xb0, 0x02, 0x60, 0x45, 0x27, 0x88, 0x00, 0x00, 0x8b, 0x08, 0x03, 0x45, 0x90, 0x06, 0xa7,
+    0x00, 0x8b, 0xba, 0x60, 0x01, 0x7f, 0xcc, 0x00, 0x2a, 0xec, 0x50, 0x1c, 0x1c, 0xaa, 0x23, 0x8d,
+    0x9b, 0x97, 0x70, 0x84, 0x00, 0x8d, 0xc4, 0x20, 0x05, 0x67, 0x1b, 0x37, 0x3e, 0x1d, 0x6c, 0xaa,
+    0x20, 0x00, 0xdc, 0xc0, 0x1c, 0xaa, 0x60, 0x01, 0x7f, 0xa9, 0x31, 0x00, 0x28, 0xca, 0x7b, 0x30,
+    0x01, 0x99, 0x6c, 0xac, 0x03, 0xc2, 0x20, 0x0e, 0x63, 0xd0, 0x05, 0xff, 0xa6, 0x10, 0x01, 0x39,
+    0xbe, 0xe0, 0x11, 0x19, 0x00, 0x7f, 0xf1, 0xc0, 0x00, 0xd9, 0x20, 0x1c, 0x63, 0x20, 0x1c, 0x7a,
+    0x01, 0x1f, 0xae, 0xf4, 0x80, 0x69, 0x95, 0xbc, 0x00, 0x5e, 0x8b, 0x2c, 0x01, 0x18, 0x00, 0x84,
+    0x02, 0x30, 0x01, 0x08, 0x05, 0xe8, 0xb2, 0xc0, 0x14, 0xca, 0xde, 0x00, 0x24, 0xde, 0x90, 0x0f,
+    0xfe, 0x30, 0x00, 0x99, 0x40, 0x3d, 0x98, 0x00, 0xf5, 0x48, 0x04, 0x5f, 0xfb, 0x10, 0x02, 0x8c,
+    0xa7, 0xb3, 0x00, 0x19, 0x96, 0xca, 0xc0, 0x3c, 0x22, 0x00, 0xe6, 0x3d, 0x00, 0x5f, 0xfa, 0x61,
+    0x00, 0x13, 0x9b, 0xee, 0x01, 0x11, 0x90, 0x07, 0xff, 0x1c, 0x00, 0xa2, 0xc0, 0x3d, 0xb8, 0x01,
+    0xe5, 0x70, 0x08, 0xfd, 0x77, 0xa4, 0x03, 0x4c, 0xad, 0xe0, 0x02, 0xf4, 0x59, 0x60, 0x08, 0xc0,
+    0x04, 0x20, 0x11, 0x80, 0x08, 0x40, 0x2f, 0x45, 0x96, 0x00, 0xa6, 0x56, 0xf0, 0x01, 0x26, 0xf4,
+    0x80, 0x7f, 0xf1, 0x80, 0x00, 0x91, 0xc0, 0x3d, 0x96, 0x01, 0xe8, 0xc0, 0x08, 0xbf, 0xf6, 0xa8,
+    0x05, 0x19, 0x6f, 0x48, 0x00, 0x33, 0x25, 0x1f, 0x00, 0x79, 0xc0, 0x3c, 0xa9, 0xe0, 0x0b, 0xff,
+    0x54, 0x28, 0x02, 0x72, 0x01, 0x40, 0x22, 0x37, 0x18, 0x00, 0xf4, 0x29, 0x00, 0x73, 0x0c, 0x00,
+    0x03, 0xe2, 0x00, 0x13, 0x90, 0x00, 0x64, 0x00, 0x7e, 0xfc, 0x40, 0x0c, 0xa2, 0x00, 0x42, 0x00,
+    0x44, 0x01, 0xff, 0xc5, 0x00, 0x2f, 0xfd, 0xaa, 0x01, 0x46, 0x5b, 0xd2, 0x00, 0x0c, 0xc9, 0x47,
+    0xc0, 0x1e, 0x70, 0x0f, 0x2a, 0x78, 0x02, 0xff, 0xd5, 0x0a, 0x00, 0x9c, 0x80, 0x50, 0x08, 0x8d,
+    0xc6, 0x00, 0x3d, 0x0a, 0x40, 0x1c, 0xc3, 0x05, 0xe8, 0x01, 0x75, 0x00, 0x48, 0xe0, 0x1e, 0x3b,
+    0x00, 0x80, 0x3f, 0x7e, 0x20, 0x06, 0x51, 0x00, 0x21, 0x00, 0x22, 0x00, 0xff, 0xe2, 0x9f, 0x88,
+    0x00, 0x64, 0x02, 0x27, 0x10, 0x00, 0x00, 0x4f, 0x73, 0x00, 0x34, 0xff, 0xb4, 0x00, 0x5f, 0xee,
+    0xe6, 0x28, 0x05, 0x19, 0x6f, 0x48, 0x00, 0x33, 0x25, 0x1f, 0x00, 0x79, 0xc0, 0x3c, 0xa9, 0xe0,
+    0x0b, 0xff, 0x54, 0x28, 0x02, 0x72, 0x01, 0x40, 0x22, 0x37, 0x18, 0x00, 0xf4, 0x29, 0x00, 0x73,
+    0x0c, 0x17, 0xa0, 0x05, 0xd4, 0x01, 0x23, 0x80, 0x78, 0xec, 0x02, 0x00, 0x4e, 0xe8, 0xd3, 0xfe,
+    0x33, 0x73, 0x79, 0x00, 0x32, 0x88, 0x01, 0x08, 0x01, 0x10, 0x07, 0xff, 0x14, 0xfc, 0x40, 0x03,
+    0x20, 0x11, 0x38, 0x80, 0x00, 0x2f, 0xfd, 0xaa, 0x01, 0x46, 0x5b, 0xd2, 0x00, 0x0c, 0xc9, 0x47,
+    0xc0, 0x1e, 0x70, 0x0f, 0x2a, 0x78, 0x02, 0xff, 0xd5, 0x0a, 0x00, 0x9c, 0x80, 0x50, 0x08, 0x8d,
+    0xc6, 0x00, 0x3d, 0x0a, 0x40, 0x1c, 0xc3, 0x05, 0xe8, 0x01, 0x75, 0x00, 0x23, 0xb9, 0xa0, 0x1a,
+    0x3f, 0xd8, 0x00, 0x00, 0x03, 0xf7, 0xe2, 0x00, 0xb2, 0x88, 0x02, 0x84, 0x00, 0xc4, 0x01, 0xff,
+    0xc9, 0x3f, 0x10, 0x02, 0xf7, 0x44, 0x0b, 0xff, 0x10, 0x00, 0x00, 0x95, 0x80, 0x3d, 0x98, 0x00,
+    0xf4, 0xd0, 0x06, 0x2b, 0xee, 0x59, 0x00, 0x31, 0xe2, 0x0d, 0x80, 0x83, 0xcc, 0xce, 0x14, 0x70,
+    0xa0, 0x01, 0xfa, 0x1b, 0xbb, 0xa9, 0x40, 0x28, 0xd9, 0x1a, 0xd1, 0x24, 0x27, 0xbd, 0x29, 0x4b,
+    0x10, 0x01, 0x10, 0x5c, 0x75, 0x55, 0x45, 0x43, 0x8d, 0x74, 0xd6, 0x60, 0x00, 0x3e, 0x00, 0x63,
+    0x40, 0x0c, 0x90, 0x01, 0x47, 0x7d, 0x0a, 0x3d, 0xe3, 0xc3, 0x80, 0x0f, 0xec, 0xe6, 0x3e, 0x44,
+    0x4b, 0xba, 0x0f, 0x4c, 0x50, 0x09, 0x5e, 0xf5, 0xf8, 0x02, 0xbe, 0xe5, 0x90, 0x03, 0x1e, 0x20,
+    0xd8, 0x08, 0x3c, 0xcc, 0xe1, 0x47, 0x0a, 0x00, 0x1f, 0xa1, 0xbb, 0xba, 0x94, 0x02, 0x8d, 0x91,
+    0xad, 0x12, 0x42, 0x7b, 0xd2, 0x94, 0xb1, 0x00, 0x11, 0x05, 0xc7, 0x55, 0x54, 0x54, 0x38, 0xd7,
+    0x4d, 0x66, 0x05, 0x5d, 0xf8, 0x80, 0x19, 0x5c, 0x03, 0xdb, 0x80, 0x10, 0x08, 0xef, 0xa1, 0x47,
+    0xbc, 0x78, 0x70, 0x01, 0xfd, 0x9c, 0xc7, 0xc8, 0x89, 0x77, 0x41, 0xe9, 0x8a, 0x01, 0x2b, 0xde,
+    0xbf, 0x04, 0x77, 0xe1, 0x00, 0x11, 0xc0, 0x31, 0xd0, 0x00, 0x00, 0xff, 0x4e, 0x00, 0x7a, 0x3a,
+    0xe0, 0x03, 0x09, 0x94, 0x00, 0x45, 0x7e, 0xf6, 0x40, 0x0c, 0x78, 0x83, 0x60, 0x20, 0xf3, 0x33,
+    0x85, 0x1c, 0x28, 0x00, 0x7e, 0x86, 0xee, 0xea, 0x50, 0x0a, 0x36, 0x46, 0xb4, 0x49, 0x09, 0xef,
+    0x4a, 0x52, 0xc4, 0x00, 0x44, 0x17, 0x1d, 0x55, 0x51, 0x50, 0xe3, 0x5d, 0x35, 0x98, 0x00, 0x36,
+    0x00, 0x64, 0x90, 0x0c, 0x5f, 0xa2, 0x00, 0x34, 0xf1, 0x00, 0x1f, 0x10, 0x02, 0x3b, 0xe8, 0x51,
+    0xef, 0x1e, 0x1c, 0x00, 0x7f, 0x67, 0x31, 0xf2, 0x22, 0x5d, 0xd0, 0x7a, 0x62, 0x80, 0x4a, 0xf7,
+    0xaf, 0xc0, 0x00, 0x91, 0x40, 0x3d, 0xbe, 0x01, 0xd1, 0xb3, 0x20, 0x0d, 0x54, 0xea, 0x00, 0xc5,
+    0xf8, 0x60, 0x11, 0x5f, 0xfa, 0xc8, 0x01, 0x8f, 0x10, 0x6c, 0x04, 0x1e, 0x66, 0x70, 0xa3, 0x85,
+    0x00, 0x0f, 0xd0, 0xdd, 0xdd, 0x4a, 0x01, 0x46, 0xc8, 0xd6, 0x89, 0x21, 0x3d, 0xe9, 0x4a, 0x58,
+    0x80, 0x08, 0x82, 0xe3, 0xaa, 0xaa, 0x2a, 0x1c, 0x6b, 0xa6, 0xb3, 0x00, 0x00, 0x1b, 0x80, 0x65,
+    0xb0, 0x0a, 0x32, 0x34, 0x01, 0x0d, 0x5c, 0x01, 0x67, 0x18, 0x02, 0x3b, 0xe8, 0x51, 0xef, 0x1e,
+    0x1c, 0x00, 0x7f, 0x67, 0x31, 0xf2, 0x22, 0x5d, 0xd0, 0x7a, 0x62, 0x80, 0x4a, 0xf7, 0xaf, 0xc0,
+    0x00, 0x95, 0x80, 0x3d, 0x98, 0x00, 0xf4, 0xd0, 0x06, 0x2b, 0xee, 0x59, 0x00, 0x31, 0xe2, 0x0d,
+    0x80, 0x83, 0xcc, 0xce, 0x14, 0x70, 0xa0, 0x01, 0xfa, 0x1b, 0xbb, 0xa9, 0x40, 0x28, 0xd9, 0x1a,
+    0xd1, 0x24, 0x27, 0xbd, 0x29, 0x4b, 0x10, 0x01, 0x10, 0x5c, 0x75, 0x55, 0x45, 0x43, 0x8d, 0x74,
+    0xd6, 0x60, 0x55, 0xdf, 0x88, 0x01, 0x95, 0xc0, 0x3d, 0xb8, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x63,
+    0x40, 0x0c, 0x90, 0x01, 0x47, 0x7d, 0x0a, 0x3d, 0xe3, 0xc3, 0x80, 0x0f, 0xec, 0xe6, 0x3e, 0x44,
+    0x4b, 0xba, 0x0f, 0x4c, 0x50, 0x09, 0x5e, 0xf5, 0xf8, 0x23, 0xbf, 0x08, 0x00, 0x8e, 0x01, 0x8e,
+    0x80, 0x00, 0x00, 0x95, 0x80, 0x3d, 0x98, 0x00, 0xf4, 0xd0, 0x05, 0x5f, 0xfe, 0xb8, 0xbb, 0x19,
+    0xae, 0xd0, 0x48, 0x86, 0x74, 0x41, 0x80, 0x7f, 0xfb, 0x00, 0x06, 0x50, 0x06, 0x60, 0x01, 0x52,
+    0x00, 0x98, 0x00, 0x10, 0x87, 0x23, 0x7f, 0x8d, 0x78, 0x5c, 0xc4, 0x03, 0xf8, 0x54, 0x82, 0x43,
+    0x40, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a, 0x20, 0xc0, 0x3f, 0xfd, 0xf5,
+    0x60, 0x1e, 0x56, 0x00, 0xf6, 0x60, 0x02, 0x00, 0x05, 0x40, 0x07, 0x68, 0x72, 0x37, 0xf8, 0xd7,
+    0x85, 0xcc, 0x40, 0x3f, 0x85, 0x48, 0x24, 0x34, 0x0f, 0x3c, 0x01, 0x22, 0x04, 0xe4, 0x00, 0xaf,
+    0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a, 0x20, 0xc0, 0x3f, 0xfd, 0xf5, 0x60, 0x1d,
+    0x5d, 0xcb, 0x00, 0xd7, 0xfe, 0xa0, 0x00, 0x05, 0x40, 0x0b, 0xb4, 0x01, 0xc8, 0xde, 0x1e, 0x6b,
+    0xc0, 0x2e, 0x62, 0x01, 0xff, 0xc0, 0x15, 0x20, 0x04, 0x86, 0x80, 0x0f, 0x3c, 0x0b, 0xba, 0x52,
+    0xff, 0x94, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a, 0x20, 0xc0, 0x3f, 0xfd,
+    0xf5, 0x60, 0x1e, 0xbc, 0x00, 0xea, 0x3b, 0xb0, 0x00, 0x05, 0x40, 0x0b, 0xb4, 0x01, 0xc8, 0xde,
+    0x1e, 0x6b, 0xc0, 0x2e, 0x62, 0x01, 0xff, 0xc0, 0x15, 0x20, 0x04, 0x86, 0x80, 0x0f, 0x3c, 0x00,
+    0xba, 0xc0, 0x57, 0xd6, 0x80, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc, 0x6e, 0x01, 0xc2, 0x41,
+    0x80, 0x13, 0x83, 0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28, 0x02, 0x6d, 0xfd, 0x70,
+    0x0c, 0x70, 0x0c, 0xa0, 0x19, 0x54, 0x1b, 0xa0, 0x00, 0x3f, 0x10, 0x06, 0x40, 0x07, 0xff, 0x1c,
+    0x40, 0x22, 0x00, 0x18, 0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x8c, 0x00, 0x9b, 0xd1, 0x90, 0x05,
+    0x20, 0xac, 0x00, 0x67, 0x1d, 0xc0, 0x00, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc, 0x6e, 0x01,
+    0xc2, 0x41, 0x80, 0x13, 0x83, 0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28, 0x02, 0x6d,
+    0xfd, 0x70, 0x0e, 0xc7, 0x66, 0x00, 0x64, 0x50, 0x84, 0x00, 0x00, 0x3f, 0x10, 0x06, 0x40, 0x07,
+    0xff, 0x1c, 0x40, 0x22, 0x00, 0x18, 0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x8c, 0x00, 0x9b, 0xd1,
+    0x90, 0x00, 0xb9, 0x48, 0x00, 0x10, 0x65, 0x60, 0x00, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc,
+    0x6e, 0x01, 0xc2, 0x41, 0x80, 0x13, 0x83, 0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28,
+    0x02, 0x6d, 0xfd, 0x70, 0x0e, 0x6e, 0x80, 0x0e, 0x28, 0xc5, 0x40, 0x00, 0x3f, 0x10, 0x06, 0x40,
+    0x07, 0xff, 0x1c, 0x40, 0x22, 0x00, 0x18, 0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x8c, 0x00, 0x9b,
+    0xd1, 0x90, 0x00, 0x4e, 0xa0, 0x08, 0x6b, 0x59, 0x80, 0x00, 0x00, 0xc7, 0x62, 0x01, 0xef, 0xe1,
+    0x00, 0xf6, 0x28, 0x07, 0x16, 0x76, 0x98, 0x06, 0x2c, 0xed, 0x30, 0x01, 0x79, 0x80, 0x43, 0xea,
+    0x01, 0xff, 0xe3, 0x70, 0x0e, 0x12, 0x0c, 0x00, 0x9c, 0x18, 0x1d, 0xd2, 0xb1, 0x2a, 0x41, 0x12,
+    0x94, 0xb1, 0x40, 0x00, 0x00, 0x8b, 0x04, 0x03, 0x4d, 0x08, 0x06, 0xb6, 0x00, 0x87, 0x37, 0x48,
+    0x00, 0x1c, 0xdd, 0x20, 0x1f, 0x88, 0x03, 0x20, 0x03, 0xff, 0x8e, 0x20, 0x11, 0x00, 0x0c, 0x0c,
+    0x21, 0x68, 0x40, 0x16, 0xd6, 0x46, 0x00, 0x00, 0x1b, 0x03, 0x18, 0x06, 0x5a, 0x0a, 0x40, 0x0c,
+    0xd8, 0x18, 0xe0, 0x18, 0xbb, 0xa5, 0x00, 0xc5, 0xff, 0x28, 0x00, 0xbc, 0xc4, 0x77, 0xa8, 0x07,
+    0xff, 0x8d, 0xc0, 0x38, 0x48, 0x30, 0x02, 0x70, 0x60, 0x77, 0x4a, 0xc4, 0xa9, 0x04, 0x4a, 0x52,
+    0xc5, 0x00, 0x02, 0x70, 0x64, 0x00, 0x25, 0x06, 0xe0, 0x01, 0xb4, 0x2e, 0x00, 0x05, 0xdd, 0x30,
+    0x00, 0xbf, 0xe6, 0x03, 0xf0, 0x11, 0x64, 0x00, 0x7f, 0xf1, 0xc4, 0x02, 0x20, 0x01, 0x81, 0x84,
+    0x2d, 0x08, 0x02, 0xda, 0xc8, 0xc0, 0x00, 0x26, 0xeb, 0x04, 0x03, 0x26, 0xeb, 0x04, 0x01, 0x78,
+    0x01, 0xde, 0xda, 0x62, 0x01, 0x28, 0x3b, 0x81, 0x80, 0x2f, 0x31, 0x12, 0x58, 0x04, 0xb4, 0x00,
+    0xe3, 0x10, 0x50, 0x70, 0x02, 0x83, 0x87, 0xa0, 0x80, 0x4b, 0x40, 0xba, 0x01, 0xbc, 0xd4, 0x1c,
+    0x03, 0x28, 0x5a, 0x08, 0x07, 0x28, 0xe8, 0x04, 0x00, 0x02, 0xe6, 0x93, 0x00, 0x24, 0x72, 0x98,
+    0x01, 0x99, 0x18, 0x00, 0xac, 0x00, 0xba, 0x38, 0xc4, 0x0c, 0x69, 0x05, 0x82, 0x8c, 0x81, 0xec,
+    0x1e, 0x80, 0x14, 0x6c, 0x2e, 0x00, 0x32, 0x85, 0x10, 0x0a, 0x87, 0x80, 0x00, 0xbc, 0x00, 0xef,
+    0x6d, 0x31, 0x00, 0x94, 0x1d, 0xc0, 0xc0, 0x17, 0x98, 0x89, 0x2c, 0x02, 0x5a, 0x00, 0x71, 0x88,
+    0x28, 0x38, 0x01, 0x41, 0xc3, 0xd0, 0x40, 0x25, 0xa0, 0x5d, 0x00, 0xde, 0x6a, 0x0e, 0x01, 0x94,
+    0x2d, 0x04, 0x03, 0x94, 0x74, 0x03, 0xd5, 0xec, 0x01, 0xe2, 0x90, 0x0f, 0x99, 0xc4, 0x02, 0x00,
+    0xac, 0x00, 0xba, 0x38, 0xc4, 0x0c, 0x69, 0x05, 0x82, 0x8c, 0x81, 0xec, 0x1e, 0x80, 0x14, 0x6c,
+    0x2e, 0x00, 0x32, 0x85, 0x10, 0x0a, 0x87, 0x80, 0x33, 0xfa, 0x00, 0x62, 0x90, 0x0e, 0x67, 0x10,
+    0x00, 0x00, 0xc7, 0xe4, 0x01, 0xfe, 0x37, 0xb0, 0x0f, 0x65, 0x00, 0x44, 0xc4, 0x00, 0x2f, 0x44,
+    0x80, 0x27, 0x04, 0x00, 0x20, 0x26, 0x09, 0x00, 0x92, 0x60, 0x03, 0x0c, 0x10, 0x10, 0x10, 0x75,
+    0x00, 0x0e, 0x80, 0x04, 0xc0, 0xc4, 0x40, 0x90, 0x96, 0x00, 0x31, 0x01, 0x30, 0x85, 0x10, 0x08,
+    0x00, 0x41, 0x22, 0x20, 0x27, 0xe1, 0x80, 0x46, 0x16, 0x24, 0x18, 0x8b, 0x60, 0x19, 0x19, 0x00,
+    0x08, 0x46, 0x80, 0x1b, 0x03, 0x00, 0x04, 0x20, 0x60, 0x00, 0x00, 0x9f, 0x40, 0x3f, 0x3b, 0x28,
+    0x07, 0xeb, 0x50, 0x0d, 0x76, 0x00, 0x5e, 0x00, 0x2b, 0x35, 0x00, 0x08, 0x62, 0x09, 0x6e, 0x06,
+    0x84, 0x68, 0x42, 0xa2, 0x69, 0x88, 0x8c, 0x52, 0x20, 0x26, 0x26, 0xe2, 0x62, 0x00, 0x2d, 0x0d,
+    0x10, 0x49, 0xa0, 0x03, 0x14, 0x00, 0x20, 0x20, 0x00, 0x00, 0xf4, 0xd8, 0x07, 0xf8, 0x5e, 0x80,
+    0x3b, 0x28, 0x02, 0xb1, 0x30, 0x01, 0x7a, 0x24, 0x01, 0x38, 0x20, 0x01, 0x01, 0x30, 0x48, 0x04,
+    0x93, 0x00, 0x18, 0x60, 0x80, 0x80, 0x83, 0xa8, 0x00, 0x74, 0x00, 0x26, 0x06, 0x22, 0x04, 0x84,
+    0xb0, 0x01, 0x88, 0x09, 0x84, 0x28, 0x80, 0x40, 0x02, 0x09, 0x11, 0x01, 0x3f, 0x0c, 0x02, 0x30,
+    0xb1, 0x20, 0xc4, 0x5b, 0x00, 0xc8, 0xc8, 0x00, 0x42, 0x34, 0x00, 0xd8, 0x18, 0x00, 0x21, 0x03,
+    0x00, 0x00, 0x00, 0xed, 0x80, 0x0f, 0x90, 0x60, 0x03, 0xe4, 0xc0, 0x0d, 0x76, 0x00, 0x5e, 0x00,
+    0x2b, 0x35, 0x00, 0x08, 0x62, 0x09, 0x6e, 0x06, 0x84, 0x68, 0x42, 0xa2, 0x69, 0x88, 0x8c, 0x52,
+    0x20, 0x26, 0x26, 0xe2, 0x62, 0x00, 0x2d, 0x0d, 0x10, 0x49, 0xa0, 0x03, 0x14, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0xcc, 0x81, 0x04, 0x01, 0xfb, 0x70, 0x59, 0x80, 0x1f, 0xae, 0x07, 0x90, 0x03, 0x65,
+    0x00, 0x55, 0xe4, 0x00, 0x2f, 0x44, 0x80, 0x27, 0x04, 0x00, 0x20, 0x26, 0x09, 0x00, 0x92, 0x60,
+    0x03, 0x0c, 0x10, 0x10, 0x10, 0x75, 0x00, 0x0e, 0x80, 0x04, 0xc0, 0xc4, 0x40, 0x90, 0x96, 0x00,
+    0x31, 0x01, 0x30, 0x85, 0x10, 0x08, 0x00, 0x41, 0x22, 0x20, 0x27, 0xe1, 0x80, 0x46, 0x16, 0x24,
+    0x18, 0x8b, 0x60, 0x19, 0x19, 0x00, 0x08, 0x46, 0x80, 0x1b, 0x03, 0x00, 0x04, 0x20, 0x60, 0x00,
+    0x00, 0xb9, 0x53, 0x84, 0x03, 0x99, 0xd9, 0xc4, 0x03, 0xa0, 0x89, 0x20, 0x15, 0xd8, 0x01, 0x78,
+    0x00, 0xac, 0xd4, 0x00, 0x21, 0x88, 0x25, 0xb8, 0x1a, 0x11, 0xa1, 0x0a, 0x89, 0xa6, 0x22, 0x31,
+    0x48, 0x80, 0x98, 0x9b, 0x89, 0x88, 0x00, 0xb4, 0x34, 0x41, 0x26, 0x80, 0x0c, 0x50, 0x00, 0x80,
+    0x80, 0x00, 0x00, 0xe3, 0x80, 0x0f, 0xf9, 0x54, 0x01, 0xff, 0x36, 0x80, 0x7b, 0x28, 0x02, 0xaf,
+    0x20, 0x01, 0x7a, 0x24, 0x01, 0x38, 0x20, 0x01, 0x01, 0x30, 0x48, 0x04, 0x93, 0x00, 0x18, 0x60,
+    0x80, 0x80, 0x83, 0xa8, 0x00, 0x74, 0x00, 0x26, 0x06, 0x22, 0x04, 0x84, 0xb0, 0x01, 0x88, 0x09,
+    0x84, 0x28, 0x80, 0x40, 0x02, 0x09, 0x11, 0x01, 0x3f, 0x0c, 0x02, 0x30, 0xb1, 0x20, 0xc4, 0x5b,
+    0x00, 0xc8, 0xc8, 0x00, 0x42, 0x34, 0x00, 0xd8, 0x18, 0x00, 0x21, 0x03, 0x00, 0x00, 0x00, 0xd3,
+    0x40, 0x1f, 0xb3, 0x00, 0x1f, 0x95, 0x80, 0x35, 0xd8, 0x01, 0x78, 0x00, 0xac, 0xd4, 0x00, 0x21,
+    0x88, 0x25, 0xb8, 0x1a, 0x11, 0xa1, 0x0a, 0x89, 0xa6, 0x22, 0x31, 0x48, 0x80, 0x98, 0x9b, 0x89,
+    0x88, 0x00, 0xb4, 0x34, 0x41, 0x26, 0x80, 0x0c, 0x50, 0x00, 0x80, 0x80, 0x00, 0xca, 0x00, 0xab,
+    0xc8, 0x00, 0x5e, 0x89, 0x00, 0x4e, 0x08, 0x00, 0x40, 0x4c, 0x12, 0x01, 0x24, 0xc0, 0x06, 0x18,
+    0x20, 0x20, 0x20, 0xea, 0x00, 0x1d, 0x00, 0x09, 0x81, 0x88, 0x81, 0x21, 0x2c, 0x00, 0x62, 0x02,
+    0x61, 0x0a, 0x20, 0x10, 0x00, 0x82, 0x44, 0x40, 0x4f, 0xc3, 0x00, 0x8c, 0x2c, 0x48, 0x31, 0x16,
+    0xc0, 0x32, 0x32, 0x00, 0x10, 0x8d, 0x00, 0x36, 0x06, 0x00, 0x08, 0x40, 0xc0, 0x33, 0xfb, 0x00,
+    0x5d, 0xe0, 0x1f, 0x8e, 0x00, 0x3f, 0xe5, 0x50, 0x07, 0x80, 0xbb, 0x00, 0x2f, 0x00, 0x15, 0x9a,
+    0x80, 0x04, 0x31, 0x04, 0xb7, 0x03, 0x42, 0x34, 0x21, 0x51, 0x34, 0xc4, 0x46, 0x29, 0x10, 0x13,
+    0x13, 0x71, 0x31, 0x00, 0x16, 0x86, 0x88, 0x24, 0xd0, 0x01, 0x8a, 0x00, 0x10, 0x10, 0x02, 0xeb,
+    0x00, 0x5f, 0x80, 0x79, 0x58, 0x03, 0xf6, 0x60, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x3e, 0x65, 0x00,
+    0xf9, 0x74, 0x03, 0x27, 0xa0, 0x05, 0x5c, 0x08, 0xb4, 0x00, 0x45, 0xa0, 0x05, 0x84, 0x85, 0x2a,
+    0x00, 0x06, 0x1a, 0xc2, 0xc0, 0x33, 0x22, 0x2c, 0x40, 0x39, 0x83, 0x00, 0x3a, 0x0e, 0x18, 0xc0,
+    0x23, 0x7b, 0x74, 0xe0, 0x0b, 0x91, 0x42, 0x4a, 0x02, 0x0a, 0x80, 0x05, 0x0e, 0x40, 0x00, 0x27,
+    0x08, 0x06, 0x67, 0x10, 0x0c, 0x52, 0x01, 0x2f, 0x90, 0x2f, 0x92, 0xab, 0x86, 0xe4, 0x82, 0xcb,
+    0x15, 0x80, 0x02, 0xc5, 0xe0, 0x11, 0x39, 0xc8, 0x05, 0xcb, 0x87, 0x00, 0xe5, 0x61, 0x4e, 0x60,
+    0x00, 0x32, 0x84, 0x10, 0x06, 0xcc, 0x03, 0x38, 0x06, 0xa9, 0x0e, 0x50, 0x02, 0x7a, 0x00, 0x55,
+    0xc0, 0x8b, 0x40, 0x04, 0x5a, 0x00, 0x58, 0x48, 0x52, 0xa0, 0x00, 0x61, 0xac, 0x2c, 0x03, 0x32,
+    0x22, 0xc4, 0x03, 0x98, 0x30, 0x03, 0xa0, 0xe1, 0x8c, 0x02, 0x37, 0xb7, 0x4e, 0x00, 0xb9, 0x14,
+    0x24, 0xa0, 0x20, 0xa8, 0x00, 0x50, 0xe4, 0x00, 0x09, 0xa0, 0xd5, 0x00, 0x67, 0x82, 0xb0, 0x01,
+    0x54, 0x10, 0x60, 0xbe, 0x40, 0xbe, 0x4a, 0xae, 0x1b, 0x92, 0x0b, 0x2c, 0x56, 0x00, 0x0b, 0x17,
+    0x80, 0x44, 0xe7, 0x20, 0x17, 0x2e, 0x1c, 0x03, 0x95, 0x85, 0x39, 0x80, 0x00, 0x8e, 0x00, 0x3e,
+    0x65, 0x00, 0xf9, 0x74, 0x03, 0x4f, 0x08, 0x04, 0xfe, 0x50, 0x10, 0x00, 0x19, 0x62, 0x19, 0x62,
+    0x08, 0x08, 0x00, 0x39, 0x49, 0x34, 0x08, 0x05, 0x29, 0xe4, 0xc0, 0x19, 0x10, 0x52, 0x01, 0xed,
+    0x04, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x27, 0x08, 0x06, 0x67, 0x10, 0x0c, 0x52, 0x01, 0x56, 0x00,
+    0x5d, 0x1c, 0x62, 0x06, 0x34, 0x82, 0xe1, 0x46, 0x40, 0xf4, 0x0f, 0x40, 0x0a, 0x35, 0x17, 0x00,
+    0x19, 0x5a, 0x08, 0x05, 0x43, 0xc0, 0x18, 0x41, 0x40, 0x23, 0xb7, 0x00, 0x8b, 0x1a, 0x00, 0x20,
+    0x00, 0x99, 0x80, 0x1c, 0xb7, 0x4a, 0x01, 0x8f, 0xf8, 0x80, 0x0f, 0xf3, 0xba, 0x8f, 0xa6, 0xbb,
+    0xd0, 0x18, 0x28, 0x92, 0xca, 0xb0, 0x06, 0xa0, 0xb0, 0x0c, 0xe9, 0xa2, 0x01, 0x1c, 0x40, 0xc0,
+    0x37, 0x23, 0x80, 0x6a, 0x3a, 0x00, 0xcc, 0xac, 0xa8, 0x91, 0x60, 0x3d, 0xde, 0x90, 0x00, 0x67,
+    0x18, 0x02, 0x16, 0xbc, 0x01, 0x12, 0x98, 0x0d, 0xff, 0xb1, 0xb7, 0x56, 0x14, 0x04, 0x48, 0x46,
+    0x00, 0x41, 0x50, 0x01, 0x1f, 0x44, 0x06, 0x98, 0x48, 0x8e, 0x2d, 0xba, 0xe0, 0x7f, 0xff, 0x53,
+    0x5d, 0xe8, 0x0c, 0x14, 0x49, 0x65, 0x58, 0x03, 0x50, 0x58, 0x06, 0x74, 0xd1, 0x00, 0x8e, 0x20,
+    0x60, 0x1b, 0x91, 0xc0, 0x35, 0x1d, 0x00, 0x66, 0x56, 0x54, 0x48, 0xb0, 0x1e, 0xef, 0x4d, 0x7f,
+    0xfa, 0xc0, 0x25, 0x60, 0x0f, 0x66, 0x00, 0x20, 0x6f, 0xfd, 0x8d, 0xba, 0xb0, 0xa0, 0x22, 0x42,
+    0x30, 0x02, 0x0a, 0x80, 0x08, 0xfa, 0x20, 0x34, 0xc2, 0x44, 0x71, 0x6d, 0xd7, 0x37, 0xfe, 0xc0,
+    0x01, 0xc0, 0x06, 0x45, 0x00, 0x00, 0x7f, 0xff, 0x53, 0x5d, 0xe8, 0x0c, 0x14, 0x49, 0x65, 0x58,
+    0x03, 0x50, 0x58, 0x06, 0x74, 0xd1, 0x00, 0x8e, 0x20, 0x60, 0x1b, 0x91, 0xc0, 0x35, 0x1d, 0x00,
+    0x66, 0x56, 0x54, 0x48, 0xb0, 0x1e, 0xef, 0x4d, 0x7f, 0xfa, 0xc0, 0x15, 0xdc, 0xb0, 0x0d, 0x7f,
+    0xea, 0x00, 0x00, 0x6f, 0xfd, 0x8d, 0xba, 0xb0, 0xa0, 0x22, 0x42, 0x30, 0x02, 0x0a, 0x80, 0x08,
+    0xfa, 0x20, 0x34, 0xc2, 0x44, 0x71, 0x6d, 0xd7, 0x37, 0xfe, 0xc0, 0x8e, 0xe8, 0x01, 0x1f, 0xf0,
+    0x00, 0x3f, 0x10, 0x0f, 0xfe, 0x43, 0xef, 0x40, 0x05, 0x50, 0xee, 0x40, 0x07, 0x2c, 0x89, 0x80,
+    0x0c, 0x00, 0x5e, 0x01, 0xff, 0xc9, 0x3f, 0x10, 0x06, 0x40, 0x17, 0x74, 0xc0, 0x02, 0xff, 0x98,
+    0x00, 0x09, 0x22, 0x40, 0x0b, 0xb3, 0xb0, 0x0f, 0x22, 0xf0, 0x05, 0x30, 0x01, 0x88, 0x40, 0x2e,
+    0x46, 0xf0, 0x07, 0x9a, 0xf0, 0x00, 0x5c, 0xc4, 0x03, 0xff, 0x86, 0x2a, 0x40, 0x14, 0x86, 0x80,
+    0x00, 0xd7, 0x61, 0x00, 0xf2, 0x9e, 0x38, 0x07, 0xde, 0x01, 0xf9, 0x73, 0x0e, 0x01, 0x5d, 0x80,
+    0x27, 0x10, 0xac, 0xd4, 0x00, 0x21, 0x88, 0x25, 0xb8, 0x1a, 0x11, 0xa1, 0x0a, 0x89, 0xa6, 0x22,
+    0x31, 0x48, 0x80, 0x98, 0x9b, 0x89, 0x88, 0x00, 0xb4, 0x34, 0x41, 0x26, 0x80, 0x0c, 0x50, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x46, 0x28, 0x04, 0x29, 0xb0, 0x01, 0x0a, 0x6c, 0x00, 0x2b, 0x23, 0x17,
+    0xa3, 0x8c, 0x40, 0xc6, 0x90, 0x5c, 0x28, 0xc8, 0x1e, 0x81, 0xe8, 0x01, 0x46, 0xa2, 0xe0, 0x03,
+    0x2b, 0x41, 0x00, 0xa8, 0x78, 0x03, 0x08, 0x28, 0x04, 0x76, 0xe0, 0x11, 0x63, 0x40, 0x04, 0x00,
+    0x00, 0x0d, 0x00, 0x70, 0x9a, 0x00, 0x7f, 0xc2, 0x68, 0x01, 0x2e, 0x2e, 0x18, 0x15, 0x2e, 0x36,
+    0x81, 0xe4, 0x16, 0x88, 0xd5, 0xdf, 0x60, 0x06, 0x66, 0xf4, 0x00, 0x67, 0x38, 0x00, 0x32, 0xdf,
+    0x58, 0x00, 0x07, 0x40, 0x06, 0x60, 0x01, 0x70, 0x00, 0x8e, 0x72, 0x7b, 0x71, 0x04, 0x00, 0xff,
+    0xe8, 0x80, 0x00, 0xf1, 0x67, 0xa0, 0x49, 0x5a, 0xf2, 0x0d, 0x0f, 0x8a, 0xf8, 0x08, 0x18, 0x80,
+    0x7f, 0xf3, 0x80, 0x03, 0xcf, 0xfc, 0x60, 0x0d, 0x0b, 0xc4, 0x12, 0x01, 0x14, 0xa0, 0x25, 0x08,
+    0x18, 0x08, 0xb5, 0xd0, 0x03, 0x9c, 0x56, 0x44, 0x03, 0x37, 0x43, 0xd8, 0x07, 0x0a, 0xb2, 0x80,
+    0x7f, 0xf0, 0x48, 0xdd, 0x98, 0x01, 0xa3, 0x25, 0xa4, 0x00, 0x01, 0xbf, 0xf4, 0x80, 0x21, 0xb3,
+    0x60, 0x01, 0xc6, 0xe4, 0x20, 0x05, 0x1b, 0xe6, 0x01, 0xc6, 0xd8, 0x95, 0x40, 0x92, 0x64, 0xfd,
+    0x20, 0x08, 0x9b, 0x88, 0x02, 0x26, 0x71, 0xa3, 0x74, 0xe1, 0xc6, 0xca, 0xa2, 0x00, 0x00, 0xab,
+    0xd8, 0x03, 0xca, 0x5a, 0x01, 0xca, 0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03, 0x2e, 0x82, 0x50,
+    0x04, 0xa0, 0xe1, 0xe6, 0x20, 0x0e, 0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b, 0x60, 0xc0, 0xc6,
+    0x77, 0x99, 0x6a, 0x08, 0x04, 0xa0, 0xb7, 0x60, 0x0e, 0xf7, 0x00, 0x8a, 0x40, 0x3e, 0x67, 0x10,
+    0x08, 0x05, 0xdf, 0xc3, 0x02, 0xa5, 0xc6, 0xd0, 0x3c, 0x82, 0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc,
+    0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0xab, 0xf5, 0xfc, 0x40, 0x05, 0x20, 0x1c,
+    0xce, 0x20, 0x00, 0x00, 0xa7, 0x4c, 0x03, 0xd2, 0x02, 0x01, 0xf6, 0x90, 0x07, 0xab, 0xd8, 0x03,
+    0xca, 0x5a, 0x01, 0xca, 0x10, 0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03, 0x2e, 0x82, 0x50, 0x04, 0xa0,
+    0xe1, 0xe6, 0x20, 0x0e, 0x0e, 0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b, 0x60, 0xc0, 0xc6, 0x77, 0x99,
+    0x6a, 0x08, 0x04, 0xa0, 0xa0, 0x00, 0x4f, 0x20, 0x06, 0x92, 0x60, 0x0e, 0xc2, 0x00, 0x97, 0x7f,
+    0x0c, 0x0a, 0x97, 0x1b, 0x40, 0xf2, 0x0b, 0x44, 0x6a, 0xef, 0xb0, 0x03, 0x33, 0x7a, 0x00, 0x33,
+    0x9c, 0x00, 0x19, 0x6f, 0xac, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0x00, 0xc2, 0x69, 0x44, 0x01, 0x0e,
+    0xce, 0x20, 0x06, 0x3f, 0xae, 0x10, 0x0c, 0x53, 0xe4, 0x20, 0x1c, 0xa5, 0xa0, 0x1c, 0xa1, 0x08,
+    0x20, 0x1b, 0xd1, 0x45, 0xc0, 0x32, 0xe8, 0x25, 0x00, 0x4a, 0x0e, 0x1e, 0x62, 0x00, 0xe0, 0xef,
+    0xa0, 0x60, 0x02, 0x46, 0x64, 0xb6, 0x0c, 0x0c, 0x67, 0x79, 0x96, 0xa0, 0x80, 0x4a, 0x0a, 0x00,
+    0x00, 0xc3, 0x84, 0x01, 0xa5, 0x08, 0x01, 0x1f, 0xb0, 0x00, 0x36, 0xcb, 0x10, 0x01, 0x79, 0xf8,
+    0x04, 0x99, 0xfa, 0x40, 0x54, 0xb8, 0xda, 0x07, 0x90, 0x5a, 0x23, 0x57, 0x7d, 0x80, 0x19, 0x9b,
+    0xd0, 0x01, 0x9c, 0xe0, 0x00, 0xcb, 0x7d, 0x60, 0x00, 0x00, 0xc9, 0xc0, 0x1e, 0x17, 0x84, 0x00,
+    0xc3, 0xb3, 0x88, 0x01, 0x8f, 0xeb, 0x84, 0x03, 0x14, 0xf9, 0x08, 0x07, 0x29, 0x68, 0x07, 0x28,
+    0x42, 0x08, 0x06, 0xf4, 0x51, 0x70, 0x0c, 0xba, 0x09, 0x40, 0x12, 0x83, 0x87, 0x98, 0x80, 0x38,
+    0x3b, 0xe8, 0x18, 0x00, 0x91, 0x99, 0x2d, 0x83, 0x03, 0x19, 0xde, 0x65, 0xa8, 0x20, 0x12, 0x82,
+    0x80, 0x00, 0x92, 0xc0, 0x39, 0x01, 0x40, 0x28, 0xfe, 0x50, 0x01, 0xb6, 0x58, 0x80, 0x0b, 0xcf,
+    0xc0, 0x24, 0xcf, 0xd2, 0x02, 0xa5, 0xc6, 0xd0, 0x3c, 0x82, 0xd1, 0x1a, 0xbb, 0xec, 0x00, 0xcc,
+    0xde, 0x80, 0x0c, 0xe7, 0x00, 0x06, 0x5b, 0xeb, 0x00, 0x00, 0x00, 0xcb, 0xac, 0x01, 0xe7, 0x53,
+    0x00, 0xc3, 0x92, 0x4a, 0x01, 0x8f, 0xef, 0x84, 0x03, 0x14, 0xf9, 0x08, 0x07, 0x29, 0x68, 0x07,
+    0x28, 0x42, 0x08, 0x06, 0xf4, 0x51, 0x70, 0x0c, 0xba, 0x09, 0x40, 0x12, 0x83, 0x87, 0x98, 0x80,
+    0x38, 0x3b, 0xe8, 0x18, 0x00, 0x91, 0x99, 0x2d, 0x83, 0x03, 0x19, 0xde, 0x65, 0xa8, 0x20, 0x12,
+    0x82, 0x80, 0x00, 0x93, 0x58, 0x03, 0x25, 0x18, 0x05, 0x1e, 0x4a, 0x00, 0x36, 0xcb, 0x10, 0x01,
+    0x79, 0xf8, 0x04, 0x99, 0xfa, 0x40, 0x54, 0xb8, 0xda, 0x07, 0x90, 0x5a, 0x23, 0x57, 0x7d, 0x80,
+    0x19, 0x9b, 0xd0, 0x01, 0x9c, 0xe0, 0x00, 0xcb, 0x7d, 0x60, 0x00, 0x00, 0x26, 0x6e, 0x08, 0x06,
+    0x49, 0x7e, 0x10, 0x0c, 0x77, 0x9e, 0x20, 0x18, 0xbd, 0xbc, 0x03, 0x86, 0xfd, 0x04, 0x03, 0x94,
+    0xb4, 0x03, 0x94, 0x21, 0x04, 0x03, 0x7a, 0x28, 0xb8, 0x06, 0x5d, 0x04, 0xa0, 0x09, 0x41, 0xc3,
+    0xcc, 0x40, 0x1c, 0x1d, 0xf4, 0x0c, 0x00, 0x48, 0xcc, 0x96, 0xc1, 0x81, 0x8c, 0xef, 0x32, 0xd4,
+    0x10, 0x09, 0x41, 0x40, 0x02, 0xc6, 0x83, 0x00, 0x25, 0x71, 0x98, 0x00, 0xdc, 0xfc, 0x01, 0x1b,
+    0x65, 0x88, 0x00, 0xbc, 0xfc, 0x02, 0x4c, 0xfd, 0x20, 0x2a, 0x5c, 0x6d, 0x03, 0xc8, 0x2d, 0x11,
+    0xab, 0xbe, 0xc0, 0x0c, 0xcd, 0xe8, 0x00, 0xce, 0x70, 0x00, 0x65, 0xbe, 0xb0, 0x00, 0x00, 0x8d,
+    0xc4, 0x03, 0x87, 0xb6, 0x80, 0x39, 0x62, 0xb0, 0x80, 0x32, 0x7f, 0x84, 0x80, 0x39, 0x4b, 0x40,
+    0x39, 0x42, 0x10, 0x40, 0x37, 0xa2, 0x8b, 0x80, 0x65, 0xd0, 0x4a, 0x00, 0x94, 0x1c, 0x3c, 0xc4,
+    0x01, 0xc1, 0xdf, 0x40, 0xc0, 0x04, 0x8c, 0xc9, 0x6c, 0x18, 0x18, 0xce, 0xf3, 0x2d, 0x41, 0x00,
+    0x94, 0x16, 0xec, 0x01, 0xde, 0xe0, 0x11, 0x48, 0x07, 0xcc, 0xe2, 0x01, 0x00, 0x00, 0x4f, 0xa8,
+    0x04, 0x88, 0xcb, 0x20, 0x02, 0x69, 0xf1, 0x00, 0x17, 0x7f, 0x0c, 0x0a, 0x97, 0x1b, 0x40, 0xf2,
+    0x0b, 0x44, 0x6a, 0xef, 0xb0, 0x03, 0x33, 0x7a, 0x00, 0x33, 0x9c, 0x00, 0x19, 0x6f, 0xac, 0x02,
+    0xaf, 0xd7, 0xf1, 0x00, 0x14, 0x80, 0x73, 0x38, 0x80, 0x00, 0x00, 0xcf, 0x60, 0x1f, 0x75, 0x00,
+    0x73, 0x44, 0xd1, 0x80, 0x66, 0x2e, 0x33, 0x00, 0x78, 0x78, 0x03, 0xca, 0x5a, 0x01, 0xca, 0x10,
+    0x82, 0x01, 0xbd, 0x14, 0x5c, 0x03, 0x2e, 0x82, 0x50, 0x04, 0xa0, 0xe1, 0xe6, 0x20, 0x0e, 0x0e,
+    0xfa, 0x06, 0x00, 0x24, 0x66, 0x4b, 0x60, 0xc0, 0xc6, 0x77, 0x99, 0x6a, 0x08, 0x04, 0xa0, 0xa0,
+    0x00, 0x96, 0x80, 0x3a, 0x24, 0x02, 0x69, 0xdf, 0x30, 0x03, 0x1f, 0x21, 0x80, 0x55, 0xd0, 0x01,
+    0x2e, 0xfe, 0x18, 0x15, 0x2e, 0x36, 0x81, 0xe4, 0x16, 0x88, 0xd5, 0xdf, 0x60, 0x06, 0x66, 0xf4,
+    0x00, 0x67, 0x38, 0x00, 0x32, 0xdf, 0x58, 0x00, 0x00, 0x0f, 0x20, 0x07, 0x87, 0x4c, 0x03, 0xcd,
+    0x4f, 0x66, 0x01, 0x98, 0xf8, 0xcc, 0x01, 0xe1, 0xe0, 0x0f, 0x29, 0x68, 0x07, 0x28, 0x42, 0x08,
+    0x06, 0xf4, 0x51, 0x70, 0x0c, 0xba, 0x09, 0x40, 0x12, 0x83, 0x87, 0x98, 0x80, 0x38, 0x3b, 0xe8,
+    0x18, 0x00, 0x91, 0x99, 0x2d, 0x83, 0x03, 0x19, 0xde, 0x65, 0xa8, 0x20, 0x12, 0x82, 0x80, 0x01,
+    0xc2, 0x00, 0xc3, 0x50, 0x01, 0x9b, 0xeb, 0x0c, 0x00, 0xc7, 0xc8, 0x60, 0x15, 0x74, 0x00, 0x4b,
+    0xbf, 0x86, 0x05, 0x4b, 0x8d, 0xa0, 0x79, 0x05, 0xa2, 0x35, 0x77, 0xd8, 0x01, 0x99, 0xbd, 0x00,
+    0x19, 0xce, 0x00, 0x0c, 0xb7, 0xd6, 0x00, 0x00, 0x00, 0xa3, 0x48, 0x03, 0xd0, 0xc6, 0x01, 0xcd,
+    0x17, 0x46, 0x01, 0x98, 0xb8, 0xcc, 0x01, 0xe1, 0xe0, 0x0f, 0x29, 0x68, 0x07, 0x28, 0x42, 0x08,
+    0x06, 0xf4, 0x51, 0x70, 0x0c, 0xba, 0x09, 0x40, 0x12, 0x83, 0x87, 0x98, 0x80, 0x38, 0x3b, 0xe8,
+    0x18, 0x00, 0x91, 0x99, 0x2d, 0x83, 0x03, 0x19, 0xde, 0x65, 0xa8, 0x20, 0x12, 0x82, 0x80, 0x00,
+    0x46, 0x90, 0x06, 0x86, 0x30, 0x09, 0xa6, 0xf4, 0xc0, 0x0c, 0x7c, 0x86, 0x01, 0x57, 0x40, 0x04,
+    0xbb, 0xf8, 0x60, 0x54, 0xb8, 0xda, 0x07, 0x90, 0x5a, 0x23, 0x57, 0x7d, 0x80, 0x19, 0x9b, 0xd0,
+    0x01, 0x9c, 0xe0, 0x00, 0xcb, 0x7d, 0x60, 0x00, 0x00, 0x1e, 0x6e, 0x10, 0x06, 0x3c, 0xdc, 0x20,
+    0x0c, 0xd0, 0x18, 0x60, 0x19, 0x8b, 0x90, 0xc0, 0x3c, 0x3c, 0x01, 0xe5, 0x2d, 0x00, 0xe5, 0x08,
+    0x41, 0x00, 0xde, 0x8a, 0x2e, 0x01, 0x97, 0x41, 0x28, 0x02, 0x50, 0x70, 0xf3, 0x10, 0x07, 0x07,
+    0x7d, 0x03, 0x00, 0x12, 0x33, 0x25, 0xb0, 0x60, 0x63, 0x3b, 0xcc, 0xb5, 0x04, 0x02, 0x50, 0x50,
+    0x02, 0xc6, 0x83, 0x00, 0x25, 0x09, 0x98, 0x02, 0xf7, 0x71, 0x80, 0x18, 0xf9, 0x0c, 0x02, 0xae,
+    0x80, 0x09, 0x77, 0xf0, 0xc0, 0xa9, 0x71, 0xb4, 0x0f, 0x20, 0xb4, 0x46, 0xae, 0xfb, 0x00, 0x33,
+    0x37, 0xa0, 0x03, 0x39, 0xc0, 0x01, 0x96, 0xfa, 0xc0, 0x00, 0x00, 0x34, 0x05, 0x98, 0x06, 0x62,
+    0xe3, 0x30, 0x07, 0x87, 0x80, 0x3c, 0xa5, 0xa0, 0x1c, 0xa1, 0x08, 0x20, 0x1b, 0xd1, 0x45, 0xc0,
+    0x32, 0xe8, 0x25, 0x00, 0x4a, 0x0e, 0x1e, 0x62, 0x00, 0xe0, 0xef, 0xa0, 0x60, 0x02, 0x46, 0x64,
+    0xb6, 0x0c, 0x0c, 0x67, 0x79, 0x96, 0xa0, 0x80, 0x4a, 0x0b, 0x76, 0x00, 0xef, 0x70, 0x08, 0xa4,
+    0x03, 0xe6, 0x71, 0x00, 0x80, 0x06, 0x90, 0xc3, 0x00, 0x31, 0xf2, 0x18, 0x05, 0x5d, 0x00, 0x12,
+    0xef, 0xe1, 0x81, 0x52, 0xe3, 0x68, 0x1e, 0x41, 0x68, 0x8d, 0x5d, 0xf6, 0x00, 0x66, 0x6f, 0x40,
+    0x06, 0x73, 0x80, 0x03, 0x2d, 0xf5, 0x80, 0x55, 0xfa, 0xfe, 0x20, 0x02, 0x90, 0x0e, 0x67, 0x10,
+    0x00, 0x2f, 0xff, 0x18, 0x02, 0x2e, 0xf1, 0x80, 0x0d, 0x13, 0x00, 0x7f, 0xf1, 0xef, 0xfe, 0xd0,
+    0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x46, 0x89, 0x80, 0x28, 0xbb, 0xc6, 0x5f, 0xfe, 0x30,
+    0x09, 0x58, 0x03, 0xd9, 0x80, 0x08, 0x03, 0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72,
+    0x6e, 0x0e, 0xe8, 0xb7, 0x87, 0x3f, 0xdb, 0x6e, 0x36, 0x4f, 0xa8, 0x38, 0xb9, 0x72, 0xa0, 0x79,
+    0xfa, 0xc0, 0x10, 0xc8, 0x80, 0x63, 0x72, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x3d, 0xc0, 0x1f, 0x1e,
+    0x00, 0x45, 0xff, 0xe3, 0x00, 0x45, 0xde, 0x30, 0x01, 0xa2, 0x60, 0x0f, 0xfa, 0xff, 0xed, 0x00,
+    0xa7, 0x32, 0xe0, 0x08, 0x8c, 0xf0, 0x07, 0xfc, 0x68, 0x98, 0x02, 0x8b, 0xbc, 0x60, 0x00, 0x3f,
+    0x30, 0x06, 0x75, 0x20, 0x0e, 0xb4, 0x00, 0x8f, 0x3f, 0x0c, 0x07, 0x57, 0x2f, 0x05, 0xc6, 0x4d,
+    0xc9, 0xb8, 0x3b, 0xa2, 0xde, 0x1c, 0xff, 0x6d, 0xb8, 0xd9, 0x3e, 0xa0, 0xe2, 0xe5, 0xca, 0x80,
+    0x00, 0x46, 0xea, 0x40, 0x34, 0x6e, 0xa4, 0x00, 0x5f, 0xfe, 0x30, 0x04, 0x5d, 0xe3, 0x00, 0x1a,
+    0x26, 0x00, 0xff, 0xaf, 0xfe, 0xd0, 0x0a, 0x73, 0x2e, 0x00, 0x88, 0xcf, 0x00, 0x7f, 0xc6, 0x89,
+    0x80, 0x28, 0xbb, 0xc6, 0x00, 0x01, 0xd8, 0x75, 0x00, 0x2a, 0xba, 0x90, 0x00, 0x90, 0xda, 0x20,
+    0x03, 0xcf, 0xc3, 0x01, 0xd5, 0xcb, 0xc1, 0x71, 0x93, 0x72, 0x6e, 0x0e, 0xe8, 0xb7, 0x87, 0x3f,
+    0xdb, 0x6e, 0x36, 0x4f, 0xa8, 0x38, 0xb9, 0x72, 0xa0, 0x00, 0xe8, 0xb0, 0x0c, 0x44, 0x1a, 0x00,
+    0x93, 0xfb, 0x04, 0x03, 0x66, 0x88, 0x00, 0xbe, 0xfb, 0x97, 0xe6, 0x00, 0x8b, 0xbc, 0x60, 0x03,
+    0x44, 0xc0, 0x1f, 0xf5, 0xff, 0xda, 0x01, 0x4e, 0x65, 0xc0, 0x11, 0x19, 0xe0, 0x0f, 0xf8, 0xd1,
+    0x30, 0x05, 0x17, 0x78, 0xc0, 0x00, 0xeb, 0x40, 0x0c, 0xc0, 0x80, 0x06, 0xf1, 0xb0, 0x01, 0x46,
+    0x49, 0x80, 0x0f, 0xcf, 0xc8, 0x00, 0x5b, 0xfa, 0x40, 0x3a, 0xb9, 0x78, 0x2e, 0x32, 0x6e, 0x4d,
+    0xc1, 0xdd, 0x16, 0xf0, 0xe7, 0xfb, 0x6d, 0xc6, 0xc9, 0xf5, 0x07, 0x17, 0x2e, 0x54, 0x00, 0xd3,
+    0x20, 0x0e, 0x2b, 0x00, 0xe4, 0xfe, 0xc0, 0x0e, 0xcd, 0x10, 0x01, 0x7d, 0xf7, 0x2f, 0xcc, 0x01,
+    0x17, 0x78, 0xc0, 0x06, 0x89, 0x80, 0x3f, 0xeb, 0xff, 0xb4, 0x02, 0x9c, 0xcb, 0x80, 0x22, 0x33,
+    0xc0, 0x1f, 0xf1, 0xa2, 0x60, 0x0a, 0x2e, 0xf1, 0x80, 0x00, 0x8b, 0x00, 0x38, 0x96, 0x00, 0x26,
+    0xfe, 0x80, 0x01, 0x46, 0x49, 0x80, 0x0f, 0xcf, 0xc8, 0x00, 0x5b, 0xfa, 0x40, 0x3a, 0xb9, 0x78,
+    0x2e, 0x32, 0x6e, 0x4d, 0xc1, 0xdd, 0x16, 0xf0, 0xe7, 0xfb, 0x6d, 0xc6, 0xc9, 0xf5, 0x07, 0x17,
+    0x2e, 0x54, 0x00, 0xd3, 0xa2, 0x01, 0x86, 0xc4, 0x03, 0x26, 0x74, 0x88, 0x06, 0xcd, 0x10, 0x01,
+    0x7d, 0xf7, 0x2f, 0xcc, 0x01, 0x17, 0x78, 0xc0, 0x06, 0x89, 0x80, 0x3f, 0xeb, 0xff, 0xb4, 0x02,
+    0x9c, 0xcb, 0x80, 0x22, 0x33, 0xc0, 0x1f, 0xf1, 0xa2, 0x60, 0x0a, 0x2e, 0xf1, 0x80, 0x00, 0x8f,
+    0x60, 0x03, 0x1c, 0x78, 0x04, 0xde, 0x4e, 0x00, 0x28, 0xc9, 0x30, 0x01, 0xf9, 0xf9, 0x00, 0x0b,
+    0x7f, 0x48, 0x07, 0x57, 0x2f, 0x05, 0xc6, 0x4d, 0xc9, 0xb8, 0x3b, 0xa2, 0xde, 0x1c, 0xff, 0x6d,
+    0xb8, 0xd9, 0x3e, 0xa0, 0xe2, 0xe5, 0xca, 0x80, 0x00, 0x46, 0xea, 0x40, 0x34, 0x2a, 0x48, 0x06,
+    0x82, 0x09, 0x00, 0xd5, 0x49, 0xb0, 0x01, 0x7e, 0xff, 0xb7, 0xcc, 0x01, 0x17, 0x78, 0xc0, 0x06,
+    0x89, 0x80, 0x3f, 0xeb, 0xff, 0xb4, 0x02, 0x9c, 0xcb, 0x80, 0x22, 0x33, 0xc0, 0x1f, 0xf1, 0xa2,
+    0x60, 0x0a, 0x2e, 0xf1, 0x80, 0x01, 0xc7, 0x65, 0x00, 0x2a, 0x0d, 0x20, 0x01, 0x3a, 0x6c, 0x40,
+    0x05, 0x19, 0x26, 0x00, 0x3f, 0x3f, 0x20, 0x01, 0x6f, 0xe9, 0x00, 0xea, 0xe5, 0xe0, 0xb8, 0xc9,
+    0xb9, 0x37, 0x07, 0x74, 0x5b, 0xc3, 0x9f, 0xed, 0xb7, 0x1b, 0x27, 0xd4, 0x1c, 0x5c, 0xb9, 0x50,
+    0x00, 0x99, 0x80, 0x1c, 0xb7, 0x4c, 0x01, 0x8f, 0xf8, 0x40, 0x05, 0xf3, 0xba, 0x8f, 0x30, 0x04,
+    0x5d, 0xe3, 0x00, 0x1a, 0x26, 0x00, 0xff, 0xe3, 0xdf, 0xfd, 0xa0, 0x14, 0xe6, 0x5c, 0x01, 0x11,
+    0x9e, 0x00, 0x8d, 0x13, 0x00, 0x51, 0x77, 0x8c, 0xbf, 0xfc, 0x60, 0x12, 0xb0, 0x07, 0xb3, 0x00,
+    0x10, 0x00, 0x37, 0xc0, 0x04, 0x51, 0xac, 0x60, 0x02, 0xe2, 0xe3, 0x00, 0x1e, 0x7e, 0x18, 0x0e,
+    0xae, 0x5e, 0x0b, 0x8c, 0x9b, 0x93, 0x70, 0x77, 0x45, 0xbc, 0x39, 0xfe, 0xdb, 0x71, 0xb2, 0x7d,
+    0x41, 0xc5, 0xcb, 0x95, 0x03, 0xcf, 0xd6, 0x00, 0x86, 0x44, 0x03, 0x1b, 0x90, 0x00, 0x6d, 0x56,
+    0x70, 0x05, 0x29, 0x7a, 0x00, 0x7f, 0xf3, 0xc0, 0x8e, 0x48, 0x26, 0x0c, 0x23, 0xf1, 0x00, 0xff,
+    0xe3, 0x00, 0x2f, 0x40, 0x0f, 0xfe, 0x79, 0x7a, 0x04, 0x89, 0x39, 0x00, 0x3e, 0x12, 0x71, 0x14,
+    0x81, 0xf8, 0x80, 0x7f, 0xf1, 0x8f, 0xc4, 0x52, 0x04, 0xe2, 0x00, 0x00, 0x1d, 0xf6, 0xc8, 0x80,
+    0x49, 0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b, 0x67, 0xc0, 0x80, 0x32, 0x90, 0x08, 0x65, 0x81, 0x40,
+    0xc0, 0x31, 0x81, 0x00, 0x7f, 0x94, 0x08, 0x03, 0x18, 0x11, 0x94, 0x00, 0x43, 0x2a, 0x00, 0x95,
+    0xb6, 0x7c, 0x0b, 0x00, 0x26, 0x04, 0x52, 0x78, 0x80, 0x47, 0x7d, 0xb2, 0x20, 0x1e, 0x74, 0x00,
+    0xfd, 0x78, 0x01, 0x80, 0x02, 0xbf, 0xd5, 0x01, 0xc1, 0xca, 0xa2, 0x38, 0xd9, 0xb9, 0x77, 0x08,
+    0x40, 0x08, 0xdc, 0x42, 0x00, 0x56, 0x71, 0xb3, 0x73, 0xe1, 0xd6, 0xca, 0xa2, 0x01, 0xe7, 0xea,
+    0x80, 0x69, 0x20, 0x0c, 0x2e, 0xc0, 0x00, 0x00, 0x8b, 0x64, 0x03, 0xe2, 0x80, 0x0f, 0xe5, 0x90,
+    0x0f, 0x1d, 0xf6, 0xc8, 0x80, 0x49, 0x81, 0x14, 0x9e, 0x20, 0x09, 0x5b, 0x67, 0xc0, 0x80, 0x32,
+    0x90, 0x08, 0x65, 0x81, 0x40, 0xc0, 0x31, 0x81, 0x00, 0x7f, 0x94, 0x08, 0x03, 0x18, 0x11, 0x94,
+    0x00, 0x43, 0x2a, 0x00, 0x95, 0xb6, 0x7c, 0x0b, 0x00, 0x26, 0x04, 0x52, 0x78, 0x80, 0x00, 0x2f,
+    0x38, 0x06, 0x57, 0x20, 0x0e, 0x95, 0x00, 0x8a, 0xff, 0x54, 0x07, 0x07, 0x2a, 0x88, 0xe3, 0x66,
+    0xe5, 0xdc, 0x21, 0x00, 0x23, 0x71, 0x08, 0x01, 0x59, 0xc6, 0xcd, 0xcf, 0x87, 0x5b, 0x2a, 0x88,
+    0x00, 0x00, 0xf3, 0xc0, 0x07, 0xc3, 0x32, 0x00, 0xe1, 0xc8, 0xe1, 0x00, 0xea, 0x45, 0x60, 0x0f,
+    0x44, 0x35, 0x40, 0x38, 0xe3, 0xb2, 0x84, 0x02, 0x4c, 0x08, 0xa4, 0xf1, 0x00, 0x4a, 0xdb, 0x3e,
+    0x04, 0x01, 0x94, 0x80, 0x43, 0x2c, 0x0a, 0x06, 0x01, 0x8c, 0x08, 0x03, 0xfc, 0xa0, 0x40, 0x18,
+    0xc0, 0x8c, 0xa0, 0x02, 0x19, 0x50, 0x04, 0xad, 0xb3, 0xe0, 0x58, 0x01, 0x30, 0x22, 0x93, 0xc4,
+    0x00, 0x00, 0xea, 0x50, 0x0c, 0x8c, 0xa0, 0x05, 0xfd, 0xc0, 0x00, 0xdd, 0x9d, 0x00, 0x2c, 0x4f,
+    0x50, 0x01, 0xcf, 0xe2, 0x00, 0xe0, 0xe5, 0x51, 0x1c, 0x6c, 0xdc, 0xbb, 0x84, 0x20, 0x04, 0x6e,
+    0x21, 0x00, 0x2b, 0x38, 0xd9, 0xb9, 0xf0, 0xeb, 0x65, 0x51, 0x00, 0x00, 0xeb, 0x40, 0x0f, 0xdf,
+    0x00, 0x1e, 0x1c, 0xdc, 0x00, 0xf5, 0x22, 0xb0, 0x07, 0xa2, 0x1a, 0xa0, 0x1c, 0x71, 0xd9, 0x42,
+    0x01, 0x26, 0x04, 0x52, 0x78, 0x80, 0x25, 0x6d, 0x9f, 0x02, 0x00, 0xca, 0x40, 0x21, 0x96, 0x05,
+    0x03, 0x00, 0xc6, 0x04, 0x01, 0xfe, 0x50, 0x20, 0x0c, 0x60, 0x46, 0x50, 0x01, 0x0c, 0xa8, 0x02,
+    0x56, 0xd9, 0xf0, 0x2c, 0x00, 0x98, 0x11, 0x49, 0xe2, 0x00, 0x00, 0x87, 0x04, 0x03, 0x0d, 0xc0,
+    0x04, 0xbf, 0xd2, 0x00, 0x1b, 0xb3, 0xa0, 0x05, 0x89, 0xea, 0x00, 0x39, 0xfc, 0x40, 0x1c, 0x1c,
+    0xaa, 0x23, 0x8d, 0x9b, 0x97, 0x70, 0x84, 0x00, 0x8d, 0xc4, 0x20, 0x05, 0x67, 0x1b, 0x37, 0x3e,
+    0x1d, 0x6c, 0xaa, 0x20, 0x00, 0xeb, 0xc0, 0x0f, 0xd4, 0xe0, 0x1e, 0x1c, 0x8b, 0x00, 0xf5, 0x22,
+    0xb0, 0x07, 0xa2, 0x1a, 0xa0, 0x1c, 0x71, 0xd9, 0x42, 0x01, 0x26, 0x04, 0x52, 0x78, 0x80, 0x25,
+    0x6d, 0x9f, 0x02, 0x00, 0xca, 0x40, 0x21, 0x96, 0x05, 0x03, 0x00, 0xc6, 0x04, 0x01, 0xfe, 0x50,
+    0x20, 0x0c, 0x60, 0x46, 0x50, 0x01, 0x0c, 0xa8, 0x02, 0x56, 0xd9, 0xf0, 0x2c, 0x00, 0x98, 0x11,
+    0x49, 0xe2, 0x00, 0x00, 0x87, 0x64, 0x03, 0x0c, 0x88, 0x04, 0xbf, 0xb0, 0x00, 0x1b, 0xb3, 0xa0,
+    0x05, 0x89, 0xea, 0x00, 0x39, 0xfc, 0x40, 0x1c, 0x1c, 0xaa, 0x23, 0x8d, 0x9b, 0x97, 0x70, 0x84,
+    0x00, 0x8d, 0xc4, 0x20, 0x05, 0x67, 0x1b, 0x37, 0x3e, 0x1d, 0x6c, 0xaa, 0x20, 0x00, 0xab, 0x74,
+    0xe0, 0x1e, 0xa4, 0xa7, 0x00, 0xf5, 0x05, 0xa8, 0x07, 0xba, 0x75, 0x80, 0x38, 0xff, 0xb2, 0x84,
+    0x02, 0x4c, 0x08, 0xa4, 0xf1, 0x00, 0x4a, 0xdb, 0x3e, 0x04, 0x01, 0x94, 0x80, 0x43, 0x2c, 0x0a,
+    0x06, 0x01, 0x8c, 0x08, 0x03, 0xfc, 0xa0, 0x40, 0x18, 0xc0, 0x8c, 0xa0, 0x02, 0x19, 0x50, 0x04,
+    0xad, 0xb3, 0xe0, 0x58, 0x01, 0x30, 0x22, 0x93, 0xc4, 0x00, 0x00, 0x64, 0x2b, 0x00, 0x0d, 0x76,
+    0x50, 0x00, 0x79, 0x4a, 0x40, 0x01, 0xbb, 0x3a, 0x00, 0x58, 0x9e, 0xa0, 0x03, 0x9f, 0xc4, 0x01,
+    0xc1, 0xca, 0xa2, 0x38, 0xd9, 0xb9, 0x77, 0x08, 0x40, 0x08, 0xdc, 0x42, 0x00, 0x56, 0x71, 0xb3,
+    0x73, 0xe1, 0xd6, 0xca, 0xa2, 0x00, 0x00, 0xce, 0xa0, 0x1f, 0x3e, 0x59, 0x80, 0x7d, 0x5a, 0xa0,
+    0x1c, 0x79, 0xfd, 0xe2, 0x01, 0x26, 0x04, 0x52, 0x78, 0x80, 0x25, 0x6d, 0x9f, 0x02, 0x00, 0xca,
+    0x40, 0x21, 0x96, 0x05, 0x03, 0x00, 0xc6, 0x04, 0x01, 0xfe, 0x50, 0x20, 0x0c, 0x60, 0x46, 0x50,
+    0x01, 0x0c, 0xa8, 0x02, 0x56, 0xd9, 0xf0, 0x2c, 0x00, 0x98, 0x11, 0x49, 0xe2, 0x01, 0x1d, 0xf6,
+    0xc8, 0x80, 0x79, 0xd0, 0x03, 0xf5, 0xe0, 0x06, 0x00, 0x00, 0x2f, 0xc8, 0x04, 0x57, 0x88, 0xa0,
+    0x02, 0xe3, 0xd5, 0x00, 0x15, 0xfe, 0xa8, 0x0e, 0x0e, 0x55, 0x11, 0xc6, 0xcd, 0xcb, 0xb8, 0x42,
+    0x00, 0x46, 0xe2, 0x10, 0x02, 0xb3, 0x8d, 0x9b, 0x9f, 0x0e, 0xb6, 0x55, 0x10, 0x0f, 0x3f, 0x54,
+    0x03, 0x49, 0x00, 0x61, 0x76, 0x00, 0x00, 0x00, 0xee, 0x50, 0x0f, 0x9d, 0x14, 0x28, 0x80, 0x33,
+    0xd0, 0x0a, 0x88, 0x00, 0xef, 0xbf, 0xdc, 0x46, 0x09, 0x98, 0xfd, 0x50, 0xf0, 0x04, 0xbb, 0x84,
+    0xa8, 0xe4, 0x0c, 0xa8, 0x03, 0x52, 0x02, 0x81, 0x00, 0x62, 0x02, 0x00, 0xfe, 0x35, 0x03, 0x00,
+    0xc6, 0x02, 0x65, 0x00, 0x10, 0xcb, 0x00, 0x25, 0x2d, 0x9f, 0xc2, 0x00, 0x09, 0x81, 0x14, 0xfe,
+    0x20, 0x00, 0x00, 0x8f, 0xc8, 0x03, 0x4c, 0x89, 0x00, 0x2a, 0x63, 0xb0, 0x2b, 0xff, 0x62, 0x0e,
+    0x16, 0xd0, 0x43, 0x8c, 0x12, 0x9c, 0xf1, 0x08, 0x01, 0x5b, 0x88, 0x40, 0x08, 0xee, 0x1b, 0x37,
+    0x2f, 0x1d, 0x6c, 0xaa, 0x20, 0x00, 0xa6, 0x80, 0x3f, 0x42, 0x10, 0x02, 0x88, 0x02, 0x1e, 0x20,
+    0x15, 0x10, 0x01, 0xdf, 0x7f, 0xb8, 0x8c, 0x13, 0x31, 0xfa, 0xa1, 0xe0, 0x09, 0x77, 0x09, 0x51,
+    0xc8, 0x19, 0x50, 0x06, 0xa4, 0x05, 0x02, 0x00, 0xc4, 0x04, 0x01, 0xfc, 0x6a, 0x06, 0x01, 0x8c,
+    0x04, 0xca, 0x00, 0x21, 0x96, 0x00, 0x4a, 0x5b, 0x3f, 0x84, 0x00, 0x13, 0x02, 0x29, 0xfc, 0x40,
+    0x00, 0x6b, 0x80, 0x77, 0x50, 0x01, 0x00, 0x07, 0xa0, 0x76, 0x05, 0x7f, 0xec, 0x41, 0xc2, 0xda,
+    0x08, 0x71, 0x82, 0x53, 0x9e, 0x21, 0x00, 0x2b, 0x71, 0x08, 0x01, 0x1d, 0xc3, 0x66, 0xe5, 0xe3,
+    0xad, 0x95, 0x44, 0x00, 0x00, 0x8b, 0x64, 0x03, 0xe2, 0x80, 0x0a, 0x88, 0x03, 0x2c, 0x80, 0xa8,
+    0x80, 0x0e, 0xfb, 0xfd, 0xc4, 0x60, 0x99, 0x8f, 0xd5, 0x0f, 0x00, 0x4b, 0xb8, 0x4a, 0x8e, 0x40,
+    0xca, 0x80, 0x35, 0x20, 0x28, 0x10, 0x06, 0x20, 0x20, 0x0f, 0xe3, 0x50, 0x30, 0x0c, 0x60, 0x26,
+    0x50, 0x01, 0x0c, 0xb0, 0x02, 0x52, 0xd9, 0xfc, 0x20, 0x00, 0x98, 0x11, 0x4f, 0xe2, 0x00, 0x00,
+    0x2f, 0x38, 0x06, 0x57, 0x20, 0x40, 0x0a, 0x54, 0xec, 0x0a, 0xff, 0xd8, 0x83, 0x85, 0xb4, 0x10,
+    0xe3, 0x04, 0xa7, 0x3c, 0x42, 0x00, 0x56, 0xe2, 0x10, 0x02, 0x3b, 0x86, 0xcd, 0xcb, 0xc7, 0x5b,
+    0x2a, 0x88, 0x00, 0x00, 0xa6, 0x8e, 0x80, 0x3c, 0xb3, 0xfe, 0x09, 0x20, 0x0b, 0x0f, 0x14, 0x58,
+    0x40, 0x07, 0x7d, 0xfe, 0xe2, 0x30, 0x4c, 0xc7, 0xea, 0x87, 0x80, 0x25, 0xdc, 0x25, 0x47, 0x20,
+    0x65, 0x40, 0x1a, 0x90, 0x14, 0x08, 0x03, 0x10, 0x10, 0x07, 0xf1, 0xa8, 0x18, 0x06, 0x30, 0x13,
+    0x28, 0x00, 0x86, 0x58, 0x01, 0x29, 0x6c, 0xfe, 0x10, 0x00, 0x4c, 0x08, 0xa7, 0xf1, 0x00, 0x00,
+    0x64, 0xb2, 0x80, 0x05, 0xb6, 0xdd, 0x00, 0x69, 0x34, 0x6c, 0x0a, 0xff, 0xd8, 0x83, 0x85, 0xb4,
+    0x10, 0xe3, 0x04, 0xa7, 0x3c, 0x42, 0x00, 0x56, 0xe2, 0x10, 0x02, 0x3b, 0x86, 0xcd, 0xcb, 0xc7,
+    0x5b, 0x2a, 0x88, 0x00, 0x00, 0xf8, 0x7c, 0xc0, 0x07, 0x7d, 0xfe, 0xe1, 0x20, 0x4c, 0xc7, 0xea,
+    0x86, 0x08, 0x4b, 0xb8, 0x4a, 0x8e, 0x40, 0xca, 0x80, 0x35, 0x20, 0x28, 0x10, 0x06, 0x20, 0x20,
+    0x0f, 0xe3, 0x50, 0x30, 0x0c, 0x60, 0x26, 0x50, 0x01, 0x0c, 0xb0, 0x02, 0x52, 0xd9, 0xfc, 0x20,
+    0x00, 0x98, 0x11, 0x4f, 0xe2, 0x01, 0x1d, 0xf6, 0xc8, 0x80, 0x79, 0xd0, 0x03, 0xf5, 0xe0, 0x06,
+    0x00, 0x00, 0xf2, 0x00, 0x71, 0xd8, 0x15, 0xff, 0xb1, 0x07, 0x0b, 0x68, 0x21, 0xc6, 0x09, 0x4e,
+    0x78, 0x84, 0x00, 0xad, 0xc4, 0x20, 0x04, 0x77, 0x0d, 0x9b, 0x97, 0x8e, 0xb6, 0x55, 0x10, 0x0f,
+    0x3f, 0x54, 0x03, 0x49, 0x00, 0x61, 0x76, 0x00, 0x00, 0x2f, 0x30, 0x08, 0x7d, 0x40, 0x3f, 0xfc,
+    0x6e, 0x01, 0xc2, 0x41, 0x80, 0x13, 0x83, 0x03, 0xba, 0x56, 0x25, 0x48, 0x22, 0x52, 0x96, 0x28,
+    0x02, 0x6d, 0xfd, 0x70, 0x0f, 0x48, 0x80, 0x78, 0x9c, 0x80, 0x20, 0x3f, 0x10, 0x06, 0x40, 0x07,
+    0xff, 0x1c, 0x40, 0x22, 0x00, 0x18, 0x18, 0x42, 0xd0, 0x80, 0x2d, 0xac, 0x8c, 0x00, 0x9b, 0xd1,
+    0x90, 0x01, 0x41, 0x80, 0x72, 0xb0, 0x00, 0x00, 0x9b, 0x54, 0x03, 0xcc, 0xe0, 0x1f, 0xa9, 0x40,
+    0x22, 0xf3, 0x00, 0x87, 0xd4, 0x03, 0xff, 0xc6, 0xe0, 0x1c, 0x24, 0x18, 0x01, 0x38, 0x30, 0x3b,
+    0xa5, 0x62, 0x54, 0x82, 0x25, 0x29, 0x62, 0x80, 0x00, 0x2f, 0x38, 0x06, 0x57, 0x20, 0x0e, 0x95,
+    0x00, 0x1f, 0x88, 0x03, 0x20, 0x03, 0xff, 0x8e, 0x20, 0x11, 0x00, 0x0c, 0x0c, 0x21, 0x68, 0x40,
+    0x16, 0xd6, 0x46, 0x00, 0x00, 0xc9, 0xc2, 0x01, 0xf4, 0x40, 0x41, 0xd0, 0x03, 0x63, 0x00, 0x28,
+    0xcb, 0xcc, 0x02, 0x1f, 0x34, 0x00, 0xfd, 0x66, 0x01, 0xff, 0xde, 0x70, 0x0e, 0x10, 0x20, 0xc0,
+    0x09, 0xc1, 0x80, 0x0e, 0xe9, 0x58, 0x95, 0x20, 0x04, 0x4a, 0x52, 0xc5, 0x00, 0x00, 0x00, 0x8f,
+    0xc8, 0x03, 0xa6, 0x44, 0x68, 0x01, 0x53, 0x05, 0xf1, 0xf8, 0x80, 0x31, 0xfc, 0x03, 0xce, 0xa0,
+    0x1f, 0xfc, 0x11, 0x00, 0xc4, 0x00, 0x30, 0x01, 0x84, 0x2d, 0x08, 0x05, 0x6d, 0x64, 0x60, 0x00,
+    0x00, 0xb5, 0x80, 0x3f, 0x4d, 0x80, 0x4e, 0x80, 0x12, 0x68, 0x05, 0x46, 0x5e, 0x60, 0x10, 0xf9,
+    0xa0, 0x07, 0xeb, 0x30, 0x0f, 0xfe, 0xf3, 0x80, 0x70, 0x81, 0x06, 0x00, 0x4e, 0x0c, 0x00, 0x77,
+    0x4a, 0xc4, 0xa9, 0x00, 0x22, 0x52, 0x96, 0x28, 0x00, 0x00, 0x00, 0x6b, 0x80, 0x7b, 0xa8, 0x00,
+    0x68, 0x00, 0x3d, 0x00, 0x5f, 0x1f, 0x88, 0x03, 0x1f, 0xc0, 0x3c, 0xea, 0x01, 0xff, 0xc1, 0x10,
+    0x0c, 0x40, 0x03, 0x00, 0x18, 0x42, 0xd0, 0x80, 0x56, 0xd6, 0x46, 0x00, 0x00, 0x00, 0x9b, 0x54,
+    0x03, 0xe6, 0x70, 0x09, 0xd0, 0x03, 0x52, 0x80, 0x28, 0xcb, 0xcc, 0x02, 0x1f, 0x34, 0x00, 0xfd,
+    0x66, 0x01, 0xff, 0xde, 0x70, 0x0e, 0x10, 0x20, 0xc0, 0x09, 0xc1, 0x80, 0x0e, 0xe9, 0x58, 0x95,
+    0x20, 0x04, 0x4a, 0x52, 0xc5, 0x00, 0x00, 0x00, 0x2f, 0x38, 0x07, 0x2b, 0x90, 0x1a, 0x00, 0x52,
+    0xa1, 0x7c, 0x7e, 0x20, 0x0c, 0x7f, 0x00, 0xf3, 0xa8, 0x07, 0xff, 0x04, 0x40, 0x31, 0x00, 0x0c,
+    0x00, 0x61, 0x0b, 0x42, 0x01, 0x5b, 0x59, 0x18, 0x00, 0x00, 0xb1, 0xd9, 0x80, 0x1c, 0x68, 0x36,
+    0x80, 0xe8, 0x00, 0x38, 0x6d, 0x20, 0xa3, 0x2f, 0x30, 0x08, 0x7c, 0xd0, 0x03, 0xf5, 0x98, 0x07,
+    0xff, 0x79, 0xc0, 0x38, 0x40, 0x83, 0x00, 0x27, 0x06, 0x00, 0x3b, 0xa5, 0x62, 0x54, 0x80, 0x11,
+    0x29, 0x4b, 0x14, 0x00, 0x00, 0x00, 0x6c, 0xab, 0x80, 0x44, 0x99, 0x0a, 0x68, 0x05, 0x2b, 0xa5,
+    0x7c, 0x7e, 0x20, 0x0c, 0x7f, 0x00, 0xf3, 0xa8, 0x07, 0xff, 0x04, 0x40, 0x31, 0x00, 0x0c, 0x00,
+    0x61, 0x0b, 0x42, 0x01, 0x5b, 0x59, 0x18, 0x00, 0x00, 0xfd, 0xae, 0x5e, 0x60, 0x10, 0xf9, 0x08,
+    0x07, 0xe5, 0x70, 0x0f, 0xde, 0x20, 0x1f, 0xfd, 0x47, 0x00, 0xf8, 0x83, 0x00, 0x27, 0x07, 0x00,
+    0x3b, 0xa5, 0x62, 0x50, 0x80, 0x11, 0x29, 0x4a, 0xf6, 0x01, 0x9b, 0x7f, 0x60, 0x03, 0xe9, 0x10,
+    0x0f, 0x89, 0xc8, 0x03, 0x00, 0x00, 0xf1, 0xa0, 0x07, 0xaf, 0x8f, 0xc4, 0x01, 0x8f, 0xe0, 0x1e,
+    0x75, 0x00, 0xff, 0xe0, 0x88, 0x06, 0x20, 0x01, 0x80, 0x0c, 0x21, 0x68, 0x40, 0x2b, 0x6b, 0x23,
+    0x00, 0x93, 0x7a, 0x32, 0x00, 0x34, 0x18, 0x07, 0x95, 0x80, 0x20, 0x00, 0x1f, 0x90, 0x07, 0x8d,
+    0xec, 0x03, 0x4f, 0x0c, 0x48, 0x3f, 0x94, 0x04, 0x00, 0x06, 0x58, 0x86, 0x58, 0x82, 0x02, 0x00,
+    0x0e, 0x52, 0x4d, 0x02, 0x01, 0x4a, 0x79, 0x30, 0x06, 0x44, 0x14, 0x80, 0x7b, 0x41, 0x00, 0x3f,
+    0xfa, 0x40, 0x02, 0xf3, 0x00, 0xc5, 0x32, 0x00, 0xe6, 0xa0, 0x0a, 0xb0, 0x02, 0xe8, 0xe3, 0x10,
+    0x31, 0xa4, 0x17, 0x0a, 0x32, 0x07, 0xa0, 0x7a, 0x00, 0x51, 0xa8, 0xb8, 0x00, 0xca, 0xd0, 0x40,
+    0x2a, 0x1e, 0x00, 0xc2, 0x0a, 0x01, 0x1d, 0xb8, 0x04, 0x58, 0xd0, 0x01, 0x00, 0x9e, 0x10, 0x09,
+    0xfc, 0xa0, 0x20, 0x00, 0x32, 0xc4, 0x32, 0xc4, 0x10, 0x10, 0x00, 0x72, 0x92, 0x68, 0x10, 0x0a,
+    0x53, 0xc9, 0x80, 0x32, 0x20, 0xa4, 0x03, 0xda, 0x08, 0x01, 0xff, 0xd5, 0x6f, 0x00, 0xf8, 0xe0,
+    0x03, 0xe6, 0x50, 0x0c, 0x00, 0xac, 0x00, 0xba, 0x38, 0xc4, 0x0c, 0x69, 0x05, 0xc2, 0x8c, 0x81,
+    0xe8, 0x1e, 0x80, 0x14, 0x6a, 0x2e, 0x00, 0x32, 0xb4, 0x10, 0x0a, 0x87, 0x80, 0x30, 0x82, 0x80,
+    0x47, 0x6e, 0x2a, 0x05, 0x8d, 0x0f, 0x60, 0x00, 0x00, 0xab, 0x48, 0x03, 0xd4, 0x06, 0x01, 0xf6,
+    0x88, 0x05, 0x3c, 0x20, 0x13, 0xf9, 0x40, 0x40, 0x00, 0x65, 0x88, 0x65, 0x88, 0x20, 0x20, 0x00,
+    0xe5, 0x24, 0xd0, 0x20, 0x14, 0xa7, 0x93, 0x00, 0x64, 0x41, 0x48, 0x07, 0xb4, 0x10, 0x03, 0xff,
+    0xa4, 0x00, 0x00, 0x4f, 0x18, 0x06, 0x92, 0x10, 0x0e, 0xc2, 0x00, 0x56, 0x00, 0x5d, 0x1c, 0x62,
+    0x06, 0x34, 0x82, 0xe1, 0x46, 0x40, 0xf4, 0x0f, 0x40, 0x0a, 0x35, 0x17, 0x00, 0x19, 0x5a, 0x08,
+    0x05, 0x43, 0xc0, 0x18, 0x41, 0x40, 0x23, 0xb7, 0x00, 0x8b, 0x1a, 0x00, 0x20, 0x00, 0x2e, 0xeb,
+    0x00, 0x39, 0x77, 0x58, 0x01, 0x4f, 0x08, 0x04, 0xfe, 0x50, 0x10, 0x00, 0x19, 0x62, 0x19, 0x62,
+    0x08, 0x08, 0x00, 0x39, 0x49, 0x34, 0x08, 0x05, 0x29, 0xe4, 0xc0, 0x19, 0x10, 0x52, 0x01, 0xed,
+    0x04, 0x00, 0xff, 0xe9, 0x00, 0x02, 0xe6, 0x93, 0x00, 0x25, 0xf2, 0x98, 0x01, 0x96, 0x30, 0x01,
+    0x58, 0x01, 0x74, 0x71, 0x88, 0x18, 0xd2, 0x0b, 0x85, 0x19, 0x03, 0xd0, 0x3d, 0x00, 0x28, 0xd4,
+    0x5c, 0x00, 0x65, 0x68, 0x20, 0x15, 0x0f, 0x00, 0x61, 0x05, 0x00, 0x8e, 0xdc, 0x02, 0x2c, 0x68,
+    0x00, 0x80, 0x0f, 0x65, 0xf1, 0x00, 0xff, 0xff, 0x87, 0x68, 0x22, 0x62, 0x00, 0x3b, 0x82, 0xae,
+    0xea, 0x00, 0x05, 0xf0, 0xd8, 0x00, 0x55, 0x03, 0xc9, 0xfc, 0x2e, 0x03, 0x49, 0xb4, 0x04, 0x80,
+    0x80, 0x48, 0x03, 0xff, 0xca, 0x00, 0x00, 0x89, 0x40, 0x35, 0xef, 0x00, 0x54, 0xb9, 0x60, 0x02,
+    0x58, 0x33, 0x00, 0x1c, 0x1d, 0x32, 0x40, 0x80, 0x52, 0x19, 0x00, 0x33, 0x86, 0x10, 0x10, 0x06,
+    0x51, 0xe4, 0xa0, 0xb0, 0xc7, 0xb7, 0x93, 0x00, 0x00, 0xc2, 0x01, 0x86, 0xb4, 0x03, 0x6b, 0xf0,
+    0x05, 0x25, 0x84, 0x00, 0x16, 0x91, 0x30, 0x02, 0x02, 0xa6, 0x48, 0x10, 0x12, 0x43, 0x20, 0x06,
+    0x70, 0xc2, 0x02, 0x00, 0xca, 0x5c, 0x94, 0x16, 0x1e, 0xf6, 0xf4, 0x60, 0x0d, 0xc0, 0x08, 0x7e,
+    0x42, 0x0d, 0x00, 0x12, 0x16, 0x0a, 0x70, 0x00, 0x65, 0x20, 0x07, 0x9a, 0x38, 0xc8, 0x04, 0x69,
+    0x12, 0x86, 0x00, 0x9f, 0x43, 0x1f, 0x00, 0x2b, 0x49, 0x81, 0xa0, 0x03, 0x49, 0xa8, 0x24, 0x02,
+    0xd2, 0x7a, 0x35, 0x00, 0x95, 0xe5, 0xf8, 0x03, 0x00, 0x06, 0xf3, 0x01, 0xf8, 0x07, 0x0b, 0x06,
+    0x0a, 0x01, 0x55, 0x05, 0x91, 0x00, 0x1c, 0x48, 0x6a, 0x01, 0x21, 0x50, 0x50, 0x02, 0xbc, 0x84,
+    0x88, 0x0c, 0xb2, 0x61, 0x40, 0x0f, 0x36, 0xb0, 0x50, 0x07, 0x9b, 0x52, 0x10, 0x01, 0x99, 0x0d,
+    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb,
+    0xff, 0x9e, 0x77, 0x66, 0x00, 0x00, 0xeb, 0xff, 0x9e, 0x77, 0x66, 0x00, 0x00, 0xfc, 0xff, 0xfe,
+    0xd6, 0xdd, 0xf7, 0x80, 0x00, 0xfb, 0xff, 0xcf, 0xbb, 0xe6, 0x00, 0x00, 0xff, 0xe0, 0xff, 0xff,
+    0xf0, 0x77, 0x7f, 0xf8, 0x20, 0x00, 0xff, 0xe0, 0xff, 0xff, 0xf0, 0x77, 0x7f, 0xf8, 0x20, 0x9a,
+    0x7b, 0x00, 0xff, 0xf8, 0x00, 0x2e, 0xee, 0xb2, 0xff, 0xea, 0x2f, 0xfe, 0xa2, 0xff, 0xea, 0x00,
+    0x0b, 0x40, 0x46, 0x40, 0x26, 0xb0, 0x00, 0x04, 0x11, 0x59, 0xa8, 0x91, 0x1c, 0x00, 0x14, 0x04,
+    0xb0, 0x25, 0x0d, 0xc0, 0x00, 0x9a, 0x0c, 0x70, 0x52, 0x00, 0x58, 0x00, 0x0b, 0x48, 0x70, 0x46,
+    0x52, 0x40, 0x32, 0x76, 0xb0, 0xb2, 0x00, 0x04, 0x14, 0x21, 0xb3, 0xb7, 0x51, 0x30, 0x52, 0x75,
+    0x40, 0x00, 0x14, 0x04, 0x14, 0xb2, 0xb0, 0x25, 0x72, 0x1d, 0xc2, 0x50, 0x00, 0x9a, 0x7d, 0x0c,
+    0x75, 0x20, 0x52, 0x20, 0x90, 0x58, 0x69, 0x80, 0x00, 0x3f, 0x00, 0x7e, 0x5f, 0x81, 0xfc, 0x5d,
+    0x71, 0xdd, 0x01, 0x78, 0x10, 0x80, 0x08, 0x80, 0x18, 0x5c, 0x03, 0x25, 0x00, 0x00, 0x00, 0x3f,
+    0x00, 0x7e, 0x5f, 0x81, 0xfc, 0x5d, 0x71, 0xdd, 0x01, 0x78, 0x10, 0xaf, 0xc0, 0xfe, 0x2e, 0xb8,
+    0xee, 0x80, 0xbc, 0xc8, 0x40, 0x04, 0x20, 0x18, 0x58, 0x00, 0x00, 0x00, 0x08, 0x01, 0x7f, 0x9c,
+    0x20, 0x01, 0x00, 0x20, 0x1b, 0xc8, 0x68, 0x00, 0x28, 0x00, 0xcf, 0xc8, 0x01, 0x0e, 0x80, 0x0b,
+    0x24, 0x0b, 0x4c, 0x00, 0x00, 0x2b, 0x21, 0x51, 0x00, 0x2b, 0x22, 0x58, 0x89, 0x44, 0x4a, 0x60,
+    0x2b, 0x22, 0x58, 0x9d, 0x88, 0x94, 0x44, 0xa6, 0xea, 0x60, 0x2b, 0x21, 0x51, 0x00, 0x00, 0x05,
+    0xed, 0x20, 0x00, 0xf1, 0x80, 0x7d, 0x5b, 0x52, 0x00, 0xb6, 0x30, 0x0f, 0x10, 0x1a, 0x28, 0x23,
+    0xc0, 0x07, 0xc4, 0x06, 0x8a, 0x15, 0xc0, 0x1f, 0xd5, 0xb5, 0x32, 0x73, 0x00, 0xfe, 0x5e, 0xd6,
+    0x78, 0xae, 0xa0, 0x4d, 0xd1, 0x80, 0x74, 0xd2, 0x3f, 0xb2, 0xd4, 0x5f, 0x00, 0x68, 0x74, 0xd4,
+    0x15, 0xd1, 0x47, 0x20, 0x08, 0xda, 0xc3, 0x50, 0x57, 0x45, 0x1c, 0x80, 0x2e, 0xb1, 0x05, 0x7e,
+    0x65, 0xab, 0x89, 0x00, 0x05, 0xed, 0x20, 0x00, 0xf1, 0x80, 0x7f, 0xd5, 0xb5, 0x20, 0x0b, 0x63,
+    0x00, 0xff, 0x10, 0x1a, 0x28, 0x23, 0xc0, 0x07, 0xfc, 0x40, 0x68, 0xa1, 0x5c, 0x01, 0xff, 0xc1,
+    0xad, 0xa9, 0x93, 0x98, 0x07, 0xff, 0x05, 0x7b, 0x59, 0xe2, 0xba, 0x81, 0x37, 0x46, 0x15, 0xd2,
+    0x01, 0xd3, 0x48, 0xfe, 0xcb, 0x51, 0x7c, 0xcc, 0xf4, 0x40, 0x05, 0x0e, 0x9a, 0x82, 0xba, 0x28,
+    0xe5, 0xe8, 0x2e, 0x60, 0x03, 0x6b, 0x0d, 0x41, 0x5d, 0x14, 0x72, 0xf4, 0x17, 0x30, 0x07, 0x58,
+    0x82, 0xbf, 0x32, 0xd5, 0xc4, 0xb3, 0xf3, 0xa0, 0x3f, 0x17, 0x11, 0x12, 0x01, 0x70, 0x00, 0x3f,
+    0x18, 0xd7, 0x11, 0x90, 0x90, 0x0f, 0xcb, 0x83, 0x10, 0x3f, 0x18, 0xd0, 0xc8, 0x71, 0x19, 0x00,
+    0xb4, 0x90, 0x0f, 0xc0, 0x50, 0xb8, 0x31, 0x01, 0xc4, 0x6e, 0x04, 0x10, 0x20, 0x20, 0x83, 0x00,
+    0x6e, 0x0a, 0xa2, 0x08, 0x6b, 0x10, 0x12, 0x08, 0x41, 0x99, 0x40, 0x6e, 0x0a, 0xa0, 0x7a, 0xa0,
+    0x86, 0xb0, 0x21, 0x10, 0x09, 0x04, 0x0f, 0x82, 0x0c, 0xca, 0x17, 0x80, 0x00, 0x6e, 0x00, 0x50,
+    0x8e, 0xc0, 0x6d, 0x13, 0x04, 0x00, 0x00, 0x56, 0x00, 0x21, 0x34, 0x15, 0xe8, 0x41, 0xc4, 0xc0,
+    0x05, 0x50, 0x80, 0x04, 0x9e, 0x00, 0x5f, 0x30, 0x02, 0xbe, 0x88, 0x02, 0x17, 0x40, 0x02, 0xaa,
+    0x00, 0x6a, 0xc8, 0x2b, 0x50, 0x00, 0x00, 0x89, 0xc0, 0x31, 0x4b, 0xc9, 0x50, 0x00, 0x5b, 0x3f,
+    0xcc, 0x02, 0x94, 0xde, 0x10, 0xa5, 0x2c, 0x42, 0xb9, 0x27, 0xd0, 0x70, 0xfd, 0x80, 0xcb, 0x61,
+    0x32, 0x10, 0x6f, 0x09, 0x6e, 0x10, 0x3f, 0x34, 0xf2, 0x00, 0x9c, 0x03, 0x08, 0x04, 0x20, 0x1f,
+    0xe3, 0x00, 0x18, 0x80, 0x7e, 0x2f, 0x12, 0xf1, 0x2b, 0x22, 0x58, 0x89, 0x44, 0x4a, 0x60, 0x06,
+    0xdf, 0xb1, 0x03, 0x95, 0xb6, 0xd0, 0x54, 0x84, 0xb3, 0x06, 0xba, 0x7e, 0x20, 0x08, 0xed, 0xe0,
+    0x02, 0x13, 0xb5, 0x00, 0xbd, 0x50, 0x03, 0x35, 0x80, 0x73, 0xc8, 0x07, 0x79, 0x80, 0x40, 0x9f,
+    0xfe, 0x68, 0xdd, 0xe7, 0x00, 0x00, 0xff, 0x9f, 0x5c, 0xc8, 0x86, 0xd7, 0xa0, 0xf7, 0x59, 0xba,
+    0xc8, 0x2c, 0x00, 0x36, 0xf6, 0x63, 0x7a, 0x44, 0x00, 0x01, 0x8b, 0xee, 0x64, 0xa0, 0x01, 0x78,
+    0xb6, 0xb6, 0x46, 0xac, 0x13, 0x69, 0x90, 0xd6, 0x3a, 0x00, 0x00, 0xd4, 0x01, 0xa0, 0x40, 0x22,
+    0x79, 0x00, 0xa5, 0xc8, 0x00, 0x88, 0xe0, 0x0a, 0xa2, 0x02, 0x0c, 0xae, 0xd0, 0x0d, 0x61, 0x12,
+    0x00, 0x00, 0x85, 0xc4, 0x03, 0xd1, 0x3a, 0x01, 0xc4, 0xa2, 0x24, 0x00, 0xc5, 0x67, 0x48, 0x01,
+    0x0b, 0xb6, 0x33, 0x88, 0x02, 0xa9, 0xa1, 0x13, 0xa0, 0x4e, 0x42, 0xaa, 0x11, 0x29, 0x59, 0xaa,
+    0xa8, 0x95, 0x40, 0x00, 0xd5, 0xfe, 0xdb, 0xdd, 0x78, 0x00, 0xf5, 0xb8, 0x07, 0x33, 0xb8, 0x03,
+    0x0c, 0x78, 0x07, 0x5b, 0x18, 0x06, 0x57, 0x80, 0x0c, 0x37, 0xc0, 0x1d, 0x6e, 0x60, 0x19, 0x1e,
+    0x40, 0x3a, 0xa4, 0x03, 0xa5, 0xd0, 0x03, 0x80, 0x0f, 0xf4, 0x00, 0x26, 0x40, 0x02, 0x10, 0x0f,
+    0xfe, 0x15, 0xc0, 0x02, 0x64, 0x00, 0x21, 0x00, 0xff, 0x5c, 0x06, 0xea, 0x40, 0x7f, 0xf0, 0xb4,
+    0x80, 0x04, 0x80, 0x3f, 0xf8, 0x4f, 0x60, 0x06, 0xa0, 0x00, 0x88, 0x03, 0xfc, 0xf6, 0x00, 0x6d,
+    0xd0, 0x80, 0x04, 0xcf, 0xd4, 0x00, 0x26, 0x7e, 0xa0, 0x15, 0xad, 0xa5, 0x91, 0x2d, 0x6d, 0x2c,
+    0x94, 0x65, 0x24, 0x11, 0x46, 0x52, 0x41, 0x1f, 0x80, 0x06, 0x0a, 0xfc, 0x00, 0x30, 0x50, 0x09,
+    0x31, 0xcc, 0x02, 0x4c, 0x73, 0x00, 0x15, 0xc4, 0x00, 0x22, 0xb8, 0x80, 0x04, 0xe0, 0xe0, 0x19,
+    0xc1, 0xc0, 0x32, 0x60, 0x07, 0x26, 0x00, 0x71, 0x40, 0x07, 0x14, 0x00, 0x73, 0x28, 0x80, 0x66,
+    0x51, 0x00, 0x00, 0x04, 0xdf, 0xd5, 0x03, 0xf3, 0x35, 0xa5, 0xa5, 0x10, 0x00, 0x6c, 0x65, 0x24,
+    0x10, 0x02, 0x8e, 0x00, 0x20, 0x20, 0x07, 0x96, 0xe0, 0x84, 0x03, 0x15, 0x43, 0x80, 0x79, 0xc1,
+    0xc0, 0x31, 0x80, 0x17, 0x80, 0x22, 0xe1, 0x00, 0x1d, 0x00, 0x45, 0x44, 0x00, 0x65, 0x10, 0x00,
+    0xa8, 0x80, 0x3f, 0x30, 0x5d, 0xfc, 0x40, 0x0c, 0x74, 0x96, 0xb6, 0x40, 0x01, 0xb1, 0x94, 0x90,
+    0x71, 0x00, 0x47, 0x00, 0x10, 0x1c, 0x03, 0xcb, 0x70, 0x40, 0x03, 0x00, 0x15, 0x4b, 0x80, 0x79,
+    0xc1, 0x80, 0x05, 0xc2, 0x00, 0x5e, 0x00, 0x8a, 0x88, 0x00, 0x96, 0x01, 0x0a, 0x88, 0x00, 0x90,
+    0x02, 0x00, 0xaf, 0xfb, 0xa3, 0x30, 0xe6, 0x46, 0x6f, 0x60, 0x0b, 0x84, 0x02, 0x32, 0x00, 0x9b,
+    0xc0, 0x21, 0x20, 0x08, 0x84, 0x03, 0x30, 0x00, 0x80, 0xc0, 0x2f, 0xfb, 0xa0, 0x02, 0xa3, 0x17,
+    0x80, 0x03, 0xb8, 0x00, 0xa0, 0x1e, 0x30, 0x0f, 0x20, 0x07, 0x1d, 0x80, 0x51, 0xb8, 0x20, 0x11,
+    0x90, 0x07, 0xff, 0x10, 0x04, 0xcf, 0xfa, 0x02, 0xcc, 0x35, 0x00, 0xc0, 0x3c, 0x40, 0x1e, 0x1a,
+    0x10, 0xc4, 0x00, 0x2f, 0x73, 0xfa, 0x00, 0x2f, 0xfb, 0xa0, 0x02, 0xe3, 0x17, 0x60, 0x09, 0xc0,
+    0x1e, 0x01, 0xef, 0x00, 0x7a, 0x02, 0xb1, 0x77, 0xf7, 0xd0, 0x00, 0x00, 0x12, 0x00, 0x48, 0xdc,
+    0x24, 0x49, 0x87, 0xf4, 0x29, 0x22, 0x33, 0x0a, 0x64, 0xa3, 0x05, 0xa6, 0x13, 0x00, 0x3e, 0x31,
+    0x51, 0x2b, 0x20, 0x0f, 0x0f, 0x98, 0x9b, 0x02, 0x68, 0x4d, 0x80, 0x00, 0xff, 0xe0, 0x1d, 0x77,
+    0xfd, 0x6a, 0x00, 0x6c, 0x38, 0xba, 0x82, 0xbb, 0x03, 0xf4, 0xb2, 0x2b, 0xcf, 0x48, 0x08, 0x80,
+    0x3e, 0x20, 0x0f, 0xff, 0xf8, 0x05, 0x1a, 0xe6, 0x24, 0x8d, 0x78, 0x11, 0x54, 0xce, 0xdb, 0x82,
+    0xd0, 0x03, 0xef, 0x66, 0x37, 0xa4, 0x40, 0x00, 0x52, 0x80, 0x1e, 0x40, 0xb0, 0x9c, 0x56, 0x20,
+    0x4a, 0xc4, 0x72, 0x4f, 0xe9, 0x1c, 0x44, 0x1d, 0x63, 0x00, 0x90, 0x80, 0x32, 0x10, 0x00, 0x87,
+    0x58, 0xc1, 0xfd, 0x23, 0x89, 0x64, 0x8e, 0x49, 0xf5, 0x62, 0x06, 0xf4, 0x65, 0x86, 0x00, 0x00,
+    0xf3, 0xd8, 0x00, 0x80, 0x22, 0x99, 0x01, 0xed, 0x00, 0x26, 0x08, 0x04, 0x5a, 0x0c, 0xec, 0x00,
+    0x2e, 0x71, 0x8e, 0x00, 0xf5, 0x49, 0x00, 0x72, 0xb3, 0x80, 0x80, 0x43, 0x7c, 0x07, 0xd6, 0x00,
+    0xb6, 0x30, 0x22, 0x18, 0x23, 0xc0, 0x00, 0x76, 0x00, 0x00, 0xfe, 0x1b, 0xfd, 0x84, 0x15, 0x11,
+    0x7f, 0xc3, 0x7d, 0x64, 0x08, 0x05, 0x3f, 0xbc, 0x60, 0x00, 0xff, 0xe0, 0x15, 0x77, 0xfd, 0x8c,
+    0x00, 0x5c, 0x08, 0xbb, 0x4a, 0xc6, 0x02, 0x7d, 0x32, 0x21, 0xa7, 0xb8, 0x00, 0x01, 0x2b, 0x33,
+    0x00, 0x17, 0x17, 0x64, 0x0a, 0x84, 0x65, 0x82, 0xc1, 0x00, 0x4c, 0x82, 0x88, 0x56, 0x04, 0x27,
+    0x4e, 0x74, 0x00, 0x3f, 0x18, 0xd0, 0xc8, 0x1f, 0x47, 0x11, 0x90, 0x0b, 0x4c, 0x10, 0x90, 0x0f,
+    0xc0, 0x51, 0x88, 0x0b, 0x83, 0x10, 0x1c, 0x5e, 0x00, 0x00, 0x02, 0xbf, 0xd6, 0x00, 0xde, 0x1a,
+    0xb2, 0x40, 0x02, 0x24, 0x14, 0x51, 0x80, 0x18, 0x09, 0xbe, 0xbb, 0xdd, 0xc0, 0x40, 0x0e, 0xe9,
+    0xcc, 0x68, 0x00, 0x23, 0x00, 0x35, 0xe4, 0x3f, 0xdc, 0x00, 0x3e, 0x80, 0xdd, 0x60, 0x06, 0x10,
+    0x33, 0x80, 0x3d, 0xdd, 0x38, 0x00, 0xe9, 0x18, 0x00, 0x8e, 0xf9, 0xb3, 0x00, 0x04, 0xc0, 0x46,
+    0x3a, 0x10, 0x95, 0xb3, 0x94, 0x08, 0x32, 0x80, 0x02, 0x7d, 0x62, 0x81, 0x26, 0x6a, 0xa2, 0x80,
+    0x58, 0x80, 0x19, 0x40, 0xc4, 0xbc, 0x0d, 0x0c, 0x7b, 0x88, 0xe3, 0x9a, 0x1a, 0x59, 0x6f, 0xa3,
+    0x60, 0x6a, 0xe7, 0x0d, 0x84, 0x02, 0x55, 0x9d, 0x44, 0x00, 0x00, 0x25, 0xfe, 0xc0, 0x04, 0xb6,
+    0x32, 0xad, 0x60, 0x0b, 0x6a, 0x68, 0xa4, 0x54, 0x18, 0x00, 0x93, 0x1c, 0x80, 0x42, 0xce, 0x2c,
+    0x80, 0x32, 0x71, 0xf8, 0x10, 0x08, 0x01, 0x2d, 0x45, 0x06, 0x00, 0x1a, 0x7a, 0x81, 0x6d, 0x41,
+    0xda, 0x6a, 0x0b, 0x62, 0x08, 0xfa, 0x00, 0x0b, 0xff, 0xe6, 0x00, 0x1d, 0xde, 0x70, 0x03, 0x22,
+    0x61, 0x00, 0xff, 0x08, 0x07, 0xc9, 0xff, 0x84, 0x00, 0x79, 0x98, 0x79, 0x0f, 0x4c, 0xe0, 0xe4,
+    0x5e, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x36, 0xfd, 0x88, 0x01, 0x25, 0x29, 0xb4, 0x01, 0xa5, 0x2b,
+    0x26, 0x20, 0x6c, 0x00, 0x4e, 0x18, 0x54, 0xff, 0x28, 0x84, 0x31, 0xff, 0x94, 0x01, 0x0c, 0x7f,
+    0xe5, 0x00, 0x44, 0x0b, 0xfc, 0xa2, 0x05, 0x6c, 0x66, 0x5e, 0x1a, 0x34, 0xcc, 0x53, 0x08, 0x00,
+    0xf2, 0x08, 0x04, 0x2a, 0x04, 0x66, 0xb2, 0x30, 0x01, 0x54, 0xee, 0x68, 0x66, 0x24, 0x03, 0x7b,
+    0x8b, 0xfb, 0x30, 0x02, 0xb0, 0xe0, 0xa0, 0xa0, 0x20, 0x01, 0x85, 0x01, 0x80, 0x7c, 0x46, 0x01,
+    0xfd, 0x44, 0x01, 0xfc, 0xd4, 0x01, 0xe3, 0xf4, 0x37, 0xf1, 0x03, 0xf2, 0x00, 0x0f, 0xc0, 0x0d,
+    0xb0, 0x01, 0x1a, 0x80, 0x7e, 0x18, 0x00, 0xfd, 0x24, 0xe0, 0x1d, 0xa1, 0x01, 0x1f, 0xc4, 0xee,
+    0xd0, 0x9f, 0x25, 0xe2, 0x77, 0x68, 0x4f, 0x12, 0xf9, 0x3b, 0xb4, 0x27, 0xbd, 0x48, 0x8e, 0xe0,
+    0x0e, 0xb3, 0x20, 0x0f, 0x86, 0xc0, 0x20, 0x2f, 0xfd, 0x88, 0x01, 0xf4, 0x65, 0x3d, 0x9c, 0x60,
+    0x06, 0x33, 0x2d, 0x95, 0x80, 0x7f, 0x85, 0xdc, 0x7e, 0x40, 0x1c, 0xc7, 0x2c, 0x7c, 0x40, 0x0b,
+    0xff, 0x4b, 0xb0, 0x80, 0x80, 0x53, 0x9b, 0xf0, 0x01, 0xf1, 0x19, 0x00, 0x7f, 0xf0, 0xfc, 0x88,
+    0x01, 0xfc, 0xc5, 0xa4, 0x00, 0x2f, 0xfd, 0xaa, 0x01, 0xfd, 0x19, 0x6f, 0x48, 0x01, 0xf8, 0xcc,
+    0x94, 0x7c, 0x01, 0xff, 0xc0, 0x70, 0x05, 0x77, 0x20, 0x03, 0xca, 0x9e, 0xe9, 0xb4, 0xec, 0x00,
+    0xbf, 0xf5, 0x3a, 0x88, 0x01, 0x35, 0x00, 0x13, 0x90, 0x14, 0x0c, 0xf9, 0xf0, 0x60, 0x02, 0x37,
+    0x1b, 0x00, 0x4f, 0x52, 0x48, 0x07, 0x43, 0x14, 0xe8, 0x21, 0x88, 0x07, 0x30, 0xc4, 0x1f, 0xfc,
+    0xf0, 0x00, 0xba, 0x00, 0xab, 0xc0, 0x24, 0xf1, 0xd4, 0x00, 0x94, 0x10, 0x01, 0xa6, 0x28, 0x24,
+    0x06, 0x05, 0xa0, 0x04, 0x40, 0x70, 0x6f, 0xe0, 0x13, 0x7f, 0x89, 0xc7, 0x11, 0x7d, 0x1a, 0xc3,
+    0xa8, 0x38, 0x40, 0xd8, 0x1b, 0x94, 0x0c, 0xc2, 0x20, 0xb7, 0x3e, 0x28, 0xf0, 0xd9, 0x1e, 0x1a,
+    0xd0, 0x71, 0xef, 0x54, 0x18, 0xf1, 0x11, 0x23, 0x20, 0x8b, 0x90, 0x58, 0x40, 0x2d, 0x0f, 0x00,
+    0x20, 0x18, 0x80, 0x00, 0x1f, 0xfd, 0xce, 0x15, 0x60, 0x09, 0xdc, 0x78, 0x10, 0x0c, 0x4b, 0x76,
+    0x02, 0x00, 0xed, 0x30, 0x0f, 0xf1, 0xa0, 0x88, 0x03, 0x9c, 0xa1, 0x94, 0xc0, 0x31, 0xe6, 0x2c,
+    0xa4, 0x00, 0xe9, 0xb0, 0x0f, 0xfe, 0x04, 0xf3, 0x24, 0x82, 0x6b, 0xa2, 0xa4, 0x8d, 0xbe, 0xe9,
+    0x40, 0x0e, 0x34, 0x6e, 0x80, 0x0e, 0x30, 0x08, 0xc0, 0x1c, 0x60, 0x11, 0x80, 0x1c, 0x68, 0xdd,
+    0x00, 0x03, 0x6f, 0xba, 0x60, 0x09, 0x37, 0xaa, 0x6c, 0x00, 0x45, 0xe0, 0x4d, 0xde, 0x80, 0x00,
+    0x00, 0x9b, 0x7e, 0xcc, 0x00, 0xf2, 0xb2, 0x14, 0x03, 0x11, 0x35, 0xc0, 0x38, 0x38, 0x04, 0x35,
+    0x21, 0xdd, 0x30, 0x52, 0xa7, 0x74, 0xc1, 0x4a, 0x9f, 0xe9, 0x00, 0x55, 0x03, 0x3e, 0x40, 0x25,
+    0x3d, 0x85, 0x96, 0x00, 0x6b, 0xb5, 0x2a, 0x80, 0x06, 0xf0, 0x08, 0xfe, 0x40, 0x3c, 0x5a, 0x92,
+    0x01, 0xc3, 0xe5, 0x60, 0x1e, 0xd0, 0xd0, 0x0b, 0x64, 0x3c, 0xcb, 0xbf, 0x43, 0xdc, 0x00, 0x43,
+    0x98, 0xf0, 0x2e, 0x0a, 0xf1, 0xb3, 0x20, 0x0c, 0xa5, 0x2e, 0x60, 0x1f, 0x32, 0x70, 0x07, 0xea,
+    0x3a, 0x00, 0xaf, 0xff, 0x5c, 0x5d, 0x8c, 0xd7, 0x68, 0x24, 0x43, 0x3a, 0x20, 0xc0, 0x32, 0xf2,
+    0x00, 0x06, 0x94, 0xf1, 0x00, 0x07, 0x88, 0x7e, 0x80, 0x03, 0xf4, 0x3f, 0x40, 0x01, 0xf2, 0x31,
+    0x00, 0x44, 0xe2, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x99, 0x40, 0x3f, 0xf8, 0x49, 0x53, 0x5f, 0x90,
+    0x01, 0xff, 0x11, 0x8a, 0x65, 0x36, 0x80, 0x7f, 0x9a, 0x4c, 0x4d, 0xbc, 0xe0, 0x03, 0xff, 0x86,
+    0x2c, 0xc0, 0x04, 0xf7, 0x24, 0x03, 0xfd, 0xc2, 0x12, 0x95, 0x6f, 0x20, 0x1f, 0xfc, 0x06, 0x94,
+    0x56, 0x60, 0x07, 0xf7, 0x09, 0x02, 0x80, 0x30, 0x04, 0xaf, 0x88, 0x03, 0x2b, 0x80, 0x14, 0x01,
+    0x80, 0x34, 0xb2, 0x0e, 0xa9, 0x45, 0x60, 0x09, 0x45, 0x66, 0x05, 0x2c, 0x24, 0x4d, 0x8e, 0x10,
+    0x02, 0xe6, 0xd2, 0x40, 0xaf, 0xed, 0x73, 0xec, 0xc0, 0x24, 0xde, 0xa0, 0x0f, 0xfe, 0xd0, 0x0c,
+    0xff, 0xb1, 0x00, 0x32, 0x65, 0xb5, 0x88, 0x51, 0xa6, 0xd2, 0x87, 0x25, 0x1b, 0x77, 0x3c, 0x25,
+    0x28, 0xdb, 0xb9, 0xe1, 0x29, 0x46, 0xdd, 0xec, 0x1c, 0x80, 0x06, 0xfe, 0x7a, 0x10, 0x09, 0x77,
+    0x5c, 0xa0, 0x18, 0xc8, 0x80, 0x1f, 0xfc, 0x10, 0x00, 0xc2, 0x01, 0xfa, 0xd8, 0x03, 0x8e, 0xd6,
+    0x68, 0x40, 0x09, 0x8e, 0x48, 0x8f, 0x10, 0xa4, 0xc7, 0xdf, 0x18, 0x41, 0x80, 0x08, 0x73, 0x04,
+    0x06, 0x01, 0x8d, 0x40, 0x3a, 0x7f, 0xe2, 0x02, 0x00, 0x3e, 0xb1, 0x21, 0x40, 0x03, 0x89, 0x1c,
+    0x25, 0x6d, 0xf3, 0x07, 0x60, 0x98, 0x24, 0x8b, 0xe2, 0x00, 0x3a, 0x58, 0x91, 0x00, 0x00, 0xab,
+    0xd8, 0x03, 0xca, 0x54, 0x01, 0xca, 0x12, 0x64, 0x01, 0xb9, 0x50, 0x54, 0x01, 0x5e, 0x8b, 0xc3,
+    0x1e, 0xd5, 0x40, 0xee, 0x50, 0x73, 0x06, 0x08, 0x81, 0xc1, 0x02, 0x98, 0x7b, 0x9a, 0x14, 0xd2,
+    0x19, 0xdc, 0xf7, 0x06, 0x93, 0x30, 0x05, 0x20, 0xc0, 0x00, 0x57, 0x7e, 0x18, 0x02, 0x16, 0x2c,
+    0x38, 0x01, 0x78, 0xc8, 0xa2, 0x0b, 0x98, 0xff, 0x31, 0xca, 0xee, 0xfa, 0x17, 0x77, 0xd0, 0xac,
+    0x3b, 0xba, 0x01, 0x50, 0x88, 0x0a, 0x00, 0x55, 0x32, 0xf4, 0x88, 0x42, 0xc5, 0x06, 0x80, 0x00,
+    0xca, 0x60, 0x1f, 0x75, 0x80, 0x73, 0xf2, 0x3f, 0x28, 0x01, 0xe2, 0x51, 0xdd, 0x48, 0x31, 0x07,
+    0x1e, 0x93, 0xf5, 0x06, 0x00, 0xd9, 0x66, 0x02, 0x01, 0xe1, 0x00, 0xfc, 0xa0, 0x80, 0x19, 0x58,
+    0xcd, 0x00, 0x11, 0x57, 0x07, 0x17, 0x3d, 0xe9, 0x40, 0x17, 0xc9, 0x8c, 0x68, 0x04, 0x2e, 0x94,
+    0xe0, 0x00, 0x9f, 0xff, 0x55, 0xe6, 0x7a, 0x2f, 0x33, 0xd1, 0x0c, 0xc2, 0x1e, 0x62, 0x04, 0xcc,
+    0x2e, 0x66, 0x20, 0x0f, 0xfe, 0xe0, 0x37, 0x7e, 0x3b, 0xb4, 0xc4, 0x34, 0x27, 0xb1, 0x83, 0x8a,
+    0x37, 0x4c, 0x16, 0xf3, 0xfe, 0x60, 0xe6, 0x9e, 0xf7, 0xa1, 0x0a, 0x15, 0xe5, 0x00, 0x1c, 0xaa,
+    0x80, 0x33, 0x32, 0x8c, 0x03, 0x4a, 0x68, 0x80, 0x04, 0xf2, 0x10, 0x0e, 0x9f, 0x00, 0x1c, 0x00,
+    0xe8, 0x01, 0x1c, 0x36, 0x00, 0x0c, 0x41, 0x38, 0x00, 0x94, 0x0c, 0x73, 0x78, 0x90, 0x0a, 0xa8,
+    0x01, 0xc8, 0x80, 0x09, 0x2c, 0xac, 0x02, 0x80, 0xd2, 0x00, 0x00, 0xc6, 0x20, 0x1e, 0x1c, 0x50,
+    0x0e, 0x28, 0x0e, 0x30, 0x08, 0xb1, 0x01, 0xf1, 0x40, 0x12, 0xb8, 0x12, 0xd6, 0x02, 0x9e, 0x01,
+    0x40, 0xa1, 0x03, 0x00, 0x42, 0x04, 0xe0, 0x60, 0x18, 0x40, 0x03, 0xff, 0xd6, 0x40, 0x1a, 0xb2,
+    0xc3, 0x04, 0x02, 0x73, 0x49, 0x14, 0x00, 0xf1, 0x80, 0x70, 0x80, 0xc0, 0x3d, 0x60, 0x67, 0xf3,
+    0xd1, 0x44, 0x85, 0x66, 0xf2, 0x85, 0xc8, 0x56, 0x88, 0x05, 0x14, 0x17, 0xe6, 0x01, 0x0b, 0x03,
+    0x08, 0x06, 0x00, 0x00, 0xb8, 0xbc, 0x03, 0x98, 0x74, 0x20, 0x02, 0x69, 0x0a, 0x07, 0x90, 0x04,
+    0x38, 0xb8, 0x4b, 0x09, 0x0d, 0x80, 0x4e, 0x08, 0x00, 0x1a, 0x2b, 0x1b, 0x42, 0x06, 0x40, 0x40,
+    0x41, 0x04, 0xe0, 0x0f, 0xb5, 0x69, 0x4c, 0xe1, 0x39, 0x05, 0xac, 0xc9, 0x00, 0x00, 0x10, 0x10,
+    0x07, 0x4a, 0x71, 0x80, 0x0b, 0xd2, 0xcf, 0x98, 0x02, 0x9c, 0xb7, 0x93, 0x00, 0x11, 0xa5, 0x02,
+    0x80, 0x73, 0x82, 0x00, 0x2f, 0xfd, 0x14, 0x40, 0x09, 0xdc, 0x7a, 0x60, 0x01, 0x10, 0xe1, 0x68,
+    0x03, 0xfc, 0x46, 0x90, 0xb6, 0x00, 0x9c, 0xb6, 0x87, 0x2f, 0x4b, 0x3d, 0x70, 0x0a, 0x53, 0x8c,
+    0x00, 0x00, 0x03, 0xce, 0xa1, 0x2c, 0xbd, 0x21, 0x54, 0x73, 0x80, 0xf1, 0x00, 0xd6, 0xa8, 0x08,
+    0x07, 0x37, 0xf2, 0x42, 0x9b, 0x7e, 0x73, 0xba, 0xbd, 0xb0,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14, .adv_w = 96, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 23, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 64, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 114, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 168, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 211, .adv_w = 48, .box_w = 2, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 216, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 242, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 269, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 288, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 308, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 315, .adv_w = 96, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 322, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 326, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 356, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 394, .adv_w = 80, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 405, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 441, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 480, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 514, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 553, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 593, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 623, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 662, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 702, .adv_w = 48, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 712, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 725, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 753, .adv_w = 128, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 768, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 795, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 828, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 907, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 948, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 985, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1028, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1064, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1093, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1118, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1163, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1182, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1187, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1207, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1244, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1255, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1301, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1334, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1380, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1412, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1465, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1500, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1542, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1557, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1581, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1623, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1688, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1731, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1763, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1797, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1810, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1839, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1852, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 1865, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1869, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 1873, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1898, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1929, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1954, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1984, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2009, .adv_w = 64, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2025, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2061, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2083, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2093, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2110, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2136, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2141, .adv_w = 176, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2166, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2184, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2210, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2243, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2274, .adv_w = 64, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2287, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2309, .adv_w = 64, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2325, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2344, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2369, .adv_w = 160, .box_w = 10, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2406, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2431, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2465, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2487, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2519, .adv_w = 64, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2524, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2557, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2572, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2573, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2586, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2619, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2661, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2697, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2731, .adv_w = 48, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2741, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2788, .adv_w = 112, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 2794, .adv_w = 192, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2857, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 2870, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2892, .adv_w = 128, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2900, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2933, .adv_w = 80, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 2938, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 2951, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2976, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2989, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3002, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 3006, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3033, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3058, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3062, .adv_w = 64, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3069, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3076, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3091, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3113, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3164, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3212, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3271, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3303, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3350, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3397, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3449, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3498, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3551, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3602, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3653, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3707, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3744, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3781, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3822, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3862, .adv_w = 48, .box_w = 4, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3872, .adv_w = 48, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3881, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3895, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3909, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3951, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3992, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4048, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4103, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4159, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4216, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4274, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4300, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4358, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4391, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4425, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4461, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4498, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4537, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4570, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4607, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4640, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4673, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4709, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4744, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4780, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4815, .adv_w = 176, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4855, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4889, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4922, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4956, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4992, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5028, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5040, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5052, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5065, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5078, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5116, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5145, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5179, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5214, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5250, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5287, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5324, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5344, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5374, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5401, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5429, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5459, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5489, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5531, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5568, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5613, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5661, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5693, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5745, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5780, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5831, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5864, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5916, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5950, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6002, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6038, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6089, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6123, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6176, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6212, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6260, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6302, .adv_w = 160, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6344, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6383, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6420, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6452, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6492, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6527, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6565, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6599, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6637, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6671, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6713, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6748, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6803, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6850, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6905, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6951, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7004, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7049, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7105, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7151, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7182, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7215, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7245, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7275, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7286, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7300, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7310, .adv_w = 48, .box_w = 5, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7320, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7333, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7346, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7356, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7374, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7384, .adv_w = 48, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7389, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7413, .adv_w = 96, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7436, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7468, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7488, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7536, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7571, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7594, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7611, .adv_w = 48, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7621, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7642, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7652, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7671, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7683, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7703, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7718, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7744, .adv_w = 48, .box_w = 5, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7760, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7800, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7827, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7871, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7899, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7944, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7973, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8015, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8041, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8095, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8128, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8185, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8221, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8279, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8316, .adv_w = 208, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8367, .adv_w = 192, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8410, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8452, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8472, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8517, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8537, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8583, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8603, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8653, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8683, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8735, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8766, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8818, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8848, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8900, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8931, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8954, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8982, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9010, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9033, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9062, .adv_w = 64, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9081, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9117, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9147, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9179, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9205, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9241, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9270, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9306, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9335, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9371, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9401, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9434, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9462, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9540, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9589, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9632, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9677, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9721, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9763, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9793, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9836, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9866, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9913, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9944, .adv_w = 48, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9953, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10007, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10042, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10088, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10126, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10174, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10214, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10262, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10304, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10364, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10407, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10452, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10487, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10533, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10573, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10620, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10660, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10706, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10746, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10793, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10834, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10880, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10920, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10966, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11007, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11045, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11080, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11119, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11155, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11204, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11249, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11282, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11304, .adv_w = 160, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11355, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11398, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11427, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11457, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11487, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11519, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11551, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11584, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11613, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11644, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11676, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11709, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11722, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 11742, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11761, .adv_w = 48, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11779, .adv_w = 128, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11823, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11854, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11902, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11938, .adv_w = 128, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11987, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12023, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12042, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12052, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12079, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12096, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12116, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12128, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12148, .adv_w = 48, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 12161, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12216, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12252, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12309, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12345, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12404, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12442, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12484, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12511, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12555, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12583, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12628, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12656, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12701, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12730, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12793, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12835, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12901, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12945, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13008, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13049, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13112, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13153, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13192, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13234, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13274, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13316, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13360, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13381, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13426, .adv_w = 64, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13446, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13500, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13525, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13572, .adv_w = 64, .box_w = 6, .box_h = 10, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 13594, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13644, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13673, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13724, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13754, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13806, .adv_w = 96, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13842, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13900, .adv_w = 96, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13936, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13996, .adv_w = 96, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14034, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14058, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14081, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14104, .adv_w = 64, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14127, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14151, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14178, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14201, .adv_w = 64, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14229, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14265, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14295, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14331, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14361, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14396, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14426, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14468, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14503, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14546, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14582, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14633, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14669, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14720, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14753, .adv_w = 208, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14826, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14873, .adv_w = 208, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14946, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14993, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15072, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15122, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15198, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15245, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15322, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15370, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15422, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15456, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15512, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15548, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15589, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15632, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15678, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15709, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15752, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15782, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15827, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15857, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15889, .adv_w = 64, .box_w = 6, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15920, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15971, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16016, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16050, .adv_w = 48, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16066, .adv_w = 64, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16083, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16122, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16158, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16209, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16243, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16293, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16327, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16384, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16425, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16481, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16522, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16578, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16619, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16676, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16718, .adv_w = 144, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16781, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16826, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16880, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16920, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16975, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17016, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17071, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17112, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17168, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17210, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17269, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17313, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17350, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17385, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17422, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17456, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17493, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17529, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17573, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17614, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17657, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17698, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17742, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17784, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17829, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17872, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17921, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17966, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17976, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17986, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17996, .adv_w = 48, .box_w = 3, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18011, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18068, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18103, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18158, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18193, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18257, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18299, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18362, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18404, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18467, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18509, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18570, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18614, .adv_w = 160, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18681, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18727, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18786, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18821, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18880, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18916, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18975, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19011, .adv_w = 160, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19071, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19108, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19169, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19209, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19243, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19271, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19304, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19332, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19374, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19408, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19450, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19485, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19527, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19561, .adv_w = 144, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19605, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19640, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19685, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19723, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19762, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19805, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19845, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19880, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19922, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19965, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20005, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20050, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20066, .adv_w = 112, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20086, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20120, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20156, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20201, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20242, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20243, .adv_w = 224, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20244, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20245, .adv_w = 208, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20246, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20247, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20248, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20249, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20250, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20251, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20252, .adv_w = 16, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20253, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20254, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20261, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20268, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 20276, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20283, .adv_w = 208, .box_w = 13, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20293, .adv_w = 208, .box_w = 13, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20303, .adv_w = 96, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 20309, .adv_w = 96, .box_w = 7, .box_h = 4, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 20320, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20327, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20334, .adv_w = 32, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20341, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20348, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20359, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20370, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20381, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20392, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 20414, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20443, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 20456, .adv_w = 96, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 20469, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20473, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20480, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20490, .adv_w = 48, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 20494, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20495, .adv_w = 256, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20564, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20648, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20655, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20665, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20681, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20688, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20699, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20716, .adv_w = 96, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20726, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20742, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20758, .adv_w = 144, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20790, .adv_w = 96, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20815, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20847, .adv_w = 96, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 20853, .adv_w = 160, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20873, .adv_w = 160, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 20890, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 20913, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20947, .adv_w = 96, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 20953, .adv_w = 32, .box_w = 8, .box_h = 10, .ofs_x = -3, .ofs_y = 0},
+    {.bitmap_index = 20984, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21005, .adv_w = 64, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21026, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21091, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21138, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21186, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21210, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21236, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 21255, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 21275, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21294, .adv_w = 48, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 21307, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21351, .adv_w = 112, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 21391, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21433, .adv_w = 144, .box_w = 9, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 21449, .adv_w = 160, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 21469, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 21491, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 21513, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21514, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21557, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21610, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21655, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21685, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21727, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 21773, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21815, .adv_w = 176, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21861, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21922, .adv_w = 192, .box_w = 13, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21988, .adv_w = 176, .box_w = 10, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22017, .adv_w = 112, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22064, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22104, .adv_w = 144, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22146, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22183, .adv_w = 288, .box_w = 18, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22271, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22312, .adv_w = 160, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 22366, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22409, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22447, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 22498, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22518, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22552, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22586, .adv_w = 144, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22618, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22659, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22701, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 22754, .adv_w = 96, .box_w = 6, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_9[] = {
+    0x0, 0x8,
+};
+
+static const uint8_t glyph_id_ofs_list_11[] = {
+    0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 0, 8, 9, 10, 11, 12,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 160, .range_length = 13, .glyph_id_start = 96,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 174, .range_length = 155, .glyph_id_start = 109,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 330, .range_length = 54, .glyph_id_start = 264,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7680, .range_length = 156, .glyph_id_start = 318,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7837, .range_length = 99, .glyph_id_start = 474,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8192, .range_length = 12, .glyph_id_start = 573,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8208, .range_length = 24, .glyph_id_start = 585,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8239, .range_length = 39, .glyph_id_start = 609,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8279, .range_length = 9, .glyph_id_start = 648,
+     .unicode_list = unicode_list_9, .glyph_id_ofs_list = NULL, .list_length = 2,
+     .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},
+    {.range_start = 8352, .range_length = 16, .glyph_id_start = 650,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8369, .range_length = 16, .glyph_id_start = 666,
+     .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_11, .list_length = 16,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 12,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_medium_13_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 19,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
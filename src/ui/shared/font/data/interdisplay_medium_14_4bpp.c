@@ -0,0 +1,2420 @@
+/*
+ * interdisplay_medium_14_4bpp - generated by script/binfont_to_c.py from interdisplay_medium_14_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x2f, 0x60, 0x01, 0x80, 0x78, 0xc0, 0x30, 0x80, 0x78, 0x7d, 0x0f, 0xd8, 0x44, 0x60, 0xd7,
+    0x8d, 0x00, 0x78, 0x8c, 0x0e, 0xc6, 0x42, 0x00, 0x00, 0x2e, 0x80, 0x31, 0x80, 0x2d, 0x70, 0x01,
+    0x28, 0x04, 0x44, 0x01, 0x11, 0x02, 0x7a, 0xbf, 0xf0, 0x73, 0x2d, 0x84, 0xdb, 0x15, 0xb8, 0xa8,
+    0x3a, 0x0b, 0xa0, 0x82, 0x88, 0x80, 0x88, 0x00, 0xeb, 0x1f, 0xf2, 0xbe, 0x86, 0xaa, 0x66, 0x02,
+    0xbc, 0x0c, 0x70, 0xc4, 0x14, 0x80, 0x0c, 0x60, 0xc2, 0x01, 0x00, 0x00, 0x85, 0xc0, 0x3e, 0x28,
+    0x00, 0xf4, 0xe8, 0x6b, 0x00, 0x56, 0xc8, 0x03, 0x2a, 0x04, 0x93, 0x20, 0xc3, 0x90, 0x10, 0x30,
+    0x0a, 0x2c, 0x08, 0x2e, 0xc0, 0x04, 0x70, 0x1b, 0x07, 0x0b, 0x50, 0x09, 0x3a, 0x01, 0x2a, 0x40,
+    0x32, 0x07, 0xab, 0x13, 0x78, 0x80, 0x5c, 0x02, 0x81, 0x00, 0x17, 0x01, 0x94, 0x36, 0x07, 0xad,
+    0x00, 0x1f, 0x5c, 0x23, 0x54, 0x02, 0x2b, 0x07, 0x20, 0x00, 0x03, 0xee, 0x28, 0x04, 0xbc, 0x01,
+    0x6c, 0x55, 0x04, 0x06, 0xe8, 0x00, 0x22, 0x74, 0x15, 0x08, 0x44, 0x00, 0x04, 0x14, 0x85, 0x91,
+    0xec, 0x03, 0x55, 0xeb, 0x94, 0xc0, 0x80, 0x65, 0xfe, 0x88, 0x33, 0x00, 0x3e, 0x12, 0x79, 0x2c,
+    0xe6, 0x00, 0xee, 0x82, 0xf4, 0xa9, 0x20, 0x09, 0xc5, 0xc0, 0xa9, 0x09, 0xc0, 0x03, 0x1c, 0x00,
+    0x15, 0x32, 0x60, 0x05, 0x31, 0x80, 0x36, 0x72, 0x0c, 0x00, 0x4f, 0x71, 0xc0, 0x33, 0xb4, 0xbc,
+    0x18, 0x05, 0xa8, 0xf2, 0x0c, 0x01, 0x6a, 0x83, 0x82, 0x00, 0x4e, 0x7b, 0x38, 0x20, 0x11, 0x98,
+    0x9c, 0xc0, 0x80, 0x71, 0x29, 0x95, 0x34, 0x18, 0x29, 0x5e, 0xbc, 0x40, 0x21, 0x08, 0x34, 0x90,
+    0x50, 0xc6, 0x83, 0x0d, 0x02, 0xc1, 0x96, 0x7b, 0x56, 0x00, 0xd7, 0x00, 0x08, 0x98, 0xc0, 0x00,
+    0x3d, 0x00, 0x20, 0x81, 0x02, 0x83, 0x04, 0x81, 0x14, 0x00, 0x46, 0x00, 0x1f, 0x00, 0x84, 0x02,
+    0x10, 0x00, 0xf0, 0x01, 0x54, 0x00, 0xc3, 0x10, 0x60, 0x70, 0x15, 0xa0, 0x6b, 0x00, 0x2a, 0x20,
+    0x0c, 0xb8, 0x00, 0x8e, 0x00, 0xf2, 0x10, 0x50, 0x20, 0x10, 0x70, 0x30, 0x10, 0x30, 0x09, 0x81,
+    0x80, 0xc0, 0xc3, 0x0c, 0x05, 0x28, 0x18, 0x58, 0x00, 0x00, 0x0f, 0x80, 0x43, 0x66, 0x25, 0x60,
+    0x27, 0x83, 0x98, 0x00, 0x61, 0x81, 0x20, 0x0d, 0x48, 0xcf, 0x00, 0xf2, 0x8a, 0xe8, 0x04, 0x38,
+    0x01, 0x00, 0x00, 0x1f, 0x88, 0x07, 0xf0, 0x89, 0xc0, 0xc4, 0x5f, 0xd6, 0x1b, 0xd9, 0xb7, 0x21,
+    0x57, 0xc6, 0x8a, 0x08, 0x83, 0x00, 0xfe, 0x3b, 0x10, 0x00, 0x1c, 0x35, 0x32, 0x21, 0x8f, 0xa0,
+    0x00, 0x01, 0x1c, 0x07, 0xdd, 0x90, 0xee, 0xf2, 0x80, 0x00, 0x8f, 0xd4, 0x44, 0x00, 0x00, 0xb2,
+    0x00, 0x23, 0xc0, 0x02, 0x02, 0x00, 0x30, 0xc0, 0x24, 0x40, 0x04, 0x78, 0x00, 0x40, 0x40, 0x06,
+    0x18, 0x04, 0x88, 0x00, 0x8f, 0x00, 0x08, 0x08, 0x00, 0xc3, 0x00, 0x91, 0x00, 0x10, 0x00, 0x36,
+    0xfe, 0x18, 0x04, 0xb2, 0xf0, 0x18, 0x40, 0x0b, 0x5a, 0x7c, 0x18, 0x03, 0x1e, 0x00, 0x99, 0x41,
+    0x41, 0x40, 0x2d, 0x02, 0x00, 0x08, 0x04, 0x20, 0x18, 0x40, 0x21, 0x00, 0x28, 0x28, 0x05, 0xa0,
+    0x46, 0x3c, 0x01, 0x32, 0x80, 0x21, 0x69, 0xb0, 0x60, 0x00, 0xd2, 0xf2, 0x18, 0x40, 0x00, 0x01,
+    0xbf, 0x44, 0x7a, 0x80, 0x39, 0xb4, 0x01, 0x70, 0x01, 0x08, 0x07, 0xff, 0x58, 0x01, 0xae, 0xfa,
+    0x10, 0x06, 0xab, 0x42, 0x60, 0x19, 0xae, 0x1f, 0x49, 0x1c, 0xd0, 0x00, 0x40, 0x29, 0x80, 0x12,
+    0x03, 0x80, 0x62, 0xb5, 0x20, 0x08, 0xb0, 0xa8, 0x02, 0x3c, 0x2c, 0x00, 0x8f, 0x57, 0x00, 0x23,
+    0xc0, 0xd6, 0x68, 0xd0, 0x06, 0x67, 0x20, 0x00, 0x47, 0x7e, 0x18, 0x02, 0x9d, 0xa4, 0x30, 0x85,
+    0x62, 0x0d, 0xa1, 0x41, 0x0a, 0x00, 0x11, 0x00, 0xb9, 0x01, 0x48, 0xd0, 0x05, 0x9a, 0xd4, 0x40,
+    0x17, 0xd3, 0x52, 0x93, 0x81, 0xac, 0xac, 0x0c, 0x28, 0x04, 0x20, 0x66, 0xb7, 0x6a, 0x4b, 0x0d,
+    0x79, 0x93, 0xcb, 0x00, 0x00, 0xc7, 0xfe, 0x00, 0xf7, 0x00, 0x7d, 0x26, 0xe0, 0x1c, 0x8d, 0x5e,
+    0x01, 0xd4, 0xc8, 0x01, 0xd4, 0x72, 0x01, 0xc8, 0xb0, 0x22, 0xf0, 0x10, 0xe0, 0xae, 0xe3, 0x87,
+    0x3c, 0x5d, 0xe6, 0x0b, 0x52, 0x44, 0xdc, 0x08, 0x40, 0x1f, 0xc0, 0x0f, 0xff, 0x08, 0x81, 0xa6,
+    0x70, 0x98, 0x6b, 0x36, 0x01, 0x06, 0x00, 0xe7, 0x0a, 0xef, 0xd4, 0x01, 0x05, 0x8a, 0x1b, 0x27,
+    0x8c, 0x65, 0xd0, 0x53, 0x41, 0x00, 0x09, 0x72, 0x61, 0x80, 0x08, 0x9c, 0xa5, 0xb0, 0xf8, 0x2c,
+    0x18, 0x8d, 0x0b, 0x82, 0x00, 0x00, 0x36, 0xfe, 0x20, 0x01, 0xa5, 0xe5, 0xec, 0x82, 0x1a, 0x9a,
+    0xc6, 0x8c, 0x68, 0x02, 0xe8, 0x60, 0x6e, 0xfe, 0x50, 0x30, 0xa9, 0xb5, 0xa3, 0x00, 0x43, 0xa5,
+    0x8c, 0x90, 0x20, 0x04, 0xac, 0xa0, 0x80, 0x01, 0x55, 0x0b, 0x44, 0x1b, 0x06, 0xc2, 0x5d, 0xa4,
+    0x6c, 0x80, 0xaf, 0xff, 0x07, 0x44, 0x63, 0x00, 0x23, 0xbe, 0x26, 0x00, 0xe7, 0x18, 0x00, 0xe9,
+    0x51, 0x00, 0xcc, 0x30, 0x01, 0xd6, 0x84, 0x01, 0x94, 0xa0, 0x03, 0xa4, 0xcc, 0x01, 0x90, 0xe0,
+    0x03, 0xbc, 0x90, 0x03, 0x00, 0x00, 0x4f, 0x7d, 0x90, 0x02, 0x99, 0x92, 0xd8, 0x00, 0x57, 0x86,
+    0xe1, 0x40, 0x07, 0x80, 0x04, 0x02, 0x5a, 0x32, 0x82, 0x40, 0xa1, 0xcd, 0x4e, 0x00, 0x60, 0xd5,
+    0xae, 0x92, 0x9f, 0x2a, 0x58, 0x41, 0x80, 0x78, 0x5c, 0x79, 0x99, 0x63, 0xc3, 0x8d, 0x32, 0x7a,
+    0x50, 0x01, 0x9e, 0xfb, 0x10, 0x06, 0xb3, 0x21, 0x70, 0x10, 0xea, 0x1f, 0x49, 0x88, 0x14, 0x00,
+    0x63, 0x86, 0x04, 0x00, 0x11, 0x90, 0x7c, 0x89, 0xa0, 0xe3, 0x47, 0xba, 0x03, 0x70, 0x4e, 0xcd,
+    0xc1, 0x33, 0x69, 0x19, 0x21, 0x59, 0x9b, 0xdd, 0xd4, 0x86, 0x18, 0xd1, 0x2f, 0x60, 0x00, 0x2e,
+    0x51, 0x11, 0x9b, 0xd8, 0x03, 0xf8, 0xfd, 0x44, 0x40, 0x00, 0x2e, 0x50, 0x13, 0x2f, 0x60, 0x0f,
+    0xe2, 0xf4, 0x60, 0x43, 0x40, 0x06, 0x80, 0x00, 0xf1, 0x00, 0x64, 0xdb, 0x00, 0x1e, 0x58, 0xd1,
+    0x5e, 0x05, 0xe1, 0xea, 0x5e, 0x20, 0x01, 0xc2, 0x98, 0x02, 0x8e, 0x69, 0xe7, 0x00, 0x0c, 0x73,
+    0xc4, 0x80, 0x43, 0x3b, 0x80, 0x11, 0xf0, 0x57, 0x77, 0x54, 0x5d, 0xf4, 0x12, 0xaf, 0x1d, 0x77,
+    0x75, 0xc5, 0xdf, 0x40, 0x20, 0x0f, 0x4e, 0x18, 0x06, 0xf1, 0xcb, 0x30, 0x02, 0x6d, 0x3e, 0x51,
+    0x00, 0x17, 0x29, 0x70, 0x02, 0x7b, 0x18, 0x07, 0xe8, 0x6e, 0x6a, 0x87, 0xe8, 0x00, 0x7f, 0x48,
+    0x80, 0x40, 0x03, 0xcf, 0xe8, 0x01, 0xc1, 0x96, 0x79, 0x60, 0xc6, 0x86, 0x74, 0xa1, 0x00, 0x19,
+    0xca, 0x00, 0x65, 0xb0, 0x0a, 0x26, 0x4c, 0x00, 0x17, 0x86, 0x00, 0xc4, 0x80, 0x18, 0x74, 0xc0,
+    0x31, 0xfa, 0x80, 0x7f, 0x00, 0x00, 0x86, 0x37, 0xfd, 0x8e, 0x01, 0xe3, 0xf6, 0x49, 0x92, 0xcf,
+    0x10, 0x04, 0x58, 0xbd, 0x2c, 0xc9, 0xf5, 0xf0, 0x0a, 0x0a, 0xc2, 0xbf, 0x6a, 0xa3, 0x80, 0x15,
+    0x80, 0xa4, 0x95, 0x50, 0x0b, 0x30, 0x10, 0x10, 0x56, 0x9a, 0x10, 0x01, 0x62, 0x23, 0x01, 0x20,
+    0x50, 0x01, 0x80, 0x04, 0x08, 0x03, 0xfe, 0x30, 0x13, 0x01, 0x20, 0x50, 0x01, 0x80, 0x14, 0x09,
+    0x01, 0x05, 0x65, 0x61, 0x15, 0x50, 0x80, 0x2b, 0x01, 0x4f, 0x4b, 0x8b, 0x41, 0x40, 0x08, 0x2a,
+    0x0a, 0xfd, 0x3b, 0xfc, 0x10, 0x01, 0x62, 0x74, 0xb3, 0x1e, 0xc4, 0x03, 0x8f, 0xd9, 0x26, 0x54,
+    0x40, 0x18, 0x00, 0x97, 0xf0, 0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5,
+    0x80, 0x77, 0x11, 0x34, 0xc8, 0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d,
+    0x0a, 0xee, 0x11, 0x90, 0x0a, 0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80,
+    0x65, 0x32, 0x00, 0x1f, 0xfd, 0xd2, 0x01, 0x96, 0x64, 0xed, 0x40, 0x16, 0xb3, 0x25, 0x94, 0x03,
+    0xe1, 0x00, 0xe1, 0x12, 0x33, 0x00, 0x28, 0xee, 0x59, 0xc0, 0x04, 0xd7, 0x6a, 0x0f, 0x10, 0x07,
+    0x22, 0x17, 0x85, 0xc0, 0x3f, 0xed, 0x66, 0x3e, 0x8b, 0x80, 0x16, 0x66, 0x5d, 0x10, 0x00, 0x0c,
+    0xf7, 0xeb, 0x00, 0x45, 0xec, 0x8e, 0x33, 0x20, 0x04, 0x86, 0xd4, 0x63, 0xb1, 0x92, 0x49, 0x00,
+    0x52, 0x8c, 0xe0, 0xa0, 0x18, 0x6d, 0x4c, 0x0c, 0x03, 0xe3, 0x03, 0x00, 0xf9, 0xc1, 0x40, 0x3a,
+    0xd4, 0x8e, 0x48, 0x02, 0x84, 0x60, 0xe0, 0xda, 0x8c, 0x76, 0x30, 0x2f, 0x64, 0x71, 0x99, 0x00,
+    0x1f, 0xfd, 0xae, 0x01, 0xc9, 0x10, 0x78, 0xc0, 0x0d, 0x8e, 0xea, 0xb3, 0x70, 0x0f, 0x91, 0x14,
+    0x01, 0xf8, 0xc8, 0x40, 0x3e, 0xe0, 0x30, 0x0f, 0xb8, 0x08, 0x03, 0xe3, 0x20, 0x0f, 0x91, 0x14,
+    0x01, 0x6b, 0x3d, 0x59, 0xb8, 0x04, 0xb3, 0x0f, 0x18, 0x00, 0x00, 0x1f, 0xff, 0x60, 0x01, 0x22,
+    0x34, 0x80, 0x31, 0xdf, 0x28, 0x07, 0xfb, 0xc4, 0x70, 0x04, 0xfd, 0xd9, 0x80, 0x0d, 0x77, 0x9c,
+    0x01, 0xc8, 0x98, 0x40, 0x3f, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a, 0x40, 0x1f, 0xff, 0x48, 0x01,
+    0x22, 0x36, 0x80, 0x31, 0xdf, 0x20, 0x07, 0xfb, 0xc4, 0x70, 0x04, 0xfd, 0xd8, 0x80, 0x0d, 0x77,
+    0x88, 0x01, 0xc8, 0x98, 0x03, 0xff, 0x9a, 0x00, 0x00, 0x0c, 0xf7, 0xeb, 0x00, 0x45, 0xec, 0x8e,
+    0x33, 0x40, 0x09, 0x0d, 0xa8, 0xc8, 0x54, 0x24, 0x92, 0x00, 0x9e, 0x5d, 0xc0, 0xa0, 0x10, 0x89,
+    0xcc, 0xc0, 0x60, 0x06, 0xee, 0xa8, 0xc0, 0xc0, 0x0f, 0x76, 0x13, 0x70, 0x50, 0x00, 0xa2, 0x8f,
+    0x11, 0xc9, 0x00, 0x56, 0x0a, 0x1c, 0x1b, 0x51, 0x8b, 0x04, 0x05, 0xec, 0x8e, 0x14, 0xe0, 0x00,
+    0x1f, 0x70, 0x0c, 0xfe, 0x01, 0xff, 0xd5, 0xf2, 0x2d, 0xe0, 0x19, 0xf7, 0x73, 0x80, 0x66, 0xaa,
+    0xca, 0x01, 0xb9, 0x57, 0x68, 0x07, 0xff, 0x50, 0x1f, 0x70, 0x0f, 0xfe, 0x90, 0x00, 0xec, 0xb0,
+    0x0f, 0xfe, 0xf3, 0xf0, 0x07, 0x08, 0xc0, 0x02, 0x23, 0x86, 0x3d, 0x8e, 0x8e, 0x0c, 0x34, 0xa0,
+    0x1f, 0x70, 0x09, 0xbe, 0x00, 0x39, 0x25, 0x60, 0x03, 0x15, 0x1d, 0x00, 0x61, 0xf0, 0xd0, 0x0e,
+    0xa2, 0xd1, 0x00, 0xd2, 0x80, 0xa0, 0x1c, 0x34, 0x92, 0x20, 0x19, 0x96, 0x82, 0x80, 0x37, 0x00,
+    0xca, 0x28, 0x07, 0x98, 0xec, 0x40, 0x3d, 0xc3, 0x60, 0x1f, 0x70, 0x0f, 0xff, 0xde, 0x3b, 0xe1,
+    0x00, 0x24, 0x46, 0x50, 0x1f, 0xf1, 0x80, 0x61, 0xff, 0x20, 0x05, 0x40, 0x19, 0xc0, 0x38, 0x5c,
+    0x03, 0x51, 0x00, 0x67, 0x14, 0x00, 0x11, 0xa0, 0x06, 0xf2, 0xe0, 0x02, 0x86, 0x80, 0x72, 0xa8,
+    0x01, 0x4a, 0x01, 0xea, 0x05, 0x22, 0x78, 0x07, 0x88, 0xfd, 0x45, 0x40, 0x3e, 0xb5, 0xa7, 0x00,
+    0xfc, 0xc0, 0x5a, 0x01, 0xf8, 0x50, 0x50, 0x03, 0x00, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02, 0x70,
+    0x0f, 0xc3, 0x02, 0x01, 0xf4, 0x8d, 0x80, 0x7e, 0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4, 0x9b,
+    0x00, 0x7c, 0x8b, 0x00, 0x1f, 0xac, 0x64, 0x03, 0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x00, 0x00,
+    0x0c, 0xf7, 0xe2, 0x80, 0x45, 0xec, 0x8e, 0x35, 0x00, 0x09, 0x0d, 0xa8, 0xd6, 0x73, 0x24, 0x92,
+    0x00, 0xa4, 0x29, 0xc1, 0x40, 0x39, 0x10, 0x60, 0x60, 0x1c, 0x46, 0x60, 0x30, 0x0e, 0x23, 0x70,
+    0x50, 0x0e, 0x44, 0x12, 0x49, 0x00, 0x52, 0x14, 0x12, 0x1b, 0x31, 0x8c, 0xe6, 0x05, 0xec, 0xee,
+    0x0a, 0x80, 0x00, 0x1f, 0xfd, 0xb0, 0x01, 0x92, 0x20, 0xee, 0x90, 0x0b, 0x1d, 0xd4, 0xec, 0x20,
+    0x1e, 0xc0, 0x20, 0x0f, 0x10, 0x08, 0x03, 0xc4, 0x4b, 0x06, 0x40, 0x07, 0xee, 0x51, 0xf0, 0x04,
+    0xd7, 0x6c, 0xd2, 0x00, 0xb9, 0x10, 0x60, 0x1f, 0xfc, 0x90, 0x00, 0x0c, 0xf7, 0xe2, 0x80, 0x45,
+    0xec, 0x8e, 0x35, 0x00, 0x09, 0x0d, 0xa8, 0xd6, 0x73, 0x24, 0x92, 0x00, 0xa4, 0x29, 0xc1, 0x40,
+    0x39, 0x10, 0x60, 0x60, 0x1c, 0x46, 0x60, 0x30, 0x0e, 0x23, 0x70, 0x50, 0x1a, 0x30, 0x44, 0x12,
+    0x49, 0x09, 0x6d, 0x05, 0x04, 0x86, 0xc8, 0x89, 0x5c, 0xc0, 0xbd, 0x9d, 0x8c, 0x38, 0x02, 0x19,
+    0xef, 0xc8, 0x80, 0x80, 0x1f, 0xfd, 0xd2, 0x01, 0x96, 0x64, 0xed, 0x60, 0x16, 0xb3, 0x26, 0x10,
+    0x80, 0x3c, 0xa0, 0xe0, 0x1e, 0x60, 0x10, 0x07, 0x88, 0x92, 0x45, 0x00, 0x0f, 0xdc, 0xb0, 0xd0,
+    0x09, 0xae, 0x81, 0x0c, 0x02, 0xe4, 0x56, 0x61, 0x00, 0x7a, 0x02, 0x00, 0x3c, 0x30, 0xa6, 0x00,
+    0x01, 0x9e, 0xfd, 0x50, 0x0b, 0x59, 0xe0, 0x69, 0x80, 0xcd, 0x32, 0x7c, 0x3a, 0x00, 0x8c, 0x02,
+    0xf9, 0x03, 0x35, 0x4a, 0x01, 0xa8, 0x03, 0x1d, 0xd7, 0xf4, 0x20, 0x14, 0x76, 0xc2, 0x60, 0x25,
+    0x00, 0x09, 0xec, 0x8c, 0x55, 0x40, 0x11, 0x00, 0xa9, 0x54, 0xbd, 0x42, 0x10, 0x63, 0x24, 0x23,
+    0xd8, 0x00, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10, 0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x3f,
+    0xff, 0x80, 0x2f, 0x60, 0x0d, 0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42, 0x22, 0xa0, 0x08,
+    0x55, 0x41, 0x05, 0xb1, 0x3e, 0x10, 0x0b, 0x62, 0xec, 0xb8, 0x60, 0xbe, 0x00, 0xe7, 0xf1, 0xd1,
+    0x30, 0x0d, 0x66, 0x2e, 0x16, 0x01, 0x09, 0xd8, 0x0a, 0x30, 0x04, 0xc0, 0xc0, 0x0d, 0x13, 0x00,
+    0x59, 0x88, 0x01, 0xc2, 0xc0, 0x4e, 0xc0, 0x21, 0x45, 0x07, 0x05, 0x00, 0xdc, 0x44, 0xc3, 0x20,
+    0x0c, 0xa0, 0xaa, 0xb0, 0x0f, 0x24, 0x82, 0x80, 0x7b, 0x84, 0xc8, 0x02, 0x00, 0xcc, 0x00, 0x47,
+    0xf6, 0x01, 0x27, 0xa2, 0x0c, 0x02, 0x40, 0x40, 0x0b, 0x01, 0x30, 0x10, 0x01, 0xa4, 0x06, 0x00,
+    0x43, 0x04, 0x0c, 0x00, 0x25, 0x02, 0x80, 0x0d, 0x00, 0x06, 0x60, 0x21, 0x44, 0x60, 0x18, 0x60,
+    0x01, 0x10, 0x08, 0x07, 0x88, 0x08, 0x08, 0x00, 0xc0, 0x3c, 0x40, 0x41, 0x2c, 0x30, 0x09, 0x01,
+    0x5f, 0x00, 0xc1, 0xd5, 0x00, 0x31, 0xe9, 0x20, 0x01, 0x38, 0x70, 0x03, 0x22, 0x00, 0xc0, 0x18,
+    0x80, 0x80, 0x1b, 0x01, 0x00, 0x24, 0x03, 0x00, 0x80, 0x4f, 0x70, 0x08, 0xbe, 0x41, 0x16, 0x04,
+    0x01, 0x23, 0x00, 0x0b, 0x1a, 0x06, 0x4b, 0x10, 0x00, 0xc2, 0x2c, 0x2a, 0x80, 0x33, 0x1d, 0x0d,
+    0x80, 0x7a, 0x81, 0x04, 0x03, 0xd0, 0x28, 0x80, 0x0e, 0x91, 0xc2, 0x90, 0x0c, 0x6d, 0x05, 0xc5,
+    0x00, 0x17, 0x1b, 0x81, 0xb3, 0x98, 0x41, 0x78, 0x05, 0x23, 0xe0, 0x00, 0x9f, 0x20, 0x0d, 0xda,
+    0x10, 0x12, 0x01, 0x38, 0xc8, 0x0c, 0x22, 0x00, 0x61, 0x10, 0x00, 0x72, 0x80, 0x80, 0x90, 0x0d,
+    0x06, 0xec, 0xc2, 0x00, 0xca, 0x70, 0x30, 0x01, 0xef, 0x09, 0x10, 0x0f, 0x08, 0x08, 0x07, 0xff,
+    0x58, 0x6f, 0xff, 0x91, 0x62, 0x38, 0x41, 0x8d, 0xdf, 0x10, 0xc9, 0x00, 0x62, 0xa5, 0x60, 0x0e,
+    0xe1, 0xb0, 0x0e, 0x93, 0xd1, 0x00, 0xc8, 0xd0, 0x60, 0x18, 0x69, 0x1c, 0x03, 0xa8, 0x28, 0x03,
+    0x9d, 0x10, 0xce, 0xf8, 0xb8, 0x16, 0x23, 0x98, 0x00, 0xbf, 0xda, 0x0d, 0xc1, 0xc6, 0x01, 0xff,
+    0xd0, 0x8d, 0xcc, 0x70, 0xc7, 0x00, 0x92, 0xc0, 0x2c, 0x30, 0x09, 0x01, 0x00, 0x23, 0xc0, 0x09,
+    0x10, 0x01, 0x61, 0x80, 0x48, 0x08, 0x01, 0x1e, 0x00, 0x48, 0x80, 0x0b, 0x0c, 0x02, 0x40, 0x40,
+    0x08, 0xf0, 0x00, 0xcf, 0xfe, 0x56, 0xa0, 0x00, 0xb8, 0x07, 0xff, 0x69, 0xf4, 0x00, 0xd9, 0x84,
+    0x00, 0x00, 0x2b, 0x80, 0x43, 0x52, 0x80, 0x09, 0x49, 0x80, 0x03, 0x7b, 0x19, 0x9c, 0xd0, 0x5a,
+    0x40, 0x11, 0xf0, 0x77, 0x79, 0xee, 0xfc, 0xc0, 0x13, 0x00, 0xb1, 0x40, 0x66, 0x40, 0x00, 0x03,
+    0xcf, 0xe7, 0x01, 0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49,
+    0x02, 0x86, 0xc2, 0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x00, 0x3f, 0x40, 0x0f, 0xfe,
+    0x59, 0x67, 0xe1, 0x00, 0x52, 0x92, 0x38, 0x01, 0x3c, 0x37, 0x8b, 0x00, 0x2c, 0x00, 0x43, 0xe0,
+    0x1f, 0xe4, 0x00, 0x10, 0xf8, 0x02, 0x61, 0xbc, 0x5c, 0x01, 0x09, 0x23, 0xa2, 0x00, 0x01, 0xaf,
+    0xe9, 0x00, 0xb1, 0x26, 0x4d, 0x20, 0x85, 0xac, 0xf2, 0xa0, 0x60, 0x60, 0x06, 0xc0, 0xf0, 0x0f,
+    0xb4, 0x0c, 0x00, 0xd8, 0x0a, 0x5a, 0xcf, 0x2a, 0x00, 0xc4, 0x99, 0x34, 0x80, 0x00, 0xe3, 0xf4,
+    0x00, 0xff, 0xe2, 0x95, 0xfe, 0x30, 0x05, 0xeb, 0x29, 0x60, 0x05, 0x2d, 0x68, 0x90, 0x06, 0x81,
+    0x80, 0x14, 0x03, 0xfd, 0xa0, 0x60, 0x04, 0x00, 0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b, 0x00,
+    0x00, 0x01, 0xaf, 0xe8, 0x00, 0xb1, 0xaa, 0x5a, 0x01, 0x0b, 0x55, 0xe1, 0xc3, 0x03, 0xbf, 0xd2,
+    0x04, 0x00, 0xcc, 0xe2, 0xd0, 0x01, 0x99, 0xe8, 0x14, 0xb9, 0x99, 0x46, 0x00, 0xc6, 0x98, 0x7a,
+    0x00, 0x01, 0xcf, 0x50, 0x93, 0xa4, 0x01, 0x25, 0x1e, 0x62, 0xf5, 0xa4, 0x1b, 0x44, 0x11, 0xa0,
+    0x80, 0x7f, 0xf3, 0x40, 0x02, 0xbf, 0xc5, 0xf4, 0x0f, 0x59, 0xbb, 0x00, 0x14, 0xb5, 0x9e, 0x00,
+    0x1a, 0x06, 0x00, 0x40, 0x0f, 0xf6, 0x81, 0x80, 0x10, 0x00, 0xa3, 0xad, 0x10, 0x00, 0xb0, 0xa5,
+    0x2c, 0x1c, 0x1f, 0x7f, 0x04, 0x04, 0x23, 0x15, 0xa4, 0xc8, 0x3d, 0xaa, 0x5f, 0x40, 0x3f, 0x40,
+    0x0f, 0xfe, 0x59, 0x67, 0xd8, 0x80, 0x50, 0x8e, 0x96, 0x01, 0x4c, 0x41, 0x94, 0x02, 0x30, 0x07,
+    0x80, 0x7f, 0xf5, 0x80, 0x3f, 0x41, 0x27, 0x2d, 0x33, 0x7a, 0x00, 0x7f, 0xf2, 0x40, 0x03, 0xf4,
+    0x01, 0x27, 0x02, 0xd3, 0x03, 0xf4, 0x00, 0xff, 0xea, 0x15, 0x03, 0x23, 0x39, 0x00, 0x3f, 0x40,
+    0x0f, 0xfe, 0x69, 0x75, 0x00, 0x61, 0xc2, 0xa0, 0x08, 0x70, 0xf4, 0x03, 0x59, 0x48, 0x80, 0x63,
+    0x19, 0x00, 0xe9, 0xd2, 0x80, 0x0e, 0x37, 0x72, 0x00, 0x74, 0x1d, 0x08, 0x3f, 0x40, 0x0f, 0xfe,
+    0x90, 0x3f, 0x6c, 0xfa, 0x1a, 0xfd, 0x30, 0x0a, 0xe6, 0x17, 0xb6, 0xc3, 0x40, 0x28, 0x57, 0x33,
+    0x3a, 0x40, 0x88, 0x00, 0x20, 0x07, 0x70, 0x06, 0x30, 0x0f, 0xff, 0x20, 0x3f, 0x7d, 0xfb, 0x10,
+    0x0a, 0x62, 0x96, 0xc0, 0x28, 0x55, 0x32, 0x80, 0x44, 0x00, 0xe0, 0x0f, 0xfe, 0xb0, 0x01, 0xaf,
+    0xe9, 0x00, 0xb5, 0x22, 0x5a, 0x81, 0x0e, 0x9d, 0xd2, 0xa4, 0x60, 0x80, 0x04, 0x07, 0xf0, 0x0f,
+    0xb0, 0x0c, 0x00, 0x80, 0xe8, 0x5a, 0xcf, 0x2a, 0x41, 0x89, 0x32, 0x6a, 0x00, 0x3f, 0x7d, 0xfc,
+    0x20, 0x0a, 0x6e, 0xc1, 0x80, 0x14, 0xb2, 0x70, 0xb0, 0x01, 0x00, 0x04, 0x3e, 0x01, 0xfe, 0xb0,
+    0x01, 0x8f, 0x80, 0x1a, 0x1b, 0x45, 0xc0, 0x10, 0x92, 0x5a, 0x20, 0x02, 0xcf, 0xc3, 0x00, 0xff,
+    0xe2, 0x80, 0x02, 0xbf, 0xc5, 0xf4, 0x0f, 0x59, 0x4b, 0x00, 0x29, 0x6b, 0x44, 0x80, 0x34, 0x0c,
+    0x00, 0xa0, 0x1f, 0xed, 0x03, 0x00, 0x20, 0x01, 0x47, 0x5a, 0x20, 0x01, 0x61, 0x4a, 0x58, 0x04,
+    0x59, 0xf8, 0xc0, 0x1f, 0xfc, 0x60, 0x3f, 0x7e, 0x70, 0x05, 0x42, 0x80, 0x2d, 0x88, 0x00, 0x40,
+    0x1f, 0xfc, 0xa0, 0x05, 0xdf, 0xc3, 0x02, 0xa4, 0xb7, 0xd0, 0x60, 0xb4, 0xa6, 0x14, 0x2d, 0xa7,
+    0x81, 0x0d, 0x90, 0x9e, 0x14, 0x76, 0xad, 0x14, 0x08, 0x82, 0x58, 0x32, 0x4a, 0xda, 0x51, 0x80,
+    0x0a, 0xd0, 0x0f, 0xb9, 0x4b, 0xd2, 0x90, 0x6d, 0x50, 0x4d, 0x04, 0x03, 0xff, 0x88, 0x44, 0x41,
+    0x0a, 0x2b, 0x50, 0x3f, 0x40, 0x03, 0x78, 0x07, 0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70,
+    0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x40, 0x00, 0xad, 0x00, 0x9f, 0xc3, 0xc8, 0xc0, 0x14,
+    0xa0, 0xa1, 0x60, 0x44, 0xf0, 0x02, 0xa8, 0x14, 0x14, 0x01, 0xc4, 0x4b, 0x50, 0x09, 0x06, 0xcf,
+    0x80, 0x33, 0xb0, 0xa0, 0x06, 0xd0, 0x70, 0x08, 0xbc, 0x00, 0x37, 0x98, 0x03, 0xe3, 0x4c, 0x01,
+    0x80, 0x80, 0x61, 0x88, 0x08, 0x08, 0x78, 0x08, 0x08, 0x44, 0xc2, 0x19, 0x40, 0xc4, 0x00, 0x22,
+    0x44, 0xa0, 0x69, 0xa0, 0x0d, 0x3c, 0x50, 0x49, 0x04, 0x00, 0x20, 0x2e, 0x06, 0x29, 0x10, 0x02,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0x5f, 0x40, 0x1e, 0xa0, 0x54, 0x90, 0x80, 0xb0, 0x05, 0x15, 0x35,
+    0x88, 0x00, 0x61, 0x51, 0x40, 0x37, 0x83, 0x00, 0x63, 0x78, 0x27, 0x00, 0xb8, 0xdd, 0xd0, 0x41,
+    0x05, 0xc1, 0x05, 0xc0, 0x00, 0xad, 0x00, 0x9f, 0xc3, 0x88, 0xc0, 0x14, 0xa0, 0x83, 0x60, 0x44,
+    0xf0, 0x03, 0xa8, 0x28, 0xa8, 0x02, 0x88, 0xed, 0xc0, 0x23, 0x29, 0x3d, 0x00, 0xca, 0xa1, 0x40,
+    0x0d, 0x40, 0xc0, 0x1c, 0xc1, 0x60, 0x19, 0x60, 0xcc, 0x01, 0x0d, 0x0f, 0x80, 0x60, 0x5f, 0xfe,
+    0x34, 0xaa, 0x88, 0x48, 0x55, 0x40, 0x56, 0x20, 0x01, 0xb5, 0x50, 0x05, 0x41, 0x40, 0x13, 0x25,
+    0x00, 0x45, 0x26, 0x2a, 0xa1, 0x70, 0x3a, 0xa9, 0x40, 0x00, 0xfc, 0x37, 0xe4, 0x00, 0x94, 0xa2,
+    0x00, 0x1a, 0x28, 0x07, 0xf3, 0x88, 0x00, 0x68, 0xf0, 0x00, 0x4a, 0x4e, 0x00, 0x3d, 0x38, 0x00,
+    0x89, 0x4c, 0x03, 0x84, 0x03, 0xfc, 0x4a, 0x40, 0x15, 0x9e, 0x90, 0x00, 0xb7, 0x44, 0x00, 0x7d,
+    0x00, 0xff, 0xeb, 0x00, 0x00, 0xe7, 0xe7, 0x00, 0x2b, 0xc1, 0x01, 0x40, 0x38, 0x00, 0x40, 0x3c,
+    0x60, 0x12, 0x43, 0x80, 0x3c, 0x68, 0x01, 0x49, 0xa0, 0x01, 0xd0, 0x0c, 0x60, 0x1f, 0x30, 0x30,
+    0x3c, 0xa9, 0x83, 0x75, 0x00, 0x00, 0x00, 0xfe, 0x5f, 0xe4, 0x03, 0xc0, 0xb5, 0x6b, 0x4a, 0x10,
+    0x19, 0x88, 0x5b, 0x58, 0x79, 0x83, 0xee, 0x98, 0x00, 0x2e, 0x61, 0x18, 0xf9, 0xc3, 0x10, 0x48,
+    0x40, 0x38, 0xcc, 0x01, 0xfe, 0x10, 0x00, 0xa5, 0x40, 0x38, 0xd7, 0xc8, 0x02, 0x7c, 0x35, 0xd4,
+    0x02, 0x87, 0x69, 0x39, 0x04, 0x09, 0x03, 0xd9, 0x0e, 0x01, 0x00, 0x0a, 0x07, 0x80, 0x61, 0x40,
+    0x50, 0x80, 0x3d, 0x90, 0x27, 0x73, 0x49, 0xc8, 0x02, 0x30, 0xd7, 0x50, 0x02, 0x35, 0xf2, 0x00,
+    0x00, 0x00, 0x1e, 0x7e, 0xa8, 0x00, 0x70, 0x61, 0xa8, 0xc1, 0x83, 0x1e, 0xca, 0x83, 0xc4, 0x40,
+    0x09, 0xd0, 0x00, 0x80, 0x48, 0x87, 0x70, 0x7f, 0xac, 0x00, 0xce, 0x17, 0x92, 0x00, 0x1e, 0x04,
+    0x32, 0x00, 0x8c, 0x03, 0x22, 0x9c, 0x13, 0x35, 0x3e, 0x84, 0x49, 0x98, 0xe4, 0x00, 0xff, 0x0f,
+    0x2d, 0x77, 0x25, 0x74, 0x44, 0x94, 0x15, 0x42, 0xa4, 0x10, 0x16, 0xa4, 0x45, 0x98, 0x04, 0x96,
+    0x01, 0xa1, 0xc0, 0x80, 0x80, 0x33, 0x08, 0x10, 0x10, 0x06, 0x71, 0x00, 0x24, 0x00, 0x69, 0x60,
+    0x03, 0xad, 0xaa, 0xb0, 0xcc, 0x02, 0xf8, 0x37, 0x65, 0xc0, 0x00, 0xcd, 0x00, 0x9f, 0xca, 0x09,
+    0x00, 0x12, 0xa4, 0x87, 0xe0, 0xa3, 0x00, 0x08, 0x42, 0x95, 0x20, 0x02, 0x1f, 0x1c, 0x80, 0x13,
+    0xcc, 0xc1, 0x90, 0x09, 0xba, 0x07, 0xd9, 0x00, 0x11, 0x87, 0x90, 0x82, 0x7f, 0x04, 0x7c, 0x02,
+    0x6e, 0x81, 0xf6, 0x40, 0x04, 0x61, 0xe4, 0x20, 0x00, 0xd8, 0x00, 0xfd, 0xb0, 0x01, 0xb6, 0x00,
+    0x3f, 0x64, 0x00, 0x01, 0xbf, 0xe6, 0x00, 0x5a, 0xcb, 0xc9, 0x83, 0x3b, 0x4a, 0xb8, 0x23, 0xa0,
+    0x52, 0x00, 0x9d, 0xd8, 0x81, 0x5f, 0x74, 0x3a, 0x86, 0x22, 0x2a, 0x69, 0x71, 0xf5, 0x0f, 0x31,
+    0xf4, 0xac, 0x88, 0x00, 0xd5, 0x89, 0xb0, 0x30, 0xa6, 0x12, 0x84, 0xc0, 0xa0, 0x08, 0x53, 0x75,
+    0x2a, 0x02, 0xf6, 0x6d, 0x00, 0x3d, 0x24, 0xd1, 0x02, 0x11, 0x19, 0x80, 0x00, 0xf0, 0x80, 0x7e,
+    0x4c, 0xfe, 0xe3, 0x80, 0x73, 0x5b, 0xcd, 0x3c, 0x60, 0x04, 0x72, 0xf6, 0xcb, 0x3a, 0x72, 0x00,
+    0x93, 0x87, 0xff, 0x59, 0xcb, 0x08, 0x25, 0x2c, 0x42, 0x9f, 0x58, 0x10, 0x04, 0xb1, 0x5d, 0x73,
+    0x40, 0x8c, 0x00, 0x3c, 0x88, 0x2a, 0xa0, 0x11, 0x82, 0x73, 0xa5, 0xea, 0x42, 0x83, 0x87, 0xa2,
+    0xd6, 0xe7, 0x15, 0xa1, 0x02, 0x35, 0x48, 0x89, 0x7c, 0x28, 0x02, 0x98, 0x6c, 0xda, 0x5f, 0x10,
+    0x0c, 0xff, 0x97, 0xd6, 0x20, 0x00, 0x07, 0xdd, 0x38, 0x24, 0xf4, 0xc2, 0x23, 0x17, 0x40, 0x57,
+    0x7b, 0x44, 0xf4, 0xe1, 0xc4, 0x28, 0x7e, 0x44, 0x00, 0x00, 0x3f, 0x9c, 0x79, 0x01, 0xc4, 0xbb,
+    0xa8, 0x87, 0x55, 0x2d, 0x94, 0x10, 0x7d, 0x02, 0x80, 0x0a, 0xab, 0x74, 0xd1, 0x00, 0x51, 0xed,
+    0x1d, 0x00, 0x5e, 0x85, 0xe6, 0x40, 0x01, 0x1e, 0x09, 0xee, 0xe4, 0xbb, 0xe0, 0x01, 0x22, 0x60,
+    0x0f, 0xad, 0x40, 0x00, 0x2e, 0x75, 0xa0, 0x04, 0xd1, 0x39, 0xb4, 0x80, 0x31, 0xea, 0x4d, 0xb2,
+    0x0e, 0xe2, 0xee, 0x41, 0x8a, 0x77, 0x00, 0x1c, 0xe0, 0xa5, 0xfc, 0x03, 0xca, 0x04, 0x45, 0x71,
+    0x16, 0x39, 0x2a, 0x13, 0x6e, 0x17, 0x7c, 0x00, 0x21, 0x37, 0xf6, 0xd8, 0x02, 0x8f, 0xee, 0x30,
+    0x00, 0x1f, 0xfa, 0xc7, 0x76, 0xa0, 0x00, 0xf9, 0x7b, 0x8a, 0x03, 0x51, 0x0a, 0x14, 0x26, 0x61,
+    0x2b, 0x91, 0x98, 0x98, 0xa3, 0x31, 0x04, 0x0f, 0xdc, 0x70, 0x00, 0x00, 0x0c, 0x80, 0x71, 0x30,
+    0x80, 0x04, 0x4e, 0x04, 0x22, 0xce, 0xb0, 0xce, 0xde, 0xb9, 0x0a, 0xbf, 0x34, 0x50, 0x44, 0x18,
+    0x88, 0xb8, 0x04, 0x59, 0xdd, 0xdb, 0xd7, 0x7d, 0xe0, 0x0a, 0xfd, 0x46, 0x7e, 0x59, 0x7c, 0x11,
+    0xe9, 0x7e, 0x1b, 0x5c, 0x26, 0x43, 0xdf, 0x00, 0x08, 0xee, 0x20, 0x1b, 0xe4, 0x50, 0x1e, 0x90,
+    0x06, 0x2c, 0x99, 0x02, 0x4e, 0xd4, 0x12, 0x1f, 0x5b, 0x90, 0x01, 0x30, 0x05, 0x48, 0x1a, 0xd8,
+    0x00, 0x3f, 0x40, 0x03, 0x78, 0x07, 0xff, 0x5c, 0x80, 0x1c, 0x01, 0xa1, 0x54, 0xc0, 0xa0, 0x06,
+    0xb8, 0xa4, 0xb0, 0x06, 0x76, 0xa5, 0xf0, 0x07, 0xff, 0x10, 0x03, 0xcf, 0xfc, 0x38, 0x60, 0xcc,
+    0x06, 0x00, 0xbf, 0xc1, 0xc0, 0x1e, 0xe0, 0x0f, 0x30, 0x80, 0x70, 0xe2, 0x09, 0x80, 0x45, 0x7c,
+    0xa0, 0x1f, 0xfc, 0xb0, 0x00, 0x8f, 0xd4, 0x44, 0x00, 0x52, 0x0c, 0x91, 0x92, 0x9b, 0x5b, 0x00,
+    0x2c, 0xf0, 0xb5, 0x00, 0x4d, 0x00, 0x7f, 0xf0, 0x80, 0x06, 0xde, 0x90, 0x49, 0x8d, 0x49, 0xd4,
+    0x53, 0xb7, 0x00, 0xf6, 0xa2, 0x95, 0xba, 0x45, 0xeb, 0xc0, 0x5f, 0x46, 0xf3, 0x00, 0x2b, 0x5a,
+    0x2e, 0x88, 0x02, 0x4f, 0xac, 0xe8, 0x02, 0xb3, 0x25, 0x42, 0x03, 0x88, 0x3b, 0xa4, 0x87, 0x51,
+    0xa9, 0x98, 0x0a, 0xd4, 0x93, 0x20, 0x00, 0x2d, 0xc0, 0x0d, 0x36, 0x00, 0xa4, 0x00, 0xc6, 0xd4,
+    0x00, 0x8c, 0x00, 0xdf, 0x02, 0x01, 0xf3, 0x0b, 0x80, 0x7c, 0x31, 0x20, 0x1f, 0xad, 0x10, 0xfe,
+    0x80, 0x05, 0xc3, 0x5b, 0x19, 0x10, 0x0e, 0xe9, 0x1a, 0x83, 0x00, 0xce, 0x2c, 0x8e, 0xc0, 0x18,
+    0x63, 0xc3, 0x4f, 0xca, 0xc0, 0x16, 0xc6, 0x13, 0xfe, 0x2b, 0x01, 0xd8, 0x00, 0xeb, 0x60, 0x00,
+    0x1b, 0xb0, 0x06, 0x7a, 0x00, 0x40, 0xb8, 0x04, 0x51, 0x00, 0x04, 0xf8, 0x06, 0xe8, 0x20, 0x0f,
+    0x9c, 0x5c, 0x03, 0xe1, 0x8e, 0x00, 0xfd, 0x4c, 0x59, 0xf4, 0x00, 0x5e, 0x55, 0x4c, 0x9e, 0xd1,
+    0x00, 0x03, 0xba, 0x09, 0xa4, 0x37, 0x00, 0x5a, 0x20, 0x04, 0x56, 0x86, 0x08, 0x8b, 0x00, 0x0e,
+    0x14, 0x80, 0x26, 0x04, 0x01, 0x06, 0xfc, 0xa1, 0x8c, 0x01, 0x4f, 0x7f, 0x94, 0x09, 0xeb, 0x10,
+    0x09, 0xb4, 0x00, 0x8f, 0xc1, 0x20, 0x01, 0x89, 0x00, 0x2f, 0x80, 0xf8, 0x02, 0xd1, 0x00, 0x01,
+    0x17, 0xa2, 0x82, 0x22, 0xc0, 0x24, 0x8f, 0x79, 0x09, 0x81, 0x00, 0x94, 0xfd, 0x3d, 0xc5, 0x93,
+    0xdc, 0x06, 0xff, 0x56, 0x3c, 0x24, 0xc0, 0x3d, 0x4c, 0x70, 0xac, 0x01, 0xc8, 0xb0, 0x4d, 0x00,
+    0x1e, 0x9b, 0x14, 0x1f, 0x58, 0x20, 0x04, 0x0a, 0x83, 0x7f, 0x96, 0x08, 0x01, 0xfc, 0x01, 0xdc,
+    0x80, 0x00, 0x00, 0xb2, 0xc0, 0x3c, 0x20, 0x1f, 0x6d, 0x80, 0x7a, 0xa4, 0x03, 0xc8, 0x01, 0xc3,
+    0x81, 0x60, 0x1b, 0x07, 0xc8, 0x02, 0x42, 0xe1, 0x02, 0x60, 0x10, 0x10, 0x05, 0x48, 0x20, 0x73,
+    0x43, 0xb0, 0x0e, 0x04, 0xb3, 0xc8, 0x00, 0x00, 0x90, 0x40, 0x3f, 0x7d, 0x80, 0x7e, 0x95, 0x10,
+    0x0f, 0x8b, 0xc4, 0x03, 0xe5, 0xfc, 0x00, 0xfb, 0x80, 0xc8, 0x03, 0xc9, 0x00, 0xa0, 0x1c, 0xa0,
+    0xa9, 0x60, 0x1d, 0xc4, 0x4d, 0x32, 0x00, 0x85, 0x14, 0x1c, 0x14, 0x02, 0x70, 0xd1, 0x02, 0xb0,
+    0x0b, 0x42, 0xbb, 0x84, 0x64, 0x02, 0x8b, 0x77, 0x48, 0x28, 0x38, 0x4a, 0x24, 0xc5, 0x61, 0xa2,
+    0x60, 0x19, 0x4c, 0x80, 0x00, 0xe3, 0x20, 0x0f, 0x8f, 0x04, 0x03, 0xe9, 0x73, 0x00, 0xfa, 0xa0,
+    0x03, 0xe5, 0xfc, 0x00, 0xfb, 0x80, 0xc8, 0x03, 0xc9, 0x00, 0xa0, 0x1c, 0xa0, 0xa9, 0x60, 0x1d,
+    0xc4, 0x4d, 0x32, 0x00, 0x85, 0x14, 0x1c, 0x14, 0x02, 0x70, 0xd1, 0x02, 0xb0, 0x0b, 0x42, 0xbb,
+    0x84, 0x64, 0x02, 0x8b, 0x77, 0x48, 0x28, 0x38, 0x4a, 0x24, 0xc5, 0x61, 0xa2, 0x60, 0x19, 0x4c,
+    0x80, 0x00, 0xce, 0x80, 0x1f, 0x4d, 0x50, 0x40, 0x38, 0xdb, 0xd2, 0xc0, 0x38, 0xfc, 0xaa, 0x80,
+    0x1e, 0x5f, 0xc0, 0x0f, 0xb8, 0x0c, 0x80, 0x3c, 0x90, 0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc,
+    0x44, 0xd3, 0x20, 0x08, 0x51, 0x41, 0xc1, 0x40, 0x27, 0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8,
+    0x46, 0x40, 0x28, 0xb7, 0x74, 0x82, 0x83, 0x84, 0xa2, 0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8,
+    0x00, 0xb2, 0x4e, 0xc0, 0x39, 0x1f, 0xb7, 0x40, 0x1c, 0x96, 0xfc, 0xc0, 0x1e, 0x5f, 0xc0, 0x0f,
+    0xb8, 0x0c, 0x80, 0x3c, 0x90, 0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc, 0x44, 0xd3, 0x20, 0x08,
+    0x51, 0x41, 0xc1, 0x40, 0x27, 0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8, 0x46, 0x40, 0x28, 0xb7,
+    0x74, 0x82, 0x83, 0x84, 0xa2, 0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8, 0x00, 0x37, 0x0b, 0xe8,
+    0x07, 0x19, 0x08, 0xc0, 0x1c, 0xb8, 0x0d, 0x80, 0x1e, 0x5f, 0xc0, 0x0f, 0xb8, 0x0c, 0x80, 0x3c,
+    0x90, 0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc, 0x44, 0xd3, 0x20, 0x08, 0x51, 0x41, 0xc1, 0x40,
+    0x27, 0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8, 0x46, 0x40, 0x28, 0xb7, 0x74, 0x82, 0x83, 0x84,
+    0xa2, 0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8, 0x00, 0x9b, 0xac, 0x40, 0x3d, 0x18, 0x08, 0x01,
+    0xe8, 0xc0, 0x40, 0x0f, 0x37, 0x58, 0x80, 0x79, 0x7f, 0x00, 0x3e, 0xe0, 0x32, 0x00, 0xf2, 0x40,
+    0x28, 0x07, 0x28, 0x2a, 0x58, 0x07, 0x71, 0x13, 0x4c, 0x80, 0x21, 0x45, 0x07, 0x05, 0x00, 0x9c,
+    0x34, 0x40, 0xac, 0x02, 0xd0, 0xae, 0xe1, 0x19, 0x00, 0xa2, 0xdd, 0xd2, 0x0a, 0x0e, 0x12, 0x89,
+    0x31, 0x58, 0x68, 0x98, 0x06, 0x53, 0x20, 0x00, 0xd3, 0xff, 0xf9, 0x00, 0x33, 0x2a, 0x04, 0x47,
+    0x30, 0x04, 0xc1, 0x06, 0x0e, 0xfc, 0x40, 0x15, 0x99, 0x00, 0x7f, 0x8c, 0xa8, 0x02, 0x11, 0xe0,
+    0x0a, 0x41, 0x80, 0x2e, 0xed, 0xe0, 0x01, 0x55, 0x08, 0xc1, 0x77, 0xa8, 0x00, 0xc0, 0xbd, 0xc6,
+    0x04, 0x4e, 0x00, 0x51, 0x5d, 0xca, 0x01, 0xf2, 0x15, 0xa2, 0x44, 0x0e, 0xfc, 0x5e, 0x2c, 0x01,
+    0xd1, 0x1c, 0xc0, 0x00, 0x0c, 0xf7, 0xeb, 0x00, 0x45, 0xec, 0x8e, 0x33, 0x20, 0x04, 0x86, 0xd4,
+    0x63, 0xb1, 0x92, 0x49, 0x00, 0x52, 0x8c, 0xe0, 0xa0, 0x18, 0x6d, 0x4c, 0x0c, 0x03, 0xe3, 0x03,
+    0x00, 0xf9, 0xc1, 0x40, 0x3a, 0xd4, 0x8e, 0x48, 0x02, 0x84, 0x60, 0xe0, 0xda, 0x8c, 0x76, 0x30,
+    0x2f, 0x65, 0x71, 0x99, 0x00, 0x43, 0x36, 0x7e, 0xc0, 0x1e, 0x4a, 0xe0, 0x0f, 0xa2, 0xec, 0x01,
+    0x00, 0x00, 0x11, 0x80, 0x7d, 0x88, 0x01, 0xc5, 0x1e, 0x01, 0xe7, 0xb0, 0x08, 0x7f, 0xfd, 0x80,
+    0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0, 0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7, 0x66, 0x00, 0x35,
+    0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff, 0x63, 0xbe, 0x50, 0x02, 0x44, 0x69, 0x00, 0x00, 0xc2,
+    0x80, 0x1e, 0x88, 0x00, 0x70, 0xb7, 0x80, 0x70, 0xf9, 0x80, 0x07, 0xff, 0xd8, 0x00, 0x48, 0x8d,
+    0x20, 0x0c, 0x77, 0xca, 0x01, 0xfe, 0xf1, 0x1c, 0x01, 0x3f, 0x76, 0x60, 0x03, 0x5d, 0xe7, 0x00,
+    0x72, 0x26, 0x10, 0x0f, 0xf6, 0x3b, 0xe5, 0x00, 0x24, 0x46, 0x90, 0x00, 0x8d, 0xc4, 0x03, 0xb6,
+    0xac, 0x03, 0x4a, 0xe2, 0x20, 0x02, 0x9b, 0x1e, 0x40, 0x1f, 0xff, 0x60, 0x01, 0x22, 0x34, 0x80,
+    0x31, 0xdf, 0x28, 0x07, 0xfb, 0xc4, 0x70, 0x04, 0xfd, 0xd9, 0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8,
+    0x98, 0x40, 0x3f, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a, 0x40, 0x00, 0x64, 0x86, 0xc0, 0x04, 0xe2,
+    0x03, 0xe0, 0x15, 0xc0, 0x63, 0x80, 0xff, 0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9, 0x40,
+    0x3f, 0xde, 0x23, 0x80, 0x27, 0xee, 0xcc, 0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01, 0xfe,
+    0xc7, 0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00, 0x04, 0x10, 0x04, 0x40, 0x01, 0xcc, 0x20, 0x5e, 0x20,
+    0x3e, 0xe0, 0x1f, 0xfd, 0xc0, 0x00, 0x19, 0x01, 0xe0, 0x02, 0x1c, 0x82, 0xe0, 0x07, 0xdc, 0x03,
+    0xff, 0xba, 0x00, 0x01, 0x73, 0x00, 0x45, 0x68, 0xa3, 0x62, 0x42, 0x78, 0xd4, 0x80, 0xfb, 0x80,
+    0x7f, 0xf9, 0xc0, 0x7e, 0x08, 0xd0, 0x12, 0x0f, 0x60, 0x6c, 0x07, 0xb0, 0x00, 0xfb, 0x80, 0x7f,
+    0xfc, 0x80, 0x08, 0xff, 0xba, 0xcc, 0x03, 0xa2, 0x0c, 0xcc, 0x50, 0x0c, 0xee, 0x8d, 0x4a, 0x10,
+    0x0f, 0xa0, 0x1c, 0x04, 0x04, 0x40, 0x03, 0x0f, 0xd6, 0x0e, 0xe3, 0x80, 0x08, 0xf8, 0xc2, 0xec,
+    0xc0, 0x02, 0x33, 0x20, 0x22, 0x04, 0x0c, 0x3c, 0x03, 0xe8, 0x07, 0x00, 0x99, 0x91, 0xa9, 0x42,
+    0x01, 0x4c, 0x99, 0x98, 0xa0, 0x00, 0x00, 0xa7, 0x0f, 0x40, 0x3c, 0xf1, 0xce, 0x01, 0xee, 0x4d,
+    0xa0, 0x08, 0x7f, 0x40, 0x33, 0xf8, 0x80, 0x09, 0xc0, 0x3f, 0x0c, 0x08, 0x07, 0xd2, 0x36, 0x01,
+    0xfa, 0x14, 0xc0, 0x3e, 0x62, 0xf0, 0x0f, 0xd2, 0x6c, 0x01, 0xf2, 0x2c, 0x00, 0x7e, 0xb1, 0x90,
+    0x0f, 0x86, 0x04, 0x03, 0xf3, 0x90, 0x00, 0x00, 0x88, 0xc0, 0x3f, 0x36, 0x10, 0x07, 0xc8, 0xd6,
+    0x01, 0xfa, 0x64, 0x01, 0xe1, 0x9e, 0xfc, 0x50, 0x08, 0xbd, 0x91, 0xc6, 0xa0, 0x01, 0x21, 0xb5,
+    0x1a, 0xce, 0x64, 0x92, 0x40, 0x14, 0x85, 0x38, 0x28, 0x07, 0x22, 0x0c, 0x0c, 0x03, 0x88, 0xcc,
+    0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01, 0xc8, 0x82, 0x49, 0x20, 0x0a, 0x42, 0x82, 0x43, 0x66, 0x31,
+    0x9c, 0xc0, 0xbd, 0x9d, 0xc1, 0x50, 0x00, 0x00, 0xe1, 0x40, 0x0f, 0xd7, 0xe0, 0x1f, 0x12, 0xd0,
+    0x07, 0xc5, 0xe2, 0x01, 0xc3, 0x3d, 0xf8, 0xa0, 0x11, 0x7b, 0x23, 0x8d, 0x40, 0x02, 0x43, 0x6a,
+    0x35, 0x9c, 0xc9, 0x24, 0x80, 0x29, 0x0a, 0x70, 0x50, 0x0e, 0x44, 0x18, 0x18, 0x07, 0x11, 0x98,
+    0x0c, 0x03, 0x88, 0xdc, 0x14, 0x03, 0x91, 0x04, 0x92, 0x40, 0x14, 0x85, 0x04, 0x86, 0xcc, 0x63,
+    0x39, 0x81, 0x7b, 0x3b, 0x82, 0xa0, 0x00, 0x00, 0xc8, 0xe0, 0x1f, 0x1d, 0x6d, 0x00, 0x79, 0x76,
+    0xb4, 0x80, 0x39, 0x8c, 0x1c, 0x80, 0x30, 0xcf, 0x7e, 0x28, 0x04, 0x5e, 0xc8, 0xe3, 0x50, 0x00,
+    0x90, 0xda, 0x8d, 0x67, 0x32, 0x49, 0x20, 0x0a, 0x42, 0x9c, 0x14, 0x03, 0x91, 0x06, 0x06, 0x01,
+    0xc4, 0x66, 0x03, 0x00, 0xe2, 0x37, 0x05, 0x00, 0xe4, 0x41, 0x24, 0x90, 0x05, 0x21, 0x41, 0x21,
+    0xb3, 0x18, 0xce, 0x60, 0x5e, 0xce, 0xe0, 0xa8, 0x00, 0x00, 0xa3, 0xbf, 0x48, 0x03, 0xa3, 0xbf,
+    0x48, 0x03, 0xff, 0x84, 0x33, 0xdf, 0x8a, 0x01, 0x17, 0xb2, 0x38, 0xd4, 0x00, 0x24, 0x36, 0xa3,
+    0x59, 0xcc, 0x92, 0x48, 0x02, 0x90, 0xa7, 0x05, 0x00, 0xe4, 0x41, 0x81, 0x80, 0x71, 0x19, 0x80,
+    0xc0, 0x38, 0x8d, 0xc1, 0x40, 0x39, 0x10, 0x49, 0x24, 0x01, 0x48, 0x50, 0x48, 0x6c, 0xc6, 0x33,
+    0x98, 0x17, 0xb3, 0xb8, 0x2a, 0x00, 0x00, 0xb5, 0xc7, 0x98, 0x03, 0x84, 0x63, 0x30, 0x07, 0x63,
+    0x06, 0xa8, 0x06, 0x19, 0xef, 0xc5, 0x00, 0x8b, 0xd9, 0x1c, 0x6a, 0x00, 0x12, 0x1b, 0x51, 0xac,
+    0xe6, 0x49, 0x24, 0x01, 0x48, 0x53, 0x82, 0x80, 0x72, 0x20, 0xc0, 0xc0, 0x38, 0x8c, 0xc0, 0x60,
+    0x1c, 0x46, 0xe0, 0xa0, 0x1c, 0x88, 0x24, 0x92, 0x00, 0xa4, 0x28, 0x24, 0x36, 0x63, 0x19, 0xcc,
+    0x0b, 0xd9, 0xdc, 0x15, 0x00, 0x00, 0x57, 0x00, 0xa1, 0x0a, 0x18, 0x1d, 0xc4, 0xee, 0x99, 0x44,
+    0x18, 0x21, 0x19, 0x5c, 0x00, 0x68, 0x2a, 0x60, 0x78, 0xbc, 0x9a, 0x54, 0x94, 0x16, 0x4b, 0x36,
+    0x01, 0x63, 0x80, 0x00, 0xff, 0xe0, 0x8c, 0xf7, 0xe2, 0xc6, 0x00, 0x0b, 0xd9, 0x1c, 0x69, 0xe4,
+    0x01, 0x21, 0xb5, 0x1e, 0x00, 0x60, 0x24, 0x92, 0x00, 0x79, 0x05, 0x03, 0x82, 0x80, 0x28, 0xf1,
+    0x10, 0x06, 0x06, 0x0e, 0xba, 0x24, 0x60, 0x60, 0x69, 0x10, 0x30, 0x23, 0x07, 0x0b, 0xa5, 0x70,
+    0x02, 0x20, 0x08, 0xd8, 0x68, 0x01, 0x21, 0x40, 0x07, 0x00, 0x4c, 0x63, 0x39, 0x82, 0x22, 0x19,
+    0xdc, 0x15, 0x00, 0x04, 0xa7, 0x9e, 0xfc, 0x50, 0x08, 0x00, 0x8c, 0x80, 0x3e, 0xaf, 0x00, 0xfa,
+    0x41, 0x00, 0x3e, 0xd4, 0x00, 0x8b, 0xd8, 0x03, 0x47, 0x80, 0x7f, 0xfa, 0x8c, 0x04, 0x03, 0x10,
+    0x88, 0xa8, 0x02, 0x15, 0x50, 0x41, 0x6c, 0x4f, 0x84, 0x02, 0xd8, 0xbb, 0x2e, 0x18, 0x00, 0xe2,
+    0x30, 0x0f, 0xb1, 0x40, 0x3c, 0xe4, 0xc0, 0x1e, 0x7c, 0x00, 0x8b, 0xd8, 0x03, 0x47, 0x80, 0x7f,
+    0xfa, 0x8c, 0x04, 0x03, 0x10, 0x88, 0xa8, 0x02, 0x15, 0x50, 0x41, 0x6c, 0x4f, 0x84, 0x02, 0xd8,
+    0xbb, 0x2e, 0x18, 0x00, 0xce, 0xc0, 0x1e, 0x8c, 0xb5, 0x00, 0xc3, 0xf5, 0xe4, 0x01, 0x85, 0xc4,
+    0x9c, 0x00, 0x5e, 0xc0, 0x1a, 0x3c, 0x03, 0xff, 0xd4, 0x60, 0x20, 0x18, 0x84, 0x45, 0x40, 0x10,
+    0xaa, 0x82, 0x0b, 0x62, 0x7c, 0x20, 0x16, 0xc5, 0xd9, 0x70, 0xc0, 0x00, 0x1f, 0x1a, 0x71, 0x00,
+    0x63, 0x10, 0x33, 0x00, 0x47, 0xa4, 0x9a, 0x20, 0x5e, 0xc0, 0x1a, 0x3c, 0x03, 0xff, 0xd4, 0x60,
+    0x20, 0x18, 0x84, 0x45, 0x40, 0x10, 0xaa, 0x82, 0x0b, 0x62, 0x7c, 0x20, 0x16, 0xc5, 0xd9, 0x70,
+    0xc0, 0x00, 0xe3, 0x10, 0x0f, 0x97, 0x00, 0x3f, 0x4c, 0x84, 0x03, 0xec, 0x60, 0x0d, 0x3e, 0x40,
+    0x1b, 0xb4, 0x20, 0x24, 0x02, 0x71, 0x90, 0x18, 0x44, 0x00, 0xc2, 0x20, 0x00, 0xe5, 0x01, 0x01,
+    0x20, 0x1a, 0x0d, 0xd9, 0x84, 0x01, 0x94, 0xe0, 0x60, 0x03, 0xde, 0x12, 0x20, 0x1e, 0x10, 0x10,
+    0x0f, 0xfe, 0xb0, 0x2f, 0x60, 0x0f, 0x84, 0x40, 0x1e, 0x8e, 0xfd, 0x50, 0x09, 0xee, 0xcf, 0x46,
+    0x00, 0xe4, 0x45, 0x15, 0x00, 0x78, 0x4c, 0x00, 0x23, 0x39, 0xf8, 0x02, 0x3b, 0x90, 0xea, 0x00,
+    0x7b, 0xce, 0x80, 0x0b, 0x90, 0xc4, 0x03, 0xfc, 0x00, 0x01, 0xaf, 0xf5, 0x08, 0x02, 0x95, 0xdc,
+    0xb8, 0x00, 0x47, 0x88, 0x49, 0x10, 0x43, 0x80, 0x06, 0x06, 0x01, 0x8a, 0x54, 0x40, 0x25, 0xd2,
+    0xe0, 0x0c, 0x96, 0xf6, 0xa0, 0x10, 0xa4, 0x9f, 0x00, 0x7c, 0xe0, 0x11, 0x34, 0x9d, 0x80, 0x49,
+    0x2e, 0xf0, 0x01, 0xe7, 0x00, 0xc3, 0x72, 0x01, 0xcb, 0xa0, 0x18, 0xf3, 0x1c, 0xe0, 0x3a, 0xf4,
+    0xd0, 0xa6, 0xd4, 0xb0, 0x3a, 0x54, 0xd5, 0xa2, 0x22, 0xda, 0x29, 0x20, 0x50, 0xd8, 0x43, 0x02,
+    0x07, 0x4a, 0x10, 0x57, 0x9b, 0x22, 0x00, 0x00, 0x8b, 0xd0, 0x03, 0x5a, 0xa0, 0x06, 0xaa, 0x00,
+    0x47, 0x98, 0xe7, 0x01, 0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1,
+    0x49, 0x02, 0x86, 0xc2, 0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x00, 0x00, 0x37, 0xd0,
+    0x04, 0x71, 0x8c, 0xe0, 0x03, 0xe3, 0xc7, 0x00, 0x1e, 0x7f, 0x38, 0x0e, 0xbd, 0x34, 0x29, 0xb5,
+    0x2c, 0x0e, 0x95, 0x35, 0x68, 0x88, 0xb6, 0x8a, 0x48, 0x14, 0x36, 0x10, 0xc0, 0x81, 0xd2, 0x84,
+    0x15, 0xe6, 0xc8, 0x80, 0x00, 0x01, 0xe9, 0x3b, 0x00, 0x22, 0x3b, 0x34, 0x00, 0xb4, 0xfe, 0xc0,
+    0x03, 0xcf, 0xe7, 0x01, 0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1,
+    0x49, 0x02, 0x86, 0xc2, 0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x00, 0x07, 0xd0, 0x9d,
+    0x00, 0x08, 0x80, 0x58, 0x00, 0xd8, 0x11, 0x60, 0x03, 0xcf, 0xe7, 0x01, 0xd7, 0xa6, 0x85, 0x36,
+    0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49, 0x02, 0x86, 0xc2, 0x18, 0x10, 0x3a, 0x50,
+    0x82, 0xbc, 0xd9, 0x10, 0x00, 0x00, 0x3f, 0x58, 0x06, 0x8f, 0x74, 0x00, 0xa3, 0xdd, 0x00, 0x27,
+    0xeb, 0x00, 0x8f, 0x3f, 0x9c, 0x07, 0x5e, 0x9a, 0x14, 0xda, 0x96, 0x07, 0x4a, 0x9a, 0xb4, 0x44,
+    0x5b, 0x45, 0x24, 0x0a, 0x1b, 0x08, 0x60, 0x40, 0xe9, 0x42, 0x0a, 0xf3, 0x64, 0x40, 0x00, 0x04,
+    0xcf, 0xe5, 0x4d, 0xfd, 0x40, 0x1b, 0x7a, 0x9a, 0xb5, 0xa4, 0xb3, 0x0a, 0xb5, 0x72, 0x48, 0x59,
+    0x49, 0x10, 0xcf, 0xf1, 0x27, 0xfc, 0x8c, 0x74, 0xb9, 0x82, 0x5c, 0xcd, 0xca, 0x12, 0x66, 0x27,
+    0x33, 0x91, 0x04, 0x0e, 0x94, 0x25, 0x29, 0x10, 0x24, 0x89, 0xb6, 0xcb, 0x4b, 0x5b, 0x40, 0x01,
+    0xaf, 0xe9, 0x00, 0xb1, 0x26, 0x4d, 0x20, 0x85, 0xac, 0xf2, 0xa0, 0x60, 0x60, 0x06, 0xc0, 0xf0,
+    0x0f, 0xb4, 0x0c, 0x00, 0xd8, 0x0a, 0x5a, 0xcf, 0x2a, 0x00, 0xc4, 0x98, 0x69, 0x00, 0x0d, 0x33,
+    0x20, 0x03, 0xa0, 0xd8, 0x03, 0xa9, 0xd0, 0x00, 0x00, 0x00, 0x64, 0x80, 0x7b, 0xd8, 0x40, 0x38,
+    0xf4, 0x03, 0x86, 0xb7, 0xe0, 0x02, 0xc6, 0xa9, 0x68, 0x04, 0x2d, 0x57, 0x87, 0x0c, 0x0e, 0xff,
+    0x48, 0x10, 0x03, 0x33, 0x8b, 0x40, 0x06, 0x67, 0xa0, 0x52, 0xe6, 0x65, 0x18, 0x03, 0x1a, 0x61,
+    0xe8, 0x00, 0x00, 0xdc, 0xe0, 0x1c, 0xe4, 0xe0, 0x1c, 0xba, 0x01, 0x86, 0xb7, 0xe0, 0x02, 0xc6,
+    0xa9, 0x68, 0x04, 0x2d, 0x57, 0x87, 0x0c, 0x0e, 0xff, 0x48, 0x10, 0x03, 0x33, 0x8b, 0x40, 0x06,
+    0x67, 0xa0, 0x52, 0xe6, 0x65, 0x18, 0x03, 0x1a, 0x61, 0xe8, 0x00, 0x00, 0x1f, 0xe0, 0x06, 0x1d,
+    0xb6, 0xa0, 0x08, 0x79, 0x2a, 0x80, 0x10, 0xd7, 0xf4, 0x00, 0x58, 0xd5, 0x2d, 0x00, 0x85, 0xaa,
+    0xf0, 0xe1, 0x81, 0xdf, 0xe9, 0x02, 0x00, 0x66, 0x71, 0x68, 0x00, 0xcc, 0xf4, 0x0a, 0x5c, 0xcc,
+    0xa3, 0x00, 0x63, 0x4c, 0x3d, 0x00, 0x05, 0xe2, 0x6e, 0x10, 0x00, 0x99, 0x80, 0xc4, 0x00, 0x9a,
+    0x2d, 0xa0, 0x10, 0xd7, 0xf4, 0x00, 0x58, 0xd5, 0x2d, 0x00, 0x85, 0xaa, 0xf0, 0xe1, 0x81, 0xdf,
+    0xe9, 0x02, 0x00, 0x66, 0x71, 0x68, 0x00, 0xcc, 0xf4, 0x0a, 0x5c, 0xcc, 0xa3, 0x00, 0x63, 0x4c,
+    0x3d, 0x00, 0x2f, 0x50, 0x28, 0x90, 0x03, 0xf8, 0x00, 0xf1, 0x00, 0x3f, 0xfa, 0x00, 0x04, 0xf3,
+    0x0f, 0x73, 0x08, 0x80, 0x1e, 0x20, 0x07, 0xff, 0x44, 0x08, 0xf9, 0x05, 0x57, 0x2b, 0x2e, 0x8e,
+    0x30, 0x1f, 0xa0, 0x07, 0xff, 0x60, 0x9c, 0x0a, 0xb1, 0x60, 0x32, 0x8a, 0x09, 0x90, 0x1f, 0xa0,
+    0x07, 0xff, 0x60, 0x00, 0x5a, 0x02, 0x08, 0x05, 0xb7, 0xbe, 0x60, 0x16, 0x99, 0xb0, 0x80, 0x2f,
+    0xca, 0x82, 0x00, 0x14, 0x7c, 0x24, 0x00, 0x3c, 0x2e, 0x15, 0x40, 0xa5, 0xc8, 0x88, 0x03, 0xd0,
+    0x20, 0x02, 0x03, 0x80, 0x71, 0x80, 0x30, 0x0c, 0x00, 0xe0, 0xa8, 0x5c, 0xcf, 0x2c, 0x21, 0x8f,
+    0x32, 0x79, 0x00, 0x00, 0x5e, 0x0f, 0x00, 0x42, 0xd1, 0xe8, 0x01, 0x0e, 0x27, 0x50, 0x00, 0xfd,
+    0xb7, 0xec, 0x40, 0x29, 0x8a, 0x5b, 0x00, 0xa1, 0x54, 0xca, 0x01, 0x10, 0x03, 0x80, 0x3f, 0xfa,
+    0xc0, 0x00, 0x5d, 0x80, 0x3d, 0x28, 0x40, 0x1c, 0x5a, 0x60, 0x18, 0x6b, 0x7e, 0x40, 0x2d, 0x48,
+    0x96, 0xa0, 0x43, 0xa7, 0x74, 0xa9, 0x18, 0x20, 0x01, 0x01, 0xfc, 0x03, 0xec, 0x03, 0x00, 0x20,
+    0x3a, 0x16, 0xb3, 0xca, 0x90, 0x62, 0x4c, 0x9a, 0x80, 0x00, 0xdb, 0x00, 0x1c, 0xa1, 0x00, 0x1c,
+    0xf8, 0x01, 0x86, 0xb7, 0xe4, 0x02, 0xd4, 0x89, 0x6a, 0x04, 0x3a, 0x77, 0x4a, 0x91, 0x82, 0x00,
+    0x10, 0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03, 0xa1, 0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9, 0xa8,
+    0x00, 0x00, 0x17, 0x68, 0x80, 0x6f, 0xb5, 0xa0, 0x0d, 0xab, 0x16, 0x01, 0x0d, 0x7f, 0x48, 0x05,
+    0xa9, 0x12, 0xd4, 0x08, 0x74, 0xee, 0x95, 0x23, 0x04, 0x00, 0x20, 0x3f, 0x80, 0x7d, 0x80, 0x60,
+    0x04, 0x07, 0x42, 0xd6, 0x79, 0x52, 0x0c, 0x49, 0x93, 0x50, 0x00, 0x00, 0x5e, 0x0f, 0x00, 0x42,
+    0xd1, 0xe8, 0x01, 0x0e, 0x27, 0x50, 0x04, 0x37, 0xfd, 0x20, 0x16, 0xa4, 0x4b, 0x50, 0x21, 0xd3,
+    0xba, 0x54, 0x8c, 0x10, 0x00, 0x80, 0xfe, 0x01, 0xf6, 0x01, 0x80, 0x10, 0x1d, 0x0b, 0x59, 0xe5,
+    0x48, 0x31, 0x26, 0x4d, 0x40, 0x00, 0x03, 0xe3, 0x4e, 0x20, 0x08, 0xc4, 0x0c, 0xc0, 0x03, 0xd2,
+    0x4d, 0x10, 0x00, 0xd7, 0xf4, 0x80, 0x5a, 0x91, 0x2d, 0x40, 0x87, 0x4e, 0xe9, 0x52, 0x30, 0x40,
+    0x02, 0x03, 0xf8, 0x07, 0xd8, 0x06, 0x00, 0x40, 0x74, 0x2d, 0x67, 0x95, 0x20, 0xc4, 0x99, 0x35,
+    0x00, 0x00, 0x2f, 0x98, 0x06, 0x30, 0x70, 0x00, 0x89, 0xf5, 0x44, 0x59, 0xdc, 0xde, 0xe5, 0x75,
+    0xdf, 0x41, 0xa2, 0x71, 0x80, 0x17, 0xd0, 0x03, 0xce, 0x00, 0x00, 0x00, 0xfe, 0x1a, 0xfe, 0x9c,
+    0x40, 0xd4, 0x89, 0x63, 0x44, 0x1d, 0x38, 0x80, 0x08, 0xc1, 0x11, 0x16, 0x0f, 0xe0, 0x55, 0xac,
+    0x00, 0xc0, 0xd8, 0x34, 0x07, 0x40, 0x09, 0xe5, 0x49, 0x89, 0x66, 0x4d, 0x40, 0xd9, 0x5f, 0xd2,
+    0x00, 0x00, 0x00, 0x5d, 0x80, 0x3d, 0x28, 0x40, 0x1c, 0x5a, 0x60, 0x11, 0xfa, 0x10, 0xb7, 0x80,
+    0x7f, 0xf3, 0x44, 0x03, 0x08, 0x06, 0x20, 0x07, 0x00, 0x08, 0x90, 0xf2, 0xc0, 0x17, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0xdb, 0x00, 0x1c, 0xa1, 0x00, 0x1c, 0xf8, 0x01, 0x1f, 0xa1, 0x0b, 0x78, 0x07,
+    0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70, 0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x40,
+    0x00, 0x00, 0x1f, 0x68, 0x80, 0x43, 0xd5, 0x50, 0x04, 0x3a, 0x8f, 0x60, 0x03, 0xf4, 0x00, 0x37,
+    0x80, 0x7f, 0xf3, 0x44, 0x03, 0x08, 0x06, 0x20, 0x07, 0x00, 0x08, 0x90, 0xf2, 0xc0, 0x17, 0x14,
+    0x14, 0x00, 0x00, 0x03, 0xe3, 0x4e, 0x20, 0x08, 0xc4, 0x0c, 0xc0, 0x03, 0xd2, 0x4d, 0x10, 0x3f,
+    0x40, 0x03, 0x78, 0x07, 0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70, 0x00, 0x89, 0x0f, 0x2c,
+    0x01, 0x71, 0x41, 0x40, 0x00, 0x00, 0x8b, 0xd0, 0x03, 0xa1, 0x50, 0x03, 0xa6, 0x80, 0x2a, 0xd0,
+    0x30, 0x7f, 0x0e, 0x23, 0x00, 0x52, 0x82, 0x0d, 0x81, 0x13, 0xc0, 0x0e, 0xa0, 0xa2, 0xa0, 0x0a,
+    0x23, 0xb7, 0x00, 0x8c, 0xa4, 0xf4, 0x03, 0x2a, 0x85, 0x00, 0x35, 0x03, 0x00, 0x73, 0x05, 0x80,
+    0x65, 0x83, 0x30, 0x04, 0x34, 0x3e, 0x01, 0x80, 0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67, 0xe1, 0x00,
+    0x52, 0x92, 0x38, 0x01, 0x3c, 0x37, 0x8b, 0x00, 0x2c, 0x00, 0x43, 0xe0, 0x1f, 0xeb, 0x00, 0x10,
+    0xf8, 0x01, 0xe1, 0xbc, 0x5c, 0x01, 0x29, 0x23, 0xa2, 0x00, 0x2c, 0xfc, 0x30, 0x0f, 0xfe, 0x28,
+    0x08, 0xd0, 0x9c, 0x00, 0xbc, 0x40, 0x5c, 0x02, 0x7c, 0x08, 0xb0, 0x05, 0x68, 0x04, 0xfe, 0x1c,
+    0x46, 0x00, 0xa5, 0x04, 0x1b, 0x02, 0x27, 0x80, 0x1d, 0x41, 0x45, 0x40, 0x14, 0x47, 0x6e, 0x01,
+    0x19, 0x49, 0xe8, 0x06, 0x55, 0x0a, 0x00, 0x6a, 0x06, 0x00, 0xe6, 0x0b, 0x00, 0xcb, 0x06, 0x60,
+    0x08, 0x68, 0x7c, 0x03, 0x00, 0x00, 0x17, 0xfd, 0x40, 0x1c, 0x5b, 0xb5, 0x80, 0x78, 0x8a, 0x10,
+    0x0f, 0x2f, 0xe0, 0x07, 0xdc, 0x06, 0x40, 0x1e, 0x48, 0x05, 0x00, 0xe5, 0x05, 0x4b, 0x00, 0xee,
+    0x22, 0x69, 0x90, 0x04, 0x28, 0xa0, 0xe0, 0xa0, 0x13, 0x86, 0x88, 0x15, 0x80, 0x5a, 0x15, 0xdc,
+    0x23, 0x20, 0x14, 0x5b, 0xba, 0x41, 0x41, 0xc2, 0x51, 0x26, 0x2b, 0x0d, 0x13, 0x00, 0xca, 0x64,
+    0x00, 0x03, 0xff, 0xa4, 0x00, 0x7b, 0xb4, 0x00, 0x44, 0x50, 0x80, 0x0f, 0x3f, 0x9c, 0x07, 0x5e,
+    0x9a, 0x14, 0xda, 0x96, 0x07, 0x4a, 0x9a, 0xb4, 0x44, 0x5b, 0x45, 0x24, 0x0a, 0x1b, 0x08, 0x60,
+    0x40, 0xe9, 0x42, 0x0a, 0xf3, 0x64, 0x40, 0x00, 0x00, 0x12, 0x80, 0xb0, 0x07, 0xac, 0x67, 0xc0,
+    0x38, 0xa3, 0x92, 0x00, 0x3c, 0xdf, 0x82, 0x01, 0xe5, 0xfc, 0x00, 0xfb, 0x80, 0xc8, 0x03, 0xc9,
+    0x00, 0xa0, 0x1c, 0xa0, 0xa9, 0x60, 0x1d, 0xc4, 0x4d, 0x32, 0x00, 0x85, 0x14, 0x1c, 0x14, 0x02,
+    0x70, 0xd1, 0x02, 0xb0, 0x0b, 0x42, 0xbb, 0x84, 0x64, 0x02, 0x8b, 0x77, 0x48, 0x28, 0x38, 0x4a,
+    0x24, 0xc5, 0x61, 0xa2, 0x60, 0x19, 0x4c, 0x80, 0x05, 0xb0, 0x6a, 0x00, 0x28, 0xfd, 0xc0, 0x05,
+    0x5f, 0xa4, 0x00, 0x3c, 0xfe, 0x70, 0x06, 0x85, 0x34, 0x29, 0x3e, 0xac, 0x0e, 0x95, 0xb5, 0x68,
+    0x88, 0xb6, 0x8a, 0x08, 0x14, 0x36, 0x14, 0xc0, 0x81, 0xd2, 0x84, 0x15, 0xe6, 0xc8, 0x80, 0x00,
+    0x00, 0x97, 0xf0, 0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5, 0x80, 0x77,
+    0x11, 0x34, 0xc8, 0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d, 0x0a, 0xee,
+    0x11, 0x90, 0x0a, 0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80, 0x65, 0x32,
+    0xbe, 0x00, 0xe3, 0x31, 0x00, 0x78, 0x51, 0x00, 0x1f, 0x0a, 0x3a, 0x80, 0x03, 0xcf, 0xe7, 0x01,
+    0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49, 0x02, 0x86, 0xc2,
+    0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x01, 0x84, 0x77, 0xf8, 0x6c, 0x03, 0x59, 0x00, 0x75,
+    0x9c, 0x00, 0x00, 0xe1, 0x30, 0x0f, 0xd5, 0x20, 0x1f, 0x1a, 0xd8, 0x07, 0xc7, 0xc2, 0x01, 0xc3,
+    0x3d, 0xfa, 0xc0, 0x11, 0x7b, 0x23, 0x8c, 0xc8, 0x01, 0x21, 0xb5, 0x18, 0xec, 0x64, 0x92, 0x40,
+    0x14, 0xa3, 0x38, 0x28, 0x06, 0x1b, 0x53, 0x03, 0x00, 0xf8, 0xc0, 0xc0, 0x3e, 0x70, 0x50, 0x0e,
+    0xb5, 0x23, 0x92, 0x00, 0xa1, 0x18, 0x38, 0x36, 0xa3, 0x1d, 0x8c, 0x0b, 0xd9, 0x1c, 0x66, 0x40,
+    0x00, 0x00, 0xdd, 0x00, 0x1c, 0xa7, 0x00, 0x1c, 0xf8, 0x01, 0x86, 0xb7, 0xe4, 0x02, 0xc4, 0x99,
+    0x34, 0x82, 0x16, 0xb3, 0xca, 0x81, 0x81, 0x80, 0x1b, 0x03, 0xc0, 0x3e, 0xd0, 0x30, 0x03, 0x60,
+    0x29, 0x6b, 0x3c, 0xa8, 0x03, 0x12, 0x64, 0xd2, 0x00, 0x00, 0xca, 0xe0, 0x1f, 0x25, 0xe4, 0x80,
+    0x78, 0xb6, 0xf8, 0x40, 0x39, 0x8c, 0x1c, 0x40, 0x30, 0xcf, 0x7e, 0xb0, 0x04, 0x5e, 0xc8, 0xe3,
+    0x32, 0x00, 0x48, 0x6d, 0x46, 0x3b, 0x19, 0x24, 0x90, 0x05, 0x28, 0xce, 0x0a, 0x01, 0x86, 0xd4,
+    0xc0, 0xc0, 0x3e, 0x30, 0x30, 0x0f, 0x9c, 0x14, 0x03, 0xad, 0x48, 0xe4, 0x80, 0x28, 0x46, 0x0e,
+    0x0d, 0xa8, 0xc7, 0x63, 0x02, 0xf6, 0x47, 0x19, 0x90, 0x00, 0x00, 0x17, 0x68, 0x80, 0x43, 0xf6,
+    0x94, 0x01, 0x0e, 0xac, 0xd8, 0x04, 0x35, 0xfd, 0x20, 0x16, 0x24, 0xc9, 0xa4, 0x10, 0xb5, 0x9e,
+    0x54, 0x0c, 0x0c, 0x00, 0xd8, 0x1e, 0x01, 0xf6, 0x81, 0x80, 0x1b, 0x01, 0x4b, 0x59, 0xe5, 0x40,
+    0x18, 0x93, 0x26, 0x90, 0x00, 0x00, 0xd1, 0xa0, 0x1f, 0xbc, 0x40, 0x3f, 0x3e, 0x00, 0x78, 0x67,
+    0xbf, 0x58, 0x02, 0x2f, 0x64, 0x71, 0x99, 0x00, 0x24, 0x36, 0xa3, 0x1d, 0x8c, 0x92, 0x48, 0x02,
+    0x94, 0x67, 0x05, 0x00, 0xc3, 0x6a, 0x60, 0x60, 0x1f, 0x18, 0x18, 0x07, 0xce, 0x0a, 0x01, 0xd6,
+    0xa4, 0x72, 0x40, 0x14, 0x23, 0x07, 0x06, 0xd4, 0x63, 0xb1, 0x81, 0x7b, 0x23, 0x8c, 0xc8, 0x00,
+    0x00, 0xb2, 0x40, 0x3c, 0xe2, 0x01, 0xeb, 0x80, 0x0c, 0x35, 0xfd, 0x20, 0x16, 0x24, 0xc9, 0xa4,
+    0x10, 0xb5, 0x9e, 0x54, 0x0c, 0x0c, 0x00, 0xd8, 0x1e, 0x01, 0xf6, 0x81, 0x80, 0x1b, 0x01, 0x4b,
+    0x59, 0xe5, 0x40, 0x18, 0x93, 0x26, 0x90, 0x00, 0x00, 0x98, 0xc1, 0xc4, 0x03, 0x8b, 0x6f, 0x44,
+    0x03, 0x92, 0xf2, 0x80, 0x3e, 0x57, 0x00, 0xf0, 0xcf, 0x7e, 0xb0, 0x04, 0x5e, 0xc8, 0xe3, 0x32,
+    0x00, 0x48, 0x6d, 0x46, 0x3b, 0x19, 0x24, 0x90, 0x05, 0x28, 0xce, 0x0a, 0x01, 0x86, 0xd4, 0xc0,
+    0xc0, 0x3e, 0x30, 0x30, 0x0f, 0x9c, 0x14, 0x03, 0xad, 0x48, 0xe4, 0x80, 0x28, 0x46, 0x0e, 0x0d,
+    0xa8, 0xc7, 0x63, 0x02, 0xf6, 0x47, 0x19, 0x90, 0x00, 0x01, 0xe5, 0x8b, 0x00, 0x87, 0x6d, 0xa8,
+    0x03, 0x1f, 0x70, 0x40, 0x21, 0xaf, 0xe8, 0x00, 0xb1, 0x26, 0x4f, 0x20, 0x85, 0xac, 0xf0, 0x80,
+    0x60, 0x60, 0x07, 0xd0, 0xf0, 0x0f, 0xb4, 0x0c, 0x00, 0xd6, 0x0a, 0x5a, 0xcf, 0x24, 0x00, 0xc4,
+    0x99, 0x34, 0x80, 0x00, 0x38, 0x89, 0xc0, 0x3d, 0xd7, 0x6e, 0x00, 0xf4, 0x22, 0x20, 0x03, 0xc3,
+    0xdc, 0x10, 0x0c, 0x3f, 0xfb, 0x5c, 0x03, 0x92, 0x20, 0xf1, 0x80, 0x1b, 0x1d, 0xd5, 0x66, 0xe0,
+    0x1f, 0x22, 0x28, 0x03, 0xf1, 0x90, 0x80, 0x7d, 0xc0, 0x60, 0x1f, 0x70, 0x10, 0x07, 0xc6, 0x40,
+    0x1f, 0x22, 0x28, 0x02, 0xd6, 0x7a, 0xb3, 0x70, 0x09, 0x66, 0x1e, 0x30, 0x00, 0x00, 0x00, 0xfd,
+    0x4c, 0x01, 0xc7, 0xe8, 0xc6, 0x01, 0xfc, 0xc0, 0x1f, 0xb0, 0xc0, 0xaf, 0xf1, 0x80, 0x3b, 0xd6,
+    0x52, 0xc0, 0x32, 0x96, 0xb4, 0x48, 0x06, 0xd0, 0x30, 0x02, 0x80, 0x7f, 0xf0, 0xb4, 0x0c, 0x00,
+    0x80, 0x19, 0x47, 0x5a, 0x20, 0x01, 0xd8, 0x52, 0x96, 0x01, 0x80, 0x08, 0xff, 0xba, 0xcc, 0x03,
+    0xa2, 0x0c, 0xcc, 0x50, 0x0c, 0xee, 0x8d, 0x4a, 0x10, 0x0f, 0xa0, 0x1c, 0x04, 0x04, 0x40, 0x03,
+    0x0f, 0xd6, 0x0e, 0xe3, 0x80, 0x08, 0xf8, 0xc2, 0xec, 0xc0, 0x02, 0x33, 0x20, 0x22, 0x04, 0x0c,
+    0x3c, 0x03, 0xe8, 0x07, 0x00, 0x99, 0x91, 0xa9, 0x42, 0x01, 0x4c, 0x99, 0x98, 0xa0, 0x00, 0x00,
+    0xe3, 0xf4, 0x00, 0xcd, 0xf8, 0x16, 0x80, 0x13, 0xed, 0x04, 0xa0, 0x15, 0xf7, 0x00, 0x04, 0x00,
+    0xf5, 0x94, 0xb0, 0x09, 0x4b, 0x5a, 0x24, 0x02, 0xd0, 0x30, 0x02, 0x80, 0x7f, 0xf0, 0x34, 0x0c,
+    0x00, 0x80, 0x12, 0x8e, 0xb4, 0x40, 0x03, 0x61, 0x4a, 0x58, 0x04, 0x00, 0x00, 0x47, 0xfc, 0x80,
+    0x14, 0xee, 0xc8, 0x01, 0x09, 0x14, 0x00, 0x1f, 0xff, 0x60, 0x01, 0x22, 0x34, 0x80, 0x31, 0xdf,
+    0x28, 0x07, 0xfb, 0xc4, 0x70, 0x04, 0xfd, 0xd9, 0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8, 0x98, 0x40,
+    0x3f, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a, 0x40, 0x01, 0xff, 0xac, 0x02, 0x1d, 0xda, 0x40, 0x31,
+    0x16, 0x00, 0x86, 0xbf, 0xa0, 0x02, 0xc6, 0xa9, 0x68, 0x04, 0x2d, 0x57, 0x87, 0x0c, 0x0e, 0xff,
+    0x48, 0x10, 0x03, 0x33, 0x8b, 0x40, 0x06, 0x67, 0xa0, 0x52, 0xe6, 0x65, 0x18, 0x03, 0x1a, 0x61,
+    0xe8, 0x00, 0x00, 0x29, 0x02, 0x18, 0x05, 0xb6, 0x32, 0x01, 0xa0, 0xb9, 0x4c, 0x03, 0x5f, 0xc0,
+    0x00, 0x7f, 0xfd, 0x80, 0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0, 0x1f, 0xef, 0x11, 0xc0, 0x13,
+    0xf7, 0x66, 0x00, 0x35, 0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff, 0x63, 0xbe, 0x50, 0x02, 0x44,
+    0x69, 0x00, 0x02, 0xd0, 0x4d, 0x00, 0x89, 0x7e, 0xb8, 0x03, 0x47, 0xf1, 0x80, 0x43, 0x5f, 0xd0,
+    0x01, 0x63, 0x54, 0xb4, 0x02, 0x16, 0xab, 0xc3, 0x86, 0x07, 0x7f, 0xa4, 0x08, 0x01, 0x99, 0xc5,
+    0xa0, 0x03, 0x33, 0xd0, 0x29, 0x73, 0x32, 0x8c, 0x01, 0x8d, 0x30, 0xf4, 0x00, 0x00, 0x97, 0x88,
+    0x03, 0xc6, 0x60, 0x0e, 0x5d, 0x10, 0x00, 0xff, 0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9,
+    0x40, 0x3f, 0xde, 0x23, 0x80, 0x27, 0xee, 0xcc, 0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01,
+    0xfe, 0xc7, 0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00, 0x00, 0xb6, 0x00, 0x3c, 0x3e, 0x01, 0xec, 0x70,
+    0x0c, 0x35, 0xfd, 0x00, 0x16, 0x35, 0x4b, 0x40, 0x21, 0x6a, 0xbc, 0x38, 0x60, 0x77, 0xfa, 0x40,
+    0x80, 0x19, 0x9c, 0x5a, 0x00, 0x33, 0x3d, 0x02, 0x97, 0x33, 0x28, 0xc0, 0x18, 0xd3, 0x0f, 0x40,
+    0x00, 0x1f, 0xff, 0x60, 0x01, 0x22, 0x34, 0x80, 0x31, 0xdf, 0x28, 0x07, 0xfb, 0xc4, 0x70, 0x04,
+    0xfd, 0xd9, 0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8, 0x98, 0x40, 0x3f, 0xd8, 0xef, 0x94, 0x00, 0x91,
+    0x1a, 0xc7, 0xff, 0x60, 0x50, 0x07, 0x50, 0xb0, 0x07, 0x68, 0x70, 0x01, 0xaf, 0xe8, 0x00, 0xb1,
+    0xaa, 0x5a, 0x01, 0x0b, 0x55, 0xe1, 0xc3, 0x03, 0xbf, 0xd2, 0x04, 0x00, 0xcc, 0xe2, 0xd0, 0x01,
+    0x99, 0xe0, 0x14, 0xb9, 0x99, 0x68, 0x00, 0xc6, 0x99, 0x06, 0x00, 0x06, 0xfc, 0xd8, 0xc0, 0x38,
+    0xc4, 0x40, 0x1c, 0xae, 0xc0, 0x00, 0x00, 0x2a, 0x03, 0x18, 0x04, 0x34, 0xd0, 0x40, 0x12, 0x3c,
+    0xd0, 0x80, 0x69, 0xf4, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x91, 0x1a, 0x40, 0x18, 0xef, 0x94, 0x03,
+    0xfd, 0xe2, 0x38, 0x02, 0x7e, 0xec, 0xc0, 0x06, 0xbb, 0xce, 0x00, 0xe4, 0x4c, 0x20, 0x1f, 0xec,
+    0x77, 0xca, 0x00, 0x48, 0x8d, 0x20, 0x01, 0xe4, 0x9a, 0x00, 0x86, 0xad, 0x28, 0x03, 0x27, 0xe8,
+    0x06, 0x1a, 0xfe, 0x80, 0x0b, 0x1a, 0xa5, 0xa0, 0x10, 0xb5, 0x5e, 0x1c, 0x30, 0x3b, 0xfd, 0x20,
+    0x40, 0x0c, 0xce, 0x2d, 0x00, 0x19, 0x9e, 0x81, 0x4b, 0x99, 0x94, 0x60, 0x0c, 0x69, 0x87, 0xa0,
+    0x00, 0x00, 0xca, 0xe0, 0x1f, 0x25, 0xe4, 0x80, 0x78, 0xb6, 0xf8, 0x40, 0x39, 0x8c, 0x1c, 0x40,
+    0x30, 0xcf, 0x7e, 0xb0, 0x04, 0x5e, 0xc8, 0xe3, 0x34, 0x00, 0x90, 0xda, 0x8c, 0x85, 0x42, 0x49,
+    0x20, 0x09, 0xe5, 0xdc, 0x0a, 0x01, 0x08, 0x9c, 0xcc, 0x06, 0x00, 0x6e, 0xea, 0x8c, 0x0c, 0x00,
+    0xf7, 0x61, 0x37, 0x05, 0x00, 0x0a, 0x28, 0xf1, 0x1c, 0x90, 0x05, 0x60, 0xa1, 0xc1, 0xb5, 0x18,
+    0xb0, 0x40, 0x5e, 0xc8, 0xe1, 0x4e, 0x00, 0x00, 0x1f, 0xe8, 0x06, 0x1d, 0xa4, 0xa0, 0x08, 0x79,
+    0x66, 0x80, 0x22, 0xbf, 0xc5, 0xf4, 0x0f, 0x59, 0xbb, 0x00, 0x14, 0xb5, 0x9e, 0x00, 0x1a, 0x06,
+    0x00, 0x40, 0x0f, 0xf6, 0x81, 0x80, 0x10, 0x00, 0xa3, 0xad, 0x10, 0x00, 0xb0, 0xa5, 0x2c, 0x1c,
+    0x1f, 0x7f, 0x04, 0x04, 0x23, 0x15, 0xa4, 0xc8, 0x3d, 0xaa, 0x5f, 0x40, 0x00, 0x9c, 0x00, 0xc2,
+    0x01, 0xd8, 0xc5, 0x00, 0x1e, 0xab, 0xcb, 0x10, 0x0e, 0x1d, 0xe5, 0x00, 0xe1, 0x9e, 0xfd, 0x60,
+    0x08, 0xbd, 0x91, 0xc6, 0x68, 0x01, 0x21, 0xb5, 0x19, 0x0a, 0x84, 0x92, 0x40, 0x13, 0xcb, 0xb8,
+    0x14, 0x02, 0x11, 0x39, 0x98, 0x0c, 0x00, 0xdd, 0xd5, 0x18, 0x18, 0x01, 0xee, 0xc2, 0x6e, 0x0a,
+    0x00, 0x14, 0x51, 0xe2, 0x39, 0x20, 0x0a, 0xc1, 0x43, 0x83, 0x6a, 0x31, 0x60, 0x80, 0xbd, 0x91,
+    0xc2, 0x9c, 0x00, 0x02, 0xe0, 0x3d, 0x00, 0x8a, 0x7f, 0x64, 0x03, 0x3f, 0xf2, 0x00, 0x45, 0x7f,
+    0x8b, 0xe8, 0x1e, 0xb3, 0x76, 0x00, 0x29, 0x6b, 0x3c, 0x00, 0x34, 0x0c, 0x00, 0x80, 0x1f, 0xed,
+    0x03, 0x00, 0x20, 0x01, 0x47, 0x5a, 0x20, 0x01, 0x61, 0x4a, 0x58, 0x38, 0x3e, 0xfe, 0x08, 0x08,
+    0x46, 0x2b, 0x49, 0x90, 0x7b, 0x54, 0xbe, 0x80, 0x00, 0xd1, 0xa0, 0x1f, 0xbc, 0x40, 0x3f, 0x3e,
+    0x00, 0x78, 0x67, 0xbf, 0x58, 0x02, 0x2f, 0x64, 0x71, 0x9a, 0x00, 0x48, 0x6d, 0x46, 0x42, 0xa1,
+    0x24, 0x90, 0x04, 0xf2, 0xee, 0x05, 0x00, 0x84, 0x4e, 0x66, 0x03, 0x00, 0x37, 0x75, 0x46, 0x06,
+    0x00, 0x7b, 0xb0, 0x9b, 0x82, 0x80, 0x05, 0x14, 0x78, 0x8e, 0x48, 0x02, 0xb0, 0x50, 0xe0, 0xda,
+    0x8c, 0x58, 0x20, 0x2f, 0x64, 0x70, 0xa7, 0x00, 0x00, 0xb6, 0x40, 0x3c, 0x22, 0x00, 0xf6, 0x40,
+    0x06, 0x2b, 0xfc, 0x5f, 0x40, 0xf5, 0x9b, 0xb0, 0x01, 0x4b, 0x59, 0xe0, 0x01, 0xa0, 0x60, 0x04,
+    0x00, 0xff, 0x68, 0x18, 0x01, 0x00, 0x0a, 0x3a, 0xd1, 0x00, 0x0b, 0x0a, 0x52, 0xc1, 0xc1, 0xf7,
+    0xf0, 0x40, 0x42, 0x31, 0x5a, 0x4c, 0x83, 0xda, 0xa5, 0xf4, 0x00, 0x00, 0x0c, 0xf7, 0xeb, 0x00,
+    0x45, 0xec, 0x8e, 0x33, 0x40, 0x09, 0x0d, 0xa8, 0xc8, 0x54, 0x24, 0x92, 0x00, 0x9e, 0x5d, 0xc0,
+    0xa0, 0x10, 0x89, 0xcc, 0xc0, 0x60, 0x06, 0xee, 0xa8, 0xc0, 0xc0, 0x0f, 0x76, 0x13, 0x70, 0x50,
+    0x00, 0xa2, 0x8f, 0x11, 0xc9, 0x00, 0x56, 0x0a, 0x1c, 0x1b, 0x51, 0x8b, 0x04, 0x05, 0xec, 0x8e,
+    0x14, 0xe0, 0x10, 0xcf, 0x7e, 0x28, 0x07, 0xaa, 0xc0, 0x3f, 0x3e, 0x80, 0x7e, 0x67, 0x00, 0xc0,
+    0x00, 0xc2, 0x01, 0xe5, 0xc0, 0x0f, 0x7a, 0x00, 0x78, 0x78, 0x03, 0xd6, 0xe0, 0x18, 0xaf, 0xf1,
+    0x7d, 0x03, 0xd6, 0x6e, 0xc0, 0x05, 0x2d, 0x67, 0x80, 0x06, 0x81, 0x80, 0x10, 0x03, 0xfd, 0xa0,
+    0x60, 0x04, 0x00, 0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b, 0x07, 0x07, 0xdf, 0xc1, 0x01, 0x08,
+    0xc5, 0x69, 0x32, 0x0f, 0x6a, 0x97, 0xd0, 0x00, 0x00, 0xcc, 0xc0, 0x0f, 0x96, 0x20, 0x80, 0x1e,
+    0xbb, 0x44, 0x80, 0x7b, 0x95, 0xb4, 0x02, 0x1f, 0x70, 0x0c, 0xfe, 0x01, 0xff, 0xd5, 0xf2, 0x2d,
+    0xe0, 0x19, 0xf7, 0x73, 0x80, 0x66, 0xaa, 0xca, 0x01, 0xb9, 0x57, 0x68, 0x07, 0xff, 0x50, 0x02,
+    0x82, 0x00, 0xf7, 0x2f, 0x00, 0x73, 0x0e, 0x83, 0x80, 0x66, 0xd0, 0xc7, 0x00, 0xe3, 0xf4, 0x00,
+    0xff, 0xe7, 0x16, 0x7d, 0x88, 0x06, 0x84, 0x74, 0xb0, 0x0d, 0x31, 0x06, 0x50, 0x0c, 0x60, 0x0f,
+    0x00, 0xff, 0xed, 0x00, 0x0d, 0xa0, 0x0c, 0x9e, 0x80, 0x1f, 0xfc, 0x0a, 0x25, 0xff, 0xd6, 0x16,
+    0x30, 0x49, 0x99, 0xa4, 0x24, 0x48, 0x00, 0x23, 0x8c, 0x08, 0x02, 0x4d, 0xdd, 0x40, 0x1c, 0x75,
+    0x5a, 0x00, 0x39, 0x95, 0x71, 0x80, 0x7f, 0xf6, 0x00, 0x03, 0xf4, 0x00, 0xe3, 0xc0, 0xbf, 0x70,
+    0x08, 0xe8, 0x27, 0x58, 0x03, 0x30, 0x03, 0xb9, 0x62, 0x01, 0xa1, 0x1d, 0x2c, 0x03, 0x4c, 0x41,
+    0x94, 0x03, 0x18, 0x03, 0xc0, 0x3f, 0xfb, 0x40, 0x1c, 0x94, 0xa4, 0x6e, 0xaf, 0x5a, 0x7e, 0x50,
+    0x1f, 0x70, 0x0f, 0xff, 0x38, 0x2e, 0x85, 0x95, 0x61, 0xad, 0x78, 0x9f, 0x40, 0x3f, 0x40, 0x0f,
+    0xfe, 0xc0, 0x3f, 0xfa, 0x4f, 0x76, 0x80, 0x22, 0x84, 0x07, 0xdc, 0x03, 0xff, 0xce, 0x00, 0x6f,
+    0xf9, 0xdd, 0xbb, 0x30, 0x91, 0x42, 0x07, 0xe8, 0x01, 0xff, 0xd8, 0x00, 0x25, 0x02, 0x61, 0x81,
+    0xaf, 0x3a, 0xe4, 0x90, 0x7f, 0xc0, 0x00, 0xfb, 0x80, 0x7f, 0xf9, 0xc0, 0x79, 0x08, 0x83, 0xaf,
+    0xa4, 0x86, 0x76, 0x08, 0x1f, 0x20, 0x07, 0xff, 0x60, 0x1f, 0x70, 0x0f, 0xfe, 0x94, 0x93, 0x31,
+    0xc1, 0xd5, 0x80, 0x03, 0xf4, 0x01, 0x27, 0x02, 0xd3, 0x03, 0xf4, 0x00, 0xff, 0xe8, 0xc2, 0x20,
+    0x93, 0x00, 0x8e, 0x10, 0x1e, 0x60, 0x33, 0x0e, 0xa8, 0xfb, 0x80, 0x7f, 0xf4, 0x80, 0x3f, 0x40,
+    0x0f, 0xfe, 0x48, 0x1f, 0x70, 0x0e, 0x6f, 0x10, 0x0f, 0xff, 0xc8, 0xea, 0x00, 0x7e, 0x12, 0x30,
+    0x07, 0x00, 0x80, 0x64, 0x95, 0x67, 0x50, 0x0e, 0xa4, 0xb8, 0x6a, 0x00, 0x3f, 0x42, 0xe5, 0x12,
+    0x70, 0x31, 0x2d, 0x32, 0xd4, 0x3f, 0x41, 0xf5, 0x00, 0xff, 0xef, 0x1f, 0xa0, 0x07, 0x0c, 0x03,
+    0x00, 0x11, 0x98, 0x60, 0x00, 0xe7, 0x60, 0x0f, 0x3d, 0xd9, 0x80, 0x3d, 0xbe, 0x20, 0x1c, 0xe2,
+    0x4e, 0x01, 0xec, 0xb0, 0x0f, 0xff, 0x63, 0xf0, 0x07, 0xc2, 0x30, 0x00, 0x88, 0x00, 0x70, 0xc7,
+    0xb1, 0xd0, 0x00, 0xe0, 0xc3, 0x4a, 0x00, 0x00, 0x08, 0xf9, 0x05, 0x57, 0x2b, 0x2e, 0x8e, 0x30,
+    0x1f, 0xa0, 0x07, 0xff, 0x74, 0xa8, 0x18, 0x11, 0x9c, 0x80, 0x1f, 0x70, 0x09, 0xbe, 0x00, 0x39,
+    0x25, 0x60, 0x03, 0x15, 0x1d, 0x00, 0x61, 0xf0, 0xd0, 0x0e, 0xa2, 0xd1, 0x00, 0xd2, 0x80, 0xa0,
+    0x1c, 0x34, 0x92, 0x20, 0x19, 0x96, 0x82, 0x80, 0x37, 0x00, 0xca, 0x28, 0x07, 0x98, 0xec, 0x40,
+    0x3d, 0xc3, 0x63, 0xee, 0x01, 0x17, 0xd0, 0x04, 0x7e, 0x40, 0x1e, 0x52, 0x20, 0x07, 0xd6, 0x01,
+    0x80, 0x3f, 0x40, 0x0f, 0xfe, 0x69, 0x75, 0x00, 0x61, 0xc2, 0xa0, 0x08, 0x70, 0xf4, 0x03, 0x59,
+    0x48, 0x80, 0x63, 0x19, 0x00, 0xe9, 0xd2, 0x80, 0x0e, 0x37, 0x72, 0x00, 0x74, 0x1d, 0x09, 0xfa,
+    0x00, 0x33, 0x84, 0x02, 0xf5, 0x00, 0xe3, 0x05, 0x00, 0xe7, 0x70, 0x06, 0x00, 0x3f, 0x40, 0x06,
+    0xe8, 0x03, 0xa0, 0xb8, 0x03, 0x13, 0xb8, 0xc0, 0x21, 0xe3, 0x80, 0x0d, 0x47, 0x00, 0x1d, 0x05,
+    0x20, 0x1c, 0x7e, 0x78, 0x01, 0xc5, 0x85, 0x40, 0x00, 0x00, 0x19, 0x00, 0x71, 0xe0, 0x07, 0xa1,
+    0xc8, 0x03, 0xae, 0x00, 0x38, 0x7d, 0xc0, 0x3f, 0xff, 0x78, 0xef, 0x84, 0x00, 0x91, 0x19, 0x40,
+    0x00, 0x20, 0x83, 0x50, 0x02, 0xec, 0x21, 0xaa, 0x07, 0xe8, 0x01, 0xff, 0xdd, 0x00, 0x1f, 0x70,
+    0x0f, 0xff, 0xde, 0x3b, 0xe1, 0x00, 0x24, 0x46, 0x51, 0xff, 0xf2, 0x00, 0x5b, 0x00, 0x1e, 0x2b,
+    0x00, 0xe2, 0x53, 0x00, 0x80, 0x3f, 0x40, 0x0f, 0xfe, 0x91, 0xfa, 0x23, 0xc4, 0xd0, 0x7f, 0x80,
+    0x00, 0xd6, 0xa0, 0x01, 0xf7, 0x05, 0x10, 0x0f, 0x98, 0x03, 0xdc, 0x40, 0x1f, 0xfe, 0x8c, 0x77,
+    0xc2, 0x00, 0x48, 0x8c, 0xa0, 0x00, 0xa9, 0x8f, 0xd1, 0x8c, 0x03, 0x30, 0x05, 0x86, 0x01, 0xff,
+    0xdc, 0x00, 0x1f, 0x70, 0x0f, 0xfe, 0xa0, 0xf3, 0x80, 0x78, 0xc4, 0x03, 0x87, 0x58, 0x03, 0xff,
+    0x91, 0x8e, 0xf8, 0x40, 0x09, 0x11, 0x94, 0x3f, 0x40, 0x0f, 0xfe, 0x45, 0xd8, 0x02, 0x77, 0x00,
+    0x59, 0x80, 0x0f, 0xfe, 0x40, 0x09, 0xe0, 0x0f, 0xfe, 0x6b, 0xa8, 0x06, 0x1d, 0x81, 0x00, 0x0b,
+    0x03, 0x72, 0x00, 0x30, 0x01, 0x62, 0x01, 0x52, 0x88, 0x07, 0x39, 0x80, 0x7e, 0x17, 0x7c, 0xa0,
+    0x14, 0x46, 0xe0, 0x03, 0xf4, 0x00, 0xff, 0xe1, 0x6a, 0x03, 0x83, 0x39, 0xd8, 0x51, 0x84, 0x00,
+    0x81, 0xa0, 0x07, 0xff, 0x18, 0x00, 0xe2, 0x30, 0x0f, 0xd8, 0x80, 0x1f, 0x29, 0xb8, 0x07, 0xcb,
+    0xa0, 0x18, 0x7f, 0x40, 0x33, 0xf8, 0x80, 0x09, 0xc0, 0x3f, 0x0c, 0x08, 0x07, 0xd2, 0x36, 0x01,
+    0xfa, 0x14, 0xc0, 0x3e, 0x62, 0xf0, 0x0f, 0xd2, 0x6c, 0x01, 0xf2, 0x2c, 0x00, 0x7e, 0xb1, 0x90,
+    0x0f, 0x86, 0x04, 0x03, 0xf3, 0x90, 0x00, 0x00, 0xdb, 0x00, 0x1c, 0xa1, 0x00, 0x1c, 0xf8, 0x01,
+    0x1f, 0xbf, 0xf5, 0x88, 0x05, 0x31, 0x4b, 0x60, 0x14, 0x2a, 0x99, 0x40, 0x22, 0x00, 0x70, 0x07,
+    0xff, 0x58, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02, 0x70, 0x0f, 0xc3, 0x02, 0x01, 0xf4, 0x8d, 0x80,
+    0x7e, 0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4, 0x9b, 0x00, 0x7c, 0x8b, 0x00, 0x1f, 0xac, 0x64,
+    0x03, 0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x1f, 0x70, 0x0d, 0xbe, 0x20, 0x1b, 0x60, 0x03, 0xf1,
+    0x58, 0x07, 0xc4, 0x86, 0x01, 0x80, 0x3f, 0x7d, 0xfb, 0x10, 0x0a, 0x62, 0x96, 0xc0, 0x28, 0x55,
+    0x32, 0x80, 0x44, 0x00, 0xe0, 0x0f, 0xfe, 0xb1, 0xfa, 0x00, 0x1b, 0xc0, 0x37, 0x38, 0x07, 0x08,
+    0x94, 0x03, 0x89, 0x88, 0x02, 0x00, 0x00, 0x9c, 0x44, 0xe0, 0x1e, 0xeb, 0xb7, 0x00, 0x7a, 0x11,
+    0x10, 0x01, 0xe1, 0xee, 0x08, 0x04, 0x3f, 0xa0, 0x19, 0xfc, 0x40, 0x04, 0xe0, 0x1f, 0x86, 0x04,
+    0x03, 0xe9, 0x1b, 0x00, 0xfd, 0x0a, 0x60, 0x1f, 0x31, 0x78, 0x07, 0xe9, 0x36, 0x00, 0xf9, 0x16,
+    0x00, 0x3f, 0x58, 0xc8, 0x07, 0xc3, 0x02, 0x01, 0xf9, 0xc8, 0x00, 0x00, 0x01, 0xd5, 0x8b, 0x00,
+    0x87, 0xe1, 0x68, 0x03, 0x16, 0xe8, 0x40, 0x07, 0xef, 0xbf, 0x62, 0x01, 0x4c, 0x52, 0xd8, 0x05,
+    0x0a, 0xa6, 0x50, 0x08, 0x80, 0x1c, 0x01, 0xff, 0xd6, 0x00, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02,
+    0x70, 0x0f, 0xc3, 0x02, 0x01, 0xf4, 0x8d, 0x80, 0x7e, 0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4,
+    0x9b, 0x00, 0x7c, 0x8b, 0x00, 0x1f, 0xac, 0x64, 0x03, 0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x1f,
+    0x70, 0x0d, 0x40, 0x1f, 0x96, 0xc0, 0x40, 0x3d, 0x65, 0x00, 0x00, 0x3f, 0x7d, 0xfb, 0x10, 0x0a,
+    0x62, 0x96, 0xc0, 0x28, 0x55, 0x32, 0x80, 0x44, 0x00, 0xe0, 0x0f, 0xfe, 0xb1, 0xfa, 0x00, 0x7f,
+    0x2e, 0x88, 0x07, 0x5a, 0xc0, 0x00, 0x00, 0xab, 0xfe, 0x20, 0x0e, 0xbd, 0xd8, 0x80, 0x38, 0x48,
+    0xa0, 0x0e, 0x19, 0xef, 0xc5, 0x00, 0x8b, 0xd9, 0x1c, 0x6a, 0x00, 0x12, 0x1b, 0x51, 0xac, 0xe6,
+    0x49, 0x24, 0x01, 0x48, 0x53, 0x82, 0x80, 0x72, 0x20, 0xc0, 0xc0, 0x38, 0x8c, 0xc0, 0x60, 0x1c,
+    0x46, 0xe0, 0xa0, 0x1c, 0x88, 0x24, 0x92, 0x00, 0xa4, 0x28, 0x24, 0x36, 0x63, 0x19, 0xcc, 0x0b,
+    0xd9, 0xdc, 0x15, 0x00, 0x00, 0x00, 0x7f, 0xda, 0x01, 0xb7, 0x6f, 0x00, 0xc4, 0x58, 0x02, 0x1a,
+    0xfe, 0x90, 0x0b, 0x52, 0x25, 0xa8, 0x10, 0xe9, 0xdd, 0x2a, 0x46, 0x08, 0x00, 0x40, 0x7f, 0x00,
+    0xfb, 0x00, 0xc0, 0x08, 0x0e, 0x85, 0xac, 0xf2, 0xa4, 0x18, 0x93, 0x26, 0xa0, 0x00, 0x00, 0x98,
+    0x41, 0x48, 0x03, 0xb1, 0x86, 0xc0, 0x3d, 0x76, 0xe8, 0x20, 0x0e, 0x1c, 0xf6, 0x00, 0xe1, 0x9e,
+    0xfc, 0x50, 0x08, 0xbd, 0x91, 0xc6, 0xa0, 0x01, 0x21, 0xb5, 0x1a, 0xce, 0x64, 0x92, 0x40, 0x14,
+    0x85, 0x38, 0x28, 0x07, 0x22, 0x0c, 0x0c, 0x03, 0x88, 0xcc, 0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01,
+    0xc8, 0x82, 0x49, 0x20, 0x0a, 0x42, 0x82, 0x43, 0x66, 0x31, 0x9c, 0xc0, 0xbd, 0x9d, 0xc1, 0x50,
+    0x00, 0x01, 0xe1, 0x2e, 0x00, 0x86, 0x7b, 0x28, 0x03, 0x3f, 0xf2, 0x00, 0x43, 0x5f, 0xd2, 0x01,
+    0x6a, 0x44, 0xb5, 0x02, 0x1d, 0x3b, 0xa5, 0x48, 0xc1, 0x00, 0x08, 0x0f, 0xe0, 0x1f, 0x60, 0x18,
+    0x01, 0x01, 0xd0, 0xb5, 0x9e, 0x54, 0x83, 0x12, 0x64, 0xd4, 0x00, 0x00, 0xc6, 0x24, 0x60, 0x1c,
+    0x78, 0x5f, 0x60, 0x1d, 0x4c, 0xa3, 0x00, 0x1d, 0x32, 0x6c, 0x00, 0xe1, 0x9e, 0xfc, 0x50, 0x08,
+    0xbd, 0x91, 0xc6, 0xa0, 0x01, 0x21, 0xb5, 0x1a, 0xce, 0x64, 0x92, 0x40, 0x14, 0x85, 0x38, 0x28,
+    0x07, 0x22, 0x0c, 0x0c, 0x03, 0x88, 0xcc, 0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01, 0xc8, 0x82, 0x49,
+    0x20, 0x0a, 0x42, 0x82, 0x43, 0x66, 0x31, 0x9c, 0xc0, 0xbd, 0x9d, 0xc1, 0x50, 0x00, 0x00, 0x3f,
+    0x17, 0xa8, 0x05, 0x51, 0x05, 0x50, 0x05, 0xcd, 0x34, 0x01, 0x0c, 0xfe, 0xc8, 0x05, 0xa9, 0x12,
+    0xd4, 0x08, 0x74, 0xee, 0x95, 0x23, 0x04, 0x00, 0x20, 0x3f, 0x80, 0x7d, 0x80, 0x60, 0x04, 0x07,
+    0x42, 0xd6, 0x79, 0x52, 0x0c, 0x49, 0x93, 0x50, 0x00, 0x00, 0x15, 0x77, 0xff, 0xe8, 0x03, 0xc4,
+    0x78, 0x60, 0x68, 0x8d, 0x61, 0xe1, 0xf2, 0xfa, 0x14, 0xef, 0x8c, 0x8e, 0x04, 0x03, 0xfc, 0xe0,
+    0x80, 0x1c, 0xe2, 0x38, 0x0c, 0x0c, 0x03, 0xaf, 0xbb, 0x11, 0x81, 0x80, 0x74, 0x5d, 0xe2, 0x70,
+    0x40, 0x0e, 0x44, 0xe0, 0x23, 0x81, 0x00, 0xff, 0xbc, 0x3e, 0x5f, 0x42, 0xdd, 0xf1, 0x81, 0xe3,
+    0xba, 0x18, 0x1e, 0x23, 0x58, 0x01, 0xaf, 0xe9, 0x06, 0xdf, 0xc3, 0x00, 0x6a, 0x44, 0xb7, 0xca,
+    0xcb, 0xe0, 0xa1, 0xd3, 0xba, 0x41, 0x61, 0xac, 0x58, 0xc1, 0x00, 0x08, 0x0b, 0xff, 0x0e, 0xf8,
+    0x07, 0x8b, 0x33, 0x46, 0x01, 0x80, 0x10, 0x00, 0x67, 0x53, 0x21, 0x6b, 0x3c, 0x81, 0x4b, 0x5b,
+    0x30, 0x31, 0x26, 0x4d, 0xf2, 0x92, 0xf8, 0x40, 0x00, 0xe4, 0x10, 0x0f, 0x3c, 0x88, 0x07, 0xa6,
+    0x40, 0x1f, 0x72, 0x00, 0x43, 0xff, 0xba, 0x40, 0x32, 0xcc, 0x9d, 0xac, 0x02, 0xd6, 0x64, 0xc2,
+    0x10, 0x07, 0x94, 0x1c, 0x03, 0xcc, 0x02, 0x00, 0xf1, 0x12, 0x48, 0xa0, 0x01, 0xfb, 0x96, 0x1a,
+    0x01, 0x35, 0xd0, 0x21, 0x80, 0x5c, 0x8a, 0xcc, 0x20, 0x0f, 0x40, 0x40, 0x07, 0x86, 0x14, 0xc0,
+    0x00, 0x17, 0xa0, 0x02, 0x19, 0x00, 0x13, 0x20, 0x3f, 0x4e, 0x70, 0x05, 0x42, 0x80, 0x2d, 0x88,
+    0x00, 0x40, 0x1f, 0xfc, 0xa0, 0x1f, 0xfd, 0xd2, 0x01, 0x96, 0x64, 0xed, 0x60, 0x16, 0xb3, 0x26,
+    0x10, 0x80, 0x3c, 0xa0, 0xe0, 0x1e, 0x60, 0x10, 0x07, 0x88, 0x92, 0x45, 0x00, 0x0f, 0xdc, 0xb0,
+    0xd0, 0x09, 0xae, 0x81, 0x0c, 0x02, 0xe4, 0x56, 0x61, 0x00, 0x7a, 0x02, 0x00, 0x3c, 0x30, 0xa6,
+    0x3e, 0xe0, 0x13, 0xf9, 0x80, 0x4b, 0xe0, 0x1f, 0x6a, 0x00, 0x7e, 0xf0, 0x0c, 0x00, 0x3f, 0x7e,
+    0x70, 0x05, 0x42, 0x80, 0x2d, 0x88, 0x00, 0x40, 0x1f, 0xfc, 0xa3, 0xf4, 0x00, 0x27, 0x88, 0x00,
+    0xd0, 0x40, 0x1f, 0xc0, 0x10, 0x00, 0x2a, 0x81, 0x90, 0x03, 0x35, 0x34, 0xa8, 0x06, 0x37, 0x99,
+    0x08, 0x07, 0x47, 0xb0, 0x04, 0x3f, 0xfb, 0xa4, 0x03, 0x2c, 0xc9, 0xda, 0xc0, 0x2d, 0x66, 0x4c,
+    0x21, 0x00, 0x79, 0x41, 0xc0, 0x3c, 0xc0, 0x20, 0x0f, 0x11, 0x24, 0x8a, 0x00, 0x1f, 0xb9, 0x61,
+    0xa0, 0x13, 0x5d, 0x02, 0x18, 0x05, 0xc8, 0xac, 0xc2, 0x00, 0xf4, 0x04, 0x00, 0x78, 0x61, 0x4c,
+    0x3e, 0x2c, 0x73, 0x8c, 0x57, 0x06, 0xe9, 0x03, 0xf7, 0xe7, 0x00, 0x54, 0x28, 0x02, 0xd8, 0x80,
+    0x04, 0x01, 0xff, 0xca, 0x00, 0x00, 0xc2, 0x80, 0x1f, 0x44, 0x80, 0x78, 0x5b, 0x80, 0x3c, 0x3e,
+    0x60, 0x18, 0x67, 0xbf, 0x54, 0x02, 0xd6, 0x78, 0x1a, 0x60, 0x33, 0x4c, 0x9f, 0x0e, 0x80, 0x23,
+    0x00, 0xbe, 0x40, 0xcd, 0x52, 0x80, 0x6a, 0x00, 0xc7, 0x75, 0xfd, 0x08, 0x05, 0x1d, 0xb0, 0x98,
+    0x09, 0x40, 0x02, 0x7b, 0x23, 0x15, 0x50, 0x04, 0x40, 0x2a, 0x55, 0x2f, 0x50, 0x84, 0x18, 0xc9,
+    0x08, 0xf6, 0x00, 0x00, 0x9b, 0xc4, 0x03, 0x5c, 0x88, 0x06, 0xe6, 0x00, 0x97, 0x73, 0x06, 0x05,
+    0x49, 0x6f, 0xa0, 0xc1, 0x69, 0x4c, 0x28, 0x5b, 0x4f, 0x02, 0x1b, 0x21, 0x3c, 0x28, 0xed, 0x5a,
+    0x28, 0x11, 0x04, 0xb0, 0x64, 0x95, 0xb4, 0xa3, 0x00, 0x00, 0x92, 0x04, 0x03, 0x8a, 0x87, 0x40,
+    0x39, 0xea, 0x6c, 0xc0, 0x32, 0xa0, 0x39, 0x80, 0x43, 0x3d, 0xfa, 0xa0, 0x16, 0xb3, 0xc0, 0xd3,
+    0x01, 0x9a, 0x64, 0xf8, 0x74, 0x01, 0x18, 0x05, 0xf2, 0x06, 0x6a, 0x94, 0x03, 0x50, 0x06, 0x3b,
+    0xaf, 0xe8, 0x40, 0x28, 0xed, 0x84, 0xc0, 0x4a, 0x00, 0x13, 0xd9, 0x18, 0xaa, 0x80, 0x22, 0x01,
+    0x52, 0xa9, 0x7a, 0x84, 0x20, 0xc6, 0x48, 0x47, 0xb0, 0x00, 0x00, 0x4f, 0xb8, 0x04, 0xc9, 0xb2,
+    0x80, 0x06, 0xd2, 0xe4, 0x00, 0x2e, 0xfe, 0x18, 0x15, 0x25, 0xbe, 0x83, 0x05, 0xa5, 0x30, 0xa1,
+    0x6d, 0x3c, 0x08, 0x6c, 0x84, 0xf0, 0xa3, 0xb5, 0x68, 0xa0, 0x44, 0x12, 0xc1, 0x92, 0x56, 0xd2,
+    0x8c, 0x01, 0x9e, 0xfd, 0x50, 0x0b, 0x59, 0xe0, 0x69, 0x80, 0xcd, 0x32, 0x7c, 0x3a, 0x00, 0x8c,
+    0x02, 0xf9, 0x03, 0x35, 0x4a, 0x01, 0xa8, 0x03, 0x1d, 0xd7, 0xf4, 0x20, 0x14, 0x76, 0xc2, 0x60,
+    0x25, 0x00, 0x09, 0xec, 0x8c, 0x55, 0x40, 0x11, 0x00, 0xa9, 0x54, 0xbd, 0x42, 0x10, 0x63, 0x24,
+    0x23, 0xd8, 0x00, 0x67, 0x46, 0xa0, 0x03, 0xdb, 0x60, 0x1e, 0x5e, 0x50, 0x08, 0x05, 0xdf, 0xc3,
+    0x02, 0xa4, 0xb7, 0xd0, 0x60, 0xb4, 0xa6, 0x14, 0x2d, 0xa7, 0x81, 0x0d, 0x90, 0x9e, 0x14, 0x76,
+    0xad, 0x14, 0x08, 0x82, 0x58, 0x32, 0x4a, 0xda, 0x51, 0x83, 0x68, 0xc2, 0x80, 0x6c, 0xa1, 0x00,
+    0x93, 0xd0, 0x40, 0x00, 0x32, 0x83, 0x98, 0x06, 0x5a, 0x79, 0x30, 0x0c, 0x6f, 0x34, 0x01, 0xe8,
+    0xe4, 0x00, 0xc3, 0x3d, 0xfa, 0xe0, 0x16, 0xb3, 0xc3, 0x43, 0x81, 0x9a, 0x64, 0xf6, 0xb4, 0x01,
+    0x18, 0x05, 0x5a, 0x06, 0x6a, 0x94, 0x00, 0xec, 0x77, 0x5f, 0xd0, 0x80, 0x51, 0xdb, 0x09, 0x80,
+    0xb8, 0x20, 0x4f, 0x64, 0x62, 0x6e, 0x01, 0x10, 0x0a, 0x1c, 0xd3, 0xd4, 0x21, 0x06, 0xb2, 0x42,
+    0x3d, 0x80, 0x07, 0xd2, 0xe4, 0x00, 0x3b, 0xb5, 0x90, 0x02, 0xaf, 0x80, 0x09, 0x77, 0xf0, 0xc0,
+    0xa9, 0x2d, 0xf4, 0x18, 0x2d, 0x25, 0xc5, 0x0b, 0x69, 0x24, 0x43, 0x64, 0x27, 0x84, 0xdd, 0xab,
+    0x45, 0x1e, 0x20, 0x96, 0x0c, 0x92, 0xb6, 0x94, 0x60, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10,
+    0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x3f, 0xff, 0xee, 0x66, 0x00, 0xf0, 0xce, 0x00, 0x79, 0x61,
+    0x00, 0x20, 0x0a, 0xd0, 0x0f, 0xb9, 0x4b, 0xd2, 0x90, 0x6d, 0x50, 0x4d, 0x04, 0x03, 0xff, 0x88,
+    0x44, 0x41, 0x0a, 0x0b, 0x50, 0x27, 0x84, 0x00, 0x56, 0xb8, 0x02, 0x5c, 0xc0, 0x00, 0x32, 0x03,
+    0x18, 0x06, 0x2a, 0x68, 0x30, 0x0c, 0x88, 0x9a, 0x00, 0xf5, 0x7a, 0x00, 0x55, 0xff, 0xf2, 0xf4,
+    0x41, 0x41, 0xe2, 0x0e, 0x8e, 0xec, 0x09, 0x77, 0x10, 0x07, 0xff, 0xf0, 0x00, 0x8f, 0x00, 0x02,
+    0x4e, 0x20, 0x0b, 0xf0, 0x60, 0x0c, 0x96, 0x1c, 0xa5, 0xe8, 0x14, 0x83, 0x6a, 0x08, 0x26, 0x82,
+    0x01, 0xff, 0xc8, 0x22, 0x20, 0x80, 0x28, 0xad, 0x40, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10,
+    0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x3f, 0xe1, 0x10, 0x18, 0x80, 0x4f, 0xd0, 0x1b, 0xc4, 0x00,
+    0x6b, 0x50, 0xab, 0x20, 0x00, 0xa6, 0x02, 0x20, 0x03, 0xff, 0xa2, 0x00, 0x0a, 0xd0, 0x0f, 0xb9,
+    0x4b, 0xd2, 0x90, 0x6d, 0x50, 0x4d, 0x07, 0x94, 0xbd, 0x31, 0x0b, 0x50, 0x84, 0x08, 0x00, 0x64,
+    0x82, 0x14, 0x56, 0xa0, 0x00, 0xb3, 0xbe, 0x80, 0x3b, 0x3b, 0xe8, 0x03, 0xfe, 0x2f, 0x60, 0x0d,
+    0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42, 0x22, 0xa0, 0x08, 0x55, 0x41, 0x05, 0xb1, 0x3e,
+    0x10, 0x0b, 0x62, 0xec, 0xb8, 0x60, 0x00, 0x5e, 0x0f, 0x00, 0x42, 0xd1, 0xe8, 0x01, 0x0e, 0x27,
+    0x50, 0x00, 0xfd, 0x40, 0x0d, 0xe0, 0x1f, 0xfc, 0xd1, 0x00, 0xc2, 0x01, 0x88, 0x01, 0xc0, 0x02,
+    0x24, 0x3c, 0xb0, 0x05, 0xc5, 0x05, 0x00, 0x00, 0x00, 0xbf, 0xed, 0x00, 0xed, 0xdb, 0xc0, 0x38,
+    0x8b, 0x00, 0x0b, 0xd8, 0x03, 0x47, 0x80, 0x7f, 0xfa, 0x8c, 0x04, 0x03, 0x10, 0x88, 0xa8, 0x02,
+    0x15, 0x50, 0x41, 0x6c, 0x4f, 0x84, 0x02, 0xd8, 0xbb, 0x2e, 0x18, 0x00, 0x7f, 0xda, 0x01, 0xb7,
+    0x6f, 0x00, 0xc4, 0x58, 0x00, 0x7e, 0x80, 0x06, 0xf0, 0x0f, 0xfe, 0x68, 0x80, 0x61, 0x00, 0xc4,
+    0x00, 0xe0, 0x01, 0x12, 0x1e, 0x58, 0x02, 0xe2, 0x82, 0x80, 0x00, 0x00, 0x0b, 0x00, 0x1c, 0x03,
+    0x0c, 0x12, 0xd8, 0x07, 0x56, 0x47, 0x00, 0x72, 0x76, 0x90, 0x00, 0xbd, 0x80, 0x34, 0x78, 0x07,
+    0xff, 0xa8, 0xc0, 0x40, 0x31, 0x08, 0x8a, 0x80, 0x21, 0x55, 0x04, 0x16, 0xc4, 0xf8, 0x40, 0x2d,
+    0x8b, 0xb2, 0xe1, 0x80, 0x01, 0xe1, 0x2e, 0x00, 0x86, 0x7b, 0x28, 0x03, 0x3f, 0xf2, 0x00, 0x0f,
+    0xd0, 0x00, 0xde, 0x01, 0xff, 0xcd, 0x10, 0x0c, 0x20, 0x18, 0x80, 0x1c, 0x00, 0x22, 0x43, 0xcb,
+    0x00, 0x5c, 0x50, 0x50, 0x00, 0x00, 0x00, 0x93, 0x74, 0x40, 0x1d, 0xf0, 0xb4, 0x01, 0xdf, 0x0b,
+    0x40, 0x1c, 0x9b, 0xa2, 0x00, 0x17, 0xb0, 0x06, 0x8f, 0x00, 0xff, 0xf5, 0x18, 0x08, 0x06, 0x21,
+    0x11, 0x50, 0x04, 0x2a, 0xa0, 0x82, 0xd8, 0x9f, 0x08, 0x05, 0xb1, 0x76, 0x5c, 0x30, 0x00, 0x26,
+    0xe8, 0x80, 0x37, 0xc2, 0xd0, 0x06, 0xf8, 0x5a, 0x00, 0xc9, 0xba, 0x20, 0x01, 0xfa, 0x00, 0x1b,
+    0xc0, 0x3f, 0xf9, 0xa2, 0x01, 0x84, 0x03, 0x10, 0x03, 0x80, 0x04, 0x48, 0x79, 0x60, 0x0b, 0x8a,
+    0x0a, 0x00, 0x00, 0x00, 0x85, 0x00, 0xc8, 0x03, 0x4c, 0x8f, 0x04, 0x03, 0x34, 0xc4, 0x0c, 0x03,
+    0x72, 0x5b, 0x80, 0x0b, 0xd8, 0x03, 0x47, 0x80, 0x7f, 0xfa, 0x8c, 0x04, 0x03, 0x10, 0x88, 0xa8,
+    0x02, 0x15, 0x50, 0x41, 0x6c, 0x4f, 0x84, 0x02, 0xd8, 0xbb, 0x2e, 0x18, 0x00, 0x3f, 0x17, 0xa8,
+    0x05, 0x51, 0x05, 0x50, 0x05, 0xcd, 0x34, 0x00, 0x3f, 0x70, 0x36, 0xf0, 0x0f, 0xfe, 0x68, 0x80,
+    0x61, 0x00, 0xc4, 0x00, 0xe0, 0x01, 0x12, 0x1e, 0x58, 0x02, 0xe2, 0x82, 0x80, 0x00, 0x2f, 0x60,
+    0x0d, 0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x40, 0x25, 0x40, 0x10, 0xa8, 0x02, 0x0b, 0x62,
+    0x78, 0x24, 0x16, 0xc5, 0xd8, 0x21, 0x80, 0x09, 0x88, 0x7c, 0xe0, 0x18, 0x92, 0xc4, 0x03, 0x88,
+    0xe1, 0x00, 0x00, 0x3f, 0x40, 0x03, 0x78, 0x07, 0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70,
+    0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x28, 0x04, 0x79, 0xf4, 0xb2, 0x01, 0xc8, 0x04, 0x01,
+    0xce, 0x56, 0x00, 0x00, 0xf3, 0xa0, 0x07, 0xfd, 0x15, 0x41, 0x00, 0xfe, 0x37, 0xf7, 0xa0, 0x0f,
+    0xe3, 0xf2, 0x9b, 0x00, 0xec, 0xc0, 0x04, 0x7f, 0x60, 0x12, 0x7a, 0x20, 0xc0, 0x24, 0x04, 0x00,
+    0xb0, 0x13, 0x01, 0x00, 0x1a, 0x40, 0x60, 0x04, 0x30, 0x40, 0xc0, 0x02, 0x50, 0x28, 0x00, 0xd0,
+    0x00, 0x66, 0x02, 0x14, 0x46, 0x01, 0x86, 0x00, 0x11, 0x00, 0x80, 0x78, 0x80, 0x80, 0x80, 0x0c,
+    0x03, 0xc4, 0x04, 0x12, 0xc3, 0x00, 0x90, 0x15, 0xf0, 0x0c, 0x1d, 0x50, 0x03, 0x1e, 0x92, 0x00,
+    0x13, 0x87, 0x00, 0x32, 0x20, 0x0c, 0x01, 0x88, 0x08, 0x01, 0xb0, 0x10, 0x02, 0x40, 0x30, 0x08,
+    0x00, 0xd5, 0xee, 0x01, 0xf3, 0x33, 0xa9, 0x00, 0x3c, 0xd8, 0x3a, 0x80, 0x15, 0xe0, 0x01, 0xbc,
+    0xc0, 0x1f, 0x1a, 0x60, 0x0c, 0x04, 0x03, 0x0c, 0x40, 0x40, 0x43, 0xc0, 0x40, 0x42, 0x26, 0x10,
+    0xca, 0x06, 0x20, 0x01, 0x12, 0x25, 0x03, 0x4d, 0x00, 0x69, 0xe2, 0x82, 0x48, 0x20, 0x01, 0x01,
+    0x70, 0x31, 0x48, 0x80, 0x12, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x86, 0x0c, 0x03, 0xea, 0x5e,
+    0x00, 0xf2, 0xab, 0x06, 0x00, 0x39, 0x78, 0x72, 0x00, 0x29, 0xf2, 0x00, 0xdd, 0xa1, 0x01, 0x20,
+    0x13, 0x8c, 0x80, 0xc2, 0x20, 0x06, 0x11, 0x00, 0x07, 0x28, 0x08, 0x09, 0x00, 0xd0, 0x6e, 0xcc,
+    0x20, 0x0c, 0xa7, 0x03, 0x00, 0x1e, 0xf0, 0x91, 0x00, 0xf0, 0x80, 0x80, 0x7f, 0xf5, 0x80, 0x00,
+    0x37, 0xd8, 0x06, 0x3b, 0xd0, 0x70, 0x08, 0xf4, 0xad, 0xc0, 0x15, 0xa0, 0x13, 0xf8, 0x71, 0x18,
+    0x02, 0x94, 0x10, 0x6c, 0x08, 0x9e, 0x00, 0x75, 0x05, 0x15, 0x00, 0x51, 0x1d, 0xb8, 0x04, 0x65,
+    0x27, 0xa0, 0x19, 0x54, 0x28, 0x01, 0xa8, 0x18, 0x03, 0x98, 0x2c, 0x03, 0x2c, 0x19, 0x80, 0x21,
+    0xa1, 0xf0, 0x0c, 0x00, 0x00, 0x46, 0x84, 0xe0, 0x07, 0x7b, 0x00, 0xb0, 0x07, 0x3d, 0x84, 0x50,
+    0x05, 0x3e, 0x40, 0x1b, 0xb4, 0x20, 0x24, 0x02, 0x71, 0x90, 0x18, 0x44, 0x00, 0xc2, 0x20, 0x00,
+    0xe5, 0x01, 0x01, 0x20, 0x1a, 0x0d, 0xd9, 0x84, 0x01, 0x94, 0xe0, 0x60, 0x03, 0xde, 0x12, 0x20,
+    0x1e, 0x10, 0x10, 0x0f, 0xfe, 0xb0, 0x00, 0xc2, 0x80, 0x1f, 0x44, 0x00, 0x3c, 0x2d, 0xc0, 0x1e,
+    0x1f, 0x20, 0x09, 0xbf, 0xfe, 0x45, 0x88, 0xe1, 0x06, 0x37, 0x7c, 0x43, 0x24, 0x01, 0x8a, 0x95,
+    0x80, 0x3b, 0x86, 0xc0, 0x3a, 0x4f, 0x44, 0x03, 0x23, 0x41, 0x80, 0x61, 0xa4, 0x70, 0x0e, 0xa0,
+    0xa0, 0x0e, 0x74, 0x43, 0x3b, 0xe2, 0xe0, 0x58, 0x8e, 0x60, 0x00, 0x9b, 0xc4, 0x03, 0x5c, 0x88,
+    0x06, 0xe6, 0x00, 0x2f, 0xfb, 0x3f, 0xc6, 0x95, 0x51, 0x09, 0x0a, 0xa8, 0x0a, 0xc4, 0x00, 0x36,
+    0xaa, 0x00, 0xa8, 0x28, 0x02, 0x64, 0xa0, 0x08, 0xa4, 0xc5, 0x54, 0x2e, 0x07, 0x55, 0x28, 0x00,
+    0x97, 0x84, 0x03, 0xc2, 0x60, 0x1f, 0x26, 0x88, 0x04, 0xdf, 0xff, 0x22, 0xc4, 0x70, 0x83, 0x1b,
+    0xbe, 0x21, 0x92, 0x00, 0xc5, 0x4a, 0xc0, 0x1d, 0xc3, 0x60, 0x1d, 0x27, 0xa2, 0x01, 0x91, 0xa0,
+    0xc0, 0x30, 0xd2, 0x38, 0x07, 0x50, 0x50, 0x07, 0x3a, 0x21, 0x9d, 0xf1, 0x70, 0x2c, 0x47, 0x30,
+    0x00, 0x27, 0x18, 0x07, 0x18, 0x80, 0x64, 0xd2, 0x00, 0x2f, 0xff, 0x1a, 0x55, 0x44, 0x24, 0x2a,
+    0xa0, 0x2b, 0x10, 0x00, 0xda, 0xa8, 0x02, 0xa0, 0xa0, 0x09, 0x92, 0x80, 0x22, 0x93, 0x15, 0x50,
+    0xb8, 0x1d, 0x54, 0xa0, 0x00, 0x32, 0x03, 0x18, 0x06, 0x2a, 0x68, 0x30, 0x0c, 0x88, 0x9a, 0x00,
+    0xf5, 0x7a, 0x00, 0x4d, 0xff, 0xf2, 0x2c, 0x47, 0x08, 0x31, 0xbb, 0xe2, 0x19, 0x20, 0x0c, 0x54,
+    0xac, 0x01, 0xdc, 0x36, 0x01, 0xd2, 0x7a, 0x20, 0x19, 0x1a, 0x0c, 0x03, 0x0d, 0x23, 0x80, 0x75,
+    0x05, 0x00, 0x73, 0xa2, 0x19, 0xdf, 0x17, 0x02, 0xc4, 0x73, 0x00, 0x06, 0xd2, 0xe4, 0x00, 0x32,
+    0x64, 0xa0, 0x05, 0x3c, 0xe0, 0x05, 0xff, 0xe3, 0x4a, 0xa8, 0x84, 0x85, 0x54, 0x05, 0x62, 0x00,
+    0x1b, 0x55, 0x00, 0x54, 0x14, 0x01, 0x32, 0x50, 0x04, 0x52, 0x62, 0xaa, 0x17, 0x03, 0xaa, 0x94,
+    0x08, 0xfb, 0x17, 0x68, 0x20, 0xd3, 0x00, 0xff, 0xea, 0x00, 0x00, 0x97, 0xf0, 0x03, 0xee, 0x03,
+    0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5, 0x80, 0x77, 0x11, 0x34, 0xc8, 0x02, 0x14, 0x50,
+    0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d, 0x0a, 0xee, 0x11, 0x90, 0x0a, 0x2d, 0xdd, 0x20,
+    0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80, 0x65, 0x32, 0xbe, 0x00, 0xe8, 0xf2, 0x00, 0x9b,
+    0xac, 0x40, 0x3d, 0x18, 0x08, 0x01, 0xe8, 0xc0, 0x40, 0x08, 0x03, 0xcf, 0xe7, 0x01, 0xd7, 0xa6,
+    0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49, 0x02, 0x86, 0xc2, 0x18, 0x10,
+    0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x01, 0x16, 0x22, 0xd9, 0x00, 0x5f, 0xa9, 0x80, 0x7f, 0xaf,
+    0xd4, 0xc0, 0x00, 0x9b, 0x84, 0x03, 0xc6, 0x60, 0x0f, 0x97, 0x44, 0x02, 0x1f, 0xfd, 0xd2, 0x01,
+    0x96, 0x64, 0xed, 0x40, 0x16, 0xb3, 0x25, 0x94, 0x03, 0xe1, 0x00, 0xe1, 0x12, 0x33, 0x00, 0x28,
+    0xee, 0x59, 0xc0, 0x04, 0xd7, 0x6a, 0x0f, 0x10, 0x07, 0x22, 0x17, 0x85, 0xc0, 0x3f, 0xed, 0x66,
+    0x3e, 0x8b, 0x80, 0x16, 0x66, 0x5d, 0x10, 0x00, 0x87, 0x50, 0x03, 0x8c, 0xc2, 0x00, 0x3f, 0x42,
+    0xe5, 0x00, 0xff, 0xe4, 0x16, 0x7e, 0x10, 0x05, 0x29, 0x23, 0x80, 0x13, 0xc3, 0x78, 0xb0, 0x02,
+    0xc0, 0x04, 0x3e, 0x01, 0xfe, 0x40, 0x01, 0x0f, 0x80, 0x26, 0x1b, 0xc5, 0xc0, 0x10, 0x92, 0x3a,
+    0x20, 0x1f, 0xfd, 0xd4, 0x20, 0x12, 0xcc, 0x99, 0x74, 0x02, 0xd6, 0x64, 0x39, 0x80, 0x61, 0x11,
+    0xa2, 0x00, 0x28, 0xee, 0x60, 0xd0, 0x04, 0xd7, 0x69, 0x3c, 0x00, 0xb9, 0x10, 0xd4, 0x4a, 0x01,
+    0xe5, 0x03, 0x00, 0xf2, 0x01, 0x00, 0x35, 0x99, 0x16, 0x48, 0x00, 0x59, 0x93, 0x27, 0x80, 0xff,
+    0xee, 0xa2, 0x00, 0xc9, 0xa2, 0x01, 0xe1, 0x33, 0x00, 0x40, 0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67,
+    0xe1, 0x00, 0x52, 0x92, 0x38, 0x01, 0x3c, 0x37, 0x8b, 0x00, 0x2c, 0x00, 0x43, 0xe0, 0x1f, 0xe4,
+    0x00, 0x10, 0xf8, 0x02, 0x61, 0xbc, 0x5c, 0x01, 0x09, 0x23, 0xa2, 0x7e, 0xd9, 0xf8, 0x60, 0x19,
+    0xf0, 0x03, 0xde, 0x40, 0x10, 0x1f, 0xfd, 0xd2, 0x01, 0x96, 0x64, 0xed, 0x40, 0x16, 0xb3, 0x25,
+    0x94, 0x03, 0xe1, 0x00, 0xe1, 0x12, 0x33, 0x00, 0x28, 0xee, 0x59, 0xc0, 0x04, 0xd7, 0x6a, 0x0f,
+    0x10, 0x07, 0x22, 0x17, 0x85, 0xc0, 0x3f, 0xed, 0x66, 0x3e, 0x8b, 0x80, 0x16, 0x66, 0x5d, 0x11,
+    0x7f, 0xee, 0xb3, 0x00, 0xa3, 0xfe, 0x40, 0x0d, 0x3b, 0xb2, 0x00, 0x00, 0x3f, 0x40, 0x0f, 0xfe,
+    0x59, 0x67, 0xe1, 0x00, 0x52, 0x92, 0x38, 0x01, 0x3c, 0x37, 0x8b, 0x00, 0x2c, 0x00, 0x43, 0xe0,
+    0x1f, 0xe4, 0x00, 0x10, 0xf8, 0x02, 0x61, 0xbc, 0x5c, 0x01, 0x09, 0x23, 0xa2, 0x7e, 0xd9, 0xf8,
+    0x60, 0x15, 0xff, 0xc2, 0x01, 0x56, 0xec, 0x20, 0x00, 0x00, 0xe1, 0x30, 0x0f, 0xd5, 0x20, 0x1f,
+    0x1a, 0xd8, 0x07, 0xc7, 0xc2, 0x01, 0xc3, 0x3d, 0xfa, 0xc0, 0x11, 0x7b, 0x23, 0x8c, 0xc8, 0x01,
+    0x21, 0xb5, 0x18, 0xec, 0x64, 0x92, 0x40, 0x14, 0xa3, 0x38, 0x28, 0x06, 0x1b, 0x53, 0x03, 0x00,
+    0xf8, 0xc0, 0xc0, 0x3e, 0x70, 0x50, 0x0e, 0xb5, 0x23, 0x92, 0x00, 0xa1, 0x18, 0x38, 0x36, 0xa3,
+    0x1d, 0x8c, 0x0b, 0xd9, 0x5c, 0x66, 0x40, 0x10, 0xcd, 0x9f, 0xb0, 0x07, 0x92, 0xb8, 0x03, 0xe8,
+    0xbb, 0x00, 0x40, 0x00, 0xdd, 0x00, 0x1c, 0xa7, 0x00, 0x1c, 0xf8, 0x01, 0x86, 0xb7, 0xe4, 0x02,
+    0xc4, 0x99, 0x34, 0x82, 0x16, 0xb3, 0xca, 0x81, 0x81, 0x80, 0x1b, 0x03, 0xc0, 0x3e, 0xd0, 0x30,
+    0x03, 0x60, 0x29, 0x6b, 0x3c, 0xa8, 0x03, 0x12, 0x61, 0xa4, 0x00, 0x34, 0xcc, 0x80, 0x0e, 0x83,
+    0x60, 0x0e, 0xa7, 0x40, 0x00, 0x00, 0xae, 0xc0, 0x1f, 0x84, 0x40, 0x1f, 0xaa, 0x80, 0x1c, 0x3f,
+    0xfb, 0x5c, 0x03, 0x92, 0x20, 0xf1, 0x80, 0x1b, 0x1d, 0xd5, 0x66, 0xe0, 0x1f, 0x22, 0x28, 0x03,
+    0xf1, 0x90, 0x80, 0x7d, 0xc0, 0x60, 0x1f, 0x70, 0x10, 0x07, 0xc6, 0x40, 0x1f, 0x22, 0x28, 0x02,
+    0xd6, 0x7a, 0xb3, 0x70, 0x09, 0x66, 0x1e, 0x30, 0x00, 0x00, 0x00, 0x1e, 0x90, 0x07, 0x39, 0x08,
+    0x07, 0x27, 0x99, 0xbd, 0x00, 0x3f, 0xf8, 0xa5, 0x7f, 0x8c, 0x01, 0x7a, 0xca, 0x58, 0x01, 0x4b,
+    0x5a, 0x24, 0x01, 0xa0, 0x60, 0x05, 0x00, 0xff, 0x68, 0x18, 0x01, 0x00, 0x0a, 0x3a, 0xd1, 0x00,
+    0x0b, 0x0a, 0x52, 0xc0, 0x00, 0x1f, 0xfd, 0xae, 0x01, 0xc9, 0x10, 0x78, 0xc0, 0x0d, 0x8e, 0xea,
+    0xb3, 0x70, 0x0f, 0x91, 0x14, 0x01, 0xf8, 0xc8, 0x40, 0x3e, 0xe0, 0x30, 0x0f, 0xb8, 0x08, 0x03,
+    0xe3, 0x20, 0x0f, 0x91, 0x14, 0x01, 0x6b, 0x3d, 0x59, 0xb8, 0x04, 0xb3, 0x0f, 0x18, 0x00, 0x1f,
+    0xfd, 0xae, 0x01, 0xe7, 0xb0, 0x0f, 0xdc, 0xc0, 0x1c, 0x00, 0x00, 0xe3, 0xf4, 0x00, 0xff, 0xe2,
+    0x95, 0xfe, 0x30, 0x05, 0xeb, 0x29, 0x60, 0x05, 0x2d, 0x68, 0x90, 0x06, 0x81, 0x80, 0x14, 0x03,
+    0xfd, 0xa0, 0x60, 0x04, 0x00, 0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b, 0x00, 0x8b, 0x3f, 0x17,
+    0xd0, 0x02, 0xb8, 0x00, 0xf3, 0x08, 0x04, 0x00, 0x1f, 0xfd, 0xae, 0x01, 0xc9, 0x10, 0x78, 0xc0,
+    0x0d, 0x8e, 0xea, 0xb3, 0x70, 0x0f, 0x91, 0x14, 0x01, 0xf8, 0xc8, 0x40, 0x3e, 0xe0, 0x30, 0x0f,
+    0xb8, 0x08, 0x03, 0xe3, 0x20, 0x0f, 0x91, 0x14, 0x01, 0x6b, 0x3d, 0x59, 0xb8, 0x04, 0xb3, 0x0f,
+    0x18, 0x00, 0x1f, 0xfd, 0xae, 0x01, 0xd9, 0xff, 0x00, 0x7b, 0xb7, 0x60, 0x0c, 0x00, 0x00, 0xe3,
+    0xf4, 0x00, 0xff, 0xe2, 0x95, 0xfe, 0x30, 0x05, 0xeb, 0x29, 0x60, 0x05, 0x2d, 0x68, 0x90, 0x06,
+    0x81, 0x80, 0x14, 0x03, 0xfd, 0xa0, 0x60, 0x04, 0x00, 0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b,
+    0x00, 0x8b, 0x3f, 0x17, 0xd0, 0x01, 0xff, 0x60, 0x06, 0xdd, 0xb8, 0x00, 0x00, 0x1f, 0xfd, 0xae,
+    0x01, 0xc9, 0x10, 0x78, 0xc0, 0x0d, 0x8e, 0xea, 0xb3, 0x70, 0x0f, 0x91, 0x14, 0x01, 0xf8, 0xc8,
+    0x40, 0x3e, 0xe0, 0x30, 0x0f, 0xb8, 0x08, 0x03, 0xe3, 0x20, 0x0f, 0x91, 0x14, 0x01, 0x6b, 0x3d,
+    0x59, 0xb8, 0x04, 0xb3, 0x0f, 0x18, 0x00, 0x1f, 0xfd, 0xae, 0x01, 0xeb, 0xa0, 0x0f, 0xcb, 0xe0,
+    0x1f, 0x95, 0x40, 0x1c, 0x00, 0x00, 0xe3, 0xf4, 0x00, 0xff, 0xe2, 0x95, 0xfe, 0x30, 0x05, 0xeb,
+    0x29, 0x60, 0x05, 0x2d, 0x68, 0x90, 0x06, 0x81, 0x80, 0x14, 0x03, 0xfd, 0xa0, 0x60, 0x04, 0x00,
+    0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b, 0x00, 0x8b, 0x3f, 0x17, 0xd0, 0x02, 0xf6, 0x00, 0xe2,
+    0x07, 0x00, 0xe1, 0x61, 0x00, 0x80, 0x1f, 0xfd, 0xae, 0x01, 0xc9, 0x10, 0x78, 0xc0, 0x0d, 0x8e,
+    0xea, 0xb3, 0x70, 0x0f, 0x91, 0x14, 0x01, 0xf8, 0xc8, 0x40, 0x3e, 0xe0, 0x30, 0x0f, 0xb8, 0x08,
+    0x03, 0xe3, 0x20, 0x0f, 0x91, 0x14, 0x01, 0x6b, 0x3d, 0x59, 0xb8, 0x04, 0xb3, 0x0f, 0x18, 0x00,
+    0x1f, 0xfd, 0xae, 0x01, 0xeb, 0xc2, 0x00, 0xf5, 0x94, 0xf8, 0x80, 0x40, 0x00, 0xe3, 0xf4, 0x00,
+    0xff, 0xe2, 0x95, 0xfe, 0x30, 0x05, 0xeb, 0x29, 0x60, 0x05, 0x2d, 0x68, 0x90, 0x06, 0x81, 0x80,
+    0x14, 0x03, 0xfd, 0xa0, 0x60, 0x04, 0x00, 0x28, 0xeb, 0x44, 0x00, 0x2c, 0x29, 0x4b, 0x00, 0x8b,
+    0x3f, 0x17, 0xd0, 0x00, 0x7d, 0x80, 0x18, 0x76, 0xd6, 0xc0, 0x00, 0x00, 0x27, 0x90, 0x07, 0x23,
+    0x40, 0x07, 0xa6, 0x80, 0x3a, 0x3f, 0xe4, 0x00, 0xa7, 0x76, 0x40, 0x08, 0x48, 0xa0, 0x00, 0xff,
+    0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9, 0x40, 0x3f, 0xde, 0x23, 0x80, 0x27, 0xee, 0xcc,
+    0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01, 0xfe, 0xc7, 0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00,
+    0x00, 0x08, 0x07, 0xd5, 0x40, 0x0f, 0x52, 0x10, 0x06, 0x1e, 0x1d, 0xb0, 0x08, 0x77, 0x69, 0x00,
+    0xc4, 0x58, 0x02, 0x1a, 0xfe, 0x80, 0x0b, 0x1a, 0xa5, 0xa0, 0x10, 0xb5, 0x5e, 0x1c, 0x30, 0x3b,
+    0xfd, 0x20, 0x40, 0x0c, 0xce, 0x2d, 0x00, 0x19, 0x9e, 0x81, 0x4b, 0x99, 0x94, 0x60, 0x0c, 0x69,
+    0x87, 0xa0, 0x00, 0x00, 0xcf, 0xc2, 0x01, 0xd3, 0x42, 0x01, 0xdc, 0x80, 0x1a, 0x3f, 0xe4, 0x00,
+    0xa7, 0x76, 0x40, 0x08, 0x48, 0xa0, 0x00, 0xff, 0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9,
+    0x40, 0x3f, 0xde, 0x23, 0x80, 0x27, 0xee, 0xcc, 0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01,
+    0xfe, 0xc7, 0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00, 0x00, 0xff, 0x87, 0xd4, 0x03, 0x99, 0x14, 0x02,
+    0x1f, 0x84, 0xb0, 0x08, 0x77, 0x6a, 0x00, 0xc4, 0x50, 0x80, 0x43, 0x5f, 0xd0, 0x01, 0x63, 0x54,
+    0xb4, 0x02, 0x16, 0xab, 0xc3, 0x86, 0x07, 0x7f, 0xa4, 0x08, 0x01, 0x99, 0xc5, 0xa0, 0x03, 0x33,
+    0xd0, 0x29, 0x73, 0x32, 0x8c, 0x01, 0x8d, 0x30, 0xf4, 0x00, 0x1f, 0xff, 0x60, 0x01, 0x22, 0x34,
+    0x80, 0x31, 0xdf, 0x28, 0x03, 0xc4, 0x70, 0x04, 0xfd, 0xd9, 0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8,
+    0x98, 0x40, 0x3f, 0xf8, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a, 0x47, 0xff, 0xd8, 0x01, 0x4e, 0xa0,
+    0x06, 0x75, 0xea, 0x30, 0x00, 0x01, 0xaf, 0xe8, 0x00, 0xb1, 0xaa, 0x5a, 0x01, 0x0b, 0x55, 0xe1,
+    0xc3, 0x03, 0xbf, 0xd2, 0x04, 0x00, 0xcc, 0xe2, 0xd0, 0x01, 0x99, 0xa0, 0x14, 0xb9, 0x99, 0x64,
+    0x00, 0xc6, 0x98, 0x69, 0x00, 0x0d, 0xff, 0x40, 0x06, 0x3e, 0xc0, 0x0c, 0x3b, 0x4d, 0x40, 0x00,
+    0x1f, 0xff, 0x60, 0x01, 0x22, 0x34, 0x80, 0x31, 0xdf, 0x28, 0x07, 0xfb, 0xc4, 0x70, 0x04, 0xfd,
+    0xd9, 0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8, 0x98, 0x40, 0x3f, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a,
+    0x47, 0xff, 0xd8, 0x00, 0x4d, 0x68, 0x50, 0x0b, 0xaf, 0x19, 0x00, 0x01, 0xaf, 0xe8, 0x00, 0xb1,
+    0xaa, 0x5a, 0x01, 0x0b, 0x55, 0xe1, 0xc3, 0x03, 0xbf, 0xd2, 0x04, 0x00, 0xcc, 0xe2, 0xd0, 0x01,
+    0x99, 0xe8, 0x14, 0xb9, 0x99, 0x46, 0x00, 0xc6, 0x98, 0x7a, 0x00, 0x0d, 0xff, 0x48, 0x06, 0xba,
+    0x3c, 0x00, 0x8d, 0xf3, 0x6c, 0x00, 0x00, 0x00, 0x29, 0x02, 0x18, 0x05, 0xb6, 0x32, 0x01, 0xa0,
+    0xb9, 0x4c, 0x03, 0x5f, 0xc0, 0x00, 0x7f, 0xfd, 0x80, 0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0,
+    0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7, 0x66, 0x00, 0x35, 0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff,
+    0x63, 0xbe, 0x50, 0x02, 0x44, 0x69, 0x1f, 0xf8, 0xb7, 0xf0, 0x03, 0x46, 0x80, 0x72, 0xc2, 0x00,
+    0x00, 0x02, 0xd0, 0x4d, 0x00, 0x89, 0x7e, 0xb8, 0x03, 0x47, 0xf1, 0x80, 0x43, 0x5f, 0xd0, 0x01,
+    0x63, 0x54, 0xb4, 0x02, 0x16, 0xab, 0xc3, 0x86, 0x07, 0x7f, 0xa4, 0x08, 0x01, 0x99, 0xc5, 0xa0,
+    0x03, 0x33, 0xd0, 0x29, 0x73, 0x32, 0x8c, 0x01, 0x8d, 0x32, 0x7a, 0x00, 0x0d, 0xb3, 0x24, 0x03,
+    0xa0, 0xdc, 0x03, 0xb5, 0xd0, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x3c, 0x24, 0x01, 0xe6, 0xc0, 0x08,
+    0x7f, 0xfd, 0x20, 0x04, 0x88, 0xda, 0x00, 0xc7, 0x7c, 0x80, 0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7,
+    0x62, 0x00, 0x35, 0xde, 0x20, 0x07, 0x22, 0x60, 0x0f, 0xfe, 0x68, 0x02, 0xe5, 0x00, 0x19, 0x80,
+    0x21, 0xd5, 0x00, 0x0e, 0x7a, 0x84, 0x9d, 0x20, 0x09, 0x28, 0xf3, 0x17, 0xad, 0x20, 0xda, 0x20,
+    0x8d, 0x04, 0x03, 0xff, 0x9a, 0x00, 0x00, 0xaf, 0xfe, 0x10, 0x0e, 0x9d, 0xd8, 0x40, 0x38, 0x8b,
+    0x00, 0x70, 0xcf, 0x7e, 0xb0, 0x04, 0x5e, 0xc8, 0xe3, 0x34, 0x00, 0x90, 0xda, 0x8c, 0x85, 0x42,
+    0x49, 0x20, 0x09, 0xe5, 0xdc, 0x0a, 0x01, 0x08, 0x9c, 0xcc, 0x06, 0x00, 0x6e, 0xea, 0x8c, 0x0c,
+    0x00, 0xf7, 0x61, 0x37, 0x05, 0x00, 0x0a, 0x28, 0xf1, 0x1c, 0x90, 0x05, 0x60, 0xa1, 0xc1, 0xb5,
+    0x18, 0xb0, 0x40, 0x5e, 0xc8, 0xe1, 0x4e, 0x00, 0x00, 0x7f, 0xd8, 0x01, 0xb7, 0x6e, 0x00, 0xc4,
+    0x58, 0x02, 0x2b, 0xfc, 0x5f, 0x40, 0xf5, 0x9b, 0xb0, 0x01, 0x4b, 0x59, 0xe0, 0x01, 0xa0, 0x60,
+    0x04, 0x00, 0xff, 0x68, 0x18, 0x01, 0x00, 0x0a, 0x3a, 0xd1, 0x00, 0x0b, 0x0a, 0x52, 0xc1, 0xc1,
+    0xf7, 0xf0, 0x40, 0x42, 0x31, 0x5a, 0x4c, 0x83, 0xda, 0xa5, 0xf4, 0x00, 0x00, 0xd7, 0x60, 0x0f,
+    0xc2, 0x40, 0x1f, 0xaa, 0x40, 0x30, 0xfb, 0x80, 0x67, 0xf0, 0x0f, 0xfe, 0xaf, 0x91, 0x6f, 0x00,
+    0xcf, 0xbb, 0x9c, 0x03, 0x35, 0x56, 0x50, 0x0d, 0xca, 0xbb, 0x40, 0x3f, 0xfa, 0x80, 0x3f, 0x40,
+    0x0e, 0x12, 0x70, 0x0e, 0x2d, 0x30, 0x0e, 0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67, 0xd8, 0x80, 0x50,
+    0x8e, 0x96, 0x01, 0x4c, 0x41, 0x94, 0x02, 0x30, 0x07, 0x80, 0x7f, 0xf5, 0x80, 0x1f, 0x70, 0x0c,
+    0xfe, 0x01, 0xff, 0xcb, 0xf2, 0x2d, 0xe0, 0x19, 0xf7, 0x73, 0x80, 0x66, 0xaa, 0xca, 0x01, 0xb9,
+    0x57, 0x68, 0x07, 0xff, 0x78, 0x7d, 0xc0, 0x33, 0xf8, 0x07, 0x54, 0x80, 0x7e, 0x12, 0x00, 0xc0,
+    0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67, 0xd8, 0x80, 0x50, 0x8e, 0x96, 0x01, 0x4c, 0x41, 0x94, 0x02,
+    0x30, 0x07, 0x80, 0x7f, 0xf5, 0x8f, 0xd0, 0x00, 0xde, 0x01, 0xaa, 0x00, 0x3c, 0xc4, 0x01, 0x00,
+    0x00, 0x1f, 0x1a, 0x71, 0x00, 0x61, 0x30, 0x01, 0x80, 0x71, 0x69, 0xa6, 0x90, 0x00, 0x7d, 0xc0,
+    0x33, 0xf8, 0x07, 0xff, 0x57, 0xc8, 0xb7, 0x80, 0x67, 0xdd, 0xce, 0x01, 0x9a, 0xab, 0x28, 0x06,
+    0xe5, 0x5d, 0xa0, 0x1f, 0xfd, 0x40, 0x9c, 0x0a, 0xb0, 0x0c, 0x2c, 0x06, 0x40, 0x1a, 0x28, 0x26,
+    0x40, 0x1c, 0x7e, 0x80, 0x1f, 0xfc, 0xe2, 0xcf, 0xb1, 0x00, 0xd0, 0x8e, 0x96, 0x01, 0xa6, 0x20,
+    0xca, 0x01, 0x8c, 0x01, 0xe0, 0x1f, 0xfd, 0xa0, 0x1f, 0x70, 0x0c, 0xfe, 0x01, 0xff, 0xd5, 0xf2,
+    0x2d, 0xe0, 0x19, 0xf7, 0x73, 0x80, 0x66, 0xaa, 0xca, 0x01, 0xb9, 0x57, 0x68, 0x07, 0xff, 0x50,
+    0x4c, 0xc0, 0x19, 0xfc, 0x01, 0xf2, 0x60, 0x1e, 0x1e, 0x02, 0x00, 0xf0, 0x3f, 0x40, 0x0f, 0xfe,
+    0x59, 0x67, 0xd8, 0x80, 0x50, 0x8e, 0x96, 0x01, 0x4c, 0x41, 0x94, 0x02, 0x30, 0x07, 0x80, 0x7f,
+    0xf5, 0x8c, 0x9c, 0x00, 0xde, 0x00, 0x9d, 0x10, 0x0c, 0x72, 0x42, 0x01, 0x80, 0x1f, 0x70, 0x0c,
+    0xfe, 0x01, 0xff, 0xcb, 0xf2, 0x2d, 0xe0, 0x19, 0xf7, 0x73, 0x80, 0x66, 0xaa, 0xca, 0x01, 0xb9,
+    0x57, 0x68, 0x07, 0xff, 0x78, 0x7d, 0xc0, 0x33, 0xf8, 0x06, 0xe2, 0x27, 0x00, 0x7a, 0xf3, 0x16,
+    0x01, 0x00, 0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67, 0xd8, 0x80, 0x50, 0x8e, 0x96, 0x01, 0x4c, 0x41,
+    0x94, 0x02, 0x30, 0x07, 0x80, 0x7f, 0xf5, 0x8f, 0xd0, 0x00, 0xde, 0x00, 0x1e, 0x13, 0xd0, 0x08,
+    0x63, 0xfa, 0x40, 0x00, 0x01, 0xf7, 0x00, 0xff, 0xf4, 0x0f, 0xb8, 0x0e, 0x4a, 0x52, 0x37, 0x57,
+    0x80, 0x03, 0xf4, 0x00, 0x09, 0x38, 0x00, 0xb4, 0xc0, 0x07, 0xe8, 0x01, 0xff, 0xd9, 0x3f, 0x40,
+    0x2d, 0x76, 0x85, 0x57, 0x45, 0x80, 0x00, 0x17, 0xa0, 0x02, 0xd9, 0x00, 0x13, 0x20, 0x8d, 0x09,
+    0xcf, 0x10, 0x17, 0x76, 0x04, 0x58, 0x0f, 0xb8, 0x07, 0xff, 0x9c, 0x00, 0xf9, 0x3c, 0x80, 0x11,
+    0x25, 0x57, 0x9b, 0x46, 0x20, 0x27, 0x34, 0x15, 0x20, 0x7e, 0x80, 0x1f, 0xfd, 0x80, 0x00, 0xe3,
+    0x20, 0x0f, 0x26, 0x00, 0x7d, 0x10, 0x20, 0x0f, 0x63, 0x80, 0x43, 0xee, 0x01, 0x37, 0xc0, 0x07,
+    0x24, 0xac, 0x00, 0x62, 0xa3, 0xa0, 0x0c, 0x3e, 0x1a, 0x01, 0xd4, 0x5a, 0x20, 0x1a, 0x50, 0x14,
+    0x03, 0x86, 0x92, 0x44, 0x03, 0x32, 0xd0, 0x50, 0x06, 0xe0, 0x19, 0x45, 0x00, 0xf3, 0x1d, 0x88,
+    0x07, 0xb8, 0x6c, 0x00, 0x20, 0x80, 0x73, 0x50, 0x07, 0xae, 0xc2, 0x01, 0xda, 0xa0, 0x1c, 0x7e,
+    0x80, 0x1f, 0xfc, 0xd2, 0xea, 0x00, 0xc3, 0x85, 0x40, 0x10, 0xe1, 0xe8, 0x06, 0xb2, 0x91, 0x00,
+    0xc6, 0x32, 0x01, 0xd3, 0xa5, 0x00, 0x1c, 0x6e, 0xe4, 0x00, 0xe8, 0x3a, 0x10, 0x1f, 0x70, 0x09,
+    0xbe, 0x00, 0x39, 0x25, 0x60, 0x03, 0x15, 0x1d, 0x00, 0x61, 0xf0, 0xd0, 0x0e, 0xa2, 0xd1, 0x00,
+    0xd2, 0x80, 0xa0, 0x1c, 0x34, 0x92, 0x20, 0x19, 0x96, 0x82, 0x80, 0x37, 0x00, 0xca, 0x28, 0x07,
+    0x98, 0xec, 0x40, 0x3d, 0xc3, 0x63, 0xee, 0x01, 0x17, 0xd0, 0x04, 0x3a, 0x80, 0x1f, 0x18, 0x80,
+    0x40, 0x3f, 0x40, 0x0f, 0xfe, 0x69, 0x75, 0x00, 0x61, 0xc2, 0xa0, 0x08, 0x70, 0xf4, 0x03, 0x59,
+    0x48, 0x80, 0x63, 0x19, 0x00, 0xe9, 0xd2, 0x80, 0x0e, 0x37, 0x72, 0x00, 0x74, 0x1d, 0x09, 0xfa,
+    0x00, 0x33, 0x84, 0x02, 0xc7, 0x00, 0xf1, 0x78, 0x04, 0x00, 0x1f, 0x70, 0x09, 0xbe, 0x00, 0x39,
+    0x25, 0x60, 0x03, 0x15, 0x1d, 0x00, 0x61, 0xf0, 0xd0, 0x0e, 0xa2, 0xd1, 0x00, 0xd2, 0x80, 0xa0,
+    0x1c, 0x34, 0x92, 0x20, 0x19, 0x96, 0x82, 0x80, 0x37, 0x00, 0xca, 0x28, 0x07, 0x98, 0xec, 0x40,
+    0x3d, 0xc3, 0x63, 0xee, 0x01, 0x17, 0xd0, 0x01, 0x3f, 0xe8, 0x00, 0xc9, 0xbb, 0x48, 0x00, 0x3f,
+    0x40, 0x0f, 0xfe, 0x69, 0x75, 0x00, 0x61, 0xc2, 0xa0, 0x08, 0x70, 0xf4, 0x03, 0x59, 0x48, 0x80,
+    0x63, 0x19, 0x00, 0xe9, 0xd2, 0x80, 0x0e, 0x37, 0x72, 0x00, 0x74, 0x1d, 0x09, 0xfa, 0x00, 0x33,
+    0x84, 0x07, 0xfe, 0xb0, 0x08, 0x77, 0x6a, 0x00, 0x00, 0x1f, 0x70, 0x0f, 0xff, 0xde, 0x3b, 0xe1,
+    0x00, 0x24, 0x46, 0x51, 0xff, 0xf2, 0x00, 0x55, 0x20, 0x1e, 0x12, 0x00, 0x80, 0x3f, 0x40, 0x0f,
+    0xfe, 0x91, 0xfa, 0x1e, 0x98, 0x13, 0x80, 0x3f, 0xfa, 0x40, 0x31, 0xee, 0xd0, 0x01, 0xc4, 0x50,
+    0x80, 0x70, 0xfb, 0x80, 0x7f, 0xff, 0xc0, 0x3b, 0x1d, 0xf0, 0x80, 0x49, 0x11, 0x94, 0x07, 0xff,
+    0xc8, 0x01, 0xaa, 0x40, 0x3e, 0x12, 0x00, 0x80, 0x6f, 0xf9, 0xdd, 0xbb, 0x30, 0x91, 0x42, 0x07,
+    0xe8, 0x01, 0xff, 0xe8, 0x3f, 0x40, 0x01, 0xe9, 0x80, 0x44, 0xe0, 0x00, 0x1f, 0x70, 0x0f, 0xff,
+    0xde, 0x3b, 0xe1, 0x00, 0x24, 0x46, 0x51, 0xff, 0xf2, 0x00, 0x3b, 0xfd, 0xc0, 0x1b, 0x37, 0x58,
+    0x00, 0x00, 0x03, 0xf4, 0x00, 0xff, 0xf4, 0x1f, 0xa0, 0x37, 0xfc, 0xee, 0xdd, 0x98, 0x1f, 0x70,
+    0x0f, 0xff, 0xde, 0x3b, 0xe1, 0x00, 0x24, 0x46, 0x51, 0xff, 0xf2, 0x00, 0x07, 0x30, 0x20, 0x1b,
+    0x6e, 0xda, 0x00, 0x00, 0x03, 0xf4, 0x00, 0xff, 0xf4, 0x1f, 0xa0, 0x01, 0xb5, 0xc1, 0x23, 0xe9,
+    0x40, 0x00, 0xf1, 0x18, 0x07, 0xfb, 0xec, 0x03, 0xf9, 0x02, 0x00, 0x3f, 0x93, 0x40, 0x38, 0x7f,
+    0xc6, 0x01, 0x87, 0xfc, 0x80, 0x15, 0x00, 0x67, 0x00, 0xe1, 0x70, 0x0d, 0x44, 0x01, 0x9c, 0x50,
+    0x00, 0x46, 0x80, 0x1b, 0xcb, 0x80, 0x0a, 0x1a, 0x01, 0xca, 0xa0, 0x05, 0x28, 0x07, 0xa8, 0x14,
+    0x89, 0xe0, 0x1e, 0x23, 0xf5, 0x15, 0x00, 0xfa, 0xd6, 0x9c, 0x03, 0xf3, 0x01, 0x68, 0x07, 0xe1,
+    0x41, 0x40, 0x0c, 0x00, 0x00, 0xf6, 0xc8, 0x07, 0xf2, 0x1c, 0x00, 0x7f, 0x36, 0x08, 0x06, 0x3f,
+    0x6c, 0xf8, 0x3a, 0xfd, 0x30, 0x0a, 0xe6, 0x17, 0xb6, 0xc3, 0x40, 0x28, 0x57, 0x33, 0x3a, 0x40,
+    0x88, 0x00, 0x20, 0x07, 0x70, 0x06, 0x30, 0x0f, 0xff, 0x20, 0x00, 0xea, 0xc0, 0x0f, 0xf1, 0x38,
+    0x07, 0xfa, 0x2c, 0x03, 0x87, 0xfc, 0x60, 0x18, 0x7f, 0xc8, 0x01, 0x50, 0x06, 0x70, 0x0e, 0x17,
+    0x00, 0xd4, 0x40, 0x19, 0xc5, 0x00, 0x04, 0x68, 0x01, 0xbc, 0xb8, 0x00, 0xa1, 0xa0, 0x1c, 0xaa,
+    0x00, 0x52, 0x80, 0x7a, 0x81, 0x48, 0x9e, 0x01, 0xe2, 0x3f, 0x51, 0x50, 0x0f, 0xad, 0x69, 0xc0,
+    0x3f, 0x30, 0x16, 0x80, 0x7e, 0x14, 0x14, 0x00, 0xc0, 0x00, 0xeb, 0xb0, 0x07, 0xf8, 0x48, 0x03,
+    0xfd, 0x52, 0x01, 0xc7, 0xed, 0x9f, 0x43, 0x5f, 0xa6, 0x01, 0x5c, 0xc2, 0xf6, 0xd8, 0x68, 0x05,
+    0x0a, 0xe6, 0x67, 0x48, 0x11, 0x00, 0x04, 0x00, 0xee, 0x00, 0xc6, 0x01, 0xff, 0xe4, 0x00, 0x1f,
+    0xf1, 0x80, 0x61, 0xff, 0x20, 0x05, 0x40, 0x19, 0xc0, 0x38, 0x5c, 0x03, 0x51, 0x00, 0x67, 0x14,
+    0x00, 0x11, 0xa0, 0x06, 0xf2, 0xe0, 0x02, 0x86, 0x80, 0x72, 0xa8, 0x01, 0x4a, 0x01, 0xea, 0x05,
+    0x22, 0x78, 0x07, 0x88, 0xfd, 0x45, 0x40, 0x3e, 0xb5, 0xa7, 0x00, 0xfc, 0xc0, 0x5a, 0x01, 0xf8,
+    0x50, 0x50, 0x03, 0x0f, 0xb0, 0x02, 0xf8, 0x00, 0x9e, 0x80, 0x1d, 0x16, 0x01, 0xfe, 0x27, 0x00,
+    0xe0, 0x3f, 0x6c, 0xfa, 0x1a, 0xfd, 0x30, 0x0a, 0xe6, 0x17, 0xb6, 0xc3, 0x40, 0x28, 0x57, 0x33,
+    0x3a, 0x40, 0x88, 0x00, 0x20, 0x07, 0x70, 0x06, 0x30, 0x0f, 0xff, 0x21, 0xfa, 0x00, 0x2e, 0xc0,
+    0x05, 0xf2, 0x00, 0xea, 0x90, 0x0f, 0xf0, 0x90, 0x07, 0x00, 0x00, 0xd7, 0x60, 0x0f, 0xc2, 0x20,
+    0x0f, 0xd5, 0x40, 0x0c, 0x3f, 0xa0, 0x19, 0xfc, 0x40, 0x04, 0xe0, 0x1f, 0x86, 0x04, 0x03, 0xe9,
+    0x1b, 0x00, 0xfd, 0x0a, 0x60, 0x1f, 0x31, 0x78, 0x07, 0xe9, 0x36, 0x00, 0xf9, 0x16, 0x00, 0x3f,
+    0x58, 0xc8, 0x07, 0xc3, 0x02, 0x01, 0xf9, 0xc8, 0x00, 0x00, 0x00, 0xb2, 0x80, 0x3c, 0xe4, 0x01,
+    0xeb, 0x80, 0x08, 0xfd, 0xf7, 0xec, 0x40, 0x29, 0x8a, 0x5b, 0x00, 0xa1, 0x54, 0xca, 0x01, 0x10,
+    0x03, 0x80, 0x3f, 0xfa, 0xc0, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02, 0x70, 0x0f, 0xc3, 0x02, 0x01,
+    0xf4, 0x8d, 0x80, 0x7e, 0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4, 0x9b, 0x00, 0x7c, 0x8b, 0x00,
+    0x1f, 0xac, 0x64, 0x03, 0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x1f, 0x70, 0x0d, 0xbe, 0x20, 0x1a,
+    0x68, 0x03, 0xf1, 0x08, 0x06, 0x00, 0x3f, 0x7d, 0xfb, 0x10, 0x0a, 0x62, 0x96, 0xc0, 0x28, 0x55,
+    0x32, 0x80, 0x44, 0x00, 0xe0, 0x0f, 0xfe, 0xb1, 0xfa, 0x00, 0x1b, 0xc0, 0x35, 0x40, 0x07, 0x98,
+    0x80, 0x20, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02, 0x70, 0x0f, 0xc3, 0x02, 0x01, 0xf4, 0x8d, 0x80,
+    0x7e, 0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4, 0x9b, 0x00, 0x7c, 0x8b, 0x00, 0x1f, 0xac, 0x64,
+    0x03, 0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x1f, 0x70, 0x0d, 0xbe, 0x20, 0x17, 0x7f, 0xb8, 0x03,
+    0xd9, 0xba, 0xc0, 0x08, 0x3f, 0x7d, 0xfb, 0x10, 0x0a, 0x62, 0x96, 0xc0, 0x28, 0x55, 0x32, 0x80,
+    0x44, 0x00, 0xe0, 0x0f, 0xfe, 0xb1, 0xfa, 0x00, 0x1b, 0xc0, 0x2f, 0xfb, 0x40, 0x36, 0xed, 0xe0,
+    0x00, 0x1f, 0xd0, 0x0c, 0xfe, 0x20, 0x02, 0x70, 0x0f, 0xc3, 0x02, 0x01, 0xf4, 0x8d, 0x80, 0x7e,
+    0x85, 0x30, 0x0f, 0x98, 0xbc, 0x03, 0xf4, 0x9b, 0x00, 0x7c, 0x8b, 0x00, 0x1f, 0xac, 0x64, 0x03,
+    0xe1, 0x81, 0x00, 0xfc, 0xe4, 0x00, 0x1f, 0x70, 0x0d, 0xbe, 0x20, 0x10, 0xe6, 0x04, 0x03, 0xdb,
+    0x76, 0xd0, 0x08, 0x3f, 0x7d, 0xfb, 0x10, 0x0a, 0x62, 0x96, 0xc0, 0x28, 0x55, 0x32, 0x80, 0x44,
+    0x00, 0xe0, 0x0f, 0xfe, 0xb1, 0xfa, 0x00, 0x1b, 0xc0, 0x22, 0xcb, 0x00, 0xc3, 0xf2, 0x76, 0x00,
+    0x00, 0x00, 0xea, 0xc0, 0x0f, 0x89, 0x34, 0x03, 0xe2, 0xe1, 0x00, 0xf2, 0xea, 0x4a, 0x00, 0x74,
+    0xc4, 0x1d, 0x00, 0x3b, 0x57, 0x38, 0x03, 0x86, 0x3b, 0xf1, 0x40, 0x22, 0xf6, 0x47, 0x1a, 0x80,
+    0x04, 0x86, 0xd4, 0x6b, 0x39, 0x92, 0x49, 0x00, 0x52, 0x14, 0xe0, 0xa0, 0x1c, 0x88, 0x30, 0x30,
+    0x0e, 0x23, 0x30, 0x18, 0x07, 0x11, 0xb8, 0x28, 0x07, 0x22, 0x09, 0x24, 0x80, 0x29, 0x0a, 0x09,
+    0x0d, 0x98, 0xc6, 0x73, 0x02, 0xf6, 0x77, 0x05, 0x40, 0x00, 0x00, 0xff, 0xe0, 0x73, 0x00, 0x73,
+    0xab, 0x00, 0x6a, 0xca, 0xd0, 0x08, 0x5f, 0xbd, 0xc0, 0x21, 0xc5, 0xea, 0x00, 0x86, 0xff, 0xa4,
+    0x02, 0xd4, 0x89, 0x6a, 0x04, 0x3a, 0x77, 0x4a, 0x91, 0x82, 0x00, 0x10, 0x1f, 0xc0, 0x3e, 0xc0,
+    0x30, 0x02, 0x03, 0xa1, 0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9, 0xa8, 0x00, 0x00, 0xad, 0x07, 0x0c,
+    0x03, 0x94, 0x80, 0x9c, 0x03, 0xb9, 0x87, 0x90, 0x03, 0x9b, 0x4e, 0x4c, 0x03, 0xaa, 0x3d, 0xcc,
+    0x03, 0xb5, 0x73, 0x80, 0x38, 0x63, 0xbf, 0x14, 0x02, 0x2f, 0x64, 0x71, 0xa8, 0x00, 0x48, 0x6d,
+    0x46, 0xb3, 0x99, 0x24, 0x90, 0x05, 0x21, 0x4e, 0x0a, 0x01, 0xc8, 0x83, 0x03, 0x00, 0xe2, 0x33,
+    0x01, 0x80, 0x71, 0x1b, 0x82, 0x80, 0x72, 0x20, 0x92, 0x48, 0x02, 0x90, 0xa0, 0x90, 0xd9, 0x8c,
+    0x67, 0x30, 0x2f, 0x67, 0x70, 0x54, 0x00, 0x04, 0xe1, 0x6e, 0x00, 0x99, 0x40, 0x90, 0x02, 0x21,
+    0xa5, 0x70, 0x08, 0x5f, 0xbd, 0xc0, 0x21, 0xc5, 0xea, 0x00, 0x86, 0xff, 0xa4, 0x02, 0xd4, 0x89,
+    0x6a, 0x04, 0x3a, 0x77, 0x4a, 0x91, 0x82, 0x00, 0x10, 0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03,
+    0xa1, 0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9, 0xa8, 0x00, 0x00, 0x97, 0xc4, 0x03, 0xe5, 0x54, 0x80,
+    0x7e, 0xa8, 0x00, 0xfa, 0xbf, 0xe2, 0x00, 0xeb, 0xdd, 0x88, 0x03, 0x84, 0x8a, 0x00, 0xe1, 0x9e,
+    0xfc, 0x50, 0x08, 0xbd, 0x91, 0xc6, 0xa0, 0x01, 0x21, 0xb5, 0x1a, 0xce, 0x64, 0x92, 0x40, 0x14,
+    0x85, 0x38, 0x28, 0x07, 0x22, 0x0c, 0x0c, 0x03, 0x88, 0xcc, 0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01,
+    0xc8, 0x82, 0x49, 0x20, 0x0a, 0x42, 0x82, 0x43, 0x66, 0x31, 0x9c, 0xc0, 0xbd, 0x9d, 0xc1, 0x50,
+    0x00, 0x00, 0x08, 0x07, 0xd7, 0x60, 0x0f, 0x5a, 0x98, 0x07, 0x70, 0xe6, 0x80, 0x6d, 0xdb, 0xc0,
+    0x31, 0x16, 0x00, 0x86, 0xbf, 0xa4, 0x02, 0xd4, 0x89, 0x6a, 0x04, 0x3a, 0x77, 0x4a, 0x91, 0x82,
+    0x00, 0x10, 0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03, 0xa1, 0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9,
+    0xa8, 0x00, 0x00, 0xe8, 0xd0, 0x0f, 0x85, 0xbc, 0x03, 0xe1, 0xe2, 0x00, 0xf5, 0x7f, 0xc4, 0x01,
+    0xd7, 0xbb, 0x10, 0x07, 0x09, 0x14, 0x01, 0xc3, 0x3d, 0xf8, 0xa0, 0x11, 0x7b, 0x23, 0x8d, 0x40,
+    0x02, 0x43, 0x6a, 0x35, 0x9c, 0xc9, 0x24, 0x80, 0x29, 0x0a, 0x70, 0x50, 0x0e, 0x44, 0x18, 0x18,
+    0x07, 0x11, 0x98, 0x0c, 0x03, 0x88, 0xdc, 0x14, 0x03, 0x91, 0x04, 0x92, 0x40, 0x14, 0x85, 0x04,
+    0x86, 0xcc, 0x63, 0x39, 0x81, 0x7b, 0x3b, 0x82, 0xa0, 0x00, 0x00, 0xe1, 0x00, 0xf7, 0x30, 0x07,
+    0x31, 0x38, 0x06, 0xf9, 0x3d, 0x00, 0xdb, 0xb7, 0x80, 0x62, 0x2c, 0x01, 0x0d, 0x7f, 0x48, 0x05,
+    0xa9, 0x12, 0xd4, 0x08, 0x74, 0xee, 0x95, 0x23, 0x04, 0x00, 0x20, 0x3f, 0x80, 0x7d, 0x80, 0x60,
+    0x04, 0x07, 0x42, 0xd6, 0x79, 0x52, 0x0c, 0x49, 0x93, 0x50, 0x00, 0x00, 0xc2, 0x80, 0x1f, 0x5f,
+    0x80, 0x78, 0x96, 0x40, 0x3c, 0x5e, 0x40, 0x10, 0xff, 0xed, 0x80, 0x0c, 0x91, 0x07, 0x74, 0x80,
+    0x58, 0xee, 0xa7, 0x61, 0x00, 0xf6, 0x01, 0x00, 0x78, 0x80, 0x40, 0x1e, 0x22, 0x58, 0x32, 0x00,
+    0x3f, 0x72, 0x8f, 0x80, 0x26, 0xbb, 0x66, 0x90, 0x05, 0xc8, 0x83, 0x00, 0xff, 0xe4, 0x80, 0x00,
+    0xcd, 0xe2, 0x01, 0xd7, 0x22, 0x01, 0xdc, 0xc0, 0x03, 0xf7, 0xdc, 0xc1, 0x00, 0x53, 0x76, 0x0c,
+    0x00, 0xa5, 0x93, 0x85, 0x80, 0x08, 0x00, 0x21, 0xf0, 0x0f, 0xf5, 0x80, 0x0c, 0x7c, 0x00, 0xd0,
+    0xda, 0x2e, 0x00, 0x84, 0x92, 0xd1, 0x00, 0x16, 0x7e, 0x18, 0x07, 0xff, 0x14, 0x00, 0x9f, 0x84,
+    0x03, 0xc2, 0x42, 0x01, 0xe6, 0xc0, 0x0c, 0x3f, 0xfb, 0x60, 0x03, 0x24, 0x41, 0xdd, 0x20, 0x16,
+    0x3b, 0xa9, 0xd8, 0x40, 0x3d, 0x80, 0x40, 0x1e, 0x20, 0x10, 0x07, 0x88, 0x96, 0x0c, 0x80, 0x0f,
+    0xdc, 0xa3, 0xe0, 0x09, 0xae, 0xd9, 0xa4, 0x01, 0x72, 0x20, 0xc0, 0x3f, 0xf9, 0x20, 0x00, 0x93,
+    0x88, 0x03, 0xc6, 0x01, 0xe4, 0xd2, 0x00, 0x1f, 0xbe, 0xfe, 0x10, 0x05, 0x37, 0x60, 0xc0, 0x0a,
+    0x59, 0x38, 0x58, 0x00, 0x80, 0x02, 0x1f, 0x00, 0xff, 0x58, 0x00, 0xc7, 0xc0, 0x0d, 0x0d, 0xa2,
+    0xe0, 0x08, 0x49, 0x2d, 0x10, 0x01, 0x67, 0xe1, 0x80, 0x7f, 0xf1, 0x40, 0x00, 0x93, 0x88, 0x03,
+    0xe3, 0x00, 0xf9, 0x34, 0x80, 0x21, 0xff, 0xdd, 0x20, 0x19, 0x66, 0x4e, 0xd6, 0x01, 0x6b, 0x32,
+    0x61, 0x08, 0x03, 0xca, 0x0e, 0x01, 0xe6, 0x01, 0x00, 0x78, 0x89, 0x24, 0x50, 0x00, 0xfd, 0xcb,
+    0x0d, 0x00, 0x9a, 0xe8, 0x10, 0xc0, 0x2e, 0x45, 0x66, 0x10, 0x07, 0xa0, 0x20, 0x03, 0xc3, 0x0a,
+    0x60, 0x02, 0xe5, 0x00, 0x19, 0x80, 0x21, 0xd5, 0x03, 0xf7, 0xe7, 0x00, 0x54, 0x28, 0x02, 0xd8,
+    0x80, 0x04, 0x01, 0xff, 0xca, 0x00, 0x1f, 0xfd, 0xd4, 0x20, 0x12, 0xcc, 0x99, 0x70, 0x02, 0xd6,
+    0x64, 0x51, 0x18, 0x07, 0x98, 0x1c, 0x01, 0xe2, 0x23, 0xf0, 0x50, 0x03, 0xf7, 0x30, 0xac, 0x40,
+    0x0d, 0x74, 0x0c, 0x80, 0x17, 0x22, 0xa3, 0x00, 0x7d, 0xe2, 0xc0, 0x1e, 0x42, 0xb0, 0x0f, 0xac,
+    0x90, 0x7d, 0xc0, 0x26, 0xf4, 0x00, 0x8f, 0x4c, 0x03, 0xce, 0x40, 0x18, 0x3f, 0x7e, 0x70, 0x05,
+    0x42, 0x80, 0x2d, 0x88, 0x00, 0x40, 0x1f, 0xfc, 0xa3, 0xf4, 0x00, 0x1e, 0x98, 0x04, 0x4e, 0x00,
+    0x00, 0x00, 0x3f, 0xfc, 0xa0, 0x19, 0xb7, 0x65, 0x00, 0xc2, 0x45, 0x00, 0x43, 0xff, 0xba, 0x84,
+    0x02, 0x59, 0x93, 0x2e, 0x00, 0x5a, 0xcc, 0x8a, 0x23, 0x00, 0xf3, 0x03, 0x80, 0x3c, 0x44, 0x7e,
+    0x0a, 0x00, 0x7e, 0xe6, 0x15, 0x88, 0x01, 0xae, 0x81, 0x90, 0x02, 0xe4, 0x54, 0x60, 0x0f, 0xbc,
+    0x58, 0x03, 0xc8, 0x56, 0x01, 0xf5, 0x92, 0x0f, 0xb8, 0x04, 0xde, 0x80, 0x11, 0xe9, 0x80, 0x79,
+    0xc8, 0x03, 0x00, 0x4f, 0xfa, 0x13, 0x76, 0x90, 0x22, 0x84, 0xfd, 0xf9, 0xc0, 0x15, 0x0a, 0x00,
+    0xb6, 0x20, 0x01, 0x00, 0x7f, 0xf2, 0x8f, 0xd0, 0x00, 0x7a, 0x60, 0x11, 0x38, 0x00, 0x1f, 0xfd,
+    0xd2, 0x01, 0x96, 0x64, 0xed, 0x60, 0x16, 0xb3, 0x26, 0x10, 0x80, 0x3c, 0xa0, 0xe0, 0x1e, 0x60,
+    0x10, 0x07, 0x88, 0x92, 0x45, 0x00, 0x0f, 0xdc, 0xb0, 0xd0, 0x09, 0xae, 0x81, 0x0c, 0x02, 0xe4,
+    0x56, 0x61, 0x00, 0x7a, 0x02, 0x00, 0x3c, 0x30, 0xa6, 0x3e, 0xe0, 0x13, 0xf9, 0x80, 0x1b, 0xfe,
+    0x60, 0x0c, 0xfb, 0xb3, 0x80, 0x00, 0x03, 0xf7, 0xe7, 0x00, 0xaa, 0x14, 0x02, 0xb6, 0x20, 0x08,
+    0x80, 0x3f, 0xf9, 0xe7, 0xe8, 0x00, 0x6f, 0xf9, 0xc1, 0xf7, 0x66, 0x00, 0x00, 0x97, 0x88, 0x03,
+    0xc2, 0x66, 0x00, 0xf2, 0x68, 0x80, 0x61, 0x9e, 0xfd, 0x50, 0x0b, 0x59, 0xe0, 0x69, 0x80, 0xcd,
+    0x32, 0x7c, 0x3a, 0x00, 0x8c, 0x02, 0xf9, 0x03, 0x35, 0x4a, 0x01, 0xa8, 0x03, 0x1d, 0xd7, 0xf4,
+    0x20, 0x14, 0x76, 0xc2, 0x60, 0x25, 0x00, 0x09, 0xec, 0x8c, 0x55, 0x40, 0x11, 0x00, 0xa9, 0x54,
+    0xbd, 0x42, 0x10, 0x63, 0x24, 0x23, 0xd8, 0x00, 0x00, 0x27, 0x18, 0x07, 0x18, 0x80, 0x64, 0xd2,
+    0x00, 0x97, 0x7f, 0x0c, 0x0a, 0x92, 0xdf, 0x41, 0x82, 0xd2, 0x98, 0x50, 0xb6, 0x9e, 0x04, 0x36,
+    0x42, 0x78, 0x51, 0xda, 0xb4, 0x50, 0x22, 0x09, 0x60, 0xc9, 0x2b, 0x69, 0x46, 0x00, 0x01, 0x9e,
+    0xfd, 0x50, 0x0b, 0x59, 0xe0, 0x69, 0x80, 0xcd, 0x32, 0x7c, 0x3a, 0x00, 0x8c, 0x02, 0xf9, 0x03,
+    0x35, 0x4a, 0x01, 0xa8, 0x03, 0x1d, 0xd7, 0xf4, 0x20, 0x14, 0x76, 0xc2, 0x60, 0x25, 0x00, 0x09,
+    0xec, 0x8c, 0x55, 0x40, 0x11, 0x00, 0xa9, 0x54, 0xbd, 0x42, 0x10, 0x63, 0x24, 0x23, 0xd8, 0x00,
+    0x67, 0x7f, 0xa0, 0x03, 0x93, 0x48, 0x03, 0xc2, 0x40, 0x18, 0x05, 0xdf, 0xc3, 0x02, 0xa4, 0xb7,
+    0xd0, 0x60, 0xb4, 0xa6, 0x14, 0x2d, 0xa7, 0x81, 0x0d, 0x90, 0x9e, 0x14, 0x76, 0xad, 0x14, 0x08,
+    0x82, 0x58, 0x32, 0x4a, 0xda, 0x51, 0x83, 0x6f, 0xea, 0x80, 0x47, 0xa4, 0x01, 0x9c, 0x84, 0x00,
+    0x00, 0x00, 0x2f, 0x08, 0x07, 0x9d, 0x93, 0x84, 0x03, 0x14, 0x75, 0x88, 0x07, 0xad, 0x40, 0x30,
+    0xcf, 0x7e, 0xa8, 0x05, 0xac, 0xf0, 0x34, 0xc0, 0x66, 0x99, 0x3e, 0x1d, 0x00, 0x46, 0x01, 0x7c,
+    0x81, 0x9a, 0xa5, 0x00, 0xd4, 0x01, 0x8e, 0xeb, 0xfa, 0x10, 0x0a, 0x3b, 0x61, 0x30, 0x12, 0x80,
+    0x04, 0xf6, 0x46, 0x2a, 0xa0, 0x08, 0x80, 0x54, 0xaa, 0x5e, 0xa1, 0x08, 0x31, 0x92, 0x11, 0xec,
+    0x00, 0x00, 0x27, 0x10, 0x06, 0x64, 0x30, 0x0c, 0x54, 0x20, 0x1c, 0xde, 0xa0, 0x10, 0xc5, 0x28,
+    0x04, 0x3c, 0xa0, 0x12, 0xef, 0xe1, 0x81, 0x52, 0x5b, 0xe8, 0x30, 0x5a, 0x53, 0x0a, 0x16, 0xd3,
+    0xc0, 0x86, 0xc8, 0x4f, 0x0a, 0x3b, 0x56, 0x8a, 0x04, 0x41, 0x2c, 0x19, 0x25, 0x6d, 0x28, 0xc0,
+    0x00, 0x93, 0x04, 0x03, 0xc2, 0x40, 0x1e, 0x56, 0xe4, 0x30, 0x0c, 0x3a, 0xd6, 0x40, 0x19, 0x1a,
+    0x28, 0x40, 0x3a, 0x39, 0x00, 0x30, 0xcf, 0x7e, 0xb8, 0x05, 0xac, 0xf0, 0xd0, 0xe0, 0x66, 0x99,
+    0x3d, 0xad, 0x00, 0x46, 0x01, 0x56, 0x81, 0x9a, 0xa5, 0x00, 0x3b, 0x1d, 0xd7, 0xf4, 0x20, 0x14,
+    0x76, 0xc2, 0x60, 0x2e, 0x08, 0x13, 0xd9, 0x18, 0x9b, 0x80, 0x44, 0x02, 0x87, 0x34, 0xf5, 0x08,
+    0x41, 0xac, 0x90, 0x8f, 0x60, 0x00, 0x00, 0x27, 0x10, 0x06, 0x72, 0x00, 0xcd, 0xdc, 0xc5, 0x00,
+    0x32, 0x6c, 0xa8, 0x05, 0x3e, 0xe0, 0x12, 0xef, 0xe1, 0x81, 0x52, 0x5b, 0xe8, 0x30, 0x5a, 0x53,
+    0x0a, 0x16, 0xd3, 0xc0, 0x86, 0xc8, 0x4f, 0x0a, 0x43, 0x56, 0x8a, 0x3b, 0xa1, 0x2c, 0x18, 0xe5,
+    0x6d, 0x28, 0xc0, 0x00, 0x93, 0x44, 0x03, 0xc2, 0x66, 0x00, 0xf2, 0xf1, 0x00, 0x7f, 0xf0, 0x46,
+    0x7b, 0xf5, 0x40, 0x2d, 0x67, 0x81, 0xa6, 0x03, 0x34, 0xc9, 0xf0, 0xe8, 0x02, 0x30, 0x0b, 0xe4,
+    0x0c, 0xd5, 0x28, 0x06, 0xa0, 0x0c, 0x77, 0x5f, 0xd0, 0x80, 0x51, 0xdb, 0x09, 0x80, 0x94, 0x00,
+    0x27, 0xb2, 0x31, 0x55, 0x00, 0x44, 0x02, 0xa5, 0x52, 0xf5, 0x08, 0x41, 0x8c, 0x90, 0x8f, 0x60,
+    0x01, 0x9d, 0xfe, 0x80, 0x0e, 0x4d, 0x20, 0x0f, 0x09, 0x00, 0x60, 0x00, 0x27, 0x18, 0x07, 0x18,
+    0x80, 0x64, 0xd2, 0x00, 0x97, 0x7f, 0x0c, 0x0a, 0x92, 0xdf, 0x41, 0x82, 0xd2, 0x98, 0x50, 0xb6,
+    0x9e, 0x04, 0x36, 0x42, 0x78, 0x51, 0xda, 0xb4, 0x50, 0x22, 0x09, 0x60, 0xc9, 0x2b, 0x69, 0x46,
+    0x0d, 0xbf, 0xaa, 0x01, 0x1e, 0x90, 0x06, 0x72, 0x10, 0x00, 0x00, 0x9b, 0x84, 0x03, 0xc6, 0x60,
+    0x0f, 0x97, 0x44, 0x02, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10, 0x74, 0x77, 0x60, 0x4b, 0xb8,
+    0x80, 0x3f, 0xff, 0x80, 0x09, 0xc0, 0x08, 0x5c, 0x02, 0x8b, 0x00, 0xa2, 0xc0, 0x22, 0x60, 0x07,
+    0x29, 0x7a, 0x52, 0x0d, 0xaa, 0x09, 0xa0, 0x80, 0x7f, 0xf1, 0x08, 0x88, 0x21, 0x45, 0x6a, 0x00,
+    0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10, 0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x3f, 0xff, 0xed,
+    0xe2, 0x01, 0xe5, 0xd1, 0x00, 0xf1, 0x98, 0x03, 0x00, 0x05, 0x60, 0x0b, 0xec, 0x03, 0xee, 0x52,
+    0xf4, 0xa4, 0x1b, 0x54, 0x13, 0x41, 0x00, 0xff, 0xe2, 0x11, 0x10, 0x42, 0x8a, 0xd4, 0x0b, 0x7d,
+    0x00, 0x18, 0xc0, 0x11, 0x08, 0x00, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10, 0x74, 0x77, 0x60,
+    0x4b, 0xb8, 0x80, 0x3f, 0xff, 0xed, 0xe2, 0x01, 0xd3, 0xff, 0x18, 0x06, 0x8d, 0xd8, 0xc0, 0x00,
+    0x0a, 0xd0, 0x0f, 0xb9, 0x4b, 0xd2, 0x90, 0x6d, 0x50, 0x4d, 0x04, 0x03, 0xff, 0x88, 0x44, 0x41,
+    0x0a, 0x2b, 0x50, 0x2d, 0xf4, 0x2f, 0xfa, 0x8b, 0x76, 0xb0, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f,
+    0x10, 0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x3f, 0xff, 0xed, 0xe2, 0x01, 0xe9, 0xd4, 0x00, 0xe7,
+    0x5e, 0xa3, 0x00, 0x00, 0x05, 0x60, 0x0d, 0xf6, 0x01, 0xfd, 0xca, 0x5e, 0x81, 0x48, 0x36, 0xa0,
+    0x82, 0x68, 0x20, 0x1f, 0xfc, 0x82, 0x22, 0x08, 0x02, 0x8a, 0xd4, 0x00, 0x5b, 0xe8, 0x00, 0x3d,
+    0xa0, 0x01, 0x6c, 0x8c, 0x80, 0x2f, 0x60, 0x0d, 0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42,
+    0x22, 0xa0, 0x08, 0x55, 0x41, 0x05, 0xb1, 0x3e, 0x10, 0x0b, 0x62, 0xec, 0xb8, 0x60, 0x04, 0xcf,
+    0xf5, 0x98, 0x04, 0x7a, 0x49, 0xa2, 0x01, 0x88, 0x44, 0x66, 0x00, 0x3f, 0x40, 0x03, 0x78, 0x07,
+    0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70, 0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x40,
+    0x04, 0x79, 0xf6, 0xfe, 0x00, 0x2d, 0x33, 0x69, 0x00, 0x44, 0xee, 0x21, 0x00, 0x2f, 0x60, 0x0d,
+    0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42, 0x22, 0xa0, 0x08, 0x55, 0x41, 0x05, 0xb1, 0x3e,
+    0x10, 0x0b, 0x62, 0xec, 0xb8, 0x60, 0x04, 0xcf, 0xf5, 0x98, 0x06, 0xab, 0x2d, 0x00, 0xc2, 0x9d,
+    0x88, 0x00, 0x00, 0x3f, 0x40, 0x03, 0x78, 0x07, 0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70,
+    0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x40, 0x04, 0x79, 0xf6, 0xfe, 0x01, 0x4e, 0x1e, 0x80,
+    0x67, 0x8e, 0x70, 0x00, 0x2f, 0x60, 0x0d, 0x1e, 0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42, 0x22,
+    0xa0, 0x08, 0x55, 0x41, 0x05, 0xb1, 0x3e, 0x10, 0x0b, 0x62, 0xec, 0xb8, 0x60, 0x04, 0xcf, 0xf5,
+    0x98, 0x06, 0x2e, 0xd1, 0x00, 0xc3, 0xf6, 0xba, 0x00, 0x00, 0x3f, 0x40, 0x03, 0x78, 0x07, 0xff,
+    0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70, 0x00, 0x89, 0x0f, 0x2c, 0x01, 0x71, 0x41, 0x40, 0x04,
+    0x79, 0xf6, 0xfe, 0x01, 0x0e, 0xe8, 0x40, 0x36, 0xdd, 0x68, 0x00, 0x00, 0xee, 0x70, 0x0f, 0x32,
+    0xb8, 0x07, 0x9a, 0xc0, 0x3d, 0x56, 0x3a, 0x01, 0x85, 0x3b, 0xdc, 0x03, 0x0f, 0xaf, 0x50, 0x00,
+    0xbd, 0x84, 0x02, 0x8f, 0x00, 0xff, 0xf5, 0x18, 0x08, 0x06, 0x21, 0x11, 0x50, 0x04, 0x2a, 0xa0,
+    0x82, 0xd8, 0x9f, 0x08, 0x05, 0xb1, 0x76, 0x5c, 0x30, 0x00, 0xff, 0xe0, 0x73, 0x00, 0x73, 0xab,
+    0x00, 0x6a, 0xca, 0xd0, 0x08, 0x53, 0xbd, 0xc0, 0x21, 0xf5, 0xea, 0x00, 0x1f, 0xa8, 0x01, 0xbc,
+    0x03, 0xff, 0x9a, 0x20, 0x18, 0x40, 0x31, 0x00, 0x38, 0x00, 0x44, 0x87, 0x96, 0x00, 0xb8, 0xa0,
+    0xa0, 0x00, 0x00, 0x00, 0x16, 0x0a, 0x60, 0x06, 0x62, 0x32, 0x20, 0x80, 0x49, 0xc4, 0xdc, 0x20,
+    0x1b, 0xfe, 0xd0, 0x0e, 0xdd, 0xbc, 0x03, 0x88, 0xb0, 0x00, 0xbd, 0x80, 0x34, 0x78, 0x07, 0xff,
+    0xa8, 0xc0, 0x40, 0x31, 0x08, 0x8a, 0x80, 0x21, 0x55, 0x04, 0x16, 0xc4, 0xf8, 0x40, 0x2d, 0x8b,
+    0xb2, 0xe1, 0x80, 0x04, 0xe2, 0x6e, 0x00, 0x9c, 0x8c, 0x88, 0x01, 0x19, 0xba, 0xc4, 0x03, 0x6e,
+    0xde, 0x01, 0x88, 0xb0, 0x00, 0xfd, 0x00, 0x0d, 0xe0, 0x1f, 0xfc, 0xd1, 0x00, 0xc2, 0x01, 0x88,
+    0x01, 0xc0, 0x02, 0x24, 0x3c, 0xb0, 0x05, 0xc5, 0x05, 0x00, 0x00, 0x00, 0x0e, 0x4a, 0x50, 0x07,
+    0x23, 0x75, 0x78, 0x07, 0x2d, 0x3f, 0x28, 0x05, 0x7c, 0x01, 0xcf, 0xe3, 0xa2, 0x60, 0x1a, 0xcc,
+    0x5c, 0x2c, 0x02, 0x13, 0xb0, 0x14, 0x60, 0x09, 0x81, 0x80, 0x1a, 0x26, 0x00, 0xb3, 0x10, 0x03,
+    0x85, 0x80, 0x9d, 0x80, 0x42, 0x8a, 0x0e, 0x0a, 0x01, 0xb8, 0x89, 0x86, 0x40, 0x19, 0x41, 0x55,
+    0x60, 0x1e, 0x49, 0x05, 0x00, 0xf7, 0x09, 0x90, 0x04, 0x00, 0x01, 0xda, 0x3b, 0x00, 0x91, 0xf7,
+    0x34, 0x02, 0x5a, 0x7f, 0x60, 0x05, 0x68, 0x04, 0xfe, 0x1e, 0x46, 0x00, 0xa5, 0x05, 0x0b, 0x02,
+    0x27, 0x80, 0x15, 0x40, 0xa0, 0xa0, 0x0e, 0x22, 0x5a, 0x80, 0x48, 0x36, 0x7c, 0x01, 0x9d, 0x85,
+    0x00, 0x36, 0x83, 0x80, 0x40, 0xbe, 0x00, 0xe7, 0xf1, 0xd1, 0x30, 0x0d, 0x66, 0x2e, 0x16, 0x01,
+    0x09, 0xd8, 0x0a, 0x30, 0x04, 0xc0, 0xc0, 0x0d, 0x13, 0x00, 0x59, 0x88, 0x01, 0xc2, 0xc0, 0x4e,
+    0xc0, 0x21, 0x45, 0x07, 0x05, 0x00, 0xdc, 0x44, 0xc3, 0x20, 0x0c, 0xa0, 0xaa, 0xb0, 0x0f, 0x24,
+    0x82, 0x80, 0x7b, 0x84, 0xc8, 0x03, 0xcb, 0xf8, 0x01, 0xf0, 0xea, 0x80, 0x7e, 0x33, 0x00, 0x60,
+    0xad, 0x00, 0x9f, 0xc3, 0xc8, 0xc0, 0x14, 0xa0, 0xa1, 0x60, 0x44, 0xf0, 0x02, 0xa8, 0x14, 0x14,
+    0x01, 0xc4, 0x4b, 0x50, 0x09, 0x06, 0xcf, 0x80, 0x33, 0xb0, 0xa0, 0x06, 0xd0, 0x70, 0x0e, 0x4f,
+    0x90, 0x0e, 0x1d, 0x50, 0x0f, 0x19, 0x80, 0x20, 0x00, 0xe4, 0x10, 0x0f, 0xfe, 0x07, 0xd8, 0x07,
+    0xff, 0x02, 0x54, 0x80, 0x3f, 0xe2, 0xf2, 0x00, 0xf6, 0x60, 0x02, 0x3f, 0xb0, 0x09, 0x3d, 0x10,
+    0x60, 0x12, 0x02, 0x00, 0x58, 0x09, 0x80, 0x80, 0x0d, 0x20, 0x30, 0x02, 0x18, 0x20, 0x60, 0x01,
+    0x28, 0x14, 0x00, 0x68, 0x00, 0x33, 0x01, 0x0a, 0x23, 0x00, 0xc3, 0x00, 0x08, 0x80, 0x40, 0x3c,
+    0x40, 0x40, 0x40, 0x06, 0x01, 0xe2, 0x02, 0x09, 0x61, 0x80, 0x48, 0x0a, 0xf8, 0x06, 0x0e, 0xa8,
+    0x01, 0x8f, 0x49, 0x00, 0x09, 0xc3, 0x80, 0x19, 0x10, 0x06, 0x00, 0xc4, 0x04, 0x00, 0xd8, 0x08,
+    0x01, 0x20, 0x18, 0x04, 0x00, 0x00, 0x8f, 0xcc, 0x03, 0xf1, 0xb4, 0x80, 0x7f, 0x4c, 0x80, 0x3a,
+    0xf0, 0x00, 0xd8, 0x60, 0x0f, 0x8d, 0x30, 0x06, 0x02, 0x01, 0x86, 0x20, 0x20, 0x21, 0xe0, 0x20,
+    0x21, 0x13, 0x08, 0x65, 0x03, 0x10, 0x00, 0x89, 0x12, 0x81, 0xa6, 0x80, 0x34, 0xf1, 0x41, 0x24,
+    0x10, 0x00, 0x80, 0xb8, 0x18, 0xa4, 0x40, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0xf8, 0xc8,
+    0x03, 0xfe, 0x2c, 0x10, 0x0f, 0xfa, 0x18, 0xc0, 0x3f, 0xea, 0x90, 0x0f, 0x66, 0x00, 0x23, 0xfb,
+    0x00, 0x93, 0xd1, 0x06, 0x01, 0x20, 0x20, 0x05, 0x80, 0x98, 0x08, 0x00, 0xd2, 0x03, 0x00, 0x21,
+    0x82, 0x06, 0x00, 0x12, 0x81, 0x40, 0x06, 0x80, 0x03, 0x30, 0x10, 0xa2, 0x30, 0x0c, 0x30, 0x00,
+    0x88, 0x04, 0x03, 0xc4, 0x04, 0x04, 0x00, 0x60, 0x1e, 0x20, 0x20, 0x96, 0x18, 0x04, 0x80, 0xaf,
+    0x80, 0x60, 0xea, 0x80, 0x18, 0xf4, 0x90, 0x00, 0x9c, 0x38, 0x01, 0x91, 0x00, 0x60, 0x0c, 0x40,
+    0x40, 0x0d, 0x80, 0x80, 0x12, 0x01, 0x80, 0x40, 0x00, 0xe6, 0xf1, 0x00, 0xfd, 0x72, 0x20, 0x1f,
+    0xb9, 0x80, 0x35, 0xe0, 0x01, 0xb0, 0xc0, 0x1f, 0x1a, 0x60, 0x0c, 0x04, 0x03, 0x0c, 0x40, 0x40,
+    0x43, 0xc0, 0x40, 0x42, 0x26, 0x10, 0xca, 0x06, 0x20, 0x01, 0x12, 0x25, 0x03, 0x4d, 0x00, 0x69,
+    0xe2, 0x82, 0x48, 0x20, 0x01, 0x01, 0x70, 0x31, 0x48, 0x80, 0x12, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0xcd, 0xc2, 0xfa, 0x01, 0xfc, 0x66, 0x11, 0x80, 0x3f, 0x97, 0x41, 0xb0, 0x03, 0xb3, 0x00,
+    0x11, 0xfd, 0x80, 0x49, 0xe8, 0x83, 0x00, 0x90, 0x10, 0x02, 0xc0, 0x4c, 0x04, 0x00, 0x69, 0x01,
+    0x80, 0x10, 0xc1, 0x03, 0x00, 0x09, 0x40, 0xa0, 0x03, 0x40, 0x01, 0x98, 0x08, 0x51, 0x18, 0x06,
+    0x18, 0x00, 0x44, 0x02, 0x01, 0xe2, 0x02, 0x02, 0x00, 0x30, 0x0f, 0x10, 0x10, 0x4b, 0x0c, 0x02,
+    0x40, 0x57, 0xc0, 0x30, 0x75, 0x40, 0x0c, 0x7a, 0x48, 0x00, 0x4e, 0x1c, 0x00, 0xc8, 0x80, 0x30,
+    0x06, 0x20, 0x20, 0x06, 0xc0, 0x40, 0x09, 0x00, 0xc0, 0x20, 0x00, 0xae, 0x83, 0x24, 0x03, 0xc2,
+    0x60, 0xe2, 0x01, 0xea, 0x90, 0xb8, 0x00, 0xaf, 0x00, 0x0d, 0xe6, 0x00, 0xf8, 0xd3, 0x00, 0x60,
+    0x20, 0x18, 0x62, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x11, 0x30, 0x86, 0x50, 0x31, 0x00, 0x08, 0x91,
+    0x28, 0x1a, 0x68, 0x03, 0x4f, 0x14, 0x12, 0x41, 0x00, 0x08, 0x0b, 0x81, 0x8a, 0x44, 0x00, 0x90,
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0xf7, 0x38, 0x07, 0xff, 0x00, 0x84, 0x03, 0xff, 0x81, 0x8c,
+    0x01, 0xec, 0xc0, 0x04, 0x7f, 0x60, 0x12, 0x7a, 0x20, 0xc0, 0x24, 0x04, 0x00, 0xb0, 0x13, 0x01,
+    0x00, 0x1a, 0x40, 0x60, 0x04, 0x30, 0x40, 0xc0, 0x02, 0x50, 0x28, 0x00, 0xd0, 0x00, 0x66, 0x02,
+    0x14, 0x46, 0x01, 0x86, 0x00, 0x11, 0x00, 0x80, 0x78, 0x80, 0x80, 0x80, 0x0c, 0x03, 0xc4, 0x04,
+    0x12, 0xc3, 0x00, 0x90, 0x15, 0xf0, 0x0c, 0x1d, 0x50, 0x03, 0x1e, 0x92, 0x00, 0x13, 0x87, 0x00,
+    0x32, 0x20, 0x0c, 0x01, 0x88, 0x08, 0x01, 0xb0, 0x10, 0x02, 0x40, 0x30, 0x08, 0x00, 0xcb, 0xc4,
+    0x01, 0xf8, 0x4c, 0x03, 0xf9, 0x34, 0x80, 0x35, 0xe0, 0x01, 0xbc, 0xc0, 0x1f, 0x1a, 0x60, 0x0c,
+    0x04, 0x03, 0x0c, 0x40, 0x40, 0x43, 0xc0, 0x40, 0x42, 0x26, 0x10, 0xca, 0x06, 0x20, 0x01, 0x12,
+    0x25, 0x03, 0x4d, 0x00, 0x69, 0xe2, 0x82, 0x48, 0x20, 0x01, 0x01, 0x70, 0x31, 0x48, 0x80, 0x12,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0xcc, 0x00, 0x47, 0xf6, 0x01, 0x27, 0xa2, 0x0c, 0x02, 0x40, 0x40,
+    0x0b, 0x01, 0x30, 0x10, 0x01, 0xa4, 0x06, 0x00, 0x43, 0x04, 0x0c, 0x00, 0x25, 0x02, 0x80, 0x0d,
+    0x00, 0x06, 0x60, 0x21, 0x44, 0x60, 0x18, 0x60, 0x01, 0x10, 0x08, 0x07, 0x88, 0x08, 0x08, 0x00,
+    0xc0, 0x3c, 0x40, 0x41, 0x2c, 0x30, 0x09, 0x01, 0x5f, 0x00, 0xc1, 0xd5, 0x00, 0x31, 0xe9, 0x20,
+    0x01, 0x38, 0x70, 0x03, 0x22, 0x00, 0xc0, 0x18, 0x80, 0x80, 0x1b, 0x01, 0x00, 0x24, 0x03, 0x00,
+    0xe4, 0xfb, 0x00, 0x8f, 0xf0, 0x03, 0xfb, 0x18, 0x03, 0xff, 0x80, 0x42, 0x01, 0xe0, 0xbc, 0x00,
+    0x37, 0x98, 0x03, 0xe3, 0x4c, 0x01, 0x80, 0x80, 0x61, 0x88, 0x08, 0x08, 0x78, 0x08, 0x08, 0x44,
+    0xc2, 0x19, 0x40, 0xc4, 0x00, 0x22, 0x44, 0xa0, 0x69, 0xa0, 0x0d, 0x3c, 0x50, 0x49, 0x04, 0x00,
+    0x20, 0x2e, 0x06, 0x29, 0x10, 0x02, 0x40, 0x40, 0x40, 0x40, 0x0d, 0x7e, 0x00, 0x3f, 0x90, 0x0f,
+    0x26, 0x90, 0x07, 0xe1, 0x20, 0x0e, 0x00, 0x00, 0x8b, 0x94, 0x03, 0xe3, 0x30, 0x07, 0xe1, 0xd5,
+    0x00, 0xc9, 0xee, 0x01, 0x17, 0xc8, 0x22, 0xc0, 0x80, 0x24, 0x60, 0x01, 0x63, 0x40, 0xc9, 0x62,
+    0x00, 0x18, 0x45, 0x85, 0x50, 0x06, 0x63, 0xa1, 0xb0, 0x0f, 0x50, 0x20, 0x80, 0x7a, 0x05, 0x10,
+    0x01, 0xd2, 0x38, 0x52, 0x01, 0x8d, 0xa0, 0xb8, 0xa0, 0x02, 0xe3, 0x70, 0x36, 0x73, 0x08, 0x2f,
+    0x00, 0xa4, 0x7c, 0x00, 0x00, 0x17, 0x28, 0x07, 0x8c, 0x40, 0x38, 0xb5, 0x00, 0x25, 0xf4, 0x01,
+    0xea, 0x05, 0x49, 0x08, 0x0b, 0x00, 0x51, 0x53, 0x58, 0x80, 0x06, 0x15, 0x14, 0x03, 0x78, 0x30,
+    0x06, 0x37, 0x82, 0x70, 0x0b, 0x8d, 0xdd, 0x04, 0x10, 0x5c, 0x10, 0x5c, 0x00, 0x00, 0x46, 0x84,
+    0xe0, 0x07, 0x78, 0x80, 0xb8, 0x07, 0x3e, 0x04, 0x58, 0x04, 0x9e, 0xe0, 0x11, 0x7c, 0x82, 0x2c,
+    0x08, 0x02, 0x46, 0x00, 0x16, 0x34, 0x0c, 0x96, 0x20, 0x01, 0x84, 0x58, 0x55, 0x00, 0x66, 0x3a,
+    0x1b, 0x00, 0xf5, 0x02, 0x08, 0x07, 0xa0, 0x51, 0x00, 0x1d, 0x23, 0x85, 0x20, 0x18, 0xda, 0x0b,
+    0x8a, 0x00, 0x2e, 0x37, 0x03, 0x67, 0x30, 0x82, 0xf0, 0x0a, 0x47, 0xc0, 0x08, 0xd0, 0xac, 0x00,
+    0xbc, 0x40, 0x98, 0x02, 0x7c, 0x08, 0xa0, 0x02, 0xfa, 0x00, 0xf5, 0x02, 0xa4, 0x84, 0x05, 0x80,
+    0x28, 0xa9, 0xac, 0x40, 0x03, 0x0a, 0x8a, 0x01, 0xbc, 0x18, 0x03, 0x1b, 0xc1, 0x38, 0x05, 0xc6,
+    0xee, 0x82, 0x08, 0x2e, 0x08, 0x2e, 0x00, 0x00, 0x8b, 0x94, 0x03, 0xe3, 0x30, 0x80, 0x7c, 0x3a,
+    0x80, 0x1a, 0x7c, 0x80, 0x37, 0x68, 0x40, 0x48, 0x04, 0xe3, 0x20, 0x30, 0x88, 0x01, 0x84, 0x40,
+    0x01, 0xca, 0x02, 0x02, 0x40, 0x34, 0x1b, 0xb3, 0x08, 0x03, 0x29, 0xc0, 0xc0, 0x07, 0xbc, 0x24,
+    0x40, 0x3c, 0x20, 0x20, 0x1f, 0xfd, 0x60, 0x00, 0x0f, 0x28, 0x07, 0x8c, 0x03, 0xc3, 0xaa, 0x01,
+    0x56, 0x80, 0x4f, 0xe1, 0xc4, 0x60, 0x0a, 0x50, 0x41, 0xb0, 0x22, 0x78, 0x01, 0xd4, 0x14, 0x54,
+    0x01, 0x44, 0x76, 0xe0, 0x11, 0x94, 0x9e, 0x80, 0x65, 0x50, 0xa0, 0x06, 0xa0, 0x60, 0x0e, 0x60,
+    0xb0, 0x0c, 0xb0, 0x66, 0x00, 0x86, 0x87, 0xc0, 0x30, 0x00, 0x8d, 0xc4, 0x03, 0xdb, 0x56, 0x01,
+    0xd2, 0xb8, 0x88, 0x00, 0xd3, 0x63, 0xc8, 0x00, 0x6f, 0xff, 0x91, 0x62, 0x38, 0x41, 0x8d, 0xdf,
+    0x10, 0xc9, 0x00, 0x62, 0xa5, 0x60, 0x0e, 0xe1, 0xb0, 0x0e, 0x93, 0xd1, 0x00, 0xc8, 0xd0, 0x60,
+    0x18, 0x69, 0x1c, 0x03, 0xa8, 0x28, 0x03, 0x9d, 0x10, 0xce, 0xf8, 0xb8, 0x16, 0x23, 0x98, 0x00,
+    0x57, 0xb8, 0x04, 0xcc, 0xea, 0x40, 0x03, 0x60, 0xea, 0x02, 0xff, 0xf1, 0xa5, 0x54, 0x42, 0x42,
+    0xaa, 0x02, 0xb1, 0x00, 0x0d, 0xaa, 0x80, 0x2a, 0x0a, 0x00, 0x99, 0x28, 0x02, 0x29, 0x31, 0x55,
+    0x0b, 0x81, 0xd5, 0x4a, 0x00, 0x6f, 0xff, 0x91, 0x62, 0x38, 0x41, 0x8d, 0xdf, 0x10, 0xc9, 0x00,
+    0x62, 0xa5, 0x60, 0x0e, 0xe1, 0xb0, 0x0e, 0x93, 0xd1, 0x00, 0xc8, 0xd0, 0x60, 0x18, 0x69, 0x1c,
+    0x03, 0xa8, 0x28, 0x03, 0x9d, 0x10, 0xce, 0xf8, 0xb8, 0x16, 0x23, 0x9a, 0x7f, 0xfe, 0x40, 0x09,
+    0x34, 0x40, 0x3c, 0x26, 0x01, 0x80, 0x5f, 0xfe, 0x34, 0xaa, 0x88, 0x48, 0x55, 0x40, 0x56, 0x20,
+    0x01, 0xb5, 0x50, 0x05, 0x41, 0x40, 0x13, 0x25, 0x00, 0x45, 0x26, 0x2a, 0xa1, 0x70, 0x3a, 0xa9,
+    0x55, 0xff, 0xc8, 0x00, 0x3d, 0x20, 0x0c, 0xe4, 0x20, 0x00, 0x6f, 0xff, 0x91, 0x62, 0x38, 0x41,
+    0x8d, 0xdf, 0x10, 0xc9, 0x00, 0x62, 0xa5, 0x60, 0x0e, 0xe1, 0xb0, 0x0e, 0x93, 0xd1, 0x00, 0xc8,
+    0xd0, 0x60, 0x18, 0x69, 0x1c, 0x03, 0xa8, 0x28, 0x03, 0x9d, 0x10, 0xce, 0xf8, 0xb8, 0x16, 0x23,
+    0x9a, 0x7f, 0xfe, 0x40, 0x04, 0xff, 0xc8, 0x01, 0xa3, 0x76, 0x40, 0x00, 0x5f, 0xfe, 0x34, 0xaa,
+    0x88, 0x48, 0x55, 0x40, 0x56, 0x20, 0x01, 0xb5, 0x50, 0x05, 0x41, 0x40, 0x13, 0x25, 0x00, 0x45,
+    0x26, 0x2a, 0xa1, 0x70, 0x3a, 0xa9, 0x55, 0xff, 0xc8, 0x0f, 0xff, 0x28, 0x01, 0xb7, 0x65, 0x00,
+    0x3f, 0x40, 0x0f, 0xfe, 0x59, 0x67, 0xd8, 0x80, 0x50, 0x8e, 0x96, 0x01, 0x4c, 0x41, 0x94, 0x02,
+    0x30, 0x07, 0x80, 0x7f, 0xf5, 0x8f, 0xd0, 0x00, 0xde, 0x01, 0x7f, 0xda, 0x01, 0xb7, 0x6f, 0x00,
+    0x00, 0x1e, 0x52, 0xe4, 0x03, 0x00, 0x1b, 0x8e, 0xa9, 0x69, 0x80, 0x22, 0xc0, 0x31, 0x30, 0x05,
+    0xca, 0x5e, 0x81, 0x48, 0x36, 0xa0, 0x82, 0x68, 0x20, 0x1f, 0xfc, 0x82, 0x22, 0x08, 0x02, 0x8a,
+    0xd4, 0x00, 0xd3, 0xcc, 0x01, 0xf1, 0x27, 0xc0, 0x07, 0xff, 0x18, 0x93, 0xe0, 0x03, 0x5e, 0x00,
+    0x3c, 0x54, 0x01, 0xf1, 0xa6, 0x00, 0xc0, 0x40, 0x30, 0xc4, 0x04, 0x04, 0x3c, 0x04, 0x04, 0x22,
+    0x61, 0x0c, 0xa0, 0x62, 0x00, 0x11, 0x22, 0x50, 0x34, 0xd0, 0x06, 0x9e, 0x28, 0x24, 0x82, 0x00,
+    0x10, 0x17, 0x03, 0x14, 0x88, 0x01, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x3f, 0x58, 0x07, 0x47,
+    0xba, 0x00, 0x68, 0xf7, 0x40, 0x0c, 0xfd, 0x60, 0x15, 0x68, 0x04, 0xfe, 0x1c, 0x46, 0x00, 0xa5,
+    0x04, 0x1b, 0x02, 0x27, 0x80, 0x1d, 0x41, 0x45, 0x40, 0x14, 0x47, 0x6e, 0x01, 0x19, 0x49, 0xe8,
+    0x06, 0x55, 0x0a, 0x00, 0x6a, 0x06, 0x00, 0xe6, 0x0b, 0x00, 0xcb, 0x06, 0x60, 0x08, 0x68, 0x7c,
+    0x03, 0x00, 0x00, 0xb1, 0x00, 0x3a, 0x7c, 0x03, 0xa7, 0xc0, 0x3b, 0x10, 0x02, 0x3c, 0xfe, 0x70,
+    0x1d, 0x7a, 0x68, 0x53, 0x6a, 0x58, 0x1d, 0x2a, 0x6a, 0xd1, 0x11, 0x6d, 0x14, 0x90, 0x28, 0x6c,
+    0x21, 0x81, 0x03, 0xa5, 0x08, 0x2b, 0xcd, 0x91, 0x00, 0x0a, 0xc0, 0x01, 0xb0, 0x02, 0x68, 0x01,
+    0x1f, 0x62, 0xed, 0x04, 0x1a, 0x60, 0x1f, 0xfd, 0x40, 0x00, 0x84, 0x00, 0x5b, 0xd4, 0x10, 0x53,
+    0x2f, 0x50, 0x96, 0xd2, 0x26, 0x29, 0x00, 0x98, 0x07, 0xff, 0x4c, 0x01, 0xbf, 0xfd, 0x80, 0x0a,
+    0x58, 0x98, 0x06, 0x00, 0x23, 0x3b, 0x78, 0x40, 0x05, 0xe0, 0x6f, 0x04, 0x02, 0x01, 0x79, 0x38,
+    0x07, 0x09, 0x96, 0xa8, 0x06, 0x1c, 0xc2, 0x52, 0x00, 0x63, 0x34, 0x8e, 0x80, 0x7c, 0x20, 0x18,
+    0x99, 0x98, 0x14, 0x01, 0x2c, 0xc8, 0x2c, 0xc0, 0x00, 0x57, 0x7f, 0x80, 0x27, 0x58, 0xaa, 0x00,
+    0x73, 0xaa, 0x80, 0x27, 0x1e, 0xb4, 0x00, 0xa8, 0x54, 0x2d, 0xc1, 0x16, 0xea, 0xde, 0x04, 0xc1,
+    0x00, 0x14, 0x0b, 0xe0, 0x1f, 0x68, 0x10, 0x01, 0x01, 0x94, 0xbd, 0x9e, 0x54, 0x83, 0xda, 0x64,
+    0xd4, 0x00, 0x00, 0x97, 0xf0, 0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5,
+    0x80, 0x77, 0x11, 0x34, 0xc8, 0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d,
+    0x0a, 0xee, 0x11, 0x90, 0x0a, 0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80,
+    0x65, 0x32, 0xbe, 0x00, 0xe8, 0xf2, 0x00, 0xd8, 0xc0, 0x1f, 0x88, 0x40, 0x30, 0x03, 0xcf, 0xe7,
+    0x01, 0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49, 0x02, 0x86,
+    0xc2, 0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x01, 0x1d, 0xf1, 0xb2, 0x00, 0x1d, 0x50,
+    0x0e, 0x33, 0x00, 0x00, 0x00, 0x9b, 0xe4, 0x03, 0xe6, 0x80, 0x0f, 0xe6, 0x90, 0x0f, 0x97, 0xb0,
+    0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5, 0x80, 0x77, 0x11, 0x34, 0xc8,
+    0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d, 0x0a, 0xee, 0x11, 0x90, 0x0a,
+    0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80, 0x65, 0x32, 0x00, 0x00, 0x3f,
+    0xc0, 0x06, 0x77, 0x00, 0x7a, 0xa0, 0x02, 0x3c, 0xde, 0x70, 0x1d, 0x7a, 0x68, 0x53, 0x6a, 0x58,
+    0x1d, 0x2a, 0x6a, 0xd1, 0x11, 0x6d, 0x14, 0x90, 0x28, 0x6c, 0x21, 0x81, 0x03, 0xa5, 0x08, 0x2b,
+    0xcd, 0x91, 0x00, 0x00, 0xff, 0xe2, 0x5d, 0x00, 0x7c, 0x4f, 0x40, 0x1c, 0x9d, 0x18, 0x01, 0xc5,
+    0x54, 0x68, 0x00, 0xe2, 0xf4, 0xc9, 0x00, 0xf2, 0x7e, 0x08, 0x07, 0xb8, 0x0c, 0x80, 0x3c, 0x90,
+    0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc, 0x44, 0xd3, 0x20, 0x08, 0x51, 0x41, 0xc1, 0x40, 0x27,
+    0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8, 0x46, 0x40, 0x28, 0xb7, 0x74, 0x82, 0x83, 0x84, 0xa2,
+    0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8, 0x00, 0xff, 0xe0, 0x64, 0x80, 0x63, 0x29, 0x00, 0x2f,
+    0xcf, 0x00, 0x0a, 0xf1, 0xd8, 0x00, 0x7e, 0x78, 0x80, 0x02, 0xdf, 0xf2, 0x80, 0xeb, 0xd3, 0x42,
+    0x9b, 0x52, 0xc0, 0xe9, 0x53, 0x56, 0x88, 0x8b, 0x68, 0xa4, 0x81, 0x43, 0x61, 0x0c, 0x08, 0x1d,
+    0x28, 0x41, 0x5e, 0x6c, 0x88, 0x00, 0x00, 0xe1, 0x00, 0xfe, 0xc6, 0x00, 0xfd, 0xd4, 0x01, 0xe4,
+    0xe9, 0xc0, 0x0e, 0x2a, 0xa3, 0x40, 0x07, 0x17, 0xa6, 0x48, 0x07, 0x93, 0xf0, 0x40, 0x3d, 0xc0,
+    0x64, 0x01, 0xe4, 0x80, 0x50, 0x0e, 0x50, 0x54, 0xb0, 0x0e, 0xe2, 0x26, 0x99, 0x00, 0x42, 0x8a,
+    0x0e, 0x0a, 0x01, 0x38, 0x68, 0x81, 0x58, 0x05, 0xa1, 0x5d, 0xc2, 0x32, 0x01, 0x45, 0xbb, 0xa4,
+    0x14, 0x1c, 0x25, 0x12, 0x62, 0xb0, 0xd1, 0x30, 0x0c, 0xa6, 0x40, 0x00, 0xc2, 0x01, 0xc3, 0xea,
+    0x01, 0x86, 0xe4, 0x02, 0x5f, 0xf6, 0x00, 0x0a, 0xf1, 0xd8, 0x00, 0x7e, 0x78, 0x80, 0x02, 0xdf,
+    0xf2, 0x80, 0xeb, 0xd3, 0x42, 0x9b, 0x52, 0xc0, 0xe9, 0x53, 0x56, 0x88, 0x8b, 0x68, 0xa4, 0x81,
+    0x43, 0x61, 0x0c, 0x08, 0x1d, 0x28, 0x41, 0x5e, 0x6c, 0x88, 0x00, 0x00, 0xef, 0xd0, 0x0f, 0xdc,
+    0x60, 0x1e, 0x3d, 0x8e, 0x00, 0xe1, 0xd9, 0x57, 0x00, 0xe1, 0xf4, 0xc6, 0x00, 0xf2, 0x7e, 0x08,
+    0x07, 0xb8, 0x0c, 0x80, 0x3c, 0x90, 0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc, 0x44, 0xd3, 0x20,
+    0x08, 0x51, 0x41, 0xc1, 0x40, 0x27, 0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8, 0x46, 0x40, 0x28,
+    0xb7, 0x74, 0x82, 0x83, 0x84, 0xa2, 0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8, 0x00, 0x87, 0xf0,
+    0x03, 0x0e, 0x88, 0x04, 0xbf, 0x3a, 0x00, 0x2b, 0xc6, 0x60, 0x00, 0xfc, 0xf1, 0x00, 0x05, 0xbf,
+    0xe5, 0x01, 0xd7, 0xa6, 0x85, 0x36, 0xa5, 0x81, 0xd2, 0xa6, 0xad, 0x11, 0x16, 0xd1, 0x49, 0x02,
+    0x86, 0xc2, 0x18, 0x10, 0x3a, 0x50, 0x82, 0xbc, 0xd9, 0x10, 0x00, 0x00, 0x16, 0x77, 0xc0, 0x07,
+    0x16, 0x4d, 0xc0, 0x07, 0xa6, 0xe8, 0x40, 0x38, 0xd3, 0x5e, 0x00, 0x38, 0xf4, 0x66, 0x40, 0x1e,
+    0x5f, 0xc0, 0x0f, 0xb8, 0x0c, 0x80, 0x3c, 0x90, 0x0a, 0x01, 0xca, 0x0a, 0x96, 0x01, 0xdc, 0x44,
+    0xd3, 0x20, 0x08, 0x51, 0x41, 0xc1, 0x40, 0x27, 0x0d, 0x10, 0x2b, 0x00, 0xb4, 0x2b, 0xb8, 0x46,
+    0x40, 0x28, 0xb7, 0x74, 0x82, 0x83, 0x84, 0xa2, 0x4c, 0x56, 0x1a, 0x26, 0x01, 0x94, 0xc8, 0x01,
+    0xea, 0x4a, 0x00, 0x23, 0xe5, 0x78, 0x01, 0x72, 0x51, 0x40, 0x05, 0x78, 0xec, 0x00, 0x3f, 0x3c,
+    0x40, 0x01, 0x6f, 0xf9, 0x40, 0x75, 0xe9, 0xa1, 0x4d, 0xa9, 0x60, 0x74, 0xa9, 0xab, 0x44, 0x45,
+    0xb4, 0x52, 0x40, 0xa1, 0xb0, 0x86, 0x04, 0x0e, 0x94, 0x20, 0xaf, 0x36, 0x44, 0x00, 0x00, 0x85,
+    0xd0, 0x03, 0xea, 0xda, 0x30, 0x0e, 0x2c, 0xaa, 0x28, 0x07, 0x13, 0x82, 0x30, 0x07, 0x97, 0xf0,
+    0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72, 0x82, 0xa5, 0x80, 0x77, 0x11, 0x34, 0xc8,
+    0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a, 0xc0, 0x2d, 0x0a, 0xee, 0x11, 0x90, 0x0a,
+    0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86, 0x89, 0x80, 0x65, 0x32, 0xbe, 0x00, 0xe8,
+    0xf2, 0x00, 0xd8, 0xc0, 0x1f, 0x88, 0x40, 0x30, 0x00, 0x37, 0xd0, 0x04, 0x71, 0x8c, 0xe0, 0x03,
+    0xe3, 0xc7, 0x00, 0x1e, 0x7f, 0x38, 0x0e, 0xbd, 0x34, 0x29, 0xb5, 0x2c, 0x0e, 0x95, 0x35, 0x68,
+    0x88, 0xb6, 0x8a, 0x48, 0x14, 0x36, 0x10, 0xc0, 0x81, 0xd2, 0x84, 0x15, 0xe6, 0xc8, 0x80, 0x08,
+    0xef, 0x8d, 0x90, 0x00, 0xea, 0x80, 0x71, 0x98, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x17, 0x98, 0x07,
+    0xd5, 0x06, 0x01, 0xc7, 0x92, 0x34, 0x01, 0xc6, 0x9f, 0x50, 0x01, 0xe8, 0xec, 0x20, 0x0f, 0x2f,
+    0xe0, 0x07, 0xdc, 0x06, 0x40, 0x1e, 0x48, 0x05, 0x00, 0xe5, 0x05, 0x4b, 0x00, 0xee, 0x22, 0x69,
+    0x90, 0x04, 0x28, 0xa0, 0xe0, 0xa0, 0x13, 0x86, 0x88, 0x15, 0x80, 0x5a, 0x15, 0xdc, 0x23, 0x20,
+    0x14, 0x5b, 0xba, 0x41, 0x41, 0xc2, 0x51, 0x26, 0x2b, 0x0d, 0x13, 0x00, 0xca, 0x64, 0x00, 0x00,
+    0xff, 0x1f, 0x90, 0x06, 0x98, 0x20, 0x02, 0xdd, 0x0d, 0x00, 0x14, 0x7e, 0xe0, 0x02, 0xaf, 0xd2,
+    0x00, 0x1e, 0x7f, 0x38, 0x0e, 0x3d, 0x34, 0x28, 0x45, 0x2c, 0x0e, 0x8a, 0xb5, 0x68, 0x88, 0xb6,
+    0xf6, 0x48, 0x14, 0x31, 0xd0, 0xc0, 0x81, 0xd2, 0x84, 0x15, 0xe6, 0xc8, 0x80, 0x00, 0x00, 0x84,
+    0x03, 0xfa, 0xa4, 0x03, 0xf5, 0x20, 0x80, 0x78, 0xf7, 0x1e, 0x80, 0x38, 0xd3, 0xea, 0x00, 0x3d,
+    0x1d, 0x84, 0x01, 0xe5, 0xfc, 0x00, 0xfb, 0x80, 0xc8, 0x03, 0xc9, 0x00, 0xa0, 0x1c, 0xa0, 0xa9,
+    0x60, 0x1d, 0xc4, 0x4d, 0x32, 0x00, 0x85, 0x14, 0x1c, 0x14, 0x02, 0x70, 0xd1, 0x02, 0xb0, 0x0b,
+    0x42, 0xbb, 0x84, 0x64, 0x02, 0x8b, 0x77, 0x48, 0x28, 0x38, 0x4a, 0x24, 0xc5, 0x61, 0xa2, 0x60,
+    0x19, 0x4c, 0x80, 0x00, 0x08, 0x07, 0xb6, 0x00, 0x3b, 0x98, 0x03, 0x2c, 0xf3, 0x50, 0x01, 0x47,
+    0xee, 0x00, 0x2a, 0xfd, 0x20, 0x01, 0xe7, 0xf3, 0x80, 0xe3, 0xd3, 0x42, 0x84, 0x52, 0xc0, 0xe8,
+    0xab, 0x56, 0x88, 0x8b, 0x6f, 0x64, 0x81, 0x43, 0x1d, 0x0c, 0x08, 0x1d, 0x28, 0x41, 0x5e, 0x6c,
+    0x88, 0x00, 0x00, 0x9b, 0xa0, 0x03, 0xe6, 0x90, 0x0f, 0x8f, 0x17, 0xa8, 0x03, 0x8d, 0x32, 0xa0,
+    0x03, 0xd1, 0xd8, 0x40, 0x1e, 0x5f, 0xc0, 0x0f, 0xb8, 0x0c, 0x80, 0x3c, 0x90, 0x0a, 0x01, 0xca,
+    0x0a, 0x96, 0x01, 0xdc, 0x44, 0xd3, 0x20, 0x08, 0x51, 0x41, 0xc1, 0x40, 0x27, 0x0d, 0x10, 0x2b,
+    0x00, 0xb4, 0x2b, 0xb8, 0x46, 0x40, 0x28, 0xb7, 0x74, 0x82, 0x83, 0x84, 0xa2, 0x4c, 0x56, 0x1a,
+    0x26, 0x01, 0x94, 0xc8, 0x00, 0x3f, 0x38, 0x06, 0x76, 0x00, 0xcb, 0x72, 0x34, 0x00, 0x51, 0xeb,
+    0x80, 0x0a, 0xbf, 0x48, 0x00, 0x79, 0xfc, 0xe0, 0x38, 0xf4, 0xd0, 0xa1, 0x14, 0xb0, 0x3a, 0x2a,
+    0xd5, 0xa2, 0x22, 0xdb, 0xd9, 0x20, 0x50, 0xc7, 0x43, 0x02, 0x07, 0x4a, 0x10, 0x57, 0x9b, 0x22,
+    0x00, 0x00, 0x16, 0x77, 0x20, 0x03, 0xd1, 0xdf, 0xa0, 0x1e, 0x91, 0x9f, 0x00, 0xe2, 0xae, 0x4b,
+    0x00, 0xf3, 0xfe, 0x08, 0x07, 0x97, 0xf0, 0x03, 0xee, 0x03, 0x20, 0x0f, 0x24, 0x02, 0x80, 0x72,
+    0x82, 0xa5, 0x80, 0x77, 0x11, 0x34, 0xc8, 0x02, 0x14, 0x50, 0x70, 0x50, 0x09, 0xc3, 0x44, 0x0a,
+    0xc0, 0x2d, 0x0a, 0xee, 0x11, 0x90, 0x0a, 0x2d, 0xdd, 0x20, 0xa0, 0xe1, 0x28, 0x93, 0x15, 0x86,
+    0x89, 0x80, 0x65, 0x32, 0x00, 0x01, 0xda, 0x4b, 0x00, 0x23, 0xe5, 0x70, 0x04, 0x2d, 0x1e, 0x00,
+    0x51, 0xfb, 0x80, 0x0a, 0xbf, 0x48, 0x00, 0x79, 0xfc, 0xe0, 0x38, 0xf4, 0xd0, 0xa1, 0x14, 0xb0,
+    0x3a, 0x2a, 0xd5, 0xa2, 0x22, 0xda, 0xd9, 0x20, 0x50, 0xd7, 0x43, 0x02, 0x07, 0x4a, 0x10, 0x57,
+    0x9b, 0x22, 0x00, 0x00, 0x12, 0x80, 0xb0, 0x07, 0xac, 0x67, 0xc0, 0x38, 0xa3, 0x92, 0x00, 0x3c,
+    0xdf, 0x82, 0x01, 0xe5, 0xfc, 0x00, 0xfb, 0x80, 0xc8, 0x03, 0xc9, 0x00, 0xa0, 0x1c, 0xa0, 0xa9,
+    0x60, 0x1d, 0xc4, 0x4d, 0x32, 0x00, 0x85, 0x14, 0x1c, 0x14, 0x02, 0x70, 0xd1, 0x02, 0xb0, 0x0b,
+    0x42, 0xbb, 0x84, 0x64, 0x02, 0x8b, 0x77, 0x48, 0x28, 0x38, 0x4a, 0x24, 0xc5, 0x61, 0xa2, 0x60,
+    0x19, 0x4c, 0xaf, 0x80, 0x3a, 0x3c, 0x80, 0x36, 0x30, 0x07, 0xe2, 0x10, 0x0c, 0x00, 0x05, 0xb0,
+    0x6a, 0x00, 0x28, 0xfd, 0xc0, 0x05, 0x5f, 0xa4, 0x00, 0x3c, 0xfe, 0x70, 0x06, 0x85, 0x34, 0x29,
+    0x3e, 0xac, 0x0e, 0x95, 0xb5, 0x68, 0x88, 0xb6, 0x8a, 0x08, 0x14, 0x36, 0x14, 0xc0, 0x81, 0xd2,
+    0x84, 0x15, 0xe6, 0xc8, 0x80, 0x08, 0xef, 0x8d, 0x90, 0x00, 0xea, 0x80, 0x71, 0x98, 0x00, 0x00,
+    0x1f, 0xff, 0x60, 0x01, 0x22, 0x34, 0x80, 0x31, 0xdf, 0x28, 0x03, 0xc4, 0x70, 0x04, 0xfd, 0xd9,
+    0x80, 0x0d, 0x77, 0x9c, 0x01, 0xc8, 0x98, 0x40, 0x3f, 0xf8, 0xd8, 0xef, 0x94, 0x00, 0x91, 0x1a,
+    0x47, 0xff, 0xd8, 0x01, 0x2e, 0x88, 0x07, 0x19, 0xc0, 0x00, 0x01, 0xaf, 0xe8, 0x00, 0xb1, 0xaa,
+    0x5a, 0x01, 0x0b, 0x55, 0xe1, 0xc3, 0x03, 0xbf, 0xd2, 0x04, 0x00, 0xcc, 0xe2, 0xd0, 0x01, 0x99,
+    0xe8, 0x14, 0xb9, 0x99, 0x46, 0x00, 0xc6, 0x98, 0x7a, 0x00, 0x0d, 0xff, 0x48, 0x07, 0x63, 0x80,
+    0x78, 0x7c, 0x02, 0x00, 0x00, 0xb3, 0x90, 0x03, 0xb0, 0xdc, 0x03, 0xd8, 0x60, 0x01, 0xff, 0xbb,
+    0xfd, 0x80, 0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0, 0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7, 0x66,
+    0x00, 0x35, 0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff, 0x63, 0xbe, 0x50, 0x02, 0x44, 0x69, 0x00,
+    0x00, 0x2f, 0xd0, 0x07, 0x2d, 0x00, 0x7c, 0xf6, 0x01, 0x86, 0xb7, 0xe0, 0x02, 0xc6, 0xa9, 0x68,
+    0x04, 0x2d, 0x57, 0x87, 0x0c, 0x0e, 0xff, 0x48, 0x10, 0x03, 0x33, 0x8b, 0x40, 0x06, 0x67, 0xa0,
+    0x52, 0xe6, 0x65, 0x18, 0x03, 0x1a, 0x61, 0xe8, 0x00, 0x00, 0x26, 0xb4, 0x28, 0x05, 0xd7, 0x8c,
+    0x80, 0x15, 0x35, 0x70, 0x80, 0xff, 0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9, 0x40, 0x3f,
+    0xde, 0x23, 0x80, 0x27, 0xee, 0xcc, 0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01, 0xfe, 0xc7,
+    0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00, 0x00, 0x65, 0x8e, 0x80, 0x46, 0x1d, 0xc5, 0x00, 0x8f, 0x57,
+    0xe0, 0x02, 0x1b, 0xfe, 0x80, 0x0b, 0x1a, 0xa5, 0xa0, 0x10, 0xb5, 0x5e, 0x1c, 0x30, 0x3b, 0xfd,
+    0x20, 0x40, 0x0c, 0xce, 0x2d, 0x00, 0x19, 0x9e, 0x81, 0x4b, 0x99, 0x94, 0x60, 0x0c, 0x69, 0x87,
+    0xa0, 0x00, 0x00, 0xff, 0xe0, 0x8f, 0xa0, 0x07, 0x33, 0xa0, 0x05, 0x5c, 0x50, 0x01, 0x3b, 0x6d,
+    0x90, 0x04, 0xd8, 0x7c, 0x40, 0x3f, 0xdf, 0xfb, 0x00, 0x09, 0x11, 0xa4, 0x01, 0x8e, 0xf9, 0x40,
+    0x3f, 0xde, 0x23, 0x80, 0x27, 0xee, 0xcc, 0x00, 0x6b, 0xbc, 0xe0, 0x0e, 0x44, 0xc2, 0x01, 0xfe,
+    0xc7, 0x7c, 0xa0, 0x04, 0x88, 0xd2, 0x00, 0x00, 0xf0, 0x80, 0x7a, 0x68, 0x03, 0x85, 0xe4, 0x02,
+    0x3f, 0xde, 0x20, 0x00, 0xed, 0x3c, 0x80, 0x43, 0x8b, 0x76, 0x00, 0x86, 0x3f, 0xa8, 0x02, 0xc6,
+    0xa9, 0x68, 0x04, 0x2d, 0x57, 0x87, 0x0c, 0x0e, 0xff, 0x48, 0x10, 0x03, 0x33, 0x8b, 0x40, 0x06,
+    0x67, 0xa0, 0x52, 0xe6, 0x65, 0x18, 0x03, 0x1a, 0x61, 0xe8, 0x00, 0x00, 0xff, 0xe0, 0x27, 0x88,
+    0x07, 0x23, 0xb0, 0x06, 0xae, 0xd7, 0x00, 0x9d, 0xb6, 0xc8, 0x02, 0x6c, 0x3e, 0x20, 0x1f, 0xef,
+    0xfd, 0x80, 0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0, 0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7, 0x66,
+    0x00, 0x35, 0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff, 0x63, 0xbe, 0x50, 0x02, 0x44, 0x69, 0x00,
+    0x00, 0xc2, 0x01, 0xf6, 0x38, 0x07, 0xba, 0x40, 0x31, 0xff, 0xb8, 0x02, 0x1d, 0xa7, 0x90, 0x08,
+    0x71, 0x6e, 0xc0, 0x10, 0xc7, 0xf5, 0x00, 0x58, 0xd5, 0x2d, 0x00, 0x85, 0xaa, 0xf0, 0xe1, 0x81,
+    0xdf, 0xe9, 0x02, 0x00, 0x66, 0x71, 0x68, 0x00, 0xcc, 0xf4, 0x0a, 0x5c, 0xcc, 0xa3, 0x00, 0x63,
+    0x4c, 0x3d, 0x00, 0x00, 0xcd, 0xce, 0x01, 0xcd, 0x3e, 0x01, 0xa3, 0x4a, 0x00, 0x26, 0x59, 0xb2,
+    0x00, 0x9f, 0x53, 0xc8, 0x07, 0xfb, 0xfd, 0xdf, 0x80, 0x04, 0x88, 0xd2, 0x00, 0xc7, 0x7c, 0xa0,
+    0x1f, 0xef, 0x11, 0xc0, 0x13, 0xf7, 0x66, 0x00, 0x35, 0xde, 0x70, 0x07, 0x22, 0x61, 0x00, 0xff,
+    0x63, 0xbe, 0x50, 0x02, 0x44, 0x69, 0x00, 0x00, 0xdd, 0xa2, 0x01, 0xde, 0x62, 0x01, 0x1f, 0xe7,
+    0x80, 0x43, 0xb4, 0xd0, 0x01, 0x0e, 0x2d, 0xd8, 0x02, 0x18, 0xfe, 0xa0, 0x0b, 0x1a, 0xa5, 0xa0,
+    0x10, 0xb5, 0x5e, 0x1c, 0x30, 0x3b, 0xfd, 0x20, 0x40, 0x0c, 0xce, 0x2d, 0x00, 0x19, 0x9e, 0x81,
+    0x4b, 0x99, 0x94, 0x60, 0x0c, 0x69, 0x87, 0xa0, 0x00, 0x00, 0x37, 0x7e, 0x98, 0x04, 0xdb, 0x18,
+    0x60, 0x10, 0xed, 0xd8, 0x03, 0x4b, 0xeb, 0xa0, 0x05, 0x12, 0x3a, 0x80, 0x3f, 0xfe, 0xc0, 0x02,
+    0x44, 0x69, 0x00, 0x63, 0xbe, 0x50, 0x0f, 0xf7, 0x88, 0xe0, 0x09, 0xfb, 0xb3, 0x00, 0x1a, 0xef,
+    0x38, 0x03, 0x91, 0x30, 0x80, 0x7f, 0xb1, 0xdf, 0x28, 0x01, 0x22, 0x34, 0x80, 0x01, 0xef, 0xf5,
+    0x00, 0x43, 0xdf, 0xea, 0x00, 0xc7, 0xf8, 0x01, 0x87, 0x69, 0xe4, 0x02, 0x1c, 0x5b, 0xb0, 0x04,
+    0x31, 0xfd, 0x40, 0x16, 0x35, 0x4b, 0x40, 0x21, 0x6a, 0xbc, 0x38, 0x60, 0x77, 0xfa, 0x40, 0x80,
+    0x19, 0x9c, 0x5a, 0x00, 0x33, 0x3d, 0x02, 0x97, 0x33, 0x28, 0xc0, 0x18, 0xd3, 0x0f, 0x40, 0x00,
+    0x00, 0x91, 0xc4, 0x03, 0x15, 0x6e, 0x80, 0x33, 0xd5, 0x2c, 0xc0, 0x25, 0x40, 0x73, 0x01, 0xff,
+    0xf6, 0x00, 0x12, 0x23, 0x48, 0x03, 0x1d, 0xf2, 0x80, 0x3c, 0x47, 0x00, 0x4f, 0xdd, 0x98, 0x00,
+    0xd7, 0x79, 0xc0, 0x1c, 0x89, 0x84, 0x03, 0xff, 0x8d, 0x8e, 0xf9, 0x40, 0x09, 0x11, 0xa4, 0x7f,
+    0xfd, 0x80, 0x12, 0xe8, 0x80, 0x71, 0x9c, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x06, 0x1d, 0xb6, 0xa0,
+    0x08, 0x79, 0x2a, 0x80, 0x10, 0xd7, 0xf4, 0x00, 0x58, 0xd5, 0x2d, 0x00, 0x85, 0xaa, 0xf0, 0xe1,
+    0x81, 0xdf, 0xe9, 0x02, 0x00, 0x66, 0x71, 0x68, 0x00, 0xcc, 0xf4, 0x0a, 0x5c, 0xcc, 0xa3, 0x00,
+    0x63, 0x4c, 0x3d, 0x00, 0x06, 0xff, 0xa4, 0x03, 0xb1, 0xc0, 0x3c, 0x3e, 0x01, 0x00, 0x7f, 0x87,
+    0x70, 0x02, 0x60, 0x79, 0xc0, 0x3f, 0xfa, 0x40, 0x9f, 0x69, 0x43, 0x0a, 0x53, 0xe4, 0x00, 0xff,
+    0xe4, 0x80, 0x1f, 0x70, 0x0f, 0xfe, 0x90, 0xfb, 0x8e, 0xa8, 0x19, 0x80, 0x3f, 0x41, 0x27, 0x2d,
+    0x33, 0x7a, 0x00, 0x7f, 0xf2, 0x4f, 0xd0, 0xb4, 0xc4, 0x9c, 0x00, 0x0c, 0xf7, 0xe2, 0x80, 0x45,
+    0xec, 0x8e, 0x35, 0x00, 0x09, 0x0d, 0xa8, 0xd6, 0x73, 0x24, 0x92, 0x00, 0xa4, 0x29, 0xc1, 0x40,
+    0x39, 0x10, 0x60, 0x60, 0x1c, 0x46, 0x60, 0x30, 0x0e, 0x23, 0x70, 0x50, 0x0e, 0x44, 0x12, 0x49,
+    0x00, 0x52, 0x14, 0x12, 0x1b, 0x31, 0x8c, 0xe6, 0x05, 0xec, 0xee, 0x0a, 0x80, 0x08, 0x67, 0xbf,
+    0x14, 0x03, 0xcd, 0x80, 0x1f, 0x84, 0x80, 0x30, 0x01, 0xaf, 0xe9, 0x00, 0xb5, 0x22, 0x5a, 0x81,
+    0x0e, 0x9d, 0xd2, 0xa4, 0x60, 0x80, 0x04, 0x07, 0xf0, 0x0f, 0xb0, 0x0c, 0x00, 0x80, 0xe8, 0x5a,
+    0xcf, 0x2a, 0x41, 0x89, 0x32, 0x6a, 0x00, 0x0d, 0x7f, 0x48, 0x07, 0x5c, 0x00, 0x79, 0xc8, 0x02,
+    0x00, 0x00, 0xdd, 0xc2, 0x00, 0xfb, 0x80, 0x3f, 0xd8, 0x40, 0x1c, 0x33, 0xdb, 0x8a, 0x01, 0x17,
+    0xb2, 0x38, 0xd4, 0x00, 0x24, 0x36, 0xa3, 0x59, 0xcc, 0x92, 0x48, 0x02, 0x90, 0xa7, 0x05, 0x00,
+    0xe4, 0x41, 0x81, 0x80, 0x71, 0x19, 0x80, 0xc0, 0x38, 0x8d, 0xc1, 0x40, 0x39, 0x10, 0x49, 0x24,
+    0x01, 0x48, 0x50, 0x48, 0x6c, 0xc6, 0x33, 0x98, 0x17, 0xb3, 0xb8, 0x2a, 0x00, 0x00, 0x1f, 0xe0,
+    0x07, 0x1d, 0x80, 0x7c, 0xba, 0x01, 0x86, 0xbb, 0xe4, 0x02, 0xd4, 0x89, 0x6a, 0x04, 0x3a, 0x77,
+    0x4a, 0x91, 0x82, 0x00, 0x10, 0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03, 0xa1, 0x6b, 0x3c, 0xa9,
+    0x06, 0x24, 0xc9, 0xa8, 0x00, 0x00, 0xf1, 0x79, 0x80, 0x7d, 0x0e, 0x60, 0x1c, 0xd7, 0x10, 0x00,
+    0xe2, 0x97, 0xb0, 0x0f, 0x4b, 0xf3, 0x18, 0x07, 0x5c, 0x17, 0x98, 0x06, 0x19, 0xef, 0xc5, 0x00,
+    0x8b, 0xd9, 0x1c, 0x6a, 0x00, 0x12, 0x1b, 0x51, 0xac, 0xe6, 0x49, 0x24, 0x01, 0x48, 0x53, 0x82,
+    0x80, 0x72, 0x20, 0xc0, 0xc0, 0x38, 0x8c, 0xc0, 0x60, 0x1c, 0x46, 0xe0, 0xa0, 0x1c, 0x88, 0x24,
+    0x92, 0x00, 0xa4, 0x28, 0x24, 0x36, 0x63, 0x19, 0xcc, 0x0b, 0xd9, 0xdc, 0x15, 0x00, 0x00, 0x00,
+    0xf0, 0x80, 0x7a, 0x30, 0x03, 0xcd, 0xc0, 0x11, 0x76, 0xf1, 0x80, 0x5f, 0x09, 0x40, 0x1b, 0xda,
+    0x60, 0x02, 0x18, 0xfe, 0xb0, 0x0b, 0x52, 0x25, 0xa8, 0x10, 0xe9, 0xdd, 0x2a, 0x46, 0x08, 0x00,
+    0x40, 0x7f, 0x00, 0xfb, 0x00, 0xc0, 0x08, 0x0e, 0x85, 0xac, 0xf2, 0xa4, 0x18, 0x93, 0x26, 0xa0,
+    0x00, 0x00, 0xe7, 0xd0, 0x0f, 0xce, 0x2a, 0x01, 0xe6, 0xbd, 0x50, 0x0e, 0x29, 0x78, 0x00, 0xf4,
+    0xbf, 0x31, 0x80, 0x75, 0xc1, 0x79, 0x80, 0x61, 0x9e, 0xfc, 0x50, 0x08, 0xbd, 0x91, 0xc6, 0xa0,
+    0x01, 0x21, 0xb5, 0x1a, 0xce, 0x64, 0x92, 0x40, 0x14, 0x85, 0x38, 0x28, 0x07, 0x22, 0x0c, 0x0c,
+    0x03, 0x88, 0xcc, 0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01, 0xc8, 0x82, 0x49, 0x20, 0x0a, 0x42, 0x82,
+    0x43, 0x66, 0x31, 0x9c, 0xc0, 0xbd, 0x9d, 0xc1, 0x50, 0x00, 0x00, 0xc2, 0x01, 0xf5, 0x48, 0x07,
+    0xa5, 0xc4, 0x02, 0x2e, 0xfe, 0x10, 0x0b, 0xe1, 0x28, 0x03, 0x7b, 0x4c, 0x00, 0x43, 0x1f, 0xd6,
+    0x01, 0x6a, 0x44, 0xb5, 0x02, 0x1d, 0x3b, 0xa5, 0x48, 0xc1, 0x00, 0x08, 0x0f, 0xe0, 0x1f, 0x60,
+    0x18, 0x01, 0x01, 0xd0, 0xb5, 0x9e, 0x54, 0x83, 0x12, 0x64, 0xd4, 0x00, 0x00, 0xe7, 0xe6, 0x00,
+    0xf9, 0xdc, 0x01, 0xf2, 0x3c, 0x30, 0x07, 0x0d, 0x52, 0x40, 0x3d, 0x6f, 0xee, 0x40, 0x1d, 0x52,
+    0x5e, 0x40, 0x18, 0x67, 0xbf, 0x14, 0x02, 0x2f, 0x64, 0x71, 0xa8, 0x00, 0x48, 0x6d, 0x46, 0xb3,
+    0x99, 0x24, 0x90, 0x05, 0x21, 0x4e, 0x0a, 0x01, 0xc8, 0x83, 0x03, 0x00, 0xe2, 0x33, 0x01, 0x80,
+    0x71, 0x1b, 0x82, 0x80, 0x72, 0x20, 0x92, 0x48, 0x02, 0x90, 0xa0, 0x90, 0xd9, 0x8c, 0x67, 0x30,
+    0x2f, 0x67, 0x70, 0x54, 0x00, 0x00, 0xd9, 0xc4, 0x01, 0xd8, 0x66, 0x00, 0x8b, 0xb9, 0xe2, 0x01,
+    0x7c, 0x3c, 0x00, 0x6f, 0x69, 0x80, 0x08, 0x63, 0xfa, 0xc0, 0x2d, 0x48, 0x96, 0xa0, 0x43, 0xa7,
+    0x74, 0xa9, 0x18, 0x20, 0x01, 0x01, 0xfc, 0x03, 0xec, 0x03, 0x00, 0x20, 0x3a, 0x16, 0xb3, 0xca,
+    0x90, 0x62, 0x4c, 0x9a, 0x80, 0x00, 0xa3, 0xbf, 0x48, 0x03, 0xa2, 0xa3, 0x48, 0x03, 0x86, 0xa8,
+    0xe0, 0x1e, 0xb7, 0xf8, 0x20, 0x0e, 0xa9, 0x2f, 0x20, 0x0c, 0x33, 0xdf, 0x8a, 0x01, 0x17, 0xb2,
+    0x38, 0xd4, 0x00, 0x24, 0x36, 0xa3, 0x59, 0xcc, 0x92, 0x48, 0x02, 0x90, 0xa7, 0x05, 0x00, 0xe4,
+    0x41, 0x81, 0x80, 0x71, 0x19, 0x80, 0xc0, 0x38, 0x8d, 0xc1, 0x40, 0x39, 0x10, 0x49, 0x24, 0x01,
+    0x48, 0x50, 0x48, 0x6c, 0xc6, 0x33, 0x98, 0x17, 0xb3, 0xb8, 0x2a, 0x00, 0x00, 0x6f, 0xfa, 0xc0,
+    0x36, 0xff, 0xac, 0x03, 0x17, 0x68, 0x07, 0x7c, 0x25, 0x00, 0x6f, 0x69, 0x80, 0x08, 0x63, 0xfa,
+    0xc0, 0x2d, 0x48, 0x96, 0xa0, 0x43, 0xa7, 0x74, 0xa9, 0x18, 0x20, 0x01, 0x01, 0xfc, 0x03, 0xec,
+    0x03, 0x00, 0x20, 0x3a, 0x16, 0xb3, 0xca, 0x90, 0x62, 0x4c, 0x9a, 0x80, 0x00, 0xc8, 0xe0, 0x1f,
+    0x1d, 0x6d, 0x00, 0x79, 0x76, 0xb4, 0x80, 0x39, 0x8c, 0x1c, 0x80, 0x30, 0xcf, 0x7e, 0x28, 0x04,
+    0x5e, 0xc8, 0xe3, 0x50, 0x00, 0x90, 0xda, 0x8d, 0x67, 0x32, 0x49, 0x20, 0x0a, 0x42, 0x9c, 0x14,
+    0x03, 0x91, 0x06, 0x06, 0x01, 0xc4, 0x66, 0x03, 0x00, 0xe2, 0x37, 0x05, 0x00, 0xe4, 0x41, 0x24,
+    0x90, 0x05, 0x21, 0x41, 0x21, 0xb3, 0x18, 0xce, 0x60, 0x5e, 0xce, 0xe0, 0xa8, 0x00, 0x86, 0x7b,
+    0xf1, 0x40, 0x3c, 0xd8, 0x01, 0xf8, 0x48, 0x03, 0x00, 0x00, 0x17, 0x68, 0x80, 0x6f, 0xb5, 0xa0,
+    0x0d, 0xab, 0x16, 0x01, 0x0d, 0x7f, 0x48, 0x05, 0xa9, 0x12, 0xd4, 0x08, 0x74, 0xee, 0x95, 0x23,
+    0x04, 0x00, 0x20, 0x3f, 0x80, 0x7d, 0x80, 0x60, 0x04, 0x07, 0x42, 0xd6, 0x79, 0x52, 0x0c, 0x49,
+    0x93, 0x50, 0x00, 0x6b, 0xfa, 0x40, 0x3a, 0xe0, 0x03, 0xce, 0x40, 0x10, 0x00, 0xe1, 0x40, 0x0f,
+    0xd7, 0xe0, 0x1f, 0x12, 0xd0, 0x2d, 0x80, 0x62, 0xf1, 0x02, 0x50, 0x00, 0xcf, 0x7f, 0xd0, 0x40,
+    0x5e, 0xf3, 0x25, 0x03, 0xd0, 0x90, 0xf7, 0x6a, 0x73, 0x22, 0x24, 0x08, 0x05, 0x03, 0x4e, 0x08,
+    0x01, 0xc8, 0x83, 0x03, 0x00, 0xe3, 0x38, 0x0c, 0x03, 0x88, 0xdc, 0x14, 0x03, 0x91, 0x04, 0x92,
+    0x40, 0x14, 0x85, 0x04, 0x86, 0xd4, 0x6b, 0x39, 0x81, 0x7b, 0x23, 0x8d, 0x40, 0x00, 0x00, 0xdb,
+    0x00, 0x1c, 0xa1, 0x0e, 0x80, 0x13, 0xe0, 0x59, 0x80, 0xd6, 0xf7, 0x99, 0x83, 0x52, 0x20, 0x0c,
+    0x88, 0x3a, 0x77, 0x4b, 0x11, 0x82, 0x00, 0x10, 0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03, 0xa1,
+    0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9, 0xa8, 0x00, 0x00, 0x88, 0xc0, 0x3f, 0x36, 0x10, 0x07, 0xc8,
+    0xd6, 0x00, 0x5b, 0x00, 0xd3, 0x20, 0x01, 0x28, 0x00, 0x67, 0xbf, 0xe8, 0x20, 0x2f, 0x79, 0x92,
+    0x81, 0xe8, 0x48, 0x7b, 0xb5, 0x39, 0x91, 0x12, 0x04, 0x02, 0x81, 0xa7, 0x04, 0x00, 0xe4, 0x41,
+    0x81, 0x80, 0x71, 0x9c, 0x06, 0x01, 0xc4, 0x6e, 0x0a, 0x01, 0xc8, 0x82, 0x49, 0x20, 0x0a, 0x42,
+    0x82, 0x43, 0x6a, 0x35, 0x9c, 0xc0, 0xbd, 0x91, 0xc6, 0xa0, 0x00, 0x00, 0x5d, 0x80, 0x3d, 0x28,
+    0x40, 0xe8, 0x00, 0x2d, 0x30, 0xb3, 0x01, 0xad, 0xef, 0x33, 0x06, 0xa4, 0x40, 0x19, 0x10, 0x74,
+    0xee, 0x96, 0x23, 0x04, 0x00, 0x20, 0x3f, 0x80, 0x7d, 0x80, 0x60, 0x04, 0x07, 0x42, 0xd6, 0x79,
+    0x52, 0x0c, 0x49, 0x93, 0x50, 0x00, 0x00, 0xdd, 0xc2, 0x00, 0xfb, 0x80, 0x23, 0x70, 0x0e, 0xc2,
+    0x04, 0x90, 0x00, 0xcf, 0x6f, 0xfa, 0x0c, 0x0b, 0xde, 0x64, 0xa0, 0x78, 0x12, 0x1e, 0xed, 0x4e,
+    0x64, 0x44, 0x81, 0x00, 0xa0, 0x69, 0xc1, 0x00, 0x39, 0x10, 0x60, 0x60, 0x1c, 0x67, 0x01, 0x80,
+    0x71, 0x1b, 0x82, 0x80, 0x72, 0x20, 0x92, 0x48, 0x02, 0x90, 0xa0, 0x90, 0xda, 0x8d, 0x67, 0x30,
+    0x2f, 0x64, 0x71, 0xa8, 0x00, 0x00, 0x1f, 0xe0, 0x07, 0x1d, 0x80, 0x1d, 0x00, 0x25, 0xd0, 0xb3,
+    0x01, 0xae, 0xe7, 0x99, 0x83, 0x52, 0x20, 0x0c, 0x88, 0x3a, 0x77, 0x4b, 0x11, 0x82, 0x00, 0x10,
+    0x1f, 0xc0, 0x3e, 0xc0, 0x30, 0x02, 0x03, 0xa1, 0x6b, 0x3c, 0xa9, 0x06, 0x24, 0xc9, 0xa8, 0x00,
+    0x00, 0xa3, 0xbf, 0x48, 0x03, 0xa3, 0xfd, 0xa4, 0xda, 0x01, 0x84, 0x02, 0x13, 0x00, 0x0c, 0xf7,
+    0xfd, 0x04, 0x05, 0xef, 0x32, 0x50, 0x3d, 0x09, 0x0f, 0x76, 0xa7, 0x32, 0x22, 0x40, 0x80, 0x50,
+    0x34, 0xe0, 0x80, 0x1c, 0x88, 0x30, 0x30, 0x0e, 0x33, 0x80, 0xc0, 0x38, 0x8d, 0xc1, 0x40, 0x39,
+    0x10, 0x49, 0x24, 0x01, 0x48, 0x50, 0x48, 0x6d, 0x46, 0xb3, 0x98, 0x17, 0xb2, 0x38, 0xd4, 0x00,
+    0x00, 0x4e, 0x96, 0x80, 0x64, 0xef, 0xa7, 0x40, 0x06, 0x9e, 0xbd, 0x98, 0x0d, 0x7f, 0xc6, 0x60,
+    0xd4, 0x88, 0x03, 0x22, 0x0e, 0x9d, 0xd2, 0xc4, 0x60, 0x80, 0x04, 0x07, 0xf0, 0x0f, 0xb0, 0x0c,
+    0x00, 0x80, 0xe8, 0x5a, 0xcf, 0x2a, 0x41, 0x89, 0x32, 0x6a, 0x00, 0x00, 0xfc, 0xfc, 0x01, 0xff,
+    0xc0, 0x19, 0xef, 0xfa, 0x08, 0x0b, 0xde, 0x64, 0xa0, 0x7a, 0x12, 0x1e, 0xed, 0x4e, 0x64, 0x44,
+    0x81, 0x00, 0xa0, 0x69, 0xc1, 0x00, 0x39, 0x10, 0x60, 0x60, 0x1c, 0x67, 0x01, 0x80, 0x71, 0x1b,
+    0x82, 0x80, 0x72, 0x20, 0x92, 0x48, 0x02, 0x90, 0xa0, 0x90, 0xda, 0x8d, 0x67, 0x30, 0x2f, 0x64,
+    0x71, 0xa8, 0x00, 0x86, 0x7b, 0xf1, 0x40, 0x3c, 0xd8, 0x01, 0xf8, 0x48, 0x03, 0x00, 0x00, 0xf6,
+    0x40, 0x07, 0xde, 0x03, 0x5f, 0xf3, 0xb0, 0x6a, 0x44, 0x01, 0x85, 0x0e, 0x9d, 0xd2, 0x46, 0x60,
+    0x40, 0x02, 0x03, 0x78, 0x07, 0x87, 0x00, 0xc0, 0x08, 0x0a, 0x85, 0xac, 0xf2, 0xc2, 0x18, 0x93,
+    0x27, 0x90, 0x00, 0xd7, 0xf4, 0x00, 0x75, 0xc0, 0x07, 0x9c, 0x80, 0x20, 0x2f, 0x60, 0x0d, 0x1e,
+    0x01, 0xff, 0xea, 0x30, 0x10, 0x0c, 0x42, 0x22, 0xa0, 0x08, 0x55, 0x41, 0x05, 0xb1, 0x3e, 0x10,
+    0x0b, 0x62, 0xec, 0xb8, 0x60, 0x04, 0xcf, 0xf5, 0x98, 0x07, 0x5c, 0x80, 0x7c, 0xe6, 0x01, 0x00,
+    0x3f, 0x40, 0x03, 0x78, 0x07, 0xff, 0x34, 0x40, 0x30, 0x80, 0x62, 0x00, 0x70, 0x00, 0x89, 0x0f,
+    0x2c, 0x01, 0x71, 0x41, 0x40, 0x04, 0x79, 0xf6, 0xfe, 0x01, 0xaa, 0x40, 0x3c, 0x24, 0x01, 0x00,
+    0x00, 0x8f, 0xf0, 0x03, 0xc7, 0x60, 0x1f, 0x97, 0x00, 0x22, 0xf6, 0x01, 0x00, 0x47, 0x80, 0x7f,
+    0xfa, 0x8c, 0x04, 0x03, 0x10, 0x88, 0xa8, 0x02, 0x15, 0x50, 0x41, 0x6c, 0x4f, 0x84, 0x02, 0xd8,
+    0xbb, 0x2e, 0x18, 0x00, 0x1f, 0xe0, 0x07, 0x1d, 0xb8, 0x07, 0x96, 0xc0, 0x23, 0xf4, 0x10, 0x6f,
+    0x00, 0xff, 0xe6, 0x88, 0x06, 0x10, 0x0c, 0x40, 0x0e, 0x00, 0x11, 0x21, 0xe5, 0x80, 0x2e, 0x28,
+    0x28, 0x00, 0x00, 0x00, 0xe2, 0x30, 0x0f, 0xec, 0x50, 0x0f, 0xce, 0x4c, 0x07, 0xe4, 0x01, 0x9f,
+    0x00, 0x38, 0xbd, 0x80, 0x34, 0x61, 0x90, 0x07, 0xf6, 0x00, 0x7f, 0xfb, 0x0c, 0x04, 0x03, 0x10,
+    0x80, 0x04, 0xa8, 0x02, 0x15, 0x50, 0x05, 0x05, 0xb1, 0x3e, 0x10, 0x01, 0x2d, 0x8b, 0xb2, 0xe1,
+    0x80, 0x00, 0x00, 0xdb, 0x00, 0x1e, 0x50, 0x80, 0xd3, 0x00, 0x9f, 0x00, 0x04, 0x07, 0xe8, 0x42,
+    0xde, 0x24, 0x01, 0xf7, 0x08, 0x07, 0xff, 0x18, 0x40, 0x30, 0x80, 0x71, 0x00, 0x38, 0x02, 0x22,
+    0x43, 0xcb, 0x00, 0x6e, 0x28, 0x28, 0x00, 0x80, 0x00, 0x8c, 0x80, 0x3f, 0xab, 0xc0, 0x3f, 0xa4,
+    0x10, 0x00, 0x7e, 0x40, 0x1b, 0x50, 0x03, 0x8b, 0xd8, 0x03, 0x46, 0x19, 0x00, 0x7f, 0x60, 0x07,
+    0xff, 0xb0, 0xc0, 0x40, 0x31, 0x08, 0x00, 0x4a, 0x80, 0x21, 0x55, 0x00, 0x50, 0x5b, 0x13, 0xe1,
+    0x00, 0x12, 0xd8, 0xbb, 0x2e, 0x18, 0x00, 0x00, 0x5d, 0x80, 0x3e, 0x94, 0x20, 0x06, 0x98, 0x00,
+    0xb4, 0xc0, 0x04, 0x07, 0xe8, 0x42, 0xde, 0x24, 0x01, 0xf7, 0x08, 0x07, 0xff, 0x18, 0x40, 0x30,
+    0x80, 0x71, 0x00, 0x38, 0x02, 0x22, 0x43, 0xcb, 0x00, 0x6e, 0x28, 0x28, 0x00, 0x80, 0x00, 0x8f,
+    0xf0, 0x03, 0xf1, 0xdb, 0x00, 0x0f, 0xc8, 0x03, 0x25, 0x00, 0x71, 0x7b, 0x00, 0x68, 0xc3, 0x20,
+    0x0f, 0xec, 0x00, 0xff, 0xf6, 0x18, 0x08, 0x06, 0x21, 0x00, 0x09, 0x50, 0x04, 0x2a, 0xa0, 0x0a,
+    0x0b, 0x62, 0x7c, 0x20, 0x02, 0x5b, 0x17, 0x65, 0xc3, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x07, 0x8e,
+    0x98, 0x01, 0xa6, 0x01, 0x2d, 0x00, 0x08, 0x0f, 0xd0, 0x00, 0xde, 0x24, 0x01, 0xf7, 0x08, 0x07,
+    0xff, 0x18, 0x40, 0x30, 0x80, 0x71, 0x00, 0x38, 0x02, 0x22, 0x43, 0xcb, 0x00, 0x6e, 0x28, 0x28,
+    0x00, 0x80, 0x00, 0xb3, 0xbe, 0x80, 0x3e, 0xce, 0xfa, 0x03, 0xf2, 0x00, 0xff, 0x8b, 0xd8, 0x03,
+    0x46, 0x19, 0x00, 0x7f, 0x60, 0x07, 0xff, 0xb0, 0xc0, 0x40, 0x31, 0x08, 0x00, 0x4a, 0x80, 0x21,
+    0x55, 0x00, 0x50, 0x5b, 0x13, 0xe1, 0x00, 0x12, 0xd8, 0xbb, 0x2e, 0x18, 0x00, 0x00, 0x5e, 0x0f,
+    0x00, 0x61, 0x68, 0xf4, 0x0d, 0x30, 0x1c, 0x4e, 0xa0, 0x20, 0x3f, 0x50, 0x03, 0x78, 0x90, 0x07,
+    0xdc, 0x20, 0x1f, 0xfc, 0x61, 0x00, 0xc2, 0x01, 0xc4, 0x00, 0xe0, 0x08, 0x89, 0x0f, 0x2c, 0x01,
+    0xb8, 0xa0, 0xa0, 0x02, 0x00, 0x00, 0xfc, 0x7e, 0x40, 0x1f, 0xf1, 0x7b, 0x00, 0x68, 0xc3, 0x20,
+    0x0f, 0xec, 0x00, 0xff, 0xf6, 0x18, 0x08, 0x06, 0x21, 0x00, 0x09, 0x50, 0x04, 0x2a, 0xa0, 0x0a,
+    0x0b, 0x62, 0x7c, 0x20, 0x02, 0x5b, 0x17, 0x65, 0xc3, 0x00, 0xc9, 0x9f, 0xeb, 0x30, 0x0f, 0xae,
+    0x40, 0x3f, 0x9c, 0xc0, 0x38, 0x00, 0xfb, 0xd0, 0x03, 0xf3, 0x9f, 0xa0, 0x01, 0xbd, 0x0c, 0x03,
+    0xeb, 0x00, 0xff, 0xe3, 0x88, 0x06, 0x10, 0x0e, 0x20, 0x07, 0x00, 0x44, 0x48, 0x79, 0x60, 0x0d,
+    0xc5, 0x05, 0x00, 0x18, 0xf3, 0xed, 0xfc, 0x03, 0xaa, 0x40, 0x3e, 0x12, 0x00, 0xc0, 0x00, 0x0a,
+    0x00, 0x7e, 0x19, 0x80, 0x0f, 0xdc, 0xc0, 0x1f, 0x8f, 0x80, 0x3a, 0x7c, 0x80, 0x37, 0x68, 0x40,
+    0x48, 0x04, 0xe3, 0x20, 0x30, 0x88, 0x01, 0x84, 0x40, 0x01, 0xca, 0x02, 0x02, 0x40, 0x34, 0x1b,
+    0xb3, 0x08, 0x03, 0x29, 0xc0, 0xc0, 0x07, 0xbc, 0x24, 0x40, 0x3c, 0x20, 0x20, 0x1f, 0xfd, 0x60,
+    0x01, 0xe7, 0x00, 0xe1, 0xb9, 0x00, 0xf2, 0xe8, 0x06, 0xad, 0x03, 0x07, 0xf0, 0xe2, 0x30, 0x05,
+    0x28, 0x20, 0xd8, 0x11, 0x3c, 0x00, 0xea, 0x0a, 0x2a, 0x00, 0xa2, 0x3b, 0x70, 0x08, 0xca, 0x4f,
+    0x40, 0x32, 0xa8, 0x50, 0x03, 0x50, 0x30, 0x07, 0x30, 0x58, 0x06, 0x58, 0x33, 0x00, 0x43, 0x43,
+    0xe0, 0x18, 0x9f, 0x20, 0x0d, 0xda, 0x10, 0x12, 0x01, 0x38, 0xc8, 0x0c, 0x22, 0x00, 0x61, 0x10,
+    0x00, 0x72, 0x80, 0x80, 0x90, 0x0d, 0x06, 0xec, 0xc2, 0x00, 0xca, 0x70, 0x30, 0x01, 0xef, 0x09,
+    0x10, 0x0f, 0x08, 0x08, 0x07, 0xff, 0x64, 0xbd, 0x80, 0x3e, 0x1d, 0x40, 0x0f, 0x8c, 0xc2, 0x01,
+    0x80, 0xad, 0x00, 0x9f, 0xc3, 0x88, 0xc0, 0x14, 0xa0, 0x83, 0x60, 0x44, 0xf0, 0x03, 0xa8, 0x28,
+    0xa8, 0x02, 0x88, 0xed, 0xc0, 0x23, 0x2a, 0x3d, 0x00, 0xca, 0xc2, 0x80, 0x1a, 0x81, 0x80, 0x39,
+    0x82, 0xc0, 0x32, 0xc1, 0x9a, 0x4c, 0x06, 0x87, 0xc5, 0xd4, 0x00, 0x00, 0xa3, 0xdc, 0x03, 0xe8,
+    0x60, 0x0f, 0xe8, 0x70, 0x0d, 0x3e, 0x40, 0x20, 0x0e, 0xd0, 0x80, 0x90, 0x09, 0xc6, 0x40, 0x61,
+    0x10, 0x03, 0x08, 0x80, 0x03, 0x94, 0x04, 0x04, 0x80, 0x68, 0x37, 0x66, 0x10, 0x06, 0x53, 0x81,
+    0x80, 0x0f, 0x78, 0x48, 0x80, 0x78, 0x40, 0x40, 0x3f, 0xfa, 0xc0, 0x00, 0x3f, 0xc0, 0x07, 0x3b,
+    0x78, 0x07, 0xa1, 0xc0, 0x2a, 0xd0, 0x10, 0x7f, 0x0e, 0x23, 0x00, 0x52, 0x82, 0x0d, 0x81, 0x13,
+    0xc0, 0x0e, 0xa0, 0xa2, 0xa0, 0x0a, 0x23, 0xb7, 0x00, 0x8c, 0xa4, 0xf4, 0x03, 0x2a, 0x85, 0x00,
+    0x35, 0x03, 0x00, 0x73, 0x05, 0x80, 0x65, 0x83, 0x30, 0x04, 0x34, 0x3e, 0x01, 0x80, 0x00, 0x0e,
+    0xc2, 0xc8, 0x07, 0x3a, 0x05, 0xe8, 0x07, 0x34, 0xc7, 0x20, 0x05, 0x3e, 0x40, 0x1b, 0xb4, 0x20,
+    0x24, 0x02, 0x71, 0x90, 0x18, 0x44, 0x00, 0xc2, 0x20, 0x00, 0xe5, 0x01, 0x01, 0x20, 0x1a, 0x0d,
+    0xd9, 0x84, 0x01, 0x94, 0xe0, 0x60, 0x03, 0xde, 0x12, 0x20, 0x1e, 0x10, 0x10, 0x0f, 0xfe, 0xb0,
+    0x01, 0xe9, 0x4a, 0x00, 0x91, 0xfa, 0xfc, 0x02, 0x59, 0x7f, 0x50, 0x05, 0x68, 0x04, 0xfe, 0x1c,
+    0x46, 0x00, 0xa5, 0x04, 0x1b, 0x02, 0x27, 0x80, 0x1d, 0x41, 0x45, 0x40, 0x14, 0x47, 0x6e, 0x01,
+    0x19, 0x49, 0xe8, 0x06, 0x55, 0x0a, 0x00, 0x6a, 0x06, 0x00, 0xe6, 0x0b, 0x00, 0xcb, 0x06, 0x60,
+    0x08, 0x68, 0x7c, 0x03, 0x00, 0xf9, 0x1f, 0x70, 0x0f, 0xff, 0xf8, 0x07, 0xfc, 0xb2, 0x11, 0xd2,
+    0xee, 0x10, 0x37, 0x00, 0x0b, 0x44, 0x14, 0x04, 0xf3, 0x8f, 0x00, 0x55, 0x86, 0x38, 0x7c, 0x42,
+    0x42, 0x58, 0x32, 0x48, 0x80, 0xa2, 0x06, 0x20, 0x1f, 0xfe, 0xc0, 0x00, 0x9f, 0x08, 0x03, 0x64,
+    0x00, 0x74, 0x9d, 0x61, 0x00, 0x05, 0x95, 0x44, 0x01, 0x28, 0x70, 0x66, 0x00, 0x04, 0x0c, 0x10,
+    0x72, 0x02, 0x01, 0x32, 0xb0, 0x08, 0x08, 0x00, 0x80, 0x54, 0x10, 0x00, 0x40, 0x26, 0x91, 0x12,
+    0xb0, 0x02, 0x95, 0xd9, 0x92, 0x00, 0x00, 0xd0, 0x01, 0xc5, 0xae, 0x40, 0x1b, 0xcf, 0x48, 0x02,
+    0x92, 0xd2, 0x00, 0xcc, 0xa6, 0x40, 0x12, 0x07, 0x86, 0x58, 0x00, 0x81, 0xc2, 0x12, 0x40, 0x40,
+    0x26, 0x56, 0x01, 0x01, 0x00, 0x10, 0x0a, 0x02, 0x00, 0x08, 0x04, 0x92, 0x1e, 0x15, 0x80, 0x14,
+    0xb0, 0xcc, 0x90, 0x00, 0x0c, 0xe0, 0x0c, 0xfe, 0xa1, 0x22, 0xc0, 0x14, 0x92, 0x82, 0x94, 0x00,
+    0x14, 0x6c, 0x02, 0x81, 0x50, 0xe1, 0x60, 0x09, 0x4a, 0x49, 0x24, 0x03, 0x0d, 0x9f, 0x03, 0x80,
+    0x53, 0xd2, 0x06, 0xe0, 0x12, 0xb4, 0x30, 0x02, 0x40, 0x2d, 0x17, 0x80, 0x61, 0x00, 0xb0, 0x6a,
+    0x81, 0x60, 0x19, 0x21, 0x16, 0x88, 0x03, 0x00, 0x03, 0x82, 0x00, 0x24, 0x08, 0x0b, 0xd0, 0x02,
+    0x1c, 0x40, 0x88, 0xa0, 0x03, 0x50, 0x09, 0x48, 0x54, 0x3c, 0x02, 0xb0, 0x4c, 0x05, 0x00, 0x8c,
+    0x7d, 0x10, 0x01, 0x85, 0xd4, 0xb4, 0x02, 0xae, 0x60, 0x03, 0x80, 0x19, 0x61, 0x80, 0xc4, 0x01,
+    0xe4, 0xf6, 0x16, 0x01, 0x61, 0x4c, 0x81, 0x80, 0x25, 0x76, 0x5a, 0x10, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xea, 0xee, 0xb2, 0x2e, 0xee, 0x00,
+    0x11, 0xea, 0xee, 0xb2, 0x2e, 0xee, 0x00, 0x01, 0x1f, 0x81, 0xbb, 0xbe, 0x77, 0x5d, 0xfc, 0xa0,
+    0x11, 0xfb, 0xbb, 0xeb, 0xbf, 0x80, 0x11, 0xff, 0xe1, 0x77, 0x7f, 0xf0, 0xae, 0xff, 0xf8, 0x40,
+    0x11, 0xff, 0xe1, 0x77, 0x7f, 0xf0, 0xae, 0xff, 0xf8, 0x40, 0x7d, 0x3f, 0x10, 0x0f, 0xff, 0xf8,
+    0x07, 0xf8, 0x2f, 0xff, 0x19, 0x6e, 0xf8, 0xcb, 0x77, 0xc6, 0x5b, 0xbe, 0x30, 0x09, 0x70, 0x42,
+    0x29, 0x98, 0x66, 0x00, 0x0c, 0x51, 0x36, 0x20, 0x35, 0x40, 0x00, 0x2c, 0x37, 0x33, 0x12, 0x07,
+    0x60, 0x00, 0x9c, 0x0c, 0x30, 0x40, 0x11, 0x29, 0x00, 0x09, 0x73, 0xd0, 0x42, 0xb6, 0x22, 0x32,
+    0x1b, 0x19, 0x06, 0x80, 0x0c, 0x57, 0x91, 0x36, 0xb1, 0x20, 0x32, 0xc5, 0x41, 0x12, 0x00, 0x2c,
+    0x3a, 0x77, 0x19, 0x94, 0x88, 0x84, 0x09, 0xd8, 0xc6, 0x20, 0x9c, 0x4f, 0x2c, 0x34, 0x06, 0x40,
+    0x14, 0x31, 0x52, 0xd0, 0x00, 0x00, 0x27, 0x98, 0x07, 0xf2, 0xfd, 0x86, 0x79, 0xa6, 0x40, 0x4e,
+    0x18, 0x99, 0x81, 0x0c, 0x02, 0x70, 0x0f, 0x08, 0x10, 0x06, 0x20, 0x0f, 0xb4, 0x02, 0x00, 0x00,
+    0x27, 0x98, 0x07, 0xf2, 0xfd, 0x86, 0x79, 0xa6, 0x40, 0x4e, 0x18, 0x99, 0x81, 0x4c, 0x17, 0xec,
+    0x33, 0xcd, 0x32, 0x02, 0x70, 0xc4, 0xcc, 0x08, 0x60, 0x13, 0x80, 0x78, 0x40, 0x80, 0x31, 0x00,
+    0x60, 0x08, 0xb4, 0x08, 0x74, 0xb3, 0x50, 0x09, 0x1c, 0x02, 0x2b, 0x30, 0x75, 0x00, 0x07, 0x00,
+    0xd1, 0x84, 0x01, 0x1e, 0xa0, 0x00, 0x69, 0x01, 0x7d, 0x40, 0x14, 0x20, 0x00, 0x00, 0x8f, 0xd4,
+    0x44, 0x00, 0x00, 0xf1, 0xfa, 0x8f, 0x48, 0x88, 0x04, 0x04, 0x00, 0xfe, 0x3f, 0x51, 0xe9, 0x0c,
+    0xc0, 0x88, 0x04, 0x04, 0x1d, 0xc0, 0x00, 0x8f, 0xd4, 0x44, 0x00, 0x00, 0x03, 0xee, 0x28, 0x04,
+    0xbc, 0x01, 0xfb, 0x62, 0xa8, 0x20, 0x37, 0x40, 0x1f, 0x08, 0x9d, 0x05, 0x42, 0x11, 0x00, 0x1f,
+    0x08, 0x29, 0x0b, 0x23, 0xd8, 0x07, 0xf5, 0x5e, 0xb9, 0x4c, 0x08, 0x07, 0xf2, 0xff, 0x44, 0x19,
+    0x80, 0x1f, 0xfc, 0x01, 0x27, 0x92, 0xce, 0x60, 0x4d, 0xd2, 0x00, 0x77, 0x41, 0x7a, 0x54, 0x9d,
+    0xc5, 0xd8, 0x03, 0x38, 0xb8, 0x15, 0x21, 0x58, 0x2b, 0x01, 0x00, 0x06, 0x38, 0x00, 0x2a, 0x65,
+    0x80, 0x8a, 0x04, 0x00, 0xa6, 0x30, 0x06, 0xce, 0x42, 0x55, 0x2e, 0x80, 0x03, 0xee, 0x28, 0x04,
+    0xbc, 0x01, 0xff, 0xc0, 0xd8, 0xaa, 0x08, 0x0d, 0xd0, 0x07, 0xfc, 0x22, 0x74, 0x15, 0x08, 0x44,
+    0x00, 0x7f, 0xc2, 0x0a, 0x42, 0xc8, 0xf6, 0x01, 0xff, 0xc1, 0xab, 0xd7, 0x29, 0x81, 0x00, 0xff,
+    0xe0, 0xaf, 0xf4, 0x41, 0x98, 0x01, 0xff, 0xc4, 0x12, 0x79, 0x2c, 0xe6, 0x04, 0xdd, 0x20, 0x3f,
+    0x61, 0x00, 0x6e, 0x82, 0xf4, 0xa9, 0x3b, 0x8b, 0xb2, 0x46, 0xa7, 0x00, 0x4e, 0x2e, 0x05, 0x48,
+    0x56, 0x0a, 0xc1, 0x86, 0x6b, 0x30, 0x00, 0xc7, 0x00, 0x05, 0x4c, 0xb0, 0x11, 0x43, 0x0c, 0xd6,
+    0x40, 0x0a, 0x63, 0x00, 0x6c, 0xe4, 0x25, 0x52, 0xe9, 0x1f, 0x17, 0xc0, 0x2f, 0x41, 0x05, 0x61,
+    0x11, 0xa0, 0x35, 0x00, 0x2f, 0x43, 0xf3, 0x10, 0x56, 0x03, 0x61, 0x11, 0x98, 0x0d, 0x00, 0x54,
+    0x1a, 0x81, 0xe4, 0x00, 0x2f, 0x43, 0xf3, 0x4f, 0x21, 0x05, 0x60, 0x32, 0x12, 0x61, 0x11, 0x98,
+    0x05, 0x40, 0xd0, 0x05, 0x43, 0x8c, 0x1a, 0x81, 0xe4, 0x26, 0x00, 0x5f, 0x17, 0x03, 0x20, 0x60,
+    0x41, 0x0b, 0x50, 0x5f, 0x17, 0xf0, 0x70, 0x34, 0x01, 0x20, 0x63, 0x02, 0x04, 0x10, 0x27, 0x0b,
+    0x50, 0xd4, 0x00, 0x5f, 0x17, 0xf0, 0x8e, 0x07, 0x03, 0x40, 0x1c, 0x10, 0x20, 0x63, 0x02, 0x50,
+    0x10, 0x41, 0x02, 0x71, 0x11, 0x05, 0xa8, 0x6a, 0x07, 0x18, 0x00, 0x23, 0x00, 0x43, 0x50, 0xa0,
+    0x08, 0x4b, 0xb0, 0x1b, 0x42, 0x94, 0x00, 0x00, 0x3f, 0x98, 0x1c, 0x49, 0x8e, 0xab, 0x02, 0x0f,
+    0x80, 0x15, 0x56, 0x20, 0x0a, 0x3d, 0x00, 0xbd, 0x0c, 0x5f, 0x40, 0x02, 0xb5, 0x90, 0x02, 0x4f,
+    0x80, 0x2b, 0x33, 0x01, 0xc4, 0x0c, 0x75, 0x1c, 0x15, 0xa8, 0x00, 0x00, 0x00, 0x86, 0xcc, 0x03,
+    0x0d, 0x9a, 0xb4, 0x28, 0x00, 0x92, 0x38, 0x1c, 0x80, 0x07, 0x2b, 0x14, 0x8e, 0x05, 0xe4, 0xae,
+    0x33, 0xcc, 0x68, 0x0c, 0x02, 0xca, 0x43, 0x70, 0x76, 0x77, 0x08, 0x06, 0x55, 0xf0, 0x76, 0x00,
+    0x3e, 0x74, 0x1c, 0x80, 0x00, 0x2f, 0x60, 0xf9, 0x00, 0x18, 0x00, 0x40, 0x3f, 0xc2, 0x06, 0x01,
+    0xf0, 0x80, 0x7e, 0xf0, 0x0c, 0x60, 0x3e, 0x81, 0xae, 0x7e, 0xc1, 0xd2, 0x22, 0x30, 0x00, 0x80,
+    0x05, 0xdf, 0xd5, 0x03, 0xa6, 0x96, 0xa2, 0x53, 0xb6, 0xb0, 0x56, 0xc7, 0xc1, 0x00, 0xc2, 0x14,
+    0x2c, 0x01, 0x1a, 0xe8, 0x80, 0x0c, 0x30, 0xc0, 0x26, 0x52, 0x00, 0xc7, 0x40, 0x1c, 0xfe, 0x40,
+    0x18, 0x44, 0x60, 0x00, 0x01, 0x1f, 0x47, 0x77, 0x7d, 0x5d, 0xf6, 0x80, 0x47, 0x00, 0xf9, 0x59,
+    0x93, 0xf7, 0x31, 0x37, 0xf4, 0x44, 0xe8, 0x76, 0x77, 0xdc, 0x80, 0x00, 0xe1, 0x00, 0xf0, 0xbe,
+    0x7f, 0x7e, 0xc1, 0x01, 0xfd, 0x25, 0x5d, 0x2a, 0x6b, 0x05, 0xec, 0x2a, 0x2c, 0x66, 0x0c, 0x00,
+    0xc4, 0x01, 0xde, 0xc0, 0x13, 0x83, 0x00, 0x06, 0x60, 0x02, 0x85, 0x50, 0x00, 0x98, 0x40, 0x29,
+    0x45, 0x30, 0x44, 0x53, 0xf8, 0x35, 0x0c, 0x58, 0x00, 0x00, 0x8d, 0xdc, 0x40, 0x1e, 0x68, 0x83,
+    0x00, 0x7a, 0x40, 0x1e, 0x01, 0xea, 0x44, 0x78, 0x07, 0x13, 0x55, 0x10, 0x40, 0x28, 0xfb, 0x03,
+    0xbd, 0x70, 0x25, 0x24, 0x88, 0x21, 0xd0, 0x92, 0x00, 0xdc, 0x08, 0x50, 0x86, 0xad, 0x99, 0xa1,
+    0xcc, 0x00, 0x01, 0x18, 0x23, 0xba, 0x3a, 0xbb, 0x8c, 0x00, 0xf9, 0xf4, 0x03, 0xe1, 0x8e, 0x00,
+    0xfa, 0x98, 0xc0, 0x3c, 0xaa, 0x90, 0x0f, 0x0d, 0xd0, 0x07, 0xd6, 0x88, 0x00, 0xf2, 0x22, 0xc0,
+    0x3e, 0x98, 0x10, 0x0f, 0x43, 0x30, 0x03, 0xc6, 0xf2, 0x01, 0xf7, 0xc1, 0x00, 0x78, 0x00, 0xbf,
+    0xda, 0x0d, 0xc1, 0xc6, 0x01, 0xfe, 0x8d, 0x06, 0xe0, 0xe3, 0x00, 0xff, 0x46, 0xe6, 0x38, 0x00,
+    0xcf, 0xfe, 0x56, 0xa0, 0x00, 0xb8, 0x07, 0xff, 0x09, 0xf4, 0x00, 0xd4, 0x00, 0x17, 0x00, 0xff,
+    0xe1, 0x3e, 0x80, 0x1b, 0x30, 0x80, 0x03, 0xcf, 0xe8, 0x00, 0x9f, 0xbf, 0x10, 0x07, 0x06, 0x59,
+    0xe4, 0x22, 0x0f, 0x21, 0x64, 0xc1, 0x8d, 0x0c, 0xe0, 0xcb, 0x2d, 0xa0, 0xa9, 0x42, 0x00, 0x33,
+    0x04, 0x40, 0x00, 0x60, 0x26, 0xa0, 0x06, 0x5b, 0x06, 0x20, 0x1e, 0x16, 0x00, 0xa2, 0x64, 0xc0,
+    0x10, 0xf8, 0x78, 0x04, 0x2f, 0x0c, 0x01, 0xa4, 0x70, 0x40, 0x31, 0x20, 0x07, 0x90, 0x03, 0x87,
+    0x4c, 0x03, 0xa2, 0xc0, 0x38, 0xfd, 0x40, 0x3a, 0xb8, 0x03, 0xff, 0x82, 0x66, 0x00, 0x80, 0x03,
+    0xcf, 0xe8, 0x00, 0x57, 0x00, 0xe8, 0xcb, 0x3c, 0x01, 0x80, 0x1c, 0x71, 0xa1, 0x58, 0x03, 0x14,
+    0x08, 0x04, 0x60, 0x03, 0x04, 0x70, 0x02, 0x2d, 0x00, 0x7c, 0xd6, 0xce, 0x02, 0x01, 0xd2, 0xd2,
+    0x01, 0xf0, 0x86, 0x80, 0x61, 0x00, 0x87, 0x50, 0x02, 0x9e, 0x00, 0x8f, 0x54, 0x02, 0xbc, 0x00,
+    0xfe, 0x33, 0x00, 0x2f, 0x60, 0x1a, 0xff, 0x50, 0x80, 0x46, 0x18, 0xf7, 0x67, 0xd0, 0x0c, 0x85,
+    0xc8, 0x8b, 0x31, 0x00, 0x96, 0x8c, 0x01, 0xc0, 0x26, 0x00, 0x15, 0x00, 0x23, 0xa8, 0x04, 0x20,
+    0x12, 0xda, 0xd0, 0x07, 0xd0, 0x94, 0x01, 0xf8, 0xf0, 0x02, 0x1f, 0x40, 0x0b, 0x9c, 0x02, 0x3f,
+    0x60, 0x00, 0xf4, 0x00, 0x42, 0x23, 0x00, 0xfc, 0x00, 0xaf, 0xfc, 0xbd, 0x32, 0x80, 0x64, 0x66,
+    0x28, 0x08, 0x04, 0xc0, 0x40, 0x10, 0x80, 0x71, 0x10, 0x03, 0x78, 0x80, 0x62, 0x60, 0x0c, 0x26,
+    0x01, 0x9b, 0x80, 0x31, 0x88, 0x00, 0x1f, 0xfd, 0x64, 0x01, 0x3a, 0x82, 0x60, 0x05, 0x9a, 0x00,
+    0x15, 0x00, 0xf8, 0x80, 0x3e, 0x20, 0x0f, 0x0a, 0x80, 0x61, 0x5c, 0x00, 0xcf, 0xd4, 0x40, 0x1f,
+    0xfc, 0xd0, 0x01, 0xbe, 0xff, 0x84, 0x35, 0x05, 0xa0, 0x00, 0x26, 0x00, 0xe2, 0x00, 0x18, 0x07,
+    0xc4, 0x20, 0x1f, 0x69, 0x04, 0x50, 0x04, 0x7b, 0xd9, 0x90, 0x80, 0x2f, 0xfb, 0xa8, 0x40, 0x29,
+    0x61, 0x5d, 0x00, 0x88, 0x40, 0x06, 0x20, 0x1f, 0xfc, 0x22, 0x10, 0x05, 0xb8, 0x17, 0x01, 0x66,
+    0x5d, 0xa6, 0x00, 0x00, 0x8c, 0x03, 0x87, 0x00, 0x21, 0xd5, 0x15, 0xd0, 0x18, 0x91, 0x9e, 0x00,
+    0x11, 0x81, 0x28, 0x0e, 0x60, 0x73, 0x40, 0x6c, 0xc4, 0xac, 0x00, 0x2e, 0x51, 0x11, 0x9b, 0xd8,
+    0x03, 0xfd, 0xea, 0x07, 0xa0, 0x84, 0x16, 0x00, 0x01, 0x8c, 0xff, 0x76, 0x38, 0x81, 0xfb, 0xb9,
+    0x9d, 0xe8, 0xf4, 0x68, 0xfb, 0x98, 0x9b, 0xfb, 0x15, 0x60, 0x0f, 0x95, 0x40, 0x1f, 0xff, 0xf0,
+    0x0f, 0xfe, 0x0a, 0xb0, 0x07, 0xcc, 0xad, 0x1f, 0x73, 0x13, 0x7f, 0x02, 0x7e, 0xee, 0x67, 0x7a,
+    0x3d, 0x00, 0x00, 0x2d, 0x00, 0x12, 0x00, 0xd6, 0x18, 0xa9, 0xa3, 0x0b, 0x40, 0x0e, 0xad, 0x90,
+    0xa7, 0x6d, 0x64, 0x13, 0x40, 0x04, 0x80, 0x0f, 0xf2, 0x40, 0x01, 0xb0, 0xc2, 0x29, 0xae, 0x54,
+    0xac, 0xb4, 0x00, 0xea, 0xc7, 0x4d, 0x18, 0x92, 0x06, 0xb0, 0x00, 0x00, 0xfb, 0x54, 0x1d, 0x00,
+    0x28, 0x65, 0x48, 0xb0, 0x01, 0xbc, 0x82, 0x8a, 0x80, 0x3e, 0x08, 0x07, 0xa8, 0x1c, 0x1c, 0x03,
+    0x8a, 0x3c, 0x03, 0xd2, 0xe6, 0x01, 0xca, 0xd0, 0x13, 0xc4, 0x03, 0x72, 0x00, 0x41, 0x40, 0xb4,
+    0x40, 0x03, 0xa1, 0x91, 0x16, 0x01, 0x1b, 0x80, 0x00, 0xff, 0x0e, 0x7f, 0xb1, 0x88, 0xe0, 0x06,
+    0x3f, 0xd5, 0x1b, 0x88, 0x00, 0x40, 0x03, 0x76, 0x64, 0x00, 0x00, 0x91, 0xe1, 0xd4, 0x03, 0x3f,
+    0xdc, 0x3c, 0x57, 0xc8, 0x34, 0xc6, 0x77, 0xfb, 0x65, 0x29, 0xb9, 0xcc, 0x40, 0x04, 0xdb, 0x40,
+    0x00, 0x99, 0x80, 0x19, 0x73, 0x1f, 0x88, 0x00, 0x41, 0x56, 0x05, 0x02, 0xe2, 0x00, 0x1f, 0x09,
+    0x61, 0x80, 0x0f, 0x04, 0x14, 0x8d, 0x0d, 0x80, 0x0d, 0xaa, 0x58, 0xa0, 0x00, 0x2f, 0x43, 0xf3,
+    0x4f, 0x26, 0xf1, 0x10, 0x2b, 0x01, 0x90, 0x90, 0x90, 0xb0, 0x88, 0xcc, 0x02, 0xa1, 0xee, 0x06,
+    0x80, 0x2a, 0x1c, 0x60, 0x5a, 0x0d, 0x40, 0xf2, 0x13, 0x01, 0x4e, 0x00, 0x00, 0x01, 0xaf, 0xea,
+    0x00, 0xed, 0x4a, 0xb4, 0x90, 0x08, 0x8e, 0xd5, 0x55, 0x80, 0x10, 0x80, 0x97, 0xdd, 0x7f, 0x84,
+    0x00, 0x20, 0x07, 0xbb, 0x84, 0xc6, 0x44, 0x35, 0x12, 0x00, 0x69, 0x60, 0x57, 0xfa, 0x40, 0x07,
+    0xd6, 0x11, 0x98, 0x80, 0x0c, 0xc0, 0x46, 0x61, 0x00, 0xf6, 0xa2, 0x40, 0x1e, 0x7b, 0xb8, 0x40,
+    0x00, 0xe4, 0x67, 0x20, 0x0f, 0x12, 0xe9, 0x00, 0x43, 0x3d, 0x3c, 0xc0, 0x11, 0x7b, 0x21, 0xb1,
+    0xd0, 0x03, 0x83, 0x66, 0xb2, 0x55, 0x88, 0xe4, 0x91, 0xf5, 0xbd, 0x9c, 0x10, 0x38, 0x08, 0x02,
+    0x30, 0x21, 0xe4, 0xc0, 0x08, 0xc0, 0x91, 0x18, 0x80, 0x13, 0x82, 0xe9, 0x98, 0x07, 0xdc, 0x92,
+    0xc1, 0x30, 0x2c, 0x14, 0x24, 0xde, 0x73, 0x0a, 0xe4, 0x04, 0xec, 0x4a, 0x15, 0x00, 0x11, 0xdb,
+    0xfe, 0x28, 0x00, 0x00, 0x15, 0x77, 0xe2, 0x00, 0x45, 0x88, 0xee, 0x1b, 0x50, 0x07, 0x07, 0xcc,
+    0x6a, 0x58, 0x11, 0xc0, 0x80, 0x53, 0x21, 0x70, 0x70, 0x44, 0x0a, 0x28, 0x98, 0x08, 0x7f, 0xd2,
+    0xe0, 0x60, 0x40, 0x04, 0xbf, 0x50, 0x70, 0x40, 0x01, 0xa9, 0xd0, 0x91, 0xc0, 0x83, 0x07, 0xb8,
+    0x87, 0x8f, 0xab, 0xe9, 0xc8, 0x00, 0xf5, 0x00, 0x9b, 0x10, 0x00, 0x0a, 0xff, 0xf0, 0x06, 0x88,
+    0xe0, 0x08, 0x5d, 0xf8, 0x03, 0xff, 0x82, 0x23, 0xc0, 0x10, 0xf7, 0x6b, 0x00, 0x86, 0xef, 0x40,
+    0x06, 0x44, 0xc4, 0x1e, 0xa3, 0xe8, 0x01, 0xb4, 0xc3, 0x50, 0x03, 0x13, 0x09, 0x00, 0x70, 0x00,
+    0x26, 0x7e, 0xb0, 0x00, 0xac, 0x21, 0xe5, 0x02, 0x83, 0x1e, 0x8b, 0x80, 0x02, 0x01, 0x7c, 0x3b,
+    0x87, 0xfd, 0x64, 0x46, 0x70, 0xdd, 0x50, 0x01, 0x9c, 0x37, 0x54, 0x00, 0x68, 0x0c, 0xda, 0x00,
+    0x08, 0x80, 0xc8, 0x51, 0x4e, 0xcd, 0x9a, 0x9f, 0x42, 0x39, 0x98, 0xe4, 0x00, 0xf1, 0xa8, 0x04,
+    0x2c, 0x24, 0xa1, 0xf8, 0xa4, 0x05, 0x31, 0xb5, 0xc6, 0xd5, 0xa8, 0x00, 0x5d, 0xb1, 0x16, 0x68,
+    0xc0, 0x02, 0x49, 0x01, 0x0c, 0x9c, 0x80, 0x02, 0x08, 0x06, 0x00, 0x10, 0x0e, 0xe0, 0x0f, 0xf2,
+    0x80, 0x7f, 0x31, 0x10, 0x03, 0xf5, 0x28, 0x07, 0x8f, 0xd8, 0xeb, 0x64, 0x01, 0x1c, 0x00, 0x0f,
+    0xf0, 0x80, 0x49, 0xe6, 0x01, 0xa0, 0x03, 0xf8, 0x58, 0xc0, 0x3f, 0x39, 0x78, 0x07, 0xb4, 0x18,
+    0x8f, 0xfd, 0x61, 0x87, 0x80, 0xba, 0xa1, 0x92, 0x14, 0x78, 0x0b, 0xaa, 0x19, 0x21, 0x47, 0x80,
+    0xbb, 0xa9, 0x06, 0x0a, 0x31, 0x03, 0x22, 0x31, 0x30, 0x30, 0x07, 0xd2, 0x01, 0xfe, 0x43, 0x00,
+    0x80, 0x1f, 0xfd, 0xb0, 0x01, 0xf2, 0x44, 0x1d, 0xd2, 0x1a, 0xe0, 0x16, 0x3b, 0xa9, 0xd8, 0x4f,
+    0xc0, 0x3e, 0xc0, 0xe1, 0x7f, 0x00, 0xf1, 0x04, 0x8a, 0xd8, 0x03, 0xc4, 0x4b, 0x06, 0xc0, 0x48,
+    0x00, 0x7e, 0xe5, 0x1f, 0x00, 0x79, 0xae, 0xd9, 0xa4, 0x01, 0xee, 0x44, 0x18, 0x07, 0xff, 0x0c,
+    0xd1, 0x00, 0x1f, 0xd0, 0x56, 0x00, 0x1f, 0xfd, 0xd2, 0x01, 0xfe, 0x59, 0x93, 0xb5, 0x80, 0x7f,
+    0x6b, 0x32, 0x61, 0x08, 0x03, 0xff, 0x80, 0xa0, 0xe5, 0x7f, 0xaa, 0x01, 0xf3, 0x00, 0xf3, 0x5a,
+    0xd1, 0x80, 0x3c, 0x44, 0x92, 0x28, 0x48, 0x88, 0x2b, 0x00, 0x3f, 0x72, 0xc3, 0x41, 0xdb, 0x23,
+    0xa0, 0x00, 0xd7, 0x40, 0x86, 0x13, 0x4c, 0xcc, 0x60, 0x07, 0x22, 0xb3, 0x08, 0x09, 0x6b, 0x8e,
+    0x80, 0x3a, 0x02, 0x03, 0x28, 0x4c, 0x94, 0x03, 0x86, 0x14, 0xf0, 0x7b, 0x5e, 0x40, 0xac, 0x00,
+    0x93, 0xe4, 0x02, 0x7f, 0x0c, 0x31, 0x00, 0x68, 0x20, 0x05, 0x6a, 0x0e, 0x08, 0x00, 0x43, 0x22,
+    0x00, 0x0f, 0x03, 0x42, 0xbf, 0xc4, 0x61, 0xbf, 0xe0, 0x91, 0xe5, 0x2c, 0x80, 0xc3, 0x4c, 0x61,
+    0xc1, 0x2c, 0x23, 0xf2, 0x34, 0x73, 0x32, 0x98, 0x64, 0x87, 0xb9, 0x7b, 0x9f, 0xaa, 0x78, 0xf6,
+    0x03, 0x84, 0x66, 0x01, 0xc2, 0xb0, 0x48, 0xd1, 0x41, 0x4c, 0xc4, 0xa0, 0xa6, 0x01, 0x61, 0x14,
+    0x00, 0x42, 0x40, 0x0e, 0x40, 0x40, 0x0b, 0x03, 0x00, 0x20, 0x01, 0x1c, 0x01, 0x84, 0x01, 0xdd,
+    0xbf, 0x04, 0x39, 0xc0, 0x0d, 0x76, 0xa3, 0x80, 0x0e, 0xe6, 0x35, 0x42, 0x00, 0xf2, 0x40, 0x83,
+    0x80, 0x7f, 0xf2, 0x3e, 0x04, 0x04, 0x03, 0x98, 0x89, 0x00, 0xa0, 0x1d, 0x13, 0x27, 0x71, 0x80,
+    0x00, 0xe3, 0xf4, 0x00, 0xcd, 0xf8, 0x16, 0x80, 0x13, 0xed, 0x04, 0xa0, 0x15, 0xf7, 0x00, 0x04,
+    0x00, 0xf5, 0x94, 0xb0, 0x09, 0x4b, 0x5a, 0x24, 0x02, 0xd0, 0x30, 0x02, 0x80, 0x7f, 0xf0, 0x34,
+    0x0c, 0x00, 0x80, 0x12, 0x8e, 0xb4, 0x40, 0x03, 0x61, 0x4a, 0x58, 0x06, 0x2c, 0xfc, 0x5f, 0x40,
+    0x15, 0x5f, 0x08, 0x2d, 0x57, 0x88, 0x00, 0x00, 0x93, 0x3f, 0x9c, 0x02, 0x4b, 0x17, 0x48, 0x30,
+    0x05, 0x1e, 0xc5, 0x61, 0x82, 0x0c, 0x00, 0x46, 0x13, 0x61, 0x7f, 0xee, 0x00, 0x42, 0x8e, 0xed,
+    0xe0, 0x08, 0x51, 0xdd, 0x60, 0x05, 0x12, 0x15, 0xbe, 0x20, 0x01, 0x60, 0xe2, 0x10, 0x10, 0x0a,
+    0x93, 0x22, 0xb8, 0x80, 0x0b, 0x42, 0xef, 0x10, 0x04, 0xf3, 0x00, 0xa7, 0xd4, 0x03, 0xca, 0xcc,
+    0x50, 0x0e, 0x2a, 0x39, 0x00, 0xf7, 0x8e, 0x80, 0x04, 0x40, 0xd4, 0x56, 0x02, 0x19, 0x41, 0x4a,
+    0x15, 0xdc, 0x8e, 0x80, 0x01, 0x03, 0xdd, 0xa8, 0xcc, 0x0b, 0xa6, 0xca, 0x84, 0x01, 0x48, 0x68,
+    0x50, 0x07, 0xc3, 0x49, 0x00, 0x1f, 0x23, 0xb9, 0x00, 0xaf, 0xff, 0x97, 0xa2, 0x0a, 0x0f, 0x10,
+    0x74, 0x77, 0x60, 0x4b, 0xb8, 0x80, 0x39, 0xa4, 0x03, 0x0e, 0x05, 0xe8, 0x04, 0x3c, 0xe1, 0xe4,
+    0x01, 0x0f, 0x28, 0x60, 0x80, 0x6d, 0x70, 0xd7, 0x00, 0xd1, 0x20, 0x60, 0x1c, 0x80, 0x1f, 0xfc,
+    0x30, 0x00, 0x91, 0xc0, 0x3f, 0xf8, 0xbb, 0x00, 0x1f, 0xfc, 0x33, 0x87, 0x0f, 0xeb, 0x40, 0x0f,
+    0xf9, 0x50, 0xc2, 0xa5, 0xed, 0xc0, 0x3f, 0xcd, 0x88, 0x0a, 0xf8, 0xf0, 0x60, 0x1f, 0xfc, 0x48,
+    0x0a, 0x00, 0x4f, 0x7d, 0x08, 0x07, 0xf9, 0x14, 0x29, 0xa6, 0x13, 0x40, 0x3f, 0xc2, 0x32, 0xd3,
+    0xba, 0xcc, 0xc0, 0x1f, 0xc2, 0x25, 0x05, 0x00, 0x20, 0x28, 0xdf, 0xb0, 0x07, 0x2b, 0x08, 0x08,
+    0x07, 0x32, 0x51, 0x80, 0x80, 0x18, 0x78, 0x00, 0x80, 0x04, 0x05, 0x00, 0x11, 0x03, 0xde, 0x25,
+    0x10, 0x00, 0xb7, 0x75, 0x19, 0x9d, 0x20, 0xf1, 0xe1, 0x99, 0x60, 0x15, 0xd4, 0x26, 0x80, 0x2f,
+    0xf4, 0xe7, 0xfa, 0x40, 0x32, 0x6f, 0xd8, 0x80, 0x7f, 0xf6, 0xc0, 0x0b, 0xff, 0xba, 0x00, 0x30,
+    0xcc, 0x99, 0xe4, 0x29, 0x06, 0x64, 0xe0, 0xdb, 0x66, 0x5b, 0xb3, 0x06, 0x0b, 0x89, 0x14, 0x20,
+    0x34, 0x87, 0xff, 0x38, 0x6d, 0x99, 0x66, 0x24, 0x17, 0x05, 0xcb, 0x31, 0x25, 0x62, 0x00, 0x2b,
+    0xb6, 0xe8, 0x40, 0x21, 0x44, 0x10, 0x07, 0xff, 0x00, 0x00, 0xc9, 0x60, 0x1f, 0x1f, 0x2b, 0x08,
+    0x06, 0x9c, 0x51, 0x9f, 0x30, 0x03, 0xb3, 0xc9, 0x69, 0xe8, 0x02, 0x12, 0x0c, 0x0b, 0x85, 0x90,
+    0x3c, 0x03, 0x1e, 0xb9, 0x03, 0x00, 0x42, 0x23, 0x10, 0x0e, 0x2e, 0xea, 0x88, 0x18, 0x00, 0x57,
+    0x61, 0x34, 0x0e, 0x00, 0x91, 0x87, 0x81, 0xd5, 0xc0, 0x03, 0xc0, 0xc1, 0x09, 0x14, 0x5c, 0x74,
+    0x20, 0x0b, 0xa4, 0x07, 0xd5, 0x00, 0xcb, 0xc5, 0x04, 0x00, 0x00, 0x00, 0x97, 0xf0, 0x03, 0xef,
+    0x03, 0x10, 0x0f, 0x2b, 0x83, 0x80, 0x72, 0x05, 0x9e, 0x80, 0x76, 0x89, 0xda, 0x00, 0x55, 0xec,
+    0x3f, 0x01, 0xfe, 0x1b, 0x90, 0xad, 0xd1, 0x1e, 0x8d, 0xc8, 0x56, 0xe8, 0x8f, 0x46, 0x01, 0xb7,
+    0x6c, 0x06, 0x14, 0x0a, 0x22, 0x8c, 0xc8, 0x1a, 0x26, 0x01, 0x90, 0x88, 0x00, 0x00, 0x36, 0xfe,
+    0xb0, 0x04, 0x92, 0xd2, 0xd2, 0x60, 0x0c, 0x1b, 0x6b, 0x04, 0x00, 0x47, 0x00, 0x10, 0x08, 0x13,
+    0xff, 0x58, 0x51, 0xad, 0xdf, 0xc6, 0xb7, 0x7f, 0x1a, 0xb0, 0x56, 0x66, 0x31, 0x22, 0x29, 0x9a,
+    0x50, 0x00, 0x65, 0x2d, 0x4a, 0x01, 0x43, 0xba, 0x5d, 0xe0, 0x00, 0x00, 0xc4, 0xc0, 0x1f, 0x9e,
+    0xc0, 0x3c, 0x33, 0x65, 0x8a, 0x01, 0x0f, 0xb1, 0x80, 0xd3, 0x80, 0x2c, 0x72, 0x0b, 0x56, 0x08,
+    0x55, 0xcc, 0x02, 0xb0, 0x54, 0x0b, 0x00, 0xc3, 0xee, 0x60, 0x40, 0x1f, 0xc6, 0x01, 0xf2, 0x83,
+    0x80, 0x73, 0xa1, 0x8c, 0x80, 0x65, 0x81, 0x08, 0x3b, 0xd0, 0x5b, 0x25, 0x06, 0x84, 0x72, 0xa3,
+    0xf0, 0x09, 0xf9, 0x86, 0xf4, 0x80, 0x30, 0xe1, 0xa0, 0x04, 0x00, 0x9f, 0xff, 0x93, 0x5d, 0xfe,
+    0x6d, 0x77, 0xf9, 0xae, 0xe6, 0x0a, 0xbb, 0x29, 0x22, 0x3c, 0x11, 0x21, 0x00, 0xff, 0xf5, 0x00,
+    0x13, 0x3f, 0x04, 0x66, 0x76, 0x84, 0x6e, 0x9c, 0x23, 0x81, 0xfb, 0x88, 0x13, 0x60, 0x77, 0x70,
+    0x16, 0x83, 0x19, 0x68, 0x43, 0x05, 0x5d, 0x86, 0xd0, 0x01, 0x04, 0x74, 0x80, 0x10, 0xf9, 0x50,
+    0x07, 0x15, 0xa4, 0x80, 0x72, 0x43, 0x28, 0x00, 0x02, 0xf6, 0x00, 0xfb, 0x30, 0xa0, 0x01, 0xa0,
+    0x55, 0x20, 0x02, 0x58, 0x27, 0x08, 0x01, 0x58, 0x13, 0x4e, 0x00, 0x7d, 0x05, 0xe4, 0x00, 0xa0,
+    0x30, 0x43, 0xdd, 0x54, 0x01, 0x18, 0x10, 0x07, 0x50, 0x20, 0x05, 0x94, 0xd0, 0x20, 0x60, 0xaf,
+    0x2e, 0x00, 0x00, 0xc6, 0x40, 0x1f, 0xbe, 0x40, 0x3e, 0x32, 0x63, 0x00, 0xea, 0xc1, 0x2c, 0x80,
+    0x09, 0xd6, 0x0d, 0x1d, 0xca, 0x00, 0x94, 0x70, 0x04, 0x1c, 0x80, 0x8b, 0x40, 0x35, 0x98, 0x18,
+    0x10, 0x06, 0x10, 0x11, 0x00, 0x78, 0xc0, 0x00, 0x01, 0xff, 0xdd, 0x00, 0x1c, 0xb3, 0x27, 0x74,
+    0x80, 0x6c, 0x66, 0x4b, 0x30, 0x03, 0xf7, 0x00, 0x46, 0x02, 0x32, 0x49, 0x85, 0x68, 0x47, 0x72,
+    0xcf, 0x82, 0x28, 0x1a, 0xed, 0xba, 0x20, 0x24, 0x0f, 0x44, 0x10, 0x05, 0x5c, 0x13, 0xf4, 0x01,
+    0xa2, 0xc1, 0xf2, 0x00, 0x31, 0x28, 0x71, 0x90, 0x06, 0x00, 0x00, 0xaa, 0x26, 0x00, 0x39, 0x10,
+    0xec, 0xa6, 0x01, 0x25, 0x8a, 0xa1, 0x68, 0x80, 0x20, 0x97, 0x49, 0x82, 0x00, 0x07, 0x40, 0x10,
+    0xbb, 0x80, 0x80, 0xc0, 0x37, 0x88, 0x18, 0x0d, 0x3c, 0xc3, 0x78, 0x08, 0xb4, 0x03, 0xf4, 0xb0,
+    0x80, 0x78, 0x46, 0xf7, 0x66, 0xc0, 0x72, 0x03, 0x13, 0x38, 0x00, 0x00, 0x22, 0x0d, 0x40, 0x3b,
+    0x35, 0x3c, 0x02, 0x1f, 0x76, 0x85, 0x90, 0x0c, 0xb3, 0x26, 0x65, 0x00, 0x5a, 0xcc, 0x96, 0x50,
+    0x0f, 0x84, 0x03, 0x84, 0x48, 0xcc, 0x00, 0xa3, 0xb9, 0x67, 0x00, 0x13, 0x5d, 0xa8, 0x3c, 0x40,
+    0x1c, 0x88, 0x5e, 0x17, 0x00, 0xff, 0xb5, 0x98, 0xfa, 0x0e, 0x00, 0x59, 0x94, 0x2e, 0x08, 0xbd,
+    0xda, 0x16, 0xcc, 0x02, 0xcd, 0x4f, 0x00, 0x80, 0x00, 0xfc, 0x59, 0xfc, 0x80, 0x0c, 0x7b, 0x71,
+    0x06, 0x1b, 0x49, 0x50, 0xe3, 0x00, 0xee, 0x20, 0x0e, 0x71, 0x91, 0x52, 0x01, 0xb6, 0xea, 0x40,
+    0x21, 0x97, 0x93, 0x05, 0xa9, 0x79, 0xa1, 0x00, 0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15, .adv_w = 96, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 24, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 75, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 138, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 201, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 250, .adv_w = 64, .box_w = 2, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 255, .adv_w = 64, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 284, .adv_w = 64, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 313, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 338, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 362, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 369, .adv_w = 96, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 377, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 382, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 414, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 463, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 477, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 519, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 564, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 603, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 690, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 725, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 769, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 815, .adv_w = 48, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 826, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 839, .adv_w = 144, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 869, .adv_w = 144, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 884, .adv_w = 144, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 914, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 949, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1042, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1091, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1134, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1184, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1227, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1260, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1288, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1344, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1368, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1373, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1392, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1433, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1444, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1497, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1535, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1587, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1626, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1684, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1728, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1778, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1794, .adv_w = 160, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1819, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1869, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1945, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1996, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2033, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2072, .adv_w = 64, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2084, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2114, .adv_w = 64, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2129, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2145, .adv_w = 96, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2152, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 2159, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2188, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2222, .adv_w = 112, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2253, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2289, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2321, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2340, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2382, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2404, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2414, .adv_w = 48, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2430, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2460, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2465, .adv_w = 192, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2492, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2510, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2541, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2578, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2614, .adv_w = 80, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2627, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2656, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2675, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2697, .adv_w = 112, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2728, .adv_w = 176, .box_w = 11, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2773, .adv_w = 112, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2805, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2846, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2873, .adv_w = 96, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2911, .adv_w = 64, .box_w = 2, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2916, .adv_w = 96, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2950, .adv_w = 144, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2968, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2969, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2982, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3025, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3069, .adv_w = 160, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3115, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3161, .adv_w = 64, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3171, .adv_w = 128, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3221, .adv_w = 128, .box_w = 6, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 3228, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3302, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3321, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3350, .adv_w = 144, .box_w = 7, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3363, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 3409, .adv_w = 96, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 3414, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3435, .adv_w = 144, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3465, .adv_w = 80, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3480, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3498, .adv_w = 64, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 3505, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3530, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3556, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3561, .adv_w = 64, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3568, .adv_w = 64, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3577, .adv_w = 96, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3594, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3623, .adv_w = 160, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3680, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3741, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3810, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3847, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3908, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3969, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4032, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4092, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4152, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4215, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4275, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4337, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4382, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4427, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4474, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4519, .adv_w = 48, .box_w = 4, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4533, .adv_w = 48, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4547, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4563, .adv_w = 48, .box_w = 6, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4578, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4630, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4679, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4743, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4807, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4873, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4934, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4998, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5027, .adv_w = 160, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5097, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5134, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5171, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5211, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5249, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5299, .adv_w = 144, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5337, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5378, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5415, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5453, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5493, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5533, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5573, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5615, .adv_w = 192, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5663, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5705, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5746, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5787, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5830, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5874, .adv_w = 48, .box_w = 4, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5886, .adv_w = 48, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5897, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5910, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5923, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5971, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6001, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6041, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6081, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6123, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6166, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6209, .adv_w = 144, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6235, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6274, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6306, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6337, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6371, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6405, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6456, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6496, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6549, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6609, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6648, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6712, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6752, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6812, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6850, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6913, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6953, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7018, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7061, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7120, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7160, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7225, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7267, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7326, .adv_w = 160, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7371, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7423, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7468, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7512, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7554, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7602, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7645, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7688, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7729, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7771, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7814, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7862, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7905, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7975, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8028, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8099, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8152, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8216, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8267, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8336, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8392, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8431, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8468, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8505, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8536, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8549, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8562, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8575, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8588, .adv_w = 48, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8604, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8617, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8627, .adv_w = 48, .box_w = 4, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 8644, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8654, .adv_w = 48, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8659, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8684, .adv_w = 96, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8708, .adv_w = 128, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8744, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 8762, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8817, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8861, .adv_w = 112, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8889, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8912, .adv_w = 48, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8926, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8949, .adv_w = 48, .box_w = 3, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8960, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8981, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8994, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9015, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9029, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9059, .adv_w = 48, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9077, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9127, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9154, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9206, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9238, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9292, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9322, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9371, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9398, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9461, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9502, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9569, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9611, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9678, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9721, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9781, .adv_w = 208, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9832, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9888, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9909, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9966, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 9989, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10048, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10069, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10131, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10169, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10234, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10273, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10333, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10371, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10434, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10473, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10498, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 10525, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10556, .adv_w = 80, .box_w = 6, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10585, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10620, .adv_w = 80, .box_w = 5, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10644, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10678, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10712, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10747, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10779, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10820, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10854, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10894, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10931, .adv_w = 160, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10972, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11006, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11043, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11075, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11168, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11226, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11279, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11332, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11382, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11434, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11471, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11520, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11556, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11611, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11648, .adv_w = 64, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11658, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 11722, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 11762, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11815, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11857, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11914, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 11957, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12012, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12057, .adv_w = 160, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12131, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12181, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12234, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12277, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12330, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12376, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12430, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12477, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12533, .adv_w = 128, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12582, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12636, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12683, .adv_w = 128, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12736, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12787, .adv_w = 128, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12840, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12890, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12933, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 12976, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13019, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13063, .adv_w = 128, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13121, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13175, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13211, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13238, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13304, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13356, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13390, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13421, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13456, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13488, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13526, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 13560, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13596, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13629, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13666, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13700, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 13713, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 13734, .adv_w = 48, .box_w = 5, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 13755, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 13774, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13827, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 13869, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13921, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13962, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14015, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14057, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14077, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14087, .adv_w = 128, .box_w = 9, .box_h = 17, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14120, .adv_w = 48, .box_w = 5, .box_h = 17, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14140, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14162, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14174, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14196, .adv_w = 48, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 14209, .adv_w = 192, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14276, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14314, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14377, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14415, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14481, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14522, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14570, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14597, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14646, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14674, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14724, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14753, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14803, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 14833, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14906, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14956, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15031, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15081, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15153, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15202, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15274, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15323, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15375, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15421, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15470, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15516, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15569, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15590, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15644, .adv_w = 80, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15665, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15731, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15758, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15814, .adv_w = 80, .box_w = 6, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 15836, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15896, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15934, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 15994, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16033, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16097, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16144, .adv_w = 144, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16214, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16259, .adv_w = 144, .box_w = 9, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16331, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16378, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16404, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16432, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16457, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16486, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16512, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16538, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16564, .adv_w = 80, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16597, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16635, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16669, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16707, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16740, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16778, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 16811, .adv_w = 160, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16857, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16899, .adv_w = 160, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16947, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16987, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17050, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17093, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17152, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17192, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17285, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17341, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17432, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17488, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17578, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17637, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17725, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17781, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17870, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 17927, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17988, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18029, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18092, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18135, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18183, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18233, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18287, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18325, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18374, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18410, .adv_w = 144, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18460, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18496, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18529, .adv_w = 80, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 18561, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18619, .adv_w = 112, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18674, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18713, .adv_w = 64, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18729, .adv_w = 80, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18747, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18792, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18834, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18893, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 18932, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18990, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19027, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19095, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19142, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19211, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19259, .adv_w = 144, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19325, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19371, .adv_w = 144, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19439, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19486, .adv_w = 144, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19560, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 19610, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19679, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19726, .adv_w = 144, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19795, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19842, .adv_w = 144, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19908, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19953, .adv_w = 144, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20021, .adv_w = 112, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20067, .adv_w = 144, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20142, .adv_w = 112, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20192, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20234, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20276, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20320, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20361, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20406, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20450, .adv_w = 128, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20503, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20555, .adv_w = 128, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20608, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20659, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20711, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20761, .adv_w = 128, .box_w = 8, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20813, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20864, .adv_w = 128, .box_w = 8, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20921, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 20974, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20984, .adv_w = 48, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 20994, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21004, .adv_w = 48, .box_w = 3, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21018, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21080, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21121, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21181, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21221, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21295, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21345, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21418, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21468, .adv_w = 160, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21541, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21589, .adv_w = 160, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21660, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21708, .adv_w = 160, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21785, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 21836, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21902, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 21944, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22011, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22054, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22117, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22160, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22224, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22267, .adv_w = 160, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22334, .adv_w = 128, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22380, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22416, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22448, .adv_w = 160, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22483, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22515, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22562, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22600, .adv_w = 160, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22647, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22686, .adv_w = 160, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22731, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22770, .adv_w = 160, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22813, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22853, .adv_w = 160, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22901, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 22942, .adv_w = 144, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22992, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23042, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23089, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23131, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23179, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23230, .adv_w = 144, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23280, .adv_w = 112, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23333, .adv_w = 176, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23351, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23371, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23414, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23460, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23512, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 23565, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23566, .adv_w = 240, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23567, .adv_w = 112, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23568, .adv_w = 224, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23569, .adv_w = 80, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23570, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23571, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23572, .adv_w = 144, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23573, .adv_w = 48, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23574, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23575, .adv_w = 16, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23576, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23577, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 23584, .adv_w = 80, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 23591, .adv_w = 144, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 23600, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 23606, .adv_w = 224, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 23616, .adv_w = 224, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 23626, .adv_w = 112, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 23634, .adv_w = 96, .box_w = 8, .box_h = 4, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 23645, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23652, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23659, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23666, .adv_w = 48, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23673, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23684, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23695, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 23706, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 23717, .adv_w = 112, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 23743, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23777, .adv_w = 112, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 23790, .adv_w = 112, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 23805, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23810, .adv_w = 96, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23818, .adv_w = 160, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23830, .adv_w = 48, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 23835, .adv_w = 32, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23836, .adv_w = 272, .box_w = 17, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23916, .adv_w = 352, .box_w = 21, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24012, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24020, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24036, .adv_w = 144, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24059, .adv_w = 48, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24067, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24083, .adv_w = 144, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 24106, .adv_w = 96, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24119, .adv_w = 80, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24137, .adv_w = 80, .box_w = 5, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24156, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24197, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24224, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24260, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 24268, .adv_w = 176, .box_w = 11, .box_h = 3, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24283, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 24303, .adv_w = 96, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24329, .adv_w = 160, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24370, .adv_w = 112, .box_w = 5, .box_h = 3, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 24377, .adv_w = 32, .box_w = 10, .box_h = 11, .ofs_x = -4, .ofs_y = 0},
+    {.bitmap_index = 24414, .adv_w = 64, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 24431, .adv_w = 64, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24454, .adv_w = 240, .box_w = 15, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24527, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24579, .adv_w = 176, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24633, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 24662, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24690, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24715, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24739, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 24763, .adv_w = 48, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 24776, .adv_w = 176, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24818, .adv_w = 112, .box_w = 6, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 24859, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 24904, .adv_w = 160, .box_w = 10, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 24922, .adv_w = 176, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 24944, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 24973, .adv_w = 192, .box_w = 12, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 25004, .adv_w = 64, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25005, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25056, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 25123, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25179, .adv_w = 128, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25215, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25260, .adv_w = 192, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 25311, .adv_w = 160, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25361, .adv_w = 192, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25414, .adv_w = 240, .box_w = 15, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25486, .adv_w = 208, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25562, .adv_w = 176, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25600, .adv_w = 128, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 25655, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25704, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25753, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25793, .adv_w = 304, .box_w = 19, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 25899, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 25945, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 26011, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26061, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26107, .adv_w = 160, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26171, .adv_w = 144, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26192, .adv_w = 112, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26232, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26274, .adv_w = 160, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26312, .adv_w = 144, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26362, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 26411, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 26472, .adv_w = 112, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+};
+
+static const uint16_t unicode_list_9[] = {
+    0x0, 0x8,
+};
+
+static const uint8_t glyph_id_ofs_list_11[] = {
+    0, 1, 2, 3, 4, 0, 0, 5, 6, 7, 0, 8, 9, 10, 11, 12,
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 160, .range_length = 13, .glyph_id_start = 96,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 174, .range_length = 155, .glyph_id_start = 109,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 330, .range_length = 54, .glyph_id_start = 264,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7680, .range_length = 156, .glyph_id_start = 318,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 7837, .range_length = 99, .glyph_id_start = 474,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8192, .range_length = 12, .glyph_id_start = 573,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8208, .range_length = 24, .glyph_id_start = 585,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8239, .range_length = 39, .glyph_id_start = 609,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8279, .range_length = 9, .glyph_id_start = 648,
+     .unicode_list = unicode_list_9, .glyph_id_ofs_list = NULL, .list_length = 2,
+     .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY},
+    {.range_start = 8352, .range_length = 16, .glyph_id_start = 650,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+    {.range_start = 8369, .range_length = 16, .glyph_id_start = 666,
+     .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_11, .list_length = 16,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 12,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t interdisplay_medium_14_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 21,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
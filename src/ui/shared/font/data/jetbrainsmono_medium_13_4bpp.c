@@ -0,0 +1,279 @@
+/*
+ * jetbrainsmono_medium_13_4bpp - generated by script/binfont_to_c.py from jetbrainsmono_medium_13_4bpp.c.inc
+ * Native LVGL font, const data in flash. Do not edit.
+ */
+
+#include <lvgl.h>
+
+static const uint8_t glyph_bitmap[] = {
+    0x00, 0x0d, 0xa0, 0x13, 0x00, 0xe1, 0x07, 0x00, 0xbc, 0x3d, 0x00, 0x98, 0x23, 0x80, 0x3f, 0x36,
+    0xf0, 0x08, 0x4c, 0x00, 0x20, 0x1c, 0x67, 0x32, 0x00, 0x00, 0x2d, 0x02, 0xd0, 0x05, 0x98, 0x0c,
+    0xc0, 0x0f, 0x34, 0x73, 0x42, 0x0f, 0x07, 0x70, 0x79, 0x00, 0xcc, 0x06, 0x40, 0x07, 0xd3, 0xed,
+    0x3c, 0x07, 0x69, 0xe6, 0x9c, 0x00, 0x19, 0x01, 0x90, 0x04, 0xca, 0x0c, 0xa0, 0x00, 0x00, 0x8c,
+    0x80, 0x39, 0x1c, 0x03, 0x44, 0xdc, 0x00, 0x25, 0x51, 0x96, 0x01, 0x2b, 0x75, 0x3a, 0x0f, 0x5c,
+    0x08, 0xa1, 0x00, 0xd0, 0xc0, 0x02, 0xd7, 0x19, 0x70, 0x0b, 0xe5, 0xe8, 0x3d, 0x40, 0x21, 0x08,
+    0xaa, 0x43, 0xc0, 0x3e, 0xba, 0x72, 0x00, 0x0b, 0x70, 0x40, 0x5e, 0xe2, 0x80, 0x2d, 0x26, 0xa9,
+    0x20, 0xe4, 0x80, 0x18, 0xee, 0x42, 0x67, 0x77, 0x00, 0x0b, 0xba, 0xcb, 0x20, 0x0c, 0xa6, 0x3d,
+    0x84, 0x05, 0x17, 0x1e, 0x96, 0x1d, 0x22, 0x03, 0xe1, 0x08, 0x80, 0x7e, 0xaa, 0x00, 0x01, 0xbf,
+    0xd4, 0x00, 0xd2, 0xfc, 0xb4, 0x01, 0xe1, 0x98, 0x00, 0xd2, 0x4e, 0x2c, 0x01, 0x0d, 0x0c, 0x20,
+    0x34, 0x04, 0x3f, 0xd5, 0x1a, 0x28, 0x09, 0x01, 0x5a, 0x60, 0x80, 0xd4, 0x91, 0x8e, 0x80, 0x12,
+    0xdb, 0x37, 0x81, 0x20, 0x00, 0xc9, 0x00, 0x85, 0x38, 0x00, 0x8c, 0x80, 0x17, 0x82, 0x18, 0xfc,
+    0x6a, 0x7a, 0x21, 0x88, 0x20, 0x03, 0x10, 0x0f, 0xfe, 0x09, 0x88, 0x05, 0x88, 0x20, 0x05, 0x3d,
+    0x10, 0x06, 0xbf, 0x18, 0x0d, 0xe0, 0x80, 0x31, 0x00, 0x97, 0xa4, 0x00, 0xda, 0xf2, 0x00, 0x2a,
+    0x62, 0x00, 0x20, 0xb8, 0x04, 0x64, 0x01, 0xff, 0xc1, 0x32, 0x00, 0x20, 0xb8, 0x15, 0x31, 0x36,
+    0xbc, 0x82, 0xec, 0x80, 0x00, 0x00, 0xa9, 0xc0, 0x30, 0x80, 0x61, 0x05, 0xea, 0x1d, 0xce, 0x25,
+    0xdd, 0x22, 0x2b, 0x88, 0x0b, 0x94, 0xc0, 0x40, 0x0a, 0xf7, 0xd2, 0x40, 0x05, 0xd1, 0x3c, 0x20,
+    0x00, 0x00, 0xae, 0x00, 0x3f, 0x8b, 0xfc, 0x8f, 0xfe, 0x2d, 0xd1, 0xb6, 0xe8, 0x08, 0x8e, 0x24,
+    0x40, 0x08, 0x7c, 0x00, 0x00, 0x09, 0xa0, 0x73, 0x11, 0x61, 0x02, 0x00, 0x2f, 0xfc, 0x5b, 0xb8,
+    0x00, 0x87, 0xf4, 0x04, 0x40, 0x00, 0xea, 0xa0, 0x06, 0x15, 0xe0, 0x0c, 0xe2, 0x80, 0x1a, 0xd8,
+    0x03, 0x19, 0x50, 0x06, 0xa3, 0x20, 0x0c, 0xf4, 0x01, 0x94, 0x58, 0x03, 0x73, 0x00, 0x62, 0x4a,
+    0x00, 0xd4, 0x46, 0x01, 0x9a, 0x80, 0x30, 0x1b, 0xfe, 0x90, 0xa0, 0xdd, 0x24, 0x27, 0x91, 0xd2,
+    0x03, 0x80, 0x7b, 0x24, 0x03, 0x74, 0x00, 0x4e, 0x42, 0x00, 0x4f, 0x23, 0xa4, 0xa0, 0xdd, 0x24,
+    0x00, 0x07, 0xff, 0x00, 0x55, 0x2e, 0x01, 0x8b, 0xb4, 0x03, 0x40, 0x07, 0xff, 0x3c, 0x48, 0xc0,
+    0x88, 0x19, 0xb2, 0x1b, 0xa1, 0x00, 0x01, 0xaf, 0xe9, 0x00, 0x50, 0xee, 0x9d, 0xc0, 0x30, 0x46,
+    0xf8, 0x14, 0x60, 0x05, 0x20, 0x0d, 0x05, 0x00, 0x14, 0x36, 0x88, 0x02, 0x1b, 0x0c, 0x01, 0x0f,
+    0x40, 0x42, 0x0c, 0x17, 0xba, 0xf0, 0x0d, 0xff, 0xce, 0x19, 0xdc, 0x71, 0x50, 0x11, 0x32, 0xe1,
+    0x00, 0x0e, 0x19, 0x80, 0x11, 0x56, 0x5a, 0x00, 0x05, 0x5d, 0x78, 0x24, 0x40, 0x06, 0x00, 0x4b,
+    0x24, 0x7c, 0x0f, 0x1d, 0xa6, 0x60, 0x00, 0x87, 0x9c, 0x03, 0x59, 0x38, 0x04, 0x8b, 0xc0, 0x10,
+    0xd4, 0x11, 0x88, 0x59, 0x38, 0x73, 0x0a, 0xf8, 0x06, 0x30, 0xcf, 0xf1, 0x01, 0x6e, 0xe1, 0x00,
+    0x11, 0x63, 0x00, 0x0b, 0xff, 0xcc, 0x00, 0x7d, 0xd9, 0x80, 0x1e, 0x45, 0x00, 0x51, 0xfb, 0x00,
+    0x0a, 0xdd, 0x4b, 0x38, 0x09, 0x11, 0x1f, 0x02, 0x88, 0x03, 0x9a, 0x49, 0x1f, 0x03, 0x83, 0x69,
+    0x9c, 0x00, 0x9f, 0x80, 0x30, 0xc5, 0x00, 0x6b, 0x64, 0x00, 0x8d, 0x53, 0xa8, 0x43, 0xd7, 0x7d,
+    0xac, 0x4e, 0x00, 0x65, 0x4c, 0x03, 0x18, 0x91, 0x24, 0x8e, 0xdc, 0x3c, 0x37, 0x49, 0x20, 0xff,
+    0xf1, 0x05, 0x77, 0x20, 0x09, 0x9c, 0x45, 0x4c, 0x12, 0x40, 0x85, 0x60, 0x1b, 0xd0, 0x80, 0x22,
+    0x4f, 0x00, 0xd6, 0x48, 0x01, 0x9a, 0xc0, 0x33, 0x0b, 0x00, 0x40, 0x01, 0xaf, 0xe9, 0x00, 0x5b,
+    0x6e, 0x9d, 0xc0, 0x94, 0x46, 0xfa, 0x09, 0xa0, 0x29, 0x81, 0x6d, 0xfc, 0xec, 0x1a, 0xfb, 0x8d,
+    0x24, 0x70, 0x47, 0x2c, 0x43, 0x04, 0x72, 0x81, 0xad, 0xb8, 0xd4, 0x00, 0x01, 0xaf, 0xe9, 0x00,
+    0x68, 0xee, 0x92, 0x88, 0xe4, 0x8e, 0xd4, 0x03, 0x8c, 0x48, 0x90, 0x22, 0x96, 0x0f, 0x6e, 0xf3,
+    0x90, 0x2c, 0xf2, 0x81, 0x00, 0xa0, 0x5c, 0x02, 0x37, 0x90, 0x00, 0x1e, 0xc0, 0x01, 0x38, 0x0e,
+    0x58, 0x07, 0xf0, 0xe5, 0x80, 0x09, 0xc0, 0x1e, 0xc0, 0x01, 0xb8, 0x0e, 0xd8, 0x07, 0xfa, 0xa4,
+    0x00, 0xa2, 0x04, 0x18, 0x0e, 0x08, 0x00, 0x00, 0xe3, 0x00, 0x9b, 0x64, 0x1f, 0xaa, 0x6b, 0x76,
+    0xc4, 0x06, 0x44, 0x08, 0x02, 0xf7, 0x3a, 0x44, 0x0e, 0xf4, 0xe8, 0x02, 0x2a, 0xb0, 0xdf, 0xfd,
+    0x5f, 0xbb, 0xac, 0x8b, 0x87, 0xbf, 0xf5, 0x66, 0xee, 0xb0, 0x30, 0x0e, 0xec, 0x50, 0x0b, 0x6a,
+    0x35, 0x40, 0x0d, 0xb1, 0x34, 0x00, 0x1d, 0x22, 0xa7, 0x87, 0x23, 0xc7, 0xa4, 0x83, 0x60, 0x40,
+    0x20, 0x5f, 0xf6, 0x20, 0x2e, 0xe2, 0xd8, 0x81, 0x1c, 0x82, 0x00, 0x4a, 0x0e, 0x0b, 0xf5, 0x24,
+    0x06, 0x5e, 0xc0, 0x07, 0xe0, 0x0c, 0xa8, 0x01, 0xb6, 0x04, 0x00, 0x00, 0x02, 0xae, 0xe5, 0x90,
+    0x03, 0xcb, 0xb9, 0xb8, 0x0a, 0x10, 0x00, 0x60, 0x32, 0x70, 0x5d, 0xb3, 0x60, 0x0a, 0x21, 0x66,
+    0x01, 0x8d, 0x80, 0x84, 0x02, 0x35, 0x12, 0x70, 0x0a, 0x6f, 0x18, 0xc9, 0xc1, 0x37, 0x50, 0x0a,
+    0x12, 0x20, 0x1d, 0x87, 0xfe, 0xa0, 0x00, 0x00, 0x0f, 0xf0, 0x07, 0x21, 0x09, 0x00, 0x6f, 0x43,
+    0x50, 0x0c, 0x98, 0xb8, 0x01, 0x10, 0xbe, 0x20, 0x04, 0xa2, 0x48, 0x08, 0x00, 0xc1, 0xef, 0x0c,
+    0x00, 0x24, 0x7f, 0x99, 0x01, 0x01, 0x84, 0x5a, 0x62, 0x00, 0xdf, 0xf7, 0x48, 0x02, 0x3b, 0x5d,
+    0xc0, 0x22, 0x37, 0xc0, 0x08, 0x53, 0x42, 0x7f, 0x9d, 0x82, 0x37, 0x1a, 0x00, 0x48, 0xe9, 0x80,
+    0x44, 0x54, 0xa1, 0x1d, 0xaf, 0x40, 0x1a, 0xee, 0x50, 0x43, 0xee, 0x9e, 0x52, 0x8c, 0xd3, 0xc0,
+    0x19, 0x1c, 0x03, 0xff, 0x88, 0x8e, 0x94, 0x66, 0x9e, 0x87, 0xdd, 0x3c, 0x80, 0xdf, 0xf7, 0x40,
+    0x02, 0x3a, 0x99, 0x80, 0x01, 0x47, 0xd0, 0x0c, 0x20, 0x1f, 0xfc, 0x51, 0x00, 0x85, 0x1f, 0x42,
+    0x3a, 0x99, 0x80, 0xbf, 0xfd, 0x80, 0xdd, 0xd6, 0x80, 0x8f, 0x00, 0x7c, 0xff, 0xf2, 0x03, 0x6e,
+    0xc8, 0x02, 0x45, 0x00, 0x04, 0x78, 0x1b, 0xba, 0xd0, 0xdf, 0xfd, 0xa0, 0xfb, 0xb6, 0x07, 0x91,
+    0x42, 0x01, 0xf4, 0x7f, 0xce, 0x0f, 0xbb, 0x30, 0x79, 0x14, 0x20, 0x1f, 0xfc, 0x00, 0x1a, 0xee,
+    0x48, 0x5b, 0x66, 0xa4, 0x25, 0x11, 0xf6, 0x80, 0x63, 0x50, 0x02, 0xff, 0xb0, 0x00, 0xba, 0xe0,
+    0x18, 0x80, 0x09, 0x44, 0x6a, 0x96, 0xd9, 0xa9, 0x00, 0xd7, 0x00, 0x55, 0x00, 0x3f, 0xf8, 0xf1,
+    0xfe, 0x50, 0x03, 0xee, 0x90, 0x01, 0xe4, 0x41, 0x00, 0xff, 0xe0, 0x80, 0xbf, 0xfc, 0xf5, 0xa6,
+    0xda, 0xe2, 0x40, 0x24, 0x01, 0xff, 0xcd, 0x12, 0x01, 0x20, 0xad, 0x36, 0xd7, 0x00, 0x00, 0xec,
+    0x70, 0x0f, 0xfe, 0xba, 0x50, 0x04, 0x20, 0xca, 0xc4, 0xc4, 0x85, 0x57, 0xb7, 0x46, 0x00, 0xd7,
+    0x00, 0x3f, 0x00, 0x74, 0xc0, 0x06, 0x70, 0x60, 0x0d, 0x30, 0x01, 0x47, 0x8b, 0x00, 0x4f, 0x80,
+    0xc0, 0x17, 0x9b, 0xc0, 0x07, 0x40, 0x38, 0x07, 0x44, 0x04, 0x5f, 0x00, 0xff, 0xf2, 0x91, 0x60,
+    0x0b, 0x77, 0x10, 0x1f, 0xd0, 0x1f, 0xe0, 0x00, 0x93, 0xa0, 0x04, 0x8b, 0xb8, 0x01, 0x5d, 0x98,
+    0xc0, 0x22, 0x14, 0x00, 0xed, 0x91, 0x00, 0xff, 0xe5, 0x00, 0xee, 0x00, 0x22, 0xc0, 0x54, 0x03,
+    0x2f, 0x00, 0x6f, 0x41, 0x00, 0xca, 0xc0, 0x1b, 0xa8, 0x03, 0x21, 0x90, 0x06, 0x65, 0x00, 0xd4,
+    0x00, 0x00, 0x1a, 0xfe, 0x90, 0xb6, 0xdd, 0x3b, 0xd4, 0x46, 0xfa, 0x60, 0x18, 0x40, 0x3f, 0xf8,
+    0x06, 0x01, 0x85, 0xe8, 0x8d, 0xf6, 0xdb, 0x74, 0xee, 0x00, 0xdf, 0xfb, 0x0c, 0x01, 0x1d, 0xad,
+    0xa0, 0x10, 0x94, 0x89, 0x00, 0x6b, 0x02, 0x08, 0xff, 0x35, 0x80, 0x1f, 0x7b, 0x88, 0x00, 0xf2,
+    0x10, 0x0f, 0xfe, 0x28, 0x1a, 0xfe, 0x90, 0xa6, 0xdd, 0x3c, 0x24, 0x91, 0xb2, 0x00, 0x80, 0x3c,
+    0x03, 0xff, 0x84, 0x20, 0x0f, 0x04, 0x92, 0x36, 0x4a, 0x6d, 0xc5, 0x81, 0xaf, 0x76, 0x00, 0xd0,
+    0x12, 0x00, 0xdf, 0xfa, 0x84, 0x01, 0x1d, 0xad, 0x40, 0x10, 0x94, 0xa0, 0x07, 0x71, 0x80, 0x23,
+    0xfc, 0xdc, 0x00, 0x7d, 0x1a, 0x20, 0x07, 0x94, 0xc8, 0x03, 0x9c, 0x58, 0x03, 0x9e, 0xc0, 0x01,
+    0xbf, 0xe9, 0x00, 0x53, 0xee, 0x9d, 0xc0, 0xd4, 0x47, 0xa8, 0x0b, 0x0c, 0x46, 0x60, 0x88, 0x56,
+    0xe0, 0x80, 0x1b, 0x39, 0xe8, 0x24, 0x80, 0x75, 0x41, 0x24, 0x8e, 0x90, 0x3c, 0x37, 0x1a, 0xc0,
+    0x5f, 0xff, 0x0a, 0xee, 0x8d, 0xb7, 0x42, 0x04, 0x47, 0x12, 0x20, 0x07, 0xff, 0x94, 0xe6, 0x00,
+    0x4d, 0x80, 0x7f, 0xf4, 0x8c, 0x03, 0x0b, 0xd1, 0x1b, 0xed, 0xb6, 0xe9, 0xdc, 0x00, 0x4f, 0x00,
+    0x93, 0xc5, 0x01, 0x00, 0x18, 0x62, 0x09, 0xa0, 0x04, 0x40, 0x03, 0x10, 0x00, 0x78, 0x00, 0x42,
+    0x14, 0x04, 0x00, 0x18, 0xa6, 0x20, 0x06, 0x4c, 0x3c, 0x00, 0xd8, 0x88, 0x50, 0x0c, 0xe4, 0x24,
+    0x00, 0x00, 0xb7, 0x0c, 0xa0, 0x97, 0x2f, 0x01, 0x60, 0x22, 0x71, 0x08, 0xc0, 0xcc, 0x26, 0x26,
+    0x10, 0x32, 0x61, 0x6d, 0x63, 0x11, 0x11, 0x72, 0x90, 0x08, 0x63, 0x76, 0x30, 0x00, 0x94, 0x88,
+    0x84, 0x00, 0x61, 0x13, 0x8f, 0x00, 0x1f, 0x50, 0x04, 0x68, 0x0b, 0xd8, 0x0b, 0xc8, 0x02, 0x01,
+    0xe1, 0x10, 0x01, 0x5c, 0x34, 0x80, 0x65, 0x03, 0x20, 0x0c, 0xe4, 0x68, 0x01, 0x0c, 0x4b, 0xc8,
+    0x05, 0x68, 0x89, 0x36, 0x03, 0x59, 0x01, 0x88, 0x08, 0x5f, 0x10, 0x01, 0xf9, 0x29, 0x48, 0x02,
+    0x54, 0x82, 0x1c, 0x49, 0x60, 0x00, 0xa4, 0xd0, 0xa4, 0x01, 0x44, 0xac, 0x00, 0x65, 0x35, 0x20,
+    0x0e, 0x62, 0x00, 0xff, 0xe3, 0x80, 0xdf, 0xfd, 0x39, 0xba, 0xc0, 0xf1, 0x22, 0x51, 0xb0, 0x00,
+    0xdb, 0x80, 0x2e, 0x72, 0x00, 0x38, 0x40, 0x00, 0xa2, 0x40, 0x29, 0x46, 0x22, 0x0a, 0xa6, 0xed,
+    0x40, 0x6f, 0xf6, 0x80, 0xef, 0x80, 0x08, 0x80, 0x1f, 0xfd, 0x51, 0xfe, 0x6d, 0xd6, 0x00, 0x0e,
+    0x70, 0x0e, 0x6a, 0x00, 0xea, 0x23, 0x00, 0xc4, 0x94, 0x01, 0xdc, 0xc0, 0x1c, 0xa2, 0xc0, 0x1c,
+    0xf4, 0x01, 0xd4, 0x64, 0x01, 0x8c, 0xa8, 0x03, 0xad, 0x80, 0x39, 0xc5, 0x00, 0x30, 0xaf, 0x00,
+    0x1f, 0xf8, 0xc7, 0x70, 0x02, 0x22, 0x00, 0x7f, 0xf7, 0x87, 0xf8, 0x00, 0x3b, 0xb1, 0x80, 0x00,
+    0x76, 0x00, 0x4c, 0xa2, 0x60, 0x0b, 0xfa, 0x90, 0x50, 0x46, 0x52, 0x9b, 0x01, 0x6b, 0x00, 0x3f,
+    0xff, 0x01, 0xee, 0xf8, 0x00, 0x9c, 0x09, 0x08, 0x00, 0x01, 0xbf, 0xe9, 0x00, 0x58, 0x76, 0x3b,
+    0x82, 0xac, 0x49, 0x34, 0x17, 0x7b, 0x8a, 0x00, 0xa8, 0xee, 0x28, 0x08, 0x10, 0x1b, 0x80, 0xcc,
+    0xbe, 0x1c, 0x00, 0xd7, 0x00, 0xe1, 0x00, 0xef, 0xcf, 0xa0, 0x02, 0xf6, 0x3c, 0x05, 0x91, 0xa1,
+    0x80, 0x7f, 0xf0, 0x6c, 0x8d, 0x0c, 0x13, 0xf1, 0xa0, 0x1a, 0xee, 0x50, 0xdb, 0xee, 0x9e, 0x1e,
+    0xcc, 0xdf, 0xa6, 0x01, 0x12, 0x18, 0x04, 0x48, 0x8b, 0x32, 0xed, 0x87, 0xdc, 0x68, 0x00, 0x00,
+    0xd5, 0x40, 0x0f, 0x16, 0x7d, 0x80, 0x25, 0xf6, 0x10, 0x17, 0x48, 0xd0, 0x00, 0x60, 0x1c, 0x60,
+    0x19, 0x74, 0x8d, 0x02, 0x5f, 0x61, 0x00, 0x1a, 0xee, 0x48, 0x58, 0xfe, 0x23, 0xa7, 0x09, 0x2e,
+    0x0d, 0xf7, 0x18, 0x06, 0xfb, 0xab, 0x4e, 0x12, 0xb7, 0xb1, 0xec, 0x17, 0x00, 0x00, 0xa7, 0xfd,
+    0xc0, 0x03, 0x6b, 0xef, 0x00, 0x38, 0x20, 0x89, 0x3e, 0xc3, 0xfd, 0xc9, 0xb4, 0x1b, 0xac, 0x02,
+    0x10, 0x22, 0x80, 0x3f, 0xf9, 0x20, 0x2c, 0xfb, 0xaa, 0x4b, 0xec, 0x20, 0x2e, 0x91, 0xa0, 0x07,
+    0xc5, 0x80, 0x2e, 0x1e, 0x9f, 0x8c, 0x07, 0xdc, 0xd1, 0x00, 0x08, 0x1a, 0x68, 0x77, 0x31, 0x1c,
+    0xd7, 0x00, 0xff, 0xbb, 0x7e, 0x80, 0x0b, 0xf8, 0x8e, 0x16, 0x46, 0x9a, 0x01, 0x8c, 0x40, 0x3f,
+    0xf8, 0xc0, 0x00, 0x1a, 0x80, 0x77, 0xd0, 0x07, 0x67, 0x80, 0x55, 0xfe, 0xe0, 0x0a, 0xf6, 0x00,
+    0x30, 0x90, 0x80, 0x7f, 0xf1, 0x84, 0x84, 0x08, 0x81, 0xfb, 0x03, 0xba, 0x30, 0x00, 0x91, 0x00,
+    0x15, 0x48, 0x05, 0xdb, 0xdf, 0xf5, 0xfe, 0xe9, 0x80, 0x48, 0x80, 0x1f, 0xfc, 0x91, 0x11, 0x23,
+    0xee, 0x6d, 0x33, 0x80, 0xc8, 0x00, 0xff, 0xe2, 0x4e, 0x80, 0x63, 0x6e, 0x00, 0xdc, 0xc6, 0x00,
+    0x7f, 0x28, 0x00, 0x9b, 0x4a, 0x00, 0x21, 0x2e, 0x64, 0x00, 0xc6, 0xf4, 0x20, 0xaf, 0xf8, 0x40,
+    0x2b, 0xdb, 0x00, 0xe1, 0x26, 0x00, 0xff, 0xed, 0x98, 0x39, 0x10, 0x02, 0x18, 0x86, 0xe8, 0x80,
+    0x4d, 0xbd, 0x7e, 0x80, 0x01, 0x5b, 0x06, 0xb8, 0x00, 0x40, 0x44, 0x40, 0x20, 0x1f, 0xfd, 0x40,
+    0xd9, 0xdf, 0xa0, 0x01, 0x6f, 0x3b, 0x83, 0x00, 0x5f, 0x40, 0x31, 0x88, 0x07, 0xff, 0x18, 0x1a,
+    0xee, 0x48, 0x5b, 0x66, 0xbb, 0x92, 0x48, 0xdb, 0x04, 0x03, 0x38, 0x80, 0x67, 0x49, 0x23, 0x6c,
+    0xb6, 0xdd, 0x3b, 0x80, 0xd9, 0xdf, 0xa0, 0x01, 0x6f, 0x3c, 0x06, 0x00, 0xa1, 0x80, 0x7f, 0xf0,
+    0x6c, 0x8d, 0xcc, 0x13, 0xb1, 0x60, 0x3b, 0x3e, 0xc0, 0x02, 0x01, 0x80, 0x2c, 0xfb, 0xaa, 0x4b,
+    0xec, 0x20, 0x2e, 0x91, 0xa0, 0x00, 0xc0, 0x38, 0xc0, 0x32, 0xe9, 0x1a, 0x04, 0xbe, 0xc2, 0x01,
+    0x67, 0xd8, 0x07, 0xe0, 0x9b, 0xb7, 0xe9, 0x82, 0xcf, 0xbf, 0x82, 0x90, 0x79, 0x80, 0x65, 0xf0,
+    0x0f, 0xfe, 0x30, 0x3c, 0xff, 0x58, 0xfa, 0xff, 0x0b, 0x81, 0x20, 0x53, 0x70, 0x57, 0x70, 0xca,
+    0xfb, 0xd6, 0x36, 0x00, 0x40, 0x65, 0x7f, 0x9e, 0x00, 0x00, 0x37, 0x00, 0x7f, 0x9b, 0xe4, 0x7f,
+    0xd8, 0xdb, 0x03, 0xbb, 0x01, 0x08, 0x11, 0x04, 0x03, 0xff, 0x88, 0x62, 0x64, 0x20, 0x05, 0x56,
+    0x6d, 0x00, 0xe6, 0x00, 0x4d, 0x80, 0x7f, 0xf1, 0x8c, 0x40, 0x06, 0x29, 0x64, 0x69, 0x90, 0xdb,
+    0xa6, 0x60, 0x2f, 0x20, 0x02, 0xf8, 0x11, 0x28, 0x01, 0xca, 0x00, 0xa5, 0x00, 0x27, 0x00, 0x14,
+    0x88, 0xa2, 0x80, 0x02, 0x35, 0xf7, 0x00, 0xd7, 0x65, 0xd0, 0x0c, 0xc6, 0x28, 0x00, 0x00, 0x98,
+    0x0c, 0x90, 0xa5, 0xf2, 0x01, 0x50, 0x76, 0x56, 0x27, 0x10, 0x23, 0x23, 0x72, 0x64, 0x20, 0x11,
+    0x66, 0x96, 0xb8, 0x01, 0x5d, 0xde, 0x9a, 0x00, 0x21, 0x25, 0x22, 0x00, 0x0d, 0x90, 0x06, 0x58,
+    0x03, 0x98, 0xd8, 0xa8, 0x00, 0x71, 0xd3, 0x62, 0x01, 0x31, 0x11, 0x40, 0x35, 0xa1, 0xb8, 0x04,
+    0xaa, 0x9a, 0x82, 0x01, 0xb8, 0x24, 0x5f, 0x00, 0x2f, 0x30, 0x03, 0x70, 0x12, 0x50, 0x02, 0x9c,
+    0x01, 0xec, 0x04, 0x76, 0x00, 0x41, 0x6a, 0x32, 0x00, 0xa6, 0x96, 0x80, 0x33, 0x19, 0x30, 0x06,
+    0x13, 0x60, 0x0e, 0x23, 0xa0, 0x0e, 0xa3, 0x30, 0x04, 0x00, 0xcf, 0xfd, 0x1b, 0xdc, 0x90, 0xc1,
+    0x11, 0xcc, 0x90, 0x07, 0xdd, 0x80, 0x1a, 0xd0, 0x00, 0x91, 0x91, 0x19, 0xcb, 0x7b, 0x96, 0x00,
+    0x00, 0xd1, 0xd2, 0x01, 0x2b, 0xd4, 0x00, 0x44, 0x44, 0x10, 0x08, 0x4c, 0x03, 0x88, 0x40, 0x38,
+    0xc8, 0x02, 0xff, 0x4f, 0x00, 0x5b, 0xa6, 0xe0, 0x08, 0x89, 0xa4, 0x01, 0xc6, 0x40, 0x1c, 0x26,
+    0x20, 0x19, 0x8f, 0xa4, 0x02, 0x1d, 0xe8, 0x00, 0xb8, 0x00, 0xff, 0xe5, 0x00, 0xbd, 0x70, 0x0a,
+    0xae, 0x08, 0x00, 0x2c, 0x0c, 0x01, 0x10, 0x30, 0x04, 0xc0, 0x40, 0x13, 0x81, 0x00, 0x46, 0xdb,
+    0xf8, 0x06, 0xd7, 0xba, 0x07, 0x04, 0x21, 0x05, 0x02, 0x00, 0x8c, 0x18, 0x01, 0x9a, 0x88, 0x00,
+    0x6f, 0xd8, 0x04, 0x00, 0x07, 0xd9, 0x03, 0xd0, 0x89, 0x57, 0x63, 0x20, 0x4e, 0xaa, 0x41, 0x70,
+    0x16, 0xfb, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1, .adv_w = 128, .box_w = 3, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14, .adv_w = 128, .box_w = 6, .box_h = 4, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 25, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 62, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 106, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 142, .adv_w = 128, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 181, .adv_w = 128, .box_w = 2, .box_h = 4, .ofs_x = 3, .ofs_y = 5},
+    {.bitmap_index = 185, .adv_w = 128, .box_w = 5, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 215, .adv_w = 128, .box_w = 5, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 245, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 273, .adv_w = 128, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 293, .adv_w = 128, .box_w = 3, .box_h = 4, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 300, .adv_w = 128, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 304, .adv_w = 128, .box_w = 3, .box_h = 3, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 309, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 343, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 369, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 390, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 422, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 454, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 483, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 513, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 543, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 571, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 604, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 635, .adv_w = 128, .box_w = 4, .box_h = 7, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 647, .adv_w = 128, .box_w = 4, .box_h = 9, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 663, .adv_w = 128, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 686, .adv_w = 128, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 698, .adv_w = 128, .box_w = 6, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 721, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 748, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 791, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 826, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 854, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 877, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 899, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 921, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 942, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 969, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 988, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1006, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1023, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1050, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1059, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1082, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1106, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1130, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1156, .adv_w = 128, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1186, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1215, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1248, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1262, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1278, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1314, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1350, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1385, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1414, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1441, .adv_w = 128, .box_w = 4, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 1455, .adv_w = 128, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1488, .adv_w = 128, .box_w = 5, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1503, .adv_w = 128, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1519, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1525, .adv_w = 128, .box_w = 3, .box_h = 2, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 1529, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1555, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1577, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1599, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1623, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1645, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1670, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1696, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1714, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1741, .adv_w = 128, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1764, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1789, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1808, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1824, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1839, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1860, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1884, .adv_w = 128, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1908, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1923, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1945, .adv_w = 128, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1970, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1986, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2015, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2044, .adv_w = 128, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2072, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2106, .adv_w = 128, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2128, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2168, .adv_w = 128, .box_w = 2, .box_h = 12, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 2173, .adv_w = 128, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 2212, .adv_w = 128, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 2},
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {.range_start = 32, .range_length = 95, .glyph_id_start = 1,
+     .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0,
+     .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
+};
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+};
+
+const lv_font_t jetbrainsmono_medium_13_4bpp = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 13,
+    .base_line = 2,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = 1,
+    .underline_thickness = 0,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
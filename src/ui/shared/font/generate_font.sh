@@ -1,7 +1,7 @@
 #!/bin/bash
 
 # LVGL Binary Font Generator Script
-# Génère automatiquement des polices binaires LVGL avec conversion en tableaux C
+# Génère automatiquement des polices LVGL, converties en lv_font_t natifs (flash)
 #
 # Usage: ./generate_font.sh [OPTIONS]
 #
@@ -78,8 +78,8 @@ show_help() {
     echo "  $0 -f Arial.ttf -s 24 -b 4 -a my_arial_font"
     echo ""
     echo "Structure de sortie:"
-    echo "  bin/     : Fichiers binaires LVGL (.bin)"
-    echo "  data/    : Tableaux C (.c)"
+    echo "  bin/     : Fichiers binaires LVGL (.bin, temporaires)"
+    echo "  data/    : Polices LVGL natives (.c, lv_font_t en flash)"
     exit 0
 }
 
@@ -241,7 +241,8 @@ mkdir -p "$BIN_DIR" "$DATA_DIR"
 
 # Fichiers de sortie
 BIN_FILE="$BIN_DIR/${OUTPUT_NAME}.bin"
-CPP_FILE="$DATA_DIR/${OUTPUT_NAME}.c.inc"  # .c.inc to prevent individual compilation
+C_FILE="$DATA_DIR/${OUTPUT_NAME}.c"  # lv_font_t natif, compilé en flash
+CONVERTER="$(cd "$(dirname "$0")" && pwd)/../../../../script/binfont_to_c.py"
 
 log_info "Génération de la police:"
 log_info "  Police source : $FONT_FILE"
@@ -249,9 +250,9 @@ log_info "  Taille        : ${FONT_SIZE}px"
 log_info "  BPP           : ${BPP} bits/pixel"
 log_info "  Jeu de chars  : $CHARSET"
 log_info "  Plage         : $CHAR_RANGE"
-log_info "  Nom array     : $ARRAY_NAME"
+log_info "  Nom police    : $OUTPUT_NAME"
 log_info "  Fichier bin   : $BIN_FILE"
-log_info "  Fichier C++   : $CPP_FILE"
+log_info "  Fichier C     : $C_FILE"
 
 # Génération de la police binaire LVGL
 log_info "Génération du fichier binaire LVGL..."
@@ -273,52 +274,31 @@ fi
 BIN_SIZE=$(stat -c%s "$BIN_FILE" 2>/dev/null || stat -f%z "$BIN_FILE" 2>/dev/null || echo "?")
 log_success "Fichier binaire généré: ${BIN_SIZE} bytes"
 
-# Conversion en tableau C++ avec xxd
-log_info "Conversion en tableau C++..."
-xxd -i "$BIN_FILE" > "$CPP_FILE"
+# Conversion en lv_font_t natif (tables const en flash, rien à parser au boot)
+log_info "Conversion en police LVGL native..."
+python3 "$CONVERTER" "$BIN_FILE" "$OUTPUT_NAME" "$C_FILE"
 
-if [[ ! -f "$CPP_FILE" ]]; then
-    log_error "Échec de la conversion en tableau C++."
+if [[ ! -f "$C_FILE" ]]; then
+    log_error "Échec de la conversion en police native."
     exit 1
 fi
 
-# Nettoyage du nom de variable dans le fichier C++ (xxd utilise le chemin complet)
-# Remplacer le nom de variable généré automatiquement par xxd par le nom souhaité
-# Utilisation de PROGMEM pour stocker en Flash et économiser la RAM
-sed -i "s/unsigned char [^=]*=/const uint8_t ${ARRAY_NAME}[] PROGMEM =/g" "$CPP_FILE"
-sed -i "s/unsigned int [^;]*;/const uint32_t ${ARRAY_NAME}_len = $(stat -c%s "$BIN_FILE" 2>/dev/null || stat -f%z "$BIN_FILE");/g" "$CPP_FILE"
+log_success "Police native générée: $C_FILE"
 
-log_success "Tableau C généré: $CPP_FILE (included via binary_font_buffer.cpp)"
-
-# Génération d'un fichier header C++ pur
-HEADER_FILE="$DATA_DIR/${OUTPUT_NAME}.hpp"
-cat > "$HEADER_FILE" << EOF
-#pragma once
-
-#include <Arduino.h>
-
-
-extern const uint8_t ${ARRAY_NAME}[] PROGMEM;
-extern const uint32_t ${ARRAY_NAME}_len;
-EOF
-
-log_success "Header généré: $HEADER_FILE"
-
-# Suppression du fichier binaire temporaire (seul le .c.inc est nécessaire)
+# Suppression du fichier binaire temporaire (seul le .c est nécessaire)
 if [[ -f "$BIN_FILE" ]]; then
     rm "$BIN_FILE"
-    log_info "Fichier .bin temporaire supprimé (seul le .c.inc est utilisé)"
+    log_info "Fichier .bin temporaire supprimé (seul le .c est utilisé)"
 fi
 
 # Résumé final
 echo ""
 log_success "✅ Génération terminée avec succès !"
 echo ""
-echo -e "${GREEN}Fichiers générés:${NC}"
-echo -e "  📄 ${CPP_FILE}"
-echo -e "  📄 ${HEADER_FILE}"
+echo -e "${GREEN}Fichier généré:${NC}"
+echo -e "  📄 ${C_FILE}"
+echo ""
+echo -e "${BLUE}Usage dans le code (binary_font_buffer.cpp):${NC}"
+echo -e "  LV_FONT_DECLARE(${OUTPUT_NAME})"
+echo -e "  fonts.my_label = &${OUTPUT_NAME};"
 echo ""
-echo -e "${BLUE}Usage dans le code:${NC}"
-echo -e "  #include \"data/${OUTPUT_NAME}.hpp\""
-echo -e "  lv_font_t* font = lv_binfont_create_from_buffer(${ARRAY_NAME}, ${ARRAY_NAME}_len);"
-echo ""
\ No newline at end of file
@@ -51,6 +51,30 @@ public:
      */
     virtual void onDeactivate() = 0;
 
+    /**
+     * @brief Build the view's LVGL tree (lazy views)
+     *
+     * For views registered with ViewManager::registerPluginView, called
+     * right before the first onActivate(), and again after a hibernation.
+     * Views that build their tree in the constructor keep the default.
+     *
+     * @param parent Plugin screen to build under
+     * @return false if the tree could not be built (the view is not shown)
+     */
+    virtual bool create(lv_obj_t* parent) {
+        (void)parent;
+        return true;
+    }
+
+    /**
+     * @brief Free the LVGL tree, keep the model (hibernation)
+     *
+     * Called after onDeactivate() for views registered with hibernate set.
+     * getElement() returns nullptr until the next create(); the view keeps
+     * its values so create() can rebuild the same screen.
+     */
+    virtual void destroy() {}
+
     /**
      * @brief Get unique view identifier (for logging/debug)
      * @return String identifier (e.g., "bitwig.device", "ableton.mixer")
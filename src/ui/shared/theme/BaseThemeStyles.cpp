@@ -0,0 +1,107 @@
+#include "BaseThemeStyles.hpp"
+
+#include "BaseTheme.hpp"
+#include "font/binary_font_buffer.hpp"
+
+namespace BaseTheme {
+namespace Style {
+
+namespace {
+
+lv_style_t styles[COUNT];
+bool initialized = false;
+
+void initLabel(lv_style_t* style, const lv_font_t* font) {
+    if (font) {
+        lv_style_set_text_font(style, font);
+    }
+    lv_style_set_text_color(style, lv_color_hex(Color::TEXT_PRIMARY));
+    lv_style_set_text_align(style, LV_TEXT_ALIGN_CENTER);
+}
+
+void initFill(lv_style_t* style, uint32_t color) {
+    lv_style_set_bg_color(style, lv_color_hex(color));
+    lv_style_set_bg_opa(style, LV_OPA_COVER);
+}
+
+void initText(lv_style_t* style, uint32_t color, lv_opa_t opa = LV_OPA_COVER) {
+    lv_style_set_text_color(style, lv_color_hex(color));
+    lv_style_set_text_opa(style, opa);
+}
+
+void init() {
+    for (lv_style_t& style : styles) {
+        lv_style_init(&style);
+    }
+
+    lv_style_t* s = &styles[CONTAINER];
+    lv_style_set_bg_opa(s, LV_OPA_TRANSP);
+    lv_style_set_border_width(s, 0);
+    lv_style_set_pad_all(s, 0);
+
+    s = &styles[BOX];
+    lv_style_set_bg_opa(s, LV_OPA_COVER);
+    lv_style_set_border_width(s, 0);
+    lv_style_set_radius(s, 0);
+
+    lv_style_set_radius(&styles[ROUNDED_BOX], Metrics::BOX_RADIUS);
+    lv_style_set_radius(&styles[CIRCLE], LV_RADIUS_CIRCLE);
+
+    initFill(&styles[FILL_INACTIVE], Color::INACTIVE);
+    initFill(&styles[FILL_ACTIVE], Color::ACTIVE);
+    initFill(&styles[FILL_KNOB_VALUE], Color::KNOB_VALUE);
+
+    s = &styles[KNOB_ARC];
+    lv_style_set_arc_width(s, Metrics::KNOB_ARC_WIDTH);
+    lv_style_set_arc_color(s, lv_color_hex(Color::INACTIVE));
+
+    s = &styles[KNOB_ARC_TRACK];
+    lv_style_set_arc_width(s, Metrics::KNOB_ARC_WIDTH / 2);
+    lv_style_set_arc_color(s, lv_color_hex(Color::KNOB_TRACK));
+    lv_style_set_pad_all(s, Metrics::KNOB_ARC_WIDTH / 4);
+
+    s = &styles[KNOB_INDICATOR];
+    lv_style_set_line_width(s, Metrics::KNOB_INDICATOR_THICKNESS);
+    lv_style_set_line_color(s, lv_color_hex(Color::KNOB_VALUE));
+    lv_style_set_line_rounded(s, true);
+
+    initLabel(&styles[PARAMETER_LABEL], fonts.parameter_label);
+    lv_style_set_text_line_space(&styles[PARAMETER_LABEL], Metrics::LABEL_LINE_SPACING);
+    initLabel(&styles[VALUE_LABEL], fonts.parameter_value_label);
+
+    lv_style_set_text_color(&styles[TEXT_SECONDARY], lv_color_hex(Color::TEXT_SECONDARY));
+    lv_style_set_text_color(&styles[TEXT_INACTIVE], lv_color_hex(Color::INACTIVE));
+
+    s = &styles[LIST_ITEM];
+    lv_style_set_bg_opa(s, LV_OPA_TRANSP);
+    lv_style_set_pad_left(s, 8);
+    lv_style_set_pad_right(s, 16);
+    lv_style_set_pad_top(s, 6);
+    lv_style_set_pad_bottom(s, 6);
+    lv_style_set_pad_column(s, 8);  // Gap between bullet and label
+    lv_style_set_radius(s, LV_RADIUS_CIRCLE);
+    lv_style_set_border_width(s, 0);
+
+    s = &styles[LIST_ITEM_LABEL];
+    if (fonts.list_item_label) {
+        lv_style_set_text_font(s, fonts.list_item_label);
+    }
+    initText(s, Color::INACTIVE_LIGHTER);
+    initText(&styles[LIST_ITEM_FOCUSED], Color::TEXT_PRIMARY);
+    initText(&styles[LIST_ITEM_PRESSED], Color::TEXT_PRIMARY);
+    initText(&styles[LIST_ITEM_DISABLED], Color::INACTIVE_LIGHTER, LV_OPA_50);
+
+    initialized = true;
+}
+
+}  // namespace
+
+lv_style_t* get(Id id) {
+    if (!initialized) {
+        init();
+    }
+    return &styles[id < COUNT ? id : CONTAINER];
+}
+
+}  // namespace Style
+}  // namespace BaseTheme
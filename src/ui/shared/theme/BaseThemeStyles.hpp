@@ -0,0 +1,64 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+/**
+ * @brief Shared LVGL styles for the base theme widgets
+ *
+ * lv_obj_set_style_* stores every property in a local style owned by the
+ * object: a page of eight knobs carried ~40 local style allocations, each
+ * resolved on its own. The styles here are static lv_style_t built once (on
+ * first use, after load_fonts()) and attached with lv_obj_add_style: one
+ * list entry per object, the properties shared by every instance.
+ *
+ * Per-object values (sizes, positions) stay on the object. Two-state looks
+ * use LV_STATE_CHECKED instead of swapping local colours: a flash is
+ * lv_obj_add_state / lv_obj_remove_state on an object that has both
+ * FILL_INACTIVE and FILL_ACTIVE (selector LV_STATE_CHECKED).
+ */
+namespace BaseTheme {
+
+/** @brief Dimensions baked into the shared styles */
+namespace Metrics {
+constexpr uint8_t KNOB_ARC_WIDTH = 8;
+constexpr uint8_t KNOB_INDICATOR_THICKNESS = 8;
+constexpr uint8_t BOX_RADIUS = 8;
+constexpr int8_t LABEL_LINE_SPACING = -2;
+}  // namespace Metrics
+
+namespace Style {
+
+enum Id : uint8_t {
+    CONTAINER,        // transparent, no border, no padding
+    BOX,              // opaque, no border, square corners
+    ROUNDED_BOX,      // BOX_RADIUS corners (add after BOX)
+    CIRCLE,           // fully round (add after BOX)
+    FILL_INACTIVE,    // bg INACTIVE
+    FILL_ACTIVE,      // bg ACTIVE, usually with selector LV_STATE_CHECKED
+    FILL_KNOB_VALUE,  // bg KNOB_VALUE
+    KNOB_ARC,         // arc LV_PART_MAIN: inactive full range
+    KNOB_ARC_TRACK,   // arc LV_PART_INDICATOR: value track
+    KNOB_INDICATOR,   // lv_line from centre to value
+    PARAMETER_LABEL,  // parameter_label font, TEXT_PRIMARY, centred, tight lines
+    VALUE_LABEL,      // parameter_value_label font, TEXT_PRIMARY, centred
+    TEXT_SECONDARY,   // text colour override (add after a label style)
+    TEXT_INACTIVE,    // text colour override, usually with LV_STATE_CHECKED
+    LIST_ITEM,        // ListOverlay row: transparent pill, flex row padding
+    LIST_ITEM_LABEL,  // ListOverlay row text, INACTIVE_LIGHTER
+    LIST_ITEM_FOCUSED,   // with LV_STATE_FOCUSED
+    LIST_ITEM_PRESSED,   // with LV_STATE_PRESSED
+    LIST_ITEM_DISABLED,  // with LV_STATE_DISABLED
+    COUNT
+};
+
+/** @brief Shared style (built on the first call) */
+lv_style_t* get(Id id);
+
+inline void add(lv_obj_t* obj, Id id, lv_style_selector_t selector = 0) {
+    lv_obj_add_style(obj, get(id), selector);
+}
+
+}  // namespace Style
+}  // namespace BaseTheme
@@ -0,0 +1,115 @@
+#include "AnimationScheduler.hpp"
+
+#include <lvgl.h>
+
+#include "config/System.hpp"
+
+namespace {
+
+struct Animation {
+    void* owner;
+    uint32_t startMs;
+    uint32_t durationMs;
+    AnimationScheduler::StepCallback onStep;
+    AnimationScheduler::EndCallback onEnd;
+};
+
+Animation animations[System::UI::MAX_ANIMATIONS] = {};
+size_t active = 0;
+lv_timer_t* frameTimer = nullptr;
+
+void finish(void* owner, AnimationScheduler::StepCallback onStep,
+            AnimationScheduler::EndCallback onEnd) {
+    if (onStep) onStep(owner, 0xFF);
+    if (onEnd) onEnd(owner);
+}
+
+void frameCallback(lv_timer_t*) {
+    const uint32_t now = lv_tick_get();
+    for (auto& animation : animations) {
+        if (!animation.owner) continue;
+
+        const uint32_t elapsed = now - animation.startMs;
+        if (elapsed < animation.durationMs) {
+            if (animation.onStep) {
+                animation.onStep(animation.owner,
+                                 static_cast<uint8_t>(elapsed * 0xFF / animation.durationMs));
+            }
+            continue;
+        }
+
+        // Free the slot first: the callbacks may start a new animation
+        const Animation done = animation;
+        animation.owner = nullptr;
+        --active;
+        finish(done.owner, done.onStep, done.onEnd);
+    }
+
+    if (active == 0 && frameTimer) {
+        lv_timer_pause(frameTimer);
+    }
+}
+
+bool start(void* owner, uint32_t durationMs, AnimationScheduler::StepCallback onStep,
+           AnimationScheduler::EndCallback onEnd) {
+    if (!owner) return false;
+
+    Animation* slot = nullptr;
+    for (auto& animation : animations) {
+        if (animation.owner == owner) {
+            slot = &animation;
+            break;
+        }
+        if (!slot && !animation.owner) slot = &animation;
+    }
+    if (!slot) {
+        finish(owner, onStep, onEnd);
+        return false;
+    }
+
+    if (slot->owner != owner) ++active;
+    *slot = {owner, lv_tick_get(), durationMs, onStep, onEnd};
+
+    if (!frameTimer) {
+        frameTimer = lv_timer_create(frameCallback,
+                                     System::Display::FRAME_PERIOD_US / 1000, nullptr);
+    } else {
+        lv_timer_resume(frameTimer);
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace AnimationScheduler {
+
+bool flash(void* owner, uint32_t durationMs, EndCallback onEnd) {
+    return start(owner, durationMs, nullptr, onEnd);
+}
+
+bool fade(void* owner, uint32_t durationMs, StepCallback onStep, EndCallback onEnd) {
+    return start(owner, durationMs, onStep, onEnd);
+}
+
+void cancel(void* owner) {
+    for (auto& animation : animations) {
+        if (owner && animation.owner == owner) {
+            animation.owner = nullptr;
+            --active;
+            return;
+        }
+    }
+}
+
+bool isRunning(const void* owner) {
+    for (const auto& animation : animations) {
+        if (owner && animation.owner == owner) return true;
+    }
+    return false;
+}
+
+size_t activeCount() {
+    return active;
+}
+
+}  // namespace AnimationScheduler
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief One frame-driven scheduler for short widget animations
+ *
+ * Value-change flashes used to create and delete an lv_timer per widget on
+ * every change; turning eight encoders churned the LVGL timer list. Here
+ * every flash / fade is an entry in a fixed array (System::UI::MAX_ANIMATIONS)
+ * advanced once per frame by a single lv_timer, paused while nothing runs.
+ *
+ * Entries are keyed by owner (usually the widget's this): starting again for
+ * the same owner restarts its animation. Owners must cancel() in their
+ * destructor.
+ */
+namespace AnimationScheduler {
+
+/** @brief Called once when the animation ends */
+using EndCallback = void (*)(void* owner);
+
+/** @brief Called every frame, progress 0-255 (255 = last call) */
+using StepCallback = void (*)(void* owner, uint8_t progress);
+
+/**
+ * @brief Call onEnd after durationMs (restarts a running one for owner)
+ * @return false when MAX_ANIMATIONS are running (onEnd is called right away)
+ */
+bool flash(void* owner, uint32_t durationMs, EndCallback onEnd);
+
+/**
+ * @brief Call onStep every frame for durationMs, then onEnd (may be nullptr)
+ * @return false when MAX_ANIMATIONS are running (final step and onEnd called)
+ */
+bool fade(void* owner, uint32_t durationMs, StepCallback onStep, EndCallback onEnd = nullptr);
+
+/** @brief Drop owner's animation without calling its callbacks */
+void cancel(void* owner);
+
+bool isRunning(const void* owner);
+size_t activeCount();
+
+}  // namespace AnimationScheduler
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Arc geometry shared by the knob widgets, indicator end points precomputed
+ *
+ * ParameterKnobWidget and ParameterKnobLiteWidget draw the same arc: RADIUS
+ * pixels, clockwise from START_ANGLE over SWEEP_DEGREES. Values are
+ * quantized to whole degrees of the sweep, the unit lv_arc_set_angles()
+ * works in and finer than a pixel at the rim. A knob redraws only when its
+ * step changes, and the indicator end point of a step is a lookup in a
+ * table built at compile time (no trigonometry at run time).
+ */
+namespace KnobGeometry {
+
+constexpr uint16_t SIZE = 62;
+constexpr uint16_t RADIUS = SIZE / 2;
+constexpr int16_t START_ANGLE = 135;
+constexpr int16_t END_ANGLE = 45;
+constexpr uint16_t SWEEP_DEGREES = 270;
+constexpr uint16_t STEP_COUNT = SWEEP_DEGREES + 1;
+constexpr uint16_t NO_STEP = 0xFFFF;  // Nothing drawn yet
+
+/** @brief Offset from the arc center, screen axes (y down) */
+struct Point {
+    int8_t x;
+    int8_t y;
+};
+
+namespace detail {
+constexpr double HALF_TURN_RADIANS = 3.14159265358979323846;
+
+/* Taylor series on [-pi, pi], well below a pixel at RADIUS */
+constexpr double sine(double radians) {
+    while (radians > HALF_TURN_RADIANS) radians -= 2 * HALF_TURN_RADIANS;
+    while (radians < -HALF_TURN_RADIANS) radians += 2 * HALF_TURN_RADIANS;
+    double term = radians;
+    double sum = radians;
+    for (int n = 1; n < 12; ++n) {
+        term *= -radians * radians / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr int8_t roundToPixel(double value) {
+    return static_cast<int8_t>(value < 0 ? value - 0.5 : value + 0.5);
+}
+
+struct Table {
+    Point points[STEP_COUNT];
+
+    constexpr Table() : points() {
+        for (uint16_t step = 0; step < STEP_COUNT; ++step) {
+            const double radians = (START_ANGLE + step) * HALF_TURN_RADIANS / 180.0;
+            points[step].x = roundToPixel(RADIUS * sine(radians + HALF_TURN_RADIANS / 2));
+            points[step].y = roundToPixel(RADIUS * sine(radians));
+        }
+    }
+};
+
+inline constexpr Table TABLE{};
+}  // namespace detail
+
+/** @return 0 to SWEEP_DEGREES, nearest degree of the sweep */
+inline uint16_t step(float normalized) {
+    const float clamped = normalized < 0.0f ? 0.0f : (normalized > 1.0f ? 1.0f : normalized);
+    return static_cast<uint16_t>(clamped * SWEEP_DEGREES + 0.5f);
+}
+
+/** @return START_ANGLE to START_ANGLE + SWEEP_DEGREES (past 360 at the end of the sweep) */
+constexpr int16_t angle(uint16_t step) {
+    return static_cast<int16_t>(START_ANGLE + step);
+}
+
+/** @brief Indicator end point of a step, from the arc center */
+constexpr const Point& point(uint16_t step) {
+    return detail::TABLE.points[step];
+}
+
+static_assert(point(0).x == -22 && point(0).y == 22, "Sweep starts bottom left at 135 degrees");
+static_assert(point(135).x == 0 && point(135).y == -RADIUS, "Middle of the sweep points up");
+
+}  // namespace KnobGeometry
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "config/System.hpp"
+#include "core/util/Utf8.hpp"
+
+/**
+ * @brief Text of an LVGL label, kept in a widget-owned buffer and set only on change
+ *
+ * lv_label_set_text() frees, allocates and copies the string in the LVGL pool
+ * and invalidates the label on every call, same text or not. set() compares
+ * the new text with the shown one (FNV-1a hash and length, then the bytes)
+ * and returns at once when it is unchanged; otherwise it copies it into the
+ * buffer and points the label at it with lv_label_set_text_static(): one
+ * invalidation, no allocation. Text longer than Capacity - 1 bytes is
+ * truncated on a UTF-8 code point boundary.
+ *
+ * The label keeps a pointer into the buffer: delete the label before the
+ * LabelText (a widget member, with the container deleted in the widget's
+ * destructor).
+ */
+template <size_t Capacity = System::UI::TEXT_LAYOUT_MAX_BYTES>
+class LabelText {
+public:
+    LabelText() = default;
+    LabelText(const LabelText&) = delete;
+    LabelText& operator=(const LabelText&) = delete;
+
+    /** @return true if the label changed */
+    bool set(lv_obj_t* label, const char* text) {
+        if (!label) return false;
+        if (!text) text = "";
+
+        const size_t length = Utf8::safeLength(text, Capacity - 1);
+
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+        }
+
+        if (label == label_ && hash == hash_ && length == length_ &&
+            memcmp(text, text_, length) == 0) {
+            return false;
+        }
+
+        memcpy(text_, text, length);
+        text_[length] = '\0';
+        hash_ = hash;
+        length_ = length;
+        label_ = label;
+        lv_label_set_text_static(label, text_);
+        return true;
+    }
+
+    const char* c_str() const {
+        return text_;
+    }
+
+private:
+    char text_[Capacity] = {};
+    lv_obj_t* label_ = nullptr;  // Label showing text_, nullptr before the first set()
+    uint32_t hash_ = 0;
+    size_t length_ = 0;
+};
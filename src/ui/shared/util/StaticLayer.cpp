@@ -0,0 +1,184 @@
+#include "StaticLayer.hpp"
+
+#include "log/Macros.hpp"
+
+namespace {
+size_t totalBytes = 0;
+
+/* Container styles overridden while frozen: size kept, nothing drawn under the snapshot */
+constexpr lv_style_prop_t PINNED_PROPS[] = {
+    LV_STYLE_WIDTH,      LV_STYLE_HEIGHT,     LV_STYLE_BG_OPA,      LV_STYLE_BG_IMAGE_OPA,
+    LV_STYLE_BORDER_OPA, LV_STYLE_SHADOW_OPA, LV_STYLE_OUTLINE_OPA,
+};
+}  // namespace
+
+StaticLayer::StaticLayer(lv_obj_t* container) {
+    setContainer(container);
+}
+
+StaticLayer::~StaticLayer() {
+    setContainer(nullptr);
+}
+
+void StaticLayer::setContainer(lv_obj_t* container) {
+    if (container == container_) return;
+
+    if (container_) {
+        thaw();
+        lv_obj_remove_event_cb_with_user_data(container_, deleteCallback, this);
+    }
+    container_ = container;
+    if (container_) {
+        lv_obj_add_event_cb(container_, deleteCallback, LV_EVENT_DELETE, this);
+    }
+}
+
+bool StaticLayer::freeze() {
+    if (!container_) return false;
+    if (isFrozen()) return true;
+
+    if (lv_obj_get_child_cnt(container_) > hidden_.capacity()) {
+        LOGF("[StaticLayer] ERROR: Too many children to freeze (max %d)\n",
+             static_cast<int>(hidden_.capacity()));
+        return false;
+    }
+
+    // Children must be at their final place before the snapshot
+    lv_obj_update_layout(container_);
+
+    const lv_color_format_t format =
+        lv_obj_get_style_bg_opa(container_, LV_PART_MAIN) >= LV_OPA_MAX
+            ? LV_COLOR_FORMAT_RGB565
+            : LV_COLOR_FORMAT_RGB565A8;
+    const size_t bytes = estimateBytes(format);
+    if (totalBytes + bytes > System::UI::STATIC_LAYER_BUDGET_BYTES) {
+        LOGF("[StaticLayer] Over budget (%d + %d bytes), container stays live\n",
+             static_cast<int>(totalBytes), static_cast<int>(bytes));
+        return false;
+    }
+
+    snapshot_ = lv_snapshot_take(container_, format);
+    if (!snapshot_) {
+        LOGLN("[StaticLayer] ERROR: Snapshot failed, container stays live");
+        return false;
+    }
+    snapshotBytes_ = snapshot_->data_size;
+    totalBytes += snapshotBytes_;
+    extDrawSize_ = lv_obj_get_ext_draw_size(container_);
+
+    const uint32_t count = lv_obj_get_child_cnt(container_);
+    for (uint32_t i = 0; i < count; ++i) {
+        lv_obj_t* child = lv_obj_get_child(container_, static_cast<int32_t>(i));
+        if (lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+        hidden_.push_back(child);
+    }
+
+    lv_obj_add_event_cb(container_, drawCallback, LV_EVENT_DRAW_MAIN, this);
+    lv_obj_add_event_cb(container_, extDrawSizeCallback, LV_EVENT_REFR_EXT_DRAW_SIZE, this);
+    pinStyles();
+    return true;
+}
+
+void StaticLayer::thaw() {
+    if (!isFrozen()) return;
+
+    if (container_) {
+        lv_obj_remove_event_cb_with_user_data(container_, drawCallback, this);
+        lv_obj_remove_event_cb_with_user_data(container_, extDrawSizeCallback, this);
+        restoreStyles();
+        for (lv_obj_t* child : hidden_) {
+            lv_obj_clear_flag(child, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    hidden_.clear();
+
+    lv_draw_buf_destroy(snapshot_);
+    snapshot_ = nullptr;
+    totalBytes -= snapshotBytes_;
+    snapshotBytes_ = 0;
+}
+
+bool StaticLayer::refresh() {
+    thaw();
+    return freeze();
+}
+
+size_t StaticLayer::bytesInUse() {
+    return totalBytes;
+}
+
+void StaticLayer::pinStyles() {
+    static_assert(sizeof(PINNED_PROPS) / sizeof(PINNED_PROPS[0]) == PINNED_STYLES,
+                  "PINNED_STYLES must match PINNED_PROPS");
+
+    const int32_t width = lv_obj_get_width(container_);
+    const int32_t height = lv_obj_get_height(container_);
+    for (size_t i = 0; i < PINNED_STYLES; ++i) {
+        saved_[i].local = lv_obj_get_local_style_prop(container_, PINNED_PROPS[i],
+                                                      &saved_[i].value,
+                                                      LV_PART_MAIN) == LV_STYLE_RES_FOUND;
+    }
+
+    lv_obj_set_size(container_, width, height);
+    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_bg_image_opa(container_, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_border_opa(container_, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_shadow_opa(container_, LV_OPA_TRANSP, LV_PART_MAIN);
+    lv_obj_set_style_outline_opa(container_, LV_OPA_TRANSP, LV_PART_MAIN);
+}
+
+void StaticLayer::restoreStyles() {
+    for (size_t i = 0; i < PINNED_STYLES; ++i) {
+        if (saved_[i].local) {
+            lv_obj_set_local_style_prop(container_, PINNED_PROPS[i], saved_[i].value,
+                                        LV_PART_MAIN);
+        } else {
+            lv_obj_remove_local_style_prop(container_, PINNED_PROPS[i], LV_PART_MAIN);
+        }
+    }
+}
+
+size_t StaticLayer::estimateBytes(lv_color_format_t format) const {
+    const int32_t ext = lv_obj_get_ext_draw_size(container_);
+    const size_t pixels = static_cast<size_t>(lv_obj_get_width(container_) + 2 * ext) *
+                          static_cast<size_t>(lv_obj_get_height(container_) + 2 * ext);
+    return pixels * (format == LV_COLOR_FORMAT_RGB565 ? 2 : 3);
+}
+
+// ===== CALLBACKS =====
+
+/* The container draws nothing itself while frozen: the snapshot is its whole look */
+void StaticLayer::drawCallback(lv_event_t* e) {
+    auto* layer = static_cast<StaticLayer*>(lv_event_get_user_data(e));
+    if (!layer || !layer->snapshot_) return;
+
+    lv_area_t area;
+    lv_obj_get_coords(layer->container_, &area);
+    area.x1 -= layer->extDrawSize_;
+    area.y1 -= layer->extDrawSize_;
+    area.x2 = area.x1 + layer->snapshot_->header.w - 1;
+    area.y2 = area.y1 + layer->snapshot_->header.h - 1;
+
+    lv_draw_image_dsc_t image;
+    lv_draw_image_dsc_init(&image);
+    image.src = layer->snapshot_;
+    lv_draw_image(lv_event_get_layer(e), &image, &area);
+}
+
+/* Shadow and outline are transparent while frozen: keep the area the snapshot covers */
+void StaticLayer::extDrawSizeCallback(lv_event_t* e) {
+    auto* layer = static_cast<StaticLayer*>(lv_event_get_user_data(e));
+    if (!layer || !layer->snapshot_) return;
+    lv_event_set_ext_draw_size(e, layer->extDrawSize_);
+}
+
+/* The children go with the container: only the snapshot is left to free */
+void StaticLayer::deleteCallback(lv_event_t* e) {
+    auto* layer = static_cast<StaticLayer*>(lv_event_get_user_data(e));
+    if (!layer) return;
+
+    layer->container_ = nullptr;
+    layer->hidden_.clear();
+    layer->thaw();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <lvgl.h>
+#include <etl/vector.h>
+
+#include "config/System.hpp"
+
+/**
+ * @brief Render a container of static decorations once, blit it afterwards
+ *
+ * Borders, section titles and inactive arc tracks are re-rasterized every
+ * time something drawn over them changes. freeze() snapshots the container
+ * (background and children) into a draw buffer, hides the children and
+ * paints the snapshot from the container's LV_EVENT_DRAW_MAIN instead: a
+ * redraw of that area becomes one image blit.
+ *
+ * While frozen the container's own background, border, shadow and outline
+ * are made transparent (the snapshot already holds them, drawing both would
+ * blend them twice) and its size is pinned, so an LV_SIZE_CONTENT container
+ * does not collapse around its hidden children. thaw() puts the styles the
+ * container had back.
+ *
+ * Hidden children no longer invalidate anything, so changes to them are not
+ * shown until refresh() (or thaw()). Only freeze containers whose content is
+ * fixed for the life of the view; dynamic widgets belong in a sibling.
+ *
+ * All frozen layers share System::UI::STATIC_LAYER_BUDGET_BYTES. A freeze
+ * that would exceed it, or whose snapshot fails, leaves the container live.
+ *
+ * @code
+ * StaticLayer background_(frame_);  // member, after frame_ is built
+ * background_.freeze();
+ * @endcode
+ */
+class StaticLayer {
+public:
+    explicit StaticLayer(lv_obj_t* container = nullptr);
+    ~StaticLayer();
+
+    StaticLayer(const StaticLayer&) = delete;
+    StaticLayer& operator=(const StaticLayer&) = delete;
+
+    /** @brief Container to cache (thaws the previous one) */
+    void setContainer(lv_obj_t* container);
+
+    /**
+     * @brief Snapshot the container and hide its children
+     * @return false if over budget or the snapshot failed (container stays live)
+     */
+    bool freeze();
+
+    /** @brief Show the children again and free the snapshot */
+    void thaw();
+
+    /** @brief Re-snapshot after the static content changed */
+    bool refresh();
+
+    bool isFrozen() const { return snapshot_ != nullptr; }
+
+    /** @brief Bytes held by all frozen layers */
+    static size_t bytesInUse();
+
+private:
+    struct SavedStyle {
+        lv_style_value_t value;
+        bool local;  // Set on the object itself, else removed again on thaw
+    };
+    static constexpr size_t PINNED_STYLES = 7;
+
+    static void drawCallback(lv_event_t* e);
+    static void extDrawSizeCallback(lv_event_t* e);
+    static void deleteCallback(lv_event_t* e);
+
+    void pinStyles();
+    void restoreStyles();
+
+    /** @brief Snapshot size in bytes for the container as it is laid out now */
+    size_t estimateBytes(lv_color_format_t format) const;
+
+    lv_obj_t* container_ = nullptr;
+    lv_draw_buf_t* snapshot_ = nullptr;
+    size_t snapshotBytes_ = 0;
+    int32_t extDrawSize_ = 0;
+    etl::vector<lv_obj_t*, System::UI::STATIC_LAYER_MAX_CHILDREN> hidden_;
+    SavedStyle saved_[PINNED_STYLES] = {};
+};
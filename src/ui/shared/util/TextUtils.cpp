@@ -3,9 +3,276 @@
 #include <Arduino.h>
 #include <lvgl.h>
 #include <misc/lv_text_private.h>
+#include <string.h>
+
+#include "config/System.hpp"
+#include "core/util/Utf8.hpp"
+
+namespace {
+
+/*
+ * Buffer variant of formatTextForTwoLines
+ */
+constexpr uint8_t FIRST_ASCII = 32;
+constexpr uint8_t LAST_ASCII = 126;
+constexpr size_t ASCII_GLYPHS = LAST_ASCII - FIRST_ASCII + 1;
+constexpr size_t MAX_WORDS = 20;
+constexpr size_t MAX_LAYOUT_INPUT = 128;  // Longer text goes through the String version
+
+struct AdvanceTable {
+    const lv_font_t* font;
+    uint8_t advance[ASCII_GLYPHS];
+};
+
+struct CacheEntry {
+    const lv_font_t* font;
+    uint32_t hash;
+    uint32_t lastUse;
+    lv_coord_t width;
+    uint8_t sourceLength;
+    uint8_t length;
+    char source[System::UI::TEXT_LAYOUT_MAX_BYTES];  // Checked on a hit: hashes collide
+    char text[System::UI::TEXT_LAYOUT_MAX_BYTES];
+};
+
+AdvanceTable advanceTables[System::UI::TEXT_LAYOUT_FONTS] = {};
+CacheEntry layoutCache[System::UI::TEXT_LAYOUT_CACHE_ENTRIES] = {};
+uint32_t layoutClock = 0;
+
+const uint8_t* advancesFor(const lv_font_t* font) {
+    for (auto& table : advanceTables) {
+        if (table.font == font) return table.advance;
+        if (table.font) continue;
+
+        for (size_t i = 0; i < ASCII_GLYPHS; ++i) {
+            const uint16_t width = lv_font_get_glyph_width(font, FIRST_ASCII + i, 0);
+            table.advance[i] = width > 0xFF ? 0xFF : static_cast<uint8_t>(width);
+        }
+        table.font = font;
+        return table.advance;
+    }
+    return nullptr;
+}
+
+/* FNV-1a, length returned alongside; false if text is not printable ASCII */
+bool hashText(const char* text, uint32_t& hash, size_t& length) {
+    bool ascii = true;
+    hash = 2166136261u;
+    length = 0;
+    for (; text[length] != '\0'; ++length) {
+        const uint8_t c = static_cast<uint8_t>(text[length]);
+        if (c < FIRST_ASCII || c > LAST_ASCII) ascii = false;
+        hash = (hash ^ c) * 16777619u;
+    }
+    return ascii;
+}
+
+class LineWriter {
+public:
+    LineWriter(char* out, size_t capacity) : out_(out), capacity_(capacity) {}
+
+    void append(const char* text, size_t count) {
+        const size_t room = capacity_ - 1 - length_;
+        if (count > room) {
+            // Cut before the code point that does not fit, not inside it
+            count = Utf8::safeLength(text, room);
+            overflow_ = true;
+        }
+        memcpy(out_ + length_, text, count);
+        length_ += count;
+        out_[length_] = '\0';
+    }
+
+    size_t length() const { return length_; }
+    bool overflow() const { return overflow_; }
+
+private:
+    char* out_;
+    size_t capacity_;
+    size_t length_ = 0;
+    bool overflow_ = false;
+};
+
+class AsciiLayout {
+public:
+    AsciiLayout(const uint8_t* advance, lv_coord_t maxWidth)
+        : advance_(advance), maxWidth_(maxWidth) {}
+
+    lv_coord_t measure(const char* text, size_t count) const {
+        lv_coord_t width = 0;
+        for (size_t i = 0; i < count; ++i) {
+            width += advance_[static_cast<uint8_t>(text[i]) - FIRST_ASCII];
+        }
+        return width;
+    }
+
+    /* truncateWithEllipsis, measured incrementally */
+    void appendTruncated(LineWriter& out, const char* text, size_t count) const {
+        if (measure(text, count) <= maxWidth_) {
+            out.append(text, count);
+            return;
+        }
+
+        const lv_coord_t ellipsis = measure("...", 3);
+        lv_coord_t width = ellipsis;
+        size_t keep = 0;
+        while (keep < count - 1) {
+            width += advance_[static_cast<uint8_t>(text[keep]) - FIRST_ASCII];
+            if (width > maxWidth_) break;
+            ++keep;
+        }
+        out.append(text, keep);
+        out.append("...", 3);
+    }
+
+    /* text: single spaces between words, no leading/trailing space */
+    void layout(LineWriter& out, const char* text, size_t length) const {
+        struct Word {
+            uint16_t start;
+            uint16_t length;
+            lv_coord_t width;
+        };
+        Word words[MAX_WORDS];
+        size_t count = 0;
+        size_t start = 0;
+        for (size_t i = 0; i <= length && count < MAX_WORDS; ++i) {
+            if (i == length || text[i] == ' ') {
+                words[count++] = {static_cast<uint16_t>(start), static_cast<uint16_t>(i - start),
+                                  measure(text + start, i - start)};
+                start = i + 1;
+            }
+        }
+
+        const lv_coord_t space = advance_[0];
+        auto span = [&](size_t first, size_t last) -> size_t {
+            return words[last].start + words[last].length - words[first].start;
+        };
+
+        // Greedy line from word first: index of its last word, or first - 1 if none fits
+        auto fill = [&](size_t first) -> size_t {
+            lv_coord_t width = 0;
+            size_t last = first;
+            for (size_t i = first; i < count; ++i) {
+                const lv_coord_t test = (i == first) ? words[i].width
+                                                     : width + space + words[i].width;
+                if (test > maxWidth_) break;
+                width = test;
+                last = i + 1;
+            }
+            return last;  // One past the last word that fits
+        };
+
+        if (words[0].width > maxWidth_) {
+            appendTruncated(out, text, words[0].length);
+            if (count > 1) {
+                size_t end = fill(1);
+                if (end == 1) end = 2;  // First word alone, truncated below
+                out.append("\n", 1);
+                appendTruncated(out, text + words[1].start, span(1, end - 1));
+            }
+            return;
+        }
+
+        const size_t end1 = fill(0);
+        out.append(text, span(0, end1 - 1));
+        if (end1 >= count) return;
+
+        out.append("\n", 1);
+        const size_t end2 = fill(end1);
+        if (end2 == end1) {
+            appendTruncated(out, text + words[end1].start, words[end1].length);
+        } else {
+            out.append(text + words[end1].start, span(end1, end2 - 1));
+        }
+    }
+
+private:
+    const uint8_t* advance_;
+    lv_coord_t maxWidth_;
+};
+
+/* Collapse space runs, trim; returns new length */
+size_t normalizeSpaces(const char* text, size_t length, char* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (text[i] == ' ' && (written == 0 || out[written - 1] == ' ')) continue;
+        out[written++] = text[i];
+    }
+    if (written > 0 && out[written - 1] == ' ') --written;
+    return written;
+}
+
+}  // namespace
 
 namespace TextUtils {
 
+size_t formatTextForTwoLines(const char* text, lv_coord_t max_width, const lv_font_t* font,
+                             char* out, size_t capacity) {
+    if (!out || capacity == 0) return 0;
+    LineWriter writer(out, capacity);
+    out[0] = '\0';
+    if (!text) return 0;
+
+    uint32_t hash;
+    size_t length;
+    const bool ascii = hashText(text, hash, length);
+    if (!font) {
+        writer.append(text, length);
+        return writer.length();
+    }
+
+    for (auto& entry : layoutCache) {
+        if (entry.font == font && entry.hash == hash && entry.width == max_width &&
+            entry.sourceLength == length && memcmp(entry.source, text, length) == 0) {
+            entry.lastUse = ++layoutClock;
+            writer.append(entry.text, entry.length);
+            return writer.length();
+        }
+    }
+
+    const uint8_t* advance = ascii && length <= MAX_LAYOUT_INPUT ? advancesFor(font) : nullptr;
+    if (advance) {
+        AsciiLayout layout(advance, max_width);
+        if (layout.measure(text, length) <= max_width) {
+            writer.append(text, length);
+        } else {
+            char normalized[MAX_LAYOUT_INPUT];
+            const size_t count = normalizeSpaces(text, length, normalized);
+            if (count == 0) {
+                writer.append(text, length);
+            } else {
+                layout.layout(writer, normalized, count);
+            }
+        }
+    } else {
+        const String formatted = formatTextForTwoLines(String(text), max_width, font);
+        writer.append(formatted.c_str(), formatted.length());
+    }
+
+    if (writer.overflow() || writer.length() >= System::UI::TEXT_LAYOUT_MAX_BYTES ||
+        length >= System::UI::TEXT_LAYOUT_MAX_BYTES) {
+        return writer.length();
+    }
+
+    CacheEntry* victim = &layoutCache[0];
+    for (auto& entry : layoutCache) {
+        if (!entry.font) {
+            victim = &entry;
+            break;
+        }
+        if (entry.lastUse < victim->lastUse) victim = &entry;
+    }
+    victim->font = font;
+    victim->hash = hash;
+    victim->width = max_width;
+    victim->lastUse = ++layoutClock;
+    victim->sourceLength = static_cast<uint8_t>(length);
+    memcpy(victim->source, text, length);
+    victim->length = static_cast<uint8_t>(writer.length());
+    memcpy(victim->text, out, writer.length() + 1);
+    return writer.length();
+}
+
 String formatTextForTwoLines(const String& text, lv_coord_t max_width, const lv_font_t* font) {
     if (!font) return text;
 
@@ -7,6 +7,21 @@ namespace TextUtils {
 
 String formatTextForTwoLines(const String& text, lv_coord_t max_width, const lv_font_t* font);
 
+/**
+ * @brief formatTextForTwoLines into a caller buffer, without heap allocation
+ *
+ * Same layout rules. ASCII text is measured with a per-font table of glyph
+ * advances (our fonts have no kerning, so the sums are exact) and results
+ * are memoized, keyed on (text hash, width, font): a name the host sends
+ * again costs one lookup. Non-ASCII text goes through the String version.
+ *
+ * @param out Destination, always NUL terminated (truncated to capacity, on a
+ *            UTF-8 code point boundary)
+ * @return Length written, without the NUL
+ */
+size_t formatTextForTwoLines(const char* text, lv_coord_t max_width, const lv_font_t* font,
+                             char* out, size_t capacity);
+
 String truncateWithEllipsis(const String& text, lv_coord_t max_width, const lv_font_t* font);
 
 String sanitizeText(const String& text);
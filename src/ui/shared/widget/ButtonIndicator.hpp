@@ -25,6 +25,10 @@ public:
 
     void setState(State state);
 
+    State getState() const {
+        return current_state_;
+    }
+
     void setCustomColor(State state, lv_color_t color);
     void setCustomOpacity(State state, lv_opa_t opacity);
 
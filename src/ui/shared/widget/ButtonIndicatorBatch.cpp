@@ -0,0 +1,65 @@
+#include "ButtonIndicatorBatch.hpp"
+
+#include "log/Macros.hpp"
+
+ButtonIndicatorBatch::ButtonIndicatorBatch(lv_display_t* display)
+    : display_(display ? display : lv_display_get_default()) {
+    if (display_) {
+        lv_display_add_event_cb(display_, frameStartCallback, LV_EVENT_REFR_START, this);
+    } else {
+        LOGLN("[ButtonIndicatorBatch] WARNING: No display, call flush() manually");
+    }
+}
+
+ButtonIndicatorBatch::~ButtonIndicatorBatch() {
+    if (display_) {
+        lv_display_remove_event_cb_with_user_data(display_, frameStartCallback, this);
+    }
+}
+
+bool ButtonIndicatorBatch::bind(Slot slot, ButtonIndicator* indicator) {
+    if (slot >= MAX_SLOTS || !indicator) return false;
+
+    const uint32_t bit = 1u << slot;
+    indicators_[slot] = indicator;
+    bound_ |= bit;
+
+    // Shown = what the indicator displays now; flush() corrects it if the target differs
+    shownActive_ &= ~bit;
+    shownPressed_ &= ~bit;
+    switch (indicator->getState()) {
+        case ButtonIndicator::State::PRESSED: shownPressed_ |= bit; break;
+        case ButtonIndicator::State::ACTIVE: shownActive_ |= bit; break;
+        default: break;
+    }
+    return true;
+}
+
+void ButtonIndicatorBatch::unbind(Slot slot) {
+    if (slot >= MAX_SLOTS) return;
+    indicators_[slot] = nullptr;
+    bound_ &= ~(1u << slot);
+}
+
+void ButtonIndicatorBatch::setStates(uint32_t activeMask, uint32_t pressedMask) {
+    active_ = activeMask;
+    pressed_ = pressedMask;
+}
+
+void ButtonIndicatorBatch::flush() {
+    // A bit may flip without changing the state (ACTIVE under PRESSED): setState() ignores it
+    uint32_t changed = ((active_ ^ shownActive_) | (pressed_ ^ shownPressed_)) & bound_;
+    while (changed) {
+        const uint32_t index = static_cast<uint32_t>(__builtin_ctz(changed));
+        changed &= changed - 1;
+        indicators_[index]->setState(stateOf(1u << index, active_, pressed_));
+    }
+
+    shownActive_ = active_;
+    shownPressed_ = pressed_;
+}
+
+void ButtonIndicatorBatch::frameStartCallback(lv_event_t* e) {
+    auto* batch = static_cast<ButtonIndicatorBatch*>(lv_event_get_user_data(e));
+    if (batch) batch->flush();
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <lvgl.h>
+#include <etl/array.h>
+
+#include <cstdint>
+
+#include "ButtonIndicator.hpp"
+
+/**
+ * @brief Applies button indicator states from bitmasks, once per frame
+ *
+ * A combo or page change that calls ButtonIndicator::setState on a dozen
+ * indicators restyles them one by one as the states arrive. Bound through a
+ * batch, the new states are given as two masks; the batch keeps the last
+ * masks applied and, at the display's LV_EVENT_REFR_START, restyles only the
+ * indicators whose bits changed, all in the frame about to render.
+ *
+ * Slots are mask bits. Bind each indicator at buttonIndex() of its button
+ * and the button layer's own mask (ControllerAPI::getPressedButtonMask())
+ * goes in as is:
+ *
+ * @code
+ * ButtonIndicatorBatch batch;
+ * batch.bind(buttonIndex(ButtonID::LEFT_TOP), &leftTop);
+ * batch.setStates(armedMask, api.getPressedButtonMask());
+ * @endcode
+ *
+ * Unbind (or destroy the batch) before deleting a bound indicator.
+ */
+class ButtonIndicatorBatch {
+public:
+    using Slot = uint8_t;
+    static constexpr size_t MAX_SLOTS = 32;
+
+    /** @param display Display whose frames apply the states (nullptr = default) */
+    explicit ButtonIndicatorBatch(lv_display_t* display = nullptr);
+    ~ButtonIndicatorBatch();
+
+    ButtonIndicatorBatch(const ButtonIndicatorBatch&) = delete;
+    ButtonIndicatorBatch& operator=(const ButtonIndicatorBatch&) = delete;
+
+    /** @return false if slot >= MAX_SLOTS or indicator is nullptr */
+    bool bind(Slot slot, ButtonIndicator* indicator);
+    void unbind(Slot slot);
+
+    /**
+     * @brief Target state of every bound indicator
+     *
+     * PRESSED where pressedMask has the slot's bit, else ACTIVE where
+     * activeMask has it, else OFF.
+     */
+    void setStates(uint32_t activeMask, uint32_t pressedMask);
+
+    /** @brief Apply changed states now (also done at every frame start) */
+    void flush();
+
+private:
+    static void frameStartCallback(lv_event_t* e);
+
+    static ButtonIndicator::State stateOf(uint32_t bit, uint32_t active, uint32_t pressed) {
+        return (pressed & bit)  ? ButtonIndicator::PRESSED
+               : (active & bit) ? ButtonIndicator::ACTIVE
+                                : ButtonIndicator::OFF;
+    }
+
+    lv_display_t* display_;
+    etl::array<ButtonIndicator*, MAX_SLOTS> indicators_ = {};
+    uint32_t bound_ = 0;
+    uint32_t active_ = 0;  // Target masks
+    uint32_t pressed_ = 0;
+    uint32_t shownActive_ = 0;  // Masks the indicators show
+    uint32_t shownPressed_ = 0;
+};
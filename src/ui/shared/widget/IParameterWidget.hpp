@@ -11,6 +11,7 @@
  *
  * Defines common operations for all parameter widget types:
  * - ParameterKnobWidget (continuous/centered knobs)
+ * - ParameterKnobLiteWidget (same knob, drawn on a single object)
  * - ParameterListWidget (enum/list selectors)
  * - ParameterButtonWidget (toggle buttons)
  */
@@ -3,7 +3,7 @@
 #include <cstring>
 
 #include "font/binary_font_buffer.hpp"
-#include "theme/BaseTheme.hpp"
+#include "theme/BaseThemeStyles.hpp"
 
 using namespace BaseTheme;
 
@@ -34,9 +34,13 @@ void ListOverlay::setTitle(const std::string& title) {
 
 void ListOverlay::setItems(const std::vector<std::string>& items) {
     items_ = items;
+    item_count_ = items_.size();
+    item_provider_ = nullptr;
+    virtualized_ = false;
+    window_start_ = 0;
 
-    if (selected_index_ >= static_cast<int>(items_.size())) {
-        selected_index_ = items_.empty() ? 0 : items_.size() - 1;
+    if (selected_index_ >= static_cast<int>(item_count_)) {
+        selected_index_ = item_count_ == 0 ? 0 : item_count_ - 1;
     }
     if (selected_index_ < 0) {
         selected_index_ = 0;
@@ -51,19 +55,49 @@ void ListOverlay::setItems(const std::vector<std::string>& items) {
     }
 }
 
+void ListOverlay::setItemSource(size_t count, ItemProvider provider) {
+    items_.clear();
+    items_.shrink_to_fit();
+    item_count_ = count;
+    item_provider_ = std::move(provider);
+    virtualized_ = true;
+
+    if (selected_index_ >= static_cast<int>(item_count_)) {
+        selected_index_ = item_count_ == 0 ? 0 : item_count_ - 1;
+    }
+    if (selected_index_ < 0) {
+        selected_index_ = 0;
+    }
+
+    if (!ui_created_ || !list_) return;
+
+    // Same row count as before: relabel in place instead of rebuilding
+    const size_t rows = count < System::UI::LIST_VIRTUAL_ROWS ? count
+                                                              : System::UI::LIST_VIRTUAL_ROWS;
+    if (rows != buttons_.size()) {
+        destroyList();
+        createList();
+        populateList();
+    }
+    updateWindow(true);
+    updateHighlight();
+    scrollToSelected();
+}
+
 void ListOverlay::setSelectedIndex(int index) {
-    if (items_.empty()) {
+    if (item_count_ == 0) {
         selected_index_ = 0;
         return;
     }
 
-    int size = static_cast<int>(items_.size());
+    int size = static_cast<int>(item_count_);
     index = ((index % size) + size) % size;  // Handle negative wrapping too
 
     if (selected_index_ != index) {
         selected_index_ = index;
 
         if (ui_created_ && visible_) {
+            updateWindow(false);
             updateHighlight();
             scrollToSelected();
         }
@@ -76,6 +110,7 @@ void ListOverlay::show() {
         lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
         visible_ = true;
 
+        updateWindow(false);
         updateHighlight();
         scrollToSelected();
     }
@@ -93,14 +128,16 @@ bool ListOverlay::isVisible() const {
 }
 
 int ListOverlay::getSelectedIndex() const {
-    return items_.empty() ? -1 : selected_index_;
+    return item_count_ == 0 ? -1 : selected_index_;
 }
 
 int ListOverlay::getItemCount() const {
-    return items_.size();
+    return item_count_;
 }
 
 lv_obj_t* ListOverlay::getButton(size_t index) const {
+    if (index < window_start_) return nullptr;
+    index -= window_start_;
     return (index < buttons_.size()) ? buttons_[index] : nullptr;
 }
 
@@ -184,51 +221,93 @@ void ListOverlay::populateList() {
     buttons_.clear();
     bullets_.clear();
 
-    for (const auto& item : items_) {
-        lv_obj_t* btn = lv_obj_create(list_);
-        lv_obj_set_width(btn, LV_PCT(100));
-        lv_obj_set_height(btn, LV_SIZE_CONTENT);
+    size_t rows = item_count_;
+    if (virtualized_) {
+        rows = item_count_ < System::UI::LIST_VIRTUAL_ROWS ? item_count_
+                                                           : System::UI::LIST_VIRTUAL_ROWS;
+        updateWindow(false);
+    }
+
+    for (size_t i = 0; i < rows; ++i) {
+        buttons_.push_back(createButton(itemText(window_start_ + i)));
+        bullets_.push_back(nullptr);  // No bullet anymore, but keep array size consistent
+    }
+
+    updateHighlight();
+}
 
-        lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, LV_STATE_CHECKED);
+const char* ListOverlay::itemText(size_t index) const {
+    if (!virtualized_) {
+        return index < items_.size() ? items_[index].c_str() : "";
+    }
+    const char* text = item_provider_ ? item_provider_(index) : nullptr;
+    return text ? text : "";
+}
 
-        lv_obj_set_style_pad_left(btn, 8, 0);
-        lv_obj_set_style_pad_right(btn, 16, 0);
-        lv_obj_set_style_pad_top(btn, 6, 0);
-        lv_obj_set_style_pad_bottom(btn, 6, 0);
-        lv_obj_set_style_pad_column(btn, 8, 0);  // Gap between bullet and label
+lv_obj_t* ListOverlay::createButton(const char* text) {
+    lv_obj_t* btn = lv_obj_create(list_);
+    lv_obj_set_width(btn, LV_PCT(100));
+    lv_obj_set_height(btn, LV_SIZE_CONTENT);
+    Style::add(btn, Style::LIST_ITEM);
+    Style::add(btn, Style::LIST_ITEM, LV_STATE_CHECKED);  // No checked highlight
 
-        lv_obj_set_style_radius(btn, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_border_width(btn, 0, 0);
+    lv_obj_set_flex_flow(btn, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(btn, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
-        lv_obj_set_flex_flow(btn, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(btn, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_t* label = lv_label_create(btn);
+    lv_label_set_text(label, text);
 
-        lv_obj_t* label = lv_label_create(btn);
-        lv_label_set_text(label, item.c_str());
+    // Text color per state, shared by every row
+    Style::add(label, Style::LIST_ITEM_LABEL);
+    Style::add(label, Style::LIST_ITEM_FOCUSED, LV_STATE_FOCUSED);
+    Style::add(label, Style::LIST_ITEM_PRESSED, LV_STATE_PRESSED);
+    Style::add(label, Style::LIST_ITEM_DISABLED, LV_STATE_DISABLED);
 
-        // Configure text styles for different states
-        lv_obj_set_style_text_color(label, lv_color_hex(Color::INACTIVE_LIGHTER), LV_STATE_DEFAULT);
-        lv_obj_set_style_text_opa(label, LV_OPA_COVER, LV_STATE_DEFAULT);
+    return btn;
+}
 
-        lv_obj_set_style_text_color(label, lv_color_hex(Color::TEXT_PRIMARY), LV_STATE_FOCUSED);
-        lv_obj_set_style_text_opa(label, LV_OPA_COVER, LV_STATE_FOCUSED);
+/*
+ * Virtualized mode: buttons_[i] shows item window_start_ + i. The window
+ * moves only when the selection gets closer than LIST_VIRTUAL_MARGIN rows
+ * to its edge, then every row is relabeled (a handful of lv_label_set_text).
+ */
+void ListOverlay::updateWindow(bool force) {
+    if (!virtualized_) {
+        window_start_ = 0;
+        return;
+    }
 
-        lv_obj_set_style_text_color(label, lv_color_white(), LV_STATE_PRESSED);
-        lv_obj_set_style_text_opa(label, LV_OPA_COVER, LV_STATE_PRESSED);
+    const size_t rows = item_count_ < System::UI::LIST_VIRTUAL_ROWS
+                            ? item_count_
+                            : System::UI::LIST_VIRTUAL_ROWS;
+    const size_t margin = rows > 2 * System::UI::LIST_VIRTUAL_MARGIN
+                              ? System::UI::LIST_VIRTUAL_MARGIN
+                              : 0;
+    const size_t selected = static_cast<size_t>(selected_index_);
+
+    size_t start = window_start_;
+    if (selected < start + margin) {
+        start = selected > margin ? selected - margin : 0;
+    } else if (selected + margin >= start + rows) {
+        start = selected + margin + 1 - rows;
+    }
+    if (start + rows > item_count_) {
+        start = item_count_ - rows;
+    }
 
-        lv_obj_set_style_text_color(label, lv_color_hex(Color::INACTIVE_LIGHTER), LV_STATE_DISABLED);
-        lv_obj_set_style_text_opa(label, LV_OPA_50, LV_STATE_DISABLED);
+    if (start == window_start_ && !force) return;
+    window_start_ = start;
 
-        if (fonts.list_item_label) {
-            lv_obj_set_style_text_font(label, fonts.list_item_label, 0);
+    for (size_t i = 0; i < buttons_.size(); ++i) {
+        lv_obj_t* label = lv_obj_get_child(buttons_[i], 0);
+        if (label) {
+            lv_label_set_text(label, itemText(window_start_ + i));
         }
-
-        buttons_.push_back(btn);
-        bullets_.push_back(nullptr);  // No bullet anymore, but keep array size consistent
     }
+}
 
-    updateHighlight();
+int ListOverlay::selectedRow() const {
+    return selected_index_ - static_cast<int>(window_start_);
 }
 
 // Helper: recursively apply/clear state on an object and all descendants
@@ -250,8 +329,8 @@ static void applyStateRecursive(lv_obj_t* obj, lv_state_t state, bool apply) {
 }
 
 void ListOverlay::updateHighlight() {
-    if (buttons_.empty() || selected_index_ < 0 ||
-        selected_index_ >= static_cast<int>(buttons_.size())) {
+    const int row = selectedRow();
+    if (buttons_.empty() || row < 0 || row >= static_cast<int>(buttons_.size())) {
         return;
     }
 
@@ -261,16 +340,17 @@ void ListOverlay::updateHighlight() {
     }
 
     // Set focused state on selected button and all its descendants
-    applyStateRecursive(buttons_[selected_index_], LV_STATE_FOCUSED, true);
+    applyStateRecursive(buttons_[row], LV_STATE_FOCUSED, true);
 }
 
 void ListOverlay::scrollToSelected() {
-    if (buttons_.empty() || selected_index_ < 0 ||
-        selected_index_ >= static_cast<int>(buttons_.size()) || !list_) {
+    const int row = selectedRow();
+    if (buttons_.empty() || row < 0 || row >= static_cast<int>(buttons_.size()) || !list_) {
         return;
     }
 
-    lv_obj_scroll_to_view(buttons_[selected_index_], LV_ANIM_ON);
+    // Rows were just relabeled under the viewport in virtualized mode: no animation
+    lv_obj_scroll_to_view(buttons_[row], virtualized_ ? LV_ANIM_OFF : LV_ANIM_ON);
 }
 
 void ListOverlay::destroyList() {
@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 #include "../interface/IComponent.hpp"
+#include "config/System.hpp"
+#include "core/util/InplaceFunction.hpp"
 
 /**
  * @brief Pure UI widget for modal list overlay with selection
@@ -23,9 +25,21 @@
  *   // Later, from controller:
  *   int newIndex = overlay.getSelectedIndex() + 1;
  *   overlay.setSelectedIndex(newIndex);
+ *
+ * Long lists (devices, presets): setItemSource() switches to a virtualized
+ * mode. Items are read through a callback, and only LIST_VIRTUAL_ROWS rows
+ * exist; they are relabeled as the selection moves through the list.
+ *
+ *   overlay.setItemSource(presets.size(), [this](size_t i) {
+ *       return presets[i].name;
+ *   });
  */
 class ListOverlay : public UI::IComponent {
 public:
+    /** @brief Label of item index, must stay valid until the next call */
+    using ItemProvider =
+        InplaceFunction<const char*(size_t index), System::Memory::EVENT_CALLBACK_SIZE>;
+
     /**
      * @brief Construct list overlay
      * @param parent Parent LVGL object (typically screen)
@@ -51,6 +65,15 @@ public:
      */
     void setItems(const std::vector<std::string>& items);
 
+    /**
+     * @brief Set list items through a callback (virtualized mode)
+     * @param count Item count
+     * @param provider Returns the label of an item, called for visible rows only
+     *
+     * Nothing is copied; call again when the source changes.
+     */
+    void setItemSource(size_t count, ItemProvider provider);
+
     /**
      * @brief Set selected item index
      * @param index Item index (0-based), clamped to valid range
@@ -91,9 +114,11 @@ public:
      * @brief Get button object at index (for advanced customization)
      *
      * Allows wrapper classes to add custom widgets to buttons (e.g., indicators).
+     * In virtualized mode the button of an item only exists while its row is
+     * in the window, and is reused for other items afterwards.
      *
-     * @param index Button index (0-based)
-     * @return Button object or nullptr if invalid index
+     * @param index Item index (0-based)
+     * @return Button object or nullptr if invalid index (or not in the window)
      */
     lv_obj_t* getButton(size_t index) const;
 
@@ -111,6 +136,12 @@ private:
     void createTitleLabel();
     void createList();
     void populateList();
+    lv_obj_t* createButton(const char* text);
+    const char* itemText(size_t index) const;
+
+    /** @brief Virtualized mode: move the row window over the selection, relabel rows */
+    void updateWindow(bool force);
+    int selectedRow() const;
 
     void updateHighlight();
     void scrollToSelected();
@@ -130,6 +161,13 @@ private:
     std::vector<lv_obj_t*> bullets_;
 
     std::vector<std::string> items_;
+
+    // Virtualized mode (setItemSource)
+    ItemProvider item_provider_;
+    size_t item_count_ = 0;
+    size_t window_start_ = 0;  // Item shown by buttons_[0]
+    bool virtualized_ = false;
+
     std::string title_;
     int selected_index_ = 0;
     bool visible_ = false;
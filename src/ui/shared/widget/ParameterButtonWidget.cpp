@@ -1,10 +1,13 @@
 #include "ParameterButtonWidget.hpp"
 
+#include "config/System.hpp"
 #include "font/binary_font_buffer.hpp"
-#include "theme/BaseTheme.hpp"
+#include "theme/BaseThemeStyles.hpp"
 #include "util/TextUtils.hpp"
 #include "log/Macros.hpp"
 
+namespace Style = BaseTheme::Style;
+
 ParameterButtonWidget::ParameterButtonWidget(lv_obj_t* parent, uint16_t width, uint16_t height,
                                              uint8_t color_index)
     : parent_(parent ? parent : lv_screen_active()),
@@ -26,8 +29,10 @@ ParameterButtonWidget::~ParameterButtonWidget() {
 void ParameterButtonWidget::setName(const String& name) {
     name_ = name;
     if (name_label_) {
-        String formatted = TextUtils::formatTextForTwoLines(name, width_ - 20, fonts.parameter_label);
-        lv_label_set_text(name_label_, formatted.c_str());
+        char formatted[System::UI::TEXT_LAYOUT_MAX_BYTES];
+        TextUtils::formatTextForTwoLines(name.c_str(), width_ - 20, fonts.parameter_label,
+                                         formatted, sizeof(formatted));
+        name_text_.set(name_label_, formatted);
     }
 }
 
@@ -43,7 +48,7 @@ void ParameterButtonWidget::setValueWithDisplay(float value, const char* display
     setValue(value);
 
     if (state_label_ && displayValue) {
-        lv_label_set_text(state_label_, displayValue);
+        state_text_.set(state_label_, displayValue);
     }
 }
 
@@ -68,9 +73,7 @@ void ParameterButtonWidget::setVisible(bool visible) {
 void ParameterButtonWidget::createUI() {
     container_ = lv_obj_create(parent_);
     lv_obj_set_size(container_, width_, height_);
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
+    Style::add(container_, Style::CONTAINER);
 
     createButtonBox();
     createStateLabel();
@@ -87,32 +90,27 @@ void ParameterButtonWidget::createButtonBox() {
                  0,
                  BUTTON_Y_OFFSET + (CONTAINER_SIZE - BUTTON_SIZE) / 2);
 
-    lv_obj_set_style_radius(button_box_, 8, 0);
-    lv_obj_set_style_border_width(button_box_, 0, 0);  // No border
-
-    // Initial state: OFF (knob inactive color)
-    lv_obj_set_style_bg_color(button_box_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
-    lv_obj_set_style_bg_opa(button_box_, LV_OPA_COVER, 0);
+    // OFF: inactive color, ON (LV_STATE_CHECKED): active color
+    Style::add(button_box_, Style::BOX);
+    Style::add(button_box_, Style::ROUNDED_BOX);
+    Style::add(button_box_, Style::FILL_INACTIVE);
+    Style::add(button_box_, Style::FILL_ACTIVE, LV_STATE_CHECKED);
 }
 
 void ParameterButtonWidget::createStateLabel() {
     state_label_ = lv_label_create(button_box_);
-
-    lv_obj_set_style_text_font(state_label_, fonts.parameter_label, 0);
-    lv_obj_set_style_text_color(state_label_, lv_color_hex(0xd9d9d9), 0);
-    lv_obj_set_style_text_align(state_label_, LV_TEXT_ALIGN_CENTER, 0);
+    // Light text, dark on the active color
+    Style::add(state_label_, Style::PARAMETER_LABEL);
+    Style::add(state_label_, Style::TEXT_INACTIVE, LV_STATE_CHECKED);
 
     lv_obj_center(state_label_);
-    lv_label_set_text(state_label_, "OFF");
+    state_text_.set(state_label_, "OFF");
 }
 
 void ParameterButtonWidget::createNameLabel() {
     name_label_ = lv_label_create(container_);
-
-    lv_obj_set_style_text_font(name_label_, fonts.parameter_label, 0);
-    lv_obj_set_style_text_color(name_label_, lv_color_hex(0xd9d9d9), 0);
-    lv_obj_set_style_text_align(name_label_, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_style_text_line_space(name_label_, -2, 0);
+    Style::add(name_label_, Style::PARAMETER_LABEL);
+    Style::add(name_label_, Style::TEXT_SECONDARY);
 
     lv_obj_set_width(name_label_, width_ - 20);
     lv_obj_set_height(name_label_, 36);
@@ -127,17 +125,12 @@ void ParameterButtonWidget::createNameLabel() {
 void ParameterButtonWidget::updateButtonState(bool isOn) {
     if (!button_box_ || !state_label_) return;
 
+    // Active: theme ACTIVE color (orange/gold) + dark text
     if (isOn) {
-        // Active: theme ACTIVE color (orange/gold) + dark text
-        lv_obj_set_style_bg_color(button_box_, lv_color_hex(BaseTheme::Color::ACTIVE), 0);
-        lv_obj_set_style_bg_opa(button_box_, LV_OPA_COVER, 0);
-        lv_obj_set_style_text_color(state_label_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
+        lv_obj_add_state(button_box_, LV_STATE_CHECKED);
+        lv_obj_add_state(state_label_, LV_STATE_CHECKED);
     } else {
-        // Inactive: knob inactive color (dark gray) + light text
-        lv_obj_set_style_bg_color(button_box_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
-        lv_obj_set_style_bg_opa(button_box_, LV_OPA_COVER, 0);
-        lv_obj_set_style_text_color(state_label_,
-                                    lv_color_hex(BaseTheme::Color::TEXT_PRIMARY),
-                                    0);  // Light gray text
+        lv_obj_clear_state(button_box_, LV_STATE_CHECKED);
+        lv_obj_clear_state(state_label_, LV_STATE_CHECKED);
     }
 }
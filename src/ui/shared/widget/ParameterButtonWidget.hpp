@@ -6,6 +6,7 @@
 #include <etl/string.h>
 
 #include "IParameterWidget.hpp"
+#include "util/LabelText.hpp"
 
 /**
  * @brief Button/Toggle widget for binary on/off parameters
@@ -63,4 +64,6 @@ private:
     lv_obj_t* button_box_ = nullptr;
     lv_obj_t* state_label_ = nullptr;
     lv_obj_t* name_label_ = nullptr;
+    LabelText<> state_text_;
+    LabelText<> name_text_;
 };
@@ -0,0 +1,235 @@
+#include "ParameterKnobLiteWidget.hpp"
+
+#include <cmath>
+
+#include "config/System.hpp"
+#include "font/binary_font_buffer.hpp"
+#include "theme/BaseTheme.hpp"
+#include "util/AnimationScheduler.hpp"
+#include "util/TextUtils.hpp"
+
+namespace {
+
+/* lv_draw_arc expects angles in 0-360 */
+inline int16_t wrapAngle(int16_t angle) {
+    return angle >= 360 ? angle - 360 : angle;
+}
+
+}  // namespace
+
+ParameterKnobLiteWidget::ParameterKnobLiteWidget(lv_obj_t* parent, uint16_t width,
+                                                 uint16_t height, uint8_t color_index,
+                                                 bool centered)
+    : parent_(parent ? parent : lv_screen_active()),
+      value_(centered ? 0.5f : 0.0f),
+      origin_(centered ? 0.5f : 0.0f),
+      width_(width),
+      height_(height),
+      name_("PARAM") {
+    value_step_ = KnobGeometry::step(value_);
+    origin_step_ = KnobGeometry::step(origin_);
+    createUI();
+    setName(name_);
+    updateIndicatorPoint();
+}
+
+ParameterKnobLiteWidget::~ParameterKnobLiteWidget() {
+    AnimationScheduler::cancel(this);
+    if (container_) {
+        lv_obj_delete(container_);
+    }
+}
+
+// ===== PUBLIC INTERFACE =====
+
+void ParameterKnobLiteWidget::setName(const String& name) {
+    if (name_ == name) return;
+    if (!name_label_) return;
+
+    name_ = name;
+    char formatted[System::UI::TEXT_LAYOUT_MAX_BYTES];
+    TextUtils::formatTextForTwoLines(name.c_str(), width_ - LABEL_HORIZONTAL_PADDING,
+                                     fonts.parameter_label, formatted, sizeof(formatted));
+    name_text_.set(name_label_, formatted);
+}
+
+void ParameterKnobLiteWidget::setValue(float value) {
+    float clamped = constrain(value, 0.0f, 1.0f);
+    if (fabsf(value_ - clamped) <= VALUE_CHANGE_THRESHOLD) return;
+
+    value_ = clamped;
+    triggerValueChangeFlash();
+
+    // Same arc degree: only the flashing center changes
+    const uint16_t step = KnobGeometry::step(value_);
+    if (step == value_step_) {
+        invalidateAroundCenter(INNER_CIRCLE_SIZE / 2);
+        return;
+    }
+    value_step_ = step;
+    updateIndicatorPoint();
+
+    // Indicator caps reach half a thickness past the arc
+    invalidateAroundCenter(ARC_RADIUS + INDICATOR_THICKNESS / 2);
+}
+
+void ParameterKnobLiteWidget::setOrigin(float origin) {
+    float clamped = constrain(origin, 0.0f, 1.0f);
+    if (origin_ == clamped) return;
+
+    origin_ = clamped;
+    const uint16_t step = KnobGeometry::step(origin_);
+    if (step == origin_step_) return;
+    origin_step_ = step;
+    invalidateAroundCenter(ARC_RADIUS);
+}
+
+void ParameterKnobLiteWidget::setValueWithDisplay(float value, const char* displayValue) {
+    setValue(value);
+}
+
+void ParameterKnobLiteWidget::setVisible(bool visible) {
+    if (!container_) return;
+
+    if (visible) {
+        lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// ===== UI CREATION =====
+
+void ParameterKnobLiteWidget::createUI() {
+    // No theme styles: nothing to resolve, the knob is painted in drawCallback
+    container_ = lv_obj_create(parent_);
+    lv_obj_remove_style_all(container_);
+    lv_obj_set_size(container_, width_, height_);
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(container_, drawCallback, LV_EVENT_DRAW_MAIN, this);
+
+    arc_center_x_ = width_ / 2;
+    arc_center_y_ = ARC_Y_OFFSET + ARC_RADIUS;
+
+    createNameLabel();
+}
+
+void ParameterKnobLiteWidget::createNameLabel() {
+    name_label_ = lv_label_create(container_);
+    BaseTheme::Style::add(name_label_, BaseTheme::Style::PARAMETER_LABEL);
+
+    lv_obj_set_width(name_label_, width_ - LABEL_HORIZONTAL_PADDING);
+    lv_obj_set_height(name_label_, LABEL_HEIGHT);
+    lv_label_set_long_mode(name_label_, LV_LABEL_LONG_WRAP);
+
+    lv_obj_align(name_label_, LV_ALIGN_TOP_MID, 0, getArcBottom() - ARC_LABEL_GAP);
+}
+
+// ===== DRAWING =====
+
+void ParameterKnobLiteWidget::drawCallback(lv_event_t* e) {
+    auto* widget = static_cast<ParameterKnobLiteWidget*>(lv_event_get_user_data(e));
+    if (!widget) return;
+    widget->draw(lv_event_get_layer(e));
+}
+
+void ParameterKnobLiteWidget::draw(lv_layer_t* layer) const {
+    lv_area_t coords;
+    lv_obj_get_coords(container_, &coords);
+    const lv_point_t center = {static_cast<int32_t>(coords.x1 + arc_center_x_),
+                               static_cast<int32_t>(coords.y1 + arc_center_y_)};
+
+    // Background arc (full range)
+    lv_draw_arc_dsc_t arc;
+    lv_draw_arc_dsc_init(&arc);
+    arc.center = center;
+    arc.radius = ARC_RADIUS;
+    arc.width = ARC_WIDTH;
+    arc.rounded = 1;
+    arc.color = lv_color_hex(BaseTheme::Color::INACTIVE);
+    arc.start_angle = START_ANGLE;
+    arc.end_angle = END_ANGLE;
+    lv_draw_arc(layer, &arc);
+
+    // Value track, origin to value (drawn clockwise, so the lower angle first)
+    if (value_step_ != origin_step_) {
+        const uint16_t from = value_step_ > origin_step_ ? origin_step_ : value_step_;
+        const uint16_t to = value_step_ > origin_step_ ? value_step_ : origin_step_;
+        arc.radius = ARC_RADIUS - ARC_WIDTH / 4;
+        arc.width = ARC_WIDTH / 2;
+        arc.color = lv_color_hex(BaseTheme::Color::KNOB_TRACK);
+        arc.start_angle = wrapAngle(KnobGeometry::angle(from));
+        arc.end_angle = wrapAngle(KnobGeometry::angle(to));
+        lv_draw_arc(layer, &arc);
+    }
+
+    // Indicator line, center to value
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.width = INDICATOR_THICKNESS;
+    line.color = lv_color_hex(BaseTheme::Color::KNOB_VALUE);
+    line.round_start = 1;
+    line.round_end = 1;
+    line.p1.x = center.x;
+    line.p1.y = center.y;
+    line.p2.x = coords.x1 + indicator_x_;
+    line.p2.y = coords.y1 + indicator_y_;
+    lv_draw_line(layer, &line);
+
+    // Center circles (inner one flashes on value change)
+    drawCircle(layer, CENTER_CIRCLE_SIZE, BaseTheme::Color::KNOB_VALUE);
+    drawCircle(layer, INNER_CIRCLE_SIZE,
+               flashing_ ? BaseTheme::Color::ACTIVE : BaseTheme::Color::INACTIVE);
+}
+
+void ParameterKnobLiteWidget::drawCircle(lv_layer_t* layer, lv_coord_t size,
+                                         uint32_t color) const {
+    lv_area_t coords;
+    lv_obj_get_coords(container_, &coords);
+
+    lv_area_t area;
+    area.x1 = coords.x1 + arc_center_x_ - size / 2;
+    area.y1 = coords.y1 + arc_center_y_ - size / 2;
+    area.x2 = area.x1 + size - 1;
+    area.y2 = area.y1 + size - 1;
+
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.radius = LV_RADIUS_CIRCLE;
+    rect.bg_color = lv_color_hex(color);
+    rect.bg_opa = LV_OPA_COVER;
+    lv_draw_rect(layer, &rect, &area);
+}
+
+void ParameterKnobLiteWidget::updateIndicatorPoint() {
+    const KnobGeometry::Point& end = KnobGeometry::point(value_step_);
+    indicator_x_ = arc_center_x_ + end.x;
+    indicator_y_ = arc_center_y_ + end.y;
+}
+
+void ParameterKnobLiteWidget::invalidateAroundCenter(lv_coord_t extent) const {
+    if (!container_) return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(container_, &coords);
+
+    lv_area_t area;
+    area.x1 = coords.x1 + arc_center_x_ - extent;
+    area.y1 = coords.y1 + arc_center_y_ - extent;
+    area.x2 = coords.x1 + arc_center_x_ + extent;
+    area.y2 = coords.y1 + arc_center_y_ + extent;
+    lv_obj_invalidate_area(container_, &area);
+}
+
+// ===== ANIMATION =====
+
+void ParameterKnobLiteWidget::triggerValueChangeFlash() {
+    flashing_ = true;
+    AnimationScheduler::flash(this, FLASH_DURATION_MS, flashEndCallback);
+}
+
+void ParameterKnobLiteWidget::flashEndCallback(void* owner) {
+    auto* widget = static_cast<ParameterKnobLiteWidget*>(owner);
+    widget->flashing_ = false;
+    widget->invalidateAroundCenter(INNER_CIRCLE_SIZE / 2);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "IParameterWidget.hpp"
+#include "theme/BaseThemeStyles.hpp"
+#include "util/KnobGeometry.hpp"
+#include "util/LabelText.hpp"
+
+/**
+ * @brief Lightweight knob: same look as ParameterKnobWidget, one drawn object
+ *
+ * ParameterKnobWidget is built from a container, an lv_arc, an lv_line and
+ * two circle objects. Here the arc, track, indicator and centre circles are
+ * painted by a single LV_EVENT_DRAW_MAIN handler on the container, which
+ * only keeps the name label as a child. A page of eight knobs goes from 48
+ * objects to 16, with no style resolution for the drawn parts.
+ *
+ * A value change invalidates only the arc's bounding box, the flash only
+ * the centre circle.
+ */
+class ParameterKnobLiteWidget : public IParameterWidget {
+public:
+    /**
+     * @brief Construct a knob widget
+     * @param parent Parent LVGL object
+     * @param width Widget width
+     * @param height Widget height
+     * @param color_index Color index for center circle (0-7)
+     * @param centered True for centered knob (pan/balance), false for normal (level)
+     */
+    ParameterKnobLiteWidget(lv_obj_t* parent, uint16_t width = 80, uint16_t height = 120,
+                            uint8_t color_index = 0, bool centered = false);
+    ~ParameterKnobLiteWidget() override;
+
+    // IParameterWidget interface
+    void setName(const String& name) override;
+    void setValue(float value) override;
+    void setValueWithDisplay(float value, const char* displayValue) override;
+    void setVisible(bool visible) override;
+    lv_obj_t* getContainer() const override { return container_; }
+
+    /** @brief Track origin (0.0-1.0), see ParameterKnobWidget::setOrigin */
+    void setOrigin(float origin);
+
+private:
+    // Arc geometry (KnobGeometry, same as ParameterKnobWidget)
+    static constexpr uint16_t ARC_SIZE = KnobGeometry::SIZE;
+    static constexpr uint16_t ARC_RADIUS = KnobGeometry::RADIUS;
+    static constexpr uint8_t ARC_WIDTH = BaseTheme::Metrics::KNOB_ARC_WIDTH;
+    static constexpr uint8_t INDICATOR_THICKNESS = BaseTheme::Metrics::KNOB_INDICATOR_THICKNESS;
+    static constexpr lv_coord_t ARC_Y_OFFSET = INDICATOR_THICKNESS / 2;
+    static constexpr int16_t START_ANGLE = KnobGeometry::START_ANGLE;
+    static constexpr int16_t END_ANGLE = KnobGeometry::END_ANGLE;
+
+    // Center circles
+    static constexpr uint8_t CENTER_CIRCLE_SIZE = 14;
+    static constexpr uint8_t INNER_CIRCLE_SIZE = 6;
+
+    // Label layout
+    static constexpr lv_coord_t LABEL_HORIZONTAL_PADDING = 20;
+    static constexpr lv_coord_t LABEL_HEIGHT = 36;
+    static constexpr lv_coord_t ARC_LABEL_GAP = 4;
+
+    // Flash animation
+    static constexpr uint32_t FLASH_DURATION_MS = 100;
+
+    static constexpr float VALUE_CHANGE_THRESHOLD = 0.001f;
+
+    void createUI();
+    void createNameLabel();
+
+    static void drawCallback(lv_event_t* e);
+    void draw(lv_layer_t* layer) const;
+    void drawCircle(lv_layer_t* layer, lv_coord_t size, uint32_t color) const;
+
+    /** @brief Indicator end point from value_step_, relative to the container */
+    void updateIndicatorPoint();
+
+    /** @brief Invalidate a square of half-size `extent` around the arc centre */
+    void invalidateAroundCenter(lv_coord_t extent) const;
+
+    void triggerValueChangeFlash();
+    static void flashEndCallback(void* owner);
+
+    constexpr lv_coord_t getArcBottom() const {
+        return ARC_Y_OFFSET + ARC_SIZE;
+    }
+
+    lv_obj_t* parent_;
+    lv_obj_t* container_ = nullptr;
+    lv_obj_t* name_label_ = nullptr;
+    LabelText<> name_text_;
+
+    float value_ = 0.0f;
+    float origin_ = 0.0f;
+    uint16_t value_step_ = 0;  // KnobGeometry::step(), what is drawn
+    uint16_t origin_step_ = 0;
+
+    lv_coord_t arc_center_x_;
+    lv_coord_t arc_center_y_;
+    lv_coord_t indicator_x_ = 0;
+    lv_coord_t indicator_y_ = 0;
+
+    uint16_t width_;
+    uint16_t height_;
+    bool flashing_ = false;
+
+    String name_;
+};
@@ -1,13 +1,16 @@
 #include "ParameterKnobWidget.hpp"
 
-#include <arm_math.h>
-
 #include <cmath>
 
+#include "config/System.hpp"
 #include "font/binary_font_buffer.hpp"
 #include "theme/BaseTheme.hpp"
+#include "theme/BaseThemeStyles.hpp"
+#include "util/AnimationScheduler.hpp"
 #include "util/TextUtils.hpp"
 
+namespace Style = BaseTheme::Style;
+
 ParameterKnobWidget::ParameterKnobWidget(lv_obj_t* parent, uint16_t width, uint16_t height,
                                          uint8_t color_index, bool centered)
     : parent_(parent ? parent : lv_screen_active()),
@@ -22,10 +25,7 @@ ParameterKnobWidget::ParameterKnobWidget(lv_obj_t* parent, uint16_t width, uint1
 }
 
 ParameterKnobWidget::~ParameterKnobWidget() {
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
+    AnimationScheduler::cancel(this);
     if (container_) {
         lv_obj_delete(container_);
     }
@@ -38,10 +38,10 @@ void ParameterKnobWidget::setName(const String& name) {
     if (!name_label_) return;
 
     name_ = name;
-    String formatted = TextUtils::formatTextForTwoLines(name,
-                                                        width_ - LABEL_HORIZONTAL_PADDING,
-                                                        fonts.parameter_label);
-    lv_label_set_text(name_label_, formatted.c_str());
+    char formatted[System::UI::TEXT_LAYOUT_MAX_BYTES];
+    TextUtils::formatTextForTwoLines(name.c_str(), width_ - LABEL_HORIZONTAL_PADDING,
+                                     fonts.parameter_label, formatted, sizeof(formatted));
+    name_text_.set(name_label_, formatted);
 }
 
 void ParameterKnobWidget::setValue(float value) {
@@ -82,9 +82,7 @@ void ParameterKnobWidget::setVisible(bool visible) {
 void ParameterKnobWidget::createUI() {
     container_ = lv_obj_create(parent_);
     lv_obj_set_size(container_, width_, height_);
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
+    Style::add(container_, Style::CONTAINER);
 
     arc_center_x_ = width_ / 2;
     arc_center_y_ = ARC_Y_OFFSET + ARC_RADIUS;
@@ -103,14 +101,9 @@ void ParameterKnobWidget::createArc() {
     // Background arc (full range display)
     lv_arc_set_bg_angles(arc_, START_ANGLE, END_ANGLE);
 
-    // Main arc style (inactive background)
-    lv_obj_set_style_arc_width(arc_, ARC_WIDTH, LV_PART_MAIN);
-    lv_obj_set_style_arc_color(arc_, lv_color_hex(BaseTheme::Color::INACTIVE), LV_PART_MAIN);
-
-    // Indicator arc style (value track)
-    lv_obj_set_style_arc_width(arc_, ARC_WIDTH / 2, LV_PART_INDICATOR);
-    lv_obj_set_style_arc_color(arc_, lv_color_hex(BaseTheme::Color::KNOB_TRACK), LV_PART_INDICATOR);
-    lv_obj_set_style_pad_all(arc_, ARC_WIDTH / 4, LV_PART_INDICATOR);
+    // Inactive background, value track
+    Style::add(arc_, Style::KNOB_ARC, LV_PART_MAIN);
+    Style::add(arc_, Style::KNOB_ARC_TRACK, LV_PART_INDICATOR);
 
     // Remove knob (we use custom indicator line)
     lv_obj_remove_style(arc_, NULL, LV_PART_KNOB);
@@ -118,9 +111,7 @@ void ParameterKnobWidget::createArc() {
 
 void ParameterKnobWidget::createValueIndicator() {
     value_indicator_ = lv_line_create(container_);
-    lv_obj_set_style_line_width(value_indicator_, INDICATOR_THICKNESS, 0);
-    lv_obj_set_style_line_color(value_indicator_, lv_color_hex(BaseTheme::Color::KNOB_VALUE), 0);
-    lv_obj_set_style_line_rounded(value_indicator_, true, 0);
+    Style::add(value_indicator_, Style::KNOB_INDICATOR);
 
     // Line from center (position will be set by updateValue() in constructor)
     line_points_[0].x = arc_center_x_;
@@ -133,11 +124,7 @@ void ParameterKnobWidget::createValueIndicator() {
 
 void ParameterKnobWidget::createNameLabel() {
     name_label_ = lv_label_create(container_);
-
-    lv_obj_set_style_text_font(name_label_, fonts.parameter_label, 0);
-    lv_obj_set_style_text_color(name_label_, lv_color_hex(BaseTheme::Color::TEXT_PRIMARY), 0);
-    lv_obj_set_style_text_align(name_label_, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_style_text_line_space(name_label_, LABEL_LINE_SPACING, 0);
+    Style::add(name_label_, Style::PARAMETER_LABEL);
 
     lv_obj_set_width(name_label_, width_ - LABEL_HORIZONTAL_PADDING);
     lv_obj_set_height(name_label_, LABEL_HEIGHT);
@@ -154,19 +141,18 @@ void ParameterKnobWidget::createCenterCircles() {
     center_circle_ = lv_obj_create(container_);
     lv_obj_set_size(center_circle_, CENTER_CIRCLE_SIZE, CENTER_CIRCLE_SIZE);
     lv_obj_align(center_circle_, LV_ALIGN_TOP_MID, 0, center_y);
-    lv_obj_set_style_radius(center_circle_, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(center_circle_, 0, 0);
-    lv_obj_set_style_bg_color(center_circle_, lv_color_hex(BaseTheme::Color::KNOB_VALUE), 0);
-    lv_obj_set_style_bg_opa(center_circle_, LV_OPA_COVER, 0);
+    Style::add(center_circle_, Style::BOX);
+    Style::add(center_circle_, Style::CIRCLE);
+    Style::add(center_circle_, Style::FILL_KNOB_VALUE);
 
     // Inner circle (inactive background, flashes on value change)
     inner_circle_ = lv_obj_create(container_);
     lv_obj_set_size(inner_circle_, INNER_CIRCLE_SIZE, INNER_CIRCLE_SIZE);
     lv_obj_align(inner_circle_, LV_ALIGN_TOP_MID, 0, inner_y);
-    lv_obj_set_style_radius(inner_circle_, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(inner_circle_, 0, 0);
-    lv_obj_set_style_bg_color(inner_circle_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
-    lv_obj_set_style_bg_opa(inner_circle_, LV_OPA_COVER, 0);
+    Style::add(inner_circle_, Style::BOX);
+    Style::add(inner_circle_, Style::CIRCLE);
+    Style::add(inner_circle_, Style::FILL_INACTIVE);
+    Style::add(inner_circle_, Style::FILL_ACTIVE, LV_STATE_CHECKED);
 }
 
 // ===== VALUE UPDATE =====
@@ -174,35 +160,32 @@ void ParameterKnobWidget::createCenterCircles() {
 void ParameterKnobWidget::updateValue() {
     if (!arc_ || !value_indicator_) return;
 
-    // Convert normalized values to angles
-    float origin_angle = normalizedToAngle(origin_);
-    float value_angle = normalizedToAngle(value_);
-
-    // Only update arc if angles changed (avoid redundant LVGL calls)
-    if (origin_angle != last_origin_angle_ || value_angle != last_value_angle_) {
-        // Arc extends from origin to value (bidirectional)
-        // LVGL draws arc clockwise, so swap angles when value < origin
-        if (value_ >= origin_) {
-            lv_arc_set_angles(arc_, origin_angle, value_angle);
-        } else {
-            lv_arc_set_angles(arc_, value_angle, origin_angle);
-        }
-
-        last_origin_angle_ = origin_angle;
-        last_value_angle_ = value_angle;
-
-        // Indicator line uses the same calculated angle (no duplication)
-        updateIndicatorLine(value_angle);
+    // Quantize to the arc's whole degrees: redraw only when a step changes
+    const uint16_t origin_step = KnobGeometry::step(origin_);
+    const uint16_t value_step = KnobGeometry::step(value_);
+    if (origin_step == origin_step_ && value_step == value_step_) return;
+
+    // Arc extends from origin to value (bidirectional)
+    // LVGL draws arc clockwise, so swap angles when value < origin
+    const int16_t origin_angle = KnobGeometry::angle(origin_step);
+    const int16_t value_angle = KnobGeometry::angle(value_step);
+    if (value_step >= origin_step) {
+        lv_arc_set_angles(arc_, origin_angle, value_angle);
+    } else {
+        lv_arc_set_angles(arc_, value_angle, origin_angle);
     }
-}
 
-void ParameterKnobWidget::updateIndicatorLine(float value_angle) {
-    // Compute sin and cos simultaneously (faster on ARM)
-    float sin_val, cos_val;
-    arm_sin_cos_f32(value_angle, &sin_val, &cos_val);
+    if (value_step != value_step_) {
+        updateIndicatorLine(value_step);
+    }
+    origin_step_ = origin_step;
+    value_step_ = value_step;
+}
 
-    line_points_[1].x = arc_center_x_ + static_cast<lv_coord_t>(ARC_RADIUS * cos_val);
-    line_points_[1].y = arc_center_y_ + static_cast<lv_coord_t>(ARC_RADIUS * sin_val);
+void ParameterKnobWidget::updateIndicatorLine(uint16_t value_step) {
+    const KnobGeometry::Point& end = KnobGeometry::point(value_step);
+    line_points_[1].x = arc_center_x_ + end.x;
+    line_points_[1].y = arc_center_y_ + end.y;
 
     lv_line_set_points(value_indicator_, line_points_, 2);
 }
@@ -212,24 +195,16 @@ void ParameterKnobWidget::updateIndicatorLine(float value_angle) {
 void ParameterKnobWidget::triggerValueChangeFlash() {
     if (!inner_circle_) return;
 
-    // Cancel existing timer if any
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
-
-    // Flash inner circle
-    lv_obj_set_style_bg_color(inner_circle_, lv_color_hex(BaseTheme::Color::ACTIVE), 0);
-    flash_timer_ = lv_timer_create(flashTimerCallback, FLASH_DURATION_MS, this);
-    lv_timer_set_repeat_count(flash_timer_, 1);
+    // Flash inner circle (restarts a running flash)
+    lv_obj_add_state(inner_circle_, LV_STATE_CHECKED);
+    AnimationScheduler::flash(this, FLASH_DURATION_MS, flashEndCallback);
 }
 
-void ParameterKnobWidget::flashTimerCallback(lv_timer_t* timer) {
-    auto* widget = static_cast<ParameterKnobWidget*>(lv_timer_get_user_data(timer));
-    if (!widget || !widget->inner_circle_) return;
+void ParameterKnobWidget::flashEndCallback(void* owner) {
+    auto* widget = static_cast<ParameterKnobWidget*>(owner);
+    if (!widget->inner_circle_) return;
 
-    lv_obj_set_style_bg_color(widget->inner_circle_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
-    widget->flash_timer_ = nullptr;
+    lv_obj_clear_state(widget->inner_circle_, LV_STATE_CHECKED);
 }
 
 // ===== GEOMETRY HELPERS =====
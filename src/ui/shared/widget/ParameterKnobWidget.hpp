@@ -4,6 +4,9 @@
 #include <lvgl.h>
 
 #include "IParameterWidget.hpp"
+#include "theme/BaseThemeStyles.hpp"
+#include "util/KnobGeometry.hpp"
+#include "util/LabelText.hpp"
 
 /**
  * @brief Knob widget for continuous parameters (normal and centered)
@@ -44,15 +47,14 @@ public:
     void setOrigin(float origin);
 
 private:
-    // Arc geometry
-    static constexpr uint16_t ARC_SIZE = 62;
-    static constexpr uint16_t ARC_RADIUS = ARC_SIZE / 2;
-    static constexpr uint8_t ARC_WIDTH = 8;
-    static constexpr uint8_t INDICATOR_THICKNESS = 8;
+    // Arc geometry (KnobGeometry, shared with ParameterKnobLiteWidget)
+    static constexpr uint16_t ARC_SIZE = KnobGeometry::SIZE;
+    static constexpr uint16_t ARC_RADIUS = KnobGeometry::RADIUS;
+    static constexpr uint8_t ARC_WIDTH = BaseTheme::Metrics::KNOB_ARC_WIDTH;
+    static constexpr uint8_t INDICATOR_THICKNESS = BaseTheme::Metrics::KNOB_INDICATOR_THICKNESS;
     static constexpr lv_coord_t ARC_Y_OFFSET = INDICATOR_THICKNESS / 2;
-    static constexpr int16_t START_ANGLE = 135;
-    static constexpr int16_t END_ANGLE = 45;
-    static constexpr float ARC_SWEEP_DEGREES = 270.0f;  // Total arc sweep (END - START in circular space)
+    static constexpr int16_t START_ANGLE = KnobGeometry::START_ANGLE;
+    static constexpr int16_t END_ANGLE = KnobGeometry::END_ANGLE;
 
     // Center circles
     static constexpr uint8_t CENTER_CIRCLE_SIZE = 14;
@@ -61,7 +63,6 @@ private:
     // Label layout
     static constexpr lv_coord_t LABEL_HORIZONTAL_PADDING = 20;
     static constexpr lv_coord_t LABEL_HEIGHT = 36;
-    static constexpr int8_t LABEL_LINE_SPACING = -2;
     static constexpr lv_coord_t ARC_LABEL_GAP = 4;
 
     // Flash animation
@@ -79,21 +80,13 @@ private:
 
     // Value update
     void updateValue();
-    void updateIndicatorLine(float value_angle);
+    void updateIndicatorLine(uint16_t value_step);
 
     // Animation
     void triggerValueChangeFlash();
-    static void flashTimerCallback(lv_timer_t* timer);
-
-    // Geometry helpers (inline for performance)
-    inline float normalizedToAngle(float normalized) const {
-        return START_ANGLE + (normalized * ARC_SWEEP_DEGREES);
-    }
-
-    inline float angleToRadians(float angle) const {
-        return angle * DEG_TO_RAD;  // Uses Arduino's DEG_TO_RAD macro
-    }
+    static void flashEndCallback(void* owner);
 
+    // Geometry helpers
     constexpr lv_coord_t getArcBottom() const {
         return ARC_Y_OFFSET + ARC_SIZE;
     }
@@ -107,16 +100,18 @@ private:
     lv_obj_t* container_ = nullptr;
     lv_obj_t* arc_ = nullptr;
     lv_obj_t* name_label_ = nullptr;
+    LabelText<> name_text_;
     lv_obj_t* value_indicator_ = nullptr;
     lv_obj_t* center_circle_ = nullptr;
     lv_obj_t* inner_circle_ = nullptr;
-    lv_timer_t* flash_timer_ = nullptr;
 
     // State (floats grouped)
     float value_ = 0.0f;
     float origin_ = 0.0f;
-    float last_origin_angle_ = -1.0f;  // Cache to avoid redundant LVGL calls
-    float last_value_angle_ = -1.0f;
+
+    // Steps on screen (KnobGeometry::step), to skip redundant LVGL calls
+    uint16_t origin_step_ = KnobGeometry::NO_STEP;
+    uint16_t value_step_ = KnobGeometry::NO_STEP;
 
     // Geometry (coordinates grouped)
     lv_coord_t arc_center_x_;
@@ -1,10 +1,14 @@
 #include "ParameterListWidget.hpp"
 
+#include "config/System.hpp"
 #include "font/binary_font_buffer.hpp"
-#include "theme/BaseTheme.hpp"
+#include "theme/BaseThemeStyles.hpp"
+#include "util/AnimationScheduler.hpp"
 #include "util/TextUtils.hpp"
 #include "log/Macros.hpp"
 
+namespace Style = BaseTheme::Style;
+
 ParameterListWidget::ParameterListWidget(lv_obj_t* parent, uint16_t width, uint16_t height,
                                          uint8_t color_index, int16_t discreteCount)
     : parent_(parent ? parent : lv_screen_active()),
@@ -19,10 +23,7 @@ ParameterListWidget::ParameterListWidget(lv_obj_t* parent, uint16_t width, uint1
 }
 
 ParameterListWidget::~ParameterListWidget() {
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
+    AnimationScheduler::cancel(this);
     if (container_) {
         lv_obj_delete(container_);
     }
@@ -31,8 +32,10 @@ ParameterListWidget::~ParameterListWidget() {
 void ParameterListWidget::setName(const String& name) {
     name_ = name;
     if (name_label_) {
-        String formatted = TextUtils::formatTextForTwoLines(name, width_ - 20, fonts.parameter_label);
-        lv_label_set_text(name_label_, formatted.c_str());
+        char formatted[System::UI::TEXT_LAYOUT_MAX_BYTES];
+        TextUtils::formatTextForTwoLines(name.c_str(), width_ - 20, fonts.parameter_label,
+                                         formatted, sizeof(formatted));
+        name_text_.set(name_label_, formatted);
     }
 }
 
@@ -46,7 +49,7 @@ void ParameterListWidget::setValue(float value) {
     if (display_value_.length() == 0) {
         display_value_ = String(index);
         if (value_label_) {
-            lv_label_set_text(value_label_, display_value_.c_str());
+            value_text_.set(value_label_, display_value_.c_str());
         }
     }
 
@@ -58,12 +61,11 @@ void ParameterListWidget::setValueWithDisplay(float value, const char* displayVa
     display_value_ = displayValue ? displayValue : "---";
 
     if (value_label_) {
-        String formatted = TextUtils::formatTextForTwoLines(display_value_,
-                                                            VALUE_BOX_SIZE - 8,
-                                                            fonts.parameter_label);
-        lv_label_set_text(value_label_, formatted.c_str());
-
-        if (top_line_) {
+        char formatted[System::UI::TEXT_LAYOUT_MAX_BYTES];
+        TextUtils::formatTextForTwoLines(display_value_.c_str(), VALUE_BOX_SIZE - 8,
+                                         fonts.parameter_label, formatted, sizeof(formatted));
+        // Unchanged text: no relayout either
+        if (value_text_.set(value_label_, formatted) && top_line_) {
             lv_obj_update_layout(value_label_);
             lv_coord_t label_width = lv_obj_get_width(value_label_);
             lv_coord_t label_x = lv_obj_get_x(value_label_);
@@ -99,9 +101,7 @@ void ParameterListWidget::setVisible(bool visible) {
 void ParameterListWidget::createUI() {
     container_ = lv_obj_create(parent_);
     lv_obj_set_size(container_, width_, height_);
-    lv_obj_set_style_bg_opa(container_, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_opa(container_, LV_OBJ_FLAG_HIDDEN, 0);
-    lv_obj_set_style_pad_all(container_, 0, 0);
+    Style::add(container_, Style::CONTAINER);
 
     createValueBox();
     createValueLabel();
@@ -114,25 +114,18 @@ void ParameterListWidget::createValueBox() {
     value_box_ = lv_obj_create(container_);
     lv_obj_set_size(value_box_, VALUE_BOX_SIZE, VALUE_BOX_SIZE);
     lv_obj_align(value_box_, LV_ALIGN_TOP_MID, 0, VALUE_BOX_Y_OFFSET);
-
-    lv_obj_set_style_radius(value_box_, 8, 0);
-    lv_obj_set_style_border_width(value_box_, 0, 0);  // No border
-    lv_obj_set_style_bg_color(value_box_, lv_color_hex(BaseTheme::Color::KNOB_BACKGROUND), 0);
-    lv_obj_set_style_bg_opa(value_box_, LV_OPA_TRANSP, 0);
+    Style::add(value_box_, Style::CONTAINER);
 }
 
 void ParameterListWidget::createValueLabel() {
     value_label_ = lv_label_create(value_box_);
-
-    lv_obj_set_style_text_font(value_label_, fonts.parameter_value_label, 0);
-    lv_obj_set_style_text_color(value_label_, lv_color_hex(BaseTheme::Color::TEXT_PRIMARY), 0);
-    lv_obj_set_style_text_align(value_label_, LV_TEXT_ALIGN_CENTER, 0);
+    Style::add(value_label_, Style::VALUE_LABEL);
 
     lv_obj_set_width(value_label_, VALUE_BOX_SIZE - 8);
     lv_label_set_long_mode(value_label_, LV_LABEL_LONG_WRAP);
 
     lv_obj_center(value_label_);
-    lv_label_set_text(value_label_, display_value_.c_str());
+    value_text_.set(value_label_, display_value_.c_str());
 }
 
 void ParameterListWidget::createTopLine() {
@@ -149,19 +142,14 @@ void ParameterListWidget::createTopLine() {
     lv_obj_set_size(top_line_, label_width, 2);       // 2px thickness
     lv_obj_set_pos(top_line_, label_x, label_y - 4);  // 4px above text
 
-    lv_obj_set_style_bg_color(top_line_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
-    lv_obj_set_style_bg_opa(top_line_, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(top_line_, 0, 0);
-    lv_obj_set_style_radius(top_line_, 0, 0);
+    Style::add(top_line_, Style::BOX);
+    Style::add(top_line_, Style::FILL_INACTIVE);
+    Style::add(top_line_, Style::FILL_ACTIVE, LV_STATE_CHECKED);
 }
 
 void ParameterListWidget::createNameLabel() {
     name_label_ = lv_label_create(container_);
-
-    lv_obj_set_style_text_font(name_label_, fonts.parameter_label, 0);
-    lv_obj_set_style_text_color(name_label_, lv_color_hex(BaseTheme::Color::TEXT_PRIMARY), 0);
-    lv_obj_set_style_text_align(name_label_, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_set_style_text_line_space(name_label_, -2, 0);
+    Style::add(name_label_, Style::PARAMETER_LABEL);
 
     lv_obj_set_width(name_label_, width_ - 20);
     lv_obj_set_height(name_label_, 36);
@@ -175,27 +163,17 @@ void ParameterListWidget::createNameLabel() {
 void ParameterListWidget::triggerValueChangeFlash() {
     if (!top_line_) return;
 
-    // Cancel any existing flash timer
-    if (flash_timer_) {
-        lv_timer_delete(flash_timer_);
-        flash_timer_ = nullptr;
-    }
-
-    // Apply active color to top line
-    lv_obj_set_style_bg_color(top_line_, lv_color_hex(BaseTheme::Color::ACTIVE), 0);
+    // Active color on the top line
+    lv_obj_add_state(top_line_, LV_STATE_CHECKED);
 
-    // Create one-shot timer to restore color after 100ms
-    flash_timer_ = lv_timer_create(flashTimerCallback, FLASH_DURATION_MS, this);
-    lv_timer_set_repeat_count(flash_timer_, 1);
+    // Restore color after 100ms (restarts a running flash)
+    AnimationScheduler::flash(this, FLASH_DURATION_MS, flashEndCallback);
 }
 
-void ParameterListWidget::flashTimerCallback(lv_timer_t* timer) {
-    auto* widget = static_cast<ParameterListWidget*>(lv_timer_get_user_data(timer));
-    if (!widget || !widget->top_line_) return;
-
-    // Restore top line color to INACTIVE
-    lv_obj_set_style_bg_color(widget->top_line_, lv_color_hex(BaseTheme::Color::INACTIVE), 0);
+void ParameterListWidget::flashEndCallback(void* owner) {
+    auto* widget = static_cast<ParameterListWidget*>(owner);
+    if (!widget->top_line_) return;
 
-    // Clear timer reference
-    widget->flash_timer_ = nullptr;
+    // Back to INACTIVE
+    lv_obj_clear_state(widget->top_line_, LV_STATE_CHECKED);
 }
@@ -6,6 +6,7 @@
 #include <etl/string.h>
 
 #include "IParameterWidget.hpp"
+#include "util/LabelText.hpp"
 
 /**
  * @brief List/Enum widget for discrete selection parameters
@@ -48,7 +49,7 @@ private:
     void createTopLine();
     void createNameLabel();
     void triggerValueChangeFlash();
-    static void flashTimerCallback(lv_timer_t* timer);
+    static void flashEndCallback(void* owner);
 
     lv_obj_t* parent_;
     uint16_t width_;
@@ -69,6 +70,7 @@ private:
     lv_obj_t* value_label_ = nullptr;
     lv_obj_t* name_label_ = nullptr;
     lv_obj_t* top_line_ = nullptr;
+    LabelText<> value_text_;
+    LabelText<> name_text_;
 
-    lv_timer_t* flash_timer_ = nullptr;
 };
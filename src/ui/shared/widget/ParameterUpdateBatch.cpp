@@ -0,0 +1,92 @@
+#include "ParameterUpdateBatch.hpp"
+
+#include <string.h>
+
+#include "core/util/Utf8.hpp"
+#include "log/Macros.hpp"
+
+ParameterUpdateBatch::ParameterUpdateBatch(lv_display_t* display)
+    : display_(display ? display : lv_display_get_default()) {
+    if (display_) {
+        lv_display_add_event_cb(display_, frameStartCallback, LV_EVENT_REFR_START, this);
+    } else {
+        LOGLN("[ParameterUpdateBatch] WARNING: No display, call flush() manually");
+    }
+}
+
+ParameterUpdateBatch::~ParameterUpdateBatch() {
+    if (display_) {
+        lv_display_remove_event_cb_with_user_data(display_, frameStartCallback, this);
+    }
+}
+
+ParameterUpdateBatch::Slot ParameterUpdateBatch::bind(IParameterWidget* widget) {
+    if (!widget) return INVALID_SLOT;
+
+    for (size_t i = 0; i < bindings_.size(); ++i) {
+        if (!bindings_[i].widget) {
+            bindings_[i].widget = widget;
+            dirty_ &= ~(1u << i);
+            return static_cast<Slot>(i);
+        }
+    }
+
+    LOGF("[ParameterUpdateBatch] ERROR: Cannot bind widget (max %d)\n",
+         static_cast<int>(MAX_BINDINGS));
+    return INVALID_SLOT;
+}
+
+void ParameterUpdateBatch::unbind(Slot slot) {
+    if (slot >= bindings_.size()) return;
+    bindings_[slot].widget = nullptr;
+    dirty_ &= ~(1u << slot);
+}
+
+ParameterUpdateBatch::Binding* ParameterUpdateBatch::markDirty(Slot slot) {
+    if (slot >= bindings_.size() || !bindings_[slot].widget) return nullptr;
+
+    const uint32_t bit = 1u << slot;
+    if (dirty_ & bit) ++coalesced_;
+    dirty_ |= bit;
+    return &bindings_[slot];
+}
+
+void ParameterUpdateBatch::setValue(Slot slot, float value) {
+    Binding* binding = markDirty(slot);
+    if (!binding) return;
+
+    binding->value = value;
+    binding->hasDisplay = false;
+}
+
+void ParameterUpdateBatch::setValueWithDisplay(Slot slot, float value, const char* displayValue) {
+    Binding* binding = markDirty(slot);
+    if (!binding) return;
+
+    binding->value = value;
+    binding->hasDisplay = true;
+    // Truncated on a code point boundary: half a sequence would render as a replacement glyph
+    const char* text = displayValue ? displayValue : "";
+    const size_t length = Utf8::safeLength(text, sizeof(binding->display) - 1);
+    memcpy(binding->display, text, length);
+    binding->display[length] = '\0';
+}
+
+void ParameterUpdateBatch::flush() {
+    while (dirty_) {
+        const uint32_t index = static_cast<uint32_t>(__builtin_ctz(dirty_));
+        dirty_ &= dirty_ - 1;
+
+        Binding& binding = bindings_[index];
+        if (binding.hasDisplay) {
+            binding.widget->setValueWithDisplay(binding.value, binding.display);
+        } else {
+            binding.widget->setValue(binding.value);
+        }
+    }
+}
+
+void ParameterUpdateBatch::frameStartCallback(lv_event_t* e) {
+    auto* batch = static_cast<ParameterUpdateBatch*>(lv_event_get_user_data(e));
+    if (batch) batch->flush();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <lvgl.h>
+#include <etl/array.h>
+
+#include <cstdint>
+
+#include "IParameterWidget.hpp"
+#include "config/System.hpp"
+
+/**
+ * @brief Coalesces parameter updates to one widget update per frame
+ *
+ * Host value updates call IParameterWidget::setValue right away, so a burst
+ * of 50 updates for one knob sets arc angles and label text 50 times. Bound
+ * through a batch, each update only records the latest value and sets a
+ * dirty bit; the widgets are updated once, at the display's
+ * LV_EVENT_REFR_START (inside lv_timer_handler, before layout and render).
+ *
+ * @code
+ * ParameterUpdateBatch batch;
+ * auto slot = batch.bind(knob);
+ * batch.setValueWithDisplay(slot, value, "440 Hz");  // from the host handler
+ * @endcode
+ *
+ * Unbind (or destroy the batch) before deleting a bound widget.
+ */
+class ParameterUpdateBatch {
+public:
+    using Slot = uint8_t;
+    static constexpr Slot INVALID_SLOT = 0xFF;
+
+    /** @param display Display whose frames apply the updates (nullptr = default) */
+    explicit ParameterUpdateBatch(lv_display_t* display = nullptr);
+    ~ParameterUpdateBatch();
+
+    ParameterUpdateBatch(const ParameterUpdateBatch&) = delete;
+    ParameterUpdateBatch& operator=(const ParameterUpdateBatch&) = delete;
+
+    /** @return Slot, INVALID_SLOT if MAX_PARAMETER_BINDINGS reached */
+    Slot bind(IParameterWidget* widget);
+
+    /** @brief Drop the binding; a pending update is discarded */
+    void unbind(Slot slot);
+
+    void setValue(Slot slot, float value);
+    void setValueWithDisplay(Slot slot, float value, const char* displayValue);
+
+    /** @brief Apply pending updates now (also done at every frame start) */
+    void flush();
+
+    /** @brief Updates replaced by a newer one before reaching their widget */
+    uint32_t getCoalescedCount() const { return coalesced_; }
+
+private:
+    static constexpr size_t MAX_BINDINGS = System::UI::MAX_PARAMETER_BINDINGS;
+    static_assert(MAX_BINDINGS <= 32, "dirty mask is 32 bits");
+
+    struct Binding {
+        IParameterWidget* widget;
+        float value;
+        bool hasDisplay;
+        char display[System::UI::PARAMETER_DISPLAY_BYTES];
+    };
+
+    static void frameStartCallback(lv_event_t* e);
+    Binding* markDirty(Slot slot);
+
+    lv_display_t* display_;
+    etl::array<Binding, MAX_BINDINGS> bindings_ = {};
+    uint32_t dirty_ = 0;
+    uint32_t coalesced_ = 0;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <lvgl.h>
+#include <etl/array.h>
+
+#include <memory>
+
+#include "core/util/InplaceFunction.hpp"
+#include "log/Macros.hpp"
+
+/**
+ * @brief Pre-built parameter widgets, recycled across plugin pages
+ *
+ * Creating a ParameterKnobWidget allocates its whole LVGL object tree; a
+ * page flip that destroys eight and builds eight more is dozens of object
+ * allocations and style resolutions. The pool builds widgets once (lazily
+ * or with prefill()) and hands them out again: a page change becomes
+ * acquire() + setName / setValue / setDiscreteMetadata on existing objects.
+ *
+ * Released widgets are hidden and moved under the parking parent. A widget
+ * must be released before the object it was acquired into is deleted,
+ * since deleting that parent would delete the widget's container too.
+ *
+ * @code
+ * WidgetPool<ParameterKnobWidget, 8> knobs(screen, [](lv_obj_t* parent) {
+ *     return std::make_unique<ParameterKnobWidget>(parent, 80, 120);
+ * });
+ * knobs.prefill(8);
+ *
+ * auto* knob = knobs.acquire(page);
+ * knob->setName(param.name);
+ * knob->setOrigin(param.centered ? 0.5f : 0.0f);
+ * knob->setValue(param.value);
+ * ...
+ * knobs.releaseAll();  // before switching page
+ * @endcode
+ *
+ * @tparam Widget IParameterWidget implementation
+ * @tparam Capacity Max widgets built by this pool
+ */
+template <typename Widget, size_t Capacity>
+class WidgetPool {
+public:
+    using Factory = InplaceFunction<std::unique_ptr<Widget>(lv_obj_t* parent), 16>;
+
+    /**
+     * @param parking Parent of the widgets while not in use (built hidden there)
+     * @param factory Builds one widget under the given parent
+     */
+    WidgetPool(lv_obj_t* parking, Factory factory)
+        : parking_(parking), factory_(std::move(factory)) {}
+
+    WidgetPool(const WidgetPool&) = delete;
+    WidgetPool& operator=(const WidgetPool&) = delete;
+
+    /** @brief Build widgets up front, up to count in total (e.g. at plugin enable) */
+    void prefill(size_t count) {
+        while (built_ < count && built_ < Capacity) {
+            if (!build()) return;
+        }
+    }
+
+    /**
+     * @brief Take a free widget and show it under parent
+     * @return nullptr when all Capacity widgets are in use
+     */
+    Widget* acquire(lv_obj_t* parent) {
+        size_t index = Capacity;
+        for (size_t i = 0; i < built_; ++i) {
+            if (!inUse_[i]) {
+                index = i;
+                break;
+            }
+        }
+        if (index == Capacity) {
+            if (built_ == Capacity || !build()) {
+                LOGF("[WidgetPool] ERROR: Pool exhausted (max %d)\n", static_cast<int>(Capacity));
+                return nullptr;
+            }
+            index = built_ - 1;
+        }
+
+        Widget* widget = widgets_[index].get();
+        lv_obj_t* container = widget->getContainer();
+        if (lv_obj_get_parent(container) != parent) {
+            lv_obj_set_parent(container, parent);
+        }
+        widget->setVisible(true);
+        inUse_[index] = true;
+        return widget;
+    }
+
+    /** @brief Hide a widget and return it to the pool */
+    void release(Widget* widget) {
+        for (size_t i = 0; i < built_; ++i) {
+            if (widgets_[i].get() == widget) {
+                park(i);
+                return;
+            }
+        }
+    }
+
+    void releaseAll() {
+        for (size_t i = 0; i < built_; ++i) {
+            park(i);
+        }
+    }
+
+    size_t built() const { return built_; }
+
+    size_t inUse() const {
+        size_t count = 0;
+        for (size_t i = 0; i < built_; ++i) {
+            if (inUse_[i]) ++count;
+        }
+        return count;
+    }
+
+private:
+    bool build() {
+        auto widget = factory_ ? factory_(parking_) : nullptr;
+        if (!widget) {
+            LOGLN("[WidgetPool] ERROR: Factory returned no widget");
+            return false;
+        }
+        widget->setVisible(false);
+        widgets_[built_] = std::move(widget);
+        inUse_[built_] = false;
+        ++built_;
+        return true;
+    }
+
+    void park(size_t index) {
+        if (!inUse_[index]) return;
+
+        Widget* widget = widgets_[index].get();
+        widget->setVisible(false);
+        lv_obj_set_parent(widget->getContainer(), parking_);
+        inUse_[index] = false;
+    }
+
+    lv_obj_t* parking_;
+    Factory factory_;
+    etl::array<std::unique_ptr<Widget>, Capacity> widgets_;
+    etl::array<bool, Capacity> inUse_ = {};
+    size_t built_ = 0;
+};
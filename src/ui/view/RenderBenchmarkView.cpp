@@ -0,0 +1,286 @@
+#include "RenderBenchmarkView.hpp"
+
+#include <Arduino.h>
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "config/System.hpp"
+#include "manager/ViewManager.hpp"
+#include "theme/BaseTheme.hpp"
+#include "ui/shared/font/binary_font_buffer.hpp"
+#include "widget/ListOverlay.hpp"
+#include "widget/ParameterKnobLiteWidget.hpp"
+#include "widget/ParameterKnobWidget.hpp"
+#include "widget/WidgetPool.hpp"
+
+namespace {
+
+constexpr const char* SCENARIO_NAMES[] = {"knobs", "lite", "list", "text"};
+
+constexpr uint16_t KNOB_WIDTH = System::Display::SCREEN_WIDTH / 4;
+constexpr uint16_t KNOB_HEIGHT = System::Display::SCREEN_HEIGHT / 2;
+
+/* Triangle wave 0..1..0 over periodMs */
+float sweep(uint32_t elapsedMs, uint32_t periodMs, uint32_t offsetMs) {
+    const uint32_t t = (elapsedMs + offsetMs) % periodMs;
+    const float half = periodMs / 2.0f;
+    return t < half ? t / half : (periodMs - t) / half;
+}
+
+}  // namespace
+
+RenderBenchmarkView::RenderBenchmarkView(ViewManager& viewManager) : viewManager_(viewManager) {}
+
+RenderBenchmarkView::~RenderBenchmarkView() {
+    onDeactivate();
+    destroy();
+}
+
+bool RenderBenchmarkView::create(lv_obj_t* parent) {
+    if (container_) return true;
+
+    container_ = lv_obj_create(parent);
+    if (!container_) return false;
+    lv_obj_remove_style_all(container_);
+    lv_obj_set_size(container_, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(container_, lv_color_hex(BaseTheme::Color::BACKGROUND), 0);
+    lv_obj_set_style_bg_opa(container_, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
+
+    stage_ = lv_obj_create(container_);
+    lv_obj_remove_style_all(stage_);
+    lv_obj_set_size(stage_, LV_PCT(100), LV_PCT(100));
+    lv_obj_clear_flag(stage_, LV_OBJ_FLAG_SCROLLABLE);
+
+    parking_ = lv_obj_create(container_);
+    lv_obj_remove_style_all(parking_);
+    lv_obj_add_flag(parking_, LV_OBJ_FLAG_HIDDEN);
+    knobPool_ = std::make_unique<KnobPool>(parking_, [this](lv_obj_t* parent) {
+        const uint8_t color = knobsBuilt_++ % KNOB_COUNT;
+        return std::make_unique<ParameterKnobWidget>(parent, KNOB_WIDTH, KNOB_HEIGHT, color);
+    });
+    liteKnobPool_ = std::make_unique<LiteKnobPool>(parking_, [this](lv_obj_t* parent) {
+        const uint8_t color = knobsBuilt_++ % KNOB_COUNT;
+        return std::make_unique<ParameterKnobLiteWidget>(parent, KNOB_WIDTH, KNOB_HEIGHT, color);
+    });
+
+    summary_ = lv_label_create(container_);
+    lv_obj_set_style_text_color(summary_, lv_color_hex(BaseTheme::Color::TEXT_PRIMARY), 0);
+    lv_obj_set_style_bg_color(summary_, lv_color_hex(BaseTheme::Color::BACKGROUND), 0);
+    lv_obj_set_style_bg_opa(summary_, LV_OPA_70, 0);
+    lv_obj_align(summary_, LV_ALIGN_BOTTOM_LEFT, 2, -2);
+    lv_label_set_text(summary_, "");
+    return true;
+}
+
+void RenderBenchmarkView::destroy() {
+    teardownScenario();
+    // The pooled knobs delete their containers: before their parents go
+    knobPool_.reset();
+    liteKnobPool_.reset();
+    knobsBuilt_ = 0;
+    if (container_) {
+        lv_obj_delete(container_);
+        container_ = nullptr;
+        stage_ = nullptr;
+        parking_ = nullptr;
+        summary_ = nullptr;
+    }
+}
+
+void RenderBenchmarkView::onActivate() {
+    if (!container_ || timer_) return;
+
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    timer_ = lv_timer_create(stepCallback, System::Display::FRAME_PERIOD_US / 1000, this);
+    startScenario(Scenario::KNOBS);
+}
+
+void RenderBenchmarkView::onDeactivate() {
+    if (timer_) {
+        lv_timer_delete(timer_);
+        timer_ = nullptr;
+    }
+    teardownScenario();
+    if (container_) {
+        lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void RenderBenchmarkView::stepCallback(lv_timer_t* timer) {
+    static_cast<RenderBenchmarkView*>(lv_timer_get_user_data(timer))->step();
+}
+
+void RenderBenchmarkView::step() {
+    const DisplayStats stats = viewManager_.getDisplayStats();
+    const uint32_t elapsedMs = millis() - scenarioStartMs_;
+
+    sample(stats);
+    if (elapsedMs >= System::Benchmark::RENDER_SCENARIO_MS) {
+        report(stats, elapsedMs);
+        const uint8_t next = (static_cast<uint8_t>(scenario_) + 1) %
+                             static_cast<uint8_t>(Scenario::COUNT);
+        startScenario(static_cast<Scenario>(next));
+        return;
+    }
+
+    animateScenario(elapsedMs);
+    ++tick_;
+}
+
+void RenderBenchmarkView::startScenario(Scenario scenario) {
+    teardownScenario();
+    scenario_ = scenario;
+    buildScenario();
+
+    const DisplayStats stats = viewManager_.getDisplayStats();
+    scenarioStartMs_ = millis();
+    startFrames_ = stats.frames;
+    lastFrames_ = stats.frames;
+    tick_ = 0;
+    result_ = {};
+}
+
+void RenderBenchmarkView::buildScenario() {
+    switch (scenario_) {
+        case Scenario::KNOBS:
+        case Scenario::KNOBS_LITE:
+            for (uint8_t i = 0; i < KNOB_COUNT; ++i) {
+                const float origin = i % 4 == 3 ? 0.5f : 0.0f;
+                if (scenario_ == Scenario::KNOBS) {
+                    ParameterKnobWidget* knob = knobPool_->acquire(stage_);
+                    if (knob) knob->setOrigin(origin);
+                    knobs_[i] = knob;
+                } else {
+                    ParameterKnobLiteWidget* knob = liteKnobPool_->acquire(stage_);
+                    if (knob) knob->setOrigin(origin);
+                    knobs_[i] = knob;
+                }
+                if (!knobs_[i]) continue;
+                lv_obj_set_pos(knobs_[i]->getContainer(), (i % 4) * KNOB_WIDTH,
+                               (i / 4) * KNOB_HEIGHT);
+                knobs_[i]->setName(String("Knob ") + String(static_cast<char>('1' + i)));
+            }
+            break;
+
+        case Scenario::LIST: {
+            std::vector<std::string> items;
+            items.reserve(System::Benchmark::RENDER_LIST_ITEMS);
+            for (uint8_t i = 0; i < System::Benchmark::RENDER_LIST_ITEMS; ++i) {
+                items.push_back("Preset " + std::to_string(i + 1));
+            }
+            list_ = std::make_unique<ListOverlay>(stage_);
+            list_->setTitle("Render benchmark");
+            list_->setItems(items);
+            list_->show();
+            break;
+        }
+
+        case Scenario::TEXT: {
+            const lv_coord_t rowHeight = System::Display::SCREEN_HEIGHT / TEXT_ROWS;
+            const lv_coord_t columnWidth = System::Display::SCREEN_WIDTH / TEXT_COLUMNS;
+            for (uint8_t i = 0; i < TEXT_ROWS * TEXT_COLUMNS; ++i) {
+                lv_obj_t* label = lv_label_create(stage_);
+                if (fonts.parameter_label) {
+                    lv_obj_set_style_text_font(label, fonts.parameter_label, 0);
+                }
+                lv_obj_set_style_text_color(label, lv_color_hex(BaseTheme::Color::MACROS[i % 8]),
+                                            0);
+                lv_obj_set_pos(label, (i % TEXT_COLUMNS) * columnWidth + 4,
+                               (i / TEXT_COLUMNS) * rowHeight);
+                labels_[i] = label;
+            }
+            break;
+        }
+
+        case Scenario::COUNT:
+            break;
+    }
+}
+
+void RenderBenchmarkView::animateScenario(uint32_t elapsedMs) {
+    switch (scenario_) {
+        case Scenario::KNOBS:
+        case Scenario::KNOBS_LITE:
+            for (uint8_t i = 0; i < KNOB_COUNT; ++i) {
+                if (knobs_[i]) knobs_[i]->setValue(sweep(elapsedMs, 2000, i * 250));
+            }
+            break;
+
+        case Scenario::LIST: {
+            // Ping-pong through the list, one row per frame
+            const int span = 2 * (System::Benchmark::RENDER_LIST_ITEMS - 1);
+            const int position = static_cast<int>(tick_ % span);
+            list_->setSelectedIndex(position < span / 2 ? position : span - position);
+            break;
+        }
+
+        case Scenario::TEXT:
+            for (uint8_t i = 0; i < TEXT_ROWS * TEXT_COLUMNS; ++i) {
+                lv_label_set_text_fmt(labels_[i], "Param %02u  %5lu", static_cast<unsigned>(i),
+                                      static_cast<unsigned long>((tick_ * 37 + i * 101) % 100000));
+            }
+            break;
+
+        case Scenario::COUNT:
+            break;
+    }
+}
+
+void RenderBenchmarkView::teardownScenario() {
+    for (auto& knob : knobs_) {
+        knob = nullptr;
+    }
+    if (knobPool_) knobPool_->releaseAll();
+    if (liteKnobPool_) liteKnobPool_->releaseAll();
+    list_.reset();
+    for (auto& label : labels_) {
+        if (label) {
+            lv_obj_delete(label);
+            label = nullptr;
+        }
+    }
+}
+
+void RenderBenchmarkView::sample(const DisplayStats& stats) {
+    if (stats.memUsed > result_.memUsedMax) {
+        result_.memUsedMax = stats.memUsed;
+    }
+    if (stats.frames == lastFrames_) return;
+
+    // A frame went out since the last step: its times are the latest stats
+    lastFrames_ = stats.frames;
+    ++result_.frames;
+    result_.renderUsTotal += stats.renderUs;
+    result_.flushUsTotal += stats.flushUs;
+    if (stats.renderUs > result_.renderUsWorst) result_.renderUsWorst = stats.renderUs;
+    if (stats.flushUs > result_.flushUsWorst) result_.flushUsWorst = stats.flushUs;
+}
+
+void RenderBenchmarkView::report(const DisplayStats& stats, uint32_t elapsedMs) {
+    const uint32_t frames = stats.frames - startFrames_;
+    const uint32_t sampled = result_.frames ? result_.frames : 1;
+    const float fps = elapsedMs ? frames * 1000.0f / elapsedMs : 0.0f;
+    const float renderMs = result_.renderUsTotal / 1000.0f / sampled;
+    const float flushMs = result_.flushUsTotal / 1000.0f / sampled;
+    const char* name = SCENARIO_NAMES[static_cast<uint8_t>(scenario_)];
+
+    Serial.printf("[RenderBenchmark] %-5s fps=%.1f render=%.2f/%.2f ms flush=%.2f/%.2f ms "
+                  "lvgl=%lu/%lu KB (max used/peak)\n",
+                  name, fps, renderMs, result_.renderUsWorst / 1000.0f, flushMs,
+                  result_.flushUsWorst / 1000.0f,
+                  static_cast<unsigned long>(result_.memUsedMax / 1024),
+                  static_cast<unsigned long>(stats.memPeak / 1024));
+
+    if (summary_) {
+        // LVGL's builtin printf has no %f
+        char text[64];
+        snprintf(text, sizeof(text), "%s: %.1f fps, render %.2f ms, flush %.2f ms", name, fps,
+                 renderMs, flushMs);
+        lv_label_set_text(summary_, text);
+        lv_obj_move_foreground(summary_);
+    }
+}
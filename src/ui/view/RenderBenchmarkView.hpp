@@ -0,0 +1,102 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <memory>
+
+#include "adapter/display/ui/DisplayStats.hpp"
+#include "interface/IView.hpp"
+
+class IParameterWidget;
+class ListOverlay;
+class ParameterKnobLiteWidget;
+class ParameterKnobWidget;
+class ViewManager;
+
+template <typename Widget, size_t Capacity>
+class WidgetPool;
+
+/**
+ * @brief Fixed render workload, to compare lv_conf.h and driver settings
+ *
+ * Runs each scenario for System::Benchmark::RENDER_SCENARIO_MS, driven by an
+ * LVGL timer at the frame rate, then loops:
+ * - Knobs: 8 ParameterKnobWidget sweeping with phase offsets
+ * - Lite knobs: the same sweep on ParameterKnobLiteWidget (2 objects a knob)
+ *   Both come from a WidgetPool: built on their first run, reused after
+ * - List: ListOverlay with RENDER_LIST_ITEMS items, selection scrolling
+ * - Text: full screen of labels rewritten every frame
+ *
+ * After each scenario, fps, render / flush ms (average and worst) and LVGL
+ * memory (highest used while running, peak since boot) are printed on
+ * Serial and shown on screen. ViewController shows it at boot in
+ * RENDER_BENCHMARK builds or when the boot combo is held.
+ */
+class RenderBenchmarkView : public UI::IView {
+public:
+    explicit RenderBenchmarkView(ViewManager& viewManager);
+    ~RenderBenchmarkView() override;
+
+    bool create(lv_obj_t* parent) override;
+    void destroy() override;
+    void onActivate() override;
+    void onDeactivate() override;
+
+    const char* getViewId() const override {
+        return "core.render_benchmark";
+    }
+    lv_obj_t* getElement() const override {
+        return container_;
+    }
+
+private:
+    enum class Scenario : uint8_t { KNOBS, KNOBS_LITE, LIST, TEXT, COUNT };
+
+    static constexpr uint8_t KNOB_COUNT = 8;
+    static constexpr uint8_t TEXT_ROWS = 12;
+    static constexpr uint8_t TEXT_COLUMNS = 2;
+
+    struct Result {
+        uint32_t frames;
+        uint64_t renderUsTotal;
+        uint64_t flushUsTotal;
+        uint32_t renderUsWorst;
+        uint32_t flushUsWorst;
+        uint32_t memUsedMax;
+    };
+
+    static void stepCallback(lv_timer_t* timer);
+    void step();
+
+    void startScenario(Scenario scenario);
+    void buildScenario();
+    void animateScenario(uint32_t elapsedMs);
+    void teardownScenario();
+    void sample(const DisplayStats& stats);
+    void report(const DisplayStats& stats, uint32_t elapsedMs);
+
+    ViewManager& viewManager_;
+
+    lv_obj_t* container_ = nullptr;
+    lv_obj_t* stage_ = nullptr;   // Scenario objects, rebuilt per scenario
+    lv_obj_t* summary_ = nullptr; // Last results, on top
+    lv_timer_t* timer_ = nullptr;
+
+    using KnobPool = WidgetPool<ParameterKnobWidget, KNOB_COUNT>;
+    using LiteKnobPool = WidgetPool<ParameterKnobLiteWidget, KNOB_COUNT>;
+
+    lv_obj_t* parking_ = nullptr;  // Hidden parent of the pooled knobs
+    std::unique_ptr<KnobPool> knobPool_;
+    std::unique_ptr<LiteKnobPool> liteKnobPool_;
+    uint8_t knobsBuilt_ = 0;  // Color index of the next pooled knob
+    IParameterWidget* knobs_[KNOB_COUNT] = {};
+    std::unique_ptr<ListOverlay> list_;
+    lv_obj_t* labels_[TEXT_ROWS * TEXT_COLUMNS] = {};
+
+    Scenario scenario_ = Scenario::KNOBS;
+    uint32_t scenarioStartMs_ = 0;
+    uint32_t startFrames_ = 0;
+    uint32_t lastFrames_ = 0;
+    uint32_t tick_ = 0;
+    Result result_ = {};
+};
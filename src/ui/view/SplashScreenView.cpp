@@ -7,7 +7,7 @@
 SplashScreenView::Config::Config()
     : title(System::Application::NAME),
       version(System::Application::VERSION),
-      duration(1000),
+      duration(System::UI::SPLASH_DURATION_MS),
       bg_color(lv_color_hex(BaseTheme::Color::BACKGROUND)),
       text_color(lv_color_hex(BaseTheme::Color::TEXT_PRIMARY)),
       progress_color(lv_color_hex(BaseTheme::Color::TEXT_PRIMARY)) {}